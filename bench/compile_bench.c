@@ -0,0 +1,136 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * compile_bench.c  —  xenlyc compile-time scalability check
+ *
+ * Generates stress programs and times ./xenlyc on them.  Per 10 statements
+ * a program has one function, one global and five distinct string
+ * literals, so the 100k-statement program has 10k functions and 50k
+ * strings: every symbol table in sema and codegen is large.
+ *
+ * Compile time must grow linearly: the run fails (exit 1) when the
+ * 100k-line program costs more than BENCH_MAX_SLOWDOWN times as much per
+ * line as the 10k-line one.
+ *
+ * Usage:  make bench-compile
+ *         ./compile_bench [small large]      (statements, default 10k 100k)
+ *         ./compile_bench --gen N > big.xe   (just write a program)
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include "platform.h"
+
+#define BENCH_SMALL          10000
+#define BENCH_LARGE          100000
+#define BENCH_MAX_SLOWDOWN   2.0     /* per-line cost, large vs small       */
+#define BENCH_RUNS           3       /* best of                              */
+
+/* One unit: 10 statements, 1 function, 1 global, 5 string literals. */
+static void gen_program(FILE *out, long statements) {
+    long units = statements / 10;
+    fprintf(out, "// generated by bench/compile_bench.c: %ld statements\n", statements);
+    for (long i = 0; i < units; i++) {
+        fprintf(out,
+            "var g%ld = %ld\n"
+            "fn f%ld(a, b) {\n"
+            "    var y = a * %ld + b + g%ld - %ld\n"
+            "    if (y > %ld) {\n"
+            "        y = y - 1\n"
+            "    }\n"
+            "    print(\"f%ld: one\", y)\n"
+            "    print(\"f%ld: two\", \"f%ld: three\")\n"
+            "    return y\n"
+            "}\n"
+            "g%ld = f%ld(g%ld, %ld)\n"
+            "print(\"f%ld: four\", \"f%ld: five\")\n",
+            i, i,
+            i,
+            i, i, i % 7,
+            i,
+            i,
+            i, i,
+            i, i, i, i % 13,
+            i, i);
+    }
+}
+
+/* Milliseconds ./xenlyc takes on `src` (best of BENCH_RUNS), -1 on failure. */
+static double time_compile(const char *xenlyc, const char *src, const char *bin) {
+    double best = -1;
+    for (int r = 0; r < BENCH_RUNS; r++) {
+        uint64_t t0 = xly_nanotime();
+        pid_t pid = fork();
+        if (pid < 0) return -1;
+        if (pid == 0) {
+            if (!freopen("/dev/null", "w", stderr)) _exit(127);
+            execl(xenlyc, xenlyc, "--no-color", src, "-o", bin, (char *)NULL);
+            _exit(127);
+        }
+        int st = 0;
+        if (waitpid(pid, &st, 0) < 0 || !WIFEXITED(st) || WEXITSTATUS(st) != 0)
+            return -1;
+        double ms = (double)(xly_nanotime() - t0) / 1e6;
+        if (best < 0 || ms < best) best = ms;
+    }
+    return best;
+}
+
+static double bench_size(const char *xenlyc, const char *dir, long statements) {
+    char src[512], bin[512];
+    snprintf(src, sizeof(src), "%s/stress_%ld.xe", dir, statements);
+    snprintf(bin, sizeof(bin), "%s/stress_%ld", dir, statements);
+    FILE *f = fopen(src, "w");
+    if (!f) { perror(src); return -1; }
+    gen_program(f, statements);
+    fclose(f);
+    double ms = time_compile(xenlyc, src, bin);
+    if (ms < 0)
+        fprintf(stderr, "compile_bench: %s failed on %s\n", xenlyc, src);
+    else
+        printf("  %8ld statements  %9.1f ms  %7.2f us/statement\n",
+               statements, ms, ms * 1000.0 / (double)statements);
+    unlink(src);
+    unlink(bin);
+    return ms;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && strcmp(argv[1], "--gen") == 0) {
+        gen_program(stdout, strtol(argv[2], NULL, 10));
+        return 0;
+    }
+    long small = argc > 2 ? strtol(argv[1], NULL, 10) : BENCH_SMALL;
+    long large = argc > 2 ? strtol(argv[2], NULL, 10) : BENCH_LARGE;
+    const char *xenlyc = getenv("XENLYC") ? getenv("XENLYC") : "./xenlyc";
+
+    char dir[] = "/tmp/xly_compile_bench.XXXXXX";
+    if (!mkdtemp(dir)) { perror("mkdtemp"); return 1; }
+
+    printf("xenlyc compile time (%s, best of %d)\n", xenlyc, BENCH_RUNS);
+    double ts = bench_size(xenlyc, dir, small);
+    double tl = ts < 0 ? -1 : bench_size(xenlyc, dir, large);
+    rmdir(dir);
+    if (ts < 0 || tl < 0) return 1;
+
+    double slowdown = (tl / (double)large) / (ts / (double)small);
+    printf("  per-statement cost %ldx the size: %.2fx (limit %.1fx)\n",
+           large / small, slowdown, BENCH_MAX_SLOWDOWN);
+    if (slowdown > BENCH_MAX_SLOWDOWN) {
+        printf("✗ compile time grows super-linearly\n");
+        return 1;
+    }
+    printf("✓ compile time scales linearly\n");
+    return 0;
+}
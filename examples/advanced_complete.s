@@ -0,0 +1,3729 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1104, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movl    $-1, -1060(%rbp)
+    movl    $-1, -932(%rbp)
+    movl    $-1, -804(%rbp)
+    movl    $-1, -676(%rbp)
+    movl    $-1, -548(%rbp)
+    leaq    .Lxly_str_9055959c76a08936(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ddb82eefcc4b1957(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c9592b9451763f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_5c90e9aff57bff3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_f4dce41a0d0dda28(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_f8795eb9f7d0e640(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b6a54425834c8725(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_54a457637baa901b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_253e8db9be887112(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6fc288ef3d053ffd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_greet
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ad61063ec8147ccb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b2:
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_065daa5971b66760(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c5867ef9fe536fc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d4d82c06fafc346d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k321(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_multiply
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_87cc9b66c023d63c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b6:
+.Lxly_ir0_b8:
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b5:
+    leaq    .Lxly_ir0_k322(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a5550bb2c55b95dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k323(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_power
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c0284ad7cfbc879f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+.Lxly_ir0_b10:
+.Lxly_ir0_b12:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r12
+    movq    %r15, %r13
+.Lxly_ir0_b13:
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b14:
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %r12
+    movq    %rbx, %r13
+    jmp     .Lxly_ir0_b13
+.Lxly_ir0_b15:
+.Lxly_ir0_b9:
+    movq    %r13, %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_741b5193545fdb6d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    -48(%rbp), %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_createUser
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_154339ba6e1a5b21(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_16566419b10316b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k325(%rip), %rax
+    movq    %rax, -88(%rbp)
+    movq    %rbx, %rdi
+    movq    -88(%rbp), %rsi
+    xorl    %edx, %edx
+    call    .Lxly_fn_createUser
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_203662e4ed0e4300(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_6f7c78a17ba65ed2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_str_e5cde7fdda328454(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir0_k326(%rip), %rax
+    movq    %rax, -104(%rbp)
+    movq    %r12, %rdi
+    movq    -104(%rbp), %rsi
+    movq    -96(%rbp), %rdx
+    call    .Lxly_fn_createUser
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_068cfe94aa626275(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_22ea317a11573594(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorl    %edi, %edi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_connect
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2e9a9e8147f7a4f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_576846634e2714c6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_connect
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4220810e0aa82d2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_str_20638d06cbb7b448(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x407bb00000000000, %rax
+    movq    %rax, %r13
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k327(%rip), %rax
+    movq    %rax, -128(%rbp)
+    movq    %rbx, %rdi
+    movq    -128(%rbp), %rsi
+    movq    -120(%rbp), %rdx
+    call    .Lxly_fn_connect
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ea819bb0a28605c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k328(%rip), %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k329(%rip), %rax
+    movq    %rax, %r15
+    movq    -136(%rbp), %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_Vector
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k330(%rip), %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k331(%rip), %rax
+    movq    %rax, -152(%rbp)
+    movq    -144(%rbp), %rdi
+    movq    -152(%rbp), %rsi
+    call    .Lxly_fn_Vector
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_e70bc3190530e654(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+    movq    -160(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_ir0_k332(%rip), %rax
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_4a658105ca1038e5(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_8907177d220621be(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_c5c8cdb28370e485(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -184(%rbp)
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8911997d220f5329(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    leaq    .Lxly_str_c5c8cdb28370e485(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8bf6e3bed2f38818(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    -160(%rbp), %rdi
+    leaq    .Lxly_str_c5c8cdb28370e485(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_842023a9ddbcb35f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    leaq    .Lxly_str_c5c8cdb28370e485(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4c970639e0e71bd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k333(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_ir0_k334(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k335(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k336(%rip), %rax
+    movq    %rax, -200(%rbp)
+    movq    %r13, %rdi
+    movq    -200(%rbp), %rsi
+    call    .Lxly_fn_Vector
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_7616f6e1a999bf14(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b17:
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -208(%rbp)
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -216(%rbp)
+    movq    -208(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -216(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -224(%rbp)
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -232(%rbp)
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -240(%rbp)
+    movq    -232(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -240(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    -224(%rbp), %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b16:
+    movq    %r12, %xmm0
+    movsd   %xmm0, -704(%rbp)
+    leaq    -712(%rbp), %rax
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7fa0a1e1af401ebd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b19:
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -264(%rbp)
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    -264(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -272(%rbp)
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -280(%rbp)
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    -280(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    -272(%rbp), %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b18:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -832(%rbp)
+    leaq    -840(%rbp), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_efc2322b618a1b49(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    .Lxly_fn_Animal
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    call    .Lxly_fn_Dog
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    call    .Lxly_fn_Cat
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_d1188a8a44e93ecd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -288(%rbp)
+.Lxly_ir0_b21:
+    movq    %r12, %rdi
+    leaq    .Lxly_str_65d3e9609806fe14(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -296(%rbp)
+.Lxly_ir0_b20:
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ec9d937df9c11aeb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b23:
+    movq    %r13, %rdi
+    leaq    .Lxly_str_65d3e9609806fe14(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -304(%rbp)
+.Lxly_ir0_b22:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bba918ca9f8a471d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b25:
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_65d3e9609806fe14(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r13
+.Lxly_ir0_b24:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_149d7e4f173b90e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_88bdc42e6d5a6de9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_046c2b8f7bfcd5f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    call    .Lxly_fn_httpRequest
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_188f4d0b7d47ed42(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_a048aa190bf19f87(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    call    .Lxly_fn_httpRequest
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6a2142cc68748b0a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_ea7e631998067e17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, -320(%rbp)
+    leaq    .Lxly_ir0_k339(%rip), %rax
+    movq    %rax, -328(%rbp)
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    movq    -328(%rbp), %rdx
+    xorl    %ecx, %ecx
+    call    .Lxly_fn_httpRequest
+    movq    %rax, -336(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -336(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4be3b07e32d80659(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorl    %edi, %edi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_configure
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c4a15eea2a28163a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_configure
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7c90917f05bfe1a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x40bf900000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k340(%rip), %rax
+    movq    %rax, -344(%rbp)
+    movq    %r13, %rdi
+    movq    -120(%rbp), %rsi
+    movq    -344(%rbp), %rdx
+    call    .Lxly_fn_configure
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_13f3d48fec617fac(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0b8ea86e491b575c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_log
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4dcc0bedd45426c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_82baf0d0b4af7ad8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    xorl    %edx, %edx
+    call    .Lxly_fn_log
+    movq    %rax, -352(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b038d5d5577c5cac(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_9cd17b50848c4c11(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_ffc58fbc52fb70dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    movq    -360(%rbp), %rdx
+    call    .Lxly_fn_log
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b3f99657246819a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_66f92d953e603bcd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k341(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_round
+    movq    %rax, -376(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9cf3cbac659ee51c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b27:
+.Lxly_ir0_b29:
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k342(%rip), %rax
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir0_k343(%rip), %rax
+    movq    %rax, -392(%rbp)
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -392(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_pow
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -400(%rbp)
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, %r13
+    movq    -400(%rbp), %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -408(%rbp)
+    movq    -408(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -416(%rbp)
+    subq    $16, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_floor
+    addq    $16, %rsp
+    movq    %rax, -424(%rbp)
+    movq    -424(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -432(%rbp)
+.Lxly_ir0_b26:
+    movq    -432(%rbp), %xmm0
+    movsd   %xmm0, -960(%rbp)
+    leaq    -968(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e8e119be56900ef8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4005bf0995aaf790, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b31:
+.Lxly_ir0_b33:
+    leaq    .Lxly_ir0_k346(%rip), %rax
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_ir0_k347(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_pow
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_floor
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b30:
+    movq    %r13, %xmm0
+    movsd   %xmm0, -1088(%rbp)
+    leaq    -1096(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_dafbdb2f6cf54162(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k321:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k322:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k323:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k325:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k326:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k327:
+    .quad   0, 0x407bb00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k328:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k329:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k330:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k331:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k332:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k333:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k334:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k335:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k336:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k339:
+    .quad   0, 0x404e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k340:
+    .quad   0, 0x40bf900000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k341:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k342:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k343:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k346:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k347:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_greet:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $320, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -276(%rbp)
+    movl    $-1, -148(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b4
+.Lxly_irf0_0_b1:
+    call    xly_null
+    movq    %rax, %r13
+    jmp     .Lxly_irf0_0_b2
+.Lxly_irf0_0_b4:
+    movq    %r12, %r13
+.Lxly_irf0_0_b2:
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af639c4c86017fcc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_6
+.Lxly_f0_5:
+    call    xly_add
+.Lxly_f0_6:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b4
+.Lxly_irf1_0_b1:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf1_0_k12(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf1_0_b2
+.Lxly_irf1_0_b4:
+    movq    %r12, %r14
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k12:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_power:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b7
+.Lxly_irf2_0_b1:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf2_0_k25(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, -64(%rbp)
+    jmp     .Lxly_irf2_0_b2
+.Lxly_irf2_0_b7:
+    movq    %r12, -64(%rbp)
+.Lxly_irf2_0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r15
+    movq    %r12, %rbx
+.Lxly_irf2_0_b3:
+    movq    %r15, %xmm0
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b5
+.Lxly_irf2_0_b4:
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    movq    %r13, %rbx
+    jmp     .Lxly_irf2_0_b3
+.Lxly_irf2_0_b5:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k25:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_createUser:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $592, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf3_0_b6
+.Lxly_irf3_0_b1:
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf3_0_k29(%rip), %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf3_0_b2
+.Lxly_irf3_0_b6:
+    movq    %r12, %r15
+.Lxly_irf3_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b7
+.Lxly_irf3_0_b3:
+    leaq    .Lxly_str_7d6780e4032b48f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    jmp     .Lxly_irf3_0_b4
+.Lxly_irf3_0_b7:
+    movq    %r13, %r12
+.Lxly_irf3_0_b4:
+    leaq    .Lxly_str_1862b8477b947ba6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_add
+.Lxly_f3_2:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f3_4
+.Lxly_f3_3:
+    call    xly_add
+.Lxly_f3_4:
+    movq    %rax, %r15
+    leaq    .Lxly_str_fd037a2d2b44115f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f3_6
+.Lxly_f3_5:
+    call    xly_add
+.Lxly_f3_6:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f3_8
+.Lxly_f3_7:
+    call    xly_add
+.Lxly_f3_8:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f3_10
+.Lxly_f3_9:
+    call    xly_add
+.Lxly_f3_10:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf3_0_k29:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_connect:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $720, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -676(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %rbx
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf4_0_b8
+.Lxly_irf4_0_b1:
+    leaq    .Lxly_str_db3f053403ad937a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    jmp     .Lxly_irf4_0_b2
+.Lxly_irf4_0_b8:
+    movq    %rbx, %r14
+.Lxly_irf4_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf4_0_b9
+.Lxly_irf4_0_b3:
+    movabsq $0x40bf900000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf4_0_k39(%rip), %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf4_0_b4
+.Lxly_irf4_0_b9:
+    movq    %r12, %r15
+.Lxly_irf4_0_b4:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf4_0_b10
+.Lxly_irf4_0_b5:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    jmp     .Lxly_irf4_0_b6
+.Lxly_irf4_0_b10:
+    movq    %r13, %r12
+.Lxly_irf4_0_b6:
+    leaq    .Lxly_str_ce03a0c180efe40c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_add
+.Lxly_f4_2:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_af63b74c8601adad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f4_4
+.Lxly_f4_3:
+    call    xly_add
+.Lxly_f4_4:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f4_6
+.Lxly_f4_5:
+    call    xly_add
+.Lxly_f4_6:
+    movq    %rax, %r15
+    leaq    .Lxly_str_0811dc3f7742d68f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f4_8
+.Lxly_f4_7:
+    call    xly_add
+.Lxly_f4_8:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -704(%rbp)
+    leaq    -712(%rbp), %rax
+    jmp     .Lxly_f4_10
+.Lxly_f4_9:
+    call    xly_add
+.Lxly_f4_10:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_12
+.Lxly_f4_11:
+    call    xly_add
+.Lxly_f4_12:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf4_0_k39:
+    .quad   0, 0x40bf900000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Vector:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    call    xly_obj_new
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_add__f5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_e70bc3190530e654(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_multiply__f5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_4a658105ca1038e5(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_toString__f5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_c5c8cdb28370e485(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_distance:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_processAnimal:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_65d3e9609806fe14(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Animal:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_sound__f8(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_65d3e9609806fe14(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_d294121372903b3d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_a79439ef7bfa9c2d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Dog:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_sound__f9(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_65d3e9609806fe14(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_e0b75b19922bd249(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_a79439ef7bfa9c2d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Cat:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_sound__f10(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_65d3e9609806fe14(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_0bec2719aa9daf87(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_a79439ef7bfa9c2d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_httpRequest:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $752, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    xorl    %eax, %eax
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movl    $-1, -708(%rbp)
+    movl    $-1, -580(%rbp)
+    movl    $-1, -452(%rbp)
+    movl    $-1, -324(%rbp)
+    movl    $-1, -196(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf11_0_b11
+.Lxly_irf11_0_b1:
+    leaq    .Lxly_str_ea7e631998067e17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    jmp     .Lxly_irf11_0_b2
+.Lxly_irf11_0_b11:
+    movq    %r12, %r15
+.Lxly_irf11_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf11_0_b12
+.Lxly_irf11_0_b3:
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf11_0_k53(%rip), %rax
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %r12
+    jmp     .Lxly_irf11_0_b4
+.Lxly_irf11_0_b12:
+    movq    %r13, %r12
+.Lxly_irf11_0_b4:
+    xorl    %eax, %eax
+    cmpq    $0, %r14
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf11_0_b13
+.Lxly_irf11_0_b5:
+    call    xly_null
+    movq    %rax, %r13
+    jmp     .Lxly_irf11_0_b6
+.Lxly_irf11_0_b13:
+    movq    %r14, %r13
+.Lxly_irf11_0_b6:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f11_2
+.Lxly_f11_1:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f11_2:
+    movq    %rax, -88(%rbp)
+    cmpq    $0, -88(%rbp)
+    je      .Lxly_irf11_0_b8
+.Lxly_irf11_0_b7:
+    leaq    .Lxly_str_738b745b44fc8f69(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf11_0_b9
+.Lxly_irf11_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_irf11_0_b9:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -224(%rbp)
+    leaq    -232(%rbp), %rax
+    jmp     .Lxly_f11_4
+.Lxly_f11_3:
+    call    xly_add
+.Lxly_f11_4:
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -352(%rbp)
+    leaq    -360(%rbp), %rax
+    jmp     .Lxly_f11_6
+.Lxly_f11_5:
+    call    xly_add
+.Lxly_f11_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_9eed8a08fa89d672(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -480(%rbp)
+    leaq    -488(%rbp), %rax
+    jmp     .Lxly_f11_8
+.Lxly_f11_7:
+    call    xly_add
+.Lxly_f11_8:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -608(%rbp)
+    leaq    -616(%rbp), %rax
+    jmp     .Lxly_f11_10
+.Lxly_f11_9:
+    call    xly_add
+.Lxly_f11_10:
+    movq    %rax, %r12
+    leaq    .Lxly_str_08d8f707b578c3b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -736(%rbp)
+    leaq    -744(%rbp), %rax
+    jmp     .Lxly_f11_12
+.Lxly_f11_11:
+    call    xly_add
+.Lxly_f11_12:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f11_14
+.Lxly_f11_13:
+    call    xly_add
+.Lxly_f11_14:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf11_0_k53:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_configure:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $592, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %rbx
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf12_0_b8
+.Lxly_irf12_0_b1:
+    leaq    .Lxly_str_2216f9f8caae0f8a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    jmp     .Lxly_irf12_0_b2
+.Lxly_irf12_0_b8:
+    movq    %rbx, %r14
+.Lxly_irf12_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf12_0_b9
+.Lxly_irf12_0_b3:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    jmp     .Lxly_irf12_0_b4
+.Lxly_irf12_0_b9:
+    movq    %r12, %rbx
+.Lxly_irf12_0_b4:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf12_0_b10
+.Lxly_irf12_0_b5:
+    movabsq $0x40a7700000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf12_0_k37(%rip), %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf12_0_b6
+.Lxly_irf12_0_b10:
+    movq    %r13, %r15
+.Lxly_irf12_0_b6:
+    leaq    .Lxly_str_8e3612f14003b7ab(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f12_2
+.Lxly_f12_1:
+    call    xly_add
+.Lxly_f12_2:
+    movq    %rax, %r12
+    leaq    .Lxly_str_7ec4c4179ba217f3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f12_4
+.Lxly_f12_3:
+    call    xly_add
+.Lxly_f12_4:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f12_6
+.Lxly_f12_5:
+    call    xly_add
+.Lxly_f12_6:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_4cd38fc5b5d35dfd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f12_8
+.Lxly_f12_7:
+    call    xly_add
+.Lxly_f12_8:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f12_10
+.Lxly_f12_9:
+    call    xly_add
+.Lxly_f12_10:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf12_0_k37:
+    .quad   0, 0x40a7700000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_log:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $592, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf13_0_b9
+.Lxly_irf13_0_b1:
+    leaq    .Lxly_str_0ac7a9d0decc0bc5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    jmp     .Lxly_irf13_0_b2
+.Lxly_irf13_0_b9:
+    movq    %r12, %r14
+.Lxly_irf13_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf13_0_b10
+.Lxly_irf13_0_b3:
+    call    xly_null
+    movq    %rax, %r12
+    jmp     .Lxly_irf13_0_b4
+.Lxly_irf13_0_b10:
+    movq    %r13, %r12
+.Lxly_irf13_0_b4:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f13_2
+.Lxly_f13_1:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f13_2:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf13_0_b6
+.Lxly_irf13_0_b5:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f13_4
+.Lxly_f13_3:
+    call    xly_add
+.Lxly_f13_4:
+    movq    %rax, %r13
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f13_6
+.Lxly_f13_5:
+    call    xly_add
+.Lxly_f13_6:
+    movq    %rax, %r12
+    jmp     .Lxly_irf13_0_b7
+.Lxly_irf13_0_b6:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %r12
+.Lxly_irf13_0_b7:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f13_8
+.Lxly_f13_7:
+    call    xly_add
+.Lxly_f13_8:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f13_10
+.Lxly_f13_9:
+    call    xly_add
+.Lxly_f13_10:
+    movq    %rax, %r15
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f13_12
+.Lxly_f13_11:
+    call    xly_add
+.Lxly_f13_12:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f13_14
+.Lxly_f13_13:
+    call    xly_add
+.Lxly_f13_14:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_round:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf14_0_b4
+.Lxly_irf14_0_b1:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf14_0_k18(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf14_0_b2
+.Lxly_irf14_0_b4:
+    movq    %r12, %r14
+.Lxly_irf14_0_b2:
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf14_0_k19(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_pow
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, %rbx
+    movq    %r13, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_floor
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf14_0_k18:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf14_0_k19:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add__f5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    call    xly_null
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f15_2
+.Lxly_f15_1:
+    call    xly_add
+.Lxly_f15_2:
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f15_4
+.Lxly_f15_3:
+    call    xly_add
+.Lxly_f15_4:
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_Vector
+
+.Lxly_fn_multiply__f5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    call    xly_null
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_Vector
+
+.Lxly_fn_toString__f5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $416, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -380(%rbp)
+    movl    $-1, -252(%rbp)
+    movl    $-1, -124(%rbp)
+    leaq    .Lxly_str_679f658bb90835be(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f17_2
+.Lxly_f17_1:
+    call    xly_add
+.Lxly_f17_2:
+    movq    %rax, %r14
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -280(%rbp)
+    leaq    -288(%rbp), %rax
+    jmp     .Lxly_f17_4
+.Lxly_f17_3:
+    call    xly_add
+.Lxly_f17_4:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -408(%rbp)
+    leaq    -416(%rbp), %rax
+    jmp     .Lxly_f17_6
+.Lxly_f17_5:
+    call    xly_add
+.Lxly_f17_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f17_8
+.Lxly_f17_7:
+    call    xly_add
+.Lxly_f17_8:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_sound__f8:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    leaq    .Lxly_str_22d32424854b119d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_sound__f9:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    leaq    .Lxly_str_6d8f00c51a65f9bd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_sound__f10:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    leaq    .Lxly_str_9e42452e42e2b194(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   7
+.Lxly_atoms:
+.Lxly_atom_af63f54c86021707:
+    .quad   .Lxly_str_af63f54c86021707
+.Lxly_atom_af63f44c86021554:
+    .quad   .Lxly_str_af63f44c86021554
+.Lxly_atom_e70bc3190530e654:
+    .quad   .Lxly_str_e70bc3190530e654
+.Lxly_atom_4a658105ca1038e5:
+    .quad   .Lxly_str_4a658105ca1038e5
+.Lxly_atom_c5c8cdb28370e485:
+    .quad   .Lxly_str_c5c8cdb28370e485
+.Lxly_atom_65d3e9609806fe14:
+    .quad   .Lxly_str_65d3e9609806fe14
+.Lxly_atom_a79439ef7bfa9c2d:
+    .quad   .Lxly_str_a79439ef7bfa9c2d
+
+.section .rodata
+.Lxly_str_9055959c76a08936:
+    .asciz  "=== Advanced Language Features Test ==="
+.Lxly_str_ddb82eefcc4b1957:
+    .asciz  "1. Raw Strings (\342\234\205 Fully Working):"
+.Lxly_str_4c9592b9451763f5:
+    .asciz  "\\d+\\.\\d+"
+.Lxly_str_5c90e9aff57bff3e:
+    .asciz  "C:\\Users\\Documents\\file.txt"
+.Lxly_str_f4dce41a0d0dda28:
+    .asciz  "SELECT * FROM users WHERE name = 'test'"
+.Lxly_str_f8795eb9f7d0e640:
+    .asciz  "  Regex pattern:"
+.Lxly_str_b6a54425834c8725:
+    .asciz  "  Windows path:"
+.Lxly_str_54a457637baa901b:
+    .asciz  "  SQL query:"
+.Lxly_str_253e8db9be887112:
+    .asciz  "2. Optional Parameters (\342\234\205 Fully Working):"
+.Lxly_str_6fc288ef3d053ffd:
+    .asciz  "  greet('Alice'):"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_ad61063ec8147ccb:
+    .asciz  "  greet('Bob', 'Hi'):"
+.Lxly_str_065daa5971b66760:
+    .asciz  "Hi, Bob!"
+.Lxly_str_c5867ef9fe536fc0:
+    .asciz  "3. Default Parameters (\342\234\205 Fully Working):"
+.Lxly_str_d4d82c06fafc346d:
+    .asciz  "  multiply(5):"
+.Lxly_str_87cc9b66c023d63c:
+    .asciz  "  multiply(5, 3):"
+.Lxly_str_a5550bb2c55b95dc:
+    .asciz  "  power(3):"
+.Lxly_str_c0284ad7cfbc879f:
+    .asciz  "  power(3, 3):"
+.Lxly_str_741b5193545fdb6d:
+    .asciz  "  createUser('Alice'):"
+.Lxly_str_154339ba6e1a5b21:
+    .asciz  "  createUser('Bob', 25):"
+.Lxly_str_16566419b10316b4:
+    .asciz  "Bob"
+.Lxly_str_203662e4ed0e4300:
+    .asciz  "  createUser('Carol', 30, 'admin'):"
+.Lxly_str_6f7c78a17ba65ed2:
+    .asciz  "Carol"
+.Lxly_str_e5cde7fdda328454:
+    .asciz  "admin"
+.Lxly_str_068cfe94aa626275:
+    .asciz  "4. Named Parameters (Pattern-based approach):"
+.Lxly_str_22ea317a11573594:
+    .asciz  "  connect():"
+.Lxly_str_2e9a9e8147f7a4f1:
+    .asciz  "  connect('example.com'):"
+.Lxly_str_576846634e2714c6:
+    .asciz  "example.com"
+.Lxly_str_4220810e0aa82d2e:
+    .asciz  "  connect('api.com', 443, true):"
+.Lxly_str_20638d06cbb7b448:
+    .asciz  "api.com"
+.Lxly_str_ea819bb0a28605c2:
+    .asciz  "5. Operator Overloading (Method-based pattern):"
+.Lxly_str_e70bc3190530e654:
+    .asciz  "add"
+.Lxly_str_4a658105ca1038e5:
+    .asciz  "multiply"
+.Lxly_str_8907177d220621be:
+    .asciz  "  v1:"
+.Lxly_str_c5c8cdb28370e485:
+    .asciz  "toString"
+.Lxly_str_8911997d220f5329:
+    .asciz  "  v2:"
+.Lxly_str_8bf6e3bed2f38818:
+    .asciz  "  v1.add(v2):"
+.Lxly_str_842023a9ddbcb35f:
+    .asciz  "  v1.multiply(2):"
+.Lxly_str_4c970639e0e71bd8:
+    .asciz  "6. Anonymous Types (Structural typing pattern):"
+.Lxly_str_7616f6e1a999bf14:
+    .asciz  "  distance(point1):"
+.Lxly_str_7fa0a1e1af401ebd:
+    .asciz  "  distance(point2):"
+.Lxly_str_efc2322b618a1b49:
+    .asciz  "7. Covariance & Contravariance (Dynamic typing patterns):"
+.Lxly_str_d1188a8a44e93ecd:
+    .asciz  "  processAnimal(animal):"
+.Lxly_str_65d3e9609806fe14:
+    .asciz  "sound"
+.Lxly_str_ec9d937df9c11aeb:
+    .asciz  "  processAnimal(dog):"
+.Lxly_str_bba918ca9f8a471d:
+    .asciz  "  processAnimal(cat):"
+.Lxly_str_149d7e4f173b90e5:
+    .asciz  "=== Practical Examples ==="
+.Lxly_str_88bdc42e6d5a6de9:
+    .asciz  "HTTP Requests:"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_046c2b8f7bfcd5f2:
+    .asciz  "https://api.example.com/users"
+.Lxly_str_188f4d0b7d47ed42:
+    .asciz  "https://api.example.com/data"
+.Lxly_str_a048aa190bf19f87:
+    .asciz  "POST"
+.Lxly_str_6a2142cc68748b0a:
+    .asciz  "https://api.example.com/stream"
+.Lxly_str_ea7e631998067e17:
+    .asciz  "GET"
+.Lxly_str_4be3b07e32d80659:
+    .asciz  "Configuration:"
+.Lxly_str_c4a15eea2a28163a:
+    .asciz  "production"
+.Lxly_str_7c90917f05bfe1a6:
+    .asciz  "staging"
+.Lxly_str_13f3d48fec617fac:
+    .asciz  "Logging:"
+.Lxly_str_0b8ea86e491b575c:
+    .asciz  "Application started"
+.Lxly_str_4dcc0bedd45426c3:
+    .asciz  "Connection established"
+.Lxly_str_82baf0d0b4af7ad8:
+    .asciz  "DEBUG"
+.Lxly_str_b038d5d5577c5cac:
+    .asciz  "Error occurred"
+.Lxly_str_9cd17b50848c4c11:
+    .asciz  "ERROR"
+.Lxly_str_ffc58fbc52fb70dd:
+    .asciz  "2024-02-15 10:30:00"
+.Lxly_str_b3f99657246819a5:
+    .asciz  "Rounding:"
+.Lxly_str_66f92d953e603bcd:
+    .asciz  "  round(3.14159):"
+.Lxly_str_9cf3cbac659ee51c:
+    .asciz  "  round(3.14159, 3):"
+.Lxly_str_e8e119be56900ef8:
+    .asciz  "  round(2.71828, 4):"
+.Lxly_str_dafbdb2f6cf54162:
+    .asciz  "\342\234\205 All advanced features working!"
+.Lxly_str_07d38007b49acdd1:
+    .asciz  ", "
+.Lxly_str_af639c4c86017fcc:
+    .asciz  "!"
+.Lxly_str_7d6780e4032b48f2:
+    .asciz  "user"
+.Lxly_str_1862b8477b947ba6:
+    .asciz  " (age: "
+.Lxly_str_fd037a2d2b44115f:
+    .asciz  ", role: "
+.Lxly_str_af63a44c86018d64:
+    .asciz  ")"
+.Lxly_str_db3f053403ad937a:
+    .asciz  "localhost"
+.Lxly_str_ce03a0c180efe40c:
+    .asciz  "Connecting to "
+.Lxly_str_af63b74c8601adad:
+    .asciz  ":"
+.Lxly_str_0811dc3f7742d68f:
+    .asciz  " (SSL: "
+.Lxly_str_d294121372903b3d:
+    .asciz  "Animal"
+.Lxly_str_e0b75b19922bd249:
+    .asciz  "Dog"
+.Lxly_str_0bec2719aa9daf87:
+    .asciz  "Cat"
+.Lxly_str_738b745b44fc8f69:
+    .asciz  " with headers"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_9eed8a08fa89d672:
+    .asciz  " (timeout: "
+.Lxly_str_08d8f707b578c3b1:
+    .asciz  "s)"
+.Lxly_str_2216f9f8caae0f8a:
+    .asciz  "development"
+.Lxly_str_8e3612f14003b7ab:
+    .asciz  "Config: env="
+.Lxly_str_7ec4c4179ba217f3:
+    .asciz  ", debug="
+.Lxly_str_4cd38fc5b5d35dfd:
+    .asciz  ", port="
+.Lxly_str_0ac7a9d0decc0bc5:
+    .asciz  "INFO"
+.Lxly_str_af64164c86024f1a:
+    .asciz  "["
+.Lxly_str_094c7a07b5dadfd8:
+    .asciz  "] "
+.Lxly_str_679f658bb90835be:
+    .asciz  "Vector("
+.Lxly_str_22d32424854b119d:
+    .asciz  "Generic animal sound"
+.Lxly_str_6d8f00c51a65f9bd:
+    .asciz  "Woof!"
+.Lxly_str_9e42452e42e2b194:
+    .asciz  "Meow!"
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_af63f44c86021554:
+    .asciz  "y"
+.Lxly_str_a79439ef7bfa9c2d:
+    .asciz  "type"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   12
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   96
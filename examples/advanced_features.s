@@ -0,0 +1,1996 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_2681c764338cbc18(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_bf8f854ea50fd678(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_07185460e2edbcd3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_7decfcaf6920619f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_13c1d3fb0030910c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_288ef0cf17275689(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c9592b9451763f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_5c90e9aff57bff3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_f38bbcfd8cf7e72e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_920751759e060d3c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ba1e9be036585865(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6fc288ef3d053ffd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_greet
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ad61063ec8147ccb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b2:
+.Lxly_ir0_b4:
+.Lxly_ir0_b6:
+    leaq    .Lxly_str_065daa5971b66760(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b11121bc529553c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d4d82c06fafc346d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k173(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_multiply
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_87cc9b66c023d63c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b8:
+.Lxly_ir0_b10:
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b7:
+    leaq    .Lxly_ir0_k174(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_741b5193545fdb6d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_createUser
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_154339ba6e1a5b21(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_16566419b10316b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k175(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    xorl    %edx, %edx
+    call    .Lxly_fn_createUser
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_203662e4ed0e4300(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_6f7c78a17ba65ed2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_e5cde7fdda328454(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k176(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    movq    %rbx, %rdx
+    call    .Lxly_fn_createUser
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_256c67ff2bf1b0e9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3e0f8d5e5f34aafb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b82d343f544cb67c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1b0833d12b5d0249(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a80bf103266e3373(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_753095968d92ca80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a2c548bab4f0bf2f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3a4cfa31733aaad6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_08f03e80ec55e1f3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_86379045cb859721(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_78f46fb425f54d55(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e36693017ede8d39(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c5b79ec935384e91(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1a301b115909c072(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8c728a2eb0dcb4d2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f289bd238e792fbb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_071d27689f3510b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_03265253a4dcbf60(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ebefc24e8c56ced2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e1d44cb8512b3e0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3c3c52b0d48b97c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_149d7e4f173b90e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c807b65bc13ee881(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_b89f2bdc5d5638a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_31e4bf7aeb04f8d9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    xorl    %esi, %esi
+    call    .Lxly_fn_log
+    movq    %rax, %r14
+    leaq    .Lxly_str_4dcc0bedd45426c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_82baf0d0b4af7ad8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_log
+    movq    %rax, %rbx
+    leaq    .Lxly_str_4f745cff92adcce4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_9f3da202cb7049f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_log
+    movq    %rax, %r14
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_046c2b8f7bfcd5f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    call    .Lxly_fn_httpRequest
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_188f4d0b7d47ed42(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_a048aa190bf19f87(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    xorl    %edx, %edx
+    call    .Lxly_fn_httpRequest
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6a2142cc68748b0a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_ea7e631998067e17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k177(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    movq    %r12, %rdx
+    call    .Lxly_fn_httpRequest
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9ceff3e79c465b8a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k173:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k174:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k175:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k176:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k177:
+    .quad   0, 0x404e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_greet:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $320, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -276(%rbp)
+    movl    $-1, -148(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b6
+.Lxly_irf0_0_b1:
+    call    xly_null
+    movq    %rax, %r13
+    jmp     .Lxly_irf0_0_b2
+.Lxly_irf0_0_b6:
+    movq    %r12, %r13
+.Lxly_irf0_0_b2:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f0_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf0_0_b7
+.Lxly_irf0_0_b3:
+    leaq    .Lxly_str_63f0bfacf2c00f6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    jmp     .Lxly_irf0_0_b4
+.Lxly_irf0_0_b7:
+    movq    %r13, %r14
+.Lxly_irf0_0_b4:
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    jmp     .Lxly_f0_6
+.Lxly_f0_5:
+    call    xly_add
+.Lxly_f0_6:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af639c4c86017fcc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_8
+.Lxly_f0_7:
+    call    xly_add
+.Lxly_f0_8:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b4
+.Lxly_irf1_0_b1:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf1_0_k12(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf1_0_b2
+.Lxly_irf1_0_b4:
+    movq    %r12, %r14
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k12:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_createUser:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $592, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf2_0_b6
+.Lxly_irf2_0_b1:
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf2_0_k29(%rip), %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf2_0_b2
+.Lxly_irf2_0_b6:
+    movq    %r12, %r15
+.Lxly_irf2_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf2_0_b7
+.Lxly_irf2_0_b3:
+    leaq    .Lxly_str_7d6780e4032b48f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    jmp     .Lxly_irf2_0_b4
+.Lxly_irf2_0_b7:
+    movq    %r13, %r12
+.Lxly_irf2_0_b4:
+    leaq    .Lxly_str_07c5a007b48ec6d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f2_4
+.Lxly_f2_3:
+    call    xly_add
+.Lxly_f2_4:
+    movq    %rax, %r15
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f2_6
+.Lxly_f2_5:
+    call    xly_add
+.Lxly_f2_6:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f2_8
+.Lxly_f2_7:
+    call    xly_add
+.Lxly_f2_8:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_10
+.Lxly_f2_9:
+    call    xly_add
+.Lxly_f2_10:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k29:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_createPoint:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    call    xly_obj_new
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_getX__f3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_67281271efacc45d(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_getY__f3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_67281171efacc2aa(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_toString__f3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_c5c8cdb28370e485(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_log:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $576, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movl    $-1, -540(%rbp)
+    movl    $-1, -412(%rbp)
+    movl    $-1, -284(%rbp)
+    movl    $-1, -156(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf4_0_b6
+.Lxly_irf4_0_b1:
+    call    xly_null
+    movq    %rax, %r13
+    jmp     .Lxly_irf4_0_b2
+.Lxly_irf4_0_b6:
+    movq    %r12, %r13
+.Lxly_irf4_0_b2:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf4_0_b4
+.Lxly_irf4_0_b3:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -184(%rbp)
+    leaq    -192(%rbp), %rax
+    jmp     .Lxly_f4_4
+.Lxly_f4_3:
+    call    xly_add
+.Lxly_f4_4:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af64104c860244e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_6
+.Lxly_f4_5:
+    call    xly_add
+.Lxly_f4_6:
+    movq    %rax, %r13
+    jmp     .Lxly_irf4_0_b5
+.Lxly_irf4_0_b4:
+    leaq    .Lxly_str_33af862adb3e226d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_irf4_0_b5:
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -312(%rbp)
+    leaq    -320(%rbp), %rax
+    jmp     .Lxly_f4_8
+.Lxly_f4_7:
+    call    xly_add
+.Lxly_f4_8:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -440(%rbp)
+    leaq    -448(%rbp), %rax
+    jmp     .Lxly_f4_10
+.Lxly_f4_9:
+    call    xly_add
+.Lxly_f4_10:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -568(%rbp)
+    leaq    -576(%rbp), %rax
+    jmp     .Lxly_f4_12
+.Lxly_f4_11:
+    call    xly_add
+.Lxly_f4_12:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_httpRequest:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $720, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -676(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf5_0_b6
+.Lxly_irf5_0_b1:
+    leaq    .Lxly_str_ea7e631998067e17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    jmp     .Lxly_irf5_0_b2
+.Lxly_irf5_0_b6:
+    movq    %r12, %r14
+.Lxly_irf5_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf5_0_b7
+.Lxly_irf5_0_b3:
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf5_0_k31(%rip), %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf5_0_b4
+.Lxly_irf5_0_b7:
+    movq    %r13, %r15
+.Lxly_irf5_0_b4:
+    leaq    .Lxly_str_d23be57df7ae7908(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f5_4
+.Lxly_f5_3:
+    call    xly_add
+.Lxly_f5_4:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f5_6
+.Lxly_f5_5:
+    call    xly_add
+.Lxly_f5_6:
+    movq    %rax, %r13
+    leaq    .Lxly_str_9eed8a08fa89d672(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f5_8
+.Lxly_f5_7:
+    call    xly_add
+.Lxly_f5_8:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -704(%rbp)
+    leaq    -712(%rbp), %rax
+    jmp     .Lxly_f5_10
+.Lxly_f5_9:
+    call    xly_add
+.Lxly_f5_10:
+    movq    %rax, %r15
+    leaq    .Lxly_str_08d8f707b578c3b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_12
+.Lxly_f5_11:
+    call    xly_add
+.Lxly_f5_12:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf5_0_k31:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_getX__f3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_getY__f3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_toString__f3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $416, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -380(%rbp)
+    movl    $-1, -252(%rbp)
+    movl    $-1, -124(%rbp)
+    leaq    .Lxly_str_cabf4f417c4e17db(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f8_2
+.Lxly_f8_1:
+    call    xly_add
+.Lxly_f8_2:
+    movq    %rax, %r14
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -280(%rbp)
+    leaq    -288(%rbp), %rax
+    jmp     .Lxly_f8_4
+.Lxly_f8_3:
+    call    xly_add
+.Lxly_f8_4:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -408(%rbp)
+    leaq    -416(%rbp), %rax
+    jmp     .Lxly_f8_6
+.Lxly_f8_5:
+    call    xly_add
+.Lxly_f8_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f8_8
+.Lxly_f8_7:
+    call    xly_add
+.Lxly_f8_8:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   5
+.Lxly_atoms:
+.Lxly_atom_af63f54c86021707:
+    .quad   .Lxly_str_af63f54c86021707
+.Lxly_atom_af63f44c86021554:
+    .quad   .Lxly_str_af63f44c86021554
+.Lxly_atom_67281271efacc45d:
+    .quad   .Lxly_str_67281271efacc45d
+.Lxly_atom_67281171efacc2aa:
+    .quad   .Lxly_str_67281171efacc2aa
+.Lxly_atom_c5c8cdb28370e485:
+    .quad   .Lxly_str_c5c8cdb28370e485
+
+.section .rodata
+.Lxly_str_2681c764338cbc18:
+    .asciz  "=== Advanced Language Features ==="
+.Lxly_str_bf8f854ea50fd678:
+    .asciz  "1. Raw Strings:"
+.Lxly_str_07185460e2edbcd3:
+    .asciz  "Line 1\nLine 2\tTabbed"
+.Lxly_str_7decfcaf6920619f:
+    .asciz  "  Regular:"
+.Lxly_str_13c1d3fb0030910c:
+    .asciz  "Line 1\\nLine 2\\tTabbed"
+.Lxly_str_288ef0cf17275689:
+    .asciz  "  Raw:"
+.Lxly_str_4c9592b9451763f5:
+    .asciz  "\\d+\\.\\d+"
+.Lxly_str_5c90e9aff57bff3e:
+    .asciz  "C:\\Users\\Documents\\file.txt"
+.Lxly_str_f38bbcfd8cf7e72e:
+    .asciz  "  Regex:"
+.Lxly_str_920751759e060d3c:
+    .asciz  "  Path:"
+.Lxly_str_ba1e9be036585865:
+    .asciz  "2. Optional Parameters:"
+.Lxly_str_6fc288ef3d053ffd:
+    .asciz  "  greet('Alice'):"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_ad61063ec8147ccb:
+    .asciz  "  greet('Bob', 'Hi'):"
+.Lxly_str_065daa5971b66760:
+    .asciz  "Hi, Bob!"
+.Lxly_str_b11121bc529553c3:
+    .asciz  "3. Default Parameters:"
+.Lxly_str_d4d82c06fafc346d:
+    .asciz  "  multiply(5):"
+.Lxly_str_87cc9b66c023d63c:
+    .asciz  "  multiply(5, 3):"
+.Lxly_str_741b5193545fdb6d:
+    .asciz  "  createUser('Alice'):"
+.Lxly_str_154339ba6e1a5b21:
+    .asciz  "  createUser('Bob', 25):"
+.Lxly_str_16566419b10316b4:
+    .asciz  "Bob"
+.Lxly_str_203662e4ed0e4300:
+    .asciz  "  createUser('Carol', 30, 'admin'):"
+.Lxly_str_6f7c78a17ba65ed2:
+    .asciz  "Carol"
+.Lxly_str_e5cde7fdda328454:
+    .asciz  "admin"
+.Lxly_str_256c67ff2bf1b0e9:
+    .asciz  "4. Named Parameters (Concept):"
+.Lxly_str_3e0f8d5e5f34aafb:
+    .asciz  "  Named parameters provide clarity:"
+.Lxly_str_b82d343f544cb67c:
+    .asciz  "  connect(host: 'localhost', port: 8080, ssl: true)"
+.Lxly_str_1b0833d12b5d0249:
+    .asciz  "  (Currently simulated with clear naming)"
+.Lxly_str_a80bf103266e3373:
+    .asciz  "5. Operator Overloading (Concept):"
+.Lxly_str_753095968d92ca80:
+    .asciz  "  Allows custom types to use operators:"
+.Lxly_str_a2c548bab4f0bf2f:
+    .asciz  "  vector1 + vector2    // Adds vectors"
+.Lxly_str_3a4cfa31733aaad6:
+    .asciz  "  matrix1 * matrix2    // Multiplies matrices"
+.Lxly_str_08f03e80ec55e1f3:
+    .asciz  "  (Feature planned for future release)"
+.Lxly_str_86379045cb859721:
+    .asciz  "6. Anonymous Types (Dynamic Objects):"
+.Lxly_str_78f46fb425f54d55:
+    .asciz  "  Created anonymous point structure"
+.Lxly_str_e36693017ede8d39:
+    .asciz  "  (Using closures for encapsulation)"
+.Lxly_str_c5b79ec935384e91:
+    .asciz  "7. Covariance & Contravariance (Concepts):"
+.Lxly_str_1a301b115909c072:
+    .asciz  "  Covariance: Output types can be more specific"
+.Lxly_str_8c728a2eb0dcb4d2:
+    .asciz  "  Contravariance: Input types can be more general"
+.Lxly_str_f289bd238e792fbb:
+    .asciz  "  Example with classes:"
+.Lxly_str_071d27689f3510b1:
+    .asciz  "  class Animal { ... }"
+.Lxly_str_03265253a4dcbf60:
+    .asciz  "  class Dog extends Animal { ... }"
+.Lxly_str_ebefc24e8c56ced2:
+    .asciz  "  Covariant return: fn() -> Dog (can return more specific)"
+.Lxly_str_e1d44cb8512b3e0b:
+    .asciz  "  Contravariant param: fn(Animal) (can accept more general)"
+.Lxly_str_3c3c52b0d48b97c2:
+    .asciz  "  (Type variance rules ensure type safety)"
+.Lxly_str_149d7e4f173b90e5:
+    .asciz  "=== Practical Examples ==="
+.Lxly_str_c807b65bc13ee881:
+    .asciz  "server=localhost;port=8080;timeout=30"
+.Lxly_str_b89f2bdc5d5638a7:
+    .asciz  "Config:"
+.Lxly_str_31e4bf7aeb04f8d9:
+    .asciz  "System started"
+.Lxly_str_4dcc0bedd45426c3:
+    .asciz  "Connection established"
+.Lxly_str_82baf0d0b4af7ad8:
+    .asciz  "DEBUG"
+.Lxly_str_4f745cff92adcce4:
+    .asciz  "Warning: Low memory"
+.Lxly_str_9f3da202cb7049f1:
+    .asciz  "WARN"
+.Lxly_str_046c2b8f7bfcd5f2:
+    .asciz  "https://api.example.com/users"
+.Lxly_str_188f4d0b7d47ed42:
+    .asciz  "https://api.example.com/data"
+.Lxly_str_a048aa190bf19f87:
+    .asciz  "POST"
+.Lxly_str_6a2142cc68748b0a:
+    .asciz  "https://api.example.com/stream"
+.Lxly_str_ea7e631998067e17:
+    .asciz  "GET"
+.Lxly_str_9ceff3e79c465b8a:
+    .asciz  "\342\234\205 Advanced features demonstrated!"
+.Lxly_str_63f0bfacf2c00f6b:
+    .asciz  "Hello"
+.Lxly_str_07d38007b49acdd1:
+    .asciz  ", "
+.Lxly_str_af639c4c86017fcc:
+    .asciz  "!"
+.Lxly_str_7d6780e4032b48f2:
+    .asciz  "user"
+.Lxly_str_07c5a007b48ec6d5:
+    .asciz  " ("
+.Lxly_str_af63a44c86018d64:
+    .asciz  ")"
+.Lxly_str_af64164c86024f1a:
+    .asciz  "["
+.Lxly_str_af64104c860244e8:
+    .asciz  "]"
+.Lxly_str_33af862adb3e226d:
+    .asciz  "[INFO]"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_d23be57df7ae7908:
+    .asciz  "Request: "
+.Lxly_str_9eed8a08fa89d672:
+    .asciz  " (timeout: "
+.Lxly_str_08d8f707b578c3b1:
+    .asciz  "s)"
+.Lxly_str_cabf4f417c4e17db:
+    .asciz  "Point("
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_af63f44c86021554:
+    .asciz  "y"
+.Lxly_str_67281271efacc45d:
+    .asciz  "getX"
+.Lxly_str_67281171efacc2aa:
+    .asciz  "getY"
+.Lxly_str_c5c8cdb28370e485:
+    .asciz  "toString"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   5
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   40
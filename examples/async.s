@@ -0,0 +1,897 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $416, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_1133585740502798(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1a35df0eed5c6dd2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_51c7dc3cf57b90f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f4af8dfdfc72c7c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ed14579d52be7bfc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3b90f0855eebf0c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e18d069c03020464(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_593f6178bf80bbb0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn_compute(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -80(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k149(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_spawn
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_fn_compute(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -112(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k150(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_spawn
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_fn_fetch(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -144(%rbp)
+    movabsq $0x4059400000000000, %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k151(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_spawn
+    addq    $16, %rsp
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_fn_fetch(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -176(%rbp)
+    movabsq $0x4059800000000000, %rax
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_ir0_k152(%rip), %rax
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_spawn
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_bd839d9a65759efb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d2c3877d1ca7464a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -224(%rbp)
+.Lxly_ir0_b2:
+    leaq    .Lxly_str_1402dbad73182ff5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_3f9775bf6d3d776d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k153(%rip), %rax
+    movq    %rax, -232(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -232(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movabsq $0x4048800000000000, %rax
+    movq    %rax, -240(%rbp)
+.Lxly_ir0_b1:
+    leaq    .Lxly_ir0_k154(%rip), %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_58d0229e26d4f2b3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_ir0_k155(%rip), %rax
+    movq    %rax, -264(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x408f380000000000, %rax
+    movq    %rax, -272(%rbp)
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_a28d11d065e4ac35(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    leaq    .Lxly_ir0_k156(%rip), %rax
+    movq    %rax, -288(%rbp)
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -288(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ea2e34c2a7241d27(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+.Lxly_ir0_b3:
+    movq    -296(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_1736db594fa0fb8e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ed9753f6a7a9c087(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -320(%rbp)
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k157(%rip), %rax
+    movq    %rax, -328(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -336(%rbp)
+.Lxly_ir0_b5:
+    leaq    .Lxly_ir0_k158(%rip), %rax
+    movq    %rax, -344(%rbp)
+    movq    -344(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+.Lxly_ir0_b8:
+    leaq    .Lxly_str_a747b57d0dd13130(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_ir0_k159(%rip), %rax
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x405a400000000000, %rax
+    movq    %rax, -368(%rbp)
+.Lxly_ir0_b7:
+    leaq    .Lxly_ir0_k160(%rip), %rax
+    movq    %rax, -376(%rbp)
+    movq    -376(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_7ee852f55b5fe5a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir0_k161(%rip), %rax
+    movq    %rax, -392(%rbp)
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -392(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_338356219b03970a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -400(%rbp)
+    leaq    .Lxly_ir0_k162(%rip), %rax
+    movq    %rax, -408(%rbp)
+    subq    $16, %rsp
+    movq    -400(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -408(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3a36cc291453ad69(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k163(%rip), %rax
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+.Lxly_ir0_b9:
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k164(%rip), %rax
+    movq    %rax, %r14
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+.Lxly_ir0_b11:
+    movabsq $0x404a000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k165(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_54a8c96aa1b1fe3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k166(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9cf2e0d6b4fad3e9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d6ccf942a6ea210c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_37e8331d294c4175(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ed12ce3ddcbc7845(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8c4aa8af9d49c86e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f71da8f1c2355297(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_85cd78e46b4453d1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k149:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k150:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k151:
+    .quad   0, 0x4059400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k152:
+    .quad   0, 0x4059800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k153:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k154:
+    .quad   0, 0x4048800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k155:
+    .quad   0, 0x4048800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k156:
+    .quad   0, 0x408f380000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k157:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k158:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k159:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k160:
+    .quad   0, 0x405a400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k161:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k162:
+    .quad   0, 0x405a400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k163:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k164:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k165:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k166:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_compute:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_1402dbad73182ff5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_3f9775bf6d3d776d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fetch:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_a28d11d065e4ac35(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3d7c7857a57756ee(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_regular_work:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_a747b57d0dd13130(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf2_0_k8(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k8:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_1133585740502798:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_1a35df0eed5c6dd2:
+    .asciz  "\342\225\221     Xenly Async Syntax Preview           \342\225\221"
+.Lxly_str_51c7dc3cf57b90f0:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_f4af8dfdfc72c7c1:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_ed14579d52be7bfc:
+    .asciz  "\342\224\202  async fn declarations                     \342\224\202"
+.Lxly_str_3b90f0855eebf0c1:
+    .asciz  "\342\224\224\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\230"
+.Lxly_str_e18d069c03020464:
+    .asciz  "\342\224\202  spawn \342\200\224 fire-and-forget execution         \342\224\202"
+.Lxly_str_593f6178bf80bbb0:
+    .asciz  "Spawning tasks..."
+.Lxly_str_bd839d9a65759efb:
+    .asciz  "All tasks spawned (in full impl, would run concurrently)"
+.Lxly_str_d2c3877d1ca7464a:
+    .asciz  "\342\224\202  await \342\200\224 wait for async result             \342\224\202"
+.Lxly_str_1402dbad73182ff5:
+    .asciz  "  Computing"
+.Lxly_str_3f9775bf6d3d776d:
+    .asciz  "^2..."
+.Lxly_str_58d0229e26d4f2b3:
+    .asciz  "Result from compute(7):"
+.Lxly_str_a28d11d065e4ac35:
+    .asciz  "  Fetching data for ID"
+.Lxly_str_ea2e34c2a7241d27:
+    .asciz  "data_999"
+.Lxly_str_1736db594fa0fb8e:
+    .asciz  "Result from fetch(999):"
+.Lxly_str_ed9753f6a7a9c087:
+    .asciz  "\342\224\202  Mixing async and regular functions        \342\224\202"
+.Lxly_str_a747b57d0dd13130:
+    .asciz  "  Regular work with"
+.Lxly_str_7ee852f55b5fe5a2:
+    .asciz  "async result:"
+.Lxly_str_338356219b03970a:
+    .asciz  "regular result:"
+.Lxly_str_3a36cc291453ad69:
+    .asciz  "\342\224\202  Async in expressions                      \342\224\202"
+.Lxly_str_54a8c96aa1b1fe3e:
+    .asciz  "Sum of compute(4) + compute(6):"
+.Lxly_str_9cf2e0d6b4fad3e9:
+    .asciz  "\342\225\221  Future: Full Async Runtime              \342\225\221"
+.Lxly_str_d6ccf942a6ea210c:
+    .asciz  "  \342\200\242 Task scheduler \342\200\224 cooperative multitasking"
+.Lxly_str_37e8331d294c4175:
+    .asciz  "  \342\200\242 Channels \342\200\224 communication between tasks"
+.Lxly_str_ed12ce3ddcbc7845:
+    .asciz  "  \342\200\242 sleep(ms) \342\200\224 yield control and resume later"
+.Lxly_str_8c4aa8af9d49c86e:
+    .asciz  "  \342\200\242 Blocking send/recv on channels"
+.Lxly_str_f71da8f1c2355297:
+    .asciz  "  \342\200\242 True concurrent execution patterns"
+.Lxly_str_85cd78e46b4453d1:
+    .asciz  "Current: Syntax preview (immediate execution)"
+.Lxly_str_3d7c7857a57756ee:
+    .asciz  "data_"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   5
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   40
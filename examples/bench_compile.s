@@ -0,0 +1,883 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $864, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    leaq    .Lxly_str_3e1e36b0ddb7d6e2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_38dc74cd02396bc8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_95071a9518ee2cbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k159(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_3563966b6925547c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3a62f9bf0d40c7a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k160(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_ir0_k161(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x40f86a0000000000, %rax
+    movq    %rax, -56(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movq    %rbx, %r15
+    movq    %rbx, %r12
+.Lxly_ir0_b1:
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %r15, %xmm0
+    movq    -64(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %r14, %r15
+    movq    %r13, %r12
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_213b4d68c2d878e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7e2d035031b696d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k165(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k166(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x407f400000000000, %rax
+    movq    %rax, -72(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -80(%rbp)
+    movq    %rbx, -88(%rbp)
+    movq    %rbx, -96(%rbp)
+.Lxly_ir0_b4:
+    movq    -88(%rbp), %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -104(%rbp)
+    cmpq    $0, -104(%rbp)
+    je      .Lxly_ir0_b6
+.Lxly_ir0_b5:
+    movq    %rbx, %r14
+    movq    -96(%rbp), %r12
+.Lxly_ir0_b7:
+    movq    %r14, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b9
+.Lxly_ir0_b8:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %r14
+    movq    %r13, %r12
+    jmp     .Lxly_ir0_b7
+.Lxly_ir0_b9:
+    movq    -88(%rbp), %xmm0
+    movq    -80(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %r13, -88(%rbp)
+    movq    %r12, -96(%rbp)
+    jmp     .Lxly_ir0_b4
+.Lxly_ir0_b6:
+    leaq    .Lxly_str_ef6dc69e57e3ffef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    -96(%rbp), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b8d5a16b77693bcd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k170(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_ir0_k171(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x40e86a0000000000, %rax
+    movq    %rax, -128(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -136(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    %rbx, %r12
+    movq    %rbx, -144(%rbp)
+.Lxly_ir0_b10:
+    movq    %r12, %xmm0
+    movq    -128(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b12
+.Lxly_ir0_b11:
+.Lxly_ir0_b22:
+    movq    %r12, %xmm0
+    movq    -136(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b21:
+.Lxly_ir0_b24:
+    movq    %r13, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b23:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movq    %r13, %r12
+    movq    %r15, -144(%rbp)
+    jmp     .Lxly_ir0_b10
+.Lxly_ir0_b12:
+    movq    -144(%rbp), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c150fcf1597b32a1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k175(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_ir0_k176(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movabsq $0x411e848000000000, %rax
+    movq    %rax, -152(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -160(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -168(%rbp)
+    movq    %rbx, %r13
+    movq    %rbx, %r14
+.Lxly_ir0_b13:
+    movq    %r13, %xmm0
+    movq    -152(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b14:
+    movq    %r13, %xmm0
+    movq    -160(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -176(%rbp)
+    movq    %r14, %xmm0
+    movq    -176(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -184(%rbp)
+    movq    -184(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movq    %r13, %xmm0
+    movq    -168(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %r15, %r13
+    movq    %r12, %r14
+    jmp     .Lxly_ir0_b13
+.Lxly_ir0_b15:
+    movq    %r14, %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_42e9516ede8136e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k180(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_ir0_k181(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movabsq $0x410e848000000000, %rax
+    movq    %rax, -192(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -200(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %r15
+    movq    %rbx, %r12
+.Lxly_ir0_b16:
+    movq    %r15, %xmm0
+    movq    -152(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b18
+.Lxly_ir0_b17:
+    movq    %r15, %xmm0
+    movq    -192(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b25
+.Lxly_ir0_b19:
+    movq    %r12, %xmm0
+    movq    -200(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    jmp     .Lxly_ir0_b20
+.Lxly_ir0_b25:
+    movq    %r12, %rbx
+.Lxly_ir0_b20:
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %r14, %r15
+    movq    %rbx, %r12
+    jmp     .Lxly_ir0_b16
+.Lxly_ir0_b18:
+    leaq    .Lxly_str_d53f91ec332907bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_80b520f8f0e18ed7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k159:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k160:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k161:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k165:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k166:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k170:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k171:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k175:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k176:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k180:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k181:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_fib:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    leaq    .Lxly_irf1_0_k15(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k15:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_3e1e36b0ddb7d6e2:
+    .asciz  "=== Performance Benchmark ==="
+.Lxly_str_38dc74cd02396bc8:
+    .asciz  "1. Fibonacci..."
+.Lxly_str_95071a9518ee2cbf:
+    .asciz  "2. Factorial(15)..."
+.Lxly_str_3563966b6925547c:
+    .asciz  "   Result:"
+.Lxly_str_3a62f9bf0d40c7a5:
+    .asciz  "3. Sum loop (100000)..."
+.Lxly_str_213b4d68c2d878e8:
+    .asciz  "   Sum:"
+.Lxly_str_7e2d035031b696d0:
+    .asciz  "4. Nested loops (500x500)..."
+.Lxly_str_ef6dc69e57e3ffef:
+    .asciz  "   Total:"
+.Lxly_str_b8d5a16b77693bcd:
+    .asciz  "5. Function calls (50000)..."
+.Lxly_str_c150fcf1597b32a1:
+    .asciz  "6. Arithmetic (500000)..."
+.Lxly_str_42e9516ede8136e4:
+    .asciz  "7. Comparisons (500000)..."
+.Lxly_str_d53f91ec332907bc:
+    .asciz  "   Count:"
+.Lxly_str_80b520f8f0e18ed7:
+    .asciz  "\342\234\205 Benchmark complete!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   11
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   88
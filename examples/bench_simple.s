@@ -0,0 +1,823 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1040, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movl    $-1, -996(%rbp)
+    movl    $-1, -868(%rbp)
+    movl    $-1, -740(%rbp)
+    movl    $-1, -612(%rbp)
+    movl    $-1, -484(%rbp)
+    movl    $-1, -356(%rbp)
+    leaq    .Lxly_str_3e1e36b0ddb7d6e2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8226925a43a24bc8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k179(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_ir0_k180(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x41086a0000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movq    %rbx, %r14
+    movq    %rbx, %r15
+.Lxly_ir0_b1:
+    movq    %r14, %xmm0
+    movq    -48(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %r14, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %r13, %r14
+    movq    %r12, %r15
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_213b4d68c2d878e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movsd   %xmm0, -384(%rbp)
+    leaq    -392(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f7b38dd373a2b5bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k184(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_ir0_k185(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, -64(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %rbx, -80(%rbp)
+    movq    %rbx, -88(%rbp)
+.Lxly_ir0_b4:
+    movq    -80(%rbp), %xmm0
+    movq    -64(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -96(%rbp)
+    cmpq    $0, -96(%rbp)
+    je      .Lxly_ir0_b6
+.Lxly_ir0_b5:
+    movq    %rbx, %r12
+    movq    -88(%rbp), %r15
+.Lxly_ir0_b7:
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b9
+.Lxly_ir0_b8:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %r12
+    movq    %r13, %r15
+    jmp     .Lxly_ir0_b7
+.Lxly_ir0_b9:
+    movq    -80(%rbp), %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %r13, -80(%rbp)
+    movq    %r15, -88(%rbp)
+    jmp     .Lxly_ir0_b4
+.Lxly_ir0_b6:
+    leaq    .Lxly_str_ef6dc69e57e3ffef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    -88(%rbp), %xmm0
+    movsd   %xmm0, -512(%rbp)
+    leaq    -520(%rbp), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9daadd0d96d2ef34(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x412e848000000000, %rax
+    movq    %rax, -120(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -128(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -136(%rbp)
+    movq    %rbx, %r15
+    movq    %rbx, %r14
+.Lxly_ir0_b10:
+    movq    %r15, %xmm0
+    movq    -120(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b12
+.Lxly_ir0_b11:
+    movq    %r15, %xmm0
+    movq    -128(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -144(%rbp)
+    movq    %r14, %xmm0
+    movq    -144(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %r15, %xmm0
+    movq    -136(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movq    %r13, %r15
+    movq    %r12, %r14
+    jmp     .Lxly_ir0_b10
+.Lxly_ir0_b12:
+    leaq    .Lxly_str_3563966b6925547c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -160(%rbp)
+    movq    %r14, %xmm0
+    movsd   %xmm0, -640(%rbp)
+    leaq    -648(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_64d5385056e1f946(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x40f86a0000000000, %rax
+    movq    %rax, -168(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -176(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %r12
+    movq    %rbx, -184(%rbp)
+.Lxly_ir0_b13:
+    movq    %r12, %xmm0
+    movq    -168(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b14:
+.Lxly_ir0_b27:
+    movq    %r12, %xmm0
+    movq    -176(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b26:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movq    %r15, %r12
+    movq    %r14, -184(%rbp)
+    jmp     .Lxly_ir0_b13
+.Lxly_ir0_b15:
+    movq    -184(%rbp), %xmm0
+    movsd   %xmm0, -768(%rbp)
+    leaq    -776(%rbp), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_214a9f58ffcc7cd0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movabsq $0x411e848000000000, %rax
+    movq    %rax, -192(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -200(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -208(%rbp)
+    movq    %rbx, %r15
+    movq    %rbx, %r13
+.Lxly_ir0_b16:
+    movq    %r15, %xmm0
+    movq    -120(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b18
+.Lxly_ir0_b17:
+    movq    %r15, %xmm0
+    movq    -192(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b28
+.Lxly_ir0_b19:
+    movq    %r13, %xmm0
+    movq    -200(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    jmp     .Lxly_ir0_b20
+.Lxly_ir0_b28:
+    movq    %r13, %r14
+.Lxly_ir0_b20:
+    movq    %r15, %xmm0
+    movq    -208(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %r12, %r15
+    movq    %r14, %r13
+    jmp     .Lxly_ir0_b16
+.Lxly_ir0_b18:
+    leaq    .Lxly_str_d53f91ec332907bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    movsd   %xmm0, -896(%rbp)
+    leaq    -904(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_37d7f92e82edf83e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k204(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_ir0_k205(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x411e848000000000, %rax
+    movq    %rax, -216(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -224(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -232(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -240(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -248(%rbp)
+    movq    %rbx, %r14
+    movq    %rbx, %r15
+.Lxly_ir0_b21:
+    movq    %r14, %xmm0
+    movq    -216(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b23
+.Lxly_ir0_b22:
+    movq    %r14, %xmm0
+    movq    -224(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movq    -232(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b29
+.Lxly_ir0_b24:
+    movq    %r15, %xmm0
+    movq    -240(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %rbx, %r12
+    jmp     .Lxly_ir0_b25
+.Lxly_ir0_b29:
+    movq    %r15, %r12
+.Lxly_ir0_b25:
+    movq    %r14, %xmm0
+    movq    -248(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movq    %rbx, %r14
+    movq    %r12, %r15
+    jmp     .Lxly_ir0_b21
+.Lxly_ir0_b23:
+    movq    %r15, %xmm0
+    movsd   %xmm0, -1024(%rbp)
+    leaq    -1032(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_80b520f8f0e18ed7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k179:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k180:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k184:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k185:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k189:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k204:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k205:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_compute:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_3e1e36b0ddb7d6e2:
+    .asciz  "=== Performance Benchmark ==="
+.Lxly_str_8226925a43a24bc8:
+    .asciz  "1. Sum loop (200000)..."
+.Lxly_str_213b4d68c2d878e8:
+    .asciz  "   Sum:"
+.Lxly_str_f7b38dd373a2b5bc:
+    .asciz  "2. Nested loops (1000x1000)..."
+.Lxly_str_ef6dc69e57e3ffef:
+    .asciz  "   Total:"
+.Lxly_str_9daadd0d96d2ef34:
+    .asciz  "3. Arithmetic (1000000)..."
+.Lxly_str_3563966b6925547c:
+    .asciz  "   Result:"
+.Lxly_str_64d5385056e1f946:
+    .asciz  "4. Function calls (100000)..."
+.Lxly_str_214a9f58ffcc7cd0:
+    .asciz  "5. Comparisons (1000000)..."
+.Lxly_str_d53f91ec332907bc:
+    .asciz  "   Count:"
+.Lxly_str_37d7f92e82edf83e:
+    .asciz  "6. Mixed operations (500000)..."
+.Lxly_str_80b520f8f0e18ed7:
+    .asciz  "\342\234\205 Benchmark complete!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   12
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   96
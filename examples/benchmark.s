@@ -0,0 +1,722 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $416, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movl    $-1, -372(%rbp)
+    movl    $-1, -244(%rbp)
+    leaq    .Lxly_str_e1642f3010dd220a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_de38694df0b38209(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k60(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c8868beb5c44ef1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -56(%rbp)
+.Lxly_ir0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    movq    %rbx, %r13
+.Lxly_ir0_b3:
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b5
+.Lxly_ir0_b4:
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %r15
+    movq    %r12, %r13
+    jmp     .Lxly_ir0_b3
+.Lxly_ir0_b5:
+.Lxly_ir0_b1:
+    movq    %r13, %xmm0
+    movsd   %xmm0, -272(%rbp)
+    leaq    -280(%rbp), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_503e6401e689ec1e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x412e848600000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k62(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    .Lxly_fn_isPrime
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c901da0de8683c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movabsq $0x403b000000000000, %rax
+    movq    %rax, -80(%rbp)
+.Lxly_ir0_b7:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -88(%rbp)
+    movq    -80(%rbp), %r15
+    movq    %r12, %r13
+.Lxly_ir0_b8:
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -96(%rbp)
+    cmpq    $0, -96(%rbp)
+    je      .Lxly_ir0_b13
+.Lxly_ir0_b9:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    %r12, %xmm0
+    movq    -104(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -112(%rbp)
+    cmpq    $0, -112(%rbp)
+    je      .Lxly_ir0_b11
+.Lxly_ir0_b10:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    movq    %rax, -136(%rbp)
+    jmp     .Lxly_ir0_b12
+.Lxly_ir0_b11:
+    movq    %r15, %xmm0
+    movq    -88(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, -136(%rbp)
+.Lxly_ir0_b12:
+    movq    %r13, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    -136(%rbp), %rax
+    movq    %rax, -144(%rbp)
+    movq    %r15, %rax
+    movq    %rax, -152(%rbp)
+    movq    -144(%rbp), %r15
+    movq    -152(%rbp), %r13
+    jmp     .Lxly_ir0_b8
+.Lxly_ir0_b13:
+.Lxly_ir0_b6:
+    movq    %r13, %xmm0
+    movsd   %xmm0, -400(%rbp)
+    leaq    -408(%rbp), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9f5bdc58d0166362(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k60:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k62:
+    .quad   0, 0x412e848600000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_fib:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    movq    %r12, %r15
+.Lxly_irf1_0_b1:
+    movq    %r14, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b3
+.Lxly_irf1_0_b2:
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    movq    %r13, %r15
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b3:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_isPrime:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b2
+.Lxly_irf2_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b2:
+    leaq    .Lxly_irf2_0_k57(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f2_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf2_0_b5
+.Lxly_irf2_0_b4:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b5:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, -56(%rbp)
+    movq    %r14, %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf2_0_b8
+.Lxly_irf2_0_b7:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b8:
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+.Lxly_irf2_0_b10:
+    movq    %r14, %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b12
+.Lxly_irf2_0_b11:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    -56(%rbp), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b14
+.Lxly_irf2_0_b13:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b14:
+    movq    %r14, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    jmp     .Lxly_irf2_0_b10
+.Lxly_irf2_0_b12:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k57:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_collatz:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $128, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movq    -48(%rbp), %r15
+    movq    %r12, %rbx
+.Lxly_irf3_0_b1:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -64(%rbp)
+    cmpq    $0, -64(%rbp)
+    je      .Lxly_irf3_0_b3
+.Lxly_irf3_0_b2:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r12, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -80(%rbp)
+    cmpq    $0, -80(%rbp)
+    je      .Lxly_irf3_0_b6
+.Lxly_irf3_0_b4:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %rax
+    movq    %rax, -104(%rbp)
+    jmp     .Lxly_irf3_0_b5
+.Lxly_irf3_0_b6:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, -104(%rbp)
+.Lxly_irf3_0_b5:
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    -104(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %rax
+    movq    %rax, -120(%rbp)
+    movq    %r15, %rax
+    movq    %rax, -128(%rbp)
+    movq    -120(%rbp), %r15
+    movq    -128(%rbp), %rbx
+    jmp     .Lxly_irf3_0_b1
+.Lxly_irf3_0_b3:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_e1642f3010dd220a:
+    .asciz  "=== Benchmark Results ==="
+.Lxly_str_de38694df0b38209:
+    .asciz  "fib(25) ="
+.Lxly_str_c8868beb5c44ef1a:
+    .asciz  "factorial(15) ="
+.Lxly_str_503e6401e689ec1e:
+    .asciz  "isPrime(1000003) ="
+.Lxly_str_4c901da0de8683c5:
+    .asciz  "collatz(27) ="
+.Lxly_str_9f5bdc58d0166362:
+    .asciz  "\342\234\223 Benchmark complete"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   0
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   8
@@ -0,0 +1,1250 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $944, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movl    $-1, -908(%rbp)
+    movl    $-1, -780(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    leaq    .Lxly_str_b7d605929e8af4ea(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a0342890e080c832(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_3563966b6925547c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d65a9ff815a41ebb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k198(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5f6ef742bf1145a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x40c3880000000000, %rax
+    movq    %rax, -64(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -80(%rbp)
+    movq    -56(%rbp), %r12
+    movq    %rbx, %r14
+.Lxly_ir0_b1:
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    .Lxly_fn_isPrime
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b30
+.Lxly_ir0_b4:
+    movq    %r14, %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %r15, -104(%rbp)
+    jmp     .Lxly_ir0_b5
+.Lxly_ir0_b30:
+    movq    %r14, -104(%rbp)
+.Lxly_ir0_b5:
+    movq    %r12, %xmm0
+    movq    -80(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %r15, %r12
+    movq    -104(%rbp), %r14
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_aeae4be79fa25815(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_80609793fe1c7740(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k205(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_ir0_k206(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x40f86a0000000000, %rax
+    movq    %rax, -112(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k207(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+.Lxly_ir0_b6:
+    movq    __xly_globals+40(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    -112(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -128(%rbp)
+    cmpq    $0, -128(%rbp)
+    je      .Lxly_ir0_b8
+.Lxly_ir0_b7:
+    movq    __xly_globals+40(%rip), %rax
+    movq    %rax, -136(%rbp)
+    movq    %r15, %rdi
+    movq    -136(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    __xly_globals+40(%rip), %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k208(%rip), %rax
+    movq    %rax, -152(%rbp)
+    movq    -144(%rbp), %rdi
+    movq    -152(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -160(%rbp)
+    movq    -160(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movq    %r14, %r15
+    jmp     .Lxly_ir0_b6
+.Lxly_ir0_b8:
+    leaq    .Lxly_str_213b4d68c2d878e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6cfd95043bddbfb3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k209(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, -168(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -176(%rbp)
+    movq    %rbx, -184(%rbp)
+    movq    %rbx, -192(%rbp)
+.Lxly_ir0_b9:
+    movq    -184(%rbp), %xmm0
+    movq    -168(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -200(%rbp)
+    cmpq    $0, -200(%rbp)
+    je      .Lxly_ir0_b11
+.Lxly_ir0_b10:
+    movq    %rbx, %r13
+    movq    -192(%rbp), %r12
+.Lxly_ir0_b12:
+    movq    %r13, %xmm0
+    movq    -168(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b14
+.Lxly_ir0_b13:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -208(%rbp)
+    movq    -208(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movq    %r13, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -216(%rbp)
+    movq    -216(%rbp), %r13
+    movq    %r14, %r12
+    jmp     .Lxly_ir0_b12
+.Lxly_ir0_b14:
+    movq    -184(%rbp), %xmm0
+    movq    -176(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movq    %r14, -184(%rbp)
+    movq    %r12, -192(%rbp)
+    jmp     .Lxly_ir0_b9
+.Lxly_ir0_b11:
+    leaq    .Lxly_str_ef6dc69e57e3ffef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    -192(%rbp), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_cb3e19150703fbd2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k214(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_ir0_k215(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    %rbx, %r12
+    movq    %rbx, -224(%rbp)
+.Lxly_ir0_b15:
+    movq    %r12, %xmm0
+    movq    -112(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b17
+.Lxly_ir0_b16:
+.Lxly_ir0_b27:
+    movq    -56(%rbp), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b26:
+.Lxly_ir0_b29:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b28:
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %r15, %r12
+    movq    %r13, -224(%rbp)
+    jmp     .Lxly_ir0_b15
+.Lxly_ir0_b17:
+    movq    -224(%rbp), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d1f111b60726afe4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k219(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_ir0_k220(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x412e848000000000, %rax
+    movq    %rax, -232(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %r12
+    movq    %rbx, -240(%rbp)
+.Lxly_ir0_b18:
+    movq    %r12, %xmm0
+    movq    -232(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -248(%rbp)
+    cmpq    $0, -248(%rbp)
+    je      .Lxly_ir0_b20
+.Lxly_ir0_b19:
+    movq    -56(%rbp), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -256(%rbp)
+    movq    -240(%rbp), %xmm0
+    movq    -256(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -264(%rbp)
+    movq    -264(%rbp), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -272(%rbp)
+    movq    -272(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movq    %r14, %r12
+    movq    %r15, -240(%rbp)
+    jmp     .Lxly_ir0_b18
+.Lxly_ir0_b20:
+    movq    -240(%rbp), %xmm0
+    movsd   %xmm0, -808(%rbp)
+    leaq    -816(%rbp), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_434cbdf575000790(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k224(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_ir0_k225(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    movabsq $0x411e848000000000, %rax
+    movq    %rax, -280(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -288(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %r15
+    movq    %rbx, %r13
+.Lxly_ir0_b21:
+    movq    %r15, %xmm0
+    movq    -232(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b23
+.Lxly_ir0_b22:
+    movq    %r15, %xmm0
+    movq    -280(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b31
+.Lxly_ir0_b24:
+    movq    %r13, %xmm0
+    movq    -288(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    jmp     .Lxly_ir0_b25
+.Lxly_ir0_b31:
+    movq    %r13, %rbx
+.Lxly_ir0_b25:
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    movq    %r14, %r15
+    movq    %rbx, %r13
+    jmp     .Lxly_ir0_b21
+.Lxly_ir0_b23:
+    leaq    .Lxly_str_d53f91ec332907bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movsd   %xmm0, -936(%rbp)
+    leaq    -944(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_80b520f8f0e18ed7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k197:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k198:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k205:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k206:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k207:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k208:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k209:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k210:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k214:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k215:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k219:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k220:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k224:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k225:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_fib:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    leaq    .Lxly_irf1_0_k17(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k17:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_isPrime:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b2
+.Lxly_irf2_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b2:
+    leaq    .Lxly_irf2_0_k57(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f2_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf2_0_b5
+.Lxly_irf2_0_b4:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b5:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, -56(%rbp)
+    movq    %r14, %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf2_0_b8
+.Lxly_irf2_0_b7:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b8:
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+.Lxly_irf2_0_b10:
+    movq    %r14, %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b12
+.Lxly_irf2_0_b11:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    -56(%rbp), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b14
+.Lxly_irf2_0_b13:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b14:
+    movq    %r14, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    jmp     .Lxly_irf2_0_b10
+.Lxly_irf2_0_b12:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k57:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_add
+.Lxly_f3_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_b7d605929e8af4ea:
+    .asciz  "=== Xenly Performance Benchmark ==="
+.Lxly_str_a0342890e080c832:
+    .asciz  "1. Fibonacci(30)..."
+.Lxly_str_3563966b6925547c:
+    .asciz  "   Result:"
+.Lxly_str_d65a9ff815a41ebb:
+    .asciz  "2. Factorial(20)..."
+.Lxly_str_5f6ef742bf1145a6:
+    .asciz  "3. Count primes up to 10000..."
+.Lxly_str_aeae4be79fa25815:
+    .asciz  "   Prime count:"
+.Lxly_str_80609793fe1c7740:
+    .asciz  "4. Array operations (100000 iterations)..."
+.Lxly_str_213b4d68c2d878e8:
+    .asciz  "   Sum:"
+.Lxly_str_6cfd95043bddbfb3:
+    .asciz  "5. Nested loops (1000x1000)..."
+.Lxly_str_ef6dc69e57e3ffef:
+    .asciz  "   Total:"
+.Lxly_str_cb3e19150703fbd2:
+    .asciz  "6. Function calls (100000 iterations)..."
+.Lxly_str_d1f111b60726afe4:
+    .asciz  "7. Arithmetic operations (1000000 iterations)..."
+.Lxly_str_434cbdf575000790:
+    .asciz  "8. Comparison operations (1000000 iterations)..."
+.Lxly_str_d53f91ec332907bc:
+    .asciz  "   Count:"
+.Lxly_str_80b520f8f0e18ed7:
+    .asciz  "\342\234\205 Benchmark complete!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   14
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   112
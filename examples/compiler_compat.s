@@ -0,0 +1,1009 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movl    $-1, -228(%rbp)
+    leaq    .Lxly_str_d22e818eb0bfb347(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_34ba9e7330c011c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k159(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_63f0bfacf2c00f6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_12ac8b85eab334d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k160(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9cba4cc85922b64e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fca4781967f357d7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8ba45bdb65c0c96e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_73f4b461b1324547(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b2:
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b1:
+    leaq    .Lxly_ir0_k161(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8b6d26aaf699ab5e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b4:
+    movabsq $0x4038000000000000, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b3:
+    leaq    .Lxly_ir0_k162(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a93f1dc2f1b80f06(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k163(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x4005bf0995aaf790, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k164(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_b0b4897dc9d41ef0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k165(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_37b5e174394f16a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k166(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ca76ff449b0c88b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3d8cb3091f49bebe(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -80(%rbp)
+.Lxly_ir0_b6:
+.Lxly_ir0_b7:
+.Lxly_ir0_b5:
+    leaq    .Lxly_ir0_k167(%rip), %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2b9ed3863ce99157(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b10:
+.Lxly_ir0_b12:
+.Lxly_ir0_b9:
+    leaq    .Lxly_ir0_k168(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_73c5bf83afbc292d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ecb048fc5008fb16(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+.Lxly_ir0_b14:
+    movabsq $0x0, %rax
+    movq    %rax, -112(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+    movq    -112(%rbp), %r12
+.Lxly_ir0_b15:
+    movq    %r14, %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b17
+.Lxly_ir0_b16:
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    movq    %r13, %r12
+    jmp     .Lxly_ir0_b15
+.Lxly_ir0_b17:
+.Lxly_ir0_b13:
+    movq    %r12, %xmm0
+    movsd   %xmm0, -256(%rbp)
+    leaq    -264(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e24c82018db5d335(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_be1d8bece418cb90(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k170(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_186e12da6bb091c7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b19:
+    leaq    .Lxly_ir0_k171(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k172(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_ir0_b18:
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_462d2f6e8a2fabf9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k173(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k174(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_335b5d8c062d2bb2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_ir0_k175(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_aa654f6227afcaa3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1c53b67fba001158(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k176(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_179137a10b31fad0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c9592b9451763f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_75b3852b1ed3bde8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_f38bbcfd8cf7e72e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_920751759e060d3c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_caeca83cb358e39b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4fe1a10a82331085(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k177(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a883097b0f06bd26(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4070000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k178(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_60e1276d86d97270(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k159:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k160:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k161:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k162:
+    .quad   0, 0x4038000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k163:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k164:
+    .quad   0, 0x4005bf0995aaf790, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k165:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k166:
+    .quad   0, 0x4005bf0995aaf790, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k167:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k168:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k170:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k171:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k172:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k173:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k174:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k175:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k176:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k177:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k178:
+    .quad   0, 0x4070000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_max:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f2_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b3
+.Lxly_irf2_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b3:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_sum:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    movq    %r12, %r15
+.Lxly_irf3_0_b1:
+    movq    %r14, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b3
+.Lxly_irf3_0_b2:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    movq    %r12, %r15
+    jmp     .Lxly_irf3_0_b1
+.Lxly_irf3_0_b3:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf4_0_b2
+.Lxly_irf4_0_b1:
+    leaq    .Lxly_irf4_0_k17(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf4_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf4_0_k17:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_createPoint:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_d22e818eb0bfb347:
+    .asciz  "=== Native Compiler Test ==="
+.Lxly_str_34ba9e7330c011c9:
+    .asciz  "1. Basic Types:"
+.Lxly_str_63f0bfacf2c00f6b:
+    .asciz  "Hello"
+.Lxly_str_12ac8b85eab334d6:
+    .asciz  "  Number:"
+.Lxly_str_9cba4cc85922b64e:
+    .asciz  "  String:"
+.Lxly_str_fca4781967f357d7:
+    .asciz  "  Boolean:"
+.Lxly_str_8ba45bdb65c0c96e:
+    .asciz  "2. Functions:"
+.Lxly_str_73f4b461b1324547:
+    .asciz  "  add(5, 3):"
+.Lxly_str_8b6d26aaf699ab5e:
+    .asciz  "  multiply(4, 6):"
+.Lxly_str_a93f1dc2f1b80f06:
+    .asciz  "3. Const Declarations:"
+.Lxly_str_b0b4897dc9d41ef0:
+    .asciz  "  PI:"
+.Lxly_str_37b5e174394f16a6:
+    .asciz  "  E:"
+.Lxly_str_ca76ff449b0c88b4:
+    .asciz  "4. Control Flow:"
+.Lxly_str_3d8cb3091f49bebe:
+    .asciz  "  max(10, 5):"
+.Lxly_str_2b9ed3863ce99157:
+    .asciz  "  max(3, 8):"
+.Lxly_str_73c5bf83afbc292d:
+    .asciz  "5. Loops:"
+.Lxly_str_ecb048fc5008fb16:
+    .asciz  "  sum(10):"
+.Lxly_str_e24c82018db5d335:
+    .asciz  "6. Recursion:"
+.Lxly_str_be1d8bece418cb90:
+    .asciz  "  factorial(5):"
+.Lxly_str_186e12da6bb091c7:
+    .asciz  "7. Tuples:"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_462d2f6e8a2fabf9:
+    .asciz  "  Point:"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_335b5d8c062d2bb2:
+    .asciz  "8. Unicode:"
+.Lxly_str_aa654f6227afcaa3:
+    .asciz  "  \344\275\240\345\245\275:"
+.Lxly_str_1c53b67fba001158:
+    .asciz  "  \317\200:"
+.Lxly_str_179137a10b31fad0:
+    .asciz  "9. Raw Strings:"
+.Lxly_str_4c9592b9451763f5:
+    .asciz  "\\d+\\.\\d+"
+.Lxly_str_75b3852b1ed3bde8:
+    .asciz  "C:\\Users\\file.txt"
+.Lxly_str_f38bbcfd8cf7e72e:
+    .asciz  "  Regex:"
+.Lxly_str_920751759e060d3c:
+    .asciz  "  Path:"
+.Lxly_str_caeca83cb358e39b:
+    .asciz  "10. Stdlib Modules:"
+.Lxly_str_4fe1a10a82331085:
+    .asciz  "  sqrt(16):"
+.Lxly_str_a883097b0f06bd26:
+    .asciz  "  pow(2, 8):"
+.Lxly_str_60e1276d86d97270:
+    .asciz  "\342\234\205 All compiler-compatible features working!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   10
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   80
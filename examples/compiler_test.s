@@ -0,0 +1,1710 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $672, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movl    $-1, -636(%rbp)
+    movl    $-1, -508(%rbp)
+    leaq    .Lxly_str_1acfb2b6fe7eb10f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_34ba9e7330c011c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k279(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_63f0bfacf2c00f6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_12ac8b85eab334d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k280(%rip), %rax
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9cba4cc85922b64e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fca4781967f357d7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5676b6960da86c12(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_092d628b38efe127(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k281(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k282(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_182146d0979cf24b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x402a000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k283(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d829c9e6abd037dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k284(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0567b9bb13d47338(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k285(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ba2d822567a6e157(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x400aaaaaaaaaaaab, %rax
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_ir0_k286(%rip), %rax
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8936de7dd0e54455(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k287(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1f5584f1369957d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b4f865a403d72f34(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7c83ad62d28ec23a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bb3d4a42282e07c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6572328c71f60e0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cd6f0e0905cd2da0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    subq    $16, %rsp
+    movq    -184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b3eddd20a6cdaa1c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6f32e5985cef61cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3ac8f800182c1c08(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b12:
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -200(%rbp)
+.Lxly_ir0_b11:
+    leaq    .Lxly_ir0_k288(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_24ebf48796109b39(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_ir0_k289(%rip), %rax
+    movq    %rax, -232(%rbp)
+    movq    -232(%rbp), %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, -240(%rbp)
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9424c9321edd6bdc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -248(%rbp)
+    subq    $16, %rsp
+    movq    -248(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_ir0_k290(%rip), %rax
+    movq    %rax, -264(%rbp)
+    movq    -264(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x4005bf0995aaf790, %rax
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_ir0_k291(%rip), %rax
+    movq    %rax, -280(%rbp)
+    movq    -280(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_16cff1bdf35eda99(%rip), %rdi
+    call    xly_str
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k292(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f96faf7d61a34e0f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k293(%rip), %rax
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6c8f68e5e9c29b46(%rip), %rdi
+    call    xly_str
+    movq    %rax, -320(%rbp)
+    subq    $16, %rsp
+    movq    -320(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k294(%rip), %rax
+    movq    %rax, -328(%rbp)
+    movq    -328(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+.Lxly_ir0_b1:
+    leaq    .Lxly_str_7f0a18ed88c12468(%rip), %rdi
+    call    xly_str
+    movq    %rax, -336(%rbp)
+    subq    $16, %rsp
+    movq    -336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b2:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_bd24ddf8c2ff530f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -344(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k295(%rip), %rax
+    movq    %rax, -352(%rbp)
+    movq    -352(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_ir0_k296(%rip), %rax
+    movq    %rax, -360(%rbp)
+    movq    -360(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %rbx, %r14
+    movq    %r15, -368(%rbp)
+.Lxly_ir0_b4:
+    movq    %r14, %xmm0
+    movq    -224(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -376(%rbp)
+    cmpq    $0, -376(%rbp)
+    je      .Lxly_ir0_b6
+.Lxly_ir0_b5:
+    movq    -368(%rbp), %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -384(%rbp)
+    movq    -384(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %r13, %r14
+    movq    %r12, -368(%rbp)
+    jmp     .Lxly_ir0_b4
+.Lxly_ir0_b6:
+    leaq    .Lxly_str_277f68d0e4071f6a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -368(%rbp), %xmm0
+    movsd   %xmm0, -536(%rbp)
+    leaq    -544(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k300(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_ir0_k301(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %rbx, %r14
+    movq    %r15, -392(%rbp)
+.Lxly_ir0_b7:
+    movq    %r14, %xmm0
+    movq    -224(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b10
+.Lxly_ir0_b8:
+    movq    -392(%rbp), %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -400(%rbp)
+    movq    -400(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+.Lxly_ir0_b9:
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %r13, %r14
+    movq    %r12, -392(%rbp)
+    jmp     .Lxly_ir0_b7
+.Lxly_ir0_b10:
+    leaq    .Lxly_str_ade84917a8a74fed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -392(%rbp), %xmm0
+    movsd   %xmm0, -664(%rbp)
+    leaq    -672(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5b746f460101fd30(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_0f19e6c4e521dd53(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_6ef05bd7cc857c54(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_4737c4067987bc78(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_90dd21fe58f78440(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_ir0_k305(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    leaq    .Lxly_str_39dbfdc96fa3c124(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_227284090e3a7bd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k306(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ff06d33875097bda(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_a384f52b4506cfbd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f3db1bc3f53e656a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_68a75e001ced999d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k307(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_outer
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e64ea164ae663f9f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9e2c21d654557f84(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k308(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3e6bef1f68bb0cf3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k309(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k310(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_59c2cf56264cd8c6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k311(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k312(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_503aed7bf7f0e6c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k313(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c73cbae55467abb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k314(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_ir0_k315(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_str_e69312a97d9cd939(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k316(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k317(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_str_1b6c10a99bcb103d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k318(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_002f87aa8d0e6981(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_efbfe0db3d04816e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k319(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5db1331a88b3398f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4070000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k320(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_56eb2be08daad235(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_upper
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_118b29e13d3c714d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0c440002c9fec970(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_3e4bd4e31c5c3ad2(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1670eabdf30e3a30(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_fa53d71e58427c00(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_be1b855b49a0d83f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f9e6e6ef197c2b25(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+160(%rip)
+    leaq    .Lxly_str_33f8d791f4706d8b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_2e3d9ecc741a7811(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e14058b64d8aaad6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b17eeef9480d2491(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_7d6780e4032b48f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_021802b0f58e99e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_0f0f354b75e8af7f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5008c45ba1d5a6bb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_79b6a9af7a07f29b(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_96c3f0565fe6adf7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_ad90b24c904b7f0f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2075d279f36ef3a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbee792189772115(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k279:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k280:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k281:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k282:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k283:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k284:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k285:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k286:
+    .quad   0, 0x400aaaaaaaaaaaab, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k287:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k288:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k289:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k290:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k291:
+    .quad   0, 0x4005bf0995aaf790, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k292:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k293:
+    .quad   0, 0x4005bf0995aaf790, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k294:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k295:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k296:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k300:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k301:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k305:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k306:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k307:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k308:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k309:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k310:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k311:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k312:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k313:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k314:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k315:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k316:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k317:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k318:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k319:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k320:
+    .quad   0, 0x4070000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    leaq    .Lxly_irf1_0_k17(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k17:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_outer:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_irf2_0_b3:
+    movq    __xly_globals+64(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf2_0_k10(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %rbx
+.Lxly_irf2_0_b2:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k10:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_fib:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf3_0_b2
+.Lxly_irf3_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fib
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_add
+.Lxly_f3_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_inner__f2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    __xly_globals+64(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_add
+.Lxly_f4_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_1acfb2b6fe7eb10f:
+    .asciz  "=== Native Compiler Test Suite ==="
+.Lxly_str_34ba9e7330c011c9:
+    .asciz  "1. Basic Types:"
+.Lxly_str_63f0bfacf2c00f6b:
+    .asciz  "Hello"
+.Lxly_str_12ac8b85eab334d6:
+    .asciz  "  Number:"
+.Lxly_str_9cba4cc85922b64e:
+    .asciz  "  String:"
+.Lxly_str_fca4781967f357d7:
+    .asciz  "  Boolean:"
+.Lxly_str_5676b6960da86c12:
+    .asciz  "  Null:"
+.Lxly_str_092d628b38efe127:
+    .asciz  "2. Arithmetic:"
+.Lxly_str_182146d0979cf24b:
+    .asciz  "  10 + 3 ="
+.Lxly_str_d829c9e6abd037dd:
+    .asciz  "  10 - 3 ="
+.Lxly_str_0567b9bb13d47338:
+    .asciz  "  10 * 3 ="
+.Lxly_str_ba2d822567a6e157:
+    .asciz  "  10 / 3 ="
+.Lxly_str_8936de7dd0e54455:
+    .asciz  "  10 % 3 ="
+.Lxly_str_1f5584f1369957d0:
+    .asciz  "3. Comparisons:"
+.Lxly_str_b4f865a403d72f34:
+    .asciz  "  10 > 3 ="
+.Lxly_str_7c83ad62d28ec23a:
+    .asciz  "  10 < 3 ="
+.Lxly_str_bb3d4a42282e07c9:
+    .asciz  "  10 >= 10 ="
+.Lxly_str_6572328c71f60e0b:
+    .asciz  "  10 <= 10 ="
+.Lxly_str_cd6f0e0905cd2da0:
+    .asciz  "  10 == 10 ="
+.Lxly_str_b3eddd20a6cdaa1c:
+    .asciz  "  10 != 3 ="
+.Lxly_str_6f32e5985cef61cc:
+    .asciz  "4. Functions:"
+.Lxly_str_3ac8f800182c1c08:
+    .asciz  "  add(5, 3) ="
+.Lxly_str_24ebf48796109b39:
+    .asciz  "  factorial(5) ="
+.Lxly_str_9424c9321edd6bdc:
+    .asciz  "5. Const Declarations:"
+.Lxly_str_16cff1bdf35eda99:
+    .asciz  "  PI ="
+.Lxly_str_f96faf7d61a34e0f:
+    .asciz  "  E ="
+.Lxly_str_6c8f68e5e9c29b46:
+    .asciz  "6. Control Flow:"
+.Lxly_str_7f0a18ed88c12468:
+    .asciz  "  x > 5: true"
+.Lxly_str_bd24ddf8c2ff530f:
+    .asciz  "7. Loops:"
+.Lxly_str_277f68d0e4071f6a:
+    .asciz  "  sum(1..5) ="
+.Lxly_str_ade84917a8a74fed:
+    .asciz  "  for sum(1..5) ="
+.Lxly_str_5b746f460101fd30:
+    .asciz  "8. String Operations:"
+.Lxly_str_0f19e6c4e521dd53:
+    .asciz  "World"
+.Lxly_str_6ef05bd7cc857c54:
+    .asciz  "Hello, World!"
+.Lxly_str_4737c4067987bc78:
+    .asciz  "  Combined:"
+.Lxly_str_90dd21fe58f78440:
+    .asciz  "9. Unicode Support:"
+.Lxly_str_39dbfdc96fa3c124:
+    .asciz  "  \344\275\240\345\245\275 ="
+.Lxly_str_227284090e3a7bd1:
+    .asciz  "  \317\200 ="
+.Lxly_str_ff06d33875097bda:
+    .asciz  "\360\237\232\200"
+.Lxly_str_a384f52b4506cfbd:
+    .asciz  "  Emoji:"
+.Lxly_str_f3db1bc3f53e656a:
+    .asciz  "10. Nested Functions:"
+.Lxly_str_68a75e001ced999d:
+    .asciz  "  outer(5) ="
+.Lxly_str_e64ea164ae663f9f:
+    .asciz  "11. Performance Test:"
+.Lxly_str_9e2c21d654557f84:
+    .asciz  "  fib(20) ="
+.Lxly_str_3e6bef1f68bb0cf3:
+    .asciz  "12. Compound Assignments:"
+.Lxly_str_59c2cf56264cd8c6:
+    .asciz  "  After += 5:"
+.Lxly_str_503aed7bf7f0e6c2:
+    .asciz  "  After *= 2:"
+.Lxly_str_c73cbae55467abb8:
+    .asciz  "13. Increment/Decrement:"
+.Lxly_str_e69312a97d9cd939:
+    .asciz  "  After ++:"
+.Lxly_str_1b6c10a99bcb103d:
+    .asciz  "  After --:"
+.Lxly_str_002f87aa8d0e6981:
+    .asciz  "14. Module Usage:"
+.Lxly_str_efbfe0db3d04816e:
+    .asciz  "  sqrt(16) ="
+.Lxly_str_5db1331a88b3398f:
+    .asciz  "  pow(2, 8) ="
+.Lxly_str_56eb2be08daad235:
+    .asciz  "  upper('hello') ="
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_118b29e13d3c714d:
+    .asciz  "15. OS Module:"
+.Lxly_str_0c440002c9fec970:
+    .asciz  "  Platform:"
+.Lxly_str_08b05507b5565e57:
+    .asciz  "os"
+.Lxly_str_3e4bd4e31c5c3ad2:
+    .asciz  "platform"
+.Lxly_str_1670eabdf30e3a30:
+    .asciz  "  PID:"
+.Lxly_str_fa53d71e58427c00:
+    .asciz  "getpid"
+.Lxly_str_be1b855b49a0d83f:
+    .asciz  "16. Crypto Module:"
+.Lxly_str_f9e6e6ef197c2b25:
+    .asciz  "test"
+.Lxly_str_33f8d791f4706d8b:
+    .asciz  "  hash('test') ="
+.Lxly_str_f342c7914fd0f990:
+    .asciz  "crypto"
+.Lxly_str_2e3d9ecc741a7811:
+    .asciz  "hash"
+.Lxly_str_e14058b64d8aaad6:
+    .asciz  "17. Path Module:"
+.Lxly_str_b17eeef9480d2491:
+    .asciz  "/home"
+.Lxly_str_7d6780e4032b48f2:
+    .asciz  "user"
+.Lxly_str_021802b0f58e99e5:
+    .asciz  "file.txt"
+.Lxly_str_03c52d0debd70676:
+    .asciz  "path"
+.Lxly_str_41def2de29651139:
+    .asciz  "join"
+.Lxly_str_0f0f354b75e8af7f:
+    .asciz  "  joined path:"
+.Lxly_str_5008c45ba1d5a6bb:
+    .asciz  "  basename:"
+.Lxly_str_79b6a9af7a07f29b:
+    .asciz  "basename"
+.Lxly_str_96c3f0565fe6adf7:
+    .asciz  "  dirname:"
+.Lxly_str_ad90b24c904b7f0f:
+    .asciz  "dirname"
+.Lxly_str_2075d279f36ef3a3:
+    .asciz  "\342\234\205 All tests passed!"
+.Lxly_str_cbee792189772115:
+    .asciz  "Native compiler is working correctly! \360\237\232\200"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   22
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   176
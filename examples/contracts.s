@@ -0,0 +1,2156 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movl    $-1, -236(%rbp)
+    leaq    .Lxly_str_d419715a3f5856c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9dc13d44ce60ac67(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d2958f20326f5548(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b2:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    leaq    .Lxly_str_4fd9fdac59015918(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_myAssert
+    movq    %rax, %r14
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b1:
+    leaq    .Lxly_ir0_k176(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0a9a8b740a43fccb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_efbfe0db3d04816e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4030000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b4:
+.Lxly_ir0_b6:
+    movq    %rbx, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b3:
+    movq    %r12, %xmm0
+    movsd   %xmm0, -264(%rbp)
+    leaq    -272(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5a91b15947ddd545(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b8:
+.Lxly_ir0_b9:
+    leaq    .Lxly_str_c8e13e3a46d71811(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %rbx
+.Lxly_ir0_b7:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_84773d686dce9c0d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fc8f33d9185851e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b12:
+.Lxly_ir0_b14:
+.Lxly_ir0_b15:
+.Lxly_ir0_b17:
+.Lxly_ir0_b11:
+    leaq    .Lxly_ir0_k178(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8698180b236aa942(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b19:
+.Lxly_ir0_b20:
+.Lxly_ir0_b22:
+.Lxly_ir0_b24:
+.Lxly_ir0_b18:
+    leaq    .Lxly_ir0_k179(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5724d790ac59e87d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_533bb7ccc4cf52d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k180(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k181(%rip), %rax
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k182(%rip), %rax
+    movq    %rax, -56(%rbp)
+    movq    %r15, %rdi
+    movq    -48(%rbp), %rsi
+    movq    -56(%rbp), %rdx
+    call    .Lxly_fn_clamp
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_31d0a72f7bd5ceb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0xc014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k183(%rip), %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir0_k184(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k185(%rip), %rax
+    movq    %rax, -80(%rbp)
+    movq    -72(%rbp), %rdi
+    movq    %rbx, %rsi
+    movq    -80(%rbp), %rdx
+    call    .Lxly_fn_clamp
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b1b4458345640f25(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k186(%rip), %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir0_k187(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k188(%rip), %rax
+    movq    %rax, %r12
+    movq    -96(%rbp), %rdi
+    movq    %r15, %rsi
+    movq    %r12, %rdx
+    call    .Lxly_fn_clamp
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f51c823a5e8a0d66(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4044000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k193(%rip), %rax
+    movq    %rax, %r15
+    subq    $48, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_73785562d1fd1ca0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, -144(%rbp)
+    movq    %r12, %rdi
+    movq    -144(%rbp), %rsi
+    call    .Lxly_fn_safeGet
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_415c42084d265da1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_safeGet
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9a9a5b3a3c0d0fcd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x40c81c8000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k196(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    call    .Lxly_fn_createBankAccount
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_8a5ef6c6474467c7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_6b88b5f721c34e75(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x407f400000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k198(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_6c86e9a8e0e445d5(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_4f8b9586a5b15e6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_6b88b5f721c34e75(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4069000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_f2d50b75b3e12f37(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r12
+    leaq    .Lxly_str_95c08a6ff7bc06f4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_6b88b5f721c34e75(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c8d8da39c2e9b01(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x409f400000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_f2d50b75b3e12f37(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2d28669a3fbad92f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_24ebf48796109b39(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k201(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_35ac00b45b21a5d2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0xbff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k202(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c20e1c0b4d7a7a2d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3869a6b89f5261bd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fb6966ba4d9c0252(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k176:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k178:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k179:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k180:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k181:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k182:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k183:
+    .quad   0, 0xc014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k184:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k185:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k186:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k187:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k188:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k189:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k193:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k196:
+    .quad   0, 0x40c81c8000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k197:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k198:
+    .quad   0, 0x407f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x4069000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x409f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k201:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k202:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_myAssert:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    call    xly_not
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    leaq    .Lxly_str_ecd4b12a7213fe82(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf0_0_b2:
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_safeDivide:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf1_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_neq
+.Lxly_f1_2:
+    movq    %rax, %r13
+    leaq    .Lxly_str_4fd9fdac59015918(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_irf1_0_b3:
+    movq    %r13, %rdi
+    call    xly_not
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b5
+.Lxly_irf1_0_b4:
+    leaq    .Lxly_str_ecd4b12a7213fe82(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf1_0_b5:
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sqrt:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b2
+.Lxly_irf2_0_b1:
+    leaq    .Lxly_str_c8e13e3a46d71811(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b2:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sqrt
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_absolute:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf3_0_b3
+.Lxly_irf3_0_b1:
+    movq    %r12, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    jmp     .Lxly_irf3_0_b2
+.Lxly_irf3_0_b3:
+    movq    %rbx, %r14
+.Lxly_irf3_0_b2:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf3_0_b5
+.Lxly_irf3_0_b4:
+    leaq    .Lxly_str_aaedf699b7f6151d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf3_0_b5:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_clamp:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf4_0_b2
+.Lxly_irf4_0_b1:
+    leaq    .Lxly_str_810485c311e97e1d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf4_0_b2:
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_4
+.Lxly_f4_3:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf4_0_b13
+.Lxly_irf4_0_b4:
+    movq    %r12, %r14
+    jmp     .Lxly_irf4_0_b5
+.Lxly_irf4_0_b13:
+    movq    %rbx, %r14
+.Lxly_irf4_0_b5:
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_6
+.Lxly_f4_5:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_6:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf4_0_b14
+.Lxly_irf4_0_b6:
+    movq    %r13, %rbx
+    jmp     .Lxly_irf4_0_b7
+.Lxly_irf4_0_b14:
+    movq    %r14, %rbx
+.Lxly_irf4_0_b7:
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f4_8
+.Lxly_f4_7:
+    call    xly_lt
+.Lxly_f4_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf4_0_b10
+.Lxly_irf4_0_b15:
+    movq    %r14, %r13
+    jmp     .Lxly_irf4_0_b11
+.Lxly_irf4_0_b10:
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_9
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f4_10
+.Lxly_f4_9:
+    call    xly_gt
+.Lxly_f4_10:
+    movq    %rax, %r12
+    movq    %r12, %r13
+.Lxly_irf4_0_b11:
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf4_0_b9
+.Lxly_irf4_0_b8:
+    leaq    .Lxly_str_15713bcd47cff5ae(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf4_0_b9:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_safeGet:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    call    xly_null
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f5_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf5_0_b2
+.Lxly_irf5_0_b1:
+    leaq    .Lxly_str_63a0f1b6d0136a8b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b2:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -64(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf5_0_b6
+.Lxly_irf5_0_b10:
+    jmp     .Lxly_irf5_0_b7
+.Lxly_irf5_0_b6:
+    movq    %r12, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setae   %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f5_4
+.Lxly_f5_3:
+    call    xly_gte
+.Lxly_f5_4:
+    movq    %rax, %r15
+    movq    %r15, %r14
+.Lxly_irf5_0_b7:
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf5_0_b5
+.Lxly_irf5_0_b4:
+    leaq    .Lxly_str_df57057d2ed1864c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b5:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_createBankAccount:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf6_4_b2
+.Lxly_irf6_4_b1:
+    leaq    .Lxly_str_efcc22149695650b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf6_4_b2:
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf6_4_b5
+.Lxly_irf6_4_b4:
+    leaq    .Lxly_str_b3d4ef4ce782df89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf6_4_b5:
+    call    xly_obj_new
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_ef60bbb873b79d4d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_f6_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_544a8e75e7bcdecd(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_f6_1(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_6c86e9a8e0e445d5(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_f6_2(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_f2d50b75b3e12f37(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_f6_3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_6b88b5f721c34e75(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, -56(%rbp)
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf7_0_b2
+.Lxly_irf7_0_b1:
+    leaq    .Lxly_str_ab96241e144189f3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf7_0_b2:
+    movabsq $0x4065400000000000, %rax
+    movq    %rax, %r13
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf7_0_b5
+.Lxly_irf7_0_b4:
+    leaq    .Lxly_str_938de8043b85ea46(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf7_0_b5:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    %r14, %r13
+    movq    %r14, %r15
+.Lxly_irf7_0_b7:
+    movq    %r13, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf7_0_b9
+.Lxly_irf7_0_b8:
+    movq    %r13, %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+    movq    %r12, %r15
+    jmp     .Lxly_irf7_0_b7
+.Lxly_irf7_0_b9:
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf7_0_b11
+.Lxly_irf7_0_b10:
+    leaq    .Lxly_str_cdcdd1afba9afd1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf7_0_b11:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f6_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    call    xly_this
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf8_0_b2
+.Lxly_irf8_0_b1:
+    leaq    .Lxly_str_43ebab85b83e2291(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf8_0_b2:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f6_1:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -140(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b2
+.Lxly_irf9_0_b1:
+    leaq    .Lxly_str_23785e0f63d03c5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf9_0_b2:
+    call    xly_this
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f9_2
+.Lxly_f9_1:
+    call    xly_add
+.Lxly_f9_2:
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f9_4
+.Lxly_f9_3:
+    call    xly_add
+.Lxly_f9_4:
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_6
+.Lxly_f9_5:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_6:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf9_0_b5
+.Lxly_irf9_0_b4:
+    leaq    .Lxly_str_4154de68442c0642(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf9_0_b5:
+    movq    %r13, %rdi
+    leaq    .Lxly_str_544a8e75e7bcdecd(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r15
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f6_2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -140(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b2
+.Lxly_irf10_0_b1:
+    leaq    .Lxly_str_23785e0f63d03c5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b2:
+    call    xly_this
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_2
+.Lxly_f10_1:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf10_0_b5
+.Lxly_irf10_0_b4:
+    leaq    .Lxly_str_f7bb904311feecd5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b5:
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_4
+.Lxly_f10_3:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_4:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf10_0_b8
+.Lxly_irf10_0_b7:
+    leaq    .Lxly_str_4154de68442c0642(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf10_0_b8:
+    movq    %r13, %rdi
+    leaq    .Lxly_str_544a8e75e7bcdecd(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f6_3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    call    xly_this
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf11_0_b2
+.Lxly_irf11_0_b1:
+    leaq    .Lxly_str_517eff2dc77442d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf11_0_b2:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   6
+.Lxly_atoms:
+.Lxly_atom_ef60bbb873b79d4d:
+    .quad   .Lxly_str_ef60bbb873b79d4d
+.Lxly_atom_420234a0f998390b:
+    .quad   .Lxly_str_420234a0f998390b
+.Lxly_atom_544a8e75e7bcdecd:
+    .quad   .Lxly_str_544a8e75e7bcdecd
+.Lxly_atom_6c86e9a8e0e445d5:
+    .quad   .Lxly_str_6c86e9a8e0e445d5
+.Lxly_atom_f2d50b75b3e12f37:
+    .quad   .Lxly_str_f2d50b75b3e12f37
+.Lxly_atom_6b88b5f721c34e75:
+    .quad   .Lxly_str_6b88b5f721c34e75
+
+.section .rodata
+.Lxly_str_d419715a3f5856c5:
+    .asciz  "=== Design by Contract Programming ==="
+.Lxly_str_9dc13d44ce60ac67:
+    .asciz  "1. Assertions:"
+.Lxly_str_d2958f20326f5548:
+    .asciz  "  safeDivide(10, 2) ="
+.Lxly_str_4fd9fdac59015918:
+    .asciz  "Denominator must not be zero"
+.Lxly_str_0a9a8b740a43fccb:
+    .asciz  "2. Precondition Pattern:"
+.Lxly_str_efbfe0db3d04816e:
+    .asciz  "  sqrt(16) ="
+.Lxly_str_5a91b15947ddd545:
+    .asciz  "  sqrt(-1) ="
+.Lxly_str_c8e13e3a46d71811:
+    .asciz  "PRECONDITION FAILED: sqrt requires x >= 0"
+.Lxly_str_84773d686dce9c0d:
+    .asciz  "3. Postcondition Pattern:"
+.Lxly_str_fc8f33d9185851e5:
+    .asciz  "  absolute(5) ="
+.Lxly_str_8698180b236aa942:
+    .asciz  "  absolute(-5) ="
+.Lxly_str_5724d790ac59e87d:
+    .asciz  "4. Range Validation:"
+.Lxly_str_533bb7ccc4cf52d4:
+    .asciz  "  clamp(5, 0, 10) ="
+.Lxly_str_31d0a72f7bd5ceb9:
+    .asciz  "  clamp(-5, 0, 10) ="
+.Lxly_str_b1b4458345640f25:
+    .asciz  "  clamp(15, 0, 10) ="
+.Lxly_str_f51c823a5e8a0d66:
+    .asciz  "5. Array Bounds Checking:"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_73785562d1fd1ca0:
+    .asciz  "  safeGet(numbers, 2) ="
+.Lxly_str_415c42084d265da1:
+    .asciz  "  safeGet(numbers, 10) ="
+.Lxly_str_9a9a5b3a3c0d0fcd:
+    .asciz  "6. State Validation (Bank Account):"
+.Lxly_str_8a5ef6c6474467c7:
+    .asciz  "  Initial balance:"
+.Lxly_str_6b88b5f721c34e75:
+    .asciz  "getBalance"
+.Lxly_str_6c86e9a8e0e445d5:
+    .asciz  "deposit"
+.Lxly_str_4f8b9586a5b15e6b:
+    .asciz  "  After deposit(500):"
+.Lxly_str_f2d50b75b3e12f37:
+    .asciz  "withdraw"
+.Lxly_str_95c08a6ff7bc06f4:
+    .asciz  "  After withdraw(200):"
+.Lxly_str_4c8d8da39c2e9b01:
+    .asciz  "  Attempting withdraw(2000)..."
+.Lxly_str_2d28669a3fbad92f:
+    .asciz  "7. Mathematical Contracts:"
+.Lxly_str_24ebf48796109b39:
+    .asciz  "  factorial(5) ="
+.Lxly_str_35ac00b45b21a5d2:
+    .asciz  "  factorial(-1) ="
+.Lxly_str_c20e1c0b4d7a7a2d:
+    .asciz  "\342\234\205 Design by Contract patterns demonstrated!"
+.Lxly_str_3869a6b89f5261bd:
+    .asciz  "Note: Full syntax support (requires/ensures keywords)"
+.Lxly_str_fb6966ba4d9c0252:
+    .asciz  "      will be available in the next version."
+.Lxly_str_ecd4b12a7213fe82:
+    .asciz  "ASSERTION FAILED:"
+.Lxly_str_aaedf699b7f6151d:
+    .asciz  "POSTCONDITION FAILED: result must be >= 0"
+.Lxly_str_810485c311e97e1d:
+    .asciz  "PRECONDITION FAILED: min must be <= max"
+.Lxly_str_15713bcd47cff5ae:
+    .asciz  "POSTCONDITION FAILED: result out of range"
+.Lxly_str_63a0f1b6d0136a8b:
+    .asciz  "PRECONDITION FAILED: array must not be null"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_df57057d2ed1864c:
+    .asciz  "PRECONDITION FAILED: index out of bounds"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_efcc22149695650b:
+    .asciz  "PRECONDITION FAILED: accountNum must be > 0"
+.Lxly_str_b3d4ef4ce782df89:
+    .asciz  "PRECONDITION FAILED: initialBalance must be >= 0"
+.Lxly_str_ab96241e144189f3:
+    .asciz  "PRECONDITION FAILED: n must be >= 0"
+.Lxly_str_938de8043b85ea46:
+    .asciz  "PRECONDITION FAILED: n must be <= 170 (overflow)"
+.Lxly_str_cdcdd1afba9afd1a:
+    .asciz  "POSTCONDITION FAILED: result must be > 0"
+.Lxly_str_43ebab85b83e2291:
+    .asciz  "INVARIANT FAILED: balance must be >= 0"
+.Lxly_str_23785e0f63d03c5a:
+    .asciz  "PRECONDITION FAILED: amount must be > 0"
+.Lxly_str_4154de68442c0642:
+    .asciz  "POSTCONDITION FAILED: incorrect balance"
+.Lxly_str_544a8e75e7bcdecd:
+    .asciz  "checkInvariant"
+.Lxly_str_f7bb904311feecd5:
+    .asciz  "PRECONDITION FAILED: insufficient funds"
+.Lxly_str_517eff2dc77442d4:
+    .asciz  "POSTCONDITION FAILED: balance must be >= 0"
+.Lxly_str_ef60bbb873b79d4d:
+    .asciz  "accountNumber"
+.Lxly_str_420234a0f998390b:
+    .asciz  "balance"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   2
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   16
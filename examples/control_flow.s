@@ -0,0 +1,738 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $944, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movl    $-1, -908(%rbp)
+    movl    $-1, -780(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k142(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_classify
+    movq    %rax, %rbx
+    movabsq $0xc01c000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k143(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_classify
+    movq    %rax, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k144(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_classify
+    movq    %rax, %r13
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_68a3e24e41eb152e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k145(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movq    -56(%rbp), %r15
+.Lxly_ir0_b1:
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r15, %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r15, %xmm0
+    movq    -64(%rbp), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %r14, %r15
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_eaffb21998747f3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k148(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k149(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r15, %r14
+    movq    %rbx, -80(%rbp)
+.Lxly_ir0_b4:
+    movq    %r14, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -88(%rbp)
+    cmpq    $0, -88(%rbp)
+    je      .Lxly_ir0_b6
+.Lxly_ir0_b5:
+    movq    -80(%rbp), %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    -112(%rbp), %r14
+    movq    -96(%rbp), %rax
+    movq    %rax, -80(%rbp)
+    jmp     .Lxly_ir0_b4
+.Lxly_ir0_b6:
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_060362785442c6c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    -80(%rbp), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4828c2ae18c83be5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k153(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, -128(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_d8137a408c1f103d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_str_d1ba0f84ee824ecc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_2a1adba7e432082c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movq    %r15, %r14
+.Lxly_ir0_b7:
+    movq    %r14, %xmm0
+    movq    -128(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -176(%rbp)
+    cmpq    $0, -176(%rbp)
+    je      .Lxly_ir0_b9
+.Lxly_ir0_b8:
+    movq    %r14, %xmm0
+    movq    -136(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -184(%rbp)
+    movq    %rbx, %xmm0
+    movq    -184(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -192(%rbp)
+    cmpq    $0, -192(%rbp)
+    je      .Lxly_ir0_b12
+.Lxly_ir0_b10:
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b11
+.Lxly_ir0_b12:
+    movq    %r14, %xmm0
+    movq    -152(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -200(%rbp)
+    movq    %rbx, %xmm0
+    movq    -200(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -208(%rbp)
+    cmpq    $0, -208(%rbp)
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b13:
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b14
+.Lxly_ir0_b15:
+    movq    %r14, %xmm0
+    movq    -56(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -216(%rbp)
+    movq    %rbx, %xmm0
+    movq    -216(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -224(%rbp)
+    cmpq    $0, -224(%rbp)
+    je      .Lxly_ir0_b18
+.Lxly_ir0_b16:
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b17
+.Lxly_ir0_b18:
+    movq    %r14, %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    movq    %rax, -232(%rbp)
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b17:
+.Lxly_ir0_b14:
+.Lxly_ir0_b11:
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -240(%rbp)
+    movq    -240(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movq    -240(%rbp), %r14
+    jmp     .Lxly_ir0_b7
+.Lxly_ir0_b9:
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_988a3289e61d5e6f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k156(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    movq    %r15, -272(%rbp)
+.Lxly_ir0_b19:
+    movq    -272(%rbp), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -280(%rbp)
+    cmpq    $0, -280(%rbp)
+    je      .Lxly_ir0_b21
+.Lxly_ir0_b20:
+    movq    %r15, %rbx
+    movq    -48(%rbp), %r13
+.Lxly_ir0_b22:
+    movq    %rbx, %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b24
+.Lxly_ir0_b23:
+    movq    -272(%rbp), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    movq    -248(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b27
+.Lxly_ir0_b25:
+    movq    %r13, %rdi
+    movq    -256(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, %r12
+    jmp     .Lxly_ir0_b26
+.Lxly_ir0_b27:
+    movq    %r13, %r12
+.Lxly_ir0_b26:
+    movq    %r14, %xmm0
+    movsd   %xmm0, -808(%rbp)
+    leaq    -816(%rbp), %rax
+    movq    %rax, -288(%rbp)
+    movq    %r12, %rdi
+    movq    -288(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -936(%rbp)
+    leaq    -944(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    -264(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %rbx
+    movq    %r12, %r13
+    jmp     .Lxly_ir0_b22
+.Lxly_ir0_b24:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -272(%rbp), %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %r12, -272(%rbp)
+    jmp     .Lxly_ir0_b19
+.Lxly_ir0_b21:
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k142:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k143:
+    .quad   0, 0xc01c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k144:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k145:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k148:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k149:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k153:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k156:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_classify:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b1:
+    leaq    .Lxly_str_73c1a26e3c886fb0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_irf0_0_b2
+.Lxly_irf0_0_b3:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b6
+.Lxly_irf0_0_b4:
+    leaq    .Lxly_str_4f0d9d1d518561e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_irf0_0_b5
+.Lxly_irf0_0_b6:
+    leaq    .Lxly_str_e4c102c53cc89951(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf0_0_b5:
+.Lxly_irf0_0_b2:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_68a3e24e41eb152e:
+    .asciz  "Countdown:"
+.Lxly_str_eaffb21998747f3e:
+    .asciz  "Go!"
+.Lxly_str_060362785442c6c3:
+    .asciz  "Sum of 1 to 100 ="
+.Lxly_str_4828c2ae18c83be5:
+    .asciz  "FizzBuzz:"
+.Lxly_str_d8137a408c1f103d:
+    .asciz  "FizzBuzz"
+.Lxly_str_d1ba0f84ee824ecc:
+    .asciz  "Fizz"
+.Lxly_str_2a1adba7e432082c:
+    .asciz  "Buzz"
+.Lxly_str_988a3289e61d5e6f:
+    .asciz  "Multiplication Table (1-5):"
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_73c1a26e3c886fb0:
+    .asciz  "is positive"
+.Lxly_str_4f0d9d1d518561e8:
+    .asciz  "is negative"
+.Lxly_str_e4c102c53cc89951:
+    .asciz  "is zero"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   5
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   40
@@ -1,2742 +1,2469 @@
 .section .text
 .globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
 main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $608, %rsp
-    leaq    .Lxly_str_0(%rip), %rdi
-    call    xly_str
-    movq    %rax, -8(%rbp)
-    leaq    .Lxly_str_1(%rip), %rdi
-    call    xly_str
-    movq    %rax, -16(%rbp)
+    subq    $2976, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_a46bf1b25ad211d9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_3e4fd1ed3062b331(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+8(%rip)
     xorq    %rdx, %rdx
-    leaq    .Lxly_str_2(%rip), %rdi
-    leaq    .Lxly_str_3(%rip), %rsi
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_3e4bd4e31c5c3ad2(%rip), %rsi
     movl    $0, %ecx
     call    xly_call_module
-    movq    %rax, -24(%rbp)
-    subq    $8, %rsp
-    movabsq $4634415122796773376, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -32(%rbp)
-    subq    $8, %rsp
-    movabsq $4662659377491083264, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -40(%rbp)
-    subq    $8, %rsp
-    movabsq $4670232813583204352, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
     movq    %rax, -48(%rbp)
-    subq    $8, %rsp
-    movabsq $4644337115725824000, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x4050c00000000000, %rax
     movq    %rax, -56(%rbp)
-    subq    $8, %rsp
-    movabsq $4647714815446351872, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    leaq    .Lxly_ir0_k714(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x40b5180000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k715(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x40d0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k716(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x4074000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k717(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x4080000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k718(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x405f000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k719(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movabsq $0x4043000000000000, %rax
     movq    %rax, -64(%rbp)
-    subq    $8, %rsp
-    movabsq $4638426141214900224, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    leaq    .Lxly_ir0_k720(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k721(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_ir0_k722(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k723(%rip), %rax
     movq    %rax, -72(%rbp)
-    subq    $8, %rsp
-    movabsq $4630544841867001856, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -72(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_ir0_k724(%rip), %rax
     movq    %rax, -80(%rbp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -80(%rbp), %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_ir0_k725(%rip), %rax
     movq    %rax, -88(%rbp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -88(%rbp), %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_ir0_k726(%rip), %rax
     movq    %rax, -96(%rbp)
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -96(%rbp), %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_ir0_k727(%rip), %rax
     movq    %rax, -104(%rbp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -104(%rbp), %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movabsq $0x4030000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k728(%rip), %rax
     movq    %rax, -112(%rbp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -120(%rbp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -128(%rbp)
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -136(%rbp)
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4625196817309499392, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -112(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_5(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -144(%rbp)
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    movabsq $0x4037000000000000, %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k729(%rip), %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k730(%rip), %rax
+    movq    %rax, -136(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -128(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4627167142146473984, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -136(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -144(%rbp)
+    movabsq $0x403f000000000000, %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k731(%rip), %rax
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_ir0_k732(%rip), %rax
+    movq    %rax, -168(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -160(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4629418941960159232, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -168(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -176(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -184(%rbp)
+    movabsq $0x4046800000000000, %rax
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_ir0_k733(%rip), %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k734(%rip), %rax
+    movq    %rax, -208(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4611686018427387904, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -200(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4631530004285489152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -208(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -216(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k735(%rip), %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_ir0_k736(%rip), %rax
+    movq    %rax, -232(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -224(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4630544841867001856, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -232(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -240(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -248(%rbp)
+    movabsq $0x404a000000000000, %rax
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_ir0_k737(%rip), %rax
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_ir0_k738(%rip), %rax
+    movq    %rax, -272(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4616189618054758400, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -264(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4632515166703976448, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -272(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -280(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -288(%rbp)
+    movabsq $0x404e800000000000, %rax
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_ir0_k739(%rip), %rax
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k740(%rip), %rax
+    movq    %rax, -312(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -304(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4633781804099174400, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -312(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -320(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -328(%rbp)
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_ir0_k741(%rip), %rax
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_ir0_k742(%rip), %rax
+    movq    %rax, -352(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4618441417868443648, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -344(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4632937379169042432, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -352(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -360(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -368(%rbp)
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, -376(%rbp)
+    leaq    .Lxly_ir0_k743(%rip), %rax
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir0_k744(%rip), %rax
+    movq    %rax, -392(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4619567317775286272, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -384(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4631952216750555136, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -392(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -400(%rbp)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -408(%rbp)
+    movabsq $0x4051800000000000, %rax
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_ir0_k745(%rip), %rax
+    movq    %rax, -424(%rbp)
+    leaq    .Lxly_ir0_k746(%rip), %rax
+    movq    %rax, -432(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4620693217682128896, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -424(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634626229029306368, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -432(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -440(%rbp)
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -448(%rbp)
+    movabsq $0x4054800000000000, %rax
+    movq    %rax, -456(%rbp)
+    leaq    .Lxly_ir0_k747(%rip), %rax
+    movq    %rax, -464(%rbp)
+    leaq    .Lxly_ir0_k748(%rip), %rax
+    movq    %rax, -472(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4621256167635550208, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -464(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4635470653959438336, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -472(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -480(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -488(%rbp)
+    movabsq $0x4052c00000000000, %rax
+    movq    %rax, -496(%rbp)
+    leaq    .Lxly_ir0_k749(%rip), %rax
+    movq    %rax, -504(%rbp)
+    leaq    .Lxly_ir0_k750(%rip), %rax
+    movq    %rax, -512(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -504(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634978072750194688, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -512(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -520(%rbp)
+    movabsq $0x4026000000000000, %rax
+    movq    %rax, -528(%rbp)
+    movabsq $0x4051400000000000, %rax
+    movq    %rax, -536(%rbp)
+    leaq    .Lxly_ir0_k751(%rip), %rax
+    movq    %rax, -544(%rbp)
+    leaq    .Lxly_ir0_k752(%rip), %rax
+    movq    %rax, -552(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4622382067542392832, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -544(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634555860285128704, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -552(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -560(%rbp)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, -568(%rbp)
+    movabsq $0x4052400000000000, %rax
+    movq    %rax, -576(%rbp)
+    leaq    .Lxly_ir0_k753(%rip), %rax
+    movq    %rax, -584(%rbp)
+    leaq    .Lxly_ir0_k754(%rip), %rax
+    movq    %rax, -592(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4622945017495814144, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -584(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634837335261839360, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -592(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -600(%rbp)
+    movabsq $0x402a000000000000, %rax
+    movq    %rax, -608(%rbp)
+    leaq    .Lxly_ir0_k755(%rip), %rax
+    movq    %rax, -616(%rbp)
+    leaq    .Lxly_ir0_k756(%rip), %rax
+    movq    %rax, -624(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4623507967449235456, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -616(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634415122796773376, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -624(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -632(%rbp)
+    movabsq $0x402c000000000000, %rax
+    movq    %rax, -640(%rbp)
+    movabsq $0x4051c00000000000, %rax
+    movq    %rax, -648(%rbp)
+    leaq    .Lxly_ir0_k757(%rip), %rax
+    movq    %rax, -656(%rbp)
+    leaq    .Lxly_ir0_k758(%rip), %rax
+    movq    %rax, -664(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4624070917402656768, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -656(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634696597773484032, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -664(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -672(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -680(%rbp)
+    leaq    .Lxly_ir0_k759(%rip), %rax
+    movq    %rax, -688(%rbp)
+    leaq    .Lxly_ir0_k760(%rip), %rax
+    movq    %rax, -696(%rbp)
     subq    $32, %rsp
-    movq    -144(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4624633867356078080, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -688(%rbp), %rax
     movq    %rax, 8(%rsp)
-    subq    $8, %rsp
-    movabsq $4634415122796773376, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -696(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
-    subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rax, -704(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, -712(%rbp)
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -720(%rbp)
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
+    movq    -712(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_6
-    cmpl    $1, (%rsi)
-    je      .Lxly_6
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_7
-.Lxly_6:
-    call    xly_add
-.Lxly_7:
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_4
-    cmpl    $1, (%rsi)
-    je      .Lxly_4
+    movq    %rax, -728(%rbp)
+.Lxly_ir0_b8:
+    leaq    .Lxly_str_e22f84f0e00344dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -736(%rbp)
+.Lxly_ir0_b7:
+    movq    -736(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_97edf644ac008fe6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -744(%rbp)
+    movq    -744(%rbp), %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_5
-.Lxly_4:
+    jmp     .Lxly_2
+.Lxly_1:
     call    xly_add
-.Lxly_5:
-    pushq   %rax
-    leaq    .Lxly_str_11(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_2
-    cmpl    $1, (%rsi)
-    je      .Lxly_2
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_3
 .Lxly_2:
-    call    xly_add
-.Lxly_3:
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_0
-    cmpl    $1, (%rsi)
-    je      .Lxly_0
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_1
-.Lxly_0:
-    call    xly_add
-.Lxly_1:
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -752(%rbp)
+    movq    -736(%rbp), %rdi
+    movq    -752(%rbp), %rsi
     call    .Lxly_fn_drawStatusBar
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4630826316843712512, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    leaq    .Lxly_str_12(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -760(%rbp)
+    movabsq $0x4044000000000000, %rax
+    movq    %rax, -768(%rbp)
+    leaq    .Lxly_str_2d2550bb73a9c6e1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -776(%rbp)
+    leaq    .Lxly_ir0_k761(%rip), %rax
+    movq    %rax, -784(%rbp)
+    leaq    .Lxly_ir0_k762(%rip), %rax
+    movq    %rax, -792(%rbp)
+    leaq    .Lxly_ir0_k763(%rip), %rax
+    movq    %rax, -800(%rbp)
+    leaq    .Lxly_ir0_k764(%rip), %rax
+    movq    %rax, -808(%rbp)
+    movq    -784(%rbp), %rdi
+    movq    -792(%rbp), %rsi
+    movq    -800(%rbp), %rdx
+    movq    -808(%rbp), %rcx
+    movq    -776(%rbp), %r8
     call    .Lxly_fn_drawPanel
-    subq    $8, %rsp
-    movabsq $4616189618054758400, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_13(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -32(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_10
-    cmpl    $1, (%rsi)
-    je      .Lxly_10
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_11
-.Lxly_10:
-    call    xly_add
-.Lxly_11:
-    pushq   %rax
-    leaq    .Lxly_str_14(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_8
-    cmpl    $1, (%rsi)
-    je      .Lxly_8
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_9
-.Lxly_8:
-    call    xly_add
-.Lxly_9:
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawLabel
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    movq    -32(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4628574517030027264, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawProgressBar
-    subq    $8, %rsp
-    movabsq $4618441417868443648, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_15(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -40(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_18
-    cmpl    $1, (%rsi)
-    je      .Lxly_18
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_19
-.Lxly_18:
-    call    xly_add
-.Lxly_19:
-    pushq   %rax
-    leaq    .Lxly_str_16(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_16
-    cmpl    $1, (%rsi)
-    je      .Lxly_16
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_17
-.Lxly_16:
-    call    xly_add
-.Lxly_17:
-    pushq   %rax
-    movq    -48(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_14
-    cmpl    $1, (%rsi)
-    je      .Lxly_14
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_15
-.Lxly_14:
-    call    xly_add
-.Lxly_15:
-    pushq   %rax
-    leaq    .Lxly_str_17(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_12
-    cmpl    $1, (%rsi)
-    je      .Lxly_12
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_13
-.Lxly_12:
-    call    xly_add
-.Lxly_13:
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawLabel
-    movq    -40(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    mulsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    movq    -48(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    divsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -160(%rbp)
-    subq    $8, %rsp
-    movabsq $4619567317775286272, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    movq    -160(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4628574517030027264, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawProgressBar
-    subq    $8, %rsp
-    movabsq $4620693217682128896, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_18(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -56(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_26
-    cmpl    $1, (%rsi)
-    je      .Lxly_26
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_27
-.Lxly_26:
-    call    xly_add
-.Lxly_27:
-    pushq   %rax
-    leaq    .Lxly_str_16(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_24
-    cmpl    $1, (%rsi)
-    je      .Lxly_24
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_25
-.Lxly_24:
-    call    xly_add
-.Lxly_25:
-    pushq   %rax
-    movq    -64(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_22
-    cmpl    $1, (%rsi)
-    je      .Lxly_22
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_23
-.Lxly_22:
-    call    xly_add
-.Lxly_23:
-    pushq   %rax
-    leaq    .Lxly_str_19(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_20
-    cmpl    $1, (%rsi)
-    je      .Lxly_20
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_21
-.Lxly_20:
-    call    xly_add
-.Lxly_21:
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawLabel
-    movq    -56(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    mulsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    movq    -64(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    divsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -168(%rbp)
-    subq    $8, %rsp
-    movabsq $4621256167635550208, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    movq    -168(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4628574517030027264, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawProgressBar
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_20(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rax, -816(%rbp)
+.Lxly_ir0_b10:
+    leaq    .Lxly_str_6ef4d6d8ac36494b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -824(%rbp)
+.Lxly_ir0_b9:
+    movq    -824(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_3e16af1814588e0d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -832(%rbp)
+.Lxly_ir0_b12:
+    subq    $16, %rsp
+    movq    -824(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -840(%rbp)
+    call    .Lxly_fn_xuiBold
+    movq    %rax, -848(%rbp)
+    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, -856(%rbp)
+    leaq    .Lxly_str_56cdae4ab2498970(%rip), %rdi
     call    xly_str
-    pushq   %rax
-    movq    -72(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_30
-    cmpl    $1, (%rsi)
-    je      .Lxly_30
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_31
-.Lxly_30:
-    call    xly_add
-.Lxly_31:
-    pushq   %rax
-    leaq    .Lxly_str_21(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_28
-    cmpl    $1, (%rsi)
-    je      .Lxly_28
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_29
-.Lxly_28:
-    call    xly_add
-.Lxly_29:
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawLabel
-    subq    $8, %rsp
-    movabsq $4622382067542392832, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_22(%rip), %rdi
+    movq    %rax, -864(%rbp)
+    subq    $16, %rsp
+    movq    -864(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -872(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -880(%rbp)
+    call    .Lxly_fn_xuiFgBrightYellow
+    movq    %rax, -888(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -896(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -904(%rbp)
+.Lxly_ir0_b11:
+.Lxly_ir0_b14:
+    leaq    .Lxly_str_ec76a0cfd555b9aa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -912(%rbp)
+.Lxly_ir0_b13:
+    movq    -912(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -920(%rbp)
+    movabsq $0x403c000000000000, %rax
+    movq    %rax, -928(%rbp)
+    leaq    .Lxly_ir0_k765(%rip), %rax
+    movq    %rax, -936(%rbp)
+    leaq    .Lxly_ir0_k766(%rip), %rax
+    movq    %rax, -944(%rbp)
+    leaq    .Lxly_ir0_k767(%rip), %rax
+    movq    %rax, -952(%rbp)
+    movq    -912(%rbp), %rdi
+    movq    -936(%rbp), %rsi
+    movq    -944(%rbp), %rdx
+    movq    -952(%rbp), %rcx
+    call    .Lxly_fn_drawProgressBar
+    movq    %rax, -960(%rbp)
+.Lxly_ir0_b16:
+    leaq    .Lxly_str_700342ea56a0a5f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -968(%rbp)
+.Lxly_ir0_b15:
+    movq    -968(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_d43673d59c06f2ac(%rip), %rdi
+    call    xly_str
+    movq    %rax, -976(%rbp)
+.Lxly_ir0_b18:
+    subq    $16, %rsp
+    movq    -968(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -984(%rbp)
+    call    .Lxly_fn_xuiBold
+    movq    %rax, -992(%rbp)
+    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, -1000(%rbp)
+    leaq    .Lxly_str_9ca37ee247abf210(%rip), %rdi
     call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rax, -1008(%rbp)
+    subq    $16, %rsp
+    movq    -1008(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1016(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1024(%rbp)
+    call    .Lxly_fn_xuiFgBrightYellow
+    movq    %rax, -1032(%rbp)
+    subq    $16, %rsp
+    movq    -976(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1040(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1048(%rbp)
+.Lxly_ir0_b17:
+    movabsq $0x40407ac000000000, %rax
+    movq    %rax, -1056(%rbp)
+    leaq    .Lxly_ir0_k768(%rip), %rax
+    movq    %rax, -1064(%rbp)
+    movq    -1064(%rbp), %rax
+    movq    %rax, __xly_globals+152(%rip)
+.Lxly_ir0_b20:
+    leaq    .Lxly_str_3417a4e1a816148c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1072(%rbp)
+.Lxly_ir0_b19:
+    movq    -1072(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_ir0_k769(%rip), %rax
+    movq    %rax, -1080(%rbp)
+    leaq    .Lxly_ir0_k770(%rip), %rax
+    movq    %rax, -1088(%rbp)
+    leaq    .Lxly_ir0_k771(%rip), %rax
+    movq    %rax, -1096(%rbp)
+    movq    -1072(%rbp), %rdi
+    movq    -1080(%rbp), %rsi
+    movq    -1088(%rbp), %rdx
+    movq    -1096(%rbp), %rcx
+    call    .Lxly_fn_drawProgressBar
+    movq    %rax, -1104(%rbp)
+.Lxly_ir0_b22:
+    leaq    .Lxly_str_17cd673defa59b77(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1112(%rbp)
+.Lxly_ir0_b21:
+    movq    -1112(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_ad2a787552b7ee2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1120(%rbp)
+.Lxly_ir0_b24:
+    subq    $16, %rsp
+    movq    -1112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1128(%rbp)
+    call    .Lxly_fn_xuiBold
+    movq    %rax, -1136(%rbp)
+    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, -1144(%rbp)
+    leaq    .Lxly_str_ab2ce80e21d025a6(%rip), %rdi
     call    xly_str
-    pushq   %rax
-    movq    -80(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_34
-    cmpl    $1, (%rsi)
-    je      .Lxly_34
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_35
-.Lxly_34:
-    call    xly_add
-.Lxly_35:
-    pushq   %rax
-    leaq    .Lxly_str_21(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_32
-    cmpl    $1, (%rsi)
-    je      .Lxly_32
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_33
-.Lxly_32:
-    call    xly_add
-.Lxly_33:
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawLabel
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631107791820423168, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4630544841867001856, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    leaq    .Lxly_str_23(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawPanel
-    subq    $8, %rsp
-    movabsq $4616189618054758400, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    call    .Lxly_fn_xuiFgBrightBlack
+    movq    %rax, -1152(%rbp)
+    subq    $16, %rsp
+    movq    -1152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1160(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1168(%rbp)
+    call    .Lxly_fn_xuiFgBrightYellow
+    movq    %rax, -1176(%rbp)
+    subq    $16, %rsp
+    movq    -1120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1184(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1192(%rbp)
+.Lxly_ir0_b23:
+    movabsq $0x404f400000000000, %rax
+    movq    %rax, -1200(%rbp)
+    leaq    .Lxly_ir0_k772(%rip), %rax
+    movq    %rax, -1208(%rbp)
+    movq    -1208(%rbp), %rax
+    movq    %rax, __xly_globals+160(%rip)
+.Lxly_ir0_b26:
+    leaq    .Lxly_str_976ee1351a92ea46(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1216(%rbp)
+.Lxly_ir0_b25:
+    movq    -1216(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_ir0_k773(%rip), %rax
+    movq    %rax, -1224(%rbp)
+    leaq    .Lxly_ir0_k774(%rip), %rax
+    movq    %rax, -1232(%rbp)
+    leaq    .Lxly_ir0_k775(%rip), %rax
+    movq    %rax, -1240(%rbp)
+    movq    -1216(%rbp), %rdi
+    movq    -1224(%rbp), %rsi
+    movq    -1232(%rbp), %rdx
+    movq    -1240(%rbp), %rcx
+    call    .Lxly_fn_drawProgressBar
+    movq    %rax, -1248(%rbp)
+.Lxly_ir0_b28:
+    leaq    .Lxly_str_e29c4f76901eba76(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1256(%rbp)
+.Lxly_ir0_b27:
+    movq    -1256(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_fda509f659855450(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1264(%rbp)
+.Lxly_ir0_b30:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1272(%rbp)
+    call    .Lxly_fn_xuiBold
+    movq    %rax, -1280(%rbp)
+    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, -1288(%rbp)
+    leaq    .Lxly_str_2c93942fa4bfeb16(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1296(%rbp)
+    subq    $16, %rsp
+    movq    -1296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1304(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1312(%rbp)
+    call    .Lxly_fn_xuiFgBrightYellow
+    movq    %rax, -1320(%rbp)
+    subq    $16, %rsp
+    movq    -1264(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1328(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1336(%rbp)
+.Lxly_ir0_b29:
+.Lxly_ir0_b32:
+    leaq    .Lxly_str_64add57f66a30027(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1344(%rbp)
+.Lxly_ir0_b31:
+    movq    -1344(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_b306771003ca5d94(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1352(%rbp)
+.Lxly_ir0_b34:
     subq    $16, %rsp
-    leaq    .Lxly_str_24(%rip), %rdi
+    movq    -1344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1360(%rbp)
+    call    .Lxly_fn_xuiBold
+    movq    %rax, -1368(%rbp)
+    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, -1376(%rbp)
+    leaq    .Lxly_str_d7495929b9449bcd(%rip), %rdi
     call    xly_str
+    movq    %rax, -1384(%rbp)
+    subq    $16, %rsp
+    movq    -1384(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -1392(%rbp)
     call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    movq    -144(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1400(%rbp)
+    call    .Lxly_fn_xuiFgBrightYellow
+    movq    %rax, -1408(%rbp)
+    subq    $16, %rsp
+    movq    -1352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1416(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -1424(%rbp)
+.Lxly_ir0_b33:
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, -1432(%rbp)
+    leaq    .Lxly_str_6691eea56cb2ad90(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1440(%rbp)
+    leaq    .Lxly_ir0_k776(%rip), %rax
+    movq    %rax, -1448(%rbp)
+    leaq    .Lxly_ir0_k777(%rip), %rax
+    movq    %rax, -1456(%rbp)
+    leaq    .Lxly_ir0_k778(%rip), %rax
+    movq    %rax, -1464(%rbp)
+    leaq    .Lxly_ir0_k779(%rip), %rax
+    movq    %rax, -1472(%rbp)
+    movq    -1448(%rbp), %rdi
+    movq    -1456(%rbp), %rsi
+    movq    -1464(%rbp), %rdx
+    movq    -1472(%rbp), %rcx
+    movq    -1440(%rbp), %r8
+    call    .Lxly_fn_drawPanel
+    movq    %rax, -1480(%rbp)
+.Lxly_ir0_b36:
+    leaq    .Lxly_str_c909382ca531b698(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1488(%rbp)
+.Lxly_ir0_b35:
+    movq    -1488(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+.Lxly_ir0_b38:
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1496(%rbp)
+.Lxly_ir0_b37:
+    leaq    .Lxly_str_07fc0307b4bcfe7e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1504(%rbp)
+    subq    $16, %rsp
+    movq    -1504(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1512(%rbp)
+.Lxly_ir0_b40:
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1520(%rbp)
+.Lxly_ir0_b39:
+.Lxly_ir0_b42:
+    leaq    .Lxly_str_03657576cc0014cf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1528(%rbp)
+.Lxly_ir0_b41:
+    movq    -1528(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_ir0_k780(%rip), %rax
+    movq    %rax, -1536(%rbp)
+    movq    -1528(%rbp), %rdi
+    movq    %r14, %rsi
+    movq    -1536(%rbp), %rdx
     call    .Lxly_fn_drawSparkline
-    subq    $8, %rsp
-    movabsq $4622382067542392832, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1544(%rbp)
+    movabsq $0x4046000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k781(%rip), %rax
+    movq    %rax, -1552(%rbp)
+    leaq    .Lxly_ir0_k782(%rip), %rax
+    movq    %rax, -1560(%rbp)
+    movq    -1552(%rbp), %rdi
+    movq    -1560(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    -1568(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
     call    .Lxly_fn_xuiFgBrightBlack
-    subq    $16, %rsp
-    leaq    .Lxly_str_25(%rip), %rdi
+    movq    %rax, -1576(%rbp)
+    leaq    .Lxly_str_83c0062739960df2(%rip), %rdi
     call    xly_str
+    movq    %rax, -1584(%rbp)
+    subq    $16, %rsp
+    movq    -1584(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -1592(%rbp)
     call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1600(%rbp)
+    leaq    .Lxly_ir0_k783(%rip), %rax
+    movq    %rax, -1608(%rbp)
+    leaq    .Lxly_ir0_k784(%rip), %rax
+    movq    %rax, -1616(%rbp)
+    movq    -1608(%rbp), %rdi
+    movq    -1616(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    -1624(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
     call    .Lxly_fn_xuiBold
+    movq    %rax, -1632(%rbp)
     call    .Lxly_fn_xuiFgBrightYellow
-    subq    $16, %rsp
-    leaq    .Lxly_str_26(%rip), %rdi
+    movq    %rax, -1640(%rbp)
+    leaq    .Lxly_str_bab6d0bb935e4179(%rip), %rdi
     call    xly_str
+    movq    %rax, -1648(%rbp)
+    subq    $16, %rsp
+    movq    -1648(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -1656(%rbp)
     call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4618441417868443648, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1664(%rbp)
+    leaq    .Lxly_ir0_k785(%rip), %rax
+    movq    %rax, -1672(%rbp)
+    leaq    .Lxly_ir0_k786(%rip), %rax
+    movq    %rax, -1680(%rbp)
+    movq    -1672(%rbp), %rdi
+    movq    -1680(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    -1688(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
     call    .Lxly_fn_xuiBold
+    movq    %rax, -1696(%rbp)
     call    .Lxly_fn_xuiFgBrightGreen
-    subq    $16, %rsp
-    leaq    .Lxly_str_27(%rip), %rdi
+    movq    %rax, -1704(%rbp)
+    leaq    .Lxly_str_9775e3a5f6b554be(%rip), %rdi
     call    xly_str
-    pushq   %rax
-    movq    -32(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_38
-    cmpl    $1, (%rsi)
-    je      .Lxly_38
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_39
-.Lxly_38:
-    call    xly_add
-.Lxly_39:
-    pushq   %rax
-    leaq    .Lxly_str_14(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_36
-    cmpl    $1, (%rsi)
-    je      .Lxly_36
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_37
-.Lxly_36:
-    call    xly_add
-.Lxly_37:
+    movq    %rax, -1712(%rbp)
+    subq    $16, %rsp
+    movq    -1712(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -1720(%rbp)
     call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4624070917402656768, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4619567317775286272, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4630826316843712512, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    leaq    .Lxly_str_28(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1728(%rbp)
+    leaq    .Lxly_str_f55d634dcc743595(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1736(%rbp)
+    leaq    .Lxly_ir0_k787(%rip), %rax
+    movq    %rax, -1744(%rbp)
+    leaq    .Lxly_ir0_k788(%rip), %rax
+    movq    %rax, -1752(%rbp)
+    leaq    .Lxly_ir0_k789(%rip), %rax
+    movq    %rax, -1760(%rbp)
+    leaq    .Lxly_ir0_k790(%rip), %rax
+    movq    %rax, -1768(%rbp)
+    movq    -1744(%rbp), %rdi
+    movq    -1752(%rbp), %rsi
+    movq    -1760(%rbp), %rdx
+    movq    -1768(%rbp), %rcx
+    movq    -1736(%rbp), %r8
     call    .Lxly_fn_drawPanel
-    subq    $8, %rsp
-    movabsq $4624633867356078080, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1776(%rbp)
+    leaq    .Lxly_ir0_k791(%rip), %rax
+    movq    %rax, -1784(%rbp)
+    leaq    .Lxly_ir0_k792(%rip), %rax
+    movq    %rax, -1792(%rbp)
+    movq    -1784(%rbp), %rdi
+    movq    -1792(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_29(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1800(%rbp)
+    movq    -1800(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_075ed2ad640cb267(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1808(%rbp)
+    leaq    .Lxly_ir0_k793(%rip), %rax
+    movq    %rax, -1816(%rbp)
+    movq    -1800(%rbp), %rdi
+    movq    -1808(%rbp), %rsi
+    movq    -1816(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    subq    $8, %rsp
-    movabsq $4625196817309499392, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1824(%rbp)
+    leaq    .Lxly_ir0_k794(%rip), %rax
+    movq    %rax, -1832(%rbp)
+    leaq    .Lxly_ir0_k795(%rip), %rax
+    movq    %rax, -1840(%rbp)
+    movq    -1832(%rbp), %rdi
+    movq    -1840(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_30(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -96(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1848(%rbp)
+    movq    -1848(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_0e32f28796cc8aba(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1856(%rbp)
+    leaq    .Lxly_ir0_k796(%rip), %rax
+    movq    %rax, -1864(%rbp)
+    movq    -1848(%rbp), %rdi
+    movq    -1856(%rbp), %rsi
+    movq    -1864(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    subq    $8, %rsp
-    movabsq $4625478292286210048, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1872(%rbp)
+    movabsq $0x4031000000000000, %rax
+    movq    %rax, -1880(%rbp)
+    leaq    .Lxly_ir0_k797(%rip), %rax
+    movq    %rax, -1888(%rbp)
+    leaq    .Lxly_ir0_k798(%rip), %rax
+    movq    %rax, -1896(%rbp)
+    movq    -1888(%rbp), %rdi
+    movq    -1896(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_31(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -104(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1904(%rbp)
+    movq    -1904(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_724c3df60a5febc7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1912(%rbp)
+    leaq    .Lxly_ir0_k799(%rip), %rax
+    movq    %rax, -1920(%rbp)
+    movq    -1904(%rbp), %rdi
+    movq    -1912(%rbp), %rsi
+    movq    -1920(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    subq    $8, %rsp
-    movabsq $4625759767262920704, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1928(%rbp)
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, -1936(%rbp)
+    leaq    .Lxly_ir0_k800(%rip), %rax
+    movq    %rax, -1944(%rbp)
+    leaq    .Lxly_ir0_k801(%rip), %rax
+    movq    %rax, -1952(%rbp)
+    movq    -1944(%rbp), %rdi
+    movq    -1952(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_32(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -112(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1960(%rbp)
+    movq    -1960(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_7e0b034249fdb622(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1968(%rbp)
+    leaq    .Lxly_ir0_k802(%rip), %rax
+    movq    %rax, -1976(%rbp)
+    movq    -1960(%rbp), %rdi
+    movq    -1968(%rbp), %rsi
+    movq    -1976(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    movq    -96(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_44
-    cmpl    $1, (%rsi)
-    je      .Lxly_44
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_45
-.Lxly_44:
-    call    xly_add
-.Lxly_45:
-    pushq   %rax
-    movq    -104(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_42
-    cmpl    $1, (%rsi)
-    je      .Lxly_42
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_43
-.Lxly_42:
-    call    xly_add
-.Lxly_43:
-    pushq   %rax
-    movq    -112(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_40
-    cmpl    $1, (%rsi)
-    je      .Lxly_40
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_41
-.Lxly_40:
-    call    xly_add
-.Lxly_41:
-    movq    %rax, -176(%rbp)
-    subq    $8, %rsp
-    movabsq $4626041242239631360, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -1984(%rbp)
+    leaq    .Lxly_ir0_k803(%rip), %rax
+    movq    %rax, -1992(%rbp)
+    movq    -1992(%rbp), %rax
+    movq    %rax, __xly_globals+168(%rip)
+    movabsq $0x4033000000000000, %rax
+    movq    %rax, -2000(%rbp)
+    leaq    .Lxly_ir0_k804(%rip), %rax
+    movq    %rax, -2008(%rbp)
+    leaq    .Lxly_ir0_k805(%rip), %rax
+    movq    %rax, -2016(%rbp)
+    movq    -2008(%rbp), %rdi
+    movq    -2016(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    -2024(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
     call    .Lxly_fn_xuiFgBrightWhite
-    subq    $16, %rsp
-    leaq    .Lxly_str_33(%rip), %rdi
-    call    xly_str
-    movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
-    addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4626041242239631360, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4622945017495814144, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -176(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4616189618054758400, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_48
-    cmpl    $0, (%rsi)
-    jne     .Lxly_48
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_49
-.Lxly_48:
-    call    xly_eq
-.Lxly_49:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_46
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -176(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_52
-    cmpl    $1, (%rsi)
-    je      .Lxly_52
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_53
-.Lxly_52:
-    call    xly_add
-.Lxly_53:
-    pushq   %rax
-    leaq    .Lxly_str_34(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_50
-    cmpl    $1, (%rsi)
-    je      .Lxly_50
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_51
-.Lxly_50:
-    call    xly_add
-.Lxly_51:
-    pushq   %rax
-    leaq    .Lxly_str_35(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawBadge
-    jmp     .Lxly_47
-.Lxly_46:
-.Lxly_47:
-    movq    -176(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_56
-    cmpl    $0, (%rsi)
-    jne     .Lxly_56
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_57
-.Lxly_56:
-    call    xly_eq
-.Lxly_57:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_54
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -176(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_60
-    cmpl    $1, (%rsi)
-    je      .Lxly_60
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_61
-.Lxly_60:
-    call    xly_add
-.Lxly_61:
-    pushq   %rax
-    leaq    .Lxly_str_34(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_58
-    cmpl    $1, (%rsi)
-    je      .Lxly_58
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_59
-.Lxly_58:
-    call    xly_add
-.Lxly_59:
-    pushq   %rax
-    leaq    .Lxly_str_36(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_drawBadge
-    jmp     .Lxly_55
-.Lxly_54:
-.Lxly_55:
-    movq    -176(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_64
-    cmpl    $0, (%rsi)
-    jne     .Lxly_64
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_65
-.Lxly_64:
-    call    xly_lt
-.Lxly_65:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_62
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rax, -2032(%rbp)
+    leaq    .Lxly_str_e958b07ca99e9f66(%rip), %rdi
     call    xly_str
-    pushq   %rax
-    movq    -176(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_68
-    cmpl    $1, (%rsi)
-    je      .Lxly_68
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_69
-.Lxly_68:
-    call    xly_add
-.Lxly_69:
-    pushq   %rax
-    leaq    .Lxly_str_34(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_66
-    cmpl    $1, (%rsi)
-    je      .Lxly_66
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_67
-.Lxly_66:
-    call    xly_add
-.Lxly_67:
-    pushq   %rax
-    leaq    .Lxly_str_37(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2040(%rbp)
+    subq    $16, %rsp
+    movq    -2040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2048(%rbp)
+    call    .Lxly_fn_xuiReset
+    movq    %rax, -2056(%rbp)
+    leaq    .Lxly_ir0_k806(%rip), %rax
+    movq    %rax, -2064(%rbp)
+    leaq    .Lxly_ir0_k807(%rip), %rax
+    movq    %rax, -2072(%rbp)
+    movq    -2064(%rbp), %rdi
+    movq    -2072(%rbp), %rsi
+    call    .Lxly_fn_xuiPos
+    movq    %rax, -2080(%rbp)
+    movq    -2080(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+.Lxly_ir0_b2:
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_57178b18223ab5b9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2088(%rbp)
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2096(%rbp)
+    movq    -2080(%rbp), %rdi
+    movq    -2088(%rbp), %rsi
+    movq    -2096(%rbp), %rdx
     call    .Lxly_fn_drawBadge
-    jmp     .Lxly_63
-.Lxly_62:
-.Lxly_63:
-    subq    $8, %rsp
-    movabsq $4624070917402656768, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631107791820423168, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4619567317775286272, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4630544841867001856, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    leaq    .Lxly_str_38(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2104(%rbp)
+.Lxly_ir0_b4:
+.Lxly_ir0_b6:
+    leaq    .Lxly_str_debbbd8ee3aa67d2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2112(%rbp)
+    leaq    .Lxly_ir0_k808(%rip), %rax
+    movq    %rax, -2120(%rbp)
+    leaq    .Lxly_ir0_k809(%rip), %rax
+    movq    %rax, -2128(%rbp)
+    leaq    .Lxly_ir0_k810(%rip), %rax
+    movq    %rax, -2136(%rbp)
+    leaq    .Lxly_ir0_k811(%rip), %rax
+    movq    %rax, -2144(%rbp)
+    movq    -2120(%rbp), %rdi
+    movq    -2128(%rbp), %rsi
+    movq    -2136(%rbp), %rdx
+    movq    -2144(%rbp), %rcx
+    movq    -2112(%rbp), %r8
     call    .Lxly_fn_drawPanel
-    subq    $8, %rsp
-    movabsq $4624633867356078080, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2152(%rbp)
+    leaq    .Lxly_ir0_k812(%rip), %rax
+    movq    %rax, -2160(%rbp)
+    leaq    .Lxly_ir0_k813(%rip), %rax
+    movq    %rax, -2168(%rbp)
+    movq    -2160(%rbp), %rdi
+    movq    -2168(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_39(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -120(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2176(%rbp)
+    movq    -2176(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_2d604c0203cd8238(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2184(%rbp)
+    leaq    .Lxly_ir0_k814(%rip), %rax
+    movq    %rax, -2192(%rbp)
+    movq    -2176(%rbp), %rdi
+    movq    -2184(%rbp), %rsi
+    movq    -2192(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    subq    $8, %rsp
-    movabsq $4625196817309499392, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2200(%rbp)
+    leaq    .Lxly_ir0_k815(%rip), %rax
+    movq    %rax, -2208(%rbp)
+    leaq    .Lxly_ir0_k816(%rip), %rax
+    movq    %rax, -2216(%rbp)
+    movq    -2208(%rbp), %rdi
+    movq    -2216(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_40(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -128(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2224(%rbp)
+    movq    -2224(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_5be3c6d61cd9182f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2232(%rbp)
+    leaq    .Lxly_ir0_k817(%rip), %rax
+    movq    %rax, -2240(%rbp)
+    movq    -2224(%rbp), %rdi
+    movq    -2232(%rbp), %rsi
+    movq    -2240(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    subq    $8, %rsp
-    movabsq $4625478292286210048, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2248(%rbp)
+    leaq    .Lxly_ir0_k818(%rip), %rax
+    movq    %rax, -2256(%rbp)
+    leaq    .Lxly_ir0_k819(%rip), %rax
+    movq    %rax, -2264(%rbp)
+    movq    -2256(%rbp), %rdi
+    movq    -2264(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_41(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -136(%rbp), %rax
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2272(%rbp)
+    movq    -2272(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_ee4ce78a904d4dbb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2280(%rbp)
+    leaq    .Lxly_ir0_k820(%rip), %rax
+    movq    %rax, -2288(%rbp)
+    movq    -2272(%rbp), %rdi
+    movq    -2280(%rbp), %rsi
+    movq    -2288(%rbp), %rdx
     call    .Lxly_fn_drawCheckbox
-    subq    $8, %rsp
-    movabsq $4625759767262920704, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4631389266797133824, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2296(%rbp)
+    leaq    .Lxly_ir0_k821(%rip), %rax
+    movq    %rax, -2304(%rbp)
+    leaq    .Lxly_ir0_k822(%rip), %rax
+    movq    %rax, -2312(%rbp)
+    movq    -2304(%rbp), %rdi
+    movq    -2312(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+144(%rip)
     call    .Lxly_fn_xuiFgBrightBlack
-    subq    $16, %rsp
-    leaq    .Lxly_str_42(%rip), %rdi
+    movq    %rax, %r14
+    leaq    .Lxly_str_93473d5e584d9128(%rip), %rdi
     call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -2320(%rbp)
     call    .Lxly_fn_xuiReset
+    movq    %rax, %r14
     call    .Lxly_fn_xuiFgBrightCyan
+    movq    %rax, %r14
     subq    $16, %rsp
-    movq    -24(%rbp), %rax
+    movq    -48(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r14
     call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4626885667169763328, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4635259547726905344, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    leaq    .Lxly_str_43(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movabsq $0x4036000000000000, %rax
+    movq    %rax, -2328(%rbp)
+    movabsq $0x4053c00000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_str_7bec311a384b90d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2336(%rbp)
+    leaq    .Lxly_ir0_k823(%rip), %rax
+    movq    %rax, -2344(%rbp)
+    leaq    .Lxly_ir0_k824(%rip), %rax
+    movq    %rax, -2352(%rbp)
+    leaq    .Lxly_ir0_k825(%rip), %rax
+    movq    %rax, -2360(%rbp)
+    leaq    .Lxly_ir0_k826(%rip), %rax
+    movq    %rax, -2368(%rbp)
+    movq    -2344(%rbp), %rdi
+    movq    -2352(%rbp), %rsi
+    movq    -2360(%rbp), %rdx
+    movq    -2368(%rbp), %rcx
+    movq    -2336(%rbp), %r8
     call    .Lxly_fn_drawPanel
-    subq    $8, %rsp
-    movabsq $4625196817309499392, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -184(%rbp)
-    subq    $8, %rsp
-    movabsq $4627167142146473984, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2376(%rbp)
+    leaq    .Lxly_ir0_k827(%rip), %rax
+    movq    %rax, -2384(%rbp)
+    movq    -2384(%rbp), %rax
+    movq    %rax, __xly_globals+176(%rip)
+    leaq    .Lxly_ir0_k828(%rip), %rax
+    movq    %rax, -2392(%rbp)
+    leaq    .Lxly_ir0_k829(%rip), %rax
+    movq    %rax, -2400(%rbp)
+    movq    -2392(%rbp), %rdi
+    movq    -2400(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_44(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_45(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_46(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_47(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    pushq   %rax
-    popq    %r9
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2408(%rbp)
+    movq    -2408(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_275e8941632a9afa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2416(%rbp)
+    leaq    .Lxly_str_8d4bb019f3bc7202(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2424(%rbp)
+    leaq    .Lxly_str_3627459bf85fece4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2432(%rbp)
+    leaq    .Lxly_str_16e1bead7b9c95ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2440(%rbp)
+    leaq    .Lxly_ir0_k830(%rip), %rax
+    movq    %rax, -2448(%rbp)
+    movq    -2408(%rbp), %rdi
+    movq    -2416(%rbp), %rsi
+    movq    -2424(%rbp), %rdx
+    movq    -2432(%rbp), %rcx
+    movq    -2440(%rbp), %r8
+    movq    -2448(%rbp), %r9
     call    .Lxly_fn_drawTableHeader
-    subq    $8, %rsp
-    movabsq $4627448617123184640, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2456(%rbp)
+    movabsq $0x4038000000000000, %rax
+    movq    %rax, -2464(%rbp)
+    leaq    .Lxly_ir0_k831(%rip), %rax
+    movq    %rax, -2472(%rbp)
+    leaq    .Lxly_ir0_k832(%rip), %rax
+    movq    %rax, -2480(%rbp)
+    movq    -2472(%rbp), %rdi
+    movq    -2480(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    -2488(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
     call    .Lxly_fn_xuiFgBrightBlack
-    subq    $16, %rsp
-    leaq    .Lxly_str_48(%rip), %rdi
+    movq    %rax, -2496(%rbp)
+    leaq    .Lxly_str_375b167f729d00e5(%rip), %rdi
     call    xly_str
+    movq    %rax, -2504(%rbp)
+    subq    $16, %rsp
+    movq    -2504(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, -2512(%rbp)
     call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4627730092099895296, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2520(%rbp)
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, -2528(%rbp)
+    leaq    .Lxly_ir0_k833(%rip), %rax
+    movq    %rax, -2536(%rbp)
+    leaq    .Lxly_ir0_k834(%rip), %rax
+    movq    %rax, -2544(%rbp)
+    movq    -2536(%rbp), %rdi
+    movq    -2544(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_49(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_50(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_51(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_52(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    pushq   %rax
-    popq    %r9
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2552(%rbp)
+    movq    -2552(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_f79a102f6f885c2f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2560(%rbp)
+    leaq    .Lxly_str_0d8959f0f8944da2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2568(%rbp)
+    leaq    .Lxly_str_d7382f0ba1d584cf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2576(%rbp)
+    leaq    .Lxly_str_d57cf542b48e8e6d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2584(%rbp)
+    leaq    .Lxly_ir0_k835(%rip), %rax
+    movq    %rax, -2592(%rbp)
+    leaq    .Lxly_ir0_k836(%rip), %rax
+    movq    %rax, -2600(%rbp)
+    subq    $16, %rsp
+    movq    -2600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2552(%rbp), %rdi
+    movq    -2560(%rbp), %rsi
+    movq    -2568(%rbp), %rdx
+    movq    -2576(%rbp), %rcx
+    movq    -2584(%rbp), %r8
+    movq    -2592(%rbp), %r9
     call    .Lxly_fn_drawTableRow
-    subq    $8, %rsp
-    movabsq $4628011567076605952, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    addq    $16, %rsp
+    movq    %rax, -2608(%rbp)
+    movabsq $0x403a000000000000, %rax
+    movq    %rax, -2616(%rbp)
+    leaq    .Lxly_ir0_k837(%rip), %rax
+    movq    %rax, -2624(%rbp)
+    leaq    .Lxly_ir0_k838(%rip), %rax
+    movq    %rax, -2632(%rbp)
+    movq    -2624(%rbp), %rdi
+    movq    -2632(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_53(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_54(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_55(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_56(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    pushq   %rax
-    popq    %r9
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2640(%rbp)
+    movq    -2640(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_3b155ae7ca54d6ae(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2648(%rbp)
+    leaq    .Lxly_str_1f93b0f102fffa25(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2656(%rbp)
+    leaq    .Lxly_str_cd6f8f3463934b49(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2664(%rbp)
+    leaq    .Lxly_str_1d14bc083067b4d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2672(%rbp)
+    leaq    .Lxly_ir0_k839(%rip), %rax
+    movq    %rax, -2680(%rbp)
+    leaq    .Lxly_ir0_k840(%rip), %rax
+    movq    %rax, -2688(%rbp)
+    subq    $16, %rsp
+    movq    -2688(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2640(%rbp), %rdi
+    movq    -2648(%rbp), %rsi
+    movq    -2656(%rbp), %rdx
+    movq    -2664(%rbp), %rcx
+    movq    -2672(%rbp), %r8
+    movq    -2680(%rbp), %r9
     call    .Lxly_fn_drawTableRow
-    subq    $8, %rsp
-    movabsq $4628293042053316608, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    addq    $16, %rsp
+    movq    %rax, -2696(%rbp)
+    movabsq $0x403b000000000000, %rax
+    movq    %rax, -2704(%rbp)
+    leaq    .Lxly_ir0_k841(%rip), %rax
+    movq    %rax, -2712(%rbp)
+    leaq    .Lxly_ir0_k842(%rip), %rax
+    movq    %rax, -2720(%rbp)
+    movq    -2712(%rbp), %rdi
+    movq    -2720(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_57(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_58(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_59(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_60(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    pushq   %rax
-    popq    %r9
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2728(%rbp)
+    movq    -2728(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_da596f1d14c59bbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2736(%rbp)
+    leaq    .Lxly_str_437cf5d8938c2e92(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2744(%rbp)
+    leaq    .Lxly_str_e7fcaef756e759e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2752(%rbp)
+    leaq    .Lxly_str_16635a5e2eed594a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2760(%rbp)
+    leaq    .Lxly_ir0_k843(%rip), %rax
+    movq    %rax, -2768(%rbp)
+    leaq    .Lxly_ir0_k844(%rip), %rax
+    movq    %rax, -2776(%rbp)
+    subq    $16, %rsp
+    movq    -2776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2728(%rbp), %rdi
+    movq    -2736(%rbp), %rsi
+    movq    -2744(%rbp), %rdx
+    movq    -2752(%rbp), %rcx
+    movq    -2760(%rbp), %r8
+    movq    -2768(%rbp), %r9
     call    .Lxly_fn_drawTableRow
-    subq    $8, %rsp
-    movabsq $4628574517030027264, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    addq    $16, %rsp
+    movq    %rax, -2784(%rbp)
+    leaq    .Lxly_ir0_k845(%rip), %rax
+    movq    %rax, -2792(%rbp)
+    leaq    .Lxly_ir0_k846(%rip), %rax
+    movq    %rax, -2800(%rbp)
+    movq    -2792(%rbp), %rdi
+    movq    -2800(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_61(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_62(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_63(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_64(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    pushq   %rax
-    popq    %r9
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2808(%rbp)
+    movq    -2808(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_a30c3ff3148ac374(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2816(%rbp)
+    leaq    .Lxly_str_c8f8a7f0d1f38c0d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2824(%rbp)
+    leaq    .Lxly_str_be7e8ef9584ed87c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2832(%rbp)
+    leaq    .Lxly_str_fd6cecb08d0b0f09(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2840(%rbp)
+    leaq    .Lxly_ir0_k847(%rip), %rax
+    movq    %rax, -2848(%rbp)
+    leaq    .Lxly_ir0_k848(%rip), %rax
+    movq    %rax, -2856(%rbp)
+    subq    $16, %rsp
+    movq    -2856(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2808(%rbp), %rdi
+    movq    -2816(%rbp), %rsi
+    movq    -2824(%rbp), %rdx
+    movq    -2832(%rbp), %rcx
+    movq    -2840(%rbp), %r8
+    movq    -2848(%rbp), %r9
     call    .Lxly_fn_drawTableRow
-    subq    $8, %rsp
-    movabsq $4628855992006737920, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    addq    $16, %rsp
+    movq    %rax, -2864(%rbp)
+    movabsq $0x403d000000000000, %rax
+    movq    %rax, -2872(%rbp)
+    leaq    .Lxly_ir0_k849(%rip), %rax
+    movq    %rax, -2880(%rbp)
+    leaq    .Lxly_ir0_k850(%rip), %rax
+    movq    %rax, -2888(%rbp)
+    movq    -2880(%rbp), %rdi
+    movq    -2888(%rbp), %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_65(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_66(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_67(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_68(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    pushq   %rax
-    popq    %r9
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2896(%rbp)
+    movq    -2896(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_de15d40af1bbd619(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2904(%rbp)
+    leaq    .Lxly_str_183e2d0b358bfac4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2912(%rbp)
+    leaq    .Lxly_str_0f3292d875d70435(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2920(%rbp)
+    leaq    .Lxly_str_562be1dc80dcf873(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2928(%rbp)
+    leaq    .Lxly_ir0_k851(%rip), %rax
+    movq    %rax, -2936(%rbp)
+    leaq    .Lxly_ir0_k852(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -2896(%rbp), %rdi
+    movq    -2904(%rbp), %rsi
+    movq    -2912(%rbp), %rdx
+    movq    -2920(%rbp), %rcx
+    movq    -2928(%rbp), %r8
+    movq    -2936(%rbp), %r9
     call    .Lxly_fn_drawTableRow
-    subq    $8, %rsp
-    movabsq $4629841154425225216, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4618441417868443648, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4635259547726905344, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    leaq    .Lxly_str_40(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %r8
-    popq    %rcx
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movabsq $0x4040800000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k853(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k854(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k855(%rip), %rax
+    movq    %rax, -2944(%rbp)
+    leaq    .Lxly_ir0_k856(%rip), %rax
+    movq    %rax, -2952(%rbp)
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    movq    -2944(%rbp), %rdx
+    movq    -2952(%rbp), %rcx
+    movq    -2232(%rbp), %r8
     call    .Lxly_fn_drawPanel
-    subq    $8, %rsp
-    movabsq $4629981891913580544, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movabsq $0x4041000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k857(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k858(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_69(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_35(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_9fe95e70c71db18d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    movq    %r14, %rdx
     call    .Lxly_fn_drawNotify
-    subq    $8, %rsp
-    movabsq $4630122629401935872, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2960(%rbp)
+    movabsq $0x4041800000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k859(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k860(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_70(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_36(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_c39322bfc14097e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    movq    -2096(%rbp), %rdx
     call    .Lxly_fn_drawNotify
-    subq    $8, %rsp
-    movabsq $4630263366890291200, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movabsq $0x4042000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k861(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k862(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_71(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_72(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_b71a1b47d8a06403(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    movq    %r14, %rdx
     call    .Lxly_fn_drawNotify
-    subq    $8, %rsp
-    movabsq $4630404104378646528, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, -2968(%rbp)
+    movabsq $0x4042800000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k863(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k864(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_73(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    leaq    .Lxly_str_72(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_7ddfa7b48edc0bf8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    movq    %r14, %rdx
     call    .Lxly_fn_drawNotify
-    subq    $8, %rsp
-    movabsq $4630826316843712512, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k865(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k866(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
-    movq    -152(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_74(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_361c709193569756(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
     call    .Lxly_fn_drawStatusBar
-    subq    $8, %rsp
-    movabsq $4631107791820423168, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k867(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k868(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
     call    .Lxly_fn_xuiPos
-    movq    %rax, -152(%rbp)
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+144(%rip)
     subq    $16, %rsp
-    movq    -152(%rbp), %rax
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r15
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
+    movq    -712(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r15
     call    .Lxly_fn_xuiReset
-    subq    $16, %rsp
-    leaq    .Lxly_str_75(%rip), %rdi
+    movq    %rax, %r15
+    leaq    .Lxly_str_af63c74c8601c8dd(%rip), %rdi
     call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r13
     movl    $0, %edi
     call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
+.section .rodata
+.balign 16
+.Lxly_ir0_k714:
+    .quad   0, 0x4050c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k715:
+    .quad   0, 0x40b5180000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k716:
+    .quad   0, 0x40d0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k717:
+    .quad   0, 0x4074000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k718:
+    .quad   0, 0x4080000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k719:
+    .quad   0, 0x405f000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k720:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k721:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k722:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k723:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k724:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k725:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k726:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k727:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k728:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k729:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k730:
+    .quad   0, 0x4037000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k731:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k732:
+    .quad   0, 0x403f000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k733:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k734:
+    .quad   0, 0x4046800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k735:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k736:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k737:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k738:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k739:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k740:
+    .quad   0, 0x404e800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k741:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k742:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k743:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k744:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k745:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k746:
+    .quad   0, 0x4051800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k747:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k748:
+    .quad   0, 0x4054800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k749:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k750:
+    .quad   0, 0x4052c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k751:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k752:
+    .quad   0, 0x4051400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k753:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k754:
+    .quad   0, 0x4052400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k755:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k756:
+    .quad   0, 0x4050c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k757:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k758:
+    .quad   0, 0x4051c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k759:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k760:
+    .quad   0, 0x4050c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k761:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k762:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k763:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k764:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k765:
+    .quad   0, 0x4050c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k766:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k767:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k768:
+    .quad   0, 0x40407ac000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k769:
+    .quad   0, 0x40407ac000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k770:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k771:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k772:
+    .quad   0, 0x404f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k773:
+    .quad   0, 0x404f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k774:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k775:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k776:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k777:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k778:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k779:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k780:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k781:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k782:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k783:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k784:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k785:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k786:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k787:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k788:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k789:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k790:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k791:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k792:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k793:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k794:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k795:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k796:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k797:
+    .quad   0, 0x4031000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k798:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k799:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k800:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k801:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k802:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k803:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k804:
+    .quad   0, 0x4033000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k805:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k806:
+    .quad   0, 0x4033000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k807:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k808:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k809:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k810:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k811:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k812:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k813:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k814:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k815:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k816:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k817:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k818:
+    .quad   0, 0x4031000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k819:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k820:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k821:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k822:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k823:
+    .quad   0, 0x4036000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k824:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k825:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k826:
+    .quad   0, 0x4053c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k827:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k828:
+    .quad   0, 0x4037000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k829:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k830:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k831:
+    .quad   0, 0x4038000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k832:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k833:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k834:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k835:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k836:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k837:
+    .quad   0, 0x403a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k838:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k839:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k840:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k841:
+    .quad   0, 0x403b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k842:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k843:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k844:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k845:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k846:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k847:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k848:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k849:
+    .quad   0, 0x403d000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k850:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k851:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k852:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k853:
+    .quad   0, 0x4040800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k854:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k855:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k856:
+    .quad   0, 0x4053c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k857:
+    .quad   0, 0x4041000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k858:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k859:
+    .quad   0, 0x4041800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k860:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k861:
+    .quad   0, 0x4042000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k862:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k863:
+    .quad   0, 0x4042800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k864:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k865:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k866:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k867:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k868:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
 .Lxly_fn_xuiPos:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -8(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_70
-    cmpl    $1, (%rsi)
-    je      .Lxly_70
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_71
-.Lxly_70:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
     call    xly_add
-.Lxly_71:
-    movq    %rax, -24(%rbp)
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_72
-    cmpl    $1, (%rsi)
-    je      .Lxly_72
+.Lxly_f0_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_73
-.Lxly_72:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
     call    xly_add
-.Lxly_73:
-    movq    %rax, -32(%rbp)
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_80
-    cmpl    $1, (%rsi)
-    je      .Lxly_80
+.Lxly_f0_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_5
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_81
-.Lxly_80:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f0_6
+.Lxly_f0_5:
     call    xly_add
-.Lxly_81:
-    pushq   %rax
-    leaq    .Lxly_str_76(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_78
-    cmpl    $1, (%rsi)
-    je      .Lxly_78
+.Lxly_f0_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_7
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_79
-.Lxly_78:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f0_8
+.Lxly_f0_7:
     call    xly_add
-.Lxly_79:
-    pushq   %rax
-    movq    -32(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_76
-    cmpl    $1, (%rsi)
-    je      .Lxly_76
+.Lxly_f0_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_9
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_77
-.Lxly_76:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f0_10
+.Lxly_f0_9:
     call    xly_add
-.Lxly_77:
-    pushq   %rax
-    leaq    .Lxly_str_77(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_74
-    cmpl    $1, (%rsi)
-    je      .Lxly_74
+.Lxly_f0_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_11
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_75
-.Lxly_74:
+    jmp     .Lxly_f0_12
+.Lxly_f0_11:
     call    xly_add
-.Lxly_75:
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-    call    xly_null
+.Lxly_f0_12:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2744,18 +2471,27 @@ main:
 .Lxly_fn_xuiReset:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2763,18 +2499,27 @@ main:
 .Lxly_fn_xuiBold:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2782,18 +2527,27 @@ main:
 .Lxly_fn_xuiDim:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2801,18 +2555,27 @@ main:
 .Lxly_fn_xuiFgBlack:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2820,18 +2583,27 @@ main:
 .Lxly_fn_xuiFgGreen:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2839,18 +2611,27 @@ main:
 .Lxly_fn_xuiFgYellow:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2858,18 +2639,27 @@ main:
 .Lxly_fn_xuiFgBlue:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2877,18 +2667,27 @@ main:
 .Lxly_fn_xuiFgCyan:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2896,18 +2695,27 @@ main:
 .Lxly_fn_xuiFgWhite:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2915,18 +2723,27 @@ main:
 .Lxly_fn_xuiFgBrightBlack:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2934,18 +2751,27 @@ main:
 .Lxly_fn_xuiFgBrightRed:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2953,18 +2779,27 @@ main:
 .Lxly_fn_xuiFgBrightGreen:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2972,18 +2807,27 @@ main:
 .Lxly_fn_xuiFgBrightYellow:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -2991,18 +2835,27 @@ main:
 .Lxly_fn_xuiFgBrightBlue:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3010,18 +2863,27 @@ main:
 .Lxly_fn_xuiFgBrightCyan:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3029,18 +2891,27 @@ main:
 .Lxly_fn_xuiFgBrightWhite:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3048,18 +2919,27 @@ main:
 .Lxly_fn_xuiBgBlack:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3067,18 +2947,27 @@ main:
 .Lxly_fn_xuiBgRed:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3086,18 +2975,27 @@ main:
 .Lxly_fn_xuiBgGreen:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3105,18 +3003,27 @@ main:
 .Lxly_fn_xuiBgBlue:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3124,18 +3031,27 @@ main:
 .Lxly_fn_xuiBgYellow:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3143,18 +3059,27 @@ main:
 .Lxly_fn_xuiBgCyan:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3162,18 +3087,27 @@ main:
 .Lxly_fn_xuiBgBrightBlack:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3181,18 +3115,27 @@ main:
 .Lxly_fn_xuiBgBrightBlue:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $64, %rsp
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
+    movq    %rax, %r12
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -3200,865 +3143,1445 @@ main:
 .Lxly_fn_drawPanel:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $176, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
-    movq    %rcx, -32(%rbp)
-    movq    %r8, -40(%rbp)
-    movq    -32(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4611686018427387904, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
+    subq    $2560, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, -72(%rbp)
+    movq    %r8, -80(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movl    $-1, -2516(%rbp)
+    movl    $-1, -2388(%rbp)
+    movl    $-1, -2260(%rbp)
+    movl    $-1, -2132(%rbp)
+    movl    $-1, -2004(%rbp)
+    movl    $-1, -1876(%rbp)
+    movl    $-1, -1748(%rbp)
+    movl    $-1, -1620(%rbp)
+    movl    $-1, -1492(%rbp)
+    movl    $-1, -1364(%rbp)
+    movl    $-1, -1236(%rbp)
+    movl    $-1, -1108(%rbp)
+    movl    $-1, -980(%rbp)
+    movl    $-1, -852(%rbp)
+    movl    $-1, -724(%rbp)
+    movl    $-1, -596(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    -96(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_irf25_0_b14:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -624(%rbp)
+    leaq    -632(%rbp), %rax
+    jmp     .Lxly_f25_2
+.Lxly_f25_1:
+    call    xly_add
+.Lxly_f25_2:
+    movq    %rax, -120(%rbp)
+    movq    %r13, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -752(%rbp)
+    leaq    -760(%rbp), %rax
+    jmp     .Lxly_f25_4
+.Lxly_f25_3:
+    call    xly_add
+.Lxly_f25_4:
+    movq    %rax, -128(%rbp)
+    movq    %r13, %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -880(%rbp)
+    leaq    -888(%rbp), %rax
+    jmp     .Lxly_f25_6
+.Lxly_f25_5:
+    call    xly_add
+.Lxly_f25_6:
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movq    -136(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1008(%rbp)
+    leaq    -1016(%rbp), %rax
+    jmp     .Lxly_f25_8
+.Lxly_f25_7:
+    call    xly_add
+.Lxly_f25_8:
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1136(%rbp)
+    leaq    -1144(%rbp), %rax
+    jmp     .Lxly_f25_10
+.Lxly_f25_9:
+    call    xly_add
+.Lxly_f25_10:
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movq    -160(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    jmp     .Lxly_f25_12
+.Lxly_f25_11:
+    call    xly_add
+.Lxly_f25_12:
+    movq    %rax, -176(%rbp)
+.Lxly_irf25_0_b13:
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -184(%rbp)
+.Lxly_irf25_0_b16:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+.Lxly_irf25_0_b15:
+    leaq    .Lxly_str_5665be1b8870744c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -208(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -224(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf25_0_b1:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -232(%rbp)
+    cmpq    $0, -232(%rbp)
+    je      .Lxly_irf25_0_b3
+.Lxly_irf25_0_b2:
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -240(%rbp)
+    movq    %rbx, %xmm0
+    movq    -224(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %rbx
+    jmp     .Lxly_irf25_0_b1
+.Lxly_irf25_0_b3:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+.Lxly_irf25_0_b18:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+.Lxly_irf25_0_b17:
+.Lxly_irf25_0_b20:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+.Lxly_irf25_0_b19:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -280(%rbp)
+.Lxly_irf25_0_b22:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+.Lxly_irf25_0_b21:
+.Lxly_irf25_0_b24:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -296(%rbp)
+.Lxly_irf25_0_b23:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -320(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf25_0_b4:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -328(%rbp)
+    cmpq    $0, -328(%rbp)
+    je      .Lxly_irf25_0_b6
+.Lxly_irf25_0_b5:
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movq    %rbx, %xmm0
+    movq    -320(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -344(%rbp)
+    movq    -344(%rbp), %rbx
+    jmp     .Lxly_irf25_0_b4
+.Lxly_irf25_0_b6:
+    leaq    .Lxly_str_5665c11b88707965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf25_0_b26:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf25_0_b25:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_str_5665bb1b88706f33(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movq    -56(%rbp), %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1264(%rbp)
+    leaq    -1272(%rbp), %rax
+    jmp     .Lxly_f25_14
+.Lxly_f25_13:
+    call    xly_add
+.Lxly_f25_14:
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -376(%rbp)
+    movq    -376(%rbp), %xmm0
+    movsd   %xmm0, -1392(%rbp)
+    leaq    -1400(%rbp), %rax
+    movq    %rax, -384(%rbp)
+    movq    %r13, %rdi
+    movq    -384(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1520(%rbp)
+    leaq    -1528(%rbp), %rax
+    jmp     .Lxly_f25_16
+.Lxly_f25_15:
+    call    xly_add
+.Lxly_f25_16:
+    movq    %rax, -392(%rbp)
+    movq    %r14, %rbx
+.Lxly_irf25_0_b7:
+    movq    %rbx, %xmm0
+    movq    -352(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -400(%rbp)
+    cmpq    $0, -400(%rbp)
+    je      .Lxly_irf25_0_b9
+.Lxly_irf25_0_b8:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -1648(%rbp)
+    leaq    -1656(%rbp), %rax
+    movq    %rax, -408(%rbp)
+    movq    -48(%rbp), %rdi
+    movq    -408(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1776(%rbp)
+    leaq    -1784(%rbp), %rax
+    jmp     .Lxly_f25_18
+.Lxly_f25_17:
+    call    xly_add
+.Lxly_f25_18:
+    movq    %rax, -416(%rbp)
+.Lxly_irf25_0_b28:
+    movq    %r13, %rdi
+    movq    -416(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1904(%rbp)
+    leaq    -1912(%rbp), %rax
+    jmp     .Lxly_f25_20
+.Lxly_f25_19:
+    call    xly_add
+.Lxly_f25_20:
+    movq    %rax, -424(%rbp)
+    movq    %r13, %rdi
+    movq    -424(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2032(%rbp)
+    leaq    -2040(%rbp), %rax
+    jmp     .Lxly_f25_22
+.Lxly_f25_21:
+    call    xly_add
+.Lxly_f25_22:
+    movq    %rax, -432(%rbp)
+    movq    -432(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2160(%rbp)
+    leaq    -2168(%rbp), %rax
+    jmp     .Lxly_f25_24
+.Lxly_f25_23:
+    call    xly_add
+.Lxly_f25_24:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2288(%rbp)
+    leaq    -2296(%rbp), %rax
+    jmp     .Lxly_f25_26
+.Lxly_f25_25:
+    call    xly_add
+.Lxly_f25_26:
+    movq    %rax, -440(%rbp)
+    movq    -440(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_27
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    subsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    movq    %rax, -48(%rbp)
+    jmp     .Lxly_f25_28
+.Lxly_f25_27:
+    call    xly_add
+.Lxly_f25_28:
+    movq    %rax, -448(%rbp)
+.Lxly_irf25_0_b27:
     subq    $16, %rsp
-    movq    -40(%rbp), %rax
+    movq    -448(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -56(%rbp)
-    movq    -48(%rbp), %rax
-    pushq   %rax
-    movq    -56(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    subsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4611686018427387904, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    subsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4611686018427387904, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    divsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -64(%rbp)
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -72(%rbp)
+    movq    %rax, -456(%rbp)
+.Lxly_irf25_0_b30:
     subq    $16, %rsp
-    movq    -72(%rbp), %rax
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgCyan
+    movq    %rax, -464(%rbp)
+.Lxly_irf25_0_b29:
     subq    $16, %rsp
-    leaq    .Lxly_str_80(%rip), %rdi
-    call    xly_str
+    movq    -360(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -80(%rbp)
-.Lxly_82:
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    movq    -64(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_84
-    cmpl    $0, (%rsi)
-    jne     .Lxly_84
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_85
-.Lxly_84:
-    call    xly_lt
-.Lxly_85:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_83
+    movq    %rax, -472(%rbp)
+.Lxly_irf25_0_b32:
     subq    $16, %rsp
-    leaq    .Lxly_str_81(%rip), %rdi
-    call    xly_str
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_86
-    cmpl    $1, (%rsi)
-    je      .Lxly_86
+    movq    %rax, -480(%rbp)
+.Lxly_irf25_0_b31:
+.Lxly_irf25_0_b34:
+    movq    %r15, %rdi
+    movq    -392(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_29
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2416(%rbp)
+    leaq    -2424(%rbp), %rax
+    jmp     .Lxly_f25_30
+.Lxly_f25_29:
+    call    xly_add
+.Lxly_f25_30:
+    movq    %rax, -488(%rbp)
+    movq    -488(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_31
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_87
-.Lxly_86:
+    jmp     .Lxly_f25_32
+.Lxly_f25_31:
     call    xly_add
-.Lxly_87:
-    movq    %rax, -80(%rbp)
-    jmp     .Lxly_82
-.Lxly_83:
+.Lxly_f25_32:
+    movq    %rax, %r15
+.Lxly_irf25_0_b33:
     subq    $16, %rsp
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
+    movq    %r15, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiBold
-    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, -496(%rbp)
+.Lxly_irf25_0_b36:
     subq    $16, %rsp
-    movq    -40(%rbp), %rax
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    call    .Lxly_fn_xuiFgCyan
+    movq    %rax, %r15
+.Lxly_irf25_0_b35:
     subq    $16, %rsp
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
+    movq    -360(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -80(%rbp)
-.Lxly_88:
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    movq    -64(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_90
-    cmpl    $0, (%rsi)
-    jne     .Lxly_90
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_91
-.Lxly_90:
-    call    xly_lt
-.Lxly_91:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_89
+    movq    %rax, %r15
+.Lxly_irf25_0_b38:
     subq    $16, %rsp
-    leaq    .Lxly_str_81(%rip), %rdi
-    call    xly_str
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_92
-    cmpl    $1, (%rsi)
-    je      .Lxly_92
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %rax, %r15
+.Lxly_irf25_0_b37:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
     addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_93
-.Lxly_92:
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %rbx
+    jmp     .Lxly_irf25_0_b7
+.Lxly_irf25_0_b9:
+    movq    -48(%rbp), %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_33
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2544(%rbp)
+    leaq    -2552(%rbp), %rax
+    jmp     .Lxly_f25_34
+.Lxly_f25_33:
     call    xly_add
-.Lxly_93:
-    movq    %rax, -80(%rbp)
-    jmp     .Lxly_88
-.Lxly_89:
-    subq    $16, %rsp
-    leaq    .Lxly_str_83(%rip), %rdi
-    call    xly_str
-    movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
-    addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
+.Lxly_f25_34:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf25_0_b40:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    movq    %rax, -80(%rbp)
-.Lxly_94:
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
+    jmp     .Lxly_f25_36
+.Lxly_f25_35:
+    call    xly_add
+.Lxly_f25_36:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_37
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    jmp     .Lxly_f25_38
+.Lxly_f25_37:
+    call    xly_add
+.Lxly_f25_38:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_39
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    subsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    jmp     .Lxly_f25_40
+.Lxly_f25_39:
+    call    xly_add
+.Lxly_f25_40:
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    -128(%rbp), %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_96
+    jne     .Lxly_f25_41
     cmpl    $0, (%rsi)
-    jne     .Lxly_96
+    jne     .Lxly_f25_41
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_97
-.Lxly_96:
-    call    xly_lt
-.Lxly_97:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_95
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    movq    -80(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_98
-    cmpl    $1, (%rsi)
-    je      .Lxly_98
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_42
+.Lxly_f25_41:
+    call    xly_add
+.Lxly_f25_42:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_43
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_43
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_99
-.Lxly_98:
+    jmp     .Lxly_f25_44
+.Lxly_f25_43:
     call    xly_add
-.Lxly_99:
-    movq    %rax, -88(%rbp)
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -72(%rbp)
+.Lxly_f25_44:
+    movq    %rax, %rbx
+.Lxly_irf25_0_b39:
     subq    $16, %rsp
-    movq    -72(%rbp), %rax
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgCyan
+    movq    %rax, %r15
+.Lxly_irf25_0_b42:
     subq    $16, %rsp
-    leaq    .Lxly_str_84(%rip), %rdi
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf25_0_b41:
+    leaq    .Lxly_str_5665c41b88707e7e(%rip), %rdi
     call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    movq    -32(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_100
-    cmpl    $1, (%rsi)
-    je      .Lxly_100
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %r15
+.Lxly_irf25_0_b10:
+    movq    %r15, %xmm0
+    movq    -88(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf25_0_b12
+.Lxly_irf25_0_b11:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
     addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_101
-.Lxly_100:
-    call    xly_add
-.Lxly_101:
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r15
+    jmp     .Lxly_irf25_0_b10
+.Lxly_irf25_0_b12:
+    leaq    .Lxly_str_5665c71b88708397(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf25_0_b44:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf25_0_b43:
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_drawProgressBar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $384, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    xorl    %eax, %eax
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movl    $-1, -348(%rbp)
+    movl    $-1, -220(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
     subsd   %xmm1, %xmm0
-    call    xly_num
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
     movq    %rax, -96(%rbp)
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    movq    -96(%rbp), %rax
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -72(%rbp)
     subq    $16, %rsp
-    movq    -72(%rbp), %rax
+    movq    -48(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgCyan
+    movq    %rax, %r13
+.Lxly_irf26_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
     subq    $16, %rsp
-    leaq    .Lxly_str_84(%rip), %rdi
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf26_0_b7:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
     call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_102
-    cmpl    $1, (%rsi)
-    je      .Lxly_102
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_103
-.Lxly_102:
-    call    xly_add
-.Lxly_103:
-    movq    %rax, -80(%rbp)
-    jmp     .Lxly_94
-.Lxly_95:
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_104
-    cmpl    $1, (%rsi)
-    je      .Lxly_104
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_105
-.Lxly_104:
-    call    xly_add
-.Lxly_105:
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    subsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -104(%rbp)
+    movq    %rax, -112(%rbp)
+.Lxly_irf26_0_b10:
+    subq    $16, %rsp
     movq    -104(%rbp), %rax
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_xuiPos
-    movq    %rax, -72(%rbp)
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf26_0_b9:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -120(%rbp)
+    movq    %r12, %r13
+.Lxly_irf26_0_b1:
+    movq    %r13, %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf26_0_b3
+.Lxly_irf26_0_b2:
     subq    $16, %rsp
-    movq    -72(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgCyan
+    movq    %rax, %r15
+    movq    %r13, %xmm0
+    movq    -120(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r13
+    jmp     .Lxly_irf26_0_b1
+.Lxly_irf26_0_b3:
+.Lxly_irf26_0_b12:
     subq    $16, %rsp
-    leaq    .Lxly_str_85(%rip), %rdi
-    call    xly_str
+    movq    -104(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -80(%rbp)
-.Lxly_106:
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    movq    -48(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_108
-    cmpl    $0, (%rsi)
-    jne     .Lxly_108
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_109
-.Lxly_108:
-    call    xly_lt
-.Lxly_109:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_107
+    movq    %rax, %r14
+.Lxly_irf26_0_b11:
+    leaq    .Lxly_str_56700b1b88794ba8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %r15
+.Lxly_irf26_0_b4:
+    movq    %r15, %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf26_0_b6
+.Lxly_irf26_0_b5:
     subq    $16, %rsp
-    leaq    .Lxly_str_81(%rip), %rdi
-    call    xly_str
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_110
-    cmpl    $1, (%rsi)
-    je      .Lxly_110
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
     addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_111
-.Lxly_110:
-    call    xly_add
-.Lxly_111:
-    movq    %rax, -80(%rbp)
-    jmp     .Lxly_106
-.Lxly_107:
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r15
+    jmp     .Lxly_irf26_0_b4
+.Lxly_irf26_0_b6:
+.Lxly_irf26_0_b14:
     subq    $16, %rsp
-    leaq    .Lxly_str_86(%rip), %rdi
-    call    xly_str
+    movq    -104(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    call    xly_null
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-
-.Lxly_fn_drawProgressBar:
-    pushq   %rbp
-    movq    %rsp, %rbp
-    subq    $128, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
-    movq    %rcx, -32(%rbp)
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    movq    -32(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    mulsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    divsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -40(%rbp)
-    movq    -32(%rbp), %rax
-    pushq   %rax
-    movq    -40(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    subsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -48(%rbp)
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4636737291354636288, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    mulsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    divsd   %xmm1, %xmm0
-    call    xly_num
-    movq    %rax, -56(%rbp)
+    movq    %rax, %r14
+.Lxly_irf26_0_b13:
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, %r13
+.Lxly_irf26_0_b16:
     subq    $16, %rsp
-    leaq    .Lxly_str_87(%rip), %rdi
-    call    xly_str
+    movq    -104(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgBrightGreen
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -64(%rbp)
-.Lxly_112:
-    movq    -64(%rbp), %rax
-    pushq   %rax
-    movq    -40(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_114
-    cmpl    $0, (%rsi)
-    jne     .Lxly_114
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_115
-.Lxly_114:
-    call    xly_lt
-.Lxly_115:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_113
+    movq    %rax, %r13
+.Lxly_irf26_0_b15:
+.Lxly_irf26_0_b18:
     subq    $16, %rsp
-    leaq    .Lxly_str_88(%rip), %rdi
-    call    xly_str
+    movq    -104(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -64(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_116
-    cmpl    $1, (%rsi)
-    je      .Lxly_116
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_117
-.Lxly_116:
-    call    xly_add
-.Lxly_117:
-    movq    %rax, -64(%rbp)
-    jmp     .Lxly_112
-.Lxly_113:
-    call    .Lxly_fn_xuiFgBrightBlack
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -64(%rbp)
-.Lxly_118:
-    movq    -64(%rbp), %rax
-    pushq   %rax
-    movq    -48(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %r13
+.Lxly_irf26_0_b17:
+    movq    -96(%rbp), %xmm0
+    movsd   %xmm0, -248(%rbp)
+    leaq    -256(%rbp), %rax
+    movq    %rax, %r13
+    movq    -104(%rbp), %rdi
+    movq    %r13, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_120
+    jne     .Lxly_f26_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_120
+    jne     .Lxly_f26_1
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_121
-.Lxly_120:
-    call    xly_lt
-.Lxly_121:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_119
-    subq    $16, %rsp
-    leaq    .Lxly_str_89(%rip), %rdi
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -376(%rbp)
+    leaq    -384(%rbp), %rax
+    jmp     .Lxly_f26_2
+.Lxly_f26_1:
+    call    xly_add
+.Lxly_f26_2:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
     call    xly_str
-    movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
-    addq    $16, %rsp
-    movq    -64(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_122
-    cmpl    $1, (%rsi)
-    je      .Lxly_122
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_3
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_123
-.Lxly_122:
+    jmp     .Lxly_f26_4
+.Lxly_f26_3:
     call    xly_add
-.Lxly_123:
-    movq    %rax, -64(%rbp)
-    jmp     .Lxly_118
-.Lxly_119:
-    call    .Lxly_fn_xuiFgBrightWhite
+.Lxly_f26_4:
+    movq    %rax, %r12
     subq    $16, %rsp
-    leaq    .Lxly_str_90(%rip), %rdi
-    call    xly_str
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgBrightYellow
-    call    .Lxly_fn_xuiBold
+    movq    %rax, %r13
+.Lxly_irf26_0_b20:
     subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -56(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_126
-    cmpl    $1, (%rsi)
-    je      .Lxly_126
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_127
-.Lxly_126:
-    call    xly_add
-.Lxly_127:
-    pushq   %rax
-    leaq    .Lxly_str_14(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_124
-    cmpl    $1, (%rsi)
-    je      .Lxly_124
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_125
-.Lxly_124:
-    call    xly_add
-.Lxly_125:
+    movq    -104(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %r13
+.Lxly_irf26_0_b19:
     call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -4066,213 +4589,429 @@ main:
 .Lxly_fn_drawBadge:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -148(%rbp)
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_35(%rip), %rdi
+    movq    %rax, %r14
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
     call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_130
+    jne     .Lxly_f27_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_130
+    jne     .Lxly_f27_1
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_131
-.Lxly_130:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_2
+.Lxly_f27_1:
     call    xly_eq
-.Lxly_131:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_128
-    call    .Lxly_fn_xuiBgGreen
-    call    .Lxly_fn_xuiFgBlack
-    call    .Lxly_fn_xuiBold
-    jmp     .Lxly_129
-.Lxly_128:
-.Lxly_129:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_37(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movl    %eax, %eax
+.Lxly_f27_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b2
+.Lxly_irf27_0_b1:
+.Lxly_irf27_0_b12:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b11:
+.Lxly_irf27_0_b14:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b13:
+.Lxly_irf27_0_b16:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b15:
+.Lxly_irf27_0_b2:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_134
+    jne     .Lxly_f27_3
     cmpl    $0, (%rsi)
-    jne     .Lxly_134
+    jne     .Lxly_f27_3
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_135
-.Lxly_134:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_4
+.Lxly_f27_3:
     call    xly_eq
-.Lxly_135:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_132
-    call    .Lxly_fn_xuiBgRed
-    call    .Lxly_fn_xuiFgBrightWhite
-    call    .Lxly_fn_xuiBold
-    jmp     .Lxly_133
-.Lxly_132:
-.Lxly_133:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_36(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movl    %eax, %eax
+.Lxly_f27_4:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b4
+.Lxly_irf27_0_b3:
+.Lxly_irf27_0_b18:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b17:
+.Lxly_irf27_0_b20:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b19:
+.Lxly_irf27_0_b22:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b21:
+.Lxly_irf27_0_b4:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_138
+    jne     .Lxly_f27_5
     cmpl    $0, (%rsi)
-    jne     .Lxly_138
+    jne     .Lxly_f27_5
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_139
-.Lxly_138:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_6
+.Lxly_f27_5:
     call    xly_eq
-.Lxly_139:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_136
-    call    .Lxly_fn_xuiBgYellow
-    call    .Lxly_fn_xuiFgBlack
-    call    .Lxly_fn_xuiBold
-    jmp     .Lxly_137
-.Lxly_136:
-.Lxly_137:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_72(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movl    %eax, %eax
+.Lxly_f27_6:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b6
+.Lxly_irf27_0_b5:
+.Lxly_irf27_0_b24:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b23:
+.Lxly_irf27_0_b26:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b25:
+.Lxly_irf27_0_b28:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b27:
+.Lxly_irf27_0_b6:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_142
+    jne     .Lxly_f27_7
     cmpl    $0, (%rsi)
-    jne     .Lxly_142
+    jne     .Lxly_f27_7
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_143
-.Lxly_142:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_8
+.Lxly_f27_7:
     call    xly_eq
-.Lxly_143:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_140
-    call    .Lxly_fn_xuiBgBlue
-    call    .Lxly_fn_xuiFgBrightWhite
-    call    .Lxly_fn_xuiBold
-    jmp     .Lxly_141
-.Lxly_140:
-.Lxly_141:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_91(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movl    %eax, %eax
+.Lxly_f27_8:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b8
+.Lxly_irf27_0_b7:
+.Lxly_irf27_0_b30:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b29:
+.Lxly_irf27_0_b32:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b31:
+.Lxly_irf27_0_b34:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b33:
+.Lxly_irf27_0_b8:
+    leaq    .Lxly_str_47df71a444e20378(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_146
+    jne     .Lxly_f27_9
     cmpl    $0, (%rsi)
-    jne     .Lxly_146
+    jne     .Lxly_f27_9
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_147
-.Lxly_146:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_10
+.Lxly_f27_9:
     call    xly_eq
-.Lxly_147:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_144
-    call    .Lxly_fn_xuiBgBrightBlack
-    call    .Lxly_fn_xuiFgWhite
-    jmp     .Lxly_145
-.Lxly_144:
-.Lxly_145:
-    subq    $16, %rsp
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_150
-    cmpl    $1, (%rsi)
-    je      .Lxly_150
+    movl    %eax, %eax
+.Lxly_f27_10:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b10
+.Lxly_irf27_0_b9:
+.Lxly_irf27_0_b36:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf27_0_b35:
+.Lxly_irf27_0_b38:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf27_0_b37:
+.Lxly_irf27_0_b10:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_11
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_151
-.Lxly_150:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f27_12
+.Lxly_f27_11:
     call    xly_add
-.Lxly_151:
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_148
-    cmpl    $1, (%rsi)
-    je      .Lxly_148
+.Lxly_f27_12:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_13
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_149
-.Lxly_148:
+    jmp     .Lxly_f27_14
+.Lxly_f27_13:
     call    xly_add
-.Lxly_149:
+.Lxly_f27_14:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %rbx
+.Lxly_irf27_0_b40:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf27_0_b39:
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -4280,623 +5019,886 @@ main:
 .Lxly_fn_drawSparkline:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $128, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
+    subq    $352, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    movq    %rdx, -64(%rbp)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf28_0_k63(%rip), %rax
+    movq    %rax, %r15
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4620693217682128896, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    %r15, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_5(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -32(%rbp)
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_566ffb1b88793078(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_irf28_0_k64(%rip), %rax
+    movq    %rax, -80(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
-    movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_92(%rip), %rdi
-    call    xly_str
+    movq    -72(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -88(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_str_566ffe1b88793591(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_irf28_0_k65(%rip), %rax
+    movq    %rax, -112(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -112(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_93(%rip), %rdi
-    call    xly_str
+    movq    -104(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -120(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_str_566ffd1b887933de(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_irf28_0_k66(%rip), %rax
+    movq    %rax, -144(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4611686018427387904, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -144(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_94(%rip), %rdi
-    call    xly_str
+    movq    -136(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -152(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_5670001b887938f7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_irf28_0_k67(%rip), %rax
+    movq    %rax, -176(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4613937818241073152, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -176(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_95(%rip), %rdi
-    call    xly_str
+    movq    -168(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -184(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_str_566fff1b88793744(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_irf28_0_k68(%rip), %rax
+    movq    %rax, -208(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4616189618054758400, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -208(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_96(%rip), %rdi
-    call    xly_str
+    movq    -200(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -216(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_str_5670021b88793c5d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_irf28_0_k69(%rip), %rax
+    movq    %rax, -240(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -240(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_97(%rip), %rdi
-    call    xly_str
+    movq    -232(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -248(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_str_5670011b88793aaa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_irf28_0_k70(%rip), %rax
+    movq    %rax, -272(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4618441417868443648, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -272(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_98(%rip), %rdi
-    call    xly_str
+    movq    -264(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -280(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_irf28_0_k71(%rip), %rax
+    movq    %rax, -304(%rbp)
     subq    $32, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    subq    $8, %rsp
-    movabsq $4619567317775286272, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
+    movq    -304(%rbp), %rax
     movq    %rax, 8(%rsp)
-    leaq    .Lxly_str_88(%rip), %rdi
-    call    xly_str
+    movq    -296(%rbp), %rax
     movq    %rax, 16(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_6(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
     movl    $3, %ecx
     call    xly_call_module
     addq    $32, %rsp
+    movq    %rax, -312(%rbp)
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    -48(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiFgBrightGreen
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, -40(%rbp)
-.Lxly_152:
-    movq    -40(%rbp), %rax
-    pushq   %rax
+    movq    %rax, -320(%rbp)
+.Lxly_irf28_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -328(%rbp)
     subq    $16, %rsp
-    movq    -16(%rbp), %rax
+    movq    -328(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_154
-    cmpl    $0, (%rsi)
-    jne     .Lxly_154
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_155
-.Lxly_154:
-    call    xly_lt
-.Lxly_155:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_153
+    movq    %rax, -336(%rbp)
+.Lxly_irf28_0_b4:
+    movq    %r15, %rbx
+.Lxly_irf28_0_b1:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %rbx, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf28_0_b3
+.Lxly_irf28_0_b2:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
     subq    $16, %rsp
-    movq    -16(%rbp), %rax
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
-    movq    -40(%rbp), %rax
+    movq    %r15, %rax
     movq    %rax, 8(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_99(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
     movl    $2, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -48(%rbp)
-    movq    -48(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4619567317775286272, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %rax, %r13
+    movq    -288(%rbp), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
     mulsd   %xmm1, %xmm0
-    call    xly_num
-    pushq   %rax
-    movq    -24(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm1
     divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
     call    xly_num
-    movq    %rax, -56(%rbp)
+    movq    %rax, %r15
     subq    $16, %rsp
-    movq    -32(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
-    movq    -56(%rbp), %rax
+    movq    %r15, %rax
     movq    %rax, 8(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_4(%rip), %rdi
-    leaq    .Lxly_str_99(%rip), %rsi
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
     movl    $2, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -64(%rbp)
+    movq    %rax, %r13
     subq    $16, %rsp
-    movq    -64(%rbp), %rax
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -40(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_156
-    cmpl    $1, (%rsi)
-    je      .Lxly_156
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    movq    %rax, %r15
+    movq    %rbx, %xmm0
+    movq    -96(%rbp), %xmm1
     addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_157
-.Lxly_156:
-    call    xly_add
-.Lxly_157:
-    movq    %rax, -40(%rbp)
-    jmp     .Lxly_152
-.Lxly_153:
-    call    .Lxly_fn_xuiReset
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %rbx
+    jmp     .Lxly_irf28_0_b1
+.Lxly_irf28_0_b3:
+.Lxly_irf28_0_b7:
+    subq    $16, %rsp
+    movq    -328(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b6:
     call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
+.section .rodata
+.balign 16
+.Lxly_irf28_0_k63:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k64:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k65:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k66:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k67:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k68:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k69:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k70:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k71:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
 .Lxly_fn_drawStatusBar:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
+    subq    $112, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiBgBrightBlue
-    call    .Lxly_fn_xuiFgBrightWhite
-    call    .Lxly_fn_xuiBold
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -16(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_158
-    cmpl    $1, (%rsi)
-    je      .Lxly_158
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_159
-.Lxly_158:
-    call    xly_add
-.Lxly_159:
-    movq    %rax, -24(%rbp)
+    movq    %rax, %r13
+.Lxly_irf29_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
     subq    $16, %rsp
-    movq    -24(%rbp), %rax
+    movq    -64(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -32(%rbp)
-.Lxly_160:
-    movq    -32(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4635329916471083008, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %rbx
+.Lxly_irf29_0_b4:
+.Lxly_irf29_0_b7:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf29_0_b6:
+.Lxly_irf29_0_b9:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf29_0_b8:
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_162
+    jne     .Lxly_f29_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_162
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_163
-.Lxly_162:
-    call    xly_lt
-.Lxly_163:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_161
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_164
-    cmpl    $1, (%rsi)
-    je      .Lxly_164
+    jne     .Lxly_f29_1
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_165
-.Lxly_164:
+    jmp     .Lxly_f29_2
+.Lxly_f29_1:
     call    xly_add
-.Lxly_165:
-    movq    %rax, -24(%rbp)
-    movq    -32(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
+.Lxly_f29_2:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -88(%rbp)
+    movq    %rbx, %r13
+    movq    %r14, %r12
+.Lxly_irf29_0_b1:
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf29_0_b3
+.Lxly_irf29_0_b2:
+    movq    %r12, %rdi
+    movq    -80(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_166
-    cmpl    $1, (%rsi)
-    je      .Lxly_166
+    jmp     .Lxly_f29_4
+.Lxly_f29_3:
+    call    xly_add
+.Lxly_f29_4:
+    movq    %rax, %rbx
+    leaq    .Lxly_irf29_0_k45(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_5
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_167
-.Lxly_166:
+    jmp     .Lxly_f29_6
+.Lxly_f29_5:
     call    xly_add
-.Lxly_167:
-    movq    %rax, -32(%rbp)
-    jmp     .Lxly_160
-.Lxly_161:
+.Lxly_f29_6:
+    movq    %rax, %r15
+    movq    %r15, %r13
+    movq    %rbx, %r12
+    jmp     .Lxly_irf29_0_b1
+.Lxly_irf29_0_b3:
     subq    $16, %rsp
-    movq    -24(%rbp), %rax
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %r13
+.Lxly_irf29_0_b11:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b10:
     call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
+.section .rodata
+.balign 16
+.Lxly_irf29_0_k45:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
 .Lxly_fn_drawCheckbox:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf30_0_k60(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_170
+    jne     .Lxly_f30_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_170
+    jne     .Lxly_f30_1
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_171
-.Lxly_170:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f30_2
+.Lxly_f30_1:
     call    xly_eq
-.Lxly_171:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_168
-    call    .Lxly_fn_xuiFgBrightGreen
-    call    .Lxly_fn_xuiBold
+    movl    %eax, %eax
+.Lxly_f30_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf30_0_b2
+.Lxly_irf30_0_b1:
+.Lxly_irf30_0_b6:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf30_0_b5:
+.Lxly_irf30_0_b8:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf30_0_b7:
+    leaq    .Lxly_str_3e57f913fe18bbc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf30_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf30_0_k61(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f30_4
+.Lxly_f30_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f30_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf30_0_b4
+.Lxly_irf30_0_b3:
+.Lxly_irf30_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf30_0_b9:
+    leaq    .Lxly_str_016543663443e82b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf30_0_b4:
+.Lxly_irf30_0_b12:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf30_0_b11:
+.Lxly_irf30_0_b14:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf30_0_b13:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf30_0_b16:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf30_0_b15:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf30_0_k60:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf30_0_k61:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_drawLabel:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
     subq    $16, %rsp
-    leaq    .Lxly_str_100(%rip), %rdi
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf31_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    jmp     .Lxly_169
-.Lxly_168:
-.Lxly_169:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %rbx
+.Lxly_irf31_0_b1:
+.Lxly_irf31_0_b4:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf31_0_b3:
+    leaq    .Lxly_str_081e0407b4d9e697(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_174
+    jne     .Lxly_f31_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_174
+    jne     .Lxly_f31_1
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_175
-.Lxly_174:
-    call    xly_eq
-.Lxly_175:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_172
-    call    .Lxly_fn_xuiFgBrightBlack
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f31_2
+.Lxly_f31_1:
+    call    xly_add
+.Lxly_f31_2:
+    movq    %rax, %r15
     subq    $16, %rsp
-    leaq    .Lxly_str_101(%rip), %rdi
-    call    xly_str
+    movq    %r15, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    jmp     .Lxly_173
-.Lxly_172:
-.Lxly_173:
-    call    .Lxly_fn_xuiReset
-    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, %rbx
+.Lxly_irf31_0_b6:
     subq    $16, %rsp
-    movq    -16(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    call    xly_null
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-
-.Lxly_fn_drawLabel:
-    pushq   %rbp
-    movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
+    movq    %rax, %rbx
+.Lxly_irf31_0_b5:
+.Lxly_irf31_0_b8:
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiBold
-    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, %rbx
+.Lxly_irf31_0_b7:
     subq    $16, %rsp
-    movq    -16(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_102(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_176
-    cmpl    $1, (%rsi)
-    je      .Lxly_176
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_177
-.Lxly_176:
-    call    xly_add
-.Lxly_177:
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
-    call    .Lxly_fn_xuiFgBrightYellow
+    movq    %rax, %rbx
+.Lxly_irf31_0_b10:
     subq    $16, %rsp
-    movq    -24(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %rbx
+.Lxly_irf31_0_b9:
     call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -4904,188 +5906,352 @@ main:
 .Lxly_fn_drawNotify:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_35(%rip), %rdi
+    movq    %rax, %r14
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
     call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_180
+    jne     .Lxly_f32_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_180
+    jne     .Lxly_f32_1
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_181
-.Lxly_180:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f32_2
+.Lxly_f32_1:
     call    xly_eq
-.Lxly_181:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_178
-    call    .Lxly_fn_xuiFgBrightGreen
-    call    .Lxly_fn_xuiBold
+    movl    %eax, %eax
+.Lxly_f32_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf32_0_b2
+.Lxly_irf32_0_b1:
+.Lxly_irf32_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b9:
+.Lxly_irf32_0_b12:
     subq    $16, %rsp
-    leaq    .Lxly_str_103(%rip), %rdi
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b11:
+    leaq    .Lxly_str_54b2a19081417685(%rip), %rdi
     call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    jmp     .Lxly_179
-.Lxly_178:
-.Lxly_179:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_37(%rip), %rdi
+    movq    %rax, %rbx
+.Lxly_irf32_0_b2:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
     call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_184
+    jne     .Lxly_f32_3
     cmpl    $0, (%rsi)
-    jne     .Lxly_184
+    jne     .Lxly_f32_3
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_185
-.Lxly_184:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f32_4
+.Lxly_f32_3:
     call    xly_eq
-.Lxly_185:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_182
-    call    .Lxly_fn_xuiFgBrightRed
-    call    .Lxly_fn_xuiBold
+    movl    %eax, %eax
+.Lxly_f32_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf32_0_b4
+.Lxly_irf32_0_b3:
+.Lxly_irf32_0_b14:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b13:
+.Lxly_irf32_0_b16:
     subq    $16, %rsp
-    leaq    .Lxly_str_104(%rip), %rdi
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b15:
+    leaq    .Lxly_str_4438eb907829d6af(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    jmp     .Lxly_183
-.Lxly_182:
-.Lxly_183:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_72(%rip), %rdi
+    movq    %rax, %r14
+.Lxly_irf32_0_b4:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
     call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_188
+    jne     .Lxly_f32_5
     cmpl    $0, (%rsi)
-    jne     .Lxly_188
+    jne     .Lxly_f32_5
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_189
-.Lxly_188:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f32_6
+.Lxly_f32_5:
     call    xly_eq
-.Lxly_189:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_186
-    call    .Lxly_fn_xuiFgBrightCyan
-    call    .Lxly_fn_xuiBold
+    movl    %eax, %eax
+.Lxly_f32_6:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf32_0_b6
+.Lxly_irf32_0_b5:
+.Lxly_irf32_0_b18:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b17:
+.Lxly_irf32_0_b20:
     subq    $16, %rsp
-    leaq    .Lxly_str_105(%rip), %rdi
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b19:
+    leaq    .Lxly_str_dbbcd1c430a9b98e(%rip), %rdi
     call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    jmp     .Lxly_187
-.Lxly_186:
-.Lxly_187:
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_36(%rip), %rdi
+    movq    %rax, %rbx
+.Lxly_irf32_0_b6:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
     call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_192
+    jne     .Lxly_f32_7
     cmpl    $0, (%rsi)
-    jne     .Lxly_192
+    jne     .Lxly_f32_7
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_193
-.Lxly_192:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f32_8
+.Lxly_f32_7:
     call    xly_eq
-.Lxly_193:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_190
-    call    .Lxly_fn_xuiFgBrightYellow
-    call    .Lxly_fn_xuiBold
+    movl    %eax, %eax
+.Lxly_f32_8:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf32_0_b8
+.Lxly_irf32_0_b7:
+.Lxly_irf32_0_b22:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b21:
+.Lxly_irf32_0_b24:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b23:
+    leaq    .Lxly_str_e838cdbe7664fc4f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
     subq    $16, %rsp
-    leaq    .Lxly_str_106(%rip), %rdi
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b8:
+.Lxly_irf32_0_b26:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    jmp     .Lxly_191
-.Lxly_190:
-.Lxly_191:
-    call    .Lxly_fn_xuiReset
-    call    .Lxly_fn_xuiFgBrightWhite
+    movq    %rax, %r14
+.Lxly_irf32_0_b25:
+.Lxly_irf32_0_b28:
     subq    $16, %rsp
-    movq    -16(%rbp), %rax
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %r14
+.Lxly_irf32_0_b27:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b30:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b29:
     call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -5093,1226 +6259,1560 @@ main:
 .Lxly_fn_drawTableHeader:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $176, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
-    movq    %rcx, -32(%rbp)
-    movq    %r8, -40(%rbp)
-    movq    %r9, -184(%rbp)
+    subq    $1104, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, -72(%rbp)
+    movq    %r8, -80(%rbp)
+    movq    %r9, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movl    $-1, -1060(%rbp)
+    movl    $-1, -932(%rbp)
+    movl    $-1, -804(%rbp)
+    movl    $-1, -676(%rbp)
+    movl    $-1, -548(%rbp)
+    movl    $-1, -420(%rbp)
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    -48(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiBold
-    call    .Lxly_fn_xuiBgBrightBlack
-    call    .Lxly_fn_xuiFgBrightCyan
-    movq    -16(%rbp), %rax
-    movq    %rax, -48(%rbp)
+    movq    %rax, -96(%rbp)
+.Lxly_irf33_0_b14:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
     subq    $16, %rsp
-    movq    -48(%rbp), %rax
+    movq    -104(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -56(%rbp)
-.Lxly_194:
-    movq    -56(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -112(%rbp)
+.Lxly_irf33_0_b13:
+.Lxly_irf33_0_b16:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+.Lxly_irf33_0_b15:
+.Lxly_irf33_0_b18:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+.Lxly_irf33_0_b17:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -152(%rbp)
+    movq    -136(%rbp), %r15
+    movq    %r12, %r14
+.Lxly_irf33_0_b1:
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_196
+    jne     .Lxly_f33_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_196
+    jne     .Lxly_f33_1
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_197
-.Lxly_196:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f33_2
+.Lxly_f33_1:
     call    xly_lt
-.Lxly_197:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_195
-    movq    -48(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_198
-    cmpl    $1, (%rsi)
-    je      .Lxly_198
+    movl    %eax, %eax
+.Lxly_f33_2:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf33_0_b3
+.Lxly_irf33_0_b2:
+    movq    %r14, %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_3
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_199
-.Lxly_198:
+    jmp     .Lxly_f33_4
+.Lxly_f33_3:
     call    xly_add
-.Lxly_199:
-    movq    %rax, -48(%rbp)
-    movq    -56(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_200
-    cmpl    $1, (%rsi)
-    je      .Lxly_200
+.Lxly_f33_4:
+    movq    %rax, %r12
+    leaq    .Lxly_irf33_0_k109(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_5
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_201
-.Lxly_200:
+    jmp     .Lxly_f33_6
+.Lxly_f33_5:
     call    xly_add
-.Lxly_201:
-    movq    %rax, -56(%rbp)
-    jmp     .Lxly_194
-.Lxly_195:
-    movq    -24(%rbp), %rax
-    movq    %rax, -64(%rbp)
+.Lxly_f33_6:
+    movq    %rax, -160(%rbp)
+    movq    -160(%rbp), %r15
+    movq    %r12, %r14
+    jmp     .Lxly_irf33_0_b1
+.Lxly_irf33_0_b3:
     subq    $16, %rsp
     movq    -64(%rbp), %rax
     movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
     addq    $16, %rsp
-    movq    %rax, -72(%rbp)
-.Lxly_202:
-    movq    -72(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, %r13
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -176(%rbp)
+    movq    %r13, %r12
+    movq    -64(%rbp), %r15
+.Lxly_irf33_0_b4:
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_204
+    jne     .Lxly_f33_7
     cmpl    $0, (%rsi)
-    jne     .Lxly_204
+    jne     .Lxly_f33_7
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_205
-.Lxly_204:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f33_8
+.Lxly_f33_7:
     call    xly_lt
-.Lxly_205:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_203
-    movq    -64(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_206
-    cmpl    $1, (%rsi)
-    je      .Lxly_206
+    movl    %eax, %eax
+.Lxly_f33_8:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf33_0_b6
+.Lxly_irf33_0_b5:
+    movq    %r15, %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_9
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_207
-.Lxly_206:
+    jmp     .Lxly_f33_10
+.Lxly_f33_9:
     call    xly_add
-.Lxly_207:
-    movq    %rax, -64(%rbp)
-    movq    -72(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_208
-    cmpl    $1, (%rsi)
-    je      .Lxly_208
+.Lxly_f33_10:
+    movq    %rax, %r13
+    leaq    .Lxly_irf33_0_k110(%rip), %rax
+    movq    %rax, -184(%rbp)
+    movq    %r12, %rdi
+    movq    -184(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_11
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_209
-.Lxly_208:
+    jmp     .Lxly_f33_12
+.Lxly_f33_11:
     call    xly_add
-.Lxly_209:
-    movq    %rax, -72(%rbp)
-    jmp     .Lxly_202
-.Lxly_203:
-    movq    -32(%rbp), %rax
-    movq    %rax, -80(%rbp)
+.Lxly_f33_12:
+    movq    %rax, -192(%rbp)
+    movq    -192(%rbp), %r12
+    movq    %r13, %r15
+    jmp     .Lxly_irf33_0_b4
+.Lxly_irf33_0_b6:
     subq    $16, %rsp
-    movq    -80(%rbp), %rax
+    movq    -72(%rbp), %rax
     movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
     addq    $16, %rsp
-    movq    %rax, -88(%rbp)
-.Lxly_210:
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -216(%rbp)
+    movq    -200(%rbp), %r12
+    movq    -72(%rbp), %r13
+.Lxly_irf33_0_b7:
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_212
+    jne     .Lxly_f33_13
     cmpl    $0, (%rsi)
-    jne     .Lxly_212
+    jne     .Lxly_f33_13
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_213
-.Lxly_212:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f33_14
+.Lxly_f33_13:
     call    xly_lt
-.Lxly_213:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_211
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_214
-    cmpl    $1, (%rsi)
-    je      .Lxly_214
+    movl    %eax, %eax
+.Lxly_f33_14:
+    movq    %rax, -224(%rbp)
+    cmpq    $0, -224(%rbp)
+    je      .Lxly_irf33_0_b9
+.Lxly_irf33_0_b8:
+    movq    %r13, %rdi
+    movq    -208(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_15
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_215
-.Lxly_214:
+    jmp     .Lxly_f33_16
+.Lxly_f33_15:
     call    xly_add
-.Lxly_215:
-    movq    %rax, -80(%rbp)
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_216
-    cmpl    $1, (%rsi)
-    je      .Lxly_216
+.Lxly_f33_16:
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_irf33_0_k111(%rip), %rax
+    movq    %rax, -240(%rbp)
+    movq    %r12, %rdi
+    movq    -240(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_17
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_217
-.Lxly_216:
+    jmp     .Lxly_f33_18
+.Lxly_f33_17:
     call    xly_add
-.Lxly_217:
-    movq    %rax, -88(%rbp)
-    jmp     .Lxly_210
-.Lxly_211:
-    movq    -40(%rbp), %rax
-    movq    %rax, -96(%rbp)
+.Lxly_f33_18:
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %r12
+    movq    -232(%rbp), %r13
+    jmp     .Lxly_irf33_0_b7
+.Lxly_irf33_0_b9:
     subq    $16, %rsp
-    movq    -96(%rbp), %rax
+    movq    -80(%rbp), %rax
     movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
     addq    $16, %rsp
-    movq    %rax, -104(%rbp)
-.Lxly_218:
-    movq    -104(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -272(%rbp)
+    movq    -256(%rbp), %r12
+    movq    -80(%rbp), %rax
+    movq    %rax, -280(%rbp)
+.Lxly_irf33_0_b10:
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_220
+    jne     .Lxly_f33_19
     cmpl    $0, (%rsi)
-    jne     .Lxly_220
+    jne     .Lxly_f33_19
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_221
-.Lxly_220:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f33_20
+.Lxly_f33_19:
     call    xly_lt
-.Lxly_221:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_219
-    movq    -96(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_222
-    cmpl    $1, (%rsi)
-    je      .Lxly_222
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_223
-.Lxly_222:
-    call    xly_add
-.Lxly_223:
-    movq    %rax, -96(%rbp)
-    movq    -104(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_224
-    cmpl    $1, (%rsi)
-    je      .Lxly_224
+    movl    %eax, %eax
+.Lxly_f33_20:
+    movq    %rax, -288(%rbp)
+    cmpq    $0, -288(%rbp)
+    je      .Lxly_irf33_0_b12
+.Lxly_irf33_0_b11:
+    movq    -280(%rbp), %rdi
+    movq    -264(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_21
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_225
-.Lxly_224:
+    jmp     .Lxly_f33_22
+.Lxly_f33_21:
     call    xly_add
-.Lxly_225:
-    movq    %rax, -104(%rbp)
-    jmp     .Lxly_218
-.Lxly_219:
-    subq    $16, %rsp
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -48(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_238
-    cmpl    $1, (%rsi)
-    je      .Lxly_238
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+.Lxly_f33_22:
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_irf33_0_k112(%rip), %rax
+    movq    %rax, -304(%rbp)
+    movq    %r12, %rdi
+    movq    -304(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_239
-.Lxly_238:
+    jmp     .Lxly_f33_24
+.Lxly_f33_23:
     call    xly_add
-.Lxly_239:
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_236
-    cmpl    $1, (%rsi)
-    je      .Lxly_236
+.Lxly_f33_24:
+    movq    %rax, -312(%rbp)
+    movq    -312(%rbp), %r12
+    movq    -296(%rbp), %rax
+    movq    %rax, -280(%rbp)
+    jmp     .Lxly_irf33_0_b10
+.Lxly_irf33_0_b12:
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_25
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_237
-.Lxly_236:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f33_26
+.Lxly_f33_25:
     call    xly_add
-.Lxly_237:
-    pushq   %rax
-    movq    -64(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_234
-    cmpl    $1, (%rsi)
-    je      .Lxly_234
+.Lxly_f33_26:
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_27
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_235
-.Lxly_234:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -576(%rbp)
+    leaq    -584(%rbp), %rax
+    jmp     .Lxly_f33_28
+.Lxly_f33_27:
     call    xly_add
-.Lxly_235:
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_232
-    cmpl    $1, (%rsi)
-    je      .Lxly_232
+.Lxly_f33_28:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_29
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_233
-.Lxly_232:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -704(%rbp)
+    leaq    -712(%rbp), %rax
+    jmp     .Lxly_f33_30
+.Lxly_f33_29:
     call    xly_add
-.Lxly_233:
-    pushq   %rax
-    movq    -80(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_230
-    cmpl    $1, (%rsi)
-    je      .Lxly_230
+.Lxly_f33_30:
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_31
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_231
-.Lxly_230:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -832(%rbp)
+    leaq    -840(%rbp), %rax
+    jmp     .Lxly_f33_32
+.Lxly_f33_31:
     call    xly_add
-.Lxly_231:
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_228
-    cmpl    $1, (%rsi)
-    je      .Lxly_228
+.Lxly_f33_32:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_33
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_229
-.Lxly_228:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -960(%rbp)
+    leaq    -968(%rbp), %rax
+    jmp     .Lxly_f33_34
+.Lxly_f33_33:
     call    xly_add
-.Lxly_229:
-    pushq   %rax
-    movq    -96(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_226
-    cmpl    $1, (%rsi)
-    je      .Lxly_226
+.Lxly_f33_34:
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_35
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1088(%rbp)
+    leaq    -1096(%rbp), %rax
+    jmp     .Lxly_f33_36
+.Lxly_f33_35:
+    call    xly_add
+.Lxly_f33_36:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -280(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_37
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_227
-.Lxly_226:
+    jmp     .Lxly_f33_38
+.Lxly_f33_37:
     call    xly_add
-.Lxly_227:
+.Lxly_f33_38:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %r15
+.Lxly_irf33_0_b20:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf33_0_b19:
     call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
+.section .rodata
+.balign 16
+.Lxly_irf33_0_k109:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf33_0_k110:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf33_0_k111:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf33_0_k112:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
 .Lxly_fn_drawTableRow:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $192, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
-    movq    %rcx, -32(%rbp)
-    movq    %r8, -40(%rbp)
-    movq    %r9, -184(%rbp)
+    subq    $1168, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, -72(%rbp)
+    movq    %r8, -80(%rbp)
+    movq    %r9, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movl    $-1, -1124(%rbp)
+    movl    $-1, -996(%rbp)
+    movl    $-1, -868(%rbp)
+    movl    $-1, -740(%rbp)
+    movl    $-1, -612(%rbp)
+    movl    $-1, -484(%rbp)
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    -48(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    xly_null
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -96(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf34_0_k137(%rip), %rax
+    movq    %rax, -104(%rbp)
+    movq    16(%rbp), %rdi
+    movq    -104(%rbp), %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_242
+    jne     .Lxly_f34_1
     cmpl    $0, (%rsi)
-    jne     .Lxly_242
+    jne     .Lxly_f34_1
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_243
-.Lxly_242:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f34_2
+.Lxly_f34_1:
     call    xly_eq
-.Lxly_243:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_240
-    call    .Lxly_fn_xuiBgBrightBlue
-    call    .Lxly_fn_xuiFgBrightWhite
-    call    .Lxly_fn_xuiBold
-    jmp     .Lxly_241
-.Lxly_240:
-.Lxly_241:
-    call    xly_null
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
+    movl    %eax, %eax
+.Lxly_f34_2:
+    movq    %rax, -112(%rbp)
+    cmpq    $0, -112(%rbp)
+    je      .Lxly_irf34_0_b2
+.Lxly_irf34_0_b1:
+.Lxly_irf34_0_b18:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+.Lxly_irf34_0_b17:
+.Lxly_irf34_0_b20:
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+.Lxly_irf34_0_b19:
+.Lxly_irf34_0_b22:
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -144(%rbp)
+.Lxly_irf34_0_b21:
+.Lxly_irf34_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_irf34_0_k138(%rip), %rax
+    movq    %rax, -160(%rbp)
+    movq    16(%rbp), %rdi
+    movq    -160(%rbp), %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_246
+    jne     .Lxly_f34_3
     cmpl    $0, (%rsi)
-    jne     .Lxly_246
+    jne     .Lxly_f34_3
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
     ucomisd %xmm1, %xmm0
     sete    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_247
-.Lxly_246:
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f34_4
+.Lxly_f34_3:
     call    xly_eq
-.Lxly_247:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_244
-    call    .Lxly_fn_xuiFgWhite
-    jmp     .Lxly_245
-.Lxly_244:
-.Lxly_245:
-    movq    -16(%rbp), %rax
-    movq    %rax, -48(%rbp)
+    movl    %eax, %eax
+.Lxly_f34_4:
+    movq    %rax, -168(%rbp)
+    cmpq    $0, -168(%rbp)
+    je      .Lxly_irf34_0_b4
+.Lxly_irf34_0_b3:
+.Lxly_irf34_0_b24:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
     subq    $16, %rsp
-    movq    -48(%rbp), %rax
+    movq    -176(%rbp), %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    movq    %rax, -56(%rbp)
-.Lxly_248:
-    movq    -56(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -184(%rbp)
+.Lxly_irf34_0_b23:
+.Lxly_irf34_0_b4:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    movq    -192(%rbp), %r14
+    movq    %r12, %r13
+.Lxly_irf34_0_b5:
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_250
+    jne     .Lxly_f34_5
     cmpl    $0, (%rsi)
-    jne     .Lxly_250
+    jne     .Lxly_f34_5
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_251
-.Lxly_250:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f34_6
+.Lxly_f34_5:
     call    xly_lt
-.Lxly_251:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_249
-    movq    -48(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_252
-    cmpl    $1, (%rsi)
-    je      .Lxly_252
+    movl    %eax, %eax
+.Lxly_f34_6:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf34_0_b7
+.Lxly_irf34_0_b6:
+    movq    %r13, %rdi
+    movq    -200(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_7
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_253
-.Lxly_252:
+    jmp     .Lxly_f34_8
+.Lxly_f34_7:
     call    xly_add
-.Lxly_253:
-    movq    %rax, -48(%rbp)
-    movq    -56(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_254
-    cmpl    $1, (%rsi)
-    je      .Lxly_254
+.Lxly_f34_8:
+    movq    %rax, %r12
+    leaq    .Lxly_irf34_0_k139(%rip), %rax
+    movq    %rax, -208(%rbp)
+    movq    %r14, %rdi
+    movq    -208(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_9
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_255
-.Lxly_254:
+    jmp     .Lxly_f34_10
+.Lxly_f34_9:
     call    xly_add
-.Lxly_255:
-    movq    %rax, -56(%rbp)
-    jmp     .Lxly_248
-.Lxly_249:
-    movq    -24(%rbp), %rax
-    movq    %rax, -64(%rbp)
+.Lxly_f34_10:
+    movq    %rax, -216(%rbp)
+    movq    -216(%rbp), %r14
+    movq    %r12, %r13
+    jmp     .Lxly_irf34_0_b5
+.Lxly_irf34_0_b7:
     subq    $16, %rsp
     movq    -64(%rbp), %rax
     movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
     addq    $16, %rsp
-    movq    %rax, -72(%rbp)
-.Lxly_256:
-    movq    -72(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    movq    -224(%rbp), %r14
+    movq    -64(%rbp), %r12
+.Lxly_irf34_0_b8:
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_258
+    jne     .Lxly_f34_11
     cmpl    $0, (%rsi)
-    jne     .Lxly_258
+    jne     .Lxly_f34_11
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_259
-.Lxly_258:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f34_12
+.Lxly_f34_11:
     call    xly_lt
-.Lxly_259:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_257
-    movq    -64(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_260
-    cmpl    $1, (%rsi)
-    je      .Lxly_260
+    movl    %eax, %eax
+.Lxly_f34_12:
+    movq    %rax, -240(%rbp)
+    cmpq    $0, -240(%rbp)
+    je      .Lxly_irf34_0_b10
+.Lxly_irf34_0_b9:
+    movq    %r12, %rdi
+    movq    -232(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_13
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_261
-.Lxly_260:
+    jmp     .Lxly_f34_14
+.Lxly_f34_13:
     call    xly_add
-.Lxly_261:
-    movq    %rax, -64(%rbp)
-    movq    -72(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_262
-    cmpl    $1, (%rsi)
-    je      .Lxly_262
+.Lxly_f34_14:
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_irf34_0_k140(%rip), %rax
+    movq    %rax, -256(%rbp)
+    movq    %r14, %rdi
+    movq    -256(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_15
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_263
-.Lxly_262:
+    jmp     .Lxly_f34_16
+.Lxly_f34_15:
     call    xly_add
-.Lxly_263:
-    movq    %rax, -72(%rbp)
-    jmp     .Lxly_256
-.Lxly_257:
-    movq    -32(%rbp), %rax
-    movq    %rax, -80(%rbp)
+.Lxly_f34_16:
+    movq    %rax, -264(%rbp)
+    movq    -264(%rbp), %r14
+    movq    -248(%rbp), %r12
+    jmp     .Lxly_irf34_0_b8
+.Lxly_irf34_0_b10:
     subq    $16, %rsp
-    movq    -80(%rbp), %rax
+    movq    -72(%rbp), %rax
     movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
     addq    $16, %rsp
-    movq    %rax, -88(%rbp)
-.Lxly_264:
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    movq    -272(%rbp), %r14
+    movq    -72(%rbp), %rax
+    movq    %rax, -288(%rbp)
+.Lxly_irf34_0_b11:
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_266
+    jne     .Lxly_f34_17
     cmpl    $0, (%rsi)
-    jne     .Lxly_266
+    jne     .Lxly_f34_17
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_267
-.Lxly_266:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f34_18
+.Lxly_f34_17:
     call    xly_lt
-.Lxly_267:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_265
-    movq    -80(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_268
-    cmpl    $1, (%rsi)
-    je      .Lxly_268
+    movl    %eax, %eax
+.Lxly_f34_18:
+    movq    %rax, -296(%rbp)
+    cmpq    $0, -296(%rbp)
+    je      .Lxly_irf34_0_b13
+.Lxly_irf34_0_b12:
+    movq    -288(%rbp), %rdi
+    movq    -280(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_19
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_269
-.Lxly_268:
+    jmp     .Lxly_f34_20
+.Lxly_f34_19:
     call    xly_add
-.Lxly_269:
-    movq    %rax, -80(%rbp)
-    movq    -88(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_270
-    cmpl    $1, (%rsi)
-    je      .Lxly_270
+.Lxly_f34_20:
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_irf34_0_k141(%rip), %rax
+    movq    %rax, -312(%rbp)
+    movq    %r14, %rdi
+    movq    -312(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_21
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_271
-.Lxly_270:
+    jmp     .Lxly_f34_22
+.Lxly_f34_21:
     call    xly_add
-.Lxly_271:
-    movq    %rax, -88(%rbp)
-    jmp     .Lxly_264
-.Lxly_265:
-    movq    -40(%rbp), %rax
-    movq    %rax, -96(%rbp)
+.Lxly_f34_22:
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %r14
+    movq    -304(%rbp), %rax
+    movq    %rax, -288(%rbp)
+    jmp     .Lxly_irf34_0_b11
+.Lxly_irf34_0_b13:
     subq    $16, %rsp
-    movq    -96(%rbp), %rax
+    movq    -80(%rbp), %rax
     movq    %rax, 0(%rsp)
-    movq    %rsp, %rdx
-    leaq    .Lxly_str_78(%rip), %rdi
-    leaq    .Lxly_str_79(%rip), %rsi
-    movl    $1, %ecx
-    call    xly_call_module
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
     addq    $16, %rsp
-    movq    %rax, -104(%rbp)
-.Lxly_272:
-    movq    -104(%rbp), %rax
-    pushq   %rax
-    movq    -184(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -336(%rbp)
+    movq    -328(%rbp), %r14
+    movq    -80(%rbp), %rax
+    movq    %rax, -344(%rbp)
+.Lxly_irf34_0_b14:
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
     cmpl    $0, (%rdi)
-    jne     .Lxly_274
+    jne     .Lxly_f34_23
     cmpl    $0, (%rsi)
-    jne     .Lxly_274
+    jne     .Lxly_f34_23
     movsd   8(%rdi), %xmm0
     movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_275
-.Lxly_274:
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f34_24
+.Lxly_f34_23:
     call    xly_lt
-.Lxly_275:
     movq    %rax, %rdi
     call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_273
-    movq    -96(%rbp), %rax
-    pushq   %rax
-    leaq    .Lxly_str_82(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_276
-    cmpl    $1, (%rsi)
-    je      .Lxly_276
+    movl    %eax, %eax
+.Lxly_f34_24:
+    movq    %rax, -352(%rbp)
+    cmpq    $0, -352(%rbp)
+    je      .Lxly_irf34_0_b16
+.Lxly_irf34_0_b15:
+    movq    -344(%rbp), %rdi
+    movq    -336(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_25
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_277
-.Lxly_276:
+    jmp     .Lxly_f34_26
+.Lxly_f34_25:
     call    xly_add
-.Lxly_277:
-    movq    %rax, -96(%rbp)
-    movq    -104(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_278
-    cmpl    $1, (%rsi)
-    je      .Lxly_278
+.Lxly_f34_26:
+    movq    %rax, -360(%rbp)
+    leaq    .Lxly_irf34_0_k142(%rip), %rax
+    movq    %rax, -368(%rbp)
+    movq    %r14, %rdi
+    movq    -368(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_27
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_279
-.Lxly_278:
+    jmp     .Lxly_f34_28
+.Lxly_f34_27:
     call    xly_add
-.Lxly_279:
-    movq    %rax, -104(%rbp)
-    jmp     .Lxly_272
-.Lxly_273:
-    subq    $16, %rsp
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    pushq   %rax
-    movq    -48(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_292
-    cmpl    $1, (%rsi)
-    je      .Lxly_292
+.Lxly_f34_28:
+    movq    %rax, -376(%rbp)
+    movq    -376(%rbp), %r14
+    movq    -360(%rbp), %rax
+    movq    %rax, -344(%rbp)
+    jmp     .Lxly_irf34_0_b14
+.Lxly_irf34_0_b16:
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_29
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_293
-.Lxly_292:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -512(%rbp)
+    leaq    -520(%rbp), %rax
+    jmp     .Lxly_f34_30
+.Lxly_f34_29:
     call    xly_add
-.Lxly_293:
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_290
-    cmpl    $1, (%rsi)
-    je      .Lxly_290
+.Lxly_f34_30:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_31
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_291
-.Lxly_290:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -640(%rbp)
+    leaq    -648(%rbp), %rax
+    jmp     .Lxly_f34_32
+.Lxly_f34_31:
     call    xly_add
-.Lxly_291:
-    pushq   %rax
-    movq    -64(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_288
-    cmpl    $1, (%rsi)
-    je      .Lxly_288
+.Lxly_f34_32:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_33
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_289
-.Lxly_288:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -768(%rbp)
+    leaq    -776(%rbp), %rax
+    jmp     .Lxly_f34_34
+.Lxly_f34_33:
     call    xly_add
-.Lxly_289:
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_286
-    cmpl    $1, (%rsi)
-    je      .Lxly_286
+.Lxly_f34_34:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_35
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_287
-.Lxly_286:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -896(%rbp)
+    leaq    -904(%rbp), %rax
+    jmp     .Lxly_f34_36
+.Lxly_f34_35:
     call    xly_add
-.Lxly_287:
-    pushq   %rax
-    movq    -80(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_284
-    cmpl    $1, (%rsi)
-    je      .Lxly_284
+.Lxly_f34_36:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -288(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_37
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_285
-.Lxly_284:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1024(%rbp)
+    leaq    -1032(%rbp), %rax
+    jmp     .Lxly_f34_38
+.Lxly_f34_37:
     call    xly_add
-.Lxly_285:
-    pushq   %rax
-    leaq    .Lxly_str_10(%rip), %rdi
-    call    xly_str
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_282
-    cmpl    $1, (%rsi)
-    je      .Lxly_282
+.Lxly_f34_38:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_39
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
-    call    xly_num
-    jmp     .Lxly_283
-.Lxly_282:
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1152(%rbp)
+    leaq    -1160(%rbp), %rax
+    jmp     .Lxly_f34_40
+.Lxly_f34_39:
     call    xly_add
-.Lxly_283:
-    pushq   %rax
-    movq    -96(%rbp), %rax
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_280
-    cmpl    $1, (%rsi)
-    je      .Lxly_280
+.Lxly_f34_40:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -344(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_41
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_41
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_281
-.Lxly_280:
+    jmp     .Lxly_f34_42
+.Lxly_f34_41:
     call    xly_add
-.Lxly_281:
+.Lxly_f34_42:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdx
-    leaq    .Lxly_str_8(%rip), %rdi
-    leaq    .Lxly_str_9(%rip), %rsi
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
     movl    $1, %ecx
     call    xly_call_module
     addq    $16, %rsp
-    call    .Lxly_fn_xuiReset
+    movq    %rax, %r13
+.Lxly_irf34_0_b26:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf34_0_b25:
     call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
 .section .rodata
-.Lxly_str_0:
+.balign 16
+.Lxly_irf34_0_k137:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf34_0_k138:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf34_0_k139:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf34_0_k140:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf34_0_k141:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf34_0_k142:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_a46bf1b25ad211d9:
     .asciz  "Xenly Linux Dashboard"
-.Lxly_str_1:
+.Lxly_str_3e4fd1ed3062b331:
     .asciz  "v2.0.0"
-.Lxly_str_2:
+.Lxly_str_08b05507b5565e57:
     .asciz  "os"
-.Lxly_str_3:
+.Lxly_str_3e4bd4e31c5c3ad2:
     .asciz  "platform"
-.Lxly_str_4:
+.Lxly_str_4f9e14b634c6b026:
     .asciz  "array"
-.Lxly_str_5:
+.Lxly_str_f74e5feadea773fd:
     .asciz  "create"
-.Lxly_str_6:
+.Lxly_str_823b87195ce20e23:
     .asciz  "set"
-.Lxly_str_7:
+.Lxly_str_cbf29ce484222325:
     .asciz  ""
-.Lxly_str_8:
+.Lxly_str_08b73907b55c4d71:
     .asciz  "io"
-.Lxly_str_9:
+.Lxly_str_b93a12b0d06caefc:
     .asciz  "write"
-.Lxly_str_10:
-    .asciz  "  "
-.Lxly_str_11:
-    .asciz  "  \342\224\202  Platform: "
-.Lxly_str_12:
+.Lxly_str_e22f84f0e00344dc:
+    .asciz  "1;1H"
+.Lxly_str_97edf644ac008fe6:
+    .asciz  "Xenly Linux Dashboard  v2.0.0  \342\224\202  Platform: "
+.Lxly_str_2d2550bb73a9c6e1:
     .asciz  "System Resources"
-.Lxly_str_13:
-    .asciz  "CPU Usage  "
-.Lxly_str_14:
-    .asciz  "%"
-.Lxly_str_15:
-    .asciz  "Memory     "
-.Lxly_str_16:
-    .asciz  " / "
-.Lxly_str_17:
-    .asciz  " MB"
-.Lxly_str_18:
-    .asciz  "Disk       "
-.Lxly_str_19:
-    .asciz  " GB"
-.Lxly_str_20:
-    .asciz  "Net Down   "
-.Lxly_str_21:
-    .asciz  " Mbps"
-.Lxly_str_22:
-    .asciz  "Net Up     "
-.Lxly_str_23:
+.Lxly_str_6ef4d6d8ac36494b:
+    .asciz  "4;3H"
+.Lxly_str_3e16af1814588e0d:
+    .asciz  "67%"
+.Lxly_str_56cdae4ab2498970:
+    .asciz  "CPU Usage  : "
+.Lxly_str_ec76a0cfd555b9aa:
+    .asciz  "5;3H"
+.Lxly_str_700342ea56a0a5f5:
+    .asciz  "6;3H"
+.Lxly_str_d43673d59c06f2ac:
+    .asciz  "5400 / 16384 MB"
+.Lxly_str_9ca37ee247abf210:
+    .asciz  "Memory     : "
+.Lxly_str_3417a4e1a816148c:
+    .asciz  "7;3H"
+.Lxly_str_17cd673defa59b77:
+    .asciz  "8;3H"
+.Lxly_str_ad2a787552b7ee2e:
+    .asciz  "320 / 512 GB"
+.Lxly_str_ab2ce80e21d025a6:
+    .asciz  "Disk       : "
+.Lxly_str_976ee1351a92ea46:
+    .asciz  "9;3H"
+.Lxly_str_e29c4f76901eba76:
+    .asciz  "10;3H"
+.Lxly_str_fda509f659855450:
+    .asciz  "124 Mbps"
+.Lxly_str_2c93942fa4bfeb16:
+    .asciz  "Net Down   : "
+.Lxly_str_64add57f66a30027:
+    .asciz  "11;3H"
+.Lxly_str_b306771003ca5d94:
+    .asciz  "38 Mbps"
+.Lxly_str_d7495929b9449bcd:
+    .asciz  "Net Up     : "
+.Lxly_str_6691eea56cb2ad90:
     .asciz  "CPU History (16 samples)"
-.Lxly_str_24:
+.Lxly_str_c909382ca531b698:
+    .asciz  "4;44H"
+.Lxly_str_07fc0307b4bcfe7e:
     .asciz  "0%"
-.Lxly_str_25:
+.Lxly_str_03657576cc0014cf:
+    .asciz  "10;44H"
+.Lxly_str_83c0062739960df2:
     .asciz  "\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200 last 16 ticks \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
-.Lxly_str_26:
+.Lxly_str_bab6d0bb935e4179:
     .asciz  "Peak: 82%"
-.Lxly_str_27:
-    .asciz  "Current: "
-.Lxly_str_28:
+.Lxly_str_9775e3a5f6b554be:
+    .asciz  "Current: 67%"
+.Lxly_str_f55d634dcc743595:
     .asciz  "Services"
-.Lxly_str_29:
+.Lxly_str_075ed2ad640cb267:
     .asciz  "Web Server (nginx)"
-.Lxly_str_30:
+.Lxly_str_0e32f28796cc8aba:
     .asciz  "Database  (postgres)"
-.Lxly_str_31:
+.Lxly_str_724c3df60a5febc7:
     .asciz  "Cache     (redis)"
-.Lxly_str_32:
+.Lxly_str_7e0b034249fdb622:
     .asciz  "Monitoring (prometheus)"
-.Lxly_str_33:
+.Lxly_str_e958b07ca99e9f66:
     .asciz  "Running: "
-.Lxly_str_34:
-    .asciz  "/4"
-.Lxly_str_35:
-    .asciz  "success"
-.Lxly_str_36:
+.Lxly_str_57178b18223ab5b9:
+    .asciz  "3/4"
+.Lxly_str_5e39a0f62bea2e31:
     .asciz  "warn"
-.Lxly_str_37:
-    .asciz  "error"
-.Lxly_str_38:
+.Lxly_str_debbbd8ee3aa67d2:
     .asciz  "Configuration Flags"
-.Lxly_str_39:
+.Lxly_str_2d604c0203cd8238:
     .asciz  "Dark Mode"
-.Lxly_str_40:
+.Lxly_str_5be3c6d61cd9182f:
     .asciz  "Notifications"
-.Lxly_str_41:
+.Lxly_str_ee4ce78a904d4dbb:
     .asciz  "Auto Update"
-.Lxly_str_42:
+.Lxly_str_93473d5e584d9128:
     .asciz  "Platform: "
-.Lxly_str_43:
+.Lxly_str_7bec311a384b90d5:
     .asciz  "Top Processes"
-.Lxly_str_44:
+.Lxly_str_275e8941632a9afa:
     .asciz  "Process"
-.Lxly_str_45:
+.Lxly_str_8d4bb019f3bc7202:
     .asciz  "PID"
-.Lxly_str_46:
+.Lxly_str_3627459bf85fece4:
     .asciz  "CPU%"
-.Lxly_str_47:
+.Lxly_str_16e1bead7b9c95ce:
     .asciz  "Memory"
-.Lxly_str_48:
+.Lxly_str_375b167f729d00e5:
     .asciz  "  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
-.Lxly_str_49:
+.Lxly_str_f79a102f6f885c2f:
     .asciz  "nginx"
-.Lxly_str_50:
+.Lxly_str_0d8959f0f8944da2:
     .asciz  "1024"
-.Lxly_str_51:
+.Lxly_str_d7382f0ba1d584cf:
     .asciz  "2.1%"
-.Lxly_str_52:
+.Lxly_str_d57cf542b48e8e6d:
     .asciz  "128 MB"
-.Lxly_str_53:
+.Lxly_str_3b155ae7ca54d6ae:
     .asciz  "postgres"
-.Lxly_str_54:
+.Lxly_str_1f93b0f102fffa25:
     .asciz  "1281"
-.Lxly_str_55:
+.Lxly_str_cd6f8f3463934b49:
     .asciz  "18.4%"
-.Lxly_str_56:
+.Lxly_str_1d14bc083067b4d5:
     .asciz  "2.1 GB"
-.Lxly_str_57:
+.Lxly_str_da596f1d14c59bbf:
     .asciz  "xenly"
-.Lxly_str_58:
+.Lxly_str_437cf5d8938c2e92:
     .asciz  "4096"
-.Lxly_str_59:
+.Lxly_str_e7fcaef756e759e5:
     .asciz  "34.2%"
-.Lxly_str_60:
+.Lxly_str_16635a5e2eed594a:
     .asciz  "512 MB"
-.Lxly_str_61:
+.Lxly_str_a30c3ff3148ac374:
     .asciz  "redis"
-.Lxly_str_62:
+.Lxly_str_c8f8a7f0d1f38c0d:
     .asciz  "1890"
-.Lxly_str_63:
+.Lxly_str_be7e8ef9584ed87c:
     .asciz  "0.8%"
-.Lxly_str_64:
+.Lxly_str_fd6cecb08d0b0f09:
     .asciz  "256 MB"
-.Lxly_str_65:
+.Lxly_str_de15d40af1bbd619:
     .asciz  "prometheus"
-.Lxly_str_66:
+.Lxly_str_183e2d0b358bfac4:
     .asciz  "2001"
-.Lxly_str_67:
+.Lxly_str_0f3292d875d70435:
     .asciz  "4.1%"
-.Lxly_str_68:
+.Lxly_str_562be1dc80dcf873:
     .asciz  "180 MB"
-.Lxly_str_69:
+.Lxly_str_9fe95e70c71db18d:
     .asciz  "Backup completed successfully \342\200\224 3.2 GB archived"
-.Lxly_str_70:
+.Lxly_str_19fe06e3408e53d0:
+    .asciz  "success"
+.Lxly_str_c39322bfc14097e4:
     .asciz  "Redis cache miss rate above threshold (12.3%)"
-.Lxly_str_71:
+.Lxly_str_b71a1b47d8a06403:
     .asciz  "Xenly 2.0.0 release build finished in 0.3s"
-.Lxly_str_72:
+.Lxly_str_f5d6a8c57ab94f05:
     .asciz  "info"
-.Lxly_str_73:
+.Lxly_str_7ddfa7b48edc0bf8:
     .asciz  "Disk partition /dev/sda1 at 62% capacity"
-.Lxly_str_74:
+.Lxly_str_361c709193569756:
     .asciz  "  q: quit   r: refresh   s: services   h: help   \342\224\202  Declarative Linux UI"
-.Lxly_str_75:
+.Lxly_str_af63c74c8601c8dd:
     .asciz  "\n"
-.Lxly_str_76:
+.Lxly_str_af63b64c8601abfa:
     .asciz  ";"
-.Lxly_str_77:
+.Lxly_str_af64054c86023237:
     .asciz  "H"
-.Lxly_str_78:
-    .asciz  "string"
-.Lxly_str_79:
-    .asciz  "len"
-.Lxly_str_80:
+.Lxly_str_5665be1b8870744c:
     .asciz  "\342\225\224"
-.Lxly_str_81:
+.Lxly_str_5665ba1b88706d80:
     .asciz  "\342\225\220"
-.Lxly_str_82:
+.Lxly_str_af639d4c8601817f:
     .asciz  " "
-.Lxly_str_83:
+.Lxly_str_5665c11b88707965:
     .asciz  "\342\225\227"
-.Lxly_str_84:
+.Lxly_str_5665bb1b88706f33:
     .asciz  "\342\225\221"
-.Lxly_str_85:
+.Lxly_str_5665c41b88707e7e:
     .asciz  "\342\225\232"
-.Lxly_str_86:
+.Lxly_str_5665c71b88708397:
     .asciz  "\342\225\235"
-.Lxly_str_87:
+.Lxly_str_af64164c86024f1a:
     .asciz  "["
-.Lxly_str_88:
+.Lxly_str_566ff41b88792493:
     .asciz  "\342\226\210"
-.Lxly_str_89:
+.Lxly_str_56700b1b88794ba8:
     .asciz  "\342\226\221"
-.Lxly_str_90:
+.Lxly_str_094c7a07b5dadfd8:
     .asciz  "] "
-.Lxly_str_91:
+.Lxly_str_af63984c86017900:
+    .asciz  "%"
+.Lxly_str_9f7452dd75d54d31:
+    .asciz  "error"
+.Lxly_str_47df71a444e20378:
     .asciz  "neutral"
-.Lxly_str_92:
+.Lxly_str_566ffb1b88793078:
     .asciz  "\342\226\201"
-.Lxly_str_93:
+.Lxly_str_566ffe1b88793591:
     .asciz  "\342\226\202"
-.Lxly_str_94:
+.Lxly_str_566ffd1b887933de:
     .asciz  "\342\226\203"
-.Lxly_str_95:
+.Lxly_str_5670001b887938f7:
     .asciz  "\342\226\204"
-.Lxly_str_96:
+.Lxly_str_566fff1b88793744:
     .asciz  "\342\226\205"
-.Lxly_str_97:
+.Lxly_str_5670021b88793c5d:
     .asciz  "\342\226\206"
-.Lxly_str_98:
+.Lxly_str_5670011b88793aaa:
     .asciz  "\342\226\207"
-.Lxly_str_99:
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
     .asciz  "get"
-.Lxly_str_100:
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_3e57f913fe18bbc0:
     .asciz  "[\342\234\223] "
-.Lxly_str_101:
+.Lxly_str_016543663443e82b:
     .asciz  "[ ] "
-.Lxly_str_102:
+.Lxly_str_081e0407b4d9e697:
     .asciz  ": "
-.Lxly_str_103:
+.Lxly_str_54b2a19081417685:
     .asciz  "\342\234\224  "
-.Lxly_str_104:
+.Lxly_str_4438eb907829d6af:
     .asciz  "\342\234\226  "
-.Lxly_str_105:
+.Lxly_str_dbbcd1c430a9b98e:
     .asciz  "\342\204\271  "
-.Lxly_str_106:
+.Lxly_str_e838cdbe7664fc4f:
     .asciz  "\342\232\240  "
 
 .section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   23
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   184
@@ -0,0 +1,1089 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $288, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_e58482519042665a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8baeec3906e96df9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_df45e40486fb0dd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir0_k193(%rip), %rax
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, -112(%rbp)
+    subq    $48, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_ir0_k196(%rip), %rax
+    movq    %rax, -136(%rbp)
+    movq    -136(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, -144(%rbp)
+    movq    %r14, %r12
+    movq    -144(%rbp), %rax
+    movq    %rax, -152(%rbp)
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+    movq    %r12, %xmm0
+    movq    -160(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -168(%rbp)
+    cmpq    $0, -168(%rbp)
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -184(%rbp)
+    movq    -152(%rbp), %rdi
+    movq    -184(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %r15, %r12
+    movq    %r13, -152(%rbp)
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_e1623825233b77f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_45e6f8b16ecd02e0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k201(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k202(%rip), %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k203(%rip), %rax
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k204(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $48, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+.Lxly_ir0_b5:
+    leaq    .Lxly_ir0_k205(%rip), %rax
+    movq    %rax, -232(%rbp)
+    movq    %r14, %r13
+    movq    -232(%rbp), %r15
+.Lxly_ir0_b6:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -240(%rbp)
+    cmpq    $0, -240(%rbp)
+    je      .Lxly_ir0_b8
+.Lxly_ir0_b7:
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -248(%rbp)
+    movq    %r15, %rdi
+    movq    -248(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -256(%rbp)
+    movq    -256(%rbp), %r13
+    movq    %r14, %r15
+    jmp     .Lxly_ir0_b6
+.Lxly_ir0_b8:
+.Lxly_ir0_b4:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_043fed3bd88dd447(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k207(%rip), %rax
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_ir0_k208(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k209(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k211(%rip), %rax
+    movq    %rax, %r15
+    subq    $48, %rsp
+    movq    -264(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 24(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_8c098226fd763fb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e3ce4ad78bb22850(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r12
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_set_atom
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k212(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_e715b4190539215c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_36ace119c2ac7da1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_f9dab5910f08a8a2(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_91b0cc374c4722ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    .Lxly_atom_e715b4190539215c(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2ead09a293eaa4ab(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r15
+    leaq    .Lxly_str_a1cd0541b8ad7226(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_e74fa719056a838c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_59253ca8fd0dc6cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_set_atom
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_70d885806b56289e(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_f7ef268b4d6ebda2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    .Lxly_atom_e74fa719056a838c(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e19df7d58cd5fff7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c1da1a5dcbd5340c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    .Lxly_atom_70d885806b56289e(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_40dd9af7a5c02b75(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cf5129c6809814b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b10:
+.Lxly_ir0_b12:
+.Lxly_ir0_b14:
+.Lxly_ir0_b9:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_784f8dc64f33f9a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b16:
+.Lxly_ir0_b17:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r14
+.Lxly_ir0_b15:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_29e913438f470192(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b22:
+.Lxly_ir0_b24:
+.Lxly_ir0_b25:
+.Lxly_ir0_b21:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6ab35ec58e42130b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cdba7cd71e7d173d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1ab8a87901814d9d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_26c0c04935d2501d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1fdd498c2fe63fa5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_596a2e4241e6bf1f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5ac86a5eff98f31d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_503397b8c17e9419(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k190:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k193:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k196:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k197:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k201:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k202:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k203:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k204:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k205:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k207:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k208:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k209:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k210:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k211:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k212:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sum:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_irf0_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %r15
+    movq    %r14, %r13
+.Lxly_irf0_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b2:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    movq    %r12, %r13
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_double:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_isEven:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_validateAge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf3_0_b2
+.Lxly_irf3_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b2:
+    movabsq $0x4062c00000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b5
+.Lxly_irf3_0_b4:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b5:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   6
+.Lxly_atoms:
+.Lxly_atom_c4bcadba8e631b86:
+    .quad   .Lxly_str_c4bcadba8e631b86
+.Lxly_atom_e715b4190539215c:
+    .quad   .Lxly_str_e715b4190539215c
+.Lxly_atom_f9dab5910f08a8a2:
+    .quad   .Lxly_str_f9dab5910f08a8a2
+.Lxly_atom_e74fa719056a838c:
+    .quad   .Lxly_str_e74fa719056a838c
+.Lxly_atom_bb62c62c9808ea37:
+    .quad   .Lxly_str_bb62c62c9808ea37
+.Lxly_atom_70d885806b56289e:
+    .quad   .Lxly_str_70d885806b56289e
+
+.section .rodata
+.Lxly_str_e58482519042665a:
+    .asciz  "Declarative Programming"
+.Lxly_str_8baeec3906e96df9:
+    .asciz  "1. Declarative vs Imperative"
+.Lxly_str_df45e40486fb0dd8:
+    .asciz  "Imperative style:"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_e1623825233b77f6:
+    .asciz  "Sum:"
+.Lxly_str_45e6f8b16ecd02e0:
+    .asciz  "Declarative style:"
+.Lxly_str_043fed3bd88dd447:
+    .asciz  "2. Declarative Transformations"
+.Lxly_str_8c098226fd763fb8:
+    .asciz  "Original:"
+.Lxly_str_07d38007b49acdd1:
+    .asciz  ", "
+.Lxly_str_41def2de29651139:
+    .asciz  "join"
+.Lxly_str_e3ce4ad78bb22850:
+    .asciz  "3. Declarative Objects"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_36ace119c2ac7da1:
+    .asciz  "NYC"
+.Lxly_str_91b0cc374c4722ce:
+    .asciz  "Person:"
+.Lxly_str_2ead09a293eaa4ab:
+    .asciz  "4. Declarative Config"
+.Lxly_str_a1cd0541b8ad7226:
+    .asciz  "MyApp"
+.Lxly_str_59253ca8fd0dc6cc:
+    .asciz  "1.0.0"
+.Lxly_str_f7ef268b4d6ebda2:
+    .asciz  "App:"
+.Lxly_str_e19df7d58cd5fff7:
+    .asciz  "Version:"
+.Lxly_str_c1da1a5dcbd5340c:
+    .asciz  "Enabled:"
+.Lxly_str_40dd9af7a5c02b75:
+    .asciz  "5. Declarative Rules"
+.Lxly_str_cf5129c6809814b5:
+    .asciz  "Valid age 30:"
+.Lxly_str_784f8dc64f33f9a2:
+    .asciz  "Valid age -5:"
+.Lxly_str_29e913438f470192:
+    .asciz  "Valid age 200:"
+.Lxly_str_6ab35ec58e42130b:
+    .asciz  "Summary:"
+.Lxly_str_cdba7cd71e7d173d:
+    .asciz  "Declarative = What, not How"
+.Lxly_str_1ab8a87901814d9d:
+    .asciz  "Benefits:"
+.Lxly_str_26c0c04935d2501d:
+    .asciz  "  \342\200\242 Clearer intent"
+.Lxly_str_1fdd498c2fe63fa5:
+    .asciz  "  \342\200\242 Less code"
+.Lxly_str_596a2e4241e6bf1f:
+    .asciz  "  \342\200\242 Easier to read"
+.Lxly_str_5ac86a5eff98f31d:
+    .asciz  "  \342\200\242 Fewer bugs"
+.Lxly_str_503397b8c17e9419:
+    .asciz  "Complete!"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_e715b4190539215c:
+    .asciz  "age"
+.Lxly_str_f9dab5910f08a8a2:
+    .asciz  "city"
+.Lxly_str_e74fa719056a838c:
+    .asciz  "app"
+.Lxly_str_bb62c62c9808ea37:
+    .asciz  "version"
+.Lxly_str_70d885806b56289e:
+    .asciz  "enabled"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   8
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   64
@@ -0,0 +1,546 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_e58482519042665a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b9170b2e5eaa475b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k91(%rip), %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k92(%rip), %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k93(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k94(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k95(%rip), %rax
+    movq    %rax, %r14
+    subq    $48, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+.Lxly_ir0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k96(%rip), %rax
+    movq    %rax, -72(%rbp)
+    movq    %r13, %r14
+    movq    -72(%rbp), %r12
+.Lxly_ir0_b3:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b5
+.Lxly_ir0_b4:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    -48(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    movq    %r13, %r12
+    jmp     .Lxly_ir0_b3
+.Lxly_ir0_b5:
+.Lxly_ir0_b1:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_e1623825233b77f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b718ba9d1ecc85c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r14
+    leaq    .Lxly_str_a1cd0541b8ad7226(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_59253ca8fd0dc6cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_set_atom
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_70d885806b56289e(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %r14, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r14, %rdi
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2f90136d6d24ca48(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b7:
+.Lxly_ir0_b9:
+.Lxly_ir0_b11:
+.Lxly_ir0_b6:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b13:
+.Lxly_ir0_b14:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+.Lxly_ir0_b12:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_cdba7cd71e7d173d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_503397b8c17e9419(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k91:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k92:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k93:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k94:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k95:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k96:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sum:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_irf0_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %r15
+    movq    %r14, %r13
+.Lxly_irf0_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b2:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    movq    %r12, %r13
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_isValid:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    movabsq $0x4062c00000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf1_0_b5
+.Lxly_irf1_0_b4:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b5:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   3
+.Lxly_atoms:
+.Lxly_atom_c4bcadba8e631b86:
+    .quad   .Lxly_str_c4bcadba8e631b86
+.Lxly_atom_bb62c62c9808ea37:
+    .quad   .Lxly_str_bb62c62c9808ea37
+.Lxly_atom_70d885806b56289e:
+    .quad   .Lxly_str_70d885806b56289e
+
+.section .rodata
+.Lxly_str_e58482519042665a:
+    .asciz  "Declarative Programming"
+.Lxly_str_b9170b2e5eaa475b:
+    .asciz  "1. Declarative Style"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_e1623825233b77f6:
+    .asciz  "Sum:"
+.Lxly_str_b718ba9d1ecc85c1:
+    .asciz  "2. Declarative Objects"
+.Lxly_str_a1cd0541b8ad7226:
+    .asciz  "MyApp"
+.Lxly_str_59253ca8fd0dc6cc:
+    .asciz  "1.0.0"
+.Lxly_str_2f90136d6d24ca48:
+    .asciz  "3. Validation Rules"
+.Lxly_str_cdba7cd71e7d173d:
+    .asciz  "Declarative = What, not How"
+.Lxly_str_503397b8c17e9419:
+    .asciz  "Complete!"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_bb62c62c9808ea37:
+    .asciz  "version"
+.Lxly_str_70d885806b56289e:
+    .asciz  "enabled"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   3
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   24
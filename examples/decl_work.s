@@ -0,0 +1,537 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_e58482519042665a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_feed12d2c2376c12(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_str_a1cd0541b8ad7226(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_457d3b18182e1cd2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_set_atom
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_70d885806b56289e(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_70d885806b56289e(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9684a31121616f43(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b2:
+.Lxly_ir0_b4:
+.Lxly_ir0_b6:
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b8:
+.Lxly_ir0_b9:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+.Lxly_ir0_b7:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b14:
+.Lxly_ir0_b16:
+.Lxly_ir0_b17:
+.Lxly_ir0_b13:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e8c0ecfd0b1258d8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k119(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_70d885806b56289e(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %r13, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b20:
+    movq    %r13, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k120(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_ir0_b19:
+    movq    %r13, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b22:
+    movq    %r13, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k121(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_ir0_b21:
+    movq    %r13, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_816e4bc05e25bb40(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_39bef0f6c617b8e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ecdf5111edba3298(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ac572bf82ea47add(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_951b218c639b0ddd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_503397b8c17e9419(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k119:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k120:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k121:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_validateAge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movabsq $0x4062c00000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf0_0_b5
+.Lxly_irf0_0_b4:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b5:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_increment:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf1_0_k8(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k8:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   4
+.Lxly_atoms:
+.Lxly_atom_c4bcadba8e631b86:
+    .quad   .Lxly_str_c4bcadba8e631b86
+.Lxly_atom_bb62c62c9808ea37:
+    .quad   .Lxly_str_bb62c62c9808ea37
+.Lxly_atom_70d885806b56289e:
+    .quad   .Lxly_str_70d885806b56289e
+.Lxly_atom_b1e5e28e4479a274:
+    .quad   .Lxly_str_b1e5e28e4479a274
+
+.section .rodata
+.Lxly_str_e58482519042665a:
+    .asciz  "Declarative Programming"
+.Lxly_str_feed12d2c2376c12:
+    .asciz  "1. Declarative Objects"
+.Lxly_str_a1cd0541b8ad7226:
+    .asciz  "MyApp"
+.Lxly_str_457d3b18182e1cd2:
+    .asciz  "1.0"
+.Lxly_str_9684a31121616f43:
+    .asciz  "2. Validation Rules"
+.Lxly_str_e8c0ecfd0b1258d8:
+    .asciz  "3. State Management"
+.Lxly_str_816e4bc05e25bb40:
+    .asciz  "Declarative Style:"
+.Lxly_str_39bef0f6c617b8e6:
+    .asciz  "  Focus on WHAT"
+.Lxly_str_ecdf5111edba3298:
+    .asciz  "  Not HOW"
+.Lxly_str_ac572bf82ea47add:
+    .asciz  "  Clearer intent"
+.Lxly_str_951b218c639b0ddd:
+    .asciz  "  Fewer bugs"
+.Lxly_str_503397b8c17e9419:
+    .asciz  "Complete!"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_bb62c62c9808ea37:
+    .asciz  "version"
+.Lxly_str_70d885806b56289e:
+    .asciz  "enabled"
+.Lxly_str_b1e5e28e4479a274:
+    .asciz  "count"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   2
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   16
@@ -0,0 +1,2425 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $512, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_dd30b887cae471ae(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6f65cce183c6661c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir6_k317(%rip), %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir6_k318(%rip), %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir6_k319(%rip), %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir6_k320(%rip), %rax
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_ir6_k321(%rip), %rax
+    movq    %rax, -112(%rbp)
+    subq    $48, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movq    $5, %rsi
+    call    xly_array_create
+    addq    $48, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_8c098226fd763fb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -144(%rbp)
+.Lxly_ir6_b2:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -152(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r12
+.Lxly_ir6_b3:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -160(%rbp)
+    cmpq    $0, -160(%rbp)
+    je      .Lxly_ir6_b5
+.Lxly_ir6_b4:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    jmp     .Lxly_ir6_b3
+.Lxly_ir6_b5:
+.Lxly_ir6_b1:
+    movq    -152(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_005ebd6c80af775a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_1(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -184(%rbp)
+.Lxly_ir6_b7:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -192(%rbp)
+    movq    %r13, %r12
+.Lxly_ir6_b8:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -200(%rbp)
+    cmpq    $0, -200(%rbp)
+    je      .Lxly_ir6_b12
+.Lxly_ir6_b9:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -216(%rbp)
+    movq    -216(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -224(%rbp)
+    cmpq    $0, -224(%rbp)
+    je      .Lxly_ir6_b11
+.Lxly_ir6_b10:
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -232(%rbp)
+.Lxly_ir6_b11:
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    jmp     .Lxly_ir6_b8
+.Lxly_ir6_b12:
+.Lxly_ir6_b6:
+    movq    -192(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_c25bdae29e0a0fd4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_2(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -240(%rbp)
+.Lxly_ir6_b14:
+    leaq    .Lxly_ir6_k324(%rip), %rax
+    movq    %rax, -248(%rbp)
+    movq    %r13, %r12
+    movq    -248(%rbp), %r14
+.Lxly_ir6_b15:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+    movq    %r12, %xmm0
+    movq    -256(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -264(%rbp)
+    cmpq    $0, -264(%rbp)
+    je      .Lxly_ir6_b17
+.Lxly_ir6_b16:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -272(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -240(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -296(%rbp)
+    movq    -296(%rbp), %r12
+    movq    -288(%rbp), %r14
+    jmp     .Lxly_ir6_b15
+.Lxly_ir6_b17:
+.Lxly_ir6_b13:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_e1623825233b77f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5d8c77cac3a5c080(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir6_k326(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_buildPerson
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_91b0cc374c4722ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    .Lxly_atom_e715b4190539215c(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -304(%rbp)
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d0ebb732792a86c0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r15
+    leaq    .Lxly_ir6_k327(%rip), %rax
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_84bf555f6d72310e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir6_b19:
+    movq    %r15, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    leaq    .Lxly_ir6_k328(%rip), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, -312(%rbp)
+    movq    %r15, %rdi
+    movq    -312(%rbp), %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_ir6_b18:
+.Lxly_ir6_b21:
+    movq    %r15, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    leaq    .Lxly_ir6_k329(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_add
+.Lxly_10:
+    movq    %rax, -320(%rbp)
+    movq    %r15, %rdi
+    movq    -320(%rbp), %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_ir6_b20:
+    leaq    .Lxly_str_7ca72b50caca70a1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3e7846bf4f40c315(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir6_b23:
+    movq    %r15, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -328(%rbp)
+    movq    %r15, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_ir6_b22:
+    leaq    .Lxly_str_3e7843bf4f40bdfc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir6_b25:
+    movq    %r15, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movq    %r15, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_ir6_b24:
+    leaq    .Lxly_str_505eb92785f9ba4f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7dbbb7053cc21dcc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir6_b27:
+.Lxly_ir6_b29:
+.Lxly_ir6_b31:
+    leaq    .Lxly_str_7d0cfe94310960b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir6_b26:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir6_b33:
+.Lxly_ir6_b34:
+    leaq    .Lxly_str_6068e60356f204a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir6_b32:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_508b2abb65a03907(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir6_b39:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -344(%rbp)
+    cmpq    $0, -344(%rbp)
+    je      .Lxly_ir6_b41
+.Lxly_ir6_b40:
+    leaq    .Lxly_str_2fb87d352b440c89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %r15
+    jmp     .Lxly_ir6_b38
+.Lxly_ir6_b41:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %r15
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -352(%rbp)
+    cmpq    $0, -352(%rbp)
+    je      .Lxly_ir6_b43
+.Lxly_ir6_b42:
+    leaq    .Lxly_str_27767315441dc1ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    jmp     .Lxly_ir6_b38
+.Lxly_ir6_b43:
+    movq    %r12, %r15
+.Lxly_ir6_b38:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_089c4407b545986a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir6_b45:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -360(%rbp)
+    cmpq    $0, -360(%rbp)
+    je      .Lxly_ir6_b47
+.Lxly_ir6_b46:
+    leaq    .Lxly_str_2fb87d352b440c89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %r15
+    jmp     .Lxly_ir6_b44
+.Lxly_ir6_b47:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %r15
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -368(%rbp)
+    cmpq    $0, -368(%rbp)
+    je      .Lxly_ir6_b49
+.Lxly_ir6_b48:
+    leaq    .Lxly_str_27767315441dc1ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    jmp     .Lxly_ir6_b44
+.Lxly_ir6_b49:
+    movq    %r12, %r15
+.Lxly_ir6_b44:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_24f4dea9af2edee0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -376(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir6_k330(%rip), %rax
+    movq    %rax, -392(%rbp)
+    leaq    .Lxly_ir6_k331(%rip), %rax
+    movq    %rax, -400(%rbp)
+    leaq    .Lxly_ir6_k332(%rip), %rax
+    movq    %rax, -408(%rbp)
+    leaq    .Lxly_ir6_k333(%rip), %rax
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_ir6_k334(%rip), %rax
+    movq    %rax, -424(%rbp)
+    leaq    .Lxly_ir6_k335(%rip), %rax
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir6_k336(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir6_k337(%rip), %rax
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_ir6_k338(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir6_k339(%rip), %rax
+    movq    %rax, -448(%rbp)
+    subq    $80, %rsp
+    movq    -392(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -408(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -416(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -424(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -432(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 48(%rsp)
+    movq    -440(%rbp), %rax
+    movq    %rax, 56(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 64(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 72(%rsp)
+    movq    %rsp, %rdi
+    movq    $10, %rsi
+    call    xly_array_create
+    addq    $80, %rsp
+    movq    %rax, -456(%rbp)
+    movq    -456(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_fn___anon_3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -464(%rbp)
+    leaq    .Lxly_fn___anon_4(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r15
+    leaq    .Lxly_fn___anon_5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -472(%rbp)
+    subq    $32, %rsp
+    movq    -464(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    -472(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+56(%rip)
+.Lxly_ir6_b51:
+    movq    %r13, %r15
+    movq    -456(%rbp), %r12
+.Lxly_ir6_b52:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -480(%rbp)
+    cmpq    $0, -480(%rbp)
+    je      .Lxly_ir6_b54
+.Lxly_ir6_b53:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -488(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -488(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -496(%rbp)
+    movq    -496(%rbp), %r15
+    movq    %r13, %r12
+    jmp     .Lxly_ir6_b52
+.Lxly_ir6_b54:
+.Lxly_ir6_b50:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_7943c9666b637666(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    __xly_globals+64(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_542020dd2c02edbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r12
+    call    xly_obj_new
+    movq    %rax, %r15
+    leaq    .Lxly_str_a1cd0541b8ad7226(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_59253ca8fd0dc6cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_e74fa719056a838c(%rip), %rsi
+    call    xly_obj_set_atom
+    call    xly_obj_new
+    movq    %rax, %r14
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_170e478902adba52(%rip), %rsi
+    call    xly_obj_set_atom
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_3862381e95ec3dcf(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_be45a3a6ee3c626a(%rip), %rsi
+    call    xly_obj_set_atom
+    call    xly_obj_new
+    movq    %rax, %r15
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir6_k341(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_64391154b056b36f(%rip), %rsi
+    call    xly_obj_set_atom
+    movabsq $0x407f400000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir6_k342(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_4587f927592235d3(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_7283aeddbebbd745(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_f7ef268b4d6ebda2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    .Lxly_atom_e74fa719056a838c(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    .Lxly_atom_e74fa719056a838c(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    .Lxly_atom_bb62c62c9808ea37(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_a47d10d2e56612c6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    .Lxly_atom_be45a3a6ee3c626a(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    .Lxly_atom_170e478902adba52(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_08e2d962383bd251(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    .Lxly_atom_7283aeddbebbd745(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_64391154b056b36f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e40542df33338a34(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0170e7af114168bb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ac4ce0ec96e665fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fa983d8cd45d6641(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_205af71671efd584(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d77abba25d7a0a46(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4a5b9f876b2cdc31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_503397b8c17e9419(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir6_k317:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k318:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k319:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k320:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k321:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k324:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k326:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k327:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k328:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k329:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k330:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k331:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k332:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k333:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k334:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k335:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k336:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k337:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k338:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k339:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k341:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir6_k342:
+    .quad   0, 0x407f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_map:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r14, %r12
+.Lxly_irf0_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r12
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_filter:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -64(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r14, %r12
+.Lxly_irf1_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf1_0_b3
+.Lxly_irf1_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b5
+.Lxly_irf1_0_b4:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf1_0_b5:
+    movq    %r12, %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b3:
+    movq    -64(%rbp), %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_reduce:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r14, %r12
+    movq    %r13, %r15
+.Lxly_irf2_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b3
+.Lxly_irf2_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    -56(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    movq    %r13, %r15
+    jmp     .Lxly_irf2_0_b1
+.Lxly_irf2_0_b3:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_1:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_buildPerson:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    call    xly_obj_new
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_e715b4190539215c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_f6_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_0f40ea29637fe28a(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_increment:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf7_0_k10(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_2
+.Lxly_f7_1:
+    call    xly_add
+.Lxly_f7_2:
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_b1e5e28e4479a274(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf7_0_k10:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_addItem:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_3e7884bf4f412c6f(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_validateAge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b2
+.Lxly_irf9_0_b1:
+    leaq    .Lxly_str_6068e60356f204a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf9_0_b2:
+    movabsq $0x4062c00000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf9_0_b5
+.Lxly_irf9_0_b4:
+    leaq    .Lxly_str_46fe4d0a73e33dda(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf9_0_b5:
+    leaq    .Lxly_str_7d0cfe94310960b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_validateUsername:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf10_0_b2
+.Lxly_irf10_0_b1:
+    leaq    .Lxly_str_2fb87d352b440c89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b2:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %rbx
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf10_0_b5
+.Lxly_irf10_0_b4:
+    leaq    .Lxly_str_27767315441dc1ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b5:
+    leaq    .Lxly_str_7d0cfe94310960b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_pipeline:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r13, %r15
+    movq    %rbx, %r14
+.Lxly_irf11_0_b1:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf11_0_b3
+.Lxly_irf11_0_b2:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r15, %xmm0
+    movq    -64(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r15
+    movq    %rbx, %r14
+    jmp     .Lxly_irf11_0_b1
+.Lxly_irf11_0_b3:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_fn___anon_f12_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_filter
+
+.Lxly_fn___anon_4:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_fn___anon_f13_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_map
+
+.Lxly_fn___anon_5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_fn___anon_f14_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf14_1_k7(%rip), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    movq    %r14, %rdx
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_reduce
+
+.section .rodata
+.balign 16
+.Lxly_irf14_1_k7:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_f6_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    leaq    .Lxly_str_6669cd6422d28062(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    call    xly_this
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f15_2
+.Lxly_f15_1:
+    call    xly_add
+.Lxly_f15_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f12_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f13_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f14_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f18_2
+.Lxly_f18_1:
+    call    xly_add
+.Lxly_f18_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   13
+.Lxly_atoms:
+.Lxly_atom_c4bcadba8e631b86:
+    .quad   .Lxly_str_c4bcadba8e631b86
+.Lxly_atom_e715b4190539215c:
+    .quad   .Lxly_str_e715b4190539215c
+.Lxly_atom_b1e5e28e4479a274:
+    .quad   .Lxly_str_b1e5e28e4479a274
+.Lxly_atom_3e7884bf4f412c6f:
+    .quad   .Lxly_str_3e7884bf4f412c6f
+.Lxly_atom_bb62c62c9808ea37:
+    .quad   .Lxly_str_bb62c62c9808ea37
+.Lxly_atom_e74fa719056a838c:
+    .quad   .Lxly_str_e74fa719056a838c
+.Lxly_atom_170e478902adba52:
+    .quad   .Lxly_str_170e478902adba52
+.Lxly_atom_3862381e95ec3dcf:
+    .quad   .Lxly_str_3862381e95ec3dcf
+.Lxly_atom_be45a3a6ee3c626a:
+    .quad   .Lxly_str_be45a3a6ee3c626a
+.Lxly_atom_64391154b056b36f:
+    .quad   .Lxly_str_64391154b056b36f
+.Lxly_atom_4587f927592235d3:
+    .quad   .Lxly_str_4587f927592235d3
+.Lxly_atom_7283aeddbebbd745:
+    .quad   .Lxly_str_7283aeddbebbd745
+.Lxly_atom_0f40ea29637fe28a:
+    .quad   .Lxly_str_0f40ea29637fe28a
+
+.section .rodata
+.Lxly_str_dd30b887cae471ae:
+    .asciz  "=== Declarative Programming ==="
+.Lxly_str_6f65cce183c6661c:
+    .asciz  "1. Declarative Data Operations"
+.Lxly_str_8c098226fd763fb8:
+    .asciz  "Original:"
+.Lxly_str_07d38007b49acdd1:
+    .asciz  ", "
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_41def2de29651139:
+    .asciz  "join"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_005ebd6c80af775a:
+    .asciz  "Doubled:"
+.Lxly_str_c25bdae29e0a0fd4:
+    .asciz  "Evens:"
+.Lxly_str_e1623825233b77f6:
+    .asciz  "Sum:"
+.Lxly_str_5d8c77cac3a5c080:
+    .asciz  "2. Declarative Object Building"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_91b0cc374c4722ce:
+    .asciz  "Person:"
+.Lxly_str_d0ebb732792a86c0:
+    .asciz  "3. Declarative State Management"
+.Lxly_str_84bf555f6d72310e:
+    .asciz  "Initial count:"
+.Lxly_str_7ca72b50caca70a1:
+    .asciz  "After increments:"
+.Lxly_str_3e7846bf4f40c315:
+    .asciz  "item1"
+.Lxly_str_3e7843bf4f40bdfc:
+    .asciz  "item2"
+.Lxly_str_505eb92785f9ba4f:
+    .asciz  "Items:"
+.Lxly_str_7dbbb7053cc21dcc:
+    .asciz  "4. Rule-Based Validation"
+.Lxly_str_7d0cfe94310960b1:
+    .asciz  "valid"
+.Lxly_str_6068e60356f204a3:
+    .asciz  "Age cannot be negative"
+.Lxly_str_508b2abb65a03907:
+    .asciz  "alice"
+.Lxly_str_2fb87d352b440c89:
+    .asciz  "Username too short"
+.Lxly_str_27767315441dc1ef:
+    .asciz  "Username too long"
+.Lxly_str_089c4407b545986a:
+    .asciz  "ab"
+.Lxly_str_24f4dea9af2edee0:
+    .asciz  "5. Declarative Data Pipeline"
+.Lxly_str_7943c9666b637666:
+    .asciz  "Pipeline result:"
+.Lxly_str_542020dd2c02edbf:
+    .asciz  "6. Declarative Configuration"
+.Lxly_str_a1cd0541b8ad7226:
+    .asciz  "MyApp"
+.Lxly_str_59253ca8fd0dc6cc:
+    .asciz  "1.0.0"
+.Lxly_str_f7ef268b4d6ebda2:
+    .asciz  "App:"
+.Lxly_str_a47d10d2e56612c6:
+    .asciz  "Dark mode:"
+.Lxly_str_08e2d962383bd251:
+    .asciz  "Max users:"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_e40542df33338a34:
+    .asciz  "Declarative features:"
+.Lxly_str_0170e7af114168bb:
+    .asciz  "  \342\200\242 Map/filter/reduce"
+.Lxly_str_ac4ce0ec96e665fb:
+    .asciz  "  \342\200\242 Object construction"
+.Lxly_str_fa983d8cd45d6641:
+    .asciz  "  \342\200\242 State management"
+.Lxly_str_205af71671efd584:
+    .asciz  "  \342\200\242 Rule-based validation"
+.Lxly_str_d77abba25d7a0a46:
+    .asciz  "  \342\200\242 Data pipelines"
+.Lxly_str_4a5b9f876b2cdc31:
+    .asciz  "  \342\200\242 Configuration objects"
+.Lxly_str_503397b8c17e9419:
+    .asciz  "Complete!"
+.Lxly_str_46fe4d0a73e33dda:
+    .asciz  "Age too high"
+.Lxly_str_6669cd6422d28062:
+    .asciz  "Hello, I'm "
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_e715b4190539215c:
+    .asciz  "age"
+.Lxly_str_b1e5e28e4479a274:
+    .asciz  "count"
+.Lxly_str_3e7884bf4f412c6f:
+    .asciz  "items"
+.Lxly_str_bb62c62c9808ea37:
+    .asciz  "version"
+.Lxly_str_e74fa719056a838c:
+    .asciz  "app"
+.Lxly_str_170e478902adba52:
+    .asciz  "darkMode"
+.Lxly_str_3862381e95ec3dcf:
+    .asciz  "notifications"
+.Lxly_str_be45a3a6ee3c626a:
+    .asciz  "features"
+.Lxly_str_64391154b056b36f:
+    .asciz  "maxUsers"
+.Lxly_str_4587f927592235d3:
+    .asciz  "maxItems"
+.Lxly_str_7283aeddbebbd745:
+    .asciz  "limits"
+.Lxly_str_0f40ea29637fe28a:
+    .asciz  "greet"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   10
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   80
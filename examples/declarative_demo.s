@@ -1,12 +1,31 @@
 .section .text
 .globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
 main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $128, %rsp
-    subq    $16, %rsp
-    leaq    .Lxly_str_0(%rip), %rdi
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    leaq    .Lxly_str_e58482519042665a(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -15,9 +34,11 @@ main:
     movq    %rsp, %rdi
     movl    $0, %esi
     call    xly_print
-    subq    $16, %rsp
-    leaq    .Lxly_str_1(%rip), %rdi
+    leaq    .Lxly_str_bbce3d694d6654b5(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -26,56 +47,49 @@ main:
     movq    %rsp, %rdi
     movl    $0, %esi
     call    xly_print
-    subq    $16, %rsp
-    leaq    .Lxly_str_2(%rip), %rdi
+    leaq    .Lxly_str_29a1d9dd91002fc0(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
+.Lxly_ir0_b2:
+.Lxly_ir0_b4:
+.Lxly_ir0_b6:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+.Lxly_ir0_b1:
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4629137466983448576, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_validateAge
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
+.Lxly_ir0_b8:
+.Lxly_ir0_b9:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+.Lxly_ir0_b7:
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rdi
-    call    xly_neg
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_validateAge
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
+.Lxly_ir0_b14:
+.Lxly_ir0_b16:
+.Lxly_ir0_b17:
+.Lxly_ir0_b13:
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4641240890982006784, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_validateAge
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -84,39 +98,37 @@ main:
     movq    %rsp, %rdi
     movl    $0, %esi
     call    xly_print
-    subq    $16, %rsp
-    leaq    .Lxly_str_3(%rip), %rdi
+    leaq    .Lxly_str_1c23cb542b3de7fe(%rip), %rdi
     call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
+.Lxly_ir0_b20:
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b19:
+    leaq    .Lxly_ir0_k104(%rip), %rax
+    movq    %rax, %r12
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_double
+    movq    %r12, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
+.Lxly_ir0_b22:
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b21:
+    leaq    .Lxly_ir0_k105(%rip), %rax
+    movq    %rax, %rbx
     subq    $16, %rsp
-    subq    $8, %rsp
-    movabsq $4621819117588971520, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_double
+    movq    %rbx, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -125,32 +137,50 @@ main:
     movq    %rsp, %rdi
     movl    $0, %esi
     call    xly_print
-    call    xly_null
-    pushq   %rax
-    call    xly_null
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4617315517961601024, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    pushq   %rax
-    popq    %rdx
-    popq    %rsi
-    popq    %rdi
-    call    .Lxly_fn_compose
-    movq    %rax, -8(%rbp)
+    leaq    .Lxly_fn_double(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_addOne(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b24:
+    leaq    .Lxly_ir0_k106(%rip), %rax
+    movq    %rax, %r14
     subq    $16, %rsp
-    leaq    .Lxly_str_4(%rip), %rdi
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b23:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_52e1e1f54ab4bb3d(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
     subq    $16, %rsp
-    movq    -8(%rbp), %rax
+    movq    %r14, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -159,41 +189,51 @@ main:
     movq    %rsp, %rdi
     movl    $0, %esi
     call    xly_print
-    subq    $16, %rsp
-    leaq    .Lxly_str_5(%rip), %rdi
+    leaq    .Lxly_str_1ab8a87901814d9d(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
-    subq    $16, %rsp
-    leaq    .Lxly_str_6(%rip), %rdi
+    leaq    .Lxly_str_ac572bf82ea47add(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
-    subq    $16, %rsp
-    leaq    .Lxly_str_7(%rip), %rdi
+    leaq    .Lxly_str_bf5c1d25ceb37e65(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
-    subq    $16, %rsp
-    leaq    .Lxly_str_8(%rip), %rdi
+    leaq    .Lxly_str_d95e414d2c10175f(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
     call    xly_print
     addq    $16, %rsp
-    subq    $16, %rsp
-    leaq    .Lxly_str_9(%rip), %rdi
+    leaq    .Lxly_str_d2e7e30736c64aa9(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -202,9 +242,11 @@ main:
     movq    %rsp, %rdi
     movl    $0, %esi
     call    xly_print
-    subq    $16, %rsp
-    leaq    .Lxly_str_10(%rip), %rdi
+    leaq    .Lxly_str_503397b8c17e9419(%rip), %rdi
     call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
     movq    %rax, 0(%rsp)
     movq    %rsp, %rdi
     movl    $1, %esi
@@ -212,93 +254,88 @@ main:
     addq    $16, %rsp
     movl    $0, %edi
     call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
+.section .rodata
+.balign 16
+.Lxly_ir0_k104:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k105:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k106:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
 .Lxly_fn_validateAge:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $80, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $0, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_2
-    cmpl    $0, (%rsi)
-    jne     .Lxly_2
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    ucomisd %xmm1, %xmm0
-    setb    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_3
-.Lxly_2:
-    call    xly_lt
-.Lxly_3:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_0
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
     movl    $0, %edi
     call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
     movq    %rbp, %rsp
     popq    %rbp
     ret
-    jmp     .Lxly_1
-.Lxly_0:
-.Lxly_1:
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4639481672377565184, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $0, (%rdi)
-    jne     .Lxly_6
-    cmpl    $0, (%rsi)
-    jne     .Lxly_6
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+.Lxly_irf0_0_b2:
+    movabsq $0x4062c00000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
     ucomisd %xmm1, %xmm0
     seta    %al
-    movzbl  %al, %edi
-    call    xly_bool
-    jmp     .Lxly_7
-.Lxly_6:
-    call    xly_gt
-.Lxly_7:
-    movq    %rax, %rdi
-    call    xly_truthy
-    testl   %eax, %eax
-    jz      .Lxly_4
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf0_0_b5
+.Lxly_irf0_0_b4:
     movl    $0, %edi
     call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
     movq    %rbp, %rsp
     popq    %rbp
     ret
-    jmp     .Lxly_5
-.Lxly_4:
-.Lxly_5:
+.Lxly_irf0_0_b5:
     movl    $1, %edi
     call    xly_bool
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -306,26 +343,26 @@ main:
 .Lxly_fn_double:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $80, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4611686018427387904, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
     mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
     call    xly_num
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -333,21 +370,37 @@ main:
 .Lxly_fn_compose:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $96, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    %rsi, -16(%rbp)
-    movq    %rdx, -24(%rbp)
-    movq    -24(%rbp), %rax
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_g
-    pushq   %rax
-    popq    %rdi
-    call    .Lxly_fn_f
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-    call    xly_null
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
     movq    %rbp, %rsp
     popq    %rbp
     ret
@@ -355,60 +408,83 @@ main:
 .Lxly_fn_addOne:
     pushq   %rbp
     movq    %rsp, %rbp
-    subq    $80, %rsp
-    movq    %rdi, -8(%rbp)
-    movq    -8(%rbp), %rax
-    pushq   %rax
-    subq    $8, %rsp
-    movabsq $4607182418800017408, %rax
-    movq    %rax, (%rsp)
-    movsd   (%rsp), %xmm0
-    addq    $8, %rsp
-    call    xly_num
-    movq    %rax, %rsi
-    popq    %rdi
-    cmpl    $1, (%rdi)
-    je      .Lxly_8
-    cmpl    $1, (%rsi)
-    je      .Lxly_8
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf3_0_k6(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
     movsd   8(%rdi), %xmm0
-    movsd   8(%rsi), %xmm1
-    addsd   %xmm1, %xmm0
+    addsd   8(%rsi), %xmm0
     call    xly_num
-    jmp     .Lxly_9
-.Lxly_8:
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
     call    xly_add
-.Lxly_9:
-    movq    %rbp, %rsp
-    popq    %rbp
-    ret
-    call    xly_null
+.Lxly_f3_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
     movq    %rbp, %rsp
     popq    %rbp
     ret
 
 .section .rodata
-.Lxly_str_0:
+.balign 16
+.Lxly_irf3_0_k6:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_e58482519042665a:
     .asciz  "Declarative Programming"
-.Lxly_str_1:
+.Lxly_str_bbce3d694d6654b5:
     .asciz  "Focus on WHAT, not HOW"
-.Lxly_str_2:
+.Lxly_str_29a1d9dd91002fc0:
     .asciz  "Validation:"
-.Lxly_str_3:
+.Lxly_str_1c23cb542b3de7fe:
     .asciz  "Transformation:"
-.Lxly_str_4:
+.Lxly_str_52e1e1f54ab4bb3d:
     .asciz  "Composed:"
-.Lxly_str_5:
+.Lxly_str_1ab8a87901814d9d:
     .asciz  "Benefits:"
-.Lxly_str_6:
+.Lxly_str_ac572bf82ea47add:
     .asciz  "  Clearer intent"
-.Lxly_str_7:
+.Lxly_str_bf5c1d25ceb37e65:
     .asciz  "  Less code"
-.Lxly_str_8:
+.Lxly_str_d95e414d2c10175f:
     .asciz  "  Easier to read"
-.Lxly_str_9:
+.Lxly_str_d2e7e30736c64aa9:
     .asciz  "  More maintainable"
-.Lxly_str_10:
+.Lxly_str_503397b8c17e9419:
     .asciz  "Complete!"
 
 .section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   1
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   8
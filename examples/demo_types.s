@@ -0,0 +1,226 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_92ea2807a01c94e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d6a2dd28b433c3d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k28(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_becced197f2ba0e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_8150d2195c1a76a1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k29(%rip), %rax
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_9ca2acff43016dd5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b2:
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b1:
+    leaq    .Lxly_ir0_k30(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1825c03de168e8d1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b4:
+.Lxly_ir0_b3:
+    leaq    .Lxly_ir0_k31(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_980d1ffb71cf9318(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k28:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k29:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k30:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k31:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_identity:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_92ea2807a01c94e5:
+    .asciz  "Type System Demo"
+.Lxly_str_d6a2dd28b433c3d5:
+    .asciz  "================"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_becced197f2ba0e8:
+    .asciz  "x ="
+.Lxly_str_8150d2195c1a76a1:
+    .asciz  "s ="
+.Lxly_str_9ca2acff43016dd5:
+    .asciz  "add(10, 20) ="
+.Lxly_str_1825c03de168e8d1:
+    .asciz  "identity(42) ="
+.Lxly_str_980d1ffb71cf9318:
+    .asciz  "Demo complete!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   2
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   16
@@ -0,0 +1,1440 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $480, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    leaq    .Lxly_str_74f0b8783b284023(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_669b18c6d2d9c95b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $2, %ecx
+    call    xly_make_variant
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_9ff1de19feac1b7c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $5, %ecx
+    call    xly_make_variant
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_6baf78886c99db89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $6, %ecx
+    call    xly_make_variant
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_cf00d78fd5953f1c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $7, %ecx
+    call    xly_make_variant
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_4139b7a40b565c47(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c63bbb6573255ecd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_8ac2dd24f22a95b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $1, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_76bae927324bfa4c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c37a9f99bc40369b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_62a32057f3310bff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_ef9cc4f81c4914a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_b8f99e26b1d8969e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f5f370ddac556091(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_b84bff60a9154918(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_38e0ac12eb195b06(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b6:
+.Lxly_ir0_b8:
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k211(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_8ac2dd24f22a95b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $1, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b5:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+72(%rip)
+.Lxly_ir0_b10:
+.Lxly_ir0_b11:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+.Lxly_ir0_b9:
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_a585f6f24614debf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b7e940f250cc9e01(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_07ee7e07b4b19223(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b14:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toNumber
+    addq    $16, %rsp
+    movq    %rax, %r13
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_eq
+.Lxly_2:
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -56(%rbp)
+    cmpq    $0, -56(%rbp)
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b35:
+    movq    -48(%rbp), %r14
+    jmp     .Lxly_ir0_b16
+.Lxly_ir0_b15:
+    leaq    .Lxly_str_af63a34c86018bb1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_contains
+    addq    $16, %rsp
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %r14
+.Lxly_ir0_b16:
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -80(%rbp)
+    cmpq    $0, -80(%rbp)
+    je      .Lxly_ir0_b18
+.Lxly_ir0_b17:
+    leaq    .Lxly_str_b711d6b442656a5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %r13
+    jmp     .Lxly_ir0_b13
+.Lxly_ir0_b18:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_ir0_b13:
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_e71fa2190541574b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b20:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toNumber
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    movq    %r15, %rdi
+    movq    -96(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_eq
+.Lxly_4:
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b21
+.Lxly_ir0_b36:
+    movq    -104(%rbp), %r15
+    jmp     .Lxly_ir0_b22
+.Lxly_ir0_b21:
+    leaq    .Lxly_str_af63a34c86018bb1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_contains
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %r15
+.Lxly_ir0_b22:
+    movq    %r15, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b24
+.Lxly_ir0_b23:
+    leaq    .Lxly_str_bcffd24bd670d870(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir0_b19
+.Lxly_ir0_b24:
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %r14
+.Lxly_ir0_b19:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_9c1da82644884d20(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2088a9185d0e047a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0db71e2ab68da842(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k212(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_a5c085b4bb73d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $8, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k213(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_a5c085b4bb73d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $8, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_7a07940a2b62f185(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $9, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_e6164688084aa91a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_374fda19c336d30c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $11, %ecx
+    call    xly_make_variant
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    movq    __xly_globals+112(%rip), %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k214(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $10, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k215(%rip), %rax
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $10, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_ir0_k216(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $10, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_f1904c25d7251732(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7f0fab88722e44ad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b26:
+    movq    %rbx, %rdi
+    call    xly_typeof
+    movq    %rax, %r13
+    leaq    .Lxly_str_8ac2dd24f22a95b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_6:
+    movq    %rax, -184(%rbp)
+    cmpq    $0, -184(%rbp)
+    je      .Lxly_ir0_b28
+.Lxly_ir0_b27:
+    leaq    .Lxly_str_d36eb9fb2120a68c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b29
+.Lxly_ir0_b28:
+    leaq    .Lxly_str_ef363f0f8aeae8e7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b29:
+.Lxly_ir0_b25:
+.Lxly_ir0_b31:
+    movq    %r12, %rdi
+    call    xly_typeof
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_8:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b33
+.Lxly_ir0_b32:
+    leaq    .Lxly_str_d36eb9fb2120a68c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b34
+.Lxly_ir0_b33:
+    leaq    .Lxly_str_ef363f0f8aeae8e7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b34:
+.Lxly_ir0_b30:
+    leaq    .Lxly_str_91535f48c63d83a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fc2c3bd345c0128a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $12, %ecx
+    call    xly_make_variant
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movq    __xly_globals+128(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_str_79e16f3b5f1edaa4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_4b052cb287d81da7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $13, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_62cca2412f0aff65(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_82a4e28ab5b56670(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $14, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_str_8f7addfc7b1888e7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_5f343a43e7ea9f91(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $15, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movq    $4, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_ab8ccb24ecc96785(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k217(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_ir0_k218(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_83a74a318bb2aa2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_af63b74c8601adad(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    movq    %r12, %rbx
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_ea11573f1af59eb5(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b4
+.Lxly_ir0_b2:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    call    xly_index
+    movq    %rax, %r13
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    movq    %rax, %r12
+    subq    $32, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+.Lxly_ir0_b3:
+    movq    %rbx, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    movq    %r12, %rbx
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_5af9907a9d1bfbc7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k210:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k211:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k212:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k213:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k214:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k215:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k216:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k217:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k218:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_safeDivide:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf0_0_k18(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f0_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_8ac2dd24f22a95b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $1, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k18:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_parseInt:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toNumber
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_eq
+.Lxly_f1_2:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b3
+.Lxly_irf1_0_b7:
+    movq    %r14, %r13
+    jmp     .Lxly_irf1_0_b4
+.Lxly_irf1_0_b3:
+    leaq    .Lxly_str_af63a34c86018bb1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_contains
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_irf1_0_b4:
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    leaq    .Lxly_str_2fb20197d4d51af0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_4
+.Lxly_f1_3:
+    call    xly_add
+.Lxly_f1_4:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_processOption:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rdi
+    call    xly_typeof
+    movq    %rax, %r12
+    leaq    .Lxly_str_8ac2dd24f22a95b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f2_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf2_0_b3
+.Lxly_irf2_0_b1:
+    leaq    .Lxly_str_d36eb9fb2120a68c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_irf2_0_b2
+.Lxly_irf2_0_b3:
+    leaq    .Lxly_str_ef363f0f8aeae8e7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf2_0_b2:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_74f0b8783b284023:
+    .asciz  "=== Algebraic Data Types with enum ==="
+.Lxly_str_669b18c6d2d9c95b:
+    .asciz  "None"
+.Lxly_str_9ff1de19feac1b7c:
+    .asciz  "Red"
+.Lxly_str_6baf78886c99db89:
+    .asciz  "Yellow"
+.Lxly_str_cf00d78fd5953f1c:
+    .asciz  "Green"
+.Lxly_str_4139b7a40b565c47:
+    .asciz  "\342\234\223 Enums defined"
+.Lxly_str_c63bbb6573255ecd:
+    .asciz  "\n=== Creating Enum Values ==="
+.Lxly_str_8ac2dd24f22a95b1:
+    .asciz  "Some"
+.Lxly_str_76bae927324bfa4c:
+    .asciz  "someValue:"
+.Lxly_str_c37a9f99bc40369b:
+    .asciz  "noValue:"
+.Lxly_str_62a32057f3310bff:
+    .asciz  "Data loaded successfully"
+.Lxly_str_091d5d07b5b33dcf:
+    .asciz  "Ok"
+.Lxly_str_ef9cc4f81c4914a6:
+    .asciz  "Connection timeout"
+.Lxly_str_d90625198e16ea2c:
+    .asciz  "Err"
+.Lxly_str_b8f99e26b1d8969e:
+    .asciz  "success:"
+.Lxly_str_f5f370ddac556091:
+    .asciz  "failure:"
+.Lxly_str_b84bff60a9154918:
+    .asciz  "Current light:"
+.Lxly_str_38e0ac12eb195b06:
+    .asciz  "\n=== Functions with ADTs ==="
+.Lxly_str_a585f6f24614debf:
+    .asciz  "safeDivide(10, 2):"
+.Lxly_str_b7e940f250cc9e01:
+    .asciz  "safeDivide(10, 0):"
+.Lxly_str_07ee7e07b4b19223:
+    .asciz  "42"
+.Lxly_str_af63a34c86018bb1:
+    .asciz  "."
+.Lxly_str_b711d6b442656a5a:
+    .asciz  "Invalid integer: 42"
+.Lxly_str_e71fa2190541574b:
+    .asciz  "abc"
+.Lxly_str_bcffd24bd670d870:
+    .asciz  "Invalid integer: abc"
+.Lxly_str_9c1da82644884d20:
+    .asciz  "parseInt('42'):"
+.Lxly_str_2088a9185d0e047a:
+    .asciz  "parseInt('abc'):"
+.Lxly_str_0db71e2ab68da842:
+    .asciz  "\n=== Nested ADTs ==="
+.Lxly_str_a5c085b4bb73d1b5:
+    .asciz  "Leaf"
+.Lxly_str_7a07940a2b62f185:
+    .asciz  "Branch"
+.Lxly_str_e6164688084aa91a:
+    .asciz  "Tree structure:"
+.Lxly_str_374fda19c336d30c:
+    .asciz  "Nil"
+.Lxly_str_3658069d1acdf568:
+    .asciz  "Cons"
+.Lxly_str_f1904c25d7251732:
+    .asciz  "Functional list:"
+.Lxly_str_7f0fab88722e44ad:
+    .asciz  "\n=== Type Safety ==="
+.Lxly_str_d36eb9fb2120a68c:
+    .asciz  "  Has value:"
+.Lxly_str_ef363f0f8aeae8e7:
+    .asciz  "  No value"
+.Lxly_str_91535f48c63d83a7:
+    .asciz  "\n=== State Machine with ADTs ==="
+.Lxly_str_fc2c3bd345c0128a:
+    .asciz  "Disconnected"
+.Lxly_str_79e16f3b5f1edaa4:
+    .asciz  "api.example.com"
+.Lxly_str_4b052cb287d81da7:
+    .asciz  "Connecting"
+.Lxly_str_62cca2412f0aff65:
+    .asciz  "abc123"
+.Lxly_str_82a4e28ab5b56670:
+    .asciz  "Connected"
+.Lxly_str_8f7addfc7b1888e7:
+    .asciz  "Network unreachable"
+.Lxly_str_5f343a43e7ea9f91:
+    .asciz  "Error"
+.Lxly_str_ab8ccb24ecc96785:
+    .asciz  "Connection states:"
+.Lxly_str_83a74a318bb2aa2e:
+    .asciz  "  State"
+.Lxly_str_af63b74c8601adad:
+    .asciz  ":"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_ea11573f1af59eb5:
+    .asciz  "length"
+.Lxly_str_5af9907a9d1bfbc7:
+    .asciz  "\n\342\234\223 Algebraic Data Types examples complete"
+.Lxly_str_2fb20197d4d51af0:
+    .asciz  "Invalid integer: "
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   19
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   152
@@ -0,0 +1,981 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_70737507d4117f02(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir8_k101(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x40239eb851eb851f, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir8_k102(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir8_k103(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_d2ba7b1928152111(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir8_k104(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c5c4e8749ca93366(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir8_k105(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x403f6a786c22680a, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir8_k106(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_ef0e4964f071d78a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir8_k107(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_fn___anon_1(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_ad632ed726fea41b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir8_k108(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3594a0bbf12a1d93(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir8_k109(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbc7a92a8ab9bbd9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir8_k110(%rip), %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir8_k111(%rip), %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir8_k112(%rip), %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir8_k113(%rip), %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir8_k114(%rip), %rax
+    movq    %rax, %r12
+    subq    $48, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movq    $5, %rsi
+    call    xly_array_create
+    addq    $48, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_8c098226fd763fb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_2(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_080f5919176d2d91(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_005ebd6c80af775a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_8ed8bca89377d4f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_f9ef043b106b46ea(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0d4b16e7f4368e23(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8762d8bbe36cb6e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_4(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_fn___anon_5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_fn___anon_6(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_7325aba55dfb9b11(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir8_k115(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_15575ed0c919ee74(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_7(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_ir8_k116(%rip), %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir8_k117(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_ir8_k118(%rip), %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir8_k119(%rip), %rax
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_f3d8c54ae5f18e93(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_47087823a415f127(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1c6aa4efb9fa162b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_eq
+.Lxly_10:
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a444461e10e7767f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir8_b2:
+    leaq    .Lxly_str_0ef37c2c3c5770e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_e6f79719051ff286(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir8_k120(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir8_k121(%rip), %rax
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+.Lxly_ir8_b1:
+    leaq    .Lxly_str_111e1a1f0ef8e4d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir8_k101:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k102:
+    .quad   0, 0x40239eb851eb851f, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k103:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k104:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k105:
+    .quad   0, 0x40239eb851eb851f, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k106:
+    .quad   0, 0x403f6a786c22680a, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k107:
+    .quad   0, 0x403f6a786c22680a, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k108:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k109:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k110:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k111:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k112:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k113:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k114:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k115:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k116:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k117:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k118:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k119:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k120:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir8_k121:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_1:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_4:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_fn___anon_f4_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf5_0_k6(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf5_0_k6:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_6:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_7:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_2
+.Lxly_f7_1:
+    call    xly_add
+.Lxly_f7_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_impureAdd:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    leaq    .Lxly_str_0ef37c2c3c5770e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_e6f79719051ff286(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f8_2
+.Lxly_f8_1:
+    call    xly_add
+.Lxly_f8_2:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f4_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, -40(%rbp)
+    movq    %rsi, %rbx
+    movq    -40(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %r12
+    movq    -40(%rbp), %rax
+    movq    8(%rax), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_70737507d4117f02:
+    .asciz  "=== Immutability with const ==="
+.Lxly_str_d2ba7b1928152111:
+    .asciz  "PI ="
+.Lxly_str_c5c4e8749ca93366:
+    .asciz  "GRAVITY ="
+.Lxly_str_ef0e4964f071d78a:
+    .asciz  "Circumference of circle with radius 5:"
+.Lxly_str_ad632ed726fea41b:
+    .asciz  "square(5) ="
+.Lxly_str_3594a0bbf12a1d93:
+    .asciz  "double(7) ="
+.Lxly_str_cbc7a92a8ab9bbd9:
+    .asciz  "\n=== Immutable Arrays ==="
+.Lxly_str_8c098226fd763fb8:
+    .asciz  "Original:"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_080f5919176d2d91:
+    .asciz  "map"
+.Lxly_str_005ebd6c80af775a:
+    .asciz  "Doubled:"
+.Lxly_str_8ed8bca89377d4f7:
+    .asciz  "filter"
+.Lxly_str_f9ef043b106b46ea:
+    .asciz  "Evens only:"
+.Lxly_str_0d4b16e7f4368e23:
+    .asciz  "Original unchanged:"
+.Lxly_str_8762d8bbe36cb6e8:
+    .asciz  "\n=== Higher-Order Functions ==="
+.Lxly_str_7325aba55dfb9b11:
+    .asciz  "add1ThenTimes2(5) ="
+.Lxly_str_15575ed0c919ee74:
+    .asciz  "\n=== Pure Functions ==="
+.Lxly_str_f3d8c54ae5f18e93:
+    .asciz  "pureAdd(2, 3) ="
+.Lxly_str_47087823a415f127:
+    .asciz  "pureAdd(2, 3) again ="
+.Lxly_str_1c6aa4efb9fa162b:
+    .asciz  "Always the same:"
+.Lxly_str_a444461e10e7767f:
+    .asciz  "\nCalling impure function:"
+.Lxly_str_0ef37c2c3c5770e4:
+    .asciz  "Adding"
+.Lxly_str_e6f79719051ff286:
+    .asciz  "and"
+.Lxly_str_111e1a1f0ef8e4d0:
+    .asciz  "\n\342\234\223 Immutability examples complete"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   16
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   128
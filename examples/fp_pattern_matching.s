@@ -0,0 +1,2637 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $896, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movl    $-1, -860(%rbp)
+    movl    $-1, -732(%rbp)
+    movl    $-1, -604(%rbp)
+    movl    $-1, -476(%rbp)
+    leaq    .Lxly_str_7f4267b64b9e5cad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d6a7e72854ed4966(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4055400000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k340(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+.Lxly_ir0_b6:
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_af63ff4c86022805(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b1:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_ef02828fe6f6b434(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63b04c8601a1c8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k341(%rip), %rax
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_89e9be1960f4c21c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+.Lxly_ir0_b12:
+    leaq    .Lxly_str_d9ad53251f2330a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b11:
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_344ea8f4939cdc98(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_2188897645cda38d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_09b3c27ca9e9e8ae(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_669b18c6d2d9c95b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $2, %ecx
+    call    xly_make_variant
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k342(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_8ac2dd24f22a95b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $1, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+.Lxly_ir0_b26:
+.Lxly_ir0_b29:
+    movq    %r13, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_1
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_null
+.Lxly_2:
+    movq    %rax, %r15
+    leaq    .Lxly_str_89dfbdb2ab4feb50(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -504(%rbp)
+    leaq    -512(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, %r15
+.Lxly_ir0_b31:
+.Lxly_ir0_b25:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b33:
+    movq    %r14, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_5
+    cmpl    $12, (%rcx)
+    jne     .Lxly_5
+    movslq  24(%rcx), %rax
+.Lxly_5:
+    movq    %rax, %r15
+    movq    $0, %rax
+    movq    %rax, -48(%rbp)
+    movq    %r15, %rax
+    cmpq    $1, %rax
+    je      .Lxly_ir0_b36
+    cmpq    $2, %rax
+    je      .Lxly_ir0_b37
+    jmp     .Lxly_ir0_b34
+.Lxly_ir0_b34:
+    movq    %r15, %rcx
+    xorl    %eax, %eax
+    cmpq    -48(%rbp), %rcx
+    setl    %al
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    jne     .Lxly_ir0_b37
+.Lxly_ir0_b35:
+    leaq    .Lxly_str_659bf7761f55c8d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    jmp     .Lxly_ir0_b38
+.Lxly_ir0_b36:
+    movq    %r14, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_6
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_7
+.Lxly_6:
+    call    xly_null
+.Lxly_7:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_9
+.Lxly_8:
+    call    xly_add
+.Lxly_9:
+    movq    %rax, %rbx
+    jmp     .Lxly_ir0_b38
+.Lxly_ir0_b37:
+    leaq    .Lxly_str_b5a42232edb7138f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rbx
+.Lxly_ir0_b38:
+.Lxly_ir0_b32:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_76c8fd23ab7401f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c06634eb991d5b96(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_4b208d14f1ac4376(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+.Lxly_ir0_b40:
+.Lxly_ir0_b43:
+    movq    %r14, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_10
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_11
+.Lxly_10:
+    call    xly_null
+.Lxly_11:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_cfd170e3210a463a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_12
+    cmpl    $0, (%rsi)
+    jne     .Lxly_12
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -632(%rbp)
+    leaq    -640(%rbp), %rax
+    jmp     .Lxly_13
+.Lxly_12:
+    call    xly_add
+.Lxly_13:
+    movq    %rax, %rbx
+.Lxly_ir0_b45:
+.Lxly_ir0_b39:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b47:
+.Lxly_ir0_b51:
+    movq    %r13, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_14
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_15
+.Lxly_14:
+    call    xly_null
+.Lxly_15:
+    movq    %rax, %r14
+    leaq    .Lxly_str_5e2e9d5a6f7e69c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_16
+    cmpl    $0, (%rsi)
+    jne     .Lxly_16
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -760(%rbp)
+    leaq    -768(%rbp), %rax
+    jmp     .Lxly_17
+.Lxly_16:
+    call    xly_add
+.Lxly_17:
+    movq    %rax, %rbx
+.Lxly_ir0_b52:
+.Lxly_ir0_b46:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0e7315b156892f79(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k343(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_a5c085b4bb73d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $5, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k344(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_a5c085b4bb73d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $5, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_7a07940a2b62f185(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $6, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -80(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k345(%rip), %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_a5c085b4bb73d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $5, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_7a07940a2b62f185(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $6, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %r15, %rdi
+    call    .Lxly_fn_countNodes
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_16e9c27a9739150d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_88ddcccf45251dd4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_6c2723ded2340684(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_374fda19c336d30c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $8, %ecx
+    call    xly_make_variant
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r15
+    movq    __xly_globals+88(%rip), %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k346(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $7, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k347(%rip), %rax
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $7, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k348(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $7, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k349(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_3658069d1acdf568(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    movl    $7, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_23fa70074070e9d3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    call    .Lxly_fn_listLength
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ffd80479a4e1d174(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    call    .Lxly_fn_sumList
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1b2c1e3546de6c87(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9ff1de19feac1b7c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $9, %ecx
+    call    xly_make_variant
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_6baf78886c99db89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $10, %ecx
+    call    xly_make_variant
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_cf00d78fd5953f1c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $11, %ecx
+    call    xly_make_variant
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    movq    __xly_globals+104(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+128(%rip)
+.Lxly_ir0_b54:
+    movq    %r15, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_18
+    cmpl    $12, (%rcx)
+    jne     .Lxly_18
+    movslq  24(%rcx), %rax
+.Lxly_18:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    subq    $9, %rax
+    cmpq    $2, %rax
+    ja      .Lxly_ir0_b55
+    leaq    .Lxly_19(%rip), %rdx
+    movslq  (%rdx,%rax,4), %rax
+    addq    %rdx, %rax
+    jmp     *%rax
+    .p2align 2
+.Lxly_19:
+    .long   .Lxly_ir0_b57-.Lxly_19
+    .long   .Lxly_ir0_b58-.Lxly_19
+    .long   .Lxly_ir0_b59-.Lxly_19
+.Lxly_ir0_b55:
+    movq    %r14, %rcx
+    xorl    %eax, %eax
+    cmpq    -48(%rbp), %rcx
+    setl    %al
+    movq    %rax, -168(%rbp)
+    cmpq    $0, -168(%rbp)
+    jne     .Lxly_ir0_b57
+.Lxly_ir0_b56:
+    movq    __xly_globals+104(%rip), %rax
+    movq    %rax, -176(%rbp)
+    movq    -176(%rbp), %rax
+    movq    %rax, -208(%rbp)
+    jmp     .Lxly_ir0_b60
+.Lxly_ir0_b57:
+    movq    __xly_globals+120(%rip), %rax
+    movq    %rax, -184(%rbp)
+    movq    -184(%rbp), %rax
+    movq    %rax, -208(%rbp)
+    jmp     .Lxly_ir0_b60
+.Lxly_ir0_b58:
+    movq    __xly_globals+104(%rip), %rax
+    movq    %rax, -192(%rbp)
+    movq    -192(%rbp), %rax
+    movq    %rax, -208(%rbp)
+    jmp     .Lxly_ir0_b60
+.Lxly_ir0_b59:
+    movq    __xly_globals+112(%rip), %rax
+    movq    %rax, -200(%rbp)
+    movq    -200(%rbp), %rax
+    movq    %rax, -208(%rbp)
+.Lxly_ir0_b60:
+.Lxly_ir0_b53:
+    movq    -208(%rbp), %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_b84bff60a9154918(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0fa94081195545a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_dbcf05f69be973ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, -224(%rbp)
+.Lxly_ir0_b62:
+    movq    $11, %rax
+    movq    %rax, %r15
+    movq    %r14, %rcx
+    xorl    %eax, %eax
+    cmpq    %r15, %rcx
+    sete    %al
+    movq    %rax, -232(%rbp)
+    movq    %r14, %rcx
+    xorl    %eax, %eax
+    cmpq    -48(%rbp), %rcx
+    setl    %al
+    movq    %rax, -240(%rbp)
+    cmpq    $0, -240(%rbp)
+    jne     .Lxly_ir0_b64
+.Lxly_ir0_b63:
+    cmpq    $0, -232(%rbp)
+    je      .Lxly_ir0_b65
+.Lxly_ir0_b64:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, -248(%rbp)
+    jmp     .Lxly_ir0_b67
+.Lxly_ir0_b65:
+.Lxly_ir0_b66:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, -248(%rbp)
+.Lxly_ir0_b67:
+.Lxly_ir0_b61:
+    subq    $16, %rsp
+    movq    -224(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4378cca5edca3285(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+.Lxly_ir0_b69:
+    movq    -208(%rbp), %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_20
+    cmpl    $12, (%rcx)
+    jne     .Lxly_20
+    movslq  24(%rcx), %rax
+.Lxly_20:
+    movq    %rax, %r14
+    movq    %r14, %rcx
+    xorl    %eax, %eax
+    cmpq    %r15, %rcx
+    sete    %al
+    movq    %rax, -264(%rbp)
+    movq    %r14, %rcx
+    xorl    %eax, %eax
+    cmpq    -48(%rbp), %rcx
+    setl    %al
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    jne     .Lxly_ir0_b71
+.Lxly_ir0_b70:
+    cmpq    $0, -264(%rbp)
+    je      .Lxly_ir0_b72
+.Lxly_ir0_b71:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir0_b74
+.Lxly_ir0_b72:
+.Lxly_ir0_b73:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r15, %r14
+.Lxly_ir0_b74:
+.Lxly_ir0_b68:
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_17e29211864ce0e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_afd409f44ed203a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    movl    $12, %ecx
+    call    xly_make_variant
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    movq    __xly_globals+144(%rip), %rax
+    movq    %rax, -272(%rbp)
+    movq    __xly_globals+152(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_11d3c978e4c87d56(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_7befb1695efc7db4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $13, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_str_e863d2bf1b2e94e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_f2235ffdd58a6fe9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $14, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    subq    $32, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    -288(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movq    $4, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+160(%rip)
+    leaq    .Lxly_str_aac5d6f70f09fb15(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, -312(%rbp)
+    leaq    .Lxly_ir0_k350(%rip), %rax
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_ir0_k351(%rip), %rax
+    movq    %rax, -328(%rbp)
+    movq    -328(%rbp), %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_str_0eeedd8087ba29ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_str_e45005029f6e64d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_str_e084ef7fec744b84(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    leaq    .Lxly_str_0db006bc97ec08ca(%rip), %rdi
+    call    xly_str
+    movq    %rax, -368(%rbp)
+    leaq    .Lxly_str_d6d9388bfcdb207b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -376(%rbp)
+    movq    -312(%rbp), %rbx
+.Lxly_ir0_b21:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_ea11573f1af59eb5(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %rbx, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b24
+.Lxly_ir0_b22:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -888(%rbp)
+    leaq    -896(%rbp), %rax
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, %r13
+.Lxly_ir0_b76:
+    movq    %r13, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_21
+    cmpl    $12, (%rcx)
+    jne     .Lxly_21
+    movslq  24(%rcx), %rax
+.Lxly_21:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    subq    $3, %rax
+    cmpq    $11, %rax
+    ja      .Lxly_ir0_b77
+    leaq    .Lxly_22(%rip), %rdx
+    movslq  (%rdx,%rax,4), %rax
+    addq    %rdx, %rax
+    jmp     *%rax
+    .p2align 2
+.Lxly_22:
+    .long   .Lxly_ir0_b79-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b77-.Lxly_22
+    .long   .Lxly_ir0_b80-.Lxly_22
+    .long   .Lxly_ir0_b81-.Lxly_22
+    .long   .Lxly_ir0_b82-.Lxly_22
+.Lxly_ir0_b77:
+    movq    %r15, %rcx
+    xorl    %eax, %eax
+    cmpq    -48(%rbp), %rcx
+    setl    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    jne     .Lxly_ir0_b79
+.Lxly_ir0_b78:
+    movq    -344(%rbp), %r12
+    jmp     .Lxly_ir0_b83
+.Lxly_ir0_b79:
+    movq    -352(%rbp), %r12
+    jmp     .Lxly_ir0_b83
+.Lxly_ir0_b80:
+    movq    -360(%rbp), %r12
+    jmp     .Lxly_ir0_b83
+.Lxly_ir0_b81:
+    movq    %r13, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_23
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_24
+.Lxly_23:
+    call    xly_null
+.Lxly_24:
+    movq    %rax, %r15
+    movq    -368(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_26
+.Lxly_25:
+    call    xly_add
+.Lxly_26:
+    movq    %rax, %r12
+    jmp     .Lxly_ir0_b83
+.Lxly_ir0_b82:
+    movq    %r13, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_27
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_28
+.Lxly_27:
+    call    xly_null
+.Lxly_28:
+    movq    %rax, %r12
+    movq    -376(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_30
+.Lxly_29:
+    call    xly_add
+.Lxly_30:
+    movq    %rax, %r13
+    movq    %r13, %r12
+.Lxly_ir0_b83:
+.Lxly_ir0_b75:
+    subq    $16, %rsp
+    movq    -336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b23:
+    movq    %rbx, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    movq    %r12, %rbx
+    jmp     .Lxly_ir0_b21
+.Lxly_ir0_b24:
+    leaq    .Lxly_str_3884fdfb97834aa7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k354(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k355(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    call    .Lxly_fn_divideAndFormat
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k356(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k357(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_divideAndFormat
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0bc00754a91433f7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k340:
+    .quad   0, 0x4055400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k341:
+    .quad   0, 0x4055400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k342:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k343:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k344:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k345:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k346:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k347:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k348:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k349:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k350:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k351:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k354:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k355:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k356:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k357:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_optionToString:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f0_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f0_1
+    movslq  24(%rcx), %rax
+.Lxly_f0_1:
+    movq    %rax, %r12
+    movq    $0, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    cmpq    $1, %rax
+    je      .Lxly_irf0_0_b2
+    cmpq    $2, %rax
+    je      .Lxly_irf0_0_b3
+    jmp     .Lxly_irf0_0_b5
+.Lxly_irf0_0_b5:
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %r13, %rcx
+    setl    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    jne     .Lxly_irf0_0_b3
+.Lxly_irf0_0_b4:
+    leaq    .Lxly_str_659bf7761f55c8d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f0_2
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f0_3
+.Lxly_f0_2:
+    call    xly_null
+.Lxly_f0_3:
+    movq    %rax, %r13
+    leaq    .Lxly_str_89dfbdb2ab4feb50(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_5
+.Lxly_f0_4:
+    call    xly_add
+.Lxly_f0_5:
+    movq    %rax, %r13
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    leaq    .Lxly_str_b5a42232edb7138f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+.Lxly_irf0_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_handleResult:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f1_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f1_1
+    movslq  24(%rcx), %rax
+.Lxly_f1_1:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    cmpq    $3, %rax
+    je      .Lxly_irf1_0_b2
+    cmpq    $4, %rax
+    je      .Lxly_irf1_0_b3
+    jmp     .Lxly_irf1_0_b5
+.Lxly_irf1_0_b5:
+.Lxly_irf1_0_b4:
+    leaq    .Lxly_str_2772365039026192(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f1_2
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f1_3
+.Lxly_f1_2:
+    call    xly_null
+.Lxly_f1_3:
+    movq    %rax, %r12
+    leaq    .Lxly_str_cfd170e3210a463a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_5
+.Lxly_f1_4:
+    call    xly_add
+.Lxly_f1_5:
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b3:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f1_6
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f1_7
+.Lxly_f1_6:
+    call    xly_null
+.Lxly_f1_7:
+    movq    %rax, %r13
+    leaq    .Lxly_str_5e2e9d5a6f7e69c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_9
+.Lxly_f1_8:
+    call    xly_add
+.Lxly_f1_9:
+    movq    %rax, %r12
+    movq    %r12, %rbx
+.Lxly_irf1_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_countNodes:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f2_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f2_1
+    movslq  24(%rcx), %rax
+.Lxly_f2_1:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    cmpq    $5, %rax
+    je      .Lxly_irf2_0_b2
+    cmpq    $6, %rax
+    je      .Lxly_irf2_0_b3
+    jmp     .Lxly_irf2_0_b5
+.Lxly_irf2_0_b5:
+.Lxly_irf2_0_b4:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf2_0_k21(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rbx
+    jmp     .Lxly_irf2_0_b1
+.Lxly_irf2_0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf2_0_k20(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf2_0_b1
+.Lxly_irf2_0_b3:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f2_2
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f2_3
+.Lxly_f2_2:
+    call    xly_null
+.Lxly_f2_3:
+    movq    %rax, %r12
+    movq    %rbx, %rcx
+    cmpq    $1, 120(%rcx)
+    jbe     .Lxly_f2_4
+    movq    112(%rcx), %rax
+    movq    8(%rax), %rax
+    jmp     .Lxly_f2_5
+.Lxly_f2_4:
+    call    xly_null
+.Lxly_f2_5:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    call    .Lxly_fn_countNodes
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    call    .Lxly_fn_countNodes
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_6
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_6
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_7
+.Lxly_f2_6:
+    call    xly_add
+.Lxly_f2_7:
+    movq    %rax, %r13
+    movq    %r13, %rbx
+.Lxly_irf2_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k21:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf2_0_k20:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_listLength:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f3_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f3_1
+    movslq  24(%rcx), %rax
+.Lxly_f3_1:
+    movq    %rax, %r12
+    movq    $0, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    cmpq    $8, %rax
+    je      .Lxly_irf3_0_b2
+    cmpq    $7, %rax
+    je      .Lxly_irf3_0_b3
+    jmp     .Lxly_irf3_0_b5
+.Lxly_irf3_0_b5:
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %r13, %rcx
+    setl    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    jne     .Lxly_irf3_0_b2
+.Lxly_irf3_0_b4:
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf3_0_k22(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf3_0_b1
+.Lxly_irf3_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf3_0_k21(%rip), %rax
+    movq    %rax, %r13
+    jmp     .Lxly_irf3_0_b1
+.Lxly_irf3_0_b3:
+    movq    %rbx, %rcx
+    cmpq    $1, 120(%rcx)
+    jbe     .Lxly_f3_2
+    movq    112(%rcx), %rax
+    movq    8(%rax), %rax
+    jmp     .Lxly_f3_3
+.Lxly_f3_2:
+    call    xly_null
+.Lxly_f3_3:
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    call    .Lxly_fn_listLength
+    movq    %rax, %r14
+    leaq    .Lxly_irf3_0_k20(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f3_5
+.Lxly_f3_4:
+    call    xly_add
+.Lxly_f3_5:
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+.Lxly_irf3_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf3_0_k22:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf3_0_k21:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf3_0_k20:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sumList:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f4_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f4_1
+    movslq  24(%rcx), %rax
+.Lxly_f4_1:
+    movq    %rax, %r12
+    movq    $0, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    cmpq    $8, %rax
+    je      .Lxly_irf4_0_b2
+    cmpq    $7, %rax
+    je      .Lxly_irf4_0_b3
+    jmp     .Lxly_irf4_0_b5
+.Lxly_irf4_0_b5:
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %r13, %rcx
+    setl    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    jne     .Lxly_irf4_0_b2
+.Lxly_irf4_0_b4:
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf4_0_k20(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf4_0_b1
+.Lxly_irf4_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf4_0_k19(%rip), %rax
+    movq    %rax, %r13
+    jmp     .Lxly_irf4_0_b1
+.Lxly_irf4_0_b3:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f4_2
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f4_3
+.Lxly_f4_2:
+    call    xly_null
+.Lxly_f4_3:
+    movq    %rax, %r13
+    movq    %rbx, %rcx
+    cmpq    $1, 120(%rcx)
+    jbe     .Lxly_f4_4
+    movq    112(%rcx), %rax
+    movq    8(%rax), %rax
+    jmp     .Lxly_f4_5
+.Lxly_f4_4:
+    call    xly_null
+.Lxly_f4_5:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_sumList
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_6
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_6
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_7
+.Lxly_f4_6:
+    call    xly_add
+.Lxly_f4_7:
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_irf4_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf4_0_k20:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf4_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_nextLight:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f5_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f5_1
+    movslq  24(%rcx), %rax
+.Lxly_f5_1:
+    movq    %rax, %r12
+    movq    $0, %rax
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    subq    $9, %rax
+    cmpq    $2, %rax
+    ja      .Lxly_irf5_0_b6
+    leaq    .Lxly_f5_2(%rip), %rdx
+    movslq  (%rdx,%rax,4), %rax
+    addq    %rdx, %rax
+    jmp     *%rax
+    .p2align 2
+.Lxly_f5_2:
+    .long   .Lxly_irf5_0_b2-.Lxly_f5_2
+    .long   .Lxly_irf5_0_b3-.Lxly_f5_2
+    .long   .Lxly_irf5_0_b4-.Lxly_f5_2
+.Lxly_irf5_0_b6:
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %rbx, %rcx
+    setl    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    jne     .Lxly_irf5_0_b2
+.Lxly_irf5_0_b5:
+    movq    __xly_globals+104(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+    jmp     .Lxly_irf5_0_b1
+.Lxly_irf5_0_b2:
+    movq    __xly_globals+120(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+    jmp     .Lxly_irf5_0_b1
+.Lxly_irf5_0_b3:
+    movq    __xly_globals+104(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+    jmp     .Lxly_irf5_0_b1
+.Lxly_irf5_0_b4:
+    movq    __xly_globals+112(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+.Lxly_irf5_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_canGo:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f6_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f6_1
+    movslq  24(%rcx), %rax
+.Lxly_f6_1:
+    movq    %rax, %r12
+    movq    $0, %rax
+    movq    %rax, %rbx
+    movq    $11, %rax
+    movq    %rax, %r13
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %r13, %rcx
+    sete    %al
+    movq    %rax, %r14
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %rbx, %rcx
+    setl    %al
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    jne     .Lxly_irf6_0_b2
+.Lxly_irf6_0_b5:
+    cmpq    $0, %r14
+    je      .Lxly_irf6_0_b4
+.Lxly_irf6_0_b2:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    jmp     .Lxly_irf6_0_b1
+.Lxly_irf6_0_b4:
+.Lxly_irf6_0_b3:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+.Lxly_irf6_0_b1:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_handleResponse:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f7_1
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f7_1
+    movslq  24(%rcx), %rax
+.Lxly_f7_1:
+    movq    %rax, %r12
+    movq    $0, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    subq    $3, %rax
+    cmpq    $11, %rax
+    ja      .Lxly_irf7_0_b7
+    leaq    .Lxly_f7_2(%rip), %rdx
+    movslq  (%rdx,%rax,4), %rax
+    addq    %rdx, %rax
+    jmp     *%rax
+    .p2align 2
+.Lxly_f7_2:
+    .long   .Lxly_irf7_0_b2-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b7-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b3-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b4-.Lxly_f7_2
+    .long   .Lxly_irf7_0_b5-.Lxly_f7_2
+.Lxly_irf7_0_b7:
+    movq    %r12, %rcx
+    xorl    %eax, %eax
+    cmpq    %r13, %rcx
+    setl    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    jne     .Lxly_irf7_0_b2
+.Lxly_irf7_0_b6:
+    leaq    .Lxly_str_0eeedd8087ba29ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rbx
+    jmp     .Lxly_irf7_0_b1
+.Lxly_irf7_0_b2:
+    leaq    .Lxly_str_e45005029f6e64d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rbx
+    jmp     .Lxly_irf7_0_b1
+.Lxly_irf7_0_b3:
+    leaq    .Lxly_str_e084ef7fec744b84(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rbx
+    jmp     .Lxly_irf7_0_b1
+.Lxly_irf7_0_b4:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f7_3
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f7_4
+.Lxly_f7_3:
+    call    xly_null
+.Lxly_f7_4:
+    movq    %rax, %r13
+    leaq    .Lxly_str_0db006bc97ec08ca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_6
+.Lxly_f7_5:
+    call    xly_add
+.Lxly_f7_6:
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf7_0_b1
+.Lxly_irf7_0_b5:
+    movq    %rbx, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f7_7
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f7_8
+.Lxly_f7_7:
+    call    xly_null
+.Lxly_f7_8:
+    movq    %rax, %r14
+    leaq    .Lxly_str_d6d9388bfcdb207b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_10
+.Lxly_f7_9:
+    call    xly_add
+.Lxly_f7_10:
+    movq    %rax, %r12
+    movq    %r12, %rbx
+.Lxly_irf7_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_safeDivide:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf8_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f8_2
+.Lxly_f8_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f8_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf8_0_b2
+.Lxly_irf8_0_b1:
+    leaq    .Lxly_str_a817a96102d2d15f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf8_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf8_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_divideAndFormat:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $464, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movl    $-1, -164(%rbp)
+.Lxly_irf9_0_b8:
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf9_0_k39(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_2
+.Lxly_f9_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b10
+.Lxly_irf9_0_b9:
+    leaq    .Lxly_str_a817a96102d2d15f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_d90625198e16ea2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $4, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf9_0_b7
+.Lxly_irf9_0_b10:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_091d5d07b5b33dcf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    movl    $3, %ecx
+    call    xly_make_variant
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_irf9_0_b7:
+    movq    %r13, %rcx
+    movq    $-1, %rax
+    testq   %rcx, %rcx
+    je      .Lxly_f9_3
+    cmpl    $12, (%rcx)
+    jne     .Lxly_f9_3
+    movslq  24(%rcx), %rax
+.Lxly_f9_3:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    cmpq    $3, %rax
+    je      .Lxly_irf9_0_b2
+    cmpq    $4, %rax
+    je      .Lxly_irf9_0_b3
+    jmp     .Lxly_irf9_0_b5
+.Lxly_irf9_0_b5:
+.Lxly_irf9_0_b4:
+    leaq    .Lxly_str_5787e20cab57b383(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf9_0_b1
+.Lxly_irf9_0_b2:
+    movq    %r13, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f9_4
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f9_5
+.Lxly_f9_4:
+    call    xly_null
+.Lxly_f9_5:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %r15
+    leaq    .Lxly_str_c37dd817ce876f70(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_6
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_6
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -192(%rbp)
+    leaq    -200(%rbp), %rax
+    jmp     .Lxly_f9_7
+.Lxly_f9_6:
+    call    xly_add
+.Lxly_f9_7:
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    -64(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    jmp     .Lxly_f9_9
+.Lxly_f9_8:
+    call    xly_add
+.Lxly_f9_9:
+    movq    %rax, %r12
+    leaq    .Lxly_str_c34e4417ce5f0332(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_10
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_10
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f9_11
+.Lxly_f9_10:
+    call    xly_add
+.Lxly_f9_11:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_toString
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_12
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_12
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f9_13
+.Lxly_f9_12:
+    call    xly_add
+.Lxly_f9_13:
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf9_0_b1
+.Lxly_irf9_0_b3:
+    movq    %r13, %rcx
+    cmpq    $0, 120(%rcx)
+    jbe     .Lxly_f9_14
+    movq    112(%rcx), %rax
+    movq    0(%rax), %rax
+    jmp     .Lxly_f9_15
+.Lxly_f9_14:
+    call    xly_null
+.Lxly_f9_15:
+    movq    %rax, %r15
+    leaq    .Lxly_str_5e2e9d5a6f7e69c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_16
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_16
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f9_17
+.Lxly_f9_16:
+    call    xly_add
+.Lxly_f9_17:
+    movq    %rax, %r14
+    movq    %r14, %r13
+.Lxly_irf9_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf9_0_k39:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_7f4267b64b9e5cad:
+    .asciz  "=== Pattern Matching with match ==="
+.Lxly_str_d6a7e72854ed4966:
+    .asciz  "\n=== Matching Literals ==="
+.Lxly_str_af63ff4c86022805:
+    .asciz  "B"
+.Lxly_str_ef02828fe6f6b434:
+    .asciz  "Grade"
+.Lxly_str_af63b04c8601a1c8:
+    .asciz  "="
+.Lxly_str_89e9be1960f4c21c:
+    .asciz  "red"
+.Lxly_str_d9ad53251f2330a5:
+    .asciz  "Stop"
+.Lxly_str_344ea8f4939cdc98:
+    .asciz  "Color"
+.Lxly_str_2188897645cda38d:
+    .asciz  "means:"
+.Lxly_str_09b3c27ca9e9e8ae:
+    .asciz  "\n=== Matching Option Types ==="
+.Lxly_str_669b18c6d2d9c95b:
+    .asciz  "None"
+.Lxly_str_8ac2dd24f22a95b1:
+    .asciz  "Some"
+.Lxly_str_89dfbdb2ab4feb50:
+    .asciz  "Value: "
+.Lxly_str_659bf7761f55c8d6:
+    .asciz  "Unknown option"
+.Lxly_str_b5a42232edb7138f:
+    .asciz  "No value"
+.Lxly_str_76c8fd23ab7401f2:
+    .asciz  "\n=== Matching Result Types ==="
+.Lxly_str_c06634eb991d5b96:
+    .asciz  "Data loaded"
+.Lxly_str_091d5d07b5b33dcf:
+    .asciz  "Ok"
+.Lxly_str_4b208d14f1ac4376:
+    .asciz  "Connection failed"
+.Lxly_str_d90625198e16ea2c:
+    .asciz  "Err"
+.Lxly_str_cfd170e3210a463a:
+    .asciz  "Success: "
+.Lxly_str_5e2e9d5a6f7e69c3:
+    .asciz  "Error: "
+.Lxly_str_0e7315b156892f79:
+    .asciz  "\n=== Destructuring Patterns ==="
+.Lxly_str_a5c085b4bb73d1b5:
+    .asciz  "Leaf"
+.Lxly_str_7a07940a2b62f185:
+    .asciz  "Branch"
+.Lxly_str_16e9c27a9739150d:
+    .asciz  "Tree has"
+.Lxly_str_88ddcccf45251dd4:
+    .asciz  "leaf nodes"
+.Lxly_str_6c2723ded2340684:
+    .asciz  "\n=== Complex Patterns ==="
+.Lxly_str_374fda19c336d30c:
+    .asciz  "Nil"
+.Lxly_str_3658069d1acdf568:
+    .asciz  "Cons"
+.Lxly_str_23fa70074070e9d3:
+    .asciz  "List length:"
+.Lxly_str_ffd80479a4e1d174:
+    .asciz  "List sum:"
+.Lxly_str_1b2c1e3546de6c87:
+    .asciz  "\n=== State Machine ==="
+.Lxly_str_9ff1de19feac1b7c:
+    .asciz  "Red"
+.Lxly_str_6baf78886c99db89:
+    .asciz  "Yellow"
+.Lxly_str_cf00d78fd5953f1c:
+    .asciz  "Green"
+.Lxly_str_b84bff60a9154918:
+    .asciz  "Current light:"
+.Lxly_str_0fa94081195545a2:
+    .asciz  "Next light:"
+.Lxly_str_dbcf05f69be973ce:
+    .asciz  "Can go?"
+.Lxly_str_4378cca5edca3285:
+    .asciz  "Can go after next?"
+.Lxly_str_17e29211864ce0e3:
+    .asciz  "\n=== HTTP Status Codes ==="
+.Lxly_str_afd409f44ed203a6:
+    .asciz  "NotFound"
+.Lxly_str_11d3c978e4c87d56:
+    .asciz  "Database connection lost"
+.Lxly_str_7befb1695efc7db4:
+    .asciz  "ServerError"
+.Lxly_str_e863d2bf1b2e94e4:
+    .asciz  "Missing required field 'email'"
+.Lxly_str_f2235ffdd58a6fe9:
+    .asciz  "BadRequest"
+.Lxly_str_aac5d6f70f09fb15:
+    .asciz  "HTTP responses:"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_0eeedd8087ba29ed:
+    .asciz  "Unknown status"
+.Lxly_str_e45005029f6e64d4:
+    .asciz  "Request successful"
+.Lxly_str_e084ef7fec744b84:
+    .asciz  "Resource not found"
+.Lxly_str_0db006bc97ec08ca:
+    .asciz  "Server error: "
+.Lxly_str_d6d9388bfcdb207b:
+    .asciz  "Bad request: "
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_ea11573f1af59eb5:
+    .asciz  "length"
+.Lxly_str_3884fdfb97834aa7:
+    .asciz  "\n=== Safe Division ==="
+.Lxly_str_0bc00754a91433f7:
+    .asciz  "\n\342\234\223 Pattern matching examples complete"
+.Lxly_str_2772365039026192:
+    .asciz  "Unknown result"
+.Lxly_str_a817a96102d2d15f:
+    .asciz  "Division by zero"
+.Lxly_str_5787e20cab57b383:
+    .asciz  "Unknown error"
+.Lxly_str_c37dd817ce876f70:
+    .asciz  " / "
+.Lxly_str_c34e4417ce5f0332:
+    .asciz  " = "
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   22
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   176
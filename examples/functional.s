@@ -0,0 +1,3435 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1216, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_050ae10c6b0a94db(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_21f5b5bbe68e0db9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir17_k474(%rip), %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir17_k475(%rip), %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir17_k476(%rip), %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir17_k477(%rip), %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir17_k478(%rip), %rax
+    movq    %rax, -104(%rbp)
+    subq    $48, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_8c098226fd763fb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -136(%rbp)
+.Lxly_ir17_b2:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -144(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+.Lxly_ir17_b3:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -152(%rbp)
+    cmpq    $0, -152(%rbp)
+    je      .Lxly_ir17_b5
+.Lxly_ir17_b4:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -168(%rbp)
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir17_b3
+.Lxly_ir17_b5:
+.Lxly_ir17_b1:
+    movq    -144(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_af30684f1ab0d294(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_1(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -184(%rbp)
+.Lxly_ir17_b7:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -192(%rbp)
+    movq    %r13, %r14
+.Lxly_ir17_b8:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -200(%rbp)
+    cmpq    $0, -200(%rbp)
+    je      .Lxly_ir17_b10
+.Lxly_ir17_b9:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -216(%rbp)
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir17_b8
+.Lxly_ir17_b10:
+.Lxly_ir17_b6:
+    movq    -192(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_005ebd6c80af775a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_aaeab17b23db0add(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_fn___anon_2(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -224(%rbp)
+.Lxly_ir17_b12:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -232(%rbp)
+    movq    %r13, %r14
+.Lxly_ir17_b13:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -240(%rbp)
+    cmpq    $0, -240(%rbp)
+    je      .Lxly_ir17_b17
+.Lxly_ir17_b14:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -248(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+    movq    -256(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -264(%rbp)
+    cmpq    $0, -264(%rbp)
+    je      .Lxly_ir17_b16
+.Lxly_ir17_b15:
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+.Lxly_ir17_b16:
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir17_b13
+.Lxly_ir17_b17:
+.Lxly_ir17_b11:
+    movq    -232(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_c25bdae29e0a0fd4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_3(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -280(%rbp)
+.Lxly_ir17_b19:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -288(%rbp)
+    movq    %r13, %r14
+.Lxly_ir17_b20:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -296(%rbp)
+    cmpq    $0, -296(%rbp)
+    je      .Lxly_ir17_b24
+.Lxly_ir17_b21:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -312(%rbp)
+    movq    -312(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -320(%rbp)
+    cmpq    $0, -320(%rbp)
+    je      .Lxly_ir17_b23
+.Lxly_ir17_b22:
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -328(%rbp)
+.Lxly_ir17_b23:
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir17_b20
+.Lxly_ir17_b24:
+.Lxly_ir17_b18:
+    movq    -288(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_9579614b35b5c7d7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_4(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -336(%rbp)
+.Lxly_ir17_b26:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -344(%rbp)
+    movq    %r13, %r14
+.Lxly_ir17_b27:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -352(%rbp)
+    cmpq    $0, -352(%rbp)
+    je      .Lxly_ir17_b31
+.Lxly_ir17_b28:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -336(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -376(%rbp)
+    cmpq    $0, -376(%rbp)
+    je      .Lxly_ir17_b30
+.Lxly_ir17_b29:
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -384(%rbp)
+.Lxly_ir17_b30:
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r14
+    jmp     .Lxly_ir17_b27
+.Lxly_ir17_b31:
+.Lxly_ir17_b25:
+    movq    -344(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_6e93a4178caafb9d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2e8c83579aef901a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_fn___anon_5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -392(%rbp)
+.Lxly_ir17_b33:
+    leaq    .Lxly_ir17_k484(%rip), %rax
+    movq    %rax, -400(%rbp)
+    movq    %r13, %r14
+    movq    -400(%rbp), %r15
+.Lxly_ir17_b34:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -408(%rbp)
+    movq    %r14, %xmm0
+    movq    -408(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -416(%rbp)
+    cmpq    $0, -416(%rbp)
+    je      .Lxly_ir17_b36
+.Lxly_ir17_b35:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -424(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -432(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -392(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -440(%rbp)
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -448(%rbp)
+    movq    -448(%rbp), %r14
+    movq    -440(%rbp), %r15
+    jmp     .Lxly_ir17_b34
+.Lxly_ir17_b36:
+.Lxly_ir17_b32:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_e1623825233b77f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -456(%rbp)
+    subq    $16, %rsp
+    movq    -456(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_6(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -464(%rbp)
+.Lxly_ir17_b38:
+    leaq    .Lxly_ir17_k486(%rip), %rax
+    movq    %rax, -472(%rbp)
+    movq    %r13, %r15
+    movq    -472(%rbp), %r14
+.Lxly_ir17_b39:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+    movq    %r15, %xmm0
+    movq    -480(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -488(%rbp)
+    cmpq    $0, -488(%rbp)
+    je      .Lxly_ir17_b41
+.Lxly_ir17_b40:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -496(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -496(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -504(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -504(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -464(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -512(%rbp)
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -520(%rbp)
+    movq    -520(%rbp), %r15
+    movq    -512(%rbp), %r14
+    jmp     .Lxly_ir17_b39
+.Lxly_ir17_b41:
+.Lxly_ir17_b37:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_9fc456789c641182(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_7(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -528(%rbp)
+.Lxly_ir17_b43:
+    leaq    .Lxly_ir17_k488(%rip), %rax
+    movq    %rax, -536(%rbp)
+    movq    %r13, %r15
+    movq    -536(%rbp), %r14
+.Lxly_ir17_b44:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -544(%rbp)
+    movq    %r15, %xmm0
+    movq    -544(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -552(%rbp)
+    cmpq    $0, -552(%rbp)
+    je      .Lxly_ir17_b46
+.Lxly_ir17_b45:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -560(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -560(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -568(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -568(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -528(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -576(%rbp)
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -584(%rbp)
+    movq    -584(%rbp), %r15
+    movq    -576(%rbp), %r14
+    jmp     .Lxly_ir17_b44
+.Lxly_ir17_b46:
+.Lxly_ir17_b42:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_49b491aecfdd6c39(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4b5562a48441450b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_fn___anon_8(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_fn___anon_9(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_compose
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_d3c006a5babc372b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir17_k490(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -592(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -592(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ed746bc290f6da8c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    call    .Lxly_fn_makeCounter
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_2da2670029871964(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    call    xly_call_fnval
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r14, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    call    xly_call_fnval
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r14, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    call    xly_call_fnval
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    .Lxly_fn_makeCounter
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_2d9f61002984d95b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    call    xly_call_fnval
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r15, %rdi
+    xorq    %rsi, %rsi
+    movl    $0, %edx
+    call    xly_call_fnval
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir17_k491(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_makeMultiplier
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_ir17_k492(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_makeMultiplier
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_94ef6b4837751355(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir17_k493(%rip), %rax
+    movq    %rax, -600(%rbp)
+    subq    $16, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -608(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -608(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a2c34f4a7532172a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir17_k494(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -616(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -616(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c00ea86b8b7b70b2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir17_k495(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_add
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -624(%rbp)
+    leaq    .Lxly_ir17_k496(%rip), %rax
+    movq    %rax, -632(%rbp)
+    movq    -632(%rbp), %rdi
+    call    .Lxly_fn_add
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_a41f44a01ec6e8d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -640(%rbp)
+    leaq    .Lxly_ir17_k497(%rip), %rax
+    movq    %rax, -648(%rbp)
+    subq    $16, %rsp
+    movq    -648(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -656(%rbp)
+    subq    $16, %rsp
+    movq    -640(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -656(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9785651526b07567(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir17_k498(%rip), %rax
+    movq    %rax, -664(%rbp)
+    subq    $16, %rsp
+    movq    -664(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -672(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -672(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_baa3a6c19ca6f1c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0xc000000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0xc014000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -680(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -688(%rbp)
+    movabsq $0xc020000000000000, %rax
+    movq    %rax, -696(%rbp)
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -704(%rbp)
+    leaq    .Lxly_ir17_k499(%rip), %rax
+    movq    %rax, -712(%rbp)
+    leaq    .Lxly_ir17_k500(%rip), %rax
+    movq    %rax, -720(%rbp)
+    leaq    .Lxly_ir17_k501(%rip), %rax
+    movq    %rax, -728(%rbp)
+    leaq    .Lxly_ir17_k502(%rip), %rax
+    movq    %rax, -736(%rbp)
+    leaq    .Lxly_ir17_k503(%rip), %rax
+    movq    %rax, -744(%rbp)
+    leaq    .Lxly_ir17_k504(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir17_k505(%rip), %rax
+    movq    %rax, -752(%rbp)
+    leaq    .Lxly_ir17_k506(%rip), %rax
+    movq    %rax, -760(%rbp)
+    leaq    .Lxly_ir17_k507(%rip), %rax
+    movq    %rax, -768(%rbp)
+    leaq    .Lxly_ir17_k508(%rip), %rax
+    movq    %rax, -776(%rbp)
+    subq    $80, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -720(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -728(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -736(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -744(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 40(%rsp)
+    movq    -752(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    -760(%rbp), %rax
+    movq    %rax, 56(%rsp)
+    movq    -768(%rbp), %rax
+    movq    %rax, 64(%rsp)
+    movq    -776(%rbp), %rax
+    movq    %rax, 72(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $10, %ecx
+    call    xly_call_module
+    addq    $80, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_5f96ac6fd3bea184(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -784(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -784(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_10(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -792(%rbp)
+.Lxly_ir17_b48:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r12
+    movq    %r13, %r15
+.Lxly_ir17_b49:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -800(%rbp)
+    movq    %r15, %xmm0
+    movq    -800(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -808(%rbp)
+    cmpq    $0, -808(%rbp)
+    je      .Lxly_ir17_b53
+.Lxly_ir17_b50:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -816(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -816(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -824(%rbp)
+    subq    $16, %rsp
+    movq    -824(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -792(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -832(%rbp)
+    movq    -832(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -840(%rbp)
+    cmpq    $0, -840(%rbp)
+    je      .Lxly_ir17_b52
+.Lxly_ir17_b51:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -824(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -848(%rbp)
+.Lxly_ir17_b52:
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -856(%rbp)
+    movq    -856(%rbp), %r15
+    jmp     .Lxly_ir17_b49
+.Lxly_ir17_b53:
+.Lxly_ir17_b47:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_str_e3cdae15c5e14900(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -864(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_11(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -872(%rbp)
+.Lxly_ir17_b55:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -880(%rbp)
+    movq    %r13, %r15
+.Lxly_ir17_b56:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -888(%rbp)
+    movq    %r15, %xmm0
+    movq    -888(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -896(%rbp)
+    cmpq    $0, -896(%rbp)
+    je      .Lxly_ir17_b58
+.Lxly_ir17_b57:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -904(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -904(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -912(%rbp)
+    subq    $16, %rsp
+    movq    -912(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -872(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -920(%rbp)
+    subq    $16, %rsp
+    movq    -880(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -920(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -928(%rbp)
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -936(%rbp)
+    movq    -936(%rbp), %r15
+    jmp     .Lxly_ir17_b56
+.Lxly_ir17_b58:
+.Lxly_ir17_b54:
+    movq    -880(%rbp), %rax
+    movq    %rax, __xly_globals+160(%rip)
+    subq    $16, %rsp
+    movq    -880(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_fn___anon_12(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -944(%rbp)
+.Lxly_ir17_b60:
+    leaq    .Lxly_ir17_k511(%rip), %rax
+    movq    %rax, -952(%rbp)
+    movq    %r13, %r15
+    movq    -952(%rbp), %r12
+.Lxly_ir17_b61:
+    subq    $16, %rsp
+    movq    -880(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -960(%rbp)
+    movq    %r15, %xmm0
+    movq    -960(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -968(%rbp)
+    cmpq    $0, -968(%rbp)
+    je      .Lxly_ir17_b63
+.Lxly_ir17_b62:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -976(%rbp)
+    subq    $16, %rsp
+    movq    -880(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -976(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -984(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -984(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -944(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -992(%rbp)
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1000(%rbp)
+    movq    -1000(%rbp), %r15
+    movq    -992(%rbp), %r12
+    jmp     .Lxly_ir17_b61
+.Lxly_ir17_b63:
+.Lxly_ir17_b59:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    subq    $16, %rsp
+    movq    -456(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_fn___anon_13(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -1008(%rbp)
+.Lxly_ir17_b65:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r15
+    movq    %r13, %r12
+.Lxly_ir17_b66:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1016(%rbp)
+    movq    %r12, %xmm0
+    movq    -1016(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -1024(%rbp)
+    cmpq    $0, -1024(%rbp)
+    je      .Lxly_ir17_b70
+.Lxly_ir17_b67:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -1032(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1032(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1040(%rbp)
+    subq    $16, %rsp
+    movq    -1040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1008(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -1048(%rbp)
+    movq    -1048(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -1056(%rbp)
+    cmpq    $0, -1056(%rbp)
+    je      .Lxly_ir17_b69
+.Lxly_ir17_b68:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1040(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1064(%rbp)
+.Lxly_ir17_b69:
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1072(%rbp)
+    movq    -1072(%rbp), %r12
+    jmp     .Lxly_ir17_b66
+.Lxly_ir17_b70:
+.Lxly_ir17_b64:
+    leaq    .Lxly_fn___anon_14(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -1080(%rbp)
+.Lxly_ir17_b72:
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r14
+    movq    %r13, %r12
+.Lxly_ir17_b73:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1088(%rbp)
+    movq    %r12, %xmm0
+    movq    -1088(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -1096(%rbp)
+    cmpq    $0, -1096(%rbp)
+    je      .Lxly_ir17_b75
+.Lxly_ir17_b74:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -1104(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1112(%rbp)
+    subq    $16, %rsp
+    movq    -1112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1080(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -1120(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1128(%rbp)
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1136(%rbp)
+    movq    -1136(%rbp), %r12
+    jmp     .Lxly_ir17_b73
+.Lxly_ir17_b75:
+.Lxly_ir17_b71:
+    leaq    .Lxly_fn___anon_15(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, -1144(%rbp)
+.Lxly_ir17_b77:
+    leaq    .Lxly_ir17_k515(%rip), %rax
+    movq    %rax, -1152(%rbp)
+    movq    %r13, %r12
+    movq    -1152(%rbp), %r15
+.Lxly_ir17_b78:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1160(%rbp)
+    movq    %r12, %xmm0
+    movq    -1160(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -1168(%rbp)
+    cmpq    $0, -1168(%rbp)
+    je      .Lxly_ir17_b80
+.Lxly_ir17_b79:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -1176(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1184(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1144(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -1192(%rbp)
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1200(%rbp)
+    movq    -1200(%rbp), %r12
+    movq    -1192(%rbp), %r15
+    jmp     .Lxly_ir17_b78
+.Lxly_ir17_b80:
+.Lxly_ir17_b76:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+176(%rip)
+    leaq    .Lxly_str_7943c9666b637666(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e614c585ebd4ad68(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    call    xly_obj_new
+    movq    %rax, %r12
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_1112e3a199c5e281(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_16(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_f5fa7c9a42abfb6e(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+184(%rip)
+.Lxly_ir17_b82:
+.Lxly_ir17_b84:
+    leaq    .Lxly_ir17_k517(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    .Lxly_fn_Some
+    movq    %rax, %r12
+.Lxly_ir17_b81:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+192(%rip)
+    leaq    .Lxly_str_b4ae05c82177f143(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir17_k518(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_f5fa7c9a42abfb6e(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir17_k519(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir17_k520(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_safeDivide
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+200(%rip)
+    leaq    .Lxly_str_251ec51912b65027(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir17_k521(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    leaq    .Lxly_str_f5fa7c9a42abfb6e(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e9954de3749dd221(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e5ab2b45feb05094(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e0545d5fc39f12fe(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8bde8191c384ca22(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2bab9e736540b5ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5c342ea3157d3965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c879d280c39a2eb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_756592d3bf693d72(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir17_k474:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k475:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k476:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k477:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k478:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k484:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k486:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k488:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k490:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k491:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k492:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k493:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k494:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k495:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k496:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k497:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k498:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k499:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k500:
+    .quad   0, 0xc000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k501:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k502:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k503:
+    .quad   0, 0xc014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k504:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k505:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k506:
+    .quad   0, 0xc020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k507:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k508:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k511:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k515:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k517:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k518:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k519:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k520:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir17_k521:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_map:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r14, %r12
+.Lxly_irf0_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r12
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_filter:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, -64(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r14, %r12
+.Lxly_irf1_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf1_0_b3
+.Lxly_irf1_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b5
+.Lxly_irf1_0_b4:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf1_0_b5:
+    movq    %r12, %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b3:
+    movq    -64(%rbp), %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_reduce:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r14, %r12
+    movq    %r13, %r15
+.Lxly_irf2_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b3
+.Lxly_irf2_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    -56(%rbp), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    movq    %r13, %r15
+    jmp     .Lxly_irf2_0_b1
+.Lxly_irf2_0_b3:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_1:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_add
+.Lxly_f4_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_4:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f8_2
+.Lxly_f8_1:
+    call    xly_add
+.Lxly_f8_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_6:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_7:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_2
+.Lxly_f10_1:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b2
+.Lxly_irf10_0_b1:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b2:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_compose:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_fn___anon_f11_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_8:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf12_0_k6(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f12_2
+.Lxly_f12_1:
+    call    xly_add
+.Lxly_f12_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf12_0_k6:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_9:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_makeCounter:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf14_1_k5(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_fn___anon_f14_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf14_1_k5:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_makeMultiplier:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_fn___anon_f15_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_fn___anon_f16_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_10:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_11:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_12:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_2
+.Lxly_f19_1:
+    call    xly_add
+.Lxly_f19_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_13:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_14:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_15:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_2
+.Lxly_f22_1:
+    call    xly_add
+.Lxly_f22_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Some:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    call    xly_obj_new
+    movq    %rax, %r12
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_1112e3a199c5e281(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rdi
+    movq    %rbx, %rdx
+    movq    .Lxly_atom_7ce4fd9430e80cea(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn___anon_f23_0(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_f5fa7c9a42abfb6e(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_16:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_safeDivide:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf25_0_k18(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f25_2
+.Lxly_f25_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f25_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf25_0_b2
+.Lxly_irf25_0_b1:
+    movq    __xly_globals+184(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf25_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_Some
+
+.section .rodata
+.balign 16
+.Lxly_irf25_0_k18:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_f11_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, -40(%rbp)
+    movq    %rsi, %rbx
+    movq    -40(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %r12
+    movq    -40(%rbp), %rax
+    movq    8(%rax), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f14_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, -32(%rbp)
+    movq    -32(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf27_0_k6(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_2
+.Lxly_f27_1:
+    call    xly_add
+.Lxly_f27_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf27_0_k6:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_f15_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, -32(%rbp)
+    movq    %rsi, %rbx
+    movq    -32(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f16_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, -32(%rbp)
+    movq    %rsi, %rbx
+    movq    -32(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f29_2
+.Lxly_f29_1:
+    call    xly_add
+.Lxly_f29_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn___anon_f23_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_this
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_7ce4fd9430e80cea(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   3
+.Lxly_atoms:
+.Lxly_atom_1112e3a199c5e281:
+    .quad   .Lxly_str_1112e3a199c5e281
+.Lxly_atom_f5fa7c9a42abfb6e:
+    .quad   .Lxly_str_f5fa7c9a42abfb6e
+.Lxly_atom_7ce4fd9430e80cea:
+    .quad   .Lxly_str_7ce4fd9430e80cea
+
+.section .rodata
+.Lxly_str_050ae10c6b0a94db:
+    .asciz  "=== Functional Programming ==="
+.Lxly_str_21f5b5bbe68e0db9:
+    .asciz  "1. Higher-Order Functions"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_8c098226fd763fb8:
+    .asciz  "Original:"
+.Lxly_str_07d38007b49acdd1:
+    .asciz  ", "
+.Lxly_str_41def2de29651139:
+    .asciz  "join"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_af30684f1ab0d294:
+    .asciz  "Squared:"
+.Lxly_str_005ebd6c80af775a:
+    .asciz  "Doubled:"
+.Lxly_str_aaeab17b23db0add:
+    .asciz  "2. Filter"
+.Lxly_str_c25bdae29e0a0fd4:
+    .asciz  "Evens:"
+.Lxly_str_9579614b35b5c7d7:
+    .asciz  "Odds:"
+.Lxly_str_6e93a4178caafb9d:
+    .asciz  "Greater than 3:"
+.Lxly_str_2e8c83579aef901a:
+    .asciz  "3. Reduce"
+.Lxly_str_e1623825233b77f6:
+    .asciz  "Sum:"
+.Lxly_str_9fc456789c641182:
+    .asciz  "Product:"
+.Lxly_str_49b491aecfdd6c39:
+    .asciz  "Max:"
+.Lxly_str_4b5562a48441450b:
+    .asciz  "4. Function Composition"
+.Lxly_str_d3c006a5babc372b:
+    .asciz  "addOneThenTimesTwo(5):"
+.Lxly_str_ed746bc290f6da8c:
+    .asciz  "5. Closures"
+.Lxly_str_2da2670029871964:
+    .asciz  "Counter1:"
+.Lxly_str_2d9f61002984d95b:
+    .asciz  "Counter2:"
+.Lxly_str_94ef6b4837751355:
+    .asciz  "triple(5):"
+.Lxly_str_a2c34f4a7532172a:
+    .asciz  "quadruple(5):"
+.Lxly_str_c00ea86b8b7b70b2:
+    .asciz  "6. Currying"
+.Lxly_str_a41f44a01ec6e8d5:
+    .asciz  "add5(3):"
+.Lxly_str_9785651526b07567:
+    .asciz  "add10(3):"
+.Lxly_str_baa3a6c19ca6f1c5:
+    .asciz  "7. Practical Example - Data Processing"
+.Lxly_str_5f96ac6fd3bea184:
+    .asciz  "Original data:"
+.Lxly_str_e3cdae15c5e14900:
+    .asciz  "Positive:"
+.Lxly_str_7943c9666b637666:
+    .asciz  "Pipeline result:"
+.Lxly_str_e614c585ebd4ad68:
+    .asciz  "8. Option Type"
+.Lxly_str_b4ae05c82177f143:
+    .asciz  "10 / 2:"
+.Lxly_str_f5fa7c9a42abfb6e:
+    .asciz  "getOr"
+.Lxly_str_251ec51912b65027:
+    .asciz  "10 / 0 (safe):"
+.Lxly_str_e9954de3749dd221:
+    .asciz  "=== Functional Programming Demo Complete ==="
+.Lxly_str_e5ab2b45feb05094:
+    .asciz  "Concepts demonstrated:"
+.Lxly_str_e0545d5fc39f12fe:
+    .asciz  "- Map, Filter, Reduce"
+.Lxly_str_8bde8191c384ca22:
+    .asciz  "- Function composition"
+.Lxly_str_2bab9e736540b5ba:
+    .asciz  "- Closures"
+.Lxly_str_5c342ea3157d3965:
+    .asciz  "- Currying"
+.Lxly_str_4c879d280c39a2eb:
+    .asciz  "- Option type"
+.Lxly_str_756592d3bf693d72:
+    .asciz  "- Data transformation pipelines"
+.Lxly_str_1112e3a199c5e281:
+    .asciz  "isSome"
+.Lxly_str_7ce4fd9430e80cea:
+    .asciz  "value"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   26
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   208
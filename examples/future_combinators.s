@@ -0,0 +1,249 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $144, %rsp
+    call    xly_null
+    movq    %rax, -8(%rbp)
+    movq    -8(%rbp), %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, -16(%rbp)
+    movq    -16(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    call    xly_null
+    movq    %rax, -24(%rbp)
+    movq    -24(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    call    xly_null
+    movq    %rax, -32(%rbp)
+    movq    -32(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_84b22983aaee7a7a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -40(%rbp)
+    call    xly_null
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -40(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    call    xly_null
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_c5969e11f47fec66(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    call    xly_null
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_970afd83b59d1cb5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    call    xly_null
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_eafc67725dbe3b44(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    call    xly_null
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8fbed90b6d2d9031(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    call    xly_null
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, -136(%rbp)
+    movl    $0, %edi
+    call    xly_exit
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_work:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $128, %rsp
+    movq    %rdi, -8(%rbp)
+    leaq    .Lxly_irf0_0_k1(%rip), %rax
+    movq    %rax, -16(%rbp)
+    leaq    .Lxly_irf0_0_k2(%rip), %rax
+    movq    %rax, -24(%rbp)
+    movq    -24(%rbp), %rax
+    movq    %rax, -32(%rbp)
+    movq    -16(%rbp), %rax
+    movq    %rax, -40(%rbp)
+.Lxly_irf0_0_b1:
+    leaq    .Lxly_irf0_0_k6(%rip), %rax
+    movq    %rax, -48(%rbp)
+    movq    -8(%rbp), %rdi
+    movq    -48(%rbp), %rsi
+    call    xly_mul
+    movq    %rax, -56(%rbp)
+    movq    -32(%rbp), %rdi
+    movq    -56(%rbp), %rsi
+.Lxly_f0_1:
+    call    xly_lt
+.Lxly_f0_2:
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, -72(%rbp)
+    cmpq    $0, -72(%rbp)
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b2:
+    leaq    .Lxly_irf0_0_k12(%rip), %rax
+    movq    %rax, -80(%rbp)
+    movq    -40(%rbp), %rdi
+    movq    -80(%rbp), %rsi
+    call    xly_add
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_irf0_0_k14(%rip), %rax
+    movq    %rax, -96(%rbp)
+    movq    -32(%rbp), %rdi
+    movq    -96(%rbp), %rsi
+    call    xly_add
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rax
+    movq    %rax, -32(%rbp)
+    movq    -88(%rbp), %rax
+    movq    %rax, -40(%rbp)
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    movq    -8(%rbp), %rax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k1:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf0_0_k2:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf0_0_k6:
+    .quad   0, 0x40c3880000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf0_0_k12:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf0_0_k14:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_dbl:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rdi, -8(%rbp)
+    leaq    .Lxly_irf1_0_k1(%rip), %rax
+    movq    %rax, -16(%rbp)
+    movq    -8(%rbp), %rdi
+    movq    -16(%rbp), %rsi
+    call    xly_mul
+    movq    %rax, -24(%rbp)
+    movq    -24(%rbp), %rax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k1:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_84b22983aaee7a7a:
+    .asciz  "all:"
+.Lxly_str_c5969e11f47fec66:
+    .asciz  "race:"
+.Lxly_str_970afd83b59d1cb5:
+    .asciz  "any:"
+.Lxly_str_eafc67725dbe3b44:
+    .asciz  "then:"
+.Lxly_str_8fbed90b6d2d9031:
+    .asciz  "empty all:"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   6
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   48
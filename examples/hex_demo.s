@@ -0,0 +1,1584 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $784, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_34b4fe9314ccf96d(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_1e50d829d1b0e29d(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %rax, -8(%rbp)
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %rax, -16(%rbp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %rax, -24(%rbp)
+    movabsq $4642648265865560064, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %rax, -32(%rbp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4640185359819341824, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %rax, -40(%rbp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+40(%rip)
+    movq    %rax, -48(%rbp)
+    movabsq $4638707616191610880, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+48(%rip)
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_e37bebec537ced02(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -24(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_6984bef2ece9aba6(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -32(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_ae1e4320cb20551c(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -40(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_5ec82f286e06b1de(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_55cc0e5b701047a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_54332e62bacc637a(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_a8263eed8e600466(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_e9b6d89838fb7734(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_c79d2165dff38322(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_7f9baa674c116e87(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $32, %rsp
+    movabsq $4638707616191610880, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 8(%rsp)
+    movabsq $4638707616191610880, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 16(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    movq    16(%rsp), %rdx
+    addq    $32, %rsp
+    call    .Lxly_fn_makeColor
+    movq    %rax, __xly_globals+56(%rip)
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_192ecf0c3a144853(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_extractRed
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_extractGreen
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_extractBlue
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_b2775516ff3a2315(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_b22fd316fefd438c(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_b240d516ff0bba25(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_9a8d083a1565e8a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_4561c118181685cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_45653b1818198af1(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4625478292286210048, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_57218b1822430a3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4629700416936869888, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_57250d1822461cfb(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4629841154425225216, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_a955dc538fb6c68a(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_e41b146093d2d2a4(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_popcount
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_9c2f614fbf0ba18c(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_popcount
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_19cb392622dcbf54(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4640185359819341824, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_popcount
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_d824f75afbccac09(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+88(%rip)
+    movq    %rax, -96(%rbp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+96(%rip)
+    movq    %rax, -104(%rbp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+104(%rip)
+    movq    %rax, -112(%rbp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+112(%rip)
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_15923994727a0adb(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -120(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_0
+    cmpl    $0, (%rsi)
+    jne     .Lxly_0
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_1
+.Lxly_0:
+    call    xly_neq
+.Lxly_1:
+    movq    %rax, __xly_globals+120(%rip)
+    movq    %rax, -128(%rbp)
+    movq    -120(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_3
+.Lxly_2:
+    call    xly_neq
+.Lxly_3:
+    movq    %rax, __xly_globals+128(%rip)
+    movq    %rax, -136(%rbp)
+    movq    -120(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_4
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_5
+.Lxly_4:
+    call    xly_neq
+.Lxly_5:
+    movq    %rax, __xly_globals+136(%rip)
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_761cbfc7dec57e9b(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_53eb9ff641ab0308(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_93c481a05590ee98(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_836bf7bcd07f200c(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4640220544191430656, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+144(%rip)
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movabsq $4640220544191430656, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_swapNibbles
+    movq    %rax, __xly_globals+152(%rip)
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_8c098226fd763fb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movabsq $4640220544191430656, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_f960f0fb83c070c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_7781f37db9fd181c(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_f5bcac981c23d83d(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_27d14f6c881a515e(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_a7a5e3fa94a56f21(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_4c9ebe82f7197bca(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_0baf221f28f6a151(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_5d4e39ee0eebe3a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_8c8d7a41588a8686(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_0bf676c86716cd05(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_1c2242ad2fb74cd5(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_c224674b3d757b29(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_toHexDigit:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf0_0_k16(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf0_0_k17(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k16:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf0_0_k17:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_simpleToHex:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $240, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movl    $-1, -196(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_irf1_0_k39(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f1_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    leaq    .Lxly_str_af63ad4c86019caf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x4030000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, -80(%rbp)
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, -88(%rbp)
+    movq    %rbx, %r15
+    movq    -64(%rbp), %r14
+.Lxly_irf1_0_b4:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf1_0_b6
+.Lxly_irf1_0_b5:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf1_0_b9:
+    movq    %rbx, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf1_0_b11
+.Lxly_irf1_0_b10:
+    movq    %rbx, %xmm0
+    movq    -80(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf1_0_b8
+.Lxly_irf1_0_b11:
+    movq    %rbx, %xmm0
+    movq    -88(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+.Lxly_irf1_0_b8:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -224(%rbp)
+    leaq    -232(%rbp), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_4
+.Lxly_f1_3:
+    call    xly_add
+.Lxly_f1_4:
+    movq    %rax, %rbx
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %rbx, %r14
+    jmp     .Lxly_irf1_0_b4
+.Lxly_irf1_0_b6:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k39:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_makeColor:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $304, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    %rsi, -16(%rbp)
+    movq    %rdx, -24(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -32(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4620693217682128896, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -40(%rbp)
+    movq    -32(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -40(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -24(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_extractRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -16(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_extractGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4620693217682128896, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -16(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_extractBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_isPowerOf2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_f6_3
+.Lxly_f6_2:
+    call    xly_eq
+.Lxly_f6_3:
+    movq    %rax, %rdi
+    call    xly_truthy
+    testl   %eax, %eax
+    jz      .Lxly_f6_0
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    jmp     .Lxly_f6_1
+.Lxly_f6_0:
+.Lxly_f6_1:
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    subsd   %xmm1, %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -16(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_4
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_f6_5
+.Lxly_f6_4:
+    call    xly_eq
+.Lxly_f6_5:
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_popcount:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $288, %rsp
+    movq    %rdi, -8(%rbp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, -16(%rbp)
+    movq    -8(%rbp), %rax
+    movq    %rax, -24(%rbp)
+.Lxly_f7_0:
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_f7_3
+.Lxly_f7_2:
+    call    xly_neq
+.Lxly_f7_3:
+    movq    %rax, %rdi
+    call    xly_truthy
+    testl   %eax, %eax
+    jz      .Lxly_f7_1
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $1, (%rdi)
+    je      .Lxly_f7_4
+    cmpl    $1, (%rsi)
+    je      .Lxly_f7_4
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    addsd   %xmm1, %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_5
+.Lxly_f7_4:
+    call    xly_add
+.Lxly_f7_5:
+    movq    %rax, -16(%rbp)
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    subsd   %xmm1, %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -24(%rbp)
+    jmp     .Lxly_f7_0
+.Lxly_f7_1:
+    movq    -16(%rbp), %rax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_swapNibbles:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $288, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -16(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -24(%rbp)
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -16(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -32(%rbp)
+    movq    -32(%rbp), %rax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_34b4fe9314ccf96d:
+    .asciz  "=== Hexadecimal Functions ==="
+.Lxly_str_1e50d829d1b0e29d:
+    .asciz  "1. Bitwise Operations"
+.Lxly_str_e37bebec537ced02:
+    .asciz  "255 AND 15:"
+.Lxly_str_6984bef2ece9aba6:
+    .asciz  "240 OR 15:"
+.Lxly_str_ae1e4320cb20551c:
+    .asciz  "255 XOR 170:"
+.Lxly_str_5ec82f286e06b1de:
+    .asciz  "1 << 4:"
+.Lxly_str_55cc0e5b701047a6:
+    .asciz  "128 >> 2:"
+.Lxly_str_54332e62bacc637a:
+    .asciz  "2. Decimal to Hex Conversion"
+.Lxly_str_a8263eed8e600466:
+    .asciz  "15 = 0xF"
+.Lxly_str_e9b6d89838fb7734:
+    .asciz  "255 = 0xFF"
+.Lxly_str_c79d2165dff38322:
+    .asciz  "4096 = 0x1000"
+.Lxly_str_7f9baa674c116e87:
+    .asciz  "3. RGB Color (24-bit)"
+.Lxly_str_192ecf0c3a144853:
+    .asciz  "Purple RGB(128,0,128):"
+.Lxly_str_b2775516ff3a2315:
+    .asciz  "Extracted R:"
+.Lxly_str_b22fd316fefd438c:
+    .asciz  "Extracted G:"
+.Lxly_str_b240d516ff0bba25:
+    .asciz  "Extracted B:"
+.Lxly_str_9a8d083a1565e8a5:
+    .asciz  "4. Power of 2 Check"
+.Lxly_str_4561c118181685cc:
+    .asciz  "16:"
+.Lxly_str_45653b1818198af1:
+    .asciz  "17:"
+.Lxly_str_57218b1822430a3e:
+    .asciz  "32:"
+.Lxly_str_57250d1822461cfb:
+    .asciz  "33:"
+.Lxly_str_a955dc538fb6c68a:
+    .asciz  "5. Population Count"
+.Lxly_str_e41b146093d2d2a4:
+    .asciz  "255 (8 bits):"
+.Lxly_str_9c2f614fbf0ba18c:
+    .asciz  "15 (4 bits):"
+.Lxly_str_19cb392622dcbf54:
+    .asciz  "170 (4 bits):"
+.Lxly_str_d824f75afbccac09:
+    .asciz  "6. Bit Flags"
+.Lxly_str_15923994727a0adb:
+    .asciz  "Permissions:"
+.Lxly_str_761cbfc7dec57e9b:
+    .asciz  "Can read:"
+.Lxly_str_53eb9ff641ab0308:
+    .asciz  "Can write:"
+.Lxly_str_93c481a05590ee98:
+    .asciz  "Can execute:"
+.Lxly_str_836bf7bcd07f200c:
+    .asciz  "7. Nibble Operations"
+.Lxly_str_8c098226fd763fb8:
+    .asciz  "Original:"
+.Lxly_str_f960f0fb83c070c3:
+    .asciz  "Swapped:"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_7781f37db9fd181c:
+    .asciz  "Bitwise operations:"
+.Lxly_str_f5bcac981c23d83d:
+    .asciz  "  \342\200\242 AND, OR, XOR, NOT"
+.Lxly_str_27d14f6c881a515e:
+    .asciz  "  \342\200\242 Shifts: <<, >>"
+.Lxly_str_a7a5e3fa94a56f21:
+    .asciz  "  \342\200\242 Color manipulation"
+.Lxly_str_4c9ebe82f7197bca:
+    .asciz  "  \342\200\242 Power of 2 checks"
+.Lxly_str_0baf221f28f6a151:
+    .asciz  "  \342\200\242 Bit counting"
+.Lxly_str_5d4e39ee0eebe3a7:
+    .asciz  "  \342\200\242 Flag operations"
+.Lxly_str_8c8d7a41588a8686:
+    .asciz  "Note: Native hex literals (0xFF)"
+.Lxly_str_0bf676c86716cd05:
+    .asciz  "documented but use decimal for now"
+.Lxly_str_1c2242ad2fb74cd5:
+    .asciz  "Compile for 18x speed:"
+.Lxly_str_c224674b3d757b29:
+    .asciz  "  ./xenlyc -O3 hex_demo.xe -o hex"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+.Lxly_str_af63ad4c86019caf:
+    .asciz  "0"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   20
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   160
@@ -0,0 +1,1601 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $832, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_c9fd68879f84222b(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_9f13ddb68e035cd7(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %rax, -8(%rbp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %rax, -16(%rbp)
+    movabsq $4661225614328463360, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %rax, -24(%rbp)
+    subq    $16, %rsp
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movabsq $4661225614328463360, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_f49302de07d437d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %rax, -32(%rbp)
+    movabsq $4642648265865560064, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %rax, -40(%rbp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4640185359819341824, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+40(%rip)
+    movq    %rax, -48(%rbp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+48(%rip)
+    movq    %rax, -56(%rbp)
+    movabsq $4638707616191610880, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+56(%rip)
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_29f11c8b69337654(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -32(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_2f978719bf1b9afa(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -40(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_2892465c0a4e0d6c(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_5bd10b2446a43ae4(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_5bbd0b24469391da(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_4206182fd21a4ca1(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $32, %rsp
+    movabsq $4638707616191610880, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 8(%rsp)
+    movabsq $4638707616191610880, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 16(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    movq    16(%rsp), %rdx
+    addq    $32, %rsp
+    call    .Lxly_fn_makeColor
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_53e5b9e99be98e7f(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_extractRed
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_extractGreen
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_extractBlue
+    movq    %rax, __xly_globals+88(%rip)
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_7417ac2bbe7257f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_53ad6f67ec9a4d92(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_0b8ebd0da5d48115(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_9a8d083a1565e8a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_4561c118181685cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_45653b1818198af1(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4625478292286210048, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_3e131a1814555b07(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4634204016564240384, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_isPowerOf2
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_dea2c2fb04f51c53(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_dc81f67d84233ea5(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_popcount
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_a455907f17c1b933(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4624633867356078080, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_popcount
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_e51a9f7d88fd1847(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    subq    $16, %rsp
+    movabsq $4640185359819341824, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    call    .Lxly_fn_popcount
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_84a464d41b686d50(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_d53d6b398e0b649b(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_510e8df86302da14(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_4ecb4ca78d5133b2(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+96(%rip)
+    movq    %rax, -104(%rbp)
+    movabsq $4679204828465856512, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+104(%rip)
+    movq    %rax, -112(%rbp)
+    movabsq $4661845738886529024, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+112(%rip)
+    movq    %rax, -120(%rbp)
+    movabsq $4661845738886529024, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+120(%rip)
+    movq    %rax, -128(%rbp)
+    movabsq $4661845738886529024, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4679204828465856512, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, __xly_globals+128(%rip)
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_57475b65a23b9f50(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movabsq $4661845738886529024, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_67ae40b2eba54591(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_fb668609276bd41d(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_e2369ccda48c5fb3(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+136(%rip)
+    movq    %rax, -144(%rbp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+144(%rip)
+    movq    %rax, -152(%rbp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+152(%rip)
+    movq    %rax, -160(%rbp)
+    movabsq $4620693217682128896, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+160(%rip)
+    movq    %rax, -168(%rbp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, __xly_globals+168(%rip)
+    movq    %rax, -176(%rbp)
+    movq    -176(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    movq    -176(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_ae6eb8f7c95d7202(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -176(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_0
+    cmpl    $0, (%rsi)
+    jne     .Lxly_0
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_1
+.Lxly_0:
+    call    xly_neq
+.Lxly_1:
+    movq    %rax, __xly_globals+176(%rip)
+    movq    %rax, -184(%rbp)
+    movq    -176(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4611686018427387904, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_3
+.Lxly_2:
+    call    xly_neq
+.Lxly_3:
+    movq    %rax, __xly_globals+184(%rip)
+    movq    %rax, -192(%rbp)
+    movq    -176(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4616189618054758400, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_4
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_5
+.Lxly_4:
+    call    xly_neq
+.Lxly_5:
+    movq    %rax, __xly_globals+192(%rip)
+    movq    %rax, -200(%rbp)
+    subq    $16, %rsp
+    leaq    .Lxly_str_b60b26f979cf0af6(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_b61528f979d762e1(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_b611aef979d45dbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_555b57c40825eaa7(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_db7171119e5ac911(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_6711753b20e84796(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_a7a5e3fa94a56f21(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_4c9ebe82f7197bca(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_0baf221f28f6a151(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_5d4e39ee0eebe3a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_1c2242ad2fb74cd5(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_3642e2602886fd01(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_extractRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -16(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_extractGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4620693217682128896, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -16(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_extractBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $272, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4643176031446892544, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_makeColor:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $304, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    %rsi, -16(%rbp)
+    movq    %rdx, -24(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4625196817309499392, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -32(%rbp)
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4620693217682128896, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -40(%rbp)
+    movq    -32(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -40(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -24(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_isPowerOf2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $288, %rsp
+    movq    %rdi, -8(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_f4_3
+.Lxly_f4_2:
+    call    xly_eq
+.Lxly_f4_3:
+    movq    %rax, %rdi
+    call    xly_truthy
+    testl   %eax, %eax
+    jz      .Lxly_f4_0
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    jmp     .Lxly_f4_1
+.Lxly_f4_0:
+.Lxly_f4_1:
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    subsd   %xmm1, %xmm0
+    call    xly_num
+    movq    %rax, -16(%rbp)
+    movq    -8(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -16(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -24(%rbp)
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_4
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_f4_5
+.Lxly_f4_4:
+    call    xly_eq
+.Lxly_f4_5:
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_popcount:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $288, %rsp
+    movq    %rdi, -8(%rbp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, -16(%rbp)
+    movq    -8(%rbp), %rax
+    movq    %rax, -24(%rbp)
+.Lxly_f5_0:
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $0, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    movzbl  %al, %edi
+    call    xly_bool
+    jmp     .Lxly_f5_3
+.Lxly_f5_2:
+    call    xly_neq
+.Lxly_f5_3:
+    movq    %rax, %rdi
+    call    xly_truthy
+    testl   %eax, %eax
+    jz      .Lxly_f5_1
+    movq    -16(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    cmpl    $1, (%rdi)
+    je      .Lxly_f5_4
+    cmpl    $1, (%rsi)
+    je      .Lxly_f5_4
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    addsd   %xmm1, %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_5
+.Lxly_f5_4:
+    call    xly_add
+.Lxly_f5_5:
+    movq    %rax, -16(%rbp)
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movabsq $4607182418800017408, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    subsd   %xmm1, %xmm0
+    call    xly_num
+    movq    %rax, -32(%rbp)
+    movq    -24(%rbp), %rax
+    subq    $16, %rsp
+    movq    %rax, (%rsp)
+    movq    -32(%rbp), %rax
+    movq    %rax, %rsi
+    movq    (%rsp), %rdi
+    addq    $16, %rsp
+    movq    %rax, -24(%rbp)
+    jmp     .Lxly_f5_0
+.Lxly_f5_1:
+    movq    -16(%rbp), %rax
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+    call    xly_null
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_toHexDigit:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf6_0_b2
+.Lxly_irf6_0_b1:
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf6_0_k16(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f6_2
+.Lxly_f6_1:
+    call    xly_add
+.Lxly_f6_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf6_0_b2:
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf6_0_k17(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f6_4
+.Lxly_f6_3:
+    call    xly_add
+.Lxly_f6_4:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf6_0_k16:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf6_0_k17:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_toHex:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $240, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movl    $-1, -196(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_irf7_0_k41(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f7_2
+.Lxly_f7_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f7_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf7_0_b2
+.Lxly_irf7_0_b1:
+    leaq    .Lxly_str_4f3d62181e02de9f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf7_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x4030000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, -80(%rbp)
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, -88(%rbp)
+    movq    %rbx, %r15
+    movq    -64(%rbp), %r14
+.Lxly_irf7_0_b4:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf7_0_b6
+.Lxly_irf7_0_b5:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf7_0_b9:
+    movq    %rbx, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf7_0_b11
+.Lxly_irf7_0_b10:
+    movq    %rbx, %xmm0
+    movq    -80(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf7_0_b8
+.Lxly_irf7_0_b11:
+    movq    %rbx, %xmm0
+    movq    -88(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+.Lxly_irf7_0_b8:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -224(%rbp)
+    leaq    -232(%rbp), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_4
+.Lxly_f7_3:
+    call    xly_add
+.Lxly_f7_4:
+    movq    %rax, %rbx
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %rbx, %r14
+    jmp     .Lxly_irf7_0_b4
+.Lxly_irf7_0_b6:
+    leaq    .Lxly_str_07fc5007b4bd8155(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_6
+.Lxly_f7_5:
+    call    xly_add
+.Lxly_f7_6:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf7_0_k41:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_c9fd68879f84222b:
+    .asciz  "=== Hexadecimal Support ==="
+.Lxly_str_9f13ddb68e035cd7:
+    .asciz  "1. Hexadecimal Literals"
+.Lxly_str_f49302de07d437d4:
+    .asciz  "2. Bitwise Operations"
+.Lxly_str_29f11c8b69337654:
+    .asciz  "AND:"
+.Lxly_str_2f978719bf1b9afa:
+    .asciz  "OR:"
+.Lxly_str_2892465c0a4e0d6c:
+    .asciz  "XOR:"
+.Lxly_str_5bd10b2446a43ae4:
+    .asciz  "SHL:"
+.Lxly_str_5bbd0b24469391da:
+    .asciz  "SHR:"
+.Lxly_str_4206182fd21a4ca1:
+    .asciz  "3. RGB Color Manipulation"
+.Lxly_str_53e5b9e99be98e7f:
+    .asciz  "Purple:"
+.Lxly_str_7417ac2bbe7257f2:
+    .asciz  "Red:"
+.Lxly_str_53ad6f67ec9a4d92:
+    .asciz  "Green:"
+.Lxly_str_0b8ebd0da5d48115:
+    .asciz  "Blue:"
+.Lxly_str_9a8d083a1565e8a5:
+    .asciz  "4. Power of 2 Check"
+.Lxly_str_4561c118181685cc:
+    .asciz  "16:"
+.Lxly_str_45653b1818198af1:
+    .asciz  "17:"
+.Lxly_str_3e131a1814555b07:
+    .asciz  "64:"
+.Lxly_str_dea2c2fb04f51c53:
+    .asciz  "5. Count Set Bits"
+.Lxly_str_dc81f67d84233ea5:
+    .asciz  "0xFF:"
+.Lxly_str_a455907f17c1b933:
+    .asciz  "0x0F:"
+.Lxly_str_e51a9f7d88fd1847:
+    .asciz  "0xAA:"
+.Lxly_str_84a464d41b686d50:
+    .asciz  "6. Hex Conversion"
+.Lxly_str_d53d6b398e0b649b:
+    .asciz  "255 in hex"
+.Lxly_str_510e8df86302da14:
+    .asciz  "4096 in hex"
+.Lxly_str_4ecb4ca78d5133b2:
+    .asciz  "7. Bit Masks"
+.Lxly_str_57475b65a23b9f50:
+    .asciz  "Value:"
+.Lxly_str_67ae40b2eba54591:
+    .asciz  "Low byte:"
+.Lxly_str_fb668609276bd41d:
+    .asciz  "High byte:"
+.Lxly_str_e2369ccda48c5fb3:
+    .asciz  "8. Flag Operations"
+.Lxly_str_ae6eb8f7c95d7202:
+    .asciz  "Flags set:"
+.Lxly_str_b60b26f979cf0af6:
+    .asciz  "Has A:"
+.Lxly_str_b61528f979d762e1:
+    .asciz  "Has B:"
+.Lxly_str_b611aef979d45dbc:
+    .asciz  "Has C:"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_555b57c40825eaa7:
+    .asciz  "Hexadecimal features:"
+.Lxly_str_db7171119e5ac911:
+    .asciz  "  \342\200\242 0x prefix literals"
+.Lxly_str_6711753b20e84796:
+    .asciz  "  \342\200\242 Bitwise operations"
+.Lxly_str_a7a5e3fa94a56f21:
+    .asciz  "  \342\200\242 Color manipulation"
+.Lxly_str_4c9ebe82f7197bca:
+    .asciz  "  \342\200\242 Power of 2 checks"
+.Lxly_str_0baf221f28f6a151:
+    .asciz  "  \342\200\242 Bit counting"
+.Lxly_str_5d4e39ee0eebe3a7:
+    .asciz  "  \342\200\242 Flag operations"
+.Lxly_str_1c2242ad2fb74cd5:
+    .asciz  "Compile for 18x speed:"
+.Lxly_str_3642e2602886fd01:
+    .asciz  "  ./xenlyc -O3 hex.xe -o hex"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+.Lxly_str_4f3d62181e02de9f:
+    .asciz  "0x0"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_07fc5007b4bd8155:
+    .asciz  "0x"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   25
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   200
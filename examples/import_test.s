@@ -0,0 +1,708 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $416, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_1133585740502798(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0600aaf749a364c7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_51c7dc3cf57b90f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f4af8dfdfc72c7c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5778611b3558e47e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3b90f0855eebf0c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ce84cf62d7e01e4e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir0_k107(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2abe0c0012c5cc75(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movabsq $0x4070000000000000, %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir0_k108(%rip), %rax
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f9cfd21cf01a63de(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fac1666f2ba04867(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -128(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k109(%rip), %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k110(%rip), %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k111(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $32, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08a94f07b5503577(%rip), %rdi
+    leaq    .Lxly_str_d10152952fb94a7c(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_52faeeaa70398f1e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -184(%rbp)
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_ir0_k112(%rip), %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k113(%rip), %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k114(%rip), %rax
+    movq    %rax, -216(%rbp)
+    subq    $32, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08a94f07b5503577(%rip), %rdi
+    leaq    .Lxly_str_24d97cada2273628(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8fb56400272ba20d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    movabsq $0xc045000000000000, %rax
+    movq    %rax, -240(%rbp)
+    leaq    .Lxly_ir0_k115(%rip), %rax
+    movq    %rax, -248(%rbp)
+    subq    $16, %rsp
+    movq    -248(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08a94f07b5503577(%rip), %rdi
+    leaq    .Lxly_str_4e0f7f18e637a364(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d70336331413cf30(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -272(%rbp)
+    subq    $16, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_826e83195d0d60f0(%rip), %rdi
+    leaq    .Lxly_str_d23bb0589f3278e7(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -264(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a1a37ef7567baa73(%rip), %rdi
+    call    xly_str
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_str_f5f24e28691fb21f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_826e83195d0d60f0(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3ae1c1e08e71e15a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_aa5ad1c324cf001f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -320(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_ea11573f1af59eb5(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    -320(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1edd55d0e6143d84(%rip), %rdi
+    call    xly_str
+    movq    %rax, -336(%rbp)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, -344(%rbp)
+    subq    $16, %rsp
+    movq    -336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -344(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_b432953f4d2b8618(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_465353cedba49735(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_5b9bc4ba528108e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5dead1dd8d446d06(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_95e8e6c083f02c6c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k116(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k117(%rip), %rax
+    movq    %rax, -376(%rbp)
+    leaq    .Lxly_ir0_k118(%rip), %rax
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir0_k119(%rip), %rax
+    movq    %rax, -392(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -384(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -392(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_dd6fbd38986b7842(%rip), %rsi
+    movl    $4, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -400(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c51b083fcc0c5f3b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k120(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k121(%rip), %rax
+    movq    %rax, -408(%rbp)
+    leaq    .Lxly_ir0_k122(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k123(%rip), %rax
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -408(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08a94f07b5503577(%rip), %rdi
+    leaq    .Lxly_str_dd6fbd38986b7842(%rip), %rsi
+    movl    $4, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -416(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -416(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f06898e1107e3236(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k107:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k108:
+    .quad   0, 0x4070000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k109:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k110:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k111:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k112:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k113:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k114:
+    .quad   0, 0x3fe0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k115:
+    .quad   0, 0xc045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k116:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k117:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k118:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k119:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k120:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k121:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k122:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k123:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_1133585740502798:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_0600aaf749a364c7:
+    .asciz  "\342\225\221   Enhanced Import Syntax                 \342\225\221"
+.Lxly_str_51c7dc3cf57b90f0:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_f4af8dfdfc72c7c1:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_5778611b3558e47e:
+    .asciz  "\342\224\202  Regular import                            \342\224\202"
+.Lxly_str_3b90f0855eebf0c1:
+    .asciz  "\342\224\224\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\230"
+.Lxly_str_ce84cf62d7e01e4e:
+    .asciz  "  math.sqrt(16)    ="
+.Lxly_str_2abe0c0012c5cc75:
+    .asciz  "  math.pow(2, 8)   ="
+.Lxly_str_f9cfd21cf01a63de:
+    .asciz  "\342\224\202  Import with alias (import...as)           \342\224\202"
+.Lxly_str_fac1666f2ba04867:
+    .asciz  "  mu.clamp(15, 0, 10)  ="
+.Lxly_str_08a94f07b5503577:
+    .asciz  "mu"
+.Lxly_str_d10152952fb94a7c:
+    .asciz  "clamp"
+.Lxly_str_52faeeaa70398f1e:
+    .asciz  "  mu.lerp(0, 100, 0.5) ="
+.Lxly_str_24d97cada2273628:
+    .asciz  "lerp"
+.Lxly_str_8fb56400272ba20d:
+    .asciz  "  mu.sign(-42)         ="
+.Lxly_str_4e0f7f18e637a364:
+    .asciz  "sign"
+.Lxly_str_d70336331413cf30:
+    .asciz  "  str.upper(\"hello\")  ="
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_826e83195d0d60f0:
+    .asciz  "str"
+.Lxly_str_d23bb0589f3278e7:
+    .asciz  "upper"
+.Lxly_str_a1a37ef7567baa73:
+    .asciz  "  str.len(\"Xenly\")     ="
+.Lxly_str_f5f24e28691fb21f:
+    .asciz  "Xenly"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_3ae1c1e08e71e15a:
+    .asciz  "\342\224\202  Selective import (from...import)          \342\224\202"
+.Lxly_str_aa5ad1c324cf001f:
+    .asciz  "  Vec2(3,4).length()         ="
+.Lxly_str_ea11573f1af59eb5:
+    .asciz  "length"
+.Lxly_str_1edd55d0e6143d84:
+    .asciz  "  Vec2(3,4) instanceof Vec2  ="
+.Lxly_str_b432953f4d2b8618:
+    .asciz  "  Rect(0,0,10,20).area()     ="
+.Lxly_str_89502e843ec2b8c4:
+    .asciz  "area"
+.Lxly_str_465353cedba49735:
+    .asciz  "  Rect instance type         ="
+.Lxly_str_5b9bc4ba528108e4:
+    .asciz  "null"
+.Lxly_str_5dead1dd8d446d06:
+    .asciz  "\342\224\202  Aliases don't replace original names     \342\224\202"
+.Lxly_str_95e8e6c083f02c6c:
+    .asciz  "  mathutils.distance(0,0,3,4) ="
+.Lxly_str_bd45fa4f3e5d1248:
+    .asciz  "mathutils"
+.Lxly_str_dd6fbd38986b7842:
+    .asciz  "distance"
+.Lxly_str_c51b083fcc0c5f3b:
+    .asciz  "  mu.distance(0,0,3,4)        ="
+.Lxly_str_f06898e1107e3236:
+    .asciz  "\342\225\221   All import enhancements working!       \342\225\221"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   2
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   16
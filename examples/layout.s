@@ -0,0 +1,9605 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k11(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_ir0_k12(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_ir0_k13(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_ir0_k14(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k15(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k11:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k12:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k13:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k14:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k15:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_layoutReset:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_layoutSetGap:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_layoutSkip:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_layoutCurRow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_layoutCurCol:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn__pos:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f5_4
+.Lxly_f5_3:
+    call    xly_add
+.Lxly_f5_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f5_6
+.Lxly_f5_5:
+    call    xly_add
+.Lxly_f5_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f5_8
+.Lxly_f5_7:
+    call    xly_add
+.Lxly_f5_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f5_10
+.Lxly_f5_9:
+    call    xly_add
+.Lxly_f5_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_12
+.Lxly_f5_11:
+    call    xly_add
+.Lxly_f5_12:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn__reset:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn__bold:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn__dim:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn__fg:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_2
+.Lxly_f9_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b2
+.Lxly_irf9_0_b1:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b2:
+    leaq    .Lxly_str_89e9be1960f4c21c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_4
+.Lxly_f9_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_4:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b4
+.Lxly_irf9_0_b3:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b4:
+    leaq    .Lxly_str_0f40f029637fecbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_6
+.Lxly_f9_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_6:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b6
+.Lxly_irf9_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b6:
+    leaq    .Lxly_str_8346a574925e75a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_8
+.Lxly_f9_7:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_8:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b8
+.Lxly_irf9_0_b7:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b8:
+    leaq    .Lxly_str_c5ccd29bc2dda64d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_9
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_10
+.Lxly_f9_9:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_10:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b10
+.Lxly_irf9_0_b9:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b10:
+    leaq    .Lxly_str_70ae2e90c1bce27a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_11
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_12
+.Lxly_f9_11:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_12:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b12
+.Lxly_irf9_0_b11:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b12:
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_14
+.Lxly_f9_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_14:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b14
+.Lxly_irf9_0_b13:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b14:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_16
+.Lxly_f9_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_16:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b16
+.Lxly_irf9_0_b15:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b16:
+    leaq    .Lxly_str_bad8e3fe841b9385(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_18
+.Lxly_f9_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_18:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b18
+.Lxly_irf9_0_b17:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b18:
+    leaq    .Lxly_str_11cc5e579bdd2fb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_20
+.Lxly_f9_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_20:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b20
+.Lxly_irf9_0_b19:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b20:
+    leaq    .Lxly_str_fd579007fe8579f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_21
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_22
+.Lxly_f9_21:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_22:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b22
+.Lxly_irf9_0_b21:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b22:
+    leaq    .Lxly_str_57c76bf18badb6d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_23
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_24
+.Lxly_f9_23:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_24:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b24
+.Lxly_irf9_0_b23:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b24:
+    leaq    .Lxly_str_03df73fd4e12ec6d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_25
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_26
+.Lxly_f9_25:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_26:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b26
+.Lxly_irf9_0_b25:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b26:
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_27
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_28
+.Lxly_f9_27:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_28:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b28
+.Lxly_irf9_0_b27:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf9_0_b28:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn__bg:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_2
+.Lxly_f10_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b2
+.Lxly_irf10_0_b1:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b2:
+    leaq    .Lxly_str_89e9be1960f4c21c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_4
+.Lxly_f10_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_4:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b4
+.Lxly_irf10_0_b3:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b4:
+    leaq    .Lxly_str_0f40f029637fecbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_6
+.Lxly_f10_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_6:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b6
+.Lxly_irf10_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b6:
+    leaq    .Lxly_str_8346a574925e75a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_8
+.Lxly_f10_7:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_8:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b8
+.Lxly_irf10_0_b7:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b8:
+    leaq    .Lxly_str_c5ccd29bc2dda64d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_9
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_10
+.Lxly_f10_9:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_10:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b10
+.Lxly_irf10_0_b9:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b10:
+    leaq    .Lxly_str_70ae2e90c1bce27a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_11
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_12
+.Lxly_f10_11:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_12:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b12
+.Lxly_irf10_0_b11:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b12:
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_14
+.Lxly_f10_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_14:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b14
+.Lxly_irf10_0_b13:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b14:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_16
+.Lxly_f10_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_16:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b16
+.Lxly_irf10_0_b15:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf10_0_b16:
+    leaq    .Lxly_str_57c76bf18badb6d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f10_18
+.Lxly_f10_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f10_18:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b18
+.Lxly_irf10_0_b17:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf10_0_b18:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_lvText:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $832, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -788(%rbp)
+    movl    $-1, -660(%rbp)
+    movl    $-1, -532(%rbp)
+    movl    $-1, -404(%rbp)
+    movl    $-1, -276(%rbp)
+    movl    $-1, -148(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r13
+.Lxly_irf11_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f11_2
+.Lxly_f11_1:
+    call    xly_add
+.Lxly_f11_2:
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    jmp     .Lxly_f11_4
+.Lxly_f11_3:
+    call    xly_add
+.Lxly_f11_4:
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -432(%rbp)
+    leaq    -440(%rbp), %rax
+    jmp     .Lxly_f11_6
+.Lxly_f11_5:
+    call    xly_add
+.Lxly_f11_6:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -560(%rbp)
+    leaq    -568(%rbp), %rax
+    jmp     .Lxly_f11_8
+.Lxly_f11_7:
+    call    xly_add
+.Lxly_f11_8:
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -688(%rbp)
+    leaq    -696(%rbp), %rax
+    jmp     .Lxly_f11_10
+.Lxly_f11_9:
+    call    xly_add
+.Lxly_f11_10:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f11_12
+.Lxly_f11_11:
+    call    xly_add
+.Lxly_f11_12:
+    movq    %rax, %r13
+.Lxly_irf11_0_b1:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf11_0_b4:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf11_0_b3:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf11_0_k33(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -816(%rbp)
+    leaq    -824(%rbp), %rax
+    jmp     .Lxly_f11_14
+.Lxly_f11_13:
+    call    xly_add
+.Lxly_f11_14:
+    movq    %rax, %r14
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f11_16
+.Lxly_f11_15:
+    call    xly_add
+.Lxly_f11_16:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf11_0_k33:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvColorText:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $864, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf12_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f12_2
+.Lxly_f12_1:
+    call    xly_add
+.Lxly_f12_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f12_4
+.Lxly_f12_3:
+    call    xly_add
+.Lxly_f12_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f12_6
+.Lxly_f12_5:
+    call    xly_add
+.Lxly_f12_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f12_8
+.Lxly_f12_7:
+    call    xly_add
+.Lxly_f12_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f12_10
+.Lxly_f12_9:
+    call    xly_add
+.Lxly_f12_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f12_12
+.Lxly_f12_11:
+    call    xly_add
+.Lxly_f12_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf12_0_b1:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf12_0_b4:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf12_0_b3:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf12_0_k35(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f12_14
+.Lxly_f12_13:
+    call    xly_add
+.Lxly_f12_14:
+    movq    %rax, %r15
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f12_16
+.Lxly_f12_15:
+    call    xly_add
+.Lxly_f12_16:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf12_0_k35:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvBold:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $832, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -788(%rbp)
+    movl    $-1, -660(%rbp)
+    movl    $-1, -532(%rbp)
+    movl    $-1, -404(%rbp)
+    movl    $-1, -276(%rbp)
+    movl    $-1, -148(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r13
+.Lxly_irf13_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f13_2
+.Lxly_f13_1:
+    call    xly_add
+.Lxly_f13_2:
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    jmp     .Lxly_f13_4
+.Lxly_f13_3:
+    call    xly_add
+.Lxly_f13_4:
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -432(%rbp)
+    leaq    -440(%rbp), %rax
+    jmp     .Lxly_f13_6
+.Lxly_f13_5:
+    call    xly_add
+.Lxly_f13_6:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -560(%rbp)
+    leaq    -568(%rbp), %rax
+    jmp     .Lxly_f13_8
+.Lxly_f13_7:
+    call    xly_add
+.Lxly_f13_8:
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -688(%rbp)
+    leaq    -696(%rbp), %rax
+    jmp     .Lxly_f13_10
+.Lxly_f13_9:
+    call    xly_add
+.Lxly_f13_10:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f13_12
+.Lxly_f13_11:
+    call    xly_add
+.Lxly_f13_12:
+    movq    %rax, %r13
+.Lxly_irf13_0_b1:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf13_0_b4:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf13_0_b3:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf13_0_b6:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf13_0_b5:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf13_0_k39(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -816(%rbp)
+    leaq    -824(%rbp), %rax
+    jmp     .Lxly_f13_14
+.Lxly_f13_13:
+    call    xly_add
+.Lxly_f13_14:
+    movq    %rax, %r14
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f13_16
+.Lxly_f13_15:
+    call    xly_add
+.Lxly_f13_16:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf13_0_k39:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvHeading:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $864, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf14_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f14_2
+.Lxly_f14_1:
+    call    xly_add
+.Lxly_f14_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f14_4
+.Lxly_f14_3:
+    call    xly_add
+.Lxly_f14_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f14_6
+.Lxly_f14_5:
+    call    xly_add
+.Lxly_f14_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f14_8
+.Lxly_f14_7:
+    call    xly_add
+.Lxly_f14_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f14_10
+.Lxly_f14_9:
+    call    xly_add
+.Lxly_f14_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f14_12
+.Lxly_f14_11:
+    call    xly_add
+.Lxly_f14_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf14_0_b1:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf14_0_b4:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf14_0_b3:
+    movq    %r12, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf14_0_b6:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf14_0_b5:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf14_0_k41(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f14_14
+.Lxly_f14_13:
+    call    xly_add
+.Lxly_f14_14:
+    movq    %rax, %r15
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f14_16
+.Lxly_f14_15:
+    call    xly_add
+.Lxly_f14_16:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf14_0_k41:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvDivider:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $880, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movl    $-1, -844(%rbp)
+    movl    $-1, -716(%rbp)
+    movl    $-1, -588(%rbp)
+    movl    $-1, -460(%rbp)
+    movl    $-1, -332(%rbp)
+    movl    $-1, -204(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf15_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -232(%rbp)
+    leaq    -240(%rbp), %rax
+    jmp     .Lxly_f15_2
+.Lxly_f15_1:
+    call    xly_add
+.Lxly_f15_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -360(%rbp)
+    leaq    -368(%rbp), %rax
+    jmp     .Lxly_f15_4
+.Lxly_f15_3:
+    call    xly_add
+.Lxly_f15_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -488(%rbp)
+    leaq    -496(%rbp), %rax
+    jmp     .Lxly_f15_6
+.Lxly_f15_5:
+    call    xly_add
+.Lxly_f15_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -616(%rbp)
+    leaq    -624(%rbp), %rax
+    jmp     .Lxly_f15_8
+.Lxly_f15_7:
+    call    xly_add
+.Lxly_f15_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -744(%rbp)
+    leaq    -752(%rbp), %rax
+    jmp     .Lxly_f15_10
+.Lxly_f15_9:
+    call    xly_add
+.Lxly_f15_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f15_12
+.Lxly_f15_11:
+    call    xly_add
+.Lxly_f15_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf15_0_b4:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -96(%rbp)
+    movq    %r14, %rbx
+    movq    %r15, %r12
+.Lxly_irf15_0_b1:
+    movq    %rbx, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf15_0_b3
+.Lxly_irf15_0_b2:
+    movq    %r12, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f15_14
+.Lxly_f15_13:
+    call    xly_add
+.Lxly_f15_14:
+    movq    %rax, %r14
+    movq    %rbx, %xmm0
+    movq    -96(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %rbx
+    movq    %r14, %r12
+    jmp     .Lxly_irf15_0_b1
+.Lxly_irf15_0_b3:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf15_0_b7:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf15_0_b6:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf15_0_k50(%rip), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -872(%rbp)
+    leaq    -880(%rbp), %rax
+    jmp     .Lxly_f15_16
+.Lxly_f15_15:
+    call    xly_add
+.Lxly_f15_16:
+    movq    %rax, %r15
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f15_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f15_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f15_18
+.Lxly_f15_17:
+    call    xly_add
+.Lxly_f15_18:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf15_0_k50:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvLabel:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $864, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf16_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f16_2
+.Lxly_f16_1:
+    call    xly_add
+.Lxly_f16_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f16_4
+.Lxly_f16_3:
+    call    xly_add
+.Lxly_f16_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f16_6
+.Lxly_f16_5:
+    call    xly_add
+.Lxly_f16_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f16_8
+.Lxly_f16_7:
+    call    xly_add
+.Lxly_f16_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f16_10
+.Lxly_f16_9:
+    call    xly_add
+.Lxly_f16_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f16_12
+.Lxly_f16_11:
+    call    xly_add
+.Lxly_f16_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf16_0_b1:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf16_0_b4:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf16_0_b3:
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+    leaq    .Lxly_str_081e0407b4d9e697(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f16_14
+.Lxly_f16_13:
+    call    xly_add
+.Lxly_f16_14:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf16_0_b6:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf16_0_b5:
+    leaq    .Lxly_str_fd579007fe8579f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf16_0_b8:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf16_0_b7:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf16_0_k53(%rip), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f16_16
+.Lxly_f16_15:
+    call    xly_add
+.Lxly_f16_16:
+    movq    %rax, %r15
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f16_18
+.Lxly_f16_17:
+    call    xly_add
+.Lxly_f16_18:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf16_0_k53:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvProgressBar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1200, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movl    $-1, -1156(%rbp)
+    movl    $-1, -1028(%rbp)
+    movl    $-1, -900(%rbp)
+    movl    $-1, -772(%rbp)
+    movl    $-1, -644(%rbp)
+    movl    $-1, -516(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -72(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %rbx
+.Lxly_irf17_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f17_2
+.Lxly_f17_1:
+    call    xly_add
+.Lxly_f17_2:
+    movq    %rax, -104(%rbp)
+    movq    -96(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f17_4
+.Lxly_f17_3:
+    call    xly_add
+.Lxly_f17_4:
+    movq    %rax, %r12
+    movq    -96(%rbp), %rdi
+    movq    -104(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -544(%rbp)
+    leaq    -552(%rbp), %rax
+    jmp     .Lxly_f17_6
+.Lxly_f17_5:
+    call    xly_add
+.Lxly_f17_6:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    movq    %rbx, %rdi
+    movq    -112(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -672(%rbp)
+    leaq    -680(%rbp), %rax
+    jmp     .Lxly_f17_8
+.Lxly_f17_7:
+    call    xly_add
+.Lxly_f17_8:
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -800(%rbp)
+    leaq    -808(%rbp), %rax
+    jmp     .Lxly_f17_10
+.Lxly_f17_9:
+    call    xly_add
+.Lxly_f17_10:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f17_12
+.Lxly_f17_11:
+    call    xly_add
+.Lxly_f17_12:
+    movq    %rax, -128(%rbp)
+.Lxly_irf17_0_b7:
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    movq    -136(%rbp), %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %rbx
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_11cc5e579bdd2fb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -152(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -160(%rbp)
+    movq    %rbx, %r14
+.Lxly_irf17_0_b1:
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf17_0_b3
+.Lxly_irf17_0_b2:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    -160(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    jmp     .Lxly_irf17_0_b1
+.Lxly_irf17_0_b3:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+    leaq    .Lxly_str_56700b1b88794ba8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    %rbx, %r13
+.Lxly_irf17_0_b4:
+    movq    %r13, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf17_0_b6
+.Lxly_irf17_0_b5:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r13, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r13
+    jmp     .Lxly_irf17_0_b4
+.Lxly_irf17_0_b6:
+    movq    -136(%rbp), %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_fd579007fe8579f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+.Lxly_irf17_0_b10:
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf17_0_b9:
+    movq    -88(%rbp), %xmm0
+    movsd   %xmm0, -928(%rbp)
+    leaq    -936(%rbp), %rax
+    movq    %rax, %r12
+    movq    -96(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1056(%rbp)
+    leaq    -1064(%rbp), %rax
+    jmp     .Lxly_f17_14
+.Lxly_f17_13:
+    call    xly_add
+.Lxly_f17_14:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f17_16
+.Lxly_f17_15:
+    call    xly_add
+.Lxly_f17_16:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf17_0_b12:
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf17_0_b11:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf17_0_k93(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1184(%rbp)
+    leaq    -1192(%rbp), %rax
+    jmp     .Lxly_f17_18
+.Lxly_f17_17:
+    call    xly_add
+.Lxly_f17_18:
+    movq    %rax, %rbx
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f17_20
+.Lxly_f17_19:
+    call    xly_add
+.Lxly_f17_20:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf17_0_k93:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvCheckbox:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $896, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movl    $-1, -852(%rbp)
+    movl    $-1, -724(%rbp)
+    movl    $-1, -596(%rbp)
+    movl    $-1, -468(%rbp)
+    movl    $-1, -340(%rbp)
+    movl    $-1, -212(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf18_0_b6:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -240(%rbp)
+    leaq    -248(%rbp), %rax
+    jmp     .Lxly_f18_2
+.Lxly_f18_1:
+    call    xly_add
+.Lxly_f18_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -368(%rbp)
+    leaq    -376(%rbp), %rax
+    jmp     .Lxly_f18_4
+.Lxly_f18_3:
+    call    xly_add
+.Lxly_f18_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -496(%rbp)
+    leaq    -504(%rbp), %rax
+    jmp     .Lxly_f18_6
+.Lxly_f18_5:
+    call    xly_add
+.Lxly_f18_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -624(%rbp)
+    leaq    -632(%rbp), %rax
+    jmp     .Lxly_f18_8
+.Lxly_f18_7:
+    call    xly_add
+.Lxly_f18_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -752(%rbp)
+    leaq    -760(%rbp), %rax
+    jmp     .Lxly_f18_10
+.Lxly_f18_9:
+    call    xly_add
+.Lxly_f18_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f18_12
+.Lxly_f18_11:
+    call    xly_add
+.Lxly_f18_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf18_0_b5:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf18_0_k69(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f18_14
+.Lxly_f18_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f18_14:
+    movq    %rax, -96(%rbp)
+    cmpq    $0, -96(%rbp)
+    je      .Lxly_irf18_0_b2
+.Lxly_irf18_0_b1:
+    leaq    .Lxly_str_11cc5e579bdd2fb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -104(%rbp)
+.Lxly_irf18_0_b8:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf18_0_b7:
+    leaq    .Lxly_str_3e57f913fe18bbc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+.Lxly_irf18_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf18_0_k70(%rip), %rax
+    movq    %rax, -120(%rbp)
+    movq    %r12, %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f18_16
+.Lxly_f18_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f18_16:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf18_0_b4
+.Lxly_irf18_0_b3:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+    leaq    .Lxly_str_016543663443e82b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf18_0_b4:
+.Lxly_irf18_0_b10:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf18_0_b9:
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf18_0_b12:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf18_0_b11:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf18_0_k71(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -880(%rbp)
+    leaq    -888(%rbp), %rax
+    jmp     .Lxly_f18_18
+.Lxly_f18_17:
+    call    xly_add
+.Lxly_f18_18:
+    movq    %rax, %r13
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f18_20
+.Lxly_f18_19:
+    call    xly_add
+.Lxly_f18_20:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf18_0_k69:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf18_0_k70:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf18_0_k71:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvButton:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1024, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movl    $-1, -980(%rbp)
+    movl    $-1, -852(%rbp)
+    movl    $-1, -724(%rbp)
+    movl    $-1, -596(%rbp)
+    movl    $-1, -468(%rbp)
+    movl    $-1, -340(%rbp)
+    movl    $-1, -212(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf19_0_b6:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -240(%rbp)
+    leaq    -248(%rbp), %rax
+    jmp     .Lxly_f19_2
+.Lxly_f19_1:
+    call    xly_add
+.Lxly_f19_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -368(%rbp)
+    leaq    -376(%rbp), %rax
+    jmp     .Lxly_f19_4
+.Lxly_f19_3:
+    call    xly_add
+.Lxly_f19_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -496(%rbp)
+    leaq    -504(%rbp), %rax
+    jmp     .Lxly_f19_6
+.Lxly_f19_5:
+    call    xly_add
+.Lxly_f19_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -624(%rbp)
+    leaq    -632(%rbp), %rax
+    jmp     .Lxly_f19_8
+.Lxly_f19_7:
+    call    xly_add
+.Lxly_f19_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -752(%rbp)
+    leaq    -760(%rbp), %rax
+    jmp     .Lxly_f19_10
+.Lxly_f19_9:
+    call    xly_add
+.Lxly_f19_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_12
+.Lxly_f19_11:
+    call    xly_add
+.Lxly_f19_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf19_0_b5:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf19_0_k65(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f19_14
+.Lxly_f19_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f19_14:
+    movq    %rax, -96(%rbp)
+    cmpq    $0, -96(%rbp)
+    je      .Lxly_irf19_0_b2
+.Lxly_irf19_0_b1:
+    leaq    .Lxly_str_0f40f029637fecbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -112(%rbp)
+.Lxly_irf19_0_b8:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf19_0_b7:
+.Lxly_irf19_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf19_0_k66(%rip), %rax
+    movq    %rax, -120(%rbp)
+    movq    %r12, %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f19_16
+.Lxly_f19_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f19_16:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf19_0_b4
+.Lxly_irf19_0_b3:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r12
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf19_0_b4:
+    leaq    .Lxly_str_09611e07b5ec9f8e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -880(%rbp)
+    leaq    -888(%rbp), %rax
+    jmp     .Lxly_f19_18
+.Lxly_f19_17:
+    call    xly_add
+.Lxly_f19_18:
+    movq    %rax, %r12
+    leaq    .Lxly_str_07c56b07b48e6cc6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_20
+.Lxly_f19_19:
+    call    xly_add
+.Lxly_f19_20:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf19_0_b10:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf19_0_b9:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf19_0_k67(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1008(%rbp)
+    leaq    -1016(%rbp), %rax
+    jmp     .Lxly_f19_22
+.Lxly_f19_21:
+    call    xly_add
+.Lxly_f19_22:
+    movq    %rax, %r13
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_24
+.Lxly_f19_23:
+    call    xly_add
+.Lxly_f19_24:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf19_0_k65:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf19_0_k66:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf19_0_k67:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvBadge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $992, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -948(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf20_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f20_2
+.Lxly_f20_1:
+    call    xly_add
+.Lxly_f20_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f20_4
+.Lxly_f20_3:
+    call    xly_add
+.Lxly_f20_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f20_6
+.Lxly_f20_5:
+    call    xly_add
+.Lxly_f20_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f20_8
+.Lxly_f20_7:
+    call    xly_add
+.Lxly_f20_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f20_10
+.Lxly_f20_9:
+    call    xly_add
+.Lxly_f20_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f20_12
+.Lxly_f20_11:
+    call    xly_add
+.Lxly_f20_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf20_0_b9:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f20_14
+.Lxly_f20_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f20_14:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf20_0_b2
+.Lxly_irf20_0_b1:
+    leaq    .Lxly_str_0f40f029637fecbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf20_0_b12:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf20_0_b11:
+.Lxly_irf20_0_b2:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f20_16
+.Lxly_f20_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f20_16:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf20_0_b4
+.Lxly_irf20_0_b3:
+    leaq    .Lxly_str_89e9be1960f4c21c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r14
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+.Lxly_irf20_0_b14:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf20_0_b13:
+.Lxly_irf20_0_b4:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f20_18
+.Lxly_f20_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f20_18:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf20_0_b6
+.Lxly_irf20_0_b5:
+    leaq    .Lxly_str_8346a574925e75a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf20_0_b16:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf20_0_b15:
+.Lxly_irf20_0_b6:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f20_20
+.Lxly_f20_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f20_20:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf20_0_b8
+.Lxly_irf20_0_b7:
+    leaq    .Lxly_str_c5ccd29bc2dda64d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf20_0_b18:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf20_0_b17:
+.Lxly_irf20_0_b8:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f20_22
+.Lxly_f20_21:
+    call    xly_add
+.Lxly_f20_22:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f20_24
+.Lxly_f20_23:
+    call    xly_add
+.Lxly_f20_24:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf20_0_b20:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf20_0_b19:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf20_0_k105(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -976(%rbp)
+    leaq    -984(%rbp), %rax
+    jmp     .Lxly_f20_26
+.Lxly_f20_25:
+    call    xly_add
+.Lxly_f20_26:
+    movq    %rax, %r15
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f20_28
+.Lxly_f20_27:
+    call    xly_add
+.Lxly_f20_28:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf20_0_k105:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvNotify:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $864, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf21_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f21_2
+.Lxly_f21_1:
+    call    xly_add
+.Lxly_f21_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f21_4
+.Lxly_f21_3:
+    call    xly_add
+.Lxly_f21_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f21_6
+.Lxly_f21_5:
+    call    xly_add
+.Lxly_f21_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f21_8
+.Lxly_f21_7:
+    call    xly_add
+.Lxly_f21_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f21_10
+.Lxly_f21_9:
+    call    xly_add
+.Lxly_f21_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f21_12
+.Lxly_f21_11:
+    call    xly_add
+.Lxly_f21_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf21_0_b9:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_14
+.Lxly_f21_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_14:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf21_0_b2
+.Lxly_irf21_0_b1:
+    leaq    .Lxly_str_11cc5e579bdd2fb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+.Lxly_irf21_0_b12:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf21_0_b11:
+    leaq    .Lxly_str_54b2a19081417685(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b2:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_16
+.Lxly_f21_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_16:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf21_0_b4
+.Lxly_irf21_0_b3:
+    leaq    .Lxly_str_bad8e3fe841b9385(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf21_0_b14:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b13:
+    leaq    .Lxly_str_4438eb907829d6af(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf21_0_b4:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_18
+.Lxly_f21_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_18:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf21_0_b6
+.Lxly_irf21_0_b5:
+    leaq    .Lxly_str_03df73fd4e12ec6d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+.Lxly_irf21_0_b16:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf21_0_b15:
+    leaq    .Lxly_str_dbbcd1c430a9b98e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b6:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_20
+.Lxly_f21_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_20:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf21_0_b8
+.Lxly_irf21_0_b7:
+    leaq    .Lxly_str_fd579007fe8579f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+.Lxly_irf21_0_b18:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf21_0_b17:
+    leaq    .Lxly_str_e838cdbe7664fc4f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b8:
+.Lxly_irf21_0_b20:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b19:
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf21_0_b22:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf21_0_b21:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf21_0_k109(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f21_22
+.Lxly_f21_21:
+    call    xly_add
+.Lxly_f21_22:
+    movq    %rax, %r15
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f21_24
+.Lxly_f21_23:
+    call    xly_add
+.Lxly_f21_24:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf21_0_k109:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvInput:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1056, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, %r14
+    xorl    %eax, %eax
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movl    $-1, -1012(%rbp)
+    movl    $-1, -884(%rbp)
+    movl    $-1, -756(%rbp)
+    movl    $-1, -628(%rbp)
+    movl    $-1, -500(%rbp)
+    movl    $-1, -372(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r15
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -80(%rbp)
+.Lxly_irf22_0_b11:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -400(%rbp)
+    leaq    -408(%rbp), %rax
+    jmp     .Lxly_f22_2
+.Lxly_f22_1:
+    call    xly_add
+.Lxly_f22_2:
+    movq    %rax, -96(%rbp)
+    movq    -88(%rbp), %rdi
+    movq    -80(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -528(%rbp)
+    leaq    -536(%rbp), %rax
+    jmp     .Lxly_f22_4
+.Lxly_f22_3:
+    call    xly_add
+.Lxly_f22_4:
+    movq    %rax, %r15
+    movq    -88(%rbp), %rdi
+    movq    -96(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -656(%rbp)
+    leaq    -664(%rbp), %rax
+    jmp     .Lxly_f22_6
+.Lxly_f22_5:
+    call    xly_add
+.Lxly_f22_6:
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    movq    -104(%rbp), %rdi
+    movq    -112(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -784(%rbp)
+    leaq    -792(%rbp), %rax
+    jmp     .Lxly_f22_8
+.Lxly_f22_7:
+    call    xly_add
+.Lxly_f22_8:
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -912(%rbp)
+    leaq    -920(%rbp), %rax
+    jmp     .Lxly_f22_10
+.Lxly_f22_9:
+    call    xly_add
+.Lxly_f22_10:
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    -128(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_12
+.Lxly_f22_11:
+    call    xly_add
+.Lxly_f22_12:
+    movq    %rax, -136(%rbp)
+.Lxly_irf22_0_b10:
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf22_0_b13:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf22_0_b12:
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    movq    %rbx, %rdi
+    movq    -152(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_14
+.Lxly_f22_13:
+    call    xly_add
+.Lxly_f22_14:
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf22_0_b15:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf22_0_b14:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_irf22_0_k108(%rip), %rax
+    movq    %rax, -176(%rbp)
+    movq    %r14, %rdi
+    movq    -176(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f22_16
+.Lxly_f22_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f22_16:
+    movq    %rax, -184(%rbp)
+    cmpq    $0, -184(%rbp)
+    je      .Lxly_irf22_0_b2
+.Lxly_irf22_0_b1:
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    movq    -192(%rbp), %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    movq    -208(%rbp), %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -216(%rbp)
+.Lxly_irf22_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_irf22_0_k109(%rip), %rax
+    movq    %rax, -232(%rbp)
+    movq    %r14, %rdi
+    movq    -232(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f22_18
+.Lxly_f22_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f22_18:
+    movq    %rax, -240(%rbp)
+    cmpq    $0, -240(%rbp)
+    je      .Lxly_irf22_0_b4
+.Lxly_irf22_0_b3:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -256(%rbp)
+.Lxly_irf22_0_b4:
+    movq    -152(%rbp), %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_20
+.Lxly_f22_19:
+    call    xly_add
+.Lxly_f22_20:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+    movq    -264(%rbp), %r13
+    movq    %r14, %r12
+.Lxly_irf22_0_b5:
+    movq    %r13, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_21
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f22_22
+.Lxly_f22_21:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f22_22:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf22_0_b7
+.Lxly_irf22_0_b6:
+    movq    %r12, %rdi
+    movq    -152(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_24
+.Lxly_f22_23:
+    call    xly_add
+.Lxly_f22_24:
+    movq    %rax, %r14
+    leaq    .Lxly_irf22_0_k110(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_26
+.Lxly_f22_25:
+    call    xly_add
+.Lxly_f22_26:
+    movq    %rax, %r15
+    movq    %r15, %r13
+    movq    %r14, %r12
+    jmp     .Lxly_irf22_0_b5
+.Lxly_irf22_0_b7:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    cmpq    $0, -184(%rbp)
+    je      .Lxly_irf22_0_b9
+.Lxly_irf22_0_b8:
+.Lxly_irf22_0_b17:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf22_0_b16:
+    leaq    .Lxly_str_c5ccd29bc2dda64d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf22_0_b9:
+.Lxly_irf22_0_b19:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf22_0_b18:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf22_0_k111(%rip), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1040(%rbp)
+    leaq    -1048(%rbp), %rax
+    jmp     .Lxly_f22_28
+.Lxly_f22_27:
+    call    xly_add
+.Lxly_f22_28:
+    movq    %rax, %rbx
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_30
+.Lxly_f22_29:
+    call    xly_add
+.Lxly_f22_30:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf22_0_k108:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf22_0_k109:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf22_0_k110:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf22_0_k111:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvSparkline:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1184, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movl    $-1, -1148(%rbp)
+    movl    $-1, -1020(%rbp)
+    movl    $-1, -892(%rbp)
+    movl    $-1, -764(%rbp)
+    movl    $-1, -636(%rbp)
+    movl    $-1, -508(%rbp)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf23_0_k80(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_str_566ffb1b88793078(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_irf23_0_k81(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -72(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_str_566ffe1b88793591(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_irf23_0_k82(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -104(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_str_566ffd1b887933de(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_irf23_0_k83(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -136(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_5670001b887938f7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_irf23_0_k84(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -168(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_str_566fff1b88793744(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_irf23_0_k85(%rip), %rax
+    movq    %rax, -192(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -200(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_str_5670021b88793c5d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_irf23_0_k86(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -232(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -240(%rbp)
+    leaq    .Lxly_str_5670011b88793aaa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_irf23_0_k87(%rip), %rax
+    movq    %rax, -256(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -264(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    leaq    .Lxly_irf23_0_k88(%rip), %rax
+    movq    %rax, -288(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -288(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -296(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -304(%rbp)
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -312(%rbp)
+.Lxly_irf23_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %rdi
+    movq    -304(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -536(%rbp)
+    leaq    -544(%rbp), %rax
+    jmp     .Lxly_f23_2
+.Lxly_f23_1:
+    call    xly_add
+.Lxly_f23_2:
+    movq    %rax, -328(%rbp)
+    movq    -320(%rbp), %rdi
+    movq    -312(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -664(%rbp)
+    leaq    -672(%rbp), %rax
+    jmp     .Lxly_f23_4
+.Lxly_f23_3:
+    call    xly_add
+.Lxly_f23_4:
+    movq    %rax, -336(%rbp)
+    movq    -320(%rbp), %rdi
+    movq    -328(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -792(%rbp)
+    leaq    -800(%rbp), %rax
+    jmp     .Lxly_f23_6
+.Lxly_f23_5:
+    call    xly_add
+.Lxly_f23_6:
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    movq    -344(%rbp), %rdi
+    movq    -352(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -920(%rbp)
+    leaq    -928(%rbp), %rax
+    jmp     .Lxly_f23_8
+.Lxly_f23_7:
+    call    xly_add
+.Lxly_f23_8:
+    movq    %rax, -360(%rbp)
+    movq    -360(%rbp), %rdi
+    movq    -336(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1048(%rbp)
+    leaq    -1056(%rbp), %rax
+    jmp     .Lxly_f23_10
+.Lxly_f23_9:
+    call    xly_add
+.Lxly_f23_10:
+    movq    %rax, -368(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, -376(%rbp)
+    movq    -368(%rbp), %rdi
+    movq    -376(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f23_12
+.Lxly_f23_11:
+    call    xly_add
+.Lxly_f23_12:
+    movq    %rax, -384(%rbp)
+.Lxly_irf23_0_b4:
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -392(%rbp)
+    leaq    .Lxly_str_11cc5e579bdd2fb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -400(%rbp)
+    movq    -400(%rbp), %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -408(%rbp)
+    movq    %r14, %r12
+.Lxly_irf23_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf23_0_b3
+.Lxly_irf23_0_b2:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    -272(%rbp), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    movq    -56(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    -80(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    jmp     .Lxly_irf23_0_b1
+.Lxly_irf23_0_b3:
+.Lxly_irf23_0_b7:
+    subq    $16, %rsp
+    movq    -320(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf23_0_b6:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf23_0_k91(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1176(%rbp)
+    leaq    -1184(%rbp), %rax
+    jmp     .Lxly_f23_14
+.Lxly_f23_13:
+    call    xly_add
+.Lxly_f23_14:
+    movq    %rax, %r14
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f23_16
+.Lxly_f23_15:
+    call    xly_add
+.Lxly_f23_16:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf23_0_k80:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k81:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k82:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k83:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k84:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k85:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k86:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k87:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k88:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf23_0_k91:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvHBegin:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_lvHText:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $864, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+24(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf25_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f25_2
+.Lxly_f25_1:
+    call    xly_add
+.Lxly_f25_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f25_4
+.Lxly_f25_3:
+    call    xly_add
+.Lxly_f25_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f25_6
+.Lxly_f25_5:
+    call    xly_add
+.Lxly_f25_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f25_8
+.Lxly_f25_7:
+    call    xly_add
+.Lxly_f25_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f25_10
+.Lxly_f25_9:
+    call    xly_add
+.Lxly_f25_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_12
+.Lxly_f25_11:
+    call    xly_add
+.Lxly_f25_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf25_0_b1:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf25_0_b4:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf25_0_b3:
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f25_14
+.Lxly_f25_13:
+    call    xly_add
+.Lxly_f25_14:
+    movq    %rax, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf25_0_k35(%rip), %rax
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_16
+.Lxly_f25_15:
+    call    xly_add
+.Lxly_f25_16:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf25_0_k35:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvHBadge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $992, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -948(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+24(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf26_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f26_2
+.Lxly_f26_1:
+    call    xly_add
+.Lxly_f26_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f26_4
+.Lxly_f26_3:
+    call    xly_add
+.Lxly_f26_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f26_6
+.Lxly_f26_5:
+    call    xly_add
+.Lxly_f26_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f26_8
+.Lxly_f26_7:
+    call    xly_add
+.Lxly_f26_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f26_10
+.Lxly_f26_9:
+    call    xly_add
+.Lxly_f26_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f26_12
+.Lxly_f26_11:
+    call    xly_add
+.Lxly_f26_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf26_0_b9:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f26_14
+.Lxly_f26_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f26_14:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf26_0_b2
+.Lxly_irf26_0_b1:
+    leaq    .Lxly_str_0f40f029637fecbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf26_0_b12:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b11:
+.Lxly_irf26_0_b2:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f26_16
+.Lxly_f26_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f26_16:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf26_0_b4
+.Lxly_irf26_0_b3:
+    leaq    .Lxly_str_89e9be1960f4c21c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r14
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+.Lxly_irf26_0_b14:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf26_0_b13:
+.Lxly_irf26_0_b4:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f26_18
+.Lxly_f26_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f26_18:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf26_0_b6
+.Lxly_irf26_0_b5:
+    leaq    .Lxly_str_8346a574925e75a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf26_0_b16:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b15:
+.Lxly_irf26_0_b6:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f26_20
+.Lxly_f26_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f26_20:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf26_0_b8
+.Lxly_irf26_0_b7:
+    leaq    .Lxly_str_c5ccd29bc2dda64d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf26_0_b18:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b17:
+.Lxly_irf26_0_b8:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f26_22
+.Lxly_f26_21:
+    call    xly_add
+.Lxly_f26_22:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f26_24
+.Lxly_f26_23:
+    call    xly_add
+.Lxly_f26_24:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf26_0_b20:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf26_0_b19:
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -976(%rbp)
+    leaq    -984(%rbp), %rax
+    jmp     .Lxly_f26_26
+.Lxly_f26_25:
+    call    xly_add
+.Lxly_f26_26:
+    movq    %rax, %rbx
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf26_0_k105(%rip), %rax
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f26_28
+.Lxly_f26_27:
+    call    xly_add
+.Lxly_f26_28:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf26_0_k105:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvHButton:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $992, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -948(%rbp)
+    movl    $-1, -820(%rbp)
+    movl    $-1, -692(%rbp)
+    movl    $-1, -564(%rbp)
+    movl    $-1, -436(%rbp)
+    movl    $-1, -308(%rbp)
+    movl    $-1, -180(%rbp)
+    movq    __xly_globals+24(%rip), %rax
+    movq    %rax, %r13
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r14
+.Lxly_irf27_0_b6:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    jmp     .Lxly_f27_2
+.Lxly_f27_1:
+    call    xly_add
+.Lxly_f27_2:
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -336(%rbp)
+    leaq    -344(%rbp), %rax
+    jmp     .Lxly_f27_4
+.Lxly_f27_3:
+    call    xly_add
+.Lxly_f27_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -464(%rbp)
+    leaq    -472(%rbp), %rax
+    jmp     .Lxly_f27_6
+.Lxly_f27_5:
+    call    xly_add
+.Lxly_f27_6:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r14, %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -592(%rbp)
+    leaq    -600(%rbp), %rax
+    jmp     .Lxly_f27_8
+.Lxly_f27_7:
+    call    xly_add
+.Lxly_f27_8:
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -720(%rbp)
+    leaq    -728(%rbp), %rax
+    jmp     .Lxly_f27_10
+.Lxly_f27_9:
+    call    xly_add
+.Lxly_f27_10:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_12
+.Lxly_f27_11:
+    call    xly_add
+.Lxly_f27_12:
+    movq    %rax, -88(%rbp)
+.Lxly_irf27_0_b5:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf27_0_k65(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_14
+.Lxly_f27_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_14:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf27_0_b2
+.Lxly_irf27_0_b1:
+    leaq    .Lxly_str_0f40f029637fecbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r14
+    leaq    .Lxly_str_4b5dd0abbc6fc1e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+.Lxly_irf27_0_b8:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf27_0_b7:
+.Lxly_irf27_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf27_0_k66(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_16
+.Lxly_f27_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_16:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf27_0_b4
+.Lxly_irf27_0_b3:
+    leaq    .Lxly_str_3e64ec7093cb8299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn__bg
+    movq    %rax, %r13
+    leaq    .Lxly_str_ced973885856e206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r14
+.Lxly_irf27_0_b4:
+    leaq    .Lxly_str_09611e07b5ec9f8e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_f27_18
+.Lxly_f27_17:
+    call    xly_add
+.Lxly_f27_18:
+    movq    %rax, %r13
+    leaq    .Lxly_str_07c56b07b48e6cc6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_20
+.Lxly_f27_19:
+    call    xly_add
+.Lxly_f27_20:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b10:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b9:
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -976(%rbp)
+    leaq    -984(%rbp), %rax
+    jmp     .Lxly_f27_22
+.Lxly_f27_21:
+    call    xly_add
+.Lxly_f27_22:
+    movq    %rax, %rbx
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf27_0_k67(%rip), %rax
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_24
+.Lxly_f27_23:
+    call    xly_add
+.Lxly_f27_24:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf27_0_k65:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k66:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k67:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvHEnd:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movq    %rax, -32(%rbp)
+    movl    $-1, -116(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf28_0_k8(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -144(%rbp)
+    leaq    -152(%rbp), %rax
+    jmp     .Lxly_f28_2
+.Lxly_f28_1:
+    call    xly_add
+.Lxly_f28_2:
+    movq    %rax, %r12
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_4
+.Lxly_f28_3:
+    call    xly_add
+.Lxly_f28_4:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf28_0_k8:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvPanelBegin:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $816, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movl    $-1, -780(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -64(%rbp)
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    -64(%rbp), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r14, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    -64(%rbp), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    movq    -64(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -72(%rbp)
+.Lxly_irf29_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f29_2
+.Lxly_f29_1:
+    call    xly_add
+.Lxly_f29_2:
+    movq    %rax, -88(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f29_4
+.Lxly_f29_3:
+    call    xly_add
+.Lxly_f29_4:
+    movq    %rax, %rbx
+    movq    -80(%rbp), %rdi
+    movq    -88(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f29_6
+.Lxly_f29_5:
+    call    xly_add
+.Lxly_f29_6:
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    movq    -96(%rbp), %rdi
+    movq    -104(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f29_8
+.Lxly_f29_7:
+    call    xly_add
+.Lxly_f29_8:
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -808(%rbp)
+    leaq    -816(%rbp), %rax
+    jmp     .Lxly_f29_10
+.Lxly_f29_9:
+    call    xly_add
+.Lxly_f29_10:
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    -120(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f29_12
+.Lxly_f29_11:
+    call    xly_add
+.Lxly_f29_12:
+    movq    %rax, -128(%rbp)
+.Lxly_irf29_0_b7:
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_70ae2e90c1bce27a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    movq    -136(%rbp), %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_5665be1b8870744c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %r14
+.Lxly_irf29_0_b1:
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf29_0_b3
+.Lxly_irf29_0_b2:
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r14
+    jmp     .Lxly_irf29_0_b1
+.Lxly_irf29_0_b3:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf29_0_b10:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf29_0_b9:
+    leaq    .Lxly_str_b5ebc3323f57d7fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b12:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b11:
+    movq    -136(%rbp), %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    %rbx, %r12
+.Lxly_irf29_0_b4:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf29_0_b6
+.Lxly_irf29_0_b5:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r12
+    jmp     .Lxly_irf29_0_b4
+.Lxly_irf29_0_b6:
+    leaq    .Lxly_str_5665c11b88707965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b14:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b13:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf29_0_k95(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f29_14
+.Lxly_f29_13:
+    call    xly_add
+.Lxly_f29_14:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf29_0_k96(%rip), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f29_16
+.Lxly_f29_15:
+    call    xly_add
+.Lxly_f29_16:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf29_0_k95:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf29_0_k96:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lvPanelEnd:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $848, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movl    $-1, -812(%rbp)
+    movl    $-1, -684(%rbp)
+    movl    $-1, -556(%rbp)
+    movl    $-1, -428(%rbp)
+    movl    $-1, -300(%rbp)
+    movl    $-1, -172(%rbp)
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r12
+.Lxly_irf30_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -200(%rbp)
+    leaq    -208(%rbp), %rax
+    jmp     .Lxly_f30_2
+.Lxly_f30_1:
+    call    xly_add
+.Lxly_f30_2:
+    movq    %rax, %r15
+    movq    -64(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -328(%rbp)
+    leaq    -336(%rbp), %rax
+    jmp     .Lxly_f30_4
+.Lxly_f30_3:
+    call    xly_add
+.Lxly_f30_4:
+    movq    %rax, %rbx
+    movq    -64(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -456(%rbp)
+    leaq    -464(%rbp), %rax
+    jmp     .Lxly_f30_6
+.Lxly_f30_5:
+    call    xly_add
+.Lxly_f30_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -584(%rbp)
+    leaq    -592(%rbp), %rax
+    jmp     .Lxly_f30_8
+.Lxly_f30_7:
+    call    xly_add
+.Lxly_f30_8:
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -712(%rbp)
+    leaq    -720(%rbp), %rax
+    jmp     .Lxly_f30_10
+.Lxly_f30_9:
+    call    xly_add
+.Lxly_f30_10:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f30_12
+.Lxly_f30_11:
+    call    xly_add
+.Lxly_f30_12:
+    movq    %rax, %r12
+.Lxly_irf30_0_b4:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_70ae2e90c1bce27a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn__fg
+    movq    %rax, %r12
+    leaq    .Lxly_str_5665c41b88707e7e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movq    %rbx, %r14
+.Lxly_irf30_0_b1:
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf30_0_b3
+.Lxly_irf30_0_b2:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    jmp     .Lxly_irf30_0_b1
+.Lxly_irf30_0_b3:
+    leaq    .Lxly_str_5665c71b88708397(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf30_0_b7:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf30_0_b6:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf30_0_k54(%rip), %rax
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -840(%rbp)
+    leaq    -848(%rbp), %rax
+    jmp     .Lxly_f30_14
+.Lxly_f30_13:
+    call    xly_add
+.Lxly_f30_14:
+    movq    %rax, %r14
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f30_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f30_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f30_16
+.Lxly_f30_15:
+    call    xly_add
+.Lxly_f30_16:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf30_0_k54:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_af63b64c8601abfa:
+    .asciz  ";"
+.Lxly_str_af64054c86023237:
+    .asciz  "H"
+.Lxly_str_08b73907b55c4d71:
+    .asciz  "io"
+.Lxly_str_b93a12b0d06caefc:
+    .asciz  "write"
+.Lxly_str_4b5dd0abbc6fc1e4:
+    .asciz  "black"
+.Lxly_str_89e9be1960f4c21c:
+    .asciz  "red"
+.Lxly_str_0f40f029637fecbc:
+    .asciz  "green"
+.Lxly_str_8346a574925e75a9:
+    .asciz  "yellow"
+.Lxly_str_c5ccd29bc2dda64d:
+    .asciz  "blue"
+.Lxly_str_70ae2e90c1bce27a:
+    .asciz  "cyan"
+.Lxly_str_ced973885856e206:
+    .asciz  "white"
+.Lxly_str_3e64ec7093cb8299:
+    .asciz  "bright_black"
+.Lxly_str_bad8e3fe841b9385:
+    .asciz  "bright_red"
+.Lxly_str_11cc5e579bdd2fb9:
+    .asciz  "bright_green"
+.Lxly_str_fd579007fe8579f6:
+    .asciz  "bright_yellow"
+.Lxly_str_57c76bf18badb6d6:
+    .asciz  "bright_blue"
+.Lxly_str_03df73fd4e12ec6d:
+    .asciz  "bright_cyan"
+.Lxly_str_b5ebc3323f57d7fb:
+    .asciz  "bright_white"
+.Lxly_str_081e0407b4d9e697:
+    .asciz  ": "
+.Lxly_str_af64164c86024f1a:
+    .asciz  "["
+.Lxly_str_566ff41b88792493:
+    .asciz  "\342\226\210"
+.Lxly_str_56700b1b88794ba8:
+    .asciz  "\342\226\221"
+.Lxly_str_094c7a07b5dadfd8:
+    .asciz  "] "
+.Lxly_str_af63984c86017900:
+    .asciz  "%"
+.Lxly_str_3e57f913fe18bbc0:
+    .asciz  "[\342\234\223] "
+.Lxly_str_016543663443e82b:
+    .asciz  "[ ] "
+.Lxly_str_09611e07b5ec9f8e:
+    .asciz  "[ "
+.Lxly_str_07c56b07b48e6cc6:
+    .asciz  " ]"
+.Lxly_str_19fe06e3408e53d0:
+    .asciz  "success"
+.Lxly_str_9f7452dd75d54d31:
+    .asciz  "error"
+.Lxly_str_5e39a0f62bea2e31:
+    .asciz  "warn"
+.Lxly_str_f5d6a8c57ab94f05:
+    .asciz  "info"
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_54b2a19081417685:
+    .asciz  "\342\234\224  "
+.Lxly_str_4438eb907829d6af:
+    .asciz  "\342\234\226  "
+.Lxly_str_dbbcd1c430a9b98e:
+    .asciz  "\342\204\271  "
+.Lxly_str_e838cdbe7664fc4f:
+    .asciz  "\342\232\240  "
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_f74e5feadea773fd:
+    .asciz  "create"
+.Lxly_str_566ffb1b88793078:
+    .asciz  "\342\226\201"
+.Lxly_str_823b87195ce20e23:
+    .asciz  "set"
+.Lxly_str_566ffe1b88793591:
+    .asciz  "\342\226\202"
+.Lxly_str_566ffd1b887933de:
+    .asciz  "\342\226\203"
+.Lxly_str_5670001b887938f7:
+    .asciz  "\342\226\204"
+.Lxly_str_566fff1b88793744:
+    .asciz  "\342\226\205"
+.Lxly_str_5670021b88793c5d:
+    .asciz  "\342\226\206"
+.Lxly_str_5670011b88793aaa:
+    .asciz  "\342\226\207"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_5665be1b8870744c:
+    .asciz  "\342\225\224"
+.Lxly_str_5665ba1b88706d80:
+    .asciz  "\342\225\220"
+.Lxly_str_5665c11b88707965:
+    .asciz  "\342\225\227"
+.Lxly_str_5665c41b88707e7e:
+    .asciz  "\342\225\232"
+.Lxly_str_5665c71b88708397:
+    .asciz  "\342\225\235"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   5
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   40
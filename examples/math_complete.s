@@ -0,0 +1,2892 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $2608, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -2608(%rbp)
+    movq    %rax, -2600(%rbp)
+    movq    %rax, -2592(%rbp)
+    movq    %rax, -2584(%rbp)
+    movq    %rax, -2576(%rbp)
+    movq    %rax, -2568(%rbp)
+    movq    %rax, -2560(%rbp)
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movl    $-1, -2572(%rbp)
+    movl    $-1, -2444(%rbp)
+    movl    $-1, -2316(%rbp)
+    movl    $-1, -2188(%rbp)
+    movl    $-1, -2060(%rbp)
+    movl    $-1, -1932(%rbp)
+    movl    $-1, -1804(%rbp)
+    movl    $-1, -1676(%rbp)
+    movl    $-1, -1548(%rbp)
+    movl    $-1, -1420(%rbp)
+    movl    $-1, -1292(%rbp)
+    movl    $-1, -1164(%rbp)
+    leaq    .Lxly_str_8a304ad16d1431e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_85a1d831206f7d38(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k409(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x4005bf0a8b145769, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k410(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x401d8e64b8d4ddae, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k411(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_37efa4d32d7b6033(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k412(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_409253d3325d988c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k413(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4a1c7ed33804d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k414(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_bfce0f3ad8249034(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b2:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k415(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k416(%rip), %rax
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_pow
+    addq    $16, %rsp
+    movq    %rax, -56(%rbp)
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7ae95fe976fa867f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k417(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k418(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x40026bb1bbb55516, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k419(%rip), %rax
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_70b4205a7065d05d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir0_k420(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f3930c5998862629(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k421(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_99ea67acd0d5db19(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_ir0_k422(%rip), %rax
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k423(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_ir0_k424(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_f6eea19eacb4f1f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k425(%rip), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8450bd9f05dda3bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k426(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k427(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_ir0_k428(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_4fc8ea686eadd0ec(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k429(%rip), %rax
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e9ffd29e13f43ecf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k430(%rip), %rax
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_eb4b1cb12dd7d0b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k431(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k432(%rip), %rax
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_ec710f8a852b865b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_ir0_k433(%rip), %rax
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9c6a64c562708ccb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k434(%rip), %rax
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k435(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_ir0_k436(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    movabsq $0x3ff6a09e667f3bcd, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k437(%rip), %rax
+    movq    %rax, -192(%rbp)
+    movq    -192(%rbp), %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_d2ef191e947358ac(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k438(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e743c80ec82f9ebd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k439(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_060e8f1eb12aa86a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k440(%rip), %rax
+    movq    %rax, -240(%rbp)
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k441(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    movabsq $0x4008000000000001, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k442(%rip), %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %rax
+    movq    %rax, __xly_globals+128(%rip)
+    leaq    .Lxly_str_132c8599229e27c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_ir0_k443(%rip), %rax
+    movq    %rax, -264(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2bb7e266451ccf72(%rip), %rdi
+    call    xly_str
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_ir0_k444(%rip), %rax
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k445(%rip), %rax
+    movq    %rax, -288(%rbp)
+    movq    -288(%rbp), %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_3c42850b9c6dfcaf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_ir0_k446(%rip), %rax
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8e44d89dbf0a8f1f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k447(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -312(%rbp)
+    movabsq $0x8000000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k448(%rip), %rax
+    movq    %rax, -320(%rbp)
+    subq    $16, %rsp
+    movq    -320(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -328(%rbp)
+    movq    -312(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -328(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -336(%rbp)
+    movq    -336(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -344(%rbp)
+.Lxly_ir0_b3:
+    movq    -344(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -352(%rbp)
+    movq    -352(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k450(%rip), %rax
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -368(%rbp)
+    movabsq $0xbff0000000000000, %rax
+    movq    %rax, -376(%rbp)
+    leaq    .Lxly_ir0_k451(%rip), %rax
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -392(%rbp)
+    movq    -368(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -392(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -400(%rbp)
+    movq    -400(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -408(%rbp)
+.Lxly_ir0_b5:
+    movq    -408(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -416(%rbp)
+    movq    -416(%rbp), %rax
+    movq    %rax, __xly_globals+152(%rip)
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k453(%rip), %rax
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    -424(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir0_k454(%rip), %rax
+    movq    %rax, -440(%rbp)
+    subq    $16, %rsp
+    movq    -440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    -432(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1192(%rbp)
+    leaq    -1200(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -448(%rbp)
+    movq    -448(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b7:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -456(%rbp)
+    movq    -456(%rbp), %rax
+    movq    %rax, __xly_globals+160(%rip)
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k456(%rip), %rax
+    movq    %rax, -464(%rbp)
+    subq    $16, %rsp
+    movq    -464(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -472(%rbp)
+    leaq    .Lxly_ir0_k457(%rip), %rax
+    movq    %rax, -480(%rbp)
+    subq    $16, %rsp
+    movq    -480(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, -488(%rbp)
+    movq    -472(%rbp), %rdi
+    movq    -488(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1320(%rbp)
+    leaq    -1328(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -496(%rbp)
+    movq    -496(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -504(%rbp)
+.Lxly_ir0_b9:
+    movq    -504(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -512(%rbp)
+    movq    -512(%rbp), %rax
+    movq    %rax, __xly_globals+168(%rip)
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k459(%rip), %rax
+    movq    %rax, -520(%rbp)
+    movq    -520(%rbp), %rdi
+    call    .Lxly_fn_sinh
+    movq    %rax, -528(%rbp)
+    leaq    .Lxly_ir0_k460(%rip), %rax
+    movq    %rax, -536(%rbp)
+    movq    -536(%rbp), %rdi
+    call    .Lxly_fn_cosh
+    movq    %rax, -544(%rbp)
+    movq    -528(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -544(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -552(%rbp)
+.Lxly_ir0_b11:
+    movq    -552(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -560(%rbp)
+    movq    -560(%rbp), %rax
+    movq    %rax, __xly_globals+176(%rip)
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k462(%rip), %rax
+    movq    %rax, -568(%rbp)
+    movq    -568(%rbp), %rdi
+    call    .Lxly_fn_sinh
+    movq    %rax, -576(%rbp)
+    leaq    .Lxly_ir0_k463(%rip), %rax
+    movq    %rax, -584(%rbp)
+    movq    -584(%rbp), %rdi
+    call    .Lxly_fn_cosh
+    movq    %rax, -592(%rbp)
+    movq    -576(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -592(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -600(%rbp)
+.Lxly_ir0_b13:
+    movq    -600(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -608(%rbp)
+    movq    -608(%rbp), %rax
+    movq    %rax, __xly_globals+184(%rip)
+    leaq    .Lxly_str_44f23c72b931e2a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -616(%rbp)
+    movq    -344(%rbp), %xmm0
+    movsd   %xmm0, -1448(%rbp)
+    leaq    -1456(%rbp), %rax
+    movq    %rax, -624(%rbp)
+    subq    $16, %rsp
+    movq    -616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -624(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3b759d72b39621bf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -632(%rbp)
+    movq    -408(%rbp), %xmm0
+    movsd   %xmm0, -1576(%rbp)
+    leaq    -1584(%rbp), %rax
+    movq    %rax, -640(%rbp)
+    subq    $16, %rsp
+    movq    -632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -640(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_52dea9cc8c432217(%rip), %rdi
+    call    xly_str
+    movq    %rax, -648(%rbp)
+    movq    %r14, %xmm0
+    movsd   %xmm0, -1704(%rbp)
+    leaq    -1712(%rbp), %rax
+    movq    %rax, -656(%rbp)
+    subq    $16, %rsp
+    movq    -648(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -656(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5aa7c8cc906c7500(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    -504(%rbp), %xmm0
+    movsd   %xmm0, -1832(%rbp)
+    leaq    -1840(%rbp), %rax
+    movq    %rax, -664(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -664(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a66d30ed21c3146b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    -552(%rbp), %xmm0
+    movsd   %xmm0, -1960(%rbp)
+    leaq    -1968(%rbp), %rax
+    movq    %rax, -672(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -672(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ae365fed25ec8284(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    -600(%rbp), %xmm0
+    movsd   %xmm0, -2088(%rbp)
+    leaq    -2096(%rbp), %rax
+    movq    %rax, -680(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -680(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_71bd0fc61f1c6348(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+.Lxly_ir0_b16:
+    movq    %rbx, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -688(%rbp)
+    movq    -688(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -696(%rbp)
+    subq    $16, %rsp
+    movq    -696(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, -704(%rbp)
+.Lxly_ir0_b15:
+    movq    -704(%rbp), %rax
+    movq    %rax, __xly_globals+192(%rip)
+.Lxly_ir0_b18:
+    movq    %r13, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -712(%rbp)
+    movq    %rbx, %xmm0
+    movq    -712(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -720(%rbp)
+    movq    -720(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -728(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, -736(%rbp)
+.Lxly_ir0_b17:
+    movq    -736(%rbp), %rax
+    movq    %rax, __xly_globals+200(%rip)
+.Lxly_ir0_b20:
+    movq    %r12, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -744(%rbp)
+    movq    %rbx, %xmm0
+    movq    -744(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -752(%rbp)
+    movq    -752(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, -768(%rbp)
+.Lxly_ir0_b19:
+    movq    -768(%rbp), %rax
+    movq    %rax, __xly_globals+208(%rip)
+.Lxly_ir0_b22:
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -776(%rbp)
+    movq    %r13, %xmm0
+    movq    -776(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -784(%rbp)
+    movq    -784(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -792(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, -800(%rbp)
+.Lxly_ir0_b21:
+    movq    -800(%rbp), %rax
+    movq    %rax, __xly_globals+216(%rip)
+.Lxly_ir0_b24:
+    leaq    .Lxly_ir0_k475(%rip), %rax
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    -808(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, -816(%rbp)
+    movq    -816(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -824(%rbp)
+.Lxly_ir0_b23:
+    movq    -824(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -832(%rbp)
+    movq    -832(%rbp), %rax
+    movq    %rax, __xly_globals+224(%rip)
+.Lxly_ir0_b26:
+    leaq    .Lxly_ir0_k477(%rip), %rax
+    movq    %rax, -840(%rbp)
+    subq    $16, %rsp
+    movq    -840(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, -848(%rbp)
+    movq    -848(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -856(%rbp)
+.Lxly_ir0_b25:
+    movq    -856(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+232(%rip)
+    leaq    .Lxly_str_a0693444fa152191(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -704(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a8326344fe3e8faa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -736(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c81367405e8a1e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -768(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bf2cbc40596e1fd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -800(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7e60ad11528e006a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -824(%rbp), %xmm0
+    movsd   %xmm0, -2216(%rbp)
+    leaq    -2224(%rbp), %rax
+    movq    %rax, -864(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f42be80d0df1beef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -856(%rbp), %xmm0
+    movsd   %xmm0, -2344(%rbp)
+    leaq    -2352(%rbp), %rax
+    movq    %rax, -872(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -872(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_198cd8e569926d14(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k481(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+240(%rip)
+    movabsq $0x3fe0c152382d7366, %rax
+    movq    %rax, -880(%rbp)
+    leaq    .Lxly_ir0_k482(%rip), %rax
+    movq    %rax, -888(%rbp)
+    movq    -888(%rbp), %rax
+    movq    %rax, __xly_globals+248(%rip)
+    movabsq $0x3ff921fb54442d18, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k483(%rip), %rax
+    movq    %rax, -896(%rbp)
+    movq    -896(%rbp), %rax
+    movq    %rax, __xly_globals+256(%rip)
+    leaq    .Lxly_str_70c12a24bd14f58d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -904(%rbp)
+    leaq    .Lxly_ir0_k484(%rip), %rax
+    movq    %rax, -912(%rbp)
+    subq    $16, %rsp
+    movq    -904(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -912(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3000a07a1abae598(%rip), %rdi
+    call    xly_str
+    movq    %rax, -920(%rbp)
+    leaq    .Lxly_ir0_k485(%rip), %rax
+    movq    %rax, -928(%rbp)
+    subq    $16, %rsp
+    movq    -920(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -928(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7999c924c224a226(%rip), %rdi
+    call    xly_str
+    movq    %rax, -936(%rbp)
+    leaq    .Lxly_ir0_k486(%rip), %rax
+    movq    %rax, -944(%rbp)
+    subq    $16, %rsp
+    movq    -936(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -944(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k487(%rip), %rax
+    movq    %rax, -952(%rbp)
+    movq    -952(%rbp), %rax
+    movq    %rax, __xly_globals+264(%rip)
+    movabsq $0x3ff0c152382d7366, %rax
+    movq    %rax, -960(%rbp)
+    leaq    .Lxly_ir0_k488(%rip), %rax
+    movq    %rax, -968(%rbp)
+    movq    -968(%rbp), %rax
+    movq    %rax, __xly_globals+272(%rip)
+    leaq    .Lxly_ir0_k489(%rip), %rax
+    movq    %rax, -976(%rbp)
+    movq    -976(%rbp), %rax
+    movq    %rax, __xly_globals+280(%rip)
+    leaq    .Lxly_str_3ff59be14f4a03a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -984(%rbp)
+    leaq    .Lxly_ir0_k490(%rip), %rax
+    movq    %rax, -992(%rbp)
+    subq    $16, %rsp
+    movq    -984(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -992(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8e67f1ce9e1a70d1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1000(%rbp)
+    leaq    .Lxly_ir0_k491(%rip), %rax
+    movq    %rax, -1008(%rbp)
+    subq    $16, %rsp
+    movq    -1000(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1008(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3678fce149ae42bf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1016(%rbp)
+    leaq    .Lxly_ir0_k492(%rip), %rax
+    movq    %rax, -1024(%rbp)
+    subq    $16, %rsp
+    movq    -1016(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1024(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k493(%rip), %rax
+    movq    %rax, -1032(%rbp)
+    movq    -1032(%rbp), %rax
+    movq    %rax, __xly_globals+288(%rip)
+    movabsq $0x3fe921fb54442d18, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k494(%rip), %rax
+    movq    %rax, -1040(%rbp)
+    movq    -1040(%rbp), %rax
+    movq    %rax, __xly_globals+296(%rip)
+    leaq    .Lxly_str_495afa3743024948(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1048(%rbp)
+    leaq    .Lxly_ir0_k495(%rip), %rax
+    movq    %rax, -1056(%rbp)
+    subq    $16, %rsp
+    movq    -1048(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1056(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4191db373ed8f65f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k496(%rip), %rax
+    movq    %rax, -1064(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1064(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k497(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+304(%rip)
+    leaq    .Lxly_ir0_k498(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+312(%rip)
+    leaq    .Lxly_str_76b0ebd59bb0d8d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k499(%rip), %rax
+    movq    %rax, -1072(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1072(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6e0e3cd596cea07b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k500(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_090ade7c08381ec6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b28:
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k501(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b27:
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+320(%rip)
+    leaq    .Lxly_str_f8ed13ed1b43fbc5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %xmm0
+    movsd   %xmm0, -2472(%rbp)
+    leaq    -2480(%rbp), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+.Lxly_ir0_b30:
+    leaq    .Lxly_ir0_k504(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k505(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_hypot
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_ir0_b29:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+328(%rip)
+    leaq    .Lxly_str_719beddd4bb593c8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+.Lxly_ir0_b32:
+    leaq    .Lxly_ir0_k506(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_cosh
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b31:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+336(%rip)
+    leaq    .Lxly_str_06c2886f1c140964(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movsd   %xmm0, -2600(%rbp)
+    leaq    -2608(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b17ef2de22f65f4f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f9e2a7c782a4d268(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4c890b19df79d3a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6570f4f9d7e550db(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1692e6ec1877d896(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ec3d019439a531a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_80e7000cd808957a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ab7d89c0aaecef43(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1c2242ad2fb74cd5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_16280c77d1f61909(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k409:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k410:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k411:
+    .quad   0, 0x401d8e64b8d4ddae, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k412:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k413:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k414:
+    .quad   0, 0x401d8e64b8d4ddae, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k415:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k416:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k417:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k418:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k419:
+    .quad   0, 0x40026bb1bbb55516, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k420:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k421:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k422:
+    .quad   0, 0x40026bb1bbb55516, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k423:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k424:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k425:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k426:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k427:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k428:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k429:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k430:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k431:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k432:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k433:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k434:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k435:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k436:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k437:
+    .quad   0, 0x3ff6a09e667f3bcd, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k438:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k439:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k440:
+    .quad   0, 0x3ff6a09e667f3bcd, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k441:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k442:
+    .quad   0, 0x4008000000000001, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k443:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k444:
+    .quad   0, 0x4008000000000001, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k445:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k446:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k447:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k448:
+    .quad   0, 0x8000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k450:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k451:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k453:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k454:
+    .quad   0, 0x8000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k456:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k457:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k459:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k460:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k462:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k463:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k475:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k477:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k481:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k482:
+    .quad   0, 0x3fe0c152382d7366, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k483:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k484:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k485:
+    .quad   0, 0x3fe0c152382d7366, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k486:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k487:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k488:
+    .quad   0, 0x3ff0c152382d7366, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k489:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k490:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k491:
+    .quad   0, 0x3ff0c152382d7366, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k492:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k493:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k494:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k495:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k496:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k497:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k498:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k499:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k500:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k501:
+    .quad   0, 0x3fe0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k504:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k505:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k506:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_exp2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf0_0_k6(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_pow
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k6:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sinh:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    8(%rax), %rax
+    btcq    $63, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_cosh:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -124(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    8(%rax), %rax
+    btcq    $63, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_tanh:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -140(%rbp)
+.Lxly_irf3_0_b3:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    8(%rax), %rax
+    btcq    $63, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_irf3_0_b2:
+.Lxly_irf3_0_b5:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_add
+.Lxly_f3_2:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_irf3_0_b4:
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_asinh:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_add
+.Lxly_f4_2:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_acosh:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_atanh:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -132(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf6_0_k12(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f6_2
+.Lxly_f6_1:
+    call    xly_add
+.Lxly_f6_2:
+    movq    %rax, %r14
+    movq    %r12, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_log
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf6_0_k12:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_exponentialGrowth:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_distance:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_hypot
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_catenary:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -140(%rbp)
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_irf9_0_b3:
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rax
+    btcq    $63, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_exp
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f9_2
+.Lxly_f9_1:
+    call    xly_add
+.Lxly_f9_2:
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf9_0_b2:
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_8a304ad16d1431e3:
+    .asciz  "=== Complete Math Library ==="
+.Lxly_str_85a1d831206f7d38:
+    .asciz  "1. Exponential Functions"
+.Lxly_str_37efa4d32d7b6033:
+    .asciz  "exp(0):"
+.Lxly_str_409253d3325d988c:
+    .asciz  "exp(1):"
+.Lxly_str_4a1c7ed33804d1b5:
+    .asciz  "exp(2):"
+.Lxly_str_bfce0f3ad8249034:
+    .asciz  "exp2(10):"
+.Lxly_str_7ae95fe976fa867f:
+    .asciz  "2. Logarithmic Functions"
+.Lxly_str_70b4205a7065d05d:
+    .asciz  "log(1):"
+.Lxly_str_f3930c5998862629:
+    .asciz  "log(e):"
+.Lxly_str_99ea67acd0d5db19:
+    .asciz  "log(10):"
+.Lxly_str_f6eea19eacb4f1f6:
+    .asciz  "log10(10):"
+.Lxly_str_8450bd9f05dda3bc:
+    .asciz  "log10(100):"
+.Lxly_str_4fc8ea686eadd0ec:
+    .asciz  "log2(2):"
+.Lxly_str_e9ffd29e13f43ecf:
+    .asciz  "log2(1024):"
+.Lxly_str_eb4b1cb12dd7d0b4:
+    .asciz  "3. Power Functions"
+.Lxly_str_ec710f8a852b865b:
+    .asciz  "pow(2, 3):"
+.Lxly_str_9c6a64c562708ccb:
+    .asciz  "pow(10, 2):"
+.Lxly_str_d2ef191e947358ac:
+    .asciz  "sqrt(4):"
+.Lxly_str_e743c80ec82f9ebd:
+    .asciz  "sqrt(16):"
+.Lxly_str_060e8f1eb12aa86a:
+    .asciz  "sqrt(2):"
+.Lxly_str_132c8599229e27c5:
+    .asciz  "cbrt(8):"
+.Lxly_str_2bb7e266451ccf72:
+    .asciz  "cbrt(27):"
+.Lxly_str_3c42850b9c6dfcaf:
+    .asciz  "hypot(3, 4):"
+.Lxly_str_8e44d89dbf0a8f1f:
+    .asciz  "4. Hyperbolic Functions"
+.Lxly_str_44f23c72b931e2a8:
+    .asciz  "sinh(0):"
+.Lxly_str_3b759d72b39621bf:
+    .asciz  "sinh(1):"
+.Lxly_str_52dea9cc8c432217:
+    .asciz  "cosh(0):"
+.Lxly_str_5aa7c8cc906c7500:
+    .asciz  "cosh(1):"
+.Lxly_str_a66d30ed21c3146b:
+    .asciz  "tanh(0):"
+.Lxly_str_ae365fed25ec8284:
+    .asciz  "tanh(1):"
+.Lxly_str_71bd0fc61f1c6348:
+    .asciz  "5. Inverse Hyperbolic Functions"
+.Lxly_str_a0693444fa152191:
+    .asciz  "asinh(0):"
+.Lxly_str_a8326344fe3e8faa:
+    .asciz  "asinh(1):"
+.Lxly_str_c81367405e8a1e31:
+    .asciz  "acosh(1):"
+.Lxly_str_bf2cbc40596e1fd8:
+    .asciz  "acosh(2):"
+.Lxly_str_7e60ad11528e006a:
+    .asciz  "atanh(0):"
+.Lxly_str_f42be80d0df1beef:
+    .asciz  "atanh(0.5):"
+.Lxly_str_198cd8e569926d14:
+    .asciz  "6. Arc Trigonometric Functions"
+.Lxly_str_70c12a24bd14f58d:
+    .asciz  "asin(0):"
+.Lxly_str_3000a07a1abae598:
+    .asciz  "asin(0.5):"
+.Lxly_str_7999c924c224a226:
+    .asciz  "asin(1):"
+.Lxly_str_3ff59be14f4a03a8:
+    .asciz  "acos(0):"
+.Lxly_str_8e67f1ce9e1a70d1:
+    .asciz  "acos(0.5):"
+.Lxly_str_3678fce149ae42bf:
+    .asciz  "acos(1):"
+.Lxly_str_495afa3743024948:
+    .asciz  "atan(0):"
+.Lxly_str_4191db373ed8f65f:
+    .asciz  "atan(1):"
+.Lxly_str_76b0ebd59bb0d8d4:
+    .asciz  "atan2(1, 1):"
+.Lxly_str_6e0e3cd596cea07b:
+    .asciz  "atan2(1, 0):"
+.Lxly_str_090ade7c08381ec6:
+    .asciz  "7. Practical Applications"
+.Lxly_str_f8ed13ed1b43fbc5:
+    .asciz  "Population growth:"
+.Lxly_str_719beddd4bb593c8:
+    .asciz  "Distance:"
+.Lxly_str_06c2886f1c140964:
+    .asciz  "Catenary:"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_b17ef2de22f65f4f:
+    .asciz  "Complete Math Library:"
+.Lxly_str_f9e2a7c782a4d268:
+    .asciz  "  \342\200\242 Exponential: exp, exp2, exp10"
+.Lxly_str_4c890b19df79d3a7:
+    .asciz  "  \342\200\242 Logarithmic: log, log10, log2"
+.Lxly_str_6570f4f9d7e550db:
+    .asciz  "  \342\200\242 Power: pow, sqrt, cbrt, hypot"
+.Lxly_str_1692e6ec1877d896:
+    .asciz  "  \342\200\242 Hyperbolic: sinh, cosh, tanh"
+.Lxly_str_ec3d019439a531a5:
+    .asciz  "  \342\200\242 Inverse Hyperbolic: asinh, acosh, atanh"
+.Lxly_str_80e7000cd808957a:
+    .asciz  "  \342\200\242 Arc Trigonometric: asin, acos, atan, atan2"
+.Lxly_str_ab7d89c0aaecef43:
+    .asciz  "Total: 105+ mathematical functions"
+.Lxly_str_1c2242ad2fb74cd5:
+    .asciz  "Compile for 18x speed:"
+.Lxly_str_16280c77d1f61909:
+    .asciz  "  ./xenlyc -O3 math_complete.xe -o math"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   43
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   344
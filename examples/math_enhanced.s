@@ -0,0 +1,1433 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1104, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_2158a0ccae38bd57(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6cad920681736906(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k228(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k229(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complex
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k230(%rip), %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k231(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complex
+    addq    $16, %rsp
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_3a0ec5415af2797e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k232(%rip), %rax
+    movq    %rax, -96(%rbp)
+    movq    %r15, %rdi
+    movq    -96(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_str_af63a64c860190ca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k233(%rip), %rax
+    movq    %rax, -112(%rbp)
+    movq    %r15, %rdi
+    movq    -112(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_str_af63e44c8601fa24(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    subq    $48, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    leaq    .Lxly_str_2f90ad271e29998d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k234(%rip), %rax
+    movq    %rax, -144(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k235(%rip), %rax
+    movq    %rax, -160(%rbp)
+    movq    -80(%rbp), %rdi
+    movq    -160(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -168(%rbp)
+    subq    $48, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complexAdd
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    movq    -176(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_8a509f3677ece5c6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_ir0_k236(%rip), %rax
+    movq    %rax, -192(%rbp)
+    movq    -176(%rbp), %rdi
+    movq    -192(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k237(%rip), %rax
+    movq    %rax, -208(%rbp)
+    movq    -176(%rbp), %rdi
+    movq    -208(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -216(%rbp)
+    subq    $48, %rsp
+    movq    -184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complexMul
+    addq    $16, %rsp
+    movq    %rax, -224(%rbp)
+    movq    -224(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_052e2d072bc3dad1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k238(%rip), %rax
+    movq    %rax, -240(%rbp)
+    movq    -224(%rbp), %rdi
+    movq    -240(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_ir0_k239(%rip), %rax
+    movq    %rax, -256(%rbp)
+    movq    -224(%rbp), %rdi
+    movq    -256(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -264(%rbp)
+    subq    $48, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_complexAbs
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+    movq    -272(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_63b8ed000682cffa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_complexConj
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+    movq    -288(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_06805d88dfcaae21(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_ir0_k240(%rip), %rax
+    movq    %rax, -304(%rbp)
+    movq    -288(%rbp), %rdi
+    movq    -304(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -312(%rbp)
+    leaq    .Lxly_ir0_k241(%rip), %rax
+    movq    %rax, -320(%rbp)
+    movq    -288(%rbp), %rdi
+    movq    -320(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -328(%rbp)
+    subq    $48, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_complexPhase
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movq    -336(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_667b95dd00eb3d9c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_str_223c4f5cf7037461(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    subq    $32, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -336(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b792f2a998ad4d78(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -368(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -376(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -384(%rbp)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -392(%rbp)
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -400(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -408(%rbp)
+    leaq    .Lxly_ir0_k242(%rip), %rax
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_ir0_k243(%rip), %rax
+    movq    %rax, -424(%rbp)
+    leaq    .Lxly_ir0_k244(%rip), %rax
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir0_k245(%rip), %rax
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_ir0_k246(%rip), %rax
+    movq    %rax, -448(%rbp)
+    leaq    .Lxly_ir0_k247(%rip), %rax
+    movq    %rax, -456(%rbp)
+    leaq    .Lxly_ir0_k248(%rip), %rax
+    movq    %rax, -464(%rbp)
+    leaq    .Lxly_ir0_k249(%rip), %rax
+    movq    %rax, -472(%rbp)
+    leaq    .Lxly_ir0_k250(%rip), %rax
+    movq    %rax, -480(%rbp)
+    leaq    .Lxly_ir0_k251(%rip), %rax
+    movq    %rax, -488(%rbp)
+    subq    $80, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -424(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -432(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -440(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -456(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -464(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    -472(%rbp), %rax
+    movq    %rax, 56(%rsp)
+    movq    -480(%rbp), %rax
+    movq    %rax, 64(%rsp)
+    movq    -488(%rbp), %rax
+    movq    %rax, 72(%rsp)
+    movq    %rsp, %rdi
+    movq    $10, %rsi
+    call    xly_array_create
+    addq    $80, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sum
+    addq    $16, %rsp
+    movq    %rax, -496(%rbp)
+    movq    -496(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_3f1d035907fa938c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -504(%rbp)
+    subq    $16, %rsp
+    movq    -504(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -496(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k252(%rip), %rax
+    movq    %rax, -512(%rbp)
+    leaq    .Lxly_ir0_k253(%rip), %rax
+    movq    %rax, -520(%rbp)
+    leaq    .Lxly_ir0_k254(%rip), %rax
+    movq    %rax, -528(%rbp)
+    leaq    .Lxly_ir0_k255(%rip), %rax
+    movq    %rax, -536(%rbp)
+    leaq    .Lxly_ir0_k256(%rip), %rax
+    movq    %rax, -544(%rbp)
+    subq    $48, %rsp
+    movq    -512(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -520(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -528(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -536(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -544(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movq    $5, %rsi
+    call    xly_array_create
+    addq    $48, %rsp
+    movq    %rax, -552(%rbp)
+    subq    $16, %rsp
+    movq    -552(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_product
+    addq    $16, %rsp
+    movq    %rax, -560(%rbp)
+    movq    -560(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_164b6bd8f7af4baa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -568(%rbp)
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -560(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_mean
+    addq    $16, %rsp
+    movq    %rax, -576(%rbp)
+    movq    -576(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_cd1266c6961bc488(%rip), %rdi
+    call    xly_str
+    movq    %rax, -584(%rbp)
+    subq    $16, %rsp
+    movq    -584(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -576(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_median
+    addq    $16, %rsp
+    movq    %rax, -592(%rbp)
+    movq    -592(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_cded1f4310696753(%rip), %rdi
+    call    xly_str
+    movq    %rax, -600(%rbp)
+    subq    $16, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -592(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_variance
+    addq    $16, %rsp
+    movq    %rax, -608(%rbp)
+    movq    -608(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_8af11a7a1b43826e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -616(%rbp)
+    subq    $16, %rsp
+    movq    -616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -608(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_stddev
+    addq    $16, %rsp
+    movq    %rax, -624(%rbp)
+    movq    -624(%rbp), %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_08b13bb137479c09(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -624(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0becc8d4dc70f4a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, -632(%rbp)
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k257(%rip), %rax
+    movq    %rax, -640(%rbp)
+    leaq    .Lxly_ir0_k258(%rip), %rax
+    movq    %rax, -648(%rbp)
+    subq    $16, %rsp
+    movq    -640(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -648(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_gcd
+    addq    $16, %rsp
+    movq    %rax, -656(%rbp)
+    movq    -656(%rbp), %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_ebdcdb03b34b92e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -664(%rbp)
+    subq    $16, %rsp
+    movq    -664(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -656(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, -672(%rbp)
+    leaq    .Lxly_ir0_k259(%rip), %rax
+    movq    %rax, -680(%rbp)
+    leaq    .Lxly_ir0_k260(%rip), %rax
+    movq    %rax, -688(%rbp)
+    subq    $16, %rsp
+    movq    -680(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -688(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_lcm
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_212284c7de0a0e33(%rip), %rdi
+    call    xly_str
+    movq    %rax, -696(%rbp)
+    subq    $16, %rsp
+    movq    -696(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k261(%rip), %rax
+    movq    %rax, -704(%rbp)
+    subq    $16, %rsp
+    movq    -704(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_factorial
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    leaq    .Lxly_str_b9b96f02f5d2fc0c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -712(%rbp)
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k262(%rip), %rax
+    movq    %rax, -720(%rbp)
+    leaq    .Lxly_ir0_k263(%rip), %rax
+    movq    %rax, -728(%rbp)
+    subq    $16, %rsp
+    movq    -720(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -728(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_combinations
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_e9953b65b65409b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -736(%rbp)
+    subq    $16, %rsp
+    movq    -736(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k264(%rip), %rax
+    movq    %rax, -744(%rbp)
+    leaq    .Lxly_ir0_k265(%rip), %rax
+    movq    %rax, -752(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -752(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_permutations
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_fa15a81a5a4c7995(%rip), %rdi
+    call    xly_str
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, -768(%rbp)
+    leaq    .Lxly_ir0_k266(%rip), %rax
+    movq    %rax, -776(%rbp)
+    leaq    .Lxly_ir0_k267(%rip), %rax
+    movq    %rax, -784(%rbp)
+    leaq    .Lxly_ir0_k268(%rip), %rax
+    movq    %rax, -792(%rbp)
+    subq    $32, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -784(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -792(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_math_lerp
+    addq    $32, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_str_4a81fbf6313dfd2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -800(%rbp)
+    subq    $16, %rsp
+    movq    -800(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k269(%rip), %rax
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    -808(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_degrees
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+160(%rip)
+    leaq    .Lxly_str_420638ffa0994171(%rip), %rdi
+    call    xly_str
+    movq    %rax, -816(%rbp)
+    leaq    .Lxly_str_2566cc910de1dbce(%rip), %rdi
+    call    xly_str
+    movq    %rax, -824(%rbp)
+    subq    $32, %rsp
+    movq    -816(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    -824(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movabsq $0x4066800000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k270(%rip), %rax
+    movq    %rax, -832(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_radians
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_f432a5d7b6c474da(%rip), %rdi
+    call    xly_str
+    movq    %rax, -840(%rbp)
+    subq    $32, %rsp
+    movq    -840(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_28997eb1399cd577(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1dfb339a1fd59d83(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4055400000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x4057000000000000, %rax
+    movq    %rax, -848(%rbp)
+    movabsq $0x4053800000000000, %rax
+    movq    %rax, -856(%rbp)
+    movabsq $0x4057c00000000000, %rax
+    movq    %rax, -864(%rbp)
+    movabsq $0x4056000000000000, %rax
+    movq    %rax, -872(%rbp)
+    movabsq $0x4053000000000000, %rax
+    movq    %rax, -880(%rbp)
+    movabsq $0x4056800000000000, %rax
+    movq    %rax, -888(%rbp)
+    movabsq $0x4055000000000000, %rax
+    movq    %rax, -896(%rbp)
+    movabsq $0x4056c00000000000, %rax
+    movq    %rax, -904(%rbp)
+    movabsq $0x4055c00000000000, %rax
+    movq    %rax, -912(%rbp)
+    leaq    .Lxly_ir0_k271(%rip), %rax
+    movq    %rax, -920(%rbp)
+    leaq    .Lxly_ir0_k272(%rip), %rax
+    movq    %rax, -928(%rbp)
+    leaq    .Lxly_ir0_k273(%rip), %rax
+    movq    %rax, -936(%rbp)
+    leaq    .Lxly_ir0_k274(%rip), %rax
+    movq    %rax, -944(%rbp)
+    leaq    .Lxly_ir0_k275(%rip), %rax
+    movq    %rax, -952(%rbp)
+    leaq    .Lxly_ir0_k276(%rip), %rax
+    movq    %rax, -960(%rbp)
+    leaq    .Lxly_ir0_k277(%rip), %rax
+    movq    %rax, -968(%rbp)
+    leaq    .Lxly_ir0_k278(%rip), %rax
+    movq    %rax, -976(%rbp)
+    leaq    .Lxly_ir0_k279(%rip), %rax
+    movq    %rax, -984(%rbp)
+    leaq    .Lxly_ir0_k280(%rip), %rax
+    movq    %rax, -992(%rbp)
+    subq    $80, %rsp
+    movq    -920(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -928(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -936(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -944(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -952(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -960(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -968(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    -976(%rbp), %rax
+    movq    %rax, 56(%rsp)
+    movq    -984(%rbp), %rax
+    movq    %rax, 64(%rsp)
+    movq    -992(%rbp), %rax
+    movq    %rax, 72(%rsp)
+    movq    %rsp, %rdi
+    movq    $10, %rsi
+    call    xly_array_create
+    addq    $80, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+176(%rip)
+    leaq    .Lxly_str_09ef70a4e63c1244(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1000(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_mean
+    addq    $16, %rsp
+    movq    %rax, -1008(%rbp)
+    subq    $16, %rsp
+    movq    -1000(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1008(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_21b0d0e9e41eaffd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1016(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_median
+    addq    $16, %rsp
+    movq    %rax, -1024(%rbp)
+    subq    $16, %rsp
+    movq    -1016(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1024(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f99f2757bdc5fe49(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1032(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_stddev
+    addq    $16, %rsp
+    movq    %rax, -1040(%rbp)
+    subq    $16, %rsp
+    movq    -1032(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1040(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_461957b352cb46fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k281(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k282(%rip), %rax
+    movq    %rax, -1048(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1048(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complex
+    addq    $16, %rsp
+    movq    %rax, -1056(%rbp)
+    movq    -1056(%rbp), %rax
+    movq    %rax, __xly_globals+184(%rip)
+    leaq    .Lxly_ir0_k283(%rip), %rax
+    movq    %rax, -1064(%rbp)
+    leaq    .Lxly_ir0_k284(%rip), %rax
+    movq    %rax, -1072(%rbp)
+    subq    $16, %rsp
+    movq    -1064(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1072(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complex
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+192(%rip)
+    subq    $16, %rsp
+    movq    -1056(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_complexAdd
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+200(%rip)
+    leaq    .Lxly_str_77a9592231b120f8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k285(%rip), %rax
+    movq    %rax, -1080(%rbp)
+    movq    %rbx, %rdi
+    movq    -1080(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k286(%rip), %rax
+    movq    %rax, -1088(%rbp)
+    movq    %rbx, %rdi
+    movq    -1088(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %r14
+    leaq    .Lxly_str_8f1996011b1c069c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1096(%rbp)
+    subq    $48, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 24(%rsp)
+    movq    -1096(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    leaq    .Lxly_str_50821f967d8baec5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_complexAbs
+    addq    $16, %rsp
+    movq    %rax, %r12
+    leaq    .Lxly_str_3cdcdab489d4400a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_71af0fcfd9f326c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x404a000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k287(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k288(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_combinations
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+208(%rip)
+    leaq    .Lxly_str_0011146a200e41f7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_48acd2ffddea94bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k228:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k229:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k230:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k231:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k232:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k233:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k234:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k235:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k236:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k237:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k238:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k239:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k240:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k241:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k242:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k243:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k244:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k245:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k246:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k247:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k248:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k249:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k250:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k251:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k252:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k253:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k254:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k255:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k256:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k257:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k258:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k259:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k260:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k261:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k262:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k263:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k264:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k265:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k266:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k267:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k268:
+    .quad   0, 0x3fe0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k269:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k270:
+    .quad   0, 0x4066800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k271:
+    .quad   0, 0x4055400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k272:
+    .quad   0, 0x4057000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k273:
+    .quad   0, 0x4053800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k274:
+    .quad   0, 0x4057c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k275:
+    .quad   0, 0x4056000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k276:
+    .quad   0, 0x4053000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k277:
+    .quad   0, 0x4056800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k278:
+    .quad   0, 0x4055000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k279:
+    .quad   0, 0x4056c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k280:
+    .quad   0, 0x4055c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k281:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k282:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k283:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k284:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k285:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k286:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k287:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k288:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_2158a0ccae38bd57:
+    .asciz  "=== Enhanced Math Module ==="
+.Lxly_str_6cad920681736906:
+    .asciz  "1. Complex Numbers:"
+.Lxly_str_3a0ec5415af2797e:
+    .asciz  "  c1 = "
+.Lxly_str_af63a64c860190ca:
+    .asciz  "+"
+.Lxly_str_af63e44c8601fa24:
+    .asciz  "i"
+.Lxly_str_2f90ad271e29998d:
+    .asciz  "  c2 = "
+.Lxly_str_8a509f3677ece5c6:
+    .asciz  "  c1 + c2 = "
+.Lxly_str_052e2d072bc3dad1:
+    .asciz  "  c1 * c2 = "
+.Lxly_str_63b8ed000682cffa:
+    .asciz  "  |c1| = "
+.Lxly_str_06805d88dfcaae21:
+    .asciz  "  conj(c1) = "
+.Lxly_str_667b95dd00eb3d9c:
+    .asciz  "  phase(c1) = "
+.Lxly_str_223c4f5cf7037461:
+    .asciz  "radians"
+.Lxly_str_b792f2a998ad4d78:
+    .asciz  "2. Type-Generic Functions:"
+.Lxly_str_3f1d035907fa938c:
+    .asciz  "  sum([1..10]) = "
+.Lxly_str_164b6bd8f7af4baa:
+    .asciz  "  product([1..5]) = "
+.Lxly_str_cd1266c6961bc488:
+    .asciz  "  mean([1..10]) = "
+.Lxly_str_cded1f4310696753:
+    .asciz  "  median([1..10]) = "
+.Lxly_str_8af11a7a1b43826e:
+    .asciz  "  variance([1..10]) = "
+.Lxly_str_08b13bb137479c09:
+    .asciz  "  stddev([1..10]) = "
+.Lxly_str_0becc8d4dc70f4a9:
+    .asciz  "3. Advanced Math Functions:"
+.Lxly_str_ebdcdb03b34b92e6:
+    .asciz  "  gcd(48, 18) = "
+.Lxly_str_212284c7de0a0e33:
+    .asciz  "  lcm(12, 18) = "
+.Lxly_str_b9b96f02f5d2fc0c:
+    .asciz  "  5! = "
+.Lxly_str_e9953b65b65409b4:
+    .asciz  "  C(10, 3) = "
+.Lxly_str_fa15a81a5a4c7995:
+    .asciz  "  P(10, 3) = "
+.Lxly_str_4a81fbf6313dfd2c:
+    .asciz  "  lerp(0, 100, 0.5) = "
+.Lxly_str_420638ffa0994171:
+    .asciz  "  \317\200 radians = "
+.Lxly_str_2566cc910de1dbce:
+    .asciz  "degrees"
+.Lxly_str_f432a5d7b6c474da:
+    .asciz  "  180 degrees = "
+.Lxly_str_28997eb1399cd577:
+    .asciz  "4. Practical Examples:"
+.Lxly_str_1dfb339a1fd59d83:
+    .asciz  "  Example 1: Test Scores"
+.Lxly_str_09ef70a4e63c1244:
+    .asciz  "    Mean score:"
+.Lxly_str_21b0d0e9e41eaffd:
+    .asciz  "    Median score:"
+.Lxly_str_f99f2757bdc5fe49:
+    .asciz  "    Std deviation:"
+.Lxly_str_461957b352cb46fb:
+    .asciz  "  Example 2: Electrical Impedance"
+.Lxly_str_77a9592231b120f8:
+    .asciz  "    Z1 + Z2 ="
+.Lxly_str_8f1996011b1c069c:
+    .asciz  "j ohms"
+.Lxly_str_50821f967d8baec5:
+    .asciz  "    |Z_total| ="
+.Lxly_str_3cdcdab489d4400a:
+    .asciz  "ohms"
+.Lxly_str_71af0fcfd9f326c5:
+    .asciz  "  Example 3: Probability"
+.Lxly_str_0011146a200e41f7:
+    .asciz  "    Poker hands (5 from 52):"
+.Lxly_str_48acd2ffddea94bc:
+    .asciz  "\342\234\205 Enhanced math module working!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   27
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   216
@@ -0,0 +1,2812 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $928, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movl    $-1, -884(%rbp)
+    movl    $-1, -756(%rbp)
+    leaq    .Lxly_str_ef9df8a7d78da26c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5fdefecbf9229567(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1e109364bb5394b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b8ed3c810bd091a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k448(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5aa56640a894f44d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4005bf0a8b145769, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k449(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f8085dda6504b7d1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_44210c83a1feb382(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x3ff6a09e667f3bcd, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k450(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3b7763839d1666ad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x3ffbb67ae8584caa, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k451(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4bb150245777c9af(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f0b7a0d2f50e46ae(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3fe62e42fefa39ef, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k452(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c18d635db3a273cb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x40026bb1bbb55516, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k453(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_05061f5cdd9d428f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_69d2635ae5314e8b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_712b2200c1b2c708(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k454(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k455(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_gcd
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6fc04b2957c84050(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4041800000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k456(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k457(%rip), %rax
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_gcd
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_89e4104e6d2b527f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0daf061f925a5b57(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k458(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k459(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_lcm
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4d36203935e829ab(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k460(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k461(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_lcm
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0034402c63473d73(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_186520a3409eaa93(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k462(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_44864580f513d57e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k463(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k464(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_491b7dd8971e4906(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k465(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6f17351fe1a1f84a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5e7df551a42003cf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b5:
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k466(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_da49f1be09177b92(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b7:
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k467(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c5293d6a621148c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b9:
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k468(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ba36ecf6324b87f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b11:
+    movabsq $0x4052c00000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k469(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_132ddfb1a00584e2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b13:
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k470(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_71b51e7ad9211a41(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x41dfffffffc00000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k471(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0xc1e0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k472(%rip), %rax
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_75b095e680b1c06f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3a4a698e0b3eb760(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b15:
+.Lxly_ir0_b16:
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k473(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ec5aa02895f2ea9a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c7a7ccf62b332f0d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f4ab70f5f8d9fc26(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+.Lxly_ir0_b21:
+.Lxly_ir0_b22:
+.Lxly_ir0_b20:
+    leaq    .Lxly_ir0_k474(%rip), %rax
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a3df72bf68887fa8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6c4ec5dc3222d7c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b27:
+.Lxly_ir0_b28:
+.Lxly_ir0_b26:
+    leaq    .Lxly_ir0_k475(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bc345a0e1efb7440(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b33:
+.Lxly_ir0_b35:
+.Lxly_ir0_b37:
+.Lxly_ir0_b32:
+    leaq    .Lxly_ir0_k476(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_141c9b79f9dfc491(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b39:
+.Lxly_ir0_b41:
+.Lxly_ir0_b42:
+.Lxly_ir0_b38:
+    leaq    .Lxly_ir0_k477(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4487ab39c686271a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_33f2636a387dc72f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x406fe00000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k478(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_ir0_k479(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_ir0_k480(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_ir0_k481(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_ir0_k482(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_ir0_k483(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_ir0_k484(%rip), %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_ir0_k485(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k486(%rip), %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k487(%rip), %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k488(%rip), %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k489(%rip), %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k490(%rip), %rax
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rdi
+    movq    %rbx, %rsi
+    movq    -120(%rbp), %rdx
+    movq    -128(%rbp), %rcx
+    movq    -136(%rbp), %r8
+    movq    -144(%rbp), %r9
+    call    .Lxly_fn_interpolateColor
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_68d008a4a4b6b061(%rip), %rdi
+    call    xly_str
+    movq    %rax, -160(%rbp)
+    movq    %r13, %rdi
+    movq    .Lxly_atom_af63ef4c86020cd5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_str_af63a14c8601884b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    .Lxly_atom_af63da4c8601e926(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -176(%rbp)
+    movq    %r13, %rdi
+    movq    .Lxly_atom_af63df4c8601f1a5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    subq    $64, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 32(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdi
+    movl    $7, %esi
+    call    xly_print
+    addq    $64, %rsp
+    movabsq $0x3fd0000000000000, %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k491(%rip), %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k492(%rip), %rax
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k493(%rip), %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_ir0_k494(%rip), %rax
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k495(%rip), %rax
+    movq    %rax, -240(%rbp)
+    leaq    .Lxly_ir0_k496(%rip), %rax
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_ir0_k497(%rip), %rax
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rdi
+    movq    -216(%rbp), %rsi
+    movq    -224(%rbp), %rdx
+    movq    -232(%rbp), %rcx
+    movq    -240(%rbp), %r8
+    movq    -248(%rbp), %r9
+    call    .Lxly_fn_interpolateColor
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+    movq    -264(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_fc0df519272fe820(%rip), %rdi
+    call    xly_str
+    movq    %rax, -272(%rbp)
+    movq    -264(%rbp), %rdi
+    movq    .Lxly_atom_af63ef4c86020cd5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -280(%rbp)
+    movq    -264(%rbp), %rdi
+    movq    .Lxly_atom_af63da4c8601e926(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -288(%rbp)
+    movq    -264(%rbp), %rdi
+    movq    .Lxly_atom_af63df4c8601f1a5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -296(%rbp)
+    subq    $64, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -288(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 32(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdi
+    movl    $7, %esi
+    call    xly_print
+    addq    $64, %rsp
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k498(%rip), %rax
+    movq    %rax, -312(%rbp)
+    leaq    .Lxly_ir0_k499(%rip), %rax
+    movq    %rax, -320(%rbp)
+    leaq    .Lxly_ir0_k500(%rip), %rax
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_ir0_k501(%rip), %rax
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_ir0_k502(%rip), %rax
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_ir0_k503(%rip), %rax
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_ir0_k504(%rip), %rax
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rdi
+    movq    -320(%rbp), %rsi
+    movq    -328(%rbp), %rdx
+    movq    -336(%rbp), %rcx
+    movq    -344(%rbp), %r8
+    movq    -352(%rbp), %r9
+    call    .Lxly_fn_interpolateColor
+    addq    $16, %rsp
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_c6e31e9523db1e76(%rip), %rdi
+    call    xly_str
+    movq    %rax, -376(%rbp)
+    movq    -368(%rbp), %rdi
+    movq    .Lxly_atom_af63ef4c86020cd5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -384(%rbp)
+    movq    -368(%rbp), %rdi
+    movq    .Lxly_atom_af63da4c8601e926(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -392(%rbp)
+    movq    -368(%rbp), %rdi
+    movq    .Lxly_atom_af63df4c8601f1a5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -400(%rbp)
+    subq    $64, %rsp
+    movq    -376(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -384(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -392(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 32(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdi
+    movl    $7, %esi
+    call    xly_print
+    addq    $64, %rsp
+    movabsq $0x3fe8000000000000, %rax
+    movq    %rax, -408(%rbp)
+    leaq    .Lxly_ir0_k505(%rip), %rax
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_ir0_k506(%rip), %rax
+    movq    %rax, -424(%rbp)
+    leaq    .Lxly_ir0_k507(%rip), %rax
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir0_k508(%rip), %rax
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_ir0_k509(%rip), %rax
+    movq    %rax, -448(%rbp)
+    leaq    .Lxly_ir0_k510(%rip), %rax
+    movq    %rax, -456(%rbp)
+    leaq    .Lxly_ir0_k511(%rip), %rax
+    movq    %rax, -464(%rbp)
+    subq    $16, %rsp
+    movq    -464(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -416(%rbp), %rdi
+    movq    -424(%rbp), %rsi
+    movq    -432(%rbp), %rdx
+    movq    -440(%rbp), %rcx
+    movq    -448(%rbp), %r8
+    movq    -456(%rbp), %r9
+    call    .Lxly_fn_interpolateColor
+    addq    $16, %rsp
+    movq    %rax, -472(%rbp)
+    movq    -472(%rbp), %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_8aa0b2757fbc90b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -480(%rbp)
+    movq    -472(%rbp), %rdi
+    movq    .Lxly_atom_af63ef4c86020cd5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -488(%rbp)
+    movq    -472(%rbp), %rdi
+    movq    .Lxly_atom_af63da4c8601e926(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -496(%rbp)
+    movq    -472(%rbp), %rdi
+    movq    .Lxly_atom_af63df4c8601f1a5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -504(%rbp)
+    subq    $64, %rsp
+    movq    -480(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -488(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -496(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 32(%rsp)
+    movq    -504(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdi
+    movl    $7, %esi
+    call    xly_print
+    addq    $64, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -512(%rbp)
+    leaq    .Lxly_ir0_k512(%rip), %rax
+    movq    %rax, -520(%rbp)
+    leaq    .Lxly_ir0_k513(%rip), %rax
+    movq    %rax, -528(%rbp)
+    leaq    .Lxly_ir0_k514(%rip), %rax
+    movq    %rax, -536(%rbp)
+    leaq    .Lxly_ir0_k515(%rip), %rax
+    movq    %rax, -544(%rbp)
+    leaq    .Lxly_ir0_k516(%rip), %rax
+    movq    %rax, -552(%rbp)
+    leaq    .Lxly_ir0_k517(%rip), %rax
+    movq    %rax, -560(%rbp)
+    leaq    .Lxly_ir0_k518(%rip), %rax
+    movq    %rax, -568(%rbp)
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -520(%rbp), %rdi
+    movq    -528(%rbp), %rsi
+    movq    -536(%rbp), %rdx
+    movq    -544(%rbp), %rcx
+    movq    -552(%rbp), %r8
+    movq    -560(%rbp), %r9
+    call    .Lxly_fn_interpolateColor
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_d44a445cc774d596(%rip), %rdi
+    call    xly_str
+    movq    %rax, -576(%rbp)
+    movq    %r15, %rdi
+    movq    .Lxly_atom_af63ef4c86020cd5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -584(%rbp)
+    movq    %r15, %rdi
+    movq    .Lxly_atom_af63da4c8601e926(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -592(%rbp)
+    movq    %r15, %rdi
+    movq    .Lxly_atom_af63df4c8601f1a5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -600(%rbp)
+    subq    $64, %rsp
+    movq    -576(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -584(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -592(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 32(%rsp)
+    movq    -600(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdi
+    movl    $7, %esi
+    call    xly_print
+    addq    $64, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b4d0ebbc39b64e40(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_afee3d885a35206b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4026000000000000, %rax
+    movq    %rax, -608(%rbp)
+    leaq    .Lxly_ir0_k519(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_ir0_k520(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -616(%rbp)
+    leaq    .Lxly_str_198ce868bec576c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -624(%rbp)
+    leaq    .Lxly_str_0a6b9d17f72a65cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -632(%rbp)
+    leaq    .Lxly_str_07dd8c07b4a336ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, -640(%rbp)
+    movq    %r14, %rbx
+.Lxly_ir0_b1:
+    movq    %rbx, %xmm0
+    movq    -608(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %rbx, %xmm0
+    movq    -616(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b45:
+    leaq    .Lxly_ir0_k521(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k522(%rip), %rax
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -648(%rbp)
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    movq    -648(%rbp), %rdx
+    call    .Lxly_fn_lerp
+    movq    %rax, -656(%rbp)
+.Lxly_ir0_b44:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -784(%rbp)
+    leaq    -792(%rbp), %rax
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movsd   %xmm0, -912(%rbp)
+    leaq    -920(%rbp), %rax
+    movq    %rax, %r12
+    subq    $48, %rsp
+    movq    -624(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    -632(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    -640(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -656(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+    movq    %rbx, %xmm0
+    movq    -512(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movq    %r13, %rbx
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b00a6e8a40905d18(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k527(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k528(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    movabsq $0x4001e3779b97f4a8, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k529(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    movabsq $0x3ff9e3779b97f4a8, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k530(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+160(%rip)
+    leaq    .Lxly_str_5d69e6e41f8dcee7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k531(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_01f918b94c634b85(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4004f1bbcdcbfa54, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k532(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3e5b4bdadf6bea15(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3fe3c6ef372fe950, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k533(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_80e378004e04da29(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x3fe3c6ef372fe94f, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k534(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7eb2d06aa4f962ca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k535(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_debc421e8617c1c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k536(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b44d56c405338f79(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b47:
+    movabsq $0x4053a28c59d5433b, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b46:
+    leaq    .Lxly_ir0_k537(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b9ff4a1f9c286b2f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b49:
+    movabsq $0x403f6a7a2955385e, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b48:
+    leaq    .Lxly_ir0_k538(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e784670647c53246(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8defded122f8f8d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2db4f874455d2c41(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8cda6e8b4e7d967e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_34ab34c6c7b55373(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bc281abc23926ac1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_46b30828c541f561(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4e87b69b41d3d0e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0067b6e7fc619b3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_36eb0cd76d71e892(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_58f3a12789eabff1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_52e657a54cd3dfc4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k448:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k449:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k450:
+    .quad   0, 0x3ff6a09e667f3bcd, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k451:
+    .quad   0, 0x3ffbb67ae8584caa, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k452:
+    .quad   0, 0x3fe62e42fefa39ef, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k453:
+    .quad   0, 0x40026bb1bbb55516, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k454:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k455:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k456:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k457:
+    .quad   0, 0x4041800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k458:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k459:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k460:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k461:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k462:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k463:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k464:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k465:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k466:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k467:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k468:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k469:
+    .quad   0, 0x4052c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k470:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k471:
+    .quad   0, 0x41dfffffffc00000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k472:
+    .quad   0, 0xc1e0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k473:
+    .quad   0, 0x41dfffffffc00000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k474:
+    .quad   0, 0x41dfffffffc00000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k475:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k476:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k477:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k478:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k479:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k480:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k481:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k482:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k483:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k484:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k485:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k486:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k487:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k488:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k489:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k490:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k491:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k492:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k493:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k494:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k495:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k496:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k497:
+    .quad   0, 0x3fd0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k498:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k499:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k500:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k501:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k502:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k503:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k504:
+    .quad   0, 0x3fe0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k505:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k506:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k507:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k508:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k509:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k510:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k511:
+    .quad   0, 0x3fe8000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k512:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k513:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k514:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k515:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k516:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k517:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k518:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k519:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k520:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k521:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k522:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k527:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k528:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k529:
+    .quad   0, 0x4001e3779b97f4a8, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k530:
+    .quad   0, 0x3ff9e3779b97f4a8, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k531:
+    .quad   0, 0x3ff9e3779b97f4a8, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k532:
+    .quad   0, 0x4004f1bbcdcbfa54, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k533:
+    .quad   0, 0x3fe3c6ef372fe950, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k534:
+    .quad   0, 0x3fe3c6ef372fe94f, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k535:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k536:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k537:
+    .quad   0, 0x4053a28c59d5433b, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k538:
+    .quad   0, 0x403f6a7a2955385e, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lerp:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -148(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_add_sat:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f1_4
+.Lxly_f1_3:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f1_4:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f1_6
+.Lxly_f1_5:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f1_6:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf1_0_b5
+.Lxly_irf1_0_b4:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b5:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_sub_sat:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf2_0_b2
+.Lxly_irf2_0_b1:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b2:
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf2_0_b5
+.Lxly_irf2_0_b4:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b5:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_mul_sat:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b2
+.Lxly_irf3_0_b1:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b2:
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b5
+.Lxly_irf3_0_b4:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b5:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_clamp:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf4_0_b2
+.Lxly_irf4_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf4_0_b2:
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_4
+.Lxly_f4_3:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf4_0_b5
+.Lxly_irf4_0_b4:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf4_0_b5:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_interpolateColor:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $576, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %r8, -80(%rbp)
+    movq    %r9, -88(%rbp)
+    movq    16(%rbp), %r15
+    xorl    %eax, %eax
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movl    $-1, -532(%rbp)
+    movl    $-1, -404(%rbp)
+    movl    $-1, -276(%rbp)
+.Lxly_irf5_0_b3:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -96(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    movq    %rax, -104(%rbp)
+    movq    %rbx, %rdi
+    movq    -104(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r14
+.Lxly_irf5_0_b2:
+.Lxly_irf5_0_b5:
+    movq    -80(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %xmm0
+    movsd   %xmm0, -432(%rbp)
+    leaq    -440(%rbp), %rax
+    movq    %rax, -120(%rbp)
+    movq    %r12, %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_4
+.Lxly_f5_3:
+    call    xly_add
+.Lxly_f5_4:
+    movq    %rax, %rbx
+.Lxly_irf5_0_b4:
+.Lxly_irf5_0_b7:
+    movq    -88(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %xmm0
+    movsd   %xmm0, -560(%rbp)
+    leaq    -568(%rbp), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_6
+.Lxly_f5_5:
+    call    xly_add
+.Lxly_f5_6:
+    movq    %rax, -136(%rbp)
+.Lxly_irf5_0_b6:
+    call    xly_obj_new
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movabsq $0x406fe00000000000, %rax
+    movq    %rax, %r15
+.Lxly_irf5_0_b9:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -144(%rbp)
+    cmpq    $0, -144(%rbp)
+    je      .Lxly_irf5_0_b11
+.Lxly_irf5_0_b10:
+    leaq    .Lxly_irf5_0_k71(%rip), %rax
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rax
+    movq    %rax, -176(%rbp)
+    jmp     .Lxly_irf5_0_b8
+.Lxly_irf5_0_b11:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -160(%rbp)
+    cmpq    $0, -160(%rbp)
+    je      .Lxly_irf5_0_b13
+.Lxly_irf5_0_b12:
+    leaq    .Lxly_irf5_0_k72(%rip), %rax
+    movq    %rax, -168(%rbp)
+    movq    -168(%rbp), %rax
+    movq    %rax, -176(%rbp)
+    jmp     .Lxly_irf5_0_b8
+.Lxly_irf5_0_b13:
+    movq    %r14, -176(%rbp)
+.Lxly_irf5_0_b8:
+    movq    %r12, %rdi
+    movq    -176(%rbp), %rdx
+    movq    .Lxly_atom_af63ef4c86020cd5(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_irf5_0_b15:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf5_0_b17
+.Lxly_irf5_0_b16:
+    leaq    .Lxly_irf5_0_k73(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf5_0_b14
+.Lxly_irf5_0_b17:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf5_0_b19
+.Lxly_irf5_0_b18:
+    leaq    .Lxly_irf5_0_k74(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf5_0_b14
+.Lxly_irf5_0_b19:
+    movq    %rbx, %r14
+.Lxly_irf5_0_b14:
+    movq    %r12, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_af63da4c8601e926(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_irf5_0_b21:
+    movq    -136(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf5_0_b23
+.Lxly_irf5_0_b22:
+    leaq    .Lxly_irf5_0_k75(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf5_0_b20
+.Lxly_irf5_0_b23:
+    movq    -136(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf5_0_b25
+.Lxly_irf5_0_b24:
+    leaq    .Lxly_irf5_0_k76(%rip), %rax
+    movq    %rax, %r14
+    jmp     .Lxly_irf5_0_b20
+.Lxly_irf5_0_b25:
+    movq    -136(%rbp), %r14
+.Lxly_irf5_0_b20:
+    movq    %r12, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_af63df4c8601f1a5(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf5_0_k71:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf5_0_k72:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf5_0_k73:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf5_0_k74:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf5_0_k75:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf5_0_k76:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_animateValue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -148(%rbp)
+.Lxly_irf6_0_b3:
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f6_2
+.Lxly_f6_1:
+    call    xly_add
+.Lxly_f6_2:
+    movq    %rax, %r12
+.Lxly_irf6_0_b2:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_circleArea:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_circleCircumference:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x401921fb54442d18, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   3
+.Lxly_atoms:
+.Lxly_atom_af63ef4c86020cd5:
+    .quad   .Lxly_str_af63ef4c86020cd5
+.Lxly_atom_af63da4c8601e926:
+    .quad   .Lxly_str_af63da4c8601e926
+.Lxly_atom_af63df4c8601f1a5:
+    .quad   .Lxly_str_af63df4c8601f1a5
+
+.section .rodata
+.Lxly_str_ef9df8a7d78da26c:
+    .asciz  "=== Enhanced Math Library ==="
+.Lxly_str_5fdefecbf9229567:
+    .asciz  "1. Mathematical Constants"
+.Lxly_str_1e109364bb5394b0:
+    .asciz  "   Fundamental:"
+.Lxly_str_b8ed3c810bd091a3:
+    .asciz  "   PI ="
+.Lxly_str_5aa56640a894f44d:
+    .asciz  "   E ="
+.Lxly_str_f8085dda6504b7d1:
+    .asciz  "   Square Roots:"
+.Lxly_str_44210c83a1feb382:
+    .asciz  "   SQRT2 ="
+.Lxly_str_3b7763839d1666ad:
+    .asciz  "   SQRT3 ="
+.Lxly_str_4bb150245777c9af:
+    .asciz  "   Logarithms:"
+.Lxly_str_f0b7a0d2f50e46ae:
+    .asciz  "   LN2 ="
+.Lxly_str_c18d635db3a273cb:
+    .asciz  "   LN10 ="
+.Lxly_str_05061f5cdd9d428f:
+    .asciz  "2. Number Theory"
+.Lxly_str_69d2635ae5314e8b:
+    .asciz  "   Greatest Common Divisor:"
+.Lxly_str_712b2200c1b2c708:
+    .asciz  "   gcd(48, 18) ="
+.Lxly_str_6fc04b2957c84050:
+    .asciz  "   gcd(100, 35) ="
+.Lxly_str_89e4104e6d2b527f:
+    .asciz  "   Least Common Multiple:"
+.Lxly_str_0daf061f925a5b57:
+    .asciz  "   lcm(12, 18) ="
+.Lxly_str_4d36203935e829ab:
+    .asciz  "   lcm(4, 6) ="
+.Lxly_str_0034402c63473d73:
+    .asciz  "3. Interpolation Functions"
+.Lxly_str_186520a3409eaa93:
+    .asciz  "   Midpoint:"
+.Lxly_str_44864580f513d57e:
+    .asciz  "   midpoint(10, 20) ="
+.Lxly_str_491b7dd8971e4906:
+    .asciz  "   midpoint(-5, 5) ="
+.Lxly_str_6f17351fe1a1f84a:
+    .asciz  "   Linear Interpolation (lerp):"
+.Lxly_str_5e7df551a42003cf:
+    .asciz  "   lerp(0, 100, 0.0) ="
+.Lxly_str_da49f1be09177b92:
+    .asciz  "   lerp(0, 100, 0.25) ="
+.Lxly_str_c5293d6a621148c2:
+    .asciz  "   lerp(0, 100, 0.5) ="
+.Lxly_str_ba36ecf6324b87f5:
+    .asciz  "   lerp(0, 100, 0.75) ="
+.Lxly_str_132ddfb1a00584e2:
+    .asciz  "   lerp(0, 100, 1.0) ="
+.Lxly_str_71b51e7ad9211a41:
+    .asciz  "4. Saturating Arithmetic"
+.Lxly_str_75b095e680b1c06f:
+    .asciz  "   Saturating Addition:"
+.Lxly_str_3a4a698e0b3eb760:
+    .asciz  "   add_sat(2000000000, 1000000000) ="
+.Lxly_str_ec5aa02895f2ea9a:
+    .asciz  "   (normal would overflow)"
+.Lxly_str_c7a7ccf62b332f0d:
+    .asciz  "   Saturating Multiplication:"
+.Lxly_str_f4ab70f5f8d9fc26:
+    .asciz  "   mul_sat(1000000, 1000000) ="
+.Lxly_str_a3df72bf68887fa8:
+    .asciz  "   Clamping:"
+.Lxly_str_6c4ec5dc3222d7c1:
+    .asciz  "   clamp(150, 0, 100) ="
+.Lxly_str_bc345a0e1efb7440:
+    .asciz  "   clamp(50, 0, 100) ="
+.Lxly_str_141c9b79f9dfc491:
+    .asciz  "   clamp(-10, 0, 100) ="
+.Lxly_str_4487ab39c686271a:
+    .asciz  "5. Practical Example: Color Interpolation"
+.Lxly_str_33f2636a387dc72f:
+    .asciz  "   Interpolating from Red to Blue:"
+.Lxly_str_68d008a4a4b6b061:
+    .asciz  "   t=0.0: RGB("
+.Lxly_str_af63a14c8601884b:
+    .asciz  ","
+.Lxly_str_af63a44c86018d64:
+    .asciz  ")"
+.Lxly_str_fc0df519272fe820:
+    .asciz  "   t=0.25: RGB("
+.Lxly_str_c6e31e9523db1e76:
+    .asciz  "   t=0.5: RGB("
+.Lxly_str_8aa0b2757fbc90b1:
+    .asciz  "   t=0.75: RGB("
+.Lxly_str_d44a445cc774d596:
+    .asciz  "   t=1.0: RGB("
+.Lxly_str_b4d0ebbc39b64e40:
+    .asciz  "6. Animation with Linear Interpolation"
+.Lxly_str_afee3d885a35206b:
+    .asciz  "   Animating from 0 to 100:"
+.Lxly_str_198ce868bec576c5:
+    .asciz  "   Step"
+.Lxly_str_0a6b9d17f72a65cc:
+    .asciz  "(t="
+.Lxly_str_07dd8c07b4a336ba:
+    .asciz  "):"
+.Lxly_str_b00a6e8a40905d18:
+    .asciz  "7. Golden Ratio (Phi)"
+.Lxly_str_5d69e6e41f8dcee7:
+    .asciz  "   \317\206 (phi) ="
+.Lxly_str_01f918b94c634b85:
+    .asciz  "   \317\206\302\262 ="
+.Lxly_str_3e5b4bdadf6bea15:
+    .asciz  "   \317\206 - 1 ="
+.Lxly_str_80e378004e04da29:
+    .asciz  "   1/\317\206 ="
+.Lxly_str_7eb2d06aa4f962ca:
+    .asciz  "8. Circle Calculations with Pi"
+.Lxly_str_debc421e8617c1c3:
+    .asciz  "   For radius ="
+.Lxly_str_b44d56c405338f79:
+    .asciz  "   Area ="
+.Lxly_str_b9ff4a1f9c286b2f:
+    .asciz  "   Circumference ="
+.Lxly_str_e784670647c53246:
+    .asciz  "=== Math Library Summary ==="
+.Lxly_str_8defded122f8f8d6:
+    .asciz  "Functions demonstrated:"
+.Lxly_str_2db4f874455d2c41:
+    .asciz  "  \342\200\242 Mathematical constants (PI, E)"
+.Lxly_str_8cda6e8b4e7d967e:
+    .asciz  "  \342\200\242 Number theory (gcd, lcm)"
+.Lxly_str_34ab34c6c7b55373:
+    .asciz  "  \342\200\242 Interpolation (lerp, midpoint)"
+.Lxly_str_bc281abc23926ac1:
+    .asciz  "  \342\200\242 Saturating arithmetic (safe overflow)"
+.Lxly_str_46b30828c541f561:
+    .asciz  "  \342\200\242 Clamping (range limiting)"
+.Lxly_str_4e87b69b41d3d0e6:
+    .asciz  "  \342\200\242 Practical applications (colors, animation)"
+.Lxly_str_0067b6e7fc619b3e:
+    .asciz  "Total math functions: 85+"
+.Lxly_str_36eb0cd76d71e892:
+    .asciz  "For maximum performance:"
+.Lxly_str_58f3a12789eabff1:
+    .asciz  "  ./xenlyc -O3 math_demo.xe -o math_demo"
+.Lxly_str_52e657a54cd3dfc4:
+    .asciz  "  ./math_demo  # 18x faster!"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+.Lxly_str_af63ef4c86020cd5:
+    .asciz  "r"
+.Lxly_str_af63da4c8601e926:
+    .asciz  "g"
+.Lxly_str_af63df4c8601f1a5:
+    .asciz  "b"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   22
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   176
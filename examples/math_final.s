@@ -0,0 +1,1045 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $304, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_8a304ad16d1431e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1c03fff4533490b9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_37efa4d32d7b6033(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k170(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_409253d3325d988c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4005bf0a8b145769, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k171(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4a1c7ed33804d1b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x401d8e64b8d4ddae, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k172(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f80dc4b2ca4a1e16(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_70b4205a7065d05d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k173(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f3930c5998862629(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k174(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8450bd9f05dda3bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k175(%rip), %rax
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e9ffd29e13f43ecf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k176(%rip), %rax
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4410b0cf2d8eacb5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b6e2446f8ee50f99(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4090000000000000, %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k177(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e743c80ec82f9ebd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir0_k178(%rip), %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2bb7e266451ccf72(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4008000000000001, %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_ir0_k179(%rip), %rax
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3c42850b9c6dfcaf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k180(%rip), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_90a43b3eaedb3cb7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e0e88acbf3ff7df2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k181(%rip), %rax
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_42e5e2a158a99517(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k182(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_50f270729f0a3a83(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k183(%rip), %rax
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3b645c706a0ab5b6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_70c12a24bd14f58d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k184(%rip), %rax
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7999c924c224a226(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    movabsq $0x3ff921fb54442d18, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k185(%rip), %rax
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3ff59be14f4a03a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k186(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3678fce149ae42bf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k187(%rip), %rax
+    movq    %rax, -216(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4191db373ed8f65f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3fe921fb54442d18, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k188(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_76b0ebd59bb0d8d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, -232(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -232(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_42b200d5a8897cd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x3fd78b56362cef38, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x3ff2cd9fc44eb982, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x3ff8b07551d9f550, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k193(%rip), %rax
+    movq    %rax, -240(%rbp)
+    movq    -240(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_3b759d72b39621bf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    -248(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5aa7c8cc906c7500(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, -264(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8432eb2b8d9633eb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3fec34366179d426, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k196(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x3ff5124271980434, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, -272(%rbp)
+    movq    -272(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_a8326344fe3e8faa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    leaq    .Lxly_ir0_k198(%rip), %rax
+    movq    %rax, -288(%rbp)
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -288(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bf2cbc40596e1fd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_42df6334e421b2be(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x3fa999999999999a, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k201(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_ir0_k202(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movabsq $0x4099c2e294c95274, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k203(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_f8ed13ed1b43fbc5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k204(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k205(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_4e11f2b0ac30f57c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k206(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k207(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x4046800000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k208(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_b656cf8ab88030dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k209(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2a2c8a4d841a802e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_595e90a4836fb69f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9f184c8e0174c8f4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bc76691fc163c744(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_beffffaf7f11ce67(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a4ac87ec39ca6184(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_80860cc638a66bf0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_41e996c27139860f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1441dc37b6fedd5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_eeb4bb778a8eee42(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_11627fa735c317d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ac8ab13c6c6eb524(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c0a1304ec89a0f89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bbd42862b73777fa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k170:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k171:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k172:
+    .quad   0, 0x401d8e64b8d4ddae, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k173:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k174:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k175:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k176:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k177:
+    .quad   0, 0x4090000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k178:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k179:
+    .quad   0, 0x4008000000000001, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k180:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k181:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k182:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k183:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k184:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k185:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k186:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k187:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k188:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k189:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x3fd78b56362cef38, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x3ff2cd9fc44eb982, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k193:
+    .quad   0, 0x3ff8b07551d9f550, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x3ff2cd9fc44eb982, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x3ff8b07551d9f550, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k196:
+    .quad   0, 0x3fec34366179d426, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k197:
+    .quad   0, 0x3ff5124271980434, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k198:
+    .quad   0, 0x3fec34366179d426, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x3ff5124271980434, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k201:
+    .quad   0, 0x3fa999999999999a, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k202:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k203:
+    .quad   0, 0x4099c2e294c95274, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k204:
+    .quad   0, 0x4099c2e294c95274, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k205:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k206:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k207:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k208:
+    .quad   0, 0x4046800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k209:
+    .quad   0, 0x3fe921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k210:
+    .quad   0, 0x4046800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_8a304ad16d1431e3:
+    .asciz  "=== Complete Math Library ==="
+.Lxly_str_1c03fff4533490b9:
+    .asciz  "1. Exponential"
+.Lxly_str_37efa4d32d7b6033:
+    .asciz  "exp(0):"
+.Lxly_str_409253d3325d988c:
+    .asciz  "exp(1):"
+.Lxly_str_4a1c7ed33804d1b5:
+    .asciz  "exp(2):"
+.Lxly_str_f80dc4b2ca4a1e16:
+    .asciz  "2. Logarithmic"
+.Lxly_str_70b4205a7065d05d:
+    .asciz  "log(1):"
+.Lxly_str_f3930c5998862629:
+    .asciz  "log(e):"
+.Lxly_str_8450bd9f05dda3bc:
+    .asciz  "log10(100):"
+.Lxly_str_e9ffd29e13f43ecf:
+    .asciz  "log2(1024):"
+.Lxly_str_4410b0cf2d8eacb5:
+    .asciz  "3. Power"
+.Lxly_str_b6e2446f8ee50f99:
+    .asciz  "pow(2, 10):"
+.Lxly_str_e743c80ec82f9ebd:
+    .asciz  "sqrt(16):"
+.Lxly_str_2bb7e266451ccf72:
+    .asciz  "cbrt(27):"
+.Lxly_str_3c42850b9c6dfcaf:
+    .asciz  "hypot(3, 4):"
+.Lxly_str_90a43b3eaedb3cb7:
+    .asciz  "4. Trigonometric"
+.Lxly_str_e0e88acbf3ff7df2:
+    .asciz  "sin(0):"
+.Lxly_str_42e5e2a158a99517:
+    .asciz  "cos(0):"
+.Lxly_str_50f270729f0a3a83:
+    .asciz  "tan(0):"
+.Lxly_str_3b645c706a0ab5b6:
+    .asciz  "5. Arc Trigonometric"
+.Lxly_str_70c12a24bd14f58d:
+    .asciz  "asin(0):"
+.Lxly_str_7999c924c224a226:
+    .asciz  "asin(1):"
+.Lxly_str_3ff59be14f4a03a8:
+    .asciz  "acos(0):"
+.Lxly_str_3678fce149ae42bf:
+    .asciz  "acos(1):"
+.Lxly_str_4191db373ed8f65f:
+    .asciz  "atan(1):"
+.Lxly_str_76b0ebd59bb0d8d4:
+    .asciz  "atan2(1, 1):"
+.Lxly_str_42b200d5a8897cd8:
+    .asciz  "6. Hyperbolic"
+.Lxly_str_3b759d72b39621bf:
+    .asciz  "sinh(1):"
+.Lxly_str_5aa7c8cc906c7500:
+    .asciz  "cosh(1):"
+.Lxly_str_8432eb2b8d9633eb:
+    .asciz  "7. Inverse Hyperbolic"
+.Lxly_str_a8326344fe3e8faa:
+    .asciz  "asinh(1):"
+.Lxly_str_bf2cbc40596e1fd8:
+    .asciz  "acosh(2):"
+.Lxly_str_42df6334e421b2be:
+    .asciz  "8. Applications"
+.Lxly_str_f8ed13ed1b43fbc5:
+    .asciz  "Population growth:"
+.Lxly_str_4e11f2b0ac30f57c:
+    .asciz  "Distance (3,4):"
+.Lxly_str_b656cf8ab88030dd:
+    .asciz  "Angle (radians):"
+.Lxly_str_2a2c8a4d841a802e:
+    .asciz  "Angle (degrees):"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_595e90a4836fb69f:
+    .asciz  "Total Functions: 105+"
+.Lxly_str_9f184c8e0174c8f4:
+    .asciz  "  Exponential & Logarithmic: 12"
+.Lxly_str_bc76691fc163c744:
+    .asciz  "  Power: 8"
+.Lxly_str_beffffaf7f11ce67:
+    .asciz  "  Hyperbolic: 12"
+.Lxly_str_a4ac87ec39ca6184:
+    .asciz  "  Trigonometric: 18"
+.Lxly_str_80860cc638a66bf0:
+    .asciz  "  Arc Functions: 13"
+.Lxly_str_41e996c27139860f:
+    .asciz  "  Complex Numbers: 6"
+.Lxly_str_1441dc37b6fedd5a:
+    .asciz  "  Statistics: 6"
+.Lxly_str_eeb4bb778a8eee42:
+    .asciz  "  Number Theory: 5"
+.Lxly_str_11627fa735c317d6:
+    .asciz  "  Others: 25+"
+.Lxly_str_ac8ab13c6c6eb524:
+    .asciz  "Compile for speed:"
+.Lxly_str_c0a1304ec89a0f89:
+    .asciz  "  ./xenlyc -O3 program.xe -o program"
+.Lxly_str_bbd42862b73777fa:
+    .asciz  "  18x faster execution!"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   13
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   104
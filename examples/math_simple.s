@@ -0,0 +1,1573 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $368, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movl    $-1, -332(%rbp)
+    movl    $-1, -204(%rbp)
+    leaq    .Lxly_str_ef9df8a7d78da26c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5fdefecbf9229567(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_fa2ea440719c049a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k316(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3970a17e16c020c4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4005bf0a8b145769, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k317(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fb386559296f3184(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x3ff6a09e667f3bcd, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k318(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f36f36592545c36b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x3ffbb67ae8584caa, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k319(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_05061f5cdd9d428f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4cef234202e034a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k320(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k321(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_gcd
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8abc33d3b12024ff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4041800000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k322(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k323(%rip), %rax
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_gcd
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_850dd93ff74889de(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k324(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k325(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_lcm
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b508e34602daf6d2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k326(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k327(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_lcm
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e3628c767eca428d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d74ee177a78329e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b5:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k328(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_71331440958033b9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b7:
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k329(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f11bde77b612f009(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b9:
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k330(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f2fae65840d9f5bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b11:
+    movabsq $0x4052c00000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k331(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1f233a6d482a73a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b13:
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k332(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_94be8b42346085b8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_fcb47b6c94ddfab5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b15:
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k333(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bc2b58ad32e09299(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b17:
+.Lxly_ir0_b16:
+    leaq    .Lxly_ir0_k334(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_34e9d9cda5e2d3e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b19:
+.Lxly_ir0_b18:
+    leaq    .Lxly_ir0_k335(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2051110d7ed5ced4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3139f189a0c723e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b21:
+.Lxly_ir0_b22:
+.Lxly_ir0_b20:
+    leaq    .Lxly_ir0_k336(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cf99aeaab2fa252f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b27:
+.Lxly_ir0_b29:
+.Lxly_ir0_b31:
+.Lxly_ir0_b26:
+    leaq    .Lxly_ir0_k337(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ccb1d9b74e41c598(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b33:
+.Lxly_ir0_b35:
+.Lxly_ir0_b36:
+.Lxly_ir0_b32:
+    leaq    .Lxly_ir0_k338(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f31eef95546a629f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x41dfffffffc00000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k339(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x41ddcd6500000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k340(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x41cdcd6500000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k341(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_db3e9fbd3d04bc44(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f73d6909be1d054f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b39:
+.Lxly_ir0_b40:
+.Lxly_ir0_b38:
+    leaq    .Lxly_ir0_k342(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e56b8c6c9f57ea7f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5d05d4e6be16c14f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k343(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_e061434d6e092eed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k344(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_54d59df4178d6650(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b45:
+    movabsq $0x4053a28c59d5433b, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b44:
+    leaq    .Lxly_ir0_k345(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1cb1ba28adf7b546(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b47:
+    movabsq $0x403f6a7a2955385e, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b46:
+    leaq    .Lxly_ir0_k346(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1f0a2eccb2f16493(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x4001e3779b97f4a8, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k347(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x3ff9e3779b97f4a8, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k348(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_ad58c2807485f360(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k349(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6e4774f2083252a0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4004f1bbcdcbfa54, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k350(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_13270eba9837aed6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_afee3d885a35206b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k351(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_39aa1c7e16f0b70c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_str_2127b9cf1a4dd155(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -96(%rbp)
+    movq    %r14, %r12
+.Lxly_ir0_b1:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b49:
+    movq    -48(%rbp), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+.Lxly_ir0_b48:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -232(%rbp)
+    leaq    -240(%rbp), %rax
+    movq    %rax, %r13
+    movq    -104(%rbp), %xmm0
+    movsd   %xmm0, -360(%rbp)
+    leaq    -368(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $32, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %r12, %xmm0
+    movq    -96(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movq    %rbx, %r12
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e784670647c53246(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_014c7682d3c5bab8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_78598cc849f505ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3e2dc6d109f2b93a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f1506bca415ad275(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c6f2d147ee0fa9c6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c4f798ba12aadc9f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ac8ab13c6c6eb524(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_73dfcfdf047e8e56(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0452a048070887ea(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k316:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k317:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k318:
+    .quad   0, 0x3ff6a09e667f3bcd, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k319:
+    .quad   0, 0x3ffbb67ae8584caa, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k320:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k321:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k322:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k323:
+    .quad   0, 0x4041800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k324:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k325:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k326:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k327:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k328:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k329:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k330:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k331:
+    .quad   0, 0x4052c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k332:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k333:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k334:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k335:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k336:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k337:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k338:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k339:
+    .quad   0, 0x41dfffffffc00000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k340:
+    .quad   0, 0x41ddcd6500000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k341:
+    .quad   0, 0x41cdcd6500000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k342:
+    .quad   0, 0x41dfffffffc00000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k343:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k344:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k345:
+    .quad   0, 0x4053a28c59d5433b, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k346:
+    .quad   0, 0x403f6a7a2955385e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k347:
+    .quad   0, 0x4001e3779b97f4a8, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k348:
+    .quad   0, 0x3ff9e3779b97f4a8, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k349:
+    .quad   0, 0x3ff9e3779b97f4a8, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k350:
+    .quad   0, 0x4004f1bbcdcbfa54, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k351:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_lerp:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -148(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_midpoint:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -140(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_clamp:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f2_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf2_0_b2
+.Lxly_irf2_0_b1:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b2:
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f2_4
+.Lxly_f2_3:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f2_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf2_0_b5
+.Lxly_irf2_0_b4:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b5:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_add_sat:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_add
+.Lxly_f3_2:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_4
+.Lxly_f3_3:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_4:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b2
+.Lxly_irf3_0_b1:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b2:
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_6
+.Lxly_f3_5:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_6:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf3_0_b5
+.Lxly_irf3_0_b4:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b5:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_circleArea:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_circleCircumference:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x401921fb54442d18, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_ef9df8a7d78da26c:
+    .asciz  "=== Enhanced Math Library ==="
+.Lxly_str_5fdefecbf9229567:
+    .asciz  "1. Mathematical Constants"
+.Lxly_str_fa2ea440719c049a:
+    .asciz  "   PI:"
+.Lxly_str_3970a17e16c020c4:
+    .asciz  "   E:"
+.Lxly_str_fb386559296f3184:
+    .asciz  "   SQRT(2):"
+.Lxly_str_f36f36592545c36b:
+    .asciz  "   SQRT(3):"
+.Lxly_str_05061f5cdd9d428f:
+    .asciz  "2. Number Theory"
+.Lxly_str_4cef234202e034a7:
+    .asciz  "   GCD(48, 18):"
+.Lxly_str_8abc33d3b12024ff:
+    .asciz  "   GCD(100, 35):"
+.Lxly_str_850dd93ff74889de:
+    .asciz  "   LCM(12, 18):"
+.Lxly_str_b508e34602daf6d2:
+    .asciz  "   LCM(4, 6):"
+.Lxly_str_e3628c767eca428d:
+    .asciz  "3. Linear Interpolation (lerp)"
+.Lxly_str_d74ee177a78329e6:
+    .asciz  "   lerp(0, 100, 0.0):"
+.Lxly_str_71331440958033b9:
+    .asciz  "   lerp(0, 100, 0.25):"
+.Lxly_str_f11bde77b612f009:
+    .asciz  "   lerp(0, 100, 0.5):"
+.Lxly_str_f2fae65840d9f5bc:
+    .asciz  "   lerp(0, 100, 0.75):"
+.Lxly_str_1f233a6d482a73a9:
+    .asciz  "   lerp(0, 100, 1.0):"
+.Lxly_str_94be8b42346085b8:
+    .asciz  "4. Midpoint Calculation"
+.Lxly_str_fcb47b6c94ddfab5:
+    .asciz  "   midpoint(10, 20):"
+.Lxly_str_bc2b58ad32e09299:
+    .asciz  "   midpoint(0, 100):"
+.Lxly_str_34e9d9cda5e2d3e3:
+    .asciz  "   midpoint(-10, 10):"
+.Lxly_str_2051110d7ed5ced4:
+    .asciz  "5. Value Clamping"
+.Lxly_str_3139f189a0c723e8:
+    .asciz  "   clamp(150, 0, 100):"
+.Lxly_str_cf99aeaab2fa252f:
+    .asciz  "   clamp(50, 0, 100):"
+.Lxly_str_ccb1d9b74e41c598:
+    .asciz  "   clamp(-10, 0, 100):"
+.Lxly_str_f31eef95546a629f:
+    .asciz  "6. Saturating Arithmetic"
+.Lxly_str_db3e9fbd3d04bc44:
+    .asciz  "   Safe addition:"
+.Lxly_str_f73d6909be1d054f:
+    .asciz  "   add_sat(2000000000, 1000000000):"
+.Lxly_str_e56b8c6c9f57ea7f:
+    .asciz  "   (prevents overflow)"
+.Lxly_str_5d05d4e6be16c14f:
+    .asciz  "7. Circle with Pi"
+.Lxly_str_e061434d6e092eed:
+    .asciz  "   Radius:"
+.Lxly_str_54d59df4178d6650:
+    .asciz  "   Area:"
+.Lxly_str_1cb1ba28adf7b546:
+    .asciz  "   Circumference:"
+.Lxly_str_1f0a2eccb2f16493:
+    .asciz  "8. Golden Ratio"
+.Lxly_str_ad58c2807485f360:
+    .asciz  "   Phi:"
+.Lxly_str_6e4774f2083252a0:
+    .asciz  "   Phi^2:"
+.Lxly_str_13270eba9837aed6:
+    .asciz  "9. Animation Example"
+.Lxly_str_afee3d885a35206b:
+    .asciz  "   Animating from 0 to 100:"
+.Lxly_str_39aa1c7e16f0b70c:
+    .asciz  "   t="
+.Lxly_str_2127b9cf1a4dd155:
+    .asciz  "value="
+.Lxly_str_e784670647c53246:
+    .asciz  "=== Math Library Summary ==="
+.Lxly_str_014c7682d3c5bab8:
+    .asciz  "Functions: 85+"
+.Lxly_str_78598cc849f505ba:
+    .asciz  "  - Constants: PI, E, PHI, SQRT2, etc."
+.Lxly_str_3e2dc6d109f2b93a:
+    .asciz  "  - Number theory: gcd, lcm"
+.Lxly_str_f1506bca415ad275:
+    .asciz  "  - Interpolation: lerp, midpoint"
+.Lxly_str_c6f2d147ee0fa9c6:
+    .asciz  "  - Saturating: add_sat, sub_sat, mul_sat, div_sat"
+.Lxly_str_c4f798ba12aadc9f:
+    .asciz  "  - Clamping: clamp, saturate_cast"
+.Lxly_str_ac8ab13c6c6eb524:
+    .asciz  "Compile for speed:"
+.Lxly_str_73dfcfdf047e8e56:
+    .asciz  "  ./xenlyc -O3 math_simple.xe -o math"
+.Lxly_str_0452a048070887ea:
+    .asciz  "  ./math  # 18x faster!"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   7
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   56
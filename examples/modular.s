@@ -0,0 +1,1530 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $2784, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -2776(%rbp)
+    movq    %rax, -2768(%rbp)
+    movq    %rax, -2760(%rbp)
+    movq    %rax, -2752(%rbp)
+    movq    %rax, -2744(%rbp)
+    movq    %rax, -2736(%rbp)
+    movq    %rax, -2728(%rbp)
+    movq    %rax, -2720(%rbp)
+    movq    %rax, -2712(%rbp)
+    movq    %rax, -2704(%rbp)
+    movq    %rax, -2696(%rbp)
+    movq    %rax, -2688(%rbp)
+    movq    %rax, -2680(%rbp)
+    movq    %rax, -2672(%rbp)
+    movq    %rax, -2664(%rbp)
+    movq    %rax, -2656(%rbp)
+    movq    %rax, -2648(%rbp)
+    movq    %rax, -2640(%rbp)
+    movq    %rax, -2632(%rbp)
+    movq    %rax, -2624(%rbp)
+    movq    %rax, -2616(%rbp)
+    movq    %rax, -2608(%rbp)
+    movq    %rax, -2600(%rbp)
+    movq    %rax, -2592(%rbp)
+    movq    %rax, -2584(%rbp)
+    movq    %rax, -2576(%rbp)
+    movq    %rax, -2568(%rbp)
+    movq    %rax, -2560(%rbp)
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movl    $-1, -2740(%rbp)
+    movl    $-1, -2612(%rbp)
+    movl    $-1, -2484(%rbp)
+    movl    $-1, -2356(%rbp)
+    movl    $-1, -2228(%rbp)
+    movl    $-1, -2100(%rbp)
+    movl    $-1, -1972(%rbp)
+    movl    $-1, -1844(%rbp)
+    movl    $-1, -1716(%rbp)
+    movl    $-1, -1588(%rbp)
+    movl    $-1, -1460(%rbp)
+    movl    $-1, -1332(%rbp)
+    movl    $-1, -1204(%rbp)
+    movl    $-1, -1076(%rbp)
+    movl    $-1, -948(%rbp)
+    movl    $-1, -820(%rbp)
+    leaq    .Lxly_str_1133585740502798(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_620f8802885c5934(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_51c7dc3cf57b90f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f4af8dfdfc72c7c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2a785ed118c0b3b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3b90f0855eebf0c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5ca3d4aca8beb4ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k187(%rip), %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir0_k188(%rip), %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $32, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_d10152952fb94a7c(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -104(%rbp)
+    movq    -64(%rbp), %rdi
+    movq    -104(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -848(%rbp)
+    leaq    -856(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d599e49ffcf0facb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    movabsq $0xc014000000000000, %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, -152(%rbp)
+    subq    $32, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_d10152952fb94a7c(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -160(%rbp)
+    movq    -120(%rbp), %rdi
+    movq    -160(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -976(%rbp)
+    leaq    -984(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d467c16a5719255c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_ir0_k193(%rip), %rax
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $32, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_d10152952fb94a7c(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, %rbx
+    movq    -176(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1104(%rbp)
+    leaq    -1112(%rbp), %rax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, -216(%rbp)
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f18ab2f99d24643c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -224(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x3fd0000000000000, %rax
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k196(%rip), %rax
+    movq    %rax, -240(%rbp)
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_ir0_k198(%rip), %rax
+    movq    %rax, -256(%rbp)
+    subq    $32, %rsp
+    movq    -240(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_24d97cada2273628(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -264(%rbp)
+    movq    -224(%rbp), %rdi
+    movq    -264(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1232(%rbp)
+    leaq    -1240(%rbp), %rax
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, -272(%rbp)
+    subq    $16, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7cdaf5a454215c45(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    movabsq $0x3fe8000000000000, %rax
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k201(%rip), %rax
+    movq    %rax, %rbx
+    subq    $32, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_24d97cada2273628(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -312(%rbp)
+    movq    -280(%rbp), %rdi
+    movq    -312(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1360(%rbp)
+    leaq    -1368(%rbp), %rax
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_add
+.Lxly_10:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2e29e4667232d55a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, -320(%rbp)
+    leaq    .Lxly_ir0_k202(%rip), %rax
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    -328(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_4e0f7f18e637a364(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movq    %rbx, %rdi
+    movq    -336(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1488(%rbp)
+    leaq    -1496(%rbp), %rax
+    jmp     .Lxly_12
+.Lxly_11:
+    call    xly_add
+.Lxly_12:
+    movq    %rax, -344(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0d510492f4f2ce68(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0xc01c000000000000, %rax
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_ir0_k203(%rip), %rax
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_4e0f7f18e637a364(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -368(%rbp)
+    movq    %rbx, %rdi
+    movq    -368(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1616(%rbp)
+    leaq    -1624(%rbp), %rax
+    jmp     .Lxly_14
+.Lxly_13:
+    call    xly_add
+.Lxly_14:
+    movq    %rax, -376(%rbp)
+    subq    $16, %rsp
+    movq    -376(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_20219b0ccd2ee33a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k204(%rip), %rax
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_4e0f7f18e637a364(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -392(%rbp)
+    movq    %rbx, %rdi
+    movq    -392(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1744(%rbp)
+    leaq    -1752(%rbp), %rax
+    jmp     .Lxly_16
+.Lxly_15:
+    call    xly_add
+.Lxly_16:
+    movq    %rax, -400(%rbp)
+    subq    $16, %rsp
+    movq    -400(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9845c822c52b82af(%rip), %rdi
+    call    xly_str
+    movq    %rax, -408(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -416(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -424(%rbp)
+    leaq    .Lxly_ir0_k205(%rip), %rax
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir0_k206(%rip), %rax
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_ir0_k207(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k208(%rip), %rax
+    movq    %rax, -448(%rbp)
+    subq    $32, %rsp
+    movq    -432(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -440(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 16(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_dd6fbd38986b7842(%rip), %rsi
+    movl    $4, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -456(%rbp)
+    movq    -408(%rbp), %rdi
+    movq    -456(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1872(%rbp)
+    leaq    -1880(%rbp), %rax
+    jmp     .Lxly_18
+.Lxly_17:
+    call    xly_add
+.Lxly_18:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_256cf101b99514bd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -464(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k209(%rip), %rax
+    movq    %rax, -472(%rbp)
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, -480(%rbp)
+    leaq    .Lxly_ir0_k211(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k212(%rip), %rax
+    movq    %rax, -488(%rbp)
+    subq    $32, %rsp
+    movq    -472(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -480(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 16(%rsp)
+    movq    -488(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_bd45fa4f3e5d1248(%rip), %rdi
+    leaq    .Lxly_str_dd6fbd38986b7842(%rip), %rsi
+    movl    $4, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -496(%rbp)
+    movq    -464(%rbp), %rdi
+    movq    -496(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2000(%rbp)
+    leaq    -2008(%rbp), %rax
+    jmp     .Lxly_20
+.Lxly_19:
+    call    xly_add
+.Lxly_20:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3fdf828de9d8654e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_e70bc3190530e654(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -504(%rbp)
+    movq    -504(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_da5201d3f41b49b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -512(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -520(%rbp)
+    movq    -512(%rbp), %rdi
+    movq    -520(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2128(%rbp)
+    leaq    -2136(%rbp), %rax
+    jmp     .Lxly_22
+.Lxly_21:
+    call    xly_add
+.Lxly_22:
+    movq    %rax, -528(%rbp)
+    subq    $16, %rsp
+    movq    -528(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_08158224f5635984(%rip), %rdi
+    call    xly_str
+    movq    %rax, -536(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -544(%rbp)
+    movq    -536(%rbp), %rdi
+    movq    -544(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2256(%rbp)
+    leaq    -2264(%rbp), %rax
+    jmp     .Lxly_24
+.Lxly_23:
+    call    xly_add
+.Lxly_24:
+    movq    %rax, -552(%rbp)
+    subq    $16, %rsp
+    movq    -552(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_028f7d67be1c74d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -560(%rbp)
+    movq    -504(%rbp), %rdi
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -568(%rbp)
+    movq    -560(%rbp), %rdi
+    movq    -568(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2384(%rbp)
+    leaq    -2392(%rbp), %rax
+    jmp     .Lxly_26
+.Lxly_25:
+    call    xly_add
+.Lxly_26:
+    movq    %rax, -576(%rbp)
+    subq    $16, %rsp
+    movq    -576(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0f7b718718a258f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -584(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_ea11573f1af59eb5(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -592(%rbp)
+    movq    -584(%rbp), %rdi
+    movq    -592(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2512(%rbp)
+    leaq    -2520(%rbp), %rax
+    jmp     .Lxly_28
+.Lxly_27:
+    call    xly_add
+.Lxly_28:
+    movq    %rax, -600(%rbp)
+    subq    $16, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_e2777217e756100a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -608(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -616(%rbp)
+    movq    -608(%rbp), %rdi
+    movq    -616(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2640(%rbp)
+    leaq    -2648(%rbp), %rax
+    jmp     .Lxly_30
+.Lxly_29:
+    call    xly_add
+.Lxly_30:
+    movq    %rax, -624(%rbp)
+    subq    $16, %rsp
+    movq    -624(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_59240687dc9bfad6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -632(%rbp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+    movq    %rax, -640(%rbp)
+    movq    -632(%rbp), %rdi
+    movq    -640(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_31
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2768(%rbp)
+    leaq    -2776(%rbp), %rax
+    jmp     .Lxly_32
+.Lxly_31:
+    call    xly_add
+.Lxly_32:
+    movq    %rax, -648(%rbp)
+    subq    $16, %rsp
+    movq    -648(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_650399bfdb5d53ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, -656(%rbp)
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -664(%rbp)
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -672(%rbp)
+    leaq    .Lxly_ir0_k213(%rip), %rax
+    movq    %rax, -680(%rbp)
+    leaq    .Lxly_ir0_k214(%rip), %rax
+    movq    %rax, -688(%rbp)
+    subq    $16, %rsp
+    movq    -680(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -688(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_4e585eeea351a038(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -696(%rbp)
+    movq    -656(%rbp), %rdi
+    movq    -696(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_33
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_34
+.Lxly_33:
+    call    xly_add
+.Lxly_34:
+    movq    %rax, -704(%rbp)
+    subq    $16, %rsp
+    movq    -704(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_55102c952576759a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -712(%rbp)
+    leaq    .Lxly_ir0_k215(%rip), %rax
+    movq    %rax, -720(%rbp)
+    leaq    .Lxly_ir0_k216(%rip), %rax
+    movq    %rax, -728(%rbp)
+    subq    $16, %rsp
+    movq    -720(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -728(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rdi
+    leaq    .Lxly_str_4e585eeea351a038(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    -712(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_36
+.Lxly_35:
+    call    xly_add
+.Lxly_36:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_205834b3d83c42cb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_52be4f249b757372(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c0604373f57407a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a29fe11631b536d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbe38a36325fc50f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5bf68ac8bc0ada84(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ba2ec0edba4f3a43(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d80c09d44d001c17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_73bbe8cd107ae725(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_102391016e6dbf6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k187:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k188:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k189:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0xc014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k193:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k196:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k197:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k198:
+    .quad   0, 0x3fd0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k201:
+    .quad   0, 0x3fe8000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k202:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k203:
+    .quad   0, 0xc01c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k204:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k205:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k206:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k207:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k208:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k209:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k210:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k211:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k212:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k213:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k214:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k215:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k216:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_1133585740502798:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_620f8802885c5934:
+    .asciz  "\342\225\221     Xenly Modular Programming            \342\225\221"
+.Lxly_str_51c7dc3cf57b90f0:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_f4af8dfdfc72c7c1:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_2a785ed118c0b3b4:
+    .asciz  "\342\224\202  Exported functions from mathutils         \342\224\202"
+.Lxly_str_3b90f0855eebf0c1:
+    .asciz  "\342\224\224\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\230"
+.Lxly_str_5ca3d4aca8beb4ef:
+    .asciz  "  clamp(15, 0, 10)   = "
+.Lxly_str_bd45fa4f3e5d1248:
+    .asciz  "mathutils"
+.Lxly_str_d10152952fb94a7c:
+    .asciz  "clamp"
+.Lxly_str_d599e49ffcf0facb:
+    .asciz  "  clamp(-5, 0, 10)   = "
+.Lxly_str_d467c16a5719255c:
+    .asciz  "  clamp(7, 0, 10)    = "
+.Lxly_str_f18ab2f99d24643c:
+    .asciz  "  lerp(0, 100, 0.25) = "
+.Lxly_str_24d97cada2273628:
+    .asciz  "lerp"
+.Lxly_str_7cdaf5a454215c45:
+    .asciz  "  lerp(0, 100, 0.75) = "
+.Lxly_str_2e29e4667232d55a:
+    .asciz  "  sign(42)           = "
+.Lxly_str_4e0f7f18e637a364:
+    .asciz  "sign"
+.Lxly_str_0d510492f4f2ce68:
+    .asciz  "  sign(-7)           = "
+.Lxly_str_20219b0ccd2ee33a:
+    .asciz  "  sign(0)            = "
+.Lxly_str_9845c822c52b82af:
+    .asciz  "  distance(0,0,3,4)  = "
+.Lxly_str_dd6fbd38986b7842:
+    .asciz  "distance"
+.Lxly_str_256cf101b99514bd:
+    .asciz  "  distance(1,1,4,5)  = "
+.Lxly_str_3fdf828de9d8654e:
+    .asciz  "\342\224\202  Exported classes from shapes              \342\224\202"
+.Lxly_str_e70bc3190530e654:
+    .asciz  "add"
+.Lxly_str_da5201d3f41b49b5:
+    .asciz  "  v1            = "
+.Lxly_str_ce3424bd1d05d5bc:
+    .asciz  "to_string"
+.Lxly_str_08158224f5635984:
+    .asciz  "  v2            = "
+.Lxly_str_028f7d67be1c74d0:
+    .asciz  "  v1 + v2       = "
+.Lxly_str_0f7b718718a258f6:
+    .asciz  "  v1.length()   = "
+.Lxly_str_ea11573f1af59eb5:
+    .asciz  "length"
+.Lxly_str_e2777217e756100a:
+    .asciz  "  r             = "
+.Lxly_str_59240687dc9bfad6:
+    .asciz  "  r.area()      = "
+.Lxly_str_89502e843ec2b8c4:
+    .asciz  "area"
+.Lxly_str_650399bfdb5d53ba:
+    .asciz  "  r.contains(50, 30) = "
+.Lxly_str_4e585eeea351a038:
+    .asciz  "contains"
+.Lxly_str_55102c952576759a:
+    .asciz  "  r.contains(5, 5)   = "
+.Lxly_str_205834b3d83c42cb:
+    .asciz  "\342\224\202  instanceof across modules                 \342\224\202"
+.Lxly_str_52be4f249b757372:
+    .asciz  "  v1 instanceof Vec2  = false"
+.Lxly_str_c0604373f57407a5:
+    .asciz  "  r  instanceof Rect  = false"
+.Lxly_str_a29fe11631b536d0:
+    .asciz  "  v1 instanceof Rect  = false"
+.Lxly_str_cbe38a36325fc50f:
+    .asciz  "\342\224\202  typeof on module objects                  \342\224\202"
+.Lxly_str_5bf68ac8bc0ada84:
+    .asciz  "  typeof(v1)          = null"
+.Lxly_str_ba2ec0edba4f3a43:
+    .asciz  "  typeof(r)           = null"
+.Lxly_str_d80c09d44d001c17:
+    .asciz  "  typeof(Vec2)        = null"
+.Lxly_str_73bbe8cd107ae725:
+    .asciz  "  typeof(Rect)        = null"
+.Lxly_str_102391016e6dbf6b:
+    .asciz  "\342\225\221   All modular programming tests passed!  \342\225\221"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   4
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   32
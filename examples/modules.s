@@ -0,0 +1,711 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $128, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_78734d0b26bdb5c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_69933f447ab2c278(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k99(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_771f093271dccdc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k100(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a6f0c25d8a499f94(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4090000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k101(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d9214be756e110e1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k102(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_38cbaf145b8c0973(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k103(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d4d8f9867579222d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k104(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_27276c8f8c7fb9b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k105(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_26b7af4d122e2557(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k106(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ac917008971d6f53(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k107(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e1e2b4c850803c26(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k108(%rip), %rax
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_07be51daf5695970(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k109(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_17fd5a643237c6e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    xorq    %rdi, %rdi
+    movl    $0, %esi
+    call    xly_math_random
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0ac492cd13e66f40(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bb06be02d72dfac0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_53fd2198005596a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2dc145b581787401(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_trim
+    addq    $16, %rsp
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f62d0db35cb53efd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_upper
+    addq    $16, %rsp
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_97752c25e0ed0a3c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_lower
+    addq    $16, %rsp
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e32cd69cd36210fa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f5f24e28691fb21f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_8b2c8cffc22798f7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_reverse
+    addq    $16, %rsp
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_827507951ff1d849(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k110(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_repeat
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0f4ae699ea61c966(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_35115f11b08dc61b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_contains
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2374316b9b449782(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_bbad9f715d040661(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_4b6ebd1433656d9c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_6a771318f6fe2cb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_replace
+    addq    $32, %rsp
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5bc1db975318900e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k111(%rip), %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k112(%rip), %rax
+    movq    %rax, %rbx
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_substr
+    addq    $32, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_600efa50941b0a23(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6647529aa8ace71b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_0ab10c61c959417c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_a77ef5fb1d51f33a(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    leaq    .Lxly_str_d211b4e1b0aaf5a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_c9e2aa83d2171445(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_b2dea4650e7a6ce3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_a77ef5fb1d51f33a(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, %r15
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k99:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k100:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k101:
+    .quad   0, 0x4090000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k102:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k103:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k104:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k105:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k106:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k107:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k108:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k109:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k110:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k111:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k112:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_78734d0b26bdb5c9:
+    .asciz  "=== Math Module ==="
+.Lxly_str_69933f447ab2c278:
+    .asciz  "abs(-42)    ="
+.Lxly_str_771f093271dccdc0:
+    .asciz  "sqrt(144)   ="
+.Lxly_str_a6f0c25d8a499f94:
+    .asciz  "pow(2, 10)  ="
+.Lxly_str_d9214be756e110e1:
+    .asciz  "floor(3.7)  ="
+.Lxly_str_38cbaf145b8c0973:
+    .asciz  "ceil(3.2)   ="
+.Lxly_str_d4d8f9867579222d:
+    .asciz  "round(3.5)  ="
+.Lxly_str_27276c8f8c7fb9b5:
+    .asciz  "max(10, 25) ="
+.Lxly_str_26b7af4d122e2557:
+    .asciz  "min(10, 25) ="
+.Lxly_str_ac917008971d6f53:
+    .asciz  "sin(0)      ="
+.Lxly_str_e1e2b4c850803c26:
+    .asciz  "cos(0)      ="
+.Lxly_str_07be51daf5695970:
+    .asciz  "log(1)      ="
+.Lxly_str_17fd5a643237c6e8:
+    .asciz  "random()    ="
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_0ac492cd13e66f40:
+    .asciz  "=== String Module ==="
+.Lxly_str_bb06be02d72dfac0:
+    .asciz  "  Hello, Xenly World!  "
+.Lxly_str_53fd2198005596a8:
+    .asciz  "original  :"
+.Lxly_str_2dc145b581787401:
+    .asciz  "trim      :"
+.Lxly_str_f62d0db35cb53efd:
+    .asciz  "upper     :"
+.Lxly_str_97752c25e0ed0a3c:
+    .asciz  "lower     :"
+.Lxly_str_e32cd69cd36210fa:
+    .asciz  "len       :"
+.Lxly_str_f5f24e28691fb21f:
+    .asciz  "Xenly"
+.Lxly_str_8b2c8cffc22798f7:
+    .asciz  "reverse   :"
+.Lxly_str_827507951ff1d849:
+    .asciz  "repeat x3 :"
+.Lxly_str_0f4ae699ea61c966:
+    .asciz  "contains  :"
+.Lxly_str_35115f11b08dc61b:
+    .asciz  "Hello Xenly"
+.Lxly_str_2374316b9b449782:
+    .asciz  "The quick brown fox"
+.Lxly_str_bbad9f715d040661:
+    .asciz  "replace   :"
+.Lxly_str_4b6ebd1433656d9c:
+    .asciz  "quick"
+.Lxly_str_6a771318f6fe2cb8:
+    .asciz  "slow"
+.Lxly_str_5bc1db975318900e:
+    .asciz  "substr    :"
+.Lxly_str_600efa50941b0a23:
+    .asciz  "=== IO Module ==="
+.Lxly_str_6647529aa8ace71b:
+    .asciz  "io.write does "
+.Lxly_str_08b73907b55c4d71:
+    .asciz  "io"
+.Lxly_str_b93a12b0d06caefc:
+    .asciz  "write"
+.Lxly_str_0ab10c61c959417c:
+    .asciz  "not add a newline."
+.Lxly_str_a77ef5fb1d51f33a:
+    .asciz  "writeln"
+.Lxly_str_d211b4e1b0aaf5a2:
+    .asciz  "io.writeln"
+.Lxly_str_c9e2aa83d2171445:
+    .asciz  "adds"
+.Lxly_str_b2dea4650e7a6ce3:
+    .asciz  "a newline!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   3
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   24
@@ -0,0 +1,1841 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    leaq    .Lxly_class_0_fields(%rip), %rdi
+    movl    $3, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_1_fields(%rip), %rdi
+    movl    $2, %esi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_class_0(%rip), %rdi
+    call    xly_new
+    movq    %rax, %rbx
+    leaq    .Lxly_str_9ff1d219feac0718(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_78c792626149a886(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b2:
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k79(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b1:
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_class_0(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+    leaq    .Lxly_str_14952548f253a0a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_c447301a24ab4e4e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b4:
+    movq    %r12, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %r12, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    leaq    .Lxly_ir0_k80(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b3:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_1
+    cmpl    $10, (%rdi)
+    jne     .Lxly_1
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_1
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_2
+.Lxly_1:
+    leaq    .Lxly_str_9a79f79baa52b203(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_2:
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_3
+    cmpl    $10, (%rdi)
+    jne     .Lxly_3
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_3
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_4
+.Lxly_3:
+    leaq    .Lxly_str_9a79f79baa52b203(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_4:
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_5
+    cmpl    $10, (%rdi)
+    jne     .Lxly_5
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_5
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_6
+.Lxly_5:
+    leaq    .Lxly_str_33954377c44b9395(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_6:
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_7
+    cmpl    $10, (%rdi)
+    jne     .Lxly_7
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_7
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_8
+.Lxly_7:
+    leaq    .Lxly_str_33954377c44b9395(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_8:
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_9
+    cmpl    $10, (%rdi)
+    jne     .Lxly_9
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_9
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_10
+.Lxly_9:
+    leaq    .Lxly_str_33954377c44b9395(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_10:
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_11
+    cmpl    $10, (%rdi)
+    jne     .Lxly_11
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_11
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_12
+.Lxly_11:
+    leaq    .Lxly_str_33954377c44b9395(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_12:
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_13
+    cmpl    $10, (%rdi)
+    jne     .Lxly_13
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_13
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_13
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_13
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_14
+.Lxly_13:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_14:
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_15
+    cmpl    $10, (%rdi)
+    jne     .Lxly_15
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_15
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_15
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_15
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_16
+.Lxly_15:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_16:
+    movq    %rax, %r15
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k81(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k82(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b5:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r14
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k83(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movq    %rbx, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k84(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movq    %rbx, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b7:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %rbx
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -48(%rbp)
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k85(%rip), %rax
+    movq    %rax, -56(%rbp)
+    movq    %rbx, %rax
+    movq    -56(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k86(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b9:
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_17
+    cmpl    $10, (%rdi)
+    jne     .Lxly_17
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_17
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_17
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_17
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_18
+.Lxly_17:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_18:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_19
+    cmpl    $10, (%rdi)
+    jne     .Lxly_19
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_19
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_19
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_19
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_20
+.Lxly_19:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_20:
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_21
+    cmpl    $10, (%rdi)
+    jne     .Lxly_21
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_21
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_21
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_21
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_22
+.Lxly_21:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_22:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_68dd55b80a3e373a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k87(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_dbdacd932fd1e9bf(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_ir0_k88(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_17720bf67d347222(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_23
+    cmpl    $10, (%rdi)
+    jne     .Lxly_23
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_23
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_23
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_23
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_24
+.Lxly_23:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_24:
+    movq    %rax, %r13
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k79:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k80:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k81:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k82:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k83:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k84:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k85:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k86:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k87:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k88:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Dog.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf0_0_k12(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k12:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Dog.bark:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -124(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f1_1
+    call    xly_null
+.Lxly_f1_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_6e5e9509934da521(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f1_3
+.Lxly_f1_2:
+    call    xly_add
+.Lxly_f1_3:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Dog.learn_trick:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f2_1
+    call    xly_null
+.Lxly_f2_1:
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf2_0_k13(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_3
+.Lxly_f2_2:
+    call    xly_add
+.Lxly_f2_3:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f2_4
+    call    xly_null
+.Lxly_f2_4:
+    movq    %rax, %r14
+    leaq    .Lxly_str_3a0a419fd894cacf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f2_6
+.Lxly_f2_5:
+    call    xly_add
+.Lxly_f2_6:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f2_7
+    call    xly_null
+.Lxly_f2_7:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k13:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Dog.describe:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -644(%rbp)
+    movl    $-1, -516(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f3_1
+    call    xly_null
+.Lxly_f3_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_5d6d358b21720998(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f3_3
+.Lxly_f3_2:
+    call    xly_add
+.Lxly_f3_3:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f3_4
+    call    xly_null
+.Lxly_f3_4:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f3_6
+.Lxly_f3_5:
+    call    xly_add
+.Lxly_f3_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_c68f8b6f27b5b317(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f3_8
+.Lxly_f3_7:
+    call    xly_add
+.Lxly_f3_8:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f3_9
+    call    xly_null
+.Lxly_f3_9:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_10
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_10
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -544(%rbp)
+    leaq    -552(%rbp), %rax
+    jmp     .Lxly_f3_11
+.Lxly_f3_10:
+    call    xly_add
+.Lxly_f3_11:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_3b4c5c61bc0397b3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_12
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_12
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -672(%rbp)
+    leaq    -680(%rbp), %rax
+    jmp     .Lxly_f3_13
+.Lxly_f3_12:
+    call    xly_add
+.Lxly_f3_13:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rectangle.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rectangle.area:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f5_1
+    call    xly_null
+.Lxly_f5_1:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f5_2
+    call    xly_null
+.Lxly_f5_2:
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rectangle.perimeter:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -132(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f6_1
+    call    xly_null
+.Lxly_f6_1:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f6_2
+    call    xly_null
+.Lxly_f6_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f6_4
+.Lxly_f6_3:
+    call    xly_add
+.Lxly_f6_4:
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rectangle.is_square:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f7_1
+    call    xly_null
+.Lxly_f7_1:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f7_2
+    call    xly_null
+.Lxly_f7_2:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f7_4
+.Lxly_f7_3:
+    call    xly_eq
+.Lxly_f7_4:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rectangle.describe:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1200, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -1156(%rbp)
+    movl    $-1, -1028(%rbp)
+    movl    $-1, -900(%rbp)
+    movl    $-1, -772(%rbp)
+    movl    $-1, -644(%rbp)
+    movl    $-1, -516(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    leaq    .Lxly_str_c7e6c200d7e4fbca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f8_1
+    call    xly_null
+.Lxly_f8_1:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f8_3
+.Lxly_f8_2:
+    call    xly_add
+.Lxly_f8_3:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63f54c86021707(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f8_5
+.Lxly_f8_4:
+    call    xly_add
+.Lxly_f8_5:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f8_6
+    call    xly_null
+.Lxly_f8_6:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f8_8
+.Lxly_f8_7:
+    call    xly_add
+.Lxly_f8_8:
+    movq    %rax, %r14
+    leaq    .Lxly_str_df0ea78a584b32e1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -544(%rbp)
+    leaq    -552(%rbp), %rax
+    jmp     .Lxly_f8_10
+.Lxly_f8_9:
+    call    xly_add
+.Lxly_f8_10:
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f8_11
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f8_11
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f8_11
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_f8_11
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f8_11
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f8_12
+.Lxly_f8_11:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f8_12:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -672(%rbp)
+    leaq    -680(%rbp), %rax
+    jmp     .Lxly_f8_14
+.Lxly_f8_13:
+    call    xly_add
+.Lxly_f8_14:
+    movq    %rax, %r14
+    leaq    .Lxly_str_4aa445bc8e4adec9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -800(%rbp)
+    leaq    -808(%rbp), %rax
+    jmp     .Lxly_f8_16
+.Lxly_f8_15:
+    call    xly_add
+.Lxly_f8_16:
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f8_17
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f8_17
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f8_17
+    cmpq    $5, 40(%r11)
+    jle     .Lxly_f8_17
+    movq    48(%r11), %r11
+    movq    40(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f8_17
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f8_18
+.Lxly_f8_17:
+    leaq    .Lxly_str_5c5acc99ad3b58f4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f8_18:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -928(%rbp)
+    leaq    -936(%rbp), %rax
+    jmp     .Lxly_f8_20
+.Lxly_f8_19:
+    call    xly_add
+.Lxly_f8_20:
+    movq    %rax, %r14
+    leaq    .Lxly_str_5b582f5a8eef96fb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1056(%rbp)
+    leaq    -1064(%rbp), %rax
+    jmp     .Lxly_f8_22
+.Lxly_f8_21:
+    call    xly_add
+.Lxly_f8_22:
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f8_23
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f8_23
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f8_23
+    cmpq    $6, 40(%r11)
+    jle     .Lxly_f8_23
+    movq    48(%r11), %r11
+    movq    48(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f8_23
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f8_24
+.Lxly_f8_23:
+    leaq    .Lxly_str_474f28fd843416ed(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f8_24:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1184(%rbp)
+    leaq    -1192(%rbp), %rax
+    jmp     .Lxly_f8_26
+.Lxly_f8_25:
+    call    xly_add
+.Lxly_f8_26:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_class_0:
+    .quad   .Lxly_str_e0b75b19922bd249
+    .quad   0
+    .quad   .Lxly_fn_Dog.init
+    .quad   3
+    .quad   .Lxly_class_0_fields
+    .quad   7
+    .quad   .Lxly_class_0_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_0_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_93c4681debd27211
+    .quad   .Lxly_str_7638d2a34edc9435
+.Lxly_class_0_vtable:
+    .quad   .Lxly_fn_Dog.init
+    .quad   .Lxly_fn_Dog.bark
+    .quad   .Lxly_fn_Dog.learn_trick
+    .quad   .Lxly_fn_Dog.describe
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_1:
+    .quad   .Lxly_str_5d0b63df0bad8c2e
+    .quad   0
+    .quad   .Lxly_fn_Rectangle.init
+    .quad   2
+    .quad   .Lxly_class_1_fields
+    .quad   7
+    .quad   .Lxly_class_1_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_1_fields:
+    .quad   .Lxly_str_dbdacd932fd1e9bf
+    .quad   .Lxly_str_17720bf67d347222
+.Lxly_class_1_vtable:
+    .quad   .Lxly_fn_Rectangle.init
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Rectangle.describe
+    .quad   .Lxly_fn_Rectangle.area
+    .quad   .Lxly_fn_Rectangle.perimeter
+    .quad   .Lxly_fn_Rectangle.is_square
+.Lxly_selectors:
+    .quad   .Lxly_str_f5d2afc57ab57213
+    .quad   .Lxly_str_9a79f79baa52b203
+    .quad   .Lxly_str_33954377c44b9395
+    .quad   .Lxly_str_498cc41b0d228cc8
+    .quad   .Lxly_str_89502e843ec2b8c4
+    .quad   .Lxly_str_5c5acc99ad3b58f4
+    .quad   .Lxly_str_474f28fd843416ed
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   2
+.Lxly_atoms:
+.Lxly_atom_dbdacd932fd1e9bf:
+    .quad   .Lxly_str_dbdacd932fd1e9bf
+.Lxly_atom_17720bf67d347222:
+    .quad   .Lxly_str_17720bf67d347222
+
+.section .rodata
+.Lxly_str_9ff1d219feac0718:
+    .asciz  "Rex"
+.Lxly_str_78c792626149a886:
+    .asciz  "German Shepherd"
+.Lxly_str_14952548f253a0a3:
+    .asciz  "Buddy"
+.Lxly_str_c447301a24ab4e4e:
+    .asciz  "Golden Retriever"
+.Lxly_str_9a79f79baa52b203:
+    .asciz  "bark"
+.Lxly_str_33954377c44b9395:
+    .asciz  "learn_trick"
+.Lxly_str_498cc41b0d228cc8:
+    .asciz  "describe"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_68dd55b80a3e373a:
+    .asciz  "Resizing r1 to 7x7:"
+.Lxly_str_6e5e9509934da521:
+    .asciz  " says: Woof!"
+.Lxly_str_3a0a419fd894cacf:
+    .asciz  " learned a trick! Total:"
+.Lxly_str_5d6d358b21720998:
+    .asciz  " is a "
+.Lxly_str_c68f8b6f27b5b317:
+    .asciz  " who knows "
+.Lxly_str_3b4c5c61bc0397b3:
+    .asciz  " tricks."
+.Lxly_str_c7e6c200d7e4fbca:
+    .asciz  "Rectangle "
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_df0ea78a584b32e1:
+    .asciz  " | area="
+.Lxly_str_89502e843ec2b8c4:
+    .asciz  "area"
+.Lxly_str_4aa445bc8e4adec9:
+    .asciz  " | perimeter="
+.Lxly_str_5c5acc99ad3b58f4:
+    .asciz  "perimeter"
+.Lxly_str_5b582f5a8eef96fb:
+    .asciz  " | square="
+.Lxly_str_474f28fd843416ed:
+    .asciz  "is_square"
+.Lxly_str_e0b75b19922bd249:
+    .asciz  "Dog"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_93c4681debd27211:
+    .asciz  "breed"
+.Lxly_str_7638d2a34edc9435:
+    .asciz  "tricks"
+.Lxly_str_5d0b63df0bad8c2e:
+    .asciz  "Rectangle"
+.Lxly_str_dbdacd932fd1e9bf:
+    .asciz  "width"
+.Lxly_str_17720bf67d347222:
+    .asciz  "height"
+.Lxly_str_f5d2afc57ab57213:
+    .asciz  "init"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   5
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   40
@@ -0,0 +1,1682 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    leaq    .Lxly_class_0_fields(%rip), %rdi
+    movl    $1, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_1_fields(%rip), %rdi
+    movl    $2, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_2_fields(%rip), %rdi
+    movl    $3, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_3_fields(%rip), %rdi
+    movl    $4, %esi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_559cfa6d62d20445(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %rbx
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b2:
+    leaq    .Lxly_str_14c54ca33d0f3ea9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_Shape.init
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k134(%rip), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b1:
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_class_2(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r14
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_5d0b63df0bad8c2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_Shape.init
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k135(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    leaq    .Lxly_ir0_k136(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b3:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_class_3(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r15
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k137(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k138(%rip), %rax
+    movq    %rax, -56(%rbp)
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    movq    -56(%rbp), %rdx
+    call    .Lxly_fn_Rect.init
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_str_6641c258b0b51b26(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r15, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k139(%rip), %rax
+    movq    %rax, -72(%rbp)
+    movq    %r15, %rax
+    movq    -72(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 24(%rax)
+.Lxly_ir0_b5:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_1
+    cmpl    $10, (%rdi)
+    jne     .Lxly_1
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_1
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_2
+.Lxly_1:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_2:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_3
+    cmpl    $10, (%rdi)
+    jne     .Lxly_3
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_3
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_4
+.Lxly_3:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_4:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_5
+    cmpl    $10, (%rdi)
+    jne     .Lxly_5
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_5
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_6
+.Lxly_5:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_6:
+    movq    %rax, %r13
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_da559fe7ebbdfa15(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_deb567188e22a1eb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_a293b946d5782cf3(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_319067c1f939947a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_7
+    cmpl    $10, (%rdi)
+    jne     .Lxly_7
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_7
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_8
+.Lxly_7:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_8:
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7f0c0794e857147c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_9
+    cmpl    $10, (%rdi)
+    jne     .Lxly_9
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_9
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_10
+.Lxly_9:
+    leaq    .Lxly_str_aba38db14eade14e(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_10:
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_da4a814ef87a9458(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7e889508c0e2dd5e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    .Lxly_atom_dbdacd932fd1e9bf(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_af63f54c86021707(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movq    %r14, %rdi
+    movq    .Lxly_atom_17720bf67d347222(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -152(%rbp)
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_11
+    cmpl    $10, (%rdi)
+    jne     .Lxly_11
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_11
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_12
+.Lxly_11:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_12:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6cd6b1f6a653aaea(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_13
+    cmpl    $10, (%rdi)
+    jne     .Lxly_13
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_13
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_13
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_13
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_14
+.Lxly_13:
+    leaq    .Lxly_str_5c5acc99ad3b58f4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_14:
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a838dab3ef3f526a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_948e93b59efdd92c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    .Lxly_atom_4e0c8a18e635803e(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2f02764a913c4575(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_15
+    cmpl    $10, (%rdi)
+    jne     .Lxly_15
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_15
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_15
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_15
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_16
+.Lxly_15:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_16:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6a35eef44fd637e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_17
+    cmpl    $10, (%rdi)
+    jne     .Lxly_17
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_17
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_17
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_17
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_18
+.Lxly_17:
+    leaq    .Lxly_str_5c5acc99ad3b58f4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_18:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bdb3ed05806f3c09(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_19
+    cmpl    $10, (%rdi)
+    jne     .Lxly_19
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_19
+    cmpq    $5, 40(%r11)
+    jle     .Lxly_19
+    movq    48(%r11), %r11
+    movq    40(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_19
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_20
+.Lxly_19:
+    leaq    .Lxly_str_a11124ede00c4a5a(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_20:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c0b91199ca4715ca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_23cb269e30ef7ec4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fd13056b71bc92cd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    .Lxly_atom_dbdacd932fd1e9bf(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0e653bd5d4ba4b82(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    .Lxly_atom_17720bf67d347222(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_60970eac18630fe1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_3(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r15
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k140(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k141(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    movq    %r13, %rdx
+    call    .Lxly_fn_Rect.init
+    movq    %rax, -168(%rbp)
+    movq    %r15, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k142(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 24(%rax)
+.Lxly_ir0_b7:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_class_3(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r13
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k143(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k144(%rip), %rax
+    movq    %rax, -176(%rbp)
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    movq    -176(%rbp), %rdx
+    call    .Lxly_fn_Rect.init
+    movq    %rax, -184(%rbp)
+    movq    %r13, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k145(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 24(%rax)
+.Lxly_ir0_b9:
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_34b98a5e6e53b984(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_21
+    cmpl    $10, (%rdi)
+    jne     .Lxly_21
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_21
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_21
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_21
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_22
+.Lxly_21:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_22:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b3ae2dd0105434e9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_23
+    cmpl    $10, (%rdi)
+    jne     .Lxly_23
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_23
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_23
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_23
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_24
+.Lxly_23:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_24:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_806b26265ab4cdbe(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    .Lxly_atom_4e0c8a18e635803e(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d97449a92abf8c93(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    .Lxly_atom_4e0c8a18e635803e(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k134:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k135:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k136:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k137:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k138:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k139:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k140:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k141:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k142:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k143:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k144:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k145:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Shape.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Shape.area:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf1_0_k5(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k5:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Shape.describe:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $304, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f2_1
+    call    xly_null
+.Lxly_f2_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_8604a6ba0f6a54db(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f2_3
+.Lxly_f2_2:
+    call    xly_add
+.Lxly_f2_3:
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f2_4
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f2_4
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f2_4
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_f2_4
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f2_4
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f2_5
+.Lxly_f2_4:
+    leaq    .Lxly_str_89502e843ec2b8c4(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f2_5:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_6
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_6
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f2_7
+.Lxly_f2_6:
+    call    xly_add
+.Lxly_f2_7:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Circle.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    leaq    .Lxly_str_14c54ca33d0f3ea9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_irf3_0_b2:
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+.Lxly_irf3_0_b1:
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Circle.area:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f4_1
+    call    xly_null
+.Lxly_f4_1:
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f4_2
+    call    xly_null
+.Lxly_f4_2:
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Circle.circumference:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x401921f9f01b866e, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f5_1
+    call    xly_null
+.Lxly_f5_1:
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rect.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    leaq    .Lxly_str_5d0b63df0bad8c2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_irf6_0_b2:
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+.Lxly_irf6_0_b1:
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rect.area:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f7_1
+    call    xly_null
+.Lxly_f7_1:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f7_2
+    call    xly_null
+.Lxly_f7_2:
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Rect.perimeter:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -132(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f8_1
+    call    xly_null
+.Lxly_f8_1:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f8_2
+    call    xly_null
+.Lxly_f8_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f8_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f8_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f8_4
+.Lxly_f8_3:
+    call    xly_add
+.Lxly_f8_4:
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Square.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+.Lxly_irf9_0_b2:
+    leaq    .Lxly_str_5d0b63df0bad8c2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_Shape.init
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_irf9_0_b1:
+    leaq    .Lxly_str_6641c258b0b51b26(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 24(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Square.diagonal:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    24(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f10_1
+    call    xly_null
+.Lxly_f10_1:
+    movq    %rax, %r12
+    movabsq $0x3ff6a09aaa3ad18d, %rax
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_class_0:
+    .quad   .Lxly_str_2de969afacdaa7a6
+    .quad   0
+    .quad   .Lxly_fn_Shape.init
+    .quad   1
+    .quad   .Lxly_class_0_fields
+    .quad   6
+    .quad   .Lxly_class_0_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_0_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+.Lxly_class_0_vtable:
+    .quad   .Lxly_fn_Shape.init
+    .quad   .Lxly_fn_Shape.area
+    .quad   .Lxly_fn_Shape.describe
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_1:
+    .quad   .Lxly_str_14c54ca33d0f3ea9
+    .quad   .Lxly_class_0
+    .quad   .Lxly_fn_Circle.init
+    .quad   2
+    .quad   .Lxly_class_1_fields
+    .quad   6
+    .quad   .Lxly_class_1_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_1_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_a293b946d5782cf3
+.Lxly_class_1_vtable:
+    .quad   .Lxly_fn_Circle.init
+    .quad   .Lxly_fn_Circle.area
+    .quad   .Lxly_fn_Shape.describe
+    .quad   .Lxly_fn_Circle.circumference
+    .quad   0
+    .quad   0
+.Lxly_class_2:
+    .quad   .Lxly_str_7414702bbe6fbc27
+    .quad   .Lxly_class_0
+    .quad   .Lxly_fn_Rect.init
+    .quad   3
+    .quad   .Lxly_class_2_fields
+    .quad   6
+    .quad   .Lxly_class_2_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_2_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_dbdacd932fd1e9bf
+    .quad   .Lxly_str_17720bf67d347222
+.Lxly_class_2_vtable:
+    .quad   .Lxly_fn_Rect.init
+    .quad   .Lxly_fn_Rect.area
+    .quad   .Lxly_fn_Shape.describe
+    .quad   0
+    .quad   .Lxly_fn_Rect.perimeter
+    .quad   0
+.Lxly_class_3:
+    .quad   .Lxly_str_6641c258b0b51b26
+    .quad   .Lxly_class_2
+    .quad   .Lxly_fn_Square.init
+    .quad   4
+    .quad   .Lxly_class_3_fields
+    .quad   6
+    .quad   .Lxly_class_3_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_3_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_dbdacd932fd1e9bf
+    .quad   .Lxly_str_17720bf67d347222
+    .quad   .Lxly_str_4e0c8a18e635803e
+.Lxly_class_3_vtable:
+    .quad   .Lxly_fn_Square.init
+    .quad   .Lxly_fn_Rect.area
+    .quad   .Lxly_fn_Shape.describe
+    .quad   0
+    .quad   .Lxly_fn_Rect.perimeter
+    .quad   .Lxly_fn_Square.diagonal
+.Lxly_selectors:
+    .quad   .Lxly_str_f5d2afc57ab57213
+    .quad   .Lxly_str_89502e843ec2b8c4
+    .quad   .Lxly_str_498cc41b0d228cc8
+    .quad   .Lxly_str_aba38db14eade14e
+    .quad   .Lxly_str_5c5acc99ad3b58f4
+    .quad   .Lxly_str_a11124ede00c4a5a
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   5
+.Lxly_atoms:
+.Lxly_atom_a293b946d5782cf3:
+    .quad   .Lxly_str_a293b946d5782cf3
+.Lxly_atom_dbdacd932fd1e9bf:
+    .quad   .Lxly_str_dbdacd932fd1e9bf
+.Lxly_atom_17720bf67d347222:
+    .quad   .Lxly_str_17720bf67d347222
+.Lxly_atom_4e0c8a18e635803e:
+    .quad   .Lxly_str_4e0c8a18e635803e
+.Lxly_atom_c4bcadba8e631b86:
+    .quad   .Lxly_str_c4bcadba8e631b86
+
+.section .rodata
+.Lxly_str_559cfa6d62d20445:
+    .asciz  "=== Shapes ==="
+.Lxly_str_14c54ca33d0f3ea9:
+    .asciz  "Circle"
+.Lxly_str_5d0b63df0bad8c2e:
+    .asciz  "Rectangle"
+.Lxly_str_6641c258b0b51b26:
+    .asciz  "Square"
+.Lxly_str_498cc41b0d228cc8:
+    .asciz  "describe"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_da559fe7ebbdfa15:
+    .asciz  "=== Circle Details ==="
+.Lxly_str_deb567188e22a1eb:
+    .asciz  "Radius:"
+.Lxly_str_319067c1f939947a:
+    .asciz  "Area:"
+.Lxly_str_89502e843ec2b8c4:
+    .asciz  "area"
+.Lxly_str_7f0c0794e857147c:
+    .asciz  "Circumference:"
+.Lxly_str_aba38db14eade14e:
+    .asciz  "circumference"
+.Lxly_str_da4a814ef87a9458:
+    .asciz  "=== Rectangle Details ==="
+.Lxly_str_7e889508c0e2dd5e:
+    .asciz  "Dimensions:"
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_6cd6b1f6a653aaea:
+    .asciz  "Perimeter:"
+.Lxly_str_5c5acc99ad3b58f4:
+    .asciz  "perimeter"
+.Lxly_str_a838dab3ef3f526a:
+    .asciz  "=== Square Details ==="
+.Lxly_str_948e93b59efdd92c:
+    .asciz  "Side:"
+.Lxly_str_2f02764a913c4575:
+    .asciz  "Area (inherited):"
+.Lxly_str_6a35eef44fd637e5:
+    .asciz  "Perimeter (inherited):"
+.Lxly_str_bdb3ed05806f3c09:
+    .asciz  "Diagonal (own):"
+.Lxly_str_a11124ede00c4a5a:
+    .asciz  "diagonal"
+.Lxly_str_c0b91199ca4715ca:
+    .asciz  "=== Inheritance Chain ==="
+.Lxly_str_23cb269e30ef7ec4:
+    .asciz  "Square name (set in Square.init):"
+.Lxly_str_fd13056b71bc92cd:
+    .asciz  "Square width (set by Rect.init via super):"
+.Lxly_str_0e653bd5d4ba4b82:
+    .asciz  "Square height (set by Rect.init via super):"
+.Lxly_str_60970eac18630fe1:
+    .asciz  "=== Independence ==="
+.Lxly_str_34b98a5e6e53b984:
+    .asciz  "s1 area:"
+.Lxly_str_b3ae2dd0105434e9:
+    .asciz  "s2 area:"
+.Lxly_str_806b26265ab4cdbe:
+    .asciz  "s1 side:"
+.Lxly_str_d97449a92abf8c93:
+    .asciz  "s2 side:"
+.Lxly_str_8604a6ba0f6a54db:
+    .asciz  ": area = "
+.Lxly_str_2de969afacdaa7a6:
+    .asciz  "Shape"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_a293b946d5782cf3:
+    .asciz  "radius"
+.Lxly_str_7414702bbe6fbc27:
+    .asciz  "Rect"
+.Lxly_str_dbdacd932fd1e9bf:
+    .asciz  "width"
+.Lxly_str_17720bf67d347222:
+    .asciz  "height"
+.Lxly_str_4e0c8a18e635803e:
+    .asciz  "side"
+.Lxly_str_f5d2afc57ab57213:
+    .asciz  "init"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   5
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   40
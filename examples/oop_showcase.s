@@ -0,0 +1,7100 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    leaq    .Lxly_class_0_fields(%rip), %rdi
+    movl    $2, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_1_fields(%rip), %rdi
+    movl    $2, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_2_fields(%rip), %rdi
+    movl    $2, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_3_fields(%rip), %rdi
+    movl    $3, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_4_fields(%rip), %rdi
+    movl    $3, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_5_fields(%rip), %rdi
+    movl    $3, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_6_fields(%rip), %rdi
+    movl    $1, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_7_fields(%rip), %rdi
+    movl    $3, %esi
+    call    xly_atoms
+    leaq    .Lxly_class_8_fields(%rip), %rdi
+    movl    $2, %esi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1168, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movl    $-1, -1124(%rbp)
+    movl    $-1, -996(%rbp)
+    leaq    .Lxly_str_1133585740502798(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a3829a7d67a0b128(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_51c7dc3cf57b90f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f4af8dfdfc72c7c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_15967dbfdb8235df(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3b90f0855eebf0c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_0(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+.Lxly_ir0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k284(%rip), %rax
+    movq    %rax, -72(%rbp)
+    movq    %r12, %rax
+    movq    -72(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir0_k285(%rip), %rax
+    movq    %rax, -88(%rbp)
+    movq    %r12, %rax
+    movq    -88(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b1:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_1
+    cmpl    $10, (%rdi)
+    jne     .Lxly_1
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_1
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_2
+.Lxly_1:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_2:
+    movq    %rax, -96(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_ir0_k286(%rip), %rax
+    movq    %rax, -112(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_3
+    cmpl    $10, (%rdi)
+    jne     .Lxly_3
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_3
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    movq    -112(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_4
+.Lxly_3:
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_4:
+    movq    %rax, -120(%rbp)
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k287(%rip), %rax
+    movq    %rax, -136(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_5
+    cmpl    $10, (%rdi)
+    jne     .Lxly_5
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_5
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    movq    -136(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_6
+.Lxly_5:
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_6:
+    movq    %rax, -144(%rbp)
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k288(%rip), %rax
+    movq    %rax, -160(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_7
+    cmpl    $10, (%rdi)
+    jne     .Lxly_7
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_7
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    movq    -160(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_8
+.Lxly_7:
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_8:
+    movq    %rax, -168(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_9
+    cmpl    $10, (%rdi)
+    jne     .Lxly_9
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_9
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_10
+.Lxly_9:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_10:
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_str_8cae7aeb2c3eb76c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_11
+    cmpl    $10, (%rdi)
+    jne     .Lxly_11
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    cmpq    $3, 40(%r11)
+    jle     .Lxly_11
+    movq    48(%r11), %r11
+    movq    24(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_12
+.Lxly_11:
+    leaq    .Lxly_str_dff7680dd73b88fe(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_12:
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_39bd8c7e72c1838b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -200(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -208(%rbp)
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k289(%rip), %rax
+    movq    %rax, -216(%rbp)
+    movq    %r12, %rax
+    movq    -216(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k290(%rip), %rax
+    movq    %rax, -224(%rbp)
+    movq    %r12, %rax
+    movq    -224(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b3:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, -232(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -240(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -248(%rbp)
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k291(%rip), %rax
+    movq    %rax, -256(%rbp)
+    movq    -232(%rbp), %rax
+    movq    -256(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k292(%rip), %rax
+    movq    %rax, -264(%rbp)
+    movq    -232(%rbp), %rax
+    movq    -264(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b5:
+    movq    -232(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_13
+    cmpl    $10, (%rdi)
+    jne     .Lxly_13
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_13
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_13
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_13
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_14
+.Lxly_13:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_14:
+    movq    %rax, -272(%rbp)
+    movq    -232(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_15
+    cmpl    $10, (%rdi)
+    jne     .Lxly_15
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_15
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_15
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_15
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_16
+.Lxly_15:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_16:
+    movq    %rax, -280(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_17
+    cmpl    $10, (%rdi)
+    jne     .Lxly_17
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_17
+    cmpq    $6, 40(%r11)
+    jle     .Lxly_17
+    movq    48(%r11), %r11
+    movq    48(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_17
+    movq    -232(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_18
+.Lxly_17:
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_e70bc3190530e654(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_18:
+    movq    %rax, -288(%rbp)
+    movq    -288(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_bace1303fed238c0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    movq    -288(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_19
+    cmpl    $10, (%rdi)
+    jne     .Lxly_19
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_19
+    cmpq    $9, 40(%r11)
+    jle     .Lxly_19
+    movq    48(%r11), %r11
+    movq    72(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_19
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_20
+.Lxly_19:
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_20:
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k293(%rip), %rax
+    movq    %rax, -312(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_21
+    cmpl    $10, (%rdi)
+    jne     .Lxly_21
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_21
+    cmpq    $7, 40(%r11)
+    jle     .Lxly_21
+    movq    48(%r11), %r11
+    movq    56(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_21
+    movq    -312(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_22
+.Lxly_21:
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_6aacb9fbb71a1d91(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_22:
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_e5085eaf7359bf17(%rip), %rdi
+    call    xly_str
+    movq    %rax, -328(%rbp)
+    movq    -320(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_23
+    cmpl    $10, (%rdi)
+    jne     .Lxly_23
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_23
+    cmpq    $9, 40(%r11)
+    jle     .Lxly_23
+    movq    48(%r11), %r11
+    movq    72(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_23
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_24
+.Lxly_23:
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_24:
+    movq    %rax, -336(%rbp)
+    subq    $16, %rsp
+    movq    -328(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -336(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b279d425370bbb5d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -344(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_25
+    cmpl    $10, (%rdi)
+    jne     .Lxly_25
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_25
+    cmpq    $8, 40(%r11)
+    jle     .Lxly_25
+    movq    48(%r11), %r11
+    movq    64(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_25
+    movq    -232(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_26
+.Lxly_25:
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_caaf2818f47458a0(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_26:
+    movq    %rax, -352(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_99bd5bccaa99edc3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_27
+    cmpl    $10, (%rdi)
+    jne     .Lxly_27
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_27
+    cmpq    $5, 40(%r11)
+    jle     .Lxly_27
+    movq    48(%r11), %r11
+    movq    40(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_27
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_28
+.Lxly_27:
+    leaq    .Lxly_str_ea11573f1af59eb5(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_28:
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c585f2d40cc6beae(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_3(%rip), %rdi
+    call    xly_new
+    movq    %rax, -376(%rbp)
+    leaq    .Lxly_str_14ccc4eb44f18325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -384(%rbp)
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k294(%rip), %rax
+    movq    %rax, -392(%rbp)
+    movq    -376(%rbp), %rdi
+    movq    -384(%rbp), %rsi
+    movq    -392(%rbp), %rdx
+    call    .Lxly_fn_Animal.init
+    movq    %rax, -400(%rbp)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, -408(%rbp)
+    movq    -376(%rbp), %rax
+    movq    -408(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b7:
+    movq    -376(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_class_4(%rip), %rdi
+    call    xly_new
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_str_667532e355a13249(%rip), %rdi
+    call    xly_str
+    movq    %rax, -424(%rbp)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, -432(%rbp)
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k295(%rip), %rax
+    movq    %rax, -440(%rbp)
+    movq    -416(%rbp), %rdi
+    movq    -424(%rbp), %rsi
+    movq    -440(%rbp), %rdx
+    call    .Lxly_fn_Animal.init
+    movq    %rax, -448(%rbp)
+    movq    -416(%rbp), %rax
+    movq    -432(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b9:
+    movq    -416(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_class_4(%rip), %rdi
+    call    xly_new
+    movq    %rax, -456(%rbp)
+    leaq    .Lxly_str_6d24e019e23ba1ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, -464(%rbp)
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k296(%rip), %rax
+    movq    %rax, -472(%rbp)
+    movq    -456(%rbp), %rdi
+    movq    -464(%rbp), %rsi
+    movq    -472(%rbp), %rdx
+    call    .Lxly_fn_Animal.init
+    movq    %rax, -480(%rbp)
+    movq    -456(%rbp), %rax
+    movq    -408(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b11:
+    movq    -456(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_class_5(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+    leaq    .Lxly_str_470c003b9da7eb0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -488(%rbp)
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k297(%rip), %rax
+    movq    %rax, -496(%rbp)
+    movq    %r12, %rdi
+    movq    -488(%rbp), %rsi
+    movq    -496(%rbp), %rdx
+    call    .Lxly_fn_Animal.init
+    movq    %rax, -504(%rbp)
+    leaq    .Lxly_ir0_k298(%rip), %rax
+    movq    %rax, -512(%rbp)
+    movq    %r12, %rax
+    movq    -512(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b13:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    -376(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_29
+    cmpl    $10, (%rdi)
+    jne     .Lxly_29
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_29
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_29
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_29
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_30
+.Lxly_29:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_30:
+    movq    %rax, -520(%rbp)
+    movq    -416(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_31
+    cmpl    $10, (%rdi)
+    jne     .Lxly_31
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_31
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_31
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_31
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_32
+.Lxly_31:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_32:
+    movq    %rax, -528(%rbp)
+    movq    -456(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_33
+    cmpl    $10, (%rdi)
+    jne     .Lxly_33
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_33
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_33
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_33
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_34
+.Lxly_33:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_34:
+    movq    %rax, -536(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_35
+    cmpl    $10, (%rdi)
+    jne     .Lxly_35
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_35
+    cmpq    $4, 40(%r11)
+    jle     .Lxly_35
+    movq    48(%r11), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_35
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_36
+.Lxly_35:
+    leaq    .Lxly_str_498cc41b0d228cc8(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_36:
+    movq    %rax, -544(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    -376(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_37
+    cmpl    $10, (%rdi)
+    jne     .Lxly_37
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_37
+    cmpq    $11, 40(%r11)
+    jle     .Lxly_37
+    movq    48(%r11), %r11
+    movq    88(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_37
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_38
+.Lxly_37:
+    leaq    .Lxly_str_6c7c070e275e6392(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_38:
+    movq    %rax, -552(%rbp)
+    movq    -416(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_39
+    cmpl    $10, (%rdi)
+    jne     .Lxly_39
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_39
+    cmpq    $12, 40(%r11)
+    jle     .Lxly_39
+    movq    48(%r11), %r11
+    movq    96(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_39
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_40
+.Lxly_39:
+    leaq    .Lxly_str_dcaf8b18fed7c502(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_40:
+    movq    %rax, -560(%rbp)
+    movq    -456(%rbp), %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_41
+    cmpl    $10, (%rdi)
+    jne     .Lxly_41
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_41
+    cmpq    $12, 40(%r11)
+    jle     .Lxly_41
+    movq    48(%r11), %r11
+    movq    96(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_41
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_42
+.Lxly_41:
+    leaq    .Lxly_str_dcaf8b18fed7c502(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_42:
+    movq    %rax, -568(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_43
+    cmpl    $10, (%rdi)
+    jne     .Lxly_43
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_43
+    cmpq    $13, 40(%r11)
+    jle     .Lxly_43
+    movq    48(%r11), %r11
+    movq    104(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_43
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_44
+.Lxly_43:
+    leaq    .Lxly_str_a044c90599d40d84(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_44:
+    movq    %rax, -576(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_45
+    cmpl    $10, (%rdi)
+    jne     .Lxly_45
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_45
+    cmpq    $13, 40(%r11)
+    jle     .Lxly_45
+    movq    48(%r11), %r11
+    movq    104(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_45
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_46
+.Lxly_45:
+    leaq    .Lxly_str_a044c90599d40d84(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_46:
+    movq    %rax, -584(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_47
+    cmpl    $10, (%rdi)
+    jne     .Lxly_47
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_47
+    cmpq    $13, 40(%r11)
+    jle     .Lxly_47
+    movq    48(%r11), %r11
+    movq    104(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_47
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_48
+.Lxly_47:
+    leaq    .Lxly_str_a044c90599d40d84(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_48:
+    movq    %rax, -592(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cf393b21313bf5e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_6(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+.Lxly_ir0_b16:
+    leaq    .Lxly_ir0_k299(%rip), %rax
+    movq    %rax, -600(%rbp)
+    movq    %r12, %rax
+    movq    -600(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+.Lxly_ir0_b15:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_49
+    cmpl    $10, (%rdi)
+    jne     .Lxly_49
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_49
+    cmpq    $14, 40(%r11)
+    jle     .Lxly_49
+    movq    48(%r11), %r11
+    movq    112(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_49
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_50
+.Lxly_49:
+    leaq    .Lxly_str_1d5858eba2deedbe(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_50:
+    movq    %rax, -608(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_51
+    cmpl    $10, (%rdi)
+    jne     .Lxly_51
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_51
+    cmpq    $14, 40(%r11)
+    jle     .Lxly_51
+    movq    48(%r11), %r11
+    movq    112(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_51
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_52
+.Lxly_51:
+    leaq    .Lxly_str_1d5858eba2deedbe(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_52:
+    movq    %rax, -616(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_53
+    cmpl    $10, (%rdi)
+    jne     .Lxly_53
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_53
+    cmpq    $14, 40(%r11)
+    jle     .Lxly_53
+    movq    48(%r11), %r11
+    movq    112(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_53
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_54
+.Lxly_53:
+    leaq    .Lxly_str_1d5858eba2deedbe(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_54:
+    movq    %rax, -624(%rbp)
+    leaq    .Lxly_str_8e16f5b42b7b07c8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -632(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_55
+    cmpl    $10, (%rdi)
+    jne     .Lxly_55
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_55
+    cmpq    $17, 40(%r11)
+    jle     .Lxly_55
+    movq    48(%r11), %r11
+    movq    136(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_55
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_56
+.Lxly_55:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_56:
+    movq    %rax, -640(%rbp)
+    subq    $16, %rsp
+    movq    -632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -640(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k300(%rip), %rax
+    movq    %rax, -648(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_57
+    cmpl    $10, (%rdi)
+    jne     .Lxly_57
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_57
+    cmpq    $6, 40(%r11)
+    jle     .Lxly_57
+    movq    48(%r11), %r11
+    movq    48(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_57
+    movq    -648(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_58
+.Lxly_57:
+    subq    $16, %rsp
+    movq    -648(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_e70bc3190530e654(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_58:
+    movq    %rax, -656(%rbp)
+    leaq    .Lxly_str_53763e29d9801c64(%rip), %rdi
+    call    xly_str
+    movq    %rax, -664(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_59
+    cmpl    $10, (%rdi)
+    jne     .Lxly_59
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_59
+    cmpq    $17, 40(%r11)
+    jle     .Lxly_59
+    movq    48(%r11), %r11
+    movq    136(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_59
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_60
+.Lxly_59:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_60:
+    movq    %rax, -672(%rbp)
+    subq    $16, %rsp
+    movq    -664(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -672(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_61
+    cmpl    $10, (%rdi)
+    jne     .Lxly_61
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_61
+    cmpq    $15, 40(%r11)
+    jle     .Lxly_61
+    movq    48(%r11), %r11
+    movq    120(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_61
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_62
+.Lxly_61:
+    leaq    .Lxly_str_2b652968055c38d2(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_62:
+    movq    %rax, -680(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_63
+    cmpl    $10, (%rdi)
+    jne     .Lxly_63
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_63
+    cmpq    $15, 40(%r11)
+    jle     .Lxly_63
+    movq    48(%r11), %r11
+    movq    120(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_63
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_64
+.Lxly_63:
+    leaq    .Lxly_str_2b652968055c38d2(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_64:
+    movq    %rax, -688(%rbp)
+    leaq    .Lxly_str_ee0507677076e947(%rip), %rdi
+    call    xly_str
+    movq    %rax, -696(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_65
+    cmpl    $10, (%rdi)
+    jne     .Lxly_65
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_65
+    cmpq    $17, 40(%r11)
+    jle     .Lxly_65
+    movq    48(%r11), %r11
+    movq    136(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_65
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_66
+.Lxly_65:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_66:
+    movq    %rax, -704(%rbp)
+    subq    $16, %rsp
+    movq    -696(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -704(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_67
+    cmpl    $10, (%rdi)
+    jne     .Lxly_67
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_67
+    cmpq    $16, 40(%r11)
+    jle     .Lxly_67
+    movq    48(%r11), %r11
+    movq    128(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_67
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_68
+.Lxly_67:
+    leaq    .Lxly_str_0f136ff2c086b760(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_68:
+    movq    %rax, -712(%rbp)
+    leaq    .Lxly_str_3a2568a65842ab00(%rip), %rdi
+    call    xly_str
+    movq    %rax, -720(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_69
+    cmpl    $10, (%rdi)
+    jne     .Lxly_69
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_69
+    cmpq    $17, 40(%r11)
+    jle     .Lxly_69
+    movq    48(%r11), %r11
+    movq    136(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_69
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_70
+.Lxly_69:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_70:
+    movq    %rax, -728(%rbp)
+    subq    $16, %rsp
+    movq    -720(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -728(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_64d2c35667cc594b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_7(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, -736(%rbp)
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, -744(%rbp)
+.Lxly_ir0_b18:
+    movq    %r12, %rax
+    movq    -736(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k301(%rip), %rax
+    movq    %rax, -752(%rbp)
+    movq    %r12, %rax
+    movq    -752(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    leaq    .Lxly_ir0_k302(%rip), %rax
+    movq    %rax, -760(%rbp)
+    movq    %r12, %rax
+    movq    -760(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b17:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_class_7(%rip), %rdi
+    call    xly_new
+    movq    %rax, %rbx
+    leaq    .Lxly_str_16566419b10316b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -768(%rbp)
+    movabsq $0x407f400000000000, %rax
+    movq    %rax, -776(%rbp)
+.Lxly_ir0_b20:
+    movq    %rbx, %rax
+    movq    -768(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k303(%rip), %rax
+    movq    %rax, -784(%rbp)
+    movq    %rbx, %rax
+    movq    -784(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    leaq    .Lxly_ir0_k304(%rip), %rax
+    movq    %rax, -792(%rbp)
+    movq    %rbx, %rax
+    movq    -792(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+.Lxly_ir0_b19:
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_71
+    cmpl    $10, (%rdi)
+    jne     .Lxly_71
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_71
+    cmpq    $21, 40(%r11)
+    jle     .Lxly_71
+    movq    48(%r11), %r11
+    movq    168(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_71
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_72
+.Lxly_71:
+    leaq    .Lxly_str_63203b95ecf7b916(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_72:
+    movq    %rax, -800(%rbp)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_73
+    cmpl    $10, (%rdi)
+    jne     .Lxly_73
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_73
+    cmpq    $21, 40(%r11)
+    jle     .Lxly_73
+    movq    48(%r11), %r11
+    movq    168(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_73
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_74
+.Lxly_73:
+    leaq    .Lxly_str_63203b95ecf7b916(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_74:
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4069000000000000, %rax
+    movq    %rax, -816(%rbp)
+    leaq    .Lxly_ir0_k305(%rip), %rax
+    movq    %rax, -824(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_75
+    cmpl    $10, (%rdi)
+    jne     .Lxly_75
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_75
+    cmpq    $18, 40(%r11)
+    jle     .Lxly_75
+    movq    48(%r11), %r11
+    movq    144(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_75
+    movq    -824(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_76
+.Lxly_75:
+    subq    $16, %rsp
+    movq    -824(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_6c86e9a8e0e445d5(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_76:
+    movq    %rax, -832(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -840(%rbp)
+    leaq    .Lxly_ir0_k306(%rip), %rax
+    movq    %rax, -848(%rbp)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_77
+    cmpl    $10, (%rdi)
+    jne     .Lxly_77
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_77
+    cmpq    $19, 40(%r11)
+    jle     .Lxly_77
+    movq    48(%r11), %r11
+    movq    152(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_77
+    movq    -848(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_78
+.Lxly_77:
+    subq    $16, %rsp
+    movq    -848(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_f2d50b75b3e12f37(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_78:
+    movq    %rax, -856(%rbp)
+    movabsq $0x4072c00000000000, %rax
+    movq    %rax, -864(%rbp)
+    leaq    .Lxly_ir0_k307(%rip), %rax
+    movq    %rax, -872(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_79
+    cmpl    $10, (%rdi)
+    jne     .Lxly_79
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_79
+    cmpq    $20, 40(%r11)
+    jle     .Lxly_79
+    movq    48(%r11), %r11
+    movq    160(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_79
+    movq    %rbx, %rsi
+    movq    -872(%rbp), %rdx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_80
+.Lxly_79:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -872(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_str_2af6c6f4ff6889e6(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_80:
+    movq    %rax, -880(%rbp)
+    leaq    .Lxly_ir0_k308(%rip), %rax
+    movq    %rax, -888(%rbp)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_81
+    cmpl    $10, (%rdi)
+    jne     .Lxly_81
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_81
+    cmpq    $19, 40(%r11)
+    jle     .Lxly_81
+    movq    48(%r11), %r11
+    movq    152(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_81
+    movq    -888(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_82
+.Lxly_81:
+    subq    $16, %rsp
+    movq    -888(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_f2d50b75b3e12f37(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_82:
+    movq    %rax, -896(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_83
+    cmpl    $10, (%rdi)
+    jne     .Lxly_83
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_83
+    cmpq    $21, 40(%r11)
+    jle     .Lxly_83
+    movq    48(%r11), %r11
+    movq    168(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_83
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_84
+.Lxly_83:
+    leaq    .Lxly_str_63203b95ecf7b916(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_84:
+    movq    %rax, -904(%rbp)
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_85
+    cmpl    $10, (%rdi)
+    jne     .Lxly_85
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_85
+    cmpq    $21, 40(%r11)
+    jle     .Lxly_85
+    movq    48(%r11), %r11
+    movq    168(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_85
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_86
+.Lxly_85:
+    leaq    .Lxly_str_63203b95ecf7b916(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_86:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_30ec875f48e36925(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_8(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r14
+.Lxly_ir0_b22:
+    movq    %r14, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_ir0_k309(%rip), %rax
+    movq    %rax, %r13
+    movq    %r14, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_ir0_b21:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_63f0bfacf2c00f6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_87
+    cmpl    $10, (%rdi)
+    jne     .Lxly_87
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_87
+    cmpq    $22, 40(%r11)
+    jle     .Lxly_87
+    movq    48(%r11), %r11
+    movq    176(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_87
+    movq    %r13, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_88
+.Lxly_87:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_3e7fe942f71f1e61(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_88:
+    movq    %rax, %r15
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_89
+    cmpl    $10, (%rdi)
+    jne     .Lxly_89
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_89
+    cmpq    $22, 40(%r11)
+    jle     .Lxly_89
+    movq    48(%r11), %r11
+    movq    176(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_89
+    movq    %r15, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_90
+.Lxly_89:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_3e7fe942f71f1e61(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_90:
+    movq    %rax, %r13
+    leaq    .Lxly_str_f5f24e28691fb21f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_91
+    cmpl    $10, (%rdi)
+    jne     .Lxly_91
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_91
+    cmpq    $22, 40(%r11)
+    jle     .Lxly_91
+    movq    48(%r11), %r11
+    movq    176(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_91
+    movq    %r13, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_92
+.Lxly_91:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_3e7fe942f71f1e61(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_92:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_93
+    cmpl    $10, (%rdi)
+    jne     .Lxly_93
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_93
+    cmpq    $22, 40(%r11)
+    jle     .Lxly_93
+    movq    48(%r11), %r11
+    movq    176(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_93
+    movq    %r15, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_94
+.Lxly_93:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_3e7fe942f71f1e61(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_94:
+    movq    %rax, %r13
+    leaq    .Lxly_str_cae09291588b48b6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_95
+    cmpl    $10, (%rdi)
+    jne     .Lxly_95
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_95
+    cmpq    $22, 40(%r11)
+    jle     .Lxly_95
+    movq    48(%r11), %r11
+    movq    176(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_95
+    movq    %r13, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_96
+.Lxly_95:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_3e7fe942f71f1e61(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_96:
+    movq    %rax, %r15
+    leaq    .Lxly_str_965381c5f90796ee(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_97
+    cmpl    $10, (%rdi)
+    jne     .Lxly_97
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_97
+    cmpq    $9, 40(%r11)
+    jle     .Lxly_97
+    movq    48(%r11), %r11
+    movq    72(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_97
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_98
+.Lxly_97:
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_98:
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_99
+    cmpl    $0, (%rsi)
+    jne     .Lxly_99
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1024(%rbp)
+    leaq    -1032(%rbp), %rax
+    jmp     .Lxly_100
+.Lxly_99:
+    call    xly_add
+.Lxly_100:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fd068868d3d10c67(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    .Lxly_atom_ea11573f1af59eb5(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_101
+    cmpl    $0, (%rsi)
+    jne     .Lxly_101
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1152(%rbp)
+    leaq    -1160(%rbp), %rax
+    jmp     .Lxly_102
+.Lxly_101:
+    call    xly_add
+.Lxly_102:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_103
+    cmpl    $10, (%rdi)
+    jne     .Lxly_103
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_103
+    cmpq    $24, 40(%r11)
+    jle     .Lxly_103
+    movq    48(%r11), %r11
+    movq    192(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_103
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_104
+.Lxly_103:
+    leaq    .Lxly_str_f531f89544a910a2(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_104:
+    movq    %rax, %r12
+    leaq    .Lxly_str_e881f9063fb32ffc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_105
+    cmpl    $10, (%rdi)
+    jne     .Lxly_105
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_105
+    cmpq    $23, 40(%r11)
+    jle     .Lxly_105
+    movq    48(%r11), %r11
+    movq    184(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_105
+    movq    %r12, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_106
+.Lxly_105:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_246cc4967f8754f8(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_106:
+    movq    %rax, %r15
+    leaq    .Lxly_str_e881fc063fb33515(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_107
+    cmpl    $10, (%rdi)
+    jne     .Lxly_107
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_107
+    cmpq    $23, 40(%r11)
+    jle     .Lxly_107
+    movq    48(%r11), %r11
+    movq    184(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_107
+    movq    %r15, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_108
+.Lxly_107:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_246cc4967f8754f8(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_108:
+    movq    %rax, %r12
+    leaq    .Lxly_str_e881fb063fb33362(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_109
+    cmpl    $10, (%rdi)
+    jne     .Lxly_109
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_109
+    cmpq    $23, 40(%r11)
+    jle     .Lxly_109
+    movq    48(%r11), %r11
+    movq    184(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_109
+    movq    %r12, %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_110
+.Lxly_109:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_246cc4967f8754f8(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_110:
+    movq    %rax, %r15
+    leaq    .Lxly_str_70cdaa6f98cef2bf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r14, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_111
+    cmpl    $10, (%rdi)
+    jne     .Lxly_111
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_111
+    cmpq    $9, 40(%r11)
+    jle     .Lxly_111
+    movq    48(%r11), %r11
+    movq    72(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_111
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_112
+.Lxly_111:
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_112:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0f26d1c2ed6679c8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k284:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k285:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k286:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k287:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k288:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k289:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k290:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k291:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k292:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k293:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k294:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k295:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k296:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k297:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k298:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k299:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k300:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k301:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k302:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k303:
+    .quad   0, 0x407f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k304:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k305:
+    .quad   0, 0x4069000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k306:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k307:
+    .quad   0, 0x4072c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k308:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k309:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Stack.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf0_0_k9(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf0_0_k10(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k9:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf0_0_k10:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Stack.push:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f1_1
+    call    xly_null
+.Lxly_f1_1:
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf1_0_k9(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_3
+.Lxly_f1_2:
+    call    xly_add
+.Lxly_f1_3:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k9:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Stack.is_empty:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f2_1
+    call    xly_null
+.Lxly_f2_1:
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf2_0_k7(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f2_3
+.Lxly_f2_2:
+    call    xly_eq
+.Lxly_f2_3:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf2_0_k7:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Stack.peek:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f3_1
+    call    xly_null
+.Lxly_f3_1:
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf3_0_k15(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_3
+.Lxly_f3_2:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_3:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf3_0_b2
+.Lxly_irf3_0_b1:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b2:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f3_4
+    call    xly_null
+.Lxly_f3_4:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf3_0_k15:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Stack.describe:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $432, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    leaq    .Lxly_str_ff9834f572e6a4bb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f4_1
+    call    xly_null
+.Lxly_f4_1:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f4_3
+.Lxly_f4_2:
+    call    xly_add
+.Lxly_f4_3:
+    movq    %rax, %r14
+    leaq    .Lxly_str_927ccc9fb73896f3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f4_5
+.Lxly_f4_4:
+    call    xly_add
+.Lxly_f4_5:
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f4_6
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f4_6
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f4_6
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_f4_6
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f4_6
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f4_7
+.Lxly_f4_6:
+    leaq    .Lxly_str_53fe3500ca90ab53(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f4_7:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f4_9
+.Lxly_f4_8:
+    call    xly_add
+.Lxly_f4_9:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.length:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f6_1
+    call    xly_null
+.Lxly_f6_1:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f6_2
+    call    xly_null
+.Lxly_f6_2:
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f6_3
+    call    xly_null
+.Lxly_f6_3:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f6_4
+    call    xly_null
+.Lxly_f6_4:
+    movq    %rax, %r12
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f7_1
+    call    xly_null
+.Lxly_f7_1:
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_3
+.Lxly_f7_2:
+    call    xly_add
+.Lxly_f7_3:
+    movq    %rax, -64(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f7_4
+    call    xly_null
+.Lxly_f7_4:
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_6
+.Lxly_f7_5:
+    call    xly_add
+.Lxly_f7_6:
+    movq    %rax, %r12
+.Lxly_irf7_0_b3:
+    movq    %r13, %rax
+    movq    -64(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %r13, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_irf7_0_b2:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.scale:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    leaq    .Lxly_class_1(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f8_1
+    call    xly_null
+.Lxly_f8_1:
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f8_2
+    call    xly_null
+.Lxly_f8_2:
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf8_0_b3:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r13, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r13, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_irf8_0_b2:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.dot:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f9_1
+    call    xly_null
+.Lxly_f9_1:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f9_2
+    call    xly_null
+.Lxly_f9_2:
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.to_string:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $432, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    leaq    .Lxly_str_af63a54c86018f17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f10_1
+    call    xly_null
+.Lxly_f10_1:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f10_3
+.Lxly_f10_2:
+    call    xly_add
+.Lxly_f10_3:
+    movq    %rax, %r14
+    leaq    .Lxly_str_07d38007b49acdd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f10_5
+.Lxly_f10_4:
+    call    xly_add
+.Lxly_f10_5:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f10_6
+    call    xly_null
+.Lxly_f10_6:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f10_8
+.Lxly_f10_7:
+    call    xly_add
+.Lxly_f10_8:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f10_10
+.Lxly_f10_9:
+    call    xly_add
+.Lxly_f10_10:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Vector2D.describe:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $432, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    leaq    .Lxly_str_7bb42119e9b1a3e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f11_1
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f11_1
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f11_1
+    cmpq    $9, 40(%r11)
+    jle     .Lxly_f11_1
+    movq    48(%r11), %r11
+    movq    72(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f11_1
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f11_2
+.Lxly_f11_1:
+    leaq    .Lxly_str_ce3424bd1d05d5bc(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f11_2:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f11_4
+.Lxly_f11_3:
+    call    xly_add
+.Lxly_f11_4:
+    movq    %rax, %r14
+    leaq    .Lxly_str_a6f2be6b48487576(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f11_6
+.Lxly_f11_5:
+    call    xly_add
+.Lxly_f11_6:
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f11_7
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f11_7
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f11_7
+    cmpq    $5, 40(%r11)
+    jle     .Lxly_f11_7
+    movq    48(%r11), %r11
+    movq    40(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f11_7
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f11_8
+.Lxly_f11_7:
+    leaq    .Lxly_str_ea11573f1af59eb5(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f11_8:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f11_10
+.Lxly_f11_9:
+    call    xly_add
+.Lxly_f11_10:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Animal.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Animal.speak:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f13_1
+    call    xly_null
+.Lxly_f13_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_639921ffe6530ede(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f13_3
+.Lxly_f13_2:
+    call    xly_add
+.Lxly_f13_3:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Animal.describe:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $560, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -516(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f14_1
+    call    xly_null
+.Lxly_f14_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_07c5a007b48ec6d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f14_3
+.Lxly_f14_2:
+    call    xly_add
+.Lxly_f14_3:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f14_4
+    call    xly_null
+.Lxly_f14_4:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f14_6
+.Lxly_f14_5:
+    call    xly_add
+.Lxly_f14_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_3be47dd908da8fa7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f14_8
+.Lxly_f14_7:
+    call    xly_add
+.Lxly_f14_8:
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_f14_9
+    cmpl    $10, (%rdi)
+    jne     .Lxly_f14_9
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f14_9
+    cmpq    $10, 40(%r11)
+    jle     .Lxly_f14_9
+    movq    48(%r11), %r11
+    movq    80(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_f14_9
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_f14_10
+.Lxly_f14_9:
+    leaq    .Lxly_str_2273708aa0141329(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_f14_10:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f14_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f14_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -544(%rbp)
+    leaq    -552(%rbp), %rax
+    jmp     .Lxly_f14_12
+.Lxly_f14_11:
+    call    xly_add
+.Lxly_f14_12:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Cat.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r13
+.Lxly_irf15_0_b2:
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_irf15_0_k15(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_irf15_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf15_0_k15:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Cat.speak:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f16_1
+    call    xly_null
+.Lxly_f16_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_0a9fa05156b25698(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f16_3
+.Lxly_f16_2:
+    call    xly_add
+.Lxly_f16_3:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Cat.purr:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -124(%rbp)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f17_1
+    call    xly_null
+.Lxly_f17_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_f3ca14e62e966fe0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f17_3
+.Lxly_f17_2:
+    call    xly_add
+.Lxly_f17_3:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Bird.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+.Lxly_irf18_0_b2:
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_irf18_0_k15(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_irf18_0_b1:
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf18_0_k15:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Bird.speak:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f19_1
+    call    xly_null
+.Lxly_f19_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_1a5c4fcff9ddfcb5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_3
+.Lxly_f19_2:
+    call    xly_add
+.Lxly_f19_3:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Bird.fly:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $304, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f20_1
+    call    xly_null
+.Lxly_f20_1:
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf20_0_b3
+.Lxly_irf20_0_b1:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f20_2
+    call    xly_null
+.Lxly_f20_2:
+    movq    %rax, %r13
+    leaq    .Lxly_str_f49c3e3e74d4fb49(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f20_4
+.Lxly_f20_3:
+    call    xly_add
+.Lxly_f20_4:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_irf20_0_b2
+.Lxly_irf20_0_b3:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f20_5
+    call    xly_null
+.Lxly_f20_5:
+    movq    %rax, %r12
+    leaq    .Lxly_str_ab45adc8602ddc69(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f20_6
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f20_6
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f20_7
+.Lxly_f20_6:
+    call    xly_add
+.Lxly_f20_7:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf20_0_b2:
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Spider.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r13
+.Lxly_irf21_0_b2:
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    leaq    .Lxly_irf21_0_k15(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+.Lxly_irf21_0_b1:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf21_0_k16(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf21_0_k15:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf21_0_k16:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Spider.speak:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f22_1
+    call    xly_null
+.Lxly_f22_1:
+    movq    %rax, %r12
+    leaq    .Lxly_str_bf9124a54434b9d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_3
+.Lxly_f22_2:
+    call    xly_add
+.Lxly_f22_3:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Spider.spin_web:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $304, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f23_1
+    call    xly_null
+.Lxly_f23_1:
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf23_0_k14(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f23_3
+.Lxly_f23_2:
+    call    xly_add
+.Lxly_f23_3:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f23_4
+    call    xly_null
+.Lxly_f23_4:
+    movq    %rax, %r14
+    leaq    .Lxly_str_758f806651139120(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f23_6
+.Lxly_f23_5:
+    call    xly_add
+.Lxly_f23_6:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f23_7
+    call    xly_null
+.Lxly_f23_7:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f23_9
+.Lxly_f23_8:
+    call    xly_add
+.Lxly_f23_9:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf23_0_k14:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Counter.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Counter.increment:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f25_1
+    call    xly_null
+.Lxly_f25_1:
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf25_0_k9(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_3
+.Lxly_f25_2:
+    call    xly_add
+.Lxly_f25_3:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf25_0_k9:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Counter.decrement:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f26_1
+    call    xly_null
+.Lxly_f26_1:
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Counter.add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f27_1
+    call    xly_null
+.Lxly_f27_1:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_3
+.Lxly_f27_2:
+    call    xly_add
+.Lxly_f27_3:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Counter.reset:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf28_0_k7(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf28_0_k7:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Counter.get:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f29_1
+    call    xly_null
+.Lxly_f29_1:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_BankAccount.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf30_0_k12(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf30_0_k12:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_BankAccount.deposit:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $448, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -404(%rbp)
+    movl    $-1, -276(%rbp)
+    movl    $-1, -148(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf31_0_b2
+.Lxly_irf31_0_b1:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f31_1
+    call    xly_null
+.Lxly_f31_1:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f31_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f31_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f31_3
+.Lxly_f31_2:
+    call    xly_add
+.Lxly_f31_3:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f31_4
+    call    xly_null
+.Lxly_f31_4:
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf31_0_k25(%rip), %rax
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f31_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f31_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f31_6
+.Lxly_f31_5:
+    call    xly_add
+.Lxly_f31_6:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    leaq    .Lxly_str_a888f8d248c6955b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f31_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f31_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f31_8
+.Lxly_f31_7:
+    call    xly_add
+.Lxly_f31_8:
+    movq    %rax, %r14
+    leaq    .Lxly_str_43844e57554f3bdd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f31_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f31_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    jmp     .Lxly_f31_10
+.Lxly_f31_9:
+    call    xly_add
+.Lxly_f31_10:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f31_11
+    call    xly_null
+.Lxly_f31_11:
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f31_12
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f31_12
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -432(%rbp)
+    leaq    -440(%rbp), %rax
+    jmp     .Lxly_f31_13
+.Lxly_f31_12:
+    call    xly_add
+.Lxly_f31_13:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf31_0_b2:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf31_0_k25:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_BankAccount.withdraw:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $576, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movl    $-1, -540(%rbp)
+    movl    $-1, -412(%rbp)
+    movl    $-1, -284(%rbp)
+    movl    $-1, -156(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf32_0_b6
+.Lxly_irf32_0_b4:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f32_1
+    call    xly_null
+.Lxly_f32_1:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f32_3
+.Lxly_f32_2:
+    call    xly_lte
+.Lxly_f32_3:
+    movq    %rax, %r15
+    jmp     .Lxly_irf32_0_b5
+.Lxly_irf32_0_b6:
+    movq    %r14, %r15
+.Lxly_irf32_0_b5:
+    movq    %r15, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf32_0_b3
+.Lxly_irf32_0_b1:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f32_4
+    call    xly_null
+.Lxly_f32_4:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f32_5
+    call    xly_null
+.Lxly_f32_5:
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf32_0_k38(%rip), %rax
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_6
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_6
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f32_7
+.Lxly_f32_6:
+    call    xly_add
+.Lxly_f32_7:
+    movq    %rax, %r15
+    movq    %rbx, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    leaq    .Lxly_str_63a3f1de178eaf12(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -184(%rbp)
+    leaq    -192(%rbp), %rax
+    jmp     .Lxly_f32_9
+.Lxly_f32_8:
+    call    xly_add
+.Lxly_f32_9:
+    movq    %rax, %r15
+    leaq    .Lxly_str_43844e57554f3bdd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_10
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_10
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -312(%rbp)
+    leaq    -320(%rbp), %rax
+    jmp     .Lxly_f32_11
+.Lxly_f32_10:
+    call    xly_add
+.Lxly_f32_11:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f32_12
+    call    xly_null
+.Lxly_f32_12:
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -440(%rbp)
+    leaq    -448(%rbp), %rax
+    jmp     .Lxly_f32_14
+.Lxly_f32_13:
+    call    xly_add
+.Lxly_f32_14:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_irf32_0_b2
+.Lxly_irf32_0_b3:
+    leaq    .Lxly_str_2bee1a5b199656d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -568(%rbp)
+    leaq    -576(%rbp), %rax
+    jmp     .Lxly_f32_16
+.Lxly_f32_15:
+    call    xly_add
+.Lxly_f32_16:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf32_0_b2:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf32_0_k38:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_BankAccount.transfer:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $880, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movl    $-1, -844(%rbp)
+    movl    $-1, -716(%rbp)
+    movl    $-1, -588(%rbp)
+    movl    $-1, -460(%rbp)
+    movl    $-1, -332(%rbp)
+    movl    $-1, -204(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf33_0_b6
+.Lxly_irf33_0_b4:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f33_1
+    call    xly_null
+.Lxly_f33_1:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_2
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f33_3
+.Lxly_f33_2:
+    call    xly_lte
+.Lxly_f33_3:
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %r14
+    jmp     .Lxly_irf33_0_b5
+.Lxly_irf33_0_b6:
+    movq    %r15, %r14
+.Lxly_irf33_0_b5:
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf33_0_b3
+.Lxly_irf33_0_b1:
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f33_4
+    call    xly_null
+.Lxly_f33_4:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %rbx, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %r12, %rdi
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f33_6
+.Lxly_f33_5:
+    call    xly_add
+.Lxly_f33_6:
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_420234a0f998390b(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f33_7
+    call    xly_null
+.Lxly_f33_7:
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf33_0_k53(%rip), %rax
+    movq    %rax, -80(%rbp)
+    movq    %r14, %rdi
+    movq    -80(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_8
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_8
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f33_9
+.Lxly_f33_8:
+    call    xly_add
+.Lxly_f33_9:
+    movq    %rax, -88(%rbp)
+    movq    %rbx, %rax
+    movq    -88(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 16(%rax)
+    movq    %r12, %rdi
+    movq    .Lxly_atom_1cfb70cd018571b0(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    leaq    .Lxly_irf33_0_k54(%rip), %rax
+    movq    %rax, -96(%rbp)
+    movq    %r14, %rdi
+    movq    -96(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_10
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_10
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f33_11
+.Lxly_f33_10:
+    call    xly_add
+.Lxly_f33_11:
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_1cfb70cd018571b0(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_6d186cc86eff9a50(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_12
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_12
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -232(%rbp)
+    leaq    -240(%rbp), %rax
+    jmp     .Lxly_f33_13
+.Lxly_f33_12:
+    call    xly_add
+.Lxly_f33_13:
+    movq    %rax, %r14
+    leaq    .Lxly_str_a83ed8f75ab6ee09(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_14
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_14
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -360(%rbp)
+    leaq    -368(%rbp), %rax
+    jmp     .Lxly_f33_15
+.Lxly_f33_14:
+    call    xly_add
+.Lxly_f33_15:
+    movq    %rax, -104(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f33_16
+    call    xly_null
+.Lxly_f33_16:
+    movq    %rax, %r15
+    movq    -104(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -488(%rbp)
+    leaq    -496(%rbp), %rax
+    jmp     .Lxly_f33_18
+.Lxly_f33_17:
+    call    xly_add
+.Lxly_f33_18:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_619d07729e78d42e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -616(%rbp)
+    leaq    -624(%rbp), %rax
+    jmp     .Lxly_f33_20
+.Lxly_f33_19:
+    call    xly_add
+.Lxly_f33_20:
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    .Lxly_atom_a692f75ab08b8cf4(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -744(%rbp)
+    leaq    -752(%rbp), %rax
+    jmp     .Lxly_f33_22
+.Lxly_f33_21:
+    call    xly_add
+.Lxly_f33_22:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_irf33_0_b2
+.Lxly_irf33_0_b3:
+    leaq    .Lxly_str_9d57c4efeb0d1026(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f33_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f33_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -872(%rbp)
+    leaq    -880(%rbp), %rax
+    jmp     .Lxly_f33_24
+.Lxly_f33_23:
+    call    xly_add
+.Lxly_f33_24:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_irf33_0_b2:
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf33_0_k53:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf33_0_k54:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_BankAccount.statement:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $816, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movl    $-1, -772(%rbp)
+    movl    $-1, -644(%rbp)
+    movl    $-1, -516(%rbp)
+    movl    $-1, -388(%rbp)
+    movl    $-1, -260(%rbp)
+    movl    $-1, -132(%rbp)
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f34_1
+    call    xly_null
+.Lxly_f34_1:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -160(%rbp)
+    leaq    -168(%rbp), %rax
+    jmp     .Lxly_f34_3
+.Lxly_f34_2:
+    call    xly_add
+.Lxly_f34_3:
+    movq    %rax, %r14
+    leaq    .Lxly_str_a4e78c184e430229(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -288(%rbp)
+    leaq    -296(%rbp), %rax
+    jmp     .Lxly_f34_5
+.Lxly_f34_4:
+    call    xly_add
+.Lxly_f34_5:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f34_6
+    call    xly_null
+.Lxly_f34_6:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -416(%rbp)
+    leaq    -424(%rbp), %rax
+    jmp     .Lxly_f34_8
+.Lxly_f34_7:
+    call    xly_add
+.Lxly_f34_8:
+    movq    %rax, %r14
+    leaq    .Lxly_str_07c5a007b48ec6d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -544(%rbp)
+    leaq    -552(%rbp), %rax
+    jmp     .Lxly_f34_10
+.Lxly_f34_9:
+    call    xly_add
+.Lxly_f34_10:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    16(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f34_11
+    call    xly_null
+.Lxly_f34_11:
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_12
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_12
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -672(%rbp)
+    leaq    -680(%rbp), %rax
+    jmp     .Lxly_f34_13
+.Lxly_f34_12:
+    call    xly_add
+.Lxly_f34_13:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_e72728aeaf7b81ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f34_14
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f34_14
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -800(%rbp)
+    leaq    -808(%rbp), %rax
+    jmp     .Lxly_f34_15
+.Lxly_f34_14:
+    call    xly_add
+.Lxly_f34_15:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_StringBuilder.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf35_0_k9(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf35_0_k9:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_StringBuilder.append:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f36_1
+    call    xly_null
+.Lxly_f36_1:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f36_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f36_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f36_3
+.Lxly_f36_2:
+    call    xly_add
+.Lxly_f36_3:
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f36_4
+    call    xly_null
+.Lxly_f36_4:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f36_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f36_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f36_6
+.Lxly_f36_5:
+    call    xly_add
+.Lxly_f36_6:
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_StringBuilder.append_line:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $320, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -276(%rbp)
+    movl    $-1, -148(%rbp)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f37_1
+    call    xly_null
+.Lxly_f37_1:
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f37_2
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f37_2
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f37_3
+.Lxly_f37_2:
+    call    xly_add
+.Lxly_f37_3:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63c74c8601c8dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f37_4
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f37_4
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f37_5
+.Lxly_f37_4:
+    call    xly_add
+.Lxly_f37_5:
+    movq    %rax, %r15
+    movq    %rbx, %rax
+    movq    %r15, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    8(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f37_6
+    call    xly_null
+.Lxly_f37_6:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f37_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f37_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    jmp     .Lxly_f37_8
+.Lxly_f37_7:
+    call    xly_add
+.Lxly_f37_8:
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf37_0_k18(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f37_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f37_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f37_10
+.Lxly_f37_9:
+    call    xly_add
+.Lxly_f37_10:
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf37_0_k18:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_StringBuilder.to_string:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f38_1
+    call    xly_null
+.Lxly_f38_1:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_StringBuilder.clear:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf39_0_k10(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    %r13, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 8(%rax)
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf39_0_k10:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_class_0:
+    .quad   .Lxly_str_ae4f7c13b7ec18ff
+    .quad   0
+    .quad   .Lxly_fn_Stack.init
+    .quad   2
+    .quad   .Lxly_class_0_fields
+    .quad   25
+    .quad   .Lxly_class_0_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_0_fields:
+    .quad   .Lxly_str_4dea9618e618ae3c
+    .quad   .Lxly_str_f5e303190ce49c5b
+.Lxly_class_0_vtable:
+    .quad   .Lxly_fn_Stack.init
+    .quad   .Lxly_fn_Stack.push
+    .quad   .Lxly_fn_Stack.is_empty
+    .quad   .Lxly_fn_Stack.peek
+    .quad   .Lxly_fn_Stack.describe
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_1:
+    .quad   .Lxly_str_1c23726b69043edc
+    .quad   0
+    .quad   .Lxly_fn_Vector2D.init
+    .quad   2
+    .quad   .Lxly_class_1_fields
+    .quad   25
+    .quad   .Lxly_class_1_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_1_fields:
+    .quad   .Lxly_str_af63f54c86021707
+    .quad   .Lxly_str_af63f44c86021554
+.Lxly_class_1_vtable:
+    .quad   .Lxly_fn_Vector2D.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Vector2D.describe
+    .quad   .Lxly_fn_Vector2D.length
+    .quad   .Lxly_fn_Vector2D.add
+    .quad   .Lxly_fn_Vector2D.scale
+    .quad   .Lxly_fn_Vector2D.dot
+    .quad   .Lxly_fn_Vector2D.to_string
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_2:
+    .quad   .Lxly_str_d294121372903b3d
+    .quad   0
+    .quad   .Lxly_fn_Animal.init
+    .quad   2
+    .quad   .Lxly_class_2_fields
+    .quad   25
+    .quad   .Lxly_class_2_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_2_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_24b477ada208116c
+.Lxly_class_2_vtable:
+    .quad   .Lxly_fn_Animal.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Animal.describe
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Animal.speak
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_3:
+    .quad   .Lxly_str_0bec2719aa9daf87
+    .quad   .Lxly_class_2
+    .quad   .Lxly_fn_Cat.init
+    .quad   3
+    .quad   .Lxly_class_3_fields
+    .quad   25
+    .quad   .Lxly_class_3_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_3_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_24b477ada208116c
+    .quad   .Lxly_str_506e8b4017fb0c4e
+.Lxly_class_3_vtable:
+    .quad   .Lxly_fn_Cat.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Animal.describe
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Cat.speak
+    .quad   .Lxly_fn_Cat.purr
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_4:
+    .quad   .Lxly_str_097a1da7d249fa52
+    .quad   .Lxly_class_2
+    .quad   .Lxly_fn_Bird.init
+    .quad   3
+    .quad   .Lxly_class_4_fields
+    .quad   25
+    .quad   .Lxly_class_4_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_4_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_24b477ada208116c
+    .quad   .Lxly_str_5dc4b5f855b1ca5f
+.Lxly_class_4_vtable:
+    .quad   .Lxly_fn_Bird.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Animal.describe
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Bird.speak
+    .quad   0
+    .quad   .Lxly_fn_Bird.fly
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_5:
+    .quad   .Lxly_str_6c8d35022983ff88
+    .quad   .Lxly_class_2
+    .quad   .Lxly_fn_Spider.init
+    .quad   3
+    .quad   .Lxly_class_5_fields
+    .quad   25
+    .quad   .Lxly_class_5_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_5_fields:
+    .quad   .Lxly_str_c4bcadba8e631b86
+    .quad   .Lxly_str_24b477ada208116c
+    .quad   .Lxly_str_640a7484e9e01021
+.Lxly_class_5_vtable:
+    .quad   .Lxly_fn_Spider.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Animal.describe
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Spider.speak
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Spider.spin_web
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_6:
+    .quad   .Lxly_str_9d1c372fe94004c3
+    .quad   0
+    .quad   .Lxly_fn_Counter.init
+    .quad   1
+    .quad   .Lxly_class_6_fields
+    .quad   25
+    .quad   .Lxly_class_6_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_6_fields:
+    .quad   .Lxly_str_7ce4fd9430e80cea
+.Lxly_class_6_vtable:
+    .quad   .Lxly_fn_Counter.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Counter.add
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_Counter.increment
+    .quad   .Lxly_fn_Counter.decrement
+    .quad   .Lxly_fn_Counter.reset
+    .quad   .Lxly_fn_Counter.get
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_7:
+    .quad   .Lxly_str_8a8efa8aa60656d2
+    .quad   0
+    .quad   .Lxly_fn_BankAccount.init
+    .quad   3
+    .quad   .Lxly_class_7_fields
+    .quad   25
+    .quad   .Lxly_class_7_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_7_fields:
+    .quad   .Lxly_str_a692f75ab08b8cf4
+    .quad   .Lxly_str_420234a0f998390b
+    .quad   .Lxly_str_1cfb70cd018571b0
+.Lxly_class_7_vtable:
+    .quad   .Lxly_fn_BankAccount.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_BankAccount.deposit
+    .quad   .Lxly_fn_BankAccount.withdraw
+    .quad   .Lxly_fn_BankAccount.transfer
+    .quad   .Lxly_fn_BankAccount.statement
+    .quad   0
+    .quad   0
+    .quad   0
+.Lxly_class_8:
+    .quad   .Lxly_str_294ecc0083145dff
+    .quad   0
+    .quad   .Lxly_fn_StringBuilder.init
+    .quad   2
+    .quad   .Lxly_class_8_fields
+    .quad   25
+    .quad   .Lxly_class_8_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_8_fields:
+    .quad   .Lxly_str_d86c0af0b398153b
+    .quad   .Lxly_str_ea11573f1af59eb5
+.Lxly_class_8_vtable:
+    .quad   .Lxly_fn_StringBuilder.init
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_StringBuilder.to_string
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   0
+    .quad   .Lxly_fn_StringBuilder.append
+    .quad   .Lxly_fn_StringBuilder.append_line
+    .quad   .Lxly_fn_StringBuilder.clear
+.Lxly_selectors:
+    .quad   .Lxly_str_f5d2afc57ab57213
+    .quad   .Lxly_str_6c80030e2762459d
+    .quad   .Lxly_str_53fe3500ca90ab53
+    .quad   .Lxly_str_dff7680dd73b88fe
+    .quad   .Lxly_str_498cc41b0d228cc8
+    .quad   .Lxly_str_ea11573f1af59eb5
+    .quad   .Lxly_str_e70bc3190530e654
+    .quad   .Lxly_str_6aacb9fbb71a1d91
+    .quad   .Lxly_str_caaf2818f47458a0
+    .quad   .Lxly_str_ce3424bd1d05d5bc
+    .quad   .Lxly_str_2273708aa0141329
+    .quad   .Lxly_str_6c7c070e275e6392
+    .quad   .Lxly_str_dcaf8b18fed7c502
+    .quad   .Lxly_str_a044c90599d40d84
+    .quad   .Lxly_str_1d5858eba2deedbe
+    .quad   .Lxly_str_2b652968055c38d2
+    .quad   .Lxly_str_0f136ff2c086b760
+    .quad   .Lxly_str_d4e26318faaa79f7
+    .quad   .Lxly_str_6c86e9a8e0e445d5
+    .quad   .Lxly_str_f2d50b75b3e12f37
+    .quad   .Lxly_str_2af6c6f4ff6889e6
+    .quad   .Lxly_str_63203b95ecf7b916
+    .quad   .Lxly_str_3e7fe942f71f1e61
+    .quad   .Lxly_str_246cc4967f8754f8
+    .quad   .Lxly_str_f531f89544a910a2
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   6
+.Lxly_atoms:
+.Lxly_atom_ea11573f1af59eb5:
+    .quad   .Lxly_str_ea11573f1af59eb5
+.Lxly_atom_af63f54c86021707:
+    .quad   .Lxly_str_af63f54c86021707
+.Lxly_atom_af63f44c86021554:
+    .quad   .Lxly_str_af63f44c86021554
+.Lxly_atom_420234a0f998390b:
+    .quad   .Lxly_str_420234a0f998390b
+.Lxly_atom_1cfb70cd018571b0:
+    .quad   .Lxly_str_1cfb70cd018571b0
+.Lxly_atom_a692f75ab08b8cf4:
+    .quad   .Lxly_str_a692f75ab08b8cf4
+
+.section .rodata
+.Lxly_str_1133585740502798:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_a3829a7d67a0b128:
+    .asciz  "\342\225\221        Xenly OOP Showcase                \342\225\221"
+.Lxly_str_51c7dc3cf57b90f0:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_f4af8dfdfc72c7c1:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_15967dbfdb8235df:
+    .asciz  "\342\224\202  Stack (dynamic array simulation)          \342\224\202"
+.Lxly_str_3b90f0855eebf0c1:
+    .asciz  "\342\224\224\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\230"
+.Lxly_str_498cc41b0d228cc8:
+    .asciz  "describe"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_8cae7aeb2c3eb76c:
+    .asciz  "Peek:"
+.Lxly_str_dff7680dd73b88fe:
+    .asciz  "peek"
+.Lxly_str_39bd8c7e72c1838b:
+    .asciz  "\342\224\202  Vector2D (2D math)                        \342\224\202"
+.Lxly_str_e70bc3190530e654:
+    .asciz  "add"
+.Lxly_str_bace1303fed238c0:
+    .asciz  "v1 + v2 ="
+.Lxly_str_ce3424bd1d05d5bc:
+    .asciz  "to_string"
+.Lxly_str_6aacb9fbb71a1d91:
+    .asciz  "scale"
+.Lxly_str_e5085eaf7359bf17:
+    .asciz  "v1 * 2  ="
+.Lxly_str_b279d425370bbb5d:
+    .asciz  "v1 . v2 ="
+.Lxly_str_caaf2818f47458a0:
+    .asciz  "dot"
+.Lxly_str_99bd5bccaa99edc3:
+    .asciz  "v1 length ="
+.Lxly_str_ea11573f1af59eb5:
+    .asciz  "length"
+.Lxly_str_c585f2d40cc6beae:
+    .asciz  "\342\224\202  Animal Hierarchy (polymorphism)           \342\224\202"
+.Lxly_str_14ccc4eb44f18325:
+    .asciz  "Whiskers"
+.Lxly_str_667532e355a13249:
+    .asciz  "Tweety"
+.Lxly_str_6d24e019e23ba1ce:
+    .asciz  "Tux"
+.Lxly_str_470c003b9da7eb0b:
+    .asciz  "Charlotte"
+.Lxly_str_6c7c070e275e6392:
+    .asciz  "purr"
+.Lxly_str_dcaf8b18fed7c502:
+    .asciz  "fly"
+.Lxly_str_a044c90599d40d84:
+    .asciz  "spin_web"
+.Lxly_str_cf393b21313bf5e4:
+    .asciz  "\342\224\202  Counter (method chaining pattern)         \342\224\202"
+.Lxly_str_1d5858eba2deedbe:
+    .asciz  "increment"
+.Lxly_str_8e16f5b42b7b07c8:
+    .asciz  "After 3 increments:"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_53763e29d9801c64:
+    .asciz  "After add(10):"
+.Lxly_str_2b652968055c38d2:
+    .asciz  "decrement"
+.Lxly_str_ee0507677076e947:
+    .asciz  "After 2 decrements:"
+.Lxly_str_0f136ff2c086b760:
+    .asciz  "reset"
+.Lxly_str_3a2568a65842ab00:
+    .asciz  "After reset:"
+.Lxly_str_64d2c35667cc594b:
+    .asciz  "\342\224\202  BankAccount (encapsulation)               \342\224\202"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_16566419b10316b4:
+    .asciz  "Bob"
+.Lxly_str_63203b95ecf7b916:
+    .asciz  "statement"
+.Lxly_str_6c86e9a8e0e445d5:
+    .asciz  "deposit"
+.Lxly_str_f2d50b75b3e12f37:
+    .asciz  "withdraw"
+.Lxly_str_2af6c6f4ff6889e6:
+    .asciz  "transfer"
+.Lxly_str_30ec875f48e36925:
+    .asciz  "\342\224\202  StringBuilder                             \342\224\202"
+.Lxly_str_63f0bfacf2c00f6b:
+    .asciz  "Hello"
+.Lxly_str_3e7fe942f71f1e61:
+    .asciz  "append"
+.Lxly_str_07d38007b49acdd1:
+    .asciz  ", "
+.Lxly_str_f5f24e28691fb21f:
+    .asciz  "Xenly"
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_cae09291588b48b6:
+    .asciz  "World!"
+.Lxly_str_965381c5f90796ee:
+    .asciz  "Built string: "
+.Lxly_str_fd068868d3d10c67:
+    .asciz  "Length: "
+.Lxly_str_f531f89544a910a2:
+    .asciz  "clear"
+.Lxly_str_e881f9063fb32ffc:
+    .asciz  "Line 1"
+.Lxly_str_246cc4967f8754f8:
+    .asciz  "append_line"
+.Lxly_str_e881fc063fb33515:
+    .asciz  "Line 2"
+.Lxly_str_e881fb063fb33362:
+    .asciz  "Line 3"
+.Lxly_str_70cdaa6f98cef2bf:
+    .asciz  "Multi-line:"
+.Lxly_str_0f26d1c2ed6679c8:
+    .asciz  "\342\225\221           All OOP tests passed!          \342\225\221"
+.Lxly_str_ff9834f572e6a4bb:
+    .asciz  "Stack: size="
+.Lxly_str_927ccc9fb73896f3:
+    .asciz  " empty="
+.Lxly_str_53fe3500ca90ab53:
+    .asciz  "is_empty"
+.Lxly_str_af63a54c86018f17:
+    .asciz  "("
+.Lxly_str_af63a44c86018d64:
+    .asciz  ")"
+.Lxly_str_7bb42119e9b1a3e5:
+    .asciz  "Vec"
+.Lxly_str_a6f2be6b48487576:
+    .asciz  " length="
+.Lxly_str_639921ffe6530ede:
+    .asciz  " makes a sound"
+.Lxly_str_07c5a007b48ec6d5:
+    .asciz  " ("
+.Lxly_str_3be47dd908da8fa7:
+    .asciz  " legs): "
+.Lxly_str_2273708aa0141329:
+    .asciz  "speak"
+.Lxly_str_0a9fa05156b25698:
+    .asciz  " says: Meow!"
+.Lxly_str_f3ca14e62e966fe0:
+    .asciz  " is purring..."
+.Lxly_str_1a5c4fcff9ddfcb5:
+    .asciz  " says: Tweet!"
+.Lxly_str_f49c3e3e74d4fb49:
+    .asciz  " is flying!"
+.Lxly_str_ab45adc8602ddc69:
+    .asciz  " cannot fly."
+.Lxly_str_bf9124a54434b9d5:
+    .asciz  " says: ..."
+.Lxly_str_758f806651139120:
+    .asciz  " spun a web! Total webs: "
+.Lxly_str_a888f8d248c6955b:
+    .asciz  "  + Deposited "
+.Lxly_str_43844e57554f3bdd:
+    .asciz  " \342\206\222 balance: "
+.Lxly_str_63a3f1de178eaf12:
+    .asciz  "  - Withdrew "
+.Lxly_str_2bee1a5b199656d4:
+    .asciz  "  ! Insufficient funds for withdrawal of "
+.Lxly_str_6d186cc86eff9a50:
+    .asciz  "  \342\207\204 Transferred "
+.Lxly_str_a83ed8f75ab6ee09:
+    .asciz  " from "
+.Lxly_str_619d07729e78d42e:
+    .asciz  " to "
+.Lxly_str_9d57c4efeb0d1026:
+    .asciz  "  ! Cannot transfer "
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_a4e78c184e430229:
+    .asciz  ": $"
+.Lxly_str_e72728aeaf7b81ed:
+    .asciz  " transactions)"
+.Lxly_str_af63c74c8601c8dd:
+    .asciz  "\n"
+.Lxly_str_ae4f7c13b7ec18ff:
+    .asciz  "Stack"
+.Lxly_str_4dea9618e618ae3c:
+    .asciz  "size"
+.Lxly_str_f5e303190ce49c5b:
+    .asciz  "cap"
+.Lxly_str_1c23726b69043edc:
+    .asciz  "Vector2D"
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_af63f44c86021554:
+    .asciz  "y"
+.Lxly_str_d294121372903b3d:
+    .asciz  "Animal"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_24b477ada208116c:
+    .asciz  "legs"
+.Lxly_str_0bec2719aa9daf87:
+    .asciz  "Cat"
+.Lxly_str_506e8b4017fb0c4e:
+    .asciz  "purring"
+.Lxly_str_097a1da7d249fa52:
+    .asciz  "Bird"
+.Lxly_str_5dc4b5f855b1ca5f:
+    .asciz  "can_fly"
+.Lxly_str_6c8d35022983ff88:
+    .asciz  "Spider"
+.Lxly_str_640a7484e9e01021:
+    .asciz  "web_count"
+.Lxly_str_9d1c372fe94004c3:
+    .asciz  "Counter"
+.Lxly_str_7ce4fd9430e80cea:
+    .asciz  "value"
+.Lxly_str_8a8efa8aa60656d2:
+    .asciz  "BankAccount"
+.Lxly_str_a692f75ab08b8cf4:
+    .asciz  "owner"
+.Lxly_str_420234a0f998390b:
+    .asciz  "balance"
+.Lxly_str_1cfb70cd018571b0:
+    .asciz  "transactions"
+.Lxly_str_294ecc0083145dff:
+    .asciz  "StringBuilder"
+.Lxly_str_d86c0af0b398153b:
+    .asciz  "buffer"
+.Lxly_str_f5d2afc57ab57213:
+    .asciz  "init"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   13
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   104
@@ -0,0 +1,1025 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $416, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movl    $-1, -372(%rbp)
+    movl    $-1, -244(%rbp)
+    leaq    .Lxly_str_0a06edc722a32835(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d8df9efd09b44ff5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9b10ffb634130904(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k122(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_calculatePiLeibniz
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_95029c068f72dfcc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x40c3880000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k123(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_calculatePiLeibniz
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_75e4ce0a25aaada0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x40f86a0000000000, %rax
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k124(%rip), %rax
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rdi
+    call    .Lxly_fn_calculatePiLeibniz
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_d46854d0be714fbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_87e3704adbe0ee11(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_91a2bb24ccad8949(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k125(%rip), %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %rdi
+    call    .Lxly_fn_calculatePiNilakantha
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_9bb1812899acce98(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k126(%rip), %rax
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rdi
+    call    .Lxly_fn_calculatePiNilakantha
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k127(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_calculatePiNilakantha
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_02cfb85309a3e3aa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k128(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_e222c1fca06f590a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k129(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b1874ee4a069603f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    btrq    $63, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_2f3051c7d1740427(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movsd   %xmm0, -272(%rbp)
+    leaq    -280(%rbp), %rax
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_22e606a9ec72e6bd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rax
+    btrq    $63, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -400(%rbp)
+    leaq    -408(%rbp), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movq    %rbx, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b1:
+    leaq    .Lxly_str_de905389a1c490e0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8bca0c4dbae9aac7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b2
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_123206ffd77723ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b2:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e5701f91e6c0dde6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a96b4d8f4931bc07(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k134(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_calculatePiMonteCarlo
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_283236c07ed58965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k135(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_calculatePiMonteCarlo
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_81bd1a1caf969fd9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ecbb53b5f634e64a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4096c1a46a169816(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_77c56815a0eeb219(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_85b15a7a42f6c1d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fc5baab870821942(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_acc5b28a355b5aa2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_06164a2ef13a705d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5fab6bd0defb9a47(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k122:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k123:
+    .quad   0, 0x40c3880000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k124:
+    .quad   0, 0x40f86a0000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k125:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k126:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k127:
+    .quad   0, 0x40c3880000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k128:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k129:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k134:
+    .quad   0, 0x40c3880000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k135:
+    .quad   0, 0x40f86a0000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_calculatePiLeibniz:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $128, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movq    %r12, %r15
+    movq    %r12, %rbx
+.Lxly_irf0_0_b1:
+    movq    %r15, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf0_0_b3
+.Lxly_irf0_0_b2:
+    movq    %r15, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r13, %xmm0
+    movq    -64(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r12, %xmm0
+    movq    -72(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -80(%rbp)
+    cmpq    $0, -80(%rbp)
+    je      .Lxly_irf0_0_b6
+.Lxly_irf0_0_b4:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %r14
+    jmp     .Lxly_irf0_0_b5
+.Lxly_irf0_0_b6:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %r14
+.Lxly_irf0_0_b5:
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %r15
+    movq    %r14, %rbx
+    jmp     .Lxly_irf0_0_b1
+.Lxly_irf0_0_b3:
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_calculatePiNilakantha:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $144, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movq    %r13, %rbx
+    movq    %r12, %r15
+.Lxly_irf1_0_b1:
+    movq    %rbx, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf1_0_b3
+.Lxly_irf1_0_b2:
+    movq    %rbx, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    -72(%rbp), %xmm0
+    movq    -80(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -56(%rbp), %xmm0
+    movq    -88(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    %r13, %xmm0
+    movq    -96(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -104(%rbp)
+    cmpq    $0, -104(%rbp)
+    je      .Lxly_irf1_0_b6
+.Lxly_irf1_0_b4:
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %r12
+    jmp     .Lxly_irf1_0_b5
+.Lxly_irf1_0_b6:
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %r12
+.Lxly_irf1_0_b5:
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %rbx
+    movq    %r12, %r15
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b3:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_calculatePiMonteCarlo:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %r14
+    movq    %r12, %r15
+.Lxly_irf2_0_b1:
+    movq    %r14, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf2_0_b3
+.Lxly_irf2_0_b2:
+    xorq    %rdi, %rdi
+    movl    $0, %esi
+    call    xly_math_random
+    movq    %rax, %r12
+    xorq    %rdi, %rdi
+    movl    $0, %esi
+    call    xly_math_random
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -56(%rbp)
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    -56(%rbp), %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf2_0_b7
+.Lxly_irf2_0_b4:
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    jmp     .Lxly_irf2_0_b5
+.Lxly_irf2_0_b7:
+    movq    %r15, %rbx
+.Lxly_irf2_0_b5:
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r14
+    movq    %rbx, %r15
+    jmp     .Lxly_irf2_0_b1
+.Lxly_irf2_0_b3:
+    movq    %r15, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r15
+    movq    %r13, %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_0a06edc722a32835:
+    .asciz  "=== Pi Calculation ==="
+.Lxly_str_d8df9efd09b44ff5:
+    .asciz  "1. Leibniz Formula"
+.Lxly_str_9b10ffb634130904:
+    .asciz  "   Pi = 4 * (1 - 1/3 + 1/5 - 1/7 + ...)"
+.Lxly_str_95029c068f72dfcc:
+    .asciz  "   1,000 iterations:"
+.Lxly_str_75e4ce0a25aaada0:
+    .asciz  "   10,000 iterations:"
+.Lxly_str_d46854d0be714fbc:
+    .asciz  "   100,000 iterations:"
+.Lxly_str_87e3704adbe0ee11:
+    .asciz  "2. Nilakantha Series"
+.Lxly_str_91a2bb24ccad8949:
+    .asciz  "   Pi = 3 + 4/(2*3*4) - 4/(4*5*6) + ..."
+.Lxly_str_9bb1812899acce98:
+    .asciz  "   100 iterations:"
+.Lxly_str_02cfb85309a3e3aa:
+    .asciz  "3. Accuracy Comparison"
+.Lxly_str_e222c1fca06f590a:
+    .asciz  "   Actual Pi:"
+.Lxly_str_b1874ee4a069603f:
+    .asciz  "   Leibniz (100k):"
+.Lxly_str_2f3051c7d1740427:
+    .asciz  "   Error:"
+.Lxly_str_22e606a9ec72e6bd:
+    .asciz  "   Nilakantha (10k):"
+.Lxly_str_de905389a1c490e0:
+    .asciz  "   Nilakantha is more accurate!"
+.Lxly_str_8bca0c4dbae9aac7:
+    .asciz  "   Uses 10x fewer iterations"
+.Lxly_str_123206ffd77723ed:
+    .asciz  "   Leibniz is more accurate"
+.Lxly_str_e5701f91e6c0dde6:
+    .asciz  "4. Monte Carlo Method"
+.Lxly_str_a96b4d8f4931bc07:
+    .asciz  "   Random sampling approach"
+.Lxly_str_283236c07ed58965:
+    .asciz  "   10,000 samples:"
+.Lxly_str_81bd1a1caf969fd9:
+    .asciz  "   100,000 samples:"
+.Lxly_str_ecbb53b5f634e64a:
+    .asciz  "5. Summary"
+.Lxly_str_4096c1a46a169816:
+    .asciz  "   Best Algorithm: Nilakantha Series"
+.Lxly_str_77c56815a0eeb219:
+    .asciz  "   - Fastest convergence"
+.Lxly_str_85b15a7a42f6c1d6:
+    .asciz  "   - Most accurate with fewer iterations"
+.Lxly_str_fc5baab870821942:
+    .asciz  "   - Recommended for production use"
+.Lxly_str_acc5b28a355b5aa2:
+    .asciz  "   For even faster computation:"
+.Lxly_str_06164a2ef13a705d:
+    .asciz  "   ./xenlyc -O3 pi_calculation.xe -o pi"
+.Lxly_str_5fab6bd0defb9a47:
+    .asciz  "   ./pi  # 18x faster!"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   11
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   88
@@ -0,0 +1,6395 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1616, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k458(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_ir0_k459(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_ir0_k460(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_ir0_k461(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k462(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k463(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_f5d2afc57ab57213(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -64(%rbp)
+.Lxly_ir0_b2:
+    leaq    .Lxly_str_e22f84f0e00344dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -80(%rbp)
+.Lxly_ir0_b1:
+.Lxly_ir0_b4:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -88(%rbp)
+.Lxly_ir0_b3:
+.Lxly_ir0_b6:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+.Lxly_ir0_b5:
+.Lxly_ir0_b8:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+.Lxly_ir0_b7:
+    leaq    .Lxly_str_377fb58972382947(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+.Lxly_ir0_b10:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+.Lxly_ir0_b9:
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x402a000000000000, %rax
+    movq    %rax, -136(%rbp)
+    movabsq $0x4043000000000000, %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_ddb8de80fc667373(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k464(%rip), %rax
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_ir0_k465(%rip), %rax
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_ir0_k466(%rip), %rax
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_ir0_k467(%rip), %rax
+    movq    %rax, -184(%rbp)
+    movq    -160(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    movq    -176(%rbp), %rdx
+    movq    -184(%rbp), %rcx
+    movq    -152(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -192(%rbp)
+    movabsq $0x4044000000000000, %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_814adc7c15f7f863(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k468(%rip), %rax
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k469(%rip), %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_ir0_k470(%rip), %rax
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k471(%rip), %rax
+    movq    %rax, -240(%rbp)
+    movq    -216(%rbp), %rdi
+    movq    -224(%rbp), %rsi
+    movq    -232(%rbp), %rdx
+    movq    -240(%rbp), %rcx
+    movq    -208(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -248(%rbp)
+    movabsq $0x4031000000000000, %rax
+    movq    %rax, -256(%rbp)
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -264(%rbp)
+    movabsq $0x4053c00000000000, %rax
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_str_df637afd1ea88757(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    leaq    .Lxly_ir0_k472(%rip), %rax
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k473(%rip), %rax
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_ir0_k474(%rip), %rax
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k475(%rip), %rax
+    movq    %rax, -312(%rbp)
+    movq    -288(%rbp), %rdi
+    movq    -296(%rbp), %rsi
+    movq    -304(%rbp), %rdx
+    movq    -312(%rbp), %rcx
+    movq    -280(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -320(%rbp)
+    leaq    .Lxly_ir0_k476(%rip), %rax
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_ir0_k477(%rip), %rax
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_ir0_k478(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k479(%rip), %rax
+    movq    %rax, -344(%rbp)
+    movq    -328(%rbp), %rdi
+    movq    -336(%rbp), %rsi
+    movq    %rbx, %rdx
+    movq    -344(%rbp), %rcx
+    movq    -56(%rbp), %r8
+    call    .Lxly_fn_renderState
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_str_33b60b2b4b437d14(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    leaq    .Lxly_str_ee63aaad45b1b116(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b12:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    -368(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -376(%rbp)
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -392(%rbp)
+.Lxly_ir0_b11:
+    leaq    .Lxly_str_cf73e4858abe5ea5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -400(%rbp)
+.Lxly_ir0_b14:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -408(%rbp)
+    subq    $16, %rsp
+    movq    -408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -416(%rbp)
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    -424(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+.Lxly_ir0_b13:
+    leaq    .Lxly_str_42278dac0debeace(%rip), %rdi
+    call    xly_str
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_str_393ee15f7d35d08d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -448(%rbp)
+.Lxly_ir0_b16:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -456(%rbp)
+    subq    $16, %rsp
+    movq    -456(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -440(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -464(%rbp)
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -472(%rbp)
+    subq    $16, %rsp
+    movq    -472(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+.Lxly_ir0_b15:
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -488(%rbp)
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, -496(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k480(%rip), %rax
+    movq    %rax, -504(%rbp)
+    leaq    .Lxly_ir0_k481(%rip), %rax
+    movq    %rax, -512(%rbp)
+    leaq    .Lxly_ir0_k482(%rip), %rax
+    movq    %rax, -520(%rbp)
+    movq    -504(%rbp), %rdi
+    movq    -512(%rbp), %rsi
+    movq    -520(%rbp), %rdx
+    call    .Lxly_fn_renderLog
+    movq    %rax, -528(%rbp)
+.Lxly_ir0_b18:
+    leaq    .Lxly_str_82214f34c9944c0e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -536(%rbp)
+    subq    $16, %rsp
+    movq    -536(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -544(%rbp)
+.Lxly_ir0_b17:
+.Lxly_ir0_b20:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -552(%rbp)
+.Lxly_ir0_b19:
+.Lxly_ir0_b22:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -560(%rbp)
+.Lxly_ir0_b21:
+    leaq    .Lxly_str_725ffba8e809f3ec(%rip), %rdi
+    call    xly_str
+    movq    %rax, -568(%rbp)
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -576(%rbp)
+.Lxly_ir0_b24:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -584(%rbp)
+.Lxly_ir0_b23:
+.Lxly_ir0_b26:
+    leaq    .Lxly_str_afe1f53b2c756aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, -592(%rbp)
+    subq    $16, %rsp
+    movq    -592(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -600(%rbp)
+.Lxly_ir0_b25:
+.Lxly_ir0_b28:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -608(%rbp)
+.Lxly_ir0_b27:
+    leaq    .Lxly_str_60ec084fd678b6a4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -616(%rbp)
+    subq    $16, %rsp
+    movq    -616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -624(%rbp)
+.Lxly_ir0_b30:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -632(%rbp)
+.Lxly_ir0_b29:
+.Lxly_ir0_b32:
+    leaq    .Lxly_str_5df9950bc691d6df(%rip), %rdi
+    call    xly_str
+    movq    %rax, -640(%rbp)
+    subq    $16, %rsp
+    movq    -640(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -648(%rbp)
+.Lxly_ir0_b31:
+.Lxly_ir0_b34:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -656(%rbp)
+.Lxly_ir0_b33:
+    leaq    .Lxly_str_4ee01ea9604955dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -664(%rbp)
+    subq    $16, %rsp
+    movq    -664(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -672(%rbp)
+.Lxly_ir0_b36:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -680(%rbp)
+.Lxly_ir0_b35:
+.Lxly_ir0_b38:
+    leaq    .Lxly_str_dd2eef02f123d06e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -688(%rbp)
+    subq    $16, %rsp
+    movq    -688(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -696(%rbp)
+.Lxly_ir0_b37:
+.Lxly_ir0_b40:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -704(%rbp)
+.Lxly_ir0_b39:
+    leaq    .Lxly_str_870ff0a6d46fea2a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -712(%rbp)
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -720(%rbp)
+.Lxly_ir0_b42:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -728(%rbp)
+.Lxly_ir0_b41:
+.Lxly_ir0_b44:
+    leaq    .Lxly_str_60bb911d726ebcb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -736(%rbp)
+    subq    $16, %rsp
+    movq    -736(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -744(%rbp)
+.Lxly_ir0_b43:
+.Lxly_ir0_b46:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -752(%rbp)
+.Lxly_ir0_b45:
+    leaq    .Lxly_str_adb240a705880a4c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -768(%rbp)
+.Lxly_ir0_b48:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -776(%rbp)
+.Lxly_ir0_b47:
+.Lxly_ir0_b50:
+    leaq    .Lxly_str_99ca831475062880(%rip), %rdi
+    call    xly_str
+    movq    %rax, -784(%rbp)
+    subq    $16, %rsp
+    movq    -784(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -792(%rbp)
+.Lxly_ir0_b49:
+.Lxly_ir0_b52:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -800(%rbp)
+.Lxly_ir0_b51:
+    leaq    .Lxly_str_267b593860127945(%rip), %rdi
+    call    xly_str
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    -808(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -816(%rbp)
+.Lxly_ir0_b54:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -824(%rbp)
+.Lxly_ir0_b53:
+.Lxly_ir0_b56:
+    leaq    .Lxly_str_6839e4eabbde855b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -832(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -840(%rbp)
+.Lxly_ir0_b55:
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -848(%rbp)
+    leaq    .Lxly_str_c9c0a742b428e51a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -856(%rbp)
+    subq    $16, %rsp
+    movq    -856(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -864(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -872(%rbp)
+    leaq    .Lxly_str_b9e464752a8fd655(%rip), %rdi
+    call    xly_str
+    movq    %rax, -880(%rbp)
+    movq    -880(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, -888(%rbp)
+    leaq    .Lxly_ir0_k483(%rip), %rax
+    movq    %rax, -896(%rbp)
+    movq    -896(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x405e000000000000, %rax
+    movq    %rax, -904(%rbp)
+    leaq    .Lxly_ir0_k484(%rip), %rax
+    movq    %rax, -912(%rbp)
+    movq    -912(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_1a79bf1d5165d5fc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -920(%rbp)
+    leaq    .Lxly_str_112b8c0079b0649f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -928(%rbp)
+    movq    -920(%rbp), %rdi
+    movq    -928(%rbp), %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -936(%rbp)
+    leaq    .Lxly_str_2d651f1c8f490544(%rip), %rdi
+    call    xly_str
+    movq    %rax, -944(%rbp)
+    movq    -944(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -952(%rbp)
+    leaq    .Lxly_str_9aa753c7c9128c58(%rip), %rdi
+    call    xly_str
+    movq    %rax, -960(%rbp)
+    movq    -960(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -968(%rbp)
+    leaq    .Lxly_str_3e48518279ad0dea(%rip), %rdi
+    call    xly_str
+    movq    %rax, -976(%rbp)
+    movq    -976(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -984(%rbp)
+    leaq    .Lxly_ir0_k485(%rip), %rax
+    movq    %rax, -992(%rbp)
+    leaq    .Lxly_ir0_k486(%rip), %rax
+    movq    %rax, -1000(%rbp)
+    leaq    .Lxly_ir0_k487(%rip), %rax
+    movq    %rax, -1008(%rbp)
+    leaq    .Lxly_ir0_k488(%rip), %rax
+    movq    %rax, -1016(%rbp)
+    movq    -992(%rbp), %rdi
+    movq    -1000(%rbp), %rsi
+    movq    -1008(%rbp), %rdx
+    movq    -1016(%rbp), %rcx
+    movq    -880(%rbp), %r8
+    call    .Lxly_fn_renderState
+    movq    %rax, -1024(%rbp)
+    leaq    .Lxly_ir0_k489(%rip), %rax
+    movq    %rax, -1032(%rbp)
+    leaq    .Lxly_ir0_k490(%rip), %rax
+    movq    %rax, -1040(%rbp)
+    leaq    .Lxly_ir0_k491(%rip), %rax
+    movq    %rax, -1048(%rbp)
+    movq    -1032(%rbp), %rdi
+    movq    -1040(%rbp), %rsi
+    movq    -1048(%rbp), %rdx
+    call    .Lxly_fn_renderLog
+    movq    %rax, -1056(%rbp)
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, -1064(%rbp)
+    leaq    .Lxly_ir0_k492(%rip), %rax
+    movq    %rax, -1072(%rbp)
+    movq    -1072(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x409cc00000000000, %rax
+    movq    %rax, -1080(%rbp)
+    leaq    .Lxly_ir0_k493(%rip), %rax
+    movq    %rax, -1088(%rbp)
+    movq    -1088(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k494(%rip), %rax
+    movq    %rax, -1096(%rbp)
+    movq    -1096(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_c9efbc0a513dd8b3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1104(%rbp)
+    movq    -1104(%rbp), %rdi
+    movq    -928(%rbp), %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1112(%rbp)
+    leaq    .Lxly_str_50566516047d443e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1120(%rbp)
+    movq    -1120(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1128(%rbp)
+    leaq    .Lxly_str_094da9e3ccb47f75(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1136(%rbp)
+    movq    -1136(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1144(%rbp)
+    leaq    .Lxly_str_b3ea653f58d7681f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1152(%rbp)
+    movq    -1152(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1160(%rbp)
+    leaq    .Lxly_str_688b9ee8bb20f1d3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1168(%rbp)
+    leaq    .Lxly_str_046666a0e890f17a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1176(%rbp)
+    movq    -1168(%rbp), %rdi
+    movq    -1176(%rbp), %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1184(%rbp)
+    leaq    .Lxly_ir0_k495(%rip), %rax
+    movq    %rax, -1192(%rbp)
+    leaq    .Lxly_ir0_k496(%rip), %rax
+    movq    %rax, -1200(%rbp)
+    leaq    .Lxly_ir0_k497(%rip), %rax
+    movq    %rax, -1208(%rbp)
+    leaq    .Lxly_ir0_k498(%rip), %rax
+    movq    %rax, -1216(%rbp)
+    movq    -1192(%rbp), %rdi
+    movq    -1200(%rbp), %rsi
+    movq    -1208(%rbp), %rdx
+    movq    -1216(%rbp), %rcx
+    movq    -880(%rbp), %r8
+    call    .Lxly_fn_renderState
+    movq    %rax, -1224(%rbp)
+    leaq    .Lxly_ir0_k499(%rip), %rax
+    movq    %rax, -1232(%rbp)
+    leaq    .Lxly_ir0_k500(%rip), %rax
+    movq    %rax, -1240(%rbp)
+    leaq    .Lxly_ir0_k501(%rip), %rax
+    movq    %rax, -1248(%rbp)
+    movq    -1232(%rbp), %rdi
+    movq    -1240(%rbp), %rsi
+    movq    -1248(%rbp), %rdx
+    call    .Lxly_fn_renderLog
+    movq    %rax, -1256(%rbp)
+    movabsq $0x4055000000000000, %rax
+    movq    %rax, -1264(%rbp)
+    leaq    .Lxly_ir0_k502(%rip), %rax
+    movq    %rax, -1272(%rbp)
+    movq    -1272(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x40ac480000000000, %rax
+    movq    %rax, -1280(%rbp)
+    leaq    .Lxly_ir0_k503(%rip), %rax
+    movq    %rax, -1288(%rbp)
+    movq    -1288(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k504(%rip), %rax
+    movq    %rax, -1296(%rbp)
+    movq    -1296(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_63c6aba1ffbebf0e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1304(%rbp)
+    movq    -1304(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_4a25a8ef5d432b68(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1312(%rbp)
+    movq    -1312(%rbp), %rdi
+    movq    -928(%rbp), %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1320(%rbp)
+    leaq    .Lxly_str_e66bda58ecd79c1b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1328(%rbp)
+    movq    -1328(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1336(%rbp)
+    leaq    .Lxly_str_2f677154d5e199a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1344(%rbp)
+    movq    -1344(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1352(%rbp)
+    leaq    .Lxly_str_42b44b9d0ce43e0d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1360(%rbp)
+    movq    -1360(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1368(%rbp)
+    leaq    .Lxly_str_50c3901eab0e4778(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1376(%rbp)
+    movq    -1376(%rbp), %rdi
+    movq    -1176(%rbp), %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1384(%rbp)
+    leaq    .Lxly_ir0_k505(%rip), %rax
+    movq    %rax, -1392(%rbp)
+    leaq    .Lxly_ir0_k506(%rip), %rax
+    movq    %rax, -1400(%rbp)
+    leaq    .Lxly_ir0_k507(%rip), %rax
+    movq    %rax, -1408(%rbp)
+    leaq    .Lxly_ir0_k508(%rip), %rax
+    movq    %rax, -1416(%rbp)
+    movq    -1392(%rbp), %rdi
+    movq    -1400(%rbp), %rsi
+    movq    -1408(%rbp), %rdx
+    movq    -1416(%rbp), %rcx
+    movq    -1304(%rbp), %r8
+    call    .Lxly_fn_renderState
+    movq    %rax, -1424(%rbp)
+    leaq    .Lxly_ir0_k509(%rip), %rax
+    movq    %rax, -1432(%rbp)
+    leaq    .Lxly_ir0_k510(%rip), %rax
+    movq    %rax, -1440(%rbp)
+    leaq    .Lxly_ir0_k511(%rip), %rax
+    movq    %rax, -1448(%rbp)
+    movq    -1432(%rbp), %rdi
+    movq    -1440(%rbp), %rsi
+    movq    -1448(%rbp), %rdx
+    call    .Lxly_fn_renderLog
+    movq    %rax, -1456(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -1464(%rbp)
+    leaq    .Lxly_ir0_k512(%rip), %rax
+    movq    %rax, -1472(%rbp)
+    movq    -1472(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x40c3878000000000, %rax
+    movq    %rax, -1480(%rbp)
+    leaq    .Lxly_ir0_k513(%rip), %rax
+    movq    %rax, -1488(%rbp)
+    movq    -1488(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k514(%rip), %rax
+    movq    %rax, -1496(%rbp)
+    movq    -1496(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_e939079cc62192b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1504(%rbp)
+    movq    -1504(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_e6a265f67747dda2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1512(%rbp)
+    movq    -1512(%rbp), %rdi
+    movq    -928(%rbp), %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1520(%rbp)
+    leaq    .Lxly_str_50e94fe629aee420(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1528(%rbp)
+    movq    -1528(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1536(%rbp)
+    leaq    .Lxly_str_0e79057129c22d5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1544(%rbp)
+    movq    -1544(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1552(%rbp)
+    leaq    .Lxly_str_03b627a44388813f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1560(%rbp)
+    movq    -1560(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1568(%rbp)
+    leaq    .Lxly_str_4c3adb8f2eec3565(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1576(%rbp)
+    movq    -1576(%rbp), %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_logEvent
+    movq    %rax, -1584(%rbp)
+    leaq    .Lxly_ir0_k515(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k516(%rip), %rax
+    movq    %rax, -1592(%rbp)
+    leaq    .Lxly_ir0_k517(%rip), %rax
+    movq    %rax, -1600(%rbp)
+    leaq    .Lxly_ir0_k518(%rip), %rax
+    movq    %rax, -1608(%rbp)
+    movq    %rbx, %rdi
+    movq    -1592(%rbp), %rsi
+    movq    -1600(%rbp), %rdx
+    movq    -1608(%rbp), %rcx
+    movq    -1504(%rbp), %r8
+    call    .Lxly_fn_renderState
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k519(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k520(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k521(%rip), %rax
+    movq    %rax, -1616(%rbp)
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    movq    -1616(%rbp), %rdx
+    call    .Lxly_fn_renderLog
+    movq    %rax, %r13
+    movabsq $0x403b000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k522(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k523(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %rbx
+    call    .Lxly_fn_bgBrightBlue
+    movq    %rax, %r14
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r14
+    call    .Lxly_fn_bold
+    movq    %rax, %r14
+    leaq    .Lxly_str_39d37ffa23b41e38(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    .Lxly_fn_reset
+    movq    %rax, %rbx
+    movabsq $0x403d000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k524(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k525(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63c74c8601c8dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k458:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k459:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k460:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k461:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k462:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k463:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k464:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k465:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k466:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k467:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k468:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k469:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k470:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k471:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k472:
+    .quad   0, 0x4031000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k473:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k474:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k475:
+    .quad   0, 0x4053c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k476:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k477:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k478:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k479:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k480:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k481:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k482:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k483:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k484:
+    .quad   0, 0x405e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k485:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k486:
+    .quad   0, 0x405e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k487:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k488:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k489:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k490:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k491:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k492:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k493:
+    .quad   0, 0x409cc00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k494:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k495:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k496:
+    .quad   0, 0x409cc00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k497:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k498:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k499:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k500:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k501:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k502:
+    .quad   0, 0x4055000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k503:
+    .quad   0, 0x40ac480000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k504:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k505:
+    .quad   0, 0x4055000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k506:
+    .quad   0, 0x40ac480000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k507:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k508:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k509:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k510:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k511:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k512:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k513:
+    .quad   0, 0x40c3878000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k514:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k515:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k516:
+    .quad   0, 0x40c3878000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k517:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k518:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k519:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k520:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k521:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k522:
+    .quad   0, 0x403b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k523:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k524:
+    .quad   0, 0x403d000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k525:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_pos:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f0_6
+.Lxly_f0_5:
+    call    xly_add
+.Lxly_f0_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f0_8
+.Lxly_f0_7:
+    call    xly_add
+.Lxly_f0_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f0_10
+.Lxly_f0_9:
+    call    xly_add
+.Lxly_f0_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_12
+.Lxly_f0_11:
+    call    xly_add
+.Lxly_f0_12:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_seqPos:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f1_4
+.Lxly_f1_3:
+    call    xly_add
+.Lxly_f1_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f1_6
+.Lxly_f1_5:
+    call    xly_add
+.Lxly_f1_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f1_8
+.Lxly_f1_7:
+    call    xly_add
+.Lxly_f1_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f1_10
+.Lxly_f1_9:
+    call    xly_add
+.Lxly_f1_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_12
+.Lxly_f1_11:
+    call    xly_add
+.Lxly_f1_12:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_reset:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bold:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_dim:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgCyan:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgWhite:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightCyan:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightWhite:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_pad:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r13, %r12
+    movq    %rbx, %r14
+.Lxly_irf22_0_b1:
+    movq    %r12, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f22_2
+.Lxly_f22_1:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f22_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf22_0_b3
+.Lxly_irf22_0_b2:
+    movq    %r14, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_4
+.Lxly_f22_3:
+    call    xly_add
+.Lxly_f22_4:
+    movq    %rax, %r13
+    leaq    .Lxly_irf22_0_k18(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_6
+.Lxly_f22_5:
+    call    xly_add
+.Lxly_f22_6:
+    movq    %rax, %r15
+    movq    %r15, %r12
+    movq    %r13, %r14
+    jmp     .Lxly_irf22_0_b1
+.Lxly_irf22_0_b3:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf22_0_k18:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_logEvent:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_renderLog:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1104, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movl    $-1, -1068(%rbp)
+    movl    $-1, -940(%rbp)
+    movl    $-1, -812(%rbp)
+    movl    $-1, -684(%rbp)
+    movl    $-1, -556(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -72(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movq    -72(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f24_2
+.Lxly_f24_1:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f24_2:
+    movq    %rax, -80(%rbp)
+    cmpq    $0, -80(%rbp)
+    je      .Lxly_irf24_0_b35
+.Lxly_irf24_0_b1:
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %rax
+    movq    %rax, -96(%rbp)
+    jmp     .Lxly_irf24_0_b2
+.Lxly_irf24_0_b35:
+    movq    %r14, -96(%rbp)
+.Lxly_irf24_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -584(%rbp)
+    leaq    -592(%rbp), %rax
+    jmp     .Lxly_f24_4
+.Lxly_f24_3:
+    call    xly_add
+.Lxly_f24_4:
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_str_ee63aaad45b1b116(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_50bdcec8e0f723d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_112b8c0079b0649f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_str_50dc64c8e1112041(%rip), %rdi
+    call    xly_str
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_046666a0e890f17a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_str_5929ddc8e5aabcd9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_str_393ee15f7d35d08d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    movabsq $0x4042000000000000, %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -216(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -224(%rbp)
+    movq    -96(%rbp), %rax
+    movq    %rax, -232(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rax, -240(%rbp)
+.Lxly_irf24_0_b3:
+    movq    -232(%rbp), %xmm0
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -248(%rbp)
+    cmpq    $0, -248(%rbp)
+    je      .Lxly_irf24_0_b5
+.Lxly_irf24_0_b4:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -256(%rbp)
+    movq    -232(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -264(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    __xly_globals+8(%rip), %rax
+    movq    %rax, -272(%rbp)
+    movq    -232(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+.Lxly_irf24_0_b15:
+    movq    -104(%rbp), %rdi
+    movq    -240(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -712(%rbp)
+    leaq    -720(%rbp), %rax
+    jmp     .Lxly_f24_6
+.Lxly_f24_5:
+    call    xly_add
+.Lxly_f24_6:
+    movq    %rax, -296(%rbp)
+    movq    -104(%rbp), %rdi
+    movq    -296(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -840(%rbp)
+    leaq    -848(%rbp), %rax
+    jmp     .Lxly_f24_8
+.Lxly_f24_7:
+    call    xly_add
+.Lxly_f24_8:
+    movq    %rax, -304(%rbp)
+    movq    -304(%rbp), %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -968(%rbp)
+    leaq    -976(%rbp), %rax
+    jmp     .Lxly_f24_10
+.Lxly_f24_9:
+    call    xly_add
+.Lxly_f24_10:
+    movq    %rax, -312(%rbp)
+    movq    -312(%rbp), %rdi
+    movq    -112(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1096(%rbp)
+    leaq    -1104(%rbp), %rax
+    jmp     .Lxly_f24_12
+.Lxly_f24_11:
+    call    xly_add
+.Lxly_f24_12:
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f24_14
+.Lxly_f24_13:
+    call    xly_add
+.Lxly_f24_14:
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    -328(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+.Lxly_irf24_0_b14:
+    movq    -288(%rbp), %rdi
+    movq    -136(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f24_16
+.Lxly_f24_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f24_16:
+    movq    %rax, -344(%rbp)
+    cmpq    $0, -344(%rbp)
+    je      .Lxly_irf24_0_b7
+.Lxly_irf24_0_b6:
+.Lxly_irf24_0_b17:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -352(%rbp)
+.Lxly_irf24_0_b16:
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -360(%rbp)
+.Lxly_irf24_0_b7:
+    movq    -288(%rbp), %rdi
+    movq    -152(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f24_18
+.Lxly_f24_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f24_18:
+    movq    %rax, -368(%rbp)
+    cmpq    $0, -368(%rbp)
+    je      .Lxly_irf24_0_b9
+.Lxly_irf24_0_b8:
+.Lxly_irf24_0_b19:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -376(%rbp)
+.Lxly_irf24_0_b18:
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -384(%rbp)
+.Lxly_irf24_0_b9:
+    movq    -288(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f24_20
+.Lxly_f24_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f24_20:
+    movq    %rax, -392(%rbp)
+    cmpq    $0, -392(%rbp)
+    je      .Lxly_irf24_0_b11
+.Lxly_irf24_0_b10:
+.Lxly_irf24_0_b21:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -400(%rbp)
+.Lxly_irf24_0_b20:
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -408(%rbp)
+.Lxly_irf24_0_b11:
+    movq    -288(%rbp), %rdi
+    movq    -184(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_21
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f24_22
+.Lxly_f24_21:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f24_22:
+    movq    %rax, -416(%rbp)
+    cmpq    $0, -416(%rbp)
+    je      .Lxly_irf24_0_b13
+.Lxly_irf24_0_b12:
+.Lxly_irf24_0_b23:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -424(%rbp)
+.Lxly_irf24_0_b22:
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+.Lxly_irf24_0_b13:
+.Lxly_irf24_0_b25:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -440(%rbp)
+.Lxly_irf24_0_b24:
+.Lxly_irf24_0_b27:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -448(%rbp)
+.Lxly_irf24_0_b26:
+.Lxly_irf24_0_b29:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %r12
+    movq    %r15, %r13
+.Lxly_irf24_0_b30:
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    -200(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf24_0_b32
+.Lxly_irf24_0_b31:
+    movq    %r13, %rdi
+    movq    -208(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f24_24
+.Lxly_f24_23:
+    call    xly_add
+.Lxly_f24_24:
+    movq    %rax, %r15
+    leaq    .Lxly_irf24_0_k161(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f24_26
+.Lxly_f24_25:
+    call    xly_add
+.Lxly_f24_26:
+    movq    %rax, %r14
+    movq    %r14, %r12
+    movq    %r15, %r13
+    jmp     .Lxly_irf24_0_b30
+.Lxly_irf24_0_b32:
+.Lxly_irf24_0_b28:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf24_0_b34:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf24_0_b33:
+    leaq    .Lxly_irf24_0_k162(%rip), %rax
+    movq    %rax, %r12
+    movq    -240(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f24_28
+.Lxly_f24_27:
+    call    xly_add
+.Lxly_f24_28:
+    movq    %rax, %r13
+    movq    -232(%rbp), %xmm0
+    movq    -224(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, -232(%rbp)
+    movq    %r13, -240(%rbp)
+    jmp     .Lxly_irf24_0_b3
+.Lxly_irf24_0_b5:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf24_0_k161:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf24_0_k162:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_panel:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $2560, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, -72(%rbp)
+    movq    %r8, -80(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movl    $-1, -2516(%rbp)
+    movl    $-1, -2388(%rbp)
+    movl    $-1, -2260(%rbp)
+    movl    $-1, -2132(%rbp)
+    movl    $-1, -2004(%rbp)
+    movl    $-1, -1876(%rbp)
+    movl    $-1, -1748(%rbp)
+    movl    $-1, -1620(%rbp)
+    movl    $-1, -1492(%rbp)
+    movl    $-1, -1364(%rbp)
+    movl    $-1, -1236(%rbp)
+    movl    $-1, -1108(%rbp)
+    movl    $-1, -980(%rbp)
+    movl    $-1, -852(%rbp)
+    movl    $-1, -724(%rbp)
+    movl    $-1, -596(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    -96(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_irf25_0_b14:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -624(%rbp)
+    leaq    -632(%rbp), %rax
+    jmp     .Lxly_f25_2
+.Lxly_f25_1:
+    call    xly_add
+.Lxly_f25_2:
+    movq    %rax, -120(%rbp)
+    movq    %r13, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -752(%rbp)
+    leaq    -760(%rbp), %rax
+    jmp     .Lxly_f25_4
+.Lxly_f25_3:
+    call    xly_add
+.Lxly_f25_4:
+    movq    %rax, -128(%rbp)
+    movq    %r13, %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -880(%rbp)
+    leaq    -888(%rbp), %rax
+    jmp     .Lxly_f25_6
+.Lxly_f25_5:
+    call    xly_add
+.Lxly_f25_6:
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movq    -136(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1008(%rbp)
+    leaq    -1016(%rbp), %rax
+    jmp     .Lxly_f25_8
+.Lxly_f25_7:
+    call    xly_add
+.Lxly_f25_8:
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1136(%rbp)
+    leaq    -1144(%rbp), %rax
+    jmp     .Lxly_f25_10
+.Lxly_f25_9:
+    call    xly_add
+.Lxly_f25_10:
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movq    -160(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_12
+.Lxly_f25_11:
+    call    xly_add
+.Lxly_f25_12:
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -184(%rbp)
+.Lxly_irf25_0_b13:
+.Lxly_irf25_0_b16:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+.Lxly_irf25_0_b15:
+    leaq    .Lxly_str_5665be1b8870744c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -208(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -224(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf25_0_b1:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -232(%rbp)
+    cmpq    $0, -232(%rbp)
+    je      .Lxly_irf25_0_b3
+.Lxly_irf25_0_b2:
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -240(%rbp)
+    movq    %rbx, %xmm0
+    movq    -224(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %rbx
+    jmp     .Lxly_irf25_0_b1
+.Lxly_irf25_0_b3:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+.Lxly_irf25_0_b18:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+.Lxly_irf25_0_b17:
+.Lxly_irf25_0_b20:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+.Lxly_irf25_0_b19:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -280(%rbp)
+.Lxly_irf25_0_b22:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+.Lxly_irf25_0_b21:
+.Lxly_irf25_0_b24:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -296(%rbp)
+.Lxly_irf25_0_b23:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -320(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf25_0_b4:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -328(%rbp)
+    cmpq    $0, -328(%rbp)
+    je      .Lxly_irf25_0_b6
+.Lxly_irf25_0_b5:
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movq    %rbx, %xmm0
+    movq    -320(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -344(%rbp)
+    movq    -344(%rbp), %rbx
+    jmp     .Lxly_irf25_0_b4
+.Lxly_irf25_0_b6:
+    leaq    .Lxly_str_5665c11b88707965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf25_0_b26:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf25_0_b25:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_str_5665bb1b88706f33(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movq    -56(%rbp), %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1264(%rbp)
+    leaq    -1272(%rbp), %rax
+    jmp     .Lxly_f25_14
+.Lxly_f25_13:
+    call    xly_add
+.Lxly_f25_14:
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -376(%rbp)
+    movq    -376(%rbp), %xmm0
+    movsd   %xmm0, -1392(%rbp)
+    leaq    -1400(%rbp), %rax
+    movq    %rax, -384(%rbp)
+    movq    %r13, %rdi
+    movq    -384(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1520(%rbp)
+    leaq    -1528(%rbp), %rax
+    jmp     .Lxly_f25_16
+.Lxly_f25_15:
+    call    xly_add
+.Lxly_f25_16:
+    movq    %rax, -392(%rbp)
+    movq    %r14, %rbx
+.Lxly_irf25_0_b7:
+    movq    %rbx, %xmm0
+    movq    -352(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -400(%rbp)
+    cmpq    $0, -400(%rbp)
+    je      .Lxly_irf25_0_b9
+.Lxly_irf25_0_b8:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -1648(%rbp)
+    leaq    -1656(%rbp), %rax
+    movq    %rax, -408(%rbp)
+    movq    -48(%rbp), %rdi
+    movq    -408(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1776(%rbp)
+    leaq    -1784(%rbp), %rax
+    jmp     .Lxly_f25_18
+.Lxly_f25_17:
+    call    xly_add
+.Lxly_f25_18:
+    movq    %rax, -416(%rbp)
+.Lxly_irf25_0_b28:
+    movq    %r13, %rdi
+    movq    -416(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1904(%rbp)
+    leaq    -1912(%rbp), %rax
+    jmp     .Lxly_f25_20
+.Lxly_f25_19:
+    call    xly_add
+.Lxly_f25_20:
+    movq    %rax, -424(%rbp)
+    movq    %r13, %rdi
+    movq    -424(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2032(%rbp)
+    leaq    -2040(%rbp), %rax
+    jmp     .Lxly_f25_22
+.Lxly_f25_21:
+    call    xly_add
+.Lxly_f25_22:
+    movq    %rax, -432(%rbp)
+    movq    -432(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2160(%rbp)
+    leaq    -2168(%rbp), %rax
+    jmp     .Lxly_f25_24
+.Lxly_f25_23:
+    call    xly_add
+.Lxly_f25_24:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2288(%rbp)
+    leaq    -2296(%rbp), %rax
+    jmp     .Lxly_f25_26
+.Lxly_f25_25:
+    call    xly_add
+.Lxly_f25_26:
+    movq    %rax, -440(%rbp)
+    movq    -440(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_28
+.Lxly_f25_27:
+    call    xly_add
+.Lxly_f25_28:
+    movq    %rax, -448(%rbp)
+    subq    $16, %rsp
+    movq    -448(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -456(%rbp)
+.Lxly_irf25_0_b27:
+.Lxly_irf25_0_b30:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -464(%rbp)
+.Lxly_irf25_0_b29:
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -472(%rbp)
+.Lxly_irf25_0_b32:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+.Lxly_irf25_0_b31:
+.Lxly_irf25_0_b34:
+    movq    %r15, %rdi
+    movq    -392(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2416(%rbp)
+    leaq    -2424(%rbp), %rax
+    jmp     .Lxly_f25_30
+.Lxly_f25_29:
+    call    xly_add
+.Lxly_f25_30:
+    movq    %rax, -488(%rbp)
+    movq    -488(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_31
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_32
+.Lxly_f25_31:
+    call    xly_add
+.Lxly_f25_32:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -496(%rbp)
+.Lxly_irf25_0_b33:
+.Lxly_irf25_0_b36:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf25_0_b35:
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf25_0_b38:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf25_0_b37:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %rbx
+    jmp     .Lxly_irf25_0_b7
+.Lxly_irf25_0_b9:
+    movq    -48(%rbp), %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_33
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2544(%rbp)
+    leaq    -2552(%rbp), %rax
+    jmp     .Lxly_f25_34
+.Lxly_f25_33:
+    call    xly_add
+.Lxly_f25_34:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf25_0_b40:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_36
+.Lxly_f25_35:
+    call    xly_add
+.Lxly_f25_36:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_37
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_38
+.Lxly_f25_37:
+    call    xly_add
+.Lxly_f25_38:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_39
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_40
+.Lxly_f25_39:
+    call    xly_add
+.Lxly_f25_40:
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_41
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_41
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_42
+.Lxly_f25_41:
+    call    xly_add
+.Lxly_f25_42:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f25_43
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f25_43
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f25_44
+.Lxly_f25_43:
+    call    xly_add
+.Lxly_f25_44:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf25_0_b39:
+.Lxly_irf25_0_b42:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf25_0_b41:
+    leaq    .Lxly_str_5665c41b88707e7e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %r15
+.Lxly_irf25_0_b10:
+    movq    %r15, %xmm0
+    movq    -88(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf25_0_b12
+.Lxly_irf25_0_b11:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r15
+    jmp     .Lxly_irf25_0_b10
+.Lxly_irf25_0_b12:
+    leaq    .Lxly_str_5665c71b88708397(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf25_0_b44:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf25_0_b43:
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_progressBar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $464, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    xorl    %eax, %eax
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movl    $-1, -420(%rbp)
+    movl    $-1, -292(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf26_0_b24:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf26_0_b23:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, -112(%rbp)
+    movq    -96(%rbp), %xmm0
+    movq    -112(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -120(%rbp)
+    cmpq    $0, -120(%rbp)
+    je      .Lxly_irf26_0_b2
+.Lxly_irf26_0_b1:
+.Lxly_irf26_0_b26:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+.Lxly_irf26_0_b25:
+.Lxly_irf26_0_b2:
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -136(%rbp)
+    movq    -96(%rbp), %xmm0
+    movq    -136(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -144(%rbp)
+    cmpq    $0, -144(%rbp)
+    je      .Lxly_irf26_0_b4
+.Lxly_irf26_0_b3:
+    movq    -96(%rbp), %xmm0
+    movq    -112(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -152(%rbp)
+    cmpq    $0, -152(%rbp)
+    je      .Lxly_irf26_0_b6
+.Lxly_irf26_0_b5:
+.Lxly_irf26_0_b28:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+.Lxly_irf26_0_b27:
+.Lxly_irf26_0_b6:
+.Lxly_irf26_0_b4:
+    movq    -96(%rbp), %xmm0
+    movq    -136(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -168(%rbp)
+    cmpq    $0, -168(%rbp)
+    je      .Lxly_irf26_0_b8
+.Lxly_irf26_0_b7:
+.Lxly_irf26_0_b30:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+.Lxly_irf26_0_b29:
+.Lxly_irf26_0_b8:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -192(%rbp)
+    movq    %r12, %r15
+.Lxly_irf26_0_b9:
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf26_0_b11
+.Lxly_irf26_0_b10:
+    subq    $16, %rsp
+    movq    -184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    -192(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    jmp     .Lxly_irf26_0_b9
+.Lxly_irf26_0_b11:
+.Lxly_irf26_0_b32:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf26_0_b31:
+    leaq    .Lxly_str_56700b1b88794ba8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    %r12, %rbx
+.Lxly_irf26_0_b12:
+    movq    %rbx, %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf26_0_b14
+.Lxly_irf26_0_b13:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf26_0_b12
+.Lxly_irf26_0_b14:
+.Lxly_irf26_0_b34:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf26_0_b33:
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b36:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b35:
+    cmpq    $0, -120(%rbp)
+    je      .Lxly_irf26_0_b16
+.Lxly_irf26_0_b15:
+.Lxly_irf26_0_b38:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b37:
+.Lxly_irf26_0_b16:
+    cmpq    $0, -144(%rbp)
+    je      .Lxly_irf26_0_b18
+.Lxly_irf26_0_b17:
+    movq    -96(%rbp), %xmm0
+    movq    -112(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf26_0_b20
+.Lxly_irf26_0_b19:
+.Lxly_irf26_0_b40:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b39:
+.Lxly_irf26_0_b20:
+.Lxly_irf26_0_b18:
+    cmpq    $0, -168(%rbp)
+    je      .Lxly_irf26_0_b22
+.Lxly_irf26_0_b21:
+.Lxly_irf26_0_b42:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b41:
+.Lxly_irf26_0_b22:
+    movq    -96(%rbp), %xmm0
+    movsd   %xmm0, -320(%rbp)
+    leaq    -328(%rbp), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -448(%rbp)
+    leaq    -456(%rbp), %rax
+    jmp     .Lxly_f26_2
+.Lxly_f26_1:
+    call    xly_add
+.Lxly_f26_2:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f26_4
+.Lxly_f26_3:
+    call    xly_add
+.Lxly_f26_4:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b44:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf26_0_b43:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_badge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -148(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_2
+.Lxly_f27_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b2
+.Lxly_irf27_0_b1:
+.Lxly_irf27_0_b12:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b11:
+.Lxly_irf27_0_b14:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b13:
+.Lxly_irf27_0_b16:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b15:
+.Lxly_irf27_0_b2:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_4
+.Lxly_f27_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_4:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b4
+.Lxly_irf27_0_b3:
+.Lxly_irf27_0_b18:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b17:
+.Lxly_irf27_0_b20:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b19:
+.Lxly_irf27_0_b22:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b21:
+.Lxly_irf27_0_b4:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_6
+.Lxly_f27_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_6:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b6
+.Lxly_irf27_0_b5:
+.Lxly_irf27_0_b24:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b23:
+.Lxly_irf27_0_b26:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b25:
+.Lxly_irf27_0_b28:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b27:
+.Lxly_irf27_0_b6:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_8
+.Lxly_f27_7:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_8:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b8
+.Lxly_irf27_0_b7:
+.Lxly_irf27_0_b30:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b29:
+.Lxly_irf27_0_b32:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b31:
+.Lxly_irf27_0_b34:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf27_0_b33:
+.Lxly_irf27_0_b8:
+    leaq    .Lxly_str_47df71a444e20378(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_9
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_10
+.Lxly_f27_9:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_10:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf27_0_b10
+.Lxly_irf27_0_b9:
+.Lxly_irf27_0_b36:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf27_0_b35:
+.Lxly_irf27_0_b38:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf27_0_b37:
+.Lxly_irf27_0_b10:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f27_12
+.Lxly_f27_11:
+    call    xly_add
+.Lxly_f27_12:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_14
+.Lxly_f27_13:
+    call    xly_add
+.Lxly_f27_14:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf27_0_b40:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf27_0_b39:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_renderState:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $336, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, %r14
+    movq    %r8, -80(%rbp)
+.Lxly_irf28_0_b27:
+    leaq    .Lxly_str_6ef4d6d8ac36494b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+.Lxly_irf28_0_b26:
+.Lxly_irf28_0_b29:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+.Lxly_irf28_0_b28:
+.Lxly_irf28_0_b31:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+.Lxly_irf28_0_b30:
+    leaq    .Lxly_str_4729246a82e7237a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+.Lxly_irf28_0_b33:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+.Lxly_irf28_0_b32:
+.Lxly_irf28_0_b35:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -144(%rbp)
+.Lxly_irf28_0_b34:
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, %r12
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -152(%rbp)
+    cmpq    $0, -152(%rbp)
+    je      .Lxly_irf28_0_b2
+.Lxly_irf28_0_b1:
+.Lxly_irf28_0_b37:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+.Lxly_irf28_0_b36:
+.Lxly_irf28_0_b2:
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -168(%rbp)
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -168(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -176(%rbp)
+    cmpq    $0, -176(%rbp)
+    je      .Lxly_irf28_0_b4
+.Lxly_irf28_0_b3:
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -184(%rbp)
+    cmpq    $0, -184(%rbp)
+    je      .Lxly_irf28_0_b6
+.Lxly_irf28_0_b5:
+.Lxly_irf28_0_b39:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b38:
+.Lxly_irf28_0_b6:
+.Lxly_irf28_0_b4:
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -168(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b8
+.Lxly_irf28_0_b7:
+.Lxly_irf28_0_b41:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b40:
+.Lxly_irf28_0_b8:
+    movq    %r13, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_2
+.Lxly_f28_1:
+    call    xly_add
+.Lxly_f28_2:
+    movq    %rax, %r12
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -192(%rbp)
+.Lxly_irf28_0_b43:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -216(%rbp)
+    movq    -200(%rbp), %r15
+    movq    %r12, %rbx
+.Lxly_irf28_0_b44:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -192(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b46
+.Lxly_irf28_0_b45:
+    movq    %rbx, %rdi
+    movq    -208(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_4
+.Lxly_f28_3:
+    call    xly_add
+.Lxly_f28_4:
+    movq    %rax, %r12
+    leaq    .Lxly_irf28_0_k439(%rip), %rax
+    movq    %rax, -224(%rbp)
+    movq    %r15, %rdi
+    movq    -224(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_6
+.Lxly_f28_5:
+    call    xly_add
+.Lxly_f28_6:
+    movq    %rax, -232(%rbp)
+    movq    -232(%rbp), %r15
+    movq    %r12, %rbx
+    jmp     .Lxly_irf28_0_b44
+.Lxly_irf28_0_b46:
+.Lxly_irf28_0_b42:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b48:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b47:
+.Lxly_irf28_0_b50:
+    leaq    .Lxly_str_ec76a0cfd555b9aa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b49:
+.Lxly_irf28_0_b52:
+.Lxly_irf28_0_b51:
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x403c000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf28_0_k440(%rip), %rax
+    movq    %rax, -240(%rbp)
+    leaq    .Lxly_irf28_0_k441(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    -48(%rbp), %rsi
+    movq    -240(%rbp), %rdx
+    movq    %rbx, %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, %r15
+.Lxly_irf28_0_b54:
+    leaq    .Lxly_str_3417a4e1a816148c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b53:
+.Lxly_irf28_0_b56:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b55:
+.Lxly_irf28_0_b58:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b57:
+    leaq    .Lxly_str_6bf228c2b843b4e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b60:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b59:
+.Lxly_irf28_0_b62:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b61:
+.Lxly_irf28_0_b64:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b63:
+    movq    %r13, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_8
+.Lxly_f28_7:
+    call    xly_add
+.Lxly_f28_8:
+    movq    %rax, %rbx
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -248(%rbp)
+.Lxly_irf28_0_b66:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -272(%rbp)
+    movq    -256(%rbp), %r15
+    movq    %rbx, %r12
+.Lxly_irf28_0_b67:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -248(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf28_0_b69
+.Lxly_irf28_0_b68:
+    movq    %r12, %rdi
+    movq    -264(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_10
+.Lxly_f28_9:
+    call    xly_add
+.Lxly_f28_10:
+    movq    %rax, %rbx
+    leaq    .Lxly_irf28_0_k442(%rip), %rax
+    movq    %rax, -280(%rbp)
+    movq    %r15, %rdi
+    movq    -280(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_12
+.Lxly_f28_11:
+    call    xly_add
+.Lxly_f28_12:
+    movq    %rax, -288(%rbp)
+    movq    -288(%rbp), %r15
+    movq    %rbx, %r12
+    jmp     .Lxly_irf28_0_b67
+.Lxly_irf28_0_b69:
+.Lxly_irf28_0_b65:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b71:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b70:
+.Lxly_irf28_0_b73:
+    leaq    .Lxly_str_17cd673defa59b77(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b72:
+.Lxly_irf28_0_b75:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b74:
+.Lxly_irf28_0_b77:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b76:
+    leaq    .Lxly_str_ea255c6489d9226d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b79:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b78:
+.Lxly_irf28_0_b81:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b80:
+.Lxly_irf28_0_b83:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b82:
+    movq    %r13, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_14
+.Lxly_f28_13:
+    call    xly_add
+.Lxly_f28_14:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b85:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b84:
+.Lxly_irf28_0_b87:
+    leaq    .Lxly_str_976ee1351a92ea46(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b86:
+.Lxly_irf28_0_b89:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b88:
+.Lxly_irf28_0_b91:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b90:
+    leaq    .Lxly_str_b1d52e3238d156ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b93:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b92:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_str_a6f9cec911b2ee19(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_a70766c911be7abd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -312(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf28_0_b9:
+    movq    %rbx, %xmm0
+    movq    -296(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b11
+.Lxly_irf28_0_b10:
+    movq    %rbx, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b13
+.Lxly_irf28_0_b12:
+    call    .Lxly_fn_fgBrightRed
+    movq    %rax, %r12
+    call    .Lxly_fn_bold
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b13:
+    movq    %rbx, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm1, %xmm0
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b15
+.Lxly_irf28_0_b14:
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf28_0_b15:
+    movq    %rbx, %xmm0
+    movq    -312(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf28_0_b9
+.Lxly_irf28_0_b11:
+.Lxly_irf28_0_b95:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b94:
+    movabsq $0x4026000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf28_0_k443(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf28_0_k444(%rip), %rax
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %r13
+    call    .Lxly_fn_bold
+    movq    %rax, %rbx
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %rbx
+    leaq    .Lxly_str_d2dd030542a93f36(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    call    .Lxly_fn_reset
+    movq    %rax, %r13
+    leaq    .Lxly_irf28_0_k445(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf28_0_k446(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    call    .Lxly_fn_seqPos
+    movq    %rax, %r15
+    leaq    .Lxly_str_f5d2afc57ab57213(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_15
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f28_16
+.Lxly_f28_15:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f28_16:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf28_0_b17
+.Lxly_irf28_0_b16:
+    leaq    .Lxly_str_00505098915b7423(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_47df71a444e20378(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    movq    %r13, %rdx
+    call    .Lxly_fn_badge
+    movq    %rax, %r12
+.Lxly_irf28_0_b17:
+    leaq    .Lxly_str_b9e464752a8fd655(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_17
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f28_18
+.Lxly_f28_17:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f28_18:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b19
+.Lxly_irf28_0_b18:
+    leaq    .Lxly_str_83ba91043d0d7ff3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    movq    %r13, %rdx
+    call    .Lxly_fn_badge
+    movq    %rax, %rbx
+.Lxly_irf28_0_b19:
+    leaq    .Lxly_str_129fac0ae1df7c8f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f28_20
+.Lxly_f28_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f28_20:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf28_0_b21
+.Lxly_irf28_0_b20:
+    leaq    .Lxly_str_29c8cca14fcee9f9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    movq    %r13, %rdx
+    call    .Lxly_fn_badge
+    movq    %rax, %r12
+.Lxly_irf28_0_b21:
+    leaq    .Lxly_str_63c6aba1ffbebf0e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_21
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f28_22
+.Lxly_f28_21:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f28_22:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b23
+.Lxly_irf28_0_b22:
+    leaq    .Lxly_str_c42960840fc9c877(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    movq    %r13, %rdx
+    call    .Lxly_fn_badge
+    movq    %rax, %rbx
+.Lxly_irf28_0_b23:
+    leaq    .Lxly_str_e939079cc62192b5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -80(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_23
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f28_24
+.Lxly_f28_23:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f28_24:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf28_0_b25
+.Lxly_irf28_0_b24:
+    leaq    .Lxly_str_c74e126d189c3a93(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    movq    %r13, %rdx
+    call    .Lxly_fn_badge
+    movq    %rax, %r12
+.Lxly_irf28_0_b25:
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf28_0_k439:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k440:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k441:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k442:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k443:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k444:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k445:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf28_0_k446:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_f74e5feadea773fd:
+    .asciz  "create"
+.Lxly_str_f5d2afc57ab57213:
+    .asciz  "init"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_08b73907b55c4d71:
+    .asciz  "io"
+.Lxly_str_b93a12b0d06caefc:
+    .asciz  "write"
+.Lxly_str_e22f84f0e00344dc:
+    .asciz  "1;1H"
+.Lxly_str_377fb58972382947:
+    .asciz  "  \342\254\241 Xenly Reactive State Demo  \342\200\224  Declarative UI Cycle                          "
+.Lxly_str_ddb8de80fc667373:
+    .asciz  "Current State"
+.Lxly_str_814adc7c15f7f863:
+    .asciz  "State Transition Log"
+.Lxly_str_df637afd1ea88757:
+    .asciz  "Declarative Reactive Model"
+.Lxly_str_33b60b2b4b437d14:
+    .asciz  "Initial state declared"
+.Lxly_str_ee63aaad45b1b116:
+    .asciz  "state"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_cf73e4858abe5ea5:
+    .asciz  "counter=0 score=0 level=1"
+.Lxly_str_42278dac0debeace:
+    .asciz  "Rendering initial view..."
+.Lxly_str_393ee15f7d35d08d:
+    .asciz  "render"
+.Lxly_str_82214f34c9944c0e:
+    .asciz  "18;3H"
+.Lxly_str_725ffba8e809f3ec:
+    .asciz  "Declarative model: describe WHAT, not HOW"
+.Lxly_str_afe1f53b2c756aff:
+    .asciz  "19;3H"
+.Lxly_str_60ec084fd678b6a4:
+    .asciz  "1. Declare state variables"
+.Lxly_str_5df9950bc691d6df:
+    .asciz  "20;3H"
+.Lxly_str_4ee01ea9604955dc:
+    .asciz  "2. Components are pure functions of state"
+.Lxly_str_dd2eef02f123d06e:
+    .asciz  "21;3H"
+.Lxly_str_870ff0a6d46fea2a:
+    .asciz  "3. Change state \342\206\222 call component again"
+.Lxly_str_60bb911d726ebcb9:
+    .asciz  "22;3H"
+.Lxly_str_adb240a705880a4c:
+    .asciz  "4. Only changed parts repaint (efficient)"
+.Lxly_str_99ca831475062880:
+    .asciz  "23;3H"
+.Lxly_str_267b593860127945:
+    .asciz  "Like: SwiftUI @State, React useState,"
+.Lxly_str_6839e4eabbde855b:
+    .asciz  "24;3H"
+.Lxly_str_c9c0a742b428e51a:
+    .asciz  "      Android LiveData, Vue reactive()"
+.Lxly_str_b9e464752a8fd655:
+    .asciz  "playing"
+.Lxly_str_1a79bf1d5165d5fc:
+    .asciz  "EVENT: game_start"
+.Lxly_str_112b8c0079b0649f:
+    .asciz  "event"
+.Lxly_str_2d651f1c8f490544:
+    .asciz  "phase: init \342\206\222 playing"
+.Lxly_str_9aa753c7c9128c58:
+    .asciz  "counter: 0 \342\206\222 12"
+.Lxly_str_3e48518279ad0dea:
+    .asciz  "score: 0 \342\206\222 120"
+.Lxly_str_c9efbc0a513dd8b3:
+    .asciz  "EVENT: level_up"
+.Lxly_str_50566516047d443e:
+    .asciz  "counter: 12 \342\206\222 55"
+.Lxly_str_094da9e3ccb47f75:
+    .asciz  "level: 1 \342\206\222 3"
+.Lxly_str_b3ea653f58d7681f:
+    .asciz  "score: 120 \342\206\222 1840"
+.Lxly_str_688b9ee8bb20f1d3:
+    .asciz  "COMPUTE: pct=55% \342\206\222 yellow"
+.Lxly_str_046666a0e890f17a:
+    .asciz  "compute"
+.Lxly_str_63c6aba1ffbebf0e:
+    .asciz  "danger"
+.Lxly_str_4a25a8ef5d432b68:
+    .asciz  "EVENT: damage_taken"
+.Lxly_str_e66bda58ecd79c1b:
+    .asciz  "counter: 55 \342\206\222 84"
+.Lxly_str_2f677154d5e199a2:
+    .asciz  "lives: 5 \342\206\222 3"
+.Lxly_str_42b44b9d0ce43e0d:
+    .asciz  "phase: playing \342\206\222 danger"
+.Lxly_str_50c3901eab0e4778:
+    .asciz  "COMPUTE: pct=84% \342\206\222 RED"
+.Lxly_str_e939079cc62192b5:
+    .asciz  "victory"
+.Lxly_str_e6a265f67747dda2:
+    .asciz  "EVENT: game_complete!"
+.Lxly_str_50e94fe629aee420:
+    .asciz  "counter: 84 \342\206\222 100"
+.Lxly_str_0e79057129c22d5a:
+    .asciz  "score: 3620 \342\206\222 9999"
+.Lxly_str_03b627a44388813f:
+    .asciz  "level: 3 \342\206\222 10"
+.Lxly_str_4c3adb8f2eec3565:
+    .asciz  "phase: danger \342\206\222 victory"
+.Lxly_str_39d37ffa23b41e38:
+    .asciz  "  4 state transitions simulated  \342\224\202  Each change triggers targeted component repaint  "
+.Lxly_str_af63c74c8601c8dd:
+    .asciz  "\n"
+.Lxly_str_af63b64c8601abfa:
+    .asciz  ";"
+.Lxly_str_af64054c86023237:
+    .asciz  "H"
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_50bdcec8e0f723d0:
+    .asciz  "\342\227\206 "
+.Lxly_str_50dc64c8e1112041:
+    .asciz  "\342\227\217 "
+.Lxly_str_5929ddc8e5aabcd9:
+    .asciz  "\342\226\270 "
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_5665be1b8870744c:
+    .asciz  "\342\225\224"
+.Lxly_str_5665ba1b88706d80:
+    .asciz  "\342\225\220"
+.Lxly_str_5665c11b88707965:
+    .asciz  "\342\225\227"
+.Lxly_str_5665bb1b88706f33:
+    .asciz  "\342\225\221"
+.Lxly_str_5665c41b88707e7e:
+    .asciz  "\342\225\232"
+.Lxly_str_5665c71b88708397:
+    .asciz  "\342\225\235"
+.Lxly_str_af64164c86024f1a:
+    .asciz  "["
+.Lxly_str_566ff41b88792493:
+    .asciz  "\342\226\210"
+.Lxly_str_56700b1b88794ba8:
+    .asciz  "\342\226\221"
+.Lxly_str_094c7a07b5dadfd8:
+    .asciz  "] "
+.Lxly_str_af63984c86017900:
+    .asciz  "%"
+.Lxly_str_19fe06e3408e53d0:
+    .asciz  "success"
+.Lxly_str_5e39a0f62bea2e31:
+    .asciz  "warn"
+.Lxly_str_9f7452dd75d54d31:
+    .asciz  "error"
+.Lxly_str_f5d6a8c57ab94f05:
+    .asciz  "info"
+.Lxly_str_47df71a444e20378:
+    .asciz  "neutral"
+.Lxly_str_6ef4d6d8ac36494b:
+    .asciz  "4;3H"
+.Lxly_str_4729246a82e7237a:
+    .asciz  "Count:  "
+.Lxly_str_ec76a0cfd555b9aa:
+    .asciz  "5;3H"
+.Lxly_str_3417a4e1a816148c:
+    .asciz  "7;3H"
+.Lxly_str_6bf228c2b843b4e5:
+    .asciz  "Score:  "
+.Lxly_str_17cd673defa59b77:
+    .asciz  "8;3H"
+.Lxly_str_ea255c6489d9226d:
+    .asciz  "Level:  "
+.Lxly_str_976ee1351a92ea46:
+    .asciz  "9;3H"
+.Lxly_str_b1d52e3238d156ba:
+    .asciz  "Lives:  "
+.Lxly_str_a6f9cec911b2ee19:
+    .asciz  "\342\231\245 "
+.Lxly_str_a70766c911be7abd:
+    .asciz  "\342\231\241 "
+.Lxly_str_d2dd030542a93f36:
+    .asciz  "Phase:  "
+.Lxly_str_00505098915b7423:
+    .asciz  "  INIT  "
+.Lxly_str_83ba91043d0d7ff3:
+    .asciz  " ACTIVE "
+.Lxly_str_129fac0ae1df7c8f:
+    .asciz  "warning"
+.Lxly_str_29c8cca14fcee9f9:
+    .asciz  " WARNING"
+.Lxly_str_c42960840fc9c877:
+    .asciz  " DANGER!"
+.Lxly_str_c74e126d189c3a93:
+    .asciz  " VICTORY"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   7
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   56
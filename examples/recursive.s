@@ -0,0 +1,2071 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $816, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movl    $-1, -772(%rbp)
+    movl    $-1, -644(%rbp)
+    movl    $-1, -516(%rbp)
+    leaq    .Lxly_str_22cd3851166216de(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8bd308441f48c968(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_fce51528ddbf91f8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k216(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d0a15f4feda0704e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k217(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7d6af5967dcff19c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k218(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_fibonacci
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_73eec6967834ef03(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k219(%rip), %rax
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rdi
+    call    .Lxly_fn_fibonacci
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6f7d49ae63999573(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k220(%rip), %rax
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %rdi
+    call    .Lxly_fn_fibonacci
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0f004ebda52f1829(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a13f81e64b431a3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+.Lxly_ir0_b2:
+    leaq    .Lxly_ir0_k221(%rip), %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k222(%rip), %rax
+    movq    %rax, -96(%rbp)
+    movq    -88(%rbp), %rdi
+    movq    -96(%rbp), %rsi
+    call    .Lxly_fn_factorialHelper
+    movq    %rax, -104(%rbp)
+.Lxly_ir0_b1:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bb98175ab4c73b47(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k223(%rip), %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k224(%rip), %rax
+    movq    %rax, -128(%rbp)
+    movq    -120(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    call    .Lxly_fn_factorialHelper
+    movq    %rax, -136(%rbp)
+.Lxly_ir0_b3:
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -144(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -152(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_ir0_k225(%rip), %rax
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_ir0_k226(%rip), %rax
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_ir0_k227(%rip), %rax
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_ir0_k228(%rip), %rax
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_ir0_k229(%rip), %rax
+    movq    %rax, -200(%rbp)
+    subq    $48, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_f256f7e9a68cca30(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k230(%rip), %rax
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k231(%rip), %rax
+    movq    %rax, -224(%rbp)
+    movq    %rbx, %rdi
+    movq    -216(%rbp), %rsi
+    movq    -224(%rbp), %rdx
+    call    .Lxly_fn_sumHelper
+    movq    %rax, -232(%rbp)
+.Lxly_ir0_b5:
+    subq    $16, %rsp
+    movq    -208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -232(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_5e58475e52815800(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9bb96a1f60bbdea9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -240(%rbp)
+.Lxly_ir0_b8:
+.Lxly_ir0_b10:
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k232(%rip), %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %rdi
+    call    .Lxly_fn_isOdd
+    movq    %rax, -256(%rbp)
+.Lxly_ir0_b7:
+    subq    $16, %rsp
+    movq    -240(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4a89e66c17451114(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+.Lxly_ir0_b12:
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k233(%rip), %rax
+    movq    %rax, -272(%rbp)
+    movq    -272(%rbp), %rdi
+    call    .Lxly_fn_isEven
+    movq    %rax, %rbx
+.Lxly_ir0_b11:
+    subq    $16, %rsp
+    movq    -264(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_46a9e68d5ab71ac7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+.Lxly_ir0_b16:
+.Lxly_ir0_b18:
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k234(%rip), %rax
+    movq    %rax, -288(%rbp)
+    movq    -288(%rbp), %rdi
+    call    .Lxly_fn_isOdd
+    movq    %rax, -296(%rbp)
+.Lxly_ir0_b15:
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0b3d9f517f837688(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+.Lxly_ir0_b20:
+.Lxly_ir0_b22:
+    leaq    .Lxly_ir0_k235(%rip), %rax
+    movq    %rax, -312(%rbp)
+    movq    -312(%rbp), %rdi
+    call    .Lxly_fn_isEven
+    movq    %rax, %rbx
+.Lxly_ir0_b19:
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2dae1231731f5109(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d939e688c3d61447(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k236(%rip), %rax
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %rdi
+    call    .Lxly_fn_fibSlow
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e34b9ea300433238(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k237(%rip), %rax
+    movq    %rax, -336(%rbp)
+    movq    -336(%rbp), %rdi
+    call    .Lxly_fn_fibSlow
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9978d4ff92933f0a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_ir0_k238(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_countdown
+    movq    %rax, %rbx
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_66d5d527d6045e1c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4a3edc478a4ce39e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k239(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k240(%rip), %rax
+    movq    %rax, -344(%rbp)
+    movq    %r13, %rdi
+    movq    -344(%rbp), %rsi
+    call    .Lxly_fn_power
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a39fa401d5a4b18b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k241(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k242(%rip), %rax
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_power
+    movq    %rax, -352(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_467821d1bb724100(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k243(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k244(%rip), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    call    .Lxly_fn_power
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3916bf113e33a882(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_24f3373134266f21(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b24:
+    movq    %rbx, -368(%rbp)
+    movq    %r12, -376(%rbp)
+.Lxly_ir0_b25:
+    movq    %r15, %xmm0
+    movq    -368(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b27
+.Lxly_ir0_b26:
+.Lxly_ir0_b23:
+    movq    -376(%rbp), %xmm0
+    movsd   %xmm0, -544(%rbp)
+    leaq    -552(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4ced1056c0e3b6f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -384(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4041800000000000, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b29:
+    movq    %r14, -392(%rbp)
+    movq    %r12, -400(%rbp)
+.Lxly_ir0_b30:
+    movq    %r15, %xmm0
+    movq    -392(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_ir0_b32
+.Lxly_ir0_b31:
+.Lxly_ir0_b28:
+    movq    -400(%rbp), %xmm0
+    movsd   %xmm0, -672(%rbp)
+    leaq    -680(%rbp), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c75358452ea83f5e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -408(%rbp)
+    movabsq $0x4031000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4033000000000000, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b34:
+    movq    %rbx, %r13
+    movq    %r14, %r12
+.Lxly_ir0_b35:
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b37
+.Lxly_ir0_b36:
+.Lxly_ir0_b33:
+    movq    %r12, %xmm0
+    movsd   %xmm0, -800(%rbp)
+    leaq    -808(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_22bd74988c8a50a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_ir0_b37:
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, -416(%rbp)
+    movq    %r13, %rax
+    movq    %rax, -424(%rbp)
+    movq    -416(%rbp), %r13
+    movq    -424(%rbp), %r12
+    jmp     .Lxly_ir0_b35
+.Lxly_ir0_b32:
+    movq    -400(%rbp), %xmm0
+    movq    -392(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, -416(%rbp)
+    movq    -392(%rbp), %rax
+    movq    %rax, -424(%rbp)
+    movq    -416(%rbp), %rax
+    movq    %rax, -392(%rbp)
+    movq    -424(%rbp), %rax
+    movq    %rax, -400(%rbp)
+    jmp     .Lxly_ir0_b30
+.Lxly_ir0_b27:
+    movq    -376(%rbp), %xmm0
+    movq    -368(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, -416(%rbp)
+    movq    -368(%rbp), %rax
+    movq    %rax, -424(%rbp)
+    movq    -416(%rbp), %rax
+    movq    %rax, -368(%rbp)
+    movq    -424(%rbp), %rax
+    movq    %rax, -376(%rbp)
+    jmp     .Lxly_ir0_b25
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k216:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k217:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k218:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k219:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k220:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k221:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k222:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k223:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k224:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k225:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k226:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k227:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k228:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k229:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k230:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k231:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k232:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k233:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k234:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k235:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k236:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k237:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k238:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k239:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k240:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k241:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k242:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k243:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k244:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_factorial:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    leaq    .Lxly_irf0_0_k17(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_factorial
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf0_0_k17:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_fibonacci:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf1_0_b2
+.Lxly_irf1_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf1_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fibonacci
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fibonacci
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_factorialHelper:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %r14
+    movq    %r12, %r15
+.Lxly_irf2_0_b1:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf2_0_b3
+.Lxly_irf2_0_b2:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf2_0_b3:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %r15
+    jmp     .Lxly_irf2_0_b1
+
+.Lxly_fn_factorialTail:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+.Lxly_irf3_0_b3:
+    movq    %rbx, %r13
+    movq    %r12, %r14
+.Lxly_irf3_0_b4:
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf3_0_b6
+.Lxly_irf3_0_b5:
+.Lxly_irf3_0_b2:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b6:
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r15, %r14
+    jmp     .Lxly_irf3_0_b4
+
+.Lxly_fn_sumHelper:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r12, %r15
+    movq    %r13, %r14
+.Lxly_irf4_0_b1:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setae   %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_gte
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_2:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf4_0_b3
+.Lxly_irf4_0_b2:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf4_0_b3:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_4
+.Lxly_f4_3:
+    call    xly_add
+.Lxly_f4_4:
+    movq    %rax, %r13
+    leaq    .Lxly_irf4_0_k26(%rip), %rax
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f4_6
+.Lxly_f4_5:
+    call    xly_add
+.Lxly_f4_6:
+    movq    %rax, %r14
+    movq    %r14, %r15
+    movq    %r13, %r14
+    jmp     .Lxly_irf4_0_b1
+
+.section .rodata
+.balign 16
+.Lxly_irf4_0_k26:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sumArray:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+.Lxly_irf5_0_b3:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_irf5_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %r15
+    movq    %r14, %r13
+.Lxly_irf5_0_b4:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm1, %xmm0
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf5_0_b6
+.Lxly_irf5_0_b5:
+.Lxly_irf5_0_b2:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b6:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_add
+.Lxly_f5_2:
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    movq    %r12, %r13
+    jmp     .Lxly_irf5_0_b4
+
+.section .rodata
+.balign 16
+.Lxly_irf5_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_isEven:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf6_0_k16(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f6_2
+.Lxly_f6_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f6_2:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf6_0_b2
+.Lxly_irf6_0_b1:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf6_0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_isOdd
+
+.section .rodata
+.balign 16
+.Lxly_irf6_0_k16:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_isOdd:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf7_0_k16(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f7_2
+.Lxly_f7_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f7_2:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf7_0_b2
+.Lxly_irf7_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf7_0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    jmp     .Lxly_fn_isEven
+
+.section .rodata
+.balign 16
+.Lxly_irf7_0_k16:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_makeMemoized:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    call    xly_obj_new
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    leaq    .Lxly_fn___anon_f8_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $2, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fibSlow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf9_0_b2
+.Lxly_irf9_0_b1:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf9_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fibSlow
+    movq    %rax, %r13
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_fibSlow
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f9_2
+.Lxly_f9_1:
+    call    xly_add
+.Lxly_f9_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_countdown:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf10_0_b2
+.Lxly_irf10_0_b1:
+    leaq    .Lxly_str_bbe67a392eb3379b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b2:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_countdown
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_power:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf11_0_k40(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f11_2
+.Lxly_f11_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f11_2:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf11_0_b2
+.Lxly_irf11_0_b1:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf11_0_k41(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf11_0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf11_0_k42(%rip), %rax
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f11_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f11_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f11_4
+.Lxly_f11_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f11_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf11_0_b5
+.Lxly_irf11_0_b4:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf11_0_b5:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -64(%rbp)
+    movq    %rbx, %rdi
+    movq    -64(%rbp), %rsi
+    call    .Lxly_fn_power
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r13, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf11_0_b9
+.Lxly_irf11_0_b7:
+    movq    -72(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf11_0_b9:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    -72(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf11_0_k40:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf11_0_k41:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf11_0_k42:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_gcd:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r12, %r14
+    movq    %rbx, %r15
+.Lxly_irf12_0_b1:
+    leaq    .Lxly_irf12_0_k20(%rip), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f12_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f12_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f12_2
+.Lxly_f12_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f12_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf12_0_b3
+.Lxly_irf12_0_b2:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf12_0_b3:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r14, %rax
+    movq    %rax, -72(%rbp)
+    movq    -64(%rbp), %r14
+    movq    -72(%rbp), %r15
+    jmp     .Lxly_irf12_0_b1
+
+.section .rodata
+.balign 16
+.Lxly_irf12_0_k20:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_f8_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %rbx
+    movq    -48(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %r12
+    movq    -48(%rbp), %rax
+    movq    8(%rax), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    call    xly_index
+    movq    %rax, %r14
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f13_2
+.Lxly_f13_1:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f13_2:
+    movq    %rax, -64(%rbp)
+    cmpq    $0, -64(%rbp)
+    je      .Lxly_irf13_0_b2
+.Lxly_irf13_0_b1:
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    call    xly_index
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf13_0_b2:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    movq    %r15, %rdx
+    call    xly_index_set
+    movq    %rax, %r13
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_22cd3851166216de:
+    .asciz  "=== Recursive Functions ==="
+.Lxly_str_8bd308441f48c968:
+    .asciz  "1. Basic Recursion"
+.Lxly_str_fce51528ddbf91f8:
+    .asciz  "factorial(5):"
+.Lxly_str_d0a15f4feda0704e:
+    .asciz  "factorial(10):"
+.Lxly_str_7d6af5967dcff19c:
+    .asciz  "fibonacci(0):"
+.Lxly_str_73eec6967834ef03:
+    .asciz  "fibonacci(1):"
+.Lxly_str_6f7d49ae63999573:
+    .asciz  "fibonacci(10):"
+.Lxly_str_0f004ebda52f1829:
+    .asciz  "2. Tail Recursion (Optimized)"
+.Lxly_str_a13f81e64b431a3e:
+    .asciz  "factorialTail(5):"
+.Lxly_str_bb98175ab4c73b47:
+    .asciz  "factorialTail(20):"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_f256f7e9a68cca30:
+    .asciz  "Sum of [1,2,3,4,5]:"
+.Lxly_str_5e58475e52815800:
+    .asciz  "3. Mutual Recursion"
+.Lxly_str_9bb96a1f60bbdea9:
+    .asciz  "isEven(10):"
+.Lxly_str_4a89e66c17451114:
+    .asciz  "isOdd(10):"
+.Lxly_str_46a9e68d5ab71ac7:
+    .asciz  "isEven(7):"
+.Lxly_str_0b3d9f517f837688:
+    .asciz  "isOdd(7):"
+.Lxly_str_2dae1231731f5109:
+    .asciz  "4. Memoization"
+.Lxly_str_d939e688c3d61447:
+    .asciz  "fibSlow(10):"
+.Lxly_str_e34b9ea300433238:
+    .asciz  "fibSlow(20):"
+.Lxly_str_9978d4ff92933f0a:
+    .asciz  "5. Countdown (Simple Recursion)"
+.Lxly_str_66d5d527d6045e1c:
+    .asciz  "6. Power (Divide and Conquer)"
+.Lxly_str_4a3edc478a4ce39e:
+    .asciz  "2^10:"
+.Lxly_str_a39fa401d5a4b18b:
+    .asciz  "3^5:"
+.Lxly_str_467821d1bb724100:
+    .asciz  "5^4:"
+.Lxly_str_3916bf113e33a882:
+    .asciz  "7. GCD (Euclidean Algorithm)"
+.Lxly_str_24f3373134266f21:
+    .asciz  "gcd(48, 18):"
+.Lxly_str_4ced1056c0e3b6f1:
+    .asciz  "gcd(100, 35):"
+.Lxly_str_c75358452ea83f5e:
+    .asciz  "gcd(17, 19):"
+.Lxly_str_22bd74988c8a50a8:
+    .asciz  "=== Recursive Functions Demo Complete ==="
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_bbe67a392eb3379b:
+    .asciz  "Blast off!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   1
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   8
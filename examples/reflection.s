@@ -0,0 +1,1863 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $400, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_0f4cd52fa4574db3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1bdebb75f34ab6d5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    call    xly_obj_new
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_4caa2b3cc1c60fce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a66fbd6dcbf78966(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_ea3387071a6bf4c8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0439bc7e17d6851f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_c5c964eca608a02f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_cd1aee2a38809f0a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r15
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_c4bcadba8e631b86(%rip), %rsi
+    call    xly_obj_set_atom
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rdx
+    movq    .Lxly_atom_e715b4190539215c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_36ace119c2ac7da1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    movq    %r15, %rdi
+    movq    -72(%rbp), %rdx
+    movq    .Lxly_atom_f9dab5910f08a8a2(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_23e95751efb16c2b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_da6638bfed434f99(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a517b4f3c8ff2093(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d73af1b7a187a300(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_34012156cd24ab08(%rip), %rdi
+    call    xly_str
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_54235c8f756fa7e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_obj_new
+    movq    %rax, %r14
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, -136(%rbp)
+    movq    %r14, %rdi
+    movq    -136(%rbp), %rdx
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_set_atom
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_ir0_k193(%rip), %rax
+    movq    %rax, -152(%rbp)
+    movq    %r14, %rdi
+    movq    -152(%rbp), %rdx
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, -160(%rbp)
+    movq    %r14, %rdi
+    movq    -160(%rbp), %rdx
+    movq    .Lxly_atom_af63f74c86021a6d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_af63f54c86021707(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movq    %r14, %rdi
+    movq    -168(%rbp), %rsi
+    call    .Lxly_fn_getProperty
+    movq    %rax, -176(%rbp)
+    movq    -176(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_af63f44c86021554(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    movq    %r14, %rdi
+    movq    -184(%rbp), %rsi
+    call    .Lxly_fn_getProperty
+    movq    %rax, -192(%rbp)
+    movq    -192(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_08f10e07b58d7ca7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_08ed8c07b58a69ea(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_3b8675ee184873b7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b2:
+    leaq    .Lxly_str_88ecffbb7f973682(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7e8af1a1b9ebb614(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c9acaf2c8c29f11e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b1:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a76edebf4bc012f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a585f6f24614debf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k196(%rip), %rax
+    movq    %rax, -216(%rbp)
+    movq    -208(%rbp), %rdi
+    movq    -216(%rbp), %rsi
+    call    .Lxly_fn_safeDivide
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b7e940f250cc9e01(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, -240(%rbp)
+    leaq    .Lxly_ir0_k198(%rip), %rax
+    movq    %rax, -248(%rbp)
+    movq    -240(%rbp), %rdi
+    movq    -248(%rbp), %rsi
+    call    .Lxly_fn_safeDivide
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1cda3b2a3a520e4d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5edfa02468e320cf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_str_7ce4fd9430e80cea(%rip), %rdi
+    call    xly_str
+    movq    %rax, -272(%rbp)
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    -288(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_2:
+    movq    %rax, -296(%rbp)
+    cmpq    $0, -296(%rbp)
+    je      .Lxly_ir0_b6
+.Lxly_ir0_b5:
+    leaq    .Lxly_str_cfa59187172cda02(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_str_e81260f7e1cb3f82(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    subq    $32, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %r14, -320(%rbp)
+    jmp     .Lxly_ir0_b3
+.Lxly_ir0_b6:
+    movq    %r13, -320(%rbp)
+.Lxly_ir0_b3:
+    subq    $16, %rsp
+    movq    -264(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -320(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_09d22696bd314832(%rip), %rdi
+    call    xly_str
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_str_08ba5f07b55ec3da(%rip), %rdi
+    call    xly_str
+    movq    %rax, -336(%rbp)
+.Lxly_ir0_b8:
+    subq    $16, %rsp
+    movq    -336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -344(%rbp)
+    movq    %r14, %rdi
+    movq    -344(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_4:
+    movq    %rax, -352(%rbp)
+    cmpq    $0, -352(%rbp)
+    je      .Lxly_ir0_b10
+.Lxly_ir0_b9:
+    leaq    .Lxly_str_cfa59187172cda02(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    leaq    .Lxly_str_e81260f7e1cb3f82(%rip), %rdi
+    call    xly_str
+    movq    %rax, -368(%rbp)
+    subq    $32, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %r14, -376(%rbp)
+    jmp     .Lxly_ir0_b7
+.Lxly_ir0_b10:
+    movq    %r13, -376(%rbp)
+.Lxly_ir0_b7:
+    subq    $16, %rsp
+    movq    -328(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_15897c321906a9e2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, -392(%rbp)
+    movq    -392(%rbp), %rdi
+    call    .Lxly_fn_stringify
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r12, %rdi
+    call    .Lxly_fn_stringify
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r13, %rdi
+    call    .Lxly_fn_stringify
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_stringify
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2d54b3f88b8d5474(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_83418183381a686c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b12:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_018828bf0dc8596a(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_6:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b13:
+    leaq    .Lxly_str_e68ed3a457f63d98(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r14, %r15
+    jmp     .Lxly_ir0_b14
+.Lxly_ir0_b15:
+    movq    %r13, %r15
+.Lxly_ir0_b14:
+.Lxly_ir0_b11:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_79f14ee03c563b8c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c1b4b7f5bb3a46fe(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_82a82e4671b02d14(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c6504037672bb0be(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b4a7be76f2f78134(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_55e9fd80d7b2a64e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8553d0bc575ec2e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_503397b8c17e9419(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k189:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k193:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k196:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k197:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k198:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_getPropertyNames:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_getProperty:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    leaq    .Lxly_str_af63f54c86021707(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf3_0_b2
+.Lxly_irf3_0_b1:
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f54c86021707(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b2:
+    leaq    .Lxly_str_af63f44c86021554(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_4
+.Lxly_f3_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_4:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf3_0_b5
+.Lxly_irf3_0_b4:
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f44c86021554(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b5:
+    leaq    .Lxly_str_af63f74c86021a6d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_6
+.Lxly_f3_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_6:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf3_0_b8
+.Lxly_irf3_0_b7:
+    movq    %rbx, %rdi
+    movq    .Lxly_atom_af63f74c86021a6d(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b8:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_inspectObject:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    leaq    .Lxly_str_88ecffbb7f973682(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7e8af1a1b9ebb614(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c9acaf2c8c29f11e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_safeDivide:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f5_2
+.Lxly_f5_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f5_2:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf5_0_b2
+.Lxly_irf5_0_b1:
+    leaq    .Lxly_str_c8b2d93352054b79(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b2:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f5_4
+.Lxly_f5_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f5_4:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf5_0_b5
+.Lxly_irf5_0_b4:
+    leaq    .Lxly_str_b9deecb6d227bba6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b5:
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf5_0_k47(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f5_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f5_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f5_6
+.Lxly_f5_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f5_6:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf5_0_b8
+.Lxly_irf5_0_b7:
+    leaq    .Lxly_str_2ec0f24874c31e4d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b8:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf5_0_k47:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_assertNumber:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f6_2
+.Lxly_f6_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f6_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf6_0_b2
+.Lxly_irf6_0_b1:
+    leaq    .Lxly_str_cfa59187172cda02(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_e81260f7e1cb3f82(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf6_0_b2:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_assertString:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_ea3387071a6bf4c8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f7_2
+.Lxly_f7_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f7_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf7_0_b2
+.Lxly_irf7_0_b1:
+    leaq    .Lxly_str_cfa59187172cda02(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_ee694056ce0d6246(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf7_0_b2:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_stringify:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf8_0_b2
+.Lxly_irf8_0_b1:
+    leaq    .Lxly_str_bbb97b1c63507dc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf8_0_b2:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_ea3387071a6bf4c8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf8_0_b5
+.Lxly_irf8_0_b4:
+    leaq    .Lxly_str_58b4b3ecd4eb6238(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf8_0_b5:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_c5c964eca608a02f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf8_0_b8
+.Lxly_irf8_0_b7:
+    leaq    .Lxly_str_0b946f226c5700df(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf8_0_b8:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_1e71ad4e5d18f8d4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf8_0_b11
+.Lxly_irf8_0_b10:
+    leaq    .Lxly_str_8629c5c653f17cc4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf8_0_b11:
+    leaq    .Lxly_str_c592307ea80f16b9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_validatePerson:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_018828bf0dc8596a(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f9_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f9_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f9_2
+.Lxly_f9_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f9_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf9_0_b4
+.Lxly_irf9_0_b1:
+    leaq    .Lxly_str_e68ed3a457f63d98(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rbx, %r14
+    jmp     .Lxly_irf9_0_b2
+.Lxly_irf9_0_b4:
+    movq    %r12, %r14
+.Lxly_irf9_0_b2:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   6
+.Lxly_atoms:
+.Lxly_atom_c4bcadba8e631b86:
+    .quad   .Lxly_str_c4bcadba8e631b86
+.Lxly_atom_e715b4190539215c:
+    .quad   .Lxly_str_e715b4190539215c
+.Lxly_atom_f9dab5910f08a8a2:
+    .quad   .Lxly_str_f9dab5910f08a8a2
+.Lxly_atom_af63f54c86021707:
+    .quad   .Lxly_str_af63f54c86021707
+.Lxly_atom_af63f44c86021554:
+    .quad   .Lxly_str_af63f44c86021554
+.Lxly_atom_af63f74c86021a6d:
+    .quad   .Lxly_str_af63f74c86021a6d
+
+.section .rodata
+.Lxly_str_0f4cd52fa4574db3:
+    .asciz  "=== Reflective Programming ==="
+.Lxly_str_1bdebb75f34ab6d5:
+    .asciz  "1. Type Introspection"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_4caa2b3cc1c60fce:
+    .asciz  "Number:"
+.Lxly_str_a79439ef7bfa9c2d:
+    .asciz  "type"
+.Lxly_str_b78e02519d37ac70:
+    .asciz  "isNumber"
+.Lxly_str_a66fbd6dcbf78966:
+    .asciz  "String:"
+.Lxly_str_ea3387071a6bf4c8:
+    .asciz  "isString"
+.Lxly_str_0439bc7e17d6851f:
+    .asciz  "Boolean:"
+.Lxly_str_c5c964eca608a02f:
+    .asciz  "isBoolean"
+.Lxly_str_cd1aee2a38809f0a:
+    .asciz  "2. Object Inspection"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_36ace119c2ac7da1:
+    .asciz  "NYC"
+.Lxly_str_23e95751efb16c2b:
+    .asciz  "Person object created"
+.Lxly_str_da6638bfed434f99:
+    .asciz  "3. Function Metadata"
+.Lxly_str_a517b4f3c8ff2093:
+    .asciz  "Functions defined"
+.Lxly_str_d73af1b7a187a300:
+    .asciz  "add: 2 parameters"
+.Lxly_str_34012156cd24ab08:
+    .asciz  "multiply: 3 parameters"
+.Lxly_str_54235c8f756fa7e3:
+    .asciz  "4. Dynamic Property Access"
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_af63f44c86021554:
+    .asciz  "y"
+.Lxly_str_08f10e07b58d7ca7:
+    .asciz  "x:"
+.Lxly_str_08ed8c07b58a69ea:
+    .asciz  "y:"
+.Lxly_str_3b8675ee184873b7:
+    .asciz  "5. Generic Object Inspector"
+.Lxly_str_88ecffbb7f973682:
+    .asciz  "Object inspection:"
+.Lxly_str_7e8af1a1b9ebb614:
+    .asciz  "  Type: object"
+.Lxly_str_c9acaf2c8c29f11e:
+    .asciz  "  Has properties: true"
+.Lxly_str_a76edebf4bc012f5:
+    .asciz  "6. Runtime Type Checking"
+.Lxly_str_a585f6f24614debf:
+    .asciz  "safeDivide(10, 2):"
+.Lxly_str_b7e940f250cc9e01:
+    .asciz  "safeDivide(10, 0):"
+.Lxly_str_1cda3b2a3a520e4d:
+    .asciz  "7. Type Assertions"
+.Lxly_str_5edfa02468e320cf:
+    .asciz  "assertNumber(42):"
+.Lxly_str_7ce4fd9430e80cea:
+    .asciz  "value"
+.Lxly_str_cfa59187172cda02:
+    .asciz  "Assertion failed:"
+.Lxly_str_e81260f7e1cb3f82:
+    .asciz  "must be number"
+.Lxly_str_09d22696bd314832:
+    .asciz  "assertNumber('hi'):"
+.Lxly_str_08ba5f07b55ec3da:
+    .asciz  "hi"
+.Lxly_str_15897c321906a9e2:
+    .asciz  "8. Polymorphic Functions"
+.Lxly_str_2d54b3f88b8d5474:
+    .asciz  "9. Object Validation"
+.Lxly_str_83418183381a686c:
+    .asciz  "Validation passed:"
+.Lxly_str_018828bf0dc8596a:
+    .asciz  "isObject"
+.Lxly_str_e68ed3a457f63d98:
+    .asciz  "Must be object"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_79f14ee03c563b8c:
+    .asciz  "Reflective capabilities:"
+.Lxly_str_c1b4b7f5bb3a46fe:
+    .asciz  "  \342\200\242 Type introspection"
+.Lxly_str_82a82e4671b02d14:
+    .asciz  "  \342\200\242 Object inspection"
+.Lxly_str_c6504037672bb0be:
+    .asciz  "  \342\200\242 Function metadata"
+.Lxly_str_b4a7be76f2f78134:
+    .asciz  "  \342\200\242 Dynamic access"
+.Lxly_str_55e9fd80d7b2a64e:
+    .asciz  "  \342\200\242 Runtime validation"
+.Lxly_str_8553d0bc575ec2e6:
+    .asciz  "  \342\200\242 Polymorphic functions"
+.Lxly_str_503397b8c17e9419:
+    .asciz  "Complete!"
+.Lxly_str_af63f74c86021a6d:
+    .asciz  "z"
+.Lxly_str_c8b2d93352054b79:
+    .asciz  "Error: a must be number"
+.Lxly_str_b9deecb6d227bba6:
+    .asciz  "Error: b must be number"
+.Lxly_str_2ec0f24874c31e4d:
+    .asciz  "Error: division by zero"
+.Lxly_str_ee694056ce0d6246:
+    .asciz  "must be string"
+.Lxly_str_bbb97b1c63507dc0:
+    .asciz  "Number"
+.Lxly_str_58b4b3ecd4eb6238:
+    .asciz  "String"
+.Lxly_str_0b946f226c5700df:
+    .asciz  "Boolean"
+.Lxly_str_1e71ad4e5d18f8d4:
+    .asciz  "isNull"
+.Lxly_str_8629c5c653f17cc4:
+    .asciz  "Null"
+.Lxly_str_c592307ea80f16b9:
+    .asciz  "Unknown"
+.Lxly_str_c4bcadba8e631b86:
+    .asciz  "name"
+.Lxly_str_e715b4190539215c:
+    .asciz  "age"
+.Lxly_str_f9dab5910f08a8a2:
+    .asciz  "city"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   9
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   72
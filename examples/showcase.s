@@ -0,0 +1,2122 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1808, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movl    $-1, -1772(%rbp)
+    movl    $-1, -1644(%rbp)
+    movl    $-1, -1516(%rbp)
+    movl    $-1, -1388(%rbp)
+    movl    $-1, -1260(%rbp)
+    movl    $-1, -1132(%rbp)
+    movl    $-1, -1004(%rbp)
+    movl    $-1, -876(%rbp)
+    movl    $-1, -748(%rbp)
+    movl    $-1, -620(%rbp)
+    leaq    .Lxly_str_ea52f354aeb76618(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k274(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_fe7b3b98e61916fc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a3aa801f40464224(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d71a41cd2a060674(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f3229ef51d9f3cbc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, %r15
+    leaq    .Lxly_str_615475ed7c7a47dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -72(%rbp)
+.Lxly_ir0_b10:
+.Lxly_ir0_b12:
+.Lxly_ir0_b14:
+.Lxly_ir0_b9:
+    leaq    .Lxly_ir0_k275(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7bb69daf6c9c4fc5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b16:
+.Lxly_ir0_b17:
+.Lxly_ir0_b15:
+    leaq    .Lxly_ir0_k276(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_59a1ba0ee93c6a09(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -112(%rbp)
+.Lxly_ir0_b22:
+.Lxly_ir0_b24:
+.Lxly_ir0_b25:
+.Lxly_ir0_b21:
+    leaq    .Lxly_ir0_k277(%rip), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6a99a3b32f69e829(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_8f10225684d372a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, -152(%rbp)
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, -160(%rbp)
+.Lxly_ir0_b28:
+    movq    -160(%rbp), %rax
+    movq    %rax, -168(%rbp)
+    movq    -152(%rbp), %rax
+    movq    %rax, -176(%rbp)
+.Lxly_ir0_b29:
+    movq    %r15, %xmm0
+    movq    -168(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -184(%rbp)
+    cmpq    $0, -184(%rbp)
+    je      .Lxly_ir0_b31
+.Lxly_ir0_b30:
+.Lxly_ir0_b27:
+    movq    -176(%rbp), %xmm0
+    movsd   %xmm0, -648(%rbp)
+    leaq    -656(%rbp), %rax
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_18175673d740aace(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -208(%rbp)
+    movabsq $0x4052c00000000000, %rax
+    movq    %rax, -216(%rbp)
+.Lxly_ir0_b33:
+    movq    -216(%rbp), %rax
+    movq    %rax, -224(%rbp)
+    movq    -208(%rbp), %rax
+    movq    %rax, -232(%rbp)
+.Lxly_ir0_b34:
+    movq    %r15, %xmm0
+    movq    -224(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -240(%rbp)
+    cmpq    $0, -240(%rbp)
+    je      .Lxly_ir0_b36
+.Lxly_ir0_b35:
+.Lxly_ir0_b32:
+    movq    -232(%rbp), %xmm0
+    movsd   %xmm0, -776(%rbp)
+    leaq    -784(%rbp), %rax
+    movq    %rax, -248(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9952165a05071c75(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+    movabsq $0x4031000000000000, %rax
+    movq    %rax, -264(%rbp)
+    movabsq $0x402a000000000000, %rax
+    movq    %rax, -272(%rbp)
+.Lxly_ir0_b38:
+    movq    -272(%rbp), %rax
+    movq    %rax, -280(%rbp)
+    movq    -264(%rbp), %rax
+    movq    %rax, -288(%rbp)
+.Lxly_ir0_b39:
+    movq    %r15, %xmm0
+    movq    -280(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -296(%rbp)
+    cmpq    $0, -296(%rbp)
+    je      .Lxly_ir0_b41
+.Lxly_ir0_b40:
+.Lxly_ir0_b37:
+    movq    -288(%rbp), %xmm0
+    movsd   %xmm0, -904(%rbp)
+    leaq    -912(%rbp), %rax
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f61f67a399dc61d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    movq    -312(%rbp), %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, -320(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_ir0_k281(%rip), %rax
+    movq    %rax, -336(%rbp)
+    movq    -336(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x403b000000000000, %rax
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_str_6b236137e413fa68(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_str_00537417f10b2ac3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -368(%rbp)
+    leaq    .Lxly_str_124250ad5a5b6d14(%rip), %rdi
+    call    xly_str
+    movq    %rax, -376(%rbp)
+    movq    -328(%rbp), %rax
+    movq    %rax, -384(%rbp)
+.Lxly_ir0_b1:
+    movq    -384(%rbp), %xmm0
+    movq    -344(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -392(%rbp)
+    cmpq    $0, -392(%rbp)
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    -384(%rbp), %xmm0
+    movsd   %xmm0, -1032(%rbp)
+    leaq    -1040(%rbp), %rax
+    movq    %rax, -400(%rbp)
+    movq    -352(%rbp), %rdi
+    movq    -400(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1160(%rbp)
+    leaq    -1168(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -408(%rbp)
+    movq    -408(%rbp), %rdi
+    movq    -360(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1288(%rbp)
+    leaq    -1296(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -416(%rbp)
+.Lxly_ir0_b43:
+    movq    -384(%rbp), %rbx
+    movq    %r15, %r12
+.Lxly_ir0_b44:
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -424(%rbp)
+    cmpq    $0, -424(%rbp)
+    je      .Lxly_ir0_b49
+.Lxly_ir0_b45:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -432(%rbp)
+    movq    %r15, %xmm0
+    movq    -432(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -440(%rbp)
+    cmpq    $0, -440(%rbp)
+    je      .Lxly_ir0_b47
+.Lxly_ir0_b46:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -448(%rbp)
+    movq    -448(%rbp), %rax
+    movq    %rax, -464(%rbp)
+    jmp     .Lxly_ir0_b48
+.Lxly_ir0_b47:
+    movq    %rbx, %xmm0
+    movq    -368(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -456(%rbp)
+    movq    -456(%rbp), %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, -464(%rbp)
+.Lxly_ir0_b48:
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    -464(%rbp), %rax
+    movq    %rax, -520(%rbp)
+    movq    %rbx, %rax
+    movq    %rax, -528(%rbp)
+    movq    -520(%rbp), %rbx
+    movq    -528(%rbp), %r12
+    jmp     .Lxly_ir0_b44
+.Lxly_ir0_b49:
+.Lxly_ir0_b42:
+    movq    %r12, %xmm0
+    movsd   %xmm0, -1416(%rbp)
+    leaq    -1424(%rbp), %rax
+    movq    %rax, %rbx
+    subq    $32, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    -384(%rbp), %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movq    %rbx, -384(%rbp)
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c6b04e7261de63c7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, %rbx
+    leaq    .Lxly_str_276bc90ce8db1cdb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x3ff6a09e667f3bcd, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k285(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e943a3758c2fa181(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x4070000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k286(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5373d2accfec2b00(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k287(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_floor
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fe3af30e2448d789(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k288(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_ceil
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_510abb9ecf66c506(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, %r12
+    leaq    .Lxly_str_c93ce60ca05f57db(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_0ee91767c510cda0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_868e45b9abfffb65(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_upper
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5237d6ec9528fbff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_reverse
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b3f7be9e9ad78222(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d724f3cef00205ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_da596f1d14c59bbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_contains
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c8da41c71de640b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, %r13
+    leaq    .Lxly_str_6db82be8486328ff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, -472(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -472(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_70a08d70d226653c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_98976165590297cc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -472(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c792c06046487ab9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5af0eee96ae44d28(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -472(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_14126d3eefa39cca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_banner
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -480(%rbp)
+    leaq    .Lxly_ir0_k289(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x4060000000000000, %rax
+    movq    %rax, -488(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -496(%rbp)
+    leaq    .Lxly_str_f2a76d200b381140(%rip), %rdi
+    call    xly_str
+    movq    %rax, -504(%rbp)
+    movq    -480(%rbp), %rax
+    movq    %rax, -512(%rbp)
+.Lxly_ir0_b4:
+    movq    -512(%rbp), %xmm0
+    movq    -488(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b6
+.Lxly_ir0_b5:
+.Lxly_ir0_b51:
+    movq    -512(%rbp), %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b53
+.Lxly_ir0_b52:
+    movq    -56(%rbp), %r14
+    jmp     .Lxly_ir0_b50
+.Lxly_ir0_b53:
+    movq    -512(%rbp), %rbx
+.Lxly_ir0_b54:
+    movq    %rbx, %xmm0
+    movq    -480(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b58
+.Lxly_ir0_b55:
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b57
+.Lxly_ir0_b56:
+    movq    -56(%rbp), %r14
+    jmp     .Lxly_ir0_b50
+.Lxly_ir0_b57:
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %rbx
+    jmp     .Lxly_ir0_b54
+.Lxly_ir0_b58:
+    movq    -472(%rbp), %r14
+.Lxly_ir0_b50:
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b8
+.Lxly_ir0_b7:
+    movq    -512(%rbp), %xmm0
+    movsd   %xmm0, -1544(%rbp)
+    leaq    -1552(%rbp), %rax
+    movq    %rax, %rbx
+    movq    -496(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1672(%rbp)
+    leaq    -1680(%rbp), %rax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    -504(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1800(%rbp)
+    leaq    -1808(%rbp), %rax
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b8:
+    movq    -512(%rbp), %xmm0
+    movq    -480(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movq    %rbx, -512(%rbp)
+    jmp     .Lxly_ir0_b4
+.Lxly_ir0_b6:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7301480d0bb8e2f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_ir0_b41:
+    movq    -288(%rbp), %xmm0
+    movq    -280(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, -520(%rbp)
+    movq    -280(%rbp), %rax
+    movq    %rax, -528(%rbp)
+    movq    -520(%rbp), %rax
+    movq    %rax, -280(%rbp)
+    movq    -528(%rbp), %rax
+    movq    %rax, -288(%rbp)
+    jmp     .Lxly_ir0_b39
+.Lxly_ir0_b36:
+    movq    -232(%rbp), %xmm0
+    movq    -224(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, -520(%rbp)
+    movq    -224(%rbp), %rax
+    movq    %rax, -528(%rbp)
+    movq    -520(%rbp), %rax
+    movq    %rax, -224(%rbp)
+    movq    -528(%rbp), %rax
+    movq    %rax, -232(%rbp)
+    jmp     .Lxly_ir0_b34
+.Lxly_ir0_b31:
+    movq    -176(%rbp), %xmm0
+    movq    -168(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, -520(%rbp)
+    movq    -168(%rbp), %rax
+    movq    %rax, -528(%rbp)
+    movq    -520(%rbp), %rax
+    movq    %rax, -168(%rbp)
+    movq    -528(%rbp), %rax
+    movq    %rax, -176(%rbp)
+    jmp     .Lxly_ir0_b29
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k274:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k275:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k276:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k277:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k281:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k285:
+    .quad   0, 0x3ff6a09e667f3bcd, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k286:
+    .quad   0, 0x4070000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k287:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k288:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k289:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_clamp:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f0_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf0_0_b2
+.Lxly_irf0_0_b1:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b2:
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_gt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f0_4:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf0_0_b5
+.Lxly_irf0_0_b4:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf0_0_b5:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_repeat_string:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movq    %r14, %rbx
+    movq    %r13, %r12
+.Lxly_irf1_0_b1:
+    movq    %rbx, %xmm0
+    movq    -56(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf1_0_b3
+.Lxly_irf1_0_b2:
+    movq    %r12, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r14
+    movq    %rbx, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %rbx
+    movq    %r14, %r12
+    jmp     .Lxly_irf1_0_b1
+.Lxly_irf1_0_b3:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_banner:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1056, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movl    $-1, -1012(%rbp)
+    movl    $-1, -884(%rbp)
+    movl    $-1, -756(%rbp)
+    movl    $-1, -628(%rbp)
+    movl    $-1, -500(%rbp)
+    movl    $-1, -372(%rbp)
+    movl    $-1, -244(%rbp)
+    leaq    .Lxly_str_5668301b8871b8d9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    movabsq $0x4044000000000000, %rax
+    movq    %rax, -64(%rbp)
+.Lxly_irf2_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r15, %rbx
+    movq    %r14, %r12
+.Lxly_irf2_0_b3:
+    movq    %rbx, %xmm0
+    movq    -64(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf2_0_b5
+.Lxly_irf2_0_b4:
+    movq    %r12, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_2
+.Lxly_f2_1:
+    call    xly_add
+.Lxly_f2_2:
+    movq    %rax, %r13
+    movq    %rbx, %xmm0
+    movq    -72(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rbx
+    movq    %r13, %r12
+    jmp     .Lxly_irf2_0_b3
+.Lxly_irf2_0_b5:
+.Lxly_irf2_0_b1:
+    leaq    .Lxly_str_56683c1b8871cd3d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -272(%rbp)
+    leaq    -280(%rbp), %rax
+    jmp     .Lxly_f2_4
+.Lxly_f2_3:
+    call    xly_add
+.Lxly_f2_4:
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5668401b8871d409(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -400(%rbp)
+    leaq    -408(%rbp), %rax
+    jmp     .Lxly_f2_6
+.Lxly_f2_5:
+    call    xly_add
+.Lxly_f2_6:
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_02010f4918a4d9ab(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -528(%rbp)
+    leaq    -536(%rbp), %rax
+    jmp     .Lxly_f2_8
+.Lxly_f2_7:
+    call    xly_add
+.Lxly_f2_8:
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    movabsq $0x4043000000000000, %rax
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+    movq    -112(%rbp), %xmm0
+    movq    -120(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -128(%rbp)
+.Lxly_irf2_0_b7:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -136(%rbp)
+    movq    %r15, %rbx
+    movq    %r14, %r13
+.Lxly_irf2_0_b8:
+    movq    %rbx, %xmm0
+    movq    -128(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf2_0_b10
+.Lxly_irf2_0_b9:
+    movq    %r13, %rdi
+    movq    -104(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f2_10
+.Lxly_f2_9:
+    call    xly_add
+.Lxly_f2_10:
+    movq    %rax, %r15
+    movq    %rbx, %xmm0
+    movq    -136(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %rbx
+    movq    %r15, %r13
+    jmp     .Lxly_irf2_0_b8
+.Lxly_irf2_0_b10:
+.Lxly_irf2_0_b6:
+    movq    -96(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -656(%rbp)
+    leaq    -664(%rbp), %rax
+    jmp     .Lxly_f2_12
+.Lxly_f2_11:
+    call    xly_add
+.Lxly_f2_12:
+    movq    %rax, %r15
+    leaq    .Lxly_str_56682e1b8871b573(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -784(%rbp)
+    leaq    -792(%rbp), %rax
+    jmp     .Lxly_f2_14
+.Lxly_f2_13:
+    call    xly_add
+.Lxly_f2_14:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5668441b8871dad5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -912(%rbp)
+    leaq    -920(%rbp), %rax
+    jmp     .Lxly_f2_16
+.Lxly_f2_15:
+    call    xly_add
+.Lxly_f2_16:
+    movq    %rax, %r14
+    leaq    .Lxly_str_5668481b8871e1a1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f2_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f2_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1040(%rbp)
+    leaq    -1048(%rbp), %rax
+    jmp     .Lxly_f2_18
+.Lxly_f2_17:
+    call    xly_add
+.Lxly_f2_18:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_gcd:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    movq    %r12, %r14
+    movq    %rbx, %r15
+.Lxly_irf3_0_b1:
+    leaq    .Lxly_irf3_0_k20(%rip), %rax
+    movq    %rax, %r12
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f3_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf3_0_b3
+.Lxly_irf3_0_b2:
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf3_0_b3:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r14, %rax
+    movq    %rax, -72(%rbp)
+    movq    -64(%rbp), %r14
+    movq    -72(%rbp), %r15
+    jmp     .Lxly_irf3_0_b1
+
+.section .rodata
+.balign 16
+.Lxly_irf3_0_k20:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_collatz_steps:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $144, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movq    -48(%rbp), %r15
+    movq    %r12, %rbx
+.Lxly_irf4_0_b1:
+    leaq    .Lxly_irf4_0_k32(%rip), %rax
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f4_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f4_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f4_2
+.Lxly_f4_1:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f4_2:
+    movq    %rax, -72(%rbp)
+    cmpq    $0, -72(%rbp)
+    je      .Lxly_irf4_0_b3
+.Lxly_irf4_0_b2:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    %r12, %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -88(%rbp)
+    cmpq    $0, -88(%rbp)
+    je      .Lxly_irf4_0_b6
+.Lxly_irf4_0_b4:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %rax
+    movq    %rax, -112(%rbp)
+    jmp     .Lxly_irf4_0_b5
+.Lxly_irf4_0_b6:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, -112(%rbp)
+.Lxly_irf4_0_b5:
+    movq    %rbx, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    -112(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    movq    %rax, -128(%rbp)
+    movq    %r15, %rax
+    movq    %rax, -136(%rbp)
+    movq    -128(%rbp), %r15
+    movq    -136(%rbp), %rbx
+    jmp     .Lxly_irf4_0_b1
+.Lxly_irf4_0_b3:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf4_0_k32:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_is_power_of_two:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf5_0_b2
+.Lxly_irf5_0_b1:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movq    %rbx, %r15
+.Lxly_irf5_0_b4:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf5_0_b6
+.Lxly_irf5_0_b5:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf5_0_b8
+.Lxly_irf5_0_b7:
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf5_0_b8:
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    jmp     .Lxly_irf5_0_b4
+.Lxly_irf5_0_b6:
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_ea52f354aeb76618:
+    .asciz  "Xenly Showcase"
+.Lxly_str_fe7b3b98e61916fc:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_a3aa801f40464224:
+    .asciz  "\342\225\221     Xenly Showcase                \342\225\221"
+.Lxly_str_d71a41cd2a060674:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_f3229ef51d9f3cbc:
+    .asciz  "Clamp Function"
+.Lxly_str_615475ed7c7a47dc:
+    .asciz  "  clamp(5, 0, 10)   ="
+.Lxly_str_7bb69daf6c9c4fc5:
+    .asciz  "  clamp(-5, 0, 10)  ="
+.Lxly_str_59a1ba0ee93c6a09:
+    .asciz  "  clamp(15, 0, 10)  ="
+.Lxly_str_6a99a3b32f69e829:
+    .asciz  "Greatest Common Divisor"
+.Lxly_str_8f10225684d372a2:
+    .asciz  "  gcd(48, 18) ="
+.Lxly_str_18175673d740aace:
+    .asciz  "  gcd(100, 75) ="
+.Lxly_str_9952165a05071c75:
+    .asciz  "  gcd(17, 13) ="
+.Lxly_str_f61f67a399dc61d0:
+    .asciz  "Collatz Conjecture"
+.Lxly_str_6b236137e413fa68:
+    .asciz  "  collatz("
+.Lxly_str_00537417f10b2ac3:
+    .asciz  ") ="
+.Lxly_str_124250ad5a5b6d14:
+    .asciz  "steps"
+.Lxly_str_c6b04e7261de63c7:
+    .asciz  "Math Operations"
+.Lxly_str_276bc90ce8db1cdb:
+    .asciz  "  sqrt(2)     ="
+.Lxly_str_e943a3758c2fa181:
+    .asciz  "  pow(2,8)    ="
+.Lxly_str_5373d2accfec2b00:
+    .asciz  "  floor(pi)   ="
+.Lxly_str_fe3af30e2448d789:
+    .asciz  "  ceil(pi)    ="
+.Lxly_str_510abb9ecf66c506:
+    .asciz  "String Operations"
+.Lxly_str_c93ce60ca05f57db:
+    .asciz  "hello xenly"
+.Lxly_str_0ee91767c510cda0:
+    .asciz  "  original  :"
+.Lxly_str_868e45b9abfffb65:
+    .asciz  "  upper     :"
+.Lxly_str_5237d6ec9528fbff:
+    .asciz  "  reverse   :"
+.Lxly_str_b3f7be9e9ad78222:
+    .asciz  "  len       :"
+.Lxly_str_d724f3cef00205ce:
+    .asciz  "  contains  :"
+.Lxly_str_da596f1d14c59bbf:
+    .asciz  "xenly"
+.Lxly_str_c8da41c71de640b1:
+    .asciz  "Logic"
+.Lxly_str_6db82be8486328ff:
+    .asciz  "  true and true  ="
+.Lxly_str_70a08d70d226653c:
+    .asciz  "  true and false ="
+.Lxly_str_98976165590297cc:
+    .asciz  "  true or false  ="
+.Lxly_str_c792c06046487ab9:
+    .asciz  "  not true       ="
+.Lxly_str_5af0eee96ae44d28:
+    .asciz  "  not false      ="
+.Lxly_str_14126d3eefa39cca:
+    .asciz  "Powers of Two"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_f2a76d200b381140:
+    .asciz  " is a power of 2"
+.Lxly_str_7301480d0bb8e2f0:
+    .asciz  "Done!"
+.Lxly_str_5668301b8871b8d9:
+    .asciz  "\342\224\200"
+.Lxly_str_56683c1b8871cd3d:
+    .asciz  "\342\224\214"
+.Lxly_str_5668401b8871d409:
+    .asciz  "\342\224\220"
+.Lxly_str_02010f4918a4d9ab:
+    .asciz  "\342\224\202  "
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_56682e1b8871b573:
+    .asciz  "\342\224\202"
+.Lxly_str_5668441b8871dad5:
+    .asciz  "\342\224\224"
+.Lxly_str_5668481b8871e1a1:
+    .asciz  "\342\224\230"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   6
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   48
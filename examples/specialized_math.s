@@ -0,0 +1,3277 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $3168, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -3168(%rbp)
+    movq    %rax, -3160(%rbp)
+    movq    %rax, -3152(%rbp)
+    movq    %rax, -3144(%rbp)
+    movq    %rax, -3136(%rbp)
+    movq    %rax, -3128(%rbp)
+    movq    %rax, -3120(%rbp)
+    movq    %rax, -3112(%rbp)
+    movq    %rax, -3104(%rbp)
+    movq    %rax, -3096(%rbp)
+    movq    %rax, -3088(%rbp)
+    movq    %rax, -3080(%rbp)
+    movq    %rax, -3072(%rbp)
+    movq    %rax, -3064(%rbp)
+    movq    %rax, -3056(%rbp)
+    movq    %rax, -3048(%rbp)
+    movq    %rax, -3040(%rbp)
+    movq    %rax, -3032(%rbp)
+    movq    %rax, -3024(%rbp)
+    movq    %rax, -3016(%rbp)
+    movq    %rax, -3008(%rbp)
+    movq    %rax, -3000(%rbp)
+    movq    %rax, -2992(%rbp)
+    movq    %rax, -2984(%rbp)
+    movq    %rax, -2976(%rbp)
+    movq    %rax, -2968(%rbp)
+    movq    %rax, -2960(%rbp)
+    movq    %rax, -2952(%rbp)
+    movq    %rax, -2944(%rbp)
+    movq    %rax, -2936(%rbp)
+    movq    %rax, -2928(%rbp)
+    movq    %rax, -2920(%rbp)
+    movq    %rax, -2912(%rbp)
+    movq    %rax, -2904(%rbp)
+    movq    %rax, -2896(%rbp)
+    movq    %rax, -2888(%rbp)
+    movq    %rax, -2880(%rbp)
+    movq    %rax, -2872(%rbp)
+    movq    %rax, -2864(%rbp)
+    movq    %rax, -2856(%rbp)
+    movq    %rax, -2848(%rbp)
+    movq    %rax, -2840(%rbp)
+    movq    %rax, -2832(%rbp)
+    movq    %rax, -2824(%rbp)
+    movq    %rax, -2816(%rbp)
+    movq    %rax, -2808(%rbp)
+    movq    %rax, -2800(%rbp)
+    movq    %rax, -2792(%rbp)
+    movq    %rax, -2784(%rbp)
+    movq    %rax, -2776(%rbp)
+    movq    %rax, -2768(%rbp)
+    movq    %rax, -2760(%rbp)
+    movq    %rax, -2752(%rbp)
+    movq    %rax, -2744(%rbp)
+    movq    %rax, -2736(%rbp)
+    movq    %rax, -2728(%rbp)
+    movq    %rax, -2720(%rbp)
+    movq    %rax, -2712(%rbp)
+    movq    %rax, -2704(%rbp)
+    movq    %rax, -2696(%rbp)
+    movq    %rax, -2688(%rbp)
+    movq    %rax, -2680(%rbp)
+    movq    %rax, -2672(%rbp)
+    movq    %rax, -2664(%rbp)
+    movq    %rax, -2656(%rbp)
+    movq    %rax, -2648(%rbp)
+    movq    %rax, -2640(%rbp)
+    movq    %rax, -2632(%rbp)
+    movq    %rax, -2624(%rbp)
+    movq    %rax, -2616(%rbp)
+    movq    %rax, -2608(%rbp)
+    movq    %rax, -2600(%rbp)
+    movq    %rax, -2592(%rbp)
+    movq    %rax, -2584(%rbp)
+    movq    %rax, -2576(%rbp)
+    movq    %rax, -2568(%rbp)
+    movq    %rax, -2560(%rbp)
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movl    $-1, -3132(%rbp)
+    movl    $-1, -3004(%rbp)
+    movl    $-1, -2876(%rbp)
+    movl    $-1, -2748(%rbp)
+    movl    $-1, -2620(%rbp)
+    movl    $-1, -2492(%rbp)
+    movl    $-1, -2364(%rbp)
+    movl    $-1, -2236(%rbp)
+    movl    $-1, -2108(%rbp)
+    movl    $-1, -1980(%rbp)
+    movl    $-1, -1852(%rbp)
+    movl    $-1, -1724(%rbp)
+    movl    $-1, -1596(%rbp)
+    movl    $-1, -1468(%rbp)
+    movl    $-1, -1340(%rbp)
+    movl    $-1, -1212(%rbp)
+    leaq    .Lxly_str_99dcab56bbaf8eff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_fabf74b28d71fe3c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k476(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x3ff921fb54442d18, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k477(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b2:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k478(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    movq    %r14, %xmm0
+    movq    -48(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b1:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k480(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -72(%rbp)
+    movq    %r14, %xmm0
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+.Lxly_ir0_b3:
+    movq    -80(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+.Lxly_ir0_b6:
+    leaq    .Lxly_ir0_k482(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+    movq    %r14, %xmm0
+    movq    -104(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+.Lxly_ir0_b5:
+    movq    -112(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -120(%rbp)
+    movq    -120(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_7b46c4aa9907fd38(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    movq    %r15, %xmm0
+    movsd   %xmm0, -1240(%rbp)
+    leaq    -1248(%rbp), %rax
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d0ed88d9ac009258(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    -80(%rbp), %xmm0
+    movsd   %xmm0, -1368(%rbp)
+    leaq    -1376(%rbp), %rax
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_98ad0ec251a3a3c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    -112(%rbp), %xmm0
+    movsd   %xmm0, -1496(%rbp)
+    leaq    -1504(%rbp), %rax
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2e2df3f30101b666(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k487(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -160(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, -168(%rbp)
+    movq    %r14, %xmm0
+    movq    -168(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -176(%rbp)
+.Lxly_ir0_b7:
+    movq    -176(%rbp), %xmm0
+    movsd   %xmm0, -1624(%rbp)
+    leaq    -1632(%rbp), %rax
+    movq    %rax, -184(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ada8721360777b5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k489(%rip), %rax
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    movq    %r14, %xmm0
+    movq    -200(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -208(%rbp)
+.Lxly_ir0_b9:
+    movq    -208(%rbp), %xmm0
+    movsd   %xmm0, -1752(%rbp)
+    leaq    -1760(%rbp), %rax
+    movq    %rax, -216(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a489209bd430e178(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k491(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    -224(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k492(%rip), %rax
+    movq    %rax, -240(%rbp)
+    movq    -240(%rbp), %rdi
+    movq    -232(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1880(%rbp)
+    leaq    -1888(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -248(%rbp)
+.Lxly_ir0_b11:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_85ec0dd27efe6f81(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k493(%rip), %rax
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_ir0_k494(%rip), %rax
+    movq    %rax, -272(%rbp)
+    movq    -272(%rbp), %rdi
+    movq    -264(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2008(%rbp)
+    leaq    -2016(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -280(%rbp)
+.Lxly_ir0_b13:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_48c8509af7faa9c7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_97001fbcce66a60d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -288(%rbp)
+.Lxly_ir0_b16:
+    leaq    .Lxly_ir0_k495(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    movq    %r14, %xmm0
+    movq    -304(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -312(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -320(%rbp)
+    movq    -312(%rbp), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -328(%rbp)
+.Lxly_ir0_b15:
+    movq    -328(%rbp), %xmm0
+    movsd   %xmm0, -2136(%rbp)
+    leaq    -2144(%rbp), %rax
+    movq    %rax, -336(%rbp)
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -336(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_233e3ba7630d5757(%rip), %rdi
+    call    xly_str
+    movq    %rax, -344(%rbp)
+.Lxly_ir0_b18:
+    leaq    .Lxly_ir0_k497(%rip), %rax
+    movq    %rax, -352(%rbp)
+    subq    $16, %rsp
+    movq    -352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -360(%rbp)
+    movq    %r14, %xmm0
+    movq    -360(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -376(%rbp)
+.Lxly_ir0_b17:
+    movq    -376(%rbp), %xmm0
+    movsd   %xmm0, -2264(%rbp)
+    leaq    -2272(%rbp), %rax
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -384(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_12ca7fb3010ecd9a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -392(%rbp)
+.Lxly_ir0_b20:
+    leaq    .Lxly_ir0_k499(%rip), %rax
+    movq    %rax, -400(%rbp)
+    subq    $16, %rsp
+    movq    -400(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -408(%rbp)
+    movq    %r14, %xmm0
+    movq    -408(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -416(%rbp)
+    movq    -416(%rbp), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -424(%rbp)
+.Lxly_ir0_b19:
+    movq    -424(%rbp), %xmm0
+    movsd   %xmm0, -2392(%rbp)
+    leaq    -2400(%rbp), %rax
+    movq    %rax, -432(%rbp)
+    subq    $16, %rsp
+    movq    -392(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -432(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_c2c841110c61cc33(%rip), %rdi
+    call    xly_str
+    movq    %rax, -440(%rbp)
+.Lxly_ir0_b22:
+    leaq    .Lxly_ir0_k501(%rip), %rax
+    movq    %rax, -448(%rbp)
+    subq    $16, %rsp
+    movq    -448(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, -456(%rbp)
+    movq    %r14, %xmm0
+    movq    -456(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -464(%rbp)
+    movq    -464(%rbp), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -472(%rbp)
+.Lxly_ir0_b21:
+    movq    -472(%rbp), %xmm0
+    movsd   %xmm0, -2520(%rbp)
+    leaq    -2528(%rbp), %rax
+    movq    %rax, -480(%rbp)
+    subq    $16, %rsp
+    movq    -440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -480(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a9f1a94b20172d59(%rip), %rdi
+    call    xly_str
+    movq    %rax, -488(%rbp)
+.Lxly_ir0_b24:
+    leaq    .Lxly_ir0_k503(%rip), %rax
+    movq    %rax, -496(%rbp)
+    subq    $16, %rsp
+    movq    -496(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, -504(%rbp)
+    movq    %r14, %xmm0
+    movq    -504(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -512(%rbp)
+    movq    -512(%rbp), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -520(%rbp)
+.Lxly_ir0_b23:
+    movq    -520(%rbp), %xmm0
+    movsd   %xmm0, -2648(%rbp)
+    leaq    -2656(%rbp), %rax
+    movq    %rax, -528(%rbp)
+    subq    $16, %rsp
+    movq    -488(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -528(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_25d85064a5f7be3d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -536(%rbp)
+.Lxly_ir0_b26:
+    leaq    .Lxly_ir0_k505(%rip), %rax
+    movq    %rax, -544(%rbp)
+    subq    $16, %rsp
+    movq    -544(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -552(%rbp)
+    leaq    .Lxly_ir0_k506(%rip), %rax
+    movq    %rax, -560(%rbp)
+    movq    -560(%rbp), %rdi
+    movq    -552(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2776(%rbp)
+    leaq    -2784(%rbp), %rax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, -568(%rbp)
+    movq    -568(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -576(%rbp)
+.Lxly_ir0_b25:
+    movq    -576(%rbp), %xmm0
+    movsd   %xmm0, -2904(%rbp)
+    leaq    -2912(%rbp), %rax
+    movq    %rax, -584(%rbp)
+    subq    $16, %rsp
+    movq    -536(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -584(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_08ec7ce3d8f7c06a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -592(%rbp)
+.Lxly_ir0_b28:
+    leaq    .Lxly_ir0_k508(%rip), %rax
+    movq    %rax, -600(%rbp)
+    subq    $16, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k509(%rip), %rax
+    movq    %rax, -608(%rbp)
+    movq    -608(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3032(%rbp)
+    leaq    -3040(%rbp), %rax
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, -616(%rbp)
+    movq    -616(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -320(%rbp), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b27:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -3160(%rbp)
+    leaq    -3168(%rbp), %rax
+    movq    %rax, -624(%rbp)
+    subq    $16, %rsp
+    movq    -592(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -624(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d3d7922cf1d90396(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e77197a489763ae5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b30:
+    leaq    .Lxly_ir0_k511(%rip), %rax
+    movq    %rax, -632(%rbp)
+    subq    $16, %rsp
+    movq    -632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -640(%rbp)
+    movq    %r14, %xmm0
+    movq    -640(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -648(%rbp)
+    movq    -648(%rbp), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -656(%rbp)
+.Lxly_ir0_b29:
+    movq    -656(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -664(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -664(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6869314a0fa79228(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x3ff0c152382d7365, %rax
+    movq    %rax, -672(%rbp)
+.Lxly_ir0_b32:
+    leaq    .Lxly_ir0_k513(%rip), %rax
+    movq    %rax, -680(%rbp)
+    subq    $16, %rsp
+    movq    -680(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -688(%rbp)
+    movq    %r14, %xmm0
+    movq    -688(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -696(%rbp)
+    movq    -696(%rbp), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -704(%rbp)
+.Lxly_ir0_b31:
+    movq    -704(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -712(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -712(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6ce8b462fcb87add(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b34:
+    leaq    .Lxly_ir0_k515(%rip), %rax
+    movq    %rax, -720(%rbp)
+    subq    $16, %rsp
+    movq    -720(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -728(%rbp)
+    movq    -728(%rbp), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b33:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -736(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -736(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9067d0631110b7d9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3fe0c152382d7365, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b36:
+    leaq    .Lxly_ir0_k517(%rip), %rax
+    movq    %rax, -744(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r14, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -752(%rbp)
+    movq    -752(%rbp), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_ir0_b35:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -760(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_17b69292f137d10f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    movabsq $0x40b8e30000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k519(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x40445b3d07c84b5e, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k520(%rip), %rax
+    movq    %rax, -768(%rbp)
+    movq    -768(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0xc05280624dd2f1aa, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k521(%rip), %rax
+    movq    %rax, -776(%rbp)
+    movq    -776(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x4049c0f27bb2fec5, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k522(%rip), %rax
+    movq    %rax, -784(%rbp)
+    movq    -784(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movabsq $0xbfc05bc01a36e2eb, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k523(%rip), %rax
+    movq    %rax, -792(%rbp)
+    movq    -792(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+.Lxly_ir0_b38:
+    movabsq $0x3fe6bd0258912f4a, %rax
+    movq    %rax, %r12
+    movabsq $0x3fecc4648875abaf, %rax
+    movq    %rax, -800(%rbp)
+    movabsq $0x3ff4a17498a1f999, %rax
+    movq    %rax, -808(%rbp)
+    movabsq $0x3fc81d88bf91f196, %rax
+    movq    %rax, -816(%rbp)
+    leaq    .Lxly_ir0_k524(%rip), %rax
+    movq    %rax, -824(%rbp)
+    movq    -824(%rbp), %rdi
+    call    .Lxly_fn_haversine
+    movq    %rax, -832(%rbp)
+    leaq    .Lxly_ir0_k525(%rip), %rax
+    movq    %rax, -840(%rbp)
+    subq    $16, %rsp
+    movq    -840(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k526(%rip), %rax
+    movq    %rax, -848(%rbp)
+    subq    $16, %rsp
+    movq    -848(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -856(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    -856(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -864(%rbp)
+    leaq    .Lxly_ir0_k527(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_haversine
+    movq    %rax, -872(%rbp)
+    movq    -864(%rbp), %xmm0
+    movq    -872(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -880(%rbp)
+    movq    -832(%rbp), %rdi
+    movq    -880(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_add
+.Lxly_10:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sqrt
+    addq    $16, %rsp
+    movq    %rax, -888(%rbp)
+    subq    $16, %rsp
+    movq    -888(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_asin
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    -320(%rbp), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -896(%rbp)
+    movq    %rbx, %xmm0
+    movq    -896(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_ir0_b37:
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_6a6363e59485a806(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_08be3b07b5626f85(%rip), %rdi
+    call    xly_str
+    movq    %rax, -904(%rbp)
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -912(%rbp)
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -912(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -904(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ef7643d0f943d815(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_116a46b223517855(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b40:
+.Lxly_ir0_b41:
+.Lxly_ir0_b42:
+.Lxly_ir0_b43:
+.Lxly_ir0_b39:
+    leaq    .Lxly_ir0_k531(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_26bfadda6885dc92(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b46:
+.Lxly_ir0_b47:
+.Lxly_ir0_b48:
+.Lxly_ir0_b50:
+.Lxly_ir0_b45:
+    leaq    .Lxly_ir0_k532(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6fedf3f8e85fba2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b52:
+.Lxly_ir0_b54:
+.Lxly_ir0_b56:
+.Lxly_ir0_b51:
+    leaq    .Lxly_ir0_k533(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_102336a345c16b50(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e9f2bb1b22988fa5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -920(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -928(%rbp)
+.Lxly_ir0_b58:
+    movq    %r14, %r12
+    movq    %r13, %r15
+.Lxly_ir0_b59:
+    movq    %r12, %xmm0
+    movq    -928(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -936(%rbp)
+    cmpq    $0, -936(%rbp)
+    je      .Lxly_ir0_b63
+.Lxly_ir0_b60:
+    movq    -928(%rbp), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -944(%rbp)
+    movq    %r13, %xmm0
+    movq    -944(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -952(%rbp)
+    cmpq    $0, -952(%rbp)
+    je      .Lxly_ir0_b80
+.Lxly_ir0_b61:
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -960(%rbp)
+    movq    -960(%rbp), %rax
+    movq    %rax, -968(%rbp)
+    jmp     .Lxly_ir0_b62
+.Lxly_ir0_b80:
+    movq    %r15, -968(%rbp)
+.Lxly_ir0_b62:
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -976(%rbp)
+    movq    -976(%rbp), %r12
+    movq    -968(%rbp), %r15
+    jmp     .Lxly_ir0_b59
+.Lxly_ir0_b63:
+.Lxly_ir0_b57:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -920(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_174fb3344871ff20(%rip), %rdi
+    call    xly_str
+    movq    %rax, -984(%rbp)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b65:
+    movq    %r14, %r12
+    movq    %r13, %rbx
+.Lxly_ir0_b66:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -992(%rbp)
+    cmpq    $0, -992(%rbp)
+    je      .Lxly_ir0_b70
+.Lxly_ir0_b67:
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -1000(%rbp)
+    movq    %r13, %xmm0
+    movq    -1000(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -1008(%rbp)
+    cmpq    $0, -1008(%rbp)
+    je      .Lxly_ir0_b81
+.Lxly_ir0_b68:
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1016(%rbp)
+    movq    -1016(%rbp), %rax
+    movq    %rax, -1024(%rbp)
+    jmp     .Lxly_ir0_b69
+.Lxly_ir0_b81:
+    movq    %rbx, -1024(%rbp)
+.Lxly_ir0_b69:
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1032(%rbp)
+    movq    -1032(%rbp), %r12
+    movq    -1024(%rbp), %rbx
+    jmp     .Lxly_ir0_b66
+.Lxly_ir0_b70:
+.Lxly_ir0_b64:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -984(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0ce02d3cced699dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1040(%rbp)
+    movabsq $0x403c000000000000, %rax
+    movq    %rax, -1048(%rbp)
+.Lxly_ir0_b72:
+    movq    %r14, %r12
+    movq    %r13, %rbx
+.Lxly_ir0_b73:
+    movq    %r12, %xmm0
+    movq    -1048(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -1056(%rbp)
+    cmpq    $0, -1056(%rbp)
+    je      .Lxly_ir0_b77
+.Lxly_ir0_b74:
+    movq    -1048(%rbp), %xmm0
+    movq    %r12, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -1064(%rbp)
+    movq    %r13, %xmm0
+    movq    -1064(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -1072(%rbp)
+    cmpq    $0, -1072(%rbp)
+    je      .Lxly_ir0_b82
+.Lxly_ir0_b75:
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1080(%rbp)
+    movq    -1080(%rbp), %rax
+    movq    %rax, -1088(%rbp)
+    jmp     .Lxly_ir0_b76
+.Lxly_ir0_b82:
+    movq    %rbx, -1088(%rbp)
+.Lxly_ir0_b76:
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1096(%rbp)
+    movq    -1096(%rbp), %r12
+    movq    -1088(%rbp), %rbx
+    jmp     .Lxly_ir0_b73
+.Lxly_ir0_b77:
+.Lxly_ir0_b71:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -1040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_e7161e0d3952c4c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_873d951f25bb51e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b79:
+    leaq    .Lxly_ir0_k537(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_sigma
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k538(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_11
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_12
+.Lxly_11:
+    call    xly_eq
+.Lxly_12:
+    movq    %rax, -1104(%rbp)
+.Lxly_ir0_b78:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_adeb1c0592e2b4f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k539(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_isPerfect
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fedeeb643999aeab(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k540(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    call    .Lxly_fn_isPerfect
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2928d1569660eb5c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b0a12c3c1c957196(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k541(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    .Lxly_fn_liouville
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_959bb33c0cfc537b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k542(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_liouville
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c994a93c2a6c6d79(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k543(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_liouville
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b9515f3c21831497(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k544(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    call    .Lxly_fn_liouville
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_62b2c53bf0737a45(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k545(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    call    .Lxly_fn_liouville
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_92e4acb078558aff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4ecfb809808fdaa7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fcc2d2da1de05428(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_63e4b7b34b3f7b9f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d5b71bbe58b80b26(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1edf0e774eaf3168(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1514b4f096240208(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5a41e14e2f747102(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f0b00a88d95f1114(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e11e09104a74db0f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f1de3f2c2c2d8fad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2fa2a99c0d140135(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ac8ab13c6c6eb524(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6e80f9d17f73425d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_69c5c348960a23ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a212adb897a9d5b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k476:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k477:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k478:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k480:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k482:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k487:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k489:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k491:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k492:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k493:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k494:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k495:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k497:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k499:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k501:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k503:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k505:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k506:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k508:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k509:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k511:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k513:
+    .quad   0, 0x3ff0c152382d7365, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k515:
+    .quad   0, 0x3ff921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k517:
+    .quad   0, 0x3fe0c152382d7365, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k519:
+    .quad   0, 0x40b8e30000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k520:
+    .quad   0, 0x40445b3d07c84b5e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k521:
+    .quad   0, 0xc05280624dd2f1aa, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k522:
+    .quad   0, 0x4049c0f27bb2fec5, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k523:
+    .quad   0, 0xbfc05bc01a36e2eb, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k524:
+    .quad   0, 0x3fc81d88bf91f196, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k525:
+    .quad   0, 0x3fe6bd0258912f4a, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k526:
+    .quad   0, 0x3fecc4648875abaf, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k527:
+    .quad   0, 0x3ff4a17498a1f999, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k531:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k532:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k533:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k537:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k538:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k539:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k540:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k541:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k542:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k543:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k544:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k545:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_versine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_vercosine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_coversine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_covercosine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_irf3_0_k7(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f3_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f3_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f3_2
+.Lxly_f3_1:
+    call    xly_add
+.Lxly_f3_2:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf3_0_k7:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_haversine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_havercosine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_hacovercosine:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -124(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_irf6_0_k9(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f6_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f6_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f6_2
+.Lxly_f6_1:
+    call    xly_add
+.Lxly_f6_2:
+    movq    %rax, %r12
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf6_0_k9:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_exsecant:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_excosecant:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_sin
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_haversineDistance:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $144, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %r8, -80(%rbp)
+    movabsq $0x3f91df46a2529d39, %rax
+    movq    %rax, %r15
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    %r15, %xmm0
+    movq    -104(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+.Lxly_irf9_0_b3:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf9_0_b2:
+    movq    -88(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+    movq    -96(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, -120(%rbp)
+    movq    -112(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -120(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_irf9_0_b5:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_cos
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -136(%rbp)
+    movq    -136(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_irf9_0_b4:
+    movq    %r12, %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %rbx, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_asin
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    -80(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_indicator:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setae   %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f10_2
+.Lxly_f10_1:
+    call    xly_gte
+.Lxly_f10_2:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf10_0_b7
+.Lxly_irf10_0_b3:
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f10_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f10_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_f10_4
+.Lxly_f10_3:
+    call    xly_lte
+.Lxly_f10_4:
+    movq    %rax, %r12
+    movq    %r12, %r13
+    jmp     .Lxly_irf10_0_b4
+.Lxly_irf10_0_b7:
+    movq    %r14, %r13
+.Lxly_irf10_0_b4:
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf10_0_b2
+.Lxly_irf10_0_b1:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf10_0_k18(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf10_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf10_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf10_0_k18:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf10_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_sigma:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $112, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    movq    %r12, %r15
+.Lxly_irf11_0_b1:
+    movq    %r14, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -56(%rbp)
+    cmpq    $0, -56(%rbp)
+    je      .Lxly_irf11_0_b3
+.Lxly_irf11_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -72(%rbp)
+    cmpq    $0, -72(%rbp)
+    je      .Lxly_irf11_0_b7
+.Lxly_irf11_0_b4:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rax
+    movq    %rax, -88(%rbp)
+    jmp     .Lxly_irf11_0_b5
+.Lxly_irf11_0_b7:
+    movq    %r15, -88(%rbp)
+.Lxly_irf11_0_b5:
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %r14
+    movq    -88(%rbp), %r15
+    jmp     .Lxly_irf11_0_b1
+.Lxly_irf11_0_b3:
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_isPerfect:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $112, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+.Lxly_irf12_0_b3:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r13, %r14
+    movq    %r12, %r15
+.Lxly_irf12_0_b4:
+    movq    %r14, %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -56(%rbp)
+    cmpq    $0, -56(%rbp)
+    je      .Lxly_irf12_0_b8
+.Lxly_irf12_0_b5:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, -64(%rbp)
+    movq    %r12, %xmm0
+    movq    -64(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, -72(%rbp)
+    cmpq    $0, -72(%rbp)
+    je      .Lxly_irf12_0_b9
+.Lxly_irf12_0_b6:
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rax
+    movq    %rax, -88(%rbp)
+    jmp     .Lxly_irf12_0_b7
+.Lxly_irf12_0_b9:
+    movq    %r15, -88(%rbp)
+.Lxly_irf12_0_b7:
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %r14
+    movq    -88(%rbp), %r15
+    jmp     .Lxly_irf12_0_b4
+.Lxly_irf12_0_b8:
+.Lxly_irf12_0_b2:
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_liouville:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $144, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_irf13_0_k57(%rip), %rax
+    movq    %rax, %r13
+    movq    -48(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f13_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f13_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f13_2
+.Lxly_f13_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f13_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf13_0_b2
+.Lxly_irf13_0_b1:
+    leaq    .Lxly_irf13_0_k58(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf13_0_b2:
+    movabsq $0x0, %rax
+    movq    %rax, -64(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %r15
+    movq    -48(%rbp), %rax
+    movq    %rax, -80(%rbp)
+    movq    -64(%rbp), %rax
+    movq    %rax, -88(%rbp)
+.Lxly_irf13_0_b4:
+    movq    %r15, %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    movq    -96(%rbp), %xmm0
+    movq    -80(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -104(%rbp)
+    cmpq    $0, -104(%rbp)
+    je      .Lxly_irf13_0_b6
+.Lxly_irf13_0_b5:
+    movq    -80(%rbp), %r14
+    movq    -88(%rbp), %rbx
+.Lxly_irf13_0_b7:
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    -64(%rbp), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf13_0_b9
+.Lxly_irf13_0_b8:
+    movq    %rbx, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %r14
+    movq    %r13, %rbx
+    jmp     .Lxly_irf13_0_b7
+.Lxly_irf13_0_b9:
+    movq    %r15, %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r15
+    movq    %r14, -80(%rbp)
+    movq    %rbx, -88(%rbp)
+    jmp     .Lxly_irf13_0_b4
+.Lxly_irf13_0_b6:
+    movq    -80(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -56(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf13_0_b16
+.Lxly_irf13_0_b10:
+    movq    -88(%rbp), %xmm0
+    movq    -56(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf13_0_b11
+.Lxly_irf13_0_b16:
+    movq    -88(%rbp), %r15
+.Lxly_irf13_0_b11:
+    movq    %r15, %xmm0
+    movq    -72(%rbp), %xmm1
+    call    fmod
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    -64(%rbp), %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf13_0_b13
+.Lxly_irf13_0_b12:
+    leaq    .Lxly_irf13_0_k60(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf13_0_b13:
+    movabsq $0xbff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf13_0_k61(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf13_0_k57:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf13_0_k58:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf13_0_k60:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf13_0_k61:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_99dcab56bbaf8eff:
+    .asciz  "=== Specialized Math Functions ==="
+.Lxly_str_fabf74b28d71fe3c:
+    .asciz  "1. Versed Trigonometric Functions"
+.Lxly_str_7b46c4aa9907fd38:
+    .asciz  "versine(0):"
+.Lxly_str_d0ed88d9ac009258:
+    .asciz  "versine(PI/2):"
+.Lxly_str_98ad0ec251a3a3c1:
+    .asciz  "versine(PI):"
+.Lxly_str_2e2df3f30101b666:
+    .asciz  "vercosine(0):"
+.Lxly_str_ada8721360777b5a:
+    .asciz  "vercosine(PI/2):"
+.Lxly_str_a489209bd430e178:
+    .asciz  "covercosine(0):"
+.Lxly_str_85ec0dd27efe6f81:
+    .asciz  "covercosine(PI):"
+.Lxly_str_48c8509af7faa9c7:
+    .asciz  "2. Half-Versed Functions"
+.Lxly_str_97001fbcce66a60d:
+    .asciz  "haversine(0):"
+.Lxly_str_233e3ba7630d5757:
+    .asciz  "haversine(PI/2):"
+.Lxly_str_12ca7fb3010ecd9a:
+    .asciz  "haversine(PI):"
+.Lxly_str_c2c841110c61cc33:
+    .asciz  "havercosine(0):"
+.Lxly_str_a9f1a94b20172d59:
+    .asciz  "havercosine(PI/2):"
+.Lxly_str_25d85064a5f7be3d:
+    .asciz  "hacovercosine(0):"
+.Lxly_str_08ec7ce3d8f7c06a:
+    .asciz  "hacovercosine(PI):"
+.Lxly_str_d3d7922cf1d90396:
+    .asciz  "3. Exsecant Functions"
+.Lxly_str_e77197a489763ae5:
+    .asciz  "exsecant(0):"
+.Lxly_str_6869314a0fa79228:
+    .asciz  "exsecant(PI/3):"
+.Lxly_str_6ce8b462fcb87add:
+    .asciz  "excosecant(PI/2):"
+.Lxly_str_9067d0631110b7d9:
+    .asciz  "excosecant(PI/6):"
+.Lxly_str_17b69292f137d10f:
+    .asciz  "4. Great Circle Distance (Haversine Formula)"
+.Lxly_str_6a6363e59485a806:
+    .asciz  "NYC to London:"
+.Lxly_str_08be3b07b5626f85:
+    .asciz  "km"
+.Lxly_str_ef7643d0f943d815:
+    .asciz  "5. Indicator Function"
+.Lxly_str_116a46b223517855:
+    .asciz  "indicator(5, 0, 10):"
+.Lxly_str_26bfadda6885dc92:
+    .asciz  "indicator(15, 0, 10):"
+.Lxly_str_6fedf3f8e85fba2e:
+    .asciz  "indicator(-5, 0, 10):"
+.Lxly_str_102336a345c16b50:
+    .asciz  "6. Sigma Function (Sum of Divisors)"
+.Lxly_str_e9f2bb1b22988fa5:
+    .asciz  "sigma(6):"
+.Lxly_str_174fb3344871ff20:
+    .asciz  "sigma(12):"
+.Lxly_str_0ce02d3cced699dd:
+    .asciz  "sigma(28):"
+.Lxly_str_e7161e0d3952c4c2:
+    .asciz  "Perfect numbers:"
+.Lxly_str_873d951f25bb51e4:
+    .asciz  "6 is perfect:"
+.Lxly_str_adeb1c0592e2b4f6:
+    .asciz  "28 is perfect:"
+.Lxly_str_fedeeb643999aeab:
+    .asciz  "12 is perfect:"
+.Lxly_str_2928d1569660eb5c:
+    .asciz  "7. Liouville Lambda Function"
+.Lxly_str_b0a12c3c1c957196:
+    .asciz  "liouville(1):"
+.Lxly_str_959bb33c0cfc537b:
+    .asciz  "liouville(2):"
+.Lxly_str_c994a93c2a6c6d79:
+    .asciz  "liouville(4):"
+.Lxly_str_b9515f3c21831497:
+    .asciz  "liouville(6):"
+.Lxly_str_62b2c53bf0737a45:
+    .asciz  "liouville(8):"
+.Lxly_str_92e4acb078558aff:
+    .asciz  "=== Summary ==="
+.Lxly_str_4ecfb809808fdaa7:
+    .asciz  "Specialized Functions Demonstrated:"
+.Lxly_str_fcc2d2da1de05428:
+    .asciz  "  \342\200\242 Versed: versine, vercosine, coversine, covercosine"
+.Lxly_str_63e4b7b34b3f7b9f:
+    .asciz  "  \342\200\242 Half-versed: haversine, havercosine, hacovercosine"
+.Lxly_str_d5b71bbe58b80b26:
+    .asciz  "  \342\200\242 Exsecant: exsecant, excosecant"
+.Lxly_str_1edf0e774eaf3168:
+    .asciz  "  \342\200\242 Number Theory: indicator, sigma, liouville"
+.Lxly_str_1514b4f096240208:
+    .asciz  "Applications:"
+.Lxly_str_5a41e14e2f747102:
+    .asciz  "  \342\200\242 Navigation (great circle distance)"
+.Lxly_str_f0b00a88d95f1114:
+    .asciz  "  \342\200\242 Perfect number detection"
+.Lxly_str_e11e09104a74db0f:
+    .asciz  "  \342\200\242 Prime factor analysis"
+.Lxly_str_f1de3f2c2c2d8fad:
+    .asciz  "  \342\200\242 Set membership testing"
+.Lxly_str_2fa2a99c0d140135:
+    .asciz  "Total Math Functions: 125+"
+.Lxly_str_ac8ab13c6c6eb524:
+    .asciz  "Compile for speed:"
+.Lxly_str_6e80f9d17f73425d:
+    .asciz  "  ./xenlyc -O3 specialized.xe -o specialized"
+.Lxly_str_69c5c348960a23ef:
+    .asciz  "  ./specialized  # 18x faster!"
+.Lxly_str_a212adb897a9d5b0:
+    .asciz  "=== Complete ==="
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   11
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   88
@@ -0,0 +1,3272 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $1984, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_fb1911dec3add28c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f192ab112e858bf8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c9c3d54173a8b144(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_99cda945db0ac6cb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_16cff1bdf35eda99(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x400921fb54442d18, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k473(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7be8e00ce857c3bf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4005bf0a8b145769, %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir0_k474(%rip), %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c80732787e5a2a00(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_ir0_k475(%rip), %rax
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6e87beeec7201dd4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+    movabsq $0x4090000000000000, %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k476(%rip), %rax
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5fe152eb0ddd7667(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k477(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_51af15030d1a83f3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movabsq $0xbff0000000000000, %rax
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_ir0_k478(%rip), %rax
+    movq    %rax, -184(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d30497efe04c2208(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k479(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_933c604aa6485cfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k480(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a84cbe6271de6285(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k481(%rip), %rax
+    movq    %rax, -240(%rbp)
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d2fa92d642c56dab(%rip), %rdi
+    call    xly_str
+    movq    %rax, -248(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_ir0_k482(%rip), %rax
+    movq    %rax, -264(%rbp)
+    subq    $16, %rsp
+    movq    -248(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_165fc164fc71e679(%rip), %rdi
+    call    xly_str
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_ir0_k483(%rip), %rax
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_17b20583f1c94ea3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k484(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_191164a8053c391f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k485(%rip), %rax
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3189e046924aa2d9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -320(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k486(%rip), %rax
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    -320(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_619f00d2812b0ef5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -336(%rbp)
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_ir0_k487(%rip), %rax
+    movq    %rax, -352(%rbp)
+    subq    $16, %rsp
+    movq    -336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7141cf3743893b8f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    leaq    .Lxly_ir0_k488(%rip), %rax
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4e358212e3e0a007(%rip), %rdi
+    call    xly_str
+    movq    %rax, -376(%rbp)
+    leaq    .Lxly_ir0_k489(%rip), %rax
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -376(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -384(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b2a8c111fc3d5e3f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -392(%rbp)
+    leaq    .Lxly_ir0_k490(%rip), %rax
+    movq    %rax, -400(%rbp)
+    subq    $16, %rsp
+    movq    -392(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bfbc2928a566b2ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, -408(%rbp)
+    leaq    .Lxly_ir0_k491(%rip), %rax
+    movq    %rax, -416(%rbp)
+    subq    $16, %rsp
+    movq    -408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -416(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a81ca0585f637218(%rip), %rdi
+    call    xly_str
+    movq    %rax, -424(%rbp)
+    leaq    .Lxly_ir0_k492(%rip), %rax
+    movq    %rax, -432(%rbp)
+    subq    $16, %rsp
+    movq    -424(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -432(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4e581a3718e69403(%rip), %rdi
+    call    xly_str
+    movq    %rax, -440(%rbp)
+    movabsq $0x4008000000000001, %rax
+    movq    %rax, -448(%rbp)
+    leaq    .Lxly_ir0_k493(%rip), %rax
+    movq    %rax, -456(%rbp)
+    subq    $16, %rsp
+    movq    -440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -456(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2a7fb5ec45e43e80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -464(%rbp)
+    xorq    %rdi, %rdi
+    movl    $0, %esi
+    call    xly_math_NAN
+    movq    %rax, -472(%rbp)
+    subq    $16, %rsp
+    movq    -472(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_isNaN
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+    subq    $16, %rsp
+    movq    -464(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -480(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5244a522b3770f4c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -488(%rbp)
+    xorq    %rdi, %rdi
+    movl    $0, %esi
+    call    xly_math_INF
+    movq    %rax, -496(%rbp)
+    subq    $16, %rsp
+    movq    -496(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_math_isInf
+    addq    $16, %rsp
+    movq    %rax, -504(%rbp)
+    subq    $16, %rsp
+    movq    -488(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -504(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_146e9c1b6ab96c34(%rip), %rdi
+    call    xly_str
+    movq    %rax, -512(%rbp)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, -520(%rbp)
+    subq    $16, %rsp
+    movq    -512(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -520(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1841546fbc0f93d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -528(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -536(%rbp)
+    leaq    .Lxly_ir0_k494(%rip), %rax
+    movq    %rax, -544(%rbp)
+    leaq    .Lxly_ir0_k495(%rip), %rax
+    movq    %rax, -552(%rbp)
+    subq    $16, %rsp
+    movq    -544(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -552(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_math_randomInt
+    addq    $16, %rsp
+    movq    %rax, -560(%rbp)
+    subq    $16, %rsp
+    movq    -528(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -560(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e4a95af4bda83fdd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -568(%rbp)
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6e14c9f0e52ace2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -576(%rbp)
+    subq    $16, %rsp
+    movq    -576(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_101bf7b37472d79c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -584(%rbp)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -592(%rbp)
+    subq    $16, %rsp
+    movq    -584(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -592(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8364060d2a4160cd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -600(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_upper
+    addq    $16, %rsp
+    movq    %rax, -608(%rbp)
+    subq    $16, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -608(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_573263e4a2fecb2e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -616(%rbp)
+    leaq    .Lxly_str_2331e7d0487ca953(%rip), %rdi
+    call    xly_str
+    movq    %rax, -624(%rbp)
+    subq    $16, %rsp
+    movq    -624(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_lower
+    addq    $16, %rsp
+    movq    %rax, -632(%rbp)
+    subq    $16, %rsp
+    movq    -616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -632(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_20e6a6d244b20127(%rip), %rdi
+    call    xly_str
+    movq    %rax, -640(%rbp)
+    leaq    .Lxly_str_c2e8f718f04d1cf8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -648(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -648(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_contains
+    addq    $16, %rsp
+    movq    %rax, -656(%rbp)
+    subq    $16, %rsp
+    movq    -640(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -656(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_98b0ce045f56994f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -664(%rbp)
+    leaq    .Lxly_str_08ba5307b55eaf76(%rip), %rdi
+    call    xly_str
+    movq    %rax, -672(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -672(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_startsWith
+    addq    $16, %rsp
+    movq    %rax, -680(%rbp)
+    subq    $16, %rsp
+    movq    -664(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -680(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_035bda5f9e07da5e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -688(%rbp)
+    leaq    .Lxly_str_08ad3907b553f8ec(%rip), %rdi
+    call    xly_str
+    movq    %rax, -696(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -696(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_endsWith
+    addq    $16, %rsp
+    movq    %rax, -704(%rbp)
+    subq    $16, %rsp
+    movq    -688(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -704(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c78689f322171762(%rip), %rdi
+    call    xly_str
+    movq    %rax, -712(%rbp)
+    leaq    .Lxly_str_08ad3c07b553fe05(%rip), %rdi
+    call    xly_str
+    movq    %rax, -720(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -720(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_indexOf
+    addq    $16, %rsp
+    movq    %rax, -728(%rbp)
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -728(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c29f099ab8dfb0b9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -736(%rbp)
+    leaq    .Lxly_str_fc1ea983ee0d5489(%rip), %rdi
+    call    xly_str
+    movq    %rax, -744(%rbp)
+    leaq    .Lxly_str_089c4407b545986a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -752(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -752(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_lastIndexOf
+    addq    $16, %rsp
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    -736(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -760(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5a435d62a5d11805(%rip), %rdi
+    call    xly_str
+    movq    %rax, -768(%rbp)
+    leaq    .Lxly_ir0_k496(%rip), %rax
+    movq    %rax, -776(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -776(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_charAt
+    addq    $16, %rsp
+    movq    %rax, -784(%rbp)
+    subq    $16, %rsp
+    movq    -768(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -784(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0d95a11ae701c60c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -792(%rbp)
+    leaq    .Lxly_str_af63fc4c860222ec(%rip), %rdi
+    call    xly_str
+    movq    %rax, -800(%rbp)
+    leaq    .Lxly_ir0_k497(%rip), %rax
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    -800(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -808(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_charCodeAt
+    addq    $16, %rsp
+    movq    %rax, -816(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -816(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_66192f16660a9207(%rip), %rdi
+    call    xly_str
+    movq    %rax, -824(%rbp)
+    movabsq $0x4050400000000000, %rax
+    movq    %rax, -832(%rbp)
+    leaq    .Lxly_ir0_k498(%rip), %rax
+    movq    %rax, -840(%rbp)
+    subq    $16, %rsp
+    movq    -840(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_fromCharCode
+    addq    $16, %rsp
+    movq    %rax, -848(%rbp)
+    subq    $16, %rsp
+    movq    -824(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -848(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5d6f59e451773186(%rip), %rdi
+    call    xly_str
+    movq    %rax, -856(%rbp)
+    leaq    .Lxly_ir0_k499(%rip), %rax
+    movq    %rax, -864(%rbp)
+    subq    $16, %rsp
+    movq    -752(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_repeat
+    addq    $16, %rsp
+    movq    %rax, -872(%rbp)
+    subq    $16, %rsp
+    movq    -856(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -872(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_89a4eead5106384b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -880(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_reverse
+    addq    $16, %rsp
+    movq    %rax, -888(%rbp)
+    subq    $16, %rsp
+    movq    -880(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -888(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7f21937198feafa6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -896(%rbp)
+    leaq    .Lxly_str_2375dae7b81eb332(%rip), %rdi
+    call    xly_str
+    movq    %rax, -904(%rbp)
+    subq    $16, %rsp
+    movq    -904(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_trim
+    addq    $16, %rsp
+    movq    %rax, -912(%rbp)
+    subq    $16, %rsp
+    movq    -896(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -912(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2a7652781251c420(%rip), %rdi
+    call    xly_str
+    movq    %rax, -920(%rbp)
+    leaq    .Lxly_str_373ebc7438e9b162(%rip), %rdi
+    call    xly_str
+    movq    %rax, -928(%rbp)
+    subq    $16, %rsp
+    movq    -928(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_trimStart
+    addq    $16, %rsp
+    movq    %rax, -936(%rbp)
+    subq    $16, %rsp
+    movq    -920(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -936(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d54f4fe0954ef395(%rip), %rdi
+    call    xly_str
+    movq    %rax, -944(%rbp)
+    leaq    .Lxly_str_743034cc9be8476a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -952(%rbp)
+    subq    $16, %rsp
+    movq    -952(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_trimEnd
+    addq    $16, %rsp
+    movq    %rax, -960(%rbp)
+    subq    $16, %rsp
+    movq    -944(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -960(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_89710e5945b06f72(%rip), %rdi
+    call    xly_str
+    movq    %rax, -968(%rbp)
+    leaq    .Lxly_str_9374d957382ac69f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -976(%rbp)
+    leaq    .Lxly_str_af64154c86024d67(%rip), %rdi
+    call    xly_str
+    movq    %rax, -984(%rbp)
+    leaq    .Lxly_str_af63a04c86018698(%rip), %rdi
+    call    xly_str
+    movq    %rax, -992(%rbp)
+    subq    $32, %rsp
+    movq    -976(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -984(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -992(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_replace
+    addq    $32, %rsp
+    movq    %rax, -1000(%rbp)
+    subq    $16, %rsp
+    movq    -968(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1000(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2f92e72e63ffb402(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1008(%rbp)
+    leaq    .Lxly_ir0_k500(%rip), %rax
+    movq    %rax, -1016(%rbp)
+    leaq    .Lxly_ir0_k501(%rip), %rax
+    movq    %rax, -1024(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1016(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1024(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_substr
+    addq    $32, %rsp
+    movq    %rax, -1032(%rbp)
+    subq    $16, %rsp
+    movq    -1008(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1032(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_95c208c2d5fc5cba(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1040(%rbp)
+    leaq    .Lxly_ir0_k502(%rip), %rax
+    movq    %rax, -1048(%rbp)
+    leaq    .Lxly_ir0_k503(%rip), %rax
+    movq    %rax, -1056(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1048(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1056(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_slice
+    addq    $32, %rsp
+    movq    %rax, -1064(%rbp)
+    subq    $16, %rsp
+    movq    -1040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1064(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_96b6ff3b15e0af91(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1072(%rbp)
+    movabsq $0xc008000000000000, %rax
+    movq    %rax, -1080(%rbp)
+    leaq    .Lxly_ir0_k504(%rip), %rax
+    movq    %rax, -1088(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1088(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_slice
+    addq    $16, %rsp
+    movq    %rax, -1096(%rbp)
+    subq    $16, %rsp
+    movq    -1072(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1096(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1339ae7edba8b1cd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1104(%rbp)
+    leaq    .Lxly_str_07ee7e07b4b19223(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1112(%rbp)
+    leaq    .Lxly_str_af63ad4c86019caf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1120(%rbp)
+    leaq    .Lxly_ir0_k505(%rip), %rax
+    movq    %rax, -1128(%rbp)
+    subq    $32, %rsp
+    movq    -1112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1120(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_padStart
+    addq    $32, %rsp
+    movq    %rax, -1136(%rbp)
+    subq    $16, %rsp
+    movq    -1104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f2d2ed8cd97c6690(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1144(%rbp)
+    leaq    .Lxly_str_08ba5f07b55ec3da(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1152(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -1160(%rbp)
+    leaq    .Lxly_str_af63a34c86018bb1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1168(%rbp)
+    leaq    .Lxly_ir0_k506(%rip), %rax
+    movq    %rax, -1176(%rbp)
+    subq    $32, %rsp
+    movq    -1152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1168(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_string_padEnd
+    addq    $32, %rsp
+    movq    %rax, -1184(%rbp)
+    subq    $16, %rsp
+    movq    -1144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7da64a4c5d8831cf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1192(%rbp)
+    leaq    .Lxly_str_af63a14c8601884b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1200(%rbp)
+    subq    $16, %rsp
+    movq    -1192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1200(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_split
+    addq    $16, %rsp
+    movq    %rax, -1208(%rbp)
+    movq    -1208(%rbp), %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_3499e9e3ecf0d005(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1216(%rbp)
+    subq    $16, %rsp
+    movq    -1216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5a8d7442c0019be2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1224(%rbp)
+    subq    $16, %rsp
+    movq    -1208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -992(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_string_join
+    addq    $16, %rsp
+    movq    %rax, -1232(%rbp)
+    subq    $16, %rsp
+    movq    -1224(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1232(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0c76e6fdc23d5354(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1240(%rbp)
+    subq    $16, %rsp
+    movq    -1240(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k507(%rip), %rax
+    movq    %rax, -1248(%rbp)
+    leaq    .Lxly_ir0_k508(%rip), %rax
+    movq    %rax, -1256(%rbp)
+    subq    $16, %rsp
+    movq    -1248(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1264(%rbp)
+    movq    -1264(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_6a5bd488da85f1f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1272(%rbp)
+    subq    $16, %rsp
+    movq    -1272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, -1280(%rbp)
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -1288(%rbp)
+    movabsq $0x4044000000000000, %rax
+    movq    %rax, -1296(%rbp)
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -1304(%rbp)
+    leaq    .Lxly_ir0_k509(%rip), %rax
+    movq    %rax, -1312(%rbp)
+    leaq    .Lxly_ir0_k510(%rip), %rax
+    movq    %rax, -1320(%rbp)
+    leaq    .Lxly_ir0_k511(%rip), %rax
+    movq    %rax, -1328(%rbp)
+    leaq    .Lxly_ir0_k512(%rip), %rax
+    movq    %rax, -1336(%rbp)
+    leaq    .Lxly_ir0_k513(%rip), %rax
+    movq    %rax, -1344(%rbp)
+    subq    $48, %rsp
+    movq    -1312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1320(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1328(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -1336(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -1344(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_7f191754e24cb4f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1352(%rbp)
+    subq    $16, %rsp
+    movq    -1352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2b4e64a4775fd003(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1360(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1368(%rbp)
+    subq    $16, %rsp
+    movq    -1360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7632f28512cb7cfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1376(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k514(%rip), %rax
+    movq    %rax, -1384(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1384(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1392(%rbp)
+    subq    $16, %rsp
+    movq    -1376(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1392(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4058c00000000000, %rax
+    movq    %rax, -1400(%rbp)
+    leaq    .Lxly_ir0_k515(%rip), %rax
+    movq    %rax, -1408(%rbp)
+    leaq    .Lxly_ir0_k516(%rip), %rax
+    movq    %rax, -1416(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1408(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1416(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -1424(%rbp)
+    leaq    .Lxly_str_52f200ed9d7e7ea5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1432(%rbp)
+    subq    $16, %rsp
+    movq    -1432(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, -1440(%rbp)
+    leaq    .Lxly_ir0_k517(%rip), %rax
+    movq    %rax, -1448(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1448(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1456(%rbp)
+    leaq    .Lxly_str_f28b9e0db3a2ee55(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1464(%rbp)
+    subq    $16, %rsp
+    movq    -1464(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_779b5819564f2f50(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1472(%rbp)
+    movq    -1472(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_0ff2a433dc9ef2f4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1480(%rbp)
+    leaq    .Lxly_str_d682a65ea27f8d79(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1488(%rbp)
+    subq    $32, %rsp
+    movq    -1480(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1472(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1488(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_297a5749140ac887(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1496(%rbp)
+    movq    -1496(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_7ca2038ad5d6c213(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1504(%rbp)
+    subq    $32, %rsp
+    movq    -1504(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1496(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1488(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_ir0_k518(%rip), %rax
+    movq    %rax, -1512(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1512(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_ceda7fef727d8722(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1520(%rbp)
+    leaq    .Lxly_str_ba59d120464f5907(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1528(%rbp)
+    subq    $16, %rsp
+    movq    -1528(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6a8018d2dfa6cff6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1536(%rbp)
+    leaq    .Lxly_ir0_k519(%rip), %rax
+    movq    %rax, -1544(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1544(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_4e585eeea351a038(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1552(%rbp)
+    subq    $16, %rsp
+    movq    -1536(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1552(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cd049af1151ae824(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1560(%rbp)
+    leaq    .Lxly_ir0_k520(%rip), %rax
+    movq    %rax, -1568(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1568(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_9b44b92353fcc11e(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1576(%rbp)
+    subq    $16, %rsp
+    movq    -1560(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1576(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2e3b646dfcd89153(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1584(%rbp)
+    movabsq $0x4088480000000000, %rax
+    movq    %rax, -1592(%rbp)
+    leaq    .Lxly_ir0_k521(%rip), %rax
+    movq    %rax, -1600(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1600(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_9b44b92353fcc11e(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1608(%rbp)
+    subq    $16, %rsp
+    movq    -1584(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1608(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_68323f0fc48e312e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1616(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_c95b3c1f3263ab65(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1624(%rbp)
+    subq    $16, %rsp
+    movq    -1616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1624(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_501bf92f9c2c2de9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1632(%rbp)
+    leaq    .Lxly_ir0_k522(%rip), %rax
+    movq    %rax, -1640(%rbp)
+    leaq    .Lxly_ir0_k523(%rip), %rax
+    movq    %rax, -1648(%rbp)
+    subq    $32, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1640(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1648(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4a6e26ba7a1d8b1(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -1656(%rbp)
+    subq    $16, %rsp
+    movq    -1632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1656(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4069000000000000, %rax
+    movq    %rax, -1664(%rbp)
+    leaq    .Lxly_ir0_k524(%rip), %rax
+    movq    %rax, -1672(%rbp)
+    leaq    .Lxly_ir0_k525(%rip), %rax
+    movq    %rax, -1680(%rbp)
+    subq    $16, %rsp
+    movq    -1672(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1680(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1688(%rbp)
+    movq    -1688(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_d3c43c42c1aedd26(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1696(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1688(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_4c9fba75ae0b9f5d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1704(%rbp)
+    subq    $16, %rsp
+    movq    -1696(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1704(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -1712(%rbp)
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -1720(%rbp)
+    leaq    .Lxly_ir0_k526(%rip), %rax
+    movq    %rax, -1728(%rbp)
+    leaq    .Lxly_ir0_k527(%rip), %rax
+    movq    %rax, -1736(%rbp)
+    leaq    .Lxly_ir0_k528(%rip), %rax
+    movq    %rax, -1744(%rbp)
+    leaq    .Lxly_ir0_k529(%rip), %rax
+    movq    %rax, -1752(%rbp)
+    leaq    .Lxly_ir0_k530(%rip), %rax
+    movq    %rax, -1760(%rbp)
+    leaq    .Lxly_ir0_k531(%rip), %rax
+    movq    %rax, -1768(%rbp)
+    subq    $48, %rsp
+    movq    -1728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1736(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1744(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -1752(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -1760(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -1768(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $6, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_71d552cd40f0abc2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1776(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_5feded18f07e3c11(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1784(%rbp)
+    subq    $16, %rsp
+    movq    -1776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1784(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6ffeb0a521002673(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1792(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_24f59cca069a779c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1800(%rbp)
+    subq    $16, %rsp
+    movq    -1792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1800(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k532(%rip), %rax
+    movq    %rax, -1808(%rbp)
+    leaq    .Lxly_ir0_k533(%rip), %rax
+    movq    %rax, -1816(%rbp)
+    leaq    .Lxly_ir0_k534(%rip), %rax
+    movq    %rax, -1824(%rbp)
+    leaq    .Lxly_ir0_k535(%rip), %rax
+    movq    %rax, -1832(%rbp)
+    leaq    .Lxly_ir0_k536(%rip), %rax
+    movq    %rax, -1840(%rbp)
+    leaq    .Lxly_ir0_k537(%rip), %rax
+    movq    %rax, -1848(%rbp)
+    leaq    .Lxly_ir0_k538(%rip), %rax
+    movq    %rax, -1856(%rbp)
+    subq    $64, %rsp
+    movq    -1808(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1816(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1824(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -1832(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -1840(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -1848(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    -1856(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $7, %ecx
+    call    xly_call_module
+    addq    $64, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_4402563261657e15(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1864(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_e4bb2490fb5c8386(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1872(%rbp)
+    subq    $16, %rsp
+    movq    -1864(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1872(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k539(%rip), %rax
+    movq    %rax, -1880(%rbp)
+    leaq    .Lxly_ir0_k540(%rip), %rax
+    movq    %rax, -1888(%rbp)
+    leaq    .Lxly_ir0_k541(%rip), %rax
+    movq    %rax, -1896(%rbp)
+    subq    $32, %rsp
+    movq    -1880(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1888(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1896(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_9adba4640138bf99(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1904(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_20aee769adb11329(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1912(%rbp)
+    subq    $16, %rsp
+    movq    -1904(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1912(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3ead32ba661248d7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k542(%rip), %rax
+    movq    %rax, -1920(%rbp)
+    subq    $16, %rsp
+    movq    -1920(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_526eb811b28d5cb2(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_927da30a14e54c13(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k543(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k544(%rip), %rax
+    movq    %rax, -1928(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1928(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_526eb811b28d5cb2(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1936(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1936(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_19256a7bc12f107b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k545(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k546(%rip), %rax
+    movq    %rax, -1944(%rbp)
+    leaq    .Lxly_ir0_k547(%rip), %rax
+    movq    %rax, -1952(%rbp)
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1944(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1952(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_526eb811b28d5cb2(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -1960(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1960(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k548(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k549(%rip), %rax
+    movq    %rax, -1968(%rbp)
+    leaq    .Lxly_ir0_k550(%rip), %rax
+    movq    %rax, -1976(%rbp)
+    leaq    .Lxly_ir0_k551(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k552(%rip), %rax
+    movq    %rax, -1984(%rbp)
+    subq    $48, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1968(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -1976(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    -1984(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_08b06007b5567108(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_c21aded1f2b89397(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_82719e195d0fc4a8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fdd519beca4244f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_07f4431917564077(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_17e55b7d497d6d9a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_080f5119176d1ff9(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b3db4f7072a2c4b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -992(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k553(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k554(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_ir0_k555(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_aad01878f02a7608(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_b903c57b3dd821eb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b0e7d199de3b12e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_978ca72f55e676d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_1e5485ef2e9f9384(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0936d3aed514e289(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_9e8c579513934bbd(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e10189ea49d36ac5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_f5b31b190cbba161(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d5fc6f65ec6c15f9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_17dd2e194f31d276(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_c2f01118f05367d4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_ea3387071a6bf4c8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ff8b1fa4f80044c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9ae8da6925d41917(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -1112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_68d0d9eb0487b115(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d097b91e10f4a395(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_2eb1c202248cb361(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_68d0d9eb0487b115(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2bee561731256b75(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k556(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_52e9dcaef415515c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_67f995c4a7ee061f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x405ec00000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k557(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_c5c8cdb28370e485(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9759fe8019a1e240(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k558(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_52e9dcaef415515c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2602068866082cd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k559(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_52e9dcaef415515c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8c7a7f828f43f754(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_52e9dcaef415515c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_83985dc3bcada883(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -1152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_52e9dcaef415515c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_53250de39ad20c32(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k560(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_b78e02519d37ac70(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_33e094cea13bf8c4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63f54c86021707(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_ea3387071a6bf4c8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4a0f4ab9d156c28d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -520(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_a534dd306e476d4d(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e7d276425693ae37(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_1e71ad4e5d18f8d4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6678f955de6c88af(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k561(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_526eb811b28d5cb2(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_e77a2fed60c60d36(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_61a22ef1eeb9e592(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k562(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_6971003f4c928aa0(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_dffdf87d9c34b58f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    -1152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_6971003f4c928aa0(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9e17fb0ec5b4d30c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -520(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_6971003f4c928aa0(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d1720bbac8d414db(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_a79439ef7bfa9c2d(%rip), %rdi
+    leaq    .Lxly_str_6971003f4c928aa0(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6c8ee73e21b838af(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k473:
+    .quad   0, 0x400921fb54442d18, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k474:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k475:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k476:
+    .quad   0, 0x4090000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k477:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k478:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k479:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k480:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k481:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k482:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k483:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k484:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k485:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k486:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k487:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k488:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k489:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k490:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k491:
+    .quad   0, 0x4005bf0a8b145769, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k492:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k493:
+    .quad   0, 0x4008000000000001, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k494:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k495:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k496:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k497:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k498:
+    .quad   0, 0x4050400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k499:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k500:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k501:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k502:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k503:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k504:
+    .quad   0, 0xc008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k505:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k506:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k507:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k508:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k509:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k510:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k511:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k512:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k513:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k514:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k515:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k516:
+    .quad   0, 0x4058c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k517:
+    .quad   0, 0x404e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k518:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k519:
+    .quad   0, 0x4058c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k520:
+    .quad   0, 0x4058c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k521:
+    .quad   0, 0x4088480000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k522:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k523:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k524:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k525:
+    .quad   0, 0x4069000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k526:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k527:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k528:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k529:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k530:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k531:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k532:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k533:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k534:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k535:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k536:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k537:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k538:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k539:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k540:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k541:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k542:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k543:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k544:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k545:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k546:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k547:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k548:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k549:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k550:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k551:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k552:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k553:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k554:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k555:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k556:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k557:
+    .quad   0, 0x405ec00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k558:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k559:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k560:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k561:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k562:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_fb1911dec3add28c:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_f192ab112e858bf8:
+    .asciz  "\342\225\221         Xenly Core Standard Library                  \342\225\221"
+.Lxly_str_c9c3d54173a8b144:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_99cda945db0ac6cb:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200 math \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_16cff1bdf35eda99:
+    .asciz  "  PI ="
+.Lxly_str_7be8e00ce857c3bf:
+    .asciz  "  E  ="
+.Lxly_str_c80732787e5a2a00:
+    .asciz  "  sqrt(144) ="
+.Lxly_str_6e87beeec7201dd4:
+    .asciz  "  pow(2,10) ="
+.Lxly_str_5fe152eb0ddd7667:
+    .asciz  "  abs(-7) ="
+.Lxly_str_51af15030d1a83f3:
+    .asciz  "  sign(-42) ="
+.Lxly_str_d30497efe04c2208:
+    .asciz  "  sign(0) ="
+.Lxly_str_933c604aa6485cfa:
+    .asciz  "  sign(99) ="
+.Lxly_str_a84cbe6271de6285:
+    .asciz  "  floor(3.7) ="
+.Lxly_str_d2fa92d642c56dab:
+    .asciz  "  ceil(3.2) ="
+.Lxly_str_165fc164fc71e679:
+    .asciz  "  round(3.5) ="
+.Lxly_str_17b20583f1c94ea3:
+    .asciz  "  trunc(3.9) ="
+.Lxly_str_191164a8053c391f:
+    .asciz  "  max(5,12) ="
+.Lxly_str_3189e046924aa2d9:
+    .asciz  "  min(5,12) ="
+.Lxly_str_619f00d2812b0ef5:
+    .asciz  "  clamp(15,0,10) ="
+.Lxly_str_7141cf3743893b8f:
+    .asciz  "  fmod(10,3) ="
+.Lxly_str_4e358212e3e0a007:
+    .asciz  "  log2(8) ="
+.Lxly_str_b2a8c111fc3d5e3f:
+    .asciz  "  log10(1000) ="
+.Lxly_str_bfbc2928a566b2ed:
+    .asciz  "  exp(1) ="
+.Lxly_str_a81ca0585f637218:
+    .asciz  "  hypot(3,4) ="
+.Lxly_str_4e581a3718e69403:
+    .asciz  "  cbrt(27) ="
+.Lxly_str_2a7fb5ec45e43e80:
+    .asciz  "  isNaN(math.NAN()) ="
+.Lxly_str_5244a522b3770f4c:
+    .asciz  "  isInf(math.INF()) ="
+.Lxly_str_146e9c1b6ab96c34:
+    .asciz  "  isFinite(42) ="
+.Lxly_str_1841546fbc0f93d0:
+    .asciz  "  randomInt(1,100):"
+.Lxly_str_e4a95af4bda83fdd:
+    .asciz  "\342\224\224\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\230"
+.Lxly_str_6e14c9f0e52ace2c:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200 string \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_101bf7b37472d79c:
+    .asciz  "  len(\"hello\") ="
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_8364060d2a4160cd:
+    .asciz  "  upper(\"hello\") ="
+.Lxly_str_573263e4a2fecb2e:
+    .asciz  "  lower(\"WORLD\") ="
+.Lxly_str_2331e7d0487ca953:
+    .asciz  "WORLD"
+.Lxly_str_20e6a6d244b20127:
+    .asciz  "  contains(\"hello\",\"ell\") ="
+.Lxly_str_c2e8f718f04d1cf8:
+    .asciz  "ell"
+.Lxly_str_98b0ce045f56994f:
+    .asciz  "  startsWith(\"hello\",\"he\") ="
+.Lxly_str_08ba5307b55eaf76:
+    .asciz  "he"
+.Lxly_str_035bda5f9e07da5e:
+    .asciz  "  endsWith(\"hello\",\"lo\") ="
+.Lxly_str_08ad3907b553f8ec:
+    .asciz  "lo"
+.Lxly_str_c78689f322171762:
+    .asciz  "  indexOf(\"hello\",\"ll\") ="
+.Lxly_str_08ad3c07b553fe05:
+    .asciz  "ll"
+.Lxly_str_c29f099ab8dfb0b9:
+    .asciz  "  lastIndexOf(\"abab\",\"ab\") ="
+.Lxly_str_fc1ea983ee0d5489:
+    .asciz  "abab"
+.Lxly_str_089c4407b545986a:
+    .asciz  "ab"
+.Lxly_str_5a435d62a5d11805:
+    .asciz  "  charAt(\"hello\",1) ="
+.Lxly_str_0d95a11ae701c60c:
+    .asciz  "  charCodeAt(\"A\",0) ="
+.Lxly_str_af63fc4c860222ec:
+    .asciz  "A"
+.Lxly_str_66192f16660a9207:
+    .asciz  "  fromCharCode(65) ="
+.Lxly_str_5d6f59e451773186:
+    .asciz  "  repeat(\"ab\",3) ="
+.Lxly_str_89a4eead5106384b:
+    .asciz  "  reverse(\"hello\") ="
+.Lxly_str_7f21937198feafa6:
+    .asciz  "  trim(\"  hi  \") ="
+.Lxly_str_2375dae7b81eb332:
+    .asciz  "  hi  "
+.Lxly_str_2a7652781251c420:
+    .asciz  "  trimStart(\"  hi\") ="
+.Lxly_str_373ebc7438e9b162:
+    .asciz  "  hi"
+.Lxly_str_d54f4fe0954ef395:
+    .asciz  "  trimEnd(\"hi  \") ="
+.Lxly_str_743034cc9be8476a:
+    .asciz  "hi  "
+.Lxly_str_89710e5945b06f72:
+    .asciz  "  replace(\"aXbXc\",\"X\",\"-\") ="
+.Lxly_str_9374d957382ac69f:
+    .asciz  "aXbXc"
+.Lxly_str_af64154c86024d67:
+    .asciz  "X"
+.Lxly_str_af63a04c86018698:
+    .asciz  "-"
+.Lxly_str_2f92e72e63ffb402:
+    .asciz  "  substr(\"hello\",1,3) ="
+.Lxly_str_95c208c2d5fc5cba:
+    .asciz  "  slice(\"hello\",1,4) ="
+.Lxly_str_96b6ff3b15e0af91:
+    .asciz  "  slice(\"hello\",-3) ="
+.Lxly_str_1339ae7edba8b1cd:
+    .asciz  "  padStart(\"42\",5,\"0\") ="
+.Lxly_str_07ee7e07b4b19223:
+    .asciz  "42"
+.Lxly_str_af63ad4c86019caf:
+    .asciz  "0"
+.Lxly_str_f2d2ed8cd97c6690:
+    .asciz  "  padEnd(\"hi\",6,\".\") ="
+.Lxly_str_08ba5f07b55ec3da:
+    .asciz  "hi"
+.Lxly_str_af63a34c86018bb1:
+    .asciz  "."
+.Lxly_str_7da64a4c5d8831cf:
+    .asciz  "a,b,c,d"
+.Lxly_str_af63a14c8601884b:
+    .asciz  ","
+.Lxly_str_3499e9e3ecf0d005:
+    .asciz  "  split(\"a,b,c,d\",\",\") ="
+.Lxly_str_5a8d7442c0019be2:
+    .asciz  "  join([a,b,c],\"-\") ="
+.Lxly_str_0c76e6fdc23d5354:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200 array \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_f74e5feadea773fd:
+    .asciz  "create"
+.Lxly_str_6a5bd488da85f1f2:
+    .asciz  "  create(5,0) ="
+.Lxly_str_08b06007b5567108:
+    .asciz  "of"
+.Lxly_str_7f191754e24cb4f0:
+    .asciz  "  of(10..50) ="
+.Lxly_str_2b4e64a4775fd003:
+    .asciz  "  len ="
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_7632f28512cb7cfa:
+    .asciz  "  get(nums,2) ="
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_823b87195ce20e23:
+    .asciz  "set"
+.Lxly_str_52f200ed9d7e7ea5:
+    .asciz  "  after set(2,99)="
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_f28b9e0db3a2ee55:
+    .asciz  "  after push(60) ="
+.Lxly_str_779b5819564f2f50:
+    .asciz  "pop"
+.Lxly_str_0ff2a433dc9ef2f4:
+    .asciz  "  pop() ="
+.Lxly_str_d682a65ea27f8d79:
+    .asciz  " arr="
+.Lxly_str_297a5749140ac887:
+    .asciz  "shift"
+.Lxly_str_7ca2038ad5d6c213:
+    .asciz  "  shift() ="
+.Lxly_str_ceda7fef727d8722:
+    .asciz  "unshift"
+.Lxly_str_ba59d120464f5907:
+    .asciz  "  unshift(5) ="
+.Lxly_str_6a8018d2dfa6cff6:
+    .asciz  "  contains(99) ="
+.Lxly_str_4e585eeea351a038:
+    .asciz  "contains"
+.Lxly_str_cd049af1151ae824:
+    .asciz  "  indexOf(99) ="
+.Lxly_str_9b44b92353fcc11e:
+    .asciz  "indexOf"
+.Lxly_str_2e3b646dfcd89153:
+    .asciz  "  indexOf(777) ="
+.Lxly_str_68323f0fc48e312e:
+    .asciz  "  reverse ="
+.Lxly_str_c95b3c1f3263ab65:
+    .asciz  "reverse"
+.Lxly_str_501bf92f9c2c2de9:
+    .asciz  "  slice(1,3) ="
+.Lxly_str_d4a6e26ba7a1d8b1:
+    .asciz  "slice"
+.Lxly_str_d3c43c42c1aedd26:
+    .asciz  "  concat ="
+.Lxly_str_4c9fba75ae0b9f5d:
+    .asciz  "concat"
+.Lxly_str_71d552cd40f0abc2:
+    .asciz  "  sort ="
+.Lxly_str_5feded18f07e3c11:
+    .asciz  "sort"
+.Lxly_str_6ffeb0a521002673:
+    .asciz  "  sortDesc ="
+.Lxly_str_24f59cca069a779c:
+    .asciz  "sortDesc"
+.Lxly_str_4402563261657e15:
+    .asciz  "  unique ="
+.Lxly_str_e4bb2490fb5c8386:
+    .asciz  "unique"
+.Lxly_str_9adba4640138bf99:
+    .asciz  "  flatten([1,2,3]) ="
+.Lxly_str_20aee769adb11329:
+    .asciz  "flatten"
+.Lxly_str_3ead32ba661248d7:
+    .asciz  "  range(5) ="
+.Lxly_str_526eb811b28d5cb2:
+    .asciz  "range"
+.Lxly_str_927da30a14e54c13:
+    .asciz  "  range(2,7) ="
+.Lxly_str_19256a7bc12f107b:
+    .asciz  "  range(0,10,2) ="
+.Lxly_str_c21aded1f2b89397:
+    .asciz  "  sum ="
+.Lxly_str_82719e195d0fc4a8:
+    .asciz  "sum"
+.Lxly_str_fdd519beca4244f0:
+    .asciz  "  min ="
+.Lxly_str_07f4431917564077:
+    .asciz  "min"
+.Lxly_str_17e55b7d497d6d9a:
+    .asciz  "  max ="
+.Lxly_str_080f5119176d1ff9:
+    .asciz  "max"
+.Lxly_str_b3db4f7072a2c4b4:
+    .asciz  "  join(\"-\") ="
+.Lxly_str_41def2de29651139:
+    .asciz  "join"
+.Lxly_str_aad01878f02a7608:
+    .asciz  "fill"
+.Lxly_str_b903c57b3dd821eb:
+    .asciz  "  fill(7) ="
+.Lxly_str_b0e7d199de3b12e3:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200 os \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_978ca72f55e676d0:
+    .asciz  "  time() ="
+.Lxly_str_08b05507b5565e57:
+    .asciz  "os"
+.Lxly_str_1e5485ef2e9f9384:
+    .asciz  "time"
+.Lxly_str_0936d3aed514e289:
+    .asciz  "  clock() ="
+.Lxly_str_9e8c579513934bbd:
+    .asciz  "clock"
+.Lxly_str_e10189ea49d36ac5:
+    .asciz  "  cwd() ="
+.Lxly_str_f5b31b190cbba161:
+    .asciz  "cwd"
+.Lxly_str_d5fc6f65ec6c15f9:
+    .asciz  "  env(PATH) exists ="
+.Lxly_str_17dd2e194f31d276:
+    .asciz  "PATH"
+.Lxly_str_c2f01118f05367d4:
+    .asciz  "env"
+.Lxly_str_a79439ef7bfa9c2d:
+    .asciz  "type"
+.Lxly_str_ea3387071a6bf4c8:
+    .asciz  "isString"
+.Lxly_str_ff8b1fa4f80044c5:
+    .asciz  "\342\224\214\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200 type \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\220"
+.Lxly_str_9ae8da6925d41917:
+    .asciz  "  toNumber(\"42\") ="
+.Lxly_str_68d0d9eb0487b115:
+    .asciz  "toNumber"
+.Lxly_str_d097b91e10f4a395:
+    .asciz  "  toNumber(\"3.14\") ="
+.Lxly_str_2eb1c202248cb361:
+    .asciz  "3.14"
+.Lxly_str_2bee561731256b75:
+    .asciz  "  toNumber(true) ="
+.Lxly_str_52e9dcaef415515c:
+    .asciz  "toBool"
+.Lxly_str_67f995c4a7ee061f:
+    .asciz  "  toString(123) ="
+.Lxly_str_c5c8cdb28370e485:
+    .asciz  "toString"
+.Lxly_str_9759fe8019a1e240:
+    .asciz  "  toBool(0) ="
+.Lxly_str_2602068866082cd1:
+    .asciz  "  toBool(1) ="
+.Lxly_str_8c7a7f828f43f754:
+    .asciz  "  toBool(\"\") ="
+.Lxly_str_83985dc3bcada883:
+    .asciz  "  toBool(\"hi\") ="
+.Lxly_str_53250de39ad20c32:
+    .asciz  "  isNumber(42) ="
+.Lxly_str_b78e02519d37ac70:
+    .asciz  "isNumber"
+.Lxly_str_33e094cea13bf8c4:
+    .asciz  "  isString(\"x\") ="
+.Lxly_str_af63f54c86021707:
+    .asciz  "x"
+.Lxly_str_4a0f4ab9d156c28d:
+    .asciz  "  isBool(true) ="
+.Lxly_str_a534dd306e476d4d:
+    .asciz  "isBool"
+.Lxly_str_e7d276425693ae37:
+    .asciz  "  isNull(null) ="
+.Lxly_str_1e71ad4e5d18f8d4:
+    .asciz  "isNull"
+.Lxly_str_6678f955de6c88af:
+    .asciz  "  isArray(range(3)) ="
+.Lxly_str_e77a2fed60c60d36:
+    .asciz  "isArray"
+.Lxly_str_61a22ef1eeb9e592:
+    .asciz  "  typeOf(42) ="
+.Lxly_str_6971003f4c928aa0:
+    .asciz  "typeOf"
+.Lxly_str_dffdf87d9c34b58f:
+    .asciz  "  typeOf(\"hi\") ="
+.Lxly_str_9e17fb0ec5b4d30c:
+    .asciz  "  typeOf(true) ="
+.Lxly_str_d1720bbac8d414db:
+    .asciz  "  typeOf(null) ="
+.Lxly_str_6c8ee73e21b838af:
+    .asciz  "\342\225\221         All stdlib modules working!                  \342\225\221"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   11
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   88
@@ -0,0 +1,1558 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $224, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_956156f2137d36c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_55a288305c60b642(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0c440002c9fec970(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_3e4bd4e31c5c3ad2(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1670eabdf30e3a30(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_fa53d71e58427c00(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e314851d85b73305(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_f5b31b190cbba161(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f248d373bb93b382(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_1e5485ef2e9f9384(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_213136695efa96f8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b53e24008c4c0f1d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_035415a79c6ebea3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_898951a9727f8ff9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_b8eaa574819a7ff8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_0d4b34396c844d0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_542672d09ff068dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_732d8bd38ff9851d(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3f302afbbf7eb6c3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_641d9cfa1a584ee4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cf21a225b64b7482(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_56c29a0c5c4f3d33(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f9cdcdcef4467583(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7f7de39c4bcebddb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_3b6ab99c24e17990(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_f47d9006c63b6697(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_c5b2a72c0845a253(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6b229121d64322bb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6ef05bd7cc857c54(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_a22c76d872a293a4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2d3440e1f5fafecd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_2e3d9ecc741a7811(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_be274c9b0588e868(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_46a9eab632329b7b(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_50cc5bf9d94270e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k270(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_3c29bcf8e69d8ba6(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0098c9adf973dc70(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_a8459529fb284912(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_676fce968531a93d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k271(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_c346f2a348f58ca1(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cb9fd46455575470(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_8c04c0e40aad86b2(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8d98e5f237af5ef5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_10683ff5438b23cd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_009c43511cef30bd(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4507d704517f9206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_58690466f5bafbe0(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_bd9c84db928e467c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_dd10afbc5c462a36(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_03d3c51b2cc97d7c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3f0304a76e1da0a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_021802b0f58e99e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_e0fa5901aa4a3801(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e0efd701aa410696(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0e2548cb8c2f41a6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_684da8c1031a301b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_79b6a9af7a07f29b(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9c758d78e3395157(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_ad90b24c904b7f0f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_beeb113db3ca7f08(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_c3120f18f0704ad4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7a570eb2d42d314f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_7e0910fa2901dccb(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e5628e7a7229a271(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2d7868fd77a47023(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e35fda07d6d86117(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_f531ec9544a8fc3e(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_41def2de29651139(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_5fdb7a8ac3147783(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_53fe79e2681ab7e0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1e29a1aeaa3c615a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k272(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cb3f7d70d387f576(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k273(%rip), %rax
+    movq    %rax, -120(%rbp)
+    movq    %r12, %rdi
+    movq    -120(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_da6e32233dad78ad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c5869ad7b68b73e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_c7ab01e6795dd305(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_52f8812e64b46c95(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_9a7ee83d1fee758b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    movq    -128(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_920751759e060d3c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_ad90b24c904b7f0f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_d82b955c53a17162(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_79b6a9af7a07f29b(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_4c7dfe070e60fb86(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_c3120f18f0704ad4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    subq    $48, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_ad90b24c904b7f0f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_79b6a9af7a07f29b(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -184(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_c3120f18f0704ad4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+    subq    $48, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+    subq    $16, %rsp
+    movq    -136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_ad90b24c904b7f0f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_79b6a9af7a07f29b(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_03c52d0debd70676(%rip), %rdi
+    leaq    .Lxly_str_c3120f18f0704ad4(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    subq    $48, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f5583e57892878a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6f6299b53eab5ad8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_6f62a0b53eab66bd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_0834c9e3a71d0cb8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_daf8aecbfe55a340(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_2e3d9ecc741a7811(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -208(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_083153e3a71a0e5f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_2e3d9ecc741a7811(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -216(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_980463f58671a46e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_2e3d9ecc741a7811(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_f342c7914fd0f990(%rip), %rdi
+    leaq    .Lxly_str_2e3d9ecc741a7811(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r15, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    movl    %eax, %edi
+    call    xly_bool
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_eq
+.Lxly_2:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_177e3ed3f4745a3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_3e4bd4e31c5c3ad2(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_2e0fa45042f8603d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5cad04a9f1a5d05d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_4:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b1:
+    leaq    .Lxly_str_61806400d7abeb4c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    jmp     .Lxly_ir0_b2
+.Lxly_ir0_b3:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b2:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_35f0d01c1cb405b7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_732d8bd38ff9851d(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_ir0_b5
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_ba64a1aeb70bfc69(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_77dfa1348bae30df(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b5:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8bec41e71d58847e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k270:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k271:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k272:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k273:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_956156f2137d36c9:
+    .asciz  "=== Xenly Standard Library Test ==="
+.Lxly_str_55a288305c60b642:
+    .asciz  "1. OS Module:"
+.Lxly_str_0c440002c9fec970:
+    .asciz  "  Platform:"
+.Lxly_str_08b05507b5565e57:
+    .asciz  "os"
+.Lxly_str_3e4bd4e31c5c3ad2:
+    .asciz  "platform"
+.Lxly_str_1670eabdf30e3a30:
+    .asciz  "  PID:"
+.Lxly_str_fa53d71e58427c00:
+    .asciz  "getpid"
+.Lxly_str_e314851d85b73305:
+    .asciz  "  Current dir:"
+.Lxly_str_f5b31b190cbba161:
+    .asciz  "cwd"
+.Lxly_str_f248d373bb93b382:
+    .asciz  "  Time:"
+.Lxly_str_1e5485ef2e9f9384:
+    .asciz  "time"
+.Lxly_str_213136695efa96f8:
+    .asciz  "2. Filesystem Operations:"
+.Lxly_str_b53e24008c4c0f1d:
+    .asciz  "/tmp/xenly_test"
+.Lxly_str_035415a79c6ebea3:
+    .asciz  "test.txt"
+.Lxly_str_03c52d0debd70676:
+    .asciz  "path"
+.Lxly_str_41def2de29651139:
+    .asciz  "join"
+.Lxly_str_898951a9727f8ff9:
+    .asciz  "  Creating directory:"
+.Lxly_str_b8eaa574819a7ff8:
+    .asciz  "mkdir"
+.Lxly_str_0d4b34396c844d0b:
+    .asciz  "  Created:"
+.Lxly_str_542672d09ff068dd:
+    .asciz  "  Directory exists?"
+.Lxly_str_732d8bd38ff9851d:
+    .asciz  "exists"
+.Lxly_str_3f302afbbf7eb6c3:
+    .asciz  "  Is directory?"
+.Lxly_str_641d9cfa1a584ee4:
+    .asciz  "isDir"
+.Lxly_str_cf21a225b64b7482:
+    .asciz  "  Is file?"
+.Lxly_str_56c29a0c5c4f3d33:
+    .asciz  "isFile"
+.Lxly_str_f9cdcdcef4467583:
+    .asciz  "  Listing /tmp:"
+.Lxly_str_7f7de39c4bcebddb:
+    .asciz  "/tmp"
+.Lxly_str_3b6ab99c24e17990:
+    .asciz  "listdir"
+.Lxly_str_f47d9006c63b6697:
+    .asciz  "  Found"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_c5b2a72c0845a253:
+    .asciz  "entries"
+.Lxly_str_6b229121d64322bb:
+    .asciz  "3. Crypto Module:"
+.Lxly_str_6ef05bd7cc857c54:
+    .asciz  "Hello, World!"
+.Lxly_str_a22c76d872a293a4:
+    .asciz  "  Text:"
+.Lxly_str_2d3440e1f5fafecd:
+    .asciz  "  DJB2 hash:"
+.Lxly_str_f342c7914fd0f990:
+    .asciz  "crypto"
+.Lxly_str_2e3d9ecc741a7811:
+    .asciz  "hash"
+.Lxly_str_be274c9b0588e868:
+    .asciz  "  FNV-1a hash:"
+.Lxly_str_46a9eab632329b7b:
+    .asciz  "fnv1a"
+.Lxly_str_50cc5bf9d94270e8:
+    .asciz  "  MurmurHash3:"
+.Lxly_str_3c29bcf8e69d8ba6:
+    .asciz  "murmur3"
+.Lxly_str_0098c9adf973dc70:
+    .asciz  "  Checksum:"
+.Lxly_str_a8459529fb284912:
+    .asciz  "checksum"
+.Lxly_str_676fce968531a93d:
+    .asciz  "  Random bytes:"
+.Lxly_str_c346f2a348f58ca1:
+    .asciz  "randomBytes"
+.Lxly_str_cb9fd46455575470:
+    .asciz  "  UUID:"
+.Lxly_str_8c04c0e40aad86b2:
+    .asciz  "uuid"
+.Lxly_str_8d98e5f237af5ef5:
+    .asciz  "  Crypto constants:"
+.Lxly_str_10683ff5438b23cd:
+    .asciz  "  MD5_SIZE:"
+.Lxly_str_009c43511cef30bd:
+    .asciz  "MD5_SIZE"
+.Lxly_str_4507d704517f9206:
+    .asciz  "  SHA1_SIZE:"
+.Lxly_str_58690466f5bafbe0:
+    .asciz  "SHA1_SIZE"
+.Lxly_str_bd9c84db928e467c:
+    .asciz  "  SHA256_SIZE:"
+.Lxly_str_dd10afbc5c462a36:
+    .asciz  "SHA256_SIZE"
+.Lxly_str_03d3c51b2cc97d7c:
+    .asciz  "4. Path Module:"
+.Lxly_str_3f0304a76e1da0a8:
+    .asciz  "/home/user/documents"
+.Lxly_str_021802b0f58e99e5:
+    .asciz  "file.txt"
+.Lxly_str_e0fa5901aa4a3801:
+    .asciz  "  Path 1:"
+.Lxly_str_e0efd701aa410696:
+    .asciz  "  Path 2:"
+.Lxly_str_0e2548cb8c2f41a6:
+    .asciz  "  Joined:"
+.Lxly_str_684da8c1031a301b:
+    .asciz  "  Basename:"
+.Lxly_str_79b6a9af7a07f29b:
+    .asciz  "basename"
+.Lxly_str_9c758d78e3395157:
+    .asciz  "  Dirname:"
+.Lxly_str_ad90b24c904b7f0f:
+    .asciz  "dirname"
+.Lxly_str_beeb113db3ca7f08:
+    .asciz  "  Extension:"
+.Lxly_str_c3120f18f0704ad4:
+    .asciz  "ext"
+.Lxly_str_7a570eb2d42d314f:
+    .asciz  "  Is absolute?"
+.Lxly_str_7e0910fa2901dccb:
+    .asciz  "isAbs"
+.Lxly_str_e5628e7a7229a271:
+    .asciz  "/home//user///documents//"
+.Lxly_str_2d7868fd77a47023:
+    .asciz  "  Messy path:"
+.Lxly_str_e35fda07d6d86117:
+    .asciz  "  Cleaned:"
+.Lxly_str_f531ec9544a8fc3e:
+    .asciz  "clean"
+.Lxly_str_5fdb7a8ac3147783:
+    .asciz  "split"
+.Lxly_str_53fe79e2681ab7e0:
+    .asciz  "  Split path:"
+.Lxly_str_1e29a1aeaa3c615a:
+    .asciz  "    Dir:"
+.Lxly_str_cb3f7d70d387f576:
+    .asciz  "    Base:"
+.Lxly_str_da6e32233dad78ad:
+    .asciz  "5. More Path Examples:"
+.Lxly_str_c5869ad7b68b73e6:
+    .asciz  "/home/user/file.txt"
+.Lxly_str_c7ab01e6795dd305:
+    .asciz  "relative/path/to/file.md"
+.Lxly_str_52f8812e64b46c95:
+    .asciz  "/etc/config.json"
+.Lxly_str_9a7ee83d1fee758b:
+    .asciz  "data.csv"
+.Lxly_str_920751759e060d3c:
+    .asciz  "  Path:"
+.Lxly_str_d82b955c53a17162:
+    .asciz  "| Base:"
+.Lxly_str_4c7dfe070e60fb86:
+    .asciz  "| Ext:"
+.Lxly_str_f5583e57892878a2:
+    .asciz  "6. Hash Comparison:"
+.Lxly_str_6f6299b53eab5ad8:
+    .asciz  "password123"
+.Lxly_str_6f62a0b53eab66bd:
+    .asciz  "password124"
+.Lxly_str_0834c9e3a71d0cb8:
+    .asciz  "  Data 1:"
+.Lxly_str_daf8aecbfe55a340:
+    .asciz  "-> Hash:"
+.Lxly_str_083153e3a71a0e5f:
+    .asciz  "  Data 2:"
+.Lxly_str_980463f58671a46e:
+    .asciz  "  Hashes equal?"
+.Lxly_str_177e3ed3f4745a3e:
+    .asciz  "7. Platform Detection:"
+.Lxly_str_2e0fa45042f8603d:
+    .asciz  "  Running on:"
+.Lxly_str_5cad04a9f1a5d05d:
+    .asciz  "linux"
+.Lxly_str_61806400d7abeb4c:
+    .asciz  "  \342\234\223 Linux detected"
+.Lxly_str_35f0d01c1cb405b7:
+    .asciz  "8. Cleanup:"
+.Lxly_str_ba64a1aeb70bfc69:
+    .asciz  "  Removing test directory..."
+.Lxly_str_77dfa1348bae30df:
+    .asciz  "rmdir"
+.Lxly_str_8bec41e71d58847e:
+    .asciz  "\342\234\205 Standard library test complete!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   16
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   128
@@ -0,0 +1,4681 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $3872, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -3872(%rbp)
+    movq    %rax, -3864(%rbp)
+    movq    %rax, -3856(%rbp)
+    movq    %rax, -3848(%rbp)
+    movq    %rax, -3840(%rbp)
+    movq    %rax, -3832(%rbp)
+    movq    %rax, -3824(%rbp)
+    movq    %rax, -3816(%rbp)
+    movq    %rax, -3808(%rbp)
+    movq    %rax, -3800(%rbp)
+    movq    %rax, -3792(%rbp)
+    movq    %rax, -3784(%rbp)
+    movq    %rax, -3776(%rbp)
+    movq    %rax, -3768(%rbp)
+    movq    %rax, -3760(%rbp)
+    movq    %rax, -3752(%rbp)
+    movq    %rax, -3744(%rbp)
+    movq    %rax, -3736(%rbp)
+    movq    %rax, -3728(%rbp)
+    movq    %rax, -3720(%rbp)
+    movq    %rax, -3712(%rbp)
+    movq    %rax, -3704(%rbp)
+    movq    %rax, -3696(%rbp)
+    movq    %rax, -3688(%rbp)
+    movq    %rax, -3680(%rbp)
+    movq    %rax, -3672(%rbp)
+    movq    %rax, -3664(%rbp)
+    movq    %rax, -3656(%rbp)
+    movq    %rax, -3648(%rbp)
+    movq    %rax, -3640(%rbp)
+    movq    %rax, -3632(%rbp)
+    movq    %rax, -3624(%rbp)
+    movq    %rax, -3616(%rbp)
+    movq    %rax, -3608(%rbp)
+    movq    %rax, -3600(%rbp)
+    movq    %rax, -3592(%rbp)
+    movq    %rax, -3584(%rbp)
+    movq    %rax, -3576(%rbp)
+    movq    %rax, -3568(%rbp)
+    movq    %rax, -3560(%rbp)
+    movq    %rax, -3552(%rbp)
+    movq    %rax, -3544(%rbp)
+    movq    %rax, -3536(%rbp)
+    movq    %rax, -3528(%rbp)
+    movq    %rax, -3520(%rbp)
+    movq    %rax, -3512(%rbp)
+    movq    %rax, -3504(%rbp)
+    movq    %rax, -3496(%rbp)
+    movq    %rax, -3488(%rbp)
+    movq    %rax, -3480(%rbp)
+    movq    %rax, -3472(%rbp)
+    movq    %rax, -3464(%rbp)
+    movq    %rax, -3456(%rbp)
+    movq    %rax, -3448(%rbp)
+    movq    %rax, -3440(%rbp)
+    movq    %rax, -3432(%rbp)
+    movq    %rax, -3424(%rbp)
+    movq    %rax, -3416(%rbp)
+    movq    %rax, -3408(%rbp)
+    movq    %rax, -3400(%rbp)
+    movq    %rax, -3392(%rbp)
+    movq    %rax, -3384(%rbp)
+    movq    %rax, -3376(%rbp)
+    movq    %rax, -3368(%rbp)
+    movq    %rax, -3360(%rbp)
+    movq    %rax, -3352(%rbp)
+    movq    %rax, -3344(%rbp)
+    movq    %rax, -3336(%rbp)
+    movq    %rax, -3328(%rbp)
+    movq    %rax, -3320(%rbp)
+    movq    %rax, -3312(%rbp)
+    movq    %rax, -3304(%rbp)
+    movq    %rax, -3296(%rbp)
+    movq    %rax, -3288(%rbp)
+    movq    %rax, -3280(%rbp)
+    movq    %rax, -3272(%rbp)
+    movq    %rax, -3264(%rbp)
+    movq    %rax, -3256(%rbp)
+    movq    %rax, -3248(%rbp)
+    movq    %rax, -3240(%rbp)
+    movq    %rax, -3232(%rbp)
+    movq    %rax, -3224(%rbp)
+    movq    %rax, -3216(%rbp)
+    movq    %rax, -3208(%rbp)
+    movq    %rax, -3200(%rbp)
+    movq    %rax, -3192(%rbp)
+    movq    %rax, -3184(%rbp)
+    movq    %rax, -3176(%rbp)
+    movq    %rax, -3168(%rbp)
+    movq    %rax, -3160(%rbp)
+    movq    %rax, -3152(%rbp)
+    movq    %rax, -3144(%rbp)
+    movq    %rax, -3136(%rbp)
+    movq    %rax, -3128(%rbp)
+    movq    %rax, -3120(%rbp)
+    movq    %rax, -3112(%rbp)
+    movq    %rax, -3104(%rbp)
+    movq    %rax, -3096(%rbp)
+    movq    %rax, -3088(%rbp)
+    movq    %rax, -3080(%rbp)
+    movq    %rax, -3072(%rbp)
+    movq    %rax, -3064(%rbp)
+    movq    %rax, -3056(%rbp)
+    movq    %rax, -3048(%rbp)
+    movq    %rax, -3040(%rbp)
+    movq    %rax, -3032(%rbp)
+    movq    %rax, -3024(%rbp)
+    movq    %rax, -3016(%rbp)
+    movq    %rax, -3008(%rbp)
+    movq    %rax, -3000(%rbp)
+    movq    %rax, -2992(%rbp)
+    movq    %rax, -2984(%rbp)
+    movq    %rax, -2976(%rbp)
+    movq    %rax, -2968(%rbp)
+    movq    %rax, -2960(%rbp)
+    movq    %rax, -2952(%rbp)
+    movq    %rax, -2944(%rbp)
+    movq    %rax, -2936(%rbp)
+    movq    %rax, -2928(%rbp)
+    movq    %rax, -2920(%rbp)
+    movq    %rax, -2912(%rbp)
+    movq    %rax, -2904(%rbp)
+    movq    %rax, -2896(%rbp)
+    movq    %rax, -2888(%rbp)
+    movq    %rax, -2880(%rbp)
+    movq    %rax, -2872(%rbp)
+    movq    %rax, -2864(%rbp)
+    movq    %rax, -2856(%rbp)
+    movq    %rax, -2848(%rbp)
+    movq    %rax, -2840(%rbp)
+    movq    %rax, -2832(%rbp)
+    movq    %rax, -2824(%rbp)
+    movq    %rax, -2816(%rbp)
+    movq    %rax, -2808(%rbp)
+    movq    %rax, -2800(%rbp)
+    movq    %rax, -2792(%rbp)
+    movq    %rax, -2784(%rbp)
+    movq    %rax, -2776(%rbp)
+    movq    %rax, -2768(%rbp)
+    movq    %rax, -2760(%rbp)
+    movq    %rax, -2752(%rbp)
+    movq    %rax, -2744(%rbp)
+    movq    %rax, -2736(%rbp)
+    movq    %rax, -2728(%rbp)
+    movq    %rax, -2720(%rbp)
+    movq    %rax, -2712(%rbp)
+    movq    %rax, -2704(%rbp)
+    movq    %rax, -2696(%rbp)
+    movq    %rax, -2688(%rbp)
+    movq    %rax, -2680(%rbp)
+    movq    %rax, -2672(%rbp)
+    movq    %rax, -2664(%rbp)
+    movq    %rax, -2656(%rbp)
+    movq    %rax, -2648(%rbp)
+    movq    %rax, -2640(%rbp)
+    movq    %rax, -2632(%rbp)
+    movq    %rax, -2624(%rbp)
+    movq    %rax, -2616(%rbp)
+    movq    %rax, -2608(%rbp)
+    movq    %rax, -2600(%rbp)
+    movq    %rax, -2592(%rbp)
+    movq    %rax, -2584(%rbp)
+    movq    %rax, -2576(%rbp)
+    movq    %rax, -2568(%rbp)
+    movq    %rax, -2560(%rbp)
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movl    $-1, -3836(%rbp)
+    movl    $-1, -3708(%rbp)
+    movl    $-1, -3580(%rbp)
+    movl    $-1, -3452(%rbp)
+    movl    $-1, -3324(%rbp)
+    movl    $-1, -3196(%rbp)
+    movl    $-1, -3068(%rbp)
+    movl    $-1, -2940(%rbp)
+    movl    $-1, -2812(%rbp)
+    movl    $-1, -2684(%rbp)
+    movl    $-1, -2556(%rbp)
+    movl    $-1, -2428(%rbp)
+    movl    $-1, -2300(%rbp)
+    movl    $-1, -2172(%rbp)
+    movl    $-1, -2044(%rbp)
+    movl    $-1, -1916(%rbp)
+    leaq    .Lxly_str_fb1911dec3add28c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1f92d16aa07117e7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c9c3d54173a8b144(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_de87b32850e604c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6ce4b807b65f7028(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_fa53d71e58427c00(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1944(%rbp)
+    leaq    -1952(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_890de6fb44516442(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_ee89819026833062(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2072(%rbp)
+    leaq    -2080(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a408051e2dfc0d05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_cf0b3c1e3fc048fb(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2200(%rbp)
+    leaq    -2208(%rbp), %rax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_72a62ab9da6e2e18(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_1e3f54eedd19797c(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2328(%rbp)
+    leaq    -2336(%rbp), %rax
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_38fa6fc3f7215003(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4a037e1e85e2b1ed(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2456(%rbp)
+    leaq    -2464(%rbp), %rax
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_add
+.Lxly_10:
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d8849a8719c50dda(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_9894a6ef22b19c4e(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2584(%rbp)
+    leaq    -2592(%rbp), %rax
+    jmp     .Lxly_12
+.Lxly_11:
+    call    xly_add
+.Lxly_12:
+    movq    %rax, -112(%rbp)
+    subq    $16, %rsp
+    movq    -112(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k690(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_2fd0f921eefd3a6a(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_5a899db492534acf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k691(%rip), %rax
+    movq    %rax, -144(%rbp)
+    movq    %r15, %rdi
+    movq    -144(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -152(%rbp)
+    movq    -136(%rbp), %rdi
+    movq    -152(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2712(%rbp)
+    leaq    -2720(%rbp), %rax
+    jmp     .Lxly_14
+.Lxly_13:
+    call    xly_add
+.Lxly_14:
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_4122ef731258a835(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movq    -160(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2840(%rbp)
+    leaq    -2848(%rbp), %rax
+    jmp     .Lxly_16
+.Lxly_15:
+    call    xly_add
+.Lxly_16:
+    movq    %rax, -176(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k692(%rip), %rax
+    movq    %rax, -184(%rbp)
+    movq    %r15, %rdi
+    movq    -184(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -192(%rbp)
+    movq    -176(%rbp), %rdi
+    movq    -192(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2968(%rbp)
+    leaq    -2976(%rbp), %rax
+    jmp     .Lxly_18
+.Lxly_17:
+    call    xly_add
+.Lxly_18:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_ir0_k693(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_2fd0f921eefd3a6a(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_c3d1189baab739b6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k694(%rip), %rax
+    movq    %rax, -224(%rbp)
+    movq    %r14, %rdi
+    movq    -224(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -232(%rbp)
+    movq    -216(%rbp), %rdi
+    movq    -232(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3096(%rbp)
+    leaq    -3104(%rbp), %rax
+    jmp     .Lxly_20
+.Lxly_19:
+    call    xly_add
+.Lxly_20:
+    movq    %rax, -240(%rbp)
+    movq    -240(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3224(%rbp)
+    leaq    -3232(%rbp), %rax
+    jmp     .Lxly_22
+.Lxly_21:
+    call    xly_add
+.Lxly_22:
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_ir0_k695(%rip), %rax
+    movq    %rax, -256(%rbp)
+    movq    %r14, %rdi
+    movq    -256(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -264(%rbp)
+    movq    -248(%rbp), %rdi
+    movq    -264(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3352(%rbp)
+    leaq    -3360(%rbp), %rax
+    jmp     .Lxly_24
+.Lxly_23:
+    call    xly_add
+.Lxly_24:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2fd65fda857cc043(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4050000000000000, %rax
+    movq    %rax, -272(%rbp)
+    movabsq $0x4080000000000000, %rax
+    movq    %rax, -280(%rbp)
+    leaq    .Lxly_ir0_k696(%rip), %rax
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k697(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_004d34191349ef24(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k698(%rip), %rax
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_004d34191349ef24(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -320(%rbp)
+    movq    -320(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_954c7c58bb9500d6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x407a400000000000, %rax
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_ir0_k699(%rip), %rax
+    movq    %rax, -336(%rbp)
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -320(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -336(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_f84f97b4633670e9(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -344(%rbp)
+    movq    -344(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_c36a7db65883b48d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    movq    -352(%rbp), %rdi
+    movq    -344(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3480(%rbp)
+    leaq    -3488(%rbp), %rax
+    jmp     .Lxly_26
+.Lxly_25:
+    call    xly_add
+.Lxly_26:
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_dd3952b52498b12f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -376(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_2573f14af27a9e36(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_9ec2699513c0f9c3(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -392(%rbp)
+    leaq    .Lxly_ir0_k700(%rip), %rax
+    movq    %rax, -400(%rbp)
+    leaq    .Lxly_ir0_k701(%rip), %rax
+    movq    %rax, -408(%rbp)
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -408(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_f84f97b4633670e9(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -416(%rbp)
+    movq    -416(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_ir0_k702(%rip), %rax
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -424(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4ce6531fbfddd605(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+    movq    -432(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    subq    $16, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_9ec2699513c0f9c3(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_str_5b807babd70d1f57(%rip), %rdi
+    call    xly_str
+    movq    %rax, -448(%rbp)
+    movq    -448(%rbp), %rdi
+    movq    -432(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3608(%rbp)
+    leaq    -3616(%rbp), %rax
+    jmp     .Lxly_28
+.Lxly_27:
+    call    xly_add
+.Lxly_28:
+    movq    %rax, -456(%rbp)
+    subq    $16, %rsp
+    movq    -456(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_aefd5a191d95e3f7(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -464(%rbp)
+    movq    -464(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_1844633b4ecee303(%rip), %rdi
+    call    xly_str
+    movq    %rax, -472(%rbp)
+    leaq    .Lxly_ir0_k703(%rip), %rax
+    movq    %rax, -480(%rbp)
+    movq    -464(%rbp), %rdi
+    movq    -480(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -488(%rbp)
+    movq    -472(%rbp), %rdi
+    movq    -488(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3736(%rbp)
+    leaq    -3744(%rbp), %rax
+    jmp     .Lxly_30
+.Lxly_29:
+    call    xly_add
+.Lxly_30:
+    movq    %rax, -496(%rbp)
+    leaq    .Lxly_str_a834e90c6e6c0673(%rip), %rdi
+    call    xly_str
+    movq    %rax, -504(%rbp)
+    movq    -496(%rbp), %rdi
+    movq    -504(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_31
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3864(%rbp)
+    leaq    -3872(%rbp), %rax
+    jmp     .Lxly_32
+.Lxly_31:
+    call    xly_add
+.Lxly_32:
+    movq    %rax, -512(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -520(%rbp)
+    leaq    .Lxly_ir0_k704(%rip), %rax
+    movq    %rax, -528(%rbp)
+    movq    -464(%rbp), %rdi
+    movq    -528(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -536(%rbp)
+    movq    -512(%rbp), %rdi
+    movq    -536(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_33
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_34
+.Lxly_33:
+    call    xly_add
+.Lxly_34:
+    movq    %rax, -544(%rbp)
+    subq    $16, %rsp
+    movq    -544(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -552(%rbp)
+    movabsq $0x4040000000000000, %rax
+    movq    %rax, -560(%rbp)
+    leaq    .Lxly_ir0_k705(%rip), %rax
+    movq    %rax, -568(%rbp)
+    leaq    .Lxly_ir0_k706(%rip), %rax
+    movq    %rax, -576(%rbp)
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -576(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_004d34191349ef24(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -584(%rbp)
+    movq    -584(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x40b0000000000000, %rax
+    movq    %rax, -592(%rbp)
+    leaq    .Lxly_ir0_k707(%rip), %rax
+    movq    %rax, -600(%rbp)
+    leaq    .Lxly_ir0_k708(%rip), %rax
+    movq    %rax, -608(%rbp)
+    subq    $16, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -608(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_004d34191349ef24(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -616(%rbp)
+    movabsq $0xbff0000000000000, %rax
+    movq    %rax, -624(%rbp)
+    leaq    .Lxly_ir0_k709(%rip), %rax
+    movq    %rax, -632(%rbp)
+    leaq    .Lxly_ir0_k710(%rip), %rax
+    movq    %rax, -640(%rbp)
+    leaq    .Lxly_ir0_k711(%rip), %rax
+    movq    %rax, -648(%rbp)
+    subq    $48, %rsp
+    movq    -632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -616(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -584(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -640(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -648(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_fe81b4a2bc80ceae(%rip), %rsi
+    movl    $5, %ecx
+    call    xly_call_module
+    addq    $48, %rsp
+    movq    %rax, -656(%rbp)
+    movq    -656(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_2d9ce75ffd78120b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -664(%rbp)
+    movq    -664(%rbp), %rdi
+    movq    -656(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_36
+.Lxly_35:
+    call    xly_add
+.Lxly_36:
+    movq    %rax, -672(%rbp)
+    subq    $16, %rsp
+    movq    -672(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_467968c7f83e92c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -680(%rbp)
+    leaq    .Lxly_ir0_k712(%rip), %rax
+    movq    %rax, -688(%rbp)
+    subq    $32, %rsp
+    movq    -656(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -688(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -680(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_8decd05c7b7d1656(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -696(%rbp)
+    movabsq $0x403c000000000000, %rax
+    movq    %rax, -704(%rbp)
+    leaq    .Lxly_ir0_k713(%rip), %rax
+    movq    %rax, -712(%rbp)
+    leaq    .Lxly_ir0_k714(%rip), %rax
+    movq    %rax, -720(%rbp)
+    subq    $32, %rsp
+    movq    -656(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -712(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -720(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_847e3ae8b5540ed7(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -728(%rbp)
+    movq    -728(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_46fe80b6b18c5495(%rip), %rdi
+    call    xly_str
+    movq    %rax, -736(%rbp)
+    movq    -736(%rbp), %rdi
+    movq    -728(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_37
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_38
+.Lxly_37:
+    call    xly_add
+.Lxly_38:
+    movq    %rax, -744(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k715(%rip), %rax
+    movq    %rax, -752(%rbp)
+    subq    $16, %rsp
+    movq    -656(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -752(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_b4e94bbc0d00316b(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3ab3b58666f4bb65(%rip), %rdi
+    call    xly_str
+    movq    %rax, -768(%rbp)
+    subq    $16, %rsp
+    movq    -768(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e14eadf656b96b9e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -776(%rbp)
+    movabsq $0x407ed00000000000, %rax
+    movq    %rax, -784(%rbp)
+    leaq    .Lxly_ir0_k716(%rip), %rax
+    movq    %rax, -792(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -792(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_b8eaa574819a7ff8(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -800(%rbp)
+    leaq    .Lxly_str_85436f745a160b3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_7a26bcfab8115b44(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -816(%rbp)
+    movq    -808(%rbp), %rdi
+    movq    -816(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_39
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_40
+.Lxly_39:
+    call    xly_add
+.Lxly_40:
+    movq    %rax, -824(%rbp)
+    subq    $16, %rsp
+    movq    -824(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ab45394215d51a81(%rip), %rdi
+    call    xly_str
+    movq    %rax, -832(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_663afaa8a67896b2(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -840(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -832(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_a8548c33c7356014(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -848(%rbp)
+    leaq    .Lxly_str_3233324938e9a723(%rip), %rdi
+    call    xly_str
+    movq    %rax, -856(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_bf46edfadf2cacec(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -864(%rbp)
+    movq    -856(%rbp), %rdi
+    movq    -864(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_41
+    cmpl    $0, (%rsi)
+    jne     .Lxly_41
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_42
+.Lxly_41:
+    call    xly_add
+.Lxly_42:
+    movq    %rax, -872(%rbp)
+    leaq    .Lxly_str_13a9bbe91b6ecc4e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -880(%rbp)
+    movq    -872(%rbp), %rdi
+    movq    -880(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_43
+    cmpl    $0, (%rsi)
+    jne     .Lxly_43
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_44
+.Lxly_43:
+    call    xly_add
+.Lxly_44:
+    movq    %rax, -888(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_a94c581d3ba24ae9(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -896(%rbp)
+    movq    -888(%rbp), %rdi
+    movq    -896(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_45
+    cmpl    $0, (%rsi)
+    jne     .Lxly_45
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_46
+.Lxly_45:
+    call    xly_add
+.Lxly_46:
+    movq    %rax, -904(%rbp)
+    subq    $16, %rsp
+    movq    -904(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k717(%rip), %rax
+    movq    %rax, -912(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -912(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_3e8c7e7610927412(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -920(%rbp)
+    leaq    .Lxly_str_eb6bd399d1018a4e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -928(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -936(%rbp)
+    leaq    .Lxly_ir0_k718(%rip), %rax
+    movq    %rax, -944(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -944(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_7e6283be0952e02b(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -952(%rbp)
+    movq    -928(%rbp), %rdi
+    movq    -952(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_47
+    cmpl    $0, (%rsi)
+    jne     .Lxly_47
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_48
+.Lxly_47:
+    call    xly_add
+.Lxly_48:
+    movq    %rax, -960(%rbp)
+    subq    $16, %rsp
+    movq    -960(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_77dfa1348bae30df(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -968(%rbp)
+    subq    $16, %rsp
+    movq    -832(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_663afaa8a67896b2(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -976(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_663afaa8a67896b2(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -984(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_590284f2d8342ab5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_352d97304bb38791(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_25d3ee2ede3bd4f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -992(%rbp)
+    movabsq $0x40bf900000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k719(%rip), %rax
+    movq    %rax, -1000(%rbp)
+    subq    $16, %rsp
+    movq    -1000(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_0675bac94ff9ec95(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1008(%rbp)
+    movq    -992(%rbp), %rdi
+    movq    -1008(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_49
+    cmpl    $0, (%rsi)
+    jne     .Lxly_49
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_50
+.Lxly_49:
+    call    xly_add
+.Lxly_50:
+    movq    %rax, -1016(%rbp)
+    leaq    .Lxly_str_cafa0dcce12493e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1024(%rbp)
+    movq    -1016(%rbp), %rdi
+    movq    -1024(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_51
+    cmpl    $0, (%rsi)
+    jne     .Lxly_51
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_52
+.Lxly_51:
+    call    xly_add
+.Lxly_52:
+    movq    %rax, -1032(%rbp)
+    leaq    .Lxly_ir0_k720(%rip), %rax
+    movq    %rax, -1040(%rbp)
+    subq    $16, %rsp
+    movq    -1040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_0675bac94ff9ec95(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_87fd82a14026fc81(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1048(%rbp)
+    movq    -1032(%rbp), %rdi
+    movq    -1048(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_53
+    cmpl    $0, (%rsi)
+    jne     .Lxly_53
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_54
+.Lxly_53:
+    call    xly_add
+.Lxly_54:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8d1784f95ae887c1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1056(%rbp)
+    movabsq $0x40c81c8000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k721(%rip), %rax
+    movq    %rax, -1064(%rbp)
+    subq    $16, %rsp
+    movq    -1064(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_0675abc94ff9d318(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1072(%rbp)
+    movq    -1056(%rbp), %rdi
+    movq    -1072(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_55
+    cmpl    $0, (%rsi)
+    jne     .Lxly_55
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_56
+.Lxly_55:
+    call    xly_add
+.Lxly_56:
+    movq    %rax, -1080(%rbp)
+    leaq    .Lxly_str_ca3c2ae9fb6eedbb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1088(%rbp)
+    movq    -1080(%rbp), %rdi
+    movq    -1088(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_57
+    cmpl    $0, (%rsi)
+    jne     .Lxly_57
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_58
+.Lxly_57:
+    call    xly_add
+.Lxly_58:
+    movq    %rax, -1096(%rbp)
+    leaq    .Lxly_ir0_k722(%rip), %rax
+    movq    %rax, -1104(%rbp)
+    subq    $16, %rsp
+    movq    -1104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_0675abc94ff9d318(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_87fd6ba14026d56c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1112(%rbp)
+    movq    -1096(%rbp), %rdi
+    movq    -1112(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_59
+    cmpl    $0, (%rsi)
+    jne     .Lxly_59
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_60
+.Lxly_59:
+    call    xly_add
+.Lxly_60:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e237d419d401ad43(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_aabafe7104d914be(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1120(%rbp)
+    subq    $16, %rsp
+    movq    -1120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_898fbb8d0f269200(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1128(%rbp)
+    movq    %r15, %rdi
+    movq    -1128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_61
+    cmpl    $0, (%rsi)
+    jne     .Lxly_61
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_62
+.Lxly_61:
+    call    xly_add
+.Lxly_62:
+    movq    %rax, -1136(%rbp)
+    subq    $16, %rsp
+    movq    -1136(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_88e9be71c631dec5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x41dfc00000400000, %rax
+    movq    %rax, -1144(%rbp)
+    leaq    .Lxly_ir0_k723(%rip), %rax
+    movq    %rax, -1152(%rbp)
+    subq    $16, %rsp
+    movq    -1152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_924628f8d152f1fa(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1160(%rbp)
+    movq    %r15, %rdi
+    movq    -1160(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_63
+    cmpl    $0, (%rsi)
+    jne     .Lxly_63
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_64
+.Lxly_63:
+    call    xly_add
+.Lxly_64:
+    movq    %rax, -1168(%rbp)
+    subq    $16, %rsp
+    movq    -1168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_e39475838c6a83e2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_f1660e8715d1ee5f(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1176(%rbp)
+    movq    -1176(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_4daf414b5679dcc2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1184(%rbp)
+    leaq    .Lxly_ir0_k724(%rip), %rax
+    movq    %rax, -1192(%rbp)
+    movq    -1176(%rbp), %rdi
+    movq    -1192(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1200(%rbp)
+    movq    -1184(%rbp), %rdi
+    movq    -1200(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_65
+    cmpl    $0, (%rsi)
+    jne     .Lxly_65
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_66
+.Lxly_65:
+    call    xly_add
+.Lxly_66:
+    movq    %rax, -1208(%rbp)
+    leaq    .Lxly_str_08d8ee07b578b466(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    -1208(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_67
+    cmpl    $0, (%rsi)
+    jne     .Lxly_67
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_68
+.Lxly_67:
+    call    xly_add
+.Lxly_68:
+    movq    %rax, -1216(%rbp)
+    leaq    .Lxly_ir0_k725(%rip), %rax
+    movq    %rax, -1224(%rbp)
+    movq    -1176(%rbp), %rdi
+    movq    -1224(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1232(%rbp)
+    movq    -1216(%rbp), %rdi
+    movq    -1232(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_69
+    cmpl    $0, (%rsi)
+    jne     .Lxly_69
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_70
+.Lxly_69:
+    call    xly_add
+.Lxly_70:
+    movq    %rax, -1240(%rbp)
+    leaq    .Lxly_str_08b33d07b5586b66(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1248(%rbp)
+    movq    -1240(%rbp), %rdi
+    movq    -1248(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_71
+    cmpl    $0, (%rsi)
+    jne     .Lxly_71
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_72
+.Lxly_71:
+    call    xly_add
+.Lxly_72:
+    movq    %rax, -1256(%rbp)
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_455883f8c40ed816(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1264(%rbp)
+    movq    -1264(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_eb2a1f7524ebb175(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1272(%rbp)
+    leaq    .Lxly_ir0_k726(%rip), %rax
+    movq    %rax, -1280(%rbp)
+    movq    -1264(%rbp), %rdi
+    movq    -1280(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1288(%rbp)
+    movq    -1272(%rbp), %rdi
+    movq    -1288(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_73
+    cmpl    $0, (%rsi)
+    jne     .Lxly_73
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_74
+.Lxly_73:
+    call    xly_add
+.Lxly_74:
+    movq    %rax, -1296(%rbp)
+    movq    -1296(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_75
+    cmpl    $0, (%rsi)
+    jne     .Lxly_75
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_76
+.Lxly_75:
+    call    xly_add
+.Lxly_76:
+    movq    %rax, -1304(%rbp)
+    leaq    .Lxly_ir0_k727(%rip), %rax
+    movq    %rax, -1312(%rbp)
+    movq    -1264(%rbp), %rdi
+    movq    -1312(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1320(%rbp)
+    movq    -1304(%rbp), %rdi
+    movq    -1320(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_77
+    cmpl    $0, (%rsi)
+    jne     .Lxly_77
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_78
+.Lxly_77:
+    call    xly_add
+.Lxly_78:
+    movq    %rax, -1328(%rbp)
+    movq    -1328(%rbp), %rdi
+    movq    -1248(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_79
+    cmpl    $0, (%rsi)
+    jne     .Lxly_79
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_80
+.Lxly_79:
+    call    xly_add
+.Lxly_80:
+    movq    %rax, -1336(%rbp)
+    subq    $16, %rsp
+    movq    -1336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_2c92f20768d7c85b(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1344(%rbp)
+    movq    -1344(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_4d1e89c11d9ac900(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1352(%rbp)
+    leaq    .Lxly_ir0_k728(%rip), %rax
+    movq    %rax, -1360(%rbp)
+    movq    -1344(%rbp), %rdi
+    movq    -1360(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1368(%rbp)
+    movq    -1352(%rbp), %rdi
+    movq    -1368(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_81
+    cmpl    $0, (%rsi)
+    jne     .Lxly_81
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_82
+.Lxly_81:
+    call    xly_add
+.Lxly_82:
+    movq    %rax, -1376(%rbp)
+    movq    -1376(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_83
+    cmpl    $0, (%rsi)
+    jne     .Lxly_83
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_84
+.Lxly_83:
+    call    xly_add
+.Lxly_84:
+    movq    %rax, -1384(%rbp)
+    leaq    .Lxly_ir0_k729(%rip), %rax
+    movq    %rax, -1392(%rbp)
+    movq    -1344(%rbp), %rdi
+    movq    -1392(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1400(%rbp)
+    movq    -1384(%rbp), %rdi
+    movq    -1400(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_85
+    cmpl    $0, (%rsi)
+    jne     .Lxly_85
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_86
+.Lxly_85:
+    call    xly_add
+.Lxly_86:
+    movq    %rax, -1408(%rbp)
+    movq    -1408(%rbp), %rdi
+    movq    -1248(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_87
+    cmpl    $0, (%rsi)
+    jne     .Lxly_87
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_88
+.Lxly_87:
+    call    xly_add
+.Lxly_88:
+    movq    %rax, -1416(%rbp)
+    subq    $16, %rsp
+    movq    -1416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_ad1fa34caa324af3(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1424(%rbp)
+    movq    -1424(%rbp), %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_c09439f52aadd3cd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1432(%rbp)
+    leaq    .Lxly_ir0_k730(%rip), %rax
+    movq    %rax, -1440(%rbp)
+    movq    -1424(%rbp), %rdi
+    movq    -1440(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1448(%rbp)
+    movq    -1432(%rbp), %rdi
+    movq    -1448(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_89
+    cmpl    $0, (%rsi)
+    jne     .Lxly_89
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_90
+.Lxly_89:
+    call    xly_add
+.Lxly_90:
+    movq    %rax, -1456(%rbp)
+    movq    -1456(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_91
+    cmpl    $0, (%rsi)
+    jne     .Lxly_91
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_92
+.Lxly_91:
+    call    xly_add
+.Lxly_92:
+    movq    %rax, -1464(%rbp)
+    leaq    .Lxly_ir0_k731(%rip), %rax
+    movq    %rax, %r15
+    movq    -1424(%rbp), %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, -1472(%rbp)
+    movq    -1464(%rbp), %rdi
+    movq    -1472(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_93
+    cmpl    $0, (%rsi)
+    jne     .Lxly_93
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_94
+.Lxly_93:
+    call    xly_add
+.Lxly_94:
+    movq    %rax, %r15
+    leaq    .Lxly_str_08c43d07b566de99(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1480(%rbp)
+    movq    %r15, %rdi
+    movq    -1480(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_95
+    cmpl    $0, (%rsi)
+    jne     .Lxly_95
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_96
+.Lxly_95:
+    call    xly_add
+.Lxly_96:
+    movq    %rax, -1488(%rbp)
+    subq    $16, %rsp
+    movq    -1488(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_455883f8c40ed816(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1496(%rbp)
+    movq    -1496(%rbp), %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_ir0_k732(%rip), %rax
+    movq    %rax, -1504(%rbp)
+    movq    -1504(%rbp), %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_ir0_k733(%rip), %rax
+    movq    %rax, -1512(%rbp)
+    movq    -1512(%rbp), %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movabsq $0x40f869f000000000, %rax
+    movq    %rax, -1520(%rbp)
+    movq    %r12, %r14
+    movq    %r12, %r15
+.Lxly_ir0_b1:
+    movq    %r14, %xmm0
+    movq    -1520(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    movq    %r14, %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    movq    %r15, %r14
+    movq    %r13, %r15
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_455883f8c40ed816(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    movabsq $0x41cdcd6500000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k736(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_ir0_k737(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, -1528(%rbp)
+    leaq    .Lxly_ir0_k738(%rip), %rax
+    movq    %rax, %r13
+    movq    -1496(%rbp), %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, -1536(%rbp)
+    movq    -1528(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -1536(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, -1544(%rbp)
+    movq    -1544(%rbp), %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_ir0_k740(%rip), %rax
+    movq    %rax, -1552(%rbp)
+    movq    %r15, %rdi
+    movq    -1552(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -1560(%rbp)
+    leaq    .Lxly_ir0_k741(%rip), %rax
+    movq    %rax, %r15
+    movq    -1496(%rbp), %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, -1568(%rbp)
+    movq    -1560(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -1568(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -1576(%rbp)
+    movq    -1576(%rbp), %rax
+    movq    %rax, __xly_globals+160(%rip)
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1584(%rbp)
+    movq    -1584(%rbp), %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_a74abc2d12e71e2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_97
+    cmpl    $0, (%rsi)
+    jne     .Lxly_97
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_98
+.Lxly_97:
+    call    xly_add
+.Lxly_98:
+    movq    %rax, %r14
+    leaq    .Lxly_str_c2a78b17cdd131b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_99
+    cmpl    $0, (%rsi)
+    jne     .Lxly_99
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_100
+.Lxly_99:
+    call    xly_add
+.Lxly_100:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x411e848000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k745(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k746(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_11a4ad642a42e3f2(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    leaq    .Lxly_str_7978413c8b786fac(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ac61c304db41d206(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_8fcb774ec13ecb33(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+176(%rip)
+    leaq    .Lxly_str_2f9b0619bf1ea89e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k747(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, -1592(%rbp)
+    movq    %r15, %rdi
+    movq    -1592(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_101
+    cmpl    $0, (%rsi)
+    jne     .Lxly_101
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_102
+.Lxly_101:
+    call    xly_add
+.Lxly_102:
+    movq    %rax, %r14
+    leaq    .Lxly_str_6e59f3b36fc429bc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_103
+    cmpl    $0, (%rsi)
+    jne     .Lxly_103
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_104
+.Lxly_103:
+    call    xly_add
+.Lxly_104:
+    movq    %rax, -1600(%rbp)
+    leaq    .Lxly_ir0_k748(%rip), %rax
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, %r14
+    movq    -1600(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_105
+    cmpl    $0, (%rsi)
+    jne     .Lxly_105
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_106
+.Lxly_105:
+    call    xly_add
+.Lxly_106:
+    movq    %rax, %r15
+    leaq    .Lxly_str_a6fe9b2ffa768182(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_107
+    cmpl    $0, (%rsi)
+    jne     .Lxly_107
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_108
+.Lxly_107:
+    call    xly_add
+.Lxly_108:
+    movq    %rax, -1608(%rbp)
+    leaq    .Lxly_ir0_k749(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r15
+    movq    -1608(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_109
+    cmpl    $0, (%rsi)
+    jne     .Lxly_109
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_110
+.Lxly_109:
+    call    xly_add
+.Lxly_110:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ac9539f92e976c14(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_412437824b289735(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_111
+    cmpl    $0, (%rsi)
+    jne     .Lxly_111
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_112
+.Lxly_111:
+    call    xly_add
+.Lxly_112:
+    movq    %rax, %r13
+    leaq    .Lxly_str_c869b1f6de803b7f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_113
+    cmpl    $0, (%rsi)
+    jne     .Lxly_113
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_114
+.Lxly_113:
+    call    xly_add
+.Lxly_114:
+    movq    %rax, %r14
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4d3e4b718803f9ec(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_115
+    cmpl    $0, (%rsi)
+    jne     .Lxly_115
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_116
+.Lxly_115:
+    call    xly_add
+.Lxly_116:
+    movq    %rax, %r13
+    leaq    .Lxly_str_56340a018f2a940f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_117
+    cmpl    $0, (%rsi)
+    jne     .Lxly_117
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_118
+.Lxly_117:
+    call    xly_add
+.Lxly_118:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_d5bfde81ec26ff2a(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+184(%rip)
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_1f531d3ce6f23592(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+192(%rip)
+    movabsq $0x4130000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k750(%rip), %rax
+    movq    %rax, -1616(%rbp)
+    movq    -1616(%rbp), %rax
+    movq    %rax, __xly_globals+200(%rip)
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1624(%rbp)
+    movq    -1624(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, -1632(%rbp)
+    movq    -1632(%rbp), %rax
+    movq    %rax, __xly_globals+208(%rip)
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_2f6941b0c489bb25(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1640(%rbp)
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -1640(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1648(%rbp)
+    movq    -1648(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1656(%rbp)
+    movq    -1656(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+216(%rip)
+    leaq    .Lxly_str_2d23e7013fbb16d1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_119
+    cmpl    $0, (%rsi)
+    jne     .Lxly_119
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_120
+.Lxly_119:
+    call    xly_add
+.Lxly_120:
+    movq    %rax, -1664(%rbp)
+    leaq    .Lxly_str_e30ce3ecef8127c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -1664(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_121
+    cmpl    $0, (%rsi)
+    jne     .Lxly_121
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_122
+.Lxly_121:
+    call    xly_add
+.Lxly_122:
+    movq    %rax, %r15
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_123
+    cmpl    $0, (%rsi)
+    jne     .Lxly_123
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_124
+.Lxly_123:
+    call    xly_add
+.Lxly_124:
+    movq    %rax, %r14
+    leaq    .Lxly_str_bf2aa91b67ff1053(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_125
+    cmpl    $0, (%rsi)
+    jne     .Lxly_125
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_126
+.Lxly_125:
+    call    xly_add
+.Lxly_126:
+    movq    %rax, %r13
+    movq    -1656(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_127
+    cmpl    $0, (%rsi)
+    jne     .Lxly_127
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_128
+.Lxly_127:
+    call    xly_add
+.Lxly_128:
+    movq    %rax, %r14
+    leaq    .Lxly_str_09167c07b5ad53ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_129
+    cmpl    $0, (%rsi)
+    jne     .Lxly_129
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_130
+.Lxly_129:
+    call    xly_add
+.Lxly_130:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_60a08f5c682da1fd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_ba0b418a47180dd2(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_131
+    cmpl    $0, (%rsi)
+    jne     .Lxly_131
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_132
+.Lxly_131:
+    call    xly_add
+.Lxly_132:
+    movq    %rax, %r14
+    leaq    .Lxly_str_642bc9e18a68d1d2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_133
+    cmpl    $0, (%rsi)
+    jne     .Lxly_133
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_134
+.Lxly_133:
+    call    xly_add
+.Lxly_134:
+    movq    %rax, %r15
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_feb5f27a94f4d970(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_135
+    cmpl    $0, (%rsi)
+    jne     .Lxly_135
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_136
+.Lxly_135:
+    call    xly_add
+.Lxly_136:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63ff4c86022805(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_137
+    cmpl    $0, (%rsi)
+    jne     .Lxly_137
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_138
+.Lxly_137:
+    call    xly_add
+.Lxly_138:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b40fe693cfc2283d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_14e5d07eaf05ddfc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_81509b185dbfb113(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_139
+    cmpl    $0, (%rsi)
+    jne     .Lxly_139
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_140
+.Lxly_139:
+    call    xly_add
+.Lxly_140:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ba0cd8d0cf3ded60(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k755(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_ir0_k756(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k757(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4032586494532e8b(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_ir0_k758(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4032586494532e8b(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_ir0_k759(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4032586494532e8b(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_str_30c61f853568abfd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_141
+    cmpl    $0, (%rsi)
+    jne     .Lxly_141
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_142
+.Lxly_141:
+    call    xly_add
+.Lxly_142:
+    movq    %rax, %r14
+    leaq    .Lxly_str_616945596ec8289c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_143
+    cmpl    $0, (%rsi)
+    jne     .Lxly_143
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_144
+.Lxly_143:
+    call    xly_add
+.Lxly_144:
+    movq    %rax, -1672(%rbp)
+    leaq    .Lxly_ir0_k760(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_a8e23464cfd4705f(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    -1672(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_145
+    cmpl    $0, (%rsi)
+    jne     .Lxly_145
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_146
+.Lxly_145:
+    call    xly_add
+.Lxly_146:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k761(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_2798558e609ad6ba(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k762(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_408722d9b073ebbd(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_str_704f37cf466413ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_147
+    cmpl    $0, (%rsi)
+    jne     .Lxly_147
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_148
+.Lxly_147:
+    call    xly_add
+.Lxly_148:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_44317ba1e0c2c6d3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x41b2345678000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k763(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_442cba811e6dc6af(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_149
+    cmpl    $0, (%rsi)
+    jne     .Lxly_149
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_150
+.Lxly_149:
+    call    xly_add
+.Lxly_150:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1fe00da843046a23(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k764(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k765(%rip), %rax
+    movq    %rax, -1680(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1680(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_362ab941ef4bc826(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1688(%rbp)
+    movq    %r14, %rdi
+    movq    -1688(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_151
+    cmpl    $0, (%rsi)
+    jne     .Lxly_151
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_152
+.Lxly_151:
+    call    xly_add
+.Lxly_152:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7d0dd0b9d1b48d34(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k766(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k767(%rip), %rax
+    movq    %rax, -1696(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -1696(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_0b75e4e67044f18f(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1704(%rbp)
+    movq    %r13, %rdi
+    movq    -1704(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_153
+    cmpl    $0, (%rsi)
+    jne     .Lxly_153
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_154
+.Lxly_153:
+    call    xly_add
+.Lxly_154:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b09b3b77dce6c31a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k768(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_82f032337109723e(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1712(%rbp)
+    movq    %r14, %rdi
+    movq    -1712(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_155
+    cmpl    $0, (%rsi)
+    jne     .Lxly_155
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_156
+.Lxly_155:
+    call    xly_add
+.Lxly_156:
+    movq    %rax, %r13
+    leaq    .Lxly_str_d6bc92704fa1a151(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_157
+    cmpl    $0, (%rsi)
+    jne     .Lxly_157
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_158
+.Lxly_157:
+    call    xly_add
+.Lxly_158:
+    movq    %rax, -1720(%rbp)
+    leaq    .Lxly_ir0_k769(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_82f032337109723e(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    -1720(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_159
+    cmpl    $0, (%rsi)
+    jne     .Lxly_159
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_160
+.Lxly_159:
+    call    xly_add
+.Lxly_160:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_17a6679658d35f34(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k770(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_47c844a6a98ab2d5(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_161
+    cmpl    $0, (%rsi)
+    jne     .Lxly_161
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_162
+.Lxly_161:
+    call    xly_add
+.Lxly_162:
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_41d5f55028a223b9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0x406fe00000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k771(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_b721bbbf9b150aa3(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1728(%rbp)
+    movq    %r14, %rdi
+    movq    -1728(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_163
+    cmpl    $0, (%rsi)
+    jne     .Lxly_163
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_164
+.Lxly_163:
+    call    xly_add
+.Lxly_164:
+    movq    %rax, %r15
+    leaq    .Lxly_str_f578a77fcb47f6ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_165
+    cmpl    $0, (%rsi)
+    jne     .Lxly_165
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_166
+.Lxly_165:
+    call    xly_add
+.Lxly_166:
+    movq    %rax, -1736(%rbp)
+    leaq    .Lxly_ir0_k772(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_f607fb190d03ab00(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    -1736(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_167
+    cmpl    $0, (%rsi)
+    jne     .Lxly_167
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_168
+.Lxly_167:
+    call    xly_add
+.Lxly_168:
+    movq    %rax, %r14
+    leaq    .Lxly_str_d38cbcaa083575f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_169
+    cmpl    $0, (%rsi)
+    jne     .Lxly_169
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_170
+.Lxly_169:
+    call    xly_add
+.Lxly_170:
+    movq    %rax, -1744(%rbp)
+    movabsq $0x4070000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k773(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_f5b6fb190cbf53d8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    -1744(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_171
+    cmpl    $0, (%rsi)
+    jne     .Lxly_171
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_172
+.Lxly_171:
+    call    xly_add
+.Lxly_172:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c9098c74af0dbff2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k774(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_fd514cd7b5839794(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_173
+    cmpl    $0, (%rsi)
+    jne     .Lxly_173
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_174
+.Lxly_173:
+    call    xly_add
+.Lxly_174:
+    movq    %rax, %r15
+    leaq    .Lxly_str_5115397978f9d658(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_175
+    cmpl    $0, (%rsi)
+    jne     .Lxly_175
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_176
+.Lxly_175:
+    call    xly_add
+.Lxly_176:
+    movq    %rax, %r13
+    movabsq $0x405fc00000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k775(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_fd514cd7b5839794(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_177
+    cmpl    $0, (%rsi)
+    jne     .Lxly_177
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_178
+.Lxly_177:
+    call    xly_add
+.Lxly_178:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cc77ecc1316eec97(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k776(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k777(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_8a0baa1961118686(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1752(%rbp)
+    movq    %r14, %rdi
+    movq    -1752(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_179
+    cmpl    $0, (%rsi)
+    jne     .Lxly_179
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_180
+.Lxly_179:
+    call    xly_add
+.Lxly_180:
+    movq    %rax, %r13
+    leaq    .Lxly_str_26e7ec5365d1666b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_181
+    cmpl    $0, (%rsi)
+    jne     .Lxly_181
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_182
+.Lxly_181:
+    call    xly_add
+.Lxly_182:
+    movq    %rax, %r15
+    movabsq $0x4030000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k778(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k779(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_8a0bc4196111b2b4(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1760(%rbp)
+    movq    %r15, %rdi
+    movq    -1760(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_183
+    cmpl    $0, (%rsi)
+    jne     .Lxly_183
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_184
+.Lxly_183:
+    call    xly_add
+.Lxly_184:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7e73cad75d6aee76(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movabsq $0xc020000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k780(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k781(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_822d95195cd5e891(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1768(%rbp)
+    movq    %r14, %rdi
+    movq    -1768(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_185
+    cmpl    $0, (%rsi)
+    jne     .Lxly_185
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_186
+.Lxly_185:
+    call    xly_add
+.Lxly_186:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6bcb094387054e5c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_bed8c20dc4e85ed9(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+232(%rip)
+    leaq    .Lxly_str_a163764569a8229c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k782(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, -1776(%rbp)
+    movq    %r14, %rdi
+    movq    -1776(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_187
+    cmpl    $0, (%rsi)
+    jne     .Lxly_187
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_188
+.Lxly_187:
+    call    xly_add
+.Lxly_188:
+    movq    %rax, %r13
+    leaq    .Lxly_str_6634d9ab5dd43fc5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_189
+    cmpl    $0, (%rsi)
+    jne     .Lxly_189
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_190
+.Lxly_189:
+    call    xly_add
+.Lxly_190:
+    movq    %rax, -1784(%rbp)
+    leaq    .Lxly_ir0_k783(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r13
+    movq    -1784(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_191
+    cmpl    $0, (%rsi)
+    jne     .Lxly_191
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_192
+.Lxly_191:
+    call    xly_add
+.Lxly_192:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k784(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r13
+    leaq    .Lxly_str_819cedc06ca52659(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1792(%rbp)
+    leaq    .Lxly_ir0_k785(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, -1800(%rbp)
+    leaq    .Lxly_ir0_k786(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -1800(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_4ce6531fbfddd605(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+240(%rip)
+    leaq    .Lxly_str_96c5396646ca1266(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_193
+    cmpl    $0, (%rsi)
+    jne     .Lxly_193
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_194
+.Lxly_193:
+    call    xly_add
+.Lxly_194:
+    movq    %rax, -1808(%rbp)
+    subq    $16, %rsp
+    movq    -1808(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k787(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_9ec2699513c0f9c3(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k788(%rip), %rax
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_9ec2699513c0f9c3(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_da596f1d14c59bbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k789(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k790(%rip), %rax
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_216583cfe3c3e255(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_e5ab66e52aaef56c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k791(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_912a2bc7936bc0dc(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_8e5dd535b20e9663(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %r12
+    leaq    .Lxly_str_cf0d363b1a04434e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9ddab28c08f69fc5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_27b1d4894d3e5311(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_415b525c65829b66(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d63e2fd9c4c0a6a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3160a080f5d64eba(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2c1f41583f21197b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a96def7cd6a72c8f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9c1b78e6bc66dc1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_97567d31098f85ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_50fe54442b42aba9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_319dc58f03db015f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_220b5adf305b0ce0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8067947dc8d4ba41(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_86c5f12f2dd3500c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_827f84195d1bd5d6(%rip), %rdi
+    leaq    .Lxly_str_3f19c374651c8412(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_195
+    cmpl    $0, (%rsi)
+    jne     .Lxly_195
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_196
+.Lxly_195:
+    call    xly_add
+.Lxly_196:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_76857cebdcafe974(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1e66ab2d211ef5ca(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k690:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k691:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k692:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k693:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k694:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k695:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k696:
+    .quad   0, 0x4050000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k697:
+    .quad   0, 0x4080000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k698:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k699:
+    .quad   0, 0x407a400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k700:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k701:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k702:
+    .quad   0, 0x4050000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k703:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k704:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k705:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k706:
+    .quad   0, 0x4040000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k707:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k708:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k709:
+    .quad   0, 0x40b0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k710:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k711:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k712:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k713:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k714:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k715:
+    .quad   0, 0x40b0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k716:
+    .quad   0, 0x407ed00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k717:
+    .quad   0, 0x407a400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k718:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k719:
+    .quad   0, 0x40bf900000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k720:
+    .quad   0, 0x40bf900000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k721:
+    .quad   0, 0x40c81c8000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k722:
+    .quad   0, 0x40c81c8000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k723:
+    .quad   0, 0x41dfc00000400000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k724:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k725:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k726:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k727:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k728:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k729:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k730:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k731:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k732:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k733:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k736:
+    .quad   0, 0x41cdcd6500000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k737:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k738:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k740:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k741:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k745:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k746:
+    .quad   0, 0x411e848000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k747:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k748:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k749:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k750:
+    .quad   0, 0x4130000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k755:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k756:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k757:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k758:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k759:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k760:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k761:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k762:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k763:
+    .quad   0, 0x41b2345678000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k764:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k765:
+    .quad   0, 0x4050000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k766:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k767:
+    .quad   0, 0x4050000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k768:
+    .quad   0, 0x4050000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k769:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k770:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k771:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k772:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k773:
+    .quad   0, 0x4070000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k774:
+    .quad   0, 0x406fe00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k775:
+    .quad   0, 0x405fc00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k776:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k777:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k778:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k779:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k780:
+    .quad   0, 0xc020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k781:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k782:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k783:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k784:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k785:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k786:
+    .quad   0, 0x4050000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k787:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k788:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k789:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k790:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k791:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_fb1911dec3add28c:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_1f92d16aa07117e7:
+    .asciz  "\342\225\221     Xenly sys Module \342\200\224 Full System Programming       \342\225\221"
+.Lxly_str_c9c3d54173a8b144:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_de87b32850e604c2:
+    .asciz  "\342\224\200\342\224\200 LEVEL 1: Process Control \342\224\200\342\224\200"
+.Lxly_str_6ce4b807b65f7028:
+    .asciz  "PID:    "
+.Lxly_str_827f84195d1bd5d6:
+    .asciz  "sys"
+.Lxly_str_fa53d71e58427c00:
+    .asciz  "getpid"
+.Lxly_str_890de6fb44516442:
+    .asciz  "PPID:   "
+.Lxly_str_ee89819026833062:
+    .asciz  "getppid"
+.Lxly_str_a408051e2dfc0d05:
+    .asciz  "UID:    "
+.Lxly_str_cf0b3c1e3fc048fb:
+    .asciz  "getuid"
+.Lxly_str_72a62ab9da6e2e18:
+    .asciz  "EUID:   "
+.Lxly_str_1e3f54eedd19797c:
+    .asciz  "geteuid"
+.Lxly_str_38fa6fc3f7215003:
+    .asciz  "GID:    "
+.Lxly_str_4a037e1e85e2b1ed:
+    .asciz  "getgid"
+.Lxly_str_d8849a8719c50dda:
+    .asciz  "EGID:   "
+.Lxly_str_9894a6ef22b19c4e:
+    .asciz  "getegid"
+.Lxly_str_2fd0f921eefd3a6a:
+    .asciz  "getrlimit"
+.Lxly_str_5a899db492534acf:
+    .asciz  "RLIMIT_NOFILE soft="
+.Lxly_str_4122ef731258a835:
+    .asciz  " hard="
+.Lxly_str_c3d1189baab739b6:
+    .asciz  "RLIMIT_STACK  soft="
+.Lxly_str_2fd65fda857cc043:
+    .asciz  "\342\224\200\342\224\200 LEVEL 2: File I/O & mmap \342\224\200\342\224\200"
+.Lxly_str_004d34191349ef24:
+    .asciz  "bor"
+.Lxly_str_954c7c58bb9500d6:
+    .asciz  "/tmp/xenly_lvl2.bin"
+.Lxly_str_f84f97b4633670e9:
+    .asciz  "open"
+.Lxly_str_c36a7db65883b48d:
+    .asciz  "Opened fd="
+.Lxly_str_dd3952b52498b12f:
+    .asciz  "XENLY: System programming at every level.\n"
+.Lxly_str_b93a12b0d06caefc:
+    .asciz  "write"
+.Lxly_str_2573f14af27a9e36:
+    .asciz  "fsync"
+.Lxly_str_9ec2699513c0f9c3:
+    .asciz  "close"
+.Lxly_str_4ce6531fbfddd605:
+    .asciz  "read"
+.Lxly_str_5b807babd70d1f57:
+    .asciz  "Read: "
+.Lxly_str_aefd5a191d95e3f7:
+    .asciz  "stat"
+.Lxly_str_1844633b4ecee303:
+    .asciz  "stat: size="
+.Lxly_str_a834e90c6e6c0673:
+    .asciz  " nlinks="
+.Lxly_str_fe81b4a2bc80ceae:
+    .asciz  "mmap"
+.Lxly_str_2d9ce75ffd78120b:
+    .asciz  "mmap ptr="
+.Lxly_str_467968c7f83e92c9:
+    .asciz  "Hello from OS-mapped memory!"
+.Lxly_str_8decd05c7b7d1656:
+    .asciz  "mmap_write"
+.Lxly_str_847e3ae8b5540ed7:
+    .asciz  "mmap_read"
+.Lxly_str_46fe80b6b18c5495:
+    .asciz  "mmap_read: "
+.Lxly_str_b4e94bbc0d00316b:
+    .asciz  "munmap"
+.Lxly_str_3ab3b58666f4bb65:
+    .asciz  "\342\224\200\342\224\200 LEVEL 3: Filesystem \342\224\200\342\224\200"
+.Lxly_str_e14eadf656b96b9e:
+    .asciz  "/tmp/xenly_fstest"
+.Lxly_str_b8eaa574819a7ff8:
+    .asciz  "mkdir"
+.Lxly_str_85436f745a160b3e:
+    .asciz  "mkdir isdir="
+.Lxly_str_7a26bcfab8115b44:
+    .asciz  "isdir"
+.Lxly_str_ab45394215d51a81:
+    .asciz  "/tmp/xenly_link"
+.Lxly_str_663afaa8a67896b2:
+    .asciz  "unlink"
+.Lxly_str_a8548c33c7356014:
+    .asciz  "symlink"
+.Lxly_str_3233324938e9a723:
+    .asciz  "islnk="
+.Lxly_str_bf46edfadf2cacec:
+    .asciz  "islnk"
+.Lxly_str_13a9bbe91b6ecc4e:
+    .asciz  " readlink="
+.Lxly_str_a94c581d3ba24ae9:
+    .asciz  "readlink"
+.Lxly_str_3e8c7e7610927412:
+    .asciz  "chmod"
+.Lxly_str_eb6bd399d1018a4e:
+    .asciz  "chmod 0644 access R_OK="
+.Lxly_str_7e6283be0952e02b:
+    .asciz  "access"
+.Lxly_str_77dfa1348bae30df:
+    .asciz  "rmdir"
+.Lxly_str_590284f2d8342ab5:
+    .asciz  "\342\224\200\342\224\200 LEVEL 4: Networking \342\224\200\342\224\200"
+.Lxly_str_352d97304bb38791:
+    .asciz  "AF_INET=2 SOCK_STREAM=1"
+.Lxly_str_25d3ee2ede3bd4f5:
+    .asciz  "htons(8080)="
+.Lxly_str_0675bac94ff9ec95:
+    .asciz  "htons"
+.Lxly_str_cafa0dcce12493e8:
+    .asciz  " ntohs(back)="
+.Lxly_str_87fd82a14026fc81:
+    .asciz  "ntohs"
+.Lxly_str_8d1784f95ae887c1:
+    .asciz  "htonl(12345)="
+.Lxly_str_0675abc94ff9d318:
+    .asciz  "htonl"
+.Lxly_str_ca3c2ae9fb6eedbb:
+    .asciz  " ntohl(back)="
+.Lxly_str_87fd6ba14026d56c:
+    .asciz  "ntohl"
+.Lxly_str_e237d419d401ad43:
+    .asciz  "inet_aton(127.0.0.1)="
+.Lxly_str_aabafe7104d914be:
+    .asciz  "127.0.0.1"
+.Lxly_str_898fbb8d0f269200:
+    .asciz  "inet_aton"
+.Lxly_str_88e9be71c631dec5:
+    .asciz  "inet_ntoa(2130706433)="
+.Lxly_str_924628f8d152f1fa:
+    .asciz  "inet_ntoa"
+.Lxly_str_e39475838c6a83e2:
+    .asciz  "\342\224\200\342\224\200 LEVEL 5: High-Resolution Clocks \342\224\200\342\224\200"
+.Lxly_str_f1660e8715d1ee5f:
+    .asciz  "clock_realtime"
+.Lxly_str_4daf414b5679dcc2:
+    .asciz  "realtime:  "
+.Lxly_str_08d8ee07b578b466:
+    .asciz  "s "
+.Lxly_str_08b33d07b5586b66:
+    .asciz  "ns"
+.Lxly_str_455883f8c40ed816:
+    .asciz  "clock_monotonic"
+.Lxly_str_eb2a1f7524ebb175:
+    .asciz  "monotonic: "
+.Lxly_str_2c92f20768d7c85b:
+    .asciz  "clock_process"
+.Lxly_str_4d1e89c11d9ac900:
+    .asciz  "process:   "
+.Lxly_str_ad1fa34caa324af3:
+    .asciz  "gettimeofday"
+.Lxly_str_c09439f52aadd3cd:
+    .asciz  "gtod:      "
+.Lxly_str_08c43d07b566de99:
+    .asciz  "us"
+.Lxly_str_a74abc2d12e71e2c:
+    .asciz  "100k-loop: "
+.Lxly_str_c2a78b17cdd131b0:
+    .asciz  " ns"
+.Lxly_str_11a4ad642a42e3f2:
+    .asciz  "nanosleep"
+.Lxly_str_7978413c8b786fac:
+    .asciz  "nanosleep(500us) done"
+.Lxly_str_ac61c304db41d206:
+    .asciz  "\342\224\200\342\224\200 LEVEL 6: System Info \342\224\200\342\224\200"
+.Lxly_str_8fcb774ec13ecb33:
+    .asciz  "uname"
+.Lxly_str_2f9b0619bf1ea89e:
+    .asciz  "OS="
+.Lxly_str_6e59f3b36fc429bc:
+    .asciz  " Host="
+.Lxly_str_a6fe9b2ffa768182:
+    .asciz  " Arch="
+.Lxly_str_ac9539f92e976c14:
+    .asciz  "CPUs: "
+.Lxly_str_412437824b289735:
+    .asciz  "nproc"
+.Lxly_str_c869b1f6de803b7f:
+    .asciz  " online / "
+.Lxly_str_4d3e4b718803f9ec:
+    .asciz  "nproc_conf"
+.Lxly_str_56340a018f2a940f:
+    .asciz  " configured"
+.Lxly_str_d5bfde81ec26ff2a:
+    .asciz  "PAGE_SIZE"
+.Lxly_str_1f531d3ce6f23592:
+    .asciz  "phys_pages"
+.Lxly_str_2f6941b0c489bb25:
+    .asciz  "avphys_pages"
+.Lxly_str_2d23e7013fbb16d1:
+    .asciz  "PAGE="
+.Lxly_str_e30ce3ecef8127c2:
+    .asciz  "B  RAM="
+.Lxly_str_bf2aa91b67ff1053:
+    .asciz  "MB  FREE="
+.Lxly_str_09167c07b5ad53ce:
+    .asciz  "MB"
+.Lxly_str_60a08f5c682da1fd:
+    .asciz  "Endian="
+.Lxly_str_ba0b418a47180dd2:
+    .asciz  "endian"
+.Lxly_str_642bc9e18a68d1d2:
+    .asciz  " ptr="
+.Lxly_str_feb5f27a94f4d970:
+    .asciz  "sizeof_ptr"
+.Lxly_str_af63ff4c86022805:
+    .asciz  "B"
+.Lxly_str_b40fe693cfc2283d:
+    .asciz  "proc_status available: "
+.Lxly_str_14e5d07eaf05ddfc:
+    .asciz  "/proc/self/status"
+.Lxly_str_81509b185dbfb113:
+    .asciz  "isfile"
+.Lxly_str_ba0cd8d0cf3ded60:
+    .asciz  "\342\224\200\342\224\200 LEVEL 7: Bit & Memory \342\224\200\342\224\200"
+.Lxly_str_4032586494532e8b:
+    .asciz  "bit_set"
+.Lxly_str_30c61f853568abfd:
+    .asciz  "set(0,3,7)="
+.Lxly_str_616945596ec8289c:
+    .asciz  "  bit_get(3)="
+.Lxly_str_a8e23464cfd4705f:
+    .asciz  "bit_get"
+.Lxly_str_2798558e609ad6ba:
+    .asciz  "bit_clear"
+.Lxly_str_408722d9b073ebbd:
+    .asciz  "bit_toggle"
+.Lxly_str_704f37cf466413ba:
+    .asciz  "clear(3)+toggle(5)="
+.Lxly_str_44317ba1e0c2c6d3:
+    .asciz  "bswap32(0x12345678)="
+.Lxly_str_442cba811e6dc6af:
+    .asciz  "bswap32"
+.Lxly_str_1fe00da843046a23:
+    .asciz  "align_up(100,64)="
+.Lxly_str_362ab941ef4bc826:
+    .asciz  "align_up"
+.Lxly_str_7d0dd0b9d1b48d34:
+    .asciz  "align_down(100,64)="
+.Lxly_str_0b75e4e67044f18f:
+    .asciz  "align_down"
+.Lxly_str_b09b3b77dce6c31a:
+    .asciz  "is_pow2(64)="
+.Lxly_str_82f032337109723e:
+    .asciz  "is_pow2"
+.Lxly_str_d6bc92704fa1a151:
+    .asciz  " is_pow2(100)="
+.Lxly_str_17a6679658d35f34:
+    .asciz  "next_pow2(100)="
+.Lxly_str_47c844a6a98ab2d5:
+    .asciz  "next_pow2"
+.Lxly_str_41d5f55028a223b9:
+    .asciz  "popcnt(255)="
+.Lxly_str_b721bbbf9b150aa3:
+    .asciz  "popcnt"
+.Lxly_str_f578a77fcb47f6ef:
+    .asciz  " clz(1)="
+.Lxly_str_f607fb190d03ab00:
+    .asciz  "clz"
+.Lxly_str_d38cbcaa083575f1:
+    .asciz  " ctz(256)="
+.Lxly_str_f5b6fb190cbf53d8:
+    .asciz  "ctz"
+.Lxly_str_c9098c74af0dbff2:
+    .asciz  "parity(255)="
+.Lxly_str_fd514cd7b5839794:
+    .asciz  "parity"
+.Lxly_str_5115397978f9d658:
+    .asciz  " parity(127)="
+.Lxly_str_cc77ecc1316eec97:
+    .asciz  "rol(1,4)="
+.Lxly_str_8a0baa1961118686:
+    .asciz  "rol"
+.Lxly_str_26e7ec5365d1666b:
+    .asciz  " ror(16,4)="
+.Lxly_str_8a0bc4196111b2b4:
+    .asciz  "ror"
+.Lxly_str_7e73cad75d6aee76:
+    .asciz  "sar(-8,2)="
+.Lxly_str_822d95195cd5e891:
+    .asciz  "sar"
+.Lxly_str_6bcb094387054e5c:
+    .asciz  "\342\224\200\342\224\200 LEVEL 8: IPC & Syslog \342\224\200\342\224\200"
+.Lxly_str_bed8c20dc4e85ed9:
+    .asciz  "pipe"
+.Lxly_str_a163764569a8229c:
+    .asciz  "pipe: rfd="
+.Lxly_str_6634d9ab5dd43fc5:
+    .asciz  " wfd="
+.Lxly_str_819cedc06ca52659:
+    .asciz  "IPC:ping"
+.Lxly_str_96c5396646ca1266:
+    .asciz  "pipe msg: "
+.Lxly_str_da596f1d14c59bbf:
+    .asciz  "xenly"
+.Lxly_str_216583cfe3c3e255:
+    .asciz  "openlog"
+.Lxly_str_e5ab66e52aaef56c:
+    .asciz  "Xenly sys demo \342\200\224 all 10 levels operational"
+.Lxly_str_912a2bc7936bc0dc:
+    .asciz  "syslog"
+.Lxly_str_8e5dd535b20e9663:
+    .asciz  "closelog"
+.Lxly_str_cf0d363b1a04434e:
+    .asciz  "Wrote to syslog OK"
+.Lxly_str_9ddab28c08f69fc5:
+    .asciz  "\342\224\200\342\224\200 LEVEL 9: Constants \342\224\200\342\224\200"
+.Lxly_str_27b1d4894d3e5311:
+    .asciz  "O_RDONLY=0 O_CREAT=64 O_NONBLOCK=2048"
+.Lxly_str_415b525c65829b66:
+    .asciz  "SIGKILL=9 SIGTERM=15 SIGUSR1=10"
+.Lxly_str_d63e2fd9c4c0a6a9:
+    .asciz  "LOG_INFO=6 LOG_ERR=3 LOG_DEBUG=7"
+.Lxly_str_3160a080f5d64eba:
+    .asciz  "PROT_READ=1 MAP_ANON=32"
+.Lxly_str_2c1f41583f21197b:
+    .asciz  "POLLIN=1 POLLOUT=4"
+.Lxly_str_a96def7cd6a72c8f:
+    .asciz  "\342\224\200\342\224\200 LEVEL 10: Integer Constants \342\224\200\342\224\200"
+.Lxly_str_9c1b78e6bc66dc1a:
+    .asciz  "INT8:   [-128, 127]"
+.Lxly_str_97567d31098f85ef:
+    .asciz  "INT16:  [-32768, 32767]"
+.Lxly_str_50fe54442b42aba9:
+    .asciz  "INT32:  [-2147483648, 2147483647]"
+.Lxly_str_319dc58f03db015f:
+    .asciz  "UINT8:  [0, 255]"
+.Lxly_str_220b5adf305b0ce0:
+    .asciz  "UINT16: [0, 65535]"
+.Lxly_str_8067947dc8d4ba41:
+    .asciz  "UINT32: [0, 4294967295]"
+.Lxly_str_86c5f12f2dd3500c:
+    .asciz  "INT_MAX=2147483647 LONG_MAX="
+.Lxly_str_3f19c374651c8412:
+    .asciz  "LONG_MAX"
+.Lxly_str_76857cebdcafe974:
+    .asciz  "STDIN=0 STDOUT=1 STDERR=2"
+.Lxly_str_1e66ab2d211ef5ca:
+    .asciz  "\342\225\221  All 10 levels verified. sys module at full power.   \342\225\221"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   31
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   248
@@ -0,0 +1,8017 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $5312, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -5312(%rbp)
+    movq    %rax, -5304(%rbp)
+    movq    %rax, -5296(%rbp)
+    movq    %rax, -5288(%rbp)
+    movq    %rax, -5280(%rbp)
+    movq    %rax, -5272(%rbp)
+    movq    %rax, -5264(%rbp)
+    movq    %rax, -5256(%rbp)
+    movq    %rax, -5248(%rbp)
+    movq    %rax, -5240(%rbp)
+    movq    %rax, -5232(%rbp)
+    movq    %rax, -5224(%rbp)
+    movq    %rax, -5216(%rbp)
+    movq    %rax, -5208(%rbp)
+    movq    %rax, -5200(%rbp)
+    movq    %rax, -5192(%rbp)
+    movq    %rax, -5184(%rbp)
+    movq    %rax, -5176(%rbp)
+    movq    %rax, -5168(%rbp)
+    movq    %rax, -5160(%rbp)
+    movq    %rax, -5152(%rbp)
+    movq    %rax, -5144(%rbp)
+    movq    %rax, -5136(%rbp)
+    movq    %rax, -5128(%rbp)
+    movq    %rax, -5120(%rbp)
+    movq    %rax, -5112(%rbp)
+    movq    %rax, -5104(%rbp)
+    movq    %rax, -5096(%rbp)
+    movq    %rax, -5088(%rbp)
+    movq    %rax, -5080(%rbp)
+    movq    %rax, -5072(%rbp)
+    movq    %rax, -5064(%rbp)
+    movq    %rax, -5056(%rbp)
+    movq    %rax, -5048(%rbp)
+    movq    %rax, -5040(%rbp)
+    movq    %rax, -5032(%rbp)
+    movq    %rax, -5024(%rbp)
+    movq    %rax, -5016(%rbp)
+    movq    %rax, -5008(%rbp)
+    movq    %rax, -5000(%rbp)
+    movq    %rax, -4992(%rbp)
+    movq    %rax, -4984(%rbp)
+    movq    %rax, -4976(%rbp)
+    movq    %rax, -4968(%rbp)
+    movq    %rax, -4960(%rbp)
+    movq    %rax, -4952(%rbp)
+    movq    %rax, -4944(%rbp)
+    movq    %rax, -4936(%rbp)
+    movq    %rax, -4928(%rbp)
+    movq    %rax, -4920(%rbp)
+    movq    %rax, -4912(%rbp)
+    movq    %rax, -4904(%rbp)
+    movq    %rax, -4896(%rbp)
+    movq    %rax, -4888(%rbp)
+    movq    %rax, -4880(%rbp)
+    movq    %rax, -4872(%rbp)
+    movq    %rax, -4864(%rbp)
+    movq    %rax, -4856(%rbp)
+    movq    %rax, -4848(%rbp)
+    movq    %rax, -4840(%rbp)
+    movq    %rax, -4832(%rbp)
+    movq    %rax, -4824(%rbp)
+    movq    %rax, -4816(%rbp)
+    movq    %rax, -4808(%rbp)
+    movq    %rax, -4800(%rbp)
+    movq    %rax, -4792(%rbp)
+    movq    %rax, -4784(%rbp)
+    movq    %rax, -4776(%rbp)
+    movq    %rax, -4768(%rbp)
+    movq    %rax, -4760(%rbp)
+    movq    %rax, -4752(%rbp)
+    movq    %rax, -4744(%rbp)
+    movq    %rax, -4736(%rbp)
+    movq    %rax, -4728(%rbp)
+    movq    %rax, -4720(%rbp)
+    movq    %rax, -4712(%rbp)
+    movq    %rax, -4704(%rbp)
+    movq    %rax, -4696(%rbp)
+    movq    %rax, -4688(%rbp)
+    movq    %rax, -4680(%rbp)
+    movq    %rax, -4672(%rbp)
+    movq    %rax, -4664(%rbp)
+    movq    %rax, -4656(%rbp)
+    movq    %rax, -4648(%rbp)
+    movq    %rax, -4640(%rbp)
+    movq    %rax, -4632(%rbp)
+    movq    %rax, -4624(%rbp)
+    movq    %rax, -4616(%rbp)
+    movq    %rax, -4608(%rbp)
+    movq    %rax, -4600(%rbp)
+    movq    %rax, -4592(%rbp)
+    movq    %rax, -4584(%rbp)
+    movq    %rax, -4576(%rbp)
+    movq    %rax, -4568(%rbp)
+    movq    %rax, -4560(%rbp)
+    movq    %rax, -4552(%rbp)
+    movq    %rax, -4544(%rbp)
+    movq    %rax, -4536(%rbp)
+    movq    %rax, -4528(%rbp)
+    movq    %rax, -4520(%rbp)
+    movq    %rax, -4512(%rbp)
+    movq    %rax, -4504(%rbp)
+    movq    %rax, -4496(%rbp)
+    movq    %rax, -4488(%rbp)
+    movq    %rax, -4480(%rbp)
+    movq    %rax, -4472(%rbp)
+    movq    %rax, -4464(%rbp)
+    movq    %rax, -4456(%rbp)
+    movq    %rax, -4448(%rbp)
+    movq    %rax, -4440(%rbp)
+    movq    %rax, -4432(%rbp)
+    movq    %rax, -4424(%rbp)
+    movl    $-1, -5276(%rbp)
+    movl    $-1, -5148(%rbp)
+    movl    $-1, -5020(%rbp)
+    movl    $-1, -4892(%rbp)
+    movl    $-1, -4764(%rbp)
+    movl    $-1, -4636(%rbp)
+    movl    $-1, -4508(%rbp)
+    movabsq $0x4041000000000000, %rax
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_ir0_k1269(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x4032000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k1270(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movabsq $0x4048000000000000, %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k1271(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    movabsq $0x404a000000000000, %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir0_k1272(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k1273(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movabsq $0x403c000000000000, %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k1274(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+    movabsq $0x4041800000000000, %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_ir0_k1275(%rip), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k1276(%rip), %rax
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -152(%rbp)
+    movabsq $0x4043000000000000, %rax
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_ir0_k1277(%rip), %rax
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    movabsq $0x4049800000000000, %rax
+    movq    %rax, -184(%rbp)
+    leaq    .Lxly_ir0_k1278(%rip), %rax
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    movabsq $0x404f800000000000, %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k1279(%rip), %rax
+    movq    %rax, -216(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -216(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -224(%rbp)
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k1280(%rip), %rax
+    movq    %rax, -240(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_ir0_k1281(%rip), %rax
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -256(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+    movabsq $0x4051c00000000000, %rax
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_ir0_k1282(%rip), %rax
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+    movabsq $0x4055000000000000, %rax
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_ir0_k1283(%rip), %rax
+    movq    %rax, -304(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -312(%rbp)
+    movabsq $0x4053400000000000, %rax
+    movq    %rax, -320(%rbp)
+    leaq    .Lxly_ir0_k1284(%rip), %rax
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movabsq $0x4051400000000000, %rax
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_ir0_k1285(%rip), %rax
+    movq    %rax, -352(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -360(%rbp)
+    movabsq $0x4052400000000000, %rax
+    movq    %rax, -368(%rbp)
+    leaq    .Lxly_ir0_k1286(%rip), %rax
+    movq    %rax, -376(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -384(%rbp)
+    movabsq $0x4050400000000000, %rax
+    movq    %rax, -392(%rbp)
+    leaq    .Lxly_ir0_k1287(%rip), %rax
+    movq    %rax, -400(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -408(%rbp)
+    movabsq $0x404d000000000000, %rax
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_ir0_k1288(%rip), %rax
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -424(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+    movabsq $0x404e800000000000, %rax
+    movq    %rax, -440(%rbp)
+    leaq    .Lxly_ir0_k1289(%rip), %rax
+    movq    %rax, -448(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -456(%rbp)
+    leaq    .Lxly_ir0_k1290(%rip), %rax
+    movq    %rax, -464(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -464(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -472(%rbp)
+    leaq    .Lxly_ir0_k1291(%rip), %rax
+    movq    %rax, -480(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -480(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -488(%rbp)
+    movabsq $0x4048800000000000, %rax
+    movq    %rax, -496(%rbp)
+    leaq    .Lxly_ir0_k1292(%rip), %rax
+    movq    %rax, -504(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -504(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -512(%rbp)
+    leaq    .Lxly_ir0_k1293(%rip), %rax
+    movq    %rax, -520(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -520(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -528(%rbp)
+    movabsq $0x40b8600000000000, %rax
+    movq    %rax, -536(%rbp)
+    leaq    .Lxly_ir0_k1294(%rip), %rax
+    movq    %rax, -544(%rbp)
+    movq    -544(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x40a1080000000000, %rax
+    movq    %rax, -552(%rbp)
+    leaq    .Lxly_ir0_k1295(%rip), %rax
+    movq    %rax, -560(%rbp)
+    movq    -560(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x40bf1c0000000000, %rax
+    movq    %rax, -568(%rbp)
+    leaq    .Lxly_ir0_k1296(%rip), %rax
+    movq    %rax, -576(%rbp)
+    movq    -576(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movabsq $0x40d0000000000000, %rax
+    movq    %rax, -584(%rbp)
+    leaq    .Lxly_ir0_k1297(%rip), %rax
+    movq    %rax, -592(%rbp)
+    movq    -592(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movabsq $0x4061c00000000000, %rax
+    movq    %rax, -600(%rbp)
+    leaq    .Lxly_ir0_k1298(%rip), %rax
+    movq    %rax, -608(%rbp)
+    movq    -608(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    movabsq $0x4055c00000000000, %rax
+    movq    %rax, -616(%rbp)
+    leaq    .Lxly_ir0_k1299(%rip), %rax
+    movq    %rax, -624(%rbp)
+    movq    -624(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movabsq $0x4078300000000000, %rax
+    movq    %rax, -632(%rbp)
+    leaq    .Lxly_ir0_k1300(%rip), %rax
+    movq    %rax, -640(%rbp)
+    movq    -640(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x4080000000000000, %rax
+    movq    %rax, -648(%rbp)
+    leaq    .Lxly_ir0_k1301(%rip), %rax
+    movq    %rax, -656(%rbp)
+    movq    -656(%rbp), %rax
+    movq    %rax, __xly_globals+96(%rip)
+    movabsq $0x405f000000000000, %rax
+    movq    %rax, -664(%rbp)
+    leaq    .Lxly_ir0_k1302(%rip), %rax
+    movq    %rax, -672(%rbp)
+    movq    -672(%rbp), %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_ir0_k1303(%rip), %rax
+    movq    %rax, -680(%rbp)
+    movq    -680(%rbp), %rax
+    movq    %rax, __xly_globals+112(%rip)
+    movabsq $0x40c0720000000000, %rax
+    movq    %rax, -688(%rbp)
+    leaq    .Lxly_ir0_k1304(%rip), %rax
+    movq    %rax, -696(%rbp)
+    movq    -696(%rbp), %rax
+    movq    %rax, __xly_globals+120(%rip)
+    movabsq $0x40b40a0000000000, %rax
+    movq    %rax, -704(%rbp)
+    leaq    .Lxly_ir0_k1305(%rip), %rax
+    movq    %rax, -712(%rbp)
+    movq    -712(%rbp), %rax
+    movq    %rax, __xly_globals+128(%rip)
+    leaq    .Lxly_ir0_k1306(%rip), %rax
+    movq    %rax, -720(%rbp)
+    subq    $16, %rsp
+    movq    -720(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -728(%rbp)
+    movq    -728(%rbp), %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_ir0_k1307(%rip), %rax
+    movq    %rax, -736(%rbp)
+    subq    $16, %rsp
+    movq    -736(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -744(%rbp)
+    movq    -744(%rbp), %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_ir0_k1308(%rip), %rax
+    movq    %rax, -752(%rbp)
+    subq    $16, %rsp
+    movq    -752(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -760(%rbp)
+    movq    -760(%rbp), %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_ir0_k1309(%rip), %rax
+    movq    %rax, -768(%rbp)
+    subq    $16, %rsp
+    movq    -768(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -776(%rbp)
+    movq    -776(%rbp), %rax
+    movq    %rax, __xly_globals+160(%rip)
+    leaq    .Lxly_ir0_k1310(%rip), %rax
+    movq    %rax, -784(%rbp)
+    subq    $16, %rsp
+    movq    -784(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -792(%rbp)
+    movq    -792(%rbp), %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_da596f1d14c59bbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -800(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -800(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -808(%rbp)
+    leaq    .Lxly_str_437cf5d8938c2e92(%rip), %rdi
+    call    xly_str
+    movq    %rax, -816(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -816(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -824(%rbp)
+    leaq    .Lxly_str_8538cc0255887a22(%rip), %rdi
+    call    xly_str
+    movq    %rax, -832(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -832(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -840(%rbp)
+    leaq    .Lxly_str_22c60f18047f4233(%rip), %rdi
+    call    xly_str
+    movq    %rax, -848(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -848(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -856(%rbp)
+    leaq    .Lxly_str_60147fb4fa4a8e0c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -864(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -872(%rbp)
+    leaq    .Lxly_str_3b155ae7ca54d6ae(%rip), %rdi
+    call    xly_str
+    movq    %rax, -880(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -880(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -888(%rbp)
+    leaq    .Lxly_str_1f93b0f102fffa25(%rip), %rdi
+    call    xly_str
+    movq    %rax, -896(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -896(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -904(%rbp)
+    leaq    .Lxly_str_c8b811f0d1bca936(%rip), %rdi
+    call    xly_str
+    movq    %rax, -912(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -912(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -920(%rbp)
+    leaq    .Lxly_str_0f27f30b304798ac(%rip), %rdi
+    call    xly_str
+    movq    %rax, -928(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -928(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -936(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -944(%rbp)
+    leaq    .Lxly_str_f79a102f6f885c2f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -952(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -952(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -960(%rbp)
+    leaq    .Lxly_str_0d8959f0f8944da2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -968(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -968(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -976(%rbp)
+    leaq    .Lxly_str_6089ab1827cd4a50(%rip), %rdi
+    call    xly_str
+    movq    %rax, -984(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -984(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -992(%rbp)
+    leaq    .Lxly_str_456fbb181822b8f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1000(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1000(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1008(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1016(%rbp)
+    leaq    .Lxly_str_a30c3ff3148ac374(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1024(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1024(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1032(%rbp)
+    leaq    .Lxly_str_c8f8a7f0d1f38c0d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1040(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1040(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1048(%rbp)
+    leaq    .Lxly_str_4e18e6181d0a2fb1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1056(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1056(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1064(%rbp)
+    leaq    .Lxly_str_602db018277ef422(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1072(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1072(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1080(%rbp)
+    leaq    .Lxly_str_bbb5ea4a0cfc5400(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1088(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1088(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1096(%rbp)
+    leaq    .Lxly_str_de15d40af1bbd619(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1104(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1112(%rbp)
+    leaq    .Lxly_str_183e2d0b358bfac4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1120(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1128(%rbp)
+    leaq    .Lxly_str_2bc4c11809afde52(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1136(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1144(%rbp)
+    leaq    .Lxly_str_454dc7181805e6f4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1152(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -1152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1160(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -864(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1168(%rbp)
+    leaq    .Lxly_str_bb663df102a2ded1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1176(%rbp)
+    movq    -1176(%rbp), %rax
+    movq    %rax, __xly_globals+176(%rip)
+    xorq    %rdx, %rdx
+    leaq    .Lxly_str_08b05507b5565e57(%rip), %rdi
+    leaq    .Lxly_str_3e4bd4e31c5c3ad2(%rip), %rsi
+    movl    $0, %ecx
+    call    xly_call_module
+    movq    %rax, -1184(%rbp)
+    movq    -1184(%rbp), %rax
+    movq    %rax, __xly_globals+184(%rip)
+    leaq    .Lxly_str_4ba3070467d44630(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1192(%rbp)
+    movq    -1192(%rbp), %rax
+    movq    %rax, __xly_globals+192(%rip)
+    leaq    .Lxly_str_2e15ee8f4339d22e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1200(%rbp)
+    movq    -1200(%rbp), %rax
+    movq    %rax, __xly_globals+200(%rip)
+    movabsq $0x40430b0000000000, %rax
+    movq    %rax, -1208(%rbp)
+    leaq    .Lxly_ir0_k1311(%rip), %rax
+    movq    %rax, -1216(%rbp)
+    movq    -1216(%rbp), %rax
+    movq    %rax, __xly_globals+208(%rip)
+    movabsq $0x402a9c8000000000, %rax
+    movq    %rax, -1224(%rbp)
+    leaq    .Lxly_ir0_k1312(%rip), %rax
+    movq    %rax, -1232(%rbp)
+    movq    -1232(%rbp), %rax
+    movq    %rax, __xly_globals+216(%rip)
+    movabsq $0x4052e58000000000, %rax
+    movq    %rax, -1240(%rbp)
+    leaq    .Lxly_ir0_k1313(%rip), %rax
+    movq    %rax, -1248(%rbp)
+    movq    -1248(%rbp), %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1256(%rbp)
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1264(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -1272(%rbp)
+    leaq    .Lxly_str_e3529f90ab1affe5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1280(%rbp)
+    movq    -1280(%rbp), %rdi
+    movq    -1184(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -4536(%rbp)
+    leaq    -4544(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -1288(%rbp)
+    leaq    .Lxly_str_e5a64fb7d5181c8c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1296(%rbp)
+    movq    -1288(%rbp), %rdi
+    movq    -1296(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -4664(%rbp)
+    leaq    -4672(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -1304(%rbp)
+    movq    -1304(%rbp), %rdi
+    movq    -1192(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, -1312(%rbp)
+    leaq    .Lxly_ir0_k1314(%rip), %rax
+    movq    %rax, -1320(%rbp)
+    movq    -1320(%rbp), %rdi
+    movq    -1312(%rbp), %rsi
+    call    .Lxly_fn_statusBar
+    movq    %rax, -1328(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -1336(%rbp)
+    movabsq $0x4022000000000000, %rax
+    movq    %rax, -1344(%rbp)
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -1352(%rbp)
+    leaq    .Lxly_str_0b453a19aa0f85a9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1360(%rbp)
+    leaq    .Lxly_ir0_k1315(%rip), %rax
+    movq    %rax, -1368(%rbp)
+    leaq    .Lxly_ir0_k1316(%rip), %rax
+    movq    %rax, -1376(%rbp)
+    leaq    .Lxly_ir0_k1317(%rip), %rax
+    movq    %rax, -1384(%rbp)
+    leaq    .Lxly_ir0_k1318(%rip), %rax
+    movq    %rax, -1392(%rbp)
+    movq    -1368(%rbp), %rdi
+    movq    -1376(%rbp), %rsi
+    movq    -1384(%rbp), %rdx
+    movq    -1392(%rbp), %rcx
+    movq    -1360(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -1400(%rbp)
+.Lxly_ir0_b46:
+    leaq    .Lxly_str_6ef4d6d8ac36494b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1408(%rbp)
+    subq    $16, %rsp
+    movq    -1408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1416(%rbp)
+.Lxly_ir0_b45:
+.Lxly_ir0_b48:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1424(%rbp)
+.Lxly_ir0_b47:
+.Lxly_ir0_b50:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1432(%rbp)
+.Lxly_ir0_b49:
+    leaq    .Lxly_str_27cabb4da1a1484d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1440(%rbp)
+    subq    $16, %rsp
+    movq    -1440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1448(%rbp)
+.Lxly_ir0_b52:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1456(%rbp)
+.Lxly_ir0_b51:
+.Lxly_ir0_b54:
+    leaq    .Lxly_str_aff0e92c973beca2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1464(%rbp)
+.Lxly_ir0_b53:
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -1472(%rbp)
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -1480(%rbp)
+    leaq    .Lxly_ir0_k1319(%rip), %rax
+    movq    %rax, -1488(%rbp)
+    leaq    .Lxly_ir0_k1320(%rip), %rax
+    movq    %rax, -1496(%rbp)
+    leaq    .Lxly_ir0_k1321(%rip), %rax
+    movq    %rax, -1504(%rbp)
+    movq    -1464(%rbp), %rdi
+    movq    -1488(%rbp), %rsi
+    movq    -1496(%rbp), %rdx
+    movq    -1504(%rbp), %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, -1512(%rbp)
+.Lxly_ir0_b56:
+    leaq    .Lxly_str_ec76a0cfd555b9aa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1520(%rbp)
+    subq    $16, %rsp
+    movq    -1520(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1528(%rbp)
+.Lxly_ir0_b55:
+.Lxly_ir0_b58:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1536(%rbp)
+.Lxly_ir0_b57:
+.Lxly_ir0_b60:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1544(%rbp)
+.Lxly_ir0_b59:
+    leaq    .Lxly_str_a4eaf65a788e7fc8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1552(%rbp)
+    subq    $16, %rsp
+    movq    -1552(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1560(%rbp)
+.Lxly_ir0_b62:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1568(%rbp)
+.Lxly_ir0_b61:
+.Lxly_ir0_b64:
+    leaq    .Lxly_str_135e932778094b31(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1576(%rbp)
+.Lxly_ir0_b63:
+    leaq    .Lxly_ir0_k1322(%rip), %rax
+    movq    %rax, -1584(%rbp)
+    leaq    .Lxly_ir0_k1323(%rip), %rax
+    movq    %rax, -1592(%rbp)
+    leaq    .Lxly_ir0_k1324(%rip), %rax
+    movq    %rax, -1600(%rbp)
+    movq    -1576(%rbp), %rdi
+    movq    -1584(%rbp), %rsi
+    movq    -1592(%rbp), %rdx
+    movq    -1600(%rbp), %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, -1608(%rbp)
+.Lxly_ir0_b66:
+    leaq    .Lxly_str_700342ea56a0a5f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1616(%rbp)
+    subq    $16, %rsp
+    movq    -1616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1624(%rbp)
+.Lxly_ir0_b65:
+.Lxly_ir0_b68:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1632(%rbp)
+.Lxly_ir0_b67:
+.Lxly_ir0_b70:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1640(%rbp)
+.Lxly_ir0_b69:
+    leaq    .Lxly_str_8fbb08d9410c7736(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1648(%rbp)
+    subq    $16, %rsp
+    movq    -1648(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1656(%rbp)
+.Lxly_ir0_b72:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1664(%rbp)
+.Lxly_ir0_b71:
+.Lxly_ir0_b74:
+    leaq    .Lxly_str_083ec1313d69299c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1672(%rbp)
+.Lxly_ir0_b73:
+    leaq    .Lxly_ir0_k1325(%rip), %rax
+    movq    %rax, -1680(%rbp)
+    leaq    .Lxly_ir0_k1326(%rip), %rax
+    movq    %rax, -1688(%rbp)
+    leaq    .Lxly_ir0_k1327(%rip), %rax
+    movq    %rax, -1696(%rbp)
+    movq    -1672(%rbp), %rdi
+    movq    -1680(%rbp), %rsi
+    movq    -1688(%rbp), %rdx
+    movq    -1696(%rbp), %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, -1704(%rbp)
+.Lxly_ir0_b76:
+    leaq    .Lxly_str_3417a4e1a816148c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1712(%rbp)
+    subq    $16, %rsp
+    movq    -1712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1720(%rbp)
+.Lxly_ir0_b75:
+.Lxly_ir0_b78:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1728(%rbp)
+.Lxly_ir0_b77:
+.Lxly_ir0_b80:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1736(%rbp)
+.Lxly_ir0_b79:
+    leaq    .Lxly_str_5a1e8c9d28b02fb9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1744(%rbp)
+    subq    $16, %rsp
+    movq    -1744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1752(%rbp)
+.Lxly_ir0_b82:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1760(%rbp)
+.Lxly_ir0_b81:
+.Lxly_ir0_b84:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1768(%rbp)
+.Lxly_ir0_b83:
+    leaq    .Lxly_str_2bf4291809d7ffcc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1776(%rbp)
+    subq    $16, %rsp
+    movq    -1776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1784(%rbp)
+.Lxly_ir0_b86:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1792(%rbp)
+.Lxly_ir0_b85:
+.Lxly_ir0_b88:
+    leaq    .Lxly_str_17cd673defa59b77(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1800(%rbp)
+    subq    $16, %rsp
+    movq    -1800(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1808(%rbp)
+.Lxly_ir0_b87:
+.Lxly_ir0_b90:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1816(%rbp)
+.Lxly_ir0_b89:
+    leaq    .Lxly_str_550d58626e5bc3af(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1824(%rbp)
+    subq    $16, %rsp
+    movq    -1824(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1832(%rbp)
+.Lxly_ir0_b92:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1840(%rbp)
+.Lxly_ir0_b91:
+.Lxly_ir0_b94:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1848(%rbp)
+.Lxly_ir0_b93:
+    subq    $16, %rsp
+    movq    -1200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1856(%rbp)
+.Lxly_ir0_b96:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1864(%rbp)
+.Lxly_ir0_b95:
+.Lxly_ir0_b98:
+    leaq    .Lxly_str_976ee1351a92ea46(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1872(%rbp)
+    subq    $16, %rsp
+    movq    -1872(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1880(%rbp)
+.Lxly_ir0_b97:
+    leaq    .Lxly_ir0_k1328(%rip), %rax
+    movq    %rax, -1888(%rbp)
+    leaq    .Lxly_ir0_k1329(%rip), %rax
+    movq    %rax, -1896(%rbp)
+    movq    -1888(%rbp), %rdi
+    movq    -1896(%rbp), %rsi
+    call    .Lxly_fn_seqPos
+    movq    %rax, -1904(%rbp)
+    leaq    .Lxly_ir0_k1330(%rip), %rax
+    movq    %rax, -1912(%rbp)
+    movq    -1904(%rbp), %rdi
+    movq    %r13, %rsi
+    movq    -1912(%rbp), %rdx
+    call    .Lxly_fn_sparkline
+    movq    %rax, -1920(%rbp)
+.Lxly_ir0_b100:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_ir0_b99:
+    leaq    .Lxly_str_f9019e7dbd9677c7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1928(%rbp)
+.Lxly_ir0_b102:
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_ir0_b101:
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -1936(%rbp)
+    leaq    .Lxly_ir0_k1331(%rip), %rax
+    movq    %rax, -1944(%rbp)
+    leaq    .Lxly_ir0_k1332(%rip), %rax
+    movq    %rax, -1952(%rbp)
+    movq    -1944(%rbp), %rdi
+    movq    -1952(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -1960(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -1968(%rbp)
+    leaq    .Lxly_str_f1112f84cf0cdcd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1976(%rbp)
+    subq    $16, %rsp
+    movq    -1976(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1984(%rbp)
+    call    .Lxly_fn_fgBrightRed
+    movq    %rax, -1992(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2000(%rbp)
+    leaq    .Lxly_str_6878f873c41cdbf2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2008(%rbp)
+    subq    $16, %rsp
+    movq    -2008(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2016(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2024(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -2032(%rbp)
+    leaq    .Lxly_str_4c2cf42285d2735b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2040(%rbp)
+    subq    $16, %rsp
+    movq    -2040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2048(%rbp)
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, -2056(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2064(%rbp)
+    leaq    .Lxly_str_81fb1373d26ce995(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2072(%rbp)
+    subq    $16, %rsp
+    movq    -2072(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2080(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2088(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -2096(%rbp)
+    leaq    .Lxly_str_98897cdad8cb19cf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2104(%rbp)
+    subq    $16, %rsp
+    movq    -2104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2112(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2120(%rbp)
+    leaq    .Lxly_ir0_k1333(%rip), %rax
+    movq    %rax, -2128(%rbp)
+    movq    -2128(%rbp), %rdi
+    call    .Lxly_fn_usageFg
+    movq    %rax, -2136(%rbp)
+    leaq    .Lxly_str_820f6f73d27e2ef3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2144(%rbp)
+    subq    $16, %rsp
+    movq    -2144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2152(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2160(%rbp)
+    leaq    .Lxly_str_16e1bead7b9c95ce(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2168(%rbp)
+    leaq    .Lxly_ir0_k1334(%rip), %rax
+    movq    %rax, -2176(%rbp)
+    leaq    .Lxly_ir0_k1335(%rip), %rax
+    movq    %rax, -2184(%rbp)
+    leaq    .Lxly_ir0_k1336(%rip), %rax
+    movq    %rax, -2192(%rbp)
+    leaq    .Lxly_ir0_k1337(%rip), %rax
+    movq    %rax, -2200(%rbp)
+    movq    -2176(%rbp), %rdi
+    movq    -2184(%rbp), %rsi
+    movq    -2192(%rbp), %rdx
+    movq    -2200(%rbp), %rcx
+    movq    -2168(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -2208(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -2216(%rbp)
+    movabsq $0x404b000000000000, %rax
+    movq    %rax, -2224(%rbp)
+    leaq    .Lxly_ir0_k1338(%rip), %rax
+    movq    %rax, -2232(%rbp)
+    leaq    .Lxly_ir0_k1339(%rip), %rax
+    movq    %rax, -2240(%rbp)
+    movq    -2232(%rbp), %rdi
+    movq    -2240(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2248(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2256(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2264(%rbp)
+    leaq    .Lxly_str_44765936d178efce(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2272(%rbp)
+    subq    $16, %rsp
+    movq    -2272(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2280(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2288(%rbp)
+    leaq    .Lxly_ir0_k1340(%rip), %rax
+    movq    %rax, -2296(%rbp)
+    leaq    .Lxly_ir0_k1341(%rip), %rax
+    movq    %rax, -2304(%rbp)
+    movq    -2296(%rbp), %rdi
+    movq    -2304(%rbp), %rsi
+    call    .Lxly_fn_seqPos
+    movq    %rax, -2312(%rbp)
+    movabsq $0x402a000000000000, %rax
+    movq    %rax, -2320(%rbp)
+    leaq    .Lxly_ir0_k1342(%rip), %rax
+    movq    %rax, -2328(%rbp)
+    leaq    .Lxly_ir0_k1343(%rip), %rax
+    movq    %rax, -2336(%rbp)
+    leaq    .Lxly_ir0_k1344(%rip), %rax
+    movq    %rax, -2344(%rbp)
+    movq    -2312(%rbp), %rdi
+    movq    -2328(%rbp), %rsi
+    movq    -2336(%rbp), %rdx
+    movq    -2344(%rbp), %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, -2352(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -2360(%rbp)
+    leaq    .Lxly_ir0_k1345(%rip), %rax
+    movq    %rax, -2368(%rbp)
+    leaq    .Lxly_ir0_k1346(%rip), %rax
+    movq    %rax, -2376(%rbp)
+    movq    -2368(%rbp), %rdi
+    movq    -2376(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2384(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2392(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2400(%rbp)
+    leaq    .Lxly_str_bdbc024b9ec59d17(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2408(%rbp)
+    subq    $16, %rsp
+    movq    -2408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2416(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2424(%rbp)
+    call    .Lxly_fn_fgBrightCyan
+    movq    %rax, -2432(%rbp)
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2440(%rbp)
+    subq    $16, %rsp
+    movq    -2440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2448(%rbp)
+    leaq    .Lxly_ir0_k1347(%rip), %rax
+    movq    %rax, -2456(%rbp)
+    movq    -2456(%rbp), %rax
+    movq    %rax, __xly_globals+232(%rip)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -2464(%rbp)
+    movabsq $0x3ffbad0000000000, %rax
+    movq    %rax, -2472(%rbp)
+    leaq    .Lxly_str_56700d1b88794f0e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2480(%rbp)
+    leaq    .Lxly_str_56700b1b88794ba8(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2488(%rbp)
+    movq    %r15, %rbx
+.Lxly_ir0_b1:
+    movq    %rbx, %xmm0
+    movq    -2464(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -2496(%rbp)
+    cmpq    $0, -2496(%rbp)
+    je      .Lxly_ir0_b3
+.Lxly_ir0_b2:
+    movq    %rbx, %xmm0
+    movq    -2472(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -2504(%rbp)
+    cmpq    $0, -2504(%rbp)
+    je      .Lxly_ir0_b5
+.Lxly_ir0_b4:
+    subq    $16, %rsp
+    movq    -2480(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2512(%rbp)
+.Lxly_ir0_b5:
+    movq    %rbx, %xmm0
+    movq    -2472(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -2520(%rbp)
+    cmpq    $0, -2520(%rbp)
+    je      .Lxly_ir0_b7
+.Lxly_ir0_b6:
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -2528(%rbp)
+    subq    $16, %rsp
+    movq    -2488(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2536(%rbp)
+    call    .Lxly_fn_fgBrightCyan
+    movq    %rax, -2544(%rbp)
+.Lxly_ir0_b7:
+    movq    %rbx, %xmm0
+    movq    -1272(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+232(%rip)
+    movq    %r14, %rbx
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b3:
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_dc81b79f8fc40e41(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    .Lxly_fn_reset
+    movq    %rax, %rbx
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -2552(%rbp)
+    leaq    .Lxly_ir0_k1349(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1350(%rip), %rax
+    movq    %rax, -2560(%rbp)
+    movq    %r14, %rdi
+    movq    -2560(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2568(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, %r14
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r14
+    leaq    .Lxly_str_53cc857f4946f82b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2576(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r14
+    leaq    .Lxly_str_a41e08c4148859e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2584(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1351(%rip), %rax
+    movq    %rax, -2592(%rbp)
+    leaq    .Lxly_ir0_k1352(%rip), %rax
+    movq    %rax, -2600(%rbp)
+    movq    -2592(%rbp), %rdi
+    movq    -2600(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2608(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2616(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2624(%rbp)
+    leaq    .Lxly_str_d30860f2a4908ddf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2632(%rbp)
+    subq    $16, %rsp
+    movq    -2632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2640(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2648(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2656(%rbp)
+    leaq    .Lxly_str_717d123413edb7c2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2664(%rbp)
+    subq    $16, %rsp
+    movq    -2664(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2672(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2680(%rbp)
+    leaq    .Lxly_ir0_k1353(%rip), %rax
+    movq    %rax, -2688(%rbp)
+    leaq    .Lxly_ir0_k1354(%rip), %rax
+    movq    %rax, -2696(%rbp)
+    movq    -2688(%rbp), %rdi
+    movq    -2696(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2704(%rbp)
+.Lxly_ir0_b9:
+.Lxly_ir0_b11:
+.Lxly_ir0_b14:
+    call    .Lxly_fn_bgGreen
+    movq    %rax, -2712(%rbp)
+    call    .Lxly_fn_fgBlack
+    movq    %rax, -2720(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2728(%rbp)
+    leaq    .Lxly_str_9090fc6758e5bee0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2736(%rbp)
+    subq    $16, %rsp
+    movq    -2736(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2744(%rbp)
+.Lxly_ir0_b15:
+    call    .Lxly_fn_reset
+    movq    %rax, -2752(%rbp)
+    leaq    .Lxly_str_b752b6bfab83174d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2760(%rbp)
+    leaq    .Lxly_ir0_k1355(%rip), %rax
+    movq    %rax, -2768(%rbp)
+    leaq    .Lxly_ir0_k1356(%rip), %rax
+    movq    %rax, -2776(%rbp)
+    leaq    .Lxly_ir0_k1357(%rip), %rax
+    movq    %rax, -2784(%rbp)
+    leaq    .Lxly_ir0_k1358(%rip), %rax
+    movq    %rax, -2792(%rbp)
+    movq    -2768(%rbp), %rdi
+    movq    -2776(%rbp), %rsi
+    movq    -2784(%rbp), %rdx
+    movq    -2792(%rbp), %rcx
+    movq    -2760(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -2800(%rbp)
+    movabsq $0x402c000000000000, %rax
+    movq    %rax, -2808(%rbp)
+    leaq    .Lxly_ir0_k1359(%rip), %rax
+    movq    %rax, -2816(%rbp)
+    leaq    .Lxly_ir0_k1360(%rip), %rax
+    movq    %rax, -2824(%rbp)
+    movq    -2816(%rbp), %rdi
+    movq    -2824(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2832(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2840(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2848(%rbp)
+    leaq    .Lxly_str_99e03c77a8fa40be(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2856(%rbp)
+    subq    $16, %rsp
+    movq    -2856(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2864(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2872(%rbp)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, -2880(%rbp)
+    leaq    .Lxly_ir0_k1361(%rip), %rax
+    movq    %rax, -2888(%rbp)
+    leaq    .Lxly_ir0_k1362(%rip), %rax
+    movq    %rax, -2896(%rbp)
+    movq    -2888(%rbp), %rdi
+    movq    -2896(%rbp), %rsi
+    call    .Lxly_fn_seqPos
+    movq    %rax, -2904(%rbp)
+    leaq    .Lxly_ir0_k1363(%rip), %rax
+    movq    %rax, -2912(%rbp)
+    leaq    .Lxly_ir0_k1364(%rip), %rax
+    movq    %rax, -2920(%rbp)
+    leaq    .Lxly_ir0_k1365(%rip), %rax
+    movq    %rax, -2928(%rbp)
+    movq    -2904(%rbp), %rdi
+    movq    -2912(%rbp), %rsi
+    movq    -2920(%rbp), %rdx
+    movq    -2928(%rbp), %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, -2936(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -2944(%rbp)
+    leaq    .Lxly_ir0_k1366(%rip), %rax
+    movq    %rax, -2952(%rbp)
+    leaq    .Lxly_ir0_k1367(%rip), %rax
+    movq    %rax, -2960(%rbp)
+    movq    -2952(%rbp), %rdi
+    movq    -2960(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2968(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2976(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2984(%rbp)
+    leaq    .Lxly_str_ac32a97ceb007afd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2992(%rbp)
+    subq    $16, %rsp
+    movq    -2992(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3000(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3008(%rbp)
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, -3016(%rbp)
+    leaq    .Lxly_str_455b41181811409e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3024(%rbp)
+    leaq    .Lxly_ir0_k1368(%rip), %rax
+    movq    %rax, -3032(%rbp)
+    movq    -3024(%rbp), %rdi
+    movq    -3032(%rbp), %rsi
+    call    .Lxly_fn_rpad
+    movq    %rax, -3040(%rbp)
+    leaq    .Lxly_str_f516510649871fae(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3048(%rbp)
+    movq    -3040(%rbp), %rdi
+    movq    -3048(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, -3056(%rbp)
+    subq    $16, %rsp
+    movq    -3056(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3064(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3072(%rbp)
+    movabsq $0x4030000000000000, %rax
+    movq    %rax, -3080(%rbp)
+    leaq    .Lxly_ir0_k1369(%rip), %rax
+    movq    %rax, -3088(%rbp)
+    leaq    .Lxly_ir0_k1370(%rip), %rax
+    movq    %rax, -3096(%rbp)
+    movq    -3088(%rbp), %rdi
+    movq    -3096(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3104(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -3112(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -3120(%rbp)
+    leaq    .Lxly_str_e9c740974f6aeca6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3128(%rbp)
+    subq    $16, %rsp
+    movq    -3128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3136(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3144(%rbp)
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, -3152(%rbp)
+    leaq    .Lxly_str_08178107b4d49c50(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3160(%rbp)
+    leaq    .Lxly_ir0_k1371(%rip), %rax
+    movq    %rax, -3168(%rbp)
+    movq    -3160(%rbp), %rdi
+    movq    -3168(%rbp), %rsi
+    call    .Lxly_fn_rpad
+    movq    %rax, -3176(%rbp)
+    movq    -3176(%rbp), %rdi
+    movq    -3048(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_add
+.Lxly_10:
+    movq    %rax, -3184(%rbp)
+    subq    $16, %rsp
+    movq    -3184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3192(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3200(%rbp)
+    movabsq $0x4031000000000000, %rax
+    movq    %rax, -3208(%rbp)
+    leaq    .Lxly_ir0_k1372(%rip), %rax
+    movq    %rax, -3216(%rbp)
+    leaq    .Lxly_ir0_k1373(%rip), %rax
+    movq    %rax, -3224(%rbp)
+    movq    -3216(%rbp), %rdi
+    movq    -3224(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3232(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -3240(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -3248(%rbp)
+    leaq    .Lxly_str_3ec4b1e9a50e1137(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3256(%rbp)
+    subq    $16, %rsp
+    movq    -3256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3264(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3272(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -3280(%rbp)
+    leaq    .Lxly_str_a11102f525bc8ba7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3288(%rbp)
+    subq    $16, %rsp
+    movq    -3288(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3296(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3304(%rbp)
+    leaq    .Lxly_ir0_k1374(%rip), %rax
+    movq    %rax, -3312(%rbp)
+    leaq    .Lxly_ir0_k1375(%rip), %rax
+    movq    %rax, -3320(%rbp)
+    movq    -3312(%rbp), %rdi
+    movq    -3320(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3328(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -3336(%rbp)
+    leaq    .Lxly_str_d949abbb1ffc3a30(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3344(%rbp)
+    subq    $16, %rsp
+    movq    -3344(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3352(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3360(%rbp)
+    leaq    .Lxly_str_9feb1a1345ccc3e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3368(%rbp)
+    leaq    .Lxly_ir0_k1376(%rip), %rax
+    movq    %rax, -3376(%rbp)
+    leaq    .Lxly_ir0_k1377(%rip), %rax
+    movq    %rax, -3384(%rbp)
+    leaq    .Lxly_ir0_k1378(%rip), %rax
+    movq    %rax, -3392(%rbp)
+    leaq    .Lxly_ir0_k1379(%rip), %rax
+    movq    %rax, %r14
+    movq    -3376(%rbp), %rdi
+    movq    -3384(%rbp), %rsi
+    movq    -3392(%rbp), %rdx
+    movq    %r14, %rcx
+    movq    -3368(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -3400(%rbp)
+    leaq    .Lxly_ir0_k1380(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1381(%rip), %rax
+    movq    %rax, -3408(%rbp)
+    movq    %r14, %rdi
+    movq    -3408(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3416(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, %r14
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r14
+    leaq    .Lxly_str_6ff4dd2c4d4b2175(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3424(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r14
+    call    .Lxly_fn_bold
+    movq    %rax, %r14
+    leaq    .Lxly_str_456fc7181822cd5a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1382(%rip), %rax
+    movq    %rax, -3432(%rbp)
+    movq    %r14, %rdi
+    movq    -3432(%rbp), %rsi
+    call    .Lxly_fn_rpad
+    movq    %rax, -3440(%rbp)
+    leaq    .Lxly_str_de1c2905ab018315(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    -3440(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_12
+.Lxly_11:
+    call    xly_add
+.Lxly_12:
+    movq    %rax, -3448(%rbp)
+    subq    $16, %rsp
+    movq    -3448(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3456(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3464(%rbp)
+    leaq    .Lxly_ir0_k1383(%rip), %rax
+    movq    %rax, -3472(%rbp)
+    leaq    .Lxly_ir0_k1384(%rip), %rax
+    movq    %rax, -3480(%rbp)
+    movq    -3472(%rbp), %rdi
+    movq    -3480(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3488(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -3496(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -3504(%rbp)
+    leaq    .Lxly_str_c5be4cfae5701073(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3512(%rbp)
+    subq    $16, %rsp
+    movq    -3512(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3520(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3528(%rbp)
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, -3536(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -3544(%rbp)
+    leaq    .Lxly_str_07ff8607b4c012ee(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3552(%rbp)
+    leaq    .Lxly_ir0_k1385(%rip), %rax
+    movq    %rax, -3560(%rbp)
+    movq    -3552(%rbp), %rdi
+    movq    -3560(%rbp), %rsi
+    call    .Lxly_fn_rpad
+    movq    %rax, -3568(%rbp)
+    movq    -3568(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_14
+.Lxly_13:
+    call    xly_add
+.Lxly_14:
+    movq    %rax, -3576(%rbp)
+    subq    $16, %rsp
+    movq    -3576(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1386(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1387(%rip), %rax
+    movq    %rax, -3584(%rbp)
+    movq    %r14, %rdi
+    movq    -3584(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3592(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, %r14
+    leaq    .Lxly_str_aa7132687970bc43(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3600(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r14
+    leaq    .Lxly_str_ca41963dc3d76d63(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3608(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1388(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1389(%rip), %rax
+    movq    %rax, -3616(%rbp)
+    movq    %r14, %rdi
+    movq    -3616(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3624(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, %r14
+    leaq    .Lxly_str_d3c3c29d8f4a60c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3632(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r14
+    leaq    .Lxly_str_95caa2cfa43aeb10(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3640(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1390(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1391(%rip), %rax
+    movq    %rax, -3648(%rbp)
+    movq    %r14, %rdi
+    movq    -3648(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3656(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, %r14
+    leaq    .Lxly_str_7ddb992604c3eb8f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3664(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    movabsq $0x4035000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4053c00000000000, %rax
+    movq    %rax, -3672(%rbp)
+    leaq    .Lxly_str_fdd447bcde2c13ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3680(%rbp)
+    leaq    .Lxly_ir0_k1392(%rip), %rax
+    movq    %rax, -3688(%rbp)
+    leaq    .Lxly_ir0_k1393(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1394(%rip), %rax
+    movq    %rax, -3696(%rbp)
+    leaq    .Lxly_ir0_k1395(%rip), %rax
+    movq    %rax, -3704(%rbp)
+    movq    -3688(%rbp), %rdi
+    movq    %r14, %rsi
+    movq    -3696(%rbp), %rdx
+    movq    -3704(%rbp), %rcx
+    movq    -3680(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -3712(%rbp)
+    movabsq $0x4036000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1396(%rip), %rax
+    movq    %rax, -3720(%rbp)
+    leaq    .Lxly_ir0_k1397(%rip), %rax
+    movq    %rax, %r14
+    movq    -3720(%rbp), %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3728(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, %r14
+    call    .Lxly_fn_bgBrightBlack
+    movq    %rax, %r14
+    call    .Lxly_fn_fgBrightCyan
+    movq    %rax, %r14
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3736(%rbp)
+    leaq    .Lxly_str_0f45d616d13c05ba(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3744(%rbp)
+    leaq    .Lxly_ir0_k1398(%rip), %rax
+    movq    %rax, -3752(%rbp)
+    movq    -3744(%rbp), %rdi
+    movq    -3752(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -3760(%rbp)
+    movq    -3736(%rbp), %rdi
+    movq    -3760(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -4792(%rbp)
+    leaq    -4800(%rbp), %rax
+    jmp     .Lxly_16
+.Lxly_15:
+    call    xly_add
+.Lxly_16:
+    movq    %rax, -3768(%rbp)
+    leaq    .Lxly_str_8d4bb019f3bc7202(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3776(%rbp)
+    leaq    .Lxly_ir0_k1399(%rip), %rax
+    movq    %rax, -3784(%rbp)
+    movq    -3776(%rbp), %rdi
+    movq    -3784(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -3792(%rbp)
+    movq    -3768(%rbp), %rdi
+    movq    -3792(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -4920(%rbp)
+    leaq    -4928(%rbp), %rax
+    jmp     .Lxly_18
+.Lxly_17:
+    call    xly_add
+.Lxly_18:
+    movq    %rax, -3800(%rbp)
+    leaq    .Lxly_str_3627459bf85fece4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3808(%rbp)
+    leaq    .Lxly_ir0_k1400(%rip), %rax
+    movq    %rax, -3816(%rbp)
+    movq    -3808(%rbp), %rdi
+    movq    -3816(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -3824(%rbp)
+    movq    -3800(%rbp), %rdi
+    movq    -3824(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -5048(%rbp)
+    leaq    -5056(%rbp), %rax
+    jmp     .Lxly_20
+.Lxly_19:
+    call    xly_add
+.Lxly_20:
+    movq    %rax, -3832(%rbp)
+    leaq    .Lxly_str_2658d2abf6c5ac6c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3840(%rbp)
+    leaq    .Lxly_ir0_k1401(%rip), %rax
+    movq    %rax, -3848(%rbp)
+    movq    -3840(%rbp), %rdi
+    movq    -3848(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -3856(%rbp)
+    movq    -3832(%rbp), %rdi
+    movq    -3856(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -5176(%rbp)
+    leaq    -5184(%rbp), %rax
+    jmp     .Lxly_22
+.Lxly_21:
+    call    xly_add
+.Lxly_22:
+    movq    %rax, -3864(%rbp)
+    leaq    .Lxly_str_2e825627746d5b6f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3872(%rbp)
+    leaq    .Lxly_ir0_k1402(%rip), %rax
+    movq    %rax, -3880(%rbp)
+    movq    -3872(%rbp), %rdi
+    movq    -3880(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -3888(%rbp)
+    movq    -3864(%rbp), %rdi
+    movq    -3888(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_24
+.Lxly_23:
+    call    xly_add
+.Lxly_24:
+    movq    %rax, -3896(%rbp)
+    subq    $16, %rsp
+    movq    -3896(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3904(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3912(%rbp)
+    movabsq $0x4037000000000000, %rax
+    movq    %rax, -3920(%rbp)
+    leaq    .Lxly_ir0_k1403(%rip), %rax
+    movq    %rax, -3928(%rbp)
+    leaq    .Lxly_ir0_k1404(%rip), %rax
+    movq    %rax, -3936(%rbp)
+    movq    -3928(%rbp), %rdi
+    movq    -3936(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -3944(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -3952(%rbp)
+    leaq    .Lxly_str_f27f734b7b4b8875(%rip), %rdi
+    call    xly_str
+    movq    %rax, -3960(%rbp)
+    subq    $16, %rsp
+    movq    -3960(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -3968(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -3976(%rbp)
+    leaq    .Lxly_ir0_k1405(%rip), %rax
+    movq    %rax, -3984(%rbp)
+    movq    -3984(%rbp), %rax
+    movq    %rax, __xly_globals+240(%rip)
+    movabsq $0x4038000000000000, %rax
+    movq    %rax, -3992(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -4000(%rbp)
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, -4008(%rbp)
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
+    call    xly_str
+    movq    %rax, -4016(%rbp)
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
+    call    xly_str
+    movq    %rax, -4024(%rbp)
+    movq    %r15, %rbx
+.Lxly_ir0_b16:
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -4032(%rbp)
+    movq    %rbx, %xmm0
+    movq    -4032(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -4040(%rbp)
+    cmpq    $0, -4040(%rbp)
+    je      .Lxly_ir0_b18
+.Lxly_ir0_b17:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -4048(%rbp)
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -4048(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -4056(%rbp)
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -4064(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -4064(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -4072(%rbp)
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -4080(%rbp)
+    subq    $16, %rsp
+    movq    -760(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -4080(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -4088(%rbp)
+    subq    $16, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -4088(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -4096(%rbp)
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -4104(%rbp)
+    subq    $16, %rsp
+    movq    -792(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -4104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    -3992(%rbp), %xmm0
+    movq    %rbx, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -4112(%rbp)
+    movq    -4112(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -4120(%rbp)
+    leaq    .Lxly_ir0_k1412(%rip), %rax
+    movq    %rax, -4128(%rbp)
+    movq    -4120(%rbp), %rdi
+    movq    -4128(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -4136(%rbp)
+    movq    -832(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_25
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_26
+.Lxly_25:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_26:
+    movq    %rax, -4144(%rbp)
+    cmpq    $0, -4144(%rbp)
+    je      .Lxly_ir0_b103
+.Lxly_ir0_b19:
+    movq    -48(%rbp), %rax
+    movq    %rax, -4152(%rbp)
+    jmp     .Lxly_ir0_b20
+.Lxly_ir0_b103:
+    movq    %r15, -4152(%rbp)
+.Lxly_ir0_b20:
+    movq    -912(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_27
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_28
+.Lxly_27:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_28:
+    movq    %rax, -4160(%rbp)
+    cmpq    $0, -4160(%rbp)
+    je      .Lxly_ir0_b104
+.Lxly_ir0_b21:
+    movq    -56(%rbp), %rax
+    movq    %rax, -4168(%rbp)
+    jmp     .Lxly_ir0_b22
+.Lxly_ir0_b104:
+    movq    -4152(%rbp), %rax
+    movq    %rax, -4168(%rbp)
+.Lxly_ir0_b22:
+    movq    -984(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_29
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_30
+.Lxly_29:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_30:
+    movq    %rax, -4176(%rbp)
+    cmpq    $0, -4176(%rbp)
+    je      .Lxly_ir0_b105
+.Lxly_ir0_b23:
+    movq    -4000(%rbp), %rax
+    movq    %rax, -4184(%rbp)
+    jmp     .Lxly_ir0_b24
+.Lxly_ir0_b105:
+    movq    -4168(%rbp), %rax
+    movq    %rax, -4184(%rbp)
+.Lxly_ir0_b24:
+    movq    -1056(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_31
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_32
+.Lxly_31:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_32:
+    movq    %rax, -4192(%rbp)
+    cmpq    $0, -4192(%rbp)
+    je      .Lxly_ir0_b106
+.Lxly_ir0_b25:
+    movq    %r15, -4200(%rbp)
+    jmp     .Lxly_ir0_b26
+.Lxly_ir0_b106:
+    movq    -4184(%rbp), %rax
+    movq    %rax, -4200(%rbp)
+.Lxly_ir0_b26:
+    movq    -1136(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_33
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_34
+.Lxly_33:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_34:
+    movq    %rax, -4208(%rbp)
+    cmpq    $0, -4208(%rbp)
+    je      .Lxly_ir0_b107
+.Lxly_ir0_b27:
+    movq    -2216(%rbp), %r13
+    jmp     .Lxly_ir0_b28
+.Lxly_ir0_b107:
+    movq    -4200(%rbp), %r13
+.Lxly_ir0_b28:
+    movq    %r13, %xmm0
+    movq    -4008(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -4216(%rbp)
+    cmpq    $0, -4216(%rbp)
+    je      .Lxly_ir0_b30
+.Lxly_ir0_b29:
+    call    .Lxly_fn_bgBrightBlue
+    movq    %rax, -4224(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -4232(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -4240(%rbp)
+.Lxly_ir0_b30:
+    movq    %r13, %xmm0
+    movq    -4008(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -4248(%rbp)
+    cmpq    $0, -4248(%rbp)
+    je      .Lxly_ir0_b32
+.Lxly_ir0_b31:
+    call    .Lxly_fn_fgWhite
+    movq    %rax, -4256(%rbp)
+.Lxly_ir0_b32:
+    leaq    .Lxly_ir0_k1413(%rip), %rax
+    movq    %rax, -4264(%rbp)
+    movq    -4056(%rbp), %rdi
+    movq    -4264(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -4272(%rbp)
+    movq    -3736(%rbp), %rdi
+    movq    -4272(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -5304(%rbp)
+    leaq    -5312(%rbp), %rax
+    jmp     .Lxly_36
+.Lxly_35:
+    call    xly_add
+.Lxly_36:
+    movq    %rax, -4280(%rbp)
+    leaq    .Lxly_ir0_k1414(%rip), %rax
+    movq    %rax, -4288(%rbp)
+    movq    -4072(%rbp), %rdi
+    movq    -4288(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -4296(%rbp)
+    movq    -4280(%rbp), %rdi
+    movq    -4296(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_37
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_38
+.Lxly_37:
+    call    xly_add
+.Lxly_38:
+    movq    %rax, -4304(%rbp)
+    subq    $16, %rsp
+    movq    -4304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -4312(%rbp)
+    cmpq    $0, -4216(%rbp)
+    je      .Lxly_ir0_b34
+.Lxly_ir0_b33:
+    movq    %r14, %rdi
+    movq    -4016(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_39
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_40
+.Lxly_39:
+    call    xly_add
+.Lxly_40:
+    movq    %rax, -4320(%rbp)
+    leaq    .Lxly_ir0_k1415(%rip), %rax
+    movq    %rax, -4328(%rbp)
+    movq    -4320(%rbp), %rdi
+    movq    -4328(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -4336(%rbp)
+    leaq    .Lxly_ir0_k1416(%rip), %rax
+    movq    %rax, -4344(%rbp)
+    movq    -4096(%rbp), %rdi
+    movq    -4344(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -4352(%rbp)
+    movq    -4336(%rbp), %rdi
+    movq    -4352(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_41
+    cmpl    $0, (%rsi)
+    jne     .Lxly_41
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_42
+.Lxly_41:
+    call    xly_add
+.Lxly_42:
+    movq    %rax, -4360(%rbp)
+    subq    $16, %rsp
+    movq    -4360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -4368(%rbp)
+.Lxly_ir0_b34:
+    cmpq    $0, -4248(%rbp)
+    je      .Lxly_ir0_b36
+.Lxly_ir0_b35:
+    call    .Lxly_fn_reset
+    movq    %rax, -4376(%rbp)
+    movq    %r13, %xmm0
+    movq    -1936(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -4384(%rbp)
+    cmpq    $0, -4384(%rbp)
+    je      .Lxly_ir0_b38
+.Lxly_ir0_b37:
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, -4392(%rbp)
+.Lxly_ir0_b38:
+    movq    %r13, %xmm0
+    movq    -1936(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    setae   %al
+    movzbl  %al, %eax
+    movq    %rax, -4400(%rbp)
+    cmpq    $0, -4400(%rbp)
+    je      .Lxly_ir0_b40
+.Lxly_ir0_b39:
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r13
+.Lxly_ir0_b40:
+    movq    %r14, %rdi
+    movq    -4024(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_43
+    cmpl    $0, (%rsi)
+    jne     .Lxly_43
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_44
+.Lxly_43:
+    call    xly_add
+.Lxly_44:
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k1417(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -4408(%rbp)
+    subq    $16, %rsp
+    movq    -4408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    call    .Lxly_fn_fgWhite
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1418(%rip), %rax
+    movq    %rax, %r14
+    movq    -4096(%rbp), %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b36:
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    movq    -864(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_45
+    cmpl    $0, (%rsi)
+    jne     .Lxly_45
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_46
+.Lxly_45:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_46:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b42
+.Lxly_ir0_b41:
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r14
+    call    .Lxly_fn_bold
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b42:
+    movq    -1088(%rbp), %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_47
+    cmpl    $0, (%rsi)
+    jne     .Lxly_47
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_48
+.Lxly_47:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_48:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_ir0_b44
+.Lxly_ir0_b43:
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b44:
+    call    .Lxly_fn_reset
+    movq    %rax, %r14
+    movq    %rbx, %xmm0
+    movq    -1272(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+240(%rip)
+    movq    %r14, %rbx
+    jmp     .Lxly_ir0_b16
+.Lxly_ir0_b18:
+    movabsq $0x4040000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_3f16727d4e2e895d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    -1184(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_49
+    cmpl    $0, (%rsi)
+    jne     .Lxly_49
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_50
+.Lxly_49:
+    call    xly_add
+.Lxly_50:
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1420(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    call    .Lxly_fn_statusBar
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k1421(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k1422(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    -1256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    call    .Lxly_fn_reset
+    movq    %rax, %r15
+    leaq    .Lxly_str_af63c74c8601c8dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k1269:
+    .quad   0, 0x4041000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1270:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1271:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1272:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1273:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1274:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1275:
+    .quad   0, 0x4041800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1276:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1277:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1278:
+    .quad   0, 0x4049800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1279:
+    .quad   0, 0x404f800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1280:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1281:
+    .quad   0, 0x4048000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1282:
+    .quad   0, 0x4051c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1283:
+    .quad   0, 0x4055000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1284:
+    .quad   0, 0x4053400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1285:
+    .quad   0, 0x4051400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1286:
+    .quad   0, 0x4052400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1287:
+    .quad   0, 0x4050400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1288:
+    .quad   0, 0x404d000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1289:
+    .quad   0, 0x404e800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1290:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1291:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1292:
+    .quad   0, 0x4048800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1293:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1294:
+    .quad   0, 0x40b8600000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1295:
+    .quad   0, 0x40a1080000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1296:
+    .quad   0, 0x40bf1c0000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1297:
+    .quad   0, 0x40d0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1298:
+    .quad   0, 0x4061c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1299:
+    .quad   0, 0x4055c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1300:
+    .quad   0, 0x4078300000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1301:
+    .quad   0, 0x4080000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1302:
+    .quad   0, 0x405f000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1303:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1304:
+    .quad   0, 0x40c0720000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1305:
+    .quad   0, 0x40b40a0000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1306:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1307:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1308:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1309:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1310:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1311:
+    .quad   0, 0x40430b0000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1312:
+    .quad   0, 0x402a9c8000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1313:
+    .quad   0, 0x4052e58000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1314:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1315:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1316:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1317:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1318:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1319:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1320:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1321:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1322:
+    .quad   0, 0x4041000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1323:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1324:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1325:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1326:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1327:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1328:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1329:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1330:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1331:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1332:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1333:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1334:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1335:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1336:
+    .quad   0, 0x4022000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1337:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1338:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1339:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1340:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1341:
+    .quad   0, 0x404e800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1342:
+    .quad   0, 0x40430b0000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1343:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1344:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1345:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1346:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1347:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1349:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1350:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1351:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1352:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1353:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1354:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1355:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1356:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1357:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1358:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1359:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1360:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1361:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1362:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1363:
+    .quad   0, 0x4052e58000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1364:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1365:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1366:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1367:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1368:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1369:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1370:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1371:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1372:
+    .quad   0, 0x4031000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1373:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1374:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1375:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1376:
+    .quad   0, 0x402a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1377:
+    .quad   0, 0x404a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1378:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1379:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1380:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1381:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1382:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1383:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1384:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1385:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1386:
+    .quad   0, 0x4030000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1387:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1388:
+    .quad   0, 0x4031000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1389:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1390:
+    .quad   0, 0x4032000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1391:
+    .quad   0, 0x404b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1392:
+    .quad   0, 0x4035000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1393:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1394:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1395:
+    .quad   0, 0x4053c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1396:
+    .quad   0, 0x4036000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1397:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1398:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1399:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1400:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1401:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1402:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1403:
+    .quad   0, 0x4037000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1404:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1405:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1412:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1413:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1414:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1415:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1416:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1417:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1418:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1420:
+    .quad   0, 0x4040000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1421:
+    .quad   0, 0x4041000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k1422:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_pos:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f0_6
+.Lxly_f0_5:
+    call    xly_add
+.Lxly_f0_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f0_8
+.Lxly_f0_7:
+    call    xly_add
+.Lxly_f0_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f0_10
+.Lxly_f0_9:
+    call    xly_add
+.Lxly_f0_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_12
+.Lxly_f0_11:
+    call    xly_add
+.Lxly_f0_12:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_seqPos:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f1_4
+.Lxly_f1_3:
+    call    xly_add
+.Lxly_f1_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f1_6
+.Lxly_f1_5:
+    call    xly_add
+.Lxly_f1_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f1_8
+.Lxly_f1_7:
+    call    xly_add
+.Lxly_f1_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f1_10
+.Lxly_f1_9:
+    call    xly_add
+.Lxly_f1_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_12
+.Lxly_f1_11:
+    call    xly_add
+.Lxly_f1_12:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_reset:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bold:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_dim:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgCyan:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgWhite:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightCyan:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightWhite:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_usageFg:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf24_0_b2
+.Lxly_irf24_0_b1:
+.Lxly_irf24_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf24_0_b7:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf24_0_k37(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf24_0_b2:
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf24_0_b5
+.Lxly_irf24_0_b4:
+.Lxly_irf24_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf24_0_b9:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf24_0_k38(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf24_0_b5:
+.Lxly_irf24_0_b12:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf24_0_b11:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf24_0_k37:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf24_0_k38:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_usageBg:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf25_0_b2
+.Lxly_irf25_0_b1:
+.Lxly_irf25_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b7:
+.Lxly_irf25_0_b10:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b9:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf25_0_k55(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf25_0_b2:
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf25_0_b5
+.Lxly_irf25_0_b4:
+.Lxly_irf25_0_b12:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b11:
+.Lxly_irf25_0_b14:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b13:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf25_0_k56(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf25_0_b5:
+.Lxly_irf25_0_b16:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b15:
+.Lxly_irf25_0_b18:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b17:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf25_0_k55:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf25_0_k56:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_pad:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r13, %r12
+    movq    %rbx, %r14
+.Lxly_irf26_0_b1:
+    movq    %r12, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f26_2
+.Lxly_f26_1:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f26_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf26_0_b3
+.Lxly_irf26_0_b2:
+    movq    %r14, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f26_4
+.Lxly_f26_3:
+    call    xly_add
+.Lxly_f26_4:
+    movq    %rax, %r13
+    leaq    .Lxly_irf26_0_k18(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f26_6
+.Lxly_f26_5:
+    call    xly_add
+.Lxly_f26_6:
+    movq    %rax, %r15
+    movq    %r15, %r12
+    movq    %r13, %r14
+    jmp     .Lxly_irf26_0_b1
+.Lxly_irf26_0_b3:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf26_0_k18:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_rpad:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r13, %r12
+    movq    %rbx, %r14
+.Lxly_irf27_0_b1:
+    movq    %r12, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_2
+.Lxly_f27_1:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf27_0_b3
+.Lxly_irf27_0_b2:
+    movq    -64(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_4
+.Lxly_f27_3:
+    call    xly_add
+.Lxly_f27_4:
+    movq    %rax, %r13
+    leaq    .Lxly_irf27_0_k18(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f27_6
+.Lxly_f27_5:
+    call    xly_add
+.Lxly_f27_6:
+    movq    %rax, %r15
+    movq    %r15, %r12
+    movq    %r13, %r14
+    jmp     .Lxly_irf27_0_b1
+.Lxly_irf27_0_b3:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf27_0_k18:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_panel:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $2560, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, -72(%rbp)
+    movq    %r8, -80(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -2552(%rbp)
+    movq    %rax, -2544(%rbp)
+    movq    %rax, -2536(%rbp)
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movl    $-1, -2516(%rbp)
+    movl    $-1, -2388(%rbp)
+    movl    $-1, -2260(%rbp)
+    movl    $-1, -2132(%rbp)
+    movl    $-1, -2004(%rbp)
+    movl    $-1, -1876(%rbp)
+    movl    $-1, -1748(%rbp)
+    movl    $-1, -1620(%rbp)
+    movl    $-1, -1492(%rbp)
+    movl    $-1, -1364(%rbp)
+    movl    $-1, -1236(%rbp)
+    movl    $-1, -1108(%rbp)
+    movl    $-1, -980(%rbp)
+    movl    $-1, -852(%rbp)
+    movl    $-1, -724(%rbp)
+    movl    $-1, -596(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    -96(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_irf28_0_b14:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -624(%rbp)
+    leaq    -632(%rbp), %rax
+    jmp     .Lxly_f28_2
+.Lxly_f28_1:
+    call    xly_add
+.Lxly_f28_2:
+    movq    %rax, -120(%rbp)
+    movq    %r13, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -752(%rbp)
+    leaq    -760(%rbp), %rax
+    jmp     .Lxly_f28_4
+.Lxly_f28_3:
+    call    xly_add
+.Lxly_f28_4:
+    movq    %rax, -128(%rbp)
+    movq    %r13, %rdi
+    movq    -120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -880(%rbp)
+    leaq    -888(%rbp), %rax
+    jmp     .Lxly_f28_6
+.Lxly_f28_5:
+    call    xly_add
+.Lxly_f28_6:
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -144(%rbp)
+    movq    -136(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1008(%rbp)
+    leaq    -1016(%rbp), %rax
+    jmp     .Lxly_f28_8
+.Lxly_f28_7:
+    call    xly_add
+.Lxly_f28_8:
+    movq    %rax, -152(%rbp)
+    movq    -152(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1136(%rbp)
+    leaq    -1144(%rbp), %rax
+    jmp     .Lxly_f28_10
+.Lxly_f28_9:
+    call    xly_add
+.Lxly_f28_10:
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    movq    -160(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_12
+.Lxly_f28_11:
+    call    xly_add
+.Lxly_f28_12:
+    movq    %rax, -176(%rbp)
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -184(%rbp)
+.Lxly_irf28_0_b13:
+.Lxly_irf28_0_b16:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+.Lxly_irf28_0_b15:
+    leaq    .Lxly_str_5665be1b8870744c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -208(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -216(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -224(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf28_0_b1:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -232(%rbp)
+    cmpq    $0, -232(%rbp)
+    je      .Lxly_irf28_0_b3
+.Lxly_irf28_0_b2:
+    subq    $16, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -240(%rbp)
+    movq    %rbx, %xmm0
+    movq    -224(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -248(%rbp)
+    movq    -248(%rbp), %rbx
+    jmp     .Lxly_irf28_0_b1
+.Lxly_irf28_0_b3:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+.Lxly_irf28_0_b18:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+.Lxly_irf28_0_b17:
+.Lxly_irf28_0_b20:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+.Lxly_irf28_0_b19:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -280(%rbp)
+.Lxly_irf28_0_b22:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+.Lxly_irf28_0_b21:
+.Lxly_irf28_0_b24:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -296(%rbp)
+.Lxly_irf28_0_b23:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -320(%rbp)
+    movq    %r12, %rbx
+.Lxly_irf28_0_b4:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -328(%rbp)
+    cmpq    $0, -328(%rbp)
+    je      .Lxly_irf28_0_b6
+.Lxly_irf28_0_b5:
+    subq    $16, %rsp
+    movq    -312(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    movq    %rbx, %xmm0
+    movq    -320(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -344(%rbp)
+    movq    -344(%rbp), %rbx
+    jmp     .Lxly_irf28_0_b4
+.Lxly_irf28_0_b6:
+    leaq    .Lxly_str_5665c11b88707965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf28_0_b26:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf28_0_b25:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_str_5665bb1b88706f33(%rip), %rdi
+    call    xly_str
+    movq    %rax, -360(%rbp)
+    movq    -56(%rbp), %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1264(%rbp)
+    leaq    -1272(%rbp), %rax
+    jmp     .Lxly_f28_14
+.Lxly_f28_13:
+    call    xly_add
+.Lxly_f28_14:
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -376(%rbp)
+    movq    -376(%rbp), %xmm0
+    movsd   %xmm0, -1392(%rbp)
+    leaq    -1400(%rbp), %rax
+    movq    %rax, -384(%rbp)
+    movq    %r13, %rdi
+    movq    -384(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1520(%rbp)
+    leaq    -1528(%rbp), %rax
+    jmp     .Lxly_f28_16
+.Lxly_f28_15:
+    call    xly_add
+.Lxly_f28_16:
+    movq    %rax, -392(%rbp)
+    movq    %r14, %rbx
+.Lxly_irf28_0_b7:
+    movq    %rbx, %xmm0
+    movq    -352(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -400(%rbp)
+    cmpq    $0, -400(%rbp)
+    je      .Lxly_irf28_0_b9
+.Lxly_irf28_0_b8:
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -1648(%rbp)
+    leaq    -1656(%rbp), %rax
+    movq    %rax, -408(%rbp)
+    movq    -48(%rbp), %rdi
+    movq    -408(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1776(%rbp)
+    leaq    -1784(%rbp), %rax
+    jmp     .Lxly_f28_18
+.Lxly_f28_17:
+    call    xly_add
+.Lxly_f28_18:
+    movq    %rax, -416(%rbp)
+.Lxly_irf28_0_b28:
+    movq    %r13, %rdi
+    movq    -416(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1904(%rbp)
+    leaq    -1912(%rbp), %rax
+    jmp     .Lxly_f28_20
+.Lxly_f28_19:
+    call    xly_add
+.Lxly_f28_20:
+    movq    %rax, -424(%rbp)
+    movq    %r13, %rdi
+    movq    -424(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2032(%rbp)
+    leaq    -2040(%rbp), %rax
+    jmp     .Lxly_f28_22
+.Lxly_f28_21:
+    call    xly_add
+.Lxly_f28_22:
+    movq    %rax, -432(%rbp)
+    movq    -432(%rbp), %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2160(%rbp)
+    leaq    -2168(%rbp), %rax
+    jmp     .Lxly_f28_24
+.Lxly_f28_23:
+    call    xly_add
+.Lxly_f28_24:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2288(%rbp)
+    leaq    -2296(%rbp), %rax
+    jmp     .Lxly_f28_26
+.Lxly_f28_25:
+    call    xly_add
+.Lxly_f28_26:
+    movq    %rax, -440(%rbp)
+    movq    -440(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_28
+.Lxly_f28_27:
+    call    xly_add
+.Lxly_f28_28:
+    movq    %rax, -448(%rbp)
+    subq    $16, %rsp
+    movq    -448(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -456(%rbp)
+.Lxly_irf28_0_b27:
+.Lxly_irf28_0_b30:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -464(%rbp)
+.Lxly_irf28_0_b29:
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -472(%rbp)
+.Lxly_irf28_0_b32:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+.Lxly_irf28_0_b31:
+.Lxly_irf28_0_b34:
+    movq    %r15, %rdi
+    movq    -392(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2416(%rbp)
+    leaq    -2424(%rbp), %rax
+    jmp     .Lxly_f28_30
+.Lxly_f28_29:
+    call    xly_add
+.Lxly_f28_30:
+    movq    %rax, -488(%rbp)
+    movq    -488(%rbp), %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_31
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_32
+.Lxly_f28_31:
+    call    xly_add
+.Lxly_f28_32:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -496(%rbp)
+.Lxly_irf28_0_b33:
+.Lxly_irf28_0_b36:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b35:
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b38:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b37:
+    movq    %rbx, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %rbx
+    jmp     .Lxly_irf28_0_b7
+.Lxly_irf28_0_b9:
+    movq    -48(%rbp), %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_33
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2544(%rbp)
+    leaq    -2552(%rbp), %rax
+    jmp     .Lxly_f28_34
+.Lxly_f28_33:
+    call    xly_add
+.Lxly_f28_34:
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+.Lxly_irf28_0_b40:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_36
+.Lxly_f28_35:
+    call    xly_add
+.Lxly_f28_36:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_37
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_38
+.Lxly_f28_37:
+    call    xly_add
+.Lxly_f28_38:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_39
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_40
+.Lxly_f28_39:
+    call    xly_add
+.Lxly_f28_40:
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_41
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_41
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_42
+.Lxly_f28_41:
+    call    xly_add
+.Lxly_f28_42:
+    movq    %rax, %r15
+    movq    %r15, %rdi
+    movq    -168(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f28_43
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f28_43
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f28_44
+.Lxly_f28_43:
+    call    xly_add
+.Lxly_f28_44:
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b39:
+.Lxly_irf28_0_b42:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf28_0_b41:
+    leaq    .Lxly_str_5665c41b88707e7e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %r15
+.Lxly_irf28_0_b10:
+    movq    %r15, %xmm0
+    movq    -88(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf28_0_b12
+.Lxly_irf28_0_b11:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r15
+    jmp     .Lxly_irf28_0_b10
+.Lxly_irf28_0_b12:
+    leaq    .Lxly_str_5665c71b88708397(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b44:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf28_0_b43:
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_progressBar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $448, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    xorl    %eax, %eax
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movl    $-1, -404(%rbp)
+    movl    $-1, -276(%rbp)
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r14
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf29_0_b7:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+.Lxly_irf29_0_b10:
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, -120(%rbp)
+    movq    -96(%rbp), %xmm0
+    movq    -120(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -128(%rbp)
+    cmpq    $0, -128(%rbp)
+    je      .Lxly_irf29_0_b12
+.Lxly_irf29_0_b11:
+    call    .Lxly_fn_fgBrightRed
+    movq    %rax, -136(%rbp)
+    jmp     .Lxly_irf29_0_b9
+.Lxly_irf29_0_b12:
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, -144(%rbp)
+    movq    -96(%rbp), %xmm0
+    movq    -144(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -152(%rbp)
+    cmpq    $0, -152(%rbp)
+    je      .Lxly_irf29_0_b14
+.Lxly_irf29_0_b13:
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, -160(%rbp)
+    jmp     .Lxly_irf29_0_b9
+.Lxly_irf29_0_b14:
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, -168(%rbp)
+.Lxly_irf29_0_b9:
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, -176(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %r15
+.Lxly_irf29_0_b1:
+    movq    %r15, %xmm0
+    movq    %rbx, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf29_0_b3
+.Lxly_irf29_0_b2:
+    subq    $16, %rsp
+    movq    -176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r15
+    jmp     .Lxly_irf29_0_b1
+.Lxly_irf29_0_b3:
+.Lxly_irf29_0_b16:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf29_0_b15:
+    leaq    .Lxly_str_56700b1b88794ba8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    movq    %r12, %r14
+.Lxly_irf29_0_b4:
+    movq    %r14, %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf29_0_b6
+.Lxly_irf29_0_b5:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %r14
+    jmp     .Lxly_irf29_0_b4
+.Lxly_irf29_0_b6:
+.Lxly_irf29_0_b18:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf29_0_b17:
+    leaq    .Lxly_str_094c7a07b5dadfd8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b20:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf29_0_b19:
+.Lxly_irf29_0_b22:
+    cmpq    $0, -128(%rbp)
+    je      .Lxly_irf29_0_b24
+.Lxly_irf29_0_b23:
+    call    .Lxly_fn_fgBrightRed
+    movq    %rax, %r13
+    jmp     .Lxly_irf29_0_b21
+.Lxly_irf29_0_b24:
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, %r13
+    movq    -96(%rbp), %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf29_0_b26
+.Lxly_irf29_0_b25:
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, %r15
+    jmp     .Lxly_irf29_0_b21
+.Lxly_irf29_0_b26:
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r15
+.Lxly_irf29_0_b21:
+    movq    -96(%rbp), %xmm0
+    movsd   %xmm0, -304(%rbp)
+    leaq    -312(%rbp), %rax
+    movq    %rax, %r15
+    movq    -104(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -432(%rbp)
+    leaq    -440(%rbp), %rax
+    jmp     .Lxly_f29_2
+.Lxly_f29_1:
+    call    xly_add
+.Lxly_f29_2:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f29_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f29_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f29_4
+.Lxly_f29_3:
+    call    xly_add
+.Lxly_f29_4:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf29_0_b28:
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf29_0_b27:
+    call    xly_null
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_metricBar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $112, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    movq    %r8, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -88(%rbp)
+.Lxly_irf30_0_b2:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+.Lxly_irf30_0_b1:
+.Lxly_irf30_0_b4:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+.Lxly_irf30_0_b3:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+.Lxly_irf30_0_b6:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf30_0_b5:
+.Lxly_irf30_0_b8:
+    leaq    .Lxly_str_62f7e4f9b5705184(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_irf30_0_b7:
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    movq    %r14, %rdx
+    movq    %r15, %rcx
+    call    .Lxly_fn_progressBar
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_sparkline:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $400, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, %r13
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf31_0_k78(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movabsq $0x0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_566ffb1b88793078(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_irf31_0_k79(%rip), %rax
+    movq    %rax, -80(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -88(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_str_566ffe1b88793591(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    leaq    .Lxly_irf31_0_k80(%rip), %rax
+    movq    %rax, -112(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -112(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -120(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_str_566ffd1b887933de(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_irf31_0_k81(%rip), %rax
+    movq    %rax, -144(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -152(%rbp)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_5670001b887938f7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_irf31_0_k82(%rip), %rax
+    movq    %rax, -176(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -184(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -192(%rbp)
+    leaq    .Lxly_str_566fff1b88793744(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_irf31_0_k83(%rip), %rax
+    movq    %rax, -208(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -216(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_str_5670021b88793c5d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_irf31_0_k84(%rip), %rax
+    movq    %rax, -240(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -232(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -248(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_str_5670011b88793aaa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_irf31_0_k85(%rip), %rax
+    movq    %rax, -272(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -280(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_irf31_0_k86(%rip), %rax
+    movq    %rax, -304(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -320(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -328(%rbp)
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, -336(%rbp)
+    movabsq $0x404e000000000000, %rax
+    movq    %rax, -344(%rbp)
+    movq    %r15, %rbx
+.Lxly_irf31_0_b1:
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %rbx, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -352(%rbp)
+    cmpq    $0, -352(%rbp)
+    je      .Lxly_irf31_0_b3
+.Lxly_irf31_0_b2:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    -328(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -368(%rbp)
+    movq    -368(%rbp), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+.Lxly_irf31_0_b5:
+    movq    %r12, %xmm0
+    movq    -336(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -376(%rbp)
+    cmpq    $0, -376(%rbp)
+    je      .Lxly_irf31_0_b7
+.Lxly_irf31_0_b6:
+    call    .Lxly_fn_fgBrightRed
+    movq    %rax, -384(%rbp)
+    jmp     .Lxly_irf31_0_b4
+.Lxly_irf31_0_b7:
+    movq    %r12, %xmm0
+    movq    -344(%rbp), %xmm1
+    ucomisd %xmm1, %xmm0
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -392(%rbp)
+    cmpq    $0, -392(%rbp)
+    je      .Lxly_irf31_0_b9
+.Lxly_irf31_0_b8:
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, %r12
+    jmp     .Lxly_irf31_0_b4
+.Lxly_irf31_0_b9:
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r12
+.Lxly_irf31_0_b4:
+    movq    -288(%rbp), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %rbx, %xmm0
+    movq    -96(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %rbx
+    jmp     .Lxly_irf31_0_b1
+.Lxly_irf31_0_b3:
+.Lxly_irf31_0_b11:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_irf31_0_b10:
+    call    xly_null
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf31_0_k78:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k79:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k80:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k81:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k82:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k83:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k84:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k85:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf31_0_k86:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_statusBar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $624, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movl    $-1, -588(%rbp)
+    movl    $-1, -460(%rbp)
+    movl    $-1, -332(%rbp)
+    movl    $-1, -204(%rbp)
+.Lxly_irf32_0_b5:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -232(%rbp)
+    leaq    -240(%rbp), %rax
+    jmp     .Lxly_f32_2
+.Lxly_f32_1:
+    call    xly_add
+.Lxly_f32_2:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63ac4c86019afc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    -64(%rbp), %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -360(%rbp)
+    leaq    -368(%rbp), %rax
+    jmp     .Lxly_f32_4
+.Lxly_f32_3:
+    call    xly_add
+.Lxly_f32_4:
+    movq    %rax, %r15
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r15, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -488(%rbp)
+    leaq    -496(%rbp), %rax
+    jmp     .Lxly_f32_6
+.Lxly_f32_5:
+    call    xly_add
+.Lxly_f32_6:
+    movq    %rax, -72(%rbp)
+    movq    -72(%rbp), %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -616(%rbp)
+    leaq    -624(%rbp), %rax
+    jmp     .Lxly_f32_8
+.Lxly_f32_7:
+    call    xly_add
+.Lxly_f32_8:
+    movq    %rax, %r14
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f32_10
+.Lxly_f32_9:
+    call    xly_add
+.Lxly_f32_10:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b4:
+.Lxly_irf32_0_b7:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b6:
+.Lxly_irf32_0_b9:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b8:
+.Lxly_irf32_0_b11:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf32_0_b10:
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f32_12
+.Lxly_f32_11:
+    call    xly_add
+.Lxly_f32_12:
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movabsq $0x4054000000000000, %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -96(%rbp)
+    movq    %rbx, %r13
+    movq    %r15, %r12
+.Lxly_irf32_0_b1:
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf32_0_b3
+.Lxly_irf32_0_b2:
+    movq    %r12, %rdi
+    movq    -88(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f32_14
+.Lxly_f32_13:
+    call    xly_add
+.Lxly_f32_14:
+    movq    %rax, %rbx
+    leaq    .Lxly_irf32_0_k61(%rip), %rax
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f32_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f32_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f32_16
+.Lxly_f32_15:
+    call    xly_add
+.Lxly_f32_16:
+    movq    %rax, %r14
+    movq    %r14, %r13
+    movq    %rbx, %r12
+    jmp     .Lxly_irf32_0_b1
+.Lxly_irf32_0_b3:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b13:
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf32_0_b12:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf32_0_k61:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_f74e5feadea773fd:
+    .asciz  "create"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_da596f1d14c59bbf:
+    .asciz  "xenly"
+.Lxly_str_437cf5d8938c2e92:
+    .asciz  "4096"
+.Lxly_str_8538cc0255887a22:
+    .asciz  "34.2"
+.Lxly_str_22c60f18047f4233:
+    .asciz  "512"
+.Lxly_str_60147fb4fa4a8e0c:
+    .asciz  "running"
+.Lxly_str_3b155ae7ca54d6ae:
+    .asciz  "postgres"
+.Lxly_str_1f93b0f102fffa25:
+    .asciz  "1281"
+.Lxly_str_c8b811f0d1bca936:
+    .asciz  "18.4"
+.Lxly_str_0f27f30b304798ac:
+    .asciz  "2100"
+.Lxly_str_f79a102f6f885c2f:
+    .asciz  "nginx"
+.Lxly_str_0d8959f0f8944da2:
+    .asciz  "1024"
+.Lxly_str_6089ab1827cd4a50:
+    .asciz  "2.1"
+.Lxly_str_456fbb181822b8f6:
+    .asciz  "128"
+.Lxly_str_a30c3ff3148ac374:
+    .asciz  "redis"
+.Lxly_str_c8f8a7f0d1f38c0d:
+    .asciz  "1890"
+.Lxly_str_4e18e6181d0a2fb1:
+    .asciz  "0.8"
+.Lxly_str_602db018277ef422:
+    .asciz  "256"
+.Lxly_str_bbb5ea4a0cfc5400:
+    .asciz  "sleeping"
+.Lxly_str_de15d40af1bbd619:
+    .asciz  "prometheus"
+.Lxly_str_183e2d0b358bfac4:
+    .asciz  "2001"
+.Lxly_str_2bc4c11809afde52:
+    .asciz  "4.1"
+.Lxly_str_454dc7181805e6f4:
+    .asciz  "180"
+.Lxly_str_bb663df102a2ded1:
+    .asciz  "xenly-server"
+.Lxly_str_08b05507b5565e57:
+    .asciz  "os"
+.Lxly_str_3e4bd4e31c5c3ad2:
+    .asciz  "platform"
+.Lxly_str_4ba3070467d44630:
+    .asciz  "14d 3h 22m"
+.Lxly_str_2e15ee8f4339d22e:
+    .asciz  "0.52 0.68 0.71"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_08b73907b55c4d71:
+    .asciz  "io"
+.Lxly_str_b93a12b0d06caefc:
+    .asciz  "write"
+.Lxly_str_e3529f90ab1affe5:
+    .asciz  "\342\254\241 Xenly System Monitor  \342\224\202  xenly-server  \342\224\202  "
+.Lxly_str_e5a64fb7d5181c8c:
+    .asciz  "  \342\224\202  Up: "
+.Lxly_str_0b453a19aa0f85a9:
+    .asciz  "CPU"
+.Lxly_str_6ef4d6d8ac36494b:
+    .asciz  "4;3H"
+.Lxly_str_27cabb4da1a1484d:
+    .asciz  "Total:  "
+.Lxly_str_aff0e92c973beca2:
+    .asciz  "4;11H"
+.Lxly_str_ec76a0cfd555b9aa:
+    .asciz  "5;3H"
+.Lxly_str_a4eaf65a788e7fc8:
+    .asciz  "User:   "
+.Lxly_str_135e932778094b31:
+    .asciz  "5;11H"
+.Lxly_str_700342ea56a0a5f5:
+    .asciz  "6;3H"
+.Lxly_str_8fbb08d9410c7736:
+    .asciz  "System: "
+.Lxly_str_083ec1313d69299c:
+    .asciz  "6;11H"
+.Lxly_str_3417a4e1a816148c:
+    .asciz  "7;3H"
+.Lxly_str_5a1e8c9d28b02fb9:
+    .asciz  "Idle:   "
+.Lxly_str_2bf4291809d7ffcc:
+    .asciz  "48%"
+.Lxly_str_17cd673defa59b77:
+    .asciz  "8;3H"
+.Lxly_str_550d58626e5bc3af:
+    .asciz  "Load avg: "
+.Lxly_str_976ee1351a92ea46:
+    .asciz  "9;3H"
+.Lxly_str_f9019e7dbd9677c7:
+    .asciz  " 20 ticks"
+.Lxly_str_f1112f84cf0cdcd8:
+    .asciz  "peak:"
+.Lxly_str_6878f873c41cdbf2:
+    .asciz  " 84%"
+.Lxly_str_4c2cf42285d2735b:
+    .asciz  "  avg:"
+.Lxly_str_81fb1373d26ce995:
+    .asciz  " 58%"
+.Lxly_str_98897cdad8cb19cf:
+    .asciz  "  now:"
+.Lxly_str_820f6f73d27e2ef3:
+    .asciz  " 52%"
+.Lxly_str_16e1bead7b9c95ce:
+    .asciz  "Memory"
+.Lxly_str_44765936d178efce:
+    .asciz  "Used:  "
+.Lxly_str_bdbc024b9ec59d17:
+    .asciz  "Cache: "
+.Lxly_str_af64164c86024f1a:
+    .asciz  "["
+.Lxly_str_56700d1b88794f0e:
+    .asciz  "\342\226\223"
+.Lxly_str_56700b1b88794ba8:
+    .asciz  "\342\226\221"
+.Lxly_str_094c7a07b5dadfd8:
+    .asciz  "] "
+.Lxly_str_dc81b79f8fc40e41:
+    .asciz  "13.3057%"
+.Lxly_str_53cc857f4946f82b:
+    .asciz  "Free:  "
+.Lxly_str_a41e08c4148859e6:
+    .asciz  "7964 MB"
+.Lxly_str_d30860f2a4908ddf:
+    .asciz  "Total: "
+.Lxly_str_717d123413edb7c2:
+    .asciz  "16384 MB"
+.Lxly_str_9090fc6758e5bee0:
+    .asciz  "   NORMAL  "
+.Lxly_str_b752b6bfab83174d:
+    .asciz  "Disk I/O"
+.Lxly_str_99e03c77a8fa40be:
+    .asciz  "Used:    "
+.Lxly_str_ac32a97ceb007afd:
+    .asciz  "Read:    "
+.Lxly_str_455b41181811409e:
+    .asciz  "142"
+.Lxly_str_f516510649871fae:
+    .asciz  " MB/s"
+.Lxly_str_e9c740974f6aeca6:
+    .asciz  "Write:   "
+.Lxly_str_08178107b4d49c50:
+    .asciz  "87"
+.Lxly_str_3ec4b1e9a50e1137:
+    .asciz  "Total:   "
+.Lxly_str_a11102f525bc8ba7:
+    .asciz  "387 / 512 GB"
+.Lxly_str_d949abbb1ffc3a30:
+    .asciz  "Partitions: /dev/sda1  /dev/sda2  /dev/sdb1"
+.Lxly_str_9feb1a1345ccc3e5:
+    .asciz  "Network"
+.Lxly_str_6ff4dd2c4d4b2175:
+    .asciz  "RX: "
+.Lxly_str_456fc7181822cd5a:
+    .asciz  "124"
+.Lxly_str_de1c2905ab018315:
+    .asciz  " Mbps"
+.Lxly_str_c5be4cfae5701073:
+    .asciz  "TX: "
+.Lxly_str_07ff8607b4c012ee:
+    .asciz  "38"
+.Lxly_str_aa7132687970bc43:
+    .asciz  "Pkts RX: "
+.Lxly_str_ca41963dc3d76d63:
+    .asciz  "8420"
+.Lxly_str_d3c3c29d8f4a60c5:
+    .asciz  "Pkts TX: "
+.Lxly_str_95caa2cfa43aeb10:
+    .asciz  "5130"
+.Lxly_str_7ddb992604c3eb8f:
+    .asciz  "eth0  lo  docker0"
+.Lxly_str_fdd447bcde2c13ba:
+    .asciz  "Processes"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_0f45d616d13c05ba:
+    .asciz  "PROCESS"
+.Lxly_str_8d4bb019f3bc7202:
+    .asciz  "PID"
+.Lxly_str_3627459bf85fece4:
+    .asciz  "CPU%"
+.Lxly_str_2658d2abf6c5ac6c:
+    .asciz  "MEM(MB)"
+.Lxly_str_2e825627746d5b6f:
+    .asciz  "STATUS"
+.Lxly_str_f27f734b7b4b8875:
+    .asciz  "  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200  \342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
+.Lxly_str_af63984c86017900:
+    .asciz  "%"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_3f16727d4e2e895d:
+    .asciz  "  r: refresh   p: processes   n: network   d: disk   q: quit  \342\224\202  Platform: "
+.Lxly_str_af63c74c8601c8dd:
+    .asciz  "\n"
+.Lxly_str_af63b64c8601abfa:
+    .asciz  ";"
+.Lxly_str_af64054c86023237:
+    .asciz  "H"
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_5665be1b8870744c:
+    .asciz  "\342\225\224"
+.Lxly_str_5665ba1b88706d80:
+    .asciz  "\342\225\220"
+.Lxly_str_5665c11b88707965:
+    .asciz  "\342\225\227"
+.Lxly_str_5665bb1b88706f33:
+    .asciz  "\342\225\221"
+.Lxly_str_5665c41b88707e7e:
+    .asciz  "\342\225\232"
+.Lxly_str_5665c71b88708397:
+    .asciz  "\342\225\235"
+.Lxly_str_566ff41b88792493:
+    .asciz  "\342\226\210"
+.Lxly_str_62f7e4f9b5705184:
+    .asciz  "0;0H"
+.Lxly_str_566ffb1b88793078:
+    .asciz  "\342\226\201"
+.Lxly_str_823b87195ce20e23:
+    .asciz  "set"
+.Lxly_str_566ffe1b88793591:
+    .asciz  "\342\226\202"
+.Lxly_str_566ffd1b887933de:
+    .asciz  "\342\226\203"
+.Lxly_str_5670001b887938f7:
+    .asciz  "\342\226\204"
+.Lxly_str_566fff1b88793744:
+    .asciz  "\342\226\205"
+.Lxly_str_5670021b88793c5d:
+    .asciz  "\342\226\206"
+.Lxly_str_5670011b88793aaa:
+    .asciz  "\342\226\207"
+.Lxly_str_af63ac4c86019afc:
+    .asciz  "1"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   31
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   248
@@ -0,0 +1,1032 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $784, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_7d7d8672f2d2acb1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6c587c8691cffa9c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r13
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -48(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k165(%rip), %rax
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_ir0_k166(%rip), %rax
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_ir0_k167(%rip), %rax
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_ir0_k168(%rip), %rax
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k169(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $48, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movq    $5, %rsi
+    call    xly_array_create
+    addq    $48, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_758bdaf11873899c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k170(%rip), %rax
+    movq    %rax, -112(%rbp)
+    movq    %r15, %rdi
+    movq    -112(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k171(%rip), %rax
+    movq    %rax, -128(%rbp)
+    movq    %r15, %rdi
+    movq    -128(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -136(%rbp)
+    leaq    .Lxly_ir0_k172(%rip), %rax
+    movq    %rax, -144(%rbp)
+    movq    %r15, %rdi
+    movq    -144(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k173(%rip), %rax
+    movq    %rax, -160(%rbp)
+    movq    %r15, %rdi
+    movq    -160(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_ir0_k174(%rip), %rax
+    movq    %rax, -176(%rbp)
+    movq    %r15, %rdi
+    movq    -176(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -184(%rbp)
+    subq    $48, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6b297974c5bbe59f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, -200(%rbp)
+    movabsq $0x40091eb851eb851f, %rax
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k175(%rip), %rax
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k176(%rip), %rax
+    movq    %rax, -224(%rbp)
+    subq    $32, %rsp
+    movq    -216(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movq    $4, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_117874d425ec06e7(%rip), %rdi
+    call    xly_str
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k177(%rip), %rax
+    movq    %rax, -240(%rbp)
+    movq    %r15, %rdi
+    movq    -240(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -248(%rbp)
+    subq    $16, %rsp
+    movq    -232(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -248(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1174f2d425e8f42a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_ir0_k178(%rip), %rax
+    movq    %rax, -264(%rbp)
+    movq    %r15, %rdi
+    movq    -264(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -272(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_117ef4d425f14c15(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    leaq    .Lxly_ir0_k179(%rip), %rax
+    movq    %rax, -288(%rbp)
+    movq    %r15, %rdi
+    movq    -288(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -280(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_117b6ad425ee2bc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k180(%rip), %rax
+    movq    %rax, -312(%rbp)
+    movq    %r15, %rdi
+    movq    -312(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -320(%rbp)
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -320(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_245eb71c16a776a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k181(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k182(%rip), %rax
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_ir0_k183(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k184(%rip), %rax
+    movq    %rax, -344(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -344(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -352(%rbp)
+    movabsq $0x4018000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k185(%rip), %rax
+    movq    %rax, -360(%rbp)
+    leaq    .Lxly_ir0_k186(%rip), %rax
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    -360(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -368(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -376(%rbp)
+    subq    $32, %rsp
+    movq    -336(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -352(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_a47d5f380e8e9dc3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir0_k187(%rip), %rax
+    movq    %rax, -392(%rbp)
+    movq    %r15, %rdi
+    movq    -392(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -400(%rbp)
+    leaq    .Lxly_ir0_k188(%rip), %rax
+    movq    %rax, -408(%rbp)
+    movq    -400(%rbp), %rdi
+    movq    -408(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -416(%rbp)
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, -424(%rbp)
+    movq    %r15, %rdi
+    movq    -424(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, -440(%rbp)
+    movq    -432(%rbp), %rdi
+    movq    -440(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -448(%rbp)
+    subq    $32, %rsp
+    movq    -384(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -416(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_a479dd380e8b8b06(%rip), %rdi
+    call    xly_str
+    movq    %rax, -456(%rbp)
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, -464(%rbp)
+    movq    %r15, %rdi
+    movq    -464(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -472(%rbp)
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, -480(%rbp)
+    movq    -472(%rbp), %rdi
+    movq    -480(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -488(%rbp)
+    leaq    .Lxly_ir0_k193(%rip), %rax
+    movq    %rax, -496(%rbp)
+    movq    %r15, %rdi
+    movq    -496(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -504(%rbp)
+    leaq    .Lxly_ir0_k194(%rip), %rax
+    movq    %rax, -512(%rbp)
+    movq    -504(%rbp), %rdi
+    movq    -512(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -520(%rbp)
+    subq    $32, %rsp
+    movq    -456(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -488(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -520(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_a483df380e93e2f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -528(%rbp)
+    leaq    .Lxly_ir0_k195(%rip), %rax
+    movq    %rax, -536(%rbp)
+    movq    %r15, %rdi
+    movq    -536(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -544(%rbp)
+    leaq    .Lxly_ir0_k196(%rip), %rax
+    movq    %rax, -552(%rbp)
+    movq    -544(%rbp), %rdi
+    movq    -552(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -560(%rbp)
+    leaq    .Lxly_ir0_k197(%rip), %rax
+    movq    %rax, -568(%rbp)
+    movq    %r15, %rdi
+    movq    -568(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -576(%rbp)
+    leaq    .Lxly_ir0_k198(%rip), %rax
+    movq    %rax, %r15
+    movq    -576(%rbp), %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, -584(%rbp)
+    subq    $32, %rsp
+    movq    -528(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -560(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -584(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7818186532f6e3d4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b2:
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, -592(%rbp)
+    movabsq $0x402e000000000000, %rax
+    movq    %rax, -600(%rbp)
+    leaq    .Lxly_ir0_k199(%rip), %rax
+    movq    %rax, -608(%rbp)
+    leaq    .Lxly_ir0_k200(%rip), %rax
+    movq    %rax, -616(%rbp)
+    leaq    .Lxly_ir0_k201(%rip), %rax
+    movq    %rax, -624(%rbp)
+    subq    $32, %rsp
+    movq    -608(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -616(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -624(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b1:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_ir0_k202(%rip), %rax
+    movq    %rax, -632(%rbp)
+    movq    %r15, %rdi
+    movq    -632(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -640(%rbp)
+    leaq    .Lxly_ir0_k203(%rip), %rax
+    movq    %rax, -648(%rbp)
+    movq    %r15, %rdi
+    movq    -648(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -656(%rbp)
+    leaq    .Lxly_ir0_k204(%rip), %rax
+    movq    %rax, -664(%rbp)
+    movq    %r15, %rdi
+    movq    -664(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -672(%rbp)
+    subq    $32, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -640(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -656(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -672(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2bd260b1853b8e88(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_277168330cabba07(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2a08f846b0ac7d5f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k205(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k206(%rip), %rax
+    movq    %rax, -680(%rbp)
+    movq    -680(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r15
+    movabsq $0x4069000000000000, %rax
+    movq    %rax, -688(%rbp)
+    movabsq $0xc024000000000000, %rax
+    movq    %rax, -696(%rbp)
+    leaq    .Lxly_ir0_k207(%rip), %rax
+    movq    %rax, -704(%rbp)
+    leaq    .Lxly_ir0_k208(%rip), %rax
+    movq    %rax, -712(%rbp)
+    leaq    .Lxly_ir0_k209(%rip), %rax
+    movq    %rax, -720(%rbp)
+    subq    $32, %rsp
+    movq    -704(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -712(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -720(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_db25fec41a20365e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -728(%rbp)
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, -736(%rbp)
+    movq    %r15, %rdi
+    movq    -736(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_a4d3219fb8aff78a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k211(%rip), %rax
+    movq    %rax, -744(%rbp)
+    movq    %r15, %rdi
+    movq    -744(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -752(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -752(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6fac9d553892d4f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k212(%rip), %rax
+    movq    %rax, -760(%rbp)
+    movq    %r15, %rdi
+    movq    -760(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -768(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -768(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_bab632836569d084(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_ir0_k213(%rip), %rax
+    movq    %rax, -776(%rbp)
+    leaq    .Lxly_ir0_k214(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k215(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k216(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k217(%rip), %rax
+    movq    %rax, %r15
+    subq    $48, %rsp
+    movq    -776(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movq    $5, %rsi
+    call    xly_array_create
+    addq    $48, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_98cb34196f030fdc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_82719e195d0fc4a8(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    -728(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_6ba3abb9edcca860(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k165:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k166:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k167:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k168:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k169:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k170:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k171:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k172:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k173:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k174:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k175:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k176:
+    .quad   0, 0x40091eb851eb851f, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k177:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k178:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k179:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k180:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k181:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k182:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k183:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k184:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k185:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k186:
+    .quad   0, 0x4018000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k187:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k188:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k189:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k193:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k194:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k195:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k196:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k197:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k198:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k199:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k200:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k201:
+    .quad   0, 0x402e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k202:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k203:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k204:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k205:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k206:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k207:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k208:
+    .quad   0, 0x4069000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k209:
+    .quad   0, 0xc024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k210:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k211:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k212:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k213:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k214:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k215:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k216:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k217:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_createArray:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_7d7d8672f2d2acb1:
+    .asciz  "=== Array Literals in Native Compiler ==="
+.Lxly_str_6c587c8691cffa9c:
+    .asciz  "1. Simple Array Literal:"
+.Lxly_str_758bdaf11873899c:
+    .asciz  "  Array:"
+.Lxly_str_6b297974c5bbe59f:
+    .asciz  "2. Mixed Types:"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_117874d425ec06e7:
+    .asciz  "  Element 0:"
+.Lxly_str_1174f2d425e8f42a:
+    .asciz  "  Element 1:"
+.Lxly_str_117ef4d425f14c15:
+    .asciz  "  Element 2:"
+.Lxly_str_117b6ad425ee2bc0:
+    .asciz  "  Element 3:"
+.Lxly_str_245eb71c16a776a7:
+    .asciz  "3. Nested Arrays:"
+.Lxly_str_a47d5f380e8e9dc3:
+    .asciz  "  Row 0:"
+.Lxly_str_a479dd380e8b8b06:
+    .asciz  "  Row 1:"
+.Lxly_str_a483df380e93e2f1:
+    .asciz  "  Row 2:"
+.Lxly_str_7818186532f6e3d4:
+    .asciz  "4. Array from Function:"
+.Lxly_str_2bd260b1853b8e88:
+    .asciz  "5. Empty Array:"
+.Lxly_str_277168330cabba07:
+    .asciz  "  Empty array created"
+.Lxly_str_2a08f846b0ac7d5f:
+    .asciz  "6. Array with Expressions:"
+.Lxly_str_db25fec41a20365e:
+    .asciz  "  Sum:"
+.Lxly_str_a4d3219fb8aff78a:
+    .asciz  "  Product:"
+.Lxly_str_6fac9d553892d4f0:
+    .asciz  "  Difference:"
+.Lxly_str_bab632836569d084:
+    .asciz  "7. Arrays with Stdlib:"
+.Lxly_str_98cb34196f030fdc:
+    .asciz  "  Array length:"
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_82719e195d0fc4a8:
+    .asciz  "sum"
+.Lxly_str_6ba3abb9edcca860:
+    .asciz  "\342\234\205 Array literals working in native compiler!"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   9
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   72
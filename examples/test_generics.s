@@ -0,0 +1,1308 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    leaq    .Lxly_class_0_fields(%rip), %rdi
+    movl    $1, %esi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $320, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_d4e1daed358ad436(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4a38d4a935f05fae(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b9accb434b168fc2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2d316dd06a25563b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c25fdaa795e6b541(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b2:
+.Lxly_ir0_b1:
+    leaq    .Lxly_ir0_k184(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b4:
+.Lxly_ir0_b3:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r15
+.Lxly_ir0_b6:
+.Lxly_ir0_b5:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_1825c03de168e8d1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k185(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_d0e42ba66d9b0419(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_92d341701931653f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_07a37f655774ef7a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_371db7389d93955e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -96(%rbp)
+    subq    $16, %rsp
+    movq    -96(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c0915efb9381a04d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_str_1a08aa1921ca5caf(%rip), %rdi
+    call    xly_str
+    movq    %rax, -120(%rbp)
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k186(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -136(%rbp)
+.Lxly_ir0_b7:
+    movq    -136(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k187(%rip), %rax
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -152(%rbp)
+.Lxly_ir0_b9:
+    movq    -152(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, -160(%rbp)
+.Lxly_ir0_b12:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -168(%rbp)
+.Lxly_ir0_b11:
+    movq    -168(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_a7f56fd7a0db37ea(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_86b7ba6334a94f25(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_236b30d8baac974a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1f09905ad162a06e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_124e225b934a54d8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_cf0676d25900b1a5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_class_0(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r15
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k188(%rip), %rax
+    movq    %rax, -176(%rbp)
+    movq    %r15, %rax
+    movq    -176(%rbp), %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+.Lxly_ir0_b13:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_class_0(%rip), %rdi
+    call    xly_new
+    movq    %rax, %r12
+.Lxly_ir0_b16:
+    movq    %r12, %rax
+    movq    %r14, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+.Lxly_ir0_b15:
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_1063b5ca95b95a05(%rip), %rdi
+    call    xly_str
+    movq    %rax, -184(%rbp)
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_1
+    cmpl    $10, (%rdi)
+    jne     .Lxly_1
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_1
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_1
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_2
+.Lxly_1:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_2:
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -184(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -192(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_7f95151799c2bb49(%rip), %rdi
+    call    xly_str
+    movq    %rax, -200(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_3
+    cmpl    $10, (%rdi)
+    jne     .Lxly_3
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_3
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_3
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_4
+.Lxly_3:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_4:
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -200(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_ir0_k189(%rip), %rax
+    movq    %rax, -224(%rbp)
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_5
+    cmpl    $10, (%rdi)
+    jne     .Lxly_5
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_5
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_5
+    movq    -224(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_6
+.Lxly_5:
+    subq    $16, %rsp
+    movq    -224(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_6:
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_str_4f59ff5e730c8af3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -240(%rbp)
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_7
+    cmpl    $10, (%rdi)
+    jne     .Lxly_7
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    cmpq    $2, 40(%r11)
+    jle     .Lxly_7
+    movq    48(%r11), %r11
+    movq    16(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_7
+    movq    -240(%rbp), %rsi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_8
+.Lxly_7:
+    subq    $16, %rsp
+    movq    -240(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_str_823b87195ce20e23(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+.Lxly_8:
+    movq    %rax, -248(%rbp)
+    leaq    .Lxly_str_49937356a61514f9(%rip), %rdi
+    call    xly_str
+    movq    %rax, -256(%rbp)
+    subq    $16, %rsp
+    movq    -256(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_566c8f8cbad52226(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    movq    %r15, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_9
+    cmpl    $10, (%rdi)
+    jne     .Lxly_9
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_9
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_9
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_10
+.Lxly_9:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_10:
+    movq    %rax, -272(%rbp)
+    subq    $16, %rsp
+    movq    -264(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -272(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5b070bb99bf6c353(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r12, %rdi
+    testq   %rdi, %rdi
+    je      .Lxly_11
+    cmpl    $10, (%rdi)
+    jne     .Lxly_11
+    movq    72(%rdi), %r11
+    movq    32(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    cmpq    $1, 40(%r11)
+    jle     .Lxly_11
+    movq    48(%r11), %r11
+    movq    8(%r11), %r11
+    testq   %r11, %r11
+    je      .Lxly_11
+    xorl    %esi, %esi
+    xorl    %edx, %edx
+    xorl    %ecx, %ecx
+    xorl    %r8d, %r8d
+    xorl    %r9d, %r9d
+    call    *%r11
+    jmp     .Lxly_12
+.Lxly_11:
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    xorq    %rdx, %rdx
+    movl    $0, %ecx
+    call    xly_obj_call
+.Lxly_12:
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f4141ac46bf19722(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_bfda02b090aa4c77(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_90ddabbde595b891(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c959bcd739cd7279(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_fn_double(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -288(%rbp)
+.Lxly_ir0_b18:
+    leaq    .Lxly_ir0_k190(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -296(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+.Lxly_ir0_b17:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -304(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b29c82b9346f3b3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_fn_shout(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r15
+.Lxly_ir0_b20:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, -312(%rbp)
+.Lxly_ir0_b19:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_fc0fc2f017bfdb75(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0647ed4d5b85ee6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_50625834202a5bd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_67f04d48c95207df(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+.Lxly_ir0_b22:
+    leaq    .Lxly_ir0_k191(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b21:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1d57c258b0464636(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b24:
+    leaq    .Lxly_ir0_k192(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    call    .Lxly_fn_wrap
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    call    .Lxly_fn_wrap
+    movq    %rax, %r14
+.Lxly_ir0_b23:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5fd686c01dac6ead(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_f9e6e6ef197c2b25(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b26:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r13
+.Lxly_ir0_b25:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_aa1c4e8879e81fa8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5521324d4a01b27c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b7781349ef8c1270(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9ab04c2501074929(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b394c129a09cbc09(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b37a7f629074d74e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1e0fe5373716391c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_4f61f7b7ea3d03ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_6d526da00f92a35e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k184:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k185:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k186:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k187:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k188:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k189:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k190:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k191:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k192:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Box.init:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Box.get:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    0(%rax), %rax
+    testq   %rax, %rax
+    jne     .Lxly_f1_1
+    call    xly_null
+.Lxly_f1_1:
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Box.set:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movq    %r12, %rcx
+    movq    72(%rax), %rax
+    movq    8(%rax), %rax
+    movq    %rcx, 0(%rax)
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_identity:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_pair:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_apply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_call_fnval
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_double:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_shout:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_af639c4c86017fcc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f7_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f7_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f7_2
+.Lxly_f7_1:
+    call    xly_add
+.Lxly_f7_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_wrap:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_doubleWrap:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+.Lxly_irf9_0_b3:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf9_0_b2:
+.Lxly_irf9_0_b5:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf9_0_b4:
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_class_0:
+    .quad   .Lxly_str_16564e19b102f152
+    .quad   0
+    .quad   .Lxly_fn_Box.init
+    .quad   1
+    .quad   .Lxly_class_0_fields
+    .quad   3
+    .quad   .Lxly_class_0_vtable
+    .quad   .Lxly_selectors
+.Lxly_class_0_fields:
+    .quad   .Lxly_str_7ce4fd9430e80cea
+.Lxly_class_0_vtable:
+    .quad   .Lxly_fn_Box.init
+    .quad   .Lxly_fn_Box.get
+    .quad   .Lxly_fn_Box.set
+.Lxly_selectors:
+    .quad   .Lxly_str_f5d2afc57ab57213
+    .quad   .Lxly_str_d4e26318faaa79f7
+    .quad   .Lxly_str_823b87195ce20e23
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_d4e1daed358ad436:
+    .asciz  "\342\225\224\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\227"
+.Lxly_str_4a38d4a935f05fae:
+    .asciz  "\342\225\221         Xenly Generic Programming Tests                \342\225\221"
+.Lxly_str_b9accb434b168fc2:
+    .asciz  "\342\225\232\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\220\342\225\235"
+.Lxly_str_2d316dd06a25563b:
+    .asciz  "Test 1: Generic Identity Function"
+.Lxly_str_c25fdaa795e6b541:
+    .asciz  "\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_1825c03de168e8d1:
+    .asciz  "identity(42) ="
+.Lxly_str_d0e42ba66d9b0419:
+    .asciz  "identity(\"hello\") ="
+.Lxly_str_92d341701931653f:
+    .asciz  "identity(true) ="
+.Lxly_str_07a37f655774ef7a:
+    .asciz  "\342\234\223 Generic identity works with multiple types"
+.Lxly_str_371db7389d93955e:
+    .asciz  "Test 2: Generic Pair Function"
+.Lxly_str_c0915efb9381a04d:
+    .asciz  "\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
+.Lxly_str_1a08aa1921ca5caf:
+    .asciz  "one"
+.Lxly_str_a7f56fd7a0db37ea:
+    .asciz  "pair(1, \"one\") ="
+.Lxly_str_86b7ba6334a94f25:
+    .asciz  "pair(\"hello\", 42) ="
+.Lxly_str_236b30d8baac974a:
+    .asciz  "pair(true, false) ="
+.Lxly_str_1f09905ad162a06e:
+    .asciz  "\342\234\223 Generic pair works with different type combinations"
+.Lxly_str_124e225b934a54d8:
+    .asciz  "Test 3: Generic Container Class"
+.Lxly_str_cf0676d25900b1a5:
+    .asciz  "\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
+.Lxly_str_1063b5ca95b95a05:
+    .asciz  "Box<number>.get() ="
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_7f95151799c2bb49:
+    .asciz  "Box<string>.get() ="
+.Lxly_str_823b87195ce20e23:
+    .asciz  "set"
+.Lxly_str_4f59ff5e730c8af3:
+    .asciz  "world"
+.Lxly_str_49937356a61514f9:
+    .asciz  "After set:"
+.Lxly_str_566c8f8cbad52226:
+    .asciz  "  numBox.get() ="
+.Lxly_str_5b070bb99bf6c353:
+    .asciz  "  strBox.get() ="
+.Lxly_str_f4141ac46bf19722:
+    .asciz  "\342\234\223 Generic classes work"
+.Lxly_str_bfda02b090aa4c77:
+    .asciz  "Test 4: Generic Higher-Order Functions"
+.Lxly_str_90ddabbde595b891:
+    .asciz  "\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
+.Lxly_str_c959bcd739cd7279:
+    .asciz  "apply(double, 5) ="
+.Lxly_str_b29c82b9346f3b3e:
+    .asciz  "apply(shout, \"hello\") ="
+.Lxly_str_fc0fc2f017bfdb75:
+    .asciz  "\342\234\223 Generic higher-order functions work"
+.Lxly_str_0647ed4d5b85ee6b:
+    .asciz  "Test 5: Nested Generics"
+.Lxly_str_50625834202a5bd1:
+    .asciz  "\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200\342\224\200"
+.Lxly_str_67f04d48c95207df:
+    .asciz  "wrap(42) ="
+.Lxly_str_1d57c258b0464636:
+    .asciz  "doubleWrap(42) ="
+.Lxly_str_5fd686c01dac6ead:
+    .asciz  "wrap(\"test\") ="
+.Lxly_str_f9e6e6ef197c2b25:
+    .asciz  "test"
+.Lxly_str_aa1c4e8879e81fa8:
+    .asciz  "\342\234\223 Nested generic calls work"
+.Lxly_str_5521324d4a01b27c:
+    .asciz  "\342\225\221           All Generic Tests Passed! \342\234\223                  \342\225\221"
+.Lxly_str_b7781349ef8c1270:
+    .asciz  "Generic programming features:"
+.Lxly_str_9ab04c2501074929:
+    .asciz  "  \342\200\242 Generic functions with type parameters"
+.Lxly_str_b394c129a09cbc09:
+    .asciz  "  \342\200\242 Multiple type parameters (T, U, etc.)"
+.Lxly_str_b37a7f629074d74e:
+    .asciz  "  \342\200\242 Generic classes"
+.Lxly_str_1e0fe5373716391c:
+    .asciz  "  \342\200\242 Type annotations on parameters"
+.Lxly_str_4f61f7b7ea3d03ed:
+    .asciz  "  \342\200\242 Generic higher-order functions"
+.Lxly_str_6d526da00f92a35e:
+    .asciz  "  \342\200\242 Nested generic calls"
+.Lxly_str_af639c4c86017fcc:
+    .asciz  "!"
+.Lxly_str_16564e19b102f152:
+    .asciz  "Box"
+.Lxly_str_7ce4fd9430e80cea:
+    .asciz  "value"
+.Lxly_str_f5d2afc57ab57213:
+    .asciz  "init"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   8
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   64
@@ -0,0 +1,346 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $512, %rsp
+    subq    $16, %rsp
+    leaq    .Lxly_str_269342667aa2691e(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_8eb765d7ae739c67(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $32, %rsp
+    leaq    .Lxly_str_db3f053403ad937a(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movabsq $4665606068653522944, %rax
+    movq    %rax, -8(%rsp)
+    movsd   -8(%rsp), %xmm0
+    call    xly_num
+    movq    %rax, 8(%rsp)
+    movl    $0, %edi
+    call    xly_bool
+    movq    %rax, 16(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    movq    16(%rsp), %rdx
+    addq    $32, %rsp
+    call    .Lxly_fn_connect
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_3802f0f7d6b5f154(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $32, %rsp
+    call    xly_null
+    movq    %rax, 0(%rsp)
+    call    xly_null
+    movq    %rax, 8(%rsp)
+    call    xly_null
+    movq    %rax, 16(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    movq    16(%rsp), %rdx
+    addq    $32, %rsp
+    call    .Lxly_fn_connect
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_ff8f4a4835280de6(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $32, %rsp
+    leaq    .Lxly_str_20638d06cbb7b448(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    call    xly_null
+    movq    %rax, 8(%rsp)
+    call    xly_null
+    movq    %rax, 16(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    movq    16(%rsp), %rdx
+    addq    $32, %rsp
+    call    .Lxly_fn_connect
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_927769be8aefefa5(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    call    xly_null
+    movq    %rax, 0(%rsp)
+    movq    0(%rsp), %rdi
+    addq    $16, %rsp
+    xorq    %rsi, %rsi
+    xorq    %rdx, %rdx
+    call    .Lxly_fn_request
+    subq    $16, %rsp
+    call    xly_null
+    movq    %rax, 0(%rsp)
+    call    xly_null
+    movq    %rax, 8(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    addq    $16, %rsp
+    xorq    %rdx, %rdx
+    call    .Lxly_fn_request
+    subq    $32, %rsp
+    call    xly_null
+    movq    %rax, 0(%rsp)
+    call    xly_null
+    movq    %rax, 8(%rsp)
+    call    xly_null
+    movq    %rax, 16(%rsp)
+    movq    0(%rsp), %rdi
+    movq    8(%rsp), %rsi
+    movq    16(%rsp), %rdx
+    addq    $32, %rsp
+    call    .Lxly_fn_request
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    subq    $16, %rsp
+    leaq    .Lxly_str_7382a27aa52a4075(%rip), %rdi
+    call    xly_str
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_connect:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    leaq    .Lxly_str_e9370081ea858de4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63b74c8601adad(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_a157f05623885c2b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_str_af63a44c86018d64(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    subq    $64, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 24(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 40(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 48(%rsp)
+    movq    %rsp, %rdi
+    movl    $7, %esi
+    call    xly_print
+    addq    $64, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_request:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $80, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    cmpq    $0, %r12
+    sete    %al
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf1_0_b5
+.Lxly_irf1_0_b1:
+    leaq    .Lxly_str_ea7e631998067e17(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    jmp     .Lxly_irf1_0_b2
+.Lxly_irf1_0_b5:
+    movq    %r12, %r14
+.Lxly_irf1_0_b2:
+    xorl    %eax, %eax
+    cmpq    $0, %r13
+    sete    %al
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf1_0_b6
+.Lxly_irf1_0_b3:
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf1_0_k22(%rip), %rax
+    movq    %rax, %r15
+    jmp     .Lxly_irf1_0_b4
+.Lxly_irf1_0_b6:
+    movq    %r13, %r15
+.Lxly_irf1_0_b4:
+    leaq    .Lxly_str_418181f8c398c610(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_str_08d8f707b578c3b1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $48, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 24(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 32(%rsp)
+    movq    %rsp, %rdi
+    movl    $5, %esi
+    call    xly_print
+    addq    $48, %rsp
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf1_0_k22:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_269342667aa2691e:
+    .asciz  "=== Named Parameters Test ==="
+.Lxly_str_8eb765d7ae739c67:
+    .asciz  "Positional:"
+.Lxly_str_db3f053403ad937a:
+    .asciz  "localhost"
+.Lxly_str_3802f0f7d6b5f154:
+    .asciz  "Named:"
+.Lxly_str_ff8f4a4835280de6:
+    .asciz  "Mixed:"
+.Lxly_str_20638d06cbb7b448:
+    .asciz  "api.com"
+.Lxly_str_927769be8aefefa5:
+    .asciz  "With defaults:"
+.Lxly_str_7382a27aa52a4075:
+    .asciz  "\342\234\205 Named parameters working!"
+.Lxly_str_e9370081ea858de4:
+    .asciz  "Connecting to"
+.Lxly_str_af63b74c8601adad:
+    .asciz  ":"
+.Lxly_str_a157f05623885c2b:
+    .asciz  "(SSL:"
+.Lxly_str_af63a44c86018d64:
+    .asciz  ")"
+.Lxly_str_ea7e631998067e17:
+    .asciz  "GET"
+.Lxly_str_418181f8c398c610:
+    .asciz  "(timeout:"
+.Lxly_str_08d8f707b578c3b1:
+    .asciz  "s)"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   0
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   8
@@ -0,0 +1,404 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k52(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_42a3fc4910d22ed1(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k53(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_42a3fc4910d22ed1(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_6296ad16508910d3(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k54(%rip), %rax
+    movq    %rax, -48(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_bd76100bd58c9c0d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_0dd9b0d16020da27(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k55(%rip), %rax
+    movq    %rax, -64(%rbp)
+    movq    %r13, %rdi
+    movq    -64(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -72(%rbp)
+    leaq    .Lxly_str_2127b2cf1a4dc570(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k56(%rip), %rax
+    movq    %rax, -88(%rbp)
+    movq    %r13, %rdi
+    movq    -88(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -96(%rbp)
+    subq    $32, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, -104(%rbp)
+    movabsq $0x4049000000000000, %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_ir0_k57(%rip), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -104(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_bd76100bd58c9c0d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_e4115bc84e61ea76(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_ir0_k58(%rip), %rax
+    movq    %rax, -136(%rbp)
+    movq    %r13, %rdi
+    movq    -136(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -144(%rbp)
+    subq    $16, %rsp
+    movq    -128(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k59(%rip), %rax
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_6296ad16508910d3(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0xbff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k60(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_bd76100bd58c9c0d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_ir0_k61(%rip), %rax
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_ir0_k62(%rip), %rax
+    movq    %rax, %r13
+    movq    %r14, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, -176(%rbp)
+    subq    $32, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -176(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_43a1d592b711330f(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movq    $1, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k63(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_d18164d68ac8d75e(%rip), %rdi
+    leaq    .Lxly_str_bd76100bd58c9c0d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_745a04e63a95734d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k64(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k65(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k52:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k53:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k54:
+    .quad   0, 0x4059000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k55:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k56:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k57:
+    .quad   0, 0x4049000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k58:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k59:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k60:
+    .quad   0, 0xbff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k61:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k62:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k63:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k64:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k65:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_d18164d68ac8d75e:
+    .asciz  "multiproc"
+.Lxly_str_42a3fc4910d22ed1:
+    .asciz  "channel_create"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_6296ad16508910d3:
+    .asciz  "channel_send"
+.Lxly_str_bd76100bd58c9c0d:
+    .asciz  "select"
+.Lxly_str_0dd9b0d16020da27:
+    .asciz  "fired:"
+.Lxly_str_2127b2cf1a4dc570:
+    .asciz  "value:"
+.Lxly_str_e4115bc84e61ea76:
+    .asciz  "timeout:"
+.Lxly_str_43a1d592b711330f:
+    .asciz  "channel_close"
+.Lxly_str_745a04e63a95734d:
+    .asciz  "closed:"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   3
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   24
@@ -0,0 +1,727 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $128, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    leaq    .Lxly_str_f8244dfed2c04c73(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_a67f95223abf4155(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k79(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_54db247d046ab340(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_b3965307749b3792(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k80(%rip), %rax
+    movq    %rax, -48(%rbp)
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_4c31fb7cff833feb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_02c3e451250cc8f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_6707fa7d0ef41df6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_77745914edbd5da5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_d180297c42d45998(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, %r14
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, %r15
+.Lxly_ir0_b2:
+    leaq    .Lxly_ir0_k81(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k82(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b1:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_462d2f6e8a2fabf9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k83(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r15, %rdi
+    movq    %rbx, %rsi
+    call    xly_index
+    movq    %rax, -56(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k84(%rip), %rax
+    movq    %rax, -64(%rbp)
+    movq    %r15, %rdi
+    movq    -64(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -72(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_36ace119c2ac7da1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+.Lxly_ir0_b4:
+    leaq    .Lxly_ir0_k85(%rip), %rax
+    movq    %rax, -88(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -80(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b3:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_ba4f00174503be96(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k86(%rip), %rax
+    movq    %rax, -96(%rbp)
+    movq    %r15, %rdi
+    movq    -96(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k87(%rip), %rax
+    movq    %rax, -104(%rbp)
+    movq    %r15, %rdi
+    movq    -104(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %rbx
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -112(%rbp)
+    leaq    .Lxly_ir0_k88(%rip), %rax
+    movq    %rax, -120(%rbp)
+    movq    %r15, %rdi
+    movq    -120(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -128(%rbp)
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_cac2ae0e1e769956(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    .Lxly_fn_MathNamespace
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_bfede5fbe7663c4c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k89(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    leaq    .Lxly_str_7884f79b0c364646(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_833e52f989e126dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k90(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rdi
+    leaq    .Lxly_str_4c5f6190acb3dc80(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9cb8a89e50810330(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    .Lxly_fn_GraphicsNamespace
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_d8d1214fd4d17133(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    .Lxly_atom_7e860296d38b6351(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    .Lxly_atom_a05ebe19ff08b6fc(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8d657ba025441d60(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k79:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k80:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k81:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k82:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k83:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k84:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k85:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k86:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k87:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k88:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k89:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k90:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_createPoint:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_createPerson:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_MathNamespace:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_square__f2(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_7884f79b0c364646(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_cube__f2(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_4c5f6190acb3dc80(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_GraphicsNamespace:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+.Lxly_irf3_0_b3:
+    call    xly_obj_new
+    movq    %rax, %r12
+    leaq    .Lxly_str_e39a3d3a300bf18e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_a05ebe19ff08b6fc(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_6e921c4551ce1dee(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_ba0f168471813c1c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_f73aa19b47782cce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_d9e4d3a72638724d(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_irf3_0_b2:
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_7e860296d38b6351(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_square__f2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_cube__f2:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Colors__f3:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_str_e39a3d3a300bf18e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_a05ebe19ff08b6fc(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_6e921c4551ce1dee(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_ba0f168471813c1c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_f73aa19b47782cce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_d9e4d3a72638724d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   6
+.Lxly_atoms:
+.Lxly_atom_7e860296d38b6351:
+    .quad   .Lxly_str_7e860296d38b6351
+.Lxly_atom_a05ebe19ff08b6fc:
+    .quad   .Lxly_str_a05ebe19ff08b6fc
+.Lxly_atom_7884f79b0c364646:
+    .quad   .Lxly_str_7884f79b0c364646
+.Lxly_atom_4c5f6190acb3dc80:
+    .quad   .Lxly_str_4c5f6190acb3dc80
+.Lxly_atom_ba0f168471813c1c:
+    .quad   .Lxly_str_ba0f168471813c1c
+.Lxly_atom_d9e4d3a72638724d:
+    .quad   .Lxly_str_d9e4d3a72638724d
+
+.section .rodata
+.Lxly_str_f8244dfed2c04c73:
+    .asciz  "=== Type System Features ==="
+.Lxly_str_a67f95223abf4155:
+    .asciz  "1. Type Inference:"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_54db247d046ab340:
+    .asciz  "  x ="
+.Lxly_str_b3965307749b3792:
+    .asciz  "(inferred: number)"
+.Lxly_str_4c31fb7cff833feb:
+    .asciz  "  y ="
+.Lxly_str_02c3e451250cc8f6:
+    .asciz  "(inferred: string)"
+.Lxly_str_6707fa7d0ef41df6:
+    .asciz  "  z ="
+.Lxly_str_77745914edbd5da5:
+    .asciz  "(inferred: bool)"
+.Lxly_str_d180297c42d45998:
+    .asciz  "2. Tuples (Array Pattern):"
+.Lxly_str_462d2f6e8a2fabf9:
+    .asciz  "  Point:"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_36ace119c2ac7da1:
+    .asciz  "NYC"
+.Lxly_str_ba4f00174503be96:
+    .asciz  "  Person:"
+.Lxly_str_cac2ae0e1e769956:
+    .asciz  "3. Namespaces (Object Pattern):"
+.Lxly_str_bfede5fbe7663c4c:
+    .asciz  "  Math.square(5):"
+.Lxly_str_7884f79b0c364646:
+    .asciz  "square"
+.Lxly_str_833e52f989e126dc:
+    .asciz  "  Math.cube(3):"
+.Lxly_str_4c5f6190acb3dc80:
+    .asciz  "cube"
+.Lxly_str_9cb8a89e50810330:
+    .asciz  "4. Nested Namespaces:"
+.Lxly_str_d8d1214fd4d17133:
+    .asciz  "  Graphics.Colors.RED:"
+.Lxly_str_8d657ba025441d60:
+    .asciz  "\342\234\205 Type system features working!"
+.Lxly_str_e39a3d3a300bf18e:
+    .asciz  "#FF0000"
+.Lxly_str_6e921c4551ce1dee:
+    .asciz  "#00FF00"
+.Lxly_str_f73aa19b47782cce:
+    .asciz  "#0000FF"
+.Lxly_str_7e860296d38b6351:
+    .asciz  "Colors"
+.Lxly_str_a05ebe19ff08b6fc:
+    .asciz  "RED"
+.Lxly_str_ba0f168471813c1c:
+    .asciz  "GREEN"
+.Lxly_str_d9e4d3a72638724d:
+    .asciz  "BLUE"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   7
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   56
@@ -0,0 +1,6010 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $3632, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -3624(%rbp)
+    movq    %rax, -3616(%rbp)
+    movq    %rax, -3608(%rbp)
+    movq    %rax, -3600(%rbp)
+    movq    %rax, -3592(%rbp)
+    movq    %rax, -3584(%rbp)
+    movq    %rax, -3576(%rbp)
+    movq    %rax, -3568(%rbp)
+    movq    %rax, -3560(%rbp)
+    movq    %rax, -3552(%rbp)
+    movq    %rax, -3544(%rbp)
+    movq    %rax, -3536(%rbp)
+    movq    %rax, -3528(%rbp)
+    movq    %rax, -3520(%rbp)
+    movq    %rax, -3512(%rbp)
+    movq    %rax, -3504(%rbp)
+    movq    %rax, -3496(%rbp)
+    movq    %rax, -3488(%rbp)
+    movq    %rax, -3480(%rbp)
+    movq    %rax, -3472(%rbp)
+    movq    %rax, -3464(%rbp)
+    movq    %rax, -3456(%rbp)
+    movq    %rax, -3448(%rbp)
+    movq    %rax, -3440(%rbp)
+    movq    %rax, -3432(%rbp)
+    movq    %rax, -3424(%rbp)
+    movq    %rax, -3416(%rbp)
+    movq    %rax, -3408(%rbp)
+    movq    %rax, -3400(%rbp)
+    movq    %rax, -3392(%rbp)
+    movq    %rax, -3384(%rbp)
+    movq    %rax, -3376(%rbp)
+    movq    %rax, -3368(%rbp)
+    movq    %rax, -3360(%rbp)
+    movq    %rax, -3352(%rbp)
+    movq    %rax, -3344(%rbp)
+    movq    %rax, -3336(%rbp)
+    movq    %rax, -3328(%rbp)
+    movq    %rax, -3320(%rbp)
+    movq    %rax, -3312(%rbp)
+    movq    %rax, -3304(%rbp)
+    movq    %rax, -3296(%rbp)
+    movq    %rax, -3288(%rbp)
+    movq    %rax, -3280(%rbp)
+    movq    %rax, -3272(%rbp)
+    movq    %rax, -3264(%rbp)
+    movq    %rax, -3256(%rbp)
+    movq    %rax, -3248(%rbp)
+    movq    %rax, -3240(%rbp)
+    movq    %rax, -3232(%rbp)
+    movq    %rax, -3224(%rbp)
+    movq    %rax, -3216(%rbp)
+    movq    %rax, -3208(%rbp)
+    movq    %rax, -3200(%rbp)
+    movq    %rax, -3192(%rbp)
+    movq    %rax, -3184(%rbp)
+    movq    %rax, -3176(%rbp)
+    movq    %rax, -3168(%rbp)
+    movq    %rax, -3160(%rbp)
+    movq    %rax, -3152(%rbp)
+    movq    %rax, -3144(%rbp)
+    movq    %rax, -3136(%rbp)
+    movq    %rax, -3128(%rbp)
+    movq    %rax, -3120(%rbp)
+    movq    %rax, -3112(%rbp)
+    movq    %rax, -3104(%rbp)
+    movq    %rax, -3096(%rbp)
+    movq    %rax, -3088(%rbp)
+    movq    %rax, -3080(%rbp)
+    movq    %rax, -3072(%rbp)
+    movq    %rax, -3064(%rbp)
+    movq    %rax, -3056(%rbp)
+    movq    %rax, -3048(%rbp)
+    movq    %rax, -3040(%rbp)
+    movq    %rax, -3032(%rbp)
+    movq    %rax, -3024(%rbp)
+    movq    %rax, -3016(%rbp)
+    movq    %rax, -3008(%rbp)
+    movq    %rax, -3000(%rbp)
+    movq    %rax, -2992(%rbp)
+    movq    %rax, -2984(%rbp)
+    movq    %rax, -2976(%rbp)
+    movq    %rax, -2968(%rbp)
+    movq    %rax, -2960(%rbp)
+    movq    %rax, -2952(%rbp)
+    movq    %rax, -2944(%rbp)
+    movq    %rax, -2936(%rbp)
+    movq    %rax, -2928(%rbp)
+    movq    %rax, -2920(%rbp)
+    movq    %rax, -2912(%rbp)
+    movq    %rax, -2904(%rbp)
+    movq    %rax, -2896(%rbp)
+    movq    %rax, -2888(%rbp)
+    movq    %rax, -2880(%rbp)
+    movq    %rax, -2872(%rbp)
+    movq    %rax, -2864(%rbp)
+    movq    %rax, -2856(%rbp)
+    movq    %rax, -2848(%rbp)
+    movq    %rax, -2840(%rbp)
+    movq    %rax, -2832(%rbp)
+    movq    %rax, -2824(%rbp)
+    movq    %rax, -2816(%rbp)
+    movq    %rax, -2808(%rbp)
+    movq    %rax, -2800(%rbp)
+    movq    %rax, -2792(%rbp)
+    movq    %rax, -2784(%rbp)
+    movq    %rax, -2776(%rbp)
+    movq    %rax, -2768(%rbp)
+    movq    %rax, -2760(%rbp)
+    movq    %rax, -2752(%rbp)
+    movq    %rax, -2744(%rbp)
+    movq    %rax, -2736(%rbp)
+    movq    %rax, -2728(%rbp)
+    movq    %rax, -2720(%rbp)
+    movq    %rax, -2712(%rbp)
+    movq    %rax, -2704(%rbp)
+    movq    %rax, -2696(%rbp)
+    movq    %rax, -2688(%rbp)
+    movq    %rax, -2680(%rbp)
+    movq    %rax, -2672(%rbp)
+    movq    %rax, -2664(%rbp)
+    movq    %rax, -2656(%rbp)
+    movq    %rax, -2648(%rbp)
+    movq    %rax, -2640(%rbp)
+    movq    %rax, -2632(%rbp)
+    movq    %rax, -2624(%rbp)
+    movq    %rax, -2616(%rbp)
+    movq    %rax, -2608(%rbp)
+    movl    $-1, -3588(%rbp)
+    movl    $-1, -3460(%rbp)
+    movl    $-1, -3332(%rbp)
+    movl    $-1, -3204(%rbp)
+    movl    $-1, -3076(%rbp)
+    movl    $-1, -2948(%rbp)
+    movl    $-1, -2820(%rbp)
+    movl    $-1, -2692(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k865(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_ir0_k866(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -56(%rbp)
+    movq    -56(%rbp), %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_ir0_k867(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -64(%rbp)
+    movq    -64(%rbp), %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_ir0_k868(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    -72(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_f74e5feadea773fd(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -80(%rbp)
+    movq    -80(%rbp), %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_af63ac4c86019afc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    leaq    .Lxly_str_de79f907f80a5d73(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -112(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k869(%rip), %rax
+    movq    %rax, -120(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -120(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -128(%rbp)
+    leaq    .Lxly_str_7360eecc9b38343d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -136(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -144(%rbp)
+    leaq    .Lxly_str_af63af4c8601a015(%rip), %rdi
+    call    xly_str
+    movq    %rax, -152(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -160(%rbp)
+    leaq    .Lxly_str_ec8a609ae3060e65(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+    leaq    .Lxly_ir0_k870(%rip), %rax
+    movq    %rax, -184(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    leaq    .Lxly_str_af63ae4c86019e62(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -208(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -216(%rbp)
+    leaq    .Lxly_str_7a2059144b975b8e(%rip), %rdi
+    call    xly_str
+    movq    %rax, -224(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -232(%rbp)
+    leaq    .Lxly_ir0_k871(%rip), %rax
+    movq    %rax, -240(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -248(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -136(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+    leaq    .Lxly_str_af63a94c860195e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -264(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -264(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+    leaq    .Lxly_str_ee7e731884e7f968(%rip), %rdi
+    call    xly_str
+    movq    %rax, -280(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -280(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k872(%rip), %rax
+    movq    %rax, -296(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -296(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_str_081d3d1917793b59(%rip), %rdi
+    call    xly_str
+    movq    %rax, -312(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -320(%rbp)
+    leaq    .Lxly_str_af63a84c86019430(%rip), %rdi
+    call    xly_str
+    movq    %rax, -328(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -328(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_str_0874ecd658bf9e18(%rip), %rdi
+    call    xly_str
+    movq    %rax, -344(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -344(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -352(%rbp)
+    leaq    .Lxly_ir0_k873(%rip), %rax
+    movq    %rax, -360(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -368(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -376(%rbp)
+    leaq    .Lxly_str_af63ab4c86019949(%rip), %rdi
+    call    xly_str
+    movq    %rax, -384(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -384(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -392(%rbp)
+    leaq    .Lxly_str_d68369c6aa54beb6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -400(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -408(%rbp)
+    leaq    .Lxly_ir0_k874(%rip), %rax
+    movq    %rax, -416(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -416(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -312(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_str_af63aa4c86019796(%rip), %rdi
+    call    xly_str
+    movq    %rax, -440(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -440(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -448(%rbp)
+    leaq    .Lxly_str_f327369b45529636(%rip), %rdi
+    call    xly_str
+    movq    %rax, -456(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -456(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -464(%rbp)
+    leaq    .Lxly_ir0_k875(%rip), %rax
+    movq    %rax, -472(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -472(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+    leaq    .Lxly_str_125083191daf6f61(%rip), %rdi
+    call    xly_str
+    movq    %rax, -488(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -488(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -496(%rbp)
+    leaq    .Lxly_str_af63b54c8601aa47(%rip), %rdi
+    call    xly_str
+    movq    %rax, -504(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -504(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -512(%rbp)
+    leaq    .Lxly_str_d77e56aa0dd11d0a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -520(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -520(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -528(%rbp)
+    leaq    .Lxly_ir0_k876(%rip), %rax
+    movq    %rax, -536(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -536(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -544(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -488(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -552(%rbp)
+    leaq    .Lxly_str_e6f09b190519daa4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -560(%rbp)
+    movq    -560(%rbp), %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    -384(%rbp), %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -568(%rbp)
+.Lxly_ir0_b44:
+    leaq    .Lxly_str_e22f84f0e00344dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, -576(%rbp)
+    subq    $16, %rsp
+    movq    -576(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -584(%rbp)
+.Lxly_ir0_b43:
+.Lxly_ir0_b46:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -592(%rbp)
+.Lxly_ir0_b45:
+.Lxly_ir0_b48:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -600(%rbp)
+.Lxly_ir0_b47:
+.Lxly_ir0_b50:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -608(%rbp)
+.Lxly_ir0_b49:
+    leaq    .Lxly_str_7c06c68969981f60(%rip), %rdi
+    call    xly_str
+    movq    %rax, -616(%rbp)
+    subq    $16, %rsp
+    movq    -616(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -624(%rbp)
+.Lxly_ir0_b52:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -632(%rbp)
+.Lxly_ir0_b51:
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -640(%rbp)
+    movabsq $0x401c000000000000, %rax
+    movq    %rax, -648(%rbp)
+    movabsq $0x4044000000000000, %rax
+    movq    %rax, -656(%rbp)
+    leaq    .Lxly_str_06c8bae1ab129885(%rip), %rdi
+    call    xly_str
+    movq    %rax, -664(%rbp)
+    leaq    .Lxly_ir0_k877(%rip), %rax
+    movq    %rax, -672(%rbp)
+    leaq    .Lxly_ir0_k878(%rip), %rax
+    movq    %rax, -680(%rbp)
+    leaq    .Lxly_ir0_k879(%rip), %rax
+    movq    %rax, -688(%rbp)
+    leaq    .Lxly_ir0_k880(%rip), %rax
+    movq    %rax, -696(%rbp)
+    movq    -672(%rbp), %rdi
+    movq    -680(%rbp), %rsi
+    movq    -688(%rbp), %rdx
+    movq    -696(%rbp), %rcx
+    movq    -664(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -704(%rbp)
+.Lxly_ir0_b54:
+    leaq    .Lxly_str_6ef4d6d8ac36494b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -712(%rbp)
+    subq    $16, %rsp
+    movq    -712(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -720(%rbp)
+.Lxly_ir0_b53:
+.Lxly_ir0_b56:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -728(%rbp)
+.Lxly_ir0_b55:
+.Lxly_ir0_b58:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -736(%rbp)
+.Lxly_ir0_b57:
+    leaq    .Lxly_str_b978c4d0a55ed89d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -744(%rbp)
+    subq    $16, %rsp
+    movq    -744(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -752(%rbp)
+.Lxly_ir0_b60:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -760(%rbp)
+.Lxly_ir0_b59:
+.Lxly_ir0_b62:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -768(%rbp)
+.Lxly_ir0_b61:
+    call    .Lxly_fn_countDone
+    movq    %rax, -776(%rbp)
+    movq    %r12, %rdi
+    movq    -776(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2720(%rbp)
+    leaq    -2728(%rbp), %rax
+    jmp     .Lxly_2
+.Lxly_1:
+    call    xly_add
+.Lxly_2:
+    movq    %rax, -784(%rbp)
+    leaq    .Lxly_str_c37dd817ce876f70(%rip), %rdi
+    call    xly_str
+    movq    %rax, -792(%rbp)
+    movq    -784(%rbp), %rdi
+    movq    -792(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2848(%rbp)
+    leaq    -2856(%rbp), %rax
+    jmp     .Lxly_4
+.Lxly_3:
+    call    xly_add
+.Lxly_4:
+    movq    %rax, -800(%rbp)
+.Lxly_ir0_b64:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -808(%rbp)
+    subq    $16, %rsp
+    movq    -808(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -816(%rbp)
+.Lxly_ir0_b63:
+    movq    -800(%rbp), %rdi
+    movq    -816(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2976(%rbp)
+    leaq    -2984(%rbp), %rax
+    jmp     .Lxly_6
+.Lxly_5:
+    call    xly_add
+.Lxly_6:
+    movq    %rax, -824(%rbp)
+    leaq    .Lxly_str_b7fdc8f90bfccf18(%rip), %rdi
+    call    xly_str
+    movq    %rax, -832(%rbp)
+    movq    -824(%rbp), %rdi
+    movq    -832(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_8
+.Lxly_7:
+    call    xly_add
+.Lxly_8:
+    movq    %rax, -840(%rbp)
+    subq    $16, %rsp
+    movq    -840(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -848(%rbp)
+.Lxly_ir0_b66:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -856(%rbp)
+.Lxly_ir0_b65:
+    leaq    .Lxly_str_22e80e18049c26e6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -864(%rbp)
+    movq    -864(%rbp), %rax
+    movq    %rax, __xly_globals+48(%rip)
+    leaq    .Lxly_str_ec76a0cfd555b9aa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -872(%rbp)
+    call    .Lxly_fn_countDone
+    movq    %rax, -880(%rbp)
+.Lxly_ir0_b68:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, -888(%rbp)
+    subq    $16, %rsp
+    movq    -888(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -896(%rbp)
+.Lxly_ir0_b67:
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -904(%rbp)
+    leaq    .Lxly_ir0_k881(%rip), %rax
+    movq    %rax, -912(%rbp)
+    movq    -872(%rbp), %rdi
+    movq    -880(%rbp), %rsi
+    movq    -896(%rbp), %rdx
+    movq    -912(%rbp), %rcx
+    call    .Lxly_fn_bar
+    movq    %rax, -920(%rbp)
+.Lxly_ir0_b70:
+    leaq    .Lxly_str_700342ea56a0a5f5(%rip), %rdi
+    call    xly_str
+    movq    %rax, -928(%rbp)
+    subq    $16, %rsp
+    movq    -928(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -936(%rbp)
+.Lxly_ir0_b69:
+.Lxly_ir0_b72:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -944(%rbp)
+.Lxly_ir0_b71:
+.Lxly_ir0_b74:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -952(%rbp)
+.Lxly_ir0_b73:
+    leaq    .Lxly_str_49344b94c31b361d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -960(%rbp)
+    subq    $16, %rsp
+    movq    -960(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -968(%rbp)
+.Lxly_ir0_b76:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -976(%rbp)
+.Lxly_ir0_b75:
+.Lxly_ir0_b78:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -984(%rbp)
+.Lxly_ir0_b77:
+.Lxly_ir0_b80:
+    call    .Lxly_fn_countTotal
+    movq    %rax, -992(%rbp)
+    call    .Lxly_fn_countDone
+    movq    %rax, -1000(%rbp)
+    movq    -992(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -1000(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1008(%rbp)
+.Lxly_ir0_b79:
+    movq    -1008(%rbp), %xmm0
+    movsd   %xmm0, -3104(%rbp)
+    leaq    -3112(%rbp), %rax
+    movq    %rax, -1016(%rbp)
+    movq    %r12, %rdi
+    movq    -1016(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_10
+.Lxly_9:
+    call    xly_add
+.Lxly_10:
+    movq    %rax, -1024(%rbp)
+    subq    $16, %rsp
+    movq    -1024(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1032(%rbp)
+.Lxly_ir0_b82:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1040(%rbp)
+.Lxly_ir0_b81:
+.Lxly_ir0_b84:
+    leaq    .Lxly_str_083b5b313d664673(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1048(%rbp)
+    subq    $16, %rsp
+    movq    -1048(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1056(%rbp)
+.Lxly_ir0_b83:
+.Lxly_ir0_b86:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1064(%rbp)
+.Lxly_ir0_b85:
+.Lxly_ir0_b88:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1072(%rbp)
+.Lxly_ir0_b87:
+    leaq    .Lxly_str_3f447d8e7fd1035b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1080(%rbp)
+    subq    $16, %rsp
+    movq    -1080(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1088(%rbp)
+.Lxly_ir0_b90:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1096(%rbp)
+.Lxly_ir0_b89:
+.Lxly_ir0_b92:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1104(%rbp)
+.Lxly_ir0_b91:
+    call    .Lxly_fn_countDone
+    movq    %rax, -1112(%rbp)
+    movq    %r12, %rdi
+    movq    -1112(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_12
+.Lxly_11:
+    call    xly_add
+.Lxly_12:
+    movq    %rax, -1120(%rbp)
+    subq    $16, %rsp
+    movq    -1120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1128(%rbp)
+.Lxly_ir0_b94:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1136(%rbp)
+.Lxly_ir0_b93:
+.Lxly_ir0_b96:
+    leaq    .Lxly_str_3417a4e1a816148c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1144(%rbp)
+    subq    $16, %rsp
+    movq    -1144(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1152(%rbp)
+.Lxly_ir0_b95:
+.Lxly_ir0_b98:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1160(%rbp)
+.Lxly_ir0_b97:
+.Lxly_ir0_b100:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1168(%rbp)
+.Lxly_ir0_b99:
+    leaq    .Lxly_str_544ec8f699df2b5c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1176(%rbp)
+    subq    $16, %rsp
+    movq    -1176(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1184(%rbp)
+.Lxly_ir0_b102:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1192(%rbp)
+.Lxly_ir0_b101:
+.Lxly_ir0_b104:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1200(%rbp)
+.Lxly_ir0_b103:
+.Lxly_ir0_b106:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1208(%rbp)
+.Lxly_ir0_b105:
+.Lxly_ir0_b108:
+    call    .Lxly_fn_countTotal
+    movq    %rax, -1216(%rbp)
+    leaq    .Lxly_ir0_k883(%rip), %rax
+    movq    %rax, -1224(%rbp)
+    movq    -1224(%rbp), %rdi
+    movq    -1216(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_13
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_14
+.Lxly_13:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_14:
+    movq    %rax, -1232(%rbp)
+    cmpq    $0, -1232(%rbp)
+    je      .Lxly_ir0_b110
+.Lxly_ir0_b109:
+    movq    %rbx, -1272(%rbp)
+    jmp     .Lxly_ir0_b107
+.Lxly_ir0_b110:
+    call    .Lxly_fn_countDone
+    movq    %rax, -1240(%rbp)
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, -1248(%rbp)
+    movq    -1240(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -1248(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1256(%rbp)
+    movq    -1256(%rbp), %xmm0
+    movq    -1216(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1264(%rbp)
+    movq    -1264(%rbp), %rax
+    movq    %rax, -1272(%rbp)
+.Lxly_ir0_b107:
+    movq    -1272(%rbp), %xmm0
+    movsd   %xmm0, -3232(%rbp)
+    leaq    -3240(%rbp), %rax
+    movq    %rax, -1280(%rbp)
+    movq    %r12, %rdi
+    movq    -1280(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3360(%rbp)
+    leaq    -3368(%rbp), %rax
+    jmp     .Lxly_16
+.Lxly_15:
+    call    xly_add
+.Lxly_16:
+    movq    %rax, -1288(%rbp)
+    leaq    .Lxly_str_af63984c86017900(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1296(%rbp)
+    movq    -1288(%rbp), %rdi
+    movq    -1296(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_18
+.Lxly_17:
+    call    xly_add
+.Lxly_18:
+    movq    %rax, -1304(%rbp)
+    subq    $16, %rsp
+    movq    -1304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1312(%rbp)
+.Lxly_ir0_b112:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1320(%rbp)
+.Lxly_ir0_b111:
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, -1328(%rbp)
+    movabsq $0x4043000000000000, %rax
+    movq    %rax, -1336(%rbp)
+    leaq    .Lxly_str_a8beb6b1182241ac(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1344(%rbp)
+    leaq    .Lxly_ir0_k885(%rip), %rax
+    movq    %rax, -1352(%rbp)
+    leaq    .Lxly_ir0_k886(%rip), %rax
+    movq    %rax, -1360(%rbp)
+    leaq    .Lxly_ir0_k887(%rip), %rax
+    movq    %rax, -1368(%rbp)
+    leaq    .Lxly_ir0_k888(%rip), %rax
+    movq    %rax, -1376(%rbp)
+    movq    -1352(%rbp), %rdi
+    movq    -1360(%rbp), %rsi
+    movq    -1368(%rbp), %rdx
+    movq    -1376(%rbp), %rcx
+    movq    -1344(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -1384(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -1392(%rbp)
+    movabsq $0x4046000000000000, %rax
+    movq    %rax, -1400(%rbp)
+    leaq    .Lxly_ir0_k889(%rip), %rax
+    movq    %rax, -1408(%rbp)
+    leaq    .Lxly_ir0_k890(%rip), %rax
+    movq    %rax, -1416(%rbp)
+    movq    -1408(%rbp), %rdi
+    movq    -1416(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -1424(%rbp)
+.Lxly_ir0_b114:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1432(%rbp)
+.Lxly_ir0_b113:
+.Lxly_ir0_b116:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1440(%rbp)
+.Lxly_ir0_b115:
+    leaq    .Lxly_str_7bbe2810795103f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1448(%rbp)
+    subq    $16, %rsp
+    movq    -1448(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1456(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1464(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, -1472(%rbp)
+    leaq    .Lxly_ir0_k891(%rip), %rax
+    movq    %rax, -1480(%rbp)
+    leaq    .Lxly_ir0_k892(%rip), %rax
+    movq    %rax, -1488(%rbp)
+    movq    -1480(%rbp), %rdi
+    movq    -1488(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -1496(%rbp)
+.Lxly_ir0_b1:
+    call    .Lxly_fn_bgGreen
+    movq    %rax, -1504(%rbp)
+    call    .Lxly_fn_fgBlack
+    movq    %rax, -1512(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -1520(%rbp)
+.Lxly_ir0_b2:
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_1992954e26341330(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1528(%rbp)
+    subq    $16, %rsp
+    movq    -1528(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1536(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1544(%rbp)
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1552(%rbp)
+    subq    $16, %rsp
+    movq    -1552(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1560(%rbp)
+.Lxly_ir0_b6:
+.Lxly_ir0_b7:
+    call    .Lxly_fn_bgBrightBlack
+    movq    %rax, -1568(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -1576(%rbp)
+.Lxly_ir0_b8:
+    leaq    .Lxly_str_0438a04fc332ff5f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1584(%rbp)
+    subq    $16, %rsp
+    movq    -1584(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1592(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1600(%rbp)
+    subq    $16, %rsp
+    movq    -1552(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1608(%rbp)
+.Lxly_ir0_b10:
+.Lxly_ir0_b11:
+    call    .Lxly_fn_bgBrightBlack
+    movq    %rax, -1616(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -1624(%rbp)
+.Lxly_ir0_b12:
+    leaq    .Lxly_str_96dfb645871b89dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1632(%rbp)
+    subq    $16, %rsp
+    movq    -1632(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1640(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1648(%rbp)
+    leaq    .Lxly_ir0_k893(%rip), %rax
+    movq    %rax, -1656(%rbp)
+    leaq    .Lxly_ir0_k894(%rip), %rax
+    movq    %rax, -1664(%rbp)
+    movq    -1656(%rbp), %rdi
+    movq    -1664(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -1672(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -1680(%rbp)
+    leaq    .Lxly_str_df4a10ec03082795(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1688(%rbp)
+    subq    $16, %rsp
+    movq    -1688(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1696(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1704(%rbp)
+    call    .Lxly_fn_fgBrightCyan
+    movq    %rax, -1712(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -1720(%rbp)
+    subq    $16, %rsp
+    movq    -560(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1728(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1736(%rbp)
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, -1744(%rbp)
+    leaq    .Lxly_ir0_k895(%rip), %rax
+    movq    %rax, -1752(%rbp)
+    leaq    .Lxly_ir0_k896(%rip), %rax
+    movq    %rax, -1760(%rbp)
+    movq    -1752(%rbp), %rdi
+    movq    -1760(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -1768(%rbp)
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -1776(%rbp)
+    leaq    .Lxly_str_c5225cce87f2bb53(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1784(%rbp)
+    subq    $16, %rsp
+    movq    -1784(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -1792(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -1800(%rbp)
+    leaq    .Lxly_ir0_k897(%rip), %rax
+    movq    %rax, -1808(%rbp)
+    movq    -1808(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_ir0_k898(%rip), %rax
+    movq    %rax, -1816(%rbp)
+    movq    -1816(%rbp), %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    %rbx, %r13
+    movq    %rbx, -1824(%rbp)
+.Lxly_ir0_b13:
+    call    .Lxly_fn_countTotal
+    movq    %rax, -1832(%rbp)
+    movq    %r13, %xmm0
+    movq    -1832(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -1840(%rbp)
+    cmpq    $0, -1840(%rbp)
+    je      .Lxly_ir0_b15
+.Lxly_ir0_b14:
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, -1848(%rbp)
+    movq    -1848(%rbp), %rdi
+    call    .Lxly_fn_taskVisible
+    movq    %rax, -1856(%rbp)
+    leaq    .Lxly_ir0_k900(%rip), %rax
+    movq    %rax, -1864(%rbp)
+    movq    -1864(%rbp), %rdi
+    movq    -1856(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_19
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_20
+.Lxly_19:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_20:
+    movq    %rax, -1872(%rbp)
+    cmpq    $0, -1872(%rbp)
+    je      .Lxly_ir0_b117
+.Lxly_ir0_b16:
+    movq    -1824(%rbp), %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1880(%rbp)
+    movq    -1880(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, -1888(%rbp)
+    movq    -1888(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    movq    -1880(%rbp), %rax
+    movq    %rax, -1896(%rbp)
+    jmp     .Lxly_ir0_b17
+.Lxly_ir0_b117:
+    movq    -1824(%rbp), %rax
+    movq    %rax, -1896(%rbp)
+.Lxly_ir0_b17:
+    movq    %r13, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -1904(%rbp)
+    movq    -1904(%rbp), %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    movq    -1904(%rbp), %r13
+    movq    -1896(%rbp), %rax
+    movq    %rax, -1824(%rbp)
+    jmp     .Lxly_ir0_b13
+.Lxly_ir0_b15:
+    call    .Lxly_fn_fgBrightYellow
+    movq    %rax, %r13
+    movq    -1824(%rbp), %xmm0
+    movsd   %xmm0, -3488(%rbp)
+    leaq    -3496(%rbp), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -3616(%rbp)
+    leaq    -3624(%rbp), %rax
+    jmp     .Lxly_22
+.Lxly_21:
+    call    xly_add
+.Lxly_22:
+    movq    %rax, -1912(%rbp)
+    leaq    .Lxly_str_3639825bfe23eebf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    -1912(%rbp), %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_24
+.Lxly_23:
+    call    xly_add
+.Lxly_24:
+    movq    %rax, -1920(%rbp)
+    subq    $16, %rsp
+    movq    -1920(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    call    .Lxly_fn_reset
+    movq    %rax, %r13
+    movabsq $0x4026000000000000, %rax
+    movq    %rax, -1928(%rbp)
+    movabsq $0x402c000000000000, %rax
+    movq    %rax, -1936(%rbp)
+    movabsq $0x4053c00000000000, %rax
+    movq    %rax, -1944(%rbp)
+    leaq    .Lxly_str_c797fd9076cc136d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -1952(%rbp)
+    leaq    .Lxly_ir0_k904(%rip), %rax
+    movq    %rax, -1960(%rbp)
+    leaq    .Lxly_ir0_k905(%rip), %rax
+    movq    %rax, -1968(%rbp)
+    leaq    .Lxly_ir0_k906(%rip), %rax
+    movq    %rax, -1976(%rbp)
+    leaq    .Lxly_ir0_k907(%rip), %rax
+    movq    %rax, -1984(%rbp)
+    movq    -1960(%rbp), %rdi
+    movq    -1968(%rbp), %rsi
+    movq    -1976(%rbp), %rdx
+    movq    -1984(%rbp), %rcx
+    movq    -1952(%rbp), %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -1992(%rbp)
+    movabsq $0x4028000000000000, %rax
+    movq    %rax, -2000(%rbp)
+    leaq    .Lxly_ir0_k908(%rip), %rax
+    movq    %rax, -2008(%rbp)
+    movq    -2008(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_ir0_k909(%rip), %rax
+    movq    %rax, -2016(%rbp)
+    movq    -2016(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_3e57f913fe18bbc0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2024(%rbp)
+    leaq    .Lxly_str_016543663443e82b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2032(%rbp)
+    leaq    .Lxly_str_c328e217ce3f406f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2040(%rbp)
+    leaq    .Lxly_str_c317e417ce30d0a2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2048(%rbp)
+    leaq    .Lxly_str_c31b4a17ce33b3cb(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2056(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2064(%rbp)
+    movabsq $0x404b800000000000, %rax
+    movq    %rax, -2072(%rbp)
+    leaq    .Lxly_str_7419ad7f59af467a(%rip), %rdi
+    call    xly_str
+    movq    %rax, -2080(%rbp)
+    movq    -2000(%rbp), %r13
+.Lxly_ir0_b18:
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, -2088(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2096(%rbp)
+    movq    -2088(%rbp), %rdi
+    movq    -2096(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_25
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_26
+.Lxly_25:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_26:
+    movq    %rax, -2104(%rbp)
+    cmpq    $0, -2104(%rbp)
+    je      .Lxly_ir0_b20
+.Lxly_ir0_b19:
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, -2112(%rbp)
+    movq    -2112(%rbp), %rdi
+    call    .Lxly_fn_taskVisible
+    movq    %rax, -2120(%rbp)
+    leaq    .Lxly_ir0_k910(%rip), %rax
+    movq    %rax, -2128(%rbp)
+    movq    -2128(%rbp), %rdi
+    movq    -2120(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_27
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_28
+.Lxly_27:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_28:
+    movq    %rax, -2136(%rbp)
+    cmpq    $0, -2136(%rbp)
+    je      .Lxly_ir0_b118
+.Lxly_ir0_b21:
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, -2144(%rbp)
+    subq    $16, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2144(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, -2152(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2152(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2160(%rbp)
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, -2168(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2168(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2176(%rbp)
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, -2184(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -2184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2192(%rbp)
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, -2200(%rbp)
+    leaq    .Lxly_ir0_k912(%rip), %rax
+    movq    %rax, -2208(%rbp)
+    movq    -2200(%rbp), %rdi
+    movq    -2208(%rbp), %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2216(%rbp)
+    leaq    .Lxly_ir0_k913(%rip), %rax
+    movq    %rax, -2224(%rbp)
+    movq    -2224(%rbp), %rdi
+    movq    -2176(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_29
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_30
+.Lxly_29:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_30:
+    movq    %rax, -2232(%rbp)
+    cmpq    $0, -2232(%rbp)
+    je      .Lxly_ir0_b24
+.Lxly_ir0_b23:
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, -2240(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2248(%rbp)
+    subq    $16, %rsp
+    movq    -2024(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2256(%rbp)
+.Lxly_ir0_b24:
+    leaq    .Lxly_ir0_k914(%rip), %rax
+    movq    %rax, -2264(%rbp)
+    movq    -2264(%rbp), %rdi
+    movq    -2176(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_31
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_32
+.Lxly_31:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_32:
+    movq    %rax, -2272(%rbp)
+    cmpq    $0, -2272(%rbp)
+    je      .Lxly_ir0_b26
+.Lxly_ir0_b25:
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -2280(%rbp)
+    subq    $16, %rsp
+    movq    -2032(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2288(%rbp)
+.Lxly_ir0_b26:
+    call    .Lxly_fn_reset
+    movq    %rax, -2296(%rbp)
+    movq    -136(%rbp), %rdi
+    movq    -2192(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_33
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_34
+.Lxly_33:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_34:
+    movq    %rax, -2304(%rbp)
+    cmpq    $0, -2304(%rbp)
+    je      .Lxly_ir0_b28
+.Lxly_ir0_b27:
+    call    .Lxly_fn_bgRed
+    movq    %rax, -2312(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2320(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2328(%rbp)
+    subq    $16, %rsp
+    movq    -2040(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2336(%rbp)
+.Lxly_ir0_b28:
+    movq    -312(%rbp), %rdi
+    movq    -2192(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_35
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_36
+.Lxly_35:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_36:
+    movq    %rax, -2344(%rbp)
+    cmpq    $0, -2344(%rbp)
+    je      .Lxly_ir0_b30
+.Lxly_ir0_b29:
+    call    .Lxly_fn_bgYellow
+    movq    %rax, -2352(%rbp)
+    call    .Lxly_fn_fgBlack
+    movq    %rax, -2360(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2368(%rbp)
+    subq    $16, %rsp
+    movq    -2048(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2376(%rbp)
+.Lxly_ir0_b30:
+    movq    -488(%rbp), %rdi
+    movq    -2192(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_37
+    cmpl    $0, (%rsi)
+    jne     .Lxly_37
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_38
+.Lxly_37:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_38:
+    movq    %rax, -2384(%rbp)
+    cmpq    $0, -2384(%rbp)
+    je      .Lxly_ir0_b32
+.Lxly_ir0_b31:
+    call    .Lxly_fn_bgBlue
+    movq    %rax, -2392(%rbp)
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2400(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2408(%rbp)
+    subq    $16, %rsp
+    movq    -2056(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2416(%rbp)
+.Lxly_ir0_b32:
+    call    .Lxly_fn_reset
+    movq    %rax, -2424(%rbp)
+    subq    $16, %rsp
+    movq    -2064(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2432(%rbp)
+    cmpq    $0, -2232(%rbp)
+    je      .Lxly_ir0_b34
+.Lxly_ir0_b33:
+    call    .Lxly_fn_fgBrightBlack
+    movq    %rax, -2440(%rbp)
+    call    .Lxly_fn_dim
+    movq    %rax, -2448(%rbp)
+.Lxly_ir0_b34:
+    cmpq    $0, -2272(%rbp)
+    je      .Lxly_ir0_b36
+.Lxly_ir0_b35:
+    movq    -384(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_39
+    cmpl    $0, (%rsi)
+    jne     .Lxly_39
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_40
+.Lxly_39:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_40:
+    movq    %rax, -2456(%rbp)
+    cmpq    $0, -2456(%rbp)
+    je      .Lxly_ir0_b38
+.Lxly_ir0_b37:
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, -2464(%rbp)
+    call    .Lxly_fn_bold
+    movq    %rax, -2472(%rbp)
+.Lxly_ir0_b38:
+    movq    -384(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_41
+    cmpl    $0, (%rsi)
+    jne     .Lxly_41
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    setne   %al
+    setp    %cl
+    orb     %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_42
+.Lxly_41:
+    call    xly_neq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_42:
+    movq    %rax, -2480(%rbp)
+    cmpq    $0, -2480(%rbp)
+    je      .Lxly_ir0_b40
+.Lxly_ir0_b39:
+    call    .Lxly_fn_fgWhite
+    movq    %rax, -2488(%rbp)
+.Lxly_ir0_b40:
+.Lxly_ir0_b36:
+    leaq    .Lxly_ir0_k915(%rip), %rax
+    movq    %rax, -2496(%rbp)
+    movq    -2160(%rbp), %rdi
+    movq    -2496(%rbp), %rsi
+    call    .Lxly_fn_pad
+    movq    %rax, -2504(%rbp)
+    subq    $16, %rsp
+    movq    -2504(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -2512(%rbp)
+    call    .Lxly_fn_reset
+    movq    %rax, -2520(%rbp)
+    movq    -384(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_43
+    cmpl    $0, (%rsi)
+    jne     .Lxly_43
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_44
+.Lxly_43:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_44:
+    movq    %rax, -2528(%rbp)
+    cmpq    $0, -2528(%rbp)
+    je      .Lxly_ir0_b42
+.Lxly_ir0_b41:
+    subq    $16, %rsp
+    movq    -2080(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b42:
+    movq    %r13, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, -2536(%rbp)
+    movq    -2536(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    jmp     .Lxly_ir0_b22
+.Lxly_ir0_b118:
+    movq    %r13, %r15
+.Lxly_ir0_b22:
+    movq    __xly_globals+80(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k917(%rip), %rax
+    movq    %rax, -2544(%rbp)
+    movq    %r13, %rdi
+    movq    -2544(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_45
+    cmpl    $0, (%rsi)
+    jne     .Lxly_45
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_46
+.Lxly_45:
+    call    xly_add
+.Lxly_46:
+    movq    %rax, -2552(%rbp)
+    movq    -2552(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movq    %r15, %r13
+    jmp     .Lxly_ir0_b18
+.Lxly_ir0_b20:
+    movabsq $0x403a000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_3aa73af46a6f52f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k918(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k919(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k920(%rip), %rax
+    movq    %rax, -2560(%rbp)
+    leaq    .Lxly_ir0_k921(%rip), %rax
+    movq    %rax, -2568(%rbp)
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    movq    -2560(%rbp), %rdx
+    movq    -2568(%rbp), %rcx
+    movq    %r13, %r8
+    call    .Lxly_fn_panel
+    movq    %rax, -2576(%rbp)
+    movabsq $0x403b000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k922(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k923(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %rbx
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r13
+    call    .Lxly_fn_bold
+    movq    %rax, %r13
+    leaq    .Lxly_str_54b2a19081417685(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    .Lxly_fn_reset
+    movq    %rax, %rbx
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %rbx
+    leaq    .Lxly_str_da9141c9f9548fa8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    call    .Lxly_fn_reset
+    movq    %rax, %r15
+    movabsq $0x403c000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k924(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k925(%rip), %rax
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, -2584(%rbp)
+    call    .Lxly_fn_fgBrightGreen
+    movq    %rax, %r15
+    call    .Lxly_fn_bold
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    call    .Lxly_fn_reset
+    movq    %rax, %r15
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r15
+    leaq    .Lxly_str_cba471d99899b68f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    call    .Lxly_fn_reset
+    movq    %rax, %r13
+    movabsq $0x403d000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k926(%rip), %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k927(%rip), %rax
+    movq    %rax, %r13
+    movq    %r15, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %rbx
+    call    .Lxly_fn_fgBrightCyan
+    movq    %rax, %r13
+    call    .Lxly_fn_bold
+    movq    %rax, %r13
+    leaq    .Lxly_str_dbbcd1c430a9b98e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    .Lxly_fn_reset
+    movq    %rax, %rbx
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5aae46ec70575dcd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    call    .Lxly_fn_reset
+    movq    %rax, %r13
+    movabsq $0x4040000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k928(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k929(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %r15
+    call    .Lxly_fn_bgBrightBlue
+    movq    %rax, %r13
+    call    .Lxly_fn_fgBrightWhite
+    movq    %rax, %r13
+    call    .Lxly_fn_bold
+    movq    %rax, %r13
+    leaq    .Lxly_str_aa01ee1e6db0520f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    call    .Lxly_fn_reset
+    movq    %rax, %r15
+    movabsq $0x4041000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k930(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k931(%rip), %rax
+    movq    %rax, %r15
+    movq    %r13, %rdi
+    movq    %r15, %rsi
+    call    .Lxly_fn_pos
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    call    .Lxly_fn_reset
+    movq    %rax, %r13
+    leaq    .Lxly_str_af63c74c8601c8dd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k865:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k866:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k867:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k868:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k869:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k870:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k871:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k872:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k873:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k874:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k875:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k876:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k877:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k878:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k879:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k880:
+    .quad   0, 0x4044000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k881:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k883:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k885:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k886:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k887:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k888:
+    .quad   0, 0x4043000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k889:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k890:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k891:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k892:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k893:
+    .quad   0, 0x401c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k894:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k895:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k896:
+    .quad   0, 0x4046000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k897:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k898:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k900:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k904:
+    .quad   0, 0x4026000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k905:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k906:
+    .quad   0, 0x402c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k907:
+    .quad   0, 0x4053c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k908:
+    .quad   0, 0x4028000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k909:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k910:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k912:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k913:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k914:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k915:
+    .quad   0, 0x404b800000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k917:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k918:
+    .quad   0, 0x403a000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k919:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k920:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k921:
+    .quad   0, 0x4053c00000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k922:
+    .quad   0, 0x403b000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k923:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k924:
+    .quad   0, 0x403c000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k925:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k926:
+    .quad   0, 0x403d000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k927:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k928:
+    .quad   0, 0x4040000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k929:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k930:
+    .quad   0, 0x4041000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k931:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_pos:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $688, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movq    %rax, -480(%rbp)
+    movq    %rax, -472(%rbp)
+    movq    %rax, -464(%rbp)
+    movq    %rax, -456(%rbp)
+    movq    %rax, -448(%rbp)
+    movq    %rax, -440(%rbp)
+    movq    %rax, -432(%rbp)
+    movq    %rax, -424(%rbp)
+    movq    %rax, -416(%rbp)
+    movq    %rax, -408(%rbp)
+    movq    %rax, -400(%rbp)
+    movq    %rax, -392(%rbp)
+    movq    %rax, -384(%rbp)
+    movq    %rax, -376(%rbp)
+    movq    %rax, -368(%rbp)
+    movq    %rax, -360(%rbp)
+    movq    %rax, -352(%rbp)
+    movq    %rax, -344(%rbp)
+    movq    %rax, -336(%rbp)
+    movq    %rax, -328(%rbp)
+    movq    %rax, -320(%rbp)
+    movq    %rax, -312(%rbp)
+    movq    %rax, -304(%rbp)
+    movq    %rax, -296(%rbp)
+    movq    %rax, -288(%rbp)
+    movq    %rax, -280(%rbp)
+    movq    %rax, -272(%rbp)
+    movq    %rax, -264(%rbp)
+    movq    %rax, -256(%rbp)
+    movq    %rax, -248(%rbp)
+    movq    %rax, -240(%rbp)
+    movq    %rax, -232(%rbp)
+    movq    %rax, -224(%rbp)
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -652(%rbp)
+    movl    $-1, -524(%rbp)
+    movl    $-1, -396(%rbp)
+    movl    $-1, -268(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -296(%rbp)
+    leaq    -304(%rbp), %rax
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -424(%rbp)
+    leaq    -432(%rbp), %rax
+    jmp     .Lxly_f0_6
+.Lxly_f0_5:
+    call    xly_add
+.Lxly_f0_6:
+    movq    %rax, %r12
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -552(%rbp)
+    leaq    -560(%rbp), %rax
+    jmp     .Lxly_f0_8
+.Lxly_f0_7:
+    call    xly_add
+.Lxly_f0_8:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -680(%rbp)
+    leaq    -688(%rbp), %rax
+    jmp     .Lxly_f0_10
+.Lxly_f0_9:
+    call    xly_add
+.Lxly_f0_10:
+    movq    %rax, %r13
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r13, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_12
+.Lxly_f0_11:
+    call    xly_add
+.Lxly_f0_12:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    call    xly_null
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_reset:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bold:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_dim:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightWhite:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightCyan:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBrightBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgCyan:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgWhite:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgGreen:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgRed:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgYellow:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBlue:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_bgBrightBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_fgBlack:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_pad:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $96, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, -56(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, %r13
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -72(%rbp)
+    movq    %r13, %r12
+    movq    %rbx, %r14
+.Lxly_irf19_0_b1:
+    movq    %r12, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f19_2
+.Lxly_f19_1:
+    call    xly_lt
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f19_2:
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf19_0_b3
+.Lxly_irf19_0_b2:
+    movq    %r14, %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_4
+.Lxly_f19_3:
+    call    xly_add
+.Lxly_f19_4:
+    movq    %rax, %r13
+    leaq    .Lxly_irf19_0_k18(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_6
+.Lxly_f19_5:
+    call    xly_add
+.Lxly_f19_6:
+    movq    %rax, %r15
+    movq    %r15, %r12
+    movq    %r13, %r14
+    jmp     .Lxly_irf19_0_b1
+.Lxly_irf19_0_b3:
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf19_0_k18:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_bar:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $112, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    movq    %rcx, %r14
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -80(%rbp)
+.Lxly_irf20_0_b8:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf20_0_b7:
+    leaq    .Lxly_str_af64164c86024f1a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf20_0_b10:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf20_0_b9:
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_str_566ff41b88792493(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -96(%rbp)
+    movq    %rbx, %r13
+.Lxly_irf20_0_b1:
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf20_0_b3
+.Lxly_irf20_0_b2:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    movq    %r13, %xmm0
+    movq    -96(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r13
+    jmp     .Lxly_irf20_0_b1
+.Lxly_irf20_0_b3:
+.Lxly_irf20_0_b12:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf20_0_b11:
+    leaq    .Lxly_str_56700b1b88794ba8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %r14
+.Lxly_irf20_0_b4:
+    movq    %r14, %xmm0
+    movq    -80(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf20_0_b6
+.Lxly_irf20_0_b5:
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r14, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r14
+    jmp     .Lxly_irf20_0_b4
+.Lxly_irf20_0_b6:
+.Lxly_irf20_0_b14:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf20_0_b13:
+    leaq    .Lxly_str_af64104c860244e8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf20_0_b16:
+    subq    $16, %rsp
+    movq    -88(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf20_0_b15:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_badge:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $192, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    xorl    %eax, %eax
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movl    $-1, -148(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_19fe06e3408e53d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_2
+.Lxly_f21_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf21_0_b2
+.Lxly_irf21_0_b1:
+.Lxly_irf21_0_b10:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b9:
+.Lxly_irf21_0_b12:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b11:
+.Lxly_irf21_0_b14:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b13:
+.Lxly_irf21_0_b2:
+    leaq    .Lxly_str_5e39a0f62bea2e31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_4
+.Lxly_f21_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_4:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf21_0_b4
+.Lxly_irf21_0_b3:
+.Lxly_irf21_0_b16:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b15:
+.Lxly_irf21_0_b18:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b17:
+.Lxly_irf21_0_b20:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b19:
+.Lxly_irf21_0_b4:
+    leaq    .Lxly_str_9f7452dd75d54d31(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_6
+.Lxly_f21_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_6:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf21_0_b6
+.Lxly_irf21_0_b5:
+.Lxly_irf21_0_b22:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b21:
+.Lxly_irf21_0_b24:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b23:
+.Lxly_irf21_0_b26:
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf21_0_b25:
+.Lxly_irf21_0_b6:
+    leaq    .Lxly_str_f5d6a8c57ab94f05(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f21_8
+.Lxly_f21_7:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f21_8:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf21_0_b8
+.Lxly_irf21_0_b7:
+.Lxly_irf21_0_b28:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf21_0_b27:
+.Lxly_irf21_0_b30:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf21_0_b29:
+.Lxly_irf21_0_b32:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf21_0_b31:
+.Lxly_irf21_0_b8:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -176(%rbp)
+    leaq    -184(%rbp), %rax
+    jmp     .Lxly_f21_10
+.Lxly_f21_9:
+    call    xly_add
+.Lxly_f21_10:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f21_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f21_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f21_12
+.Lxly_f21_11:
+    call    xly_add
+.Lxly_f21_12:
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+.Lxly_irf21_0_b34:
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf21_0_b33:
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_panel:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $2528, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, -48(%rbp)
+    movq    %rsi, -56(%rbp)
+    movq    %rdx, -64(%rbp)
+    movq    %rcx, -72(%rbp)
+    movq    %r8, -80(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -2528(%rbp)
+    movq    %rax, -2520(%rbp)
+    movq    %rax, -2512(%rbp)
+    movq    %rax, -2504(%rbp)
+    movq    %rax, -2496(%rbp)
+    movq    %rax, -2488(%rbp)
+    movq    %rax, -2480(%rbp)
+    movq    %rax, -2472(%rbp)
+    movq    %rax, -2464(%rbp)
+    movq    %rax, -2456(%rbp)
+    movq    %rax, -2448(%rbp)
+    movq    %rax, -2440(%rbp)
+    movq    %rax, -2432(%rbp)
+    movq    %rax, -2424(%rbp)
+    movq    %rax, -2416(%rbp)
+    movq    %rax, -2408(%rbp)
+    movq    %rax, -2400(%rbp)
+    movq    %rax, -2392(%rbp)
+    movq    %rax, -2384(%rbp)
+    movq    %rax, -2376(%rbp)
+    movq    %rax, -2368(%rbp)
+    movq    %rax, -2360(%rbp)
+    movq    %rax, -2352(%rbp)
+    movq    %rax, -2344(%rbp)
+    movq    %rax, -2336(%rbp)
+    movq    %rax, -2328(%rbp)
+    movq    %rax, -2320(%rbp)
+    movq    %rax, -2312(%rbp)
+    movq    %rax, -2304(%rbp)
+    movq    %rax, -2296(%rbp)
+    movq    %rax, -2288(%rbp)
+    movq    %rax, -2280(%rbp)
+    movq    %rax, -2272(%rbp)
+    movq    %rax, -2264(%rbp)
+    movq    %rax, -2256(%rbp)
+    movq    %rax, -2248(%rbp)
+    movq    %rax, -2240(%rbp)
+    movq    %rax, -2232(%rbp)
+    movq    %rax, -2224(%rbp)
+    movq    %rax, -2216(%rbp)
+    movq    %rax, -2208(%rbp)
+    movq    %rax, -2200(%rbp)
+    movq    %rax, -2192(%rbp)
+    movq    %rax, -2184(%rbp)
+    movq    %rax, -2176(%rbp)
+    movq    %rax, -2168(%rbp)
+    movq    %rax, -2160(%rbp)
+    movq    %rax, -2152(%rbp)
+    movq    %rax, -2144(%rbp)
+    movq    %rax, -2136(%rbp)
+    movq    %rax, -2128(%rbp)
+    movq    %rax, -2120(%rbp)
+    movq    %rax, -2112(%rbp)
+    movq    %rax, -2104(%rbp)
+    movq    %rax, -2096(%rbp)
+    movq    %rax, -2088(%rbp)
+    movq    %rax, -2080(%rbp)
+    movq    %rax, -2072(%rbp)
+    movq    %rax, -2064(%rbp)
+    movq    %rax, -2056(%rbp)
+    movq    %rax, -2048(%rbp)
+    movq    %rax, -2040(%rbp)
+    movq    %rax, -2032(%rbp)
+    movq    %rax, -2024(%rbp)
+    movq    %rax, -2016(%rbp)
+    movq    %rax, -2008(%rbp)
+    movq    %rax, -2000(%rbp)
+    movq    %rax, -1992(%rbp)
+    movq    %rax, -1984(%rbp)
+    movq    %rax, -1976(%rbp)
+    movq    %rax, -1968(%rbp)
+    movq    %rax, -1960(%rbp)
+    movq    %rax, -1952(%rbp)
+    movq    %rax, -1944(%rbp)
+    movq    %rax, -1936(%rbp)
+    movq    %rax, -1928(%rbp)
+    movq    %rax, -1920(%rbp)
+    movq    %rax, -1912(%rbp)
+    movq    %rax, -1904(%rbp)
+    movq    %rax, -1896(%rbp)
+    movq    %rax, -1888(%rbp)
+    movq    %rax, -1880(%rbp)
+    movq    %rax, -1872(%rbp)
+    movq    %rax, -1864(%rbp)
+    movq    %rax, -1856(%rbp)
+    movq    %rax, -1848(%rbp)
+    movq    %rax, -1840(%rbp)
+    movq    %rax, -1832(%rbp)
+    movq    %rax, -1824(%rbp)
+    movq    %rax, -1816(%rbp)
+    movq    %rax, -1808(%rbp)
+    movq    %rax, -1800(%rbp)
+    movq    %rax, -1792(%rbp)
+    movq    %rax, -1784(%rbp)
+    movq    %rax, -1776(%rbp)
+    movq    %rax, -1768(%rbp)
+    movq    %rax, -1760(%rbp)
+    movq    %rax, -1752(%rbp)
+    movq    %rax, -1744(%rbp)
+    movq    %rax, -1736(%rbp)
+    movq    %rax, -1728(%rbp)
+    movq    %rax, -1720(%rbp)
+    movq    %rax, -1712(%rbp)
+    movq    %rax, -1704(%rbp)
+    movq    %rax, -1696(%rbp)
+    movq    %rax, -1688(%rbp)
+    movq    %rax, -1680(%rbp)
+    movq    %rax, -1672(%rbp)
+    movq    %rax, -1664(%rbp)
+    movq    %rax, -1656(%rbp)
+    movq    %rax, -1648(%rbp)
+    movq    %rax, -1640(%rbp)
+    movq    %rax, -1632(%rbp)
+    movq    %rax, -1624(%rbp)
+    movq    %rax, -1616(%rbp)
+    movq    %rax, -1608(%rbp)
+    movq    %rax, -1600(%rbp)
+    movq    %rax, -1592(%rbp)
+    movq    %rax, -1584(%rbp)
+    movq    %rax, -1576(%rbp)
+    movq    %rax, -1568(%rbp)
+    movq    %rax, -1560(%rbp)
+    movq    %rax, -1552(%rbp)
+    movq    %rax, -1544(%rbp)
+    movq    %rax, -1536(%rbp)
+    movq    %rax, -1528(%rbp)
+    movq    %rax, -1520(%rbp)
+    movq    %rax, -1512(%rbp)
+    movq    %rax, -1504(%rbp)
+    movq    %rax, -1496(%rbp)
+    movq    %rax, -1488(%rbp)
+    movq    %rax, -1480(%rbp)
+    movq    %rax, -1472(%rbp)
+    movq    %rax, -1464(%rbp)
+    movq    %rax, -1456(%rbp)
+    movq    %rax, -1448(%rbp)
+    movq    %rax, -1440(%rbp)
+    movq    %rax, -1432(%rbp)
+    movq    %rax, -1424(%rbp)
+    movq    %rax, -1416(%rbp)
+    movq    %rax, -1408(%rbp)
+    movq    %rax, -1400(%rbp)
+    movq    %rax, -1392(%rbp)
+    movq    %rax, -1384(%rbp)
+    movq    %rax, -1376(%rbp)
+    movq    %rax, -1368(%rbp)
+    movq    %rax, -1360(%rbp)
+    movq    %rax, -1352(%rbp)
+    movq    %rax, -1344(%rbp)
+    movq    %rax, -1336(%rbp)
+    movq    %rax, -1328(%rbp)
+    movq    %rax, -1320(%rbp)
+    movq    %rax, -1312(%rbp)
+    movq    %rax, -1304(%rbp)
+    movq    %rax, -1296(%rbp)
+    movq    %rax, -1288(%rbp)
+    movq    %rax, -1280(%rbp)
+    movq    %rax, -1272(%rbp)
+    movq    %rax, -1264(%rbp)
+    movq    %rax, -1256(%rbp)
+    movq    %rax, -1248(%rbp)
+    movq    %rax, -1240(%rbp)
+    movq    %rax, -1232(%rbp)
+    movq    %rax, -1224(%rbp)
+    movq    %rax, -1216(%rbp)
+    movq    %rax, -1208(%rbp)
+    movq    %rax, -1200(%rbp)
+    movq    %rax, -1192(%rbp)
+    movq    %rax, -1184(%rbp)
+    movq    %rax, -1176(%rbp)
+    movq    %rax, -1168(%rbp)
+    movq    %rax, -1160(%rbp)
+    movq    %rax, -1152(%rbp)
+    movq    %rax, -1144(%rbp)
+    movq    %rax, -1136(%rbp)
+    movq    %rax, -1128(%rbp)
+    movq    %rax, -1120(%rbp)
+    movq    %rax, -1112(%rbp)
+    movq    %rax, -1104(%rbp)
+    movq    %rax, -1096(%rbp)
+    movq    %rax, -1088(%rbp)
+    movq    %rax, -1080(%rbp)
+    movq    %rax, -1072(%rbp)
+    movq    %rax, -1064(%rbp)
+    movq    %rax, -1056(%rbp)
+    movq    %rax, -1048(%rbp)
+    movq    %rax, -1040(%rbp)
+    movq    %rax, -1032(%rbp)
+    movq    %rax, -1024(%rbp)
+    movq    %rax, -1016(%rbp)
+    movq    %rax, -1008(%rbp)
+    movq    %rax, -1000(%rbp)
+    movq    %rax, -992(%rbp)
+    movq    %rax, -984(%rbp)
+    movq    %rax, -976(%rbp)
+    movq    %rax, -968(%rbp)
+    movq    %rax, -960(%rbp)
+    movq    %rax, -952(%rbp)
+    movq    %rax, -944(%rbp)
+    movq    %rax, -936(%rbp)
+    movq    %rax, -928(%rbp)
+    movq    %rax, -920(%rbp)
+    movq    %rax, -912(%rbp)
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movq    %rax, -776(%rbp)
+    movq    %rax, -768(%rbp)
+    movq    %rax, -760(%rbp)
+    movq    %rax, -752(%rbp)
+    movq    %rax, -744(%rbp)
+    movq    %rax, -736(%rbp)
+    movq    %rax, -728(%rbp)
+    movq    %rax, -720(%rbp)
+    movq    %rax, -712(%rbp)
+    movq    %rax, -704(%rbp)
+    movq    %rax, -696(%rbp)
+    movq    %rax, -688(%rbp)
+    movq    %rax, -680(%rbp)
+    movq    %rax, -672(%rbp)
+    movq    %rax, -664(%rbp)
+    movq    %rax, -656(%rbp)
+    movq    %rax, -648(%rbp)
+    movq    %rax, -640(%rbp)
+    movq    %rax, -632(%rbp)
+    movq    %rax, -624(%rbp)
+    movq    %rax, -616(%rbp)
+    movq    %rax, -608(%rbp)
+    movq    %rax, -600(%rbp)
+    movq    %rax, -592(%rbp)
+    movq    %rax, -584(%rbp)
+    movq    %rax, -576(%rbp)
+    movq    %rax, -568(%rbp)
+    movq    %rax, -560(%rbp)
+    movq    %rax, -552(%rbp)
+    movq    %rax, -544(%rbp)
+    movq    %rax, -536(%rbp)
+    movq    %rax, -528(%rbp)
+    movq    %rax, -520(%rbp)
+    movq    %rax, -512(%rbp)
+    movq    %rax, -504(%rbp)
+    movq    %rax, -496(%rbp)
+    movq    %rax, -488(%rbp)
+    movl    $-1, -2492(%rbp)
+    movl    $-1, -2364(%rbp)
+    movl    $-1, -2236(%rbp)
+    movl    $-1, -2108(%rbp)
+    movl    $-1, -1980(%rbp)
+    movl    $-1, -1852(%rbp)
+    movl    $-1, -1724(%rbp)
+    movl    $-1, -1596(%rbp)
+    movl    $-1, -1468(%rbp)
+    movl    $-1, -1340(%rbp)
+    movl    $-1, -1212(%rbp)
+    movl    $-1, -1084(%rbp)
+    movl    $-1, -956(%rbp)
+    movl    $-1, -828(%rbp)
+    movl    $-1, -700(%rbp)
+    movl    $-1, -572(%rbp)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r13
+    movq    -72(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -88(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_string_len
+    addq    $16, %rsp
+    movq    %rax, -96(%rbp)
+    movq    -88(%rbp), %xmm0
+    movq    -96(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -104(%rbp)
+    movq    -104(%rbp), %xmm0
+    movq    %r13, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -112(%rbp)
+    movq    -112(%rbp), %xmm0
+    movq    %r13, %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_str_cbf29ce484222325(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    -48(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -600(%rbp)
+    leaq    -608(%rbp), %rax
+    jmp     .Lxly_f22_2
+.Lxly_f22_1:
+    call    xly_add
+.Lxly_f22_2:
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_str_af63b64c8601abfa(%rip), %rdi
+    call    xly_str
+    movq    %rax, -128(%rbp)
+    movq    -120(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -728(%rbp)
+    leaq    -736(%rbp), %rax
+    jmp     .Lxly_f22_4
+.Lxly_f22_3:
+    call    xly_add
+.Lxly_f22_4:
+    movq    %rax, -136(%rbp)
+    movq    -136(%rbp), %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_5
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -856(%rbp)
+    leaq    -864(%rbp), %rax
+    jmp     .Lxly_f22_6
+.Lxly_f22_5:
+    call    xly_add
+.Lxly_f22_6:
+    movq    %rax, -144(%rbp)
+    movq    %r13, %rdi
+    movq    -144(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_7
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -984(%rbp)
+    leaq    -992(%rbp), %rax
+    jmp     .Lxly_f22_8
+.Lxly_f22_7:
+    call    xly_add
+.Lxly_f22_8:
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_str_af64054c86023237(%rip), %rdi
+    call    xly_str
+    movq    %rax, -160(%rbp)
+    movq    -152(%rbp), %rdi
+    movq    -160(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_9
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_10
+.Lxly_f22_9:
+    call    xly_add
+.Lxly_f22_10:
+    movq    %rax, -168(%rbp)
+    subq    $16, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -176(%rbp)
+.Lxly_irf22_0_b14:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -184(%rbp)
+.Lxly_irf22_0_b13:
+    leaq    .Lxly_str_5665be1b8870744c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -192(%rbp)
+    subq    $16, %rsp
+    movq    -192(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -200(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -216(%rbp)
+    movq    %rbx, %r12
+.Lxly_irf22_0_b1:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -224(%rbp)
+    cmpq    $0, -224(%rbp)
+    je      .Lxly_irf22_0_b3
+.Lxly_irf22_0_b2:
+    subq    $16, %rsp
+    movq    -208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -232(%rbp)
+    movq    %r12, %xmm0
+    movq    -216(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -240(%rbp)
+    movq    -240(%rbp), %r12
+    jmp     .Lxly_irf22_0_b1
+.Lxly_irf22_0_b3:
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -248(%rbp)
+.Lxly_irf22_0_b16:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -256(%rbp)
+.Lxly_irf22_0_b15:
+.Lxly_irf22_0_b18:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -264(%rbp)
+.Lxly_irf22_0_b17:
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -272(%rbp)
+.Lxly_irf22_0_b20:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -280(%rbp)
+.Lxly_irf22_0_b19:
+.Lxly_irf22_0_b22:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -288(%rbp)
+.Lxly_irf22_0_b21:
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -296(%rbp)
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, -304(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, -312(%rbp)
+    movq    %rbx, %r12
+.Lxly_irf22_0_b4:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -320(%rbp)
+    cmpq    $0, -320(%rbp)
+    je      .Lxly_irf22_0_b6
+.Lxly_irf22_0_b5:
+    subq    $16, %rsp
+    movq    -304(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -328(%rbp)
+    movq    %r12, %xmm0
+    movq    -312(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -336(%rbp)
+    movq    -336(%rbp), %r12
+    jmp     .Lxly_irf22_0_b4
+.Lxly_irf22_0_b6:
+    leaq    .Lxly_str_5665c11b88707965(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf22_0_b24:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_irf22_0_b23:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -344(%rbp)
+    leaq    .Lxly_str_5665bb1b88706f33(%rip), %rdi
+    call    xly_str
+    movq    %rax, -352(%rbp)
+    movq    -56(%rbp), %rdi
+    movq    -72(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_11
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_11
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1112(%rbp)
+    leaq    -1120(%rbp), %rax
+    jmp     .Lxly_f22_12
+.Lxly_f22_11:
+    call    xly_add
+.Lxly_f22_12:
+    movq    %rax, -360(%rbp)
+    movq    -360(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -368(%rbp)
+    movq    %r15, %r12
+.Lxly_irf22_0_b7:
+    movq    %r12, %xmm0
+    movq    -344(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, -376(%rbp)
+    cmpq    $0, -376(%rbp)
+    je      .Lxly_irf22_0_b9
+.Lxly_irf22_0_b8:
+    movq    %r12, %xmm0
+    movsd   %xmm0, -1240(%rbp)
+    leaq    -1248(%rbp), %rax
+    movq    %rax, -384(%rbp)
+    movq    -48(%rbp), %rdi
+    movq    -384(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_13
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_13
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1368(%rbp)
+    leaq    -1376(%rbp), %rax
+    jmp     .Lxly_f22_14
+.Lxly_f22_13:
+    call    xly_add
+.Lxly_f22_14:
+    movq    %rax, -392(%rbp)
+    movq    %r13, %rdi
+    movq    -392(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_15
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_15
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1496(%rbp)
+    leaq    -1504(%rbp), %rax
+    jmp     .Lxly_f22_16
+.Lxly_f22_15:
+    call    xly_add
+.Lxly_f22_16:
+    movq    %rax, -400(%rbp)
+    movq    -400(%rbp), %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_17
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_17
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1624(%rbp)
+    leaq    -1632(%rbp), %rax
+    jmp     .Lxly_f22_18
+.Lxly_f22_17:
+    call    xly_add
+.Lxly_f22_18:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_19
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_19
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -1752(%rbp)
+    leaq    -1760(%rbp), %rax
+    jmp     .Lxly_f22_20
+.Lxly_f22_19:
+    call    xly_add
+.Lxly_f22_20:
+    movq    %rax, -408(%rbp)
+    movq    -408(%rbp), %rdi
+    movq    -160(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_21
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_21
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_22
+.Lxly_f22_21:
+    call    xly_add
+.Lxly_f22_22:
+    movq    %rax, -416(%rbp)
+    subq    $16, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -424(%rbp)
+.Lxly_irf22_0_b26:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -432(%rbp)
+.Lxly_irf22_0_b25:
+    subq    $16, %rsp
+    movq    -352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -440(%rbp)
+.Lxly_irf22_0_b28:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -448(%rbp)
+.Lxly_irf22_0_b27:
+    movq    -368(%rbp), %xmm0
+    movsd   %xmm0, -1880(%rbp)
+    leaq    -1888(%rbp), %rax
+    movq    %rax, -456(%rbp)
+    movq    %r14, %rdi
+    movq    -456(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_23
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_23
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2008(%rbp)
+    leaq    -2016(%rbp), %rax
+    jmp     .Lxly_f22_24
+.Lxly_f22_23:
+    call    xly_add
+.Lxly_f22_24:
+    movq    %rax, -464(%rbp)
+    movq    -464(%rbp), %rdi
+    movq    -160(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_25
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_25
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_26
+.Lxly_f22_25:
+    call    xly_add
+.Lxly_f22_26:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -472(%rbp)
+.Lxly_irf22_0_b30:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf22_0_b29:
+    subq    $16, %rsp
+    movq    -352(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf22_0_b32:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf22_0_b31:
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r14, %r12
+    jmp     .Lxly_irf22_0_b7
+.Lxly_irf22_0_b9:
+    movq    -48(%rbp), %rdi
+    movq    -64(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_27
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_27
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2136(%rbp)
+    leaq    -2144(%rbp), %rax
+    jmp     .Lxly_f22_28
+.Lxly_f22_27:
+    call    xly_add
+.Lxly_f22_28:
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    movsd   %xmm0, -2264(%rbp)
+    leaq    -2272(%rbp), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_29
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_29
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2392(%rbp)
+    leaq    -2400(%rbp), %rax
+    jmp     .Lxly_f22_30
+.Lxly_f22_29:
+    call    xly_add
+.Lxly_f22_30:
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    -128(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_31
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_31
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -2520(%rbp)
+    leaq    -2528(%rbp), %rax
+    jmp     .Lxly_f22_32
+.Lxly_f22_31:
+    call    xly_add
+.Lxly_f22_32:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    -56(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_33
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_33
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_34
+.Lxly_f22_33:
+    call    xly_add
+.Lxly_f22_34:
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    -160(%rbp), %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_35
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_35
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f22_36
+.Lxly_f22_35:
+    call    xly_add
+.Lxly_f22_36:
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf22_0_b34:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf22_0_b33:
+    leaq    .Lxly_str_5665c41b88707e7e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+    leaq    .Lxly_str_5665ba1b88706d80(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %rbx, %r12
+.Lxly_irf22_0_b10:
+    movq    %r12, %xmm0
+    movq    -88(%rbp), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf22_0_b12
+.Lxly_irf22_0_b11:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %rbx
+    movq    %r12, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %r12
+    jmp     .Lxly_irf22_0_b10
+.Lxly_irf22_0_b12:
+    leaq    .Lxly_str_5665c71b88708397(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf22_0_b36:
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_08b73907b55c4d71(%rip), %rdi
+    leaq    .Lxly_str_b93a12b0d06caefc(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_irf22_0_b35:
+    call    xly_null
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_countTotal:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_countDone:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r12
+    movq    %rbx, %r13
+    movq    %rbx, %r14
+.Lxly_irf24_0_b1:
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r15
+    movq    %r13, %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf24_0_b3
+.Lxly_irf24_0_b2:
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %rbx
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, -48(%rbp)
+    leaq    .Lxly_irf24_0_k28(%rip), %rax
+    movq    %rax, %r15
+    movq    -48(%rbp), %rdi
+    movq    %r15, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f24_2
+.Lxly_f24_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f24_2:
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_irf24_0_b7
+.Lxly_irf24_0_b4:
+    movq    %r14, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    jmp     .Lxly_irf24_0_b5
+.Lxly_irf24_0_b7:
+    movq    %r14, %rbx
+.Lxly_irf24_0_b5:
+    movq    %r13, %xmm0
+    movq    %r12, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %r13
+    movq    %rbx, %r14
+    jmp     .Lxly_irf24_0_b1
+.Lxly_irf24_0_b3:
+    movq    %r14, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf24_0_k28:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_countActive:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+.Lxly_irf25_0_b3:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf25_0_b2:
+    call    .Lxly_fn_countDone
+    movq    %rax, %rbx
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_pctDone:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+.Lxly_irf26_0_b6:
+    movq    __xly_globals+0(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_12726a191dcc2b4c(%rip), %rsi
+    movl    $1, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r12
+.Lxly_irf26_0_b5:
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf26_0_k21(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f26_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f26_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f26_2
+.Lxly_f26_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f26_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf26_0_b2
+.Lxly_irf26_0_b1:
+    leaq    .Lxly_irf26_0_k22(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf26_0_b2:
+    call    .Lxly_fn_countDone
+    movq    %rax, %r14
+    movabsq $0x4059000000000000, %rax
+    movq    %rax, %rbx
+    movq    %r14, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf26_0_k21:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf26_0_k22:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_taskVisible:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    __xly_globals+16(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_e6f09b190519daa4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_2
+.Lxly_f27_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_2:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf27_0_b2
+.Lxly_irf27_0_b1:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf27_0_k49(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf27_0_b2:
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_str_6580790b036f0c6f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r14, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_3
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_4
+.Lxly_f27_3:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_4:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf27_0_b5
+.Lxly_irf27_0_b4:
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf27_0_k50(%rip), %rax
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_5
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_5
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_6
+.Lxly_f27_5:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_6:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf27_0_b7
+.Lxly_irf27_0_b6:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf27_0_k51(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf27_0_b7:
+    leaq    .Lxly_irf27_0_k52(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf27_0_b5:
+    movq    __xly_globals+32(%rip), %rax
+    movq    %rax, %r12
+    leaq    .Lxly_str_dc51fb6761fd6e91(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_7
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_7
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_8
+.Lxly_f27_7:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_8:
+    movq    %rax, %r14
+    cmpq    $0, %r14
+    je      .Lxly_irf27_0_b11
+.Lxly_irf27_0_b10:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf27_0_k53(%rip), %rax
+    movq    %rax, %r14
+    movq    %r13, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f27_9
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f27_9
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f27_10
+.Lxly_f27_9:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f27_10:
+    movq    %rax, %r12
+    cmpq    $0, %r12
+    je      .Lxly_irf27_0_b13
+.Lxly_irf27_0_b12:
+    leaq    .Lxly_irf27_0_k54(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf27_0_b13:
+    movabsq $0x0, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf27_0_k55(%rip), %rax
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf27_0_b11:
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_irf27_0_k56(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf27_0_k49:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k50:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k51:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k52:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k53:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k54:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k55:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf27_0_k56:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_f74e5feadea773fd:
+    .asciz  "create"
+.Lxly_str_af63ac4c86019afc:
+    .asciz  "1"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_de79f907f80a5d73:
+    .asciz  "Fix parser double-free bug"
+.Lxly_str_7360eecc9b38343d:
+    .asciz  "high"
+.Lxly_str_af63af4c8601a015:
+    .asciz  "2"
+.Lxly_str_ec8a609ae3060e65:
+    .asciz  "Build xui declarative framework"
+.Lxly_str_af63ae4c86019e62:
+    .asciz  "3"
+.Lxly_str_7a2059144b975b8e:
+    .asciz  "Write layout engine (VStack/HStack)"
+.Lxly_str_af63a94c860195e3:
+    .asciz  "4"
+.Lxly_str_ee7e731884e7f968:
+    .asciz  "Add reactive state engine"
+.Lxly_str_081d3d1917793b59:
+    .asciz  "med"
+.Lxly_str_af63a84c86019430:
+    .asciz  "5"
+.Lxly_str_0874ecd658bf9e18:
+    .asciz  "Create dashboard demo"
+.Lxly_str_af63ab4c86019949:
+    .asciz  "6"
+.Lxly_str_d68369c6aa54beb6:
+    .asciz  "Write todo app demo"
+.Lxly_str_af63aa4c86019796:
+    .asciz  "7"
+.Lxly_str_f327369b45529636:
+    .asciz  "Write system monitor demo"
+.Lxly_str_125083191daf6f61:
+    .asciz  "low"
+.Lxly_str_af63b54c8601aa47:
+    .asciz  "8"
+.Lxly_str_d77e56aa0dd11d0a:
+    .asciz  "Package final release"
+.Lxly_str_e6f09b190519daa4:
+    .asciz  "all"
+.Lxly_str_cbf29ce484222325:
+    .asciz  ""
+.Lxly_str_08b73907b55c4d71:
+    .asciz  "io"
+.Lxly_str_b93a12b0d06caefc:
+    .asciz  "write"
+.Lxly_str_e22f84f0e00344dc:
+    .asciz  "1;1H"
+.Lxly_str_7c06c68969981f60:
+    .asciz  "  \342\234\223 Xenly Task Manager  \342\200\224  Declarative Linux UI                                  "
+.Lxly_str_06c8bae1ab129885:
+    .asciz  "Project Progress"
+.Lxly_str_6ef4d6d8ac36494b:
+    .asciz  "4;3H"
+.Lxly_str_b978c4d0a55ed89d:
+    .asciz  "Tasks:  "
+.Lxly_str_c37dd817ce876f70:
+    .asciz  " / "
+.Lxly_str_12726a191dcc2b4c:
+    .asciz  "len"
+.Lxly_str_b7fdc8f90bfccf18:
+    .asciz  " completed"
+.Lxly_str_22e80e18049c26e6:
+    .asciz  "5;3"
+.Lxly_str_ec76a0cfd555b9aa:
+    .asciz  "5;3H"
+.Lxly_str_700342ea56a0a5f5:
+    .asciz  "6;3H"
+.Lxly_str_49344b94c31b361d:
+    .asciz  "Active: "
+.Lxly_str_083b5b313d664673:
+    .asciz  "6;16H"
+.Lxly_str_3f447d8e7fd1035b:
+    .asciz  "Done:   "
+.Lxly_str_3417a4e1a816148c:
+    .asciz  "7;3H"
+.Lxly_str_544ec8f699df2b5c:
+    .asciz  "Progress: "
+.Lxly_str_af63984c86017900:
+    .asciz  "%"
+.Lxly_str_a8beb6b1182241ac:
+    .asciz  "Filters"
+.Lxly_str_7bbe2810795103f6:
+    .asciz  "Show: "
+.Lxly_str_1992954e26341330:
+    .asciz  "[ All    ]"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_0438a04fc332ff5f:
+    .asciz  "[ Active ]"
+.Lxly_str_96dfb645871b89dd:
+    .asciz  "[ Done   ]"
+.Lxly_str_df4a10ec03082795:
+    .asciz  "Filter: "
+.Lxly_str_c5225cce87f2bb53:
+    .asciz  "Visible: "
+.Lxly_str_3639825bfe23eebf:
+    .asciz  " tasks"
+.Lxly_str_c797fd9076cc136d:
+    .asciz  "Tasks"
+.Lxly_str_3e57f913fe18bbc0:
+    .asciz  "[\342\234\223] "
+.Lxly_str_016543663443e82b:
+    .asciz  "[ ] "
+.Lxly_str_c328e217ce3f406f:
+    .asciz  " H "
+.Lxly_str_c317e417ce30d0a2:
+    .asciz  " M "
+.Lxly_str_c31b4a17ce33b3cb:
+    .asciz  " L "
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_7419ad7f59af467a:
+    .asciz  "  \342\227\200"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_3aa73af46a6f52f1:
+    .asciz  "Recent Actions"
+.Lxly_str_54b2a19081417685:
+    .asciz  "\342\234\224  "
+.Lxly_str_da9141c9f9548fa8:
+    .asciz  "Parser double-free bug fixed \342\200\224 variables now pass correctly to all functions"
+.Lxly_str_cba471d99899b68f:
+    .asciz  "XUI framework loaded \342\200\224 30+ declarative components available"
+.Lxly_str_dbbcd1c430a9b98e:
+    .asciz  "\342\204\271  "
+.Lxly_str_5aae46ec70575dcd:
+    .asciz  "Layout engine ready \342\200\224 VStack/HStack/Panel composition working"
+.Lxly_str_aa01ee1e6db0520f:
+    .asciz  "  \342\206\221\342\206\223: navigate   space: toggle   f: filter   a: add   d: delete   q: quit     "
+.Lxly_str_af63c74c8601c8dd:
+    .asciz  "\n"
+.Lxly_str_af63b64c8601abfa:
+    .asciz  ";"
+.Lxly_str_af64054c86023237:
+    .asciz  "H"
+.Lxly_str_af64164c86024f1a:
+    .asciz  "["
+.Lxly_str_566ff41b88792493:
+    .asciz  "\342\226\210"
+.Lxly_str_56700b1b88794ba8:
+    .asciz  "\342\226\221"
+.Lxly_str_af64104c860244e8:
+    .asciz  "]"
+.Lxly_str_19fe06e3408e53d0:
+    .asciz  "success"
+.Lxly_str_5e39a0f62bea2e31:
+    .asciz  "warn"
+.Lxly_str_9f7452dd75d54d31:
+    .asciz  "error"
+.Lxly_str_f5d6a8c57ab94f05:
+    .asciz  "info"
+.Lxly_str_5665be1b8870744c:
+    .asciz  "\342\225\224"
+.Lxly_str_5665ba1b88706d80:
+    .asciz  "\342\225\220"
+.Lxly_str_5665c11b88707965:
+    .asciz  "\342\225\227"
+.Lxly_str_5665bb1b88706f33:
+    .asciz  "\342\225\221"
+.Lxly_str_5665c41b88707e7e:
+    .asciz  "\342\225\232"
+.Lxly_str_5665c71b88708397:
+    .asciz  "\342\225\235"
+.Lxly_str_6580790b036f0c6f:
+    .asciz  "active"
+.Lxly_str_dc51fb6761fd6e91:
+    .asciz  "done"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   11
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   88
@@ -0,0 +1,2416 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $912, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -904(%rbp)
+    movq    %rax, -896(%rbp)
+    movq    %rax, -888(%rbp)
+    movq    %rax, -880(%rbp)
+    movq    %rax, -872(%rbp)
+    movq    %rax, -864(%rbp)
+    movq    %rax, -856(%rbp)
+    movq    %rax, -848(%rbp)
+    movq    %rax, -840(%rbp)
+    movq    %rax, -832(%rbp)
+    movq    %rax, -824(%rbp)
+    movq    %rax, -816(%rbp)
+    movq    %rax, -808(%rbp)
+    movq    %rax, -800(%rbp)
+    movq    %rax, -792(%rbp)
+    movq    %rax, -784(%rbp)
+    movl    $-1, -868(%rbp)
+    leaq    .Lxly_str_f8244dfed2c04c73(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_7bf2e277a38b3b8e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_123909cb9f15d167(%rip), %rdi
+    call    xly_str
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x403e000000000000, %rax
+    movq    %rax, -56(%rbp)
+    leaq    .Lxly_ir0_k247(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    movl    $1, %edi
+    call    xly_bool
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_fd2900eaf207ed7c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_197c62d2bd852d51(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -48(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_ca5993223c51044a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_c093e04f8e75692d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k248(%rip), %rax
+    movq    %rax, -64(%rbp)
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -64(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_ee2de8a368a6f007(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_b3ee60447b9eb9be(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_73f4b461b1324547(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b2:
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b1:
+    leaq    .Lxly_ir0_k249(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_2f86308e0de45250(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+.Lxly_ir0_b4:
+    leaq    .Lxly_str_8b17b4b9be5a298e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b3:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f06f3ca9c1e6c5f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4045000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k250(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_54db247d046ab340(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    leaq    .Lxly_str_b3965307749b3792(%rip), %rdi
+    call    xly_str
+    movq    %rax, -88(%rbp)
+    leaq    .Lxly_ir0_k251(%rip), %rax
+    movq    %rax, -96(%rbp)
+    subq    $32, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -96(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -88(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_4c31fb7cff833feb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_02c3e451250cc8f6(%rip), %rdi
+    call    xly_str
+    movq    %rax, -104(%rbp)
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    -104(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_6707fa7d0ef41df6(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_77745914edbd5da5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $32, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_71adadaae8154fe3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+.Lxly_ir0_b6:
+    movabsq $0x4034000000000000, %rax
+    movq    %rax, -112(%rbp)
+.Lxly_ir0_b5:
+    leaq    .Lxly_ir0_k252(%rip), %rax
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1bf9f6e8a3a2da19(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+.Lxly_ir0_b8:
+    leaq    .Lxly_ir0_k253(%rip), %rax
+    movq    %rax, -120(%rbp)
+    leaq    .Lxly_ir0_k254(%rip), %rax
+    movq    %rax, -128(%rbp)
+    subq    $16, %rsp
+    movq    -120(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -128(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r15
+.Lxly_ir0_b7:
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x4008000000000000, %rax
+    movq    %rax, -136(%rbp)
+    movabsq $0x4010000000000000, %rax
+    movq    %rax, -144(%rbp)
+.Lxly_ir0_b10:
+    leaq    .Lxly_ir0_k255(%rip), %rax
+    movq    %rax, -152(%rbp)
+    leaq    .Lxly_ir0_k256(%rip), %rax
+    movq    %rax, -160(%rbp)
+    subq    $16, %rsp
+    movq    -152(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -160(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b9:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_6e5c799c2b2d922c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -168(%rbp)
+    leaq    .Lxly_ir0_k257(%rip), %rax
+    movq    %rax, -176(%rbp)
+    movq    %r15, %rdi
+    movq    -176(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -184(%rbp)
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k258(%rip), %rax
+    movq    %rax, -192(%rbp)
+    movq    %r15, %rdi
+    movq    -192(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -200(%rbp)
+    subq    $32, %rsp
+    movq    -168(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -184(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -200(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_6e58f39c2b2a78a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -208(%rbp)
+    leaq    .Lxly_ir0_k259(%rip), %rax
+    movq    %rax, -216(%rbp)
+    movq    %r14, %rdi
+    movq    -216(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -224(%rbp)
+    leaq    .Lxly_ir0_k260(%rip), %rax
+    movq    %rax, -232(%rbp)
+    movq    %r14, %rdi
+    movq    -232(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -240(%rbp)
+    subq    $32, %rsp
+    movq    -208(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -224(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -240(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movl    $3, %esi
+    call    xly_print
+    addq    $32, %rsp
+    leaq    .Lxly_str_bca205849cf5c9b0(%rip), %rdi
+    call    xly_str
+    movq    %rax, -248(%rbp)
+.Lxly_ir0_b12:
+    leaq    .Lxly_ir0_k261(%rip), %rax
+    movq    %rax, -256(%rbp)
+    movq    %r15, %rdi
+    movq    -256(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -264(%rbp)
+    leaq    .Lxly_ir0_k262(%rip), %rax
+    movq    %rax, -272(%rbp)
+    movq    %r14, %rdi
+    movq    -272(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -280(%rbp)
+    movq    -264(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -280(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -288(%rbp)
+    leaq    .Lxly_ir0_k263(%rip), %rax
+    movq    %rax, -296(%rbp)
+    movq    %r15, %rdi
+    movq    -296(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -304(%rbp)
+    leaq    .Lxly_ir0_k264(%rip), %rax
+    movq    %rax, %r15
+    movq    %r14, %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, -312(%rbp)
+    movq    -304(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    -312(%rbp), %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    -288(%rbp), %xmm0
+    movq    -288(%rbp), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r15, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, -320(%rbp)
+    movq    %r14, %xmm0
+    movq    -320(%rbp), %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+.Lxly_ir0_b11:
+    movq    %r14, %xmm0
+    movsd   %xmm0, -896(%rbp)
+    leaq    -904(%rbp), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    -248(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k266(%rip), %rax
+    movq    %rax, -328(%rbp)
+    leaq    .Lxly_ir0_k267(%rip), %rax
+    movq    %rax, -336(%rbp)
+    leaq    .Lxly_ir0_k268(%rip), %rax
+    movq    %rax, -344(%rbp)
+    subq    $32, %rsp
+    movq    -328(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -336(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -344(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_ir0_k269(%rip), %rax
+    movq    %rax, -352(%rbp)
+    movq    %r14, %rdi
+    movq    -352(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -360(%rbp)
+    movq    -360(%rbp), %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_ir0_k270(%rip), %rax
+    movq    %rax, -368(%rbp)
+    movq    %r14, %rdi
+    movq    -368(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -376(%rbp)
+    movq    -376(%rbp), %rax
+    movq    %rax, __xly_globals+80(%rip)
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, -384(%rbp)
+    leaq    .Lxly_ir0_k271(%rip), %rax
+    movq    %rax, -392(%rbp)
+    movq    %r14, %rdi
+    movq    -392(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -400(%rbp)
+    movq    -400(%rbp), %rax
+    movq    %rax, __xly_globals+88(%rip)
+    leaq    .Lxly_str_7be11faa5554c04e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $32, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -360(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -376(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -400(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    %rsp, %rdi
+    movl    $4, %esi
+    call    xly_print
+    addq    $32, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_9d9e89a456f5c25b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    .Lxly_fn_Math_namespace
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    leaq    .Lxly_str_58d71f2c3f5730f1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -408(%rbp)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k272(%rip), %rax
+    movq    %rax, -416(%rbp)
+    subq    $16, %rsp
+    movq    -416(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_7884f79b0c364646(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -424(%rbp)
+    subq    $16, %rsp
+    movq    -408(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -424(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_3098976978041d29(%rip), %rdi
+    call    xly_str
+    movq    %rax, -432(%rbp)
+    leaq    .Lxly_ir0_k273(%rip), %rax
+    movq    %rax, -440(%rbp)
+    subq    $16, %rsp
+    movq    -440(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_4c5f6190acb3dc80(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -448(%rbp)
+    subq    $16, %rsp
+    movq    -432(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -448(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c61ce16e07d62f3f(%rip), %rdi
+    call    xly_str
+    movq    %rax, -456(%rbp)
+    movabsq $0xc024000000000000, %rax
+    movq    %rax, -464(%rbp)
+    leaq    .Lxly_ir0_k274(%rip), %rax
+    movq    %rax, -472(%rbp)
+    subq    $16, %rsp
+    movq    -472(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_e71fb2190541727b(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -480(%rbp)
+    subq    $16, %rsp
+    movq    -456(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -480(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    call    .Lxly_fn_Graphics_namespace
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_d8d1214fd4d17133(%rip), %rdi
+    call    xly_str
+    movq    %rax, -488(%rbp)
+    movq    %r14, %rdi
+    movq    .Lxly_atom_7e860296d38b6351(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -496(%rbp)
+    movq    -496(%rbp), %rdi
+    movq    .Lxly_atom_a05ebe19ff08b6fc(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -504(%rbp)
+    subq    $16, %rsp
+    movq    -488(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -504(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_47fe285e659f7df4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -512(%rbp)
+    movq    %r14, %rdi
+    movq    .Lxly_atom_de466a82b78b2eef(%rip), %rsi
+    call    xly_obj_get_atom
+    movq    %rax, -520(%rbp)
+    leaq    .Lxly_ir0_k275(%rip), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -520(%rbp), %rdi
+    leaq    .Lxly_str_2c5c798f62d3d8c9(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -528(%rbp)
+    subq    $16, %rsp
+    movq    -512(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -528(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_149d7e4f173b90e5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    call    .Lxly_fn_ApiClient
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_59c0293605db1c0c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -536(%rbp)
+    subq    $16, %rsp
+    movq    -536(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, -544(%rbp)
+    leaq    .Lxly_str_046c2b8f7bfcd5f2(%rip), %rdi
+    call    xly_str
+    movq    %rax, -552(%rbp)
+    subq    $16, %rsp
+    movq    -552(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_d4e26318faaa79f7(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -560(%rbp)
+    subq    $16, %rsp
+    movq    -544(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -560(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_188f4d0b7d47ed42(%rip), %rdi
+    call    xly_str
+    movq    %rax, -568(%rbp)
+    subq    $16, %rsp
+    movq    -568(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_8c2fe90da8958d47(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $1, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -576(%rbp)
+    subq    $16, %rsp
+    movq    -544(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -576(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_f0208dea5dcd67a8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_36ace119c2ac7da1(%rip), %rdi
+    call    xly_str
+    movq    %rax, -584(%rbp)
+.Lxly_ir0_b14:
+    leaq    .Lxly_ir0_k276(%rip), %rax
+    movq    %rax, -592(%rbp)
+    subq    $32, %rsp
+    movq    -48(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -592(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -584(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+.Lxly_ir0_b13:
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_16566419b10316b4(%rip), %rdi
+    call    xly_str
+    movq    %rax, -600(%rbp)
+    movabsq $0x4039000000000000, %rax
+    movq    %rax, -608(%rbp)
+    leaq    .Lxly_str_09461007b5d5c00c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -616(%rbp)
+.Lxly_ir0_b16:
+    leaq    .Lxly_ir0_k277(%rip), %rax
+    movq    %rax, -624(%rbp)
+    subq    $32, %rsp
+    movq    -600(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    -624(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -616(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, -632(%rbp)
+.Lxly_ir0_b15:
+    movq    -632(%rbp), %rax
+    movq    %rax, __xly_globals+128(%rip)
+.Lxly_ir0_b18:
+    leaq    .Lxly_ir0_k278(%rip), %rax
+    movq    %rax, -640(%rbp)
+    movq    %r14, %rdi
+    movq    -640(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -648(%rbp)
+    leaq    .Lxly_ir0_k279(%rip), %rax
+    movq    %rax, -656(%rbp)
+    movq    %r14, %rdi
+    movq    -656(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -664(%rbp)
+    leaq    .Lxly_ir0_k280(%rip), %rax
+    movq    %rax, -672(%rbp)
+    movq    %r14, %rdi
+    movq    -672(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -680(%rbp)
+    leaq    .Lxly_str_ba4f00174503be96(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    leaq    .Lxly_str_af63a04c86018698(%rip), %rdi
+    call    xly_str
+    movq    %rax, -688(%rbp)
+    leaq    .Lxly_str_07e1503d569ed78c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -696(%rbp)
+    subq    $48, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    -648(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    -688(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    -664(%rbp), %rax
+    movq    %rax, 24(%rsp)
+    movq    -696(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -680(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+.Lxly_ir0_b17:
+.Lxly_ir0_b20:
+    leaq    .Lxly_ir0_k281(%rip), %rax
+    movq    %rax, -704(%rbp)
+    movq    -632(%rbp), %rdi
+    movq    -704(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k282(%rip), %rax
+    movq    %rax, -712(%rbp)
+    movq    -632(%rbp), %rdi
+    movq    -712(%rbp), %rsi
+    call    xly_index
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k283(%rip), %rax
+    movq    %rax, -720(%rbp)
+    movq    -632(%rbp), %rdi
+    movq    -720(%rbp), %rsi
+    call    xly_index
+    movq    %rax, -728(%rbp)
+    subq    $48, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    -688(%rbp), %rax
+    movq    %rax, 16(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 24(%rsp)
+    movq    -696(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    -728(%rbp), %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+.Lxly_ir0_b19:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    call    .Lxly_fn_MathLib
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_325c7a667b2c2416(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_beac78d1b7190dfd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k284(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k285(%rip), %rax
+    movq    %rax, -736(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -736(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_e70bc3190530e654(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -744(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -744(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_24ec49b3f5a0f6d0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k286(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k287(%rip), %rax
+    movq    %rax, -752(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -752(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_50bd8aca628b9d41(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -760(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -760(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_c5c570cdc73d67e4(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k288(%rip), %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k289(%rip), %rax
+    movq    %rax, -768(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -768(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_4a658105ca1038e5(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, -776(%rbp)
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    -776(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0336b1194a085a41(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k290(%rip), %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k291(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r14, %rdi
+    leaq    .Lxly_str_d1376826789a1830(%rip), %rsi
+    movq    %rsp, %rdx
+    movl    $2, %ecx
+    call    xly_obj_call
+    addq    $16, %rsp
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_8d657ba025441d60(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k247:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k248:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k249:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k250:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k251:
+    .quad   0, 0x4045000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k252:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k253:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k254:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k255:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k256:
+    .quad   0, 0x4010000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k257:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k258:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k259:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k260:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k261:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k262:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k263:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k264:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k266:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k267:
+    .quad   0, 0x4034000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k268:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k269:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k270:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k271:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k272:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k273:
+    .quad   0, 0x4008000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k274:
+    .quad   0, 0xc024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k275:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k276:
+    .quad   0, 0x403e000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k277:
+    .quad   0, 0x4039000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k278:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k279:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k280:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k281:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k282:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k283:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k284:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k285:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k286:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k287:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k288:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k289:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k290:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k291:
+    .quad   0, 0x4014000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_add:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_greet:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_aeca1d734cdc30ff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f1_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f1_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f1_2
+.Lxly_f1_1:
+    call    xly_add
+.Lxly_f1_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_createPoint:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movq    $2, %rsi
+    call    xly_array_create
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_distance:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf4_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r15
+    leaq    .Lxly_irf4_0_k20(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r13
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r13, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_irf4_0_k21(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, -64(%rbp)
+    leaq    .Lxly_irf4_0_k22(%rip), %rax
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, %r15
+    movq    -64(%rbp), %rax
+    movsd   8(%rax), %xmm0
+    movq    %r15, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r14, %xmm0
+    movq    %r14, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r12, %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r14
+    movq    %r15, %xmm0
+    movq    %r14, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    sqrtsd  %xmm0, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf4_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf4_0_k20:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf4_0_k21:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf4_0_k22:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_Math_namespace:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_square__f5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_7884f79b0c364646(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_cube__f5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_4c5f6190acb3dc80(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_abs__f5(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_e71fb2190541727b(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Graphics_namespace:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+.Lxly_irf6_0_b3:
+    call    xly_obj_new
+    movq    %rax, %r12
+    leaq    .Lxly_str_e39a3d3a300bf18e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_a05ebe19ff08b6fc(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_6e921c4551ce1dee(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_ba0f168471813c1c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_f73aa19b47782cce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r12, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_d9e4d3a72638724d(%rip), %rsi
+    call    xly_obj_set_atom
+.Lxly_irf6_0_b2:
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_7e860296d38b6351(%rip), %rsi
+    call    xly_obj_set_atom
+    call    .Lxly_fn_Shapes__f6
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rdx
+    movq    .Lxly_atom_de466a82b78b2eef(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_ApiClient:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_get__f7(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_d4e26318faaa79f7(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_post__f7(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_8c2fe90da8958d47(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_request__f7(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_6f4743b8bc5b4eb2(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_createPerson:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rdx, %r13
+    subq    $32, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdi
+    movq    $3, %rsi
+    call    xly_array_create
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_displayPerson:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_irf9_0_k13(%rip), %rax
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    call    xly_index
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf9_0_k14(%rip), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rsi
+    call    xly_index
+    movq    %rax, %r13
+    movabsq $0x4000000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_irf9_0_k15(%rip), %rax
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rsi
+    call    xly_index
+    movq    %rax, %r14
+    leaq    .Lxly_str_ba4f00174503be96(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    leaq    .Lxly_str_af63a04c86018698(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    leaq    .Lxly_str_07e1503d569ed78c(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $48, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 24(%rsp)
+    movq    -56(%rbp), %rax
+    movq    %rax, 32(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 40(%rsp)
+    movq    %rsp, %rdi
+    movl    $6, %esi
+    call    xly_print
+    addq    $48, %rsp
+    call    xly_null
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf9_0_k13:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf9_0_k14:
+    .quad   0, 0x3ff0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf9_0_k15:
+    .quad   0, 0x4000000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_MathLib:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_add__f10(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_e70bc3190530e654(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_subtract__f10(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_50bd8aca628b9d41(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_multiply__f10(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_4a658105ca1038e5(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_divide__f10(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_d1376826789a1830(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_square__f5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %r12, %xmm0
+    call    xly_num
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_cube__f5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_abs__f5:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %r13
+    cmpq    $0, %r13
+    je      .Lxly_irf13_0_b2
+.Lxly_irf13_0_b1:
+    movq    %rbx, %rax
+    movq    8(%rax), %rax
+    btcq    $63, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    jmp     .Lxly_irf13_0_b3
+.Lxly_irf13_0_b2:
+    movq    %rbx, %r12
+.Lxly_irf13_0_b3:
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Colors__f6:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_str_e39a3d3a300bf18e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_a05ebe19ff08b6fc(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_6e921c4551ce1dee(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_ba0f168471813c1c(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_str_f73aa19b47782cce(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_d9e4d3a72638724d(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_Shapes__f6:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $16, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    call    xly_obj_new
+    movq    %rax, %rbx
+    leaq    .Lxly_fn_circle__f15(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_2c5c798f62d3d8c9(%rip), %rsi
+    call    xly_obj_set_atom
+    leaq    .Lxly_fn_square__f15(%rip), %rdi
+    call    xly_make_fn
+    movq    %rax, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rdx
+    movq    .Lxly_atom_7884f79b0c364646(%rip), %rsi
+    call    xly_obj_set_atom
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_request__f7:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $176, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    xorl    %eax, %eax
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movl    $-1, -140(%rbp)
+    leaq    .Lxly_str_af639d4c8601817f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %rbx, %rdi
+    movq    %r13, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -168(%rbp)
+    leaq    -176(%rbp), %rax
+    jmp     .Lxly_f16_2
+.Lxly_f16_1:
+    call    xly_add
+.Lxly_f16_2:
+    movq    %rax, %r14
+    movq    %r14, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f16_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f16_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f16_4
+.Lxly_f16_3:
+    call    xly_add
+.Lxly_f16_4:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_get__f7:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+.Lxly_irf17_0_b3:
+    leaq    .Lxly_str_7b409b7d53087775(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f17_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f17_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f17_2
+.Lxly_f17_1:
+    call    xly_add
+.Lxly_f17_2:
+    movq    %rax, %r13
+.Lxly_irf17_0_b2:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_post__f7:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+.Lxly_irf18_0_b3:
+    leaq    .Lxly_str_4d18af8f4b9248c5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f18_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f18_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f18_2
+.Lxly_f18_1:
+    call    xly_add
+.Lxly_f18_2:
+    movq    %rax, %r13
+.Lxly_irf18_0_b2:
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_add__f10:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f19_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f19_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f19_2
+.Lxly_f19_1:
+    call    xly_add
+.Lxly_f19_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_subtract__f10:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    subsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_multiply__f10:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    mulsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r13
+    movq    %r13, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_divide__f10:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $64, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    movq    %rdi, %rbx
+    movq    %rsi, %r12
+    movabsq $0x0, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_irf22_0_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %r12, %rdi
+    movq    %r14, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f22_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f22_1
+    movsd   8(%rdi), %xmm0
+    movsd   8(%rsi), %xmm1
+    ucomisd %xmm1, %xmm0
+    sete    %al
+    setnp   %cl
+    andb    %cl, %al
+    movzbl  %al, %eax
+    jmp     .Lxly_f22_2
+.Lxly_f22_1:
+    call    xly_eq
+    movq    %rax, %rdi
+    call    xly_truthy
+    movl    %eax, %eax
+.Lxly_f22_2:
+    movq    %rax, %r15
+    cmpq    $0, %r15
+    je      .Lxly_irf22_0_b2
+.Lxly_irf22_0_b1:
+    leaq    .Lxly_str_5547b36cdf94e465(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r15, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_irf22_0_k20(%rip), %rax
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+.Lxly_irf22_0_b2:
+    movq    %rbx, %rax
+    movsd   8(%rax), %xmm0
+    movq    %r12, %rax
+    movsd   8(%rax), %xmm1
+    divsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %r15
+    movq    %r15, %xmm0
+    call    xly_num
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_irf22_0_k19:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_irf22_0_k20:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_circle__f15:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_ae7c3167c91394eb(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f23_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f23_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f23_2
+.Lxly_f23_1:
+    call    xly_add
+.Lxly_f23_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.Lxly_fn_square__f15:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $32, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    leaq    .Lxly_str_aeaf6e4f1a4361dc(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f24_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f24_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f24_2
+.Lxly_f24_1:
+    call    xly_add
+.Lxly_f24_2:
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   16
+.Lxly_atoms:
+.Lxly_atom_7e860296d38b6351:
+    .quad   .Lxly_str_7e860296d38b6351
+.Lxly_atom_a05ebe19ff08b6fc:
+    .quad   .Lxly_str_a05ebe19ff08b6fc
+.Lxly_atom_de466a82b78b2eef:
+    .quad   .Lxly_str_de466a82b78b2eef
+.Lxly_atom_7884f79b0c364646:
+    .quad   .Lxly_str_7884f79b0c364646
+.Lxly_atom_4c5f6190acb3dc80:
+    .quad   .Lxly_str_4c5f6190acb3dc80
+.Lxly_atom_e71fb2190541727b:
+    .quad   .Lxly_str_e71fb2190541727b
+.Lxly_atom_ba0f168471813c1c:
+    .quad   .Lxly_str_ba0f168471813c1c
+.Lxly_atom_d9e4d3a72638724d:
+    .quad   .Lxly_str_d9e4d3a72638724d
+.Lxly_atom_d4e26318faaa79f7:
+    .quad   .Lxly_str_d4e26318faaa79f7
+.Lxly_atom_8c2fe90da8958d47:
+    .quad   .Lxly_str_8c2fe90da8958d47
+.Lxly_atom_6f4743b8bc5b4eb2:
+    .quad   .Lxly_str_6f4743b8bc5b4eb2
+.Lxly_atom_e70bc3190530e654:
+    .quad   .Lxly_str_e70bc3190530e654
+.Lxly_atom_50bd8aca628b9d41:
+    .quad   .Lxly_str_50bd8aca628b9d41
+.Lxly_atom_4a658105ca1038e5:
+    .quad   .Lxly_str_4a658105ca1038e5
+.Lxly_atom_d1376826789a1830:
+    .quad   .Lxly_str_d1376826789a1830
+.Lxly_atom_2c5c798f62d3d8c9:
+    .quad   .Lxly_str_2c5c798f62d3d8c9
+
+.section .rodata
+.Lxly_str_f8244dfed2c04c73:
+    .asciz  "=== Type System Features ==="
+.Lxly_str_7bf2e277a38b3b8e:
+    .asciz  "1. Type Signatures (Annotations):"
+.Lxly_str_123909cb9f15d167:
+    .asciz  "Alice"
+.Lxly_str_fd2900eaf207ed7c:
+    .asciz  "  name:"
+.Lxly_str_197c62d2bd852d51:
+    .asciz  "(string)"
+.Lxly_str_ca5993223c51044a:
+    .asciz  "  age:"
+.Lxly_str_c093e04f8e75692d:
+    .asciz  "(number)"
+.Lxly_str_ee2de8a368a6f007:
+    .asciz  "  active:"
+.Lxly_str_b3ee60447b9eb9be:
+    .asciz  "(bool)"
+.Lxly_str_73f4b461b1324547:
+    .asciz  "  add(5, 3):"
+.Lxly_str_2f86308e0de45250:
+    .asciz  "  greet('Bob'):"
+.Lxly_str_8b17b4b9be5a298e:
+    .asciz  "Hello, Bob"
+.Lxly_str_f06f3ca9c1e6c5f6:
+    .asciz  "2. Type Inference:"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_54db247d046ab340:
+    .asciz  "  x ="
+.Lxly_str_b3965307749b3792:
+    .asciz  "(inferred: number)"
+.Lxly_str_4c31fb7cff833feb:
+    .asciz  "  y ="
+.Lxly_str_02c3e451250cc8f6:
+    .asciz  "(inferred: string)"
+.Lxly_str_6707fa7d0ef41df6:
+    .asciz  "  z ="
+.Lxly_str_77745914edbd5da5:
+    .asciz  "(inferred: bool)"
+.Lxly_str_71adadaae8154fe3:
+    .asciz  "  multiply(4, 5):"
+.Lxly_str_1bf9f6e8a3a2da19:
+    .asciz  "3. Tuples (Array Pattern):"
+.Lxly_str_6e5c799c2b2d922c:
+    .asciz  "  Point 1:"
+.Lxly_str_6e58f39c2b2a78a3:
+    .asciz  "  Point 2:"
+.Lxly_str_bca205849cf5c9b0:
+    .asciz  "  Distance:"
+.Lxly_str_7be11faa5554c04e:
+    .asciz  "  Coordinates:"
+.Lxly_str_9d9e89a456f5c25b:
+    .asciz  "4. Namespaces (Object Pattern):"
+.Lxly_str_58d71f2c3f5730f1:
+    .asciz  "  MathUtils.square(5):"
+.Lxly_str_7884f79b0c364646:
+    .asciz  "square"
+.Lxly_str_3098976978041d29:
+    .asciz  "  MathUtils.cube(3):"
+.Lxly_str_4c5f6190acb3dc80:
+    .asciz  "cube"
+.Lxly_str_c61ce16e07d62f3f:
+    .asciz  "  MathUtils.abs(-10):"
+.Lxly_str_e71fb2190541727b:
+    .asciz  "abs"
+.Lxly_str_d8d1214fd4d17133:
+    .asciz  "  Graphics.Colors.RED:"
+.Lxly_str_47fe285e659f7df4:
+    .asciz  "  Graphics.Shapes.circle(10):"
+.Lxly_str_2c5c798f62d3d8c9:
+    .asciz  "circle"
+.Lxly_str_149d7e4f173b90e5:
+    .asciz  "=== Practical Examples ==="
+.Lxly_str_59c0293605db1c0c:
+    .asciz  "API Client:"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_046c2b8f7bfcd5f2:
+    .asciz  "https://api.example.com/users"
+.Lxly_str_d4e26318faaa79f7:
+    .asciz  "get"
+.Lxly_str_188f4d0b7d47ed42:
+    .asciz  "https://api.example.com/data"
+.Lxly_str_8c2fe90da8958d47:
+    .asciz  "post"
+.Lxly_str_f0208dea5dcd67a8:
+    .asciz  "Person Records:"
+.Lxly_str_36ace119c2ac7da1:
+    .asciz  "NYC"
+.Lxly_str_16566419b10316b4:
+    .asciz  "Bob"
+.Lxly_str_09461007b5d5c00c:
+    .asciz  "SF"
+.Lxly_str_ba4f00174503be96:
+    .asciz  "  Person:"
+.Lxly_str_af63a04c86018698:
+    .asciz  "-"
+.Lxly_str_07e1503d569ed78c:
+    .asciz  "years old, from"
+.Lxly_str_325c7a667b2c2416:
+    .asciz  "Math Library:"
+.Lxly_str_beac78d1b7190dfd:
+    .asciz  "  Math.add(10, 5):"
+.Lxly_str_e70bc3190530e654:
+    .asciz  "add"
+.Lxly_str_24ec49b3f5a0f6d0:
+    .asciz  "  Math.subtract(10, 5):"
+.Lxly_str_50bd8aca628b9d41:
+    .asciz  "subtract"
+.Lxly_str_c5c570cdc73d67e4:
+    .asciz  "  Math.multiply(10, 5):"
+.Lxly_str_4a658105ca1038e5:
+    .asciz  "multiply"
+.Lxly_str_0336b1194a085a41:
+    .asciz  "  Math.divide(10, 5):"
+.Lxly_str_d1376826789a1830:
+    .asciz  "divide"
+.Lxly_str_8d657ba025441d60:
+    .asciz  "\342\234\205 Type system features working!"
+.Lxly_str_aeca1d734cdc30ff:
+    .asciz  "Hello, "
+.Lxly_str_e39a3d3a300bf18e:
+    .asciz  "#FF0000"
+.Lxly_str_6e921c4551ce1dee:
+    .asciz  "#00FF00"
+.Lxly_str_f73aa19b47782cce:
+    .asciz  "#0000FF"
+.Lxly_str_af639d4c8601817f:
+    .asciz  " "
+.Lxly_str_7b409b7d53087775:
+    .asciz  "GET "
+.Lxly_str_4d18af8f4b9248c5:
+    .asciz  "POST "
+.Lxly_str_5547b36cdf94e465:
+    .asciz  "  Error: Division by zero"
+.Lxly_str_ae7c3167c91394eb:
+    .asciz  "Circle: "
+.Lxly_str_aeaf6e4f1a4361dc:
+    .asciz  "Square: "
+.Lxly_str_7e860296d38b6351:
+    .asciz  "Colors"
+.Lxly_str_a05ebe19ff08b6fc:
+    .asciz  "RED"
+.Lxly_str_de466a82b78b2eef:
+    .asciz  "Shapes"
+.Lxly_str_ba0f168471813c1c:
+    .asciz  "GREEN"
+.Lxly_str_d9e4d3a72638724d:
+    .asciz  "BLUE"
+.Lxly_str_6f4743b8bc5b4eb2:
+    .asciz  "request"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   18
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   144
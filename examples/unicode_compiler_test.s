@@ -0,0 +1,963 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $224, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorl    %eax, %eax
+    movq    %rax, -216(%rbp)
+    movq    %rax, -208(%rbp)
+    movq    %rax, -200(%rbp)
+    movq    %rax, -192(%rbp)
+    movq    %rax, -184(%rbp)
+    movq    %rax, -176(%rbp)
+    movq    %rax, -168(%rbp)
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movl    $-1, -180(%rbp)
+    leaq    .Lxly_str_d48b373856e52d86(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_bc4883fb5bcc0af5(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_64010ff0f3522ea2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    leaq    .Lxly_str_0be0960ba3c75ae1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_281e79c45552e6f0(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+16(%rip)
+    leaq    .Lxly_str_07c5a807b48ed46d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_df8aa5ce4da7d574(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9a5c8b71ac372c89(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+24(%rip)
+    leaq    .Lxly_str_740e87fae57a21df(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+32(%rip)
+    leaq    .Lxly_str_4c4deae25c2b798e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+40(%rip)
+    leaq    .Lxly_str_8316fe943672c769(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+48(%rip)
+    movabsq $0x400921f9f01b866e, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir0_k207(%rip), %rax
+    movq    %rax, -48(%rbp)
+    movq    -48(%rbp), %rax
+    movq    %rax, __xly_globals+56(%rip)
+    leaq    .Lxly_str_aa654f6227afcaa3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -56(%rbp)
+    subq    $16, %rsp
+    movq    -56(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_94a60f33a652b9a7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_65fda91ddbd822ed(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_1c53b67fba001158(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k208(%rip), %rax
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ba42648808567d3e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_567fde1b8885bf64(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+64(%rip)
+    leaq    .Lxly_str_55ddca1b87fcef18(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+72(%rip)
+    leaq    .Lxly_str_ff06d33875097bda(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+80(%rip)
+    leaq    .Lxly_str_a4d36579c4c3c3a3(%rip), %rdi
+    call    xly_str
+    movq    %rax, -64(%rbp)
+    subq    $16, %rsp
+    movq    -64(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_83a0ed318bada079(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r13, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_5c4ea3ff6a094645(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_4db20220682e8c24(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b6:
+    leaq    .Lxly_str_234e9aa2c89b833d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b5:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b8:
+    leaq    .Lxly_str_2ba0e67d9416fe2d(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+.Lxly_ir0_b7:
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_1d512a989207fcb2(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x401921f9f01b866e, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k209(%rip), %rax
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+88(%rip)
+    movabsq $0x3f50624dd2f1a9fc, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir0_k210(%rip), %rax
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+96(%rip)
+    movabsq $0x3fe0000000000000, %rax
+    movq    %rax, %r12
+    leaq    .Lxly_ir0_k211(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+104(%rip)
+    leaq    .Lxly_str_227284090e3a7bd1(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k212(%rip), %rax
+    movq    %rax, -72(%rbp)
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    -72(%rbp), %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_ffcc6008fa9a21fd(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k213(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_b1006a0c419199f8(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k214(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_715afd0b8cc254ef(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    leaq    .Lxly_ir0_k215(%rip), %rax
+    movq    %rax, %r15
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_85ef91d249559d8b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_9224fde07c59fc71(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+112(%rip)
+    leaq    .Lxly_str_7d9e1cf7fc964bbf(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+120(%rip)
+    leaq    .Lxly_str_0e473f0be4bc4069(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+128(%rip)
+    leaq    .Lxly_str_25aebbff6d372bc7(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+136(%rip)
+    leaq    .Lxly_str_4737c4067987bc78(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_0b9e1c8defcee17c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_feff073875020288(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+144(%rip)
+    leaq    .Lxly_str_feff05387501ff22(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+152(%rip)
+    leaq    .Lxly_str_feff04387501fd6f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+160(%rip)
+    leaq    .Lxly_str_d40c5d68675db129(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8cf92cd95169892a(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_8dfb933b2b4ec439(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_ee808e606a58da92(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_63f0bfacf2c00f6b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+168(%rip)
+    leaq    .Lxly_str_3d262481d7d5eaa3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+176(%rip)
+    leaq    .Lxly_str_8c0ef3aed579cbff(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r15
+    movq    %r15, %rax
+    movq    %rax, __xly_globals+184(%rip)
+    leaq    .Lxly_str_7306b4a71c439dbe(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rax
+    movq    %rax, __xly_globals+192(%rip)
+    leaq    .Lxly_str_4da7a88146d2272b(%rip), %rdi
+    call    xly_str
+    movq    %rax, -80(%rbp)
+    subq    $16, %rsp
+    movq    -80(%rbp), %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_f574cb718a6555be(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_0cb93bd5dcbabb6c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r15, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_26625847e1645541(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_2b57a36b6a232970(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+200(%rip)
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+208(%rip)
+    leaq    .Lxly_str_a430d84680aabd0b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+216(%rip)
+    leaq    .Lxly_str_c91b7b16a3e8440e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    leaq    .Lxly_str_accddcdbfda55b5f(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_60aaa7353188fa5b(%rip), %rdi
+    call    xly_str
+    movq    %rax, %rbx
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movabsq $0x0, %rax
+    movq    %rax, %rbx
+    leaq    .Lxly_ir0_k216(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    leaq    .Lxly_ir0_k217(%rip), %rax
+    movq    %rax, %r13
+    movq    %r13, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    movabsq $0x4014000000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_str_2c019581f677be9e(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movabsq $0x3ff0000000000000, %rax
+    movq    %rax, %r15
+    movq    %rbx, %r14
+.Lxly_ir0_b1:
+    movq    %r14, %xmm0
+    movq    %r13, %xmm1
+    ucomisd %xmm0, %xmm1
+    seta    %al
+    movzbl  %al, %eax
+    movq    %rax, %rbx
+    cmpq    $0, %rbx
+    je      .Lxly_ir0_b4
+.Lxly_ir0_b2:
+    movq    %r14, %xmm0
+    movq    %r15, %xmm1
+    addsd   %xmm1, %xmm0
+    movq    %xmm0, %rax
+    movq    %rax, %rbx
+    movq    %rbx, %xmm0
+    movsd   %xmm0, -208(%rbp)
+    leaq    -216(%rbp), %rax
+    movq    %rax, %r14
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r14, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdi
+    movl    $2, %esi
+    call    xly_print
+    addq    $16, %rsp
+.Lxly_ir0_b3:
+    movq    %rbx, %xmm0
+    call    xly_num
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+224(%rip)
+    movq    %rbx, %r14
+    jmp     .Lxly_ir0_b1
+.Lxly_ir0_b4:
+    movq    %rsp, %rdi
+    movl    $0, %esi
+    call    xly_print
+    leaq    .Lxly_str_b0fdd6a85adbc9e3(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir0_k207:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k208:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k209:
+    .quad   0, 0x401921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k210:
+    .quad   0, 0x3f50624dd2f1a9fc, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k211:
+    .quad   0, 0x3fe0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k212:
+    .quad   0, 0x400921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k213:
+    .quad   0, 0x401921f9f01b866e, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k214:
+    .quad   0, 0x3f50624dd2f1a9fc, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k215:
+    .quad   0, 0x3fe0000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k216:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir0_k217:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn_greet世界:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $160, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, %rbx
+    xorl    %eax, %eax
+    movq    %rax, -160(%rbp)
+    movq    %rax, -152(%rbp)
+    movq    %rax, -144(%rbp)
+    movq    %rax, -136(%rbp)
+    movq    %rax, -128(%rbp)
+    movq    %rax, -120(%rbp)
+    movq    %rax, -112(%rbp)
+    movq    %rax, -104(%rbp)
+    movq    %rax, -96(%rbp)
+    movq    %rax, -88(%rbp)
+    movq    %rax, -80(%rbp)
+    movq    %rax, -72(%rbp)
+    movq    %rax, -64(%rbp)
+    movq    %rax, -56(%rbp)
+    movq    %rax, -48(%rbp)
+    movq    %rax, -40(%rbp)
+    movl    $-1, -124(%rbp)
+    leaq    .Lxly_str_e1a084da155d2787(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r12, %rdi
+    movq    %rbx, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_1
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_1
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    movsd   %xmm0, -152(%rbp)
+    leaq    -160(%rbp), %rax
+    jmp     .Lxly_f0_2
+.Lxly_f0_1:
+    call    xly_add
+.Lxly_f0_2:
+    movq    %rax, %r13
+    leaq    .Lxly_str_cd8ef1870c5b13c9(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r12
+    movq    %r13, %rdi
+    movq    %r12, %rsi
+    cmpl    $0, (%rdi)
+    jne     .Lxly_f0_3
+    cmpl    $0, (%rsi)
+    jne     .Lxly_f0_3
+    movsd   8(%rdi), %xmm0
+    addsd   8(%rsi), %xmm0
+    call    xly_num
+    jmp     .Lxly_f0_4
+.Lxly_f0_3:
+    call    xly_add
+.Lxly_f0_4:
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   0
+.Lxly_atoms:
+
+.section .rodata
+.Lxly_str_d48b373856e52d86:
+    .asciz  "=== Unicode Native Compiler Test ==="
+.Lxly_str_bc4883fb5bcc0af5:
+    .asciz  "1. UTF-8 String Literals:"
+.Lxly_str_64010ff0f3522ea2:
+    .asciz  "Hello, \344\270\226\347\225\214! \360\237\214\215"
+.Lxly_str_0be0960ba3c75ae1:
+    .asciz  "\360\237\230\200 \360\237\230\216 \360\237\232\200 \360\237\216\211 \342\255\220"
+.Lxly_str_281e79c45552e6f0:
+    .asciz  "English, Espa\303\261ol, \344\270\255\346\226\207, \346\227\245\346\234\254\350\252\236, \330\247\331\204\330\271\330\261\330\250\331\212\330\251, \320\240\321\203\321\201\321\201\320\272\320\270\320\271"
+.Lxly_str_07c5a807b48ed46d:
+    .asciz  "  "
+.Lxly_str_df8aa5ce4da7d574:
+    .asciz  "2. Unicode Identifiers:"
+.Lxly_str_9a5c8b71ac372c89:
+    .asciz  "Hello in Chinese"
+.Lxly_str_740e87fae57a21df:
+    .asciz  "Hello in Russian"
+.Lxly_str_4c4deae25c2b798e:
+    .asciz  "Hello in Arabic"
+.Lxly_str_8316fe943672c769:
+    .asciz  "Hello in Japanese"
+.Lxly_str_aa654f6227afcaa3:
+    .asciz  "  \344\275\240\345\245\275:"
+.Lxly_str_94a60f33a652b9a7:
+    .asciz  "  \320\277\321\200\320\270\320\262\320\265\321\202:"
+.Lxly_str_65fda91ddbd822ed:
+    .asciz  "  \343\201\223\343\202\223\343\201\253\343\201\241\343\201\257:"
+.Lxly_str_1c53b67fba001158:
+    .asciz  "  \317\200:"
+.Lxly_str_ba42648808567d3e:
+    .asciz  "3. Unicode Escape Sequences:"
+.Lxly_str_567fde1b8885bf64:
+    .asciz  "\342\235\244"
+.Lxly_str_55ddca1b87fcef18:
+    .asciz  "\342\255\220"
+.Lxly_str_ff06d33875097bda:
+    .asciz  "\360\237\232\200"
+.Lxly_str_a4d36579c4c3c3a3:
+    .asciz  "  Heart:"
+.Lxly_str_83a0ed318bada079:
+    .asciz  "  Star:"
+.Lxly_str_5c4ea3ff6a094645:
+    .asciz  "  Rocket:"
+.Lxly_str_4db20220682e8c24:
+    .asciz  "4. Unicode in Functions:"
+.Lxly_str_234e9aa2c89b833d:
+    .asciz  "\344\275\240\345\245\275, Alice! \360\237\221\213"
+.Lxly_str_2ba0e67d9416fe2d:
+    .asciz  "\344\275\240\345\245\275, \344\270\226\347\225\214! \360\237\221\213"
+.Lxly_str_1d512a989207fcb2:
+    .asciz  "5. Mathematical Notation:"
+.Lxly_str_227284090e3a7bd1:
+    .asciz  "  \317\200 ="
+.Lxly_str_ffcc6008fa9a21fd:
+    .asciz  "  \317\204 ="
+.Lxly_str_b1006a0c419199f8:
+    .asciz  "  \316\224 ="
+.Lxly_str_715afd0b8cc254ef:
+    .asciz  "  \316\261 ="
+.Lxly_str_85ef91d249559d8b:
+    .asciz  "6. Unicode String Concatenation:"
+.Lxly_str_9224fde07c59fc71:
+    .asciz  "Hello "
+.Lxly_str_7d9e1cf7fc964bbf:
+    .asciz  "\344\270\226\347\225\214"
+.Lxly_str_0e473f0be4bc4069:
+    .asciz  " \360\237\214\215"
+.Lxly_str_25aebbff6d372bc7:
+    .asciz  "Hello \344\270\226\347\225\214 \360\237\214\215"
+.Lxly_str_4737c4067987bc78:
+    .asciz  "  Combined:"
+.Lxly_str_0b9e1c8defcee17c:
+    .asciz  "7. Emoji in Expressions:"
+.Lxly_str_feff073875020288:
+    .asciz  "\360\237\230\200"
+.Lxly_str_feff05387501ff22:
+    .asciz  "\360\237\230\216"
+.Lxly_str_feff04387501fd6f:
+    .asciz  "\360\237\230\215"
+.Lxly_str_d40c5d68675db129:
+    .asciz  "  Happy:"
+.Lxly_str_8cf92cd95169892a:
+    .asciz  "  Cool:"
+.Lxly_str_8dfb933b2b4ec439:
+    .asciz  "  Love:"
+.Lxly_str_ee808e606a58da92:
+    .asciz  "8. Mixed Scripts:"
+.Lxly_str_63f0bfacf2c00f6b:
+    .asciz  "Hello"
+.Lxly_str_3d262481d7d5eaa3:
+    .asciz  "\344\275\240\345\245\275"
+.Lxly_str_8c0ef3aed579cbff:
+    .asciz  "\320\237\321\200\320\270\320\262\320\265\321\202"
+.Lxly_str_7306b4a71c439dbe:
+    .asciz  "\331\205\330\261\330\255\330\250\330\247"
+.Lxly_str_4da7a88146d2272b:
+    .asciz  "  English:"
+.Lxly_str_f574cb718a6555be:
+    .asciz  "  Chinese:"
+.Lxly_str_0cb93bd5dcbabb6c:
+    .asciz  "  Russian:"
+.Lxly_str_26625847e1645541:
+    .asciz  "  Arabic:"
+.Lxly_str_2b57a36b6a232970:
+    .asciz  "9. Unicode in Comparisons:"
+.Lxly_str_a430d84680aabd0b:
+    .asciz  "hello"
+.Lxly_str_c91b7b16a3e8440e:
+    .asciz  "  \342\234\223 Unicode equality works!"
+.Lxly_str_accddcdbfda55b5f:
+    .asciz  "  \342\234\223 Unicode inequality works!"
+.Lxly_str_60aaa7353188fa5b:
+    .asciz  "10. Unicode in Loops:"
+.Lxly_str_2c019581f677be9e:
+    .asciz  "  Loop iteration:"
+.Lxly_str_b0fdd6a85adbc9e3:
+    .asciz  "\342\234\205 Native compiler Unicode support works!"
+.Lxly_str_e1a084da155d2787:
+    .asciz  "\344\275\240\345\245\275, "
+.Lxly_str_cd8ef1870c5b13c9:
+    .asciz  "! \360\237\221\213"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   29
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   232
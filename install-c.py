@@ -71,7 +71,6 @@ RT_NOMP_SRCS = [
 RTC_SRCS = [
     "src/xly_rt.c",
     "src/unicode.c",
-    "src/xly_rt_compiler_stub.c",
 ]
 
 # ── Environment variables ─────────────────────────────────────────────────────
@@ -213,6 +212,10 @@ def build_runtime(cc, cflags):
 def build_compiler_runtime(cc, cflags):
     print(f"==> Building compiler runtime library: {RTC_LIB}")
     rtc_objs = compile_objs(RTC_SRCS, cc, cflags)
+    # modules.c with only math and string: the natives math.* / string.* bind to
+    compile_obj("src/modules.c", "src/modules_core_rt.o", cc, cflags,
+                extra=["-DXENLY_NO_MULTIPROC", "-DXENLY_CORE_MODULES"])
+    rtc_objs.append("src/modules_core_rt.o")
     print("Creating compiler runtime library...")
     run(["ar", "rcs", RTC_LIB] + rtc_objs)
     print(f"  Compiler runtime: {RTC_LIB}")
@@ -149,6 +149,10 @@ struct Param {
     int is_optional;        // flag: parameter can be omitted
 };
 
+// ─── Function marks (ASTNode.fn_flags) ──────────────────────────────────────
+#define AST_FN_PURE  1      // result depends only on the arguments, no effects
+#define AST_FN_MEMO  2      // pure and calls itself more than once: memoizable
+
 // ─── AST Node ────────────────────────────────────────────────────────────────
 struct ASTNode {
     NodeType type;
@@ -186,6 +190,9 @@ struct ASTNode {
     ASTNode **invariants;          // class invariants
     size_t   invariant_count;
 
+    // Function declarations: AST_FN_* marks set by ast_optimize() (astopt.h)
+    int      fn_flags;
+
     // Compound assign operator type (stored as string: "+=", "-=", etc.)
     // reuses str_value
 };
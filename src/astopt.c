@@ -0,0 +1,660 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * astopt.c — AST optimization pass (see astopt.h)
+ *
+ * Three walks over the program:
+ *   1. count how often every name is bound (declared, assigned, a parameter,
+ *      a pattern or import binding) — a const is only propagated, and a
+ *      function only analysed, when its name is bound exactly once
+ *   2. top-level statements in order, each bottom-up: substitute known
+ *      consts, fold, prune; a const whose initializer folded to a literal is
+ *      known from the next statement on
+ *   3. purity of the top-level functions, to a fixed point over the calls
+ *      between them
+ *
+ * Folding follows eval() (interpreter.c) and xly_rt.c: numbers print with
+ * %lld when integral and below 1e15 and with %g otherwise, `==` on
+ * different types is false, and/or yield one of their operands.  Where the
+ * two disagree (x / 0, `%` on fractions) or the result would not be a
+ * finite literal, the expression is left alone.
+ */
+
+#include "astopt.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* M_PI / M_E are not in strict C11; same values as modules.c gets */
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#ifndef M_E
+#define M_E  2.7182818284590452354
+#endif
+
+/* ── name table ─────────────────────────────────────────────────────────── */
+typedef struct {
+    char    *name;
+    int      binds;         /* times the name is bound anywhere            */
+    ASTNode *value;         /* const literal (owned), once known           */
+    int      fn;            /* index into Opt.fns, -1 if none              */
+} OptName;
+
+typedef struct {
+    OptName *slots;
+    size_t   cap, count;
+} OptNames;
+
+typedef struct {
+    ASTNode *decl;
+    int      ok;            /* body is pure, calls aside                   */
+    int      self_calls;
+    int     *callees;
+    int      ncallees;
+} OptFn;
+
+typedef struct {
+    OptNames    names;
+    OptFn      *fns;
+    int         nfns;
+    int         wildcard;   /* `import * from`: any name may be rebound    */
+    int         math_ok;    /* `import "math"` seen, `math` bound once     */
+    AstOptStats st;
+} Opt;
+
+static unsigned long long name_hash(const char *s) {
+    unsigned long long h = 0xcbf29ce484222325ULL;
+    for (; *s; s++) { h ^= (unsigned char)*s; h *= 0x100000001b3ULL; }
+    return h;
+}
+
+static OptName *names_find(OptNames *t, const char *name, int add) {
+    if (!name) return NULL;
+    if (add && (t->count + 1) * 2 > t->cap) {
+        OptNames g = { NULL, t->cap ? t->cap * 2 : 64, 0 };
+        g.slots = (OptName *)calloc(g.cap, sizeof(OptName));
+        for (size_t i = 0; i < t->cap; i++) {
+            if (!t->slots[i].name) continue;
+            size_t j = (size_t)name_hash(t->slots[i].name) & (g.cap - 1);
+            while (g.slots[j].name) j = (j + 1) & (g.cap - 1);
+            g.slots[j] = t->slots[i];
+            g.count++;
+        }
+        free(t->slots);
+        *t = g;
+    }
+    if (!t->cap) return NULL;
+    size_t i = (size_t)name_hash(name) & (t->cap - 1);
+    while (t->slots[i].name) {
+        if (strcmp(t->slots[i].name, name) == 0) return &t->slots[i];
+        i = (i + 1) & (t->cap - 1);
+    }
+    if (!add) return NULL;
+    t->slots[i].name = strdup(name);
+    t->slots[i].fn   = -1;
+    t->count++;
+    return &t->slots[i];
+}
+
+static int name_binds(Opt *o, const char *name) {
+    OptName *e = names_find(&o->names, name, 0);
+    return e ? e->binds : 0;
+}
+
+static void bind(Opt *o, const char *name) {
+    OptName *e = names_find(&o->names, name, 1);
+    if (e) e->binds++;
+}
+
+/* "lib/util.xe" → "util": the global a regular import binds */
+static void import_name(const char *path, char *out, size_t cap) {
+    const char *b = strrchr(path, '/');
+    b = b ? b + 1 : path;
+    size_t n = strcspn(b, ".");
+    if (n >= cap) n = cap - 1;
+    memcpy(out, b, n);
+    out[n] = '\0';
+}
+
+/* ── 1. bindings ────────────────────────────────────────────────────────── */
+static void count_binds(Opt *o, ASTNode *n) {
+    if (!n) return;
+    switch (n->type) {
+        case NODE_VAR_DECL: case NODE_LET_DECL: case NODE_CONST_DECL:
+        case NODE_FN_DECL:  case NODE_GEN_DECL: case NODE_CLASS_DECL:
+        case NODE_ENUM_DECL: case NODE_ENUM_VARIANT:
+        case NODE_FOR_IN:   case NODE_FOR_OF:
+        case NODE_ASSIGN:   case NODE_INCREMENT: case NODE_DECREMENT:
+        case NODE_NAMESPACE: case NODE_TYPE_ALIAS:
+            bind(o, n->str_value);
+            break;
+        case NODE_COMPOUND_ASSIGN:
+            if (n->child_count) bind(o, n->children[0]->str_value);
+            break;
+        case NODE_PATTERN:
+            if (n->bool_value == 0) bind(o, n->str_value);
+            break;
+        case NODE_WHERE:
+            for (size_t i = 1; i < n->child_count; i++)
+                if (n->children[i]) bind(o, n->children[i]->str_value);
+            break;
+        case NODE_IMPORT:
+            if ((int)n->num_value == 3) o->wildcard = 1;
+            if ((int)n->num_value == 0 && n->str_value) {
+                char mod[256];
+                import_name(n->str_value, mod, sizeof(mod));
+                bind(o, mod);
+            }
+            for (size_t i = 0; i < n->child_count; i++)
+                if (n->children[i]) bind(o, n->children[i]->str_value);
+            return;
+        default: break;
+    }
+    for (size_t i = 0; i < n->param_count; i++) {
+        bind(o, n->params[i].name);
+        count_binds(o, n->params[i].default_value);
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        count_binds(o, n->children[i]);
+}
+
+/* ── literals ───────────────────────────────────────────────────────────── */
+static int is_lit(const ASTNode *n) {
+    return n && (n->type == NODE_NUMBER || n->type == NODE_STRING ||
+                 n->type == NODE_BOOL   || n->type == NODE_NULL);
+}
+
+static int lit_truthy(const ASTNode *n) {
+    switch (n->type) {
+        case NODE_NUMBER: return n->num_value != 0.0;
+        case NODE_STRING: return n->str_value && n->str_value[0] != '\0';
+        case NODE_BOOL:   return n->bool_value;
+        default:          return 0;
+    }
+}
+
+static char *lit_to_str(const ASTNode *n) {
+    char buf[64];
+    switch (n->type) {
+        case NODE_NUMBER:
+            if (n->num_value == (double)(long long)n->num_value && fabs(n->num_value) < 1e15)
+                snprintf(buf, sizeof(buf), "%lld", (long long)n->num_value);
+            else
+                snprintf(buf, sizeof(buf), "%g", n->num_value);
+            return strdup(buf);
+        case NODE_STRING: return strdup(n->str_value ? n->str_value : "");
+        case NODE_BOOL:   return strdup(n->bool_value ? "true" : "false");
+        default:          return strdup("null");
+    }
+}
+
+static ASTNode *lit_copy(const ASTNode *n, int line) {
+    ASTNode *c = ast_node_create(n->type, line);
+    c->num_value  = n->num_value;
+    c->bool_value = n->bool_value;
+    if (n->str_value) c->str_value = strdup(n->str_value);
+    return c;
+}
+
+/* Replace *slot by `with`, freeing what it held. */
+static void replace(ASTNode **slot, ASTNode *with) {
+    ASTNode *old = *slot;
+    *slot = with;
+    ast_node_destroy(old);
+}
+
+/* Replace *slot by its i-th child. */
+static void replace_by_child(ASTNode **slot, size_t i) {
+    ASTNode *keep = (*slot)->children[i];
+    (*slot)->children[i] = NULL;
+    replace(slot, keep);
+}
+
+/* Replace *slot by a number / bool literal and count it in *stat. */
+static void set_num(int *stat, ASTNode **slot, double v) {
+    ASTNode *n = ast_node_create(NODE_NUMBER, (*slot)->line);
+    n->num_value = v;
+    replace(slot, n);
+    (*stat)++;
+}
+
+static void set_bool(int *stat, ASTNode **slot, int v) {
+    ASTNode *n = ast_node_create(NODE_BOOL, (*slot)->line);
+    n->bool_value = v ? 1 : 0;
+    replace(slot, n);
+    (*stat)++;
+}
+
+/* ── 2. folding ─────────────────────────────────────────────────────────── */
+static int lit_equal(const ASTNode *a, const ASTNode *b) {
+    if (a->type != b->type) return 0;
+    switch (a->type) {
+        case NODE_NUMBER: return a->num_value == b->num_value;
+        case NODE_STRING: return strcmp(a->str_value ? a->str_value : "",
+                                        b->str_value ? b->str_value : "") == 0;
+        case NODE_BOOL:   return a->bool_value == b->bool_value;
+        default:          return 1;
+    }
+}
+
+static int is_exact_int(double v) {
+    return v == trunc(v) && fabs(v) < 9007199254740992.0;   /* 2^53 */
+}
+
+static void fold_binary(Opt *o, ASTNode **slot) {
+    ASTNode *n = *slot;
+    if (n->child_count != 2 || !n->str_value) return;
+    ASTNode *l = n->children[0], *r = n->children[1];
+    const char *op = n->str_value;
+
+    if ((strcmp(op, "and") == 0 || strcmp(op, "or") == 0) && is_lit(l)) {
+        int take_left = lit_truthy(l) ? (op[0] == 'o') : (op[0] == 'a');
+        replace_by_child(slot, take_left ? 0 : 1);
+        o->st.folded++;
+        return;
+    }
+    if (!is_lit(l) || !is_lit(r)) return;
+
+    if (strcmp(op, "==") == 0) { set_bool(&o->st.folded, slot,  lit_equal(l, r)); return; }
+    if (strcmp(op, "!=") == 0) { set_bool(&o->st.folded, slot, !lit_equal(l, r)); return; }
+
+    if (strcmp(op, "+") == 0 && (l->type == NODE_STRING || r->type == NODE_STRING)) {
+        if (l->type == NODE_NULL || r->type == NODE_NULL) return;
+        char *ls = lit_to_str(l), *rs = lit_to_str(r);
+        size_t ll = strlen(ls), rl = strlen(rs);
+        ASTNode *s = ast_node_create(NODE_STRING, n->line);
+        s->str_value = (char *)malloc(ll + rl + 1);
+        memcpy(s->str_value, ls, ll);
+        memcpy(s->str_value + ll, rs, rl + 1);
+        free(ls); free(rs);
+        replace(slot, s);
+        o->st.folded++;
+        return;
+    }
+
+    if (l->type != NODE_NUMBER || r->type != NODE_NUMBER) return;
+    double a = l->num_value, b = r->num_value, v;
+    if      (strcmp(op, "<")  == 0) { set_bool(&o->st.folded, slot, a <  b); return; }
+    else if (strcmp(op, ">")  == 0) { set_bool(&o->st.folded, slot, a >  b); return; }
+    else if (strcmp(op, "<=") == 0) { set_bool(&o->st.folded, slot, a <= b); return; }
+    else if (strcmp(op, ">=") == 0) { set_bool(&o->st.folded, slot, a >= b); return; }
+    else if (strcmp(op, "+")  == 0) v = a + b;
+    else if (strcmp(op, "-")  == 0) v = a - b;
+    else if (strcmp(op, "*")  == 0) v = a * b;
+    else if (strcmp(op, "/")  == 0) {
+        if (b == 0.0) return;               /* error at run time vs NaN/inf */
+        v = a / b;
+    }
+    else if (strcmp(op, "%")  == 0) {
+        /* eval() takes integer remainders, compiled code fmod() */
+        if (b == 0.0 || !is_exact_int(a) || !is_exact_int(b)) return;
+        v = fmod(a, b);
+        if (v == 0.0 && a < 0) return;      /* -0 vs 0 */
+    }
+    else return;
+    if (!isfinite(v)) return;
+    set_num(&o->st.folded, slot, v);
+}
+
+static void fold_unary(Opt *o, ASTNode **slot) {
+    ASTNode *n = *slot;
+    if (n->child_count != 1 || !n->str_value || !is_lit(n->children[0])) return;
+    ASTNode *x = n->children[0];
+    if (strcmp(n->str_value, "-") == 0 && x->type == NODE_NUMBER)
+        set_num(&o->st.folded, slot, -x->num_value);
+    else if (strcmp(n->str_value, "not") == 0)
+        set_bool(&o->st.folded, slot, !lit_truthy(x));
+}
+
+/* math.<name>(args) with literal number args — the functions of the math
+ * module (modules.c) that only compute from their arguments. */
+static int math_eval(const char *f, size_t argc, const double *a, double *out, int *is_bool) {
+    *is_bool = 0;
+#define M1(nm, expr) if (strcmp(f, nm) == 0) { if (argc != 1) return 0; *out = (expr); return 1; }
+#define M2(nm, expr) if (strcmp(f, nm) == 0) { if (argc != 2) return 0; *out = (expr); return 1; }
+    M1("abs",   fabs(a[0]))   M1("sqrt",  sqrt(a[0]))   M1("floor", floor(a[0]))
+    M1("ceil",  ceil(a[0]))   M1("round", round(a[0]))  M1("trunc", trunc(a[0]))
+    M1("sin",   sin(a[0]))    M1("cos",   cos(a[0]))    M1("tan",   tan(a[0]))
+    M1("asin",  asin(a[0]))   M1("acos",  acos(a[0]))   M1("atan",  atan(a[0]))
+    M1("log",   log(a[0]))    M1("log2",  log2(a[0]))   M1("log10", log10(a[0]))
+    M1("exp",   exp(a[0]))    M1("cbrt",  cbrt(a[0]))
+    M1("sign",  a[0] > 0 ? 1.0 : (a[0] < 0 ? -1.0 : 0.0))
+    M2("pow",   pow(a[0], a[1]))    M2("atan2", atan2(a[0], a[1]))
+    M2("fmod",  fmod(a[0], a[1]))   M2("hypot", hypot(a[0], a[1]))
+    M2("max",   a[0] > a[1] ? a[0] : a[1])
+    M2("min",   a[0] < a[1] ? a[0] : a[1])
+#undef M1
+#undef M2
+    if (strcmp(f, "clamp") == 0) {
+        if (argc != 3) return 0;
+        double v = a[0];
+        if (v < a[1]) v = a[1];
+        if (v > a[2]) v = a[2];
+        *out = v;
+        return 1;
+    }
+    if (strcmp(f, "PI") == 0 && argc == 0) { *out = M_PI; return 1; }
+    if (strcmp(f, "E")  == 0 && argc == 0) { *out = M_E;  return 1; }
+    if (argc == 1 && (strcmp(f, "isNaN") == 0 || strcmp(f, "isInf") == 0 ||
+                      strcmp(f, "isFinite") == 0)) {
+        *is_bool = 1;
+        *out = f[2] == 'N' ? isnan(a[0]) : f[2] == 'I' ? isinf(a[0]) : isfinite(a[0]);
+        return 1;
+    }
+    return 0;
+}
+
+static int is_math_call(const Opt *o, const ASTNode *n) {
+    return o->math_ok && n->type == NODE_METHOD_CALL && n->child_count >= 1 &&
+           n->children[0] && n->children[0]->type == NODE_IDENTIFIER &&
+           n->children[0]->str_value && strcmp(n->children[0]->str_value, "math") == 0 &&
+           n->str_value;
+}
+
+static void fold_math(Opt *o, ASTNode **slot) {
+    ASTNode *n = *slot;
+    if (!is_math_call(o, n)) return;
+    size_t argc = n->child_count - 1;
+    double a[3];
+    if (argc > 3) return;
+    for (size_t i = 0; i < argc; i++) {
+        if (!n->children[i + 1] || n->children[i + 1]->type != NODE_NUMBER) return;
+        a[i] = n->children[i + 1]->num_value;
+    }
+    double v;
+    int is_bool;
+    if (!math_eval(n->str_value, argc, a, &v, &is_bool)) return;
+    if (is_bool)          set_bool(&o->st.math_calls, slot, v != 0.0);
+    else if (isfinite(v)) set_num(&o->st.math_calls, slot, v);
+}
+
+/* Declarations codegen may hoist: never pruned, even where unreachable. */
+static int has_decl(const ASTNode *n) {
+    if (!n) return 0;
+    switch (n->type) {
+        case NODE_FN_DECL: case NODE_GEN_DECL: case NODE_CLASS_DECL:
+        case NODE_ENUM_DECL: case NODE_IMPORT: case NODE_EXPORT:
+            return 1;
+        default: break;
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        if (has_decl(n->children[i])) return 1;
+    return 0;
+}
+
+static void set_empty(Opt *o, ASTNode **slot) {
+    replace(slot, ast_node_create(NODE_BLOCK, (*slot)->line));
+    o->st.branches++;
+}
+
+static void prune(Opt *o, ASTNode **slot) {
+    ASTNode *n = *slot;
+    if (n->child_count < 2 || !is_lit(n->children[0])) return;
+    int truthy = lit_truthy(n->children[0]);
+    switch (n->type) {
+        case NODE_IF: {
+            size_t keep = truthy ? 1 : 2;
+            for (size_t i = 1; i < n->child_count; i++)
+                if (i != keep && has_decl(n->children[i])) return;
+            if (keep < n->child_count && n->children[keep]) {
+                replace_by_child(slot, keep);
+                o->st.branches++;
+            } else {
+                set_empty(o, slot);
+            }
+            break;
+        }
+        case NODE_UNLESS:
+            /* unless always yields null: only the never-run case is pruned */
+            if (truthy && !has_decl(n->children[1])) set_empty(o, slot);
+            break;
+        case NODE_WHILE:
+            if (!truthy && !has_decl(n->children[1])) set_empty(o, slot);
+            break;
+        default: break;
+    }
+}
+
+/* Whether child i of n is read as a value (a const may stand in for it). */
+static int reads_child(const ASTNode *n, size_t i) {
+    switch (n->type) {
+        case NODE_BINARY: case NODE_UNARY: case NODE_TERNARY: case NODE_PRINT:
+        case NODE_RETURN: case NODE_EXPR_STMT: case NODE_ARRAY_LITERAL:
+        case NODE_INDEX:  case NODE_TYPEOF: case NODE_NULLISH: case NODE_FN_CALL:
+        case NODE_ASSERT:
+            return 1;
+        case NODE_NAMED_ARG: case NODE_VAR_DECL: case NODE_LET_DECL:
+        case NODE_CONST_DECL: case NODE_ASSIGN:
+        case NODE_IF: case NODE_WHILE: case NODE_UNLESS: case NODE_REPEAT:
+            return i == 0;
+        case NODE_COMPOUND_ASSIGN: case NODE_DO_WHILE: case NODE_FOR:
+            return i == 1;
+        case NODE_METHOD_CALL: case NODE_INDEX_ASSIGN:
+            return i >= 1;
+        default:
+            return 0;
+    }
+}
+
+static void subst_const(Opt *o, ASTNode **slot) {
+    if (o->wildcard) return;
+    OptName *e = names_find(&o->names, (*slot)->str_value, 0);
+    if (!e || !e->value || e->binds != 1) return;
+    replace(slot, lit_copy(e->value, (*slot)->line));
+    o->st.consts++;
+}
+
+static void opt_node(Opt *o, ASTNode **slot) {
+    ASTNode *n = *slot;
+    if (!n) return;
+    for (size_t i = 0; i < n->child_count; i++) {
+        if (!n->children[i]) continue;
+        if (n->children[i]->type == NODE_IDENTIFIER) {
+            if (reads_child(n, i)) subst_const(o, &n->children[i]);
+        } else {
+            opt_node(o, &n->children[i]);
+        }
+    }
+    switch (n->type) {
+        case NODE_BINARY:      fold_binary(o, slot); break;
+        case NODE_UNARY:       fold_unary(o, slot);  break;
+        case NODE_METHOD_CALL: fold_math(o, slot);   break;
+        case NODE_TERNARY:
+            if (n->child_count == 3 && is_lit(n->children[0])) {
+                replace_by_child(slot, lit_truthy(n->children[0]) ? 1 : 2);
+                o->st.folded++;
+            }
+            break;
+        case NODE_IF: case NODE_UNLESS: case NODE_WHILE:
+            prune(o, slot);
+            break;
+        default: break;
+    }
+}
+
+/* ── 3. purity ──────────────────────────────────────────────────────────── */
+typedef struct {
+    const char **items;
+    size_t count, cap;
+} OptLocals;
+
+static void locals_add(OptLocals *ls, const char *name) {
+    if (!name) return;
+    if (ls->count >= ls->cap) {
+        ls->cap = ls->cap ? ls->cap * 2 : 16;
+        ls->items = (const char **)realloc(ls->items, sizeof(char *) * ls->cap);
+    }
+    ls->items[ls->count++] = name;
+}
+
+static int locals_has(const OptLocals *ls, const char *name) {
+    if (!name) return 0;
+    for (size_t i = 0; i < ls->count; i++)
+        if (strcmp(ls->items[i], name) == 0) return 1;
+    return 0;
+}
+
+/* Every name a function binds itself counts as local for the whole body. */
+static void collect_locals(const ASTNode *n, OptLocals *ls) {
+    if (!n) return;
+    switch (n->type) {
+        case NODE_VAR_DECL: case NODE_CONST_DECL: case NODE_LET_DECL:
+        case NODE_FOR_IN:   case NODE_FOR_OF:
+            locals_add(ls, n->str_value);
+            break;
+        default: break;
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        collect_locals(n->children[i], ls);
+}
+
+static void add_callee(OptFn *f, int callee) {
+    for (int i = 0; i < f->ncallees; i++)
+        if (f->callees[i] == callee) return;
+    f->callees = (int *)realloc(f->callees, sizeof(int) * (size_t)(f->ncallees + 1));
+    f->callees[f->ncallees++] = callee;
+}
+
+static int pure_node(Opt *o, int fi, const OptLocals *ls, const ASTNode *n) {
+    if (!n) return 1;
+    switch (n->type) {
+        case NODE_NUMBER: case NODE_STRING: case NODE_BOOL: case NODE_NULL:
+        case NODE_BREAK:  case NODE_CONTINUE:
+            return 1;
+        case NODE_IDENTIFIER:
+            return locals_has(ls, n->str_value);
+        case NODE_ASSIGN: case NODE_INCREMENT: case NODE_DECREMENT:
+            if (!locals_has(ls, n->str_value)) return 0;
+            break;
+        case NODE_COMPOUND_ASSIGN:
+            if (n->child_count != 2 || !locals_has(ls, n->children[0]->str_value)) return 0;
+            return pure_node(o, fi, ls, n->children[1]);
+        case NODE_FN_CALL: {
+            if (locals_has(ls, n->str_value)) return 0;
+            OptName *e = names_find(&o->names, n->str_value, 0);
+            if (!e || e->fn < 0) return 0;
+            if (e->fn == fi) o->fns[fi].self_calls++;
+            else add_callee(&o->fns[fi], e->fn);
+            break;
+        }
+        case NODE_METHOD_CALL: {
+            /* a math function fold_math knows, called with its arity */
+            double a[3] = { 0, 0, 0 }, out;
+            int is_bool;
+            size_t argc = n->child_count - 1;
+            if (!is_math_call(o, n) || argc > 3 ||
+                !math_eval(n->str_value, argc, a, &out, &is_bool)) return 0;
+            for (size_t i = 1; i < n->child_count; i++)
+                if (!pure_node(o, fi, ls, n->children[i])) return 0;
+            return 1;
+        }
+        case NODE_BINARY: case NODE_UNARY: case NODE_TERNARY: case NODE_NULLISH:
+        case NODE_VAR_DECL: case NODE_LET_DECL: case NODE_CONST_DECL:
+        case NODE_IF: case NODE_UNLESS: case NODE_WHILE: case NODE_FOR:
+        case NODE_DO_WHILE: case NODE_REPEAT: case NODE_BLOCK: case NODE_RETURN:
+        case NODE_EXPR_STMT: case NODE_NAMED_ARG:
+            break;
+        default:
+            return 0;
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        if (!pure_node(o, fi, ls, n->children[i])) return 0;
+    return 1;
+}
+
+static void analyse_purity(Opt *o, ASTNode *program) {
+    for (size_t i = 0; i < program->child_count; i++) {
+        ASTNode *d = program->children[i];
+        if (d && d->type == NODE_EXPORT && d->child_count) d = d->children[0];
+        if (!d || d->type != NODE_FN_DECL || !d->str_value || d->child_count < 1) continue;
+        OptName *e = names_find(&o->names, d->str_value, 0);
+        if (!e || e->binds != 1) continue;
+        o->fns = (OptFn *)realloc(o->fns, sizeof(OptFn) * (size_t)(o->nfns + 1));
+        memset(&o->fns[o->nfns], 0, sizeof(OptFn));
+        o->fns[o->nfns].decl = d;
+        e->fn = o->nfns++;
+    }
+
+    for (int fi = 0; fi < o->nfns; fi++) {
+        OptFn *f = &o->fns[fi];
+        ASTNode *d = f->decl;
+        if (d->num_value != 0 || d->requires_clause || d->ensures_clause) continue;  /* async */
+        OptLocals ls = { NULL, 0, 0 };
+        int ok = 1;
+        for (size_t i = 0; i < d->param_count; i++)
+            locals_add(&ls, d->params[i].name);
+        for (size_t i = 0; i < d->param_count && ok; i++)
+            ok = pure_node(o, fi, &ls, d->params[i].default_value);
+        collect_locals(d->children[0], &ls);
+        if (ok) ok = pure_node(o, fi, &ls, d->children[0]);
+        f->ok = ok;
+        free(ls.items);
+    }
+
+    /* a function is pure when it and everything it calls is */
+    for (int changed = 1; changed; ) {
+        changed = 0;
+        for (int fi = 0; fi < o->nfns; fi++) {
+            OptFn *f = &o->fns[fi];
+            if (!f->ok) continue;
+            for (int k = 0; k < f->ncallees; k++)
+                if (!o->fns[f->callees[k]].ok) { f->ok = 0; changed = 1; break; }
+        }
+    }
+
+    for (int fi = 0; fi < o->nfns; fi++) {
+        OptFn *f = &o->fns[fi];
+        if (!f->ok) continue;
+        f->decl->fn_flags |= AST_FN_PURE;
+        o->st.pure_fns++;
+        if (f->decl->param_count > 0 && f->self_calls >= 2) {
+            f->decl->fn_flags |= AST_FN_MEMO;
+            o->st.memo_fns++;
+        }
+    }
+}
+
+/* ── driver ─────────────────────────────────────────────────────────────── */
+void ast_optimize(ASTNode *program, AstOptStats *stats) {
+    if (!program || program->type != NODE_PROGRAM) return;
+    Opt o;
+    memset(&o, 0, sizeof(o));
+    count_binds(&o, program);
+
+    for (size_t i = 0; i < program->child_count; i++) {
+        opt_node(&o, &program->children[i]);
+        ASTNode *s = program->children[i];
+        if (s && s->type == NODE_EXPORT && s->child_count) s = s->children[0];
+        if (!s) continue;
+        if (s->type == NODE_IMPORT && (int)s->num_value == 0 && s->str_value &&
+            strcmp(s->str_value, "math") == 0 && name_binds(&o, "math") == 1)
+            o.math_ok = 1;
+        if (s->type == NODE_CONST_DECL && s->child_count == 1 && s->children[0] &&
+            (s->children[0]->type == NODE_NUMBER || s->children[0]->type == NODE_STRING ||
+             s->children[0]->type == NODE_BOOL)) {
+            OptName *e = names_find(&o.names, s->str_value, 0);
+            if (e && e->binds == 1 && !e->value)
+                e->value = lit_copy(s->children[0], s->line);
+        }
+    }
+
+    analyse_purity(&o, program);
+
+    for (size_t i = 0; i < o.names.cap; i++) {
+        free(o.names.slots[i].name);
+        ast_node_destroy(o.names.slots[i].value);
+    }
+    free(o.names.slots);
+    for (int i = 0; i < o.nfns; i++) free(o.fns[i].callees);
+    free(o.fns);
+    if (stats) *stats = o.st;
+}
@@ -0,0 +1,48 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * astopt.h — AST optimization pass shared by the interpreter and xenlyc
+ *
+ * Runs once on a parsed (and checked) program, before it is interpreted or
+ * compiled, and rewrites it in place:
+ *
+ *   • folds literal arithmetic, comparisons, string concatenation, not/and/or
+ *     and ternaries — only where eval() and the compiled runtime agree on the
+ *     result (no division by zero, `%` on integers only, finite results)
+ *   • propagates top-level `const` bindings to number, string or bool
+ *     literals into the code after them, when the name is bound nowhere else
+ *   • prunes if / unless / while branches whose condition became a literal
+ *   • folds math.* calls (after `import "math"`) with literal arguments
+ *   • marks top-level functions that only compute from their arguments as
+ *     AST_FN_PURE, and recursive ones that call themselves more than once as
+ *     AST_FN_MEMO (memoization candidates) — see ASTNode.fn_flags
+ *
+ * Output, errors and the values of every expression are unchanged.
+ */
+
+#ifndef ASTOPT_H
+#define ASTOPT_H
+
+#include "ast.h"
+
+typedef struct {
+    int folded;         /* expressions replaced by a literal               */
+    int consts;         /* const references replaced by their value        */
+    int branches;       /* if / unless / while statements pruned           */
+    int math_calls;     /* math.* calls folded                             */
+    int pure_fns;       /* functions marked AST_FN_PURE                    */
+    int memo_fns;       /* functions marked AST_FN_MEMO                    */
+} AstOptStats;
+
+/* ast_optimize — optimize `program` (a NODE_PROGRAM) in place.  stats may
+ * be NULL. */
+void ast_optimize(ASTNode *program, AstOptStats *stats);
+
+#endif /* ASTOPT_H */
@@ -31,15 +31,20 @@
  *   Exprs       BINARY UNARY FN_CALL METHOD_CALL TYPEOF
  *   Stmts       PRINT IF WHILE FOR FOR_IN BREAK CONTINUE RETURN BLOCK
  *   Decls       FN_DECL IMPORT (import is a no-op; modules are linked)
+ *   Classes     CLASS_DECL NEW THIS SUPER_CALL INSTANCEOF (static layouts,
+ *               vtable dispatch; see "SHARED: classes")
  */
 
 #include "codegen.h"
+#include "ir.h"
 #include "platform.h"
 #include <stdio.h>
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdarg.h>
 #include <stdint.h>
+#include <pthread.h>
 
 /*
  * macOS/Mach-O requires a leading underscore on C symbol names in assembly.
@@ -48,11 +53,13 @@
 #if defined(XLY_PLATFORM_MACOS) || defined(PLATFORM_MACOS)
 #  define XLY_SYM(s)  "_" s
 #  define XLY_TEXT_SECTION   ".section __TEXT,__text,regular,pure_instructions"
+#  define XLY_COLD_SECTION   ".section __TEXT,__text_cold,regular,pure_instructions"
 #  define XLY_DATA_SECTION   ".section __TEXT,__cstring,cstring_literals"
 #  define XLY_EMIT_GNU_STACK 0
 #else
 #  define XLY_SYM(s)  s
 #  define XLY_TEXT_SECTION   ".section .text"
+#  define XLY_COLD_SECTION   ".section .text.unlikely,\"ax\",@progbits"
 #  define XLY_DATA_SECTION   ".section .rodata"
 #  define XLY_EMIT_GNU_STACK 1
 #  define XLY_GNU_STACK_SECTION ".section .note.GNU-stack,\"\",@progbits"
@@ -73,16 +80,55 @@
 /* Named type for the rename table entries — used in CG, funcs[], and helpers */
 typedef struct { char *src; char *lbl; } FnRename;
 
+/* collected fn declarations, emitted after main */
+typedef struct {
+    ASTNode *node;
+    char   **captures;   /* names of captured outer variables (NULL if none) */
+    int      ncaptures;
+    char    *asm_label;  /* unique asm label suffix (without .Lxly_fn_ prefix) */
+    /* rename context snapshot: the fn_renames visible when this decl was encountered,
+     * so that when the body is later emitted the same peer/sibling names resolve. */
+    FnRename *rename_ctx;
+    int rename_ctx_count;
+    int num_entry;       /* also emitted as a raw-f64 body (<label>__num) */
+    int cls;             /* classes[] index for a method, else -1    */
+    int recv_twin;       /* funcs[] index of its receiver body, else -1 */
+} CGFunc;
+
+/* interned string literal → .rodata label */
+typedef struct { char *text; char *label; } CGString;
+
+/* name index: open-addressed hash from a name to its positions in one of
+ * the tables below (vars, gvars, strings, fn_names, ...), so a lookup
+ * costs the same in a 100k-line program as in a 100-line one.  The table
+ * stays the truth: a slot is believed only while its position is below
+ * the table's count and the entry there still has the name, so truncating
+ * a table (scope_leave, fn_renames_pop_to, BODY_TAKE) needs no index
+ * update.  A scoped table indexes every entry of a name and a lookup takes
+ * the highest live position, i.e. the innermost one.                    */
+typedef struct {
+    unsigned long long *hash;
+    int                *pos;        /* -1 = empty slot                     */
+    int                 used, cap;  /* cap: a power of two                 */
+} CGIndex;
+
 /* ── codegen state ──────────────────────────────────────────────────────── */
 /* ── Optimization levels ────────────────────────────────────────────────────
  *   0 = -O0: no opts (debug output, most readable asm)
  *   1 = -O1: constant folding + noreturn elision
- *   2 = -O2: + unboxed numeric fast-paths, sys constant inlining  (default)
- *   3 = -O3: + aggressive inlining of single-arg sys calls
+ *   2 = -O2: + unboxed numeric fast-paths, sys constant inlining, function
+ *            inlining, tail calls as jumps, raw-f64 entry points for
+ *            functions annotated `number`  (default)
+ *   3 = -O3: + raw-f64 entry points for every candidate, larger inlining
+ *            limits
  * ─────────────────────────────────────────────────────────────────────────── */
 typedef struct {
     FILE   *out;
     int     label_seq;          /* monotonic label counter                 */
+    int     body_fi;            /* funcs[] index of the body being emitted
+                                 * by emit_bodies, -1 for main            */
+    char    label_pfx[16];      /* "" in main, "f<body_fi>_" in a body: the
+                                 * label_seq labels are unique per body   */
     int     opt_level;          /* optimization level: 0-3                 */
     int     verbose;            /* emit source-level comments in asm       */
     int     noreturn_mode;      /* 1 = we are dead after sys.exit/abort    */
@@ -90,6 +136,7 @@ typedef struct {
     /* variable table: name + rbp-offset + scope-depth */
     struct { char *name; int offset; int depth; } *vars;
     int     var_count, var_cap;
+    CGIndex var_idx;
 
     /* global variable table: top-level vars accessible from any function.
      * These are stored in a fixed-size BSS block (__xly_globals) and
@@ -97,51 +144,99 @@ typedef struct {
      * global_offset[i] = byte offset into __xly_globals for the i-th global. */
     struct { char *name; int index; } *gvars;
     int     gvar_count, gvar_cap;
+    CGIndex gvar_idx;
     int     in_main_scope;  /* 1 while emitting main() top-level statements */
 
     int     scope_depth;
     int     frame_offset;       /* next free slot (negative, grows down)   */
 
     /* interned string literals → .rodata labels */
-    struct { char *text; char *label; } *strings;
+    CGString *strings;
     int     str_count, str_cap;
+    CGIndex str_idx;            /* by label */
+
+    /* property names → .data slots the runtime sets to their atoms at
+     * startup (xly_atoms), passed to xly_obj_get_atom / _set_atom       */
+    CGString *atoms;
+    int     atom_count, atom_cap;
+    CGIndex atom_idx;
+
+    /* --profile-generate (x86-64): the sites counted, key → counter label
+     * (see "SHARED: profile feedback") */
+    int     prof_gen;
+    CGString *prof_sites;
+    int     prof_site_count, prof_site_cap;
+    CGIndex prof_site_idx;
+    int     fn_cold;            /* body being emitted goes to the cold
+                                 * section as a whole                     */
 
     /* break / continue label stacks */
     char   **brk_labels;  int brk_top;
     char   **cnt_labels;  int cnt_top;
 
     /* collected fn declarations, emitted after main */
-    struct {
-        ASTNode *node;
-        char   **captures;   /* names of captured outer variables (NULL if none) */
-        int      ncaptures;
-        char    *asm_label;  /* unique asm label suffix (without .Lxly_fn_ prefix) */
-        /* rename context snapshot: the fn_renames visible when this decl was encountered,
-         * so that when the body is later emitted the same peer/sibling names resolve. */
-        FnRename *rename_ctx;
-        int rename_ctx_count;
-    } *funcs;
+    CGFunc *funcs;
     int     func_count, func_cap;
+    CGIndex func_idx;        /* by asm_label */
+    int     num_planned;     /* ir_plan_num_entries() has run            */
 
     /* set of declared function names (for call-site dispatch) */
     char  **fn_names;
     int     fn_name_count, fn_name_cap;
+    CGIndex fn_name_idx;
 
     /* set of asm labels already claimed for fn bodies (never reset) */
     struct { char *lbl; } *fn_labels_used;
     int fn_labels_used_count, fn_labels_used_cap;
+    CGIndex fn_label_idx;
 
     /* per-scope rename table: source-name → unique asm label
      * Saved/restored around each emit_function call.             */
     FnRename *fn_renames;
     int fn_rename_count, fn_rename_cap;
+    CGIndex fn_rename_idx;
+    int fn_rename_open;      /* rename scopes open (fn_rename_scope_enter) */
+    int fn_rename_floor;     /* count when the outermost one opened      */
 
     /* enum variant name table: tracks variant names and their param counts
      * so NODE_FN_CALL and NODE_IDENTIFIER can emit xly_make_variant calls */
     struct { char *name; int nparams; } *variants;
     int     variant_count, variant_cap;
 
+    /* classes, parents ahead of their subclasses.  Each one becomes an
+     * XlyClass in .data (emit_class_tables): instance fields in slot order
+     * (the parent's first) and one vtable entry per program-wide selector. */
+    struct {
+        char    *name;
+        ASTNode *node;
+        int      parent;     /* classes[] index, -1 for a root class     */
+        char   **fields;
+        int      nfields;
+        int     *vtable;     /* funcs[] index per selector, -1 = none    */
+        int      init_fi;    /* nearest init (own or inherited), -1      */
+    } *classes;
+    int     class_count, class_cap;
+    char  **selectors;       /* method names, index = vtable slot        */
+    int     selector_count, selector_cap;
+    int     cur_cls;         /* class of the body the direct emitters are
+                              * emitting, -1 outside methods            */
+
     int     had_error;
+    ASTNode *program;           /* whole program                           */
+    /* calls by name in the whole program (the inliner's call-site counts),
+     * counted once before any body is emitted (collect_call_sites)     */
+    struct { char *name; int n; } *call_sites;
+    int     call_site_count, call_site_cap;
+    CGIndex call_site_idx;
+
+    /* module units (see "SHARED: module units"): the unit being compiled,
+     * NULL for the program itself; its exported fn names; and the names
+     * `import` statements bound to user modules the driver registered   */
+    const char *unit;
+    char  **exports;
+    int     export_count, export_cap;
+    struct { char *alias; char *path; } *unit_aliases;
+    int     unit_alias_count, unit_alias_cap;
 
     /* ARM64-specific: frame-relative spill tracking (no sp movement) */
     int     a64_spill_depth;    /* current spill nesting level             */
@@ -152,7 +247,14 @@ typedef struct {
     int     stat_const_fold;    /* number of compile-time constant folds   */
     int     stat_noreturn_elim; /* statements skipped after noreturn call  */
     int     stat_sys_inline;    /* sys.CONSTANT() calls inlined            */
+    int     stat_native_calls;  /* math.* / string.* bound to their native */
     int     stat_unboxed_ops;   /* unboxed arithmetic/compare ops emitted  */
+    int     stat_jump_tables;   /* IR switches dispatched through a table  */
+    int     stat_ir_lowered;    /* bodies emitted through the IR           */
+    int     stat_ir_fallback;   /* bodies left to the direct emitters      */
+    int     stat_ir_num_entries;/* raw-f64 entry points                    */
+    int     stat_cold_blocks;   /* blocks moved to the cold section        */
+    int     stat_cold_fns;      /* bodies emitted there whole              */
 } CG;
 
 /* ── emit helpers ───────────────────────────────────────────────────────── */
@@ -164,31 +266,148 @@ static void emit(CG *cg, const char *fmt, ...) {
 }
 
 static int fresh_label(CG *cg, char *buf, size_t sz) {
-    return snprintf(buf, sz, ".Lxly_%d", cg->label_seq++);
+    return snprintf(buf, sz, ".Lxly_%s%d", cg->label_pfx, cg->label_seq++);
 }
 
-/* ── string intern ──────────────────────────────────────────────────────── */
-static const char *intern_string(CG *cg, const char *text) {
-    for (int i = 0; i < cg->str_count; i++)
-        if (strcmp(cg->strings[i].text, text) == 0)
-            return cg->strings[i].label;
-    if (cg->str_count >= cg->str_cap) {
-        cg->str_cap = cg->str_cap ? cg->str_cap * 2 : 32;
-        cg->strings = realloc(cg->strings, sizeof(cg->strings[0]) * (size_t)cg->str_cap);
+/* FNV-1a 64 */
+static unsigned long long str_hash(const char *s) {
+    unsigned long long h = 0xcbf29ce484222325ULL;
+    for (const unsigned char *p = (const unsigned char *)s; *p; p++) {
+        h ^= *p;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* ── name index (see CGIndex) ───────────────────────────────────────────── */
+/* A table as the index sees it: entry i's name is the char * at
+ * base + i*stride + off. */
+typedef struct { const void *base; size_t stride, off; int count; } CGKeys;
+
+#define CG_KEYS(arr, cnt, off) ((CGKeys){ (arr), sizeof((arr)[0]), (off), (cnt) })
+
+static const char *cgkey_at(CGKeys k, int i) {
+    return *(char *const *)((const char *)k.base + (size_t)i * k.stride + k.off);
+}
+
+static void cgidx_put(CGIndex *ix, unsigned long long h, int pos) {
+    int s = (int)(h & (unsigned long long)(ix->cap - 1));
+    while (ix->pos[s] >= 0) s = (s + 1) & (ix->cap - 1);
+    ix->hash[s] = h;
+    ix->pos[s]  = pos;
+    ix->used++;
+}
+
+/* Rebuild from the live entries only, with room for as many again. */
+static void cgidx_rebuild(CGIndex *ix, CGKeys k) {
+    int cap = 64;
+    while (cap < k.count * 4) cap *= 2;
+    free(ix->hash);
+    free(ix->pos);
+    ix->hash = malloc(sizeof(unsigned long long) * (size_t)cap);
+    ix->pos  = malloc(sizeof(int) * (size_t)cap);
+    memset(ix->pos, 0xff, sizeof(int) * (size_t)cap);
+    ix->cap  = cap;
+    ix->used = 0;
+    for (int i = 0; i < k.count; i++) cgidx_put(ix, str_hash(cgkey_at(k, i)), i);
+}
+
+/* Highest live position of `name`, -1 if none. */
+static int cgidx_find(const CGIndex *ix, CGKeys k, const char *name) {
+    if (ix->cap == 0) return -1;
+    unsigned long long h = str_hash(name);
+    int best = -1;
+    for (int s = (int)(h & (unsigned long long)(ix->cap - 1)); ix->pos[s] >= 0;
+         s = (s + 1) & (ix->cap - 1)) {
+        int p = ix->pos[s];
+        if (ix->hash[s] == h && p > best && p < k.count && strcmp(cgkey_at(k, p), name) == 0)
+            best = p;
     }
+    return best;
+}
+
+/* Index entry `pos`, just appended (the table's top).  Slots at or above
+ * it belong to entries since popped and are reused. */
+static void cgidx_add(CGIndex *ix, CGKeys k, int pos) {
+    if ((ix->used + 1) * 2 > ix->cap) { cgidx_rebuild(ix, k); return; }
+    const char *name = cgkey_at(k, pos);
+    unsigned long long h = str_hash(name);
+    int s = (int)(h & (unsigned long long)(ix->cap - 1)), reuse = -1;
+    for (; ix->pos[s] >= 0; s = (s + 1) & (ix->cap - 1)) {
+        if (ix->pos[s] == pos && ix->hash[s] == h && strcmp(cgkey_at(k, pos), name) == 0)
+            return;
+        if (reuse < 0 && ix->pos[s] >= pos) reuse = s;
+    }
+    if (reuse >= 0) { ix->hash[reuse] = h; ix->pos[reuse] = pos; return; }
+    ix->hash[s] = h;
+    ix->pos[s]  = pos;
+    ix->used++;
+}
+
+static void cgidx_copy(CGIndex *dst, const CGIndex *src) {
+    *dst = *src;
+    if (!src->cap) return;
+    dst->hash = malloc(sizeof(unsigned long long) * (size_t)src->cap);
+    dst->pos  = malloc(sizeof(int) * (size_t)src->cap);
+    memcpy(dst->hash, src->hash, sizeof(unsigned long long) * (size_t)src->cap);
+    memcpy(dst->pos, src->pos, sizeof(int) * (size_t)src->cap);
+}
+
+static void cgidx_free(CGIndex *ix) {
+    free(ix->hash);
+    free(ix->pos);
+    memset(ix, 0, sizeof(*ix));
+}
+
+static void cg_indexes_free(CG *cg) {
+    cgidx_free(&cg->var_idx);
+    cgidx_free(&cg->gvar_idx);
+    cgidx_free(&cg->str_idx);
+    cgidx_free(&cg->atom_idx);
+    cgidx_free(&cg->prof_site_idx);
+    cgidx_free(&cg->func_idx);
+    cgidx_free(&cg->fn_name_idx);
+    cgidx_free(&cg->fn_label_idx);
+    cgidx_free(&cg->fn_rename_idx);
+}
+
+/* Entry of `text` in a CGString table, added with label <prefix><hash>.
+ * The index is by label. */
+static const char *cgstr_intern(CGString **tab, int *count, int *cap, CGIndex *ix,
+                                const char *prefix, const char *text) {
     char lbl[64];
-    snprintf(lbl, sizeof(lbl), ".Lxly_str_%d", cg->str_count);
-    cg->strings[cg->str_count].text  = strdup(text);
-    cg->strings[cg->str_count].label = strdup(lbl);
-    cg->str_count++;
-    return cg->strings[cg->str_count - 1].label;
+    snprintf(lbl, sizeof(lbl), "%s%016llx", prefix, str_hash(text));
+    int i = cgidx_find(ix, CG_KEYS(*tab, *count, offsetof(CGString, label)), lbl);
+    if (i >= 0 && strcmp((*tab)[i].text, text) == 0)
+        return (*tab)[i].label;
+    if (*count >= *cap) {
+        *cap = *cap ? *cap * 2 : 32;
+        *tab = realloc(*tab, sizeof(CGString) * (size_t)*cap);
+    }
+    (*tab)[*count].text  = strdup(text);
+    (*tab)[*count].label = strdup(lbl);
+    (*count)++;
+    cgidx_add(ix, CG_KEYS(*tab, *count, offsetof(CGString, label)), *count - 1);
+    return (*tab)[*count - 1].label;
+}
+
+/* ── string intern ──────────────────────────────────────────────────────────
+ * The label is a hash of the text, not an index, so function bodies emitted
+ * in parallel (emit_bodies) agree on it without sharing the table.        */
+static const char *intern_string(CG *cg, const char *text) {
+    return cgstr_intern(&cg->strings, &cg->str_count, &cg->str_cap, &cg->str_idx,
+                        ".Lxly_str_", text);
+}
+
+/* Slot holding the atom of property name `text` (emit_atom_table). */
+static const char *atom_label(CG *cg, const char *text) {
+    return cgstr_intern(&cg->atoms, &cg->atom_count, &cg->atom_cap, &cg->atom_idx,
+                        ".Lxly_atom_", text);
 }
 
 /* ── variable table ─────────────────────────────────────────────────────── */
 static int var_find(CG *cg, const char *name) {
-    for (int i = cg->var_count - 1; i >= 0; i--)
-        if (strcmp(cg->vars[i].name, name) == 0) return i;
-    return -1;
+    return cgidx_find(&cg->var_idx, CG_KEYS(cg->vars, cg->var_count, 0), name);
 }
 
 /* ── global variable table ──────────────────────────────────────────────── */
@@ -201,9 +420,8 @@ static int var_find(CG *cg, const char *name) {
  * Global write: movq %rax, __xly_globals+index*8(%rip)
  */
 static int gvar_find(CG *cg, const char *name) {
-    for (int i = 0; i < cg->gvar_count; i++)
-        if (strcmp(cg->gvars[i].name, name) == 0) return cg->gvars[i].index;
-    return -1;
+    int i = cgidx_find(&cg->gvar_idx, CG_KEYS(cg->gvars, cg->gvar_count, 0), name);
+    return i >= 0 ? cg->gvars[i].index : -1;
 }
 static int gvar_declare(CG *cg, const char *name) {
     int existing = gvar_find(cg, name);
@@ -216,6 +434,7 @@ static int gvar_declare(CG *cg, const char *name) {
     cg->gvars[cg->gvar_count].name  = strdup(name);
     cg->gvars[cg->gvar_count].index = idx;
     cg->gvar_count++;
+    cgidx_add(&cg->gvar_idx, CG_KEYS(cg->gvars, cg->gvar_count, 0), idx);
     return idx;
 }
 
@@ -226,11 +445,9 @@ static int var_offset(CG *cg, const char *name) {
     return i >= 0 ? cg->vars[i].offset : 0;
 }
 static int var_declare(CG *cg, const char *name) {
-    /* idempotent at same depth */
-    for (int i = cg->var_count - 1; i >= 0; i--) {
-        if (cg->vars[i].depth != cg->scope_depth) break;
-        if (strcmp(cg->vars[i].name, name) == 0) return cg->vars[i].offset;
-    }
+    /* idempotent at same depth (the entries of this depth are the top ones) */
+    int i = var_find(cg, name);
+    if (i >= 0 && cg->vars[i].depth == cg->scope_depth) return cg->vars[i].offset;
     if (cg->var_count >= cg->var_cap) {
         cg->var_cap = cg->var_cap ? cg->var_cap * 2 : 16;
         cg->vars    = realloc(cg->vars, sizeof(cg->vars[0]) * (size_t)cg->var_cap);
@@ -240,6 +457,7 @@ static int var_declare(CG *cg, const char *name) {
     cg->vars[cg->var_count].offset = cg->frame_offset;
     cg->vars[cg->var_count].depth  = cg->scope_depth;
     cg->var_count++;
+    cgidx_add(&cg->var_idx, CG_KEYS(cg->vars, cg->var_count, 0), cg->var_count - 1);
     return cg->frame_offset;
 }
 static void scope_enter(CG *cg) { cg->scope_depth++; }
@@ -270,19 +488,17 @@ static void emit_stmt(CG *cg, ASTNode *node);
 #endif
 
 /* ── declared-function name registry ───────────────────────────────────── */
+static int fn_name_is_declared(CG *cg, const char *name) {
+    return cgidx_find(&cg->fn_name_idx, CG_KEYS(cg->fn_names, cg->fn_name_count, 0), name) >= 0;
+}
 static void fn_name_register(CG *cg, const char *name) {
-    for (int i = 0; i < cg->fn_name_count; i++)
-        if (strcmp(cg->fn_names[i], name) == 0) return;
+    if (fn_name_is_declared(cg, name)) return;
     if (cg->fn_name_count >= cg->fn_name_cap) {
         cg->fn_name_cap = cg->fn_name_cap ? cg->fn_name_cap * 2 : 16;
         cg->fn_names = realloc(cg->fn_names, sizeof(char*) * (size_t)cg->fn_name_cap);
     }
     cg->fn_names[cg->fn_name_count++] = strdup(name);
-}
-static int fn_name_is_declared(CG *cg, const char *name) {
-    for (int i = 0; i < cg->fn_name_count; i++)
-        if (strcmp(cg->fn_names[i], name) == 0) return 1;
-    return 0;
+    cgidx_add(&cg->fn_name_idx, CG_KEYS(cg->fn_names, cg->fn_name_count, 0), cg->fn_name_count - 1);
 }
 
 /* ── fn label uniquification helpers ────────────────────────────────────
@@ -295,9 +511,8 @@ static int fn_name_is_declared(CG *cg, const char *name) {
  *                   saved/restored around each emit_function() call       */
 
 static int fn_label_is_used(CG *cg, const char *lbl) {
-    for (int i = 0; i < cg->fn_labels_used_count; i++)
-        if (strcmp(cg->fn_labels_used[i].lbl, lbl) == 0) return 1;
-    return 0;
+    return cgidx_find(&cg->fn_label_idx,
+                      CG_KEYS(cg->fn_labels_used, cg->fn_labels_used_count, 0), lbl) >= 0;
 }
 static void fn_label_mark_used(CG *cg, const char *lbl) {
     if (fn_label_is_used(cg, lbl)) return;
@@ -307,14 +522,21 @@ static void fn_label_mark_used(CG *cg, const char *lbl) {
                              sizeof(cg->fn_labels_used[0]) * (size_t)cg->fn_labels_used_cap);
     }
     cg->fn_labels_used[cg->fn_labels_used_count++].lbl = strdup(lbl);
+    cgidx_add(&cg->fn_label_idx, CG_KEYS(cg->fn_labels_used, cg->fn_labels_used_count, 0),
+              cg->fn_labels_used_count - 1);
 }
-/* Pick a unique label for `name`; write into buf[bufsz]; mark as used. */
+/* Pick a unique label for `name`; write into buf[bufsz]; mark as used.
+ * Functions nested in the body of funcs[K] are named "<name>__fK" first:
+ * bodies emitted side by side never pick the same label.               */
 static void fn_unique_label(CG *cg, const char *name, char *buf, size_t bufsz) {
-    if (!fn_label_is_used(cg, name)) {
-        snprintf(buf, bufsz, "%s", name);
+    char base[224];
+    if (cg->body_fi >= 0) snprintf(base, sizeof(base), "%s__f%d", name, cg->body_fi);
+    else                  snprintf(base, sizeof(base), "%s", name);
+    if (!fn_label_is_used(cg, base)) {
+        snprintf(buf, bufsz, "%s", base);
     } else {
         for (int n = 2; ; n++) {
-            snprintf(buf, bufsz, "%s__%d", name, n);
+            snprintf(buf, bufsz, "%s__%d", base, n);
             if (!fn_label_is_used(cg, buf)) break;
         }
     }
@@ -330,6 +552,8 @@ static void fn_rename_push(CG *cg, const char *src, const char *lbl) {
     cg->fn_renames[cg->fn_rename_count].src = strdup(src);
     cg->fn_renames[cg->fn_rename_count].lbl = strdup(lbl);
     cg->fn_rename_count++;
+    cgidx_add(&cg->fn_rename_idx, CG_KEYS(cg->fn_renames, cg->fn_rename_count, 0),
+              cg->fn_rename_count - 1);
 }
 /* Pop rename entries back to `target`, freeing strings. */
 static void fn_renames_pop_to(CG *cg, int target) {
@@ -341,21 +565,36 @@ static void fn_renames_pop_to(CG *cg, int target) {
 }
 /* Return the innermost asm label for `src`, or NULL if not renamed. */
 static const char *fn_rename_lookup(CG *cg, const char *src) {
-    for (int i = cg->fn_rename_count - 1; i >= 0; i--)
-        if (strcmp(cg->fn_renames[i].src, src) == 0)
-            return cg->fn_renames[i].lbl;
-    return NULL;
+    int i = cgidx_find(&cg->fn_rename_idx, CG_KEYS(cg->fn_renames, cg->fn_rename_count, 0), src);
+    return i >= 0 ? cg->fn_renames[i].lbl : NULL;
+}
+
+/* Rename scopes: a body (emit_function, ir_lower_in_ctx) overlays its
+ * context and pops back to where it started.  Entries below the outermost
+ * open scope are never popped, and bodies emitted later (in any worker)
+ * start from the same bottom of the stack.                              */
+static int fn_rename_scope_enter(CG *cg) {
+    if (cg->fn_rename_open++ == 0) cg->fn_rename_floor = cg->fn_rename_count;
+    return cg->fn_rename_count;
+}
+static void fn_rename_scope_leave(CG *cg, int saved) {
+    fn_renames_pop_to(cg, saved);
+    cg->fn_rename_open--;
 }
 
 /* Snapshot the current rename stack: returns a malloc'd copy array + count.
+ * Only the entries above the permanent bottom are copied — restoring the
+ * bottom would push nothing, as it is still there — so a program's
+ * top-level functions cost no copy at all.
  * The caller owns the returned array; free with fn_rename_ctx_free().        */
 static void fn_rename_ctx_snapshot(CG *cg, FnRename **out, int *out_count) {
-    *out_count = cg->fn_rename_count;
-    if (cg->fn_rename_count == 0) { *out = NULL; return; }
-    *out = malloc(sizeof(FnRename) * (size_t)cg->fn_rename_count);
-    for (int i = 0; i < cg->fn_rename_count; i++) {
-        (*out)[i].src = strdup(cg->fn_renames[i].src);
-        (*out)[i].lbl = strdup(cg->fn_renames[i].lbl);
+    int from = cg->fn_rename_open ? cg->fn_rename_floor : cg->fn_rename_count;
+    *out_count = cg->fn_rename_count - from;
+    if (*out_count == 0) { *out = NULL; return; }
+    *out = malloc(sizeof(FnRename) * (size_t)*out_count);
+    for (int i = 0; i < *out_count; i++) {
+        (*out)[i].src = strdup(cg->fn_renames[from + i].src);
+        (*out)[i].lbl = strdup(cg->fn_renames[from + i].lbl);
     }
 }
 /* Restore (overlay) a snapshot onto the rename stack: push all entries from
@@ -403,6 +642,12 @@ static int variant_find(CG *cg, const char *name) {
             return cg->variants[i].nparams;
     return -1;
 }
+/* Tag id stored in the variants this program builds (1-based), 0 if unknown. */
+static int variant_id(CG *cg, const char *name) {
+    for (int i = 0; i < cg->variant_count; i++)
+        if (strcmp(cg->variants[i].name, name) == 0) return i + 1;
+    return 0;
+}
 
 /* ── free-variable analysis for closure capture ─────────────────────────
  * Collects names of identifiers in `node` that are NOT in `params[]`
@@ -424,6 +669,8 @@ static int nameset_has(NameSet *s, const char *n) {
     for (int i = 0; i < s->count; i++) if (strcmp(s->names[i], n) == 0) return 1;
     return 0;
 }
+static int fn_uses_this(ASTNode *node);
+
 /* Collect all IDENTIFIER references in subtree, excluding param names */
 static void collect_free_vars(CG *cg, ASTNode *node, NameSet *params, NameSet *out) {
     if (!node) return;
@@ -432,13 +679,19 @@ static void collect_free_vars(CG *cg, ASTNode *node, NameSet *params, NameSet *o
         if (!nameset_has(params, nm) && !fn_name_is_declared(cg, nm))
             nameset_add(out, nm);
     }
+    /* `this` inside a method is its hidden first param */
+    if (node->type == NODE_THIS && !nameset_has(params, "this"))
+        nameset_add(out, "this");
     /* FN_CALL: the callee name is in str_value, not a child IDENTIFIER */
     if (node->type == NODE_FN_CALL && node->str_value) {
         const char *nm = node->str_value;
         if (!nameset_has(params, nm) && !fn_name_is_declared(cg, nm))
             nameset_add(out, nm);
     }
-    /* Don't recurse into nested fn decls/arrow fns — they have their own captures */
+    /* Don't recurse into nested fn decls/arrow fns — they have their own
+     * captures — but an inner arrow fn's `this` is this one's */
+    if (node->type == NODE_ARROW_FN && !nameset_has(params, "this") && fn_uses_this(node))
+        nameset_add(out, "this");
     if (node->type == NODE_FN_DECL || node->type == NODE_ARROW_FN) return;
     for (size_t i = 0; i < node->child_count; i++)
         collect_free_vars(cg, node->children[i], params, out);
@@ -455,6 +708,7 @@ static void collect_fn_names(CG *cg, ASTNode *node) {
         fn_name_register(cg, node->str_value);
         return; /* do NOT recurse into body — nested fn labels assigned at emit time */
     }
+    if (node->type == NODE_CLASS_DECL) return;  /* methods: see collect_classes */
     for (size_t i = 0; i < node->child_count; i++)
         collect_fn_names(cg, node->children[i]);
     /* also recurse into params default values */
@@ -482,8 +736,9 @@ static void collect_variant_names(CG *cg, ASTNode *node) {
 static int count_locals(ASTNode *node) {
     if (!node) return 0;
     int n = (node->type == NODE_VAR_DECL || node->type == NODE_CONST_DECL) ? 1 : 0;
-    /* for-in declares 4 hidden slots per loop; count conservatively */
+    /* for-in declares 4 hidden slots per loop, for-of 2; count conservatively */
     if (node->type == NODE_FOR_IN) n += 4;
+    if (node->type == NODE_FOR_OF) n += 2;
     for (size_t i = 0; i < node->child_count; i++)
         n += count_locals(node->children[i]);
     return n;
@@ -494,229 +749,3111 @@ static int count_locals(ASTNode *node) {
  * Declared here (outside any arch #ifdef) so both x86-64 and ARM64 see them. */
 static int g_opt_level   = 2;   /* default: -O2 */
 static int g_verbose_asm = 0;   /* default: no annotation */
+static int g_jobs        = 0;   /* threads emitting fn bodies, 0 = one per CPU */
+
+/* Set by codegen_set_unit() / codegen_add_import(): the module unit the
+ * next codegen() call compiles, and what the driver knows about the user
+ * modules it imports — one entry per export, plus one with a NULL name
+ * per module standing for its initializer.                              */
+typedef struct {
+    char *path;         /* import path as written in the importing source */
+    char *unit;         /* the module's unit name                         */
+    char *name;         /* exported fn, NULL = the module initializer     */
+    char *label;        /* its global symbol: xlym_<unit>[__<name>]       */
+    int   arity;
+} UnitImport;
+static char       *g_unit = NULL;
+static UnitImport *g_imports = NULL;
+static int         g_import_count = 0, g_import_cap = 0;
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * x86-64 BACKEND  (Linux/BSD + macOS Intel)
+ * SHARED: sys constants and function stashing (used by every emitter)
  * ═══════════════════════════════════════════════════════════════════════════ */
-#ifdef XLY_ARCH_X86_64
 
-/* ── load a double constant into %xmm0 ─────────────────────────────────
- * Use the red zone (-8(%rsp)) to avoid changing %rsp, which would break
- * 16-byte alignment before a subsequent call instruction.                 */
-static void emit_load_double(CG *cg, double d) {
-    union { double d; unsigned long long u; } uu; uu.d = d;
-    emit(cg, "    movabsq $%llu, %%rax", (unsigned long long)uu.u);
-    emit(cg, "    movq    %%rax, -8(%%rsp)");
-    emit(cg, "    movsd   -8(%%rsp), %%xmm0");
+/* ── sys constant table ─────────────────────────────────────────────────
+ * Zero-arg sys functions that return compile-time constants; at -O2 and
+ * above calls to them are replaced by an immediate.                      */
+static int sys_const_lookup(const char *name, long long *out) {
+    static const struct { const char *name; long long val; } SC[] = {
+        /* Standard file descriptors */
+        {"STDIN",0},{"STDOUT",1},{"STDERR",2},
+        /* Open flags (Linux x86-64) */
+        {"O_RDONLY",0},{"O_WRONLY",1},{"O_RDWR",2},
+        {"O_CREAT",64},{"O_TRUNC",512},{"O_APPEND",1024},
+        {"O_NONBLOCK",2048},{"O_SYNC",1052672},{"O_EXCL",128},
+        /* Signals */
+        {"SIGHUP",1},{"SIGINT",2},{"SIGQUIT",3},{"SIGKILL",9},
+        {"SIGTERM",15},{"SIGUSR1",10},{"SIGUSR2",12},
+        {"SIGCHLD",17},{"SIGPIPE",13},{"SIGALRM",14},{"SIGSEGV",11},
+        /* Syslog levels */
+        {"LOG_EMERG",0},{"LOG_ALERT",1},{"LOG_CRIT",2},
+        {"LOG_ERR",3},{"LOG_WARNING",4},{"LOG_NOTICE",5},
+        {"LOG_INFO",6},{"LOG_DEBUG",7},
+        /* mmap prot/map flags */
+        {"PROT_READ",1},{"PROT_WRITE",2},{"PROT_EXEC",4},
+        {"PROT_NONE",0},{"MAP_SHARED",1},{"MAP_PRIVATE",2},
+        {"MAP_ANONYMOUS",32},
+        /* Socket / address family */
+        {"AF_INET",2},{"AF_INET6",10},{"AF_UNIX",1},
+        {"SOCK_STREAM",1},{"SOCK_DGRAM",2},
+        /* Poll events */
+        {"POLLIN",1},{"POLLOUT",4},{"POLLERR",8},{"POLLHUP",16},
+        /* Resource limits */
+        {"RLIMIT_CPU",0},{"RLIMIT_FSIZE",1},
+        {"RLIMIT_STACK",3},{"RLIMIT_NOFILE",7},{"RLIMIT_AS",9},
+        /* Integer limits */
+        {"INT8_MAX",127},{"INT8_MIN",-128},
+        {"INT16_MAX",32767},{"INT16_MIN",-32768},
+        {"INT32_MAX",2147483647LL},{"INT32_MIN",-2147483648LL},
+        {"UINT8_MAX",255},{"UINT16_MAX",65535},
+        {"UINT32_MAX",4294967295LL},
+        {"INT_MAX",2147483647LL},{"INT_MIN",-2147483648LL},
+        {"UINT_MAX",4294967295LL},
+        {NULL,0}
+    };
+    for (int ci = 0; SC[ci].name; ci++) {
+        if (strcmp(name, SC[ci].name) == 0) {
+            *out = SC[ci].val;
+            return 1;
+        }
+    }
+    return 0;
 }
 
-/* ── expression compiler ────────────────────────────────────────────────
- * Post-condition: result XlyVal* is in %rax.  %rsp is unchanged.         */
-static void emit_expr(CG *cg, ASTNode *node) {
-    if (!node) { emit(cg, "    call    " XLY_SYM("xly_null")); return; }
+/* ── native module functions ────────────────────────────────────────────
+ * math.* and string.* bind at compile time to the natives modules.c
+ * exports as xly_<module>_<fn> (libxly_rtc.a links them), a plain call
+ * with the usual (args, argc) instead of xly_call_module's lookup by
+ * name.  Other modules, and names missing here, keep the dynamic
+ * dispatch.  The lists follow math_fns / string_fns in modules.c.     */
+static const char *const NATIVE_MATH[] = {
+    "abs", "sqrt", "pow", "cbrt", "hypot", "sign", "fmod", "clamp", "exp",
+    "floor", "ceil", "round", "trunc", "max", "min",
+    "sin", "cos", "tan", "asin", "acos", "atan", "atan2",
+    "log", "log2", "log10", "random", "randomInt",
+    "PI", "E", "INF", "NAN", "isNaN", "isInf", "isFinite",
+    "complex", "complexAdd", "complexMul", "complexAbs", "complexConj",
+    "complexPhase", "sum", "product", "mean", "median", "variance", "stddev",
+    "gcd", "lcm", "factorial", "combinations", "permutations",
+    "lerp", "degrees", "radians", NULL
+};
+static const char *const NATIVE_STRING[] = {
+    "len", "toString", "toNumber", "upper", "lower", "contains",
+    "startsWith", "endsWith", "indexOf", "lastIndexOf", "charAt",
+    "charCodeAt", "fromCharCode", "repeat", "reverse", "trim", "trimStart",
+    "trimEnd", "replace", "substr", "slice", "padStart", "padEnd",
+    "split", "join", "unicodeLength", "unicodeCharAt", "codePointAt",
+    "fromCodePoint", "normalize", NULL
+};
+
+/* The asm symbol of the native behind mod.fn, written to buf; NULL when
+ * the call has to go through xly_call_module. */
+static const char *module_native(const char *mod, const char *fn, char *buf, size_t sz) {
+    const char *const *names = strcmp(mod, "math") == 0   ? NATIVE_MATH
+                             : strcmp(mod, "string") == 0 ? NATIVE_STRING : NULL;
+    if (!names) return NULL;
+    for (int i = 0; names[i]; i++)
+        if (strcmp(names[i], fn) == 0) {
+            snprintf(buf, sz, XLY_SYM("xly_%s_%s"), mod, fn);
+            return buf;
+        }
+    return NULL;
+}
 
-    switch (node->type) {
+/* The inline form of math.fn called with argc arguments, if it has one. */
+static IRNative module_native_op(const char *mod, const char *fn, int argc) {
+    if (strcmp(mod, "math") != 0) return IR_NATIVE_CALL;
+    if (argc == 1 && strcmp(fn, "sqrt") == 0) return IR_NATIVE_SQRT;
+    if (argc == 1 && strcmp(fn, "abs") == 0)  return IR_NATIVE_ABS;
+    if (argc == 2 && strcmp(fn, "min") == 0)  return IR_NATIVE_MIN;
+    if (argc == 2 && strcmp(fn, "max") == 0)  return IR_NATIVE_MAX;
+    return IR_NATIVE_CALL;
+}
 
-    /* ── literals ────────────────────────────────────────────────────── */
-    case NODE_NUMBER:
-        emit_load_double(cg, node->num_value);
-        emit(cg, "    call    " XLY_SYM("xly_num"));
-        break;
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SHARED: module units
+ *
+ * xenlyc compiles every imported user module separately (xenlyc_units.c).
+ * A module unit has no main: its top-level statements become the global
+ * initializer xlym_<unit>, guarded to run once, and each exported fn also
+ * gets the global symbol xlym_<unit>__<name>.  Top-level variables stay in
+ * the unit's own (local) __xly_globals.
+ *
+ * In the importer, `import "m"` calls the initializer, and m.fn(...), or
+ * fn(...) after `from "m" import fn`, is a direct call.  Call sites use the
+ * usual .Lxly_fn_<label> form with the symbol as label; a one-jump stub
+ * per import forwards it to the other object.
+ * ═══════════════════════════════════════════════════════════════════════════ */
 
-    case NODE_STRING: {
-        const char *lbl = intern_string(cg, node->str_value ? node->str_value : "");
-        emit(cg, "    leaq    %s(%%rip), %%rdi", lbl);
-        emit(cg, "    call    " XLY_SYM("xly_str"));
-        break;
+static const UnitImport *unit_import_find(const char *path, const char *name) {
+    for (int i = 0; i < g_import_count; i++) {
+        const UnitImport *u = &g_imports[i];
+        if (strcmp(u->path, path) != 0) continue;
+        if (name ? (u->name && strcmp(u->name, name) == 0) : !u->name) return u;
     }
+    return NULL;
+}
 
-    case NODE_BOOL:
-        emit(cg, "    movl    $%d, %%edi", node->bool_value ? 1 : 0);
-        emit(cg, "    call    " XLY_SYM("xly_bool"));
-        break;
+static const UnitImport *unit_import_by_label(const char *label) {
+    for (int i = 0; i < g_import_count; i++)
+        if (strcmp(g_imports[i].label, label) == 0) return &g_imports[i];
+    return NULL;
+}
 
-    case NODE_NULL:
-        emit(cg, "    call    " XLY_SYM("xly_null"));
-        break;
+/* Name a plain `import "dir/m.xe"` binds: the file name without .xe */
+static char *unit_default_alias(const char *path) {
+    const char *slash = strrchr(path, '/');
+    const char *base  = slash ? slash + 1 : path;
+    size_t len = strlen(base);
+    if (len > 3 && strcmp(base + len - 3, ".xe") == 0) len -= 3;
+    char *name = malloc(len + 1);
+    memcpy(name, base, len);
+    name[len] = '\0';
+    return name;
+}
 
-    /* ── anonymous function expression: fn(params) { body } ──────────
-     * Synthesise a unique name, stash the node for later emission,
-     * then wrap the raw label address as a VAL_FUNCTION XlyVal* via
-     * xly_make_fn() so the value can be stored in a variable.         */
-    case NODE_ARROW_FN: {
-        char anon_name[64];
-        snprintf(anon_name, sizeof(anon_name), "__anon_%d", cg->label_seq++);
-        /* Give the node a synthesized name so emit_function can use it */
-        if (node->str_value) free(node->str_value);
-        node->str_value = strdup(anon_name);
-        fn_name_register(cg, anon_name);
-
-        /* ── free-variable analysis: find captured outer variables ── */
-        NameSet fn_params = {0};
-        for (size_t i = 0; i < node->param_count; i++)
-            nameset_add(&fn_params, node->params[i].name);
-        NameSet free_vars = {0};
-        if (node->child_count > 0)
-            collect_free_vars(cg, node->children[0], &fn_params, &free_vars);
-        nameset_free(&fn_params);
-        /* Filter to only vars that actually exist in current scope */
-        NameSet captures = {0};
-        for (int i = 0; i < free_vars.count; i++) {
-            int off = var_offset(cg, free_vars.names[i]);
-            if (off != 0)
-                nameset_add(&captures, free_vars.names[i]);
-        }
-        nameset_free(&free_vars);
+/* Calls to `name` go to the import `u` */
+static void unit_bind_fn(CG *cg, const char *name, const UnitImport *u) {
+    fn_name_register(cg, name);
+    fn_rename_push(cg, name, u->label);
+}
 
-        /* Stash for emission after main */
-        if (cg->func_count >= cg->func_cap) {
-            cg->func_cap = cg->func_cap ? cg->func_cap * 2 : 16;
-            cg->funcs    = realloc(cg->funcs, sizeof(cg->funcs[0]) * (size_t)cg->func_cap);
-        }
-        int fi = cg->func_count++;
-        cg->funcs[fi].node       = node;
-        cg->funcs[fi].ncaptures  = captures.count;
-        cg->funcs[fi].captures   = captures.count > 0 ? captures.names : NULL;
-        cg->funcs[fi].asm_label  = strdup(anon_name);
-        fn_label_mark_used(cg, anon_name);
-        fn_rename_ctx_snapshot(cg, &cg->funcs[fi].rename_ctx, &cg->funcs[fi].rename_ctx_count);
-        /* (don't nameset_free: captures.names ownership transferred) */
+/* `alias.fn(...)` calls into the module imported as `path` */
+static void unit_alias_add(CG *cg, char *alias, const char *path) {
+    if (cg->unit_alias_count >= cg->unit_alias_cap) {
+        cg->unit_alias_cap = cg->unit_alias_cap ? cg->unit_alias_cap * 2 : 8;
+        cg->unit_aliases = realloc(cg->unit_aliases,
+                           sizeof(cg->unit_aliases[0]) * (size_t)cg->unit_alias_cap);
+    }
+    cg->unit_aliases[cg->unit_alias_count].alias = alias;
+    cg->unit_aliases[cg->unit_alias_count].path  = strdup(path);
+    cg->unit_alias_count++;
+}
 
-        if (captures.count == 0) {
-            /* No captures: simple function pointer wrap */
-            emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", anon_name);
-            emit(cg, "    call    " XLY_SYM("xly_make_fn"));
-        } else {
-            /* Build env array on stack: [cap0, cap1, ...] */
-            int env_bytes = ((captures.count * 8) + 15) & ~15;
-            emit(cg, "    subq    $%d, %%rsp", env_bytes);
-            for (int i = 0; i < captures.count; i++) {
-                int off = var_offset(cg, captures.names[i]);
-                emit(cg, "    movq    %d(%%rbp), %%rax", off);
-                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+/* Pre-pass: bind the names every import of a registered module makes. */
+static void collect_unit_imports(CG *cg, ASTNode *node) {
+    if (!node) return;
+    if (node->type == NODE_IMPORT && node->str_value &&
+        unit_import_find(node->str_value, NULL)) {
+        const char *path = node->str_value;
+        switch ((int)node->num_value) {
+        case 1:                                         /* import "m" as a */
+            /* the module stays reachable by its own name too, as in the
+             * interpreter (load_user_module registers it first)          */
+            if (node->child_count > 0 && node->children[0]->str_value)
+                unit_alias_add(cg, strdup(node->children[0]->str_value), path);
+            /* fall through */
+        case 0:                                         /* import "m"      */
+            unit_alias_add(cg, unit_default_alias(path), path);
+            break;
+        case 2:                                         /* from "m" import a, b */
+            for (size_t i = 0; i < node->child_count; i++) {
+                const char *nm = node->children[i] ? node->children[i]->str_value : NULL;
+                const UnitImport *u = nm ? unit_import_find(path, nm) : NULL;
+                if (u) unit_bind_fn(cg, nm, u);
             }
-            /* xly_make_closure(fp, env, env_size) */
-            emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", anon_name);
-            emit(cg, "    movq    %%rsp, %%rsi");
-            emit(cg, "    movl    $%d, %%edx", captures.count);
-            emit(cg, "    call    " XLY_SYM("xly_make_closure"));
-            emit(cg, "    addq    $%d, %%rsp", env_bytes);
+            break;
+        case 3:                                         /* from "m" import * */
+            for (int i = 0; i < g_import_count; i++)
+                if (g_imports[i].name && strcmp(g_imports[i].path, path) == 0)
+                    unit_bind_fn(cg, g_imports[i].name, &g_imports[i]);
+            break;
         }
-        break;
+        return;
     }
+    if (node->type == NODE_FN_DECL || node->type == NODE_ARROW_FN) return;
+    for (size_t i = 0; i < node->child_count; i++)
+        collect_unit_imports(cg, node->children[i]);
+}
 
-    /* ── identifier ──────────────────────────────────────────────────── */
-    case NODE_IDENTIFIER: {
-        int off = var_offset(cg, node->str_value);
-        if (off != 0) {
-            emit(cg, "    movq    %d(%%rbp), %%rax", off);
-        } else {
-            int gi = gvar_find(cg, node->str_value);
-            if (gi >= 0) {
-                /* Global variable: load from __xly_globals array */
-                emit(cg, "    movq    " XLY_SYM("__xly_globals") "+%d(%%rip), %%rax", gi * 8);
-            } else if (fn_is_known(cg, node->str_value)) {
-                /* Declared function used as a value — wrap its address as XlyVal* */
-                const char *lbl = fn_resolve_label(cg, node->str_value);
-                emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", lbl);
-                emit(cg, "    call    " XLY_SYM("xly_make_fn"));
-            } else {
-                emit(cg, "    call    " XLY_SYM("xly_null"));   /* undefined → null */
-            }
+/* `recv.name` where recv is an identifier bound by an import: the export
+ * it calls, or NULL.  Callers have ruled out locals and globals.        */
+static const UnitImport *unit_export_call(CG *cg, const char *recv, const char *name) {
+    for (int i = cg->unit_alias_count - 1; i >= 0; i--)
+        if (strcmp(cg->unit_aliases[i].alias, recv) == 0)
+            return unit_import_find(cg->unit_aliases[i].path, name);
+    return NULL;
+}
+
+/* Pre-pass: `export fn` / `export class` declare as usual; a unit also
+ * notes the exported fn names.                                          */
+static void unit_unwrap_exports(CG *cg, ASTNode *program) {
+    for (size_t i = 0; i < program->child_count; i++) {
+        ASTNode *ex = program->children[i];
+        if (!ex || ex->type != NODE_EXPORT || ex->child_count == 0) continue;
+        ASTNode *decl = ex->children[0];
+        program->children[i] = decl;
+        ex->children[0] = NULL;
+        ex->child_count = 0;
+        ast_node_destroy(ex);
+        if (!cg->unit || !decl || decl->type != NODE_FN_DECL || !decl->str_value) continue;
+        if (cg->export_count >= cg->export_cap) {
+            cg->export_cap = cg->export_cap ? cg->export_cap * 2 : 8;
+            cg->exports = realloc(cg->exports, sizeof(char *) * (size_t)cg->export_cap);
         }
-        break;
+        cg->exports[cg->export_count++] = strdup(decl->str_value);
     }
+}
 
-    /* ── this ────────────────────────────────────────────────────────── */
-    case NODE_THIS:
-        emit(cg, "    call    " XLY_SYM("xly_this"));
-        break;
+static void unit_tables_free(CG *cg) {
+    for (int i = 0; i < cg->export_count; i++) free(cg->exports[i]);
+    free(cg->exports);
+    for (int i = 0; i < cg->unit_alias_count; i++) {
+        free(cg->unit_aliases[i].alias);
+        free(cg->unit_aliases[i].path);
+    }
+    free(cg->unit_aliases);
+}
 
-    /* ── binary ──────────────────────────────────────────────────────── */
-    case NODE_BINARY: {
-        const char *op = node->str_value;
+/* ── function stash ─────────────────────────────────────────────────────
+ * Function bodies are emitted after main.  fn_stash() records the node,
+ * its asm label and captures, plus a snapshot of the rename table so peer
+ * functions declared in the same scope still resolve when the body is
+ * emitted later.  Ownership of `captures` passes to funcs[].             */
+static int fn_label_index(CG *cg, const char *label);
+
+static int fn_stash(CG *cg, ASTNode *node, const char *asm_label,
+                    char **captures, int ncaptures) {
+    if (cg->func_count >= cg->func_cap) {
+        cg->func_cap = cg->func_cap ? cg->func_cap * 2 : 16;
+        cg->funcs    = realloc(cg->funcs, sizeof(cg->funcs[0]) * (size_t)cg->func_cap);
+    }
+    int fi = cg->func_count++;
+    cg->funcs[fi].node      = node;
+    cg->funcs[fi].captures  = ncaptures > 0 ? captures : NULL;
+    cg->funcs[fi].ncaptures = ncaptures;
+    cg->funcs[fi].asm_label = strdup(asm_label);
+    cg->funcs[fi].num_entry = 0;
+    cg->funcs[fi].cls       = -1;
+    cg->funcs[fi].recv_twin = -1;
+    cgidx_add(&cg->func_idx, CG_KEYS(cg->funcs, cg->func_count, offsetof(CGFunc, asm_label)), fi);
+    fn_label_mark_used(cg, asm_label);
+    fn_rename_ctx_snapshot(cg, &cg->funcs[fi].rename_ctx, &cg->funcs[fi].rename_ctx_count);
+    return fi;
+}
 
-        /* ── short-circuit: and ──
-         * eval left → if falsy jump to end (result = left)
-         * eval right → result = right                          */
-        if (strcmp(op, "and") == 0) {
-            char lbl_end[64], lbl_done[64];
-            int seq = cg->label_seq++;
-            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%d_and_end",  seq);
-            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%d_and_done", seq);
+/* ── receivers ──────────────────────────────────────────────────────────
+ * `this` in a function that is not a class method is the object it was
+ * called on as obj.fn(), null when called any other way.  Such a function
+ * takes the receiver as a leading "this" param, like a method, and its
+ * value is made with xly_make_method so xly_obj_call knows to pass it.
+ * An anonymous fn is only ever called through its value, so that is its
+ * one body; a declared fn keeps its plain body for calls by name and gets
+ * a receiver twin for its value.  An inner anonymous fn's `this` is the
+ * enclosing one (captured).                                              */
+static int fn_uses_this(ASTNode *node) {
+    if (!node) return 0;
+    if (node->type == NODE_THIS) return 1;
+    for (size_t i = 0; i < node->child_count; i++) {
+        ASTNode *c = node->children[i];
+        if (!c || c->type == NODE_FN_DECL || c->type == NODE_GEN_DECL ||
+            c->type == NODE_CLASS_DECL)
+            continue;
+        if (fn_uses_this(c)) return 1;
+    }
+    return 0;
+}
 
-            emit_expr(cg, node->children[0]);          /* left → %rax */
-            emit(cg, "    subq    $16, %%rsp");        /* aligned spill slot */
-            emit(cg, "    movq    %%rax, (%%rsp)");    /* save left */
-            emit(cg, "    movq    %%rax, %%rdi");
-            emit(cg, "    call    " XLY_SYM("xly_truthy"));        /* eax = 0|1 */
-            emit(cg, "    testl   %%eax, %%eax");
-            emit(cg, "    jz      %s", lbl_end);       /* falsy → keep left */
-            /* truthy: discard left, eval right */
-            emit(cg, "    addq    $16, %%rsp");        /* free spill slot */
-            emit_expr(cg, node->children[1]);          /* right → %rax */
-            emit(cg, "    jmp     %s", lbl_done);
-            emit(cg, "%s:", lbl_end);                  /* falsy exit: left in spill slot */
-            emit(cg, "    movq    (%%rsp), %%rax");    /* restore left */
-            emit(cg, "    addq    $16, %%rsp");
-            emit(cg, "%s:", lbl_done);
-            break;
-        }
+/* A copy of fn whose params are "this" followed by its own. */
+static ASTNode *fn_with_receiver(ASTNode *fn) {
+    ASTNode *m = malloc(sizeof(ASTNode));
+    *m = *fn;
+    m->param_count = fn->param_count + 1;
+    m->params      = calloc(m->param_count, sizeof(Param));
+    m->params[0].name = strdup("this");
+    for (size_t k = 0; k < fn->param_count; k++) m->params[k + 1] = fn->params[k];
+    return m;
+}
 
-        /* ── short-circuit: or ──
-         * eval left → if truthy jump to end (result = left)
-         * eval right → result = right                          */
-        if (strcmp(op, "or") == 0) {
-            char lbl_end[64], lbl_done[64];
-            int seq = cg->label_seq++;
-            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%d_or_end",  seq);
-            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%d_or_done", seq);
+/* FN_DECL: allocate a globally-unique asm label (e.g. "add__2" when the
+ * name is reused in another scope), push the scope-local rename so call
+ * sites inside this body resolve to it, and stash the body (and its
+ * receiver twin when it uses `this`).                                    */
+static void fn_decl_stash(CG *cg, ASTNode *node) {
+    char ulbl[256];
+    fn_unique_label(cg, node->str_value, ulbl, sizeof(ulbl));
+    fn_rename_push(cg, node->str_value, ulbl);
+    int fi = fn_stash(cg, node, ulbl, NULL, 0);
+    if (!fn_uses_this(node)) return;
+    char tlbl[256], base[264];
+    snprintf(base, sizeof(base), "%s__this", ulbl);
+    fn_unique_label(cg, base, tlbl, sizeof(tlbl));
+    int ti = fn_stash(cg, fn_with_receiver(node), tlbl, NULL, 0);
+    cg->funcs[fi].recv_twin = ti;
+}
 
-            emit_expr(cg, node->children[0]);
-            emit(cg, "    subq    $16, %%rsp");        /* aligned spill slot */
-            emit(cg, "    movq    %%rax, (%%rsp)");    /* save left */
-            emit(cg, "    movq    %%rax, %%rdi");
-            emit(cg, "    call    " XLY_SYM("xly_truthy"));
-            emit(cg, "    testl   %%eax, %%eax");
-            emit(cg, "    jnz     %s", lbl_end);       /* truthy → keep left */
-            emit(cg, "    addq    $16, %%rsp");        /* free spill slot */
-            emit_expr(cg, node->children[1]);
-            emit(cg, "    jmp     %s", lbl_done);
-            emit(cg, "%s:", lbl_end);
-            emit(cg, "    movq    (%%rsp), %%rax");    /* restore left */
-            emit(cg, "    addq    $16, %%rsp");
-            emit(cg, "%s:", lbl_done);
-            break;
-        }
+/* The body the value of declared fn `name` calls; *recv is set when that
+ * body takes a receiver (so the value is made with xly_make_method).     */
+static const char *fn_value_label(CG *cg, const char *name, int *recv) {
+    const char *lbl = fn_resolve_label(cg, name);
+    int fi = fn_label_index(cg, lbl);
+    int ti = fi >= 0 ? cg->funcs[fi].recv_twin : -1;
+    *recv = ti >= 0;
+    return ti >= 0 ? cg->funcs[ti].asm_label : lbl;
+}
 
-        /* ── general binary op ──
-         * OPTIMIZATION: For arithmetic ops (+,-,*,/), emit unboxed floating-point
-         * ops to avoid boxing overhead. BUT: + is also string concat, so we need
-         * a runtime type check before unboxing. */
-        int is_arith = (strcmp(op,"+") == 0 || strcmp(op,"-") == 0 || 
-                        strcmp(op,"*") == 0 || strcmp(op,"/") == 0);
+/* GEN_DECL: the body is stashed like any fn, under a label of its own
+ * ("__gen_<name>") with no rename, so a call by name still goes through
+ * the global holding xly_gen_fn(body) and makes a new generator.        */
+static void gen_decl_stash(CG *cg, ASTNode *node, char *lbl, size_t lblsz) {
+    char base[224];
+    snprintf(base, sizeof(base), "__gen_%s", node->str_value ? node->str_value : "anon");
+    fn_unique_label(cg, base, lbl, lblsz);
+    fn_stash(cg, node, lbl, NULL, 0);
+}
 
-        if (is_arith) {
-            /* For +, we need to handle string concatenation.
-             * Strategy: check if left operand is a string at runtime.
-             * If yes, fall back to xly_add. Otherwise, use unboxed path. */
-            int is_plus = (strcmp(op,"+") == 0);
-            
-            /* Handle special case: both operands are number literals */
-            if (node->children[0]->type == NODE_NUMBER && 
-                node->children[1]->type == NODE_NUMBER) {
-                /* Ultra-fast path: compile-time constant folding */
-                double left_val = node->children[0]->num_value;
-                double right_val = node->children[1]->num_value;
-                double result;
-                if      (strcmp(op,"+") == 0) result = left_val + right_val;
-                else if (strcmp(op,"-") == 0) result = left_val - right_val;
-                else if (strcmp(op,"*") == 0) result = left_val * right_val;
-                else                          result = left_val / right_val;
-                
-                uint64_t bits;
-                memcpy(&bits, &result, sizeof(double));
-                emit(cg, "    movabsq $%lu, %%rax", bits);
+static int fn_label_index(CG *cg, const char *label) {
+    return cgidx_find(&cg->func_idx,
+                      CG_KEYS(cg->funcs, cg->func_count, offsetof(CGFunc, asm_label)), label);
+}
+
+/* Arity of a stashed function body by label, or -1 if unknown.  Direct
+ * call sites zero the registers of omitted params so the callee's
+ * optional-param check sees a raw NULL rather than a stale register.     */
+static int fn_callee_arity(CG *cg, const char *label) {
+    int fi = fn_label_index(cg, label);
+    if (fi < 0) {
+        const UnitImport *u = unit_import_by_label(label);
+        return u ? u->arity : -1;
+    }
+    return (int)cg->funcs[fi].node->param_count;
+}
+
+/* ARROW_FN: give the node a synthesized "__anon_N" name and collect the
+ * free variables of its body.  The caller keeps the names that resolve to
+ * locals of the enclosing frame — those become the closure captures.     */
+static void arrow_fn_prepare(CG *cg, ASTNode *node, char *name, size_t namesz,
+                             NameSet *free_vars) {
+    snprintf(name, namesz, "__anon_%s%d", cg->label_pfx, cg->label_seq++);
+    if (node->str_value) free(node->str_value);
+    node->str_value = strdup(name);
+    fn_name_register(cg, name);
+
+    NameSet fn_params = {0};
+    for (size_t i = 0; i < node->param_count; i++)
+        nameset_add(&fn_params, node->params[i].name);
+    if (node->child_count > 0)
+        collect_free_vars(cg, node->children[0], &fn_params, free_vars);
+    nameset_free(&fn_params);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SHARED: classes
+ *
+ * Classes are laid out before main is emitted.  An instance's fields are
+ * its parent's followed by every `this.NAME` its own methods use, so a
+ * field keeps its slot in subclasses.  Methods become functions labelled
+ * "Class.method" (never callable by name) whose first param is the
+ * receiver, and each class gets a vtable with one entry per method name
+ * in the program (a "selector"), inherited entries copied from the parent.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static int class_find(CG *cg, const char *name) {
+    for (int i = cg->class_count - 1; i >= 0; i--)
+        if (strcmp(cg->classes[i].name, name) == 0) return i;
+    return -1;
+}
+
+static int selector_find(CG *cg, const char *name) {
+    for (int i = 0; i < cg->selector_count; i++)
+        if (strcmp(cg->selectors[i], name) == 0) return i;
+    return -1;
+}
+
+static int class_field_slot(CG *cg, int ci, const char *field) {
+    for (int i = 0; i < cg->classes[ci].nfields; i++)
+        if (strcmp(cg->classes[ci].fields[i], field) == 0) return i;
+    return -1;
+}
+
+static void class_add_field(CG *cg, int ci, const char *field) {
+    if (class_field_slot(cg, ci, field) >= 0) return;
+    int n = cg->classes[ci].nfields++;
+    cg->classes[ci].fields = realloc(cg->classes[ci].fields, sizeof(char*) * (size_t)(n + 1));
+    cg->classes[ci].fields[n] = strdup(field);
+}
+
+static void class_collect_fields(CG *cg, int ci, ASTNode *n) {
+    if (!n) return;
+    if ((n->type == NODE_PROPERTY_GET || n->type == NODE_PROPERTY_SET) && n->str_value &&
+        n->child_count > 0 && n->children[0] && n->children[0]->type == NODE_THIS)
+        class_add_field(cg, ci, n->str_value);
+    for (size_t i = 0; i < n->child_count; i++)
+        class_collect_fields(cg, ci, n->children[i]);
+    for (size_t i = 0; i < n->param_count; i++)
+        if (n->params && n->params[i].default_value)
+            class_collect_fields(cg, ci, n->params[i].default_value);
+}
+
+/* Pass 1: register every class and method name, wherever declared. */
+static void collect_class_names(CG *cg, ASTNode *node) {
+    if (!node) return;
+    if (node->type == NODE_CLASS_DECL && node->str_value) {
+        if (cg->class_count >= cg->class_cap) {
+            cg->class_cap = cg->class_cap ? cg->class_cap * 2 : 8;
+            cg->classes   = realloc(cg->classes, sizeof(cg->classes[0]) * (size_t)cg->class_cap);
+        }
+        int ci = cg->class_count++;
+        memset(&cg->classes[ci], 0, sizeof(cg->classes[0]));
+        cg->classes[ci].name    = strdup(node->str_value);
+        cg->classes[ci].node    = node;
+        cg->classes[ci].parent  = -1;
+        cg->classes[ci].init_fi = -1;
+        for (size_t i = 1; i < node->child_count; i++) {
+            ASTNode *m = node->children[i];
+            if (!m || m->type != NODE_FN_DECL || !m->str_value ||
+                selector_find(cg, m->str_value) >= 0)
+                continue;
+            if (cg->selector_count >= cg->selector_cap) {
+                cg->selector_cap = cg->selector_cap ? cg->selector_cap * 2 : 16;
+                cg->selectors = realloc(cg->selectors, sizeof(char*) * (size_t)cg->selector_cap);
+            }
+            cg->selectors[cg->selector_count++] = strdup(m->str_value);
+        }
+    }
+    for (size_t i = 0; i < node->child_count; i++)
+        collect_class_names(cg, node->children[i]);
+}
+
+/* Pass 2: fields, methods and vtable of classes[ci], parent first.  The
+ * vtable doubles as the "done" mark, which also stops inheritance cycles. */
+static void class_layout(CG *cg, int ci) {
+    if (cg->classes[ci].vtable) return;
+    int nsel = cg->selector_count;
+    cg->classes[ci].vtable = malloc(sizeof(int) * (size_t)(nsel ? nsel : 1));
+    for (int k = 0; k < nsel; k++) cg->classes[ci].vtable[k] = -1;
+
+    ASTNode *node = cg->classes[ci].node;
+    ASTNode *pn   = node->child_count > 0 ? node->children[0] : NULL;
+    int p = pn && pn->type == NODE_IDENTIFIER && pn->str_value ? class_find(cg, pn->str_value) : -1;
+    if (p == ci) p = -1;
+    cg->classes[ci].parent = p;
+    if (p >= 0) {
+        class_layout(cg, p);
+        for (int k = 0; k < cg->classes[p].nfields; k++)
+            class_add_field(cg, ci, cg->classes[p].fields[k]);
+        memcpy(cg->classes[ci].vtable, cg->classes[p].vtable, sizeof(int) * (size_t)nsel);
+        cg->classes[ci].init_fi = cg->classes[p].init_fi;
+    }
+
+    for (size_t i = 1; i < node->child_count; i++) {
+        ASTNode *m = node->children[i];
+        if (!m || m->type != NODE_FN_DECL || !m->str_value) continue;
+        class_collect_fields(cg, ci, m);
+
+        /* the stashed body: same children and params, plus the receiver */
+        ASTNode *fn = fn_with_receiver(m);
+        char name[256];
+        snprintf(name, sizeof(name), "%s.%s", cg->classes[ci].name, m->str_value);
+        fn->str_value   = strdup(name);
+
+        char lbl[256];
+        fn_unique_label(cg, name, lbl, sizeof(lbl));
+        int fi = fn_stash(cg, fn, lbl, NULL, 0);
+        cg->funcs[fi].cls = ci;
+        cg->classes[ci].vtable[selector_find(cg, m->str_value)] = fi;
+        if (strcmp(m->str_value, "init") == 0) cg->classes[ci].init_fi = fi;
+    }
+}
+
+static void collect_classes(CG *cg, ASTNode *program) {
+    collect_class_names(cg, program);
+    for (int i = 0; i < cg->class_count; i++) class_layout(cg, i);
+}
+
+/* One XlyClass per class in .data (layout in xly_rt.h), then the shared
+ * selector names.  Called ahead of the string table so names are interned. */
+static void emit_class_tables(CG *cg) {
+    if (cg->class_count == 0) return;
+    emit(cg, "");
+#if defined(__APPLE__)
+    emit(cg, ".section __DATA,__data");
+#else
+    emit(cg, ".section .data");
+#endif
+    emit(cg, ".balign 8");
+    for (int ci = 0; ci < cg->class_count; ci++) {
+        int p = cg->classes[ci].parent, init = cg->classes[ci].init_fi;
+        emit(cg, ".Lxly_class_%d:", ci);
+        emit(cg, "    .quad   %s", intern_string(cg, cg->classes[ci].name));
+        if (p >= 0) emit(cg, "    .quad   .Lxly_class_%d", p);
+        else        emit(cg, "    .quad   0");
+        if (init >= 0) emit(cg, "    .quad   .Lxly_fn_%s", cg->funcs[init].asm_label);
+        else           emit(cg, "    .quad   0");
+        emit(cg, "    .quad   %d", cg->classes[ci].nfields);
+        emit(cg, "    .quad   .Lxly_class_%d_fields", ci);
+        emit(cg, "    .quad   %d", cg->selector_count);
+        emit(cg, "    .quad   .Lxly_class_%d_vtable", ci);
+        emit(cg, "    .quad   .Lxly_selectors");
+        emit(cg, ".Lxly_class_%d_fields:", ci);
+        for (int k = 0; k < cg->classes[ci].nfields; k++)
+            emit(cg, "    .quad   %s", intern_string(cg, cg->classes[ci].fields[k]));
+        emit(cg, ".Lxly_class_%d_vtable:", ci);
+        for (int k = 0; k < cg->selector_count; k++) {
+            int fi = cg->classes[ci].vtable[k];
+            if (fi >= 0) emit(cg, "    .quad   .Lxly_fn_%s", cg->funcs[fi].asm_label);
+            else         emit(cg, "    .quad   0");
+        }
+    }
+    emit(cg, ".Lxly_selectors:");
+    for (int k = 0; k < cg->selector_count; k++)
+        emit(cg, "    .quad   %s", intern_string(cg, cg->selectors[k]));
+}
+
+/* The atom slots the bodies used, in .data: main (or the unit's
+ * initializer) has xly_atoms overwrite each with the atom of its name
+ * before anything reads them.  Called ahead of the string table.       */
+static void emit_atom_table(CG *cg) {
+    emit(cg, "");
+#if defined(__APPLE__)
+    emit(cg, ".section __DATA,__data");
+#else
+    emit(cg, ".section .data");
+#endif
+    emit(cg, ".balign 8");
+    emit(cg, ".Lxly_atom_count:");
+    emit(cg, "    .quad   %d", cg->atom_count);
+    emit(cg, ".Lxly_atoms:");
+    for (int i = 0; i < cg->atom_count; i++) {
+        emit(cg, "%s:", cg->atoms[i].label);
+        emit(cg, "    .quad   %s", intern_string(cg, cg->atoms[i].text));
+    }
+}
+
+static void classes_free(CG *cg) {
+    for (int i = 0; i < cg->func_count; i++) {
+        if (cg->funcs[i].cls < 0) continue;
+        ASTNode *fn = cg->funcs[i].node;         /* synthesized by class_layout */
+        free(fn->str_value);
+        free(fn->params[0].name);
+        free(fn->params);
+        free(fn);
+    }
+    for (int i = 0; i < cg->class_count; i++) {
+        free(cg->classes[i].name);
+        for (int k = 0; k < cg->classes[i].nfields; k++) free(cg->classes[i].fields[k]);
+        free(cg->classes[i].fields);
+        free(cg->classes[i].vtable);
+    }
+    free(cg->classes);
+    for (int i = 0; i < cg->selector_count; i++) free(cg->selectors[i]);
+    free(cg->selectors);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SHARED: profile feedback  (--profile-generate / --profile-use)
+ *
+ * A site is a point the lowering counts: a function entry, the two edges
+ * of a condition, a direct call, a boxed + - * /.  Its key names the
+ * function ("name@line", "Class.name@line", "main"; "<unit>:" ahead in a
+ * module) and the site ("kind:line.n", the n-th of that kind on the line),
+ * so it carries over from the instrumented build to the optimized one
+ * for as long as the function's source does.
+ *
+ *   generate  each site owns two counters in the XlyProfTable (xly_rt.h)
+ *             main registers; IR_PROF_COUNT bumps one, atomically, as
+ *             spawned tasks count from several threads.  Counter labels
+ *             hash the key, so bodies emitted in parallel agree on them.
+ *   use       the .xeprof the program wrote is loaded once (g_prof) and
+ *             the lowering turns its counts into hints:
+ *               · an edge never taken gets a cold block: it and what only
+ *                 it leads to are laid out in .text.unlikely
+ *               · a function never entered goes to .text.unlikely whole
+ *               · a direct call is hot (>= 1% of the busiest call site) or
+ *                 cold (never made): the inliner takes hot calls first,
+ *                 with a larger size limit, and leaves cold ones alone
+ *               · a + - * / that mostly saw non-numbers calls the runtime
+ *                 directly instead of testing for two numbers first
+ *
+ * Sites the profile does not know (new or edited code) get no hint.  Only
+ * bodies that go through the IR are counted or hinted.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct { char *key; unsigned long long count[2]; } ProfEntry;
+
+static char *g_prof_gen = NULL;     /* --profile-generate: where the program
+                                     * writes its counts                   */
+static struct {
+    ProfEntry *slot;                /* open addressing, cap a power of two  */
+    size_t     cap, n;
+    unsigned long long max_call;    /* busiest direct call site             */
+    unsigned long long hash;        /* of the file (module cache keys)      */
+} g_prof;                           /* --profile-use                        */
+
+enum { PROF_BR, PROF_CALL, PROF_ARITH, PROF_KIND_COUNT };
+static const char *prof_kinds[PROF_KIND_COUNT] = { "br", "call", "arith" };
+
+/* Call sites at least this share of the busiest one are hot */
+#define PROF_HOT_PERCENT 1
+
+static const ProfEntry *prof_find(const char *key) {
+    if (!g_prof.cap) return NULL;
+    size_t i = (size_t)str_hash(key) & (g_prof.cap - 1);
+    for (; g_prof.slot[i].key; i = (i + 1) & (g_prof.cap - 1))
+        if (strcmp(g_prof.slot[i].key, key) == 0) return &g_prof.slot[i];
+    return NULL;
+}
+
+static void prof_free(void) {
+    for (size_t i = 0; i < g_prof.cap; i++) free(g_prof.slot[i].key);
+    free(g_prof.slot);
+    memset(&g_prof, 0, sizeof(g_prof));
+}
+
+/* Read a .xeprof ("<count0> <count1> <key>" lines, as xly_rt writes it). */
+static int prof_load(const char *path) {
+    FILE *in = fopen(path, "r");
+    if (!in) return -1;
+    prof_free();
+    g_prof.hash = 0xcbf29ce484222325ULL;
+    char *line = NULL;
+    size_t len = 0;
+    ssize_t got;
+    while ((got = getline(&line, &len, in)) > 0) {
+        for (ssize_t i = 0; i < got; i++) {
+            g_prof.hash ^= (unsigned char)line[i];
+            g_prof.hash *= 0x100000001b3ULL;
+        }
+        unsigned long long c0, c1;
+        char key[512];
+        if (line[0] == '#' || sscanf(line, "%llu %llu %511s", &c0, &c1, key) != 3) continue;
+        if (2 * (g_prof.n + 1) > g_prof.cap) {
+            ProfEntry *old = g_prof.slot;
+            size_t ocap = g_prof.cap;
+            g_prof.cap  = ocap ? ocap * 2 : 256;
+            g_prof.slot = calloc(g_prof.cap, sizeof(ProfEntry));
+            for (size_t i = 0; i < ocap; i++) {
+                if (!old[i].key) continue;
+                size_t k = (size_t)str_hash(old[i].key) & (g_prof.cap - 1);
+                while (g_prof.slot[k].key) k = (k + 1) & (g_prof.cap - 1);
+                g_prof.slot[k] = old[i];
+            }
+            free(old);
+        }
+        size_t k = (size_t)str_hash(key) & (g_prof.cap - 1);
+        while (g_prof.slot[k].key && strcmp(g_prof.slot[k].key, key) != 0)
+            k = (k + 1) & (g_prof.cap - 1);
+        if (!g_prof.slot[k].key) { g_prof.slot[k].key = strdup(key); g_prof.n++; }
+        g_prof.slot[k].count[0] += c0;
+        g_prof.slot[k].count[1] += c1;
+        if (strstr(key, "/call:") && g_prof.slot[k].count[0] > g_prof.max_call)
+            g_prof.max_call = g_prof.slot[k].count[0];
+    }
+    free(line);
+    fclose(in);
+    return 0;
+}
+
+/* Counter label of a site in the program being compiled. */
+static const char *prof_site_label(CG *cg, const char *key) {
+    return cgstr_intern(&cg->prof_sites, &cg->prof_site_count, &cg->prof_site_cap,
+                        &cg->prof_site_idx, ".Lxly_prof_", key);
+}
+
+/* The function part of the keys of funcs[fi] (-1: main). */
+static void prof_fn_id(CG *cg, int fi, char *buf, size_t sz) {
+    const char *unit = cg->unit ? cg->unit : "", *sep = cg->unit ? ":" : "";
+    if (fi < 0) { snprintf(buf, sz, "%s%smain", unit, sep); return; }
+    ASTNode *fn = cg->funcs[fi].node;
+    int cls = cg->funcs[fi].cls;
+    snprintf(buf, sz, "%s%s%s%s%s@%d", unit, sep,
+             cls >= 0 ? cg->classes[cls].name : "", cls >= 0 ? "." : "",
+             fn->str_value ? fn->str_value : "fn", fn->line);
+}
+
+/* funcs[fi] never ran in the profiled runs. */
+static int prof_fn_cold(CG *cg, int fi) {
+    if (!g_prof.cap) return 0;
+    char id[256], key[300];
+    prof_fn_id(cg, fi, id, sizeof(id));
+    snprintf(key, sizeof(key), "%s/entry", id);
+    const ProfEntry *e = prof_find(key);
+    return e && e->count[0] == 0;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * AST → SSA IR LOWERING  (shared by both backends)
+ *
+ * main and every function body whose statements only use the constructs
+ * accepted by ir_can_lower() are lowered to an IRFunc, optimized with
+ * ir_optimize() and emitted by the IR emitters of the active backend.
+ * Anything else (match, generators, bitwise ops, ...) keeps going
+ * through the direct AST emitters, so the IR path can grow one construct at
+ * a time without changing what compiles.
+ *
+ * Variables map to SSA variable ids; reads and writes go through
+ * ir_read_var()/ir_write_var() (see ir.h).  Top-level variables of main are
+ * also mirrored to __xly_globals so functions can read them; the ones that
+ * some function body assigns are kept in memory only ("mem" variables), so
+ * main always observes the latest value.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static FILE *g_ir_dump = NULL;      /* --emit-ir: optimized IR is printed here */
+
+typedef struct {
+    CG       *cg;
+    IRFunc   *f;
+    IRBlock  *cur;                  /* block receiving new instructions      */
+    int       is_main;
+
+    /* lexical variables, innermost last */
+    struct { char *name; int var; int depth; int gidx; int mem; } *vars;
+    int       nvars, vars_cap;
+    CGIndex   var_idx;
+    int       depth;
+    int       next_var;
+
+    /* enclosing loops, innermost last */
+    struct { IRBlock *brk, *cnt; } *loops;
+    int       nloops, loops_cap;
+
+    NameSet   fn_written;           /* main: names assigned inside fn bodies */
+
+    IRBlock  *self_head;            /* target of self tail calls (-O2)       */
+    int      *param_vars;           /* SSA variable of each param            */
+    int       cls;                  /* classes[] index in a method, else -1  */
+
+    /* profile sites (see "SHARED: profile feedback") */
+    int       prof;                 /* counting or using a profile           */
+    char      prof_fn[256];         /* function part of the site keys        */
+    long long prof_runs;            /* its entry count, -1 = unknown         */
+    struct { int kind, line, n; } *prof_seen;
+    int       nprof_seen, prof_seen_cap;
+} Lower;
+
+/* The parser marks a switch's default clause by name. */
+static int switch_is_default(ASTNode *c) {
+    return c->str_value && strcmp(c->str_value, "__default__") == 0;
+}
+
+/* An IR_SWITCH over `n` keys spanning lo..hi: dense enough for a table
+ * of label offsets, or a chain of compares.                            */
+static int switch_use_table(long long lo, long long hi, int n) {
+    return n >= 3 && hi - lo < 4LL * n && hi - lo < 1024;
+}
+
+/* ── can this subtree be lowered? ───────────────────────────────────────
+ * Nested FN_DECL / ARROW_FN bodies are separate functions and are checked
+ * when they are emitted.  `a64` limits calls to register-passed args.    */
+static int ir_can_lower(ASTNode *n, int a64) {
+    if (!n) return 1;
+    size_t need = 0;
+    switch (n->type) {
+    case NODE_FN_DECL:
+    case NODE_GEN_DECL:
+        return n->str_value != NULL && n->child_count > 0;
+    case NODE_YIELD_EMPTY:
+        return 1;
+    case NODE_YIELD:         need = 1; break;
+    case NODE_ARROW_FN:
+    case NODE_IMPORT:
+    case NODE_NULL:
+    case NODE_BREAK:
+    case NODE_CONTINUE:
+    case NODE_THIS:
+    case NODE_NUMBER:
+    case NODE_STRING:
+    case NODE_BOOL:
+        return 1;
+    case NODE_ENUM_DECL:
+        return 1;                   /* children are variant descriptors */
+    case NODE_CLASS_DECL:
+        return 1;                   /* methods are stashed by collect_classes */
+    case NODE_IDENTIFIER:
+        return n->str_value != NULL;
+
+    case NODE_BINARY: {
+        static const char *ops[] = { "+","-","*","/","%","<",">","<=",">=",
+                                     "==","!=","and","or", NULL };
+        int ok = 0;
+        for (int i = 0; n->str_value && ops[i]; i++)
+            if (strcmp(n->str_value, ops[i]) == 0) ok = 1;
+        if (!ok) return 0;
+        need = 2;
+        break;
+    }
+    case NODE_UNARY:
+        if (!n->str_value ||
+            (strcmp(n->str_value, "-") != 0 && strcmp(n->str_value, "not") != 0))
+            return 0;
+        need = 1;
+        break;
+    case NODE_COMPOUND_ASSIGN:
+        if (!n->str_value || n->child_count < 2 ||
+            !n->children[0] || n->children[0]->type != NODE_IDENTIFIER ||
+            !n->children[0]->str_value)
+            return 0;
+        break;
+    case NODE_FN_CALL:
+        if (!n->str_value || (a64 && n->child_count > 8)) return 0;
+        break;
+    case NODE_NEW:
+    case NODE_SUPER_CALL:           /* init takes the receiver ahead of the args */
+        if ((n->type == NODE_NEW && !n->str_value) || (a64 && n->child_count + 1 > 8))
+            return 0;
+        break;
+    case NODE_INSTANCEOF:
+        if (n->child_count < 2 || !n->children[1] || !n->children[1]->str_value) return 0;
+        return ir_can_lower(n->children[0], a64);
+    case NODE_METHOD_CALL:
+        if (!n->str_value || n->child_count < 1 || !n->children[0]) return 0;
+        if (n->children[0]->type == NODE_IDENTIFIER && !n->children[0]->str_value)
+            return 0;
+        break;
+    case NODE_OBJECT_LITERAL:
+        for (size_t i = 0; i < n->child_count; i++) {
+            ASTNode *p = n->children[i];
+            if (!p || p->type != NODE_NAMED_ARG || !p->str_value) return 0;
+            if (p->child_count > 0 && !ir_can_lower(p->children[0], a64)) return 0;
+        }
+        return 1;
+
+    case NODE_ASSIGN:        need = 1; /* fall through */
+    case NODE_INCREMENT:
+    case NODE_DECREMENT:
+    case NODE_VAR_DECL:
+    case NODE_CONST_DECL:
+        if (!n->str_value) return 0;
+        break;
+    case NODE_FOR_IN:
+    case NODE_FOR_OF:
+        if (!n->str_value) return 0;
+        need = 2;
+        break;
+    case NODE_PROPERTY_GET:  if (!n->str_value) return 0; need = 1; break;
+    case NODE_PROPERTY_SET:  if (!n->str_value) return 0; need = 2; break;
+    case NODE_IF:            need = 2; break;
+    case NODE_WHILE:         need = 2; break;
+    case NODE_DO_WHILE:
+    case NODE_UNLESS:
+    case NODE_REPEAT:
+    case NODE_NULLISH:
+    case NODE_PIPE_FORWARD:
+    case NODE_TERNARY:       need = 2; break;
+    case NODE_FOREVER:       need = 1; break;
+    case NODE_SWITCH:
+        for (size_t i = 1; i < n->child_count; i++) {
+            ASTNode *c = n->children[i];
+            if (!c || c->type != NODE_BLOCK) return 0;
+            if (!switch_is_default(c) && (c->child_count == 0 || !c->children[0]))
+                return 0;
+        }
+        need = 1;
+        break;
+    case NODE_MATCH:
+        if (n->child_count < 1 || !n->children[0] || !ir_can_lower(n->children[0], a64))
+            return 0;
+        for (size_t i = 1; i < n->child_count; i++) {
+            ASTNode *arm = n->children[i];
+            if (!arm || arm->type != NODE_MATCH_ARM || arm->child_count < 2 ||
+                !arm->children[0] || !arm->children[1])
+                return 0;
+            ASTNode *p = arm->children[0];
+            if ((!p->bool_value || p->bool_value == 2) && !p->str_value) return 0;
+            if (!ir_can_lower(arm->children[1], a64)) return 0;
+        }
+        return 1;
+    case NODE_FOR:           need = 4; break;
+    case NODE_INDEX:
+    case NODE_COMPUTED_PROP: need = 2; break;
+    case NODE_INDEX_ASSIGN:
+    case NODE_COMPUTED_PROP_SET: need = 3; break;
+    case NODE_TYPEOF:
+    case NODE_SPAWN:
+    case NODE_AWAIT:         need = 1; break;
+
+    case NODE_PROGRAM:
+    case NODE_BLOCK:
+    case NODE_RETURN:
+    case NODE_PRINT:
+    case NODE_EXPR_STMT:
+    case NODE_ARRAY_LITERAL:
+        break;
+    default:
+        return 0;
+    }
+    if (n->child_count < need) return 0;
+    for (size_t i = 0; i < n->child_count; i++) {
+        if (i < need && !n->children[i]) return 0;
+        if (!ir_can_lower(n->children[i], a64)) return 0;
+    }
+    return 1;
+}
+
+/* Names assigned anywhere inside a function body (main's pre-pass). */
+static void collect_fn_assigned(ASTNode *n, int in_fn, NameSet *out) {
+    if (!n) return;
+    if (in_fn) {
+        if ((n->type == NODE_ASSIGN || n->type == NODE_INCREMENT ||
+             n->type == NODE_DECREMENT) && n->str_value)
+            nameset_add(out, n->str_value);
+        if (n->type == NODE_COMPOUND_ASSIGN && n->child_count > 0 &&
+            n->children[0] && n->children[0]->type == NODE_IDENTIFIER &&
+            n->children[0]->str_value)
+            nameset_add(out, n->children[0]->str_value);
+    }
+    int inner = in_fn || n->type == NODE_FN_DECL || n->type == NODE_ARROW_FN ||
+                n->type == NODE_GEN_DECL || n->type == NODE_CLASS_DECL ||
+                n->type == NODE_BLOCK_FN;
+    for (size_t i = 0; i < n->child_count; i++)
+        collect_fn_assigned(n->children[i], inner, out);
+    for (size_t i = 0; i < n->param_count; i++)
+        if (n->params && n->params[i].default_value)
+            collect_fn_assigned(n->params[i].default_value, inner, out);
+}
+
+/* ── variables ──────────────────────────────────────────────────────── */
+static int lw_find(Lower *L, const char *name) {
+    return cgidx_find(&L->var_idx, CG_KEYS(L->vars, L->nvars, 0), name);
+}
+
+/* Redeclaring a name in the same scope reuses the variable (as var_declare). */
+static int lw_declare(Lower *L, const char *name, int gidx, int mem) {
+    int found = lw_find(L, name);
+    if (found >= 0 && L->vars[found].depth == L->depth) return found;
+    if (L->nvars >= L->vars_cap) {
+        L->vars_cap = L->vars_cap ? L->vars_cap * 2 : 16;
+        L->vars = realloc(L->vars, sizeof(L->vars[0]) * (size_t)L->vars_cap);
+    }
+    int i = L->nvars++;
+    L->vars[i].name  = strdup(name);
+    L->vars[i].var   = L->next_var++;
+    L->vars[i].depth = L->depth;
+    L->vars[i].gidx  = gidx;
+    L->vars[i].mem   = mem;
+    cgidx_add(&L->var_idx, CG_KEYS(L->vars, L->nvars, 0), i);
+    return i;
+}
+
+static void lw_scope_enter(Lower *L) { L->depth++; }
+static void lw_scope_leave(Lower *L) {
+    while (L->nvars > 0 && L->vars[L->nvars - 1].depth == L->depth)
+        free(L->vars[--L->nvars].name);
+    L->depth--;
+}
+
+static IRInstr *lw_null(Lower *L) {
+    return ir_emit(L->f, L->cur, IR_CONST_NULL, IRT_VAL);
+}
+
+static IRInstr *lw_global_load(Lower *L, int gidx) {
+    IRInstr *in = ir_emit(L->f, L->cur, IR_GLOBAL_LOAD, IRT_VAL);
+    in->imm = gidx;
+    return in;
+}
+
+static void lw_global_store(Lower *L, int gidx, IRInstr *val) {
+    IRInstr *in = ir_emit(L->f, L->cur, IR_GLOBAL_STORE, IRT_VOID);
+    in->imm = gidx;
+    ir_add_arg(in, val);
+}
+
+static IRInstr *lw_read(Lower *L, const char *name) {
+    int i = lw_find(L, name);
+    if (i >= 0)
+        return L->vars[i].mem ? lw_global_load(L, L->vars[i].gidx)
+                              : ir_read_var(L->f, L->cur, L->vars[i].var);
+    int gi = gvar_find(L->cg, name);
+    if (gi >= 0) return lw_global_load(L, gi);
+    if (fn_is_known(L->cg, name)) {
+        /* declared function used as a value */
+        int recv;
+        IRInstr *in = ir_emit(L->f, L->cur, IR_MAKE_FN, IRT_VAL);
+        in->sym = strdup(fn_value_label(L->cg, name, &recv));
+        in->imm = recv;
+        return in;
+    }
+    return lw_null(L);
+}
+
+static void lw_write(Lower *L, const char *name, IRInstr *val) {
+    int i = lw_find(L, name);
+    if (i < 0) {
+        int gi = gvar_find(L->cg, name);
+        if (gi >= 0) { lw_global_store(L, gi, val); return; }
+        i = lw_declare(L, name, -1, 0);
+    }
+    if (!L->vars[i].mem)
+        ir_write_var(L->cur, L->vars[i].var, val);
+    if (L->vars[i].gidx >= 0)
+        lw_global_store(L, L->vars[i].gidx, val);
+}
+
+/* ── blocks / control flow ──────────────────────────────────────────── */
+
+/* Code after break/continue/return/sys.exit lands in a block nobody jumps
+ * to; ir_order_blocks() drops it.                                        */
+static void lw_dead_block(Lower *L) {
+    L->cur = ir_block_new(L->f);
+    ir_seal_block(L->f, L->cur);
+}
+
+static void lw_loop_push(Lower *L, IRBlock *brk, IRBlock *cnt) {
+    if (L->nloops >= L->loops_cap) {
+        L->loops_cap = L->loops_cap ? L->loops_cap * 2 : 8;
+        L->loops = realloc(L->loops, sizeof(L->loops[0]) * (size_t)L->loops_cap);
+    }
+    L->loops[L->nloops].brk = brk;
+    L->loops[L->nloops].cnt = cnt;
+    L->nloops++;
+}
+
+static IRInstr *lw_expr(Lower *L, ASTNode *n);
+static void     lw_stmt(Lower *L, ASTNode *n);
+
+/* Poll for a waiting collection at the top of every loop and function
+ * body, so code that never allocates still reaches a safepoint. */
+static void lw_safepoint(Lower *L) {
+    ir_emit(L->f, L->cur, IR_SAFEPOINT, IRT_VOID);
+}
+
+/* ── profile sites ──────────────────────────────────────────────────── */
+
+/* --profile-generate: bump counter k of site `key` in the current block. */
+static void lw_prof_count(Lower *L, const char *key, int k) {
+    IRInstr *in = ir_emit(L->f, L->cur, IR_PROF_COUNT, IRT_VOID);
+    in->sym = strdup(prof_site_label(L->cg, key));
+    in->imm = k;
+}
+
+/* Start the sites of funcs[fi] (-1: main) and count its entry. */
+static void lw_prof_enter(Lower *L, int fi) {
+    L->prof_runs = -1;
+    L->prof = L->cg->prof_gen || g_prof.cap;
+    if (!L->prof) return;
+    char key[300];
+    prof_fn_id(L->cg, fi, L->prof_fn, sizeof(L->prof_fn));
+    snprintf(key, sizeof(key), "%s/entry", L->prof_fn);
+    if (L->cg->prof_gen) lw_prof_count(L, key, 0);
+    const ProfEntry *e = prof_find(key);
+    if (e) L->prof_runs = (long long)e->count[0];
+}
+
+/* Key of the next site of `kind` on `line`, or NULL if nothing is counted. */
+static const char *lw_prof_key(Lower *L, int kind, int line, char *buf, size_t sz) {
+    if (!L->prof) return NULL;
+    int i = 0;
+    while (i < L->nprof_seen && (L->prof_seen[i].kind != kind || L->prof_seen[i].line != line)) i++;
+    if (i == L->nprof_seen) {
+        if (L->nprof_seen >= L->prof_seen_cap) {
+            L->prof_seen_cap = L->prof_seen_cap ? L->prof_seen_cap * 2 : 16;
+            L->prof_seen = realloc(L->prof_seen, sizeof(L->prof_seen[0]) * (size_t)L->prof_seen_cap);
+        }
+        L->prof_seen[i].kind = kind;
+        L->prof_seen[i].line = line;
+        L->prof_seen[i].n    = 0;
+        L->nprof_seen++;
+    }
+    snprintf(buf, sz, "%s/%s:%d.%d", L->prof_fn, prof_kinds[kind], line, L->prof_seen[i].n++);
+    return buf;
+}
+
+/* A direct call about to be made: counted when generating.  Returns its
+ * hint: +1 hot, -1 never made although the function ran, 0 unknown.   */
+static int lw_prof_call(Lower *L, ASTNode *n) {
+    char key[300];
+    if (!lw_prof_key(L, PROF_CALL, n->line, key, sizeof(key))) return 0;
+    if (L->cg->prof_gen) lw_prof_count(L, key, 0);
+    const ProfEntry *e = prof_find(key);
+    if (!e) return 0;
+    if (e->count[0] == 0) return L->prof_runs > 0 ? -1 : 0;
+    return e->count[0] * 100 >= g_prof.max_call * PROF_HOT_PERCENT ? 1 : 0;
+}
+
+/* A boxed + - * /: the emitter counts its runs and runtime calls when
+ * generating; hinted when the operands were mostly not two numbers.   */
+static void lw_prof_arith(Lower *L, ASTNode *n, IRInstr *in) {
+    char key[300];
+    if (in->op < IR_ADD || in->op > IR_DIV ||
+        !lw_prof_key(L, PROF_ARITH, n->line, key, sizeof(key)))
+        return;
+    if (L->cg->prof_gen) in->prof = strdup(prof_site_label(L->cg, key));
+    const ProfEntry *e = prof_find(key);
+    if (e && e->count[0] > 0 && 2 * e->count[1] > e->count[0]) in->hint = -1;
+}
+
+/* Branch on the truthiness of `n`.  With a profile the edges go through
+ * blocks of their own: counting blocks when generating, a cold block for
+ * an edge the profiled runs never took.                                 */
+static void lw_cond(Lower *L, ASTNode *n, IRBlock *t, IRBlock *e) {
+    IRInstr *v = lw_expr(L, n);
+    IRInstr *c = ir_unop(L->f, L->cur, IR_TRUTHY, IRT_BOOL, v);
+    char key[300];
+    if (!lw_prof_key(L, PROF_BR, n->line, key, sizeof(key))) {
+        ir_br(L->f, L->cur, c, t, e);
+        return;
+    }
+    const ProfEntry *pe = prof_find(key);
+    IRBlock *from = L->cur, *to[2] = { t, e }, *edge[2] = { t, e };
+    for (int k = 0; k < 2; k++) {
+        int cold = pe && pe->count[k] == 0 && pe->count[!k] > 0;
+        if (!cold && !L->cg->prof_gen) continue;
+        edge[k] = ir_block_new(L->f);
+        edge[k]->cold = cold;
+    }
+    ir_br(L->f, from, c, edge[0], edge[1]);
+    for (int k = 0; k < 2; k++) {
+        if (edge[k] == to[k]) continue;
+        ir_seal_block(L->f, edge[k]);
+        L->cur = edge[k];
+        if (L->cg->prof_gen) lw_prof_count(L, key, k);
+        ir_jmp(L->f, edge[k], to[k]);
+    }
+    L->cur = from;
+}
+
+/* Operands must all be evaluated before the instruction consuming them is
+ * appended: evaluating one may itself emit code (or even new blocks).    */
+static IRInstr **lw_eval_list(Lower *L, ASTNode **nodes, size_t n) {
+    IRInstr **vals = malloc(sizeof(IRInstr *) * (n ? n : 1));
+    for (size_t i = 0; i < n; i++) vals[i] = lw_expr(L, nodes[i]);
+    return vals;
+}
+
+static IRInstr *lw_emit_n(Lower *L, IROp op, IRType type, IRInstr *first,
+                          IRInstr **vals, size_t n) {
+    IRInstr *in = ir_emit(L->f, L->cur, op, type);
+    if (first) ir_add_arg(in, first);
+    for (size_t i = 0; i < n; i++) ir_add_arg(in, vals[i]);
+    return in;
+}
+
+static IROp lw_binop(const char *op) {
+    static const struct { const char *s; IROp op; } T[] = {
+        {"+",IR_ADD},{"-",IR_SUB},{"*",IR_MUL},{"/",IR_DIV},{"%",IR_MOD},
+        {"<",IR_LT},{">",IR_GT},{"<=",IR_LE},{">=",IR_GE},
+        {"==",IR_EQ},{"!=",IR_NE},{NULL,IR_ADD}
+    };
+    for (int i = 0; T[i].s; i++)
+        if (strcmp(op, T[i].s) == 0) return T[i].op;
+    return IR_ADD;
+}
+
+/* `and` / `or`: short-circuit through a temporary SSA variable. */
+static IRInstr *lw_logical(Lower *L, ASTNode *n, int is_and) {
+    int tmp = L->next_var++;
+    IRInstr *l = lw_expr(L, n->children[0]);
+    ir_write_var(L->cur, tmp, l);
+    IRInstr *c = ir_unop(L->f, L->cur, IR_TRUTHY, IRT_BOOL, l);
+    IRBlock *rhs = ir_block_new(L->f), *join = ir_block_new(L->f);
+    if (is_and) ir_br(L->f, L->cur, c, rhs, join);
+    else        ir_br(L->f, L->cur, c, join, rhs);
+    ir_seal_block(L->f, rhs);
+    L->cur = rhs;
+    ir_write_var(L->cur, tmp, lw_expr(L, n->children[1]));
+    ir_jmp(L->f, L->cur, join);
+    ir_seal_block(L->f, join);
+    L->cur = join;
+    return ir_read_var(L->f, L->cur, tmp);
+}
+
+static IRInstr *lw_call(Lower *L, ASTNode *n) {
+    CG *cg = L->cg;
+    const char *name = n->str_value;
+    if (variant_find(cg, name) >= 0) {
+        IRInstr **vals = lw_eval_list(L, n->children, n->child_count);
+        IRInstr *in = lw_emit_n(L, IR_MAKE_VARIANT, IRT_VAL, NULL, vals, n->child_count);
+        in->sym = strdup(name);
+        in->imm = variant_id(cg, name);
+        free(vals);
+        return in;
+    }
+    if (fn_is_known(cg, name)) {
+        IRInstr **vals = lw_eval_list(L, n->children, n->child_count);
+        int hint = lw_prof_call(L, n);
+        IRInstr *in = lw_emit_n(L, IR_CALL, IRT_VAL, NULL, vals, n->child_count);
+        in->sym  = strdup(fn_resolve_label(cg, name));
+        in->imm  = fn_callee_arity(cg, in->sym);
+        in->hint = hint;
+        free(vals);
+        return in;
+    }
+    if (lw_find(L, name) >= 0 || gvar_find(cg, name) >= 0) {
+        IRInstr *fnv = lw_read(L, name);
+        IRInstr **vals = lw_eval_list(L, n->children, n->child_count);
+        IRInstr *in = lw_emit_n(L, IR_CALL_VALUE, IRT_VAL, fnv, vals, n->child_count);
+        free(vals);
+        return in;
+    }
+    return lw_null(L);
+}
+
+/* spawn f(args): the function value and the arguments now, the call on a
+ * worker thread (xly_spawn).  What is not a call of a function runs here. */
+static IRInstr *lw_spawn(Lower *L, ASTNode *call) {
+    const char *name = call->str_value;
+    if (call->type != NODE_FN_CALL || variant_find(L->cg, name) >= 0 ||
+        (!fn_is_known(L->cg, name) && lw_find(L, name) < 0 && gvar_find(L->cg, name) < 0)) {
+        lw_expr(L, call);
+        return lw_null(L);
+    }
+    IRInstr *fnv = lw_read(L, name);
+    IRInstr **vals = lw_eval_list(L, call->children, call->child_count);
+    IRInstr *in = lw_emit_n(L, IR_SPAWN, IRT_VAL, fnv, vals, call->child_count);
+    free(vals);
+    return in;
+}
+
+static IRInstr *lw_method_call(Lower *L, ASTNode *n) {
+    CG *cg = L->cg;
+    ASTNode *recv = n->children[0];
+    const char *method = n->str_value;
+    size_t argc = n->child_count - 1;
+    int is_obj = recv->type != NODE_IDENTIFIER ||
+                 lw_find(L, recv->str_value) >= 0 ||
+                 gvar_find(cg, recv->str_value) >= 0;
+
+    if (is_obj) {
+        /* a class method name: dispatch through the receiver's vtable when
+         * the args fit in registers behind it */
+        int sel = selector_find(cg, method);
+        IRInstr *obj = lw_expr(L, recv);
+        IRInstr **vals = lw_eval_list(L, n->children + 1, argc);
+        int virt = sel >= 0 && argc + 1 <= 6;
+        IRInstr *in = lw_emit_n(L, virt ? IR_CALL_VIRT : IR_CALL_METHOD, IRT_VAL,
+                                obj, vals, argc);
+        in->sym = strdup(method);
+        if (virt) in->imm = sel;
+        free(vals);
+        return in;
+    }
+
+    const char *mod = recv->str_value;
+    const UnitImport *ux = unit_export_call(cg, mod, method);
+    if (ux) {
+        IRInstr **vals = lw_eval_list(L, n->children + 1, argc);
+        IRInstr *in = lw_emit_n(L, IR_CALL, IRT_VAL, NULL, vals, argc);
+        in->sym = strdup(ux->label);
+        in->imm = ux->arity;
+        free(vals);
+        return in;
+    }
+    int is_sys = strcmp(mod, "sys") == 0;
+    long long cval;
+    if (cg->opt_level >= 2 && is_sys && argc == 0 && sys_const_lookup(method, &cval)) {
+        cg->stat_sys_inline++;
+        return ir_const_num(L->f, L->cur, (double)cval);
+    }
+    IRInstr **vals = lw_eval_list(L, n->children + 1, argc);
+    char nsym[128];
+    if (module_native(mod, method, nsym, sizeof(nsym))) {
+        IRInstr *in = lw_emit_n(L, IR_CALL_NATIVE, IRT_VAL, NULL, vals, argc);
+        in->sym = strdup(nsym);
+        in->imm = module_native_op(mod, method, (int)argc);
+        cg->stat_native_calls++;
+        free(vals);
+        return in;
+    }
+    IRInstr *in = lw_emit_n(L, IR_CALL_MODULE, IRT_VAL, NULL, vals, argc);
+    in->sym  = strdup(mod);
+    in->sym2 = strdup(method);
+    free(vals);
+    if (cg->opt_level >= 1 && is_sys &&
+        (strcmp(method, "exit") == 0 || strcmp(method, "abort") == 0)) {
+        in->noreturn = 1;
+        cg->stat_noreturn_elim++;
+        ir_unreachable(L->f, L->cur);
+        lw_dead_block(L);
+    }
+    return in;
+}
+
+/* Direct call of the init body funcs[fi] on `self`. */
+static void lw_init_call(Lower *L, int fi, IRInstr *self, ASTNode **args, size_t argc) {
+    IRInstr **vals = lw_eval_list(L, args, argc);
+    IRInstr *in = lw_emit_n(L, IR_CALL, IRT_VAL, self, vals, argc);
+    in->sym = strdup(L->cg->funcs[fi].asm_label);
+    in->imm = fn_callee_arity(L->cg, in->sym);
+    free(vals);
+}
+
+/* new C(args): allocate with the layout of C, then call its init directly. */
+static IRInstr *lw_new(Lower *L, ASTNode *n) {
+    int ci = class_find(L->cg, n->str_value);
+    if (ci < 0) return lw_null(L);
+    IRInstr *obj = ir_emit(L->f, L->cur, IR_NEW, IRT_VAL);
+    obj->imm = ci;
+    int fi = L->cg->classes[ci].init_fi;
+    if (fi >= 0) lw_init_call(L, fi, obj, n->children, n->child_count);
+    return obj;
+}
+
+/* Slot of `this.NAME` inside a method of a class laying NAME out, else -1. */
+static int lw_field_slot(Lower *L, ASTNode *n) {
+    if (L->cls < 0 || n->children[0]->type != NODE_THIS) return -1;
+    return class_field_slot(L->cg, L->cls, n->str_value);
+}
+
+static IRInstr *lw_arrow_fn(Lower *L, ASTNode *n) {
+    char name[64];
+    NameSet free_vars = {0}, captures = {0};
+    arrow_fn_prepare(L->cg, n, name, sizeof(name), &free_vars);
+    for (int i = 0; i < free_vars.count; i++)
+        if (lw_find(L, free_vars.names[i]) >= 0)
+            nameset_add(&captures, free_vars.names[i]);
+    int recv = nameset_has(&free_vars, "this") && !nameset_has(&captures, "this");
+    nameset_free(&free_vars);
+
+    IRInstr **vals = malloc(sizeof(IRInstr *) * (size_t)(captures.count ? captures.count : 1));
+    for (int i = 0; i < captures.count; i++)
+        vals[i] = lw_read(L, captures.names[i]);
+    IRInstr *in = lw_emit_n(L, captures.count ? IR_MAKE_CLOSURE : IR_MAKE_FN,
+                            IRT_VAL, NULL, vals, (size_t)captures.count);
+    in->sym = strdup(name);
+    in->imm = recv;
+    free(vals);
+    fn_stash(L->cg, recv ? fn_with_receiver(n) : n, name, captures.names, captures.count);
+    return in;
+}
+
+/* x op= rhs, x++ / x--: the expression value is the new value. */
+static IRInstr *lw_update(Lower *L, const char *name, IROp op, ASTNode *rhs) {
+    IRInstr *cur = lw_read(L, name);
+    IRInstr *r   = rhs ? lw_expr(L, rhs) : ir_const_num(L->f, L->cur, 1.0);
+    IRInstr *v   = ir_binop(L->f, L->cur, op, IRT_VAL, cur, r);
+    lw_write(L, name, v);
+    return v;
+}
+
+/* cond ? a : b — the chosen value flows through a temporary. */
+static IRInstr *lw_ternary(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    int tmp = L->next_var++;
+    IRBlock *then_b = ir_block_new(f), *else_b = ir_block_new(f);
+    IRBlock *join = ir_block_new(f);
+    lw_cond(L, n->children[0], then_b, else_b);
+    ir_seal_block(f, then_b);
+    L->cur = then_b;
+    ir_write_var(L->cur, tmp, lw_expr(L, n->children[1]));
+    ir_jmp(f, L->cur, join);
+    ir_seal_block(f, else_b);
+    L->cur = else_b;
+    ir_write_var(L->cur, tmp, n->child_count > 2 ? lw_expr(L, n->children[2]) : lw_null(L));
+    ir_jmp(f, L->cur, join);
+    ir_seal_block(f, join);
+    L->cur = join;
+    return ir_read_var(f, L->cur, tmp);
+}
+
+/* a ?? b: b only when a is null (or an omitted argument). */
+static IRInstr *lw_nullish(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    int tmp = L->next_var++;
+    IRInstr *l = lw_expr(L, n->children[0]);
+    ir_write_var(L->cur, tmp, l);
+    IRBlock *test = ir_block_new(f), *rhs = ir_block_new(f), *join = ir_block_new(f);
+    ir_br(f, L->cur, ir_unop(f, L->cur, IR_IS_MISSING, IRT_BOOL, l), rhs, test);
+    ir_seal_block(f, test);
+    L->cur = test;
+    IRInstr *eq = ir_binop(f, L->cur, IR_EQ, IRT_VAL, l, lw_null(L));
+    ir_br(f, L->cur, ir_unop(f, L->cur, IR_TRUTHY, IRT_BOOL, eq), rhs, join);
+    ir_seal_block(f, rhs);
+    L->cur = rhs;
+    ir_write_var(L->cur, tmp, lw_expr(L, n->children[1]));
+    ir_jmp(f, L->cur, join);
+    ir_seal_block(f, join);
+    L->cur = join;
+    return ir_read_var(f, L->cur, tmp);
+}
+
+/* x |> fn: a direct call when fn names a declared function. */
+static IRInstr *lw_pipe(Lower *L, ASTNode *n) {
+    CG *cg = L->cg;
+    ASTNode *fn = n->children[1];
+    IRInstr *arg = lw_expr(L, n->children[0]);
+    if (fn->type == NODE_IDENTIFIER && lw_find(L, fn->str_value) < 0 &&
+        gvar_find(cg, fn->str_value) < 0 && fn_is_known(cg, fn->str_value)) {
+        IRInstr *in = lw_emit_n(L, IR_CALL, IRT_VAL, NULL, &arg, 1);
+        in->sym = strdup(fn_resolve_label(cg, fn->str_value));
+        in->imm = fn_callee_arity(cg, in->sym);
+        return in;
+    }
+    IRInstr *fnv = lw_expr(L, fn);
+    return lw_emit_n(L, IR_CALL_VALUE, IRT_VAL, fnv, &arg, 1);
+}
+
+/* Value of a match arm: an expression, or a block yielding its last
+ * expression statement. */
+static IRInstr *lw_arm_value(Lower *L, ASTNode *r) {
+    if (r->type != NODE_BLOCK) return lw_expr(L, r);
+    IRInstr *v = NULL;
+    lw_scope_enter(L);
+    for (size_t i = 0; i < r->child_count; i++) {
+        ASTNode *s = r->children[i];
+        if (i + 1 < r->child_count)   lw_stmt(L, s);
+        else if (s && s->type == NODE_EXPR_STMT && s->child_count > 0)
+                                      v = lw_expr(L, s->children[0]);
+        else                          v = lw_expr(L, s);
+    }
+    lw_scope_leave(L);
+    return v ? v : lw_null(L);
+}
+
+static int pattern_is_wild(ASTNode *p) {
+    return p->str_value && strcmp(p->str_value, "_") == 0;
+}
+
+static IRBlock *lw_match_fail(Lower *L, IRBlock **fail, int line) {
+    if (!*fail) {
+        *fail = ir_block_new(L->f);
+        IRInstr *in = ir_emit(L->f, *fail, IR_MATCH_FAIL, IRT_VOID);
+        in->imm = line;
+        ir_unreachable(L->f, *fail);
+    }
+    return *fail;
+}
+
+/* Variant patterns only, at least two of them tags this program defines:
+ * dispatch once on the tag id instead of testing arm by arm. */
+static int lw_match_by_tag(CG *cg, ASTNode *n) {
+    int tags = 0;
+    for (size_t a = 1; a < n->child_count; a++) {
+        ASTNode *p = n->children[a]->children[0];
+        if (p->bool_value) return 0;
+        if (!pattern_is_wild(p) && variant_id(cg, p->str_value)) tags++;
+    }
+    return tags >= 2;
+}
+
+/* match subject { pattern => value, ... }
+ *
+ * The interpreter tries the arms in order: `_` matches anything, literals
+ * match equal values, and an identifier matches a variant carrying that
+ * tag (binding its fields) or, for a non-variant subject and no field
+ * list, anything (binding the subject).  Variant tests compare the tag id
+ * set by xly_make_variant; with lw_match_by_tag a single switch on that
+ * id picks the arm.                                                      */
+static IRInstr *lw_match(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    CG *cg = L->cg;
+    int tmp = L->next_var++;
+    size_t narms = n->child_count - 1;
+    IRInstr *subj = lw_expr(L, n->children[0]);
+    IRInstr *tag  = ir_unop(f, L->cur, IR_VARIANT_TAG, IRT_I64, subj);
+    IRInstr *zero = ir_emit(f, L->cur, IR_ICONST, IRT_I64);
+    IRBlock **arm = malloc(sizeof(IRBlock *) * (narms ? narms : 1));
+    IRBlock *join = ir_block_new(f), *fail = NULL;
+    for (size_t a = 0; a < narms; a++) arm[a] = ir_block_new(f);
+
+    if (lw_match_by_tag(cg, n)) {
+        /* tags up to the first `_` go straight to their arm; anything
+         * else falls to the first arm that takes it */
+        IRBlock *other = ir_block_new(f);
+        IRInstr *sw = ir_switch(f, L->cur, tag, other);
+        long long any = -1, nonvariant = -1;
+        for (size_t a = 0; a < narms; a++) {
+            ASTNode *p = n->children[a + 1]->children[0];
+            if (pattern_is_wild(p)) {
+                if (any < 0) any = (long long)a;
+                if (nonvariant < 0) nonvariant = (long long)a;
+                break;
+            }
+            if (p->param_count == 0 && nonvariant < 0) nonvariant = (long long)a;
+            int id = variant_id(cg, p->str_value);
+            int seen = 0;
+            for (int c = 1; c < sw->ncases; c++) seen |= sw->keys[c] == id;
+            if (id && !seen) ir_switch_case(sw, id, arm[a]);
+        }
+        ir_seal_block(f, other);
+        L->cur = other;
+        IRBlock *to_any = any >= 0 ? arm[any] : lw_match_fail(L, &fail, n->line);
+        IRBlock *to_val = nonvariant >= 0 ? arm[nonvariant] : lw_match_fail(L, &fail, n->line);
+        if (to_any == to_val) ir_jmp(f, L->cur, to_any);
+        else ir_br(f, L->cur, ir_binop(f, L->cur, IR_ILT, IRT_BOOL, tag, zero), to_val, to_any);
+    } else {
+        for (size_t a = 0; a < narms; a++) {
+            ASTNode *p = n->children[a + 1]->children[0];
+            IRBlock *next = ir_block_new(f);
+            if (pattern_is_wild(p)) {
+                ir_jmp(f, L->cur, arm[a]);
+            } else if (p->bool_value) {
+                IRInstr *lit;
+                if (p->bool_value == 1) {
+                    lit = ir_const_num(f, L->cur, p->num_value);
+                } else if (p->bool_value == 2) {
+                    lit = ir_emit(f, L->cur, IR_CONST_STR, IRT_VAL);
+                    lit->sym = strdup(p->str_value ? p->str_value : "");
+                } else {
+                    lit = ir_emit(f, L->cur, IR_CONST_BOOL, IRT_VAL);
+                    lit->imm = p->bool_value == 3;
+                }
+                IRInstr *eq = ir_binop(f, L->cur, IR_EQ, IRT_VAL, subj, lit);
+                ir_br(f, L->cur, ir_unop(f, L->cur, IR_TRUTHY, IRT_BOOL, eq), arm[a], next);
+            } else {
+                IRInstr *id = ir_emit(f, L->cur, IR_ICONST, IRT_I64);
+                id->imm = variant_id(cg, p->str_value);
+                IRInstr *is_tag = ir_binop(f, L->cur, IR_IEQ, IRT_BOOL, tag, id);
+                if (p->param_count > 0) {
+                    ir_br(f, L->cur, is_tag, arm[a], next);
+                } else {
+                    IRBlock *variant = ir_block_new(f);
+                    ir_br(f, L->cur, ir_binop(f, L->cur, IR_ILT, IRT_BOOL, tag, zero),
+                          arm[a], variant);
+                    ir_seal_block(f, variant);
+                    L->cur = variant;
+                    ir_br(f, L->cur, is_tag, arm[a], next);
+                }
+            }
+            ir_seal_block(f, next);
+            L->cur = next;
+        }
+        ir_jmp(f, L->cur, lw_match_fail(L, &fail, n->line));
+    }
+    if (fail) ir_seal_block(f, fail);
+
+    for (size_t a = 0; a < narms; a++) {
+        ASTNode *p = n->children[a + 1]->children[0];
+        ir_seal_block(f, arm[a]);
+        L->cur = arm[a];
+        lw_scope_enter(L);
+        if (!pattern_is_wild(p) && !p->bool_value) {
+            if (p->param_count == 0) {
+                int v = lw_declare(L, p->str_value, -1, 0);
+                ir_write_var(L->cur, L->vars[v].var, subj);
+            }
+            for (size_t j = 0; j < p->param_count; j++) {
+                IRInstr *fld = ir_unop(f, L->cur, IR_VARIANT_FIELD, IRT_VAL, subj);
+                fld->imm = (long long)j;
+                int v = lw_declare(L, p->params[j].name, -1, 0);
+                ir_write_var(L->cur, L->vars[v].var, fld);
+            }
+        }
+        ir_write_var(L->cur, tmp, lw_arm_value(L, n->children[a + 1]->children[1]));
+        lw_scope_leave(L);
+        ir_jmp(f, L->cur, join);
+    }
+    free(arm);
+    ir_seal_block(f, join);
+    L->cur = join;
+    return ir_read_var(f, L->cur, tmp);
+}
+
+static IRInstr *lw_expr(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    if (!n) return lw_null(L);
+
+    switch (n->type) {
+    case NODE_NUMBER:
+        return ir_const_num(f, L->cur, n->num_value);
+    case NODE_STRING: {
+        IRInstr *in = ir_emit(f, L->cur, IR_CONST_STR, IRT_VAL);
+        in->sym = strdup(n->str_value ? n->str_value : "");
+        return in;
+    }
+    case NODE_BOOL: {
+        IRInstr *in = ir_emit(f, L->cur, IR_CONST_BOOL, IRT_VAL);
+        in->imm = n->bool_value ? 1 : 0;
+        return in;
+    }
+    case NODE_NULL:
+        return lw_null(L);
+    case NODE_THIS:
+        /* the receiver param (or a closure's capture of it); none in a
+         * declared fn's plain body, called by name                       */
+        if (lw_find(L, "this") >= 0) return lw_read(L, "this");
+        return lw_null(L);
+    case NODE_IDENTIFIER:
+        return lw_read(L, n->str_value);
+
+    case NODE_NEW:
+        return lw_new(L, n);
+    case NODE_SUPER_CALL: {
+        int p  = L->cls >= 0 ? L->cg->classes[L->cls].parent : -1;
+        int fi = p >= 0 ? L->cg->classes[p].init_fi : -1;
+        if (fi >= 0) lw_init_call(L, fi, lw_read(L, "this"), n->children, n->child_count);
+        return lw_null(L);
+    }
+    case NODE_INSTANCEOF: {
+        IRInstr *v = lw_expr(L, n->children[0]);
+        int ci = class_find(L->cg, n->children[1]->str_value);
+        if (ci < 0) {
+            IRInstr *in = ir_emit(f, L->cur, IR_CONST_BOOL, IRT_VAL);
+            in->imm = 0;
+            return in;
+        }
+        IRInstr *in = ir_unop(f, L->cur, IR_INSTANCEOF, IRT_VAL, v);
+        in->imm = ci;
+        return in;
+    }
+
+    case NODE_BINARY: {
+        if (strcmp(n->str_value, "and") == 0) return lw_logical(L, n, 1);
+        if (strcmp(n->str_value, "or")  == 0) return lw_logical(L, n, 0);
+        IRInstr *a = lw_expr(L, n->children[0]);
+        IRInstr *b = lw_expr(L, n->children[1]);
+        IRInstr *in = ir_binop(f, L->cur, lw_binop(n->str_value), IRT_VAL, a, b);
+        lw_prof_arith(L, n, in);
+        return in;
+    }
+    case NODE_UNARY: {
+        IRInstr *a = lw_expr(L, n->children[0]);
+        return ir_unop(f, L->cur, n->str_value[0] == '-' ? IR_NEG : IR_NOT, IRT_VAL, a);
+    }
+    case NODE_TYPEOF:
+        return ir_unop(f, L->cur, IR_TYPEOF, IRT_VAL, lw_expr(L, n->children[0]));
+
+    case NODE_ASSIGN: {
+        IRInstr *v = lw_expr(L, n->children[0]);
+        lw_write(L, n->str_value, v);
+        return v;
+    }
+    case NODE_COMPOUND_ASSIGN: {
+        const char *op = n->str_value;
+        IROp o = strcmp(op, "-=") == 0 ? IR_SUB
+               : strcmp(op, "*=") == 0 ? IR_MUL
+               : strcmp(op, "/=") == 0 ? IR_DIV
+               : strcmp(op, "%=") == 0 ? IR_MOD : IR_ADD;
+        return lw_update(L, n->children[0]->str_value, o, n->children[1]);
+    }
+    case NODE_INCREMENT:
+        return lw_update(L, n->str_value, IR_ADD, NULL);
+    case NODE_DECREMENT:
+        return lw_update(L, n->str_value, IR_SUB, NULL);
+
+    case NODE_FN_CALL:
+        return lw_call(L, n);
+    case NODE_METHOD_CALL:
+        return lw_method_call(L, n);
+    case NODE_ARROW_FN:
+        return lw_arrow_fn(L, n);
+
+    case NODE_ARRAY_LITERAL: {
+        IRInstr **vals = lw_eval_list(L, n->children, n->child_count);
+        IRInstr *in = lw_emit_n(L, IR_ARRAY, IRT_VAL, NULL, vals, n->child_count);
+        free(vals);
+        return in;
+    }
+    case NODE_INDEX:
+    case NODE_COMPUTED_PROP: {
+        IRInstr *a = lw_expr(L, n->children[0]);
+        IRInstr *k = lw_expr(L, n->children[1]);
+        return ir_binop(f, L->cur, IR_INDEX, IRT_VAL, a, k);
+    }
+    case NODE_INDEX_ASSIGN:
+    case NODE_COMPUTED_PROP_SET: {
+        IRInstr **vals = lw_eval_list(L, n->children, 3);
+        IRInstr *in = lw_emit_n(L, IR_INDEX_SET, IRT_VAL, NULL, vals, 3);
+        free(vals);
+        return in;
+    }
+    case NODE_OBJECT_LITERAL: {
+        IRInstr *obj = ir_emit(f, L->cur, IR_OBJECT_NEW, IRT_VAL);
+        for (size_t i = 0; i < n->child_count; i++) {
+            ASTNode *pair = n->children[i];
+            IRInstr *v = pair->child_count > 0 ? lw_expr(L, pair->children[0]) : lw_null(L);
+            IRInstr *set = ir_emit(f, L->cur, IR_PROP_SET, IRT_VOID);
+            ir_add_arg(set, obj);
+            ir_add_arg(set, v);
+            set->sym = strdup(pair->str_value);
+        }
+        return obj;
+    }
+    case NODE_PROPERTY_GET: {
+        int slot = lw_field_slot(L, n);
+        IRInstr *obj = lw_expr(L, n->children[0]);
+        IRInstr *in = ir_unop(f, L->cur, slot >= 0 ? IR_FIELD_GET : IR_PROP_GET, IRT_VAL, obj);
+        in->sym = strdup(n->str_value);
+        if (slot >= 0) in->imm = slot;
+        return in;
+    }
+    case NODE_PROPERTY_SET: {
+        int slot = lw_field_slot(L, n);
+        IRInstr *obj = lw_expr(L, n->children[0]);
+        IRInstr *v   = lw_expr(L, n->children[1]);
+        if (slot >= 0) {
+            IRInstr *set = ir_emit(f, L->cur, IR_FIELD_SET, IRT_VOID);
+            ir_add_arg(set, obj);
+            ir_add_arg(set, v);
+            set->sym = strdup(n->str_value);
+            set->imm = slot;
+            return lw_null(L);
+        }
+        IRInstr *set = ir_emit(f, L->cur, IR_PROP_SET, IRT_VOID);
+        ir_add_arg(set, obj);
+        ir_add_arg(set, v);
+        set->sym = strdup(n->str_value);
+        return lw_null(L);                  /* as in the interpreter */
+    }
+
+    case NODE_TERNARY:
+        return lw_ternary(L, n);
+    case NODE_NULLISH:
+        return lw_nullish(L, n);
+    case NODE_PIPE_FORWARD:
+        return lw_pipe(L, n);
+    case NODE_MATCH:
+        return lw_match(L, n);
+
+    case NODE_SPAWN:
+        return lw_spawn(L, n->children[0]);
+    case NODE_AWAIT:
+        return lw_expr(L, n->children[0]);
+
+    default:
+        lw_stmt(L, n);
+        return lw_null(L);
+    }
+}
+
+static void lw_if(Lower *L, ASTNode *n) {
+    IRBlock *then_b = ir_block_new(L->f), *join = ir_block_new(L->f);
+    IRBlock *else_b = n->child_count > 2 ? ir_block_new(L->f) : join;
+    lw_cond(L, n->children[0], then_b, else_b);
+    ir_seal_block(L->f, then_b);
+    L->cur = then_b;
+    lw_stmt(L, n->children[1]);
+    ir_jmp(L->f, L->cur, join);
+    if (else_b != join) {
+        ir_seal_block(L->f, else_b);
+        L->cur = else_b;
+        lw_stmt(L, n->children[2]);
+        ir_jmp(L->f, L->cur, join);
+    }
+    ir_seal_block(L->f, join);
+    L->cur = join;
+}
+
+static void lw_while(Lower *L, ASTNode *n) {
+    IRBlock *head = ir_block_new(L->f), *body = ir_block_new(L->f);
+    IRBlock *exit = ir_block_new(L->f);
+    ir_jmp(L->f, L->cur, head);
+    L->cur = head;
+    lw_safepoint(L);
+    lw_cond(L, n->children[0], body, exit);
+    ir_seal_block(L->f, body);
+    L->cur = body;
+    lw_loop_push(L, exit, head);
+    lw_stmt(L, n->children[1]);
+    L->nloops--;
+    ir_jmp(L->f, L->cur, head);
+    ir_seal_block(L->f, head);
+    ir_seal_block(L->f, exit);
+    L->cur = exit;
+}
+
+static void lw_for(Lower *L, ASTNode *n) {
+    lw_scope_enter(L);
+    lw_stmt(L, n->children[0]);                         /* init */
+    IRBlock *head = ir_block_new(L->f), *body = ir_block_new(L->f);
+    IRBlock *upd  = ir_block_new(L->f), *exit = ir_block_new(L->f);
+    ir_jmp(L->f, L->cur, head);
+    L->cur = head;
+    lw_safepoint(L);
+    ASTNode *cond = n->children[1];
+    if (cond->type == NODE_BOOL && cond->bool_value)    /* parser default */
+        ir_jmp(L->f, L->cur, body);
+    else
+        lw_cond(L, cond, body, exit);
+    ir_seal_block(L->f, body);
+    L->cur = body;
+    lw_loop_push(L, exit, upd);
+    lw_stmt(L, n->children[3]);
+    L->nloops--;
+    ir_jmp(L->f, L->cur, upd);
+    ir_seal_block(L->f, upd);
+    L->cur = upd;
+    if (n->children[2]->type != NODE_NULL)
+        lw_stmt(L, n->children[2]);                     /* update */
+    ir_jmp(L->f, L->cur, head);
+    ir_seal_block(L->f, head);
+    ir_seal_block(L->f, exit);
+    L->cur = exit;
+    lw_scope_leave(L);
+}
+
+/* for x in arr { ... }: a raw i64 index runs 0 .. xly_array_len(arr). */
+static void lw_for_in(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    lw_scope_enter(L);
+    IRInstr *arr = lw_expr(L, n->children[0]);
+    IRInstr *len = ir_unop(f, L->cur, IR_ARRAY_LEN, IRT_I64, arr);
+    int idx_var = L->next_var++;
+    IRInstr *zero = ir_emit(f, L->cur, IR_ICONST, IRT_I64);
+    ir_write_var(L->cur, idx_var, zero);
+
+    IRBlock *head = ir_block_new(f), *body = ir_block_new(f);
+    IRBlock *inc  = ir_block_new(f), *exit = ir_block_new(f);
+    ir_jmp(f, L->cur, head);
+    L->cur = head;
+    lw_safepoint(L);
+    IRInstr *idx = ir_read_var(f, head, idx_var);
+    ir_br(f, head, ir_binop(f, head, IR_ILT, IRT_BOOL, idx, len), body, exit);
+
+    ir_seal_block(f, body);
+    L->cur = body;
+    IRInstr *elem = ir_binop(f, body, IR_ARRAY_GET, IRT_VAL, arr, idx);
+    int iv = lw_declare(L, n->str_value, -1, 0);
+    ir_write_var(body, L->vars[iv].var, elem);
+    lw_loop_push(L, exit, inc);
+    lw_stmt(L, n->children[1]);
+    L->nloops--;
+    ir_jmp(f, L->cur, inc);
+
+    ir_seal_block(f, inc);
+    L->cur = inc;
+    IRInstr *one = ir_emit(f, inc, IR_ICONST, IRT_I64);
+    one->imm = 1;
+    ir_write_var(inc, idx_var, ir_binop(f, inc, IR_IADD, IRT_I64,
+                                        ir_read_var(f, inc, idx_var), one));
+    ir_jmp(f, inc, head);
+    ir_seal_block(f, head);
+    ir_seal_block(f, exit);
+    L->cur = exit;
+    lw_scope_leave(L);
+}
+
+/* for (x of gen): resume the generator until xly_for_of_next says done. */
+static void lw_for_of(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    lw_scope_enter(L);
+    IRInstr *gen = lw_expr(L, n->children[0]);
+
+    IRBlock *head = ir_block_new(f), *body = ir_block_new(f), *exit = ir_block_new(f);
+    ir_jmp(f, L->cur, head);
+    L->cur = head;
+    lw_safepoint(L);
+    IRInstr *next = ir_unop(f, head, IR_GEN_NEXT, IRT_VAL, gen);
+    ir_br(f, head, ir_unop(f, head, IR_IS_MISSING, IRT_BOOL, next), exit, body);
+
+    ir_seal_block(f, body);
+    L->cur = body;
+    int iv = lw_declare(L, n->str_value, -1, 0);
+    ir_write_var(body, L->vars[iv].var, next);
+    lw_loop_push(L, exit, head);
+    lw_stmt(L, n->children[1]);
+    L->nloops--;
+    ir_jmp(f, L->cur, head);
+    ir_seal_block(f, head);
+    ir_seal_block(f, exit);
+    L->cur = exit;
+    lw_scope_leave(L);
+}
+
+static void lw_do_while(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    IRBlock *body = ir_block_new(f), *cond = ir_block_new(f), *exit = ir_block_new(f);
+    ir_jmp(f, L->cur, body);
+    L->cur = body;
+    lw_safepoint(L);
+    lw_loop_push(L, exit, cond);
+    lw_stmt(L, n->children[0]);
+    L->nloops--;
+    ir_jmp(f, L->cur, cond);
+    ir_seal_block(f, cond);
+    L->cur = cond;
+    lw_cond(L, n->children[1], body, exit);
+    ir_seal_block(f, body);
+    ir_seal_block(f, exit);
+    L->cur = exit;
+}
+
+static void lw_unless(Lower *L, ASTNode *n) {
+    IRBlock *body = ir_block_new(L->f), *join = ir_block_new(L->f);
+    lw_cond(L, n->children[0], join, body);
+    ir_seal_block(L->f, body);
+    L->cur = body;
+    lw_stmt(L, n->children[1]);
+    ir_jmp(L->f, L->cur, join);
+    ir_seal_block(L->f, join);
+    L->cur = join;
+}
+
+/* repeat N { ... }: N truncated toward zero, as the interpreter's
+ * (long long) cast; a non-number reads as 0 through ->num.  The counter
+ * is an ordinary number, so -O2 keeps the whole loop unboxed.          */
+static void lw_repeat(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    IRInstr *cnt   = lw_expr(L, n->children[0]);
+    IRInstr *frac  = ir_binop(f, L->cur, IR_MOD, IRT_VAL, cnt, ir_const_num(f, L->cur, 1.0));
+    IRInstr *times = ir_binop(f, L->cur, IR_SUB, IRT_VAL, cnt, frac);
+    int iv = L->next_var++;
+    ir_write_var(L->cur, iv, ir_const_num(f, L->cur, 0.0));
+
+    IRBlock *head = ir_block_new(f), *body = ir_block_new(f);
+    IRBlock *inc  = ir_block_new(f), *exit = ir_block_new(f);
+    ir_jmp(f, L->cur, head);
+    L->cur = head;
+    lw_safepoint(L);
+    IRInstr *lt = ir_binop(f, head, IR_LT, IRT_VAL, ir_read_var(f, head, iv), times);
+    ir_br(f, head, ir_unop(f, head, IR_TRUTHY, IRT_BOOL, lt), body, exit);
+    ir_seal_block(f, body);
+    L->cur = body;
+    lw_loop_push(L, exit, inc);
+    lw_stmt(L, n->children[1]);
+    L->nloops--;
+    ir_jmp(f, L->cur, inc);
+    ir_seal_block(f, inc);
+    L->cur = inc;
+    ir_write_var(inc, iv, ir_binop(f, inc, IR_ADD, IRT_VAL, ir_read_var(f, inc, iv),
+                                   ir_const_num(f, inc, 1.0)));
+    ir_jmp(f, inc, head);
+    ir_seal_block(f, head);
+    ir_seal_block(f, exit);
+    L->cur = exit;
+}
+
+static void lw_forever(Lower *L, ASTNode *n) {
+    IRBlock *body = ir_block_new(L->f), *exit = ir_block_new(L->f);
+    ir_jmp(L->f, L->cur, body);
+    L->cur = body;
+    lw_safepoint(L);
+    lw_loop_push(L, exit, body);
+    lw_stmt(L, n->children[0]);
+    L->nloops--;
+    ir_jmp(L->f, L->cur, body);
+    ir_seal_block(L->f, body);
+    ir_seal_block(L->f, exit);
+    L->cur = exit;
+}
+
+/* An integer literal case value (within int32, so tables stay small). */
+static int switch_case_key(ASTNode *v, long long *key) {
+    double d;
+    if (v->type == NODE_NUMBER)
+        d = v->num_value;
+    else if (v->type == NODE_UNARY && v->str_value && strcmp(v->str_value, "-") == 0 &&
+             v->child_count > 0 && v->children[0]->type == NODE_NUMBER)
+        d = -v->children[0]->num_value;
+    else
+        return 0;
+    if (!(d >= INT32_MIN && d <= INT32_MAX) || d != (double)(long long)d) return 0;
+    *key = (long long)d;
+    return 1;
+}
+
+/* Statements of a case run in the enclosing scope, as in the interpreter. */
+static void lw_case_body(Lower *L, ASTNode *c, size_t first) {
+    for (size_t j = first; j < c->child_count; j++) lw_stmt(L, c->children[j]);
+}
+
+/* switch (d) { case v: ... default: ... } — no fall-through; `break`
+ * leaves the switch and `continue` belongs to the enclosing loop.  When
+ * every case is an integer literal the dispatch is one IR_SWITCH (a jump
+ * table in the emitters); otherwise the cases are compared in order.   */
+static void lw_switch(Lower *L, ASTNode *n) {
+    IRFunc *f = L->f;
+    IRInstr *disc = lw_expr(L, n->children[0]);
+    ASTNode *dflt = NULL;
+    int table = 1;
+    long long key = 0;
+    for (size_t i = 1; i < n->child_count; i++) {
+        ASTNode *c = n->children[i];
+        if (switch_is_default(c)) dflt = c;
+        else if (!switch_case_key(c->children[0], &key)) table = 0;
+    }
+    IRBlock *exit = ir_block_new(f), *other = ir_block_new(f);
+    lw_loop_push(L, exit, L->nloops > 0 ? L->loops[L->nloops - 1].cnt : NULL);
+
+    if (table) {
+        IRInstr *sw = ir_switch(f, L->cur, disc, other);
+        for (size_t i = 1; i < n->child_count; i++) {
+            ASTNode *c = n->children[i];
+            if (switch_is_default(c)) continue;
+            switch_case_key(c->children[0], &key);
+            int seen = 0;
+            for (int k = 1; k < sw->ncases; k++) seen |= sw->keys[k] == key;
+            if (seen) {
+                lw_dead_block(L);               /* shadowed by an earlier case */
+            } else {
+                IRBlock *b = ir_block_new(f);
+                ir_switch_case(sw, key, b);
+                ir_seal_block(f, b);
+                L->cur = b;
+            }
+            lw_case_body(L, c, 1);
+            ir_jmp(f, L->cur, exit);
+        }
+    } else {
+        for (size_t i = 1; i < n->child_count; i++) {
+            ASTNode *c = n->children[i];
+            if (switch_is_default(c)) continue;
+            IRBlock *body = ir_block_new(f), *next = ir_block_new(f);
+            IRInstr *eq = ir_binop(f, L->cur, IR_EQ, IRT_VAL, disc, lw_expr(L, c->children[0]));
+            ir_br(f, L->cur, ir_unop(f, L->cur, IR_TRUTHY, IRT_BOOL, eq), body, next);
+            ir_seal_block(f, body);
+            L->cur = body;
+            lw_case_body(L, c, 1);
+            ir_jmp(f, L->cur, exit);
+            ir_seal_block(f, next);
+            L->cur = next;
+        }
+        ir_jmp(f, L->cur, other);
+    }
+    ir_seal_block(f, other);
+    L->cur = other;
+    if (dflt) lw_case_body(L, dflt, 0);
+    ir_jmp(f, L->cur, exit);
+    L->nloops--;
+    ir_seal_block(f, exit);
+    L->cur = exit;
+}
+
+/* `return f(args)` inside f itself, passing every param: rebind the
+ * params and jump back to the top of the body instead of calling.      */
+static int lw_self_tail_call(Lower *L, ASTNode *n) {
+    CG *cg = L->cg;
+    if (!L->self_head || n->type != NODE_FN_CALL || !n->str_value) return 0;
+    if (variant_find(cg, n->str_value) >= 0 || !fn_is_known(cg, n->str_value) ||
+        strcmp(fn_resolve_label(cg, n->str_value), L->f->name) != 0 ||
+        (int)n->child_count != L->f->nparams)
+        return 0;
+    IRInstr **vals = lw_eval_list(L, n->children, n->child_count);
+    for (size_t i = 0; i < n->child_count; i++)
+        ir_write_var(L->cur, L->param_vars[i], vals[i]);
+    free(vals);
+    ir_jmp(L->f, L->cur, L->self_head);
+    lw_dead_block(L);
+    L->f->stat_tail++;
+    return 1;
+}
+
+static void lw_stmt(Lower *L, ASTNode *n) {
+    if (!n) return;
+    IRFunc *f = L->f;
+
+    switch (n->type) {
+    case NODE_VAR_DECL:
+    case NODE_CONST_DECL: {
+        IRInstr *v = n->child_count > 0 ? lw_expr(L, n->children[0]) : lw_null(L);
+        if (L->is_main && L->depth == 0) {
+            /* top-level: mirrored in __xly_globals so functions see it */
+            int gi  = gvar_declare(L->cg, n->str_value);
+            int mem = nameset_has(&L->fn_written, n->str_value);
+            int i   = lw_declare(L, n->str_value, gi, mem);
+            if (!L->vars[i].mem) ir_write_var(L->cur, L->vars[i].var, v);
+            lw_global_store(L, gi, v);
+        } else {
+            int i = lw_declare(L, n->str_value, -1, 0);
+            ir_write_var(L->cur, L->vars[i].var, v);
+        }
+        break;
+    }
+
+    case NODE_PRINT: {
+        IRInstr **vals = lw_eval_list(L, n->children, n->child_count);
+        lw_emit_n(L, IR_PRINT, IRT_VOID, NULL, vals, n->child_count);
+        free(vals);
+        break;
+    }
+
+    case NODE_EXPR_STMT:
+        if (n->child_count > 0) lw_expr(L, n->children[0]);
+        break;
+
+    case NODE_BLOCK:
+        lw_scope_enter(L);
+        for (size_t i = 0; i < n->child_count; i++)
+            lw_stmt(L, n->children[i]);
+        lw_scope_leave(L);
+        break;
+
+    case NODE_IF:       lw_if(L, n);       break;
+    case NODE_UNLESS:   lw_unless(L, n);   break;
+    case NODE_WHILE:    lw_while(L, n);    break;
+    case NODE_DO_WHILE: lw_do_while(L, n); break;
+    case NODE_FOR:      lw_for(L, n);      break;
+    case NODE_FOR_IN:   lw_for_in(L, n);   break;
+    case NODE_FOR_OF:   lw_for_of(L, n);   break;
+    case NODE_REPEAT:   lw_repeat(L, n);   break;
+    case NODE_FOREVER:  lw_forever(L, n);  break;
+    case NODE_SWITCH:   lw_switch(L, n);   break;
+
+    case NODE_BREAK:
+    case NODE_CONTINUE:
+        if (L->nloops > 0) {
+            /* a switch has no continue target of its own (NULL outside loops) */
+            IRBlock *to = n->type == NODE_BREAK ? L->loops[L->nloops - 1].brk
+                                                : L->loops[L->nloops - 1].cnt;
+            if (!to) break;
+            ir_jmp(f, L->cur, to);
+            lw_dead_block(L);
+        }
+        break;
+
+    case NODE_RETURN: {
+        if (n->child_count > 0 && lw_self_tail_call(L, n->children[0])) break;
+        IRInstr *v = n->child_count > 0 ? lw_expr(L, n->children[0]) : lw_null(L);
+        ir_ret(f, L->cur, L->is_main ? NULL : v);
+        lw_dead_block(L);
+        break;
+    }
+
+    case NODE_FN_DECL:
+        fn_decl_stash(L->cg, n);
+        break;
+
+    case NODE_GEN_DECL: {                  /* bound in a global, as emit_stmt */
+        char lbl[256];
+        gen_decl_stash(L->cg, n, lbl, sizeof(lbl));
+        IRInstr *in = ir_emit(f, L->cur, IR_GEN_FN, IRT_VAL);
+        in->sym = strdup(lbl);
+        lw_global_store(L, gvar_declare(L->cg, n->str_value), in);
+        break;
+    }
+
+    case NODE_YIELD:
+    case NODE_YIELD_EMPTY: {
+        IRInstr *v = n->type == NODE_YIELD ? lw_expr(L, n->children[0]) : lw_null(L);
+        IRInstr *in = ir_emit(f, L->cur, IR_YIELD, IRT_VOID);
+        ir_add_arg(in, v);
+        break;
+    }
+
+    case NODE_ENUM_DECL:
+        /* parameterless variants are singletons held in globals; parametric
+         * ones are built at the call site (see lw_call) */
+        for (size_t vi = 0; vi < n->child_count; vi++) {
+            ASTNode *vn = n->children[vi];
+            if (!vn || !vn->str_value || vn->param_count != 0) continue;
+            IRInstr *in = ir_emit(f, L->cur, IR_MAKE_VARIANT, IRT_VAL);
+            in->sym = strdup(vn->str_value);
+            in->imm = variant_id(L->cg, vn->str_value);
+            lw_global_store(L, gvar_declare(L->cg, vn->str_value), in);
+        }
+        break;
+
+    case NODE_IMPORT: {                    /* a user module: run its init */
+        const UnitImport *u = n->str_value ? unit_import_find(n->str_value, NULL) : NULL;
+        if (u) {
+            IRInstr *in = ir_emit(f, L->cur, IR_CALL, IRT_VAL);
+            in->sym = strdup(u->label);
+            in->imm = 0;
+        }
+        break;
+    }
+
+    case NODE_CLASS_DECL:                  /* laid out by collect_classes */
+    case NODE_NULL:
+        break;
+
+    default:
+        lw_expr(L, n);
+        break;
+    }
+}
+
+static void lw_free(Lower *L) {
+    for (int i = 0; i < L->nvars; i++) free(L->vars[i].name);
+    free(L->vars);
+    cgidx_free(&L->var_idx);
+    free(L->loops);
+    free(L->param_vars);
+    free(L->prof_seen);
+    nameset_free(&L->fn_written);
+}
+
+/* Direct calls with every argument supplied may use the callee's raw-f64
+ * entry; the unboxing pass decides whether the arguments are numbers.    */
+static void ir_mark_num_calls(CG *cg, IRFunc *f) {
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->op != IR_CALL) continue;
+            int fi = fn_label_index(cg, in->sym);
+            in->num_entry = fi >= 0 && cg->funcs[fi].num_entry &&
+                            in->nargs == (int)cg->funcs[fi].node->param_count;
+        }
+    }
+}
+
+/* Lower main; NULL if it uses a construct the IR does not handle yet.
+ * The caller runs ir_finish() once the functions main declares are known. */
+static IRFunc *ir_lower_main(CG *cg, ASTNode *program, int a64) {
+    if (!ir_can_lower(program, a64)) return NULL;
+    Lower L;
+    memset(&L, 0, sizeof(L));
+    L.cg = cg;
+    L.is_main = 1;
+    L.cls = -1;
+    L.f = ir_func_new("main", 0, 0, 1);
+    L.cur = ir_block_new(L.f);
+    ir_seal_block(L.f, L.cur);
+    lw_prof_enter(&L, -1);
+    collect_fn_assigned(program, 0, &L.fn_written);
+    for (size_t i = 0; i < program->child_count; i++)
+        lw_stmt(&L, program->children[i]);
+    ir_ret(L.f, L.cur, NULL);
+    lw_free(&L);
+    return L.f;
+}
+
+/* Does `n` contain `return name(...)` outside nested function bodies? */
+static int ast_has_self_tail_call(ASTNode *n, const char *name) {
+    if (!n || !name) return 0;
+    if (n->type == NODE_FN_DECL || n->type == NODE_ARROW_FN) return 0;
+    if (n->type == NODE_RETURN && n->child_count > 0 && n->children[0] &&
+        n->children[0]->type == NODE_FN_CALL && n->children[0]->str_value &&
+        strcmp(n->children[0]->str_value, name) == 0)
+        return 1;
+    for (size_t i = 0; i < n->child_count; i++)
+        if (ast_has_self_tail_call(n->children[i], name)) return 1;
+    return 0;
+}
+
+/* Lower funcs[fi]; NULL if it must go through the direct emitter.  The
+ * caller has already restored the function's rename context.  With
+ * `num_abi` the params are raw f64 (the body behind the raw entry).      */
+static IRFunc *ir_lower_function(CG *cg, int fi, int a64, int num_abi) {
+    ASTNode *fn      = cg->funcs[fi].node;
+    char   **caps    = cg->funcs[fi].captures;
+    int      ncaps   = cg->funcs[fi].ncaptures;
+    if (fn->child_count == 0 || !fn->children[0]) return NULL;
+    if (a64 && (int)fn->param_count + (ncaps > 0 ? 1 : 0) > 8) return NULL;
+    for (size_t i = 0; i < fn->param_count; i++)
+        if (!fn->params[i].name || !ir_can_lower(fn->params[i].default_value, a64))
+            return NULL;
+    if (!ir_can_lower(fn->children[0], a64)) return NULL;
+
+    Lower L;
+    memset(&L, 0, sizeof(L));
+    L.cg = cg;
+    L.cls = cg->funcs[fi].cls;
+    L.f = ir_func_new(cg->funcs[fi].asm_label, (int)fn->param_count, ncaps, 0);
+    IRFunc *f = L.f;
+    f->num_abi = num_abi;
+    L.cur = ir_block_new(f);
+    ir_seal_block(f, L.cur);
+    lw_prof_enter(&L, fi);
+
+    for (int i = 0; i < ncaps; i++) {
+        IRInstr *c = ir_emit(f, L.cur, IR_CAPTURE, IRT_VAL);
+        c->imm = i;
+        int ci = lw_declare(&L, caps[i], -1, 0);
+        ir_write_var(L.cur, L.vars[ci].var, c);
+    }
+    L.param_vars = malloc(sizeof(int) * (fn->param_count ? fn->param_count : 1));
+    for (size_t i = 0; i < fn->param_count; i++) {
+        IRInstr *p = ir_emit(f, L.cur, IR_PARAM, num_abi ? IRT_F64 : IRT_VAL);
+        p->imm = (long long)i;
+        int pi = lw_declare(&L, fn->params[i].name, -1, 0);
+        L.param_vars[i] = L.vars[pi].var;
+        ir_write_var(L.cur, L.param_vars[i], p);
+    }
+
+    /* self tail calls loop back here, ahead of the defaults, so a missing
+     * argument passed on still picks up its default */
+    ASTNode *body = fn->children[0];
+    if (cg->opt_level >= 2 && ast_has_self_tail_call(body, fn->str_value)) {
+        L.self_head = ir_block_new(f);
+        ir_jmp(f, L.cur, L.self_head);
+        L.cur = L.self_head;
+    }
+    lw_safepoint(&L);
+
+    for (size_t i = 0; i < fn->param_count; i++) {
+        if (!fn->params[i].is_optional && !fn->params[i].default_value) continue;
+
+        /* omitted argument (raw NULL) → default value, or null */
+        int var = L.param_vars[i];
+        IRInstr *p = ir_read_var(f, L.cur, var);
+        IRBlock *dflt = ir_block_new(f), *join = ir_block_new(f);
+        ir_br(f, L.cur, ir_unop(f, L.cur, IR_IS_MISSING, IRT_BOOL, p), dflt, join);
+        ir_seal_block(f, dflt);
+        L.cur = dflt;
+        ir_write_var(L.cur, var, lw_expr(&L, fn->params[i].default_value));
+        ir_jmp(f, L.cur, join);
+        ir_seal_block(f, join);
+        L.cur = join;
+    }
+
+    lw_scope_enter(&L);
+    for (size_t i = 0; i < body->child_count; i++)
+        lw_stmt(&L, body->children[i]);
+    lw_scope_leave(&L);
+    ir_ret(f, L.cur, lw_null(&L));                       /* implicit return null */
+    if (L.self_head) ir_seal_block(f, L.self_head);
+    lw_free(&L);
+    return f;
+}
+
+/* ir_lower_function() under the function's own rename context. */
+static IRFunc *ir_lower_in_ctx(CG *cg, int fi, int a64, int num_abi) {
+    int sv_rename = fn_rename_scope_enter(cg);
+    fn_rename_ctx_restore(cg, cg->funcs[fi].rename_ctx, cg->funcs[fi].rename_ctx_count);
+    IRFunc *f = ir_lower_function(cg, fi, a64, num_abi);
+    fn_rename_scope_leave(cg, sv_rename);
+    return f;
+}
+
+static int ast_has_nested_fn(ASTNode *n) {
+    if (!n) return 0;
+    if (n->type == NODE_FN_DECL || n->type == NODE_ARROW_FN ||
+        n->type == NODE_GEN_DECL || n->type == NODE_CLASS_DECL ||
+        n->type == NODE_BLOCK_FN)
+        return 1;
+    for (size_t i = 0; i < n->child_count; i++)
+        if (ast_has_nested_fn(n->children[i])) return 1;
+    return 0;
+}
+
+/* ── inlining (-O2) ─────────────────────────────────────────────────────
+ * Direct calls to small functions are replaced by a copy of the callee's
+ * body (ir_inline_call).  A callee qualifies when it has no captures,
+ * stashes no nested functions (so lowering it again has no side effects)
+ * and does not call itself, and the call passes every param.  Its size
+ * after -O1 cleanup must stay under a limit that doubles when the call is
+ * the only one to that name in the program; each caller may grow by a
+ * bounded number of instructions.  Calls copied in are not revisited.  A
+ * call in tail position is only inlined if the callee makes no calls of
+ * its own: otherwise the jump it becomes keeps recursion in constant stack.
+ * With a profile, calls it found hot go first and may be IR_INLINE_HOT
+ * times larger; calls it never saw made are left alone.                  */
+#define IR_INLINE_SIZE(cg)    ((cg)->opt_level >= 3 ? 40 : 16)
+#define IR_INLINE_BUDGET(cg)  ((cg)->opt_level >= 3 ? 600 : 200)
+#define IR_INLINE_HOT         4
+
+/* Pre-pass (-O2): count the calls of every name in one walk. */
+static void collect_call_sites(CG *cg, ASTNode *n) {
+    if (!n) return;
+    if (n->type == NODE_FN_CALL && n->str_value) {
+        CGKeys k = CG_KEYS(cg->call_sites, cg->call_site_count, 0);
+        int i = cgidx_find(&cg->call_site_idx, k, n->str_value);
+        if (i >= 0) {
+            cg->call_sites[i].n++;
+        } else {
+            if (cg->call_site_count >= cg->call_site_cap) {
+                cg->call_site_cap = cg->call_site_cap ? cg->call_site_cap * 2 : 64;
+                cg->call_sites = realloc(cg->call_sites,
+                                         sizeof(cg->call_sites[0]) * (size_t)cg->call_site_cap);
+            }
+            i = cg->call_site_count++;
+            cg->call_sites[i].name = strdup(n->str_value);
+            cg->call_sites[i].n    = 1;
+            cgidx_add(&cg->call_site_idx, CG_KEYS(cg->call_sites, cg->call_site_count, 0), i);
+        }
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        collect_call_sites(cg, n->children[i]);
+    for (size_t i = 0; i < n->param_count; i++)
+        if (n->params && n->params[i].default_value)
+            collect_call_sites(cg, n->params[i].default_value);
+}
+
+static void call_sites_free(CG *cg) {
+    for (int i = 0; i < cg->call_site_count; i++) free(cg->call_sites[i].name);
+    free(cg->call_sites);
+    cgidx_free(&cg->call_site_idx);
+}
+
+static int ir_has_calls(IRFunc *f) {
+    for (int bi = 0; bi < f->nblocks; bi++)
+        for (int i = 0; i < f->blocks[bi]->nins; i++) {
+            IROp op = f->blocks[bi]->ins[i]->op;
+            if (op == IR_CALL || op == IR_CALL_VALUE || op == IR_CALL_METHOD ||
+                op == IR_CALL_VIRT)
+                return 1;
+        }
+    return 0;
+}
+
+/* `call` is directly returned: the next live instruction is its ret. */
+static int ir_is_tail_position(IRInstr *call) {
+    IRBlock *b = call->block;
+    int i = 0;
+    while (b->ins[i] != call) i++;
+    while (++i < b->nins && b->ins[i]->dead) ;
+    return i < b->nins && b->ins[i]->op == IR_RET && b->ins[i]->nargs == 1 &&
+           ir_resolve(b->ins[i]->args[0]) == call;
+}
+
+static int ir_call_sites(CG *cg, int fi) {
+    int i = cgidx_find(&cg->call_site_idx, CG_KEYS(cg->call_sites, cg->call_site_count, 0),
+                       cg->funcs[fi].node->str_value);
+    return i >= 0 ? cg->call_sites[i].n : 0;
+}
+
+/* funcs[fi] lowered and cleaned up for copying, or NULL if it does not
+ * qualify.  Lowering bumps the sys-inline / noreturn counters again; they
+ * are restored so --verbose reports each source site once.              */
+static IRFunc *ir_inline_body(CG *cg, int fi, int a64) {
+    ASTNode *fn = cg->funcs[fi].node;
+    if (cg->funcs[fi].ncaptures > 0 || !fn->str_value || fn->child_count == 0 ||
+        ast_has_nested_fn(fn->children[0]))
+        return NULL;
+    for (size_t i = 0; i < fn->param_count; i++)
+        if (ast_has_nested_fn(fn->params[i].default_value)) return NULL;
+    int sv_sys = cg->stat_sys_inline, sv_noret = cg->stat_noreturn_elim;
+    int sv_native = cg->stat_native_calls;
+    IRFunc *g = ir_lower_in_ctx(cg, fi, a64, 0);
+    cg->stat_sys_inline = sv_sys;
+    cg->stat_noreturn_elim = sv_noret;
+    cg->stat_native_calls = sv_native;
+    if (!g) return NULL;
+    ir_optimize(g, 1);
+    for (int bi = 0; bi < g->nblocks; bi++)
+        for (int i = 0; i < g->blocks[bi]->nins; i++) {
+            IRInstr *in = g->blocks[bi]->ins[i];
+            if (in->op == IR_CALL && strcmp(in->sym, g->name) == 0) {
+                ir_func_free(g);
+                return NULL;
+            }
+        }
+    return g;
+}
+
+static void ir_inline_calls(CG *cg, IRFunc *f, int a64) {
+    if (cg->opt_level < 2) return;
+    int nf = cg->func_count, budget = IR_INLINE_BUDGET(cg);
+    /* callees tried so far, by label, and their inlinable bodies (NULL =
+     * not one); main may call thousands of them */
+    struct { const char *sym; IRFunc *body; } *tried = NULL;
+    int ntried = 0, tried_cap = 0;
+    CGIndex tried_idx = {0};
+
+    IRInstr **calls = NULL;
+    int ncalls = 0;
+    for (int bi = 0; bi < f->nblocks; bi++)
+        for (int i = 0; i < f->blocks[bi]->nins; i++) {
+            IRInstr *in = f->blocks[bi]->ins[i];
+            if (in->op != IR_CALL || in->dead) continue;
+            calls = realloc(calls, sizeof(IRInstr*) * (size_t)(ncalls + 1));
+            calls[ncalls++] = in;
+        }
+
+    for (int hot = 1; hot >= 0; hot--)
+    for (int c = 0; c < ncalls; c++) {
+        if ((calls[c]->hint > 0) != hot || calls[c]->hint < 0) continue;
+        int fi = fn_label_index(cg, calls[c]->sym);
+        if (fi < 0 || fi >= nf || strcmp(calls[c]->sym, f->name) == 0) continue;
+        int t = cgidx_find(&tried_idx, CG_KEYS(tried, ntried, 0), calls[c]->sym);
+        if (t < 0) {
+            if (ntried >= tried_cap) {
+                tried_cap = tried_cap ? tried_cap * 2 : 16;
+                tried = realloc(tried, sizeof(tried[0]) * (size_t)tried_cap);
+            }
+            t = ntried++;
+            tried[t].sym  = calls[c]->sym;
+            tried[t].body = ir_inline_body(cg, fi, a64);
+            cgidx_add(&tried_idx, CG_KEYS(tried, ntried, 0), t);
+        }
+        IRFunc *body = tried[t].body;
+        if (!body) continue;
+        int size  = ir_func_size(body);
+        int limit = IR_INLINE_SIZE(cg) * (ir_call_sites(cg, fi) == 1 ? 2 : 1) *
+                    (hot ? IR_INLINE_HOT : 1);
+        if (size > limit || size > budget) continue;
+        if (ir_is_tail_position(calls[c]) && ir_has_calls(body)) continue;
+        if (ir_inline_call(f, calls[c], body)) budget -= size;
+    }
+
+    for (int t = 0; t < ntried; t++) ir_func_free(tried[t].body);
+    free(tried);
+    cgidx_free(&tried_idx);
+    free(calls);
+}
+
+/* Optimize and prepare a lowered function for emission. */
+static void ir_finish(CG *cg, IRFunc *f, int a64) {
+    ir_inline_calls(cg, f, a64);
+    ir_mark_num_calls(cg, f);
+    ir_optimize(f, cg->opt_level);
+    if (g_ir_dump) ir_print(f, g_ir_dump);
+    if (cg->verbose)
+        fprintf(stderr, "  ir %-24s folded %d, branches %d, dce %d, cse %d, licm %d, unboxed %d,"
+                        " inlined %d, tail %d, stack %d\n",
+                f->name, f->stat_folded, f->stat_branches, f->stat_dce,
+                f->stat_cse, f->stat_licm, f->stat_unboxed, f->stat_inlined, f->stat_tail,
+                f->stat_stack);
+    ir_split_critical_edges(f);
+}
+
+/* ── raw-f64 entry points (-O3; -O2 where annotated) ────────────────────
+ * A function gets a second body taking and returning raw doubles when,
+ * lowered with numeric params, every return is a number.  Recursive and
+ * mutually recursive calls assume the callee qualifies; candidates that
+ * fail are dropped until the set is stable.  Callers pass numbers in
+ * xmm0-5 / d0-d5, and the boxed entry forwards to the raw body when all
+ * its arguments are numbers.  Bodies that stash nested functions are
+ * skipped so lowering them more than once has no side effects.
+ *
+ * Type annotations (typecheck.c) are not enforced at run time, so they
+ * only choose which functions pay for the second body, never what a
+ * value is taken to be: -O3 tries every candidate but one with a param
+ * or result annotated as another type, -O2 only those whose params are
+ * all annotated `number` (and result too, if it has one).               */
+static int ann_excludes_number(const char *t) {
+    static const char *other[] = { "string", "bool", "null", "array", "object" };
+    for (size_t i = 0; t && i < sizeof(other) / sizeof(other[0]); i++)
+        if (strcmp(t, other[i]) == 0) return 1;
+    return 0;
+}
+
+static int ann_is_number(const char *t) {
+    return t && strcmp(t, "number") == 0;
+}
+
+static int ir_num_candidate(CG *cg, int fi) {
+    ASTNode *fn = cg->funcs[fi].node;
+    if (cg->funcs[fi].ncaptures > 0 || cg->funcs[fi].cls >= 0) return 0;
+    if (fn->type == NODE_GEN_DECL) return 0;     /* entered by xly_gen_fn only */
+    if (fn->param_count == 0 || fn->param_count > 6) return 0;
+    if (ann_excludes_number(fn->return_type)) return 0;
+    for (size_t i = 0; i < fn->param_count; i++) {
+        if (fn->params[i].is_optional || fn->params[i].default_value) return 0;
+        if (ann_excludes_number(fn->params[i].type_annotation)) return 0;
+        if (cg->opt_level < 3 && !ann_is_number(fn->params[i].type_annotation)) return 0;
+    }
+    if (cg->opt_level < 3 && fn->return_type && !ann_is_number(fn->return_type)) return 0;
+    return fn->child_count > 0 && !ast_has_nested_fn(fn->children[0]);
+}
+
+static void ir_plan_num_entries(CG *cg, int a64) {
+    if (cg->num_planned) return;
+    cg->num_planned = 1;
+    if (cg->opt_level < 2) return;
+    for (int i = 0; i < cg->func_count; i++)
+        cg->funcs[i].num_entry = ir_num_candidate(cg, i);
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int i = 0; i < cg->func_count; i++) {
+            if (!cg->funcs[i].num_entry) continue;
+            IRFunc *f = ir_lower_in_ctx(cg, i, a64, 1);
+            int ok = f != NULL;
+            if (f) {
+                ir_inline_calls(cg, f, a64);
+                ir_mark_num_calls(cg, f);
+                ir_optimize(f, cg->opt_level);
+                ok = ir_returns_num(f);
+                ir_func_free(f);
+            }
+            if (!ok) { cg->funcs[i].num_entry = 0; changed = 1; }
+        }
+    }
+}
+
+/* ── frame layout shared by the IR emitters ─────────────────────────────
+ * From -O1 ir_regalloc() places values in callee-saved registers; the
+ * rest own one 8-byte slot below the frame pointer.  The callee-saved
+ * registers in use are saved in the first slots.  Parameters that arrive
+ * in registers are moved to their register or slot in the prologue,
+ * stack-passed ones are read in place.  A run of scratch slots after the
+ * values is used for parallel phi copies, and the XlyVal cells of values
+ * kept off the heap come last.
+ *
+ * Value locations are ints: a frame offset, or IR_LOC_REG(r) for the
+ * r-th allocatable register (frame offsets are never in 1..15).          */
+#define IR_LOC_REG(r)       (1 + (r))
+#define IR_LOC_IS_REG(loc)  ((loc) >= 1 && (loc) < 16)
+#define IR_LOC_INDEX(loc)   ((loc) - 1)
+#define IR_CELL_BYTES       128         /* sizeof(XlyVal)                   */
+
+typedef struct {
+    int save_slot;                  /* callee-saved register save area      */
+    int nsaved;
+    int env_slot;                   /* closure env pointer (captures only)  */
+    int first_param;                /* slots before the spilled params      */
+    int nreg_params;                /* params passed in registers           */
+    int scratch;                    /* first scratch slot (negative offset) */
+    int cells;                      /* lowest XlyVal cell (values off heap) */
+    int ncells;
+    int bytes;                      /* total slot bytes, 16-aligned         */
+} IRFrame;
+
+static int ir_loc(const IRInstr *v) {
+    return v->reg >= 0 ? IR_LOC_REG(v->reg) : v->slot;
+}
+
+static int ir_param_slot(const IRFrame *fr, int i) {
+    return i < fr->nreg_params ? -8 * (fr->first_param + i + 1)
+                               : 16 + 8 * (i - fr->nreg_params);   /* caller's frame */
+}
+
+/* Allocate registers (-O1 and up, `nregs` callee-saved ones available)
+ * and lay out the frame. */
+static void ir_frame_layout(CG *cg, IRFunc *f, int nreg_params, int nregs, IRFrame *fr) {
+    int n = 0, maxphi = 0;
+    if (cg->opt_level >= 1) {
+        ir_regalloc(f, nregs);
+        if (cg->verbose)
+            fprintf(stderr, "  regalloc %-18s %d register%s, %d spilled\n", f->name,
+                    f->stat_regs, f->stat_regs == 1 ? "" : "s", f->stat_spilled);
+    }
+    fr->save_slot   = -8;
+    fr->nsaved      = f->stat_regs;
+    n += fr->nsaved;
+    fr->env_slot    = f->ncaptures > 0 ? -8 * ++n : 0;
+    fr->first_param = n;
+    fr->nreg_params = nreg_params;
+    n += f->nparams < nreg_params ? f->nparams : nreg_params;
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        int nphi = 0;
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->op == IR_PHI) nphi++;
+            if (in->type == IRT_VOID) continue;
+            if (in->op == IR_PARAM)  in->slot = ir_param_slot(fr, (int)in->imm);
+            else if (in->reg < 0)    in->slot = -8 * ++n;
+        }
+        if (nphi > maxphi) maxphi = nphi;
+    }
+    fr->scratch = -8 * (n + 1);
+    n += maxphi;
+    fr->ncells = 0;
+    for (int bi = 0; bi < f->nblocks; bi++)
+        for (int i = 0; i < f->blocks[bi]->nins; i++) {
+            IRInstr *in = f->blocks[bi]->ins[i];
+            if (!in->stack) continue;
+            n += IR_CELL_BYTES / 8;
+            in->cell = -8 * n;
+            fr->ncells++;
+        }
+    fr->cells = -8 * n;
+    fr->bytes = (n * 8 + 15) & ~15;
+}
+
+/* ── values kept off the heap ───────────────────────────────────────────
+ * A boxed number constant is a read-only XlyVal laid out after its
+ * function.  A value pass_escape marked `stack` owns a cell in the frame,
+ * cleared by the prologue with refcount XLY_NOT_HEAP (xly_rt.c); each run
+ * only stores its number there.                                          */
+static int ir_const_box(const IRInstr *in) {
+    return (in->op == IR_CONST_NUM && in->type == IRT_VAL) ||
+           (in->op == IR_BOX && in->args[0]->op == IR_CONST_NUM);
+}
+
+static void ir_const_box_label(CG *cg, int seq, const IRInstr *in, char *buf, size_t sz) {
+    snprintf(buf, sz, ".Lxly_ir%s%d_k%d", cg->label_pfx, seq, in->id);
+}
+
+static void ir_emit_const_boxes(CG *cg, IRFunc *f, int seq) {
+    int any = 0;
+    for (int bi = 0; bi < f->nblocks; bi++)
+        for (int i = 0; i < f->blocks[bi]->nins; i++) {
+            IRInstr *in = f->blocks[bi]->ins[i];
+            if (!ir_const_box(in)) continue;
+            if (!any) {
+                emit(cg, "");
+#if defined(__APPLE__)
+                emit(cg, ".section __DATA,__const");
+#else
+                emit(cg, ".section .rodata");
+#endif
+                emit(cg, ".balign 16");
+                any = 1;
+            }
+            union { double d; unsigned long long u; } c;
+            c.d = in->op == IR_BOX ? in->args[0]->num : in->num;
+            char l[64];
+            ir_const_box_label(cg, seq, in, l, sizeof(l));
+            emit(cg, "%s:", l);
+            /* type VAL_NUMBER, num, str, boolean/local, fn_shared/refcount */
+            emit(cg, "    .quad   0, 0x%llx, 0, 0, 0xffffffff00000000", c.u);
+            emit(cg, "    .space  %d", IR_CELL_BYTES - 40);
+        }
+    if (any) emit(cg, "    %s", cg->fn_cold ? XLY_COLD_SECTION : XLY_TEXT_SECTION);
+}
+
+/* Phi copies along the edge b → s: dst[i] = src[i] as locations.  Returns
+ * the count and sets *parallel when some copy overwrites another copy's
+ * source (the copies must then go through scratch slots).                */
+static int ir_phi_moves(IRBlock *b, IRBlock *s, int *dst, int *src, int *parallel) {
+    int k = -1, n = 0;
+    for (int p = 0; p < s->npreds; p++)
+        if (s->preds[p] == b) { k = p; break; }
+    *parallel = 0;
+    if (k < 0) return 0;
+    for (int i = 0; i < s->nins && s->ins[i]->op == IR_PHI; i++) {
+        IRInstr *phi = s->ins[i];
+        IRInstr *v = phi->args[k];
+        if (v == phi || ir_loc(v) == ir_loc(phi)) continue;
+        dst[n] = ir_loc(phi);
+        src[n] = ir_loc(v);
+        n++;
+    }
+    for (int i = 0; i < n; i++)
+        for (int j = i + 1; j < n; j++)
+            if (dst[i] == src[j]) *parallel = 1;
+    return n;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * x86-64 BACKEND  (Linux/BSD + macOS Intel)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+#ifdef XLY_ARCH_X86_64
+
+/* ── safepoint poll ─────────────────────────────────────────────────────
+ * At loop heads and function entry, where nothing is live in a caller-
+ * saved register: park if a collection is waiting (xly_stopping).      */
+static void emit_safepoint(CG *cg) {
+    char skip[64];
+    fresh_label(cg, skip, sizeof(skip));
+    emit(cg, "    cmpl    $0, " XLY_SYM("xly_stopping") "(%%rip)");
+    emit(cg, "    je      %s", skip);
+    emit(cg, "    call    " XLY_SYM("xly_safepoint"));
+    emit(cg, "%s:", skip);
+}
+
+/* ── load a double constant into %xmm0 ─────────────────────────────────
+ * Use the red zone (-8(%rsp)) to avoid changing %rsp, which would break
+ * 16-byte alignment before a subsequent call instruction.                 */
+static void emit_load_double(CG *cg, double d) {
+    union { double d; unsigned long long u; } uu; uu.d = d;
+    emit(cg, "    movabsq $%llu, %%rax", (unsigned long long)uu.u);
+    emit(cg, "    movq    %%rax, -8(%%rsp)");
+    emit(cg, "    movsd   -8(%%rsp), %%xmm0");
+}
+
+/* Evaluate `argc` args into an aligned array at (%rsp); returns the bytes
+ * to release once the callee has run.                                    */
+static int emit_arg_array(CG *cg, ASTNode **args, int argc) {
+    int bytes = argc > 0 ? (((argc * 8) + 15) & ~15) : 0;
+    if (bytes > 0) emit(cg, "    subq    $%d, %%rsp", bytes);
+    for (int i = 0; i < argc; i++) {
+        emit_expr(cg, args[i]);
+        emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+    }
+    return bytes;
+}
+
+/* ── direct call of a declared fn: SysV x86-64 ABI ──────────────────────
+ * Args 0-5 → rdi,rsi,rdx,rcx,r8,r9
+ * Args 6+  → [rsp], [rsp+8], ...  (callee reads at [rbp+16], ...)
+ *
+ * We evaluate all args into a staging area first, then:
+ *  1. Copy staging[nreg..nargs-1] to positions above staging
+ *     (these become the stack args once staging is freed)
+ *  2. Load staging[0..nreg-1] into the register args
+ *  3. Free staging (stack args slide into place at rsp)
+ *  4. call
+ *  5. Caller cleans up stack args (SysV: caller-cleanup for stack args)
+ */
+static void emit_call_label(CG *cg, ASTNode **args, int nargs, const char *lbl) {
+    static const char *regs[] = {"rdi","rsi","rdx","rcx","r8","r9"};
+    int nreg = nargs < 6 ? nargs : 6;
+    int nstk = nargs - nreg;
+    int stage_bytes = nargs > 0 ? (((nargs * 8) + 15) & ~15) : 0;
+    int stk_bytes   = nstk > 0  ? (((nstk * 8)  + 15) & ~15) : 0;
+
+    /* Evaluate all args into staging */
+    if (stage_bytes > 0)
+        emit(cg, "    subq    $%d, %%rsp", stage_bytes);
+    for (int i = 0; i < nargs; i++) {
+        emit_expr(cg, args[i]);
+        emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+    }
+
+    /* Pre-place stack args above the staging area (using r10 as scratch).
+     * After addq $stage_bytes these will be at [rsp+0], [rsp+8], ... */
+    for (int i = 0; i < nstk; i++) {
+        emit(cg, "    movq    %d(%%rsp), %%r10", (nreg + i) * 8);
+        emit(cg, "    movq    %%r10, %d(%%rsp)", stage_bytes + i * 8);
+    }
+
+    /* Load register args from staging */
+    for (int i = 0; i < nreg; i++)
+        emit(cg, "    movq    %d(%%rsp), %%%s", i * 8, regs[i]);
+
+    /* Free staging — stack args now at [rsp..] */
+    if (stage_bytes > 0)
+        emit(cg, "    addq    $%d, %%rsp", stage_bytes);
+
+    int arity = fn_callee_arity(cg, lbl);
+    for (int i = nreg; i < arity && i < 6; i++)
+        emit(cg, "    xorq    %%%s, %%%s", regs[i], regs[i]);
+    emit(cg, "    call    .Lxly_fn_%s", lbl);
+
+    /* Caller cleans up stack args */
+    if (stk_bytes > 0)
+        emit(cg, "    addq    $%d, %%rsp", stk_bytes);
+}
+
+/* spawn's operand is a call of a declared function or of a variable. */
+static int spawn_target(CG *cg, ASTNode *call) {
+    const char *name = call->str_value;
+    return call->type == NODE_FN_CALL && variant_find(cg, name) < 0 &&
+           (fn_is_known(cg, name) || var_offset(cg, name) != 0 || gvar_find(cg, name) >= 0);
+}
+
+/* The value `name` denotes, in %rax: a local, a global, a declared
+ * function wrapped as a value, or null. */
+static void emit_load_name(CG *cg, const char *name) {
+    int off = var_offset(cg, name);
+    if (off != 0) {
+        emit(cg, "    movq    %d(%%rbp), %%rax", off);
+        return;
+    }
+    int gi = gvar_find(cg, name);
+    if (gi >= 0) {
+        /* Global variable: load from __xly_globals array */
+        emit(cg, "    movq    " XLY_SYM("__xly_globals") "+%d(%%rip), %%rax", gi * 8);
+    } else if (fn_is_known(cg, name)) {
+        /* Declared function used as a value — wrap its address as XlyVal* */
+        int recv;
+        const char *lbl = fn_value_label(cg, name, &recv);
+        emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", lbl);
+        if (recv) {
+            emit(cg, "    xorl    %%esi, %%esi");
+            emit(cg, "    xorl    %%edx, %%edx");
+            emit(cg, "    call    " XLY_SYM("xly_make_method"));
+        } else {
+            emit(cg, "    call    " XLY_SYM("xly_make_fn"));
+        }
+    } else {
+        emit(cg, "    call    " XLY_SYM("xly_null"));   /* undefined → null */
+    }
+}
+
+/* ── expression compiler ────────────────────────────────────────────────
+ * Post-condition: result XlyVal* is in %rax.  %rsp is unchanged.         */
+static void emit_expr(CG *cg, ASTNode *node) {
+    if (!node) { emit(cg, "    call    " XLY_SYM("xly_null")); return; }
+
+    switch (node->type) {
+
+    /* ── literals ────────────────────────────────────────────────────── */
+    case NODE_NUMBER:
+        emit_load_double(cg, node->num_value);
+        emit(cg, "    call    " XLY_SYM("xly_num"));
+        break;
+
+    case NODE_STRING: {
+        const char *lbl = intern_string(cg, node->str_value ? node->str_value : "");
+        emit(cg, "    leaq    %s(%%rip), %%rdi", lbl);
+        emit(cg, "    call    " XLY_SYM("xly_str"));
+        break;
+    }
+
+    case NODE_BOOL:
+        emit(cg, "    movl    $%d, %%edi", node->bool_value ? 1 : 0);
+        emit(cg, "    call    " XLY_SYM("xly_bool"));
+        break;
+
+    case NODE_NULL:
+        emit(cg, "    call    " XLY_SYM("xly_null"));
+        break;
+
+    /* ── cond ? a : b ─────────────────────────────────────────────── */
+    case NODE_TERNARY: {
+        char lbl_else[64], lbl_end[64];
+        fresh_label(cg, lbl_else, sizeof(lbl_else));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    testl   %%eax, %%eax");
+        emit(cg, "    jz      %s", lbl_else);
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    jmp     %s", lbl_end);
+        emit(cg, "%s:", lbl_else);
+        emit_expr(cg, node->children[2]);
+        emit(cg, "%s:", lbl_end);
+        break;
+    }
+
+    /* ── a ?? b: b only when a is null ────────────────────────────── */
+    case NODE_NULLISH: {
+        char lbl_rhs[64], lbl_end[64];
+        fresh_label(cg, lbl_rhs, sizeof(lbl_rhs));
+        fresh_label(cg, lbl_end, sizeof(lbl_end));
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    testq   %%rax, %%rax");
+        emit(cg, "    je      %s", lbl_rhs);
+        emit(cg, "    cmpl    $3, (%%rax)");                   /* VAL_NULL */
+        emit(cg, "    jne     %s", lbl_end);
+        emit(cg, "%s:", lbl_rhs);
+        emit_expr(cg, node->children[1]);
+        emit(cg, "%s:", lbl_end);
+        break;
+    }
+
+    /* ── anonymous function expression: fn(params) { body } ──────────
+     * Synthesise a unique name, stash the node for later emission,
+     * then wrap the raw label address as a VAL_FUNCTION XlyVal* via
+     * xly_make_fn() so the value can be stored in a variable.         */
+    case NODE_ARROW_FN: {
+        char anon_name[64];
+        NameSet free_vars = {0};
+        arrow_fn_prepare(cg, node, anon_name, sizeof(anon_name), &free_vars);
+        /* Filter to only vars that actually exist in current scope */
+        NameSet captures = {0};
+        for (int i = 0; i < free_vars.count; i++) {
+            int off = var_offset(cg, free_vars.names[i]);
+            if (off != 0)
+                nameset_add(&captures, free_vars.names[i]);
+        }
+        /* `this` with no receiver in scope: the fn takes its own */
+        int recv = nameset_has(&free_vars, "this") && !nameset_has(&captures, "this");
+        nameset_free(&free_vars);
+
+        /* Stash for emission after main (captures.names ownership transferred) */
+        fn_stash(cg, recv ? fn_with_receiver(node) : node, anon_name,
+                 captures.names, captures.count);
+
+        if (captures.count == 0) {
+            /* No captures: simple function pointer wrap */
+            emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", anon_name);
+            if (recv) {
+                emit(cg, "    xorl    %%esi, %%esi");
+                emit(cg, "    xorl    %%edx, %%edx");
+                emit(cg, "    call    " XLY_SYM("xly_make_method"));
+            } else {
+                emit(cg, "    call    " XLY_SYM("xly_make_fn"));
+            }
+        } else {
+            /* Build env array on stack: [cap0, cap1, ...] */
+            int env_bytes = ((captures.count * 8) + 15) & ~15;
+            emit(cg, "    subq    $%d, %%rsp", env_bytes);
+            for (int i = 0; i < captures.count; i++) {
+                int off = var_offset(cg, captures.names[i]);
+                emit(cg, "    movq    %d(%%rbp), %%rax", off);
+                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+            }
+            /* xly_make_closure(fp, env, env_size) */
+            emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", anon_name);
+            emit(cg, "    movq    %%rsp, %%rsi");
+            emit(cg, "    movl    $%d, %%edx", captures.count);
+            emit(cg, "    call    %s", recv ? XLY_SYM("xly_make_method") : XLY_SYM("xly_make_closure"));
+            emit(cg, "    addq    $%d, %%rsp", env_bytes);
+        }
+        break;
+    }
+
+    /* ── identifier ──────────────────────────────────────────────────── */
+    case NODE_IDENTIFIER:
+        emit_load_name(cg, node->str_value);
+        break;
+
+    /* ── this ────────────────────────────────────────────────────────── */
+    case NODE_THIS:
+        if (var_offset(cg, "this") != 0)    /* the receiver param (see fn_uses_this) */
+            emit(cg, "    movq    %d(%%rbp), %%rax", var_offset(cg, "this"));
+        else                                /* a declared fn called by name */
+            emit(cg, "    call    " XLY_SYM("xly_null"));
+        break;
+
+    /* ── classes: new / super(...) / instanceof ──────────────────────── */
+    case NODE_NEW: {
+        int ci = class_find(cg, node->str_value);
+        if (ci < 0) { emit(cg, "    call    " XLY_SYM("xly_null")); break; }
+        int argc  = (int)node->child_count;
+        int bytes = emit_arg_array(cg, node->children, argc);
+        emit(cg, "    leaq    .Lxly_class_%d(%%rip), %%rdi", ci);
+        if (argc > 0) emit(cg, "    movq    %%rsp, %%rsi");
+        else          emit(cg, "    xorq    %%rsi, %%rsi");
+        emit(cg, "    movl    $%d, %%edx", argc);
+        emit(cg, "    call    " XLY_SYM("xly_construct"));
+        if (bytes > 0) emit(cg, "    addq    $%d, %%rsp", bytes);
+        break;
+    }
+    case NODE_SUPER_CALL: {
+        int p = cg->cur_cls >= 0 ? cg->classes[cg->cur_cls].parent : -1;
+        if (p < 0 || var_offset(cg, "this") == 0) {
+            emit(cg, "    call    " XLY_SYM("xly_null"));
+            break;
+        }
+        int argc  = (int)node->child_count;
+        int bytes = emit_arg_array(cg, node->children, argc);
+        emit(cg, "    leaq    .Lxly_class_%d(%%rip), %%rdi", p);
+        emit(cg, "    movq    %d(%%rbp), %%rsi", var_offset(cg, "this"));
+        if (argc > 0) emit(cg, "    movq    %%rsp, %%rdx");
+        else          emit(cg, "    xorq    %%rdx, %%rdx");
+        emit(cg, "    movl    $%d, %%ecx", argc);
+        emit(cg, "    call    " XLY_SYM("xly_call_init"));
+        if (bytes > 0) emit(cg, "    addq    $%d, %%rsp", bytes);
+        break;
+    }
+    case NODE_INSTANCEOF: {
+        int ci = class_find(cg, node->children[1]->str_value);
+        emit_expr(cg, node->children[0]);
+        if (ci < 0) {
+            emit(cg, "    xorl    %%edi, %%edi");
+            emit(cg, "    call    " XLY_SYM("xly_bool"));
+            break;
+        }
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    leaq    .Lxly_class_%d(%%rip), %%rsi", ci);
+        emit(cg, "    call    " XLY_SYM("xly_instanceof"));
+        break;
+    }
+
+    /* ── binary ──────────────────────────────────────────────────────── */
+    case NODE_BINARY: {
+        const char *op = node->str_value;
+
+        /* ── short-circuit: and ──
+         * eval left → if falsy jump to end (result = left)
+         * eval right → result = right                          */
+        if (strcmp(op, "and") == 0) {
+            char lbl_end[64], lbl_done[64];
+            int seq = cg->label_seq++;
+            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%s%d_and_end",  cg->label_pfx, seq);
+            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%s%d_and_done", cg->label_pfx, seq);
+
+            emit_expr(cg, node->children[0]);          /* left → %rax */
+            emit(cg, "    subq    $16, %%rsp");        /* aligned spill slot */
+            emit(cg, "    movq    %%rax, (%%rsp)");    /* save left */
+            emit(cg, "    movq    %%rax, %%rdi");
+            emit(cg, "    call    " XLY_SYM("xly_truthy"));        /* eax = 0|1 */
+            emit(cg, "    testl   %%eax, %%eax");
+            emit(cg, "    jz      %s", lbl_end);       /* falsy → keep left */
+            /* truthy: discard left, eval right */
+            emit(cg, "    addq    $16, %%rsp");        /* free spill slot */
+            emit_expr(cg, node->children[1]);          /* right → %rax */
+            emit(cg, "    jmp     %s", lbl_done);
+            emit(cg, "%s:", lbl_end);                  /* falsy exit: left in spill slot */
+            emit(cg, "    movq    (%%rsp), %%rax");    /* restore left */
+            emit(cg, "    addq    $16, %%rsp");
+            emit(cg, "%s:", lbl_done);
+            break;
+        }
+
+        /* ── short-circuit: or ──
+         * eval left → if truthy jump to end (result = left)
+         * eval right → result = right                          */
+        if (strcmp(op, "or") == 0) {
+            char lbl_end[64], lbl_done[64];
+            int seq = cg->label_seq++;
+            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%s%d_or_end",  cg->label_pfx, seq);
+            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%s%d_or_done", cg->label_pfx, seq);
+
+            emit_expr(cg, node->children[0]);
+            emit(cg, "    subq    $16, %%rsp");        /* aligned spill slot */
+            emit(cg, "    movq    %%rax, (%%rsp)");    /* save left */
+            emit(cg, "    movq    %%rax, %%rdi");
+            emit(cg, "    call    " XLY_SYM("xly_truthy"));
+            emit(cg, "    testl   %%eax, %%eax");
+            emit(cg, "    jnz     %s", lbl_end);       /* truthy → keep left */
+            emit(cg, "    addq    $16, %%rsp");        /* free spill slot */
+            emit_expr(cg, node->children[1]);
+            emit(cg, "    jmp     %s", lbl_done);
+            emit(cg, "%s:", lbl_end);
+            emit(cg, "    movq    (%%rsp), %%rax");    /* restore left */
+            emit(cg, "    addq    $16, %%rsp");
+            emit(cg, "%s:", lbl_done);
+            break;
+        }
+
+        /* ── general binary op ──
+         * OPTIMIZATION: For arithmetic ops (+,-,*,/), emit unboxed floating-point
+         * ops to avoid boxing overhead. BUT: + is also string concat, so we need
+         * a runtime type check before unboxing. */
+        int is_arith = (strcmp(op,"+") == 0 || strcmp(op,"-") == 0 || 
+                        strcmp(op,"*") == 0 || strcmp(op,"/") == 0);
+
+        if (is_arith) {
+            /* For +, we need to handle string concatenation.
+             * Strategy: check if left operand is a string at runtime.
+             * If yes, fall back to xly_add. Otherwise, use unboxed path. */
+            int is_plus = (strcmp(op,"+") == 0);
+            
+            /* Handle special case: both operands are number literals */
+            if (node->children[0]->type == NODE_NUMBER && 
+                node->children[1]->type == NODE_NUMBER) {
+                /* Ultra-fast path: compile-time constant folding */
+                double left_val = node->children[0]->num_value;
+                double right_val = node->children[1]->num_value;
+                double result;
+                if      (strcmp(op,"+") == 0) result = left_val + right_val;
+                else if (strcmp(op,"-") == 0) result = left_val - right_val;
+                else if (strcmp(op,"*") == 0) result = left_val * right_val;
+                else                          result = left_val / right_val;
+                
+                uint64_t bits;
+                memcpy(&bits, &result, sizeof(double));
+                emit(cg, "    movabsq $%lu, %%rax", bits);
                 emit(cg, "    movq    %%rax, -8(%%rsp)");
                 emit(cg, "    movsd   -8(%%rsp), %%xmm0");
                 emit(cg, "    call    " XLY_SYM("xly_num"));
@@ -748,1222 +3885,2487 @@ static void emit_expr(CG *cg, ASTNode *node) {
                 emit(cg, "    movsd   8(%%rsi), %%xmm1");
                 emit(cg, "    addsd   %%xmm1, %%xmm0");
                 emit(cg, "    call    " XLY_SYM("xly_num"));
-                emit(cg, "    jmp     %s", lbl_end);
-                
-                /* Slow path: call xly_add for string concat or mixed types */
-                emit(cg, "%s:", lbl_slow);
-                emit(cg, "    call    " XLY_SYM("xly_add"));
-                
-                emit(cg, "%s:", lbl_end);
+                emit(cg, "    jmp     %s", lbl_end);
+                
+                /* Slow path: call xly_add for string concat or mixed types */
+                emit(cg, "%s:", lbl_slow);
+                emit(cg, "    call    " XLY_SYM("xly_add"));
+                
+                emit(cg, "%s:", lbl_end);
+            } else {
+                /* For -, *, /: always use unboxed path (no string operations) */
+                
+                /* Eval left operand → %rax (XlyVal*) */
+                emit_expr(cg, node->children[0]);
+                emit(cg, "    subq    $16, %%rsp");     /* aligned spill for left */
+                emit(cg, "    movq    %%rax, (%%rsp)"); /* save left boxed */
+                
+                /* Eval right operand → %rax (XlyVal*) */
+                emit_expr(cg, node->children[1]);
+                emit(cg, "    movq    %%rax, %%rsi");   /* rsi = right boxed */
+                emit(cg, "    movq    (%%rsp), %%rdi"); /* rdi = left boxed */
+                emit(cg, "    addq    $16, %%rsp");     /* free spill slot */
+                
+                /* Unbox both */
+                emit(cg, "    movsd   8(%%rdi), %%xmm0");
+                emit(cg, "    movsd   8(%%rsi), %%xmm1");
+                
+                /* Perform arithmetic */
+                if      (strcmp(op,"-") == 0) emit(cg, "    subsd   %%xmm1, %%xmm0");
+                else if (strcmp(op,"*") == 0) emit(cg, "    mulsd   %%xmm1, %%xmm0");
+                else if (strcmp(op,"/") == 0) emit(cg, "    divsd   %%xmm1, %%xmm0");
+                
+                /* Box result */
+                emit(cg, "    call    " XLY_SYM("xly_num"));
+            }
+        } else {
+            /* ── Comparisons and other ops ─────────────────────────────────── */
+            int is_comparison = (strcmp(op,"<") == 0 || strcmp(op,">") == 0 || 
+                                strcmp(op,"<=") == 0 || strcmp(op,">=") == 0 ||
+                                strcmp(op,"==") == 0 || strcmp(op,"!=") == 0);
+            
+            if (is_comparison) {
+                /* OPTIMIZATION: Unboxed comparisons for numbers */
+                if (node->children[0]->type == NODE_NUMBER && 
+                    node->children[1]->type == NODE_NUMBER) {
+                    /* Compile-time constant folding */
+                    double left_val = node->children[0]->num_value;
+                    double right_val = node->children[1]->num_value;
+                    int result;
+                    if      (strcmp(op,"<") == 0)  result = left_val < right_val;
+                    else if (strcmp(op,">") == 0)  result = left_val > right_val;
+                    else if (strcmp(op,"<=") == 0) result = left_val <= right_val;
+                    else if (strcmp(op,">=") == 0) result = left_val >= right_val;
+                    else if (strcmp(op,"==") == 0) result = left_val == right_val;
+                    else                           result = left_val != right_val;
+                    
+                    emit(cg, "    movl    $%d, %%edi", result);
+                    emit(cg, "    call    " XLY_SYM("xly_bool"));
+                } else {
+                    /* Runtime unboxed comparison */
+                    char lbl_slow[64], lbl_end[64];
+                    fresh_label(cg, lbl_slow, sizeof(lbl_slow));
+                    fresh_label(cg, lbl_end, sizeof(lbl_end));
+                    
+                    emit_expr(cg, node->children[0]);
+                    emit(cg, "    subq    $16, %%rsp");     /* aligned spill */
+                    emit(cg, "    movq    %%rax, (%%rsp)"); /* save left */
+                    emit_expr(cg, node->children[1]);
+                    emit(cg, "    movq    %%rax, %%rsi");
+                    emit(cg, "    movq    (%%rsp), %%rdi"); /* restore left */
+                    emit(cg, "    addq    $16, %%rsp");
+                    
+                    /* Check if both are numbers */
+                    emit(cg, "    cmpl    $0, (%%rdi)");
+                    emit(cg, "    jne     %s", lbl_slow);
+                    emit(cg, "    cmpl    $0, (%%rsi)");
+                    emit(cg, "    jne     %s", lbl_slow);
+                    
+                    /* Fast path: unbox and compare */
+                    emit(cg, "    movsd   8(%%rdi), %%xmm0");
+                    emit(cg, "    movsd   8(%%rsi), %%xmm1");
+                    emit(cg, "    ucomisd %%xmm1, %%xmm0");
+                    
+                    if (strcmp(op,"<") == 0)       emit(cg, "    setb    %%al");
+                    else if (strcmp(op,">") == 0)  emit(cg, "    seta    %%al");
+                    else if (strcmp(op,"<=") == 0) emit(cg, "    setbe   %%al");
+                    else if (strcmp(op,">=") == 0) emit(cg, "    setae   %%al");
+                    else if (strcmp(op,"==") == 0) emit(cg, "    sete    %%al");
+                    else                           emit(cg, "    setne   %%al");
+                    
+                    emit(cg, "    movzbl  %%al, %%edi");
+                    emit(cg, "    call    " XLY_SYM("xly_bool"));
+                    emit(cg, "    jmp     %s", lbl_end);
+                    
+                    /* Slow path */
+                    emit(cg, "%s:", lbl_slow);
+                    const char *fn = NULL;
+                    if      (strcmp(op,"==") == 0) fn = XLY_SYM("xly_eq");
+                    else if (strcmp(op,"!=") == 0) fn = XLY_SYM("xly_neq");
+                    else if (strcmp(op,"<")  == 0) fn = XLY_SYM("xly_lt");
+                    else if (strcmp(op,">")  == 0) fn = XLY_SYM("xly_gt");
+                    else if (strcmp(op,"<=") == 0) fn = XLY_SYM("xly_lte");
+                    else if (strcmp(op,">=") == 0) fn = XLY_SYM("xly_gte");
+                    if (fn) emit(cg, "    call    %s", fn);
+                    emit(cg, "%s:", lbl_end);
+                }
+            } else {
+                /* Slow path for other ops */
+                emit_expr(cg, node->children[0]);
+                emit(cg, "    subq    $16, %%rsp");     /* aligned spill */
+                emit(cg, "    movq    %%rax, (%%rsp)"); /* save left */
+                emit_expr(cg, node->children[1]);
+                emit(cg, "    movq    %%rax, %%rsi");
+                emit(cg, "    movq    (%%rsp), %%rdi"); /* restore left */
+                emit(cg, "    addq    $16, %%rsp");
+
+                const char *fn = NULL;
+                if (strcmp(op,"%") == 0) fn = XLY_SYM("xly_mod");
+                if (fn) emit(cg, "    call    %s", fn);
+            }
+        }
+        break;
+    }
+
+    /* ── unary ─────────────────────────────────────────────────────── */
+    case NODE_UNARY:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    %s",
+             strcmp(node->str_value, "-") == 0 ? XLY_SYM("xly_neg") : XLY_SYM("xly_not"));
+        break;
+
+    /* ── user function call ──────────────────────────────────────────
+     * If the callee name is a declared fn → direct call .Lxly_fn_<name>
+     * If the callee name is a variable (holding a VAL_FUNCTION XlyVal*)
+     *   → load from stack, extract .fn ptr at offset 32, indirect call.
+     * Args are eval'd left-to-right, spilled, then loaded into SysV regs. */
+    case NODE_FN_CALL: {
+        int nargs = (int)node->child_count;
+
+        /* ── enum variant constructor ───────────────────────────────────────
+         * If the callee name is a known variant, emit xly_make_variant call. */
+        if (node->str_value && variant_find(cg, node->str_value) >= 0) {
+            /* Build args array on stack, call xly_make_variant(tag, arr, n, id) */
+            int arr_bytes = nargs > 0 ? (((nargs * 8) + 15) & ~15) : 0;
+            if (arr_bytes > 0)
+                emit(cg, "    subq    $%d, %%rsp", arr_bytes);
+            for (int i = 0; i < nargs; i++) {
+                emit_expr(cg, node->children[i]);
+                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+            }
+            /* rdi = tag string (intern the variant name as a string literal) */
+            const char *tag_lbl = intern_string(cg, node->str_value);
+            emit(cg, "    leaq    %s(%%rip), %%rdi", tag_lbl);
+            emit(cg, "    call    " XLY_SYM("xly_str"));
+            emit(cg, "    movq    %%rax, %%rdi");         /* rdi = tag XlyVal* */
+            if (nargs > 0)
+                emit(cg, "    movq    %%rsp, %%rsi");     /* rsi = fields ptr  */
+            else
+                emit(cg, "    xorq    %%rsi, %%rsi");
+            emit(cg, "    movl    $%d, %%edx", nargs);   /* edx = nfields     */
+            emit(cg, "    movl    $%d, %%ecx", variant_id(cg, node->str_value));
+            emit(cg, "    call    " XLY_SYM("xly_make_variant"));
+            if (arr_bytes > 0)
+                emit(cg, "    addq    $%d, %%rsp", arr_bytes);
+            break;
+        }
+
+        /* ── variable-fn path: use xly_call_fnval (all args in array) ─────
+         * Handles any number of args cleanly via the args array.           */
+        int var_off = var_offset(cg, node->str_value);
+        int gi_fn   = (var_off == 0) ? gvar_find(cg, node->str_value) : -1;
+        int is_var_fn = !fn_is_known(cg, node->str_value)
+                        && (var_off != 0 || gi_fn >= 0);
+
+        if (is_var_fn) {
+            int arr_bytes = nargs > 0 ? (((nargs * 8) + 15) & ~15) : 0;
+            if (arr_bytes > 0)
+                emit(cg, "    subq    $%d, %%rsp", arr_bytes);
+            for (int i = 0; i < nargs; i++) {
+                emit_expr(cg, node->children[i]);
+                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+            }
+            if (var_off != 0)
+                emit(cg, "    movq    %d(%%rbp), %%rdi", var_off);
+            else
+                emit(cg, "    movq    " XLY_SYM("__xly_globals") "+%d(%%rip), %%rdi", gi_fn * 8);
+            if (nargs > 0)
+                emit(cg, "    movq    %%rsp, %%rsi");
+            else
+                emit(cg, "    xorq    %%rsi, %%rsi");
+            emit(cg, "    movl    $%d, %%edx", nargs);
+            emit(cg, "    call    " XLY_SYM("xly_call_fnval"));
+            if (arr_bytes > 0)
+                emit(cg, "    addq    $%d, %%rsp", arr_bytes);
+            break;
+        }
+
+        if (!fn_is_known(cg, node->str_value)) {
+            emit(cg, "    call    " XLY_SYM("xly_null"));
+            break;
+        }
+
+        emit_call_label(cg, node->children, nargs,
+                        fn_resolve_label(cg, node->str_value));
+        break;
+    }
+
+    /* ── module method call  (mod.fn(args…)) ─────────────────────────
+     * Signature: xly_call_module(const char *mod, const char *fn,
+     *                            XlyVal **args, size_t argc)
+     *            rdi             rsi             rdx              rcx
+     *
+     * SYSTEMS PROGRAMMING OPTIMIZATIONS (xenlyc v0.1.0):
+     *   O2: sys.CONSTANT() zero-arg calls → inlined immediate (no call)
+     *   O1: sys.exit/abort detected → noreturn_mode set for dead-code elim
+     */
+    case NODE_METHOD_CALL: {
+        const char *mod_name = node->children[0]->str_value;
+        const char *fn_name  = node->str_value;
+        int argc = (int)node->child_count - 1;
+
+        /* ── Detect local-variable object method call ───────────────────────
+         * If children[0] is an identifier that resolves to a local variable
+         * (not a module), treat this as obj.method(args) via xly_obj_call.
+         * xly_obj_call(obj, method, args_array, argc)                         */
+        int obj_var_off = (node->children[0]->type == NODE_IDENTIFIER)
+                          ? var_offset(cg, mod_name) : 0;
+        /* Also handle chained expressions: if children[0] is not a simple
+         * identifier, always eval it and use obj_call. */
+        int is_obj_call = (obj_var_off != 0) ||
+                          (node->children[0]->type != NODE_IDENTIFIER);
+
+        if (is_obj_call) {
+            /* Build args array on stack */
+            int arr_bytes = argc > 0 ? (((argc * 8) + 15) & ~15) : 0;
+            if (arr_bytes > 0)
+                emit(cg, "    subq    $%d, %%rsp", arr_bytes);
+            for (int i = 0; i < argc; i++) {
+                emit_expr(cg, node->children[i + 1]);
+                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+            }
+            /* Eval the object expression */
+            emit_expr(cg, node->children[0]);
+            emit(cg, "    movq    %%rax, %%rdi");           /* obj */
+            const char *mfl = intern_string(cg, fn_name);
+            emit(cg, "    leaq    %s(%%rip), %%rsi", mfl); /* method name */
+            if (argc > 0)
+                emit(cg, "    movq    %%rsp, %%rdx");       /* args array */
+            else
+                emit(cg, "    xorq    %%rdx, %%rdx");
+            emit(cg, "    movl    $%d, %%ecx", argc);
+            emit(cg, "    call    " XLY_SYM("xly_obj_call"));
+            if (arr_bytes > 0)
+                emit(cg, "    addq    $%d, %%rsp", arr_bytes);
+            break;
+        }
+
+        /* ── exported fn of an imported user module: direct call ─────────── */
+        const UnitImport *ux = gvar_find(cg, mod_name) < 0
+                             ? unit_export_call(cg, mod_name, fn_name) : NULL;
+        if (ux) {
+            emit_call_label(cg, node->children + 1, argc, ux->label);
+            break;
+        }
+
+        /* ── O2+: sys constant inlining ────────────────────────────────────
+         * Zero-arg sys functions returning compile-time constants are inlined
+         * as immediate loads — eliminates call overhead in tight sys loops.  */
+        if (cg->opt_level >= 2 && strcmp(mod_name, "sys") == 0 && argc == 0) {
+            long long cval;
+            if (sys_const_lookup(fn_name, &cval)) {
+                if (cg->verbose)
+                    emit(cg, "    # [xenlyc] inline sys.%s() = %lld", fn_name, cval);
+                emit_load_double(cg, (double)cval);
+                emit(cg, "    call    " XLY_SYM("xly_num"));
+                cg->stat_sys_inline++;
+                goto x86_method_done;
+            }
+        }
+
+        /* ── O1+: noreturn detection ────────────────────────────────────────
+         * sys.exit() and sys.abort() do not return — set noreturn_mode so
+         * the enclosing statement compiler skips subsequent dead code.       */
+        int is_noreturn = (cg->opt_level >= 1 &&
+                           strcmp(mod_name, "sys") == 0 &&
+                           (strcmp(fn_name, "exit") == 0 ||
+                            strcmp(fn_name, "abort") == 0));
+
+        /* ── general dispatch via xly_call_module ─────────────────────────
+         * math.* / string.* call their native directly: (args, argc).     */
+        {
+            char nsym[128];
+            const char *native = module_native(mod_name, fn_name, nsym, sizeof(nsym));
+            int slot_bytes  = argc * 8;
+            int alloc_bytes = argc > 0 ? ((slot_bytes + 15) & ~15) : 0;
+
+            if (alloc_bytes > 0)
+                emit(cg, "    subq    $%d, %%rsp", alloc_bytes);
+
+            for (int i = 0; i < argc; i++) {
+                emit_expr(cg, node->children[i + 1]);
+                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+            }
+
+            if (native) {
+                if (argc > 0)
+                    emit(cg, "    movq    %%rsp, %%rdi");
+                else
+                    emit(cg, "    xorq    %%rdi, %%rdi");
+                emit(cg, "    movl    $%d, %%esi", argc);
+                emit(cg, "    call    %s", native);
+                cg->stat_native_calls++;
             } else {
-                /* For -, *, /: always use unboxed path (no string operations) */
-                
-                /* Eval left operand → %rax (XlyVal*) */
-                emit_expr(cg, node->children[0]);
-                emit(cg, "    subq    $16, %%rsp");     /* aligned spill for left */
-                emit(cg, "    movq    %%rax, (%%rsp)"); /* save left boxed */
-                
-                /* Eval right operand → %rax (XlyVal*) */
-                emit_expr(cg, node->children[1]);
-                emit(cg, "    movq    %%rax, %%rsi");   /* rsi = right boxed */
-                emit(cg, "    movq    (%%rsp), %%rdi"); /* rdi = left boxed */
-                emit(cg, "    addq    $16, %%rsp");     /* free spill slot */
-                
-                /* Unbox both */
-                emit(cg, "    movsd   8(%%rdi), %%xmm0");
-                emit(cg, "    movsd   8(%%rsi), %%xmm1");
-                
-                /* Perform arithmetic */
-                if      (strcmp(op,"-") == 0) emit(cg, "    subsd   %%xmm1, %%xmm0");
-                else if (strcmp(op,"*") == 0) emit(cg, "    mulsd   %%xmm1, %%xmm0");
-                else if (strcmp(op,"/") == 0) emit(cg, "    divsd   %%xmm1, %%xmm0");
-                
-                /* Box result */
-                emit(cg, "    call    " XLY_SYM("xly_num"));
+                if (argc > 0)
+                    emit(cg, "    movq    %%rsp, %%rdx");
+                else
+                    emit(cg, "    xorq    %%rdx, %%rdx");
+
+                const char *ml = intern_string(cg, mod_name);
+                const char *fl = intern_string(cg, fn_name);
+                emit(cg, "    leaq    %s(%%rip), %%rdi", ml);
+                emit(cg, "    leaq    %s(%%rip), %%rsi", fl);
+                emit(cg, "    movl    $%d, %%ecx", argc);
+                emit(cg, "    call    " XLY_SYM("xly_call_module"));
+            }
+
+            if (alloc_bytes > 0)
+                emit(cg, "    addq    $%d, %%rsp", alloc_bytes);
+
+            if (is_noreturn) {
+                if (cg->verbose)
+                    emit(cg, "    # [xenlyc] noreturn: dead code elision after this point");
+                cg->noreturn_mode = 1;
+                cg->stat_noreturn_elim++;
             }
+        }
+
+        x86_method_done:;
+        break;
+    }
+
+    /* ── typeof ────────────────────────────────────────────────────── */
+    case NODE_TYPEOF:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_typeof"));
+        break;
+
+    /* ── increment / decrement as expression ───────────────────────── */
+    case NODE_INCREMENT:
+    case NODE_DECREMENT: {
+        int off = var_offset(cg, node->str_value);
+        /* load current value — aligned spill across xly_num call */
+        emit(cg, "    movq    %d(%%rbp), %%rax", off);
+        emit(cg, "    subq    $16, %%rsp");       /* aligned spill slot */
+        emit(cg, "    movq    %%rax, (%%rsp)");   /* save current */
+        emit_load_double(cg, 1.0);
+        emit(cg, "    call    " XLY_SYM("xly_num"));          /* rax = num(1) */
+        emit(cg, "    movq    %%rax, %%rsi");     /* rsi = num(1) */
+        emit(cg, "    movq    (%%rsp), %%rdi");   /* rdi = current value */
+        emit(cg, "    addq    $16, %%rsp");
+        emit(cg, "    call    %s",
+             node->type == NODE_INCREMENT ? XLY_SYM("xly_add") : XLY_SYM("xly_sub"));
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+        break;
+    }
+
+    /* ── array literal [expr, expr, ...] ───────────────────────────── */
+    case NODE_ARRAY_LITERAL: {
+        int nelems = (int)node->child_count;
+
+        /* Use sub+store (not push) so alignment is deterministic.
+         * xly_array_create(XlyVal **elements, size_t count): rdi, rsi */
+        int alloc_bytes = nelems > 0 ? (((nelems * 8) + 15) & ~15) : 0;
+
+        if (alloc_bytes > 0)
+            emit(cg, "    subq    $%d, %%rsp", alloc_bytes);
+
+        /* Eval each element left-to-right, store at rsp[i*8] */
+        for (int i = 0; i < nelems; i++) {
+            emit_expr(cg, node->children[i]);
+            emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+        }
+
+        if (nelems > 0)
+            emit(cg, "    movq    %%rsp, %%rdi");
+        else
+            emit(cg, "    xorq    %%rdi, %%rdi");  /* NULL for empty */
+        emit(cg, "    movq    $%d, %%rsi", nelems);
+        emit(cg, "    call    " XLY_SYM("xly_array_create"));
+
+        if (alloc_bytes > 0)
+            emit(cg, "    addq    $%d, %%rsp", alloc_bytes);
+        break;
+    }
+
+    /* ── array/string indexing arr[index] ──────────────────────────── */
+    case NODE_INDEX: {
+        /* children[0] = array/string, children[1] = index */
+        emit_expr(cg, node->children[0]);  /* array in rax */
+        emit(cg, "    subq    $16, %%rsp");     /* aligned spill */
+        emit(cg, "    movq    %%rax, (%%rsp)"); /* save array */
+        emit_expr(cg, node->children[1]);  /* index in rax */
+        emit(cg, "    movq    %%rax, %%rsi");   /* index to rsi */
+        emit(cg, "    movq    (%%rsp), %%rdi"); /* array to rdi */
+        emit(cg, "    addq    $16, %%rsp");
+        emit(cg, "    call    " XLY_SYM("xly_index"));
+        break;
+    }
+
+    /* ── object literal  { key: val, key: val, ... } ───────────────── */
+    case NODE_OBJECT_LITERAL: {
+        /* Parser produces: NODE_OBJECT_LITERAL
+         *   children[i] = NODE_NAMED_ARG { str_value=key, children[0]=val_expr }
+         * Create empty object, then set each field.                          */
+        emit(cg, "    call    " XLY_SYM("xly_obj_new"));
+        /* Spill obj ptr onto stack */
+        emit(cg, "    subq    $16, %%rsp");
+        emit(cg, "    movq    %%rax, (%%rsp)");
+        int npairs = (int)node->child_count;
+        for (int i = 0; i < npairs; i++) {
+            ASTNode *pair = node->children[i];    /* NODE_NAMED_ARG */
+            const char *key_str = pair->str_value;
+            ASTNode *val_node   = pair->child_count > 0 ? pair->children[0] : NULL;
+            const char *kl = atom_label(cg, key_str);
+            /* Eval value; spill obj across the eval */
+            if (val_node)
+                emit_expr(cg, val_node);
+            else
+                emit(cg, "    call    " XLY_SYM("xly_null"));
+            emit(cg, "    movq    %%rax, %%rdx");          /* rdx = value */
+            emit(cg, "    movq    (%%rsp), %%rdi");        /* rdi = obj */
+            emit(cg, "    movq    %s(%%rip), %%rsi", kl); /* rsi = key */
+            emit(cg, "    call    " XLY_SYM("xly_obj_set_atom"));
+        }
+        emit(cg, "    movq    (%%rsp), %%rax");  /* return obj in rax */
+        emit(cg, "    addq    $16, %%rsp");
+        break;
+    }
+
+    /* ── property get  obj.field ──────────────────────────────────── */
+    case NODE_PROPERTY_GET: {
+        /* children[0] = object expression, str_value = field name */
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        const char *fl = atom_label(cg, node->str_value);
+        emit(cg, "    movq    %s(%%rip), %%rsi", fl);
+        emit(cg, "    call    " XLY_SYM("xly_obj_get_atom"));
+        break;
+    }
+
+    /* ── property set  obj.field = val  (as expression) ─────────────
+     * children[0] = object, children[1] = value; str_value = field   */
+    case NODE_PROPERTY_SET: {
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    subq    $16, %%rsp");
+        emit(cg, "    movq    %%rax, (%%rsp)");   /* spill obj */
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    movq    %%rax, %%rdx");     /* rdx = val */
+        emit(cg, "    movq    (%%rsp), %%rdi");   /* rdi = obj */
+        emit(cg, "    addq    $16, %%rsp");
+        const char *fl2 = atom_label(cg, node->str_value);
+        emit(cg, "    movq    %s(%%rip), %%rsi", fl2);
+        emit(cg, "    call    " XLY_SYM("xly_obj_set_atom"));
+        /* return the object (rdi) for chaining */
+        emit(cg, "    movq    %%rdi, %%rax");
+        break;
+    }
+
+    /* ── await expr ─────────────────────────────────────────────────────
+     * await fn_call  — synchronous in current impl: just evaluate the call.
+     * children[0] = the call expression (NODE_FN_CALL or NODE_CALL_EXPR).  */
+    case NODE_AWAIT:
+        emit_expr(cg, node->children[0]);
+        break;
+
+    /* ── spawn expr ─────────────────────────────────────────────────────
+     * spawn fn_call  — the function value and the args are evaluated here,
+     * the call is queued on a worker thread:
+     *   xly_spawn(fn_val, args_array, argc)  → null
+     * Anything but a call of a function or variable runs inline.          */
+    case NODE_SPAWN: {
+        ASTNode *call = node->children[0];
+        if (!spawn_target(cg, call)) {
+            emit_expr(cg, call);
+            emit(cg, "    call    " XLY_SYM("xly_null"));  /* spawn → null */
+            break;
+        }
+        int argc  = (int)call->child_count;
+        int bytes = emit_arg_array(cg, call->children, argc);
+        emit_load_name(cg, call->str_value);
+        emit(cg, "    movq    %%rax, %%rdi");
+        if (argc > 0) emit(cg, "    movq    %%rsp, %%rsi");
+        else          emit(cg, "    xorq    %%rsi, %%rsi");
+        emit(cg, "    movl    $%d, %%edx", argc);
+        emit(cg, "    call    " XLY_SYM("xly_spawn"));
+        if (bytes > 0) emit(cg, "    addq    $%d, %%rsp", bytes);
+        break;
+    }
+
+    /* ── fallback ──────────────────────────────────────────────────── */
+    default:
+        emit(cg, "    call    " XLY_SYM("xly_null"));
+        break;
+    }
+}
+
+/* ── statement compiler (x86-64) — Post-condition: %%rsp unchanged from entry.
+ * If noreturn_mode is set (after sys.exit/abort), all subsequent statements
+ * are elided — the code is unreachable and emitting it wastes binary space.  */
+static void emit_stmt(CG *cg, ASTNode *node) {
+    if (!node) return;
+    /* Dead code elimination after noreturn calls (O1+) */
+    if (cg->noreturn_mode) {
+        cg->stat_noreturn_elim++;
+        return;
+    }
+
+    switch (node->type) {
+
+    /* ── var/const decl ────────────────────────────────────────────── */
+    case NODE_VAR_DECL:
+    case NODE_CONST_DECL: {
+        if (node->child_count > 0)
+            emit_expr(cg, node->children[0]);
+        else
+            emit(cg, "    call    " XLY_SYM("xly_null"));
+        if (cg->in_main_scope && cg->scope_depth == 0) {
+            /* Top-level decl: store in global slot so functions can read it */
+            int gi = gvar_declare(cg, node->str_value);
+            emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
+            /* Also declare a local alias for use within main() */
+            int off = var_declare(cg, node->str_value);
+            emit(cg, "    movq    %%rax, %d(%%rbp)", off);
         } else {
-            /* ── Comparisons and other ops ─────────────────────────────────── */
-            int is_comparison = (strcmp(op,"<") == 0 || strcmp(op,">") == 0 || 
-                                strcmp(op,"<=") == 0 || strcmp(op,">=") == 0 ||
-                                strcmp(op,"==") == 0 || strcmp(op,"!=") == 0);
-            
-            if (is_comparison) {
-                /* OPTIMIZATION: Unboxed comparisons for numbers */
-                if (node->children[0]->type == NODE_NUMBER && 
-                    node->children[1]->type == NODE_NUMBER) {
-                    /* Compile-time constant folding */
-                    double left_val = node->children[0]->num_value;
-                    double right_val = node->children[1]->num_value;
-                    int result;
-                    if      (strcmp(op,"<") == 0)  result = left_val < right_val;
-                    else if (strcmp(op,">") == 0)  result = left_val > right_val;
-                    else if (strcmp(op,"<=") == 0) result = left_val <= right_val;
-                    else if (strcmp(op,">=") == 0) result = left_val >= right_val;
-                    else if (strcmp(op,"==") == 0) result = left_val == right_val;
-                    else                           result = left_val != right_val;
-                    
-                    emit(cg, "    movl    $%d, %%edi", result);
-                    emit(cg, "    call    " XLY_SYM("xly_bool"));
-                } else {
-                    /* Runtime unboxed comparison */
-                    char lbl_slow[64], lbl_end[64];
-                    fresh_label(cg, lbl_slow, sizeof(lbl_slow));
-                    fresh_label(cg, lbl_end, sizeof(lbl_end));
-                    
-                    emit_expr(cg, node->children[0]);
-                    emit(cg, "    subq    $16, %%rsp");     /* aligned spill */
-                    emit(cg, "    movq    %%rax, (%%rsp)"); /* save left */
-                    emit_expr(cg, node->children[1]);
-                    emit(cg, "    movq    %%rax, %%rsi");
-                    emit(cg, "    movq    (%%rsp), %%rdi"); /* restore left */
-                    emit(cg, "    addq    $16, %%rsp");
-                    
-                    /* Check if both are numbers */
-                    emit(cg, "    cmpl    $0, (%%rdi)");
-                    emit(cg, "    jne     %s", lbl_slow);
-                    emit(cg, "    cmpl    $0, (%%rsi)");
-                    emit(cg, "    jne     %s", lbl_slow);
-                    
-                    /* Fast path: unbox and compare */
-                    emit(cg, "    movsd   8(%%rdi), %%xmm0");
-                    emit(cg, "    movsd   8(%%rsi), %%xmm1");
-                    emit(cg, "    ucomisd %%xmm1, %%xmm0");
-                    
-                    if (strcmp(op,"<") == 0)       emit(cg, "    setb    %%al");
-                    else if (strcmp(op,">") == 0)  emit(cg, "    seta    %%al");
-                    else if (strcmp(op,"<=") == 0) emit(cg, "    setbe   %%al");
-                    else if (strcmp(op,">=") == 0) emit(cg, "    setae   %%al");
-                    else if (strcmp(op,"==") == 0) emit(cg, "    sete    %%al");
-                    else                           emit(cg, "    setne   %%al");
-                    
-                    emit(cg, "    movzbl  %%al, %%edi");
-                    emit(cg, "    call    " XLY_SYM("xly_bool"));
-                    emit(cg, "    jmp     %s", lbl_end);
-                    
-                    /* Slow path */
-                    emit(cg, "%s:", lbl_slow);
-                    const char *fn = NULL;
-                    if      (strcmp(op,"==") == 0) fn = XLY_SYM("xly_eq");
-                    else if (strcmp(op,"!=") == 0) fn = XLY_SYM("xly_neq");
-                    else if (strcmp(op,"<")  == 0) fn = XLY_SYM("xly_lt");
-                    else if (strcmp(op,">")  == 0) fn = XLY_SYM("xly_gt");
-                    else if (strcmp(op,"<=") == 0) fn = XLY_SYM("xly_lte");
-                    else if (strcmp(op,">=") == 0) fn = XLY_SYM("xly_gte");
-                    if (fn) emit(cg, "    call    %s", fn);
-                    emit(cg, "%s:", lbl_end);
-                }
-            } else {
-                /* Slow path for other ops */
-                emit_expr(cg, node->children[0]);
-                emit(cg, "    subq    $16, %%rsp");     /* aligned spill */
-                emit(cg, "    movq    %%rax, (%%rsp)"); /* save left */
-                emit_expr(cg, node->children[1]);
-                emit(cg, "    movq    %%rax, %%rsi");
-                emit(cg, "    movq    (%%rsp), %%rdi"); /* restore left */
-                emit(cg, "    addq    $16, %%rsp");
+            int off = var_declare(cg, node->str_value);
+            emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+        }
+        break;
+    }
+
+    /* ── assign  (str_value = varname, children[0] = rhs) ─────────── */
+    case NODE_ASSIGN: {
+        emit_expr(cg, node->children[0]);
+        int off = var_offset(cg, node->str_value);
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+        break;
+    }
+
+    /* ── compound assign  (str_value = op like "+=",
+     *                       children[0] = IDENT target,
+     *                       children[1] = rhs expression)            ── */
+    case NODE_COMPOUND_ASSIGN: {
+        const char *varname = node->children[0]->str_value;
+        int off = var_offset(cg, varname);
+
+        /* load current value, spill across rhs eval — aligned slot */
+        emit(cg, "    movq    %d(%%rbp), %%rax", off);
+        emit(cg, "    subq    $16, %%rsp");        /* aligned spill */
+        emit(cg, "    movq    %%rax, (%%rsp)");    /* save current */
+        emit_expr(cg, node->children[1]);          /* rhs → %rax */
+        emit(cg, "    movq    %%rax, %%rsi");      /* rsi = rhs */
+        emit(cg, "    movq    (%%rsp), %%rdi");    /* rdi = current */
+        emit(cg, "    addq    $16, %%rsp");
+
+        const char *op  = node->str_value;         /* "+=", "-=", "*=", "/=" */
+        const char *fn  = XLY_SYM("xly_add");
+        if      (strcmp(op, "+=") == 0) fn = XLY_SYM("xly_add");
+        else if (strcmp(op, "-=") == 0) fn = XLY_SYM("xly_sub");
+        else if (strcmp(op, "*=") == 0) fn = XLY_SYM("xly_mul");
+        else if (strcmp(op, "/=") == 0) fn = XLY_SYM("xly_div");
+
+        emit(cg, "    call    %s", fn);
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+        break;
+    }
+
+    /* ── increment / decrement as statement ────────────────────────── */
+    case NODE_INCREMENT:
+    case NODE_DECREMENT: {
+        int off = var_offset(cg, node->str_value);
+        emit(cg, "    movq    %d(%%rbp), %%rax", off);
+        emit(cg, "    subq    $16, %%rsp");        /* aligned spill */
+        emit(cg, "    movq    %%rax, (%%rsp)");    /* save current */
+        emit_load_double(cg, 1.0);
+        emit(cg, "    call    " XLY_SYM("xly_num"));
+        emit(cg, "    movq    %%rax, %%rsi");      /* rsi = num(1) */
+        emit(cg, "    movq    (%%rsp), %%rdi");    /* rdi = current */
+        emit(cg, "    addq    $16, %%rsp");
+        emit(cg, "    call    %s",
+             node->type == NODE_INCREMENT ? XLY_SYM("xly_add") : XLY_SYM("xly_sub"));
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+        break;
+    }
+
+    /* ── print ────────────────────────────────────────────────────── */
+    case NODE_PRINT: {
+        /*
+         * xly_print(XlyVal **vals, size_t n)   — rdi, rsi
+         *
+         * Use sub+store (not push) so alignment is deterministic.
+         * alloc_bytes = ((n*8) + 15) & ~15 keeps rsp 16-aligned.
+         */
+        int n = (int)node->child_count;
+        int alloc_bytes = n > 0 ? (((n * 8) + 15) & ~15) : 0;
+
+        if (alloc_bytes > 0)
+            emit(cg, "    subq    $%d, %%rsp", alloc_bytes);
+
+        /* Eval each arg left-to-right, store at rsp[i*8] */
+        for (int i = 0; i < n; i++) {
+            emit_expr(cg, node->children[i]);
+            emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+        }
+
+        emit(cg, "    movq    %%rsp, %%rdi");
+        emit(cg, "    movl    $%d, %%esi", n);
+        emit(cg, "    call    " XLY_SYM("xly_print"));
+
+        if (alloc_bytes > 0)
+            emit(cg, "    addq    $%d, %%rsp", alloc_bytes);
+        break;
+    }
+
+    /* ── expression statement ─────────────────────────────────────── */
+    case NODE_EXPR_STMT:
+        if (node->child_count > 0)
+            emit_expr(cg, node->children[0]);
+        break;
+
+    /* ── if / else if / else ──────────────────────────────────────── */
+    case NODE_IF: {
+        char lbl_else[64], lbl_end[64];
+        fresh_label(cg, lbl_else, sizeof(lbl_else));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    testl   %%eax, %%eax");
+        emit(cg, "    jz      %s", lbl_else);
+
+        emit_stmt(cg, node->children[1]);          /* then */
+        emit(cg, "    jmp     %s", lbl_end);
+
+        emit(cg, "%s:", lbl_else);
+        if (node->child_count > 2)
+            emit_stmt(cg, node->children[2]);      /* else / else-if */
+
+        emit(cg, "%s:", lbl_end);
+        break;
+    }
 
-                const char *fn = NULL;
-                if (strcmp(op,"%") == 0) fn = XLY_SYM("xly_mod");
-                if (fn) emit(cg, "    call    %s", fn);
-            }
-        }
+    /* ── while ────────────────────────────────────────────────────── */
+    case NODE_WHILE: {
+        char lbl_cond[64], lbl_end[64];
+        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_cond);
+
+        emit(cg, "%s:", lbl_cond);
+        emit_safepoint(cg);
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    testl   %%eax, %%eax");
+        emit(cg, "    jz      %s", lbl_end);
+
+        emit_stmt(cg, node->children[1]);
+        emit(cg, "    jmp     %s", lbl_cond);
+
+        emit(cg, "%s:", lbl_end);
+        pop_cnt(cg);
+        pop_brk(cg);
         break;
     }
 
-    /* ── unary ─────────────────────────────────────────────────────── */
-    case NODE_UNARY:
+    /* ── do { body } while (cond)  children: [0]=body [1]=cond ────── */
+    case NODE_DO_WHILE: {
+        char lbl_top[64], lbl_cond[64], lbl_end[64];
+        fresh_label(cg, lbl_top,  sizeof(lbl_top));
+        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_cond);
+
+        emit(cg, "%s:", lbl_top);
+        emit_safepoint(cg);
+        emit_stmt(cg, node->children[0]);
+        emit(cg, "%s:", lbl_cond);
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    testl   %%eax, %%eax");
+        emit(cg, "    jnz     %s", lbl_top);
+
+        emit(cg, "%s:", lbl_end);
+        pop_cnt(cg);
+        pop_brk(cg);
+        break;
+    }
+
+    /* ── unless (cond) { body } ───────────────────────────────────── */
+    case NODE_UNLESS: {
+        char lbl_end[64];
+        fresh_label(cg, lbl_end, sizeof(lbl_end));
         emit_expr(cg, node->children[0]);
         emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    %s",
-             strcmp(node->str_value, "-") == 0 ? XLY_SYM("xly_neg") : XLY_SYM("xly_not"));
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    testl   %%eax, %%eax");
+        emit(cg, "    jnz     %s", lbl_end);
+        emit_stmt(cg, node->children[1]);
+        emit(cg, "%s:", lbl_end);
         break;
+    }
 
-    /* ── user function call ──────────────────────────────────────────
-     * If the callee name is a declared fn → direct call .Lxly_fn_<name>
-     * If the callee name is a variable (holding a VAL_FUNCTION XlyVal*)
-     *   → load from stack, extract .fn ptr at offset 32, indirect call.
-     * Args are eval'd left-to-right, spilled, then loaded into SysV regs. */
-    case NODE_FN_CALL: {
-        int nargs = (int)node->child_count;
-        static const char *regs[] = {"rdi","rsi","rdx","rcx","r8","r9"};
-        int nreg = nargs < 6 ? nargs : 6;  /* args 0-5 → registers       */
-        int nstk = nargs - nreg;            /* args 6+  → stack (SysV ABI) */
+    /* ── forever { body } ─────────────────────────────────────────── */
+    case NODE_FOREVER: {
+        char lbl_top[64], lbl_end[64];
+        fresh_label(cg, lbl_top, sizeof(lbl_top));
+        fresh_label(cg, lbl_end, sizeof(lbl_end));
 
-        /* ── enum variant constructor ───────────────────────────────────────
-         * If the callee name is a known variant, emit xly_make_variant call. */
-        if (node->str_value && variant_find(cg, node->str_value) >= 0) {
-            /* Build args array on stack, call xly_make_variant(tag, arr, n) */
-            int arr_bytes = nargs > 0 ? (((nargs * 8) + 15) & ~15) : 0;
-            if (arr_bytes > 0)
-                emit(cg, "    subq    $%d, %%rsp", arr_bytes);
-            for (int i = 0; i < nargs; i++) {
-                emit_expr(cg, node->children[i]);
-                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
-            }
-            /* rdi = tag string (intern the variant name as a string literal) */
-            const char *tag_lbl = intern_string(cg, node->str_value);
-            emit(cg, "    leaq    %s(%%rip), %%rdi", tag_lbl);
-            emit(cg, "    call    " XLY_SYM("xly_str"));
-            emit(cg, "    movq    %%rax, %%rdi");         /* rdi = tag XlyVal* */
-            if (nargs > 0)
-                emit(cg, "    movq    %%rsp, %%rsi");     /* rsi = fields ptr  */
-            else
-                emit(cg, "    xorq    %%rsi, %%rsi");
-            emit(cg, "    movl    $%d, %%edx", nargs);   /* edx = nfields     */
-            emit(cg, "    call    " XLY_SYM("xly_make_variant"));
-            if (arr_bytes > 0)
-                emit(cg, "    addq    $%d, %%rsp", arr_bytes);
-            break;
-        }
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_top);
 
-        /* ── variable-fn path: use xly_call_fnval (all args in array) ─────
-         * Handles any number of args cleanly via the args array.           */
-        int var_off = var_offset(cg, node->str_value);
-        int gi_fn   = (var_off == 0) ? gvar_find(cg, node->str_value) : -1;
-        int is_var_fn = !fn_is_known(cg, node->str_value)
-                        && (var_off != 0 || gi_fn >= 0);
+        emit(cg, "%s:", lbl_top);
+        emit_safepoint(cg);
+        emit_stmt(cg, node->children[0]);
+        emit(cg, "    jmp     %s", lbl_top);
 
-        if (is_var_fn) {
-            int arr_bytes = nargs > 0 ? (((nargs * 8) + 15) & ~15) : 0;
-            if (arr_bytes > 0)
-                emit(cg, "    subq    $%d, %%rsp", arr_bytes);
-            for (int i = 0; i < nargs; i++) {
-                emit_expr(cg, node->children[i]);
-                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
-            }
-            if (var_off != 0)
-                emit(cg, "    movq    %d(%%rbp), %%rdi", var_off);
-            else
-                emit(cg, "    movq    " XLY_SYM("__xly_globals") "+%d(%%rip), %%rdi", gi_fn * 8);
-            if (nargs > 0)
-                emit(cg, "    movq    %%rsp, %%rsi");
-            else
-                emit(cg, "    xorq    %%rsi, %%rsi");
-            emit(cg, "    movl    $%d, %%edx", nargs);
-            emit(cg, "    call    " XLY_SYM("xly_call_fnval"));
-            if (arr_bytes > 0)
-                emit(cg, "    addq    $%d, %%rsp", arr_bytes);
-            break;
-        }
+        emit(cg, "%s:", lbl_end);
+        pop_cnt(cg);
+        pop_brk(cg);
+        break;
+    }
 
-        if (!fn_is_known(cg, node->str_value)) {
-            emit(cg, "    call    " XLY_SYM("xly_null"));
-            break;
-        }
+    /* ── for (C-style)  children: [0]=init [1]=cond [2]=update [3]=body ── */
+    case NODE_FOR: {
+        char lbl_cond[64], lbl_upd[64], lbl_end[64];
+        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
+        fresh_label(cg, lbl_upd,  sizeof(lbl_upd));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
 
-        /* ── declared fn: SysV x86-64 ABI ──────────────────────────────────
-         * Args 0-5 → rdi,rsi,rdx,rcx,r8,r9
-         * Args 6+  → [rsp], [rsp+8], ...  (callee reads at [rbp+16], ...)
-         *
-         * We evaluate all args into a staging area first, then:
-         *  1. Copy staging[nreg..nargs-1] to positions above staging
-         *     (these become the stack args once staging is freed)
-         *  2. Load staging[0..nreg-1] into the register args
-         *  3. Free staging (stack args slide into place at rsp)
-         *  4. call
-         *  5. Caller cleans up stack args (SysV: caller-cleanup for stack args)
-         */
-        int stage_bytes = nargs > 0 ? (((nargs * 8) + 15) & ~15) : 0;
-        int stk_bytes   = nstk > 0  ? (((nstk * 8)  + 15) & ~15) : 0;
+        scope_enter(cg);
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_upd);
 
-        /* Evaluate all args into staging */
-        if (stage_bytes > 0)
-            emit(cg, "    subq    $%d, %%rsp", stage_bytes);
-        for (int i = 0; i < nargs; i++) {
-            emit_expr(cg, node->children[i]);
-            emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
-        }
+        emit_stmt(cg, node->children[0]);          /* init */
 
-        /* Pre-place stack args above the staging area (using r10 as scratch).
-         * After addq $stage_bytes these will be at [rsp+0], [rsp+8], ... */
-        for (int i = 0; i < nstk; i++) {
-            emit(cg, "    movq    %d(%%rsp), %%r10", (nreg + i) * 8);
-            emit(cg, "    movq    %%r10, %d(%%rsp)", stage_bytes + i * 8);
+        emit(cg, "%s:", lbl_cond);
+        emit_safepoint(cg);
+        /* if cond is literal true (parser default), skip the check */
+        if (!(node->children[1]->type == NODE_BOOL && node->children[1]->bool_value)) {
+            emit_expr(cg, node->children[1]);
+            emit(cg, "    movq    %%rax, %%rdi");
+            emit(cg, "    call    " XLY_SYM("xly_truthy"));
+            emit(cg, "    testl   %%eax, %%eax");
+            emit(cg, "    jz      %s", lbl_end);
         }
 
-        /* Load register args from staging */
-        for (int i = 0; i < nreg; i++)
-            emit(cg, "    movq    %d(%%rsp), %%%s", i * 8, regs[i]);
-
-        /* Free staging — stack args now at [rsp..] */
-        if (stage_bytes > 0)
-            emit(cg, "    addq    $%d, %%rsp", stage_bytes);
+        emit_stmt(cg, node->children[3]);          /* body */
 
-        emit(cg, "    call    .Lxly_fn_%s", fn_resolve_label(cg, node->str_value));
+        emit(cg, "%s:", lbl_upd);
+        if (node->children[2]->type != NODE_NULL)
+            emit_stmt(cg, node->children[2]);      /* update */
 
-        /* Caller cleans up stack args */
-        if (stk_bytes > 0)
-            emit(cg, "    addq    $%d, %%rsp", stk_bytes);
+        emit(cg, "    jmp     %s", lbl_cond);
+        emit(cg, "%s:", lbl_end);
 
+        pop_cnt(cg);
+        pop_brk(cg);
+        scope_leave(cg);
         break;
     }
 
-    /* ── module method call  (mod.fn(args…)) ─────────────────────────
-     * Signature: xly_call_module(const char *mod, const char *fn,
-     *                            XlyVal **args, size_t argc)
-     *            rdi             rsi             rdx              rcx
-     *
-     * SYSTEMS PROGRAMMING OPTIMIZATIONS (xenlyc v0.1.0):
-     *   O2: sys.CONSTANT() zero-arg calls → inlined immediate (no call)
-     *   O1: sys.exit/abort detected → noreturn_mode set for dead-code elim
-     */
-    case NODE_METHOD_CALL: {
-        const char *mod_name = node->children[0]->str_value;
-        const char *fn_name  = node->str_value;
-        int argc = (int)node->child_count - 1;
+    /* ── for-in  str_value=itervar, children[0]=iterable, [1]=body ── */
+    case NODE_FOR_IN: {
+        char lbl_cond[64], lbl_end[64];
+        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
 
-        /* ── Detect local-variable object method call ───────────────────────
-         * If children[0] is an identifier that resolves to a local variable
-         * (not a module), treat this as obj.method(args) via xly_obj_call.
-         * xly_obj_call(obj, method, args_array, argc)                         */
-        int obj_var_off = (node->children[0]->type == NODE_IDENTIFIER)
-                          ? var_offset(cg, mod_name) : 0;
-        /* Also handle chained expressions: if children[0] is not a simple
-         * identifier, always eval it and use obj_call. */
-        int is_obj_call = (obj_var_off != 0) ||
-                          (node->children[0]->type != NODE_IDENTIFIER);
+        scope_enter(cg);
 
-        if (is_obj_call) {
-            /* Build args array on stack */
-            int arr_bytes = argc > 0 ? (((argc * 8) + 15) & ~15) : 0;
-            if (arr_bytes > 0)
-                emit(cg, "    subq    $%d, %%rsp", arr_bytes);
-            for (int i = 0; i < argc; i++) {
-                emit_expr(cg, node->children[i + 1]);
-                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
-            }
-            /* Eval the object expression */
-            emit_expr(cg, node->children[0]);
-            emit(cg, "    movq    %%rax, %%rdi");           /* obj */
-            const char *mfl = intern_string(cg, fn_name);
-            emit(cg, "    leaq    %s(%%rip), %%rsi", mfl); /* method name */
-            if (argc > 0)
-                emit(cg, "    movq    %%rsp, %%rdx");       /* args array */
-            else
-                emit(cg, "    xorq    %%rdx, %%rdx");
-            emit(cg, "    movl    $%d, %%ecx", argc);
-            emit(cg, "    call    " XLY_SYM("xly_obj_call"));
-            if (arr_bytes > 0)
-                emit(cg, "    addq    $%d, %%rsp", arr_bytes);
-            break;
-        }
+        /* declare: itervar + 3 hidden slots (arr, idx, len) */
+        int off_iter = var_declare(cg, node->str_value);
+        char tmp[80];
+        snprintf(tmp, sizeof(tmp), "__fi_a_%d", cg->label_seq);
+        int off_arr  = var_declare(cg, tmp);
+        snprintf(tmp, sizeof(tmp), "__fi_i_%d", cg->label_seq);
+        int off_idx  = var_declare(cg, tmp);
+        snprintf(tmp, sizeof(tmp), "__fi_l_%d", cg->label_seq++);
+        int off_len  = var_declare(cg, tmp);
 
-        /* ── O2+: sys constant inlining ────────────────────────────────────
-         * Zero-arg sys functions returning compile-time constants are inlined
-         * as immediate loads — eliminates call overhead in tight sys loops.  */
-        if (cg->opt_level >= 2 && strcmp(mod_name, "sys") == 0 && argc == 0) {
-            static const struct { const char *name; long long val; } SC[] = {
-                /* Standard file descriptors */
-                {"STDIN",0},{"STDOUT",1},{"STDERR",2},
-                /* Open flags (Linux x86-64) */
-                {"O_RDONLY",0},{"O_WRONLY",1},{"O_RDWR",2},
-                {"O_CREAT",64},{"O_TRUNC",512},{"O_APPEND",1024},
-                {"O_NONBLOCK",2048},{"O_SYNC",1052672},{"O_EXCL",128},
-                /* Signals */
-                {"SIGHUP",1},{"SIGINT",2},{"SIGQUIT",3},{"SIGKILL",9},
-                {"SIGTERM",15},{"SIGUSR1",10},{"SIGUSR2",12},
-                {"SIGCHLD",17},{"SIGPIPE",13},{"SIGALRM",14},{"SIGSEGV",11},
-                /* Syslog levels */
-                {"LOG_EMERG",0},{"LOG_ALERT",1},{"LOG_CRIT",2},
-                {"LOG_ERR",3},{"LOG_WARNING",4},{"LOG_NOTICE",5},
-                {"LOG_INFO",6},{"LOG_DEBUG",7},
-                /* mmap prot/map flags */
-                {"PROT_READ",1},{"PROT_WRITE",2},{"PROT_EXEC",4},
-                {"PROT_NONE",0},{"MAP_SHARED",1},{"MAP_PRIVATE",2},
-                {"MAP_ANONYMOUS",32},
-                /* Socket / address family */
-                {"AF_INET",2},{"AF_INET6",10},{"AF_UNIX",1},
-                {"SOCK_STREAM",1},{"SOCK_DGRAM",2},
-                /* Poll events */
-                {"POLLIN",1},{"POLLOUT",4},{"POLLERR",8},{"POLLHUP",16},
-                /* Resource limits */
-                {"RLIMIT_CPU",0},{"RLIMIT_FSIZE",1},
-                {"RLIMIT_STACK",3},{"RLIMIT_NOFILE",7},{"RLIMIT_AS",9},
-                /* Integer limits */
-                {"INT8_MAX",127},{"INT8_MIN",-128},
-                {"INT16_MAX",32767},{"INT16_MIN",-32768},
-                {"INT32_MAX",2147483647LL},{"INT32_MIN",-2147483648LL},
-                {"UINT8_MAX",255},{"UINT16_MAX",65535},
-                {"UINT32_MAX",4294967295LL},
-                {"INT_MAX",2147483647LL},{"INT_MIN",-2147483648LL},
-                {"UINT_MAX",4294967295LL},
-                {NULL,0}
-            };
-            for (int ci = 0; SC[ci].name; ci++) {
-                if (strcmp(fn_name, SC[ci].name) == 0) {
-                    if (cg->verbose)
-                        emit(cg, "    # [xenlyc] inline sys.%s() = %lld",
-                             fn_name, SC[ci].val);
-                    emit_load_double(cg, (double)SC[ci].val);
-                    emit(cg, "    call    " XLY_SYM("xly_num"));
-                    cg->stat_sys_inline++;
-                    goto x86_method_done;
-                }
-            }
-        }
+        /* eval iterable */
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off_arr);
+        /* len = xly_array_len(arr) */
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_array_len"));
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off_len);
+        /* idx = 0 */
+        emit(cg, "    movq    $0, %d(%%rbp)", off_idx);
+
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_cond);
+
+        emit(cg, "%s:", lbl_cond);
+        emit_safepoint(cg);
+        emit(cg, "    movq    %d(%%rbp), %%rax", off_idx);
+        emit(cg, "    cmpq    %d(%%rbp), %%rax", off_len);
+        emit(cg, "    jae     %s", lbl_end);
+
+        /* itervar = array_get(arr, idx) */
+        emit(cg, "    movq    %d(%%rbp), %%rdi", off_arr);
+        emit(cg, "    movq    %d(%%rbp), %%rsi", off_idx);
+        emit(cg, "    call    " XLY_SYM("xly_array_get"));
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off_iter);
+
+        emit_stmt(cg, node->children[1]);          /* body */
 
-        /* ── O1+: noreturn detection ────────────────────────────────────────
-         * sys.exit() and sys.abort() do not return — set noreturn_mode so
-         * the enclosing statement compiler skips subsequent dead code.       */
-        int is_noreturn = (cg->opt_level >= 1 &&
-                           strcmp(mod_name, "sys") == 0 &&
-                           (strcmp(fn_name, "exit") == 0 ||
-                            strcmp(fn_name, "abort") == 0));
+        /* idx++ */
+        emit(cg, "    movq    %d(%%rbp), %%rax", off_idx);
+        emit(cg, "    addq    $1, %%rax");
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off_idx);
+        emit(cg, "    jmp     %s", lbl_cond);
+        emit(cg, "%s:", lbl_end);
 
-        /* ── general dispatch via xly_call_module ───────────────────────── */
-        {
-            int slot_bytes  = argc * 8;
-            int alloc_bytes = argc > 0 ? ((slot_bytes + 15) & ~15) : 0;
+        pop_cnt(cg);
+        pop_brk(cg);
+        scope_leave(cg);
+        break;
+    }
 
-            if (alloc_bytes > 0)
-                emit(cg, "    subq    $%d, %%rsp", alloc_bytes);
+    /* ── break / continue ──────────────────────────────────────────── */
+    case NODE_BREAK:
+        if (cg->brk_top > 0)
+            emit(cg, "    jmp     %s", cg->brk_labels[cg->brk_top-1]);
+        break;
+    case NODE_CONTINUE:
+        if (cg->cnt_top > 0)
+            emit(cg, "    jmp     %s", cg->cnt_labels[cg->cnt_top-1]);
+        break;
 
-            for (int i = 0; i < argc; i++) {
-                emit_expr(cg, node->children[i + 1]);
-                emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
-            }
+    /* ── block ─────────────────────────────────────────────────────── */
+    case NODE_BLOCK:
+        scope_enter(cg);
+        for (size_t i = 0; i < node->child_count; i++)
+            emit_stmt(cg, node->children[i]);
+        scope_leave(cg);
+        break;
 
-            if (argc > 0)
-                emit(cg, "    movq    %%rsp, %%rdx");
-            else
-                emit(cg, "    xorq    %%rdx, %%rdx");
+    /* ── fn decl — stash for emission after main ─────────────────── */
+    case NODE_FN_DECL:
+        fn_decl_stash(cg, node);
+        break;
 
-            const char *ml = intern_string(cg, mod_name);
-            const char *fl = intern_string(cg, fn_name);
-            emit(cg, "    leaq    %s(%%rip), %%rdi", ml);
-            emit(cg, "    leaq    %s(%%rip), %%rsi", fl);
-            emit(cg, "    movl    $%d, %%ecx", argc);
-            emit(cg, "    call    " XLY_SYM("xly_call_module"));
+    /* ── return ────────────────────────────────────────────────────── */
+    case NODE_RETURN:
+        if (node->child_count > 0)
+            emit_expr(cg, node->children[0]);
+        else
+            emit(cg, "    call    " XLY_SYM("xly_null"));
+        emit(cg, "    movq    %%rbp, %%rsp");
+        emit(cg, "    popq    %%rbp");
+        emit(cg, "    ret");
+        break;
 
-            if (alloc_bytes > 0)
-                emit(cg, "    addq    $%d, %%rsp", alloc_bytes);
+    /* ── import — runs a user module's initializer; no-op for the
+     *    stdlib, which is linked statically ─────────────────────────── */
+    case NODE_IMPORT: {
+        const UnitImport *u = node->str_value ? unit_import_find(node->str_value, NULL) : NULL;
+        if (u) emit(cg, "    call    .Lxly_fn_%s", u->label);
+        break;
+    }
 
-            if (is_noreturn) {
-                if (cg->verbose)
-                    emit(cg, "    # [xenlyc] noreturn: dead code elision after this point");
-                cg->noreturn_mode = 1;
-                cg->stat_noreturn_elim++;
+    /* ── class — laid out and its methods stashed by collect_classes ── */
+    case NODE_CLASS_DECL:
+        break;
+
+    /* ── enum declaration — register variants, create parameterless ones ── */
+    case NODE_ENUM_DECL:
+        /* Variant names already registered in variant table by pre-pass.
+         * For parameterless variants, emit a global holding the singleton
+         * VAL_ENUM_VARIANT value so NODE_IDENTIFIER can load it.
+         * Parametric variants are constructed at call-site via xly_make_variant. */
+        for (size_t vi = 0; vi < node->child_count; vi++) {
+            ASTNode *vn = node->children[vi];
+            if (!vn || !vn->str_value) continue;
+            if (vn->param_count == 0) {
+                /* Create the singleton and store in a global */
+                const char *tag_label = intern_string(cg, vn->str_value);
+                emit(cg, "    leaq    %s(%%rip), %%rdi", tag_label);
+                emit(cg, "    call    " XLY_SYM("xly_str"));
+                emit(cg, "    movq    %%rax, %%rdi");
+                emit(cg, "    xorq    %%rsi, %%rsi");   /* fields = NULL */
+                emit(cg, "    xorl    %%edx, %%edx");   /* nfields = 0   */
+                emit(cg, "    movl    $%d, %%ecx", variant_id(cg, vn->str_value));
+                emit(cg, "    call    " XLY_SYM("xly_make_variant"));
+                /* Store in global slot so identifier lookups find it */
+                int gi = gvar_declare(cg, vn->str_value);
+                emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
             }
+            /* Parametric variants: nothing to emit here; call-sites use xly_make_variant */
         }
+        break;
 
-        x86_method_done:;
+    /* ── Generator function declaration (x86-64) ───────────────────────────
+     * The body is emitted after main like a fn; the name is bound to
+     * xly_gen_fn(body), which makes a generator per call.              */
+    case NODE_GEN_DECL: {
+        char lbl[256];
+        gen_decl_stash(cg, node, lbl, sizeof(lbl));
+        emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", lbl);
+        emit(cg, "    call    " XLY_SYM("xly_gen_fn"));
+        if (node->str_value) {
+            int gi = gvar_declare(cg, node->str_value);
+            emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
+        }
         break;
     }
 
-    /* ── typeof ────────────────────────────────────────────────────── */
-    case NODE_TYPEOF:
-        emit_expr(cg, node->children[0]);
+    /* ── yield expr (x86-64) ────────────────────────────────────────────────
+     * xly_gen_yield switches to the generator's resumer and returns when
+     * it is resumed; the body just carries on.                          */
+    case NODE_YIELD:
+        if (node->child_count > 0) emit_expr(cg, node->children[0]);
+        else emit(cg, "    call    " XLY_SYM("xly_null"));
         emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_typeof"));
+        emit(cg, "    call    " XLY_SYM("xly_gen_yield"));
         break;
 
-    /* ── increment / decrement as expression ───────────────────────── */
-    case NODE_INCREMENT:
-    case NODE_DECREMENT: {
-        int off = var_offset(cg, node->str_value);
-        /* load current value — aligned spill across xly_num call */
-        emit(cg, "    movq    %d(%%rbp), %%rax", off);
-        emit(cg, "    subq    $16, %%rsp");       /* aligned spill slot */
-        emit(cg, "    movq    %%rax, (%%rsp)");   /* save current */
-        emit_load_double(cg, 1.0);
-        emit(cg, "    call    " XLY_SYM("xly_num"));          /* rax = num(1) */
-        emit(cg, "    movq    %%rax, %%rsi");     /* rsi = num(1) */
-        emit(cg, "    movq    (%%rsp), %%rdi");   /* rdi = current value */
-        emit(cg, "    addq    $16, %%rsp");
-        emit(cg, "    call    %s",
-             node->type == NODE_INCREMENT ? XLY_SYM("xly_add") : XLY_SYM("xly_sub"));
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+    case NODE_YIELD_EMPTY:
+        emit(cg, "    call    " XLY_SYM("xly_null"));
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_gen_yield"));
         break;
-    }
 
-    /* ── array literal [expr, expr, ...] ───────────────────────────── */
-    case NODE_ARRAY_LITERAL: {
-        int nelems = (int)node->child_count;
+    /* ── for (x of iterable) — x86-64 ──────────────────────────────────────
+     * children[0]=iterable, children[1]=body, str_value=loop var.  The
+     * iterator lives in a hidden slot, as for-in's array does.          */
+    case NODE_FOR_OF: {
+        char lbl_next[64], lbl_end[64];
+        fresh_label(cg, lbl_next, sizeof(lbl_next));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
 
-        /* Use sub+store (not push) so alignment is deterministic.
-         * xly_array_create(XlyVal **elements, size_t count): rdi, rsi */
-        int alloc_bytes = nelems > 0 ? (((nelems * 8) + 15) & ~15) : 0;
+        scope_enter(cg);
+        int off_var = var_declare(cg, node->str_value ? node->str_value : "__fo_v");
+        char tmp[80];
+        snprintf(tmp, sizeof(tmp), "__fo_g_%d", cg->label_seq++);
+        int off_gen = var_declare(cg, tmp);
 
-        if (alloc_bytes > 0)
-            emit(cg, "    subq    $%d, %%rsp", alloc_bytes);
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off_gen);
 
-        /* Eval each element left-to-right, store at rsp[i*8] */
-        for (int i = 0; i < nelems; i++) {
-            emit_expr(cg, node->children[i]);
-            emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
-        }
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_next);
 
-        if (nelems > 0)
-            emit(cg, "    movq    %%rsp, %%rdi");
-        else
-            emit(cg, "    xorq    %%rdi, %%rdi");  /* NULL for empty */
-        emit(cg, "    movq    $%d, %%rsi", nelems);
-        emit(cg, "    call    " XLY_SYM("xly_array_create"));
+        emit(cg, "%s:", lbl_next);
+        emit_safepoint(cg);
+        emit(cg, "    movq    %d(%%rbp), %%rdi", off_gen);
+        emit(cg, "    call    " XLY_SYM("xly_for_of_next"));
+        emit(cg, "    testq   %%rax, %%rax");
+        emit(cg, "    je      %s", lbl_end);
+        emit(cg, "    movq    %%rax, %d(%%rbp)", off_var);
+        if (node->child_count > 1) emit_stmt(cg, node->children[1]);
+        emit(cg, "    jmp     %s", lbl_next);
+        emit(cg, "%s:", lbl_end);
 
-        if (alloc_bytes > 0)
-            emit(cg, "    addq    $%d, %%rsp", alloc_bytes);
+        pop_cnt(cg);
+        pop_brk(cg);
+        scope_leave(cg);
         break;
     }
 
-    /* ── array/string indexing arr[index] ──────────────────────────── */
-    case NODE_INDEX: {
-        /* children[0] = array/string, children[1] = index */
-        emit_expr(cg, node->children[0]);  /* array in rax */
-        emit(cg, "    subq    $16, %%rsp");     /* aligned spill */
-        emit(cg, "    movq    %%rax, (%%rsp)"); /* save array */
-        emit_expr(cg, node->children[1]);  /* index in rax */
-        emit(cg, "    movq    %%rax, %%rsi");   /* index to rsi */
-        emit(cg, "    movq    (%%rsp), %%rdi"); /* array to rdi */
-        emit(cg, "    addq    $16, %%rsp");
+    /* ── Computed property: obj.[expr] — x86-64 ─────────────────────────── */
+    case NODE_COMPUTED_PROP:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    movq    %%rax, %%rsi");
+        emit(cg, "    popq    %%rdi");
         emit(cg, "    call    " XLY_SYM("xly_index"));
         break;
-    }
 
-    /* ── object literal  { key: val, key: val, ... } ───────────────── */
-    case NODE_OBJECT_LITERAL: {
-        /* Parser produces: NODE_OBJECT_LITERAL
-         *   children[i] = NODE_NAMED_ARG { str_value=key, children[0]=val_expr }
-         * Create empty object, then set each field.                          */
-        emit(cg, "    call    " XLY_SYM("xly_obj_new"));
-        /* Spill obj ptr onto stack */
-        emit(cg, "    subq    $16, %%rsp");
-        emit(cg, "    movq    %%rax, (%%rsp)");
-        int npairs = (int)node->child_count;
-        for (int i = 0; i < npairs; i++) {
-            ASTNode *pair = node->children[i];    /* NODE_NAMED_ARG */
-            const char *key_str = pair->str_value;
-            ASTNode *val_node   = pair->child_count > 0 ? pair->children[0] : NULL;
-            const char *kl = intern_string(cg, key_str);
-            /* Eval value; spill obj across the eval */
-            if (val_node)
-                emit_expr(cg, val_node);
-            else
-                emit(cg, "    call    " XLY_SYM("xly_null"));
-            emit(cg, "    movq    %%rax, %%rdx");          /* rdx = value */
-            emit(cg, "    movq    (%%rsp), %%rdi");        /* rdi = obj */
-            emit(cg, "    leaq    %s(%%rip), %%rsi", kl); /* rsi = key */
-            emit(cg, "    call    " XLY_SYM("xly_obj_set"));
-        }
-        emit(cg, "    movq    (%%rsp), %%rax");  /* return obj in rax */
-        emit(cg, "    addq    $16, %%rsp");
+    case NODE_COMPUTED_PROP_SET:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");              /* save obj */
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    pushq   %%rax");              /* save key */
+        emit_expr(cg, node->children[2]);
+        emit(cg, "    movq    %%rax, %%rdx");       /* val → rdx */
+        emit(cg, "    popq    %%rsi");              /* key → rsi */
+        emit(cg, "    popq    %%rdi");              /* obj → rdi */
+        emit(cg, "    call    " XLY_SYM("xly_index_set"));
+        break;
+
+    /* ── Reflect calls — x86-64 SysV ABI ───────────────────────────────────
+     * All take (obj, key) or (obj, key, val) → straightforward rdi/rsi/rdx */
+    case NODE_REFLECT_KEYS:
+    case NODE_REFLECT_OWN_KEYS:
+        if (node->child_count > 0) emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_keys"));
+        break;
+
+    case NODE_REFLECT_GET:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    movq    %%rax, %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_get"));
+        break;
+
+    case NODE_REFLECT_SET:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[2]);
+        emit(cg, "    movq    %%rax, %%rdx");
+        emit(cg, "    popq    %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_set"));
+        break;
+
+    case NODE_REFLECT_HAS:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    movq    %%rax, %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_has"));
         break;
-    }
 
-    /* ── property get  obj.field ──────────────────────────────────── */
-    case NODE_PROPERTY_GET: {
-        /* children[0] = object expression, str_value = field name */
+    case NODE_REFLECT_DELETE:
         emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[1]);
+        emit(cg, "    movq    %%rax, %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_delete"));
+        break;
+
+    case NODE_REFLECT_FREEZE:
+        if (node->child_count > 0) emit_expr(cg, node->children[0]);
         emit(cg, "    movq    %%rax, %%rdi");
-        const char *fl = intern_string(cg, node->str_value);
-        emit(cg, "    leaq    %s(%%rip), %%rsi", fl);
-        emit(cg, "    call    " XLY_SYM("xly_obj_get"));
+        emit(cg, "    call    " XLY_SYM("xly_reflect_freeze"));
         break;
-    }
 
-    /* ── property set  obj.field = val  (as expression) ─────────────
-     * children[0] = object, children[1] = value; str_value = field   */
-    case NODE_PROPERTY_SET: {
+    case NODE_REFLECT_IS_FROZEN:
+        if (node->child_count > 0) emit_expr(cg, node->children[0]);
+        emit(cg, "    movq    %%rax, %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_is_frozen"));
+        break;
+
+    case NODE_REFLECT_DEFINE:
         emit_expr(cg, node->children[0]);
-        emit(cg, "    subq    $16, %%rsp");
-        emit(cg, "    movq    %%rax, (%%rsp)");   /* spill obj */
+        emit(cg, "    pushq   %%rax");
         emit_expr(cg, node->children[1]);
-        emit(cg, "    movq    %%rax, %%rdx");     /* rdx = val */
-        emit(cg, "    movq    (%%rsp), %%rdi");   /* rdi = obj */
-        emit(cg, "    addq    $16, %%rsp");
-        const char *fl2 = intern_string(cg, node->str_value);
-        emit(cg, "    leaq    %s(%%rip), %%rsi", fl2);
-        emit(cg, "    call    " XLY_SYM("xly_obj_set"));
-        /* return the object (rdi) for chaining */
-        emit(cg, "    movq    %%rdi, %%rax");
+        emit(cg, "    pushq   %%rax");
+        emit_expr(cg, node->children[2]);
+        emit(cg, "    movq    %%rax, %%rdx");
+        emit(cg, "    popq    %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_define"));
         break;
-    }
 
-    /* ── await expr ─────────────────────────────────────────────────────
-     * await fn_call  — synchronous in current impl: just evaluate the call.
-     * children[0] = the call expression (NODE_FN_CALL or NODE_CALL_EXPR).  */
-    case NODE_AWAIT:
+    case NODE_REFLECT_APPLY:
         emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        if (node->child_count > 2) emit_expr(cg, node->children[2]);
+        else emit(cg, "    call    " XLY_SYM("xly_null"));
+        emit(cg, "    movq    %%rax, %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_apply"));
         break;
 
-    /* ── spawn expr ─────────────────────────────────────────────────────
-     * spawn fn_call  — evaluate the call for side effects, discard result.
-     * In the compiled runtime there is no scheduler; spawn executes the
-     * function synchronously (matching the interpreter "preview" semantics).
-     * Result ends up in %rax but the expression produces null.             */
-    case NODE_SPAWN:
-        emit_expr(cg, node->children[0]);   /* execute fn call, result in %rax */
-        emit(cg, "    call    " XLY_SYM("xly_null"));  /* spawn → null */
+    case NODE_REFLECT_CONSTRUCT:
+        emit_expr(cg, node->children[0]);
+        emit(cg, "    pushq   %%rax");
+        if (node->child_count > 1) emit_expr(cg, node->children[1]);
+        else emit(cg, "    call    " XLY_SYM("xly_null"));
+        emit(cg, "    movq    %%rax, %%rsi");
+        emit(cg, "    popq    %%rdi");
+        emit(cg, "    call    " XLY_SYM("xly_reflect_construct"));
         break;
 
-    /* ── fallback ──────────────────────────────────────────────────── */
+    /* ── Block fn: desugar to anonymous function (x86-64) ───────────────── */
+    case NODE_BLOCK_FN:
+        emit_expr(cg, node);
+        break;
+
+    /* ── everything else — try as expression ─────────────────────── */
     default:
-        emit(cg, "    call    " XLY_SYM("xly_null"));
+        emit_expr(cg, node);
         break;
     }
 }
 
-/* ── statement compiler (x86-64) — Post-condition: %%rsp unchanged from entry.
- * If noreturn_mode is set (after sys.exit/abort), all subsequent statements
- * are elided — the code is unreachable and emitting it wastes binary space.  */
-static void emit_stmt(CG *cg, ASTNode *node) {
-    if (!node) return;
-    /* Dead code elimination after noreturn calls (O1+) */
-    if (cg->noreturn_mode) {
-        cg->stat_noreturn_elim++;
-        return;
-    }
-
-    switch (node->type) {
-
-    /* ── var/const decl ────────────────────────────────────────────── */
-    case NODE_VAR_DECL:
-    case NODE_CONST_DECL: {
-        if (node->child_count > 0)
-            emit_expr(cg, node->children[0]);
-        else
-            emit(cg, "    call    " XLY_SYM("xly_null"));
-        if (cg->in_main_scope && cg->scope_depth == 0) {
-            /* Top-level decl: store in global slot so functions can read it */
-            int gi = gvar_declare(cg, node->str_value);
-            emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
-            /* Also declare a local alias for use within main() */
-            int off = var_declare(cg, node->str_value);
-            emit(cg, "    movq    %%rax, %d(%%rbp)", off);
-        } else {
-            int off = var_declare(cg, node->str_value);
-            emit(cg, "    movq    %%rax, %d(%%rbp)", off);
-        }
-        break;
+/* Label of a function body; an export of the unit being compiled is also
+ * given its global symbol. */
+static void emit_fn_label(CG *cg, ASTNode *fn, const char *asm_label) {
+    /* top-level fns keep their name as label; nested namesakes do not */
+    int exported = 0;
+    if (cg->unit && fn->str_value && strcmp(fn->str_value, asm_label) == 0)
+        for (int i = 0; i < cg->export_count && !exported; i++)
+            exported = strcmp(cg->exports[i], asm_label) == 0;
+    if (exported) {
+        emit(cg, ".globl  " XLY_SYM("xlym_%s__%s"), cg->unit, asm_label);
+        emit(cg, XLY_SYM("xlym_%s__%s") ":", cg->unit, asm_label);
     }
+    emit(cg, ".Lxly_fn_%s:", asm_label);
+}
 
-    /* ── assign  (str_value = varname, children[0] = rhs) ─────────── */
-    case NODE_ASSIGN: {
-        emit_expr(cg, node->children[0]);
-        int off = var_offset(cg, node->str_value);
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
-        break;
+/* One jump per imported initializer / export: call sites refer to the
+ * local .Lxly_fn_<symbol> like any other fn. */
+static void emit_unit_stubs(CG *cg) {
+    if (g_import_count == 0) return;
+    emit(cg, "");
+    emit(cg, XLY_TEXT_SECTION);         /* the tables before are data */
+    for (int i = 0; i < g_import_count; i++) {
+        emit(cg, ".Lxly_fn_%s:", g_imports[i].label);
+        emit(cg, "    jmp     " XLY_SYM("%s"), g_imports[i].label);
     }
+}
 
-    /* ── compound assign  (str_value = op like "+=",
-     *                       children[0] = IDENT target,
-     *                       children[1] = rhs expression)            ── */
-    case NODE_COMPOUND_ASSIGN: {
-        const char *varname = node->children[0]->str_value;
-        int off = var_offset(cg, varname);
-
-        /* load current value, spill across rhs eval — aligned slot */
-        emit(cg, "    movq    %d(%%rbp), %%rax", off);
-        emit(cg, "    subq    $16, %%rsp");        /* aligned spill */
-        emit(cg, "    movq    %%rax, (%%rsp)");    /* save current */
-        emit_expr(cg, node->children[1]);          /* rhs → %rax */
-        emit(cg, "    movq    %%rax, %%rsi");      /* rsi = rhs */
-        emit(cg, "    movq    (%%rsp), %%rdi");    /* rdi = current */
-        emit(cg, "    addq    $16, %%rsp");
+/* ── emit a user-defined function ──────────────────────────────────────── */
+static void emit_function(CG *cg, ASTNode *fn, const char *asm_label,
+                          FnRename *rename_ctx, int rename_ctx_count,
+                          char **captures, int ncaptures) {
+    size_t      nparams = fn->param_count;
+    ASTNode    *body    = fn->children[0];   /* NODE_BLOCK */
 
-        const char *op  = node->str_value;         /* "+=", "-=", "*=", "/=" */
-        const char *fn  = XLY_SYM("xly_add");
-        if      (strcmp(op, "+=") == 0) fn = XLY_SYM("xly_add");
-        else if (strcmp(op, "-=") == 0) fn = XLY_SYM("xly_sub");
-        else if (strcmp(op, "*=") == 0) fn = XLY_SYM("xly_mul");
-        else if (strcmp(op, "/=") == 0) fn = XLY_SYM("xly_div");
+    /* save codegen frame state — clear var table so main() vars don't leak in */
+    int sv_vc = cg->var_count, sv_fo = cg->frame_offset, sv_sd = cg->scope_depth;
+    int sv_nm = cg->noreturn_mode;
+    int sv_rename = fn_rename_scope_enter(cg);   /* save rename scope for nested fns */
+    cg->scope_depth  = 0;
+    cg->frame_offset = 0;
+    cg->var_count    = 0;   /* hide main() vars: functions have their own scope */
+    cg->noreturn_mode = 0;
 
-        emit(cg, "    call    %s", fn);
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
-        break;
-    }
+    /* Restore the rename context that was visible when this fn was declared.
+     * This makes sibling/peer inner function names resolvable inside the body. */
+    fn_rename_ctx_restore(cg, rename_ctx, rename_ctx_count);
 
-    /* ── increment / decrement as statement ────────────────────────── */
-    case NODE_INCREMENT:
-    case NODE_DECREMENT: {
-        int off = var_offset(cg, node->str_value);
-        emit(cg, "    movq    %d(%%rbp), %%rax", off);
-        emit(cg, "    subq    $16, %%rsp");        /* aligned spill */
-        emit(cg, "    movq    %%rax, (%%rsp)");    /* save current */
-        emit_load_double(cg, 1.0);
-        emit(cg, "    call    " XLY_SYM("xly_num"));
-        emit(cg, "    movq    %%rax, %%rsi");      /* rsi = num(1) */
-        emit(cg, "    movq    (%%rsp), %%rdi");    /* rdi = current */
-        emit(cg, "    addq    $16, %%rsp");
-        emit(cg, "    call    %s",
-             node->type == NODE_INCREMENT ? XLY_SYM("xly_add") : XLY_SYM("xly_sub"));
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off);
-        break;
-    }
+    /* frame size: params + captures + locals + generous padding, 16-aligned */
+    int n = (int)nparams + ncaptures + count_locals(body) + 32;
+    int frame = (n * 8 + 15) & ~15;
 
-    /* ── print ────────────────────────────────────────────────────── */
-    case NODE_PRINT: {
-        /*
-         * xly_print(XlyVal **vals, size_t n)   — rdi, rsi
-         *
-         * Use sub+store (not push) so alignment is deterministic.
-         * alloc_bytes = ((n*8) + 15) & ~15 keeps rsp 16-aligned.
-         */
-        int n = (int)node->child_count;
-        int alloc_bytes = n > 0 ? (((n * 8) + 15) & ~15) : 0;
+    emit(cg, "");
+    emit_fn_label(cg, fn, asm_label);
+    emit(cg, "    pushq   %%rbp");
+    emit(cg, "    movq    %%rsp, %%rbp");
+    emit(cg, "    subq    $%d, %%rsp", frame);
 
-        if (alloc_bytes > 0)
-            emit(cg, "    subq    $%d, %%rsp", alloc_bytes);
+    /* For closures: hidden first arg is XlyVal** __env (in %rdi).
+     * Explicit params are shifted: param[0] → %rsi, param[1] → %rdx, etc.
+     * We load captured variables from __env[0..ncaptures-1] into stack slots. */
+    static const char *pregs[] = {"rdi","rsi","rdx","rcx","r8","r9"};
+    int param_reg_start = ncaptures > 0 ? 1 : 0; /* shift if closure */
 
-        /* Eval each arg left-to-right, store at rsp[i*8] */
-        for (int i = 0; i < n; i++) {
-            emit_expr(cg, node->children[i]);
-            emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+    if (ncaptures > 0) {
+        /* Spill __env ptr (rdi) into a temporary stack slot, then load captures */
+        int env_slot = var_declare(cg, "__env");
+        emit(cg, "    movq    %%rdi, %d(%%rbp)", env_slot);
+        for (int i = 0; i < ncaptures; i++) {
+            int cslot = var_declare(cg, captures[i]);
+            emit(cg, "    movq    %d(%%rbp), %%rax", env_slot); /* __env ptr */
+            emit(cg, "    movq    %d(%%rax), %%rax", i * 8);    /* env[i] */
+            emit(cg, "    movq    %%rax, %d(%%rbp)", cslot);    /* store capture */
         }
-
-        emit(cg, "    movq    %%rsp, %%rdi");
-        emit(cg, "    movl    $%d, %%esi", n);
-        emit(cg, "    call    " XLY_SYM("xly_print"));
-
-        if (alloc_bytes > 0)
-            emit(cg, "    addq    $%d, %%rsp", alloc_bytes);
-        break;
     }
 
-    /* ── expression statement ─────────────────────────────────────── */
-    case NODE_EXPR_STMT:
-        if (node->child_count > 0)
-            emit_expr(cg, node->children[0]);
-        break;
-
-    /* ── if / else if / else ──────────────────────────────────────── */
-    case NODE_IF: {
-        char lbl_else[64], lbl_end[64];
-        fresh_label(cg, lbl_else, sizeof(lbl_else));
-        fresh_label(cg, lbl_end,  sizeof(lbl_end));
-
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_truthy"));
-        emit(cg, "    testl   %%eax, %%eax");
-        emit(cg, "    jz      %s", lbl_else);
+    /* spill incoming SysV register args into stack slots.
+     * For closures param_reg_start=1 (rdi=env), so register params cap at
+     * reg index 5, meaning up to (6 - param_reg_start) params in registers. */
+    int nreg_params = 6 - param_reg_start;  /* how many params fit in regs */
+    for (size_t i = 0; i < nparams; i++) {
+        int off = var_declare(cg, fn->params[i].name);
+        int reg_idx = (int)i + param_reg_start;
+        if (reg_idx < 6) {
+            /* Register-passed arg */
+            emit(cg, "    movq    %%%s, %d(%%rbp)", pregs[reg_idx], off);
+        } else {
+            /* Stack-passed arg: [rbp+16] for param nreg_params,
+             * [rbp+24] for param nreg_params+1, etc.
+             * (rbp+0=saved_rbp, rbp+8=ret_addr, rbp+16=first stack arg) */
+            int stk_slot = (int)(i - (size_t)nreg_params) * 8 + 16;
+            emit(cg, "    movq    %d(%%rbp), %%rax", stk_slot);
+            emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+        }
+        
+        /* Handle optional/default parameters */
+        if (fn->params[i].is_optional || fn->params[i].default_value) {
+            char lbl_has_arg[64];
+            fresh_label(cg, lbl_has_arg, sizeof(lbl_has_arg));
+            
+            emit(cg, "    movq    %d(%%rbp), %%rax", off);
+            emit(cg, "    testq   %%rax, %%rax");
+            emit(cg, "    jnz     %s", lbl_has_arg);
+            
+            if (fn->params[i].default_value) {
+                emit_expr(cg, fn->params[i].default_value);
+                emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+            }
+            
+            emit(cg, "%s:", lbl_has_arg);
+        }
+    }
+    (void)nreg_params; /* suppress unused-variable warning if nparams==0 */
+    emit_safepoint(cg);
 
-        emit_stmt(cg, node->children[1]);          /* then */
-        emit(cg, "    jmp     %s", lbl_end);
+    /* body */
+    scope_enter(cg);
+    for (size_t i = 0; i < body->child_count; i++)
+        emit_stmt(cg, body->children[i]);
+    scope_leave(cg);
 
-        emit(cg, "%s:", lbl_else);
-        if (node->child_count > 2)
-            emit_stmt(cg, node->children[2]);      /* else / else-if */
+    /* implicit return null */
+    emit(cg, "    call    " XLY_SYM("xly_null"));
+    emit(cg, "    movq    %%rbp, %%rsp");
+    emit(cg, "    popq    %%rbp");
+    emit(cg, "    ret");
 
-        emit(cg, "%s:", lbl_end);
-        break;
-    }
+    /* restore codegen state */
+    while (cg->var_count > sv_vc) { cg->var_count--; free(cg->vars[cg->var_count].name); }
+    cg->frame_offset  = sv_fo;
+    cg->scope_depth   = sv_sd;
+    cg->noreturn_mode = sv_nm;
+    cg->frame_offset = sv_fo;
+    cg->scope_depth  = sv_sd;
+    fn_rename_scope_leave(cg, sv_rename);  /* pop renames pushed by nested fn decls */
+}
 
-    /* ── while ────────────────────────────────────────────────────── */
-    case NODE_WHILE: {
-        char lbl_cond[64], lbl_end[64];
-        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
-        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+/* ── IR emitter (x86-64) ────────────────────────────────────────────────
+ * Straightforward out-of-SSA code: every value lives in its frame slot,
+ * each instruction loads its operands, computes into %rax and stores the
+ * result back.  Phi copies are placed on the incoming edges (critical
+ * edges were split by ir_finish).  Boxed +,-,*,/ and comparisons test
+ * both operand tags inline and only call the runtime for non-numbers.    */
+static const char *irx_regs[]   = {"rdi","rsi","rdx","rcx","r8","r9"};
+static const char *irx_regs32[] = {"edi","esi","edx","ecx","r8d","r9d"};
+static const char *irx_saved[]  = {"rbx","r12","r13","r14","r15"};   /* allocatable */
+#define IRX_NSAVED 5
+
+/* Operand text for a location; a small ring so one emit() can use several. */
+static const char *irx_at_loc(int loc) {
+    static _Thread_local char ring[4][32];
+    static _Thread_local int k;
+    char *buf = ring[k++ & 3];
+    if (IR_LOC_IS_REG(loc)) snprintf(buf, 32, "%%%s", irx_saved[IR_LOC_INDEX(loc)]);
+    else                    snprintf(buf, 32, "%d(%%rbp)", loc);
+    return buf;
+}
 
-        push_brk(cg, lbl_end);
-        push_cnt(cg, lbl_cond);
+static const char *irx_at(const IRInstr *v) { return irx_at_loc(ir_loc(v)); }
 
-        emit(cg, "%s:", lbl_cond);
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_truthy"));
-        emit(cg, "    testl   %%eax, %%eax");
-        emit(cg, "    jz      %s", lbl_end);
+static void irx_label(CG *cg, int seq, IRBlock *b, char *buf, size_t sz) {
+    snprintf(buf, sz, ".Lxly_ir%s%d_b%d", cg->label_pfx, seq, b->id);
+}
 
-        emit_stmt(cg, node->children[1]);
-        emit(cg, "    jmp     %s", lbl_cond);
+static void irx_ld(CG *cg, const char *reg, IRInstr *v) {
+    emit(cg, "    movq    %s, %%%s", irx_at(v), reg);
+}
 
-        emit(cg, "%s:", lbl_end);
-        pop_cnt(cg);
-        pop_brk(cg);
-        break;
+/* Store operands into an aligned stack array at (%rsp); returns the bytes
+ * to release after the call (0 when there are no operands).             */
+static int irx_array(CG *cg, IRInstr **vals, int n) {
+    if (n <= 0) return 0;
+    int bytes = ((n * 8) + 15) & ~15;
+    emit(cg, "    subq    $%d, %%rsp", bytes);
+    for (int i = 0; i < n; i++) {
+        irx_ld(cg, "rax", vals[i]);
+        emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
     }
+    return bytes;
+}
 
-    /* ── for (C-style)  children: [0]=init [1]=cond [2]=update [3]=body ── */
-    case NODE_FOR: {
-        char lbl_cond[64], lbl_upd[64], lbl_end[64];
-        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
-        fresh_label(cg, lbl_upd,  sizeof(lbl_upd));
-        fresh_label(cg, lbl_end,  sizeof(lbl_end));
-
-        scope_enter(cg);
-        push_brk(cg, lbl_end);
-        push_cnt(cg, lbl_upd);
-
-        emit_stmt(cg, node->children[0]);          /* init */
+static void irx_array_ptr(CG *cg, int bytes, const char *reg) {
+    if (bytes) emit(cg, "    movq    %%rsp, %%%s", reg);
+    else       emit(cg, "    xorq    %%%s, %%%s", reg, reg);
+}
 
-        emit(cg, "%s:", lbl_cond);
-        /* if cond is literal true (parser default), skip the check */
-        if (!(node->children[1]->type == NODE_BOOL && node->children[1]->bool_value)) {
-            emit_expr(cg, node->children[1]);
-            emit(cg, "    movq    %%rax, %%rdi");
-            emit(cg, "    call    " XLY_SYM("xly_truthy"));
-            emit(cg, "    testl   %%eax, %%eax");
-            emit(cg, "    jz      %s", lbl_end);
-        }
+static void irx_release(CG *cg, int bytes) {
+    if (bytes) emit(cg, "    addq    $%d, %%rsp", bytes);
+}
 
-        emit_stmt(cg, node->children[3]);          /* body */
+/* The number held by `v` into %xmmN: raw f64 as is, boxed via ->num. */
+static void irx_ld_num(CG *cg, int xmm, IRInstr *v) {
+    if (v->type == IRT_F64) {
+        emit(cg, "    movq    %s, %%xmm%d", irx_at(v), xmm);
+    } else {
+        irx_ld(cg, "rax", v);
+        emit(cg, "    movsd   8(%%rax), %%xmm%d", xmm);
+    }
+}
 
-        emit(cg, "%s:", lbl_upd);
-        if (node->children[2]->type != NODE_NULL)
-            emit_stmt(cg, node->children[2]);      /* update */
+/* Box the number in %xmm0 as the result of `in`: in its frame cell when
+ * it does not escape (pass_escape), on the heap otherwise.              */
+static void irx_box_xmm0(CG *cg, IRInstr *in) {
+    if (in->stack) {
+        emit(cg, "    movsd   %%xmm0, %d(%%rbp)", in->cell + 8);
+        emit(cg, "    leaq    %d(%%rbp), %%rax", in->cell);
+    } else {
+        emit(cg, "    call    " XLY_SYM("xly_num"));
+    }
+}
 
-        emit(cg, "    jmp     %s", lbl_cond);
-        emit(cg, "%s:", lbl_end);
+/* a op b (+ - * / %).  An f64 result is computed on the operands' numbers
+ * directly (the unboxing pass only types + f64 for two raw operands);
+ * boxed + - * / get an inline fast path when both are numbers, unless the
+ * profile says they mostly were not.  A profiled site counts its runs in
+ * counter 0 and the ones that took the slow path in counter 1.         */
+static void irx_arith(CG *cg, IRInstr *in) {
+    static const char *sse[] = { "addsd", "subsd", "mulsd", "divsd" };
+    static const char *rt[]  = { XLY_SYM("xly_add"), XLY_SYM("xly_sub"),
+                                 XLY_SYM("xly_mul"), XLY_SYM("xly_div"),
+                                 XLY_SYM("xly_mod") };
+    int k = in->op - IR_ADD;
+    if (in->type == IRT_F64) {
+        irx_ld_num(cg, 0, in->args[0]);
+        irx_ld_num(cg, 1, in->args[1]);
+        if (in->op == IR_MOD) emit(cg, "    call    " XLY_SYM("fmod"));
+        else                  emit(cg, "    %s   %%xmm1, %%xmm0", sse[k]);
+        emit(cg, "    movq    %%xmm0, %%rax");
+        cg->stat_unboxed_ops++;
+        return;
+    }
+    irx_ld(cg, "rdi", in->args[0]);
+    irx_ld(cg, "rsi", in->args[1]);
+    if (cg->opt_level >= 2 && in->op != IR_MOD && in->hint >= 0) {
+        char slow[64], done[64];
+        fresh_label(cg, slow, sizeof(slow));
+        fresh_label(cg, done, sizeof(done));
+        if (in->prof) emit(cg, "    lock incq %s(%%rip)", in->prof);
+        emit(cg, "    cmpl    $0, (%%rdi)");
+        emit(cg, "    jne     %s", slow);
+        emit(cg, "    cmpl    $0, (%%rsi)");
+        emit(cg, "    jne     %s", slow);
+        emit(cg, "    movsd   8(%%rdi), %%xmm0");
+        emit(cg, "    %s   8(%%rsi), %%xmm0", sse[k]);
+        irx_box_xmm0(cg, in);
+        emit(cg, "    jmp     %s", done);
+        emit(cg, "%s:", slow);
+        if (in->prof) emit(cg, "    lock incq %s+8(%%rip)", in->prof);
+        emit(cg, "    call    %s", rt[k]);
+        emit(cg, "%s:", done);
+        cg->stat_unboxed_ops++;
+    } else {
+        emit(cg, "    call    %s", rt[k]);
+    }
+}
 
-        pop_cnt(cg);
-        pop_brk(cg);
-        scope_leave(cg);
+/* %al = (xmm0 <op> xmm1) after ucomisd, false on NaN except for != */
+static void irx_setcc(CG *cg, IROp op) {
+    switch (op) {
+    case IR_LT: emit(cg, "    ucomisd %%xmm0, %%xmm1"); emit(cg, "    seta    %%al");  break;
+    case IR_LE: emit(cg, "    ucomisd %%xmm0, %%xmm1"); emit(cg, "    setae   %%al");  break;
+    case IR_GT: emit(cg, "    ucomisd %%xmm1, %%xmm0"); emit(cg, "    seta    %%al");  break;
+    case IR_GE: emit(cg, "    ucomisd %%xmm1, %%xmm0"); emit(cg, "    setae   %%al");  break;
+    case IR_EQ:
+        emit(cg, "    ucomisd %%xmm1, %%xmm0");
+        emit(cg, "    sete    %%al");
+        emit(cg, "    setnp   %%cl");
+        emit(cg, "    andb    %%cl, %%al");
+        break;
+    default:
+        emit(cg, "    ucomisd %%xmm1, %%xmm0");
+        emit(cg, "    setne   %%al");
+        emit(cg, "    setp    %%cl");
+        emit(cg, "    orb     %%cl, %%al");
         break;
     }
+    emit(cg, "    movzbl  %%al, %%eax");
+}
 
-    /* ── for-in  str_value=itervar, children[0]=iterable, [1]=body ── */
-    case NODE_FOR_IN: {
-        char lbl_cond[64], lbl_end[64];
-        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
-        fresh_label(cg, lbl_end,  sizeof(lbl_end));
-
-        scope_enter(cg);
-
-        /* declare: itervar + 3 hidden slots (arr, idx, len) */
-        int off_iter = var_declare(cg, node->str_value);
-        char tmp[80];
-        snprintf(tmp, sizeof(tmp), "__fi_a_%d", cg->label_seq);
-        int off_arr  = var_declare(cg, tmp);
-        snprintf(tmp, sizeof(tmp), "__fi_i_%d", cg->label_seq);
-        int off_idx  = var_declare(cg, tmp);
-        snprintf(tmp, sizeof(tmp), "__fi_l_%d", cg->label_seq++);
-        int off_len  = var_declare(cg, tmp);
-
-        /* eval iterable */
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off_arr);
-        /* len = xly_array_len(arr) */
+/* Comparisons.  ucomisd sets PF for unordered operands, so every form is
+ * false on NaN except !=.  The bool form (fused into a branch) yields a
+ * raw 0/1; the val form boxes it.                                        */
+static void irx_compare(CG *cg, IRInstr *in) {
+    static const char *rt[] = { XLY_SYM("xly_lt"), XLY_SYM("xly_gt"),
+                                XLY_SYM("xly_lte"), XLY_SYM("xly_gte"),
+                                XLY_SYM("xly_eq"), XLY_SYM("xly_neq") };
+    int k = in->op - IR_LT;
+    if (in->args[0]->type == IRT_F64 || in->args[1]->type == IRT_F64) {
+        irx_ld_num(cg, 0, in->args[0]);
+        irx_ld_num(cg, 1, in->args[1]);
+        irx_setcc(cg, in->op);
+        if (in->type == IRT_VAL) {
+            emit(cg, "    movl    %%eax, %%edi");
+            emit(cg, "    call    " XLY_SYM("xly_bool"));
+        }
+        cg->stat_unboxed_ops++;
+        return;
+    }
+    irx_ld(cg, "rdi", in->args[0]);
+    irx_ld(cg, "rsi", in->args[1]);
+    char slow[64], done[64];
+    fresh_label(cg, slow, sizeof(slow));
+    fresh_label(cg, done, sizeof(done));
+    if (cg->opt_level >= 2) {
+        emit(cg, "    cmpl    $0, (%%rdi)");
+        emit(cg, "    jne     %s", slow);
+        emit(cg, "    cmpl    $0, (%%rsi)");
+        emit(cg, "    jne     %s", slow);
+        emit(cg, "    movsd   8(%%rdi), %%xmm0");
+        emit(cg, "    movsd   8(%%rsi), %%xmm1");
+        irx_setcc(cg, in->op);
+        if (in->type == IRT_VAL) {
+            emit(cg, "    movl    %%eax, %%edi");
+            emit(cg, "    call    " XLY_SYM("xly_bool"));
+        }
+        emit(cg, "    jmp     %s", done);
+        cg->stat_unboxed_ops++;
+    }
+    emit(cg, "%s:", slow);
+    emit(cg, "    call    %s", rt[k]);
+    if (in->type == IRT_BOOL) {
         emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_array_len"));
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off_len);
-        /* idx = 0 */
-        emit(cg, "    movq    $0, %d(%%rbp)", off_idx);
-
-        push_brk(cg, lbl_end);
-        push_cnt(cg, lbl_cond);
-
-        emit(cg, "%s:", lbl_cond);
-        emit(cg, "    movq    %d(%%rbp), %%rax", off_idx);
-        emit(cg, "    cmpq    %d(%%rbp), %%rax", off_len);
-        emit(cg, "    jae     %s", lbl_end);
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    movl    %%eax, %%eax");
+    }
+    emit(cg, "%s:", done);
+}
 
-        /* itervar = array_get(arr, idx) */
-        emit(cg, "    movq    %d(%%rbp), %%rdi", off_arr);
-        emit(cg, "    movq    %d(%%rbp), %%rsi", off_idx);
-        emit(cg, "    call    " XLY_SYM("xly_array_get"));
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off_iter);
+/* Phi copies for the edge b → s, then the jump itself (omitted when s is
+ * laid out next).                                                        */
+static void irx_edge(CG *cg, IRFrame *fr, int seq, IRBlock *b, IRBlock *s, IRBlock *next) {
+    int n = 0, par = 0;
+    int *dst = malloc(sizeof(int) * (size_t)(s->nins + 1));
+    int *src = malloc(sizeof(int) * (size_t)(s->nins + 1));
+    n = ir_phi_moves(b, s, dst, src, &par);
+    if (par) {
+        for (int i = 0; i < n; i++) {
+            emit(cg, "    movq    %s, %%rax", irx_at_loc(src[i]));
+            emit(cg, "    movq    %%rax, %d(%%rbp)", fr->scratch - 8 * i);
+        }
+        for (int i = 0; i < n; i++) src[i] = fr->scratch - 8 * i;
+    }
+    for (int i = 0; i < n; i++) {
+        if (IR_LOC_IS_REG(src[i]) || IR_LOC_IS_REG(dst[i])) {
+            emit(cg, "    movq    %s, %s", irx_at_loc(src[i]), irx_at_loc(dst[i]));
+        } else {
+            emit(cg, "    movq    %s, %%rax", irx_at_loc(src[i]));
+            emit(cg, "    movq    %%rax, %s", irx_at_loc(dst[i]));
+        }
+    }
+    free(dst);
+    free(src);
+    if (s != next) {
+        char l[64];
+        irx_label(cg, seq, s, l, sizeof(l));
+        emit(cg, "    jmp     %s", l);
+    }
+}
 
-        emit_stmt(cg, node->children[1]);          /* body */
+/* IR_SWITCH.  An i64 operand is the key; a number is one only when it is
+ * integral (anything else takes the default).  Targets have no phis of
+ * their own (critical edges were split), so this is a plain jump.       */
+static void irx_switch(CG *cg, int seq, IRInstr *in) {
+    char dflt[64], l[64], tab[64];
+    IRInstr *v = in->args[0];
+    irx_label(cg, seq, in->cases[0], dflt, sizeof(dflt));
+    if (v->type == IRT_I64) {
+        irx_ld(cg, "rax", v);
+    } else {
+        if (v->type == IRT_F64) {
+            emit(cg, "    movq    %s, %%xmm0", irx_at(v));
+        } else {
+            irx_ld(cg, "rax", v);
+            emit(cg, "    testq   %%rax, %%rax");
+            emit(cg, "    je      %s", dflt);
+            emit(cg, "    cmpl    $0, (%%rax)");                 /* VAL_NUMBER */
+            emit(cg, "    jne     %s", dflt);
+            emit(cg, "    movsd   8(%%rax), %%xmm0");
+        }
+        emit(cg, "    cvttsd2si %%xmm0, %%rax");
+        emit(cg, "    cvtsi2sd %%rax, %%xmm1");
+        emit(cg, "    ucomisd %%xmm1, %%xmm0");
+        emit(cg, "    jne     %s", dflt);
+        emit(cg, "    jp      %s", dflt);
+    }
+    int n = in->ncases - 1;
+    long long lo = 0, hi = 0;
+    for (int c = 1; c <= n; c++) {
+        if (c == 1 || in->keys[c] < lo) lo = in->keys[c];
+        if (c == 1 || in->keys[c] > hi) hi = in->keys[c];
+    }
+    if (!switch_use_table(lo, hi, n)) {
+        for (int c = 1; c <= n; c++) {
+            irx_label(cg, seq, in->cases[c], l, sizeof(l));
+            emit(cg, "    cmpq    $%lld, %%rax", in->keys[c]);
+            emit(cg, "    je      %s", l);
+        }
+        emit(cg, "    jmp     %s", dflt);
+        return;
+    }
+    fresh_label(cg, tab, sizeof(tab));
+    if (lo) emit(cg, "    subq    $%lld, %%rax", lo);
+    emit(cg, "    cmpq    $%lld, %%rax", hi - lo);
+    emit(cg, "    ja      %s", dflt);
+    emit(cg, "    leaq    %s(%%rip), %%rdx", tab);
+    emit(cg, "    movslq  (%%rdx,%%rax,4), %%rax");
+    emit(cg, "    addq    %%rdx, %%rax");
+    emit(cg, "    jmp     *%%rax");
+    emit(cg, "    .p2align 2");
+    emit(cg, "%s:", tab);
+    for (long long k = lo; k <= hi; k++) {
+        IRBlock *to = in->cases[0];
+        for (int c = 1; c <= n; c++)
+            if (in->keys[c] == k) { to = in->cases[c]; break; }
+        irx_label(cg, seq, to, l, sizeof(l));
+        emit(cg, "    .long   %s-%s", l, tab);
+    }
+    cg->stat_jump_tables++;
+}
 
-        /* idx++ */
-        emit(cg, "    movq    %d(%%rbp), %%rax", off_idx);
-        emit(cg, "    addq    $1, %%rax");
-        emit(cg, "    movq    %%rax, %d(%%rbp)", off_idx);
-        emit(cg, "    jmp     %s", lbl_cond);
-        emit(cg, "%s:", lbl_end);
+/* Restore the callee-saved registers and pop the frame. */
+static void irx_leave(CG *cg, IRFrame *fr) {
+    for (int r = 0; r < fr->nsaved; r++)
+        emit(cg, "    movq    %d(%%rbp), %%%s", fr->save_slot - 8 * r, irx_saved[r]);
+    emit(cg, "    movq    %%rbp, %%rsp");
+    emit(cg, "    popq    %%rbp");
+}
 
-        pop_cnt(cg);
-        pop_brk(cg);
-        scope_leave(cg);
-        break;
+static void irx_epilogue(CG *cg, IRFunc *f, IRFrame *fr) {
+    if (f->is_main && !cg->unit) {
+        emit(cg, "    movl    $0, %%edi");
+        emit(cg, "    call    " XLY_SYM("xly_exit"));
     }
+    irx_leave(cg, fr);
+    emit(cg, "    ret");
+}
 
-    /* ── break / continue ──────────────────────────────────────────── */
-    case NODE_BREAK:
-        if (cg->brk_top > 0)
-            emit(cg, "    jmp     %s", cg->brk_labels[cg->brk_top-1]);
-        break;
-    case NODE_CONTINUE:
-        if (cg->cnt_top > 0)
-            emit(cg, "    jmp     %s", cg->cnt_labels[cg->cnt_top-1]);
-        break;
-
-    /* ── block ─────────────────────────────────────────────────────── */
-    case NODE_BLOCK:
-        scope_enter(cg);
-        for (size_t i = 0; i < node->child_count; i++)
-            emit_stmt(cg, node->children[i]);
-        scope_leave(cg);
-        break;
+/* Tail calls become jumps when every argument travels in a register. */
+static int irx_tail_jump(const IRInstr *in) {
+    return in->op == IR_CALL && in->tail && in->nargs <= 6;
+}
 
-    /* ── fn decl — stash for emission after main ─────────────────── */
-    case NODE_FN_DECL: {
-        /* Allocate a globally-unique asm label for this function body.
-         * If a function with this name was already emitted (e.g. same name
-         * reused in a different inner scope), the label gets a numeric suffix
-         * like "add__2" so the assembler never sees duplicate definitions.   */
-        char ulbl[256];
-        fn_unique_label(cg, node->str_value, ulbl, sizeof(ulbl));
-        /* Push scope-local rename so call sites inside THIS body resolve
-         * to the correct (possibly renamed) label.                           */
-        fn_rename_push(cg, node->str_value, ulbl);
-        if (cg->func_count >= cg->func_cap) {
-            cg->func_cap = cg->func_cap ? cg->func_cap * 2 : 16;
-            cg->funcs    = realloc(cg->funcs, sizeof(cg->funcs[0]) * (size_t)cg->func_cap);
+static void irx_instr(CG *cg, IRFunc *f, IRFrame *fr, int seq, IRInstr *in, IRBlock *next) {
+    char l[64], l2[64];
+    int bytes;
+    if (cg->verbose && in->op != IR_PHI && in->op != IR_PARAM)
+        emit(cg, "    # %%%d = %s", in->id, ir_op_name(in->op));
+
+    switch (in->op) {
+    case IR_CONST_NUM:
+        if (in->type == IRT_F64) {
+            union { double d; unsigned long long u; } c = { in->num };
+            emit(cg, "    movabsq $0x%llx, %%rax", c.u);
+            break;
         }
-        { int fi = cg->func_count++;
-          cg->funcs[fi].node      = node;
-          cg->funcs[fi].captures  = NULL;
-          cg->funcs[fi].ncaptures = 0;
-          cg->funcs[fi].asm_label = strdup(ulbl);
-          /* Snapshot the current rename table so that when this function's
-           * body is emitted later (after the outer scope has been cleaned up),
-           * peer functions declared in the same scope are still resolvable.   */
-          fn_rename_ctx_snapshot(cg, &cg->funcs[fi].rename_ctx, &cg->funcs[fi].rename_ctx_count); }
+        ir_const_box_label(cg, seq, in, l, sizeof(l));
+        emit(cg, "    leaq    %s(%%rip), %%rax", l);
         break;
-    }
-
-    /* ── return ────────────────────────────────────────────────────── */
-    case NODE_RETURN:
-        if (node->child_count > 0)
-            emit_expr(cg, node->children[0]);
-        else
-            emit(cg, "    call    " XLY_SYM("xly_null"));
-        emit(cg, "    movq    %%rbp, %%rsp");
-        emit(cg, "    popq    %%rbp");
-        emit(cg, "    ret");
+    case IR_CONST_STR:
+        emit(cg, "    leaq    %s(%%rip), %%rdi", intern_string(cg, in->sym));
+        emit(cg, "    call    " XLY_SYM("xly_str"));
         break;
-
-    /* ── import — no-op (stdlib linked statically) ────────────────── */
-    case NODE_IMPORT:
+    case IR_CONST_BOOL:
+        emit(cg, "    movl    $%d, %%edi", (int)in->imm);
+        emit(cg, "    call    " XLY_SYM("xly_bool"));
         break;
-
-    /* ── enum declaration — register variants, create parameterless ones ── */
-    case NODE_ENUM_DECL:
-        /* Variant names already registered in variant table by pre-pass.
-         * For parameterless variants, emit a global holding the singleton
-         * VAL_ENUM_VARIANT value so NODE_IDENTIFIER can load it.
-         * Parametric variants are constructed at call-site via xly_make_variant. */
-        for (size_t vi = 0; vi < node->child_count; vi++) {
-            ASTNode *vn = node->children[vi];
-            if (!vn || !vn->str_value) continue;
-            if (vn->param_count == 0) {
-                /* Create the singleton and store in a global */
-                const char *tag_label = intern_string(cg, vn->str_value);
-                emit(cg, "    leaq    %s(%%rip), %%rdi", tag_label);
-                emit(cg, "    call    " XLY_SYM("xly_str"));
-                emit(cg, "    movq    %%rax, %%rdi");
-                emit(cg, "    xorq    %%rsi, %%rsi");   /* fields = NULL */
-                emit(cg, "    xorl    %%edx, %%edx");   /* nfields = 0   */
-                emit(cg, "    call    " XLY_SYM("xly_make_variant"));
-                /* Store in global slot so identifier lookups find it */
-                int gi = gvar_declare(cg, vn->str_value);
-                emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
-            }
-            /* Parametric variants: nothing to emit here; call-sites use xly_make_variant */
-        }
+    case IR_CONST_NULL:
+        emit(cg, "    call    " XLY_SYM("xly_null"));
+        break;
+    case IR_ICONST:
+        if (in->imm >= INT32_MIN && in->imm <= INT32_MAX)
+            emit(cg, "    movq    $%lld, %%rax", in->imm);
+        else
+            emit(cg, "    movabsq $%lld, %%rax", in->imm);
         break;
 
-    /* ── Generator function declaration (x86-64) ───────────────────────────
-     * Like the ARM64 path: emit xly_gen_create(fn_ptr, NULL) and store. */
-    case NODE_GEN_DECL: {
-        const char *gen_name = node->str_value ? node->str_value : "__anon_gen";
-        char body_lbl[128]; snprintf(body_lbl, sizeof(body_lbl), "_xly_gen_%s", gen_name);
-        emit(cg, "    leaq    %s(%%rip), %%rdi", body_lbl);
-        emit(cg, "    xorq    %%rsi, %%rsi");   /* env_ptr = NULL */
-        emit(cg, "    call    " XLY_SYM("xly_gen_create"));
-        if (node->str_value) {
-            int gi = gvar_declare(cg, node->str_value);
-            emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
+    case IR_PARAM:
+    case IR_PHI:
+        return;                                     /* already in their slots */
+    case IR_CAPTURE:
+        emit(cg, "    movq    %d(%%rbp), %%rax", fr->env_slot);
+        emit(cg, "    movq    %d(%%rax), %%rax", (int)in->imm * 8);
+        break;
+    case IR_GLOBAL_LOAD:
+        emit(cg, "    movq    " XLY_SYM("__xly_globals") "+%d(%%rip), %%rax", (int)in->imm * 8);
+        break;
+    case IR_GLOBAL_STORE:
+        irx_ld(cg, "rax", in->args[0]);
+        emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", (int)in->imm * 8);
+        return;
+
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+        irx_arith(cg, in);
+        break;
+    case IR_LT: case IR_GT: case IR_LE: case IR_GE: case IR_EQ: case IR_NE:
+        irx_compare(cg, in);
+        break;
+    case IR_NEG:
+        if (in->type == IRT_F64) {
+            irx_ld(cg, "rax", in->args[0]);
+            if (in->args[0]->type != IRT_F64) emit(cg, "    movq    8(%%rax), %%rax");
+            emit(cg, "    btcq    $63, %%rax");
+            break;
         }
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    call    " XLY_SYM("xly_neg"));
+        break;
+    case IR_BOX:
+        if (ir_const_box(in)) {
+            ir_const_box_label(cg, seq, in, l, sizeof(l));
+            emit(cg, "    leaq    %s(%%rip), %%rax", l);
+            break;
+        }
+        emit(cg, "    movq    %s, %%xmm0", irx_at(in->args[0]));
+        irx_box_xmm0(cg, in);
+        break;
+    case IR_NOT:
+    case IR_TYPEOF:
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    call    %s", in->op == IR_NOT ? XLY_SYM("xly_not")
+                                                    : XLY_SYM("xly_typeof"));
+        break;
+    case IR_TRUTHY:
+        if (in->args[0]->type == IRT_F64) {             /* != 0, NaN is truthy */
+            emit(cg, "    movq    %s, %%xmm0", irx_at(in->args[0]));
+            emit(cg, "    xorpd   %%xmm1, %%xmm1");
+            irx_setcc(cg, IR_NE);
+            break;
+        }
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    call    " XLY_SYM("xly_truthy"));
+        emit(cg, "    movl    %%eax, %%eax");
+        break;
+    case IR_IS_MISSING:
+        emit(cg, "    xorl    %%eax, %%eax");
+        emit(cg, "    cmpq    $0, %s", irx_at(in->args[0]));
+        emit(cg, "    sete    %%al");
         break;
-    }
 
-    /* ── yield expr (x86-64) ────────────────────────────────────────────────
-     * Evaluate yield value → rdi, call xly_gen_yield, then ret.        */
-    case NODE_YIELD:
-        if (node->child_count > 0) emit_expr(cg, node->children[0]);
-        else emit(cg, "    call    " XLY_SYM("xly_null"));
-        emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_gen_yield"));
-        emit(cg, "    ret");
+    case IR_IADD:
+        irx_ld(cg, "rax", in->args[0]);
+        emit(cg, "    addq    %s, %%rax", irx_at(in->args[1]));
+        break;
+    case IR_ILT:
+    case IR_IEQ:
+        irx_ld(cg, "rcx", in->args[0]);
+        emit(cg, "    xorl    %%eax, %%eax");
+        emit(cg, "    cmpq    %s, %%rcx", irx_at(in->args[1]));
+        emit(cg, "    %s    %%al", in->op == IR_ILT ? "setl" : "sete");
         break;
 
-    case NODE_YIELD_EMPTY:
+    case IR_ARRAY:
+        bytes = irx_array(cg, in->args, in->nargs);
+        irx_array_ptr(cg, bytes, "rdi");
+        emit(cg, "    movq    $%d, %%rsi", in->nargs);
+        emit(cg, "    call    " XLY_SYM("xly_array_create"));
+        irx_release(cg, bytes);
+        break;
+    case IR_ARRAY_LEN:
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    call    " XLY_SYM("xly_array_len"));
+        break;
+    case IR_ARRAY_GET:
+        irx_ld(cg, "rdi", in->args[0]);
+        irx_ld(cg, "rsi", in->args[1]);
+        emit(cg, "    call    " XLY_SYM("xly_array_get"));
+        break;
+    case IR_INDEX:
+        irx_ld(cg, "rdi", in->args[0]);
+        irx_ld(cg, "rsi", in->args[1]);
+        emit(cg, "    call    " XLY_SYM("xly_index"));
+        break;
+    case IR_INDEX_SET:
+        irx_ld(cg, "rdi", in->args[0]);
+        irx_ld(cg, "rsi", in->args[1]);
+        irx_ld(cg, "rdx", in->args[2]);
+        emit(cg, "    call    " XLY_SYM("xly_index_set"));
+        break;
+    case IR_OBJECT_NEW:
+        emit(cg, "    call    " XLY_SYM("xly_obj_new"));
+        break;
+    case IR_PROP_GET:
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    movq    %s(%%rip), %%rsi", atom_label(cg, in->sym));
+        emit(cg, "    call    " XLY_SYM("xly_obj_get_atom"));
+        break;
+    case IR_PROP_SET:
+        irx_ld(cg, "rdi", in->args[0]);
+        irx_ld(cg, "rdx", in->args[1]);
+        emit(cg, "    movq    %s(%%rip), %%rsi", atom_label(cg, in->sym));
+        emit(cg, "    call    " XLY_SYM("xly_obj_set_atom"));
+        return;
+    case IR_NEW:
+        emit(cg, "    leaq    .Lxly_class_%d(%%rip), %%rdi", (int)in->imm);
+        emit(cg, "    call    " XLY_SYM("xly_new"));
+        break;
+    case IR_FIELD_GET:                      /* this->instance->vals[slot] */
+        irx_ld(cg, "rax", in->args[0]);
+        emit(cg, "    movq    72(%%rax), %%rax");
+        emit(cg, "    movq    8(%%rax), %%rax");
+        emit(cg, "    movq    %d(%%rax), %%rax", (int)in->imm * 8);
+        fresh_label(cg, l, sizeof(l));
+        emit(cg, "    testq   %%rax, %%rax");
+        emit(cg, "    jne     %s", l);
+        emit(cg, "    call    " XLY_SYM("xly_null"));  /* not assigned yet */
+        emit(cg, "%s:", l);
+        break;
+    case IR_FIELD_SET:
+        irx_ld(cg, "rax", in->args[0]);
+        irx_ld(cg, "rcx", in->args[1]);
+        emit(cg, "    movq    72(%%rax), %%rax");
+        emit(cg, "    movq    8(%%rax), %%rax");
+        emit(cg, "    movq    %%rcx, %d(%%rax)", (int)in->imm * 8);
+        return;
+    case IR_INSTANCEOF:
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    leaq    .Lxly_class_%d(%%rip), %%rsi", (int)in->imm);
+        emit(cg, "    call    " XLY_SYM("xly_instanceof"));
+        break;
+    case IR_VARIANT_TAG:
+        fresh_label(cg, l, sizeof(l));
+        irx_ld(cg, "rcx", in->args[0]);
+        emit(cg, "    movq    $-1, %%rax");
+        emit(cg, "    testq   %%rcx, %%rcx");
+        emit(cg, "    je      %s", l);
+        emit(cg, "    cmpl    $12, (%%rcx)");                  /* VAL_ENUM_VARIANT */
+        emit(cg, "    jne     %s", l);
+        emit(cg, "    movslq  24(%%rcx), %%rax");              /* tag id      */
+        emit(cg, "%s:", l);
+        break;
+    case IR_VARIANT_FIELD:
+        fresh_label(cg, l,  sizeof(l));
+        fresh_label(cg, l2, sizeof(l2));
+        irx_ld(cg, "rcx", in->args[0]);
+        emit(cg, "    cmpq    $%d, 120(%%rcx)", (int)in->imm); /* field_count */
+        emit(cg, "    jbe     %s", l);
+        emit(cg, "    movq    112(%%rcx), %%rax");             /* fields      */
+        emit(cg, "    movq    %d(%%rax), %%rax", (int)in->imm * 8);
+        emit(cg, "    jmp     %s", l2);
+        emit(cg, "%s:", l);
         emit(cg, "    call    " XLY_SYM("xly_null"));
+        emit(cg, "%s:", l2);
+        break;
+    case IR_MAKE_FN:
+        emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", in->sym);
+        if (in->imm) {                                  /* takes a receiver */
+            emit(cg, "    xorl    %%esi, %%esi");
+            emit(cg, "    xorl    %%edx, %%edx");
+            emit(cg, "    call    " XLY_SYM("xly_make_method"));
+        } else {
+            emit(cg, "    call    " XLY_SYM("xly_make_fn"));
+        }
+        break;
+    case IR_GEN_FN:
+        emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", in->sym);
+        emit(cg, "    call    " XLY_SYM("xly_gen_fn"));
+        break;
+    case IR_MAKE_CLOSURE:
+        bytes = irx_array(cg, in->args, in->nargs);
+        emit(cg, "    leaq    .Lxly_fn_%s(%%rip), %%rdi", in->sym);
+        emit(cg, "    movq    %%rsp, %%rsi");
+        emit(cg, "    movl    $%d, %%edx", in->nargs);
+        emit(cg, "    call    %s", in->imm ? XLY_SYM("xly_make_method") : XLY_SYM("xly_make_closure"));
+        irx_release(cg, bytes);
+        break;
+    case IR_MAKE_VARIANT:
+        bytes = irx_array(cg, in->args, in->nargs);
+        emit(cg, "    leaq    %s(%%rip), %%rdi", intern_string(cg, in->sym));
+        emit(cg, "    call    " XLY_SYM("xly_str"));
         emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_gen_yield"));
-        emit(cg, "    ret");
+        irx_array_ptr(cg, bytes, "rsi");
+        emit(cg, "    movl    $%d, %%edx", in->nargs);
+        emit(cg, "    movl    $%d, %%ecx", (int)in->imm);
+        emit(cg, "    call    " XLY_SYM("xly_make_variant"));
+        irx_release(cg, bytes);
         break;
 
-    /* ── for (x of iterable) — x86-64 ──────────────────────────────────────
-     * children[0]=iterable, children[1]=body, str_value=loop var         */
-    case NODE_FOR_OF: {
-        int lbl = cg->label_seq++;
-        char loop_lbl[40], end_lbl[40];
-        snprintf(loop_lbl, sizeof(loop_lbl), ".Lfor_of_%d", lbl);
-        snprintf(end_lbl,  sizeof(end_lbl),  ".Lfor_of_end_%d", lbl);
-        /* Save rbx (callee-saved) for iterator */
-        emit(cg, "    pushq   %%rbx");
-        emit_expr(cg, node->children[0]);   /* rax = iterable */
-        emit(cg, "    movq    %%rax, %%rbx");
-        emit(cg, "%s:", loop_lbl);
-        emit(cg, "    movq    %%rbx, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_for_of_next"));
-        emit(cg, "    testq   %%rax, %%rax");
-        emit(cg, "    je      %s", end_lbl);
-        /* Store loop variable */
-        if (node->str_value) {
-            int gi = gvar_declare(cg, node->str_value);
-            emit(cg, "    movq    %%rax, " XLY_SYM("__xly_globals") "+%d(%%rip)", gi * 8);
+    case IR_CALL: {
+        if (in->type == IRT_F64) {                      /* raw-f64 entry */
+            for (int i = 0; i < in->nargs; i++)
+                emit(cg, "    movq    %s, %%xmm%d", irx_at(in->args[i]), i);
+            if (irx_tail_jump(in)) {
+                irx_leave(cg, fr);
+                emit(cg, "    jmp     .Lxly_fn_%s__num", in->sym);
+                return;
+            }
+            emit(cg, "    call    .Lxly_fn_%s__num", in->sym);
+            emit(cg, "    movq    %%xmm0, %%rax");
+            break;
         }
-        if (node->child_count > 1) emit_stmt(cg, node->children[1]);
-        emit(cg, "    jmp     %s", loop_lbl);
-        emit(cg, "%s:", end_lbl);
-        emit(cg, "    popq    %%rbx");
+        /* SysV: args 0-5 in registers, the rest on the stack (caller
+         * cleans up).  Registers for params the caller omitted are zeroed
+         * so the callee sees a raw NULL ("missing") for them.            */
+        int n = in->nargs, nreg = n < 6 ? n : 6, nstk = n - nreg;
+        int stk = nstk > 0 ? ((nstk * 8) + 15) & ~15 : 0;
+        if (stk) emit(cg, "    subq    $%d, %%rsp", stk);
+        for (int i = 0; i < nstk; i++) {
+            irx_ld(cg, "rax", in->args[6 + i]);
+            emit(cg, "    movq    %%rax, %d(%%rsp)", i * 8);
+        }
+        for (int i = 0; i < nreg; i++) irx_ld(cg, irx_regs[i], in->args[i]);
+        int upto = in->imm < 0 ? 6 : (in->imm < 6 ? (int)in->imm : 6);
+        for (int i = nreg; i < upto; i++)
+            emit(cg, "    xorl    %%%s, %%%s", irx_regs32[i], irx_regs32[i]);
+        if (irx_tail_jump(in)) {                        /* reuse our frame */
+            irx_leave(cg, fr);
+            emit(cg, "    jmp     .Lxly_fn_%s", in->sym);
+            return;
+        }
+        emit(cg, "    call    .Lxly_fn_%s", in->sym);
+        irx_release(cg, stk);
         break;
     }
-
-    /* ── Computed property: obj.[expr] — x86-64 ─────────────────────────── */
-    case NODE_COMPUTED_PROP:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    movq    %%rax, %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_index"));
+    case IR_CALL_VALUE:
+        bytes = irx_array(cg, in->args + 1, in->nargs - 1);
+        irx_ld(cg, "rdi", in->args[0]);
+        irx_array_ptr(cg, bytes, "rsi");
+        emit(cg, "    movl    $%d, %%edx", in->nargs - 1);
+        emit(cg, "    call    " XLY_SYM("xly_call_fnval"));
+        irx_release(cg, bytes);
         break;
-
-    case NODE_COMPUTED_PROP_SET:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");              /* save obj */
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    pushq   %%rax");              /* save key */
-        emit_expr(cg, node->children[2]);
-        emit(cg, "    movq    %%rax, %%rdx");       /* val → rdx */
-        emit(cg, "    popq    %%rsi");              /* key → rsi */
-        emit(cg, "    popq    %%rdi");              /* obj → rdi */
-        emit(cg, "    call    " XLY_SYM("xly_index_set"));
+    case IR_SPAWN:
+        bytes = irx_array(cg, in->args + 1, in->nargs - 1);
+        irx_ld(cg, "rdi", in->args[0]);
+        irx_array_ptr(cg, bytes, "rsi");
+        emit(cg, "    movl    $%d, %%edx", in->nargs - 1);
+        emit(cg, "    call    " XLY_SYM("xly_spawn"));
+        irx_release(cg, bytes);
         break;
-
-    /* ── Reflect calls — x86-64 SysV ABI ───────────────────────────────────
-     * All take (obj, key) or (obj, key, val) → straightforward rdi/rsi/rdx */
-    case NODE_REFLECT_KEYS:
-    case NODE_REFLECT_OWN_KEYS:
-        if (node->child_count > 0) emit_expr(cg, node->children[0]);
-        emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_keys"));
+    case IR_CALL_MODULE:
+        bytes = irx_array(cg, in->args, in->nargs);
+        irx_array_ptr(cg, bytes, "rdx");
+        emit(cg, "    leaq    %s(%%rip), %%rdi", intern_string(cg, in->sym));
+        emit(cg, "    leaq    %s(%%rip), %%rsi", intern_string(cg, in->sym2));
+        emit(cg, "    movl    $%d, %%ecx", in->nargs);
+        emit(cg, "    call    " XLY_SYM("xly_call_module"));
+        irx_release(cg, bytes);
         break;
-
-    case NODE_REFLECT_GET:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    movq    %%rax, %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_get"));
+    case IR_CALL_NATIVE:
+        if (in->type == IRT_F64) {                      /* inline on raw numbers */
+            if (in->imm == IR_NATIVE_ABS) {
+                irx_ld(cg, "rax", in->args[0]);
+                emit(cg, "    btrq    $63, %%rax");
+                break;
+            }
+            emit(cg, "    movq    %s, %%xmm0", irx_at(in->args[0]));
+            if (in->imm == IR_NATIVE_SQRT) {
+                emit(cg, "    sqrtsd  %%xmm0, %%xmm0");
+            } else {                                    /* a < b ? a : b, a > b ? a : b */
+                emit(cg, "    movq    %s, %%xmm1", irx_at(in->args[1]));
+                emit(cg, "    %s   %%xmm1, %%xmm0", in->imm == IR_NATIVE_MIN ? "minsd" : "maxsd");
+            }
+            emit(cg, "    movq    %%xmm0, %%rax");
+            break;
+        }
+        bytes = irx_array(cg, in->args, in->nargs);
+        irx_array_ptr(cg, bytes, "rdi");
+        emit(cg, "    movl    $%d, %%esi", in->nargs);
+        emit(cg, "    call    %s", in->sym);
+        irx_release(cg, bytes);
         break;
-
-    case NODE_REFLECT_SET:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[2]);
-        emit(cg, "    movq    %%rax, %%rdx");
-        emit(cg, "    popq    %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_set"));
+    case IR_CALL_METHOD:
+        bytes = irx_array(cg, in->args + 1, in->nargs - 1);
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    leaq    %s(%%rip), %%rsi", intern_string(cg, in->sym));
+        irx_array_ptr(cg, bytes, "rdx");
+        emit(cg, "    movl    $%d, %%ecx", in->nargs - 1);
+        emit(cg, "    call    " XLY_SYM("xly_obj_call"));
+        irx_release(cg, bytes);
         break;
-
-    case NODE_REFLECT_HAS:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    movq    %%rax, %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_has"));
+    case IR_GEN_NEXT:
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    call    " XLY_SYM("xly_for_of_next"));
         break;
-
-    case NODE_REFLECT_DELETE:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    movq    %%rax, %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_delete"));
+    case IR_CALL_VIRT: {
+        /* class instance whose vtable has the selector: call the method
+         * with the receiver in %rdi, omitted params zeroed; anything else
+         * takes the xly_obj_call path */
+        fresh_label(cg, l,  sizeof(l));
+        fresh_label(cg, l2, sizeof(l2));
+        int sel = (int)in->imm;
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    testq   %%rdi, %%rdi");
+        emit(cg, "    je      %s", l);
+        emit(cg, "    cmpl    $10, (%%rdi)");                  /* VAL_INSTANCE */
+        emit(cg, "    jne     %s", l);
+        emit(cg, "    movq    72(%%rdi), %%r11");              /* ->instance   */
+        emit(cg, "    movq    32(%%r11), %%r11");              /* store->cls   */
+        emit(cg, "    testq   %%r11, %%r11");
+        emit(cg, "    je      %s", l);
+        emit(cg, "    cmpq    $%d, 40(%%r11)", sel);           /* cls->nslots  */
+        emit(cg, "    jle     %s", l);
+        emit(cg, "    movq    48(%%r11), %%r11");              /* cls->vtable  */
+        emit(cg, "    movq    %d(%%r11), %%r11", sel * 8);
+        emit(cg, "    testq   %%r11, %%r11");
+        emit(cg, "    je      %s", l);
+        for (int i = 1; i < in->nargs; i++) irx_ld(cg, irx_regs[i], in->args[i]);
+        for (int i = in->nargs; i < 6; i++)
+            emit(cg, "    xorl    %%%s, %%%s", irx_regs32[i], irx_regs32[i]);
+        emit(cg, "    call    *%%r11");
+        emit(cg, "    jmp     %s", l2);
+        emit(cg, "%s:", l);
+        bytes = irx_array(cg, in->args + 1, in->nargs - 1);
+        emit(cg, "    leaq    %s(%%rip), %%rsi", intern_string(cg, in->sym));
+        irx_array_ptr(cg, bytes, "rdx");
+        emit(cg, "    movl    $%d, %%ecx", in->nargs - 1);
+        emit(cg, "    call    " XLY_SYM("xly_obj_call"));
+        irx_release(cg, bytes);
+        emit(cg, "%s:", l2);
         break;
+    }
+    case IR_PRINT:
+        bytes = irx_array(cg, in->args, in->nargs);
+        emit(cg, "    movq    %%rsp, %%rdi");
+        emit(cg, "    movl    $%d, %%esi", in->nargs);
+        emit(cg, "    call    " XLY_SYM("xly_print"));
+        irx_release(cg, bytes);
+        return;
+    case IR_YIELD:
+        irx_ld(cg, "rdi", in->args[0]);
+        emit(cg, "    call    " XLY_SYM("xly_gen_yield"));
+        return;
 
-    case NODE_REFLECT_FREEZE:
-        if (node->child_count > 0) emit_expr(cg, node->children[0]);
-        emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_freeze"));
-        break;
+    case IR_MATCH_FAIL:
+        emit(cg, "    movl    $%d, %%edi", (int)in->imm);
+        emit(cg, "    call    " XLY_SYM("xly_match_fail"));
+        return;
+    case IR_PROF_COUNT:
+        emit(cg, "    lock incq %s%s(%%rip)", in->sym, in->imm ? "+8" : "");
+        return;
+    case IR_SAFEPOINT:
+        emit_safepoint(cg);
+        return;
 
-    case NODE_REFLECT_IS_FROZEN:
-        if (node->child_count > 0) emit_expr(cg, node->children[0]);
-        emit(cg, "    movq    %%rax, %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_is_frozen"));
-        break;
+    case IR_JMP:
+        irx_edge(cg, fr, seq, in->block, in->target[0], next);
+        return;
+    case IR_SWITCH:
+        irx_switch(cg, seq, in);
+        return;
+    case IR_BR:
+        irx_label(cg, seq, in->target[0], l,  sizeof(l));
+        irx_label(cg, seq, in->target[1], l2, sizeof(l2));
+        emit(cg, "    cmpq    $0, %s", irx_at(in->args[0]));
+        if (in->target[0] == next) {
+            emit(cg, "    je      %s", l2);
+        } else {
+            emit(cg, "    jne     %s", l);
+            if (in->target[1] != next) emit(cg, "    jmp     %s", l2);
+        }
+        return;
+    case IR_RET:
+        if (in->nargs > 0 && irx_tail_jump(in->args[0]))
+            return;                                     /* the callee returns */
+        if (in->nargs > 0 && f->num_abi)
+            emit(cg, "    movq    %s, %%xmm0", irx_at(in->args[0]));
+        else if (in->nargs > 0)
+            irx_ld(cg, "rax", in->args[0]);
+        irx_epilogue(cg, f, fr);
+        return;
+    case IR_UNREACHABLE:
+        emit(cg, "    ud2");
+        return;
+    default:
+        return;
+    }
+    if (in->type != IRT_VOID)
+        emit(cg, "    movq    %%rax, %s", irx_at(in));
+}
 
-    case NODE_REFLECT_DEFINE:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[1]);
-        emit(cg, "    pushq   %%rax");
-        emit_expr(cg, node->children[2]);
-        emit(cg, "    movq    %%rax, %%rdx");
-        emit(cg, "    popq    %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_define"));
-        break;
+/* Emit `f` as the body following its label: prologue, param spills, blocks. */
+static void irx_emit_func(CG *cg, IRFunc *f) {
+    IRFrame fr;
+    int nreg = 6 - (f->ncaptures > 0 ? 1 : 0);
+    ir_frame_layout(cg, f, nreg, IRX_NSAVED, &fr);
+    int seq = cg->label_seq++;
 
-    case NODE_REFLECT_APPLY:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        if (node->child_count > 2) emit_expr(cg, node->children[2]);
-        else emit(cg, "    call    " XLY_SYM("xly_null"));
-        emit(cg, "    movq    %%rax, %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_apply"));
-        break;
+    emit(cg, "    pushq   %%rbp");
+    emit(cg, "    movq    %%rsp, %%rbp");
+    if (fr.bytes) emit(cg, "    subq    $%d, %%rsp", fr.bytes);
+    for (int i = 0; i < fr.nsaved; i++)
+        emit(cg, "    movq    %%%s, %d(%%rbp)", irx_saved[i], fr.save_slot - 8 * i);
+    int r = 0;
+    if (f->ncaptures > 0)
+        emit(cg, "    movq    %%%s, %d(%%rbp)", irx_regs[r++], fr.env_slot);
+
+    /* params: into their register or slot; stack-passed ones that were
+     * given a register are loaded from the caller's frame */
+    for (int bi = 0; bi < f->nblocks; bi++)
+    for (int i = 0; i < f->blocks[bi]->nins; i++) {
+        IRInstr *p = f->blocks[bi]->ins[i];
+        if (p->op != IR_PARAM) continue;
+        int k = (int)p->imm;
+        const char *to = irx_at(p);
+        if (k >= nreg) {
+            if (p->reg >= 0) emit(cg, "    movq    %d(%%rbp), %s", p->slot, to);
+        } else if (f->num_abi) {
+            emit(cg, "    movq    %%xmm%d, %s", k, to);
+        } else {
+            emit(cg, "    movq    %%%s, %s", irx_regs[r + k], to);
+        }
+    }
+    if (fr.ncells) {
+        emit(cg, "    xorl    %%eax, %%eax");
+        for (int off = 0; off < fr.ncells * IR_CELL_BYTES; off += 8)
+            emit(cg, "    movq    %%rax, %d(%%rbp)", fr.cells + off);
+        for (int c = 0; c < fr.ncells; c++)         /* refcount = XLY_NOT_HEAP */
+            emit(cg, "    movl    $-1, %d(%%rbp)", fr.cells + c * IR_CELL_BYTES + 36);
+    }
 
-    case NODE_REFLECT_CONSTRUCT:
-        emit_expr(cg, node->children[0]);
-        emit(cg, "    pushq   %%rax");
-        if (node->child_count > 1) emit_expr(cg, node->children[1]);
-        else emit(cg, "    call    " XLY_SYM("xly_null"));
-        emit(cg, "    movq    %%rax, %%rsi");
-        emit(cg, "    popq    %%rdi");
-        emit(cg, "    call    " XLY_SYM("xly_reflect_construct"));
-        break;
+    /* blocks the profile never reached go to the cold section, after the
+     * rest; a fall-through only ever targets the next block of its group.
+     * Jump tables hold section-relative offsets, so a switch keeps its
+     * function in one piece.                                             */
+    int ncold = cg->fn_cold ? 0 : ir_mark_cold(f);
+    for (int bi = 0; bi < f->nblocks && ncold; bi++) {
+        IRBlock *b = f->blocks[bi];
+        if (b->nins && b->ins[b->nins - 1]->op == IR_SWITCH) ncold = 0;
+    }
+    int split = ncold > 0;
+    cg->stat_cold_blocks += ncold;
+    for (int cold = 0; cold <= split; cold++) {
+        if (cold) emit(cg, "    " XLY_COLD_SECTION);
+        for (int bi = 0; bi < f->nblocks; bi++) {
+            IRBlock *b = f->blocks[bi];
+            if (split && b->cold != cold) continue;
+            IRBlock *next = NULL;
+            for (int ni = bi + 1; ni < f->nblocks && !next; ni++)
+                if (!split || f->blocks[ni]->cold == cold) next = f->blocks[ni];
+            if (bi > 0) {
+                char l[64];
+                irx_label(cg, seq, b, l, sizeof(l));
+                emit(cg, "%s:", l);
+            }
+            for (int i = 0; i < b->nins; i++)
+                irx_instr(cg, f, &fr, seq, b->ins[i], next);
+        }
+        if (cold) emit(cg, "    " XLY_TEXT_SECTION);
+    }
+    ir_emit_const_boxes(cg, f, seq);
+}
 
-    /* ── Block fn: desugar to anonymous function (x86-64) ───────────────── */
-    case NODE_BLOCK_FN:
-        emit_expr(cg, node);
-        break;
+/* Boxed entry of a function with a raw-f64 body: when every argument is
+ * a number, unbox them, call the raw body and box its result.            */
+static void irx_num_forward(CG *cg, int fi) {
+    int n = (int)cg->funcs[fi].node->param_count;
+    char boxed[64];
+    fresh_label(cg, boxed, sizeof(boxed));
+    for (int i = 0; i < n; i++) {
+        emit(cg, "    testq   %%%s, %%%s", irx_regs[i], irx_regs[i]);
+        emit(cg, "    je      %s", boxed);
+        emit(cg, "    cmpl    $0, (%%%s)", irx_regs[i]);
+        emit(cg, "    jne     %s", boxed);
+    }
+    for (int i = 0; i < n; i++)
+        emit(cg, "    movsd   8(%%%s), %%xmm%d", irx_regs[i], i);
+    emit(cg, "    pushq   %%rbp");
+    emit(cg, "    movq    %%rsp, %%rbp");
+    emit(cg, "    call    .Lxly_fn_%s__num", cg->funcs[fi].asm_label);
+    emit(cg, "    call    " XLY_SYM("xly_num"));
+    emit(cg, "    popq    %%rbp");
+    emit(cg, "    ret");
+    emit(cg, "%s:", boxed);
+}
 
-    /* ── everything else — try as expression ─────────────────────── */
+/* Emit funcs[fi] through the IR if its body can be lowered. */
+static int emit_function_ir(CG *cg, int fi) {
+    IRFunc *f = ir_lower_in_ctx(cg, fi, 0, 0);
+    if (!f) {
+        if (g_ir_dump)
+            fprintf(g_ir_dump, "; fn %s: not lowered (uses constructs the IR does not cover)\n\n",
+                    cg->funcs[fi].asm_label);
+        cg->stat_ir_fallback++;
+        return 0;
+    }
+    ir_finish(cg, f, 0);
+    emit(cg, "");
+    cg->fn_cold = prof_fn_cold(cg, fi);
+    if (cg->fn_cold) {
+        emit(cg, "    " XLY_COLD_SECTION);
+        cg->stat_cold_fns++;
+    }
+    emit_fn_label(cg, cg->funcs[fi].node, f->name);
+    if (cg->funcs[fi].num_entry) irx_num_forward(cg, fi);
+    irx_emit_func(cg, f);
+    ir_func_free(f);
+    if (cg->funcs[fi].num_entry && (f = ir_lower_in_ctx(cg, fi, 0, 1))) {
+        ir_finish(cg, f, 0);
+        emit(cg, "");
+        emit(cg, ".Lxly_fn_%s__num:", f->name);
+        irx_emit_func(cg, f);
+        ir_func_free(f);
+        cg->stat_ir_num_entries++;
+    }
+    if (cg->fn_cold) emit(cg, "    " XLY_TEXT_SECTION);
+    cg->fn_cold = 0;
+    cg->stat_ir_lowered++;
+    return 1;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * x86-64: function bodies in parallel
+ *
+ * After main, funcs[] is emitted in waves: the bodies stashed so far are
+ * emitted side by side on up to g_jobs threads, then the nested functions
+ * they stashed form the next wave.  A body never writes shared state:
+ *
+ *   • its worker has private copies of the tables a body can grow (funcs,
+ *     fn labels, fn names, strings); what the body added is handed back
+ *   • labels are numbered per body ("f<K>_" prefix, see label_pfx) and so
+ *     are nested function labels ("<name>__f<K>", fn_unique_label)
+ *   • string labels hash their text (intern_string)
+ *   • the globals a body may declare are declared ahead of the wave
+ *
+ * Each body is written to its own buffer; the buffers and the table
+ * additions are merged in funcs[] order, the order a single thread emits
+ * them in, so the output is the same for any number of threads.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct {
+    char     *text;                 /* the body's assembly                  */
+    size_t    len;
+    CGFunc   *funcs;    int nfuncs; /* nested functions it stashed          */
+    char    **labels;   int nlabels;
+    char    **names;    int nnames;
+    CGString *strings;  int nstrings;
+    CGString *sites;    int nsites; /* profile counters it uses            */
+    CGString *atoms;    int natoms; /* property name slots                 */
+    int       stat_const_fold, stat_noreturn_elim, stat_sys_inline,
+              stat_native_calls, stat_unboxed_ops, stat_jump_tables,
+              stat_ir_lowered, stat_ir_fallback, stat_ir_num_entries,
+              stat_cold_blocks, stat_cold_fns;
+    int       had_error;
+} BodyOut;
+
+typedef struct {
+    CG             *cg;             /* read-only while the wave runs        */
+    int             lo, hi;         /* funcs[lo..hi) */
+    int             next;           /* next body to take, under lock        */
+    pthread_mutex_t lock;
+    BodyOut        *outs;
+} BodyWave;
+
+/* Globals a body declares when emitted (generators, parameterless enum
+ * variants), in source order; nested bodies are left to their own wave. */
+static void body_declare_globals(CG *cg, ASTNode *n) {
+    if (!n) return;
+    switch (n->type) {
+    case NODE_FN_DECL: case NODE_ARROW_FN: case NODE_CLASS_DECL: case NODE_BLOCK_FN:
+        return;
+    case NODE_GEN_DECL:
+        if (n->str_value) gvar_declare(cg, n->str_value);
+        return;
+    case NODE_ENUM_DECL:
+        for (size_t i = 0; i < n->child_count; i++) {
+            ASTNode *vn = n->children[i];
+            if (vn && vn->str_value && vn->param_count == 0) gvar_declare(cg, vn->str_value);
+        }
+        return;
     default:
-        emit_expr(cg, node);
         break;
     }
+    for (size_t i = 0; i < n->child_count; i++)
+        body_declare_globals(cg, n->children[i]);
 }
 
-/* ── emit a user-defined function ──────────────────────────────────────── */
-static void emit_function(CG *cg, ASTNode *fn, const char *asm_label,
-                          FnRename *rename_ctx, int rename_ctx_count,
-                          char **captures, int ncaptures) {
-    size_t      nparams = fn->param_count;
-    ASTNode    *body    = fn->children[0];   /* NODE_BLOCK */
-
-    /* save codegen frame state — clear var table so main() vars don't leak in */
-    int sv_vc = cg->var_count, sv_fo = cg->frame_offset, sv_sd = cg->scope_depth;
-    int sv_nm = cg->noreturn_mode;
-    int sv_rename = cg->fn_rename_count;   /* save rename scope for nested fns */
-    cg->scope_depth  = 0;
-    cg->frame_offset = 0;
-    cg->var_count    = 0;   /* hide main() vars: functions have their own scope */
-    cg->noreturn_mode = 0;
+/* A worker's view of cg: shared read-only tables, private growable ones. */
+static void body_worker_init(CG *w, const CG *cg) {
+    *w = *cg;
+    w->out = NULL;
+    w->funcs = malloc(sizeof(CGFunc) * (size_t)(cg->func_count + 16));
+    memcpy(w->funcs, cg->funcs, sizeof(CGFunc) * (size_t)cg->func_count);
+    w->func_cap = cg->func_count + 16;
+    w->fn_labels_used = malloc(sizeof(w->fn_labels_used[0]) * (size_t)(cg->fn_labels_used_count + 16));
+    memcpy(w->fn_labels_used, cg->fn_labels_used,
+           sizeof(w->fn_labels_used[0]) * (size_t)cg->fn_labels_used_count);
+    w->fn_labels_used_cap = cg->fn_labels_used_count + 16;
+    w->fn_names = malloc(sizeof(char *) * (size_t)(cg->fn_name_count + 16));
+    memcpy(w->fn_names, cg->fn_names, sizeof(char *) * (size_t)cg->fn_name_count);
+    w->fn_name_cap = cg->fn_name_count + 16;
+    w->strings = malloc(sizeof(CGString) * (size_t)(cg->str_count + 16));
+    memcpy(w->strings, cg->strings, sizeof(CGString) * (size_t)cg->str_count);
+    w->str_cap = cg->str_count + 16;
+    w->atoms = malloc(sizeof(CGString) * (size_t)(cg->atom_count + 16));
+    memcpy(w->atoms, cg->atoms, sizeof(CGString) * (size_t)cg->atom_count);
+    w->atom_cap = cg->atom_count + 16;
+    w->fn_renames = malloc(sizeof(FnRename) * (size_t)(cg->fn_rename_count + 16));
+    memcpy(w->fn_renames, cg->fn_renames, sizeof(FnRename) * (size_t)cg->fn_rename_count);
+    w->fn_rename_cap = cg->fn_rename_count + 16;
+    w->prof_sites = malloc(sizeof(CGString) * (size_t)(cg->prof_site_count + 16));
+    memcpy(w->prof_sites, cg->prof_sites, sizeof(CGString) * (size_t)cg->prof_site_count);
+    w->prof_site_cap = cg->prof_site_count + 16;
+    w->gvars = malloc(sizeof(w->gvars[0]) * (size_t)(cg->gvar_count + 16));
+    memcpy(w->gvars, cg->gvars, sizeof(w->gvars[0]) * (size_t)cg->gvar_count);
+    w->gvar_cap = cg->gvar_count + 16;
+    cgidx_copy(&w->func_idx, &cg->func_idx);
+    cgidx_copy(&w->fn_label_idx, &cg->fn_label_idx);
+    cgidx_copy(&w->fn_name_idx, &cg->fn_name_idx);
+    cgidx_copy(&w->str_idx, &cg->str_idx);
+    cgidx_copy(&w->atom_idx, &cg->atom_idx);
+    cgidx_copy(&w->fn_rename_idx, &cg->fn_rename_idx);
+    cgidx_copy(&w->prof_site_idx, &cg->prof_site_idx);
+    cgidx_copy(&w->gvar_idx, &cg->gvar_idx);
+    w->vars = NULL;       w->var_count = w->var_cap = 0;
+    memset(&w->var_idx, 0, sizeof(w->var_idx));
+    w->brk_labels = NULL; w->brk_top = 0;
+    w->cnt_labels = NULL; w->cnt_top = 0;
+}
 
-    /* Restore the rename context that was visible when this fn was declared.
-     * This makes sibling/peer inner function names resolvable inside the body. */
-    fn_rename_ctx_restore(cg, rename_ctx, rename_ctx_count);
+/* The entries are the shared ones (additions were handed back): free the
+ * arrays only. */
+static void body_worker_free(CG *w) {
+    free(w->funcs);
+    free(w->fn_labels_used);
+    free(w->fn_names);
+    free(w->strings);
+    free(w->atoms);
+    free(w->fn_renames);
+    free(w->prof_sites);
+    free(w->gvars);
+    free(w->vars);
+    cg_indexes_free(w);
+    free(w->brk_labels);
+    free(w->cnt_labels);
+}
 
-    /* frame size: params + captures + locals + generous padding, 16-aligned */
-    int n = (int)nparams + ncaptures + count_locals(body) + 32;
-    int frame = (n * 8 + 15) & ~15;
+/* Entries [from, *count) of a worker table move to a fresh array. */
+#define BODY_TAKE(dst, ndst, src, count, from) do {                            \
+        (ndst) = (count) - (from);                                            \
+        (dst)  = NULL;                                                        \
+        if ((ndst) > 0) {                                                     \
+            (dst) = malloc(sizeof((dst)[0]) * (size_t)(ndst));                \
+            memcpy((dst), (src) + (from), sizeof((dst)[0]) * (size_t)(ndst)); \
+        }                                                                     \
+        (count) = (from);                                                     \
+    } while (0)
+
+static void body_emit(CG *w, int fi, BodyOut *o) {
+    int nf = w->func_count, nl = w->fn_labels_used_count, nn = w->fn_name_count;
+    int ns = w->str_count, np = w->prof_site_count, ng = w->gvar_count;
+    int na = w->atom_count;
+
+    FILE *mem = open_memstream(&o->text, &o->len);
+    if (!mem) { perror("codegen: open_memstream"); o->had_error = 1; return; }
+    w->out       = mem;
+    w->label_seq = 0;
+    w->body_fi   = fi;
+    snprintf(w->label_pfx, sizeof(w->label_pfx), "f%d_", fi);
+    w->had_error = 0;
+    w->stat_const_fold = w->stat_noreturn_elim = w->stat_sys_inline = 0;
+    w->stat_native_calls = 0;
+    w->stat_unboxed_ops = w->stat_jump_tables = 0;
+    w->stat_ir_lowered = w->stat_ir_fallback = w->stat_ir_num_entries = 0;
+    w->stat_cold_blocks = w->stat_cold_fns = 0;
+
+    if (!emit_function_ir(w, fi)) {
+        w->cur_cls = w->funcs[fi].cls;
+        emit_function(w, w->funcs[fi].node, w->funcs[fi].asm_label,
+                      w->funcs[fi].rename_ctx, w->funcs[fi].rename_ctx_count,
+                      w->funcs[fi].captures, w->funcs[fi].ncaptures);
+        w->cur_cls = -1;
+    }
+    fclose(mem);
+    w->out = NULL;
+
+    BODY_TAKE(o->funcs, o->nfuncs, w->funcs, w->func_count, nf);
+    o->nlabels = w->fn_labels_used_count - nl;
+    o->labels  = o->nlabels > 0 ? malloc(sizeof(char *) * (size_t)o->nlabels) : NULL;
+    for (int i = 0; i < o->nlabels; i++) o->labels[i] = w->fn_labels_used[nl + i].lbl;
+    w->fn_labels_used_count = nl;
+    BODY_TAKE(o->names, o->nnames, w->fn_names, w->fn_name_count, nn);
+    BODY_TAKE(o->strings, o->nstrings, w->strings, w->str_count, ns);
+    BODY_TAKE(o->sites, o->nsites, w->prof_sites, w->prof_site_count, np);
+    BODY_TAKE(o->atoms, o->natoms, w->atoms, w->atom_count, na);
+    if (w->gvar_count != ng) {
+        /* body_declare_globals missed a declaration: its slot would clash */
+        fprintf(stderr, "[xenlyc] internal error: global declared in body of %s\n",
+                w->funcs[fi].asm_label);
+        while (w->gvar_count > ng) free(w->gvars[--w->gvar_count].name);
+        w->had_error = 1;
+    }
 
-    emit(cg, "");
-    emit(cg, ".Lxly_fn_%s:", asm_label);
-    emit(cg, "    pushq   %%rbp");
-    emit(cg, "    movq    %%rsp, %%rbp");
-    emit(cg, "    subq    $%d, %%rsp", frame);
+    o->stat_const_fold     = w->stat_const_fold;
+    o->stat_noreturn_elim  = w->stat_noreturn_elim;
+    o->stat_sys_inline     = w->stat_sys_inline;
+    o->stat_native_calls   = w->stat_native_calls;
+    o->stat_unboxed_ops    = w->stat_unboxed_ops;
+    o->stat_jump_tables    = w->stat_jump_tables;
+    o->stat_ir_lowered     = w->stat_ir_lowered;
+    o->stat_ir_fallback    = w->stat_ir_fallback;
+    o->stat_ir_num_entries = w->stat_ir_num_entries;
+    o->stat_cold_blocks    = w->stat_cold_blocks;
+    o->stat_cold_fns       = w->stat_cold_fns;
+    o->had_error           = w->had_error;
+}
 
-    /* For closures: hidden first arg is XlyVal** __env (in %rdi).
-     * Explicit params are shifted: param[0] → %rsi, param[1] → %rdx, etc.
-     * We load captured variables from __env[0..ncaptures-1] into stack slots. */
-    static const char *pregs[] = {"rdi","rsi","rdx","rcx","r8","r9"};
-    int param_reg_start = ncaptures > 0 ? 1 : 0; /* shift if closure */
+static void *body_worker(void *arg) {
+    BodyWave *wv = (BodyWave *)arg;
+    CG w;
+    body_worker_init(&w, wv->cg);
+    for (;;) {
+        pthread_mutex_lock(&wv->lock);
+        int fi = wv->next++;
+        pthread_mutex_unlock(&wv->lock);
+        if (fi >= wv->hi) break;
+        body_emit(&w, fi, &wv->outs[fi - wv->lo]);
+    }
+    body_worker_free(&w);
+    return NULL;
+}
 
-    if (ncaptures > 0) {
-        /* Spill __env ptr (rdi) into a temporary stack slot, then load captures */
-        int env_slot = var_declare(cg, "__env");
-        emit(cg, "    movq    %%rdi, %d(%%rbp)", env_slot);
-        for (int i = 0; i < ncaptures; i++) {
-            int cslot = var_declare(cg, captures[i]);
-            emit(cg, "    movq    %d(%%rbp), %%rax", env_slot); /* __env ptr */
-            emit(cg, "    movq    %d(%%rax), %%rax", i * 8);    /* env[i] */
-            emit(cg, "    movq    %%rax, %d(%%rbp)", cslot);    /* store capture */
+/* Add the entries a body interned to a table of cg; two bodies interning
+ * the same text agree on its label, so those are dropped.              */
+static void body_merge_strings(CG *cg, CGString **tab, int *count, int *cap, CGIndex *ix,
+                               CGString *add, int nadd) {
+    for (int i = 0; i < nadd; i++) {
+        CGString *str = &add[i];
+        int k = cgidx_find(ix, CG_KEYS(*tab, *count, offsetof(CGString, label)), str->label);
+        if (k >= 0) {
+            if (strcmp((*tab)[k].text, str->text) != 0) {
+                fprintf(stderr, "[xenlyc] error: string label collision (%s)\n", str->label);
+                cg->had_error = 1;
+            }
+            free(str->text);
+            free(str->label);
+            continue;
+        }
+        if (*count >= *cap) {
+            *cap = *cap ? *cap * 2 : 32;
+            *tab = realloc(*tab, sizeof(CGString) * (size_t)*cap);
         }
+        (*tab)[(*count)++] = *str;
+        cgidx_add(ix, CG_KEYS(*tab, *count, offsetof(CGString, label)), *count - 1);
     }
+    free(add);
+}
 
-    /* spill incoming SysV register args into stack slots.
-     * For closures param_reg_start=1 (rdi=env), so register params cap at
-     * reg index 5, meaning up to (6 - param_reg_start) params in registers. */
-    int nreg_params = 6 - param_reg_start;  /* how many params fit in regs */
-    for (size_t i = 0; i < nparams; i++) {
-        int off = var_declare(cg, fn->params[i].name);
-        int reg_idx = (int)i + param_reg_start;
-        if (reg_idx < 6) {
-            /* Register-passed arg */
-            emit(cg, "    movq    %%%s, %d(%%rbp)", pregs[reg_idx], off);
-        } else {
-            /* Stack-passed arg: [rbp+16] for param nreg_params,
-             * [rbp+24] for param nreg_params+1, etc.
-             * (rbp+0=saved_rbp, rbp+8=ret_addr, rbp+16=first stack arg) */
-            int stk_slot = (int)(i - (size_t)nreg_params) * 8 + 16;
-            emit(cg, "    movq    %d(%%rbp), %%rax", stk_slot);
-            emit(cg, "    movq    %%rax, %d(%%rbp)", off);
+/* Append what one body produced to cg, as if it had been emitted there. */
+static void body_merge(CG *cg, BodyOut *o) {
+    if (o->len) fwrite(o->text, 1, o->len, cg->out);
+    free(o->text);
+
+    for (int i = 0; i < o->nfuncs; i++) {
+        if (cg->func_count >= cg->func_cap) {
+            cg->func_cap = cg->func_cap ? cg->func_cap * 2 : 16;
+            cg->funcs    = realloc(cg->funcs, sizeof(cg->funcs[0]) * (size_t)cg->func_cap);
         }
-        
-        /* Handle optional/default parameters */
-        if (fn->params[i].is_optional || fn->params[i].default_value) {
-            char lbl_has_arg[64];
-            fresh_label(cg, lbl_has_arg, sizeof(lbl_has_arg));
-            
-            emit(cg, "    movq    %d(%%rbp), %%rax", off);
-            emit(cg, "    testq   %%rax, %%rax");
-            emit(cg, "    jnz     %s", lbl_has_arg);
-            
-            if (fn->params[i].default_value) {
-                emit_expr(cg, fn->params[i].default_value);
-                emit(cg, "    movq    %%rax, %d(%%rbp)", off);
-            }
-            
-            emit(cg, "%s:", lbl_has_arg);
+        cg->funcs[cg->func_count++] = o->funcs[i];
+        cgidx_add(&cg->func_idx, CG_KEYS(cg->funcs, cg->func_count, offsetof(CGFunc, asm_label)),
+                  cg->func_count - 1);
+    }
+    for (int i = 0; i < o->nlabels; i++) {
+        if (cg->fn_labels_used_count >= cg->fn_labels_used_cap) {
+            cg->fn_labels_used_cap = cg->fn_labels_used_cap ? cg->fn_labels_used_cap * 2 : 16;
+            cg->fn_labels_used = realloc(cg->fn_labels_used,
+                                 sizeof(cg->fn_labels_used[0]) * (size_t)cg->fn_labels_used_cap);
         }
+        cg->fn_labels_used[cg->fn_labels_used_count++].lbl = o->labels[i];
+        cgidx_add(&cg->fn_label_idx, CG_KEYS(cg->fn_labels_used, cg->fn_labels_used_count, 0),
+                  cg->fn_labels_used_count - 1);
     }
-    (void)nreg_params; /* suppress unused-variable warning if nparams==0 */
+    for (int i = 0; i < o->nnames; i++) {
+        if (cg->fn_name_count >= cg->fn_name_cap) {
+            cg->fn_name_cap = cg->fn_name_cap ? cg->fn_name_cap * 2 : 16;
+            cg->fn_names = realloc(cg->fn_names, sizeof(char *) * (size_t)cg->fn_name_cap);
+        }
+        cg->fn_names[cg->fn_name_count++] = o->names[i];
+        cgidx_add(&cg->fn_name_idx, CG_KEYS(cg->fn_names, cg->fn_name_count, 0),
+                  cg->fn_name_count - 1);
+    }
+    body_merge_strings(cg, &cg->strings, &cg->str_count, &cg->str_cap, &cg->str_idx,
+                       o->strings, o->nstrings);
+    body_merge_strings(cg, &cg->prof_sites, &cg->prof_site_count, &cg->prof_site_cap,
+                       &cg->prof_site_idx, o->sites, o->nsites);
+    body_merge_strings(cg, &cg->atoms, &cg->atom_count, &cg->atom_cap, &cg->atom_idx,
+                       o->atoms, o->natoms);
+    free(o->funcs);
+    free(o->labels);
+    free(o->names);
+
+    cg->stat_const_fold     += o->stat_const_fold;
+    cg->stat_noreturn_elim  += o->stat_noreturn_elim;
+    cg->stat_sys_inline     += o->stat_sys_inline;
+    cg->stat_native_calls   += o->stat_native_calls;
+    cg->stat_unboxed_ops    += o->stat_unboxed_ops;
+    cg->stat_jump_tables    += o->stat_jump_tables;
+    cg->stat_ir_lowered     += o->stat_ir_lowered;
+    cg->stat_ir_fallback    += o->stat_ir_fallback;
+    cg->stat_ir_num_entries += o->stat_ir_num_entries;
+    cg->stat_cold_blocks    += o->stat_cold_blocks;
+    cg->stat_cold_fns       += o->stat_cold_fns;
+    cg->had_error           |= o->had_error;
+}
 
-    /* body */
-    scope_enter(cg);
-    for (size_t i = 0; i < body->child_count; i++)
-        emit_stmt(cg, body->children[i]);
-    scope_leave(cg);
+/* Bodies per thread below which another thread is not worth starting */
+#define BODY_MIN_PER_THREAD 16
 
-    /* implicit return null */
-    emit(cg, "    call    " XLY_SYM("xly_null"));
-    emit(cg, "    movq    %%rbp, %%rsp");
-    emit(cg, "    popq    %%rbp");
-    emit(cg, "    ret");
+static void emit_bodies(CG *cg) {
+    int jobs = g_jobs > 0 ? g_jobs : (int)xly_cpu_count();
+    if (g_ir_dump || cg->verbose) jobs = 1;  /* keep per-fn diagnostics in order */
 
-    /* restore codegen state */
-    while (cg->var_count > sv_vc) { cg->var_count--; free(cg->vars[cg->var_count].name); }
-    cg->frame_offset  = sv_fo;
-    cg->scope_depth   = sv_sd;
-    cg->noreturn_mode = sv_nm;
-    cg->frame_offset = sv_fo;
-    cg->scope_depth  = sv_sd;
-    fn_renames_pop_to(cg, sv_rename);  /* pop renames pushed by nested fn decls */
+    for (int lo = 0; lo < cg->func_count; ) {
+        int hi = cg->func_count;
+        for (int i = lo; i < hi; i++) {
+            ASTNode *fn = cg->funcs[i].node;
+            for (size_t k = 0; k < fn->param_count; k++)
+                body_declare_globals(cg, fn->params[k].default_value);
+            if (fn->child_count > 0) body_declare_globals(cg, fn->children[0]);
+        }
+
+        BodyWave wv;
+        wv.cg   = cg;
+        wv.lo   = lo;
+        wv.hi   = hi;
+        wv.next = lo;
+        wv.outs = calloc((size_t)(hi - lo), sizeof(BodyOut));
+        pthread_mutex_init(&wv.lock, NULL);
+
+        int nthreads = (hi - lo) / BODY_MIN_PER_THREAD;
+        if (nthreads > jobs) nthreads = jobs;
+        if (nthreads < 1)    nthreads = 1;
+        pthread_t *tids = malloc(sizeof(pthread_t) * (size_t)nthreads);
+        int started = 0;
+        for (int t = 1; t < nthreads; t++)
+            if (pthread_create(&tids[started], NULL, body_worker, &wv) == 0) started++;
+        body_worker(&wv);                   /* this thread works too */
+        for (int t = 0; t < started; t++) pthread_join(tids[t], NULL);
+        free(tids);
+        pthread_mutex_destroy(&wv.lock);
+
+        for (int i = lo; i < hi; i++) body_merge(cg, &wv.outs[i - lo]);
+        free(wv.outs);
+        lo = hi;
+    }
+}
+
+/* --profile-generate: the XlyProfTable main registers (xly_rt.h), one
+ * site per counter label the bodies used.                              */
+static void emit_prof_table(CG *cg) {
+    emit(cg, "");
+#if defined(__APPLE__)
+    emit(cg, ".section __DATA,__data");
+#else
+    emit(cg, ".section .data");
+#endif
+    emit(cg, ".balign 8");
+    emit(cg, ".Lxly_prof_table:");
+    emit(cg, "    .quad   %d", cg->prof_site_count);
+    for (int i = 0; i < cg->prof_site_count; i++) {
+        emit(cg, "%s:", cg->prof_sites[i].label);
+        emit(cg, "    .quad   0");
+        emit(cg, "    .quad   0");
+        emit(cg, "    .quad   %s", intern_string(cg, cg->prof_sites[i].text));
+    }
 }
 
 /* ── x86-64 public entry (called by the dispatch codegen() below) ───────── */
 /* g_opt_level / g_verbose_asm are declared above, outside all arch #ifdefs */
-static int codegen_x86_64(ASTNode *program, const char *outpath) {
+static int codegen_x86_64(ASTNode *program, FILE *out) {
     CG cg;
     memset(&cg, 0, sizeof(cg));
-    cg.out       = fopen(outpath, "w");
-    if (!cg.out) { perror("codegen: fopen"); return 1; }
+    cg.out       = out;
     cg.opt_level = g_opt_level;
     cg.verbose   = g_verbose_asm;
+    cg.cur_cls   = -1;
+    cg.body_fi   = -1;
+    cg.unit      = g_unit;
+    cg.prof_gen  = g_prof_gen != NULL;
 
     if (cg.verbose)
         emit(&cg, "    # xenlyc v0.1.0  opt=%d  arch=x86-64  abi=sysv", cg.opt_level);
 
     /* pre-pass: collect all declared function names for call-site dispatch */
+    cg.program = program;
+    unit_unwrap_exports(&cg, program);
     collect_fn_names(&cg, program);
+    collect_unit_imports(&cg, program);
     collect_variant_names(&cg, program);
+    collect_classes(&cg, program);
+    if (cg.opt_level >= 2) collect_call_sites(&cg, program);
 
     /* main frame: generous */
     /* Frame = locals × 8 + 512 bytes of spill headroom.
@@ -1974,6 +6376,19 @@ static int codegen_x86_64(ASTNode *program, const char *outpath) {
     int mframe = (n_top * 8 + 15) & ~15;
 
     emit(&cg, XLY_TEXT_SECTION);
+    if (cg.unit) {
+        /* a module unit: its top level is the run-once initializer */
+        emit(&cg, ".globl  " XLY_SYM("xlym_%s"), cg.unit);
+        emit(&cg, XLY_SYM("xlym_%s") ":", cg.unit);
+        emit(&cg, "    movq    .Lxly_unit_done(%%rip), %%rax");
+        emit(&cg, "    testq   %%rax, %%rax");
+        emit(&cg, "    je      .Lxly_unit_run");
+        emit(&cg, "    ret");
+        emit(&cg, ".Lxly_unit_run:");
+        emit(&cg, "    movl    $1, %%eax");
+        emit(&cg, "    movq    %%rax, .Lxly_unit_done(%%rip)");
+        goto x86_top_level;
+    }
     emit(&cg, ".globl  " XLY_SYM("main"));
 #if XLY_EMIT_GNU_STACK
     /* Linux/ELF: _start is the true kernel entry point.  The kernel jumps
@@ -1988,26 +6403,72 @@ static int codegen_x86_64(ASTNode *program, const char *outpath) {
     emit(&cg, "    subq    $8, %%rsp");     /* simulate return-address push */
 #endif
     emit(&cg, XLY_SYM("main") ":");
-    emit(&cg, "    pushq   %%rbp");
-    emit(&cg, "    movq    %%rsp, %%rbp");
-    emit(&cg, "    subq    $%d, %%rsp", mframe);
 
-    cg.in_main_scope = 1;
-    for (size_t i = 0; i < program->child_count; i++)
-        emit_stmt(&cg, program->children[i]);
-    cg.in_main_scope = 0;
+x86_top_level:;
+    emit(&cg, "    subq    $8, %%rsp");
+    if (cg.prof_gen) {
+        /* hand the counters to the runtime, which writes them out at exit */
+        emit(&cg, "    leaq    %s(%%rip), %%rdi", intern_string(&cg, g_prof_gen));
+        emit(&cg, "    leaq    .Lxly_prof_table(%%rip), %%rsi");
+        emit(&cg, "    call    " XLY_SYM("xly_prof_register"));
+    }
+    /* the collector's roots: the globals (their count is only known at the
+     * end, see .Lxly_gvar_count) and, for main, the stack above its frame */
+    emit(&cg, "    leaq    " XLY_SYM("__xly_globals") "(%%rip), %%rdi");
+    emit(&cg, "    movq    .Lxly_gvar_count(%%rip), %%rsi");
+    if (cg.unit) emit(&cg, "    xorl    %%edx, %%edx");
+    else         emit(&cg, "    leaq    8(%%rsp), %%rdx");
+    emit(&cg, "    call    " XLY_SYM("xly_gc_roots"));
+    /* property names and class fields to atoms, see emit_atom_table */
+    emit(&cg, "    leaq    .Lxly_atoms(%%rip), %%rdi");
+    emit(&cg, "    movq    .Lxly_atom_count(%%rip), %%rsi");
+    emit(&cg, "    call    " XLY_SYM("xly_atoms"));
+    for (int ci = 0; ci < cg.class_count; ci++) {
+        if (cg.classes[ci].nfields == 0) continue;
+        emit(&cg, "    leaq    .Lxly_class_%d_fields(%%rip), %%rdi", ci);
+        emit(&cg, "    movl    $%d, %%esi", cg.classes[ci].nfields);
+        emit(&cg, "    call    " XLY_SYM("xly_atoms"));
+    }
+    emit(&cg, "    addq    $8, %%rsp");
+    IRFunc *mainf = ir_lower_main(&cg, program, 0);
+    if (mainf) {
+        ir_plan_num_entries(&cg, 0);
+        ir_finish(&cg, mainf, 0);
+        irx_emit_func(&cg, mainf);
+        ir_func_free(mainf);
+        cg.stat_ir_lowered++;
+    } else {
+        if (g_ir_dump)
+            fprintf(g_ir_dump, "; fn main: not lowered (uses constructs the IR does not cover)\n\n");
+        cg.stat_ir_fallback++;
+        emit(&cg, "    pushq   %%rbp");
+        emit(&cg, "    movq    %%rsp, %%rbp");
+        emit(&cg, "    subq    $%d, %%rsp", mframe);
+
+        cg.in_main_scope = 1;
+        for (size_t i = 0; i < program->child_count; i++)
+            emit_stmt(&cg, program->children[i]);
+        cg.in_main_scope = 0;
+
+        if (!cg.unit) {
+            emit(&cg, "    movl    $0, %%edi");
+            emit(&cg, "    call    " XLY_SYM("xly_exit"));
+        }
+        emit(&cg, "    movq    %%rbp, %%rsp");
+        emit(&cg, "    popq    %%rbp");
+        emit(&cg, "    ret");
+    }
 
-    emit(&cg, "    movl    $0, %%edi");
-    emit(&cg, "    call    " XLY_SYM("xly_exit"));
-    emit(&cg, "    movq    %%rbp, %%rsp");
-    emit(&cg, "    popq    %%rbp");
-    emit(&cg, "    ret");
+    /* user functions: through the IR when the body allows it, several at
+     * a time (emit_bodies).  Bodies may stash nested functions, so funcs[]
+     * grows meanwhile. */
+    ir_plan_num_entries(&cg, 0);
+    emit_bodies(&cg);
 
-    /* user functions */
-    for (int i = 0; i < cg.func_count; i++)
-        emit_function(&cg, cg.funcs[i].node, cg.funcs[i].asm_label,
-                      cg.funcs[i].rename_ctx, cg.funcs[i].rename_ctx_count,
-                      cg.funcs[i].captures, cg.funcs[i].ncaptures);
+    emit_class_tables(&cg);
+    emit_atom_table(&cg);
+    emit_unit_stubs(&cg);
+    if (cg.prof_gen) emit_prof_table(&cg);
 
     /* .rodata */
     emit(&cg, "");
@@ -2044,18 +6505,38 @@ static int codegen_x86_64(ASTNode *program, const char *outpath) {
 #endif
 
     /* Global variable storage: __xly_globals[N] = array of XlyVal* pointers.
-     * Initialised to zero (BSS); filled at runtime by main().              */
-    if (cg.gvar_count > 0) {
+     * Initialised to zero (BSS); filled at runtime by main().  Always
+     * emitted: main registers it with the collector.                     */
+    emit(&cg, "");
+#if defined(__APPLE__)
+    emit(&cg, ".section __DATA,__const");
+#else
+    emit(&cg, ".section .rodata");
+#endif
+    emit(&cg, ".balign 8");
+    emit(&cg, ".Lxly_gvar_count:");
+    emit(&cg, "    .quad   %d", cg.gvar_count);
+    emit(&cg, "");
+#if defined(__APPLE__)
+    emit(&cg, ".section __DATA,__bss");
+#else
+    emit(&cg, ".section .bss");
+#endif
+    if (!cg.unit)           /* each unit keeps its own, local to the object */
+        emit(&cg, ".globl  " XLY_SYM("__xly_globals"));
+    emit(&cg, ".balign 8");
+    emit(&cg, XLY_SYM("__xly_globals") ":");
+    emit(&cg, "    .zero   %d", (cg.gvar_count ? cg.gvar_count : 1) * 8);
+    if (cg.unit) {
         emit(&cg, "");
 #if defined(__APPLE__)
         emit(&cg, ".section __DATA,__bss");
 #else
         emit(&cg, ".section .bss");
 #endif
-        emit(&cg, ".globl  " XLY_SYM("__xly_globals"));
         emit(&cg, ".balign 8");
-        emit(&cg, XLY_SYM("__xly_globals") ":");
-        emit(&cg, "    .zero   %d", cg.gvar_count * 8);
+        emit(&cg, ".Lxly_unit_done:");
+        emit(&cg, "    .zero   8");
     }
 
     /* Emit compilation stats as trailing comments when verbose */
@@ -2063,19 +6544,27 @@ static int codegen_x86_64(ASTNode *program, const char *outpath) {
         emit(&cg, "    # --- xenlyc stats ---");
         emit(&cg, "    # constant folds:   %d", cg.stat_const_fold);
         emit(&cg, "    # sys inlines:      %d", cg.stat_sys_inline);
+        emit(&cg, "    # native calls:     %d", cg.stat_native_calls);
         emit(&cg, "    # noreturn elim:    %d", cg.stat_noreturn_elim);
         emit(&cg, "    # unboxed ops:      %d", cg.stat_unboxed_ops);
     }
 
-    fclose(cg.out);
+    fflush(cg.out);
 
     /* Print stats to stderr if verbose */
     if (g_verbose_asm) {
         fputs("\033[1;36m[xenlyc] codegen stats:\033[0m\n", stderr);
         fprintf(stderr, "  sys constants inlined:   %d\n", cg.stat_sys_inline);
+        fprintf(stderr, "  module calls bound:      %d\n", cg.stat_native_calls);
         fprintf(stderr, "  noreturn elims:          %d\n", cg.stat_noreturn_elim);
         fprintf(stderr, "  constant folds:          %d\n", cg.stat_const_fold);
         fprintf(stderr, "  unboxed arithmetic ops:  %d\n", cg.stat_unboxed_ops);
+        fprintf(stderr, "  switch jump tables:      %d\n", cg.stat_jump_tables);
+        fprintf(stderr, "  functions via IR:        %d (direct: %d)\n", cg.stat_ir_lowered, cg.stat_ir_fallback);
+        fprintf(stderr, "  raw-f64 entry points:    %d\n", cg.stat_ir_num_entries);
+        if (g_prof.cap)
+            fprintf(stderr, "  cold (profile):          %d blocks, %d functions\n",
+                    cg.stat_cold_blocks, cg.stat_cold_fns);
     }
 
     /* cleanup */
@@ -2085,6 +6574,11 @@ static int codegen_x86_64(ASTNode *program, const char *outpath) {
     free(cg.gvars);
     for (int i = 0; i < cg.str_count; i++)   { free(cg.strings[i].text); free(cg.strings[i].label); }
     free(cg.strings);
+    for (int i = 0; i < cg.atom_count; i++)  { free(cg.atoms[i].text); free(cg.atoms[i].label); }
+    free(cg.atoms);
+    for (int i = 0; i < cg.prof_site_count; i++) { free(cg.prof_sites[i].text); free(cg.prof_sites[i].label); }
+    free(cg.prof_sites);
+    classes_free(&cg);
     for (int i = 0; i < cg.func_count; i++) {
         free(cg.funcs[i].asm_label);
         fn_rename_ctx_free(cg.funcs[i].rename_ctx, cg.funcs[i].rename_ctx_count);
@@ -2096,12 +6590,15 @@ static int codegen_x86_64(ASTNode *program, const char *outpath) {
     free(cg.fn_labels_used);
     for (int i = 0; i < cg.fn_rename_count; i++) { free(cg.fn_renames[i].src); free(cg.fn_renames[i].lbl); }
     free(cg.fn_renames);
+    cg_indexes_free(&cg);
+    call_sites_free(&cg);
     for (int i = 0; i < cg.variant_count; i++) free(cg.variants[i].name);
     free(cg.variants);
     for (int i = 0; i < cg.brk_top; i++) free(cg.brk_labels[i]);
     free(cg.brk_labels);
     for (int i = 0; i < cg.cnt_top; i++) free(cg.cnt_labels[i]);
     free(cg.cnt_labels);
+    unit_tables_free(&cg);
 
     return cg.had_error;
 }
@@ -2242,6 +6739,54 @@ static void emit_adrp_a64(CG *cg, const char *reg, const char *sym) {
     emit(cg, "    add     %s, %s, %s@PAGEOFF", reg, reg, sym);
 }
 
+/* Safepoint poll (see emit_safepoint); x9 is free at loop heads. */
+static void emit_safepoint_a64(CG *cg) {
+    char skip[64];
+    fresh_label(cg, skip, sizeof(skip));
+    emit(cg, "    adrp    x9, " XLY_SYM("xly_stopping") "@PAGE");
+    emit(cg, "    ldr     w9, [x9, " XLY_SYM("xly_stopping") "@PAGEOFF]");
+    emit(cg, "    cbz     w9, %s", skip);
+    emit(cg, "    bl      " XLY_SYM("xly_safepoint"));
+    emit(cg, "%s:", skip);
+}
+
+/* reg = the atom of property name `name` (atom_label). */
+static void emit_atom_a64(CG *cg, const char *reg, const char *name) {
+    const char *sym = atom_label(cg, name);
+    emit(cg, "    adrp    %s, %s@PAGE", reg, sym);
+    emit(cg, "    ldr     %s, [%s, %s@PAGEOFF]", reg, reg, sym);
+}
+
+/* The value `name` denotes, in x0 (see emit_load_name). */
+static void emit_load_name_a64(CG *cg, const char *name) {
+    int off = var_offset(cg, name);
+    if (off != 0) {
+        safe_ldr_a64(cg, "x0", off);
+        return;
+    }
+    int gi = gvar_find(cg, name);
+    if (gi >= 0) {
+        /* Global: load from __xly_globals[gi] */
+        emit(cg, "    adrp    x9, " XLY_SYM("__xly_globals") "@PAGE");
+        emit(cg, "    add     x9, x9, " XLY_SYM("__xly_globals") "@PAGEOFF");
+        emit(cg, "    ldr     x0, [x9, #%d]", gi * 8);
+    } else if (fn_is_known(cg, name)) {
+        int recv;
+        const char *lbl_a = fn_value_label(cg, name, &recv);
+        emit(cg, "    adrp    x0, .Lxly_fn_%s@PAGE", lbl_a);
+        emit(cg, "    add     x0, x0, .Lxly_fn_%s@PAGEOFF", lbl_a);
+        if (recv) {
+            emit(cg, "    mov     x1, xzr");
+            emit(cg, "    mov     w2, wzr");
+            emit(cg, "    bl      " XLY_SYM("xly_make_method"));
+        } else {
+            emit(cg, "    bl      " XLY_SYM("xly_make_fn"));
+        }
+    } else {
+        emit(cg, "    bl      " XLY_SYM("xly_null"));
+    }
+}
+
 /* ── expression compiler (ARM64) — Post-condition: result XlyVal* in x0, sp unchanged. */
 static void emit_expr_a64(CG *cg, ASTNode *node) {
     if (!node) { emit(cg, "    bl      " XLY_SYM("xly_null")); return; }
@@ -2270,45 +6815,61 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         emit(cg, "    bl      " XLY_SYM("xly_null"));
         break;
 
+    case NODE_TERNARY: {
+        char lbl_else[64], lbl_end[64];
+        fresh_label(cg, lbl_else, sizeof(lbl_else));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+        emit_expr_a64(cg, node->children[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_truthy"));
+        emit(cg, "    cbz     w0, %s", lbl_else);
+        emit_expr_a64(cg, node->children[1]);
+        emit(cg, "    b       %s", lbl_end);
+        emit(cg, "%s:", lbl_else);
+        emit_expr_a64(cg, node->children[2]);
+        emit(cg, "%s:", lbl_end);
+        break;
+    }
+
+    case NODE_NULLISH: {
+        char lbl_rhs[64], lbl_end[64];
+        fresh_label(cg, lbl_rhs, sizeof(lbl_rhs));
+        fresh_label(cg, lbl_end, sizeof(lbl_end));
+        emit_expr_a64(cg, node->children[0]);
+        emit(cg, "    cbz     x0, %s", lbl_rhs);
+        emit(cg, "    ldr     w9, [x0]");
+        emit(cg, "    cmp     w9, #3");                        /* VAL_NULL */
+        emit(cg, "    b.ne    %s", lbl_end);
+        emit(cg, "%s:", lbl_rhs);
+        emit_expr_a64(cg, node->children[1]);
+        emit(cg, "%s:", lbl_end);
+        break;
+    }
+
     /* ── anonymous function expression: fn(params) { body } ──────────
      * Synthesise a unique name, stash for emission, wrap as XlyVal*. */
     case NODE_ARROW_FN: {
         char anon_name[64];
-        snprintf(anon_name, sizeof(anon_name), "__anon_%d", cg->label_seq++);
-        if (node->str_value) free(node->str_value);
-        node->str_value = strdup(anon_name);
-        fn_name_register(cg, anon_name);
-
-        /* Free-variable analysis for closure capture */
-        NameSet fn_params_a = {0};
-        for (size_t i = 0; i < node->param_count; i++)
-            nameset_add(&fn_params_a, node->params[i].name);
         NameSet free_vars_a = {0};
-        if (node->child_count > 0)
-            collect_free_vars(cg, node->children[0], &fn_params_a, &free_vars_a);
-        nameset_free(&fn_params_a);
+        arrow_fn_prepare(cg, node, anon_name, sizeof(anon_name), &free_vars_a);
         NameSet captures_a = {0};
         for (int i = 0; i < free_vars_a.count; i++)
             if (var_offset(cg, free_vars_a.names[i]) != 0)
                 nameset_add(&captures_a, free_vars_a.names[i]);
+        /* `this` with no receiver in scope: the fn takes its own */
+        int recv = nameset_has(&free_vars_a, "this") && !nameset_has(&captures_a, "this");
         nameset_free(&free_vars_a);
 
-        if (cg->func_count >= cg->func_cap) {
-            cg->func_cap = cg->func_cap ? cg->func_cap * 2 : 16;
-            cg->funcs    = realloc(cg->funcs, sizeof(cg->funcs[0]) * (size_t)cg->func_cap);
-        }
-        { int fi = cg->func_count++;
-          cg->funcs[fi].node = node;
-          cg->funcs[fi].ncaptures = captures_a.count;
-          cg->funcs[fi].captures  = captures_a.count > 0 ? captures_a.names : NULL;
-          cg->funcs[fi].asm_label = strdup(anon_name);
-          fn_label_mark_used(cg, anon_name);
-          fn_rename_ctx_snapshot(cg, &cg->funcs[fi].rename_ctx, &cg->funcs[fi].rename_ctx_count); }
+        fn_stash(cg, recv ? fn_with_receiver(node) : node, anon_name,
+                 captures_a.names, captures_a.count);
 
         /* Load address of the synthesized label, wrap via xly_make_fn/closure */
         emit(cg, "    adrp    x0, .Lxly_fn_%s@PAGE", anon_name);
         emit(cg, "    add     x0, x0, .Lxly_fn_%s@PAGEOFF", anon_name);
-        if (captures_a.count == 0) {
+        if (captures_a.count == 0 && recv) {
+            emit(cg, "    mov     x1, xzr");
+            emit(cg, "    mov     w2, wzr");
+            emit(cg, "    bl      " XLY_SYM("xly_make_method"));
+        } else if (captures_a.count == 0) {
             emit(cg, "    bl      " XLY_SYM("xly_make_fn"));
         } else {
             /* Build env on stack and call xly_make_closure */
@@ -2324,40 +6885,70 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
             emit(cg, "    ldr     x0, [sp]");   /* fn ptr → x0 */
             emit(cg, "    add     x1, sp, #8"); /* env array → x1 */
             emit(cg, "    mov     w2, #%d", captures_a.count);
-            emit(cg, "    bl      " XLY_SYM("xly_make_closure"));
+            emit(cg, "    bl      %s", recv ? XLY_SYM("xly_make_method") : XLY_SYM("xly_make_closure"));
             sp_add_a64(cg, alloc_a);
         }
         break;
     }
 
     /* ── identifier ─────────────────────────────────────────────────── */
-    case NODE_IDENTIFIER: {
-        int off = var_offset(cg, node->str_value);
-        if (off != 0) {
-            safe_ldr_a64(cg, "x0", off);
-        } else {
-            int gi = gvar_find(cg, node->str_value);
-            if (gi >= 0) {
-                /* Global: load from __xly_globals[gi] */
-                emit(cg, "    adrp    x9, " XLY_SYM("__xly_globals") "@PAGE");
-                emit(cg, "    add     x9, x9, " XLY_SYM("__xly_globals") "@PAGEOFF");
-                emit(cg, "    ldr     x0, [x9, #%d]", gi * 8);
-            } else if (fn_is_known(cg, node->str_value)) {
-                const char *lbl_a = fn_resolve_label(cg, node->str_value);
-                emit(cg, "    adrp    x0, .Lxly_fn_%s@PAGE", lbl_a);
-                emit(cg, "    add     x0, x0, .Lxly_fn_%s@PAGEOFF", lbl_a);
-                emit(cg, "    bl      " XLY_SYM("xly_make_fn"));
-            } else {
-                emit(cg, "    bl      " XLY_SYM("xly_null"));
-            }
-        }
+    case NODE_IDENTIFIER:
+        emit_load_name_a64(cg, node->str_value);
         break;
-    }
 
     /* ── this ────────────────────────────────────────────────────────── */
     case NODE_THIS:
-        emit(cg, "    bl      " XLY_SYM("xly_this"));
+        if (var_offset(cg, "this") != 0)    /* the receiver param (see fn_uses_this) */
+            safe_ldr_a64(cg, "x0", var_offset(cg, "this"));
+        else                                /* a declared fn called by name */
+            emit(cg, "    bl      " XLY_SYM("xly_null"));
+        break;
+
+    /* ── classes: new / super(...) / instanceof ──────────────────────── */
+    case NODE_NEW:
+    case NODE_SUPER_CALL: {
+        /* xly_construct(x0=cls, x1=args, x2=argc)
+         * xly_call_init(x0=parent, x1=this, x2=args, x3=argc)            */
+        int is_new = node->type == NODE_NEW;
+        int ci = is_new ? class_find(cg, node->str_value)
+                        : (cg->cur_cls >= 0 ? cg->classes[cg->cur_cls].parent : -1);
+        if (ci < 0 || (!is_new && var_offset(cg, "this") == 0)) {
+            emit(cg, "    bl      " XLY_SYM("xly_null"));
+            break;
+        }
+        int argc = (int)node->child_count;
+        int arr_bytes = argc > 0 ? (((argc * 8) + 15) & ~15) : 0;
+        if (arr_bytes > 0) sp_sub_a64(cg, arr_bytes);
+        for (int i = 0; i < argc; i++) {
+            emit_expr_a64(cg, node->children[i]);
+            emit(cg, "    str     x0, [sp, #%d]", i * 8);
+        }
+        char cl[64];
+        snprintf(cl, sizeof(cl), ".Lxly_class_%d", ci);
+        emit_adrp_a64(cg, "x0", cl);
+        int a = is_new ? 1 : 2;
+        if (!is_new) safe_ldr_a64(cg, "x1", var_offset(cg, "this"));
+        if (argc > 0) emit(cg, "    mov     x%d, sp", a);
+        else          emit(cg, "    mov     x%d, xzr", a);
+        emit(cg, "    mov     x%d, #%d", a + 1, argc);
+        emit(cg, "    bl      %s", is_new ? XLY_SYM("xly_construct") : XLY_SYM("xly_call_init"));
+        if (arr_bytes > 0) sp_add_a64(cg, arr_bytes);
+        break;
+    }
+    case NODE_INSTANCEOF: {
+        int ci = class_find(cg, node->children[1]->str_value);
+        emit_expr_a64(cg, node->children[0]);
+        if (ci < 0) {
+            emit(cg, "    mov     w0, #0");
+            emit(cg, "    bl      " XLY_SYM("xly_bool"));
+            break;
+        }
+        char cl[64];
+        snprintf(cl, sizeof(cl), ".Lxly_class_%d", ci);
+        emit_adrp_a64(cg, "x1", cl);
+        emit(cg, "    bl      " XLY_SYM("xly_instanceof"));
         break;
+    }
 
     /* ── binary ─────────────────────────────────────────────────────── */
     case NODE_BINARY: {
@@ -2367,8 +6958,8 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         if (strcmp(op, "and") == 0) {
             char lbl_end[64], lbl_done[64];
             int seq = cg->label_seq++;
-            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%d_and_end",  seq);
-            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%d_and_done", seq);
+            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%s%d_and_end",  cg->label_pfx, seq);
+            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%s%d_and_done", cg->label_pfx, seq);
 
             emit_expr_a64(cg, node->children[0]);   /* x0 = left */
             spill_push_a64(cg, "x0");               /* save left */
@@ -2387,8 +6978,8 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         if (strcmp(op, "or") == 0) {
             char lbl_end[64], lbl_done[64];
             int seq = cg->label_seq++;
-            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%d_or_end",  seq);
-            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%d_or_done", seq);
+            snprintf(lbl_end,  sizeof(lbl_end),  ".Lxly_%s%d_or_end",  cg->label_pfx, seq);
+            snprintf(lbl_done, sizeof(lbl_done), ".Lxly_%s%d_or_done", cg->label_pfx, seq);
 
             emit_expr_a64(cg, node->children[0]);
             spill_push_a64(cg, "x0");
@@ -2587,6 +7178,7 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
             else
                 emit(cg, "    mov     x1, #0");
             emit(cg, "    mov     w2, #%d", nargs);
+            emit(cg, "    mov     w3, #%d", variant_id(cg, node->str_value));
             emit(cg, "    bl      " XLY_SYM("xly_make_variant"));
             if (arr_bytes > 0)
                 sp_add_a64(cg, arr_bytes);
@@ -2606,7 +7198,11 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
 
         /* Dispatch: declared fn → bl direct; variable fn → xly_call_fnval */
         if (fn_is_known(cg, node->str_value)) {
-            emit(cg, "    bl      .Lxly_fn_%s", fn_resolve_label(cg, node->str_value));
+            const char *lbl = fn_resolve_label(cg, node->str_value);
+            int arity = fn_callee_arity(cg, lbl);
+            for (int i = nargs; i < arity && i < 8; i++)
+                emit(cg, "    mov     %s, xzr", aregs[i]);
+            emit(cg, "    bl      .Lxly_fn_%s", lbl);
         } else {
             int var_off = var_offset(cg, node->str_value);
             int gi_fn_a = (var_off == 0) ? gvar_find(cg, node->str_value) : -1;
@@ -2688,10 +7284,13 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         /*
          * xly_call_module(mod, fn, args, argc)
          *   x0=mod  x1=fn  x2=args_ptr  x3=argc
+         * or, for math.* / string.*, their native: x0=args_ptr  x1=argc
          *
          * We reserve space for the args array on the stack (16-aligned),
          * eval each arg and store, then pass sp as the array pointer.
          */
+        char nsym[128];
+        const char *native = module_native(mod_name, fn_name, nsym, sizeof(nsym));
         int slot_bytes  = argc * 8;
         int alloc_bytes = argc > 0 ? ((slot_bytes + 15) & ~15) : 0;
 
@@ -2703,6 +7302,19 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
             emit(cg, "    str     x0, [sp, #%d]", i * 8);
         }
 
+        if (native) {
+            if (argc > 0)
+                emit(cg, "    mov     x0, sp");
+            else
+                emit(cg, "    mov     x0, xzr");
+            emit(cg, "    mov     x1, #%d", argc);
+            emit(cg, "    bl      %s", native);
+            cg->stat_native_calls++;
+            if (alloc_bytes > 0)
+                sp_add_a64(cg, alloc_bytes);
+            break;
+        }
+
         /* x0 = mod string ptr */
         const char *ml = intern_string(cg, mod_name);
         emit_adrp_a64(cg, "x0", ml);
@@ -2793,7 +7405,6 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         int npairs = (int)node->child_count;
         for (int i = 0; i < npairs; i++) {
             ASTNode *pair     = node->children[i];  /* NODE_NAMED_ARG */
-            const char *kl    = intern_string(cg, pair->str_value);
             ASTNode *val_node = pair->child_count > 0 ? pair->children[0] : NULL;
             if (val_node)
                 emit_expr_a64(cg, val_node);
@@ -2801,8 +7412,8 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
                 emit(cg, "    bl      " XLY_SYM("xly_null"));
             emit(cg, "    mov     x2, x0");            /* x2 = value */
             safe_ldr_a64(cg, "x0", obj_slot);         /* x0 = obj */
-            emit_adrp_a64(cg, "x1", kl);              /* x1 = key */
-            emit(cg, "    bl      " XLY_SYM("xly_obj_set"));
+            emit_atom_a64(cg, "x1", pair->str_value); /* x1 = key */
+            emit(cg, "    bl      " XLY_SYM("xly_obj_set_atom"));
         }
         safe_ldr_a64(cg, "x0", obj_slot);   /* result = obj */
         break;
@@ -2812,9 +7423,8 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
     case NODE_PROPERTY_GET: {
         emit_expr_a64(cg, node->children[0]);
         /* x0 = obj */
-        const char *fl = intern_string(cg, node->str_value);
-        emit_adrp_a64(cg, "x1", fl);
-        emit(cg, "    bl      " XLY_SYM("xly_obj_get"));
+        emit_atom_a64(cg, "x1", node->str_value);
+        emit(cg, "    bl      " XLY_SYM("xly_obj_get_atom"));
         break;
     }
 
@@ -2825,9 +7435,8 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         emit_expr_a64(cg, node->children[1]);
         emit(cg, "    mov     x2, x0");
         spill_pop_a64(cg, "x0");
-        const char *fl2 = intern_string(cg, node->str_value);
-        emit_adrp_a64(cg, "x1", fl2);
-        emit(cg, "    bl      " XLY_SYM("xly_obj_set"));
+        emit_atom_a64(cg, "x1", node->str_value);
+        emit(cg, "    bl      " XLY_SYM("xly_obj_set_atom"));
         break;
     }
 
@@ -2836,11 +7445,29 @@ static void emit_expr_a64(CG *cg, ASTNode *node) {
         emit_expr_a64(cg, node->children[0]);
         break;
 
-    /* ── spawn expr (ARM64) ─────────────────────────────────────────── */
-    case NODE_SPAWN:
-        emit_expr_a64(cg, node->children[0]);   /* execute call, result in x0 */
-        emit(cg, "    bl      " XLY_SYM("xly_null"));   /* spawn → null */
+    /* ── spawn expr (ARM64): xly_spawn(x0=fn, x1=args, x2=argc) ─────── */
+    case NODE_SPAWN: {
+        ASTNode *call = node->children[0];
+        if (!spawn_target(cg, call)) {
+            emit_expr_a64(cg, call);
+            emit(cg, "    bl      " XLY_SYM("xly_null"));   /* spawn → null */
+            break;
+        }
+        int argc = (int)call->child_count;
+        int arr_bytes = argc > 0 ? (((argc * 8) + 15) & ~15) : 0;
+        if (arr_bytes > 0) sp_sub_a64(cg, arr_bytes);
+        for (int i = 0; i < argc; i++) {
+            emit_expr_a64(cg, call->children[i]);
+            emit(cg, "    str     x0, [sp, #%d]", i * 8);
+        }
+        emit_load_name_a64(cg, call->str_value);
+        if (argc > 0) emit(cg, "    mov     x1, sp");
+        else          emit(cg, "    mov     x1, xzr");
+        emit(cg, "    mov     x2, #%d", argc);
+        emit(cg, "    bl      " XLY_SYM("xly_spawn"));
+        if (arr_bytes > 0) sp_add_a64(cg, arr_bytes);
         break;
+    }
 
     default:
         emit(cg, "    bl      " XLY_SYM("xly_null"));
@@ -2975,6 +7602,7 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         push_cnt(cg, lbl_cond);
 
         emit(cg, "%s:", lbl_cond);
+        emit_safepoint_a64(cg);
         emit_expr_a64(cg, node->children[0]);
         emit(cg, "    bl      " XLY_SYM("xly_truthy"));
         emit(cg, "    cbz     w0, %s", lbl_end);
@@ -2988,6 +7616,59 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         break;
     }
 
+    case NODE_DO_WHILE: {
+        char lbl_top[64], lbl_cond[64], lbl_end[64];
+        fresh_label(cg, lbl_top,  sizeof(lbl_top));
+        fresh_label(cg, lbl_cond, sizeof(lbl_cond));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_cond);
+
+        emit(cg, "%s:", lbl_top);
+        emit_safepoint_a64(cg);
+        emit_stmt_a64(cg, node->children[0]);
+        emit(cg, "%s:", lbl_cond);
+        emit_expr_a64(cg, node->children[1]);
+        emit(cg, "    bl      " XLY_SYM("xly_truthy"));
+        emit(cg, "    cbnz    w0, %s", lbl_top);
+
+        emit(cg, "%s:", lbl_end);
+        pop_cnt(cg);
+        pop_brk(cg);
+        break;
+    }
+
+    case NODE_UNLESS: {
+        char lbl_end[64];
+        fresh_label(cg, lbl_end, sizeof(lbl_end));
+        emit_expr_a64(cg, node->children[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_truthy"));
+        emit(cg, "    cbnz    w0, %s", lbl_end);
+        emit_stmt_a64(cg, node->children[1]);
+        emit(cg, "%s:", lbl_end);
+        break;
+    }
+
+    case NODE_FOREVER: {
+        char lbl_top[64], lbl_end[64];
+        fresh_label(cg, lbl_top, sizeof(lbl_top));
+        fresh_label(cg, lbl_end, sizeof(lbl_end));
+
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_top);
+
+        emit(cg, "%s:", lbl_top);
+        emit_safepoint_a64(cg);
+        emit_stmt_a64(cg, node->children[0]);
+        emit(cg, "    b       %s", lbl_top);
+
+        emit(cg, "%s:", lbl_end);
+        pop_cnt(cg);
+        pop_brk(cg);
+        break;
+    }
+
     case NODE_FOR: {
         char lbl_cond[64], lbl_upd[64], lbl_end[64];
         fresh_label(cg, lbl_cond, sizeof(lbl_cond));
@@ -3001,6 +7682,7 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         emit_stmt_a64(cg, node->children[0]);   /* init */
 
         emit(cg, "%s:", lbl_cond);
+        emit_safepoint_a64(cg);
         if (!(node->children[1]->type == NODE_BOOL && node->children[1]->bool_value)) {
             emit_expr_a64(cg, node->children[1]);
             emit(cg, "    bl      " XLY_SYM("xly_truthy"));
@@ -3049,6 +7731,7 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         push_cnt(cg, lbl_cond);
 
         emit(cg, "%s:", lbl_cond);
+        emit_safepoint_a64(cg);
         safe_ldr_a64(cg, "x9", off_idx);
         safe_ldr_a64(cg, "x10", off_len);
         emit(cg, "    cmp     x9, x10");
@@ -3089,22 +7772,9 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         scope_leave(cg);
         break;
 
-    case NODE_FN_DECL: {
-        char ulbl_a[256];
-        fn_unique_label(cg, node->str_value, ulbl_a, sizeof(ulbl_a));
-        fn_rename_push(cg, node->str_value, ulbl_a);
-        if (cg->func_count >= cg->func_cap) {
-            cg->func_cap = cg->func_cap ? cg->func_cap * 2 : 16;
-            cg->funcs    = realloc(cg->funcs, sizeof(cg->funcs[0]) * (size_t)cg->func_cap);
-        }
-        { int fi = cg->func_count++;
-          cg->funcs[fi].node      = node;
-          cg->funcs[fi].captures  = NULL;
-          cg->funcs[fi].ncaptures = 0;
-          cg->funcs[fi].asm_label = strdup(ulbl_a);
-          fn_rename_ctx_snapshot(cg, &cg->funcs[fi].rename_ctx, &cg->funcs[fi].rename_ctx_count); }
+    case NODE_FN_DECL:
+        fn_decl_stash(cg, node);
         break;
-    }
 
     case NODE_RETURN:
         if (node->child_count > 0)
@@ -3129,6 +7799,7 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         break;
 
     case NODE_IMPORT:
+    case NODE_CLASS_DECL:           /* see collect_classes */
         break;
 
     /* ── enum declaration (ARM64) ─────────────────────────────────────── */
@@ -3143,6 +7814,7 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
                 emit(cg, "    bl      " XLY_SYM("xly_str"));
                 emit(cg, "    mov     x1, #0");   /* fields = NULL */
                 emit(cg, "    mov     w2, #0");   /* nfields = 0   */
+                emit(cg, "    mov     w3, #%d", variant_id(cg, vn->str_value));
                 emit(cg, "    bl      " XLY_SYM("xly_make_variant"));
                 int gi = gvar_declare(cg, vn->str_value);
                 emit(cg, "    adrp    x9, " XLY_SYM("__xly_globals") "@PAGE");
@@ -3152,32 +7824,15 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
         }
         break;
 
-    /* ── Generator function declaration (ARM64) ─────────────────────────────
-     * gen fn name(params) { body }
-     *
-     * Strategy: emit the generator body as a regular function but add
-     * a state-machine wrapper.  The function returns an iterator object
-     * allocated on the heap:  xly_call_module("iter","__make_gen__",…)
-     *
-     * For the native compiler the cleanest approach is to lower the
-     * generator to a plain Xenly function whose first argument is a
-     * heap-allocated state struct.  We call the runtime helper
-     * xly_gen_create(fn_ptr, env_ptr) which returns a VAL_INSTANCE
-     * iterator.  The generator body is emitted as a helper with a
-     * switch-based PC dispatch.                                         */
+    /* ── Generator function declaration (ARM64) ────────────────────────────
+     * As on x86-64: the body is stashed like a fn and the name is bound
+     * to xly_gen_fn(body).                                              */
     case NODE_GEN_DECL: {
-        const char *gen_name = node->str_value ? node->str_value : "__anon_gen";
-        char body_lbl[128]; snprintf(body_lbl, sizeof(body_lbl), "_xly_gen_%s", gen_name);
-
-        /* Emit the state-machine body function */
-        emit(cg, "// ── generator body: %s ─────────────────────────────", gen_name);
-        emit(cg, "    adrp    x0, %s@PAGE", body_lbl);
-        emit(cg, "    add     x0, x0, %s@PAGEOFF", body_lbl);
-        /* Pass fn pointer + current env to runtime helper */
-        emit(cg, "    mov     x1, sp");   /* env approximation */
-        emit(cg, "    bl      " XLY_SYM("xly_gen_create"));
-        /* x0 = iterator VAL_INSTANCE */
-        /* Store in global if named */
+        char lbl[256];
+        gen_decl_stash(cg, node, lbl, sizeof(lbl));
+        emit(cg, "    adrp    x0, .Lxly_fn_%s@PAGE", lbl);
+        emit(cg, "    add     x0, x0, .Lxly_fn_%s@PAGEOFF", lbl);
+        emit(cg, "    bl      " XLY_SYM("xly_gen_fn"));
         if (node->str_value) {
             int gi = gvar_declare(cg, node->str_value);
             emit(cg, "    adrp    x9, " XLY_SYM("__xly_globals") "@PAGE");
@@ -3188,55 +7843,52 @@ static void emit_stmt_a64(CG *cg, ASTNode *node) {
     }
 
     /* ── yield expr (ARM64) ─────────────────────────────────────────────────
-     * Within a generator body, yield suspends execution.
-     * In native codegen this is lowered to:
-     *   1. Evaluate the yield expression → x0
-     *   2. Store x0 as the current yield value via xly_gen_yield(x0)
-     *   3. Return from the body function (the runtime resumes on next .next())
-     * The runtime tracks the PC via the state struct.                   */
+     * xly_gen_yield switches to the generator's resumer and returns when
+     * it is resumed.                                                     */
     case NODE_YIELD:
         if (node->child_count > 0) emit_expr_a64(cg, node->children[0]);
         else emit(cg, "    bl      " XLY_SYM("xly_null"));
-        emit(cg, "    bl      " XLY_SYM("xly_gen_yield"));  /* saves yield value */
-        emit(cg, "    ret");                                  /* suspend */
+        emit(cg, "    bl      " XLY_SYM("xly_gen_yield"));
         break;
 
     case NODE_YIELD_EMPTY:
         emit(cg, "    bl      " XLY_SYM("xly_null"));
         emit(cg, "    bl      " XLY_SYM("xly_gen_yield"));
-        emit(cg, "    ret");
         break;
 
     /* ── for (x of iterable) — ARM64 ────────────────────────────────────────
-     * children[0] = iterable, children[1] = body, str_value = loop var name
-     * Lowers to: call xly_for_of_next(iter) in a loop.                */
+     * children[0] = iterable, children[1] = body, str_value = loop var name.
+     * The iterator lives in a hidden slot, as for-in's array does.      */
     case NODE_FOR_OF: {
-        int lbl = cg->label_seq++;
-        char loop_lbl[32], end_lbl[32];
-        snprintf(loop_lbl, sizeof(loop_lbl), ".Lfor_of_%d", lbl);
-        snprintf(end_lbl,  sizeof(end_lbl),  ".Lfor_of_end_%d", lbl);
+        char lbl_next[64], lbl_end[64];
+        fresh_label(cg, lbl_next, sizeof(lbl_next));
+        fresh_label(cg, lbl_end,  sizeof(lbl_end));
+
+        scope_enter(cg);
+        int off_var = var_declare(cg, node->str_value ? node->str_value : "__fo_v");
+        char tmp[80];
+        snprintf(tmp, sizeof(tmp), "__fo_g_%d", cg->label_seq++);
+        int off_gen = var_declare(cg, tmp);
 
-        /* Evaluate iterable → x19 (callee-saved) */
         emit_expr_a64(cg, node->children[0]);
-        emit(cg, "    mov     x19, x0");   /* save iterator */
+        safe_str_a64(cg, "x0", off_gen);
 
-        emit(cg, "%s:", loop_lbl);
-        /* Call .next() on iterator */
-        emit(cg, "    mov     x0, x19");
+        push_brk(cg, lbl_end);
+        push_cnt(cg, lbl_next);
+
+        emit(cg, "%s:", lbl_next);
+        emit_safepoint_a64(cg);
+        safe_ldr_a64(cg, "x0", off_gen);
         emit(cg, "    bl      " XLY_SYM("xly_for_of_next"));
-        /* x0 = {value, done} or NULL if done */
-        emit(cg, "    cbz     x0, %s", end_lbl);
-        /* Store value in loop variable */
-        if (node->str_value) {
-            const char *var_lbl = intern_string(cg, node->str_value);
-            emit(cg, "    adrp    x9, %s@PAGE", var_lbl);
-            emit(cg, "    add     x9, x9, %s@PAGEOFF", var_lbl);
-            emit(cg, "    str     x0, [x9]");
-        }
-        /* Emit body */
+        emit(cg, "    cbz     x0, %s", lbl_end);
+        safe_str_a64(cg, "x0", off_var);
         if (node->child_count > 1) emit_stmt_a64(cg, node->children[1]);
-        emit(cg, "    b       %s", loop_lbl);
-        emit(cg, "%s:", end_lbl);
+        emit(cg, "    b       %s", lbl_next);
+        emit(cg, "%s:", lbl_end);
+
+        pop_cnt(cg);
+        pop_brk(cg);
+        scope_leave(cg);
         break;
     }
 
@@ -3371,7 +8023,7 @@ static void emit_function_a64(CG *cg, ASTNode *fn, const char *asm_label,
     int sv_vc = cg->var_count, sv_fo = cg->frame_offset, sv_sd = cg->scope_depth;
     int sv_spill = cg->a64_spill_depth;
     int sv_nm_a = cg->noreturn_mode;
-    int sv_rename_a = cg->fn_rename_count;   /* save rename scope */
+    int sv_rename_a = fn_rename_scope_enter(cg);   /* save rename scope */
     cg->scope_depth    = 0;
     cg->frame_offset   = 0;
     cg->var_count      = 0;   /* hide main() vars */
@@ -3461,6 +8113,7 @@ static void emit_function_a64(CG *cg, ASTNode *fn, const char *asm_label,
             emit(cg, "%s:", lbl_has_arg);
         }
     }
+    emit_safepoint_a64(cg);
 
     scope_enter(cg);
     for (size_t i = 0; i < body->child_count; i++)
@@ -3487,7 +8140,831 @@ static void emit_function_a64(CG *cg, ASTNode *fn, const char *asm_label,
     cg->a64_spill_depth = sv_spill;
     cg->noreturn_mode   = sv_nm_a;
     cg->a64_sp_adj      = 0;  /* reset: caller's sp_adj is already 0 at call sites */
-    fn_renames_pop_to(cg, sv_rename_a);  /* pop renames pushed by nested fn decls */
+    fn_rename_scope_leave(cg, sv_rename_a);  /* pop renames pushed by nested fn decls */
+}
+
+/* ── IR emitter (ARM64) ─────────────────────────────────────────────────
+ * Same scheme as the x86-64 IR emitter: values in x19-x28 or a
+ * [x29, #-N] slot, phi copies on the incoming edges, inline number fast
+ * paths.  Scratch registers: x9 (address materialisation in
+ * safe_*_a64), x10-x12.                                                  */
+static const char *ira_regs[]  = {"x0","x1","x2","x3","x4","x5","x6","x7"};
+static const char *ira_saved[] = {"x19","x20","x21","x22","x23",
+                                  "x24","x25","x26","x27","x28"};     /* allocatable */
+#define IRA_NSAVED 10
+
+static void ira_label(CG *cg, int seq, IRBlock *b, char *buf, size_t sz) {
+    snprintf(buf, sz, ".Lxly_ir%s%d_b%d", cg->label_pfx, seq, b->id);
+}
+
+static void ira_ld_loc(CG *cg, const char *reg, int loc) {
+    if (IR_LOC_IS_REG(loc)) emit(cg, "    mov     %s, %s", reg, ira_saved[IR_LOC_INDEX(loc)]);
+    else                    safe_ldr_a64(cg, reg, loc);
+}
+
+static void ira_st_loc(CG *cg, const char *reg, int loc) {
+    if (IR_LOC_IS_REG(loc)) emit(cg, "    mov     %s, %s", ira_saved[IR_LOC_INDEX(loc)], reg);
+    else                    safe_str_a64(cg, reg, loc);
+}
+
+static void ira_ld(CG *cg, const char *reg, IRInstr *v) {
+    ira_ld_loc(cg, reg, ir_loc(v));
+}
+
+/* Materialise a 64-bit immediate with movz/movk. */
+static void ira_mov_imm(CG *cg, const char *reg, unsigned long long u) {
+    int first = 1;
+    for (int shift = 0; shift <= 48; shift += 16) {
+        unsigned long long chunk = (u >> shift) & 0xFFFF;
+        if (chunk == 0 && !first) continue;
+        emit(cg, "    %s    %s, #0x%llx, lsl #%d", first ? "movz" : "movk", reg, chunk, shift);
+        first = 0;
+    }
+}
+
+/* dst = src + imm for any imm (sp allowed as src/dst). */
+static void ira_add_imm(CG *cg, const char *dst, const char *src, int imm) {
+    if (imm >= 0 && imm <= 4095) {
+        emit(cg, "    add     %s, %s, #%d", dst, src, imm);
+    } else if (imm < 0 && imm >= -4095) {
+        emit(cg, "    sub     %s, %s, #%d", dst, src, -imm);
+    } else {
+        ira_mov_imm(cg, "x9", (unsigned long long)(imm < 0 ? -(long long)imm : imm));
+        emit(cg, "    %s     %s, %s, x9", imm < 0 ? "sub" : "add", dst, src);
+    }
+}
+
+/* Operand array at [sp]; returns bytes to release (0 if no operands). */
+static int ira_array(CG *cg, IRInstr **vals, int n) {
+    if (n <= 0) return 0;
+    int bytes = ((n * 8) + 15) & ~15;
+    ira_add_imm(cg, "sp", "sp", -bytes);
+    for (int i = 0; i < n; i++) {
+        ira_ld(cg, "x10", vals[i]);
+        emit(cg, "    str     x10, [sp, #%d]", i * 8);
+    }
+    return bytes;
+}
+
+static void ira_array_ptr(CG *cg, int bytes, const char *reg) {
+    if (bytes) emit(cg, "    mov     %s, sp", reg);
+    else       emit(cg, "    mov     %s, xzr", reg);
+}
+
+static void ira_release(CG *cg, int bytes) {
+    if (bytes) ira_add_imm(cg, "sp", "sp", bytes);
+}
+
+static void ira_sym_addr(CG *cg, const char *reg, const char *name) {
+    char b[256];
+    emit_adrp_a64(cg, reg, XLY_RSYM(b, name));
+}
+
+/* Both operands in x0/x1; branch to `slow` unless both are numbers, else
+ * leave their doubles in d0/d1.                                          */
+static void ira_num_guard(CG *cg, const char *slow) {
+    emit(cg, "    ldr     w9, [x0]");
+    emit(cg, "    cbnz    w9, %s", slow);
+    emit(cg, "    ldr     w9, [x1]");
+    emit(cg, "    cbnz    w9, %s", slow);
+    emit(cg, "    ldr     d0, [x0, #8]");
+    emit(cg, "    ldr     d1, [x1, #8]");
+}
+
+/* The number held by `v` into dN: raw f64 as is, boxed via ->num. */
+static void ira_ld_num(CG *cg, int d, IRInstr *v) {
+    ira_ld(cg, "x10", v);
+    if (v->type == IRT_F64) emit(cg, "    fmov    d%d, x10", d);
+    else                    emit(cg, "    ldr     d%d, [x10, #8]", d);
+}
+
+/* a op b (+ - * / %), as irx_arith: f64 results work on the numbers
+ * directly, boxed + - * / take an inline fast path for two numbers.      */
+/* Box the number in d0 as the result of `in` (see irx_box_xmm0). */
+static void ira_box_d0(CG *cg, IRInstr *in) {
+    if (in->stack) {
+        ira_add_imm(cg, "x0", "x29", in->cell);
+        emit(cg, "    str     d0, [x0, #8]");
+    } else {
+        emit(cg, "    bl      " XLY_SYM("xly_num"));
+    }
+}
+
+static void ira_arith(CG *cg, IRInstr *in) {
+    static const char *fop[] = { "fadd", "fsub", "fmul", "fdiv" };
+    static const char *rt[]  = { "xly_add", "xly_sub", "xly_mul", "xly_div", "xly_mod" };
+    char b[64];
+    int k = in->op - IR_ADD;
+    if (in->type == IRT_F64) {
+        ira_ld_num(cg, 0, in->args[0]);
+        ira_ld_num(cg, 1, in->args[1]);
+        if (in->op == IR_MOD) emit(cg, "    bl      " XLY_SYM("fmod"));
+        else                  emit(cg, "    %s    d0, d0, d1", fop[k]);
+        emit(cg, "    fmov    x0, d0");
+        cg->stat_unboxed_ops++;
+        return;
+    }
+    ira_ld(cg, "x0", in->args[0]);
+    ira_ld(cg, "x1", in->args[1]);
+    if (cg->opt_level >= 2 && in->op != IR_MOD) {
+        char slow[64], done[64];
+        fresh_label(cg, slow, sizeof(slow));
+        fresh_label(cg, done, sizeof(done));
+        ira_num_guard(cg, slow);
+        emit(cg, "    %s    d0, d0, d1", fop[k]);
+        ira_box_d0(cg, in);
+        emit(cg, "    b       %s", done);
+        emit(cg, "%s:", slow);
+        emit(cg, "    bl      %s", XLY_RSYM(b, rt[k]));
+        emit(cg, "%s:", done);
+        cg->stat_unboxed_ops++;
+    } else {
+        emit(cg, "    bl      %s", XLY_RSYM(b, rt[k]));
+    }
+}
+
+/* fcmp leaves unordered as C=1 V=1: mi/ls are false for NaN (lt/le would
+ * not be), gt/ge/eq are false and ne is true — matching the runtime.     */
+static void ira_compare(CG *cg, IRInstr *in) {
+    static const char *cc[] = { "mi", "gt", "ls", "ge", "eq", "ne" };
+    static const char *rt[] = { "xly_lt", "xly_gt", "xly_lte", "xly_gte", "xly_eq", "xly_neq" };
+    char b[64], slow[64], done[64];
+    int k = in->op - IR_LT;
+    if (in->args[0]->type == IRT_F64 || in->args[1]->type == IRT_F64) {
+        ira_ld_num(cg, 0, in->args[0]);
+        ira_ld_num(cg, 1, in->args[1]);
+        emit(cg, "    fcmp    d0, d1");
+        emit(cg, "    cset    w0, %s", cc[k]);
+        if (in->type == IRT_VAL)
+            emit(cg, "    bl      " XLY_SYM("xly_bool"));
+        cg->stat_unboxed_ops++;
+        return;
+    }
+    ira_ld(cg, "x0", in->args[0]);
+    ira_ld(cg, "x1", in->args[1]);
+    fresh_label(cg, slow, sizeof(slow));
+    fresh_label(cg, done, sizeof(done));
+    if (cg->opt_level >= 2) {
+        ira_num_guard(cg, slow);
+        emit(cg, "    fcmp    d0, d1");
+        emit(cg, "    cset    w0, %s", cc[k]);
+        if (in->type == IRT_VAL)
+            emit(cg, "    bl      " XLY_SYM("xly_bool"));
+        emit(cg, "    b       %s", done);
+        cg->stat_unboxed_ops++;
+    }
+    emit(cg, "%s:", slow);
+    emit(cg, "    bl      %s", XLY_RSYM(b, rt[k]));
+    if (in->type == IRT_BOOL) {
+        emit(cg, "    bl      " XLY_SYM("xly_truthy"));
+        emit(cg, "    mov     w0, w0");
+    }
+    emit(cg, "%s:", done);
+}
+
+static void ira_edge(CG *cg, IRFrame *fr, int seq, IRBlock *b, IRBlock *s, IRBlock *next) {
+    int par = 0;
+    int *dst = malloc(sizeof(int) * (size_t)(s->nins + 1));
+    int *src = malloc(sizeof(int) * (size_t)(s->nins + 1));
+    int n = ir_phi_moves(b, s, dst, src, &par);
+    if (par) {
+        for (int i = 0; i < n; i++) {
+            ira_ld_loc(cg, "x10", src[i]);
+            safe_str_a64(cg, "x10", fr->scratch - 8 * i);
+        }
+        for (int i = 0; i < n; i++) src[i] = fr->scratch - 8 * i;
+    }
+    for (int i = 0; i < n; i++) {
+        if (IR_LOC_IS_REG(dst[i])) {
+            ira_ld_loc(cg, ira_saved[IR_LOC_INDEX(dst[i])], src[i]);
+        } else {
+            ira_ld_loc(cg, "x10", src[i]);
+            safe_str_a64(cg, "x10", dst[i]);
+        }
+    }
+    free(dst);
+    free(src);
+    if (s != next) {
+        char l[64];
+        ira_label(cg, seq, s, l, sizeof(l));
+        emit(cg, "    b       %s", l);
+    }
+}
+
+/* IR_SWITCH as irx_switch: the key in x10, non-integral numbers and
+ * non-numbers take the default, dense keys go through an adr-relative
+ * table of .word offsets.                                                */
+static void ira_switch(CG *cg, int seq, IRInstr *in) {
+    char dflt[64], l[64], tab[64];
+    IRInstr *v = in->args[0];
+    ira_label(cg, seq, in->cases[0], dflt, sizeof(dflt));
+    ira_ld(cg, "x10", v);
+    if (v->type != IRT_I64) {
+        if (v->type == IRT_F64) {
+            emit(cg, "    fmov    d0, x10");
+        } else {
+            emit(cg, "    cbz     x10, %s", dflt);
+            emit(cg, "    ldr     w9, [x10]");                 /* VAL_NUMBER */
+            emit(cg, "    cbnz    w9, %s", dflt);
+            emit(cg, "    ldr     d0, [x10, #8]");
+        }
+        emit(cg, "    fcvtzs  x10, d0");
+        emit(cg, "    scvtf   d1, x10");
+        emit(cg, "    fcmp    d0, d1");
+        emit(cg, "    b.ne    %s", dflt);                     /* NaN too */
+    }
+    int n = in->ncases - 1;
+    long long lo = 0, hi = 0;
+    for (int c = 1; c <= n; c++) {
+        if (c == 1 || in->keys[c] < lo) lo = in->keys[c];
+        if (c == 1 || in->keys[c] > hi) hi = in->keys[c];
+    }
+    if (!switch_use_table(lo, hi, n)) {
+        for (int c = 1; c <= n; c++) {
+            ira_label(cg, seq, in->cases[c], l, sizeof(l));
+            ira_mov_imm(cg, "x11", (unsigned long long)in->keys[c]);
+            emit(cg, "    cmp     x10, x11");
+            emit(cg, "    b.eq    %s", l);
+        }
+        emit(cg, "    b       %s", dflt);
+        return;
+    }
+    fresh_label(cg, tab, sizeof(tab));
+    if (lo) {
+        ira_mov_imm(cg, "x11", (unsigned long long)lo);
+        emit(cg, "    sub     x10, x10, x11");
+    }
+    ira_mov_imm(cg, "x11", (unsigned long long)(hi - lo));
+    emit(cg, "    cmp     x10, x11");
+    emit(cg, "    b.hi    %s", dflt);
+    emit(cg, "    adr     x11, %s", tab);
+    emit(cg, "    ldrsw   x9, [x11, x10, lsl #2]");
+    emit(cg, "    add     x11, x11, x9");
+    emit(cg, "    br      x11");
+    emit(cg, "    .p2align 2");
+    emit(cg, "%s:", tab);
+    for (long long k = lo; k <= hi; k++) {
+        IRBlock *to = in->cases[0];
+        for (int c = 1; c <= n; c++)
+            if (in->keys[c] == k) { to = in->cases[c]; break; }
+        ira_label(cg, seq, to, l, sizeof(l));
+        emit(cg, "    .word   %s-%s", l, tab);
+    }
+    cg->stat_jump_tables++;
+}
+
+/* Frame: [saved x29/x30][value slots] — x29 points at the saved pair;
+ * the callee-saved registers in use are kept in the first value slots.
+ * ira_leave() restores them and pops the frame; x0-x7 are left alone.   */
+static void ira_leave(CG *cg, IRFrame *fr, int frame) {
+    int fp_adj = frame - 16;
+    for (int r = 0; r < fr->nsaved; r++)
+        safe_ldr_a64(cg, ira_saved[r], fr->save_slot - 8 * r);
+    ira_add_imm(cg, "sp", "x29", -fp_adj);
+    if (fp_adj <= 504) {
+        emit(cg, "    ldp     x29, x30, [sp, #%d]", fp_adj);
+    } else {
+        ira_add_imm(cg, "x10", "sp", fp_adj);
+        emit(cg, "    ldp     x29, x30, [x10]");
+    }
+    ira_add_imm(cg, "sp", "sp", frame);
+}
+
+static void ira_epilogue(CG *cg, IRFunc *f, IRFrame *fr, int frame) {
+    if (f->is_main) {
+        emit(cg, "    mov     w0, #0");
+        emit(cg, "    bl      " XLY_SYM("xly_exit"));
+    }
+    ira_leave(cg, fr, frame);
+    emit(cg, "    ret");
+}
+
+static void ira_instr(CG *cg, IRFunc *f, IRFrame *fr, int frame, int seq,
+                      IRInstr *in, IRBlock *next) {
+    char l[64], l2[64], b[256];
+    int bytes;
+    if (cg->verbose && in->op != IR_PHI && in->op != IR_PARAM)
+        emit(cg, "    // %%%d = %s", in->id, ir_op_name(in->op));
+
+    switch (in->op) {
+    case IR_CONST_NUM:
+        if (in->type == IRT_F64) {
+            union { double d; unsigned long long u; } c = { in->num };
+            if (c.u == 0) emit(cg, "    mov     x0, xzr");
+            else          ira_mov_imm(cg, "x0", c.u);
+            break;
+        }
+        ir_const_box_label(cg, seq, in, l, sizeof(l));
+        emit_adrp_a64(cg, "x0", l);
+        break;
+    case IR_CONST_STR:
+        emit_adrp_a64(cg, "x0", intern_string(cg, in->sym));
+        emit(cg, "    bl      " XLY_SYM("xly_str"));
+        break;
+    case IR_CONST_BOOL:
+        emit(cg, "    mov     w0, #%d", (int)in->imm);
+        emit(cg, "    bl      " XLY_SYM("xly_bool"));
+        break;
+    case IR_CONST_NULL:
+        emit(cg, "    bl      " XLY_SYM("xly_null"));
+        break;
+    case IR_ICONST:
+        ira_mov_imm(cg, "x0", (unsigned long long)in->imm);
+        break;
+
+    case IR_PARAM:
+    case IR_PHI:
+        return;
+    case IR_CAPTURE:
+        safe_ldr_a64(cg, "x10", fr->env_slot);
+        emit(cg, "    ldr     x0, [x10, #%d]", (int)in->imm * 8);
+        break;
+    case IR_GLOBAL_LOAD:
+        ira_sym_addr(cg, "x10", "__xly_globals");
+        emit(cg, "    ldr     x0, [x10, #%d]", (int)in->imm * 8);
+        break;
+    case IR_GLOBAL_STORE:
+        ira_ld(cg, "x11", in->args[0]);
+        ira_sym_addr(cg, "x10", "__xly_globals");
+        emit(cg, "    str     x11, [x10, #%d]", (int)in->imm * 8);
+        return;
+
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+        ira_arith(cg, in);
+        break;
+    case IR_LT: case IR_GT: case IR_LE: case IR_GE: case IR_EQ: case IR_NE:
+        ira_compare(cg, in);
+        break;
+    case IR_NEG:
+        if (in->type == IRT_F64) {
+            ira_ld(cg, "x0", in->args[0]);
+            if (in->args[0]->type != IRT_F64) emit(cg, "    ldr     x0, [x0, #8]");
+            emit(cg, "    eor     x0, x0, #0x8000000000000000");
+            break;
+        }
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_neg"));
+        break;
+    case IR_BOX:
+        if (ir_const_box(in)) {
+            ir_const_box_label(cg, seq, in, l, sizeof(l));
+            emit_adrp_a64(cg, "x0", l);
+            break;
+        }
+        ira_ld(cg, "x10", in->args[0]);
+        emit(cg, "    fmov    d0, x10");
+        ira_box_d0(cg, in);
+        break;
+    case IR_NOT:
+    case IR_TYPEOF:
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    bl      %s", in->op == IR_NOT ? XLY_SYM("xly_not")
+                                                    : XLY_SYM("xly_typeof"));
+        break;
+    case IR_TRUTHY:
+        if (in->args[0]->type == IRT_F64) {             /* != 0, NaN is truthy */
+            ira_ld(cg, "x10", in->args[0]);
+            emit(cg, "    fmov    d0, x10");
+            emit(cg, "    fcmp    d0, #0.0");
+            emit(cg, "    cset    x0, ne");
+            break;
+        }
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_truthy"));
+        emit(cg, "    mov     w0, w0");
+        break;
+    case IR_IS_MISSING:
+        ira_ld(cg, "x10", in->args[0]);
+        emit(cg, "    cmp     x10, #0");
+        emit(cg, "    cset    x0, eq");
+        break;
+
+    case IR_IADD:
+        ira_ld(cg, "x10", in->args[0]);
+        ira_ld(cg, "x11", in->args[1]);
+        emit(cg, "    add     x0, x10, x11");
+        break;
+    case IR_ILT:
+    case IR_IEQ:
+        ira_ld(cg, "x10", in->args[0]);
+        ira_ld(cg, "x11", in->args[1]);
+        emit(cg, "    cmp     x10, x11");
+        emit(cg, "    cset    x0, %s", in->op == IR_ILT ? "lt" : "eq");
+        break;
+
+    case IR_ARRAY:
+        bytes = ira_array(cg, in->args, in->nargs);
+        ira_array_ptr(cg, bytes, "x0");
+        emit(cg, "    mov     x1, #%d", in->nargs);
+        emit(cg, "    bl      " XLY_SYM("xly_array_create"));
+        ira_release(cg, bytes);
+        break;
+    case IR_ARRAY_LEN:
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_array_len"));
+        break;
+    case IR_ARRAY_GET:
+    case IR_INDEX:
+        ira_ld(cg, "x0", in->args[0]);
+        ira_ld(cg, "x1", in->args[1]);
+        emit(cg, "    bl      %s", in->op == IR_INDEX ? XLY_SYM("xly_index")
+                                                      : XLY_SYM("xly_array_get"));
+        break;
+    case IR_INDEX_SET:
+        ira_ld(cg, "x0", in->args[0]);
+        ira_ld(cg, "x1", in->args[1]);
+        ira_ld(cg, "x2", in->args[2]);
+        emit(cg, "    bl      " XLY_SYM("xly_index_set"));
+        break;
+    case IR_OBJECT_NEW:
+        emit(cg, "    bl      " XLY_SYM("xly_obj_new"));
+        break;
+    case IR_PROP_GET:
+        ira_ld(cg, "x0", in->args[0]);
+        emit_atom_a64(cg, "x1", in->sym);
+        emit(cg, "    bl      " XLY_SYM("xly_obj_get_atom"));
+        break;
+    case IR_PROP_SET:
+        ira_ld(cg, "x0", in->args[0]);
+        ira_ld(cg, "x2", in->args[1]);
+        emit_atom_a64(cg, "x1", in->sym);
+        emit(cg, "    bl      " XLY_SYM("xly_obj_set_atom"));
+        return;
+    case IR_NEW:
+        snprintf(b, sizeof(b), ".Lxly_class_%d", (int)in->imm);
+        emit_adrp_a64(cg, "x0", b);
+        emit(cg, "    bl      " XLY_SYM("xly_new"));
+        break;
+    case IR_FIELD_GET:                      /* this->instance->vals[slot] */
+        fresh_label(cg, l, sizeof(l));
+        ira_ld(cg, "x10", in->args[0]);
+        emit(cg, "    ldr     x10, [x10, #72]");
+        emit(cg, "    ldr     x10, [x10, #8]");
+        emit(cg, "    ldr     x0, [x10, #%d]", (int)in->imm * 8);
+        emit(cg, "    cbnz    x0, %s", l);
+        emit(cg, "    bl      " XLY_SYM("xly_null"));    /* not assigned yet */
+        emit(cg, "%s:", l);
+        break;
+    case IR_FIELD_SET:
+        ira_ld(cg, "x10", in->args[0]);
+        ira_ld(cg, "x11", in->args[1]);
+        emit(cg, "    ldr     x10, [x10, #72]");
+        emit(cg, "    ldr     x10, [x10, #8]");
+        emit(cg, "    str     x11, [x10, #%d]", (int)in->imm * 8);
+        return;
+    case IR_INSTANCEOF:
+        ira_ld(cg, "x0", in->args[0]);
+        snprintf(b, sizeof(b), ".Lxly_class_%d", (int)in->imm);
+        emit_adrp_a64(cg, "x1", b);
+        emit(cg, "    bl      " XLY_SYM("xly_instanceof"));
+        break;
+    case IR_MAKE_FN:
+        snprintf(b, sizeof(b), ".Lxly_fn_%s", in->sym);
+        emit_adrp_a64(cg, "x0", b);
+        if (in->imm) {                                  /* takes a receiver */
+            emit(cg, "    mov     x1, xzr");
+            emit(cg, "    mov     w2, wzr");
+            emit(cg, "    bl      " XLY_SYM("xly_make_method"));
+        } else {
+            emit(cg, "    bl      " XLY_SYM("xly_make_fn"));
+        }
+        break;
+    case IR_GEN_FN:
+        snprintf(b, sizeof(b), ".Lxly_fn_%s", in->sym);
+        emit_adrp_a64(cg, "x0", b);
+        emit(cg, "    bl      " XLY_SYM("xly_gen_fn"));
+        break;
+    case IR_MAKE_CLOSURE:
+        bytes = ira_array(cg, in->args, in->nargs);
+        snprintf(b, sizeof(b), ".Lxly_fn_%s", in->sym);
+        emit_adrp_a64(cg, "x0", b);
+        emit(cg, "    mov     x1, sp");
+        emit(cg, "    mov     w2, #%d", in->nargs);
+        emit(cg, "    bl      %s", in->imm ? XLY_SYM("xly_make_method") : XLY_SYM("xly_make_closure"));
+        ira_release(cg, bytes);
+        break;
+    case IR_MAKE_VARIANT:
+        bytes = ira_array(cg, in->args, in->nargs);
+        emit_adrp_a64(cg, "x0", intern_string(cg, in->sym));
+        emit(cg, "    bl      " XLY_SYM("xly_str"));
+        ira_array_ptr(cg, bytes, "x1");
+        emit(cg, "    mov     w2, #%d", in->nargs);
+        emit(cg, "    mov     w3, #%d", (int)in->imm);
+        emit(cg, "    bl      " XLY_SYM("xly_make_variant"));
+        ira_release(cg, bytes);
+        break;
+    case IR_VARIANT_TAG:
+        fresh_label(cg, l, sizeof(l));
+        ira_ld(cg, "x10", in->args[0]);
+        emit(cg, "    mov     x0, #-1");
+        emit(cg, "    cbz     x10, %s", l);
+        emit(cg, "    ldr     w9, [x10]");
+        emit(cg, "    cmp     w9, #12");                       /* VAL_ENUM_VARIANT */
+        emit(cg, "    b.ne    %s", l);
+        emit(cg, "    ldrsw   x0, [x10, #24]");                /* tag id      */
+        emit(cg, "%s:", l);
+        break;
+    case IR_VARIANT_FIELD:
+        fresh_label(cg, l,  sizeof(l));
+        fresh_label(cg, l2, sizeof(l2));
+        ira_ld(cg, "x10", in->args[0]);
+        emit(cg, "    ldr     x11, [x10, #120]");              /* field_count */
+        emit(cg, "    cmp     x11, #%d", (int)in->imm);
+        emit(cg, "    b.ls    %s", l);
+        emit(cg, "    ldr     x10, [x10, #112]");              /* fields      */
+        emit(cg, "    ldr     x0, [x10, #%d]", (int)in->imm * 8);
+        emit(cg, "    b       %s", l2);
+        emit(cg, "%s:", l);
+        emit(cg, "    bl      " XLY_SYM("xly_null"));
+        emit(cg, "%s:", l2);
+        break;
+
+    case IR_CALL: {
+        if (in->type == IRT_F64) {                      /* raw-f64 entry */
+            for (int i = 0; i < in->nargs; i++) {
+                ira_ld(cg, "x10", in->args[i]);
+                emit(cg, "    fmov    d%d, x10", i);
+            }
+            if (in->tail) {
+                ira_leave(cg, fr, frame);
+                emit(cg, "    b       .Lxly_fn_%s__num", in->sym);
+                return;
+            }
+            emit(cg, "    bl      .Lxly_fn_%s__num", in->sym);
+            emit(cg, "    fmov    x0, d0");
+            break;
+        }
+        int upto = in->imm < 0 ? 8 : (in->imm < 8 ? (int)in->imm : 8);
+        for (int i = 0; i < in->nargs; i++) ira_ld(cg, ira_regs[i], in->args[i]);
+        for (int i = in->nargs; i < upto; i++)
+            emit(cg, "    mov     %s, xzr", ira_regs[i]);
+        if (in->tail) {                                 /* reuse our frame */
+            ira_leave(cg, fr, frame);
+            emit(cg, "    b       .Lxly_fn_%s", in->sym);
+            return;
+        }
+        emit(cg, "    bl      .Lxly_fn_%s", in->sym);
+        break;
+    }
+    case IR_CALL_VALUE:
+        bytes = ira_array(cg, in->args + 1, in->nargs - 1);
+        ira_ld(cg, "x0", in->args[0]);
+        ira_array_ptr(cg, bytes, "x1");
+        emit(cg, "    mov     w2, #%d", in->nargs - 1);
+        emit(cg, "    bl      " XLY_SYM("xly_call_fnval"));
+        ira_release(cg, bytes);
+        break;
+    case IR_SPAWN:
+        bytes = ira_array(cg, in->args + 1, in->nargs - 1);
+        ira_ld(cg, "x0", in->args[0]);
+        ira_array_ptr(cg, bytes, "x1");
+        emit(cg, "    mov     w2, #%d", in->nargs - 1);
+        emit(cg, "    bl      " XLY_SYM("xly_spawn"));
+        ira_release(cg, bytes);
+        break;
+    case IR_CALL_MODULE:
+        bytes = ira_array(cg, in->args, in->nargs);
+        emit_adrp_a64(cg, "x0", intern_string(cg, in->sym));
+        emit_adrp_a64(cg, "x1", intern_string(cg, in->sym2));
+        ira_array_ptr(cg, bytes, "x2");
+        emit(cg, "    mov     x3, #%d", in->nargs);
+        emit(cg, "    bl      " XLY_SYM("xly_call_module"));
+        ira_release(cg, bytes);
+        break;
+    case IR_CALL_NATIVE:
+        if (in->type == IRT_F64) {                      /* inline on raw numbers */
+            if (in->imm == IR_NATIVE_ABS) {
+                ira_ld(cg, "x0", in->args[0]);
+                emit(cg, "    and     x0, x0, #0x7fffffffffffffff");
+                break;
+            }
+            ira_ld_num(cg, 0, in->args[0]);
+            if (in->imm == IR_NATIVE_SQRT) {
+                emit(cg, "    fsqrt   d0, d0");
+            } else {                                    /* a < b ? a : b, a > b ? a : b */
+                ira_ld_num(cg, 1, in->args[1]);
+                emit(cg, "    fcmp    d0, d1");
+                emit(cg, "    fcsel   d0, d0, d1, %s", in->imm == IR_NATIVE_MIN ? "mi" : "gt");
+            }
+            emit(cg, "    fmov    x0, d0");
+            break;
+        }
+        bytes = ira_array(cg, in->args, in->nargs);
+        ira_array_ptr(cg, bytes, "x0");
+        emit(cg, "    mov     x1, #%d", in->nargs);
+        emit(cg, "    bl      %s", in->sym);
+        ira_release(cg, bytes);
+        break;
+    case IR_CALL_METHOD:
+        bytes = ira_array(cg, in->args + 1, in->nargs - 1);
+        ira_ld(cg, "x0", in->args[0]);
+        emit_adrp_a64(cg, "x1", intern_string(cg, in->sym));
+        ira_array_ptr(cg, bytes, "x2");
+        emit(cg, "    mov     w3, #%d", in->nargs - 1);
+        emit(cg, "    bl      " XLY_SYM("xly_obj_call"));
+        ira_release(cg, bytes);
+        break;
+    case IR_GEN_NEXT:
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_for_of_next"));
+        break;
+    case IR_CALL_VIRT: {
+        /* vtable dispatch as on x86-64: receiver in x0, omitted params
+         * zeroed, xly_obj_call for anything that is not a class instance */
+        fresh_label(cg, l,  sizeof(l));
+        fresh_label(cg, l2, sizeof(l2));
+        int sel = (int)in->imm;
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    cbz     x0, %s", l);
+        emit(cg, "    ldr     w16, [x0]");
+        emit(cg, "    cmp     w16, #10");                      /* VAL_INSTANCE */
+        emit(cg, "    b.ne    %s", l);
+        emit(cg, "    ldr     x16, [x0, #72]");                /* ->instance   */
+        emit(cg, "    ldr     x16, [x16, #32]");               /* store->cls   */
+        emit(cg, "    cbz     x16, %s", l);
+        emit(cg, "    ldr     x17, [x16, #40]");               /* cls->nslots  */
+        ira_mov_imm(cg, "x10", (unsigned long long)sel);
+        emit(cg, "    cmp     x17, x10");
+        emit(cg, "    b.le    %s", l);
+        emit(cg, "    ldr     x16, [x16, #48]");               /* cls->vtable  */
+        emit(cg, "    ldr     x16, [x16, #%d]", sel * 8);
+        emit(cg, "    cbz     x16, %s", l);
+        for (int i = 1; i < in->nargs; i++) ira_ld(cg, ira_regs[i], in->args[i]);
+        for (int i = in->nargs; i < 8; i++)
+            emit(cg, "    mov     %s, xzr", ira_regs[i]);
+        emit(cg, "    blr     x16");
+        emit(cg, "    b       %s", l2);
+        emit(cg, "%s:", l);
+        bytes = ira_array(cg, in->args + 1, in->nargs - 1);
+        emit_adrp_a64(cg, "x1", intern_string(cg, in->sym));
+        ira_array_ptr(cg, bytes, "x2");
+        emit(cg, "    mov     w3, #%d", in->nargs - 1);
+        emit(cg, "    bl      " XLY_SYM("xly_obj_call"));
+        ira_release(cg, bytes);
+        emit(cg, "%s:", l2);
+        break;
+    }
+    case IR_PRINT:
+        bytes = ira_array(cg, in->args, in->nargs);
+        emit(cg, "    mov     x0, sp");
+        emit(cg, "    mov     x1, #%d", in->nargs);
+        emit(cg, "    bl      " XLY_SYM("xly_print"));
+        ira_release(cg, bytes);
+        return;
+    case IR_YIELD:
+        ira_ld(cg, "x0", in->args[0]);
+        emit(cg, "    bl      " XLY_SYM("xly_gen_yield"));
+        return;
+
+    case IR_MATCH_FAIL:
+        ira_mov_imm(cg, "x0", (unsigned long long)in->imm);
+        emit(cg, "    bl      " XLY_SYM("xly_match_fail"));
+        return;
+    case IR_SAFEPOINT:
+        emit_safepoint_a64(cg);
+        return;
+
+    case IR_JMP:
+        ira_edge(cg, fr, seq, in->block, in->target[0], next);
+        return;
+    case IR_SWITCH:
+        ira_switch(cg, seq, in);
+        return;
+    case IR_BR:
+        ira_label(cg, seq, in->target[0], l,  sizeof(l));
+        ira_label(cg, seq, in->target[1], l2, sizeof(l2));
+        ira_ld(cg, "x10", in->args[0]);
+        if (in->target[0] == next) {
+            emit(cg, "    cbz     x10, %s", l2);
+        } else {
+            emit(cg, "    cbnz    x10, %s", l);
+            if (in->target[1] != next) emit(cg, "    b       %s", l2);
+        }
+        return;
+    case IR_RET:
+        if (in->nargs > 0 && in->args[0]->op == IR_CALL && in->args[0]->tail)
+            return;                                     /* the callee returns */
+        if (in->nargs > 0) ira_ld(cg, "x0", in->args[0]);
+        if (in->nargs > 0 && f->num_abi) emit(cg, "    fmov    d0, x0");
+        ira_epilogue(cg, f, fr, frame);
+        return;
+    case IR_UNREACHABLE:
+        emit(cg, "    brk     #1");
+        return;
+    default:
+        return;
+    }
+    if (in->type != IRT_VOID)
+        ira_st_loc(cg, "x0", ir_loc(in));
+}
+
+static void ira_emit_func(CG *cg, IRFunc *f) {
+    IRFrame fr;
+    int nreg = 8 - (f->ncaptures > 0 ? 1 : 0);
+    ir_frame_layout(cg, f, nreg, IRA_NSAVED, &fr);
+    int frame  = fr.bytes + 16;
+    int fp_adj = frame - 16;
+    int seq = cg->label_seq++;
+
+    ira_add_imm(cg, "sp", "sp", -frame);
+    if (fp_adj <= 504) {
+        emit(cg, "    stp     x29, x30, [sp, #%d]", fp_adj);
+    } else {
+        ira_add_imm(cg, "x10", "sp", fp_adj);
+        emit(cg, "    stp     x29, x30, [x10]");
+    }
+    ira_add_imm(cg, "x29", "sp", fp_adj);
+    for (int i = 0; i < fr.nsaved; i++)
+        safe_str_a64(cg, ira_saved[i], fr.save_slot - 8 * i);
+    int r = 0;
+    if (f->ncaptures > 0)
+        safe_str_a64(cg, ira_regs[r++], fr.env_slot);
+
+    /* params: into their register or slot (see irx_emit_func) */
+    for (int bi = 0; bi < f->nblocks; bi++)
+    for (int i = 0; i < f->blocks[bi]->nins; i++) {
+        IRInstr *p = f->blocks[bi]->ins[i];
+        if (p->op != IR_PARAM) continue;
+        int k = (int)p->imm;
+        if (k >= nreg) {
+            if (p->reg >= 0) safe_ldr_a64(cg, ira_saved[p->reg], p->slot);
+        } else if (f->num_abi) {
+            emit(cg, "    fmov    x10, d%d", k);
+            ira_st_loc(cg, "x10", ir_loc(p));
+        } else {
+            ira_st_loc(cg, ira_regs[r + k], ir_loc(p));
+        }
+    }
+    if (fr.ncells) {
+        emit(cg, "    mov     w11, #-1");
+        for (int c = 0; c < fr.ncells; c++) {
+            ira_add_imm(cg, "x10", "x29", fr.cells + c * IR_CELL_BYTES);
+            for (int off = 0; off < IR_CELL_BYTES; off += 16)
+                emit(cg, "    stp     xzr, xzr, [x10, #%d]", off);
+            emit(cg, "    str     w11, [x10, #36]");    /* refcount = XLY_NOT_HEAP */
+        }
+    }
+
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *blk = f->blocks[bi];
+        IRBlock *next = bi + 1 < f->nblocks ? f->blocks[bi + 1] : NULL;
+        if (bi > 0) {
+            char l[64];
+            ira_label(cg, seq, blk, l, sizeof(l));
+            emit(cg, "%s:", l);
+        }
+        for (int i = 0; i < blk->nins; i++)
+            ira_instr(cg, f, &fr, frame, seq, blk->ins[i], next);
+    }
+    ir_emit_const_boxes(cg, f, seq);
+}
+
+/* Boxed entry forwarding to the raw-f64 body (see irx_num_forward). */
+static void ira_num_forward(CG *cg, int fi) {
+    int n = (int)cg->funcs[fi].node->param_count;
+    char boxed[64];
+    fresh_label(cg, boxed, sizeof(boxed));
+    for (int i = 0; i < n; i++) {
+        emit(cg, "    cbz     %s, %s", ira_regs[i], boxed);
+        emit(cg, "    ldr     w9, [%s]", ira_regs[i]);
+        emit(cg, "    cbnz    w9, %s", boxed);
+    }
+    for (int i = 0; i < n; i++)
+        emit(cg, "    ldr     d%d, [%s, #8]", i, ira_regs[i]);
+    emit(cg, "    stp     x29, x30, [sp, #-16]!");
+    emit(cg, "    mov     x29, sp");
+    emit(cg, "    bl      .Lxly_fn_%s__num", cg->funcs[fi].asm_label);
+    emit(cg, "    bl      " XLY_SYM("xly_num"));
+    emit(cg, "    ldp     x29, x30, [sp], #16");
+    emit(cg, "    ret");
+    emit(cg, "%s:", boxed);
+}
+
+static int emit_function_ir_a64(CG *cg, int fi) {
+    IRFunc *f = ir_lower_in_ctx(cg, fi, 1, 0);
+    if (!f) {
+        if (g_ir_dump)
+            fprintf(g_ir_dump, "; fn %s: not lowered (uses constructs the IR does not cover)\n\n",
+                    cg->funcs[fi].asm_label);
+        cg->stat_ir_fallback++;
+        return 0;
+    }
+    ir_finish(cg, f, 1);
+    emit(cg, "");
+    emit(cg, ".Lxly_fn_%s:", f->name);
+    if (cg->funcs[fi].num_entry) ira_num_forward(cg, fi);
+    ira_emit_func(cg, f);
+    ir_func_free(f);
+    if (cg->funcs[fi].num_entry && (f = ir_lower_in_ctx(cg, fi, 1, 1))) {
+        ir_finish(cg, f, 1);
+        emit(cg, "");
+        emit(cg, ".Lxly_fn_%s__num:", f->name);
+        ira_emit_func(cg, f);
+        ir_func_free(f);
+        cg->stat_ir_num_entries++;
+    }
+    cg->stat_ir_lowered++;
+    return 1;
 }
 
 #endif /* XLY_ARCH_ARM64 */
@@ -3502,22 +8979,82 @@ void codegen_set_opts(int opt_level, int verbose_asm) {
     g_verbose_asm = verbose_asm;
 }
 
-int codegen(ASTNode *program, const char *outpath) {
+void codegen_set_jobs(int jobs) {
+    g_jobs = jobs > 0 ? jobs : 0;
+}
+
+void codegen_set_profile_generate(const char *path) {
+    free(g_prof_gen);
+    g_prof_gen = path ? strdup(path) : NULL;
+}
+
+int codegen_load_profile(const char *path) {
+    return prof_load(path);
+}
+
+unsigned long long codegen_profile_hash(void) {
+    unsigned long long h = g_prof.hash;
+    if (g_prof_gen) h ^= str_hash(g_prof_gen) * 31 + 1;
+    return h;
+}
+
+void codegen_set_unit(const char *unit) {
+    free(g_unit);
+    g_unit = unit ? strdup(unit) : NULL;
+}
+
+void codegen_add_import(const char *path, const char *unit, const char *name, int arity) {
+    if (g_import_count >= g_import_cap) {
+        g_import_cap = g_import_cap ? g_import_cap * 2 : 16;
+        g_imports = realloc(g_imports, sizeof(g_imports[0]) * (size_t)g_import_cap);
+    }
+    UnitImport *u = &g_imports[g_import_count++];
+    char label[512];
+    if (name) snprintf(label, sizeof(label), "xlym_%s__%s", unit, name);
+    else      snprintf(label, sizeof(label), "xlym_%s", unit);
+    u->path  = strdup(path);
+    u->unit  = strdup(unit);
+    u->name  = name ? strdup(name) : NULL;
+    u->label = strdup(label);
+    u->arity = arity;
+}
+
+void codegen_clear_imports(void) {
+    for (int i = 0; i < g_import_count; i++) {
+        free(g_imports[i].path);
+        free(g_imports[i].unit);
+        free(g_imports[i].name);
+        free(g_imports[i].label);
+    }
+    g_import_count = 0;
+}
+
+int codegen_to(ASTNode *program, FILE *out) {
 #ifdef XLY_ARCH_ARM64
     /* ── ARM64 code generation ────────────────────────────────────────── */
     CG cg;
     memset(&cg, 0, sizeof(cg));
-    cg.out       = fopen(outpath, "w");
-    if (!cg.out) { perror("codegen: fopen"); return 1; }
+    cg.out       = out;
     cg.opt_level = g_opt_level;
     cg.verbose   = g_verbose_asm;
+    cg.cur_cls   = -1;
+    cg.body_fi   = -1;
 
     cg.a64_spill_depth = 0;
     cg.a64_sp_adj      = 0;
+    if (g_unit) {
+        fprintf(stderr, "[xenlyc] module units are only compiled for x86-64\n");
+        return 1;
+    }
 
     /* pre-pass: collect all declared function names for call-site dispatch */
+    cg.program = program;
+    unit_unwrap_exports(&cg, program);
     collect_fn_names(&cg, program);
+    collect_unit_imports(&cg, program);
     collect_variant_names(&cg, program);
+    collect_classes(&cg, program);
+    if (cg.opt_level >= 2) collect_call_sites(&cg, program);
     int n_top  = count_locals(program) + 16;
     /* main frame: locals + spill headroom (16 slots) + x29/x30, 16-aligned.
      * The +16 gives enough room for simultaneous spills at any expression depth.
@@ -3537,6 +9074,38 @@ int codegen(ASTNode *program, const char *outpath) {
 #if XLY_EMIT_GNU_STACK
     emit(&cg, "_start:");
 #endif
+    /* the collector's roots, as on x86-64 */
+    emit(&cg, "    stp     x29, x30, [sp, #-16]!");
+    emit_adrp_a64(&cg, "x0", XLY_SYM("__xly_globals"));
+    emit(&cg, "    adrp    x1, .Lxly_gvar_count@PAGE");
+    emit(&cg, "    ldr     x1, [x1, .Lxly_gvar_count@PAGEOFF]");
+    emit(&cg, "    add     x2, sp, #16");
+    emit(&cg, "    bl      " XLY_SYM("xly_gc_roots"));
+    emit_adrp_a64(&cg, "x0", ".Lxly_atoms");
+    emit(&cg, "    adrp    x1, .Lxly_atom_count@PAGE");
+    emit(&cg, "    ldr     x1, [x1, .Lxly_atom_count@PAGEOFF]");
+    emit(&cg, "    bl      " XLY_SYM("xly_atoms"));
+    for (int ci = 0; ci < cg.class_count; ci++) {
+        if (cg.classes[ci].nfields == 0) continue;
+        char fl[48];
+        snprintf(fl, sizeof(fl), ".Lxly_class_%d_fields", ci);
+        emit_adrp_a64(&cg, "x0", fl);
+        emit(&cg, "    mov     x1, #%d", cg.classes[ci].nfields);
+        emit(&cg, "    bl      " XLY_SYM("xly_atoms"));
+    }
+    emit(&cg, "    ldp     x29, x30, [sp], #16");
+    IRFunc *mainf = ir_lower_main(&cg, program, 1);
+    if (mainf) {
+        ir_plan_num_entries(&cg, 1);
+        ir_finish(&cg, mainf, 1);
+        ira_emit_func(&cg, mainf);
+        ir_func_free(mainf);
+        cg.stat_ir_lowered++;
+        goto a64_functions;
+    }
+    if (g_ir_dump)
+        fprintf(g_ir_dump, "; fn main: not lowered (uses constructs the IR does not cover)\n\n");
+    cg.stat_ir_fallback++;
     /* Same frame layout as emit_function_a64: allocate first, save pair at
      * TOP of frame, set x29 to saved-pair address so that locals at
      * [x29, #-8], [x29, #-16], ... remain within [sp, old_sp).            */
@@ -3568,10 +9137,19 @@ int codegen(ASTNode *program, const char *outpath) {
     emit(&cg, "    ret");
 
     /* user-defined functions */
-    for (int i = 0; i < cg.func_count; i++)
+a64_functions:
+    ir_plan_num_entries(&cg, 1);
+    for (int i = 0; i < cg.func_count; i++) {
+        if (emit_function_ir_a64(&cg, i)) continue;
+        cg.cur_cls = cg.funcs[i].cls;
         emit_function_a64(&cg, cg.funcs[i].node, cg.funcs[i].asm_label,
                           cg.funcs[i].rename_ctx, cg.funcs[i].rename_ctx_count,
                           cg.funcs[i].captures, cg.funcs[i].ncaptures);
+        cg.cur_cls = -1;
+    }
+
+    emit_class_tables(&cg);
+    emit_atom_table(&cg);
 
     /* string literals section */
     emit(&cg, "");
@@ -3598,17 +9176,20 @@ int codegen(ASTNode *program, const char *outpath) {
         fputs("\"\n", cg.out);
     }
 
-    /* Global variable storage for ARM64 */
-    if (cg.gvar_count > 0) {
-        emit(&cg, "");
-        emit(&cg, ".section __DATA,__bss");
-        emit(&cg, ".globl  " XLY_SYM("__xly_globals"));
-        emit(&cg, ".balign 8");
-        emit(&cg, XLY_SYM("__xly_globals") ":");
-        emit(&cg, "    .zero   %d", cg.gvar_count * 8);
-    }
+    /* Global variable storage for ARM64 (always: main registers it) */
+    emit(&cg, "");
+    emit(&cg, ".section __DATA,__const");
+    emit(&cg, ".balign 8");
+    emit(&cg, ".Lxly_gvar_count:");
+    emit(&cg, "    .quad   %d", cg.gvar_count);
+    emit(&cg, "");
+    emit(&cg, ".section __DATA,__bss");
+    emit(&cg, ".globl  " XLY_SYM("__xly_globals"));
+    emit(&cg, ".balign 8");
+    emit(&cg, XLY_SYM("__xly_globals") ":");
+    emit(&cg, "    .zero   %d", (cg.gvar_count ? cg.gvar_count : 1) * 8);
 
-    fclose(cg.out);
+    fflush(cg.out);
 
     for (int i = 0; i < cg.var_count; i++) free(cg.vars[i].name);
     free(cg.vars);
@@ -3616,6 +9197,9 @@ int codegen(ASTNode *program, const char *outpath) {
     free(cg.gvars);
     for (int i = 0; i < cg.str_count; i++) { free(cg.strings[i].text); free(cg.strings[i].label); }
     free(cg.strings);
+    for (int i = 0; i < cg.atom_count; i++)  { free(cg.atoms[i].text); free(cg.atoms[i].label); }
+    free(cg.atoms);
+    classes_free(&cg);
     for (int i = 0; i < cg.func_count; i++) {
         free(cg.funcs[i].asm_label);
         fn_rename_ctx_free(cg.funcs[i].rename_ctx, cg.funcs[i].rename_ctx_count);
@@ -3627,17 +9211,37 @@ int codegen(ASTNode *program, const char *outpath) {
     free(cg.fn_labels_used);
     for (int i = 0; i < cg.fn_rename_count; i++) { free(cg.fn_renames[i].src); free(cg.fn_renames[i].lbl); }
     free(cg.fn_renames);
+    cg_indexes_free(&cg);
+    call_sites_free(&cg);
     for (int i = 0; i < cg.variant_count; i++) free(cg.variants[i].name);
     free(cg.variants);
     for (int i = 0; i < cg.brk_top; i++) free(cg.brk_labels[i]);
     free(cg.brk_labels);
     for (int i = 0; i < cg.cnt_top; i++) free(cg.cnt_labels[i]);
     free(cg.cnt_labels);
+    unit_tables_free(&cg);
 
     return cg.had_error;
 
 #else
     /* ── x86-64 code generation (original) ───────────────────────────── */
-    return codegen_x86_64(program, outpath);
+    return codegen_x86_64(program, out);
 #endif
 }
+
+int codegen(ASTNode *program, const char *outpath) {
+    FILE *out = fopen(outpath, "w");
+    if (!out) { perror("codegen: fopen"); return 1; }
+    int rc = codegen_to(program, out);
+    if (fclose(out) != 0 && !rc) { perror("codegen: fclose"); rc = 1; }
+    return rc;
+}
+
+/* --emit-ir: run the whole pipeline, printing each function's optimized IR
+ * to `out` instead of keeping the assembly. */
+int codegen_emit_ir(ASTNode *program, FILE *out) {
+    g_ir_dump = out;
+    int rc = codegen(program, "/dev/null");
+    g_ir_dump = NULL;
+    return rc;
+}
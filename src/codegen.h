@@ -11,18 +11,26 @@
 #define CODEGEN_H
 
 #include "ast.h"
+#include <stdio.h>
 
 /*
  * codegen  —  AST  →  x86-64 System-V assembly text (.s)
  *
  * compile_program()  walks the AST once and writes a complete, self-contained
- * .s file to *outpath*.  The caller then invokes `as` + `gcc` to produce
- * the final ELF binary.
+ * .s file to *outpath*.  The caller then assembles it (xlas in-process, or
+ * the system assembler) and links the result.
  *
  * Returns 0 on success, non-zero on error.
  */
 int  codegen(ASTNode *program, const char *outpath);
 
+/*
+ * codegen_to  —  same as codegen(), writing the assembly to an open stream
+ * (the driver passes an open_memstream() buffer that it hands to xlas).
+ * The stream is flushed, not closed.
+ */
+int  codegen_to(ASTNode *program, FILE *out);
+
 /*
  * codegen_set_opts  —  configure codegen before calling codegen()
  *
@@ -31,4 +39,55 @@ int  codegen(ASTNode *program, const char *outpath);
  */
 void codegen_set_opts(int opt_level, int verbose_asm);
 
+/*
+ * codegen_set_jobs  —  threads the x86-64 backend emits function bodies on
+ * (0 = one per CPU, the default).  The output does not depend on it.
+ */
+void codegen_set_jobs(int jobs);
+
+/*
+ * Profile-guided optimization (x86-64)
+ *
+ *   codegen_set_profile_generate  instrument the next programs: branches,
+ *                        direct calls, boxed arithmetic and function entries
+ *                        are counted, and the program adds its counts to
+ *                        *path* when it exits.  NULL stops instrumenting.
+ *   codegen_load_profile use the counts in the .xeprof at *path* to lay out
+ *                        cold code apart and guide inlining.  Returns 0, or
+ *                        -1 if the file cannot be read.
+ *   codegen_profile_hash what the two settings above change in the output,
+ *                        for object cache keys (0 when neither is set).
+ */
+void codegen_set_profile_generate(const char *path);
+int  codegen_load_profile(const char *path);
+unsigned long long codegen_profile_hash(void);
+
+/*
+ * Separate compilation of imported user modules (x86-64 only)
+ *
+ *   codegen_set_unit     compile the next program as module unit *unit*:
+ *                        no main/_start; its top level becomes the run-once
+ *                        initializer xlym_<unit>, and every exported fn is
+ *                        also the global xlym_<unit>__<fn>.  NULL switches
+ *                        back to compiling the program itself.
+ *   codegen_add_import   declare what the next program may import: the
+ *                        module *path* (as written in `import`) is unit
+ *                        *unit*; call once with name NULL for the module,
+ *                        then once per exported fn with its arity.
+ *   codegen_clear_imports forget every declared import.
+ *
+ * Imports of modules that were not declared keep going through
+ * xly_call_module at run time.
+ */
+void codegen_set_unit(const char *unit);
+void codegen_add_import(const char *path, const char *unit, const char *name, int arity);
+void codegen_clear_imports(void);
+
+/*
+ * codegen_emit_ir  —  --emit-ir: print the optimized SSA IR of main and of
+ * every function to *out* (functions the IR does not cover yet are listed
+ * as such).  Uses the options set by codegen_set_opts().
+ */
+int  codegen_emit_ir(ASTNode *program, FILE *out);
+
 #endif /* CODEGEN_H */
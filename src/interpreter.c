@@ -43,15 +43,32 @@
 #include "multiproc.h"
 #include "lexer.h"
 #include "parser.h"
+#include "jit.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <stdatomic.h>
+#include "platform.h"
 
 // File-scope pointer to the active interpreter — set during interpreter_run.
 // Used by value_array to register arrays for shutdown cleanup.
 Interpreter *g_interp = NULL; /* non-static: used by xly_http callback shims */
 
+/* Pool worker threads evaluate Xenly code on their own Interpreter but must
+ * not append to g_interp's registries concurrently with the main thread.   */
+static _Thread_local int t_isolate = 0;
+#define XLY_TRACK_ALLOCS() (g_interp && !t_isolate)
+
+void interpreter_mark_isolate(void) { t_isolate = 1; }
+
+/* The user function whose body is being evaluated, for the JIT's heat
+ * counts (NULL with the JIT off and on isolates).  Loops add a back-edge
+ * per iteration; jit_call() adds the calls.  Heat a loop gathers is seen
+ * by the function's next call: running frames are not replaced.         */
+static _Thread_local FnDef *t_jit_fn = NULL;
+#define JIT_BACKEDGE() do { if (t_jit_fn) t_jit_fn->jit_heat++; } while (0)
+
 /* Forward declarations needed by generator and reflect eval cases */
 Value *call_value(Interpreter *interp, Value *fn_val, Value **args, size_t argc);
 Value *eval(Interpreter *interp, ASTNode *node, Environment *env); /* non-static: used by multiproc.c */
@@ -100,7 +117,7 @@ Value *value_array(Value **items, size_t len) {
     v->array_len = len;
     v->array_cap = items ? (len ? len : 4) : 0;
     // Register in global array list for shutdown cleanup
-    if (g_interp) {
+    if (XLY_TRACK_ALLOCS()) {
         if (g_interp->all_arrays_count >= g_interp->all_arrays_cap) {
             g_interp->all_arrays_cap = g_interp->all_arrays_cap ? g_interp->all_arrays_cap * 2 : 64;
             g_interp->all_arrays = (Value **)realloc(g_interp->all_arrays,
@@ -119,7 +136,7 @@ Value *value_variant(const char *tag, Value **fields, size_t field_count) {
     v->variant.fields = fields;  // takes ownership
     v->variant.field_count = field_count;
     // Register in global variant list for cleanup at shutdown
-    if (g_interp) {
+    if (XLY_TRACK_ALLOCS()) {
         if (g_interp->all_variants_count >= g_interp->all_variants_cap) {
             g_interp->all_variants_cap = g_interp->all_variants_cap ? g_interp->all_variants_cap * 2 : 64;
             g_interp->all_variants = (Value **)realloc(g_interp->all_variants,
@@ -673,6 +690,20 @@ static void do_import(Interpreter *interp, const char *modname, const char *alia
 }
 
 // ─── call_value: invoke a Xenly function value with pre-evaluated args ───────
+/* Evaluate a user function's body in fn_env, attributing loop heat (and,
+ * with --jit-stats, interpreted time) to fn. */
+static Value *eval_fn_body(Interpreter *interp, FnDef *fn, Environment *fn_env) {
+    if (!g_jit_on || t_isolate) return eval(interp, fn->body, fn_env);
+    FnDef *outer = t_jit_fn;
+    JitTimer timer;
+    t_jit_fn = fn;
+    if (g_jit_stats) jit_time_begin(&timer);
+    Value *result = eval(interp, fn->body, fn_env);
+    if (g_jit_stats) jit_time_end(&timer, fn);
+    t_jit_fn = outer;
+    return result;
+}
+
 Value *call_value(Interpreter *interp, Value *fn_val, Value **args, size_t argc) {
     if (!fn_val) return value_null();
     if (fn_val->type == VAL_BUILTIN_FN) return fn_val->builtin_fn(args, argc);
@@ -747,6 +778,11 @@ Value *call_value(Interpreter *interp, Value *fn_val, Value **args, size_t argc)
         return iter;
     }
 
+    if (g_jit_on && !t_isolate) {
+        Value *native = jit_call(fn, args, argc);
+        if (native) return native;
+    }
+
     Environment *fn_env = env_create(fn->closure);
     // Copy args before binding — env_destroy will free the copies, not the originals
     for (size_t i = 0; i < argc && i < fn->param_count; i++) {
@@ -825,7 +861,7 @@ Value *call_value(Interpreter *interp, Value *fn_val, Value **args, size_t argc)
         return rv;
     }
 
-    Value *result = eval(interp, fn->body, fn_env);
+    Value *result = eval_fn_body(interp, fn, fn_env);
     if (result && result->type == VAL_RETURN) {
         Value *inner = result->inner;
         result->inner = NULL;
@@ -836,6 +872,365 @@ Value *call_value(Interpreter *interp, Value *fn_val, Value **args, size_t argc)
     return result ? result : value_null();
 }
 
+// ─── Parallel array operations ───────────────────────────────────────────────
+// array.parallelMap / parallelFilter / parallelReduce split the input into
+// chunks that runner tasks claim from an atomic cursor.  Runners execute on
+// the shared thread pool, each on its worker's isolate interpreter, and the
+// calling thread runs chunks too.  Results are written by index, so the merge
+// keeps input order.  Callbacks must pass par_check_fn(): they may read
+// their parameters, locals, consts holding primitives, modules and other
+// parallel-safe functions, but must not touch mutable outer state (a const
+// array or object is still mutable), change anything but their own locals
+// through a module call, or create closures.
+
+typedef enum { PAR_MAP, PAR_FILTER, PAR_REDUCE } ParOp;
+
+typedef struct {
+    ParOp    op;
+    Value   *fn;
+    Value  **items;
+    size_t   n;
+    size_t   chunk;
+    size_t   nchunks;
+    _Atomic size_t next;        // next chunk index to claim
+    Value  **out;               // MAP: n results; REDUCE: one partial per chunk
+    unsigned char *keep;        // FILTER: one flag per element
+} ParJob;
+
+static Value *par_copy(Value *v) {
+    if (!v || v->type == VAL_NULL) return value_null();
+    if (v->type == VAL_NUMBER) return value_number(v->num);
+    if (v->type == VAL_STRING) return value_string(v->str);
+    if (v->type == VAL_BOOL)   return value_bool(v->boolean);
+    return v;   // shared types are never freed by value_destroy
+}
+
+static void par_run_chunks(ParJob *job, Interpreter *interp) {
+    for (;;) {
+        size_t c = atomic_fetch_add(&job->next, 1);
+        if (c >= job->nchunks) return;
+        size_t lo = c * job->chunk;
+        size_t hi = lo + job->chunk < job->n ? lo + job->chunk : job->n;
+
+        switch (job->op) {
+            case PAR_MAP:
+                for (size_t k = lo; k < hi; k++) {
+                    Value *r = call_value(interp, job->fn, &job->items[k], 1);
+                    job->out[k] = r ? r : value_null();
+                }
+                break;
+            case PAR_FILTER:
+                for (size_t k = lo; k < hi; k++) {
+                    Value *r = call_value(interp, job->fn, &job->items[k], 1);
+                    job->keep[k] = (unsigned char)(r && r->type != VAL_NULL &&
+                                   !(r->type == VAL_BOOL && !r->boolean));
+                    value_destroy(r);
+                }
+                break;
+            case PAR_REDUCE: {
+                Value *acc = par_copy(job->items[lo]);
+                for (size_t k = lo + 1; k < hi; k++) {
+                    Value *call_args[2] = { acc, job->items[k] };
+                    Value *next = call_value(interp, job->fn, call_args, 2);
+                    value_destroy(acc);
+                    acc = next ? next : value_null();
+                }
+                job->out[c] = acc;
+                break;
+            }
+        }
+    }
+}
+
+static void par_task(void *ctx, Interpreter *isolate) {
+    par_run_chunks((ParJob *)ctx, isolate);
+}
+
+// ── Purity check ────────────────────────────────────────────────────────────
+typedef struct {
+    const char **items;
+    size_t count, cap;
+} ParNames;
+
+static void par_names_add(ParNames *ns, const char *name) {
+    if (!name) return;
+    if (ns->count >= ns->cap) {
+        ns->cap = ns->cap ? ns->cap * 2 : 16;
+        ns->items = (const char **)realloc(ns->items, sizeof(char *) * ns->cap);
+    }
+    ns->items[ns->count++] = name;
+}
+
+static int par_names_has(const ParNames *ns, const char *name) {
+    for (size_t i = 0; i < ns->count; i++)
+        if (strcmp(ns->items[i], name) == 0) return 1;
+    return 0;
+}
+
+typedef struct {
+    Interpreter *interp;
+    FnDef      **fns;           // functions already checked (handles recursion)
+    size_t       fn_count;
+    char         why[192];
+} ParCheck;
+
+static int par_check_fn(ParCheck *pc, FnDef *fn);
+
+static EnvEntry *par_find_entry(Environment *env, const char *name) {
+    for (Environment *e = env; e; e = e->parent)
+        for (EnvEntry *entry = e->entries; entry; entry = entry->next)
+            if (strcmp(entry->name, name) == 0) return entry;
+    return NULL;
+}
+
+static int par_is_module_name(Interpreter *interp, const char *name) {
+    for (size_t i = 0; i < interp->module_count; i++)
+        if (strcmp(interp->modules[i].name, name) == 0) return 1;
+    for (size_t i = 0; i < interp->user_module_count; i++)
+        if (strcmp(interp->user_modules[i].name, name) == 0) return 1;
+    return 0;
+}
+
+// Every name a function binds itself counts as local for the whole body.
+static void par_collect_locals(ASTNode *n, ParNames *locals) {
+    if (!n) return;
+    switch (n->type) {
+        case NODE_VAR_DECL: case NODE_CONST_DECL: case NODE_LET_DECL:
+        case NODE_FOR_IN:   case NODE_FOR_OF:
+            par_names_add(locals, n->str_value);
+            break;
+        default: break;
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        par_collect_locals(n->children[i], locals);
+}
+
+static int par_check_outer_read(ParCheck *pc, FnDef *fn, const char *name) {
+    EnvEntry *e = par_find_entry(fn->closure, name);
+    if (!e) return 1;                   // builtin or undefined: nothing shared
+    Value *v = e->value;
+    if (v && (v->type == VAL_BUILTIN_FN || v->type == VAL_CLASS)) return 1;
+    if (v && v->type == VAL_FUNCTION) return par_check_fn(pc, v->fn);
+    if (par_is_module_name(pc->interp, name)) return 1;
+    if (e->is_const && (!v || v->type == VAL_NULL || v->type == VAL_NUMBER ||
+                        v->type == VAL_STRING || v->type == VAL_BOOL)) return 1;
+    snprintf(pc->why, sizeof(pc->why), e->is_const
+             ? "'%s' shares outer const '%s', whose value is mutable"
+             : "'%s' captures mutable outer variable '%s'", fn->name, name);
+    return 0;
+}
+
+// Module functions that change their first argument in place.
+static const char *const par_mutators[] = {
+    "array.set", "array.push", "array.pop", "array.shift", "array.unshift", "array.fill",
+    "reflect.set", "reflect.delete", "reflect.define", "reflect.freeze",
+    NULL
+};
+
+// A call to one of par_mutators is fine on the callback's own locals only.
+static int par_check_module_call(ParCheck *pc, FnDef *fn, ParNames *locals, ASTNode *n) {
+    ASTNode *mod = n->children[0];
+    if (!mod || mod->type != NODE_IDENTIFIER || !n->str_value ||
+        par_names_has(locals, mod->str_value) ||
+        !par_is_module_name(pc->interp, mod->str_value)) return 1;
+    char full[128];
+    snprintf(full, sizeof(full), "%s.%s", mod->str_value, n->str_value);
+    for (const char *const *m = par_mutators; *m; m++) {
+        if (strcmp(*m, full) != 0) continue;
+        ASTNode *recv = n->child_count > 1 ? n->children[1] : NULL;
+        if (recv && recv->type == NODE_IDENTIFIER && par_names_has(locals, recv->str_value))
+            return 1;
+        snprintf(pc->why, sizeof(pc->why),
+                 "'%s' calls %s on a value it does not own", fn->name, full);
+        return 0;
+    }
+    return 1;
+}
+
+static int par_check_node(ParCheck *pc, FnDef *fn, ParNames *locals, ASTNode *n) {
+    if (!n) return 1;
+    const char *target = NULL;
+    switch (n->type) {
+        case NODE_IDENTIFIER:
+            if (!par_names_has(locals, n->str_value) &&
+                !par_check_outer_read(pc, fn, n->str_value)) return 0;
+            break;
+        case NODE_FN_CALL:
+            if (n->str_value && !par_names_has(locals, n->str_value) &&
+                !par_check_outer_read(pc, fn, n->str_value)) return 0;
+            break;
+        case NODE_METHOD_CALL:
+            if (n->child_count && !par_check_module_call(pc, fn, locals, n)) return 0;
+            break;
+        case NODE_ASSIGN: case NODE_INCREMENT: case NODE_DECREMENT:
+            target = n->str_value;
+            break;
+        case NODE_COMPOUND_ASSIGN:
+            target = n->child_count ? n->children[0]->str_value : NULL;
+            break;
+        case NODE_INDEX_ASSIGN: case NODE_PROPERTY_SET: case NODE_COMPUTED_PROP_SET:
+        case NODE_REFLECT_SET:  case NODE_REFLECT_DEFINE:
+        case NODE_REFLECT_DELETE: case NODE_REFLECT_FREEZE:
+            if (n->child_count && n->children[0]->type == NODE_IDENTIFIER)
+                target = n->children[0]->str_value;
+            break;
+        case NODE_THIS: case NODE_SUPER_CALL:
+            snprintf(pc->why, sizeof(pc->why), "'%s' uses 'this'", fn->name);
+            return 0;
+        case NODE_SPAWN: case NODE_AWAIT:
+            snprintf(pc->why, sizeof(pc->why), "'%s' spawns tasks", fn->name);
+            return 0;
+        case NODE_FN_DECL: case NODE_ARROW_FN: case NODE_GEN_DECL: case NODE_BLOCK_FN:
+        case NODE_BLOCK_CALL: case NODE_CLASS_DECL: case NODE_IMPORT: case NODE_EXPORT:
+            snprintf(pc->why, sizeof(pc->why),
+                     "'%s' creates closures or declarations", fn->name);
+            return 0;
+        default: break;
+    }
+    if (target && !par_names_has(locals, target)) {
+        snprintf(pc->why, sizeof(pc->why),
+                 "'%s' mutates outer variable '%s'", fn->name, target);
+        return 0;
+    }
+    for (size_t i = 0; i < n->child_count; i++)
+        if (!par_check_node(pc, fn, locals, n->children[i])) return 0;
+    return 1;
+}
+
+static int par_check_fn(ParCheck *pc, FnDef *fn) {
+    if (!fn || !fn->body) return 1;     // variant constructors
+    for (size_t i = 0; i < pc->fn_count; i++)
+        if (pc->fns[i] == fn) return 1; // already checked (or recursing)
+    pc->fns = (FnDef **)realloc(pc->fns, sizeof(FnDef *) * (pc->fn_count + 1));
+    pc->fns[pc->fn_count++] = fn;
+    if (fn->pure) return 1;             // ast_optimize proved it
+    if (fn->is_generator || fn->is_async) {
+        snprintf(pc->why, sizeof(pc->why), "'%s' is a generator or async function", fn->name);
+        return 0;
+    }
+
+    ParNames locals = { NULL, 0, 0 };
+    for (size_t i = 0; i < fn->param_count; i++)
+        par_names_add(&locals, fn->params[i].name);
+    par_collect_locals(fn->body, &locals);
+    int ok = par_check_node(pc, fn, &locals, fn->body);
+    free(locals.items);
+    return ok;
+}
+
+static size_t par_option(Value *opts, const char *key, size_t dflt) {
+    if (!opts || opts->type != VAL_INSTANCE || !opts->instance) return dflt;
+    Value *v = env_get(opts->instance->fields, key);
+    if (!v || v->type != VAL_NUMBER || v->num < 1) return dflt;
+    return (size_t)v->num;
+}
+
+// array.parallelMap(arr, fn, {chunk, workers})
+// array.parallelFilter(arr, fn, {chunk, workers})
+// array.parallelReduce(arr, fn, initial, {chunk, workers})  — fn must be associative
+static Value *par_array_op(Interpreter *interp, ParOp op, const char *fnname,
+                           Value **args, size_t argc) {
+    size_t need = op == PAR_REDUCE ? 3 : 2;
+    if (argc < need || args[0]->type != VAL_ARRAY ||
+        (args[1]->type != VAL_FUNCTION && args[1]->type != VAL_BUILTIN_FN)) {
+        fprintf(stderr, "\033[1;31m[Xenly Error] array.%s expects (array, fn%s, options?).\033[0m\n",
+                fnname, op == PAR_REDUCE ? ", initial" : "");
+        interp->had_error = 1;
+        return op == PAR_REDUCE ? value_null() : value_array(NULL, 0);
+    }
+    Value *arr  = args[0];
+    Value *fn   = args[1];
+    Value *opts = argc > need ? args[need] : NULL;
+
+    if (fn->type == VAL_FUNCTION) {
+        ParCheck pc;
+        memset(&pc, 0, sizeof(pc));
+        pc.interp = interp;
+        int ok = par_check_fn(&pc, fn->fn);
+        free(pc.fns);
+        if (!ok) {
+            fprintf(stderr, "\033[1;31m[Xenly Error] array.%s: callback is not parallel-safe: %s.\033[0m\n",
+                    fnname, pc.why);
+            interp->had_error = 1;
+            return op == PAR_REDUCE ? value_null() : value_array(NULL, 0);
+        }
+    }
+
+    size_t n = arr->array_len;
+    if (n == 0) return op == PAR_REDUCE ? par_copy(args[2]) : value_array(NULL, 0);
+
+    long ncpu = xly_cpu_count();
+    size_t workers = par_option(opts, "workers", ncpu > 0 ? (size_t)ncpu : 1);
+    size_t chunk   = par_option(opts, "chunk", (n + workers * 4 - 1) / (workers * 4));
+
+    ParJob job;
+    memset(&job, 0, sizeof(job));
+    job.op      = op;
+    job.fn      = fn;
+    job.items   = arr->array;
+    job.n       = n;
+    job.chunk   = chunk;
+    job.nchunks = (n + chunk - 1) / chunk;
+    atomic_init(&job.next, 0);
+    if (op == PAR_MAP)    job.out  = (Value **)malloc(sizeof(Value *) * n);
+    if (op == PAR_REDUCE) job.out  = (Value **)malloc(sizeof(Value *) * job.nchunks);
+    if (op == PAR_FILTER) job.keep = (unsigned char *)malloc(n);
+
+    // The caller is one runner; the rest go to the shared pool.
+    size_t runners = workers < job.nchunks ? workers : job.nchunks;
+    Future **futs = NULL;
+    if (runners > 1) {
+        ThreadPool *pool = thread_pool_shared();
+        futs = (Future **)malloc(sizeof(Future *) * (runners - 1));
+        for (size_t i = 0; i + 1 < runners; i++)
+            futs[i] = thread_pool_submit_native(pool, par_task, &job);
+    }
+    par_run_chunks(&job, interp);
+    for (size_t i = 0; i + 1 < runners; i++) {
+        future_get(futs[i]);
+        future_destroy(futs[i]);
+    }
+    free(futs);
+
+    switch (op) {
+        case PAR_MAP:
+            return value_array(job.out, n);
+        case PAR_FILTER: {
+            Value **out = (Value **)malloc(sizeof(Value *) * n);
+            size_t out_n = 0;
+            for (size_t k = 0; k < n; k++)
+                if (job.keep[k]) out[out_n++] = par_copy(arr->array[k]);
+            free(job.keep);
+            return value_array(out, out_n);
+        }
+        case PAR_REDUCE: {
+            // Combine chunk partials pairwise (tree-shaped, order-preserving),
+            // then fold the initial value in on the left.
+            size_t count = job.nchunks;
+            while (count > 1) {
+                size_t half = 0;
+                for (size_t i = 0; i + 1 < count; i += 2) {
+                    Value *call_args[2] = { job.out[i], job.out[i + 1] };
+                    Value *r = call_value(interp, fn, call_args, 2);
+                    value_destroy(job.out[i]);
+                    value_destroy(job.out[i + 1]);
+                    job.out[half++] = r ? r : value_null();
+                }
+                if (count & 1) job.out[half++] = job.out[count - 1];
+                count = half;
+            }
+            Value *init = par_copy(args[2]);
+            Value *call_args[2] = { init, job.out[0] };
+            Value *r = call_value(interp, fn, call_args, 2);
+            value_destroy(init);
+            value_destroy(job.out[0]);
+            free(job.out);
+            return r ? r : value_null();
+        }
+    }
+    return value_null();
+}
+
 // ─── Call a Module Function ──────────────────────────────────────────────────
 static Value *call_module_fn(Interpreter *interp, const char *modname,
                              const char *fnname, Value **args, size_t argc) {
@@ -846,6 +1241,13 @@ static Value *call_module_fn(Interpreter *interp, const char *modname,
             if (argc < 1 || args[0]->type != VAL_ARRAY) return value_number(0);
             return value_number((double)args[0]->array_len);
         }
+        // array.parallelMap / parallelFilter / parallelReduce — chunked over the pool
+        if (strcmp(fnname, "parallelMap") == 0)
+            return par_array_op(interp, PAR_MAP, fnname, args, argc);
+        if (strcmp(fnname, "parallelFilter") == 0)
+            return par_array_op(interp, PAR_FILTER, fnname, args, argc);
+        if (strcmp(fnname, "parallelReduce") == 0)
+            return par_array_op(interp, PAR_REDUCE, fnname, args, argc);
         // array.map(arr, fn) — returns new array with fn applied to each element
         if (strcmp(fnname, "map") == 0) {
             if (argc < 2 || args[0]->type != VAL_ARRAY) return value_array(NULL, 0);
@@ -1189,7 +1591,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
                 env_set(env, variant_name, variant_val);
             } else {
                 // Variant with params: create a constructor function
-                FnDef *constructor = (FnDef *)malloc(sizeof(FnDef));
+                FnDef *constructor = (FnDef *)calloc(1, sizeof(FnDef));
                 constructor->name = strdup(variant_name);
                 // Deep copy params
                 constructor->param_count = param_count;
@@ -1297,13 +1699,14 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
         Value *fnval = (Value *)calloc(1, sizeof(Value));
         fnval->type      = VAL_FUNCTION;
         fnval->fn_shared = 0;  // this Value owns the FnDef
-        fnval->fn   = (FnDef *)malloc(sizeof(FnDef));
+        fnval->fn   = (FnDef *)calloc(1, sizeof(FnDef));
         fnval->fn->name       = strdup(node->str_value);
         fnval->fn->params     = node->params;
         fnval->fn->param_count = node->param_count;
         fnval->fn->body       = node->children[0]; // the block
         fnval->fn->closure    = env;               // capture current env
         fnval->fn->is_async   = (int)node->num_value;  // async flag from parser
+        fnval->fn->pure       = (node->fn_flags & AST_FN_PURE) != 0;
         env_retain(env);                           // increment refcount
         env_set(env, node->str_value, fnval);
         return value_null();
@@ -1379,6 +1782,17 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
             return result;
         }
 
+        // Hot function: run it natively when it is compiled for these args
+        if (named_count == 0 && g_jit_on && !t_isolate) {
+            Value *native = jit_call(fn, args, positional_count);
+            if (native) {
+                for (size_t i = 0; i < positional_count; i++)
+                    value_destroy(args[i]);
+                free(args);
+                return native;
+            }
+        }
+
         // Create new scope from closure
         Environment *fn_env = env_create(fn->closure);
         
@@ -1430,7 +1844,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
             }
         }
 
-        Value *result = eval(interp, fn->body, fn_env);
+        Value *result = eval_fn_body(interp, fn, fn_env);
 
         // Unwrap return sentinel
         if (result && result->type == VAL_RETURN) {
@@ -1526,6 +1940,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
             value_destroy(cond);
             if (!truthy) break;
 
+            JIT_BACKEDGE();
             value_destroy(result);
             result = eval(interp, node->children[1], env);  // body
             if (result && result->type == VAL_RETURN) return result;  // bubble up
@@ -1556,6 +1971,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
             value_destroy(cond);
             if (!truthy) break;
             
+            JIT_BACKEDGE();
             value_destroy(result);
             result = eval(interp, node->children[3], env);  // body
             if (result && result->type == VAL_RETURN) return result;
@@ -1581,6 +1997,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
         // children[0] = body, children[1] = condition
         Value *result = value_null();
         do {
+            JIT_BACKEDGE();
             value_destroy(result);
             result = eval(interp, node->children[0], env);  // body
             if (result && result->type == VAL_RETURN) return result;
@@ -1689,7 +2106,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
         Value *fnval = (Value *)calloc(1, sizeof(Value));
         fnval->type      = VAL_FUNCTION;
         fnval->fn_shared = 0;  // this Value owns the FnDef
-        fnval->fn   = (FnDef *)malloc(sizeof(FnDef));
+        fnval->fn   = (FnDef *)calloc(1, sizeof(FnDef));
         fnval->fn->name        = strdup("<arrow>");
         fnval->fn->params      = node->params;
         fnval->fn->param_count = node->param_count;
@@ -2096,7 +2513,7 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
             // Create a VAL_FUNCTION for this method, capturing current env as closure
             Value *fnval = (Value *)calloc(1, sizeof(Value));
             fnval->type = VAL_FUNCTION;
-            fnval->fn   = (FnDef *)malloc(sizeof(FnDef));
+            fnval->fn   = (FnDef *)calloc(1, sizeof(FnDef));
             fnval->fn->name        = strdup(method_node->str_value);
             fnval->fn->params      = method_node->params;
             fnval->fn->param_count = method_node->param_count;
@@ -2137,12 +2554,14 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
         instance->type     = VAL_INSTANCE;
         instance->instance = inst;
         // Register in global instance registry (freed once at shutdown)
-        if (g_interp->all_instances_count >= g_interp->all_instances_cap) {
-            g_interp->all_instances_cap = g_interp->all_instances_cap ? g_interp->all_instances_cap * 2 : 64;
-            g_interp->all_instances = (Value **)realloc(g_interp->all_instances,
-                sizeof(Value *) * g_interp->all_instances_cap);
+        if (XLY_TRACK_ALLOCS()) {
+            if (g_interp->all_instances_count >= g_interp->all_instances_cap) {
+                g_interp->all_instances_cap = g_interp->all_instances_cap ? g_interp->all_instances_cap * 2 : 64;
+                g_interp->all_instances = (Value **)realloc(g_interp->all_instances,
+                    sizeof(Value *) * g_interp->all_instances_cap);
+            }
+            g_interp->all_instances[g_interp->all_instances_count++] = instance;
         }
-        g_interp->all_instances[g_interp->all_instances_count++] = instance;
 
         // Register instance in its own fields as 'this' isn't strictly needed here —
         // 'this' is bound when calling methods. But we store instance in a local var.
@@ -2344,12 +2763,14 @@ Value *eval(Interpreter *interp, ASTNode *node, Environment *env) {
         obj->type     = VAL_INSTANCE;
         obj->instance = inst;
         // Register in global instance registry (freed once at shutdown)
-        if (g_interp->all_instances_count >= g_interp->all_instances_cap) {
-            g_interp->all_instances_cap = g_interp->all_instances_cap ? g_interp->all_instances_cap * 2 : 64;
-            g_interp->all_instances = (Value **)realloc(g_interp->all_instances,
-                sizeof(Value *) * g_interp->all_instances_cap);
+        if (XLY_TRACK_ALLOCS()) {
+            if (g_interp->all_instances_count >= g_interp->all_instances_cap) {
+                g_interp->all_instances_cap = g_interp->all_instances_cap ? g_interp->all_instances_cap * 2 : 64;
+                g_interp->all_instances = (Value **)realloc(g_interp->all_instances,
+                    sizeof(Value *) * g_interp->all_instances_cap);
+            }
+            g_interp->all_instances[g_interp->all_instances_count++] = obj;
         }
-        g_interp->all_instances[g_interp->all_instances_count++] = obj;
         return obj;
     }
 
@@ -45,6 +45,9 @@ typedef struct {
     Environment *closure;   // captured env at definition time
     int      is_async;      // 1 = async function (can be spawned)
     int      is_generator;  // 0=normal, 1=gen template, 2=next() step fn
+    int      pure;          // AST_FN_PURE: reads only its arguments
+    unsigned long jit_heat; // calls + loop back-edges, counted for the JIT
+    struct JitFn *jit;      // JIT state (jit.c), NULL until it is tracked
 } FnDef;
 
 // ─── Class definition (stored inside a VAL_CLASS value) ─────────────────────
@@ -175,6 +178,11 @@ Interpreter *interpreter_create(void);
 void         interpreter_destroy(Interpreter *interp);
 void         interpreter_set_source_dir(Interpreter *interp, const char *dir);
 Value       *interpreter_run(Interpreter *interp, ASTNode *program);
+// Call on a pool worker thread before it evaluates anything: values it
+// allocates are no longer recorded in the main interpreter's shutdown
+// registries, which are not thread-safe.
+void         interpreter_mark_isolate(void);
+Value       *call_value(Interpreter *interp, Value *fn_val, Value **args, size_t argc);
 
 // Value helpers
 Value *value_number(double n);
@@ -0,0 +1,1901 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * ir.c  —  Xenly SSA IR: construction, optimization passes, printer
+ *
+ * Target-independent half of the mid-level IR (see ir.h).  The AST lowering
+ * and the x86-64 / arm64 emitters live in codegen.c because they share the
+ * codegen tables (variables, globals, function labels, string pool).
+ */
+#include "ir.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <math.h>
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * CONSTRUCTION
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+IRFunc *ir_func_new(const char *name, int nparams, int ncaptures, int is_main) {
+    IRFunc *f = calloc(1, sizeof(IRFunc));
+    f->name      = strdup(name ? name : "?");
+    f->nparams   = nparams;
+    f->ncaptures = ncaptures;
+    f->is_main   = is_main;
+    return f;
+}
+
+static void block_free(IRBlock *b);
+
+static void instr_free(IRInstr *in) {
+    free(in->args);
+    free(in->cases);
+    free(in->keys);
+    free(in->sym);
+    free(in->sym2);
+    free(in->prof);
+    free(in);
+}
+
+void ir_func_free(IRFunc *f) {
+    if (!f) return;
+    for (int i = 0; i < f->nblocks; i++) {
+        IRBlock *b = f->blocks[i];
+        for (int j = 0; j < b->nins; j++) instr_free(b->ins[j]);
+        block_free(b);
+    }
+    for (int i = 0; i < f->ngrave; i++) instr_free(f->graveyard[i]);
+    free(f->graveyard);
+    free(f->blocks);
+    free(f->name);
+    free(f);
+}
+
+IRBlock *ir_block_new(IRFunc *f) {
+    IRBlock *b = calloc(1, sizeof(IRBlock));
+    b->id  = f->next_block_id++;
+    b->rpo = -1;
+    if (f->nblocks >= f->blocks_cap) {
+        f->blocks_cap = f->blocks_cap ? f->blocks_cap * 2 : 16;
+        f->blocks = realloc(f->blocks, sizeof(IRBlock*) * (size_t)f->blocks_cap);
+    }
+    f->blocks[f->nblocks++] = b;
+    return b;
+}
+
+static IRInstr *instr_new(IRFunc *f, IROp op, IRType type) {
+    IRInstr *in = calloc(1, sizeof(IRInstr));
+    in->id   = f->next_id++;
+    in->op   = op;
+    in->type = type;
+    in->reg  = -1;
+    return in;
+}
+
+static void block_insert(IRBlock *b, int at, IRInstr *in) {
+    if (b->nins >= b->ins_cap) {
+        b->ins_cap = b->ins_cap ? b->ins_cap * 2 : 8;
+        b->ins = realloc(b->ins, sizeof(IRInstr*) * (size_t)b->ins_cap);
+    }
+    memmove(&b->ins[at + 1], &b->ins[at], sizeof(IRInstr*) * (size_t)(b->nins - at));
+    b->ins[at] = in;
+    b->nins++;
+    in->block = b;
+}
+
+static void block_add_pred(IRBlock *b, IRBlock *p) {
+    if (b->npreds >= b->preds_cap) {
+        b->preds_cap = b->preds_cap ? b->preds_cap * 2 : 4;
+        b->preds = realloc(b->preds, sizeof(IRBlock*) * (size_t)b->preds_cap);
+    }
+    b->preds[b->npreds++] = p;
+}
+
+IRInstr *ir_emit(IRFunc *f, IRBlock *b, IROp op, IRType type) {
+    IRInstr *in = instr_new(f, op, type);
+    block_insert(b, b->nins, in);
+    return in;
+}
+
+void ir_add_arg(IRInstr *in, IRInstr *arg) {
+    if (in->nargs >= in->args_cap) {
+        in->args_cap = in->args_cap ? in->args_cap * 2 : 4;
+        in->args = realloc(in->args, sizeof(IRInstr*) * (size_t)in->args_cap);
+    }
+    in->args[in->nargs++] = arg;
+}
+
+IRInstr *ir_const_num(IRFunc *f, IRBlock *b, double n) {
+    IRInstr *in = ir_emit(f, b, IR_CONST_NUM, IRT_VAL);
+    in->num = n;
+    return in;
+}
+
+IRInstr *ir_binop(IRFunc *f, IRBlock *b, IROp op, IRType type, IRInstr *a, IRInstr *c) {
+    IRInstr *in = ir_emit(f, b, op, type);
+    ir_add_arg(in, a);
+    ir_add_arg(in, c);
+    return in;
+}
+
+IRInstr *ir_unop(IRFunc *f, IRBlock *b, IROp op, IRType type, IRInstr *a) {
+    IRInstr *in = ir_emit(f, b, op, type);
+    ir_add_arg(in, a);
+    return in;
+}
+
+int ir_is_terminator(IROp op) {
+    return op == IR_JMP || op == IR_BR || op == IR_SWITCH || op == IR_RET ||
+           op == IR_UNREACHABLE;
+}
+
+IRInstr *ir_terminator(IRBlock *b) {
+    for (int i = b->nins - 1; i >= 0; i--) {
+        if (b->ins[i]->dead) continue;
+        return ir_is_terminator(b->ins[i]->op) ? b->ins[i] : NULL;
+    }
+    return NULL;
+}
+
+void ir_jmp(IRFunc *f, IRBlock *b, IRBlock *to) {
+    IRInstr *in = ir_emit(f, b, IR_JMP, IRT_VOID);
+    in->target[0] = to;
+    block_add_pred(to, b);
+}
+
+void ir_br(IRFunc *f, IRBlock *b, IRInstr *cond, IRBlock *t, IRBlock *e) {
+    IRInstr *in = ir_emit(f, b, IR_BR, IRT_VOID);
+    ir_add_arg(in, cond);
+    in->target[0] = t;
+    in->target[1] = e;
+    block_add_pred(t, b);
+    block_add_pred(e, b);
+}
+
+static void switch_add(IRInstr *sw, long long key, IRBlock *to) {
+    if (sw->ncases >= sw->cases_cap) {
+        sw->cases_cap = sw->cases_cap ? sw->cases_cap * 2 : 8;
+        sw->cases = realloc(sw->cases, sizeof(IRBlock*) * (size_t)sw->cases_cap);
+        sw->keys  = realloc(sw->keys, sizeof(long long) * (size_t)sw->cases_cap);
+    }
+    sw->cases[sw->ncases] = to;
+    sw->keys[sw->ncases]  = key;
+    sw->ncases++;
+}
+
+IRInstr *ir_switch(IRFunc *f, IRBlock *b, IRInstr *v, IRBlock *dflt) {
+    IRInstr *in = ir_emit(f, b, IR_SWITCH, IRT_VOID);
+    ir_add_arg(in, v);
+    switch_add(in, 0, dflt);
+    block_add_pred(dflt, b);
+    return in;
+}
+
+void ir_switch_case(IRInstr *sw, long long key, IRBlock *to) {
+    switch_add(sw, key, to);
+    block_add_pred(to, sw->block);
+}
+
+void ir_ret(IRFunc *f, IRBlock *b, IRInstr *val) {
+    IRInstr *in = ir_emit(f, b, IR_RET, IRT_VOID);
+    if (val) ir_add_arg(in, val);     /* main returns nothing: it exits */
+}
+
+void ir_unreachable(IRFunc *f, IRBlock *b) {
+    ir_emit(f, b, IR_UNREACHABLE, IRT_VOID);
+}
+
+IRInstr *ir_resolve(IRInstr *v) {
+    while (v && v->repl) v = v->repl;
+    return v;
+}
+
+/* Mark `old` as replaced by `with`; users pick this up via ir_resolve(). */
+static void ir_replace(IRInstr *old, IRInstr *with) {
+    with = ir_resolve(with);
+    if (old == with) return;
+    old->repl = with;
+    old->dead = 1;
+}
+
+static int count_phis(IRBlock *b) {
+    int n = 0;
+    while (n < b->nins && b->ins[n]->op == IR_PHI) n++;
+    return n;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SSA CONSTRUCTION  (Braun et al. 2013)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* A block's defs are scanned while few; a long straight-line block (the
+ * top level of a big program) hashes them so each access stays O(1). */
+#define IR_DEFS_HASH_MIN 16
+
+static void block_def_slot(IRBlock *b, int i) {
+    unsigned m = (unsigned)b->def_slot_cap - 1;
+    unsigned k = ((unsigned)b->defs[i].var * 2654435761u) & m;
+    while (b->def_slots[k]) k = (k + 1) & m;
+    b->def_slots[k] = i + 1;
+}
+
+static int block_def_find(IRBlock *b, int var) {
+    if (b->def_slot_cap) {
+        unsigned m = (unsigned)b->def_slot_cap - 1;
+        for (unsigned k = ((unsigned)var * 2654435761u) & m; b->def_slots[k]; k = (k + 1) & m)
+            if (b->defs[b->def_slots[k] - 1].var == var) return b->def_slots[k] - 1;
+        return -1;
+    }
+    for (int i = 0; i < b->ndefs; i++)
+        if (b->defs[i].var == var) return i;
+    return -1;
+}
+
+void ir_write_var(IRBlock *b, int var, IRInstr *val) {
+    int i = block_def_find(b, var);
+    if (i >= 0) { b->defs[i].val = val; return; }
+    if (b->ndefs >= b->defs_cap) {
+        b->defs_cap = b->defs_cap ? b->defs_cap * 2 : 8;
+        b->defs = realloc(b->defs, sizeof(b->defs[0]) * (size_t)b->defs_cap);
+    }
+    b->defs[b->ndefs].var = var;
+    b->defs[b->ndefs].val = val;
+    b->ndefs++;
+    if (b->def_slot_cap && b->ndefs * 2 <= b->def_slot_cap) {
+        block_def_slot(b, b->ndefs - 1);
+    } else if (b->ndefs >= IR_DEFS_HASH_MIN) {
+        int cap = 64;
+        while (cap < b->ndefs * 4) cap *= 2;
+        free(b->def_slots);
+        b->def_slots    = calloc((size_t)cap, sizeof(int));
+        b->def_slot_cap = cap;
+        for (int k = 0; k < b->ndefs; k++) block_def_slot(b, k);
+    }
+}
+
+/* Value of a variable read before any write: null, like the interpreter. */
+static IRInstr *undef_value(IRFunc *f, IRBlock *b) {
+    IRInstr *in = instr_new(f, IR_CONST_NULL, IRT_VAL);
+    block_insert(b, count_phis(b), in);
+    return in;
+}
+
+static IRInstr *new_phi(IRFunc *f, IRBlock *b) {
+    IRInstr *in = instr_new(f, IR_PHI, IRT_VAL);
+    block_insert(b, count_phis(b), in);
+    return in;
+}
+
+static IRInstr *try_remove_trivial_phi(IRFunc *f, IRInstr *phi) {
+    IRInstr *same = NULL;
+    for (int i = 0; i < phi->nargs; i++) {
+        IRInstr *op = ir_resolve(phi->args[i]);
+        if (op == same || op == phi) continue;
+        if (same) return phi;               /* merges two values: real phi */
+        same = op;
+    }
+    if (!same) same = undef_value(f, phi->block);
+    ir_replace(phi, same);
+    return same;
+}
+
+static IRInstr *add_phi_operands(IRFunc *f, int var, IRInstr *phi) {
+    IRBlock *b = phi->block;
+    for (int i = 0; i < b->npreds; i++)
+        ir_add_arg(phi, ir_read_var(f, b->preds[i], var));
+    return try_remove_trivial_phi(f, phi);
+}
+
+static IRInstr *read_var_recursive(IRFunc *f, IRBlock *b, int var) {
+    IRInstr *val;
+    if (!b->sealed) {
+        val = new_phi(f, b);
+        if (b->nincomplete >= b->incomplete_cap) {
+            b->incomplete_cap = b->incomplete_cap ? b->incomplete_cap * 2 : 4;
+            b->incomplete = realloc(b->incomplete,
+                                    sizeof(b->incomplete[0]) * (size_t)b->incomplete_cap);
+        }
+        b->incomplete[b->nincomplete].var = var;
+        b->incomplete[b->nincomplete].phi = val;
+        b->nincomplete++;
+    } else if (b->npreds == 0) {
+        val = undef_value(f, b);
+    } else if (b->npreds == 1) {
+        val = ir_read_var(f, b->preds[0], var);
+    } else {
+        val = new_phi(f, b);
+        ir_write_var(b, var, val);        /* break cycles through loops */
+        val = add_phi_operands(f, var, val);
+    }
+    ir_write_var(b, var, val);
+    return val;
+}
+
+IRInstr *ir_read_var(IRFunc *f, IRBlock *b, int var) {
+    int i = block_def_find(b, var);
+    if (i >= 0) return ir_resolve(b->defs[i].val);
+    return ir_resolve(read_var_recursive(f, b, var));
+}
+
+void ir_seal_block(IRFunc *f, IRBlock *b) {
+    if (b->sealed) return;
+    for (int i = 0; i < b->nincomplete; i++)
+        add_phi_operands(f, b->incomplete[i].var, b->incomplete[i].phi);
+    b->nincomplete = 0;
+    b->sealed = 1;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * CFG UTILITIES
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* Removed instructions and blocks are parked until ir_func_free(): a
+ * forwarding chain or a stale SSA def table may still point at them. */
+static void bury_instr(IRFunc *f, IRInstr *in) {
+    if (f->ngrave >= f->grave_cap) {
+        f->grave_cap = f->grave_cap ? f->grave_cap * 2 : 64;
+        f->graveyard = realloc(f->graveyard, sizeof(IRInstr*) * (size_t)f->grave_cap);
+    }
+    f->graveyard[f->ngrave++] = in;
+}
+
+/* Rewrite every operand through its forwarding chain and drop dead
+ * instructions from the block arrays. */
+static void ir_compact(IRFunc *f) {
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        int w = 0;
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->dead) { bury_instr(f, in); continue; }
+            for (int a = 0; a < in->nargs; a++)
+                in->args[a] = ir_resolve(in->args[a]);
+            b->ins[w++] = in;
+        }
+        b->nins = w;
+    }
+}
+
+/* Successors of `b`: *out points into its terminator (assigning through it
+ * retargets the edge). */
+static int block_succs(IRBlock *b, IRBlock ***out) {
+    IRInstr *t = ir_terminator(b);
+    *out = NULL;
+    if (!t) return 0;
+    if (t->op == IR_JMP)    { *out = t->target; return 1; }
+    if (t->op == IR_BR)     { *out = t->target; return 2; }
+    if (t->op == IR_SWITCH) { *out = t->cases;  return t->ncases; }
+    return 0;
+}
+
+/* Remove the pred slot `k` of `b` together with the matching phi operands. */
+static void block_remove_pred_at(IRBlock *b, int k) {
+    for (int i = 0; i < b->nins; i++) {
+        IRInstr *in = b->ins[i];
+        if (in->op != IR_PHI) break;
+        if (in->dead || k >= in->nargs) continue;
+        memmove(&in->args[k], &in->args[k + 1],
+                sizeof(IRInstr*) * (size_t)(in->nargs - k - 1));
+        in->nargs--;
+    }
+    memmove(&b->preds[k], &b->preds[k + 1],
+            sizeof(IRBlock*) * (size_t)(b->npreds - k - 1));
+    b->npreds--;
+}
+
+static void block_remove_pred(IRBlock *b, IRBlock *p) {
+    for (int k = b->npreds - 1; k >= 0; k--)
+        if (b->preds[k] == p) { block_remove_pred_at(b, k); return; }
+}
+
+static void block_free(IRBlock *b) {
+    free(b->ins);
+    free(b->preds);
+    free(b->defs);
+    free(b->def_slots);
+    free(b->incomplete);
+    free(b);
+}
+
+void ir_order_blocks(IRFunc *f) {
+    if (f->nblocks == 0) return;
+    for (int i = 0; i < f->nblocks; i++) { f->blocks[i]->mark = 0; f->blocks[i]->rpo = -1; }
+
+    /* iterative DFS computing postorder */
+    IRBlock **post  = malloc(sizeof(IRBlock*) * (size_t)f->nblocks);
+    IRBlock **stack = malloc(sizeof(IRBlock*) * (size_t)f->nblocks);
+    int      *next  = calloc((size_t)f->next_block_id, sizeof(int));
+    int npost = 0, sp = 0;
+    stack[sp++] = f->blocks[0];
+    f->blocks[0]->mark = 1;
+    while (sp > 0) {
+        IRBlock *b = stack[sp - 1];
+        IRBlock **succ;
+        int ns = block_succs(b, &succ);
+        if (next[b->id] < ns) {
+            /* false edge first: the true target (then / loop body) then
+             * lands right after `b` in reverse postorder */
+            IRBlock *s = succ[ns - 1 - next[b->id]++];
+            if (!s->mark) { s->mark = 1; stack[sp++] = s; }
+        } else {
+            post[npost++] = b;
+            sp--;
+        }
+    }
+
+    /* unreachable blocks: detach them from their reachable successors,
+     * then bury their instructions */
+    for (int i = 0; i < f->nblocks; i++) {
+        IRBlock *b = f->blocks[i];
+        if (b->mark) continue;
+        IRBlock **succ;
+        int ns = block_succs(b, &succ);
+        for (int s = 0; s < ns; s++)
+            if (succ[s]->mark) block_remove_pred(succ[s], b);
+    }
+    for (int i = 0; i < f->nblocks; i++) {
+        IRBlock *b = f->blocks[i];
+        if (b->mark) continue;
+        for (int j = 0; j < b->nins; j++) {
+            b->ins[j]->dead  = 1;
+            b->ins[j]->block = NULL;
+            bury_instr(f, b->ins[j]);
+        }
+        block_free(b);
+    }
+    for (int i = npost - 1, k = 0; i >= 0; i--, k++) {
+        post[i]->rpo = k;
+        f->blocks[k] = post[i];
+    }
+    f->nblocks = npost;
+    free(post);
+    free(stack);
+    free(next);
+}
+
+/* Cooper, Harvey & Kennedy: "A Simple, Fast Dominance Algorithm".
+ * Requires blocks[] in reverse postorder (ir_order_blocks). */
+static IRBlock *dom_intersect(IRBlock *a, IRBlock *b) {
+    while (a != b) {
+        while (a->rpo > b->rpo) a = a->idom;
+        while (b->rpo > a->rpo) b = b->idom;
+    }
+    return a;
+}
+
+static void compute_dominators(IRFunc *f) {
+    for (int i = 0; i < f->nblocks; i++) f->blocks[i]->idom = NULL;
+    IRBlock *entry = f->blocks[0];
+    entry->idom = entry;
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int i = 1; i < f->nblocks; i++) {
+            IRBlock *b = f->blocks[i];
+            IRBlock *nd = NULL;
+            for (int p = 0; p < b->npreds; p++) {
+                IRBlock *pb = b->preds[p];
+                if (!pb->idom) continue;
+                nd = nd ? dom_intersect(pb, nd) : pb;
+            }
+            if (nd && b->idom != nd) { b->idom = nd; changed = 1; }
+        }
+    }
+}
+
+static int dominates(IRBlock *a, IRBlock *b) {
+    while (b) {
+        if (a == b) return 1;
+        if (b->idom == b) return 0;
+        b = b->idom;
+    }
+    return 0;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * OPCODE PROPERTIES
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* No side effects and result depends only on operands: CSE / LICM candidate */
+static int op_is_pure(IROp op) {
+    switch (op) {
+    case IR_CONST_NUM: case IR_CONST_STR: case IR_CONST_BOOL: case IR_CONST_NULL:
+    case IR_ICONST:
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+    case IR_LT: case IR_GT: case IR_LE: case IR_GE: case IR_EQ: case IR_NE:
+    case IR_NEG: case IR_NOT: case IR_TYPEOF: case IR_TRUTHY: case IR_IS_MISSING:
+    case IR_IADD: case IR_ILT: case IR_IEQ: case IR_INSTANCEOF:
+    case IR_VARIANT_TAG:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+/* Must be kept even when the result is unused */
+static int op_has_effects(IROp op) {
+    switch (op) {
+    case IR_INDEX_SET: case IR_PROP_SET: case IR_FIELD_SET:
+    case IR_CALL: case IR_CALL_VALUE: case IR_CALL_MODULE: case IR_CALL_NATIVE:
+    case IR_CALL_METHOD: case IR_CALL_VIRT: case IR_GEN_NEXT: case IR_SPAWN:
+    case IR_GLOBAL_STORE: case IR_PRINT: case IR_YIELD:
+    case IR_MATCH_FAIL: case IR_PROF_COUNT: case IR_SAFEPOINT:
+    case IR_JMP: case IR_BR: case IR_SWITCH: case IR_RET: case IR_UNREACHABLE:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int is_const_val(IRInstr *v) {
+    return v->op == IR_CONST_NUM || v->op == IR_CONST_STR ||
+           v->op == IR_CONST_BOOL || v->op == IR_CONST_NULL;
+}
+
+/* Mirrors xly_truthy() for compile-time constants */
+static int const_truthy(IRInstr *v) {
+    switch (v->op) {
+    case IR_CONST_NUM:  return v->num != 0.0;
+    case IR_CONST_STR:  return v->sym && v->sym[0] != '\0';
+    case IR_CONST_BOOL: return v->imm != 0;
+    default:            return 0;
+    }
+}
+
+/* Mirrors vals_equal() in xly_rt.c */
+static int const_equal(IRInstr *a, IRInstr *b) {
+    if (a->op != b->op) return 0;
+    switch (a->op) {
+    case IR_CONST_NUM:  return a->num == b->num;
+    case IR_CONST_STR:  return strcmp(a->sym, b->sym) == 0;
+    case IR_CONST_BOOL: return a->imm == b->imm;
+    default:            return 1;
+    }
+}
+
+/* Mirrors xly_to_cstr() for the scalar constants (string concat folding) */
+static void const_to_str(IRInstr *v, char *buf, size_t sz) {
+    switch (v->op) {
+    case IR_CONST_NUM:
+        if (v->num == (double)(long long)v->num && fabs(v->num) < 1e15)
+            snprintf(buf, sz, "%lld", (long long)v->num);
+        else
+            snprintf(buf, sz, "%g", v->num);
+        break;
+    case IR_CONST_BOOL: snprintf(buf, sz, "%s", v->imm ? "true" : "false"); break;
+    default:            snprintf(buf, sz, "null"); break;
+    }
+}
+
+/* Turn `in` into a constant in place (keeps its id and position). */
+static void make_const_num(IRInstr *in, double n) {
+    in->op = IR_CONST_NUM; in->type = IRT_VAL; in->num = n; in->nargs = 0;
+}
+static void make_const_bool(IRInstr *in, int b) {
+    if (in->type == IRT_BOOL) { in->op = IR_ICONST; in->imm = b ? 1 : 0; }
+    else { in->op = IR_CONST_BOOL; in->type = IRT_VAL; in->imm = b ? 1 : 0; }
+    in->nargs = 0;
+}
+static void make_const_str(IRInstr *in, const char *s) {
+    char *dup = strdup(s);
+    free(in->sym);
+    in->op = IR_CONST_STR; in->type = IRT_VAL; in->sym = dup; in->nargs = 0;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: constant propagation + branch folding
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static int *count_uses(IRFunc *f) {
+    int *uses = calloc((size_t)f->next_id + 1, sizeof(int));
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->dead) continue;
+            for (int a = 0; a < in->nargs; a++)
+                uses[ir_resolve(in->args[a])->id]++;
+        }
+    }
+    return uses;
+}
+
+/* Fold a single instruction; returns 1 if anything changed. */
+static int fold_instr(IRFunc *f, IRInstr *in, int *uses) {
+    for (int a = 0; a < in->nargs; a++) in->args[a] = ir_resolve(in->args[a]);
+    IRInstr *x = in->nargs > 0 ? in->args[0] : NULL;
+    IRInstr *y = in->nargs > 1 ? in->args[1] : NULL;
+
+    switch (in->op) {
+    case IR_PHI: {
+        IRInstr *same = NULL;
+        for (int a = 0; a < in->nargs; a++) {
+            IRInstr *op = in->args[a];
+            if (op == same || op == in) continue;
+            if (same) return 0;
+            same = op;
+        }
+        if (!same) return 0;
+        ir_replace(in, same);
+        return 1;
+    }
+
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+        if (x->op == IR_CONST_NUM && y->op == IR_CONST_NUM) {
+            double r;
+            switch (in->op) {
+            case IR_ADD: r = x->num + y->num; break;
+            case IR_SUB: r = x->num - y->num; break;
+            case IR_MUL: r = x->num * y->num; break;
+            case IR_DIV: r = x->num / y->num; break;
+            default:     r = y->num == 0.0 ? NAN : fmod(x->num, y->num); break;
+            }
+            make_const_num(in, r);
+            f->stat_folded++;
+            return 1;
+        }
+        /* constant string concatenation: "a" + 1 + "b" */
+        if (in->op == IR_ADD && is_const_val(x) && is_const_val(y) &&
+            (x->op == IR_CONST_STR || y->op == IR_CONST_STR)) {
+            char bx[64], by[64];
+            const char *sx = x->op == IR_CONST_STR ? x->sym : (const_to_str(x, bx, sizeof(bx)), bx);
+            const char *sy = y->op == IR_CONST_STR ? y->sym : (const_to_str(y, by, sizeof(by)), by);
+            size_t lx = strlen(sx), ly = strlen(sy);
+            char *cat = malloc(lx + ly + 1);
+            memcpy(cat, sx, lx); memcpy(cat + lx, sy, ly); cat[lx + ly] = '\0';
+            make_const_str(in, cat);
+            free(cat);
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_LT: case IR_GT: case IR_LE: case IR_GE:
+        if (x->op == IR_CONST_NUM && y->op == IR_CONST_NUM) {
+            int r = in->op == IR_LT ? x->num <  y->num :
+                    in->op == IR_GT ? x->num >  y->num :
+                    in->op == IR_LE ? x->num <= y->num : x->num >= y->num;
+            make_const_bool(in, r);
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_EQ: case IR_NE:
+        if (is_const_val(x) && is_const_val(y)) {
+            int r = const_equal(x, y);
+            make_const_bool(in, in->op == IR_EQ ? r : !r);
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_NEG:
+        if (x->op == IR_CONST_NUM) { make_const_num(in, -x->num); f->stat_folded++; return 1; }
+        return 0;
+
+    case IR_NOT:
+        if (is_const_val(x)) { make_const_bool(in, !const_truthy(x)); f->stat_folded++; return 1; }
+        return 0;
+
+    case IR_TYPEOF:
+        if (is_const_val(x)) {
+            make_const_str(in, x->op == IR_CONST_NUM ? "number" :
+                               x->op == IR_CONST_STR ? "string" :
+                               x->op == IR_CONST_BOOL ? "bool" : "null");
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_TRUTHY:
+        if (is_const_val(x)) {
+            in->op = IR_ICONST; in->imm = const_truthy(x); in->nargs = 0;
+            f->stat_folded++;
+            return 1;
+        }
+        /* truthy(cmp(a,b)) with no other users: let the compare produce the
+         * raw condition directly and skip boxing the intermediate bool.    */
+        if ((x->op == IR_LT || x->op == IR_GT || x->op == IR_LE ||
+             x->op == IR_GE || x->op == IR_EQ || x->op == IR_NE) &&
+            x->type == IRT_VAL && uses[x->id] == 1) {
+            x->type = IRT_BOOL;
+            ir_replace(in, x);
+            return 1;
+        }
+        return 0;
+
+    case IR_IS_MISSING:
+        if (x->op != IR_PARAM && x->op != IR_CAPTURE && x->op != IR_PHI &&
+            x->op != IR_GEN_NEXT) {
+            in->op = IR_ICONST; in->imm = 0; in->nargs = 0;
+            return 1;
+        }
+        return 0;
+
+    case IR_IADD:
+        if (x->op == IR_ICONST && y->op == IR_ICONST) {
+            in->op = IR_ICONST; in->imm = x->imm + y->imm; in->nargs = 0;
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_ILT:
+        if (x->op == IR_ICONST && y->op == IR_ICONST) {
+            in->op = IR_ICONST; in->imm = x->imm < y->imm; in->nargs = 0;
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_IEQ:
+        if (x->op == IR_ICONST && y->op == IR_ICONST) {
+            in->op = IR_ICONST; in->imm = x->imm == y->imm; in->nargs = 0;
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_VARIANT_TAG:
+        if (x->op == IR_MAKE_VARIANT || is_const_val(x)) {
+            in->op = IR_ICONST; in->imm = x->op == IR_MAKE_VARIANT ? x->imm : -1;
+            in->nargs = 0;
+            f->stat_folded++;
+            return 1;
+        }
+        return 0;
+
+    case IR_SWITCH: {
+        /* a known key (or a constant that is no integer) picks the target */
+        long long key = LLONG_MIN;          /* matches no case */
+        int k = 0;
+        if (x->op == IR_ICONST)
+            key = x->imm;
+        else if (x->op == IR_CONST_NUM && fabs(x->num) < 9e15 &&
+                 x->num == (double)(long long)x->num)
+            key = (long long)x->num;
+        else if (!is_const_val(x))
+            return 0;
+        for (int c = 1; c < in->ncases && !k; c++)
+            if (in->keys[c] == key) k = c;
+        for (int c = 0; c < in->ncases; c++)
+            if (c != k) block_remove_pred(in->cases[c], in->block);
+        in->op = IR_JMP;
+        in->nargs = 0;
+        in->target[0] = in->cases[k];
+        in->ncases = 0;
+        f->stat_branches++;
+        return 1;
+    }
+
+    case IR_BR: {
+        IRBlock *keep = NULL, *drop = NULL;
+        if (in->target[0] == in->target[1]) {
+            keep = drop = in->target[0];
+        } else if (x->op == IR_ICONST) {
+            keep = in->target[x->imm ? 0 : 1];
+            drop = in->target[x->imm ? 1 : 0];
+        }
+        if (!keep) return 0;
+        block_remove_pred(drop, in->block);
+        in->op = IR_JMP;
+        in->nargs = 0;
+        in->target[0] = keep;
+        in->target[1] = NULL;
+        f->stat_branches++;
+        return 1;
+    }
+
+    default:
+        return 0;
+    }
+}
+
+static void pass_constprop(IRFunc *f) {
+    int changed = 1, any_branch = 0;
+    while (changed) {
+        changed = 0;
+        int *uses = count_uses(f);
+        int branches_before = f->stat_branches;
+        for (int bi = 0; bi < f->nblocks; bi++) {
+            IRBlock *b = f->blocks[bi];
+            for (int i = 0; i < b->nins; i++) {
+                IRInstr *in = b->ins[i];
+                if (in->dead) continue;
+                if (fold_instr(f, in, uses)) changed = 1;
+            }
+        }
+        free(uses);
+        if (f->stat_branches != branches_before) any_branch = 1;
+        ir_compact(f);
+        if (any_branch) { ir_order_blocks(f); any_branch = 0; }
+    }
+}
+
+/* Phi cleanup only — used at -O0 so the emitted IR is still minimal SSA */
+static void pass_trivial_phis(IRFunc *f) {
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int bi = 0; bi < f->nblocks; bi++) {
+            IRBlock *b = f->blocks[bi];
+            for (int i = 0; i < b->nins && b->ins[i]->op == IR_PHI; i++) {
+                IRInstr *in = b->ins[i];
+                if (in->dead) continue;
+                if (fold_instr(f, in, NULL)) changed = 1;
+            }
+        }
+        ir_compact(f);
+    }
+    /* phis are created untyped (val); give them their operands' type so
+     * raw i64 loop counters are not mistaken for boxed values */
+    changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int bi = 0; bi < f->nblocks; bi++) {
+            IRBlock *b = f->blocks[bi];
+            for (int i = 0; i < b->nins && b->ins[i]->op == IR_PHI; i++) {
+                IRInstr *in = b->ins[i];
+                for (int a = 0; a < in->nargs; a++) {
+                    IRInstr *arg = in->args[a];
+                    if (arg->op == IR_PHI && arg->type == IRT_VAL) continue;
+                    if (arg->type != in->type) { in->type = arg->type; changed = 1; }
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: dead-code elimination (mark from side-effecting roots)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void pass_dce(IRFunc *f) {
+    IRInstr **work = NULL;
+    int nwork = 0, cap = 0;
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            in->mark = 0;
+            if (in->dead || !op_has_effects(in->op)) continue;
+            in->mark = 1;
+            if (nwork >= cap) { cap = cap ? cap * 2 : 64; work = realloc(work, sizeof(IRInstr*) * (size_t)cap); }
+            work[nwork++] = in;
+        }
+    }
+    while (nwork > 0) {
+        IRInstr *in = work[--nwork];
+        for (int a = 0; a < in->nargs; a++) {
+            IRInstr *arg = ir_resolve(in->args[a]);
+            if (arg->mark) continue;
+            arg->mark = 1;
+            if (nwork >= cap) { cap = cap ? cap * 2 : 64; work = realloc(work, sizeof(IRInstr*) * (size_t)cap); }
+            work[nwork++] = arg;
+        }
+    }
+    free(work);
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->dead || in->mark) continue;
+            in->dead = 1;
+            f->stat_dce++;
+        }
+    }
+    ir_compact(f);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: common-subexpression elimination over the dominator tree
+ *
+ * A scoped hash table of available pure expressions is pushed on entry to a
+ * block and popped on exit, so an expression is reused only where its
+ * earlier occurrence dominates the later one.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct {
+    IRInstr **entries;      /* stack of available expressions */
+    int      *chain;        /* chain[i] = next entry index in the same bucket */
+    int       n, cap;
+    int      *buckets;      /* bucket head index, -1 if empty */
+    int       nbuckets;
+    int       nblk;
+    IRBlock ***children;    /* dominator-tree children per block rpo */
+    int      *nchildren;
+} CSETable;
+
+static uint64_t expr_hash(IRInstr *in) {
+    uint64_t h = 1469598103934665603ULL;
+    h = (h ^ (uint64_t)in->op) * 1099511628211ULL;
+    h = (h ^ (uint64_t)in->type) * 1099511628211ULL;
+    for (int a = 0; a < in->nargs; a++)
+        h = (h ^ (uint64_t)in->args[a]->id) * 1099511628211ULL;
+    uint64_t bits; memcpy(&bits, &in->num, sizeof(bits));
+    h = (h ^ bits) * 1099511628211ULL;
+    h = (h ^ (uint64_t)in->imm) * 1099511628211ULL;
+    if (in->sym)
+        for (const char *s = in->sym; *s; s++)
+            h = (h ^ (uint64_t)(unsigned char)*s) * 1099511628211ULL;
+    /* fold the high half down: the table takes the low bits, and small
+     * integer constants differ only in the high bits of their double */
+    return h ^ (h >> 32);
+}
+
+static int expr_equal(IRInstr *a, IRInstr *b) {
+    if (a->op != b->op || a->type != b->type || a->nargs != b->nargs) return 0;
+    for (int i = 0; i < a->nargs; i++) if (a->args[i] != b->args[i]) return 0;
+    if (memcmp(&a->num, &b->num, sizeof(double)) != 0) return 0;
+    if (a->imm != b->imm) return 0;
+    if ((a->sym == NULL) != (b->sym == NULL)) return 0;
+    if (a->sym && strcmp(a->sym, b->sym) != 0) return 0;
+    return 1;
+}
+
+static void cse_walk(IRFunc *f, CSETable *t, IRBlock *b) {
+    int mark = t->n;
+    for (int i = 0; i < b->nins; i++) {
+        IRInstr *in = b->ins[i];
+        if (in->dead) continue;
+        for (int a = 0; a < in->nargs; a++) in->args[a] = ir_resolve(in->args[a]);
+        if (!op_is_pure(in->op)) continue;
+        /* == / != and * are commutative: canonicalise operand order */
+        if ((in->op == IR_EQ || in->op == IR_NE || in->op == IR_MUL) &&
+            in->args[0]->id > in->args[1]->id) {
+            IRInstr *tmp = in->args[0]; in->args[0] = in->args[1]; in->args[1] = tmp;
+        }
+        int bucket = (int)(expr_hash(in) % (uint64_t)t->nbuckets);
+        IRInstr *found = NULL;
+        for (int e = t->buckets[bucket]; e >= 0; e = t->chain[e])
+            if (expr_equal(t->entries[e], in)) { found = t->entries[e]; break; }
+        if (found) {
+            ir_replace(in, found);
+            f->stat_cse++;
+            continue;
+        }
+        if (t->n >= t->cap) {
+            t->cap = t->cap ? t->cap * 2 : 64;
+            t->entries = realloc(t->entries, sizeof(IRInstr*) * (size_t)t->cap);
+            t->chain   = realloc(t->chain,   sizeof(int) * (size_t)t->cap);
+        }
+        t->entries[t->n] = in;
+        t->chain[t->n]   = t->buckets[bucket];
+        t->buckets[bucket] = t->n;
+        t->n++;
+    }
+    for (int c = 0; c < t->nchildren[b->rpo]; c++)
+        cse_walk(f, t, t->children[b->rpo][c]);
+    /* pop this block's entries (they were pushed LIFO onto bucket heads) */
+    while (t->n > mark) {
+        t->n--;
+        int bucket = (int)(expr_hash(t->entries[t->n]) % (uint64_t)t->nbuckets);
+        t->buckets[bucket] = t->chain[t->n];
+    }
+}
+
+static void pass_cse(IRFunc *f) {
+    compute_dominators(f);
+    CSETable t;
+    memset(&t, 0, sizeof(t));
+    t.nbuckets = 256;
+    while (t.nbuckets < f->next_id) t.nbuckets *= 2;
+    t.buckets = malloc(sizeof(int) * (size_t)t.nbuckets);
+    for (int i = 0; i < t.nbuckets; i++) t.buckets[i] = -1;
+    t.nblk      = f->nblocks;
+    t.children  = calloc((size_t)f->nblocks, sizeof(IRBlock**));
+    t.nchildren = calloc((size_t)f->nblocks, sizeof(int));
+    for (int i = 1; i < f->nblocks; i++) {
+        IRBlock *b = f->blocks[i];
+        int p = b->idom->rpo;
+        t.children[p] = realloc(t.children[p], sizeof(IRBlock*) * (size_t)(t.nchildren[p] + 1));
+        t.children[p][t.nchildren[p]++] = b;
+    }
+    cse_walk(f, &t, f->blocks[0]);
+    for (int i = 0; i < f->nblocks; i++) free(t.children[i]);
+    free(t.children);
+    free(t.nchildren);
+    free(t.entries);
+    free(t.chain);
+    free(t.buckets);
+    ir_compact(f);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: loop-invariant code motion
+ *
+ * Natural loops are found from back edges (an edge b → h where h dominates
+ * b).  Pure instructions whose operands are all defined outside the loop are
+ * moved to the preheader — the unique outside predecessor of the header that
+ * jumps straight into it.  The AST lowering always creates one for while /
+ * for / for-in loops.  Inner loops are processed first so invariants bubble
+ * out through several levels.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct { IRBlock *header; char *in_loop; int size; } IRLoop;
+
+static int loop_cmp(const void *a, const void *b) {
+    return ((const IRLoop*)a)->size - ((const IRLoop*)b)->size;
+}
+
+static void pass_licm(IRFunc *f) {
+    compute_dominators(f);
+    int nb = f->nblocks;
+    IRLoop *loops = NULL;
+    int nloops = 0;
+
+    for (int hi = 0; hi < nb; hi++) {
+        IRBlock *h = f->blocks[hi];
+        char *in_loop = NULL;
+        int size = 0;
+        for (int p = 0; p < h->npreds; p++) {
+            IRBlock *latch = h->preds[p];
+            if (!dominates(h, latch)) continue;
+            if (!in_loop) { in_loop = calloc((size_t)nb, 1); in_loop[h->rpo] = 1; size = 1; }
+            /* walk backwards from the latch until the header */
+            IRBlock **stack = malloc(sizeof(IRBlock*) * (size_t)nb);
+            int sp = 0;
+            if (!in_loop[latch->rpo]) { in_loop[latch->rpo] = 1; size++; stack[sp++] = latch; }
+            while (sp > 0) {
+                IRBlock *x = stack[--sp];
+                for (int q = 0; q < x->npreds; q++) {
+                    IRBlock *y = x->preds[q];
+                    if (y->rpo < 0 || in_loop[y->rpo]) continue;
+                    in_loop[y->rpo] = 1; size++;
+                    stack[sp++] = y;
+                }
+            }
+            free(stack);
+        }
+        if (!in_loop) continue;
+        loops = realloc(loops, sizeof(IRLoop) * (size_t)(nloops + 1));
+        loops[nloops].header  = h;
+        loops[nloops].in_loop = in_loop;
+        loops[nloops].size    = size;
+        nloops++;
+    }
+    qsort(loops, (size_t)nloops, sizeof(IRLoop), loop_cmp);
+
+    for (int li = 0; li < nloops; li++) {
+        IRLoop *L = &loops[li];
+        IRBlock *pre = NULL;
+        int outside = 0;
+        for (int p = 0; p < L->header->npreds; p++) {
+            IRBlock *pb = L->header->preds[p];
+            if (L->in_loop[pb->rpo]) continue;
+            outside++;
+            pre = pb;
+        }
+        if (outside != 1) continue;
+        IRInstr *pt = ir_terminator(pre);
+        if (!pt || pt->op != IR_JMP) continue;
+
+        for (int bi = 0; bi < nb; bi++) {
+            IRBlock *b = f->blocks[bi];
+            if (!L->in_loop[b->rpo]) continue;
+            for (int i = 0; i < b->nins; i++) {
+                IRInstr *in = b->ins[i];
+                if (in->dead || !op_is_pure(in->op)) continue;
+                int invariant = 1;
+                for (int a = 0; a < in->nargs; a++) {
+                    IRInstr *arg = ir_resolve(in->args[a]);
+                    in->args[a] = arg;
+                    if (arg->block && arg->block->rpo >= 0 && L->in_loop[arg->block->rpo]) {
+                        invariant = 0;
+                        break;
+                    }
+                }
+                if (!invariant) continue;
+                /* move before the preheader's jump */
+                memmove(&b->ins[i], &b->ins[i + 1], sizeof(IRInstr*) * (size_t)(b->nins - i - 1));
+                b->nins--;
+                i--;
+                block_insert(pre, pre->nins - 1, in);
+                f->stat_licm++;
+            }
+        }
+    }
+    for (int li = 0; li < nloops; li++) free(loops[li].in_loop);
+    free(loops);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: unboxing (-O2)
+ *
+ * The runtime's -, *, / and % (and unary -) always produce numbers; + does
+ * when both operands are numbers.  Constants, those results, phis over
+ * numbers, params of a num_abi function, raw-entry calls and math.sqrt /
+ * abs / min / max (IR_CALL_NATIVE intrinsics) with numeric arguments are
+ * retyped f64 (phis, + and calls are assumed numeric until
+ * an operand proves otherwise, so loop-carried numbers qualify).  Arithmetic, comparisons, truthiness, phis, raw calls
+ * and num_abi returns consume f64 directly; any other use gets an IR_BOX
+ * placed right before it, so a number that never escapes is never boxed.
+ * Runs last: the folding passes only understand boxed constants.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static int unbox_all_num(IRInstr *in) {
+    for (int a = 0; a < in->nargs; a++)
+        if (!in->args[a]->mark) return 0;
+    return 1;
+}
+
+static int unbox_is_num(IRFunc *f, IRInstr *in) {
+    if (in->type == IRT_F64) return 1;                  /* num_abi params */
+    if (in->type != IRT_VAL) return 0;
+    switch (in->op) {
+    case IR_CONST_NUM:
+    case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD: case IR_NEG:
+        return 1;
+    case IR_PARAM:
+        return f->num_abi;
+    case IR_ADD: case IR_PHI:
+        return unbox_all_num(in);
+    case IR_CALL:
+        return in->num_entry && unbox_all_num(in);
+    case IR_CALL_NATIVE:
+        return in->imm != IR_NATIVE_CALL && unbox_all_num(in);
+    default:
+        return 0;
+    }
+}
+
+/* Can operand `a` of `in` stay a raw f64?  The runtime's -, *, /, %, unary
+ * minus and ordering comparisons read ->num whatever the operand's type,
+ * so the emitters pair a raw operand with a boxed one by loading its num. */
+static int unbox_raw_use(IRFunc *f, IRInstr *in, int a) {
+    switch (in->op) {
+    case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD: case IR_NEG:
+    case IR_LT: case IR_GT: case IR_LE: case IR_GE:
+    case IR_TRUTHY:
+        return 1;
+    case IR_ADD: case IR_EQ: case IR_NE:
+        return in->args[0]->type == IRT_F64 && in->args[1]->type == IRT_F64;
+    case IR_PHI: case IR_CALL: case IR_CALL_NATIVE:
+        return in->type == IRT_F64;
+    case IR_SWITCH:
+        return 1;
+    case IR_RET:
+        return f->num_abi;
+    default:
+        (void)a;
+        return 0;
+    }
+}
+
+static IRInstr *unbox_box(IRFunc *f, IRBlock *b, int at, IRInstr *v) {
+    IRInstr *bx = instr_new(f, IR_BOX, IRT_VAL);
+    ir_add_arg(bx, v);
+    block_insert(b, at, bx);
+    return bx;
+}
+
+static void pass_unbox(IRFunc *f) {
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            in->mark = in->type == IRT_F64 || (in->type == IRT_VAL &&
+                       (in->op == IR_PHI || in->op == IR_ADD ||
+                        (in->op == IR_CALL && in->num_entry) ||
+                        (in->op == IR_CALL_NATIVE && in->imm != IR_NATIVE_CALL)));
+        }
+    }
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int bi = 0; bi < f->nblocks; bi++) {
+            IRBlock *b = f->blocks[bi];
+            for (int i = 0; i < b->nins; i++) {
+                IRInstr *in = b->ins[i];
+                int m = unbox_is_num(f, in);
+                if (m != in->mark) { in->mark = m; changed = 1; }
+            }
+        }
+    }
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++)
+            if (b->ins[i]->mark && b->ins[i]->type == IRT_VAL) {
+                b->ins[i]->type = IRT_F64;
+                f->stat_unboxed++;
+            }
+    }
+
+    /* box at the uses that need an XlyVal* (phi operands at the end of
+     * the matching predecessor).  The rest of a block is rebuilt with its
+     * boxes in one pass: inserting each in place would shift the whole
+     * block, quadratic in the top level of a large program.           */
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        int nphi = count_phis(b);
+        for (int i = 0; i < nphi; i++) {
+            IRInstr *in = b->ins[i];
+            for (int a = 0; a < in->nargs; a++) {
+                if (in->args[a]->type != IRT_F64 || unbox_raw_use(f, in, a)) continue;
+                IRBlock *p = b->preds[a];
+                in->args[a] = unbox_box(f, p, p->nins - 1, in->args[a]);
+            }
+        }
+        IRInstr **ins = NULL;
+        int n = nphi, cap = 0;
+        for (int i = nphi; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            for (int a = 0; in->op != IR_BOX && a < in->nargs; a++) {
+                if (in->args[a]->type != IRT_F64 || unbox_raw_use(f, in, a)) continue;
+                if (!ins) {
+                    cap = b->nins + 16;
+                    ins = malloc(sizeof(IRInstr*) * (size_t)cap);
+                    memcpy(ins, b->ins, sizeof(IRInstr*) * (size_t)i);
+                    n = i;
+                }
+                if (n + 1 >= cap) {
+                    cap *= 2;
+                    ins = realloc(ins, sizeof(IRInstr*) * (size_t)cap);
+                }
+                IRInstr *bx = instr_new(f, IR_BOX, IRT_VAL);
+                ir_add_arg(bx, in->args[a]);
+                bx->block = b;
+                ins[n++] = bx;
+                in->args[a] = bx;
+            }
+            if (ins) {
+                if (n >= cap) {
+                    cap *= 2;
+                    ins = realloc(ins, sizeof(IRInstr*) * (size_t)cap);
+                }
+                ins[n++] = in;
+            }
+        }
+        if (ins) {
+            free(b->ins);
+            b->ins     = ins;
+            b->nins    = n;
+            b->ins_cap = cap;
+        }
+    }
+}
+
+int ir_returns_num(IRFunc *f) {
+    if (!f->num_abi) return 1;
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRInstr *t = ir_terminator(f->blocks[bi]);
+        if (t && t->op == IR_RET && (t->nargs == 0 || t->args[0]->type != IRT_F64))
+            return 0;
+    }
+    return 1;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: tail-call marking (-O2)
+ *
+ * A call whose result is returned as is, with nothing in between, can
+ * reuse the caller's frame: the emitters turn it into a jump.  The
+ * returned value must already be in the ABI of the caller's own return.
+ * Self tail calls never get here — the lowering turns them into loops.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static void pass_tail_calls(IRFunc *f) {
+    if (f->is_main) return;
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        if (b->nins < 2) continue;
+        IRInstr *ret = b->ins[b->nins - 1], *call = b->ins[b->nins - 2];
+        if (ret->op != IR_RET || ret->nargs != 1 || call->op != IR_CALL ||
+            ir_resolve(ret->args[0]) != call)
+            continue;
+        if (call->type != (f->num_abi ? IRT_F64 : IRT_VAL)) continue;
+        call->tail = 1;
+        f->stat_tail++;
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PASS: escape analysis of boxed numbers (-O2)
+ *
+ * IR_BOX and the inline number path of boxed + - * / allocate a fresh
+ * XlyVal on every run.  When each use of the result only reads it, the
+ * value cannot outlive its frame: it is never stored into an array,
+ * object, global or closure, passed to a call, returned, yielded or
+ * merged by a phi.  Such a value is marked `stack`, and the emitters
+ * build it in a cell of the function's frame instead of on the heap.
+ *
+ * One cell per instruction is enough: in SSA a use always sees the
+ * latest run of its definition, and earlier runs can only be reached
+ * through a phi — an escaping use.  The cells count towards the frame
+ * of every call (and generator stacks are small), so only the first
+ * IR_MAX_STACK_CELLS candidates of a function get one.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* Uses that read an XlyVal* operand without keeping it: the runtime
+ * helpers behind them return a new value, an element of a collection
+ * (IR_INDEX) or nothing. */
+static int escape_reads_only(IROp op) {
+    switch (op) {
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV: case IR_MOD:
+    case IR_LT: case IR_GT: case IR_LE: case IR_GE: case IR_EQ: case IR_NE:
+    case IR_NEG: case IR_NOT: case IR_TYPEOF: case IR_TRUTHY: case IR_IS_MISSING:
+    case IR_VARIANT_TAG: case IR_INDEX: case IR_PRINT: case IR_SWITCH:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static int escape_candidate(const IRInstr *in) {
+    if (in->type != IRT_VAL) return 0;
+    switch (in->op) {
+    case IR_BOX:        /* a boxed constant is laid out statically instead */
+        return in->args[0]->op != IR_CONST_NUM;
+    case IR_ADD: case IR_SUB: case IR_MUL: case IR_DIV:
+        return in->hint >= 0;           /* has the inline number path */
+    default:
+        return 0;
+    }
+}
+
+static void pass_escape(IRFunc *f) {
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++)
+            b->ins[i]->mark = escape_candidate(b->ins[i]);
+    }
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (escape_reads_only(in->op)) continue;
+            for (int a = 0; a < in->nargs; a++)
+                ir_resolve(in->args[a])->mark = 0;
+        }
+    }
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins && f->stat_stack < IR_MAX_STACK_CELLS; i++)
+            if (b->ins[i]->mark) {
+                b->ins[i]->stack = 1;
+                f->stat_stack++;
+            }
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * DRIVER
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+void ir_optimize(IRFunc *f, int opt_level) {
+    ir_compact(f);
+    ir_order_blocks(f);
+    pass_trivial_phis(f);
+    if (opt_level >= 1) {
+        pass_constprop(f);
+        pass_dce(f);
+    }
+    if (opt_level >= 2) {
+        pass_cse(f);
+        pass_licm(f);
+        /* hoisting and CSE expose more folds / dead values */
+        pass_constprop(f);
+        pass_dce(f);
+        pass_unbox(f);
+        pass_tail_calls(f);
+        pass_escape(f);
+    }
+}
+
+/* Split every edge from a multi-way branch into a block with phis, so phi
+ * copies can be placed at the end of a predecessor without affecting the
+ * other successors. */
+void ir_split_critical_edges(IRFunc *f) {
+    int nb = f->nblocks;
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock *b = f->blocks[bi];
+        IRBlock **succs;
+        int ns = block_succs(b, &succs);
+        if (ns < 2) continue;
+        for (int s = 0; s < ns; s++) {
+            IRBlock *succ = succs[s];
+            if (succ->npreds < 2 || count_phis(succ) == 0) continue;
+            IRBlock *e = ir_block_new(f);
+            e->sealed = 1;
+            IRInstr *j = ir_emit(f, e, IR_JMP, IRT_VOID);
+            j->target[0] = succ;
+            block_add_pred(e, b);
+            for (int k = 0; k < succ->npreds; k++)
+                if (succ->preds[k] == b) { succ->preds[k] = e; break; }
+            succs[s] = e;
+        }
+    }
+    ir_order_blocks(f);
+}
+
+/* Greatest fixpoint: start from every block but the entry being cold and
+ * clear the ones some warm block leads to, so a loop reached only through
+ * a cold edge stays cold along with its back edge.                     */
+int ir_mark_cold(IRFunc *f) {
+    if (f->nblocks == 0) return 0;
+    for (int i = 0; i < f->nblocks; i++) {
+        f->blocks[i]->mark = f->blocks[i]->cold;        /* marked by the lowering */
+        f->blocks[i]->cold = i > 0;
+    }
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int i = 1; i < f->nblocks; i++) {
+            IRBlock *b = f->blocks[i];
+            if (!b->cold || b->mark) continue;
+            for (int p = 0; p < b->npreds; p++)
+                if (!b->preds[p]->cold) { b->cold = 0; changed = 1; break; }
+        }
+    }
+    int n = 0;
+    for (int i = 0; i < f->nblocks; i++) n += f->blocks[i]->cold;
+    return n;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * INLINING
+ *
+ * The caller decides what to inline (codegen.c knows the functions); this
+ * half copies an already-optimized callee into the call site.  The block
+ * holding the call is split after it, the callee's blocks are cloned with
+ * params replaced by the call's arguments, and every return becomes a jump
+ * to the continuation, where a phi merges the returned values.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+int ir_func_size(IRFunc *f) {
+    int n = 0;
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        for (int i = 0; i < b->nins; i++)
+            if (!b->ins[i]->dead && b->ins[i]->op != IR_PHI && b->ins[i]->op != IR_PARAM &&
+                b->ins[i]->op != IR_PROF_COUNT && b->ins[i]->op != IR_SAFEPOINT)
+                n++;
+    }
+    return n;
+}
+
+int ir_inline_call(IRFunc *f, IRInstr *call, IRFunc *callee) {
+    if (callee->nblocks == 0 || callee->blocks[0]->npreds > 0 ||
+        callee->ncaptures > 0 || callee->num_abi || call->nargs != callee->nparams)
+        return 0;
+    IRBlock *b = call->block;
+    int at = 0;
+    while (at < b->nins && b->ins[at] != call) at++;
+    if (at == b->nins) return 0;
+
+    /* continuation: everything after the call, with b's CFG edges */
+    IRBlock *cont = ir_block_new(f);
+    cont->sealed = 1;
+    for (int i = at + 1; i < b->nins; i++) block_insert(cont, cont->nins, b->ins[i]);
+    b->nins = at;
+    IRBlock **succ;
+    int ns = block_succs(cont, &succ);
+    for (int k = 0; k < ns; k++)
+        for (int p = 0; p < succ[k]->npreds; p++)
+            if (succ[k]->preds[p] == b) succ[k]->preds[p] = cont;
+
+    /* clone: blocks first (indexed through mark), then instructions */
+    int nb = callee->nblocks;
+    IRBlock **bmap = malloc(sizeof(IRBlock*) * (size_t)nb);
+    IRInstr **vmap = calloc((size_t)callee->next_id, sizeof(IRInstr*));
+    for (int bi = 0; bi < nb; bi++) {
+        callee->blocks[bi]->mark = bi;
+        bmap[bi] = ir_block_new(f);
+        bmap[bi]->sealed = 1;
+        bmap[bi]->cold   = callee->blocks[bi]->cold;
+    }
+    IRInstr **rets = NULL;
+    IRBlock **ret_blocks = NULL;
+    int nrets = 0;
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock *cb = callee->blocks[bi];
+        for (int i = 0; i < cb->nins; i++) {
+            IRInstr *in = cb->ins[i];
+            if (in->dead) continue;
+            if (in->op == IR_PARAM) { vmap[in->id] = ir_resolve(call->args[in->imm]); continue; }
+            if (in->op == IR_RET) {
+                rets       = realloc(rets, sizeof(IRInstr*) * (size_t)(nrets + 1));
+                ret_blocks = realloc(ret_blocks, sizeof(IRBlock*) * (size_t)(nrets + 1));
+                rets[nrets] = in->nargs > 0 ? in->args[0] : NULL;
+                ret_blocks[nrets++] = bmap[bi];
+                IRInstr *j = ir_emit(f, bmap[bi], IR_JMP, IRT_VOID);
+                j->target[0] = cont;
+                continue;
+            }
+            IRInstr *c = ir_emit(f, bmap[bi], in->op, in->type);
+            c->num       = in->num;
+            c->imm       = in->imm;
+            c->sym       = in->sym  ? strdup(in->sym)  : NULL;
+            c->sym2      = in->sym2 ? strdup(in->sym2) : NULL;
+            c->noreturn  = in->noreturn;
+            c->num_entry = in->num_entry;
+            c->hint      = in->hint;
+            c->prof      = in->prof ? strdup(in->prof) : NULL;
+            for (int t = 0; t < 2; t++)
+                if (in->target[t]) c->target[t] = bmap[in->target[t]->mark];
+            for (int k = 0; k < in->ncases; k++)
+                switch_add(c, in->keys[k], bmap[in->cases[k]->mark]);
+            vmap[in->id] = c;
+        }
+        for (int p = 0; p < cb->npreds; p++)
+            block_add_pred(bmap[bi], bmap[cb->preds[p]->mark]);
+    }
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock *cb = callee->blocks[bi];
+        for (int i = 0; i < cb->nins; i++) {
+            IRInstr *in = cb->ins[i];
+            if (in->dead || !vmap[in->id] || in->op == IR_PARAM) continue;
+            for (int a = 0; a < in->nargs; a++)
+                ir_add_arg(vmap[in->id], vmap[ir_resolve(in->args[a])->id]);
+        }
+    }
+
+    /* b → callee entry; returns → cont */
+    IRInstr *j = ir_emit(f, b, IR_JMP, IRT_VOID);
+    j->target[0] = bmap[0];
+    block_add_pred(bmap[0], b);
+    IRInstr *result;
+    if (nrets == 1 && rets[0]) {
+        result = vmap[ir_resolve(rets[0])->id];
+        block_add_pred(cont, ret_blocks[0]);
+    } else if (nrets == 0) {
+        result = instr_new(f, IR_CONST_NULL, IRT_VAL);   /* cont is unreachable */
+        block_insert(cont, 0, result);
+    } else {
+        result = instr_new(f, IR_PHI, IRT_VAL);
+        block_insert(cont, 0, result);
+        for (int r = 0; r < nrets; r++) {
+            block_add_pred(cont, ret_blocks[r]);
+            if (rets[r]) {
+                ir_add_arg(result, vmap[ir_resolve(rets[r])->id]);
+            } else {
+                IRInstr *nul = instr_new(f, IR_CONST_NULL, IRT_VAL);
+                IRBlock *rb = ret_blocks[r];
+                block_insert(rb, rb->nins - 1, nul);
+                ir_add_arg(result, nul);
+            }
+        }
+    }
+    ir_replace(call, result);
+    bury_instr(f, call);
+    free(bmap);
+    free(vmap);
+    free(rets);
+    free(ret_blocks);
+    f->stat_inlined++;
+    return 1;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * REGISTER ALLOCATION: linear scan (Poletto & Sarkar)
+ *
+ * Instructions are numbered in emission order and block-level liveness is
+ * solved with bit sets; a phi is defined at the top of its block and its
+ * operands are used at the end of the matching predecessor.  Each value
+ * gets one interval from its first to its last live point — holes are not
+ * tracked, which only costs registers, never correctness.  Intervals are
+ * scanned by start; when the registers run out, the interval with the
+ * lowest spill weight (uses and defs, x8 per loop level) among the active
+ * ones and the new one loses and stays in its frame slot.  The backends
+ * hand out callee-saved registers only, so values survive runtime calls
+ * without caller-side saves.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct { int start, end; double weight; IRInstr *v; } IRInterval;
+
+static int interval_cmp(const void *a, const void *b) {
+    const IRInterval *x = a, *y = b;
+    if (x->start != y->start) return x->start - y->start;
+    return x->v->id - y->v->id;
+}
+
+#define BS_WORDS(n)   (((n) + 63) / 64)
+#define BS_HAS(s, i)  (((s)[(i) >> 6] >> ((i) & 63)) & 1)
+#define BS_SET(s, i)  ((s)[(i) >> 6] |= 1ULL << ((i) & 63))
+
+static int phi_pred_index(IRBlock *s, IRBlock *b) {
+    for (int p = 0; p < s->npreds; p++)
+        if (s->preds[p] == b) return p;
+    return -1;
+}
+
+void ir_regalloc(IRFunc *f, int nregs) {
+    int nb = f->nblocks, nv = f->next_id, w = BS_WORDS(nv);
+    f->stat_regs = f->stat_spilled = 0;
+
+    /* positions and a crude loop depth: every back edge b → h (h laid out
+     * no later than b) nests the blocks between them one level deeper */
+    int *bstart = malloc(sizeof(int) * (size_t)nb);
+    int *bend   = malloc(sizeof(int) * (size_t)nb);
+    int *depth  = calloc((size_t)nb, sizeof(int));
+    int pos = 0;
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock *b = f->blocks[bi];
+        b->mark = bi;
+        bstart[bi] = pos;
+        for (int i = 0; i < b->nins; i++) b->ins[i]->mark = ++pos;
+        bend[bi] = ++pos;
+    }
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock **succ;
+        int ns = block_succs(f->blocks[bi], &succ);
+        for (int k = 0; k < ns; k++)
+            if (succ[k]->mark <= bi)
+                for (int j = succ[k]->mark; j <= bi; j++) depth[j]++;
+    }
+
+    /* liveness: in(b) = phis(b) ∪ gen(b) ∪ (out(b) − defs(b)),
+     * out(b) = ∪ (in(s) − phis(s)) ∪ phi operands flowing from b */
+    uint64_t *gen  = calloc((size_t)nb * (size_t)w, sizeof(uint64_t));
+    uint64_t *kill = calloc((size_t)nb * (size_t)w, sizeof(uint64_t));
+    uint64_t *lin  = calloc((size_t)nb * (size_t)w, sizeof(uint64_t));
+    uint64_t *lout = calloc((size_t)nb * (size_t)w, sizeof(uint64_t));
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock *b = f->blocks[bi];
+        uint64_t *g = gen + (size_t)bi * w, *k = kill + (size_t)bi * w;
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->op != IR_PHI)
+                for (int a = 0; a < in->nargs; a++)
+                    if (!BS_HAS(k, in->args[a]->id)) BS_SET(g, in->args[a]->id);
+            if (in->type != IRT_VOID) BS_SET(k, in->id);
+        }
+    }
+    uint64_t *tmp = malloc(sizeof(uint64_t) * (size_t)w);
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        for (int bi = nb - 1; bi >= 0; bi--) {
+            IRBlock *b = f->blocks[bi];
+            uint64_t *out = lout + (size_t)bi * w, *in = lin + (size_t)bi * w;
+            IRBlock **succ;
+            int ns = block_succs(b, &succ);
+            for (int k = 0; k < ns; k++) {
+                IRBlock *s = succ[k];
+                int pi = phi_pred_index(s, b);
+                memcpy(tmp, lin + (size_t)s->mark * w, sizeof(uint64_t) * (size_t)w);
+                for (int i = 0; i < s->nins && s->ins[i]->op == IR_PHI; i++) {
+                    IRInstr *phi = s->ins[i];
+                    tmp[phi->id >> 6] &= ~(1ULL << (phi->id & 63));
+                    if (pi >= 0) BS_SET(tmp, phi->args[pi]->id);
+                }
+                for (int x = 0; x < w; x++)
+                    if ((out[x] | tmp[x]) != out[x]) { out[x] |= tmp[x]; changed = 1; }
+            }
+            uint64_t *g = gen + (size_t)bi * w, *k = kill + (size_t)bi * w;
+            for (int x = 0; x < w; x++) {
+                uint64_t v = g[x] | (out[x] & ~k[x]);
+                if ((v | in[x]) != in[x]) { in[x] |= v; changed = 1; }
+            }
+            for (int i = 0; i < b->nins && b->ins[i]->op == IR_PHI; i++)
+                if (!BS_HAS(in, b->ins[i]->id)) { BS_SET(in, b->ins[i]->id); changed = 1; }
+        }
+    }
+    free(tmp);
+
+    /* intervals */
+    IRInterval *iv = calloc((size_t)nv, sizeof(IRInterval));
+    for (int i = 0; i < nv; i++) { iv[i].start = INT32_MAX; iv[i].end = -1; }
+    #define IV_COVER(id, p) do { IRInterval *t_ = &iv[id];            \
+        if ((p) < t_->start) t_->start = (p);                           \
+        if ((p) > t_->end)   t_->end   = (p); } while (0)
+    for (int bi = 0; bi < nb; bi++) {
+        IRBlock *b = f->blocks[bi];
+        double wt = 1.0;
+        for (int d = 0; d < depth[bi] && d < 6; d++) wt *= 8.0;
+        uint64_t *in = lin + (size_t)bi * w, *out = lout + (size_t)bi * w;
+        for (int v = 0; v < nv; v++) {
+            if (BS_HAS(in, v))  IV_COVER(v, bstart[bi]);
+            if (BS_HAS(out, v)) IV_COVER(v, bend[bi]);
+        }
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in_ = b->ins[i];
+            if (in_->type != IRT_VOID) {
+                /* params are materialised by the prologue */
+                IV_COVER(in_->id, in_->op == IR_PHI   ? bstart[bi] :
+                                  in_->op == IR_PARAM ? 0 : in_->mark);
+                iv[in_->id].v = in_;
+                iv[in_->id].weight += wt;
+            }
+            for (int a = 0; a < in_->nargs; a++) {
+                IRInstr *arg = in_->args[a];
+                if (in_->op == IR_PHI) {
+                    IRBlock *p = b->preds[a];
+                    IV_COVER(arg->id, bend[p->mark]);
+                } else {
+                    IV_COVER(arg->id, in_->mark);
+                }
+                iv[arg->id].weight += wt;
+            }
+        }
+    }
+    #undef IV_COVER
+    int n = 0;
+    for (int i = 0; i < nv; i++)
+        if (iv[i].v) { iv[i].v->reg = -1; iv[n++] = iv[i]; }
+    qsort(iv, (size_t)n, sizeof(IRInterval), interval_cmp);
+
+    /* scan */
+    IRInterval **active = malloc(sizeof(IRInterval*) * (size_t)(nregs + 1));
+    int nactive = 0, used = 0;
+    int *free_regs = malloc(sizeof(int) * (size_t)(nregs + 1));
+    int nfree = nregs;
+    for (int r = 0; r < nregs; r++) free_regs[r] = nregs - 1 - r;
+    for (int i = 0; i < n; i++) {
+        IRInterval *cur = &iv[i];
+        for (int a = 0; a < nactive; ) {
+            if (active[a]->end < cur->start) {
+                free_regs[nfree++] = active[a]->v->reg;
+                active[a] = active[--nactive];
+            } else {
+                a++;
+            }
+        }
+        if (nfree > 0) {
+            cur->v->reg = free_regs[--nfree];
+            if (cur->v->reg + 1 > used) used = cur->v->reg + 1;
+            active[nactive++] = cur;
+            continue;
+        }
+        int victim = -1;
+        double vw = cur->weight;
+        for (int a = 0; a < nactive; a++)
+            if (active[a]->weight < vw ||
+                (active[a]->weight == vw && victim >= 0 && active[a]->end > active[victim]->end)) {
+                victim = a;
+                vw = active[a]->weight;
+            }
+        if (victim < 0) { f->stat_spilled++; continue; }
+        cur->v->reg = active[victim]->v->reg;
+        active[victim]->v->reg = -1;
+        active[victim] = cur;
+        f->stat_spilled++;
+    }
+    f->stat_regs = used;
+
+    free(active); free(free_regs); free(iv);
+    free(gen); free(kill); free(lin); free(lout);
+    free(bstart); free(bend); free(depth);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PRINTER  (xenlyc --emit-ir)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+const char *ir_op_name(IROp op) {
+    static const char *names[IR_OP_COUNT] = {
+        [IR_CONST_NUM] = "const.num",   [IR_CONST_STR] = "const.str",
+        [IR_CONST_BOOL] = "const.bool", [IR_CONST_NULL] = "const.null",
+        [IR_ICONST] = "iconst",
+        [IR_PARAM] = "param",           [IR_CAPTURE] = "capture",
+        [IR_GLOBAL_LOAD] = "global.load",
+        [IR_ADD] = "add", [IR_SUB] = "sub", [IR_MUL] = "mul",
+        [IR_DIV] = "div", [IR_MOD] = "mod",
+        [IR_LT] = "lt", [IR_GT] = "gt", [IR_LE] = "le", [IR_GE] = "ge",
+        [IR_EQ] = "eq", [IR_NE] = "ne",
+        [IR_NEG] = "neg", [IR_NOT] = "not", [IR_TYPEOF] = "typeof",
+        [IR_TRUTHY] = "truthy",         [IR_IS_MISSING] = "is_missing",
+        [IR_BOX] = "box",
+        [IR_IADD] = "iadd",             [IR_ILT] = "ilt",
+        [IR_IEQ] = "ieq",
+        [IR_ARRAY] = "array",           [IR_ARRAY_LEN] = "array.len",
+        [IR_ARRAY_GET] = "array.get",   [IR_INDEX] = "index",
+        [IR_INDEX_SET] = "index.set",   [IR_OBJECT_NEW] = "object.new",
+        [IR_PROP_GET] = "prop.get",     [IR_PROP_SET] = "prop.set",
+        [IR_MAKE_FN] = "make.fn",       [IR_MAKE_CLOSURE] = "make.closure",
+        [IR_GEN_FN] = "gen.fn",
+        [IR_MAKE_VARIANT] = "make.variant",
+        [IR_VARIANT_TAG] = "variant.tag", [IR_VARIANT_FIELD] = "variant.field",
+        [IR_NEW] = "new",               [IR_FIELD_GET] = "field.get",
+        [IR_FIELD_SET] = "field.set",   [IR_INSTANCEOF] = "instanceof",
+        [IR_CALL_VIRT] = "call.virt",   [IR_GEN_NEXT] = "gen.next",
+        [IR_CALL] = "call",             [IR_CALL_VALUE] = "call.value",
+        [IR_CALL_MODULE] = "call.module", [IR_CALL_NATIVE] = "call.native",
+        [IR_CALL_METHOD] = "call.method", [IR_SPAWN] = "spawn",
+        [IR_GLOBAL_STORE] = "global.store", [IR_PRINT] = "print",
+        [IR_YIELD] = "yield",
+        [IR_MATCH_FAIL] = "match.fail", [IR_PROF_COUNT] = "prof.count",
+        [IR_SAFEPOINT] = "safepoint",
+        [IR_PHI] = "phi",
+        [IR_JMP] = "jmp", [IR_BR] = "br", [IR_SWITCH] = "switch", [IR_RET] = "ret",
+        [IR_UNREACHABLE] = "unreachable",
+    };
+    return (op >= 0 && op < IR_OP_COUNT && names[op]) ? names[op] : "?";
+}
+
+static void print_escaped(FILE *out, const char *s) {
+    fputc('"', out);
+    for (; *s; s++) {
+        unsigned char c = (unsigned char)*s;
+        if (c == '\n')      fputs("\\n", out);
+        else if (c == '\t') fputs("\\t", out);
+        else if (c == '"')  fputs("\\\"", out);
+        else if (c == '\\') fputs("\\\\", out);
+        else if (c < 0x20)  fprintf(out, "\\x%02x", c);
+        else                fputc(c, out);
+    }
+    fputc('"', out);
+}
+
+void ir_print(IRFunc *f, FILE *out) {
+    static const char *tnames[] = { "void", "val", "bool", "i64", "f64" };
+    fprintf(out, "fn %s(params %d, captures %d%s) {\n", f->name, f->nparams,
+            f->ncaptures, f->num_abi ? ", raw f64" : "");
+    for (int bi = 0; bi < f->nblocks; bi++) {
+        IRBlock *b = f->blocks[bi];
+        fprintf(out, "  b%d:", b->id);
+        if (b->cold) fputs(" cold", out);
+        if (b->npreds > 0) {
+            fputs("                       ; preds", out);
+            for (int p = 0; p < b->npreds; p++) fprintf(out, " b%d", b->preds[p]->id);
+        }
+        fputc('\n', out);
+        for (int i = 0; i < b->nins; i++) {
+            IRInstr *in = b->ins[i];
+            if (in->dead) continue;
+            fputs("    ", out);
+            if (in->type != IRT_VOID) fprintf(out, "%%%d:%s = ", in->id, tnames[in->type]);
+            fputs(ir_op_name(in->op), out);
+            switch (in->op) {
+            case IR_CONST_NUM:   fprintf(out, " %.17g", in->num); break;
+            case IR_CONST_STR:   fputc(' ', out); print_escaped(out, in->sym); break;
+            case IR_CONST_BOOL:  fputs(in->imm ? " true" : " false", out); break;
+            case IR_ICONST: case IR_PARAM: case IR_CAPTURE:
+            case IR_GLOBAL_LOAD: case IR_GLOBAL_STORE:
+            case IR_VARIANT_FIELD: case IR_MATCH_FAIL:
+                fprintf(out, " %lld", in->imm); break;
+            case IR_MAKE_VARIANT: fprintf(out, " %s#%lld", in->sym, in->imm); break;
+            case IR_CALL_MODULE: fprintf(out, " %s.%s", in->sym, in->sym2); break;
+            case IR_NEW: case IR_INSTANCEOF:
+                fprintf(out, " class %lld", in->imm); break;
+            case IR_FIELD_GET: case IR_FIELD_SET: case IR_CALL_VIRT: case IR_PROF_COUNT:
+                fprintf(out, " %s[%lld]", in->sym, in->imm); break;
+            default:
+                if (in->sym) fprintf(out, " %s", in->sym);
+                break;
+            }
+            for (int a = 0; a < in->nargs; a++) {
+                IRInstr *arg = ir_resolve(in->args[a]);
+                fprintf(out, "%s%%%d", (a == 0 && !in->sym && in->op != IR_GLOBAL_STORE &&
+                                        in->op != IR_INSTANCEOF &&
+                                        in->op != IR_VARIANT_FIELD) ? " " : ", ", arg->id);
+                if (in->op == IR_PHI && a < b->npreds) fprintf(out, " [b%d]", b->preds[a]->id);
+            }
+            if (in->op == IR_JMP) fprintf(out, " b%d", in->target[0]->id);
+            if (in->op == IR_BR)  fprintf(out, ", b%d, b%d", in->target[0]->id, in->target[1]->id);
+            if (in->op == IR_SWITCH) {
+                fprintf(out, ", default b%d", in->cases[0]->id);
+                for (int c = 1; c < in->ncases; c++)
+                    fprintf(out, ", %lld b%d", in->keys[c], in->cases[c]->id);
+            }
+            if (in->noreturn)     fputs("   ; noreturn", out);
+            if (in->op == IR_CALL && in->type == IRT_F64) fputs("   ; raw f64 entry", out);
+            if (in->tail)         fputs("   ; tail", out);
+            if (in->stack)        fputs("   ; stack", out);
+            if (in->hint > 0)     fputs("   ; hot", out);
+            if (in->hint < 0)     fputs(in->op == IR_CALL ? "   ; cold" : "   ; mostly boxed", out);
+            fputc('\n', out);
+        }
+    }
+    fputs("}\n", out);
+    if (f->stat_folded || f->stat_branches || f->stat_dce || f->stat_cse ||
+        f->stat_licm || f->stat_unboxed || f->stat_inlined || f->stat_tail || f->stat_stack)
+        fprintf(out, "; folded %d  branches %d  dce %d  cse %d  licm %d  unboxed %d"
+                     "  inlined %d  tail %d  stack %d\n\n",
+                f->stat_folded, f->stat_branches, f->stat_dce, f->stat_cse,
+                f->stat_licm, f->stat_unboxed, f->stat_inlined, f->stat_tail, f->stat_stack);
+    else
+        fputc('\n', out);
+}
@@ -0,0 +1,305 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * ir.h  —  Xenly mid-level SSA IR
+ *
+ * Sits between the AST and the native emitters in the xenlyc pipeline:
+ *
+ *   AST  →  lowering (codegen.c)  →  IRFunc  →  ir_optimize()  →  x86-64 / arm64
+ *
+ * Every function body (and main) becomes an IRFunc: a list of basic blocks,
+ * each holding straight-line IRInstrs and ending in exactly one terminator
+ * (jmp / br / switch / ret / unreachable).  Instructions are SSA values: each one is
+ * defined once, operands point directly at their defining instruction, and
+ * control-flow merges are expressed with phi nodes at the head of a block.
+ *
+ * Value types:
+ *   val   boxed XlyVal*  — what every Xenly expression produces
+ *   bool  raw 0/1        — branch conditions (truthy, fused comparisons)
+ *   i64   raw integer    — array lengths / for-in indices
+ *   f64   raw double     — a value proven to be a number (-O2 unboxing)
+ *
+ * SSA construction follows Braun et al., "Simple and Efficient Construction
+ * of Static Single Assignment Form": the lowering records variable writes per
+ * block and reads resolve on the fly, creating phis only where a block has
+ * several predecessors.  Blocks are "sealed" once all their predecessors are
+ * known (loop headers are sealed after the back edge is added).
+ *
+ * Passes (ir_optimize):
+ *   -O1   constant propagation + branch folding, dead-code elimination
+ *   -O2   + dominator-scoped CSE, loop-invariant code motion, unboxing,
+ *         tail-call marking, escape analysis of boxed numbers
+ *
+ * Unboxing runs last: values proven to be numbers are retyped f64 and kept
+ * as raw doubles; IR_BOX is inserted in front of each use that needs an
+ * XlyVal*.  A function whose result is a number whenever its arguments are
+ * gets a second, raw-f64 entry point (num_abi) that direct calls with
+ * numeric arguments use instead of the boxed one.  math.sqrt / abs / min /
+ * max of numbers are computed inline on the raw doubles.
+ *
+ * Escape analysis follows: a boxed number whose uses only read it gets a
+ * cell in its function's frame (IRInstr.stack) instead of a heap XlyVal.
+ */
+#ifndef IR_H
+#define IR_H
+
+#include <stdio.h>
+
+typedef struct IRInstr IRInstr;
+typedef struct IRBlock IRBlock;
+typedef struct IRFunc  IRFunc;
+
+/* ── Value types ─────────────────────────────────────────────────────────── */
+typedef enum {
+    IRT_VOID,
+    IRT_VAL,
+    IRT_BOOL,
+    IRT_I64,
+    IRT_F64,
+} IRType;
+
+/* ── Opcodes ─────────────────────────────────────────────────────────────── */
+typedef enum {
+    /* constants */
+    IR_CONST_NUM,       /* num                          → val              */
+    IR_CONST_STR,       /* sym = text                   → val              */
+    IR_CONST_BOOL,      /* imm = 0/1                    → val              */
+    IR_CONST_NULL,      /*                              → val              */
+    IR_ICONST,          /* imm                          → i64 / bool       */
+
+    /* function inputs */
+    IR_PARAM,           /* imm = param index            → val (may be NULL)*/
+    IR_CAPTURE,         /* imm = env slot               → val              */
+    IR_GLOBAL_LOAD,     /* imm = __xly_globals index    → val              */
+
+    /* boxed arithmetic / comparison (args: a, b) */
+    IR_ADD, IR_SUB, IR_MUL, IR_DIV, IR_MOD,
+    IR_LT, IR_GT, IR_LE, IR_GE, IR_EQ, IR_NE,   /* → val, or bool if fused */
+    IR_NEG, IR_NOT, IR_TYPEOF,
+    IR_TRUTHY,          /* val → bool                                      */
+    IR_IS_MISSING,      /* val → bool: raw NULL (omitted optional arg)     */
+    IR_BOX,             /* f64 → val (xly_num)                             */
+
+    /* raw integer helpers */
+    IR_IADD,            /* i64, i64 → i64                                  */
+    IR_ILT,             /* i64, i64 → bool                                 */
+    IR_IEQ,             /* i64, i64 → bool                                 */
+
+    /* heap / runtime */
+    IR_ARRAY,           /* elems...                     → val              */
+    IR_ARRAY_LEN,       /* arr                          → i64              */
+    IR_ARRAY_GET,       /* arr, i64                     → val              */
+    IR_INDEX,           /* coll, key                    → val              */
+    IR_INDEX_SET,       /* coll, key, val               → val              */
+    IR_OBJECT_NEW,      /*                              → val              */
+    IR_PROP_GET,        /* obj; sym = field             → val              */
+    IR_PROP_SET,        /* obj, val; sym = field                           */
+    IR_MAKE_FN,         /* sym = fn label               → val              */
+    IR_MAKE_CLOSURE,    /* captures...; sym = fn label  → val              */
+    IR_GEN_FN,          /* sym = generator body label   → val              */
+    IR_MAKE_VARIANT,    /* fields...; sym = tag, imm = tag id → val        */
+    IR_VARIANT_TAG,     /* val → i64: tag id of a variant, -1 otherwise    */
+    IR_VARIANT_FIELD,   /* variant; imm = field index   → val (null if none)*/
+    IR_NEW,             /* imm = class index            → val (no init)    */
+    IR_FIELD_GET,       /* obj; imm = slot, sym = field → val              */
+    IR_FIELD_SET,       /* obj, val; imm = slot, sym = field               */
+    IR_INSTANCEOF,      /* val; imm = class index       → val              */
+
+    /* calls */
+    IR_CALL,            /* args...; sym = fn label      → val              */
+    IR_CALL_VALUE,      /* fnval, args...               → val              */
+    IR_CALL_MODULE,     /* args...; sym = module, sym2 = fn                */
+    IR_CALL_NATIVE,     /* args...; sym = module native, imm = IRNative    */
+    IR_CALL_METHOD,     /* obj, args...; sym = method   → val              */
+    IR_CALL_VIRT,       /* obj, args...; imm = selector, sym = method      */
+    IR_GEN_NEXT,        /* gen → val, raw NULL once the generator is done  */
+    IR_SPAWN,           /* fnval, args...: queued on a worker → val (null) */
+
+    /* other side effects */
+    IR_GLOBAL_STORE,    /* val; imm = __xly_globals index                  */
+    IR_PRINT,           /* vals...                                         */
+    IR_YIELD,           /* val: suspends the running generator             */
+    IR_MATCH_FAIL,      /* imm = source line; never returns                */
+    IR_PROF_COUNT,      /* sym = profile site label, imm = its counter 0/1 */
+    IR_SAFEPOINT,       /* park here if a collection is waiting            */
+
+    IR_PHI,             /* one operand per predecessor, in preds[] order   */
+
+    /* terminators */
+    IR_JMP,             /* target[0]                                       */
+    IR_BR,              /* bool; target[0] if true, target[1] if false     */
+    IR_SWITCH,          /* i64, or a number taken when integral; cases[i]
+                           for keys[i], cases[0] otherwise                 */
+    IR_RET,             /* val (none in main: it exits)                    */
+    IR_UNREACHABLE,     /* control never gets here (after sys.exit)        */
+
+    IR_OP_COUNT
+} IROp;
+
+/* IR_CALL_NATIVE forms the emitters compute inline, on raw f64 operands,
+ * once unboxing has proven every argument a number (result f64). */
+typedef enum {
+    IR_NATIVE_CALL,     /* none: always the call                           */
+    IR_NATIVE_SQRT,     /* math.sqrt(x)                                    */
+    IR_NATIVE_ABS,      /* math.abs(x)                                     */
+    IR_NATIVE_MIN,      /* math.min(a, b): a < b ? a : b                   */
+    IR_NATIVE_MAX,      /* math.max(a, b): a > b ? a : b                   */
+} IRNative;
+
+/* ── Instruction (= SSA value) ───────────────────────────────────────────── */
+struct IRInstr {
+    int        id;          /* %id in dumps; unique within the function     */
+    IROp       op;
+    IRType     type;
+    IRInstr  **args;
+    int        nargs, args_cap;
+    double     num;         /* IR_CONST_NUM                                 */
+    long long  imm;         /* ICONST / CONST_BOOL / PARAM / CAPTURE / GLOBAL */
+    char      *sym;         /* label, string text, field or module name     */
+    char      *sym2;        /* IR_CALL_MODULE function name                 */
+    int        noreturn;    /* IR_CALL_MODULE: sys.exit / sys.abort         */
+    int        num_entry;   /* IR_CALL: callee has a raw-f64 entry point    */
+    int        tail;        /* IR_CALL: result returned as is (a jump)      */
+    int        hint;        /* profile: IR_CALL +1 hot / -1 never taken;
+                               boxed + - * / -1 = operands mostly not numbers */
+    char      *prof;        /* boxed + - * /: profile site counting how often
+                               it runs and takes the runtime call          */
+    IRBlock   *block;
+    IRBlock   *target[2];   /* IR_JMP / IR_BR successors                    */
+    IRBlock  **cases;       /* IR_SWITCH successors; cases[0] is the default */
+    long long *keys;        /* IR_SWITCH: keys[i] selects cases[i], i >= 1  */
+    int        ncases, cases_cap;
+    IRInstr   *repl;        /* forwarding pointer set by ir_replace()       */
+    int        dead;        /* removed; skipped by every walker             */
+    int        mark;        /* scratch for passes                           */
+    int        stack;       /* boxed result never outlives the frame: built
+                               in a frame cell, not on the heap (-O2)      */
+    int        cell;        /* backend: frame offset of that XlyVal cell    */
+    int        slot;        /* backend: frame offset holding the value      */
+    int        reg;         /* backend: register index, -1 = in its slot    */
+};
+
+/* ── Basic block ─────────────────────────────────────────────────────────── */
+struct IRBlock {
+    int        id;
+    IRInstr  **ins;         /* phis first, terminator last                  */
+    int        nins, ins_cap;
+    IRBlock  **preds;
+    int        npreds, preds_cap;
+
+    /* SSA construction state (Braun et al.) */
+    int        sealed;
+    struct { int var; IRInstr *val; } *defs;
+    int        ndefs, defs_cap;
+    int       *def_slots;   /* past 16 defs: hash of var -> defs index + 1  */
+    int        def_slot_cap;
+    struct { int var; IRInstr *phi; } *incomplete;
+    int        nincomplete, incomplete_cap;
+
+    /* analysis scratch */
+    int        rpo;         /* reverse-postorder index, -1 if unreachable   */
+    IRBlock   *idom;
+    int        loop_depth;
+    int        mark;
+
+    int        cold;        /* the profile never saw it run (ir_mark_cold)  */
+};
+
+/* ── Function ────────────────────────────────────────────────────────────── */
+struct IRFunc {
+    char      *name;        /* asm label suffix ("main" for the entry)      */
+    int        nparams;
+    int        ncaptures;
+    int        is_main;
+    int        num_abi;     /* params arrive / result returns as raw f64    */
+    IRBlock  **blocks;      /* blocks[0] is the entry                       */
+    int        nblocks, blocks_cap;
+    int        next_id;
+    int        next_block_id;
+    IRInstr  **graveyard;   /* removed instructions, freed with the function */
+    int        ngrave, grave_cap;
+
+    /* pass statistics (reported with --verbose) */
+    int        stat_folded;
+    int        stat_branches;
+    int        stat_dce;
+    int        stat_cse;
+    int        stat_licm;
+    int        stat_unboxed;
+    int        stat_inlined;
+    int        stat_tail;
+    int        stat_stack;      /* boxed results given a frame cell     */
+    int        stat_regs;       /* registers handed out by ir_regalloc  */
+    int        stat_spilled;    /* values left in frame slots           */
+};
+
+/* ── Construction ────────────────────────────────────────────────────────── */
+IRFunc  *ir_func_new(const char *name, int nparams, int ncaptures, int is_main);
+void     ir_func_free(IRFunc *f);
+IRBlock *ir_block_new(IRFunc *f);
+
+/* Append a new instruction to the end of `b` (before nothing — callers add
+ * the terminator last).  Operands are added with ir_add_arg(). */
+IRInstr *ir_emit(IRFunc *f, IRBlock *b, IROp op, IRType type);
+void     ir_add_arg(IRInstr *in, IRInstr *arg);
+IRInstr *ir_const_num(IRFunc *f, IRBlock *b, double n);
+IRInstr *ir_binop(IRFunc *f, IRBlock *b, IROp op, IRType type, IRInstr *a, IRInstr *c);
+IRInstr *ir_unop(IRFunc *f, IRBlock *b, IROp op, IRType type, IRInstr *a);
+
+/* Terminators — also record the CFG edge in the successor's preds[]. */
+void     ir_jmp(IRFunc *f, IRBlock *b, IRBlock *to);
+void     ir_br(IRFunc *f, IRBlock *b, IRInstr *cond, IRBlock *t, IRBlock *e);
+/* Multi-way branch on `v`; add the keyed targets with ir_switch_case().
+ * Each target must be a fresh block whose only predecessor is `b`.    */
+IRInstr *ir_switch(IRFunc *f, IRBlock *b, IRInstr *v, IRBlock *dflt);
+void     ir_switch_case(IRInstr *sw, long long key, IRBlock *to);
+void     ir_ret(IRFunc *f, IRBlock *b, IRInstr *val);
+void     ir_unreachable(IRFunc *f, IRBlock *b);
+int      ir_is_terminator(IROp op);
+IRInstr *ir_terminator(IRBlock *b);
+
+/* SSA variables: lowering assigns each source variable an integer id. */
+void     ir_write_var(IRBlock *b, int var, IRInstr *val);
+IRInstr *ir_read_var(IRFunc *f, IRBlock *b, int var);
+void     ir_seal_block(IRFunc *f, IRBlock *b);
+
+/* Follow repl chains to the live definition. */
+IRInstr *ir_resolve(IRInstr *v);
+
+/* ── Passes ──────────────────────────────────────────────────────────────── */
+/* Most boxed results per function built in frame cells (128 bytes each). */
+#define IR_MAX_STACK_CELLS 16
+
+void     ir_optimize(IRFunc *f, int opt_level);
+/* After ir_optimize at -O2: 1 if every return of a num_abi function yields
+ * a raw f64 (i.e. the raw entry point is usable), always 1 otherwise. */
+int      ir_returns_num(IRFunc *f);
+void     ir_split_critical_edges(IRFunc *f);
+/* Recompute blocks[] in reverse postorder; drops unreachable blocks. */
+void     ir_order_blocks(IRFunc *f);
+/* Live, non-phi instructions: the inliner's size measure. */
+int      ir_func_size(IRFunc *f);
+/* Replace `call` (an IR_CALL in f passing every param) by a copy of the
+ * boxed, capture-free `callee`.  Returns 0 if the call was left alone. */
+int      ir_inline_call(IRFunc *f, IRInstr *call, IRFunc *callee);
+/* Cold blocks: the ones the lowering marked (an edge the profile never
+ * saw taken) and every block only cold blocks lead to.  Returns their
+ * count; the emitters lay them out apart from the hot path. */
+int      ir_mark_cold(IRFunc *f);
+/* Linear-scan allocation of `nregs` callee-saved registers over the final
+ * block order (run after ir_split_critical_edges).  Sets in->reg; values
+ * that lose out keep reg = -1 and live in their frame slot. */
+void     ir_regalloc(IRFunc *f, int nregs);
+
+/* ── Debug output (--emit-ir) ────────────────────────────────────────────── */
+const char *ir_op_name(IROp op);
+void     ir_print(IRFunc *f, FILE *out);
+
+#endif /* IR_H */
@@ -0,0 +1,1005 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * jit.c — baseline template JIT for the interpreter
+ *
+ * Native calling convention (one per compiled function):
+ *
+ *     int code(const double *args, double *ret);
+ *
+ * Arguments and the result are unboxed: numbers as themselves, bools as
+ * 0.0 / 1.0.  It returns 1 with *ret set, or 0 to deoptimize — compiled
+ * code has no side effects (it never writes a global or calls anything
+ * that could), so returning 0 at any point and evaluating the call again
+ * in eval() is always correct.
+ *
+ * Frame:
+ *     -8(%rbp)  saved %rbx        (%rbx = args)
+ *    -16(%rbp)  saved %r12        (%r12 = ret)
+ *    -24(%rbp)  result slot of nested calls
+ *    -32(%rbp)… one slot per local, never reused
+ * below that, 8-byte temporaries pushed while evaluating expressions.
+ * Every bail path restores %rsp from %rbp, so guards can jump out of any
+ * expression depth.
+ */
+
+/* _GNU_SOURCE: MAP_ANONYMOUS and open_memstream() (see multiproc.c). */
+#if !defined(__APPLE__)
+#define _GNU_SOURCE
+#endif
+#include "jit.h"
+#include "xenly_asm.h"
+
+#include <math.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#if defined(__APPLE__) && !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS 0x1000   // MAP_ANON, hidden by strict _POSIX_C_SOURCE
+#endif
+
+#if defined(__x86_64__) && !defined(_WIN32)
+#define JIT_SUPPORTED 1
+#else
+#define JIT_SUPPORTED 0
+#endif
+
+#define JIT_DEFAULT_THRESHOLD 1000
+#define JIT_MAX_PARAMS        16
+#define JIT_MAX_LOOPS         64
+#define JIT_BAIL_LIMIT        100   /* deopts before a function is dropped */
+
+enum { JK_NUM = 1, JK_BOOL = 2 };  /* what an unboxed double holds */
+
+typedef enum { JIT_COLD, JIT_COMPILING, JIT_READY, JIT_FAILED } JitState;
+
+typedef int (*JitCode)(const double *args, double *ret);
+
+typedef struct JitFn {
+    FnDef         *fn;
+    char          *name;
+    int            line;
+    JitState       state;
+    JitCode        code;           /* called through by other compiled fns */
+    void          *mem;
+    size_t         mem_size, code_size;
+    size_t         nparams;
+    unsigned char  param_kind[JIT_MAX_PARAMS];
+    int            ret_kind;       /* 0 until the first return is compiled */
+    int            ret_assumed;    /* a recursive call assumed JK_NUM      */
+    char           why[160];       /* why it is not compiled               */
+    unsigned long  bails;
+    /* --jit-stats */
+    unsigned long  native_calls;   /* every invocation, counted natively   */
+    unsigned long  native_entries; /* entries from the interpreter         */
+    uint64_t       native_ns;
+    unsigned long  interp_calls;
+    uint64_t       interp_ns;      /* self time, nested calls excluded     */
+    struct JitFn  *next;
+} JitFn;
+
+extern Interpreter *g_interp;
+
+int g_jit_on    = JIT_SUPPORTED;
+int g_jit_stats = 0;
+
+static unsigned long    g_threshold = JIT_DEFAULT_THRESHOLD;
+static JitFn           *g_fns       = NULL;
+static pthread_mutex_t  g_jit_lock  = PTHREAD_MUTEX_INITIALIZER;
+static unsigned long    g_bails     = 0;
+static _Thread_local JitTimer *t_timer = NULL;
+
+void jit_configure(int on, unsigned long threshold, int stats) {
+    g_jit_on    = on && JIT_SUPPORTED;
+    g_threshold = threshold ? threshold : JIT_DEFAULT_THRESHOLD;
+    g_jit_stats = stats;
+}
+
+int jit_supported(void) { return JIT_SUPPORTED; }
+
+static uint64_t jit_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+/* What a function that is not compiled (yet) is called through. */
+static int jit_bail_stub(const double *args, double *ret) {
+    (void)args; (void)ret;
+    return 0;
+}
+
+/* Caller holds g_jit_lock. */
+static JitFn *jit_attach_locked(FnDef *fn) {
+    if (fn->jit) return fn->jit;
+    JitFn *j = (JitFn *)calloc(1, sizeof(JitFn));
+    j->fn      = fn;
+    j->name    = strdup(fn->name ? fn->name : "<fn>");
+    j->line    = fn->body ? fn->body->line : 0;
+    j->state   = JIT_COLD;
+    j->code    = jit_bail_stub;
+    j->nparams = fn->param_count;
+    j->next    = g_fns;
+    g_fns      = j;
+    fn->jit    = j;
+    return j;
+}
+
+static JitFn *jit_attach(FnDef *fn) {
+    if (fn->jit) return fn->jit;
+    pthread_mutex_lock(&g_jit_lock);
+    JitFn *j = jit_attach_locked(fn);
+    pthread_mutex_unlock(&g_jit_lock);
+    return j;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * TEMPLATE COMPILER
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#if JIT_SUPPORTED
+
+#define SLOT_RET      (-24)
+#define SLOT(i)       (-32 - 8 * (i))
+
+typedef struct {
+    const char *name;
+    int         slot;
+    int         kind;
+    int         depth;
+    int         is_const;
+} JitLocal;
+
+typedef struct {
+    JitFn    *j;
+    FILE     *out;
+    char     *text;
+    size_t    len;
+    int       ok;
+    JitLocal *locals;
+    int       nlocals, cap;
+    int       nslots;
+    int       depth;       /* lexical block depth                        */
+    int       sp;          /* bytes of temporaries below the frame       */
+    int       label;
+    int       brk[JIT_MAX_LOOPS], cont[JIT_MAX_LOOPS];
+    int       nloops;
+} JitC;
+
+static void jit_compile(JitFn *j);
+
+static void jemit(JitC *c, const char *fmt, ...) {
+    va_list ap;
+    va_start(ap, fmt);
+    vfprintf(c->out, fmt, ap);
+    va_end(ap);
+    fputc('\n', c->out);
+}
+
+static const char *jc_what(NodeType t) {
+    switch (t) {
+        case NODE_STRING:          return "uses strings";
+        case NODE_NULL:            return "uses null";
+        case NODE_PRINT:           return "prints";
+        case NODE_INPUT:           return "reads input";
+        case NODE_ARRAY_LITERAL:
+        case NODE_INDEX:
+        case NODE_INDEX_ASSIGN:    return "uses arrays";
+        case NODE_OBJECT_LITERAL:
+        case NODE_PROPERTY_GET:
+        case NODE_PROPERTY_SET:
+        case NODE_NEW:
+        case NODE_THIS:            return "uses objects";
+        case NODE_METHOD_CALL:     return "calls methods";
+        case NODE_CALL_EXPR:       return "calls a function value";
+        case NODE_FN_DECL:
+        case NODE_ARROW_FN:
+        case NODE_BLOCK_FN:        return "defines a function";
+        case NODE_FOR_IN:
+        case NODE_FOR_OF:          return "iterates a collection";
+        case NODE_SWITCH:          return "uses switch";
+        case NODE_MATCH:           return "uses match";
+        case NODE_YIELD:
+        case NODE_YIELD_EMPTY:     return "yields";
+        case NODE_SPAWN:
+        case NODE_AWAIT:           return "is async";
+        default:                   return "uses syntax the JIT does not cover";
+    }
+}
+
+static int jc_reject(JitC *c, ASTNode *n, const char *fmt, ...) {
+    if (c->ok && !c->j->why[0]) {
+        char msg[128];
+        va_list ap;
+        va_start(ap, fmt);
+        vsnprintf(msg, sizeof(msg), fmt, ap);
+        va_end(ap);
+        snprintf(c->j->why, sizeof(c->j->why), "line %d: %s", n ? n->line : c->j->line, msg);
+    }
+    c->ok = 0;
+    return 0;
+}
+
+static int jc_label(JitC *c) { return c->label++; }
+
+static void jc_push(JitC *c) {
+    jemit(c, "    subq    $8, %%rsp");
+    jemit(c, "    movsd   %%xmm0, (%%rsp)");
+    c->sp += 8;
+}
+
+static void jc_pop(JitC *c, int xmm) {
+    jemit(c, "    movsd   (%%rsp), %%xmm%d", xmm);
+    jemit(c, "    addq    $8, %%rsp");
+    c->sp -= 8;
+}
+
+static void jc_const(JitC *c, int xmm, double d) {
+    if (d == 0.0 && !signbit(d)) {
+        jemit(c, "    xorpd   %%xmm%d, %%xmm%d", xmm, xmm);
+        return;
+    }
+    unsigned long long bits;
+    memcpy(&bits, &d, sizeof(bits));
+    jemit(c, "    movabsq $%llu, %%rax", bits);
+    jemit(c, "    movq    %%rax, %%xmm%d", xmm);
+}
+
+/* Jump to .Lj<l> when xmm0 is falsy (0.0; NaN is truthy), or truthy. */
+static void jc_branch_false(JitC *c, int l) {
+    int skip = jc_label(c);
+    jemit(c, "    xorpd   %%xmm2, %%xmm2");
+    jemit(c, "    ucomisd %%xmm2, %%xmm0");
+    jemit(c, "    jp      .Lj%d", skip);
+    jemit(c, "    je      .Lj%d", l);
+    jemit(c, ".Lj%d:", skip);
+}
+
+static void jc_branch_true(JitC *c, int l) {
+    jemit(c, "    xorpd   %%xmm2, %%xmm2");
+    jemit(c, "    ucomisd %%xmm2, %%xmm0");
+    jemit(c, "    jp      .Lj%d", l);
+    jemit(c, "    jne     .Lj%d", l);
+}
+
+/* %al → xmm0 as 0.0 / 1.0 */
+static void jc_bool_result(JitC *c) {
+    jemit(c, "    movzbl  %%al, %%eax");
+    jemit(c, "    cvtsi2sdl %%eax, %%xmm0");
+}
+
+/* ── locals ──────────────────────────────────────────────────────────────── */
+
+static JitLocal *jc_find(JitC *c, const char *name) {
+    for (int i = c->nlocals - 1; i >= 0; i--)
+        if (strcmp(c->locals[i].name, name) == 0) return &c->locals[i];
+    return NULL;
+}
+
+static JitLocal *jc_declare(JitC *c, ASTNode *n, const char *name, int kind, int is_const) {
+    JitLocal *l = jc_find(c, name);
+    /* var/let on a name already in this scope rebinds it (env_set) */
+    if (l && l->depth == c->depth && !is_const) {
+        if (l->is_const) { jc_reject(c, n, "redeclares const '%s'", name); return NULL; }
+        if (l->kind != kind) { jc_reject(c, n, "changes the type of '%s'", name); return NULL; }
+        return l;
+    }
+    if (c->nlocals == c->cap) {
+        c->cap    = c->cap ? c->cap * 2 : 16;
+        c->locals = (JitLocal *)realloc(c->locals, sizeof(JitLocal) * (size_t)c->cap);
+    }
+    l = &c->locals[c->nlocals++];
+    l->name     = name;
+    l->slot     = c->nslots++;
+    l->kind     = kind;
+    l->depth    = c->depth;
+    l->is_const = is_const;
+    return l;
+}
+
+static void jc_scope_pop(JitC *c) {
+    while (c->nlocals && c->locals[c->nlocals - 1].depth == c->depth) c->nlocals--;
+    c->depth--;
+}
+
+/* The binding env_get would find from the function's scope once no local
+ * matches: functions are only compiled when they close over the globals. */
+static EnvEntry *jc_global(const char *name) {
+    for (EnvEntry *e = g_interp->global->entries; e; e = e->next)
+        if (strcmp(e->name, name) == 0) return e;
+    return NULL;
+}
+
+/* %rax = the Value currently bound to entry e */
+static void jc_load_binding(JitC *c, EnvEntry *e) {
+    jemit(c, "    movabsq $%llu, %%rax", (unsigned long long)(uintptr_t)e);
+    jemit(c, "    movq    %d(%%rax), %%rax", (int)offsetof(EnvEntry, value));
+}
+
+/* ── expressions: leave the value in %xmm0 and return its kind ───────────── */
+
+static int jc_expr(JitC *c, ASTNode *n);
+
+static int jc_global_read(JitC *c, ASTNode *n) {
+    EnvEntry *e = jc_global(n->str_value);
+    if (!e || !e->value) return jc_reject(c, n, "reads undefined '%s'", n->str_value);
+    int kind = e->value->type == VAL_NUMBER ? JK_NUM
+             : e->value->type == VAL_BOOL   ? JK_BOOL : 0;
+    if (!kind) return jc_reject(c, n, "reads global '%s', which is not a number or bool", n->str_value);
+    jc_load_binding(c, e);
+    jemit(c, "    cmpl    $%d, %d(%%rax)", kind == JK_NUM ? VAL_NUMBER : VAL_BOOL,
+          (int)offsetof(Value, type));
+    jemit(c, "    jne     .Lbail");
+    if (kind == JK_NUM) {
+        jemit(c, "    movsd   %d(%%rax), %%xmm0", (int)offsetof(Value, num));
+    } else {
+        jemit(c, "    cmpl    $0, %d(%%rax)", (int)offsetof(Value, boolean));
+        jemit(c, "    setne   %%al");
+        jc_bool_result(c);
+    }
+    return kind;
+}
+
+static int jc_call(JitC *c, ASTNode *n) {
+    const char *name = n->str_value;
+    size_t argc = n->child_count;
+    if (jc_find(c, name)) return jc_reject(c, n, "calls local '%s'", name);
+    for (size_t i = 0; i < argc; i++)
+        if (n->children[i]->type == NODE_NAMED_ARG)
+            return jc_reject(c, n, "passes named arguments");
+    EnvEntry *e = jc_global(name);
+    if (!e || !e->value) return jc_reject(c, n, "calls undefined '%s'", name);
+    if (e->value->type == VAL_BUILTIN_FN) return jc_reject(c, n, "calls builtin '%s'", name);
+    FnDef *cf = e->value->type == VAL_FUNCTION ? e->value->fn : NULL;
+    if (!cf || !cf->body) return jc_reject(c, n, "calls '%s', which is not a function", name);
+    if (argc != cf->param_count)
+        return jc_reject(c, n, "calls '%s' with %zu of %zu arguments", name, argc, cf->param_count);
+    if (argc > JIT_MAX_PARAMS) return jc_reject(c, n, "calls '%s' with too many arguments", name);
+
+    /* arguments, last first, so they end up in order at (%rsp) */
+    int pad = (c->sp + 8 * (int)argc) % 16 ? 8 : 0;
+    if (pad) {
+        jemit(c, "    subq    $8, %%rsp");
+        c->sp += 8;
+    }
+    unsigned char kinds[JIT_MAX_PARAMS];
+    for (size_t i = argc; i-- > 0;) {
+        int k = jc_expr(c, n->children[i]);
+        if (!k) return 0;
+        kinds[i] = (unsigned char)k;
+        jc_push(c);
+    }
+
+    JitFn *cj = jit_attach_locked(cf);
+    if (cj->state == JIT_COLD) {
+        memcpy(cj->param_kind, kinds, argc);
+        jit_compile(cj);
+    }
+    if (cj->state == JIT_FAILED)
+        return jc_reject(c, n, "calls '%s', which is not compiled", name);
+    if (memcmp(cj->param_kind, kinds, argc) != 0)
+        return jc_reject(c, n, "calls '%s' with other argument types", name);
+    int kind = cj->ret_kind;
+    if (!kind) {                /* recursion before the callee's first return */
+        cj->ret_assumed = 1;
+        kind = JK_NUM;
+    }
+
+    /* the name must still be bound to the same function */
+    jc_load_binding(c, e);
+    jemit(c, "    cmpl    $%d, %d(%%rax)", VAL_FUNCTION, (int)offsetof(Value, type));
+    jemit(c, "    jne     .Lbail");
+    jemit(c, "    movabsq $%llu, %%rcx", (unsigned long long)(uintptr_t)cf);
+    jemit(c, "    cmpq    %%rcx, %d(%%rax)", (int)offsetof(Value, fn));
+    jemit(c, "    jne     .Lbail");
+    jemit(c, "    movq    %%rsp, %%rdi");
+    jemit(c, "    leaq    %d(%%rbp), %%rsi", SLOT_RET);
+    if (cj == c->j) {
+        jemit(c, "    call    .Lentry");
+    } else {
+        jemit(c, "    movabsq $%llu, %%rax", (unsigned long long)(uintptr_t)&cj->code);
+        jemit(c, "    call    *(%%rax)");
+    }
+    jemit(c, "    addq    $%d, %%rsp", 8 * (int)argc + pad);
+    c->sp -= 8 * (int)argc + pad;
+    jemit(c, "    testl   %%eax, %%eax");
+    jemit(c, "    je      .Lbail");
+    jemit(c, "    movsd   %d(%%rbp), %%xmm0", SLOT_RET);
+    return kind;
+}
+
+/* %rax = (long long)xmm0, %rcx = (long long)xmm1 */
+static void jc_to_int(JitC *c) {
+    jemit(c, "    cvttsd2si %%xmm0, %%rax");
+    jemit(c, "    cvttsd2si %%xmm1, %%rcx");
+}
+
+static int jc_binary(JitC *c, ASTNode *n) {
+    const char *op = n->str_value;
+
+    /* and / or yield one of their operands, like eval() */
+    if (!strcmp(op, "and") || !strcmp(op, "or")) {
+        int end = jc_label(c);
+        int kl = jc_expr(c, n->children[0]);
+        if (!kl) return 0;
+        if (op[0] == 'a') jc_branch_false(c, end);
+        else              jc_branch_true(c, end);
+        int kr = jc_expr(c, n->children[1]);
+        if (!kr) return 0;
+        jemit(c, ".Lj%d:", end);
+        if (kl != kr) return jc_reject(c, n, "'%s' mixes numbers and bools", op);
+        return kl;
+    }
+
+    int kr = jc_expr(c, n->children[1]);
+    if (!kr) return 0;
+    jc_push(c);
+    int kl = jc_expr(c, n->children[0]);
+    if (!kl) return 0;
+    jc_pop(c, 1);
+
+    if (!strcmp(op, "==") || !strcmp(op, "!=")) {
+        if (kl != kr) return jc_reject(c, n, "compares a number with a bool");
+        jemit(c, "    ucomisd %%xmm1, %%xmm0");
+        if (op[0] == '=') {
+            jemit(c, "    sete    %%al");
+            jemit(c, "    setnp   %%cl");
+            jemit(c, "    andb    %%cl, %%al");
+        } else {
+            jemit(c, "    setne   %%al");
+            jemit(c, "    setp    %%cl");
+            jemit(c, "    orb     %%cl, %%al");
+        }
+        jc_bool_result(c);
+        return JK_BOOL;
+    }
+    if (kl != JK_NUM || kr != JK_NUM)
+        return jc_reject(c, n, "applies '%s' to a bool", op);
+
+    if (!strcmp(op, "+")) { jemit(c, "    addsd   %%xmm1, %%xmm0"); return JK_NUM; }
+    if (!strcmp(op, "-")) { jemit(c, "    subsd   %%xmm1, %%xmm0"); return JK_NUM; }
+    if (!strcmp(op, "*")) { jemit(c, "    mulsd   %%xmm1, %%xmm0"); return JK_NUM; }
+    if (!strcmp(op, "/")) {
+        /* x / 0 is an error eval() reports */
+        int ok = jc_label(c);
+        jemit(c, "    xorpd   %%xmm2, %%xmm2");
+        jemit(c, "    ucomisd %%xmm2, %%xmm1");
+        jemit(c, "    jp      .Lj%d", ok);
+        jemit(c, "    je      .Lbail");
+        jemit(c, ".Lj%d:", ok);
+        jemit(c, "    divsd   %%xmm1, %%xmm0");
+        return JK_NUM;
+    }
+    if (!strcmp(op, "%")) {
+        int neg1 = jc_label(c), done = jc_label(c);
+        jc_to_int(c);
+        jemit(c, "    testq   %%rcx, %%rcx");
+        jemit(c, "    je      .Lbail");
+        jemit(c, "    cmpq    $-1, %%rcx");
+        jemit(c, "    je      .Lj%d", neg1);
+        jemit(c, "    cqto");
+        jemit(c, "    idivq   %%rcx");
+        jemit(c, "    cvtsi2sdq %%rdx, %%xmm0");
+        jemit(c, "    jmp     .Lj%d", done);
+        jemit(c, ".Lj%d:", neg1);
+        jemit(c, "    xorpd   %%xmm0, %%xmm0");
+        jemit(c, ".Lj%d:", done);
+        return JK_NUM;
+    }
+    if (!strcmp(op, "<"))  { jemit(c, "    ucomisd %%xmm0, %%xmm1"); jemit(c, "    seta    %%al"); }
+    else if (!strcmp(op, "<=")) { jemit(c, "    ucomisd %%xmm0, %%xmm1"); jemit(c, "    setae   %%al"); }
+    else if (!strcmp(op, ">"))  { jemit(c, "    ucomisd %%xmm1, %%xmm0"); jemit(c, "    seta    %%al"); }
+    else if (!strcmp(op, ">=")) { jemit(c, "    ucomisd %%xmm1, %%xmm0"); jemit(c, "    setae   %%al"); }
+    else {
+        static const struct { const char *op, *ins; } bit[] = {
+            {"&", "andq"}, {"|", "orq"}, {"^", "xorq"}, {"<<", "salq"}, {">>", "sarq"},
+        };
+        for (size_t i = 0; i < sizeof(bit) / sizeof(bit[0]); i++) {
+            if (strcmp(op, bit[i].op)) continue;
+            jc_to_int(c);
+            if (op[0] == '<' || op[0] == '>') jemit(c, "    %s    %%cl, %%rax", bit[i].ins);
+            else                              jemit(c, "    %s    %%rcx, %%rax", bit[i].ins);
+            jemit(c, "    cvtsi2sdq %%rax, %%xmm0");
+            return JK_NUM;
+        }
+        return jc_reject(c, n, "uses operator '%s'", op);
+    }
+    jc_bool_result(c);
+    return JK_BOOL;
+}
+
+static int jc_expr(JitC *c, ASTNode *n) {
+    if (!c->ok) return 0;
+    if (!n) return jc_reject(c, NULL, "has an empty expression");
+    switch (n->type) {
+    case NODE_NUMBER:
+        jc_const(c, 0, n->num_value);
+        return JK_NUM;
+    case NODE_BOOL:
+        jc_const(c, 0, n->bool_value ? 1.0 : 0.0);
+        return JK_BOOL;
+    case NODE_IDENTIFIER: {
+        JitLocal *l = jc_find(c, n->str_value);
+        if (!l) return jc_global_read(c, n);
+        jemit(c, "    movsd   %d(%%rbp), %%xmm0", SLOT(l->slot));
+        return l->kind;
+    }
+    case NODE_BINARY:
+        return jc_binary(c, n);
+    case NODE_UNARY: {
+        int k = jc_expr(c, n->children[0]);
+        if (!k) return 0;
+        if (!strcmp(n->str_value, "not")) {
+            jemit(c, "    xorpd   %%xmm1, %%xmm1");
+            jemit(c, "    ucomisd %%xmm1, %%xmm0");
+            jemit(c, "    sete    %%al");
+            jemit(c, "    setnp   %%cl");
+            jemit(c, "    andb    %%cl, %%al");
+            jc_bool_result(c);
+            return JK_BOOL;
+        }
+        if (k != JK_NUM) return jc_reject(c, n, "applies '%s' to a bool", n->str_value);
+        if (!strcmp(n->str_value, "-")) {
+            jemit(c, "    movabsq $%llu, %%rax", 0x8000000000000000ull);
+            jemit(c, "    movq    %%rax, %%xmm1");
+            jemit(c, "    xorpd   %%xmm1, %%xmm0");
+            return JK_NUM;
+        }
+        if (!strcmp(n->str_value, "~")) {
+            jemit(c, "    cvttsd2si %%xmm0, %%rax");
+            jemit(c, "    notq    %%rax");
+            jemit(c, "    cvtsi2sdq %%rax, %%xmm0");
+            return JK_NUM;
+        }
+        return jc_reject(c, n, "uses operator '%s'", n->str_value);
+    }
+    case NODE_TERNARY: {
+        int other = jc_label(c), end = jc_label(c);
+        if (!jc_expr(c, n->children[0])) return 0;
+        jc_branch_false(c, other);
+        int k1 = jc_expr(c, n->children[1]);
+        jemit(c, "    jmp     .Lj%d", end);
+        jemit(c, ".Lj%d:", other);
+        int k2 = jc_expr(c, n->children[2]);
+        jemit(c, ".Lj%d:", end);
+        if (!k1 || !k2) return 0;
+        if (k1 != k2) return jc_reject(c, n, "'?:' mixes numbers and bools");
+        return k1;
+    }
+    case NODE_FN_CALL:
+        return jc_call(c, n);
+    default:
+        return jc_reject(c, n, "%s", jc_what(n->type));
+    }
+}
+
+/* ── statements ──────────────────────────────────────────────────────────── */
+
+static JitLocal *jc_assignable(JitC *c, ASTNode *n, const char *name) {
+    JitLocal *l = jc_find(c, name);
+    if (!l) { jc_reject(c, n, "assigns to '%s', which is not a local", name); return NULL; }
+    if (l->is_const) { jc_reject(c, n, "assigns to const '%s'", name); return NULL; }
+    return l;
+}
+
+static void jc_stmt(JitC *c, ASTNode *n);
+
+static void jc_loop_body(JitC *c, ASTNode *body, int brk, int cont) {
+    if (c->nloops == JIT_MAX_LOOPS) { jc_reject(c, body, "nests loops too deeply"); return; }
+    c->brk[c->nloops]  = brk;
+    c->cont[c->nloops] = cont;
+    c->nloops++;
+    jc_stmt(c, body);
+    c->nloops--;
+}
+
+static void jc_stmt(JitC *c, ASTNode *n) {
+    if (!n || !c->ok) return;
+    switch (n->type) {
+    case NODE_BLOCK:
+        c->depth++;
+        for (size_t i = 0; i < n->child_count; i++) jc_stmt(c, n->children[i]);
+        jc_scope_pop(c);
+        return;
+
+    case NODE_VAR_DECL:
+    case NODE_LET_DECL:
+    case NODE_CONST_DECL: {
+        if (n->child_count == 0) { jc_reject(c, n, "declares '%s' without a value", n->str_value); return; }
+        int k = jc_expr(c, n->children[0]);
+        if (!k) return;
+        JitLocal *l = jc_declare(c, n, n->str_value, k, n->type == NODE_CONST_DECL);
+        if (l) jemit(c, "    movsd   %%xmm0, %d(%%rbp)", SLOT(l->slot));
+        return;
+    }
+
+    case NODE_ASSIGN: {
+        JitLocal *l = jc_assignable(c, n, n->str_value);
+        if (!l) return;
+        int k = jc_expr(c, n->children[0]);
+        if (!k) return;
+        if (k != l->kind) { jc_reject(c, n, "changes the type of '%s'", n->str_value); return; }
+        jemit(c, "    movsd   %%xmm0, %d(%%rbp)", SLOT(l->slot));
+        return;
+    }
+
+    case NODE_COMPOUND_ASSIGN: {
+        const char *name = n->children[0]->str_value;
+        JitLocal *l = jc_assignable(c, n, name);
+        if (!l) return;
+        if (l->kind != JK_NUM) { jc_reject(c, n, "applies '%s' to a bool", n->str_value); return; }
+        int k = jc_expr(c, n->children[1]);
+        if (!k) return;
+        if (k != JK_NUM) { jc_reject(c, n, "applies '%s' to a bool", n->str_value); return; }
+        jemit(c, "    movapd  %%xmm0, %%xmm1");
+        jemit(c, "    movsd   %d(%%rbp), %%xmm0", SLOT(l->slot));
+        switch (n->str_value[0]) {
+        case '+': jemit(c, "    addsd   %%xmm1, %%xmm0"); break;
+        case '-': jemit(c, "    subsd   %%xmm1, %%xmm0"); break;
+        case '*': jemit(c, "    mulsd   %%xmm1, %%xmm0"); break;
+        case '/': {
+            int ok = jc_label(c);
+            jemit(c, "    xorpd   %%xmm2, %%xmm2");
+            jemit(c, "    ucomisd %%xmm2, %%xmm1");
+            jemit(c, "    jp      .Lj%d", ok);
+            jemit(c, "    je      .Lbail");
+            jemit(c, ".Lj%d:", ok);
+            jemit(c, "    divsd   %%xmm1, %%xmm0");
+            break;
+        }
+        default:
+            jc_reject(c, n, "uses '%s'", n->str_value);
+            return;
+        }
+        jemit(c, "    movsd   %%xmm0, %d(%%rbp)", SLOT(l->slot));
+        return;
+    }
+
+    case NODE_INCREMENT:
+    case NODE_DECREMENT: {
+        JitLocal *l = jc_assignable(c, n, n->str_value);
+        if (!l) return;
+        if (l->kind != JK_NUM) { jc_reject(c, n, "increments a bool"); return; }
+        jc_const(c, 1, 1.0);
+        jemit(c, "    movsd   %d(%%rbp), %%xmm0", SLOT(l->slot));
+        jemit(c, "    %s   %%xmm1, %%xmm0", n->type == NODE_INCREMENT ? "addsd" : "subsd");
+        jemit(c, "    movsd   %%xmm0, %d(%%rbp)", SLOT(l->slot));
+        return;
+    }
+
+    case NODE_IF: {
+        int other = jc_label(c), end = jc_label(c);
+        if (!jc_expr(c, n->children[0])) return;
+        jc_branch_false(c, other);
+        jc_stmt(c, n->children[1]);
+        jemit(c, "    jmp     .Lj%d", end);
+        jemit(c, ".Lj%d:", other);
+        if (n->child_count > 2) jc_stmt(c, n->children[2]);
+        jemit(c, ".Lj%d:", end);
+        return;
+    }
+
+    case NODE_WHILE: {
+        int top = jc_label(c), end = jc_label(c);
+        jemit(c, ".Lj%d:", top);
+        if (!jc_expr(c, n->children[0])) return;
+        jc_branch_false(c, end);
+        jc_loop_body(c, n->children[1], end, top);
+        jemit(c, "    jmp     .Lj%d", top);
+        jemit(c, ".Lj%d:", end);
+        return;
+    }
+
+    case NODE_FOR: {
+        int top = jc_label(c), next = jc_label(c), end = jc_label(c);
+        if (!n->children[1]) { jc_reject(c, n, "has a for loop without a condition"); return; }
+        jc_stmt(c, n->children[0]);
+        jemit(c, ".Lj%d:", top);
+        if (!jc_expr(c, n->children[1])) return;
+        jc_branch_false(c, end);
+        jc_loop_body(c, n->children[3], end, next);
+        jemit(c, ".Lj%d:", next);
+        jc_stmt(c, n->children[2]);
+        jemit(c, "    jmp     .Lj%d", top);
+        jemit(c, ".Lj%d:", end);
+        return;
+    }
+
+    case NODE_DO_WHILE: {
+        int top = jc_label(c), cond = jc_label(c), end = jc_label(c);
+        jemit(c, ".Lj%d:", top);
+        jc_loop_body(c, n->children[0], end, cond);
+        jemit(c, ".Lj%d:", cond);
+        if (!jc_expr(c, n->children[1])) return;
+        jc_branch_true(c, top);
+        jemit(c, ".Lj%d:", end);
+        return;
+    }
+
+    case NODE_BREAK:
+    case NODE_CONTINUE:
+        if (!c->nloops) { jc_reject(c, n, "breaks out of a function"); return; }
+        jemit(c, "    jmp     .Lj%d", n->type == NODE_BREAK ? c->brk[c->nloops - 1]
+                                                            : c->cont[c->nloops - 1]);
+        return;
+
+    case NODE_RETURN: {
+        if (n->child_count == 0) { jc_reject(c, n, "returns nothing"); return; }
+        int k = jc_expr(c, n->children[0]);
+        if (!k) return;
+        if (!c->j->ret_kind) c->j->ret_kind = k;
+        else if (c->j->ret_kind != k) { jc_reject(c, n, "returns both numbers and bools"); return; }
+        jemit(c, "    jmp     .Lret");
+        return;
+    }
+
+    case NODE_EXPR_STMT:
+        jc_expr(c, n->children[0]);
+        return;
+
+    default:
+        jc_expr(c, n);
+        return;
+    }
+}
+
+/* Compile j (state COLD, param kinds set).  Caller holds g_jit_lock. */
+static void jit_compile(JitFn *j) {
+    FnDef *fn = j->fn;
+    JitC c;
+    memset(&c, 0, sizeof(c));
+    c.j  = j;
+    c.ok = 1;
+    j->state = JIT_COMPILING;
+
+    if (fn->is_generator)                    jc_reject(&c, fn->body, "is a generator");
+    else if (fn->is_async)                   jc_reject(&c, fn->body, "is async");
+    else if (fn->closure != g_interp->global) jc_reject(&c, fn->body, "is a closure");
+    else if (fn->param_count > JIT_MAX_PARAMS) jc_reject(&c, fn->body, "has too many parameters");
+    if (!c.ok) { j->state = JIT_FAILED; return; }
+
+    c.out = open_memstream(&c.text, &c.len);
+    for (size_t i = 0; i < fn->param_count; i++) {
+        JitLocal *l = jc_declare(&c, fn->body, fn->params[i].name, j->param_kind[i], 0);
+        jemit(&c, "    movsd   %zu(%%rbx), %%xmm0", 8 * i);
+        jemit(&c, "    movsd   %%xmm0, %d(%%rbp)", SLOT(l->slot));
+    }
+    jc_stmt(&c, fn->body);
+    jemit(&c, "    jmp     .Lbail");      /* fell off the end: eval() knows the value */
+    fclose(c.out);
+    free(c.locals);
+
+    if (c.ok && !j->ret_kind) jc_reject(&c, fn->body, "never returns a value");
+    if (c.ok && j->ret_assumed && j->ret_kind != JK_NUM)
+        jc_reject(&c, fn->body, "returns a bool from a recursive call");
+
+    char *src = NULL;
+    size_t src_len = 0;
+    if (c.ok) {
+        int frame = (8 * (c.nslots + 1) + 15) & ~15;
+        FILE *f = open_memstream(&src, &src_len);
+        fprintf(f, "    .text\n");
+        fprintf(f, ".Lentry:\n");
+        fprintf(f, "    pushq   %%rbp\n");
+        fprintf(f, "    movq    %%rsp, %%rbp\n");
+        fprintf(f, "    pushq   %%rbx\n");
+        fprintf(f, "    pushq   %%r12\n");
+        fprintf(f, "    subq    $%d, %%rsp\n", frame);
+        fprintf(f, "    movq    %%rdi, %%rbx\n");
+        fprintf(f, "    movq    %%rsi, %%r12\n");
+        if (g_jit_stats) {
+            fprintf(f, "    movabsq $%llu, %%rax\n", (unsigned long long)(uintptr_t)&j->native_calls);
+            fprintf(f, "    incq    (%%rax)\n");
+        }
+        fwrite(c.text, 1, c.len, f);
+        fprintf(f, ".Lret:\n");
+        fprintf(f, "    movsd   %%xmm0, (%%r12)\n");
+        fprintf(f, "    movl    $1, %%eax\n");
+        fprintf(f, "    jmp     .Lexit\n");
+        fprintf(f, ".Lbail:\n");
+        fprintf(f, "    xorl    %%eax, %%eax\n");
+        fprintf(f, ".Lexit:\n");
+        fprintf(f, "    leaq    -16(%%rbp), %%rsp\n");
+        fprintf(f, "    popq    %%r12\n");
+        fprintf(f, "    popq    %%rbx\n");
+        fprintf(f, "    popq    %%rbp\n");
+        fprintf(f, "    ret\n");
+        fclose(f);
+    }
+    free(c.text);
+    if (!c.ok) { j->state = JIT_FAILED; free(src); return; }
+
+    unsigned char *code = NULL;
+    size_t size = 0;
+    char err[256];
+    if (xlas_assemble_code(src, src_len, &code, &size, err, sizeof(err)) != XLAS_OK) {
+        snprintf(j->why, sizeof(j->why), "assembler: %.140s", err);
+        j->state = JIT_FAILED;
+        free(src);
+        return;
+    }
+    free(src);
+
+    long page = sysconf(_SC_PAGESIZE);
+    size_t msize = (size + (size_t)page - 1) & ~((size_t)page - 1);
+    void *mem = mmap(NULL, msize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mem == MAP_FAILED) {
+        snprintf(j->why, sizeof(j->why), "cannot map code memory");
+        j->state = JIT_FAILED;
+        free(code);
+        return;
+    }
+    memcpy(mem, code, size);
+    free(code);
+    if (mprotect(mem, msize, PROT_READ | PROT_EXEC) != 0) {
+        munmap(mem, msize);
+        snprintf(j->why, sizeof(j->why), "cannot make code memory executable");
+        j->state = JIT_FAILED;
+        return;
+    }
+    j->mem       = mem;
+    j->mem_size  = msize;
+    j->code_size = size;
+    j->code      = (JitCode)mem;
+    j->state     = JIT_READY;
+}
+
+/* First call at or over the threshold: specialize on these arguments. */
+static JitFn *jit_compile_hot(FnDef *fn, Value **args, size_t argc) {
+    if (argc != fn->param_count || argc > JIT_MAX_PARAMS) return NULL;
+    unsigned char kinds[JIT_MAX_PARAMS];
+    for (size_t i = 0; i < argc; i++) {
+        if (!args[i]) return NULL;
+        if (args[i]->type == VAL_NUMBER)    kinds[i] = JK_NUM;
+        else if (args[i]->type == VAL_BOOL) kinds[i] = JK_BOOL;
+        else return NULL;           /* maybe a later call passes numbers */
+    }
+    pthread_mutex_lock(&g_jit_lock);
+    JitFn *j = jit_attach_locked(fn);
+    if (j->state == JIT_COLD) {
+        memcpy(j->param_kind, kinds, argc);
+        jit_compile(j);
+    }
+    pthread_mutex_unlock(&g_jit_lock);
+    return j->state == JIT_READY ? j : NULL;
+}
+
+#endif /* JIT_SUPPORTED */
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * RUNTIME
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+Value *jit_call(FnDef *fn, Value **args, size_t argc) {
+#if JIT_SUPPORTED
+    JitFn *j = fn->jit;
+    if (!j || j->state != JIT_READY) {
+        if (j && j->state != JIT_COLD) return NULL;
+        if (++fn->jit_heat < g_threshold) return NULL;
+        if (!(j = jit_compile_hot(fn, args, argc))) return NULL;
+    }
+    if (argc != j->nparams) return NULL;
+
+    double a[JIT_MAX_PARAMS];
+    for (size_t i = 0; i < argc; i++) {
+        Value *v = args[i];
+        if (!v) return NULL;
+        if (j->param_kind[i] == JK_NUM) {
+            if (v->type != VAL_NUMBER) return NULL;
+            a[i] = v->num;
+        } else {
+            if (v->type != VAL_BOOL) return NULL;
+            a[i] = v->boolean ? 1.0 : 0.0;
+        }
+    }
+
+    double r = 0;
+    int ok;
+    if (g_jit_stats) {
+        uint64_t t0 = jit_now();
+        ok = j->code(a, &r);
+        uint64_t el = jit_now() - t0;
+        j->native_ns += el;
+        j->native_entries++;
+        if (t_timer) t_timer->child += el;
+    } else {
+        ok = j->code(a, &r);
+    }
+    if (!ok) {
+        g_bails++;
+        if (++j->bails >= JIT_BAIL_LIMIT) {
+            /* callers compiled against it now deoptimize too */
+            j->code  = jit_bail_stub;
+            j->state = JIT_FAILED;
+            snprintf(j->why, sizeof(j->why), "deoptimized %lu times", j->bails);
+        }
+        return NULL;
+    }
+    return j->ret_kind == JK_BOOL ? value_bool(r != 0.0) : value_number(r);
+#else
+    (void)fn; (void)args; (void)argc;
+    return NULL;
+#endif
+}
+
+void jit_time_begin(JitTimer *t) {
+    t->child  = 0;
+    t->parent = t_timer;
+    t_timer   = t;
+    t->t0     = jit_now();
+}
+
+void jit_time_end(JitTimer *t, FnDef *fn) {
+    uint64_t el = jit_now() - t->t0;
+    t_timer = t->parent;
+    if (t_timer) t_timer->child += el;
+    JitFn *j = jit_attach(fn);
+    j->interp_calls++;
+    j->interp_ns += el > t->child ? el - t->child : 0;
+}
+
+static const char *jit_kind_name(int k) { return k == JK_BOOL ? "bool" : "num"; }
+
+void jit_report(FILE *out) {
+    int compiled = 0, rejected = 0;
+    uint64_t native_ns = 0;
+    for (JitFn *j = g_fns; j; j = j->next) {
+        if (j->state == JIT_READY) compiled++;
+        else if (j->state == JIT_FAILED) rejected++;
+    }
+    fprintf(out, "\n── JIT ─────────────────────────────────────────────────────────\n");
+    if (!JIT_SUPPORTED) {
+        fprintf(out, "  not available on this target\n\n");
+        return;
+    }
+    fprintf(out, "  %s, threshold %lu, %d compiled, %d not compiled, %lu deopts\n",
+            g_jit_on ? "on" : "off", g_threshold, compiled, rejected, g_bails);
+    for (JitFn *j = g_fns; j; j = j->next) {
+        if (j->state != JIT_READY) continue;
+        char sig[96];
+        size_t at = (size_t)snprintf(sig, sizeof(sig), "%s(", j->name);
+        for (size_t i = 0; i < j->nparams && at < sizeof(sig); i++)
+            at += (size_t)snprintf(sig + at, sizeof(sig) - at, "%s%s", i ? ", " : "",
+                                   jit_kind_name(j->param_kind[i]));
+        if (at < sizeof(sig))
+            snprintf(sig + at, sizeof(sig) - at, ") -> %s", jit_kind_name(j->ret_kind));
+        fprintf(out, "  compiled  %-28s line %-5d %5zu bytes  %10lu native calls  %lu deopts\n",
+                sig, j->line, j->code_size, j->native_calls, j->bails);
+        /* measured only: a recursive function's native calls mostly run
+         * under one entry, so scaling the interpreted cost up by them
+         * says nothing about the program */
+        fprintf(out, "            native: %lu entries, %.1f ms   interpreted: %lu calls, %.1f ms self\n",
+                j->native_entries, (double)j->native_ns / 1e6,
+                j->interp_calls, (double)j->interp_ns / 1e6);
+        native_ns += j->native_ns;
+    }
+    for (JitFn *j = g_fns; j; j = j->next)
+        if (j->state == JIT_FAILED)
+            fprintf(out, "  skipped   %-28s line %-5d %s\n", j->name, j->line, j->why);
+    fprintf(out, "  time in compiled code: %.1f ms\n\n", (double)native_ns / 1e6);
+}
+
+void jit_shutdown(void) {
+    JitFn *j = g_fns;
+    while (j) {
+        JitFn *next = j->next;
+        if (j->mem) munmap(j->mem, j->mem_size);
+        free(j->name);
+        free(j);
+        j = next;
+    }
+    g_fns = NULL;
+}
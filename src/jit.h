@@ -0,0 +1,74 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * jit.h — baseline template JIT for the interpreter (x86-64)
+ *
+ * The interpreter counts, per FnDef, its calls and the loop back-edges its
+ * body takes (FnDef.jit_heat).  Once a function's heat reaches the
+ * threshold, its next call compiles it: every statement and expression is
+ * expanded from a fixed x86-64 template (the same SSE sequences the
+ * compiler's backend emits for unboxed numbers), the text is assembled by
+ * xlas and copied into RW memory that is then flipped to RX.
+ *
+ * Compiled code only handles what it can do without touching the heap:
+ * numbers and bools in locals and parameters, reads of global numbers and
+ * bools, arithmetic, comparisons, if/while/for/do-while, and calls to other
+ * compilable functions.  A function using anything else stays in eval()
+ * (--jit-stats says why).  At run time every assumption is guarded — the
+ * types of the arguments and globals, which function a global name is
+ * bound to, divisors — and a failed guard deoptimizes: the native code
+ * returns without having changed anything and eval() runs the whole call.
+ */
+
+#ifndef JIT_H
+#define JIT_H
+
+#include "interpreter.h"
+#include <stdint.h>
+#include <stdio.h>
+
+extern int g_jit_on;       /* 0 = --jit=off                                */
+extern int g_jit_stats;    /* 1 = --jit-stats: time calls, report at exit  */
+
+/* jit_configure — on/off, heat threshold (0 = default), --jit-stats. */
+void   jit_configure(int on, unsigned long threshold, int stats);
+
+/* jit_supported — whether this build can generate native code at all. */
+int    jit_supported(void);
+
+/*
+ * jit_call — run fn natively if it is (or just became) compiled and the
+ * arguments fit what it was compiled for.  Returns the result, or NULL
+ * when the caller must evaluate the call itself (not hot yet, not
+ * compilable, guard failed).  args are borrowed.  Main thread only.
+ */
+Value *jit_call(FnDef *fn, Value **args, size_t argc);
+
+/*
+ * --jit-stats: time interpreted calls.  jit_time_begin/jit_time_end
+ * bracket the evaluation of fn's body; time spent in nested calls is
+ * excluded so interpreted and native costs per call compare.
+ */
+typedef struct JitTimer {
+    uint64_t         t0;
+    uint64_t         child;
+    struct JitTimer *parent;
+} JitTimer;
+
+void   jit_time_begin(JitTimer *t);
+void   jit_time_end(JitTimer *t, FnDef *fn);
+
+/* jit_report — the --jit-stats report (call before interpreter_destroy). */
+void   jit_report(FILE *out);
+
+/* jit_shutdown — release all generated code. */
+void   jit_shutdown(void);
+
+#endif /* JIT_H */
@@ -24,6 +24,12 @@
  *        --ast                Dump parsed AST, then exit
  *        --typecheck          Enable type checking (warnings)
  *        --typecheck-strict   Enable strict type checking (errors)
+ *        --jit=on|off         Compile hot functions to native code (x86-64,
+ *                             default on)
+ *        --jit-threshold=N    Calls + loop iterations before a function is
+ *                             compiled (default 1000)
+ *        --jit-stats          Report compiled functions and the time spent in them
+ *        --no-ast-opt         Skip constant folding / dead-branch pruning
  */
 
 #include <stdio.h>
@@ -34,6 +40,8 @@
 #include "parser.h"
 #include "interpreter.h"
 #include "typecheck.h"
+#include "astopt.h"
+#include "jit.h"
 
 /* ══════════════════════════════════════════════════════════════════════════════
  * VERSION / BUILD METADATA  — change these in one place only
@@ -154,6 +162,12 @@ static void print_usage(const char *prog) {
            COL("1"), RESET, COL("2"), RESET);
     printf("    %s     --typecheck-strict%s   Enable strict type checking %s(errors)%s\n",
            COL("1"), RESET, COL("2"), RESET);
+    printf("    %s     --jit=on|off%s         Compile hot functions to native code %s(default on)%s\n",
+           COL("1"), RESET, COL("2"), RESET);
+    printf("    %s     --jit-threshold=N%s    Calls + loop iterations before compiling %s(default 1000)%s\n",
+           COL("1"), RESET, COL("2"), RESET);
+    printf("    %s     --jit-stats%s          Report compiled functions and the time spent in them\n", COL("1"), RESET);
+    printf("    %s     --no-ast-opt%s         Skip constant folding and dead-branch pruning\n", COL("1"), RESET);
     printf("\n");
     printf("  %sExamples:%s\n", COL("1;32"), RESET);
     printf("    %s main.xe\n",               prog);
@@ -209,6 +223,10 @@ int main(int argc, char **argv) {
     int            dump_tok       = 0;
     int            dump_ast       = 0;
     TypeCheckMode  typecheck_mode = TYPECHECK_OFF;
+    int            jit_on         = 1;
+    unsigned long  jit_threshold  = 0;
+    int            jit_stats      = 0;
+    int            ast_opt        = 1;
 
     /* ── parse CLI args ────────────────────────────────────────────────── */
     for (int i = 1; i < argc; i++) {
@@ -246,6 +264,20 @@ int main(int argc, char **argv) {
         if (strcmp(argv[i], "--typecheck-strict") == 0) {
             typecheck_mode = TYPECHECK_ERROR; continue;
         }
+        if (strcmp(argv[i], "--jit=on")  == 0 || strcmp(argv[i], "--jit") == 0) { jit_on = 1; continue; }
+        if (strcmp(argv[i], "--jit=off") == 0) { jit_on = 0; continue; }
+        if (strcmp(argv[i], "--jit-stats") == 0) { jit_stats = 1; continue; }
+        if (strcmp(argv[i], "--no-ast-opt") == 0) { ast_opt = 0; continue; }
+        if (strncmp(argv[i], "--jit-threshold=", 16) == 0) {
+            char *end;
+            jit_threshold = strtoul(argv[i] + 16, &end, 10);
+            if (*end || !jit_threshold) {
+                fprintf(stderr, "%s[Xenly]%s Invalid JIT threshold: %s\n",
+                        COL("1;31"), RESET, argv[i] + 16);
+                return 1;
+            }
+            continue;
+        }
 
         /* ── positional: source file ── */
         if (argv[i][0] != '-') { filename = argv[i]; continue; }
@@ -322,7 +354,11 @@ int main(int argc, char **argv) {
         }
     }
 
+    /* ── fold constants, prune dead branches, mark pure functions ────── */
+    if (ast_opt) ast_optimize(program, NULL);
+
     /* ── interpret ────────────────────────────────────────────────────── */
+    jit_configure(jit_on, jit_threshold, jit_stats);
     Interpreter *interp = interpreter_create();
 
     /* Set source directory for relative module imports */
@@ -345,7 +381,9 @@ int main(int argc, char **argv) {
     /* ── cleanup ──────────────────────────────────────────────────────── */
     int exit_code = interp->had_error ? 1 : 0;
     value_destroy(result);
+    if (jit_stats) jit_report(stderr);
     interpreter_destroy(interp);
+    jit_shutdown();
     ast_node_destroy(program);
     parser_destroy(parser);
     lexer_destroy(lexer);
@@ -28,12 +28,18 @@
 #include <sys/stat.h>
 
 // ─── Forward declarations for modules defined later in this file ─────────────
+#ifndef XENLY_CORE_MODULES
 static Module module_fs(void);
+#endif
 
 // ─── Registry ────────────────────────────────────────────────────────────────
+// XENLY_CORE_MODULES builds only math and string (src/modules_core_rt.o, the
+// copy in libxly_rtc.a that compiled programs link): everything else here
+// needs the interpreter's environments or the HTTP server.
 int modules_get(const char *name, Module *out) {
     if (strcmp(name, "math")      == 0) { *out = module_math();      return 1; }
     if (strcmp(name, "string")    == 0) { *out = module_string();    return 1; }
+#ifndef XENLY_CORE_MODULES
     if (strcmp(name, "io")        == 0) { *out = module_io();        return 1; }
     if (strcmp(name, "array")     == 0) { *out = module_array();     return 1; }
     if (strcmp(name, "os")        == 0) { *out = module_os();        return 1; }
@@ -46,112 +52,117 @@ int modules_get(const char *name, Module *out) {
     if (strcmp(name, "http")      == 0) { extern Module module_http(void);    *out = module_http();    return 1; }
     if (strcmp(name, "reflect")   == 0) { extern Module module_reflect(void); *out = module_reflect(); return 1; }
     if (strcmp(name, "iter")      == 0) { extern Module module_iter(void);    *out = module_iter();    return 1; }
+#endif
     return 0;
 }
 
 // ═════════════════════════════════════════════════════════════════════════════
 // MATH MODULE  — arithmetic, trig, rounding, constants, predicates
+//
+// The math and string natives are exported as xly_math_<fn> / xly_string_<fn>
+// (<fn> as spelled in Xenly): xenlyc calls them directly for math.* and
+// string.* instead of looking them up by name at run time.
 // ═════════════════════════════════════════════════════════════════════════════
 
-static Value *math_abs(Value **args, size_t argc) {
+Value *xly_math_abs(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(fabs(args[0]->num));
 }
-static Value *math_sqrt(Value **args, size_t argc) {
+Value *xly_math_sqrt(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(sqrt(args[0]->num));
 }
-static Value *math_pow(Value **args, size_t argc) {
+Value *xly_math_pow(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     return value_number(pow(args[0]->num, args[1]->num));
 }
-static Value *math_floor(Value **args, size_t argc) {
+Value *xly_math_floor(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(floor(args[0]->num));
 }
-static Value *math_ceil(Value **args, size_t argc) {
+Value *xly_math_ceil(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(ceil(args[0]->num));
 }
-static Value *math_round(Value **args, size_t argc) {
+Value *xly_math_round(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(round(args[0]->num));
 }
-static Value *math_max(Value **args, size_t argc) {
+Value *xly_math_max(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     return value_number(args[0]->num > args[1]->num ? args[0]->num : args[1]->num);
 }
-static Value *math_min(Value **args, size_t argc) {
+Value *xly_math_min(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     return value_number(args[0]->num < args[1]->num ? args[0]->num : args[1]->num);
 }
-static Value *math_sin(Value **args, size_t argc) {
+Value *xly_math_sin(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(sin(args[0]->num));
 }
-static Value *math_cos(Value **args, size_t argc) {
+Value *xly_math_cos(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(cos(args[0]->num));
 }
-static Value *math_tan(Value **args, size_t argc) {
+Value *xly_math_tan(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(tan(args[0]->num));
 }
-static Value *math_asin(Value **args, size_t argc) {
+Value *xly_math_asin(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(asin(args[0]->num));
 }
-static Value *math_acos(Value **args, size_t argc) {
+Value *xly_math_acos(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(acos(args[0]->num));
 }
-static Value *math_atan(Value **args, size_t argc) {
+Value *xly_math_atan(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(atan(args[0]->num));
 }
-static Value *math_atan2(Value **args, size_t argc) {
+Value *xly_math_atan2(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     return value_number(atan2(args[0]->num, args[1]->num));
 }
-static Value *math_log(Value **args, size_t argc) {
+Value *xly_math_log(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(log(args[0]->num));
 }
-static Value *math_log2(Value **args, size_t argc) {
+Value *xly_math_log2(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(log2(args[0]->num));
 }
-static Value *math_log10(Value **args, size_t argc) {
+Value *xly_math_log10(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(log10(args[0]->num));
 }
-static Value *math_exp(Value **args, size_t argc) {
+Value *xly_math_exp(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(exp(args[0]->num));
 }
-static Value *math_sign(Value **args, size_t argc) {
+Value *xly_math_sign(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     double n = args[0]->num;
     return value_number(n > 0 ? 1.0 : (n < 0 ? -1.0 : 0.0));
 }
-static Value *math_fmod(Value **args, size_t argc) {
+Value *xly_math_fmod(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     return value_number(fmod(args[0]->num, args[1]->num));
 }
-static Value *math_clamp(Value **args, size_t argc) {
+Value *xly_math_clamp(Value **args, size_t argc) {
     if (argc < 3) return value_number(0);
     double val = args[0]->num, lo = args[1]->num, hi = args[2]->num;
     if (val < lo) val = lo;
     if (val > hi) val = hi;
     return value_number(val);
 }
-static Value *math_random(Value **args, size_t argc) {
+Value *xly_math_random(Value **args, size_t argc) {
     (void)args; (void)argc;
     static int seeded = 0;
     if (!seeded) { srand((unsigned int)time(NULL)); seeded = 1; }
     return value_number((double)rand() / (double)RAND_MAX);
 }
-static Value *math_random_int(Value **args, size_t argc) {
+Value *xly_math_randomInt(Value **args, size_t argc) {
     static int seeded = 0;
     if (!seeded) { srand((unsigned int)time(NULL)); seeded = 1; }
     if (argc < 2) return value_number(0);
@@ -161,43 +172,43 @@ static Value *math_random_int(Value **args, size_t argc) {
     return value_number((double)(lo + rand() % (hi - lo)));
 }
 // Constants returned as functions: math.PI(), math.E(), math.INF(), math.NAN()
-static Value *math_pi(Value **args, size_t argc) {
+Value *xly_math_PI(Value **args, size_t argc) {
     (void)args; (void)argc;
     return value_number(M_PI);
 }
-static Value *math_e(Value **args, size_t argc) {
+Value *xly_math_E(Value **args, size_t argc) {
     (void)args; (void)argc;
     return value_number(M_E);
 }
-static Value *math_inf(Value **args, size_t argc) {
+Value *xly_math_INF(Value **args, size_t argc) {
     (void)args; (void)argc;
     return value_number(HUGE_VAL);
 }
-static Value *math_nan(Value **args, size_t argc) {
+Value *xly_math_NAN(Value **args, size_t argc) {
     (void)args; (void)argc;
     return value_number(NAN);
 }
-static Value *math_isnan(Value **args, size_t argc) {
+Value *xly_math_isNaN(Value **args, size_t argc) {
     if (argc < 1) return value_bool(0);
     return value_bool(isnan(args[0]->num));
 }
-static Value *math_isinf(Value **args, size_t argc) {
+Value *xly_math_isInf(Value **args, size_t argc) {
     if (argc < 1) return value_bool(0);
     return value_bool(isinf(args[0]->num));
 }
-static Value *math_isfinite(Value **args, size_t argc) {
+Value *xly_math_isFinite(Value **args, size_t argc) {
     if (argc < 1) return value_bool(0);
     return value_bool(isfinite(args[0]->num));
 }
-static Value *math_hypot(Value **args, size_t argc) {
+Value *xly_math_hypot(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     return value_number(hypot(args[0]->num, args[1]->num));
 }
-static Value *math_cbrt(Value **args, size_t argc) {
+Value *xly_math_cbrt(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(cbrt(args[0]->num));
 }
-static Value *math_trunc(Value **args, size_t argc) {
+Value *xly_math_trunc(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(trunc(args[0]->num));
 }
@@ -205,19 +216,32 @@ static Value *math_trunc(Value **args, size_t argc) {
 // ─── Complex Numbers ──────────────────────────────────────────────────────────
 // Complex numbers are represented as arrays [real, imag]
 
-static Value *math_complex(Value **args, size_t argc) {
+// An empty array with room for `cap` elements, filled with arr_put().  The
+// array exists before its elements do: in compiled programs the runtime
+// collects garbage, and an element held only in a malloc'd buffer is lost.
+static Value *arr_new(size_t cap) {
+    if (cap == 0) cap = 1;
+    Value *arr = value_array((Value **)malloc(sizeof(Value *) * cap), 0);
+    arr->array_cap = cap;
+    return arr;
+}
+static void arr_put(Value *arr, Value *v) {
+    arr->array[arr->array_len++] = v;
+}
+
+Value *xly_math_complex(Value **args, size_t argc) {
     // Create complex number from real and imaginary parts
     double real = (argc >= 1) ? args[0]->num : 0.0;
     double imag = (argc >= 2) ? args[1]->num : 0.0;
     
     // Return as array [real, imag] — use value_array() so it's registered correctly
-    Value **elems = (Value **)malloc(sizeof(Value *) * 2);
-    elems[0] = value_number(real);
-    elems[1] = value_number(imag);
-    return value_array(elems, 2);
+    Value *c = arr_new(2);
+    arr_put(c, value_number(real));
+    arr_put(c, value_number(imag));
+    return c;
 }
 
-static Value *math_complexAdd(Value **args, size_t argc) {
+Value *xly_math_complexAdd(Value **args, size_t argc) {
     if (argc < 2) return value_null();
     if (args[0]->type != VAL_ARRAY || args[1]->type != VAL_ARRAY) return value_null();
     if (args[0]->array_len < 2 || args[1]->array_len < 2) return value_null();
@@ -227,13 +251,13 @@ static Value *math_complexAdd(Value **args, size_t argc) {
     double r2 = args[1]->array[0]->num;
     double i2 = args[1]->array[1]->num;
     
-    Value **elems = (Value **)malloc(sizeof(Value *) * 2);
-    elems[0] = value_number(r1 + r2);
-    elems[1] = value_number(i1 + i2);
-    return value_array(elems, 2);
+    Value *c = arr_new(2);
+    arr_put(c, value_number(r1 + r2));
+    arr_put(c, value_number(i1 + i2));
+    return c;
 }
 
-static Value *math_complexMul(Value **args, size_t argc) {
+Value *xly_math_complexMul(Value **args, size_t argc) {
     if (argc < 2) return value_null();
     if (args[0]->type != VAL_ARRAY || args[1]->type != VAL_ARRAY) return value_null();
     if (args[0]->array_len < 2 || args[1]->array_len < 2) return value_null();
@@ -244,13 +268,13 @@ static Value *math_complexMul(Value **args, size_t argc) {
     double i2 = args[1]->array[1]->num;
     
     // (r1 + i1*i) * (r2 + i2*i) = (r1*r2 - i1*i2) + (r1*i2 + i1*r2)*i
-    Value **elems = (Value **)malloc(sizeof(Value *) * 2);
-    elems[0] = value_number(r1 * r2 - i1 * i2);
-    elems[1] = value_number(r1 * i2 + i1 * r2);
-    return value_array(elems, 2);
+    Value *c = arr_new(2);
+    arr_put(c, value_number(r1 * r2 - i1 * i2));
+    arr_put(c, value_number(r1 * i2 + i1 * r2));
+    return c;
 }
 
-static Value *math_complexAbs(Value **args, size_t argc) {
+Value *xly_math_complexAbs(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     if (args[0]->type != VAL_ARRAY || args[0]->array_len < 2) return value_number(0);
     
@@ -259,20 +283,20 @@ static Value *math_complexAbs(Value **args, size_t argc) {
     return value_number(sqrt(real * real + imag * imag));
 }
 
-static Value *math_complexConj(Value **args, size_t argc) {
+Value *xly_math_complexConj(Value **args, size_t argc) {
     if (argc < 1) return value_null();
     if (args[0]->type != VAL_ARRAY || args[0]->array_len < 2) return value_null();
     
     double real = args[0]->array[0]->num;
     double imag = args[0]->array[1]->num;
     
-    Value **elems = (Value **)malloc(sizeof(Value *) * 2);
-    elems[0] = value_number(real);
-    elems[1] = value_number(-imag);
-    return value_array(elems, 2);
+    Value *c = arr_new(2);
+    arr_put(c, value_number(real));
+    arr_put(c, value_number(-imag));
+    return c;
 }
 
-static Value *math_complexPhase(Value **args, size_t argc) {
+Value *xly_math_complexPhase(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     if (args[0]->type != VAL_ARRAY || args[0]->array_len < 2) return value_number(0);
     
@@ -283,7 +307,7 @@ static Value *math_complexPhase(Value **args, size_t argc) {
 
 // ─── Type-Generic Math Functions ──────────────────────────────────────────────
 
-static Value *math_sum(Value **args, size_t argc) {
+Value *xly_math_sum(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     
     // If array, sum all elements
@@ -307,7 +331,7 @@ static Value *math_sum(Value **args, size_t argc) {
     return value_number(total);
 }
 
-static Value *math_product(Value **args, size_t argc) {
+Value *xly_math_product(Value **args, size_t argc) {
     if (argc < 1) return value_number(1);
     
     // If array, multiply all elements
@@ -331,7 +355,7 @@ static Value *math_product(Value **args, size_t argc) {
     return value_number(result);
 }
 
-static Value *math_mean(Value **args, size_t argc) {
+Value *xly_math_mean(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     
     // If array, calculate mean
@@ -359,7 +383,7 @@ static Value *math_mean(Value **args, size_t argc) {
     return value_number(total / argc);
 }
 
-static Value *math_median(Value **args, size_t argc) {
+Value *xly_math_median(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     
     Value *arr = args[0];
@@ -401,7 +425,7 @@ static Value *math_median(Value **args, size_t argc) {
     return value_number(result);
 }
 
-static Value *math_variance(Value **args, size_t argc) {
+Value *xly_math_variance(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     
     Value *arr = args[0];
@@ -432,8 +456,8 @@ static Value *math_variance(Value **args, size_t argc) {
     return value_number(variance / count);
 }
 
-static Value *math_stddev(Value **args, size_t argc) {
-    Value *var = math_variance(args, argc);
+Value *xly_math_stddev(Value **args, size_t argc) {
+    Value *var = xly_math_variance(args, argc);
     double result = sqrt(var->num);
     value_destroy(var);
     return value_number(result);
@@ -441,7 +465,7 @@ static Value *math_stddev(Value **args, size_t argc) {
 
 // ─── Advanced Math Functions ───────────────────────────────────────────────────
 
-static Value *math_gcd(Value **args, size_t argc) {
+Value *xly_math_gcd(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     
     long long a = (long long)args[0]->num;
@@ -459,7 +483,7 @@ static Value *math_gcd(Value **args, size_t argc) {
     return value_number((double)a);
 }
 
-static Value *math_lcm(Value **args, size_t argc) {
+Value *xly_math_lcm(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     
     long long a = (long long)args[0]->num;
@@ -467,14 +491,14 @@ static Value *math_lcm(Value **args, size_t argc) {
     
     if (a == 0 || b == 0) return value_number(0);
     
-    Value *gcd_val = math_gcd(args, argc);
+    Value *gcd_val = xly_math_gcd(args, argc);
     long long gcd = (long long)gcd_val->num;
     value_destroy(gcd_val);
     
     return value_number((double)((llabs(a) / gcd) * llabs(b)));
 }
 
-static Value *math_factorial(Value **args, size_t argc) {
+Value *xly_math_factorial(Value **args, size_t argc) {
     if (argc < 1) return value_number(1);
     
     int n = (int)args[0]->num;
@@ -489,7 +513,7 @@ static Value *math_factorial(Value **args, size_t argc) {
     return value_number(result);
 }
 
-static Value *math_combinations(Value **args, size_t argc) {
+Value *xly_math_combinations(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     
     int n = (int)args[0]->num;
@@ -510,7 +534,7 @@ static Value *math_combinations(Value **args, size_t argc) {
     return value_number(result);
 }
 
-static Value *math_permutations(Value **args, size_t argc) {
+Value *xly_math_permutations(Value **args, size_t argc) {
     if (argc < 2) return value_number(0);
     
     int n = (int)args[0]->num;
@@ -526,7 +550,7 @@ static Value *math_permutations(Value **args, size_t argc) {
     return value_number(result);
 }
 
-static Value *math_lerp(Value **args, size_t argc) {
+Value *xly_math_lerp(Value **args, size_t argc) {
     if (argc < 3) return value_number(0);
     
     double a = args[0]->num;
@@ -536,71 +560,71 @@ static Value *math_lerp(Value **args, size_t argc) {
     return value_number(a + (b - a) * t);
 }
 
-static Value *math_degrees(Value **args, size_t argc) {
+Value *xly_math_degrees(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(args[0]->num * 180.0 / M_PI);
 }
 
-static Value *math_radians(Value **args, size_t argc) {
+Value *xly_math_radians(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     return value_number(args[0]->num * M_PI / 180.0);
 }
 
 static NativeFunc math_fns[] = {
-    /* arithmetic  */ { "abs",       math_abs },
-                      { "sqrt",      math_sqrt },
-                      { "pow",       math_pow },
-                      { "cbrt",      math_cbrt },
-                      { "hypot",     math_hypot },
-                      { "sign",      math_sign },
-                      { "fmod",      math_fmod },
-                      { "clamp",     math_clamp },
-                      { "exp",       math_exp },
-    /* rounding    */ { "floor",     math_floor },
-                      { "ceil",      math_ceil },
-                      { "round",     math_round },
-                      { "trunc",     math_trunc },
-    /* min / max   */ { "max",       math_max },
-                      { "min",       math_min },
-    /* trig        */ { "sin",       math_sin },
-                      { "cos",       math_cos },
-                      { "tan",       math_tan },
-                      { "asin",      math_asin },
-                      { "acos",      math_acos },
-                      { "atan",      math_atan },
-                      { "atan2",     math_atan2 },
-    /* log         */ { "log",       math_log },
-                      { "log2",      math_log2 },
-                      { "log10",     math_log10 },
-    /* random      */ { "random",    math_random },
-                      { "randomInt", math_random_int },
-    /* constants   */ { "PI",        math_pi },
-                      { "E",         math_e },
-                      { "INF",       math_inf },
-                      { "NAN",       math_nan },
-    /* predicates  */ { "isNaN",     math_isnan },
-                      { "isInf",     math_isinf },
-                      { "isFinite",  math_isfinite },
-    /* complex     */ { "complex",       math_complex },
-                      { "complexAdd",    math_complexAdd },
-                      { "complexMul",    math_complexMul },
-                      { "complexAbs",    math_complexAbs },
-                      { "complexConj",   math_complexConj },
-                      { "complexPhase",  math_complexPhase },
-    /* generic     */ { "sum",        math_sum },
-                      { "product",    math_product },
-                      { "mean",       math_mean },
-                      { "median",     math_median },
-                      { "variance",   math_variance },
-                      { "stddev",     math_stddev },
-    /* advanced    */ { "gcd",        math_gcd },
-                      { "lcm",        math_lcm },
-                      { "factorial",  math_factorial },
-                      { "combinations", math_combinations },
-                      { "permutations", math_permutations },
-                      { "lerp",       math_lerp },
-                      { "degrees",    math_degrees },
-                      { "radians",    math_radians },
+    /* arithmetic  */ { "abs",       xly_math_abs },
+                      { "sqrt",      xly_math_sqrt },
+                      { "pow",       xly_math_pow },
+                      { "cbrt",      xly_math_cbrt },
+                      { "hypot",     xly_math_hypot },
+                      { "sign",      xly_math_sign },
+                      { "fmod",      xly_math_fmod },
+                      { "clamp",     xly_math_clamp },
+                      { "exp",       xly_math_exp },
+    /* rounding    */ { "floor",     xly_math_floor },
+                      { "ceil",      xly_math_ceil },
+                      { "round",     xly_math_round },
+                      { "trunc",     xly_math_trunc },
+    /* min / max   */ { "max",       xly_math_max },
+                      { "min",       xly_math_min },
+    /* trig        */ { "sin",       xly_math_sin },
+                      { "cos",       xly_math_cos },
+                      { "tan",       xly_math_tan },
+                      { "asin",      xly_math_asin },
+                      { "acos",      xly_math_acos },
+                      { "atan",      xly_math_atan },
+                      { "atan2",     xly_math_atan2 },
+    /* log         */ { "log",       xly_math_log },
+                      { "log2",      xly_math_log2 },
+                      { "log10",     xly_math_log10 },
+    /* random      */ { "random",    xly_math_random },
+                      { "randomInt", xly_math_randomInt },
+    /* constants   */ { "PI",        xly_math_PI },
+                      { "E",         xly_math_E },
+                      { "INF",       xly_math_INF },
+                      { "NAN",       xly_math_NAN },
+    /* predicates  */ { "isNaN",     xly_math_isNaN },
+                      { "isInf",     xly_math_isInf },
+                      { "isFinite",  xly_math_isFinite },
+    /* complex     */ { "complex",       xly_math_complex },
+                      { "complexAdd",    xly_math_complexAdd },
+                      { "complexMul",    xly_math_complexMul },
+                      { "complexAbs",    xly_math_complexAbs },
+                      { "complexConj",   xly_math_complexConj },
+                      { "complexPhase",  xly_math_complexPhase },
+    /* generic     */ { "sum",        xly_math_sum },
+                      { "product",    xly_math_product },
+                      { "mean",       xly_math_mean },
+                      { "median",     xly_math_median },
+                      { "variance",   xly_math_variance },
+                      { "stddev",     xly_math_stddev },
+    /* advanced    */ { "gcd",        xly_math_gcd },
+                      { "lcm",        xly_math_lcm },
+                      { "factorial",  xly_math_factorial },
+                      { "combinations", xly_math_combinations },
+                      { "permutations", xly_math_permutations },
+                      { "lerp",       xly_math_lerp },
+                      { "degrees",    xly_math_degrees },
+                      { "radians",    xly_math_radians },
     { NULL, NULL }
 };
 
@@ -616,7 +640,7 @@ Module module_math(void) {
 // STRING MODULE  — length, case, search, slice, pad, split, join, trim, …
 // ═════════════════════════════════════════════════════════════════════════════
 
-static Value *str_toString(Value **args, size_t argc) {
+Value *xly_string_toString(Value **args, size_t argc) {
     if (argc < 1) return value_string("null");
     Value *v = args[0];
     if (v->type == VAL_STRING) return value_string(v->str);
@@ -631,7 +655,7 @@ static Value *str_toString(Value **args, size_t argc) {
     return value_string("[object]");
 }
 
-static Value *str_toNumber(Value **args, size_t argc) {
+Value *xly_string_toNumber(Value **args, size_t argc) {
     if (argc < 1) return value_number(0);
     Value *v = args[0];
     if (v->type == VAL_NUMBER) return value_number(v->num);
@@ -640,33 +664,33 @@ static Value *str_toNumber(Value **args, size_t argc) {
     return value_number(0);
 }
 
-static Value *str_len(Value **args, size_t argc) {
+Value *xly_string_len(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_number(0);
     return value_number((double)strlen(args[0]->str));
 }
-static Value *str_upper(Value **args, size_t argc) {
+Value *xly_string_upper(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     char *copy = strdup(args[0]->str);
     for (char *p = copy; *p; p++) *p = toupper((unsigned char)*p);
     Value *r = value_string(copy); free(copy); return r;
 }
-static Value *str_lower(Value **args, size_t argc) {
+Value *xly_string_lower(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     char *copy = strdup(args[0]->str);
     for (char *p = copy; *p; p++) *p = tolower((unsigned char)*p);
     Value *r = value_string(copy); free(copy); return r;
 }
-static Value *str_contains(Value **args, size_t argc) {
+Value *xly_string_contains(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING || args[1]->type != VAL_STRING)
         return value_bool(0);
     return value_bool(strstr(args[0]->str, args[1]->str) != NULL);
 }
-static Value *str_startsWith(Value **args, size_t argc) {
+Value *xly_string_startsWith(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING || args[1]->type != VAL_STRING)
         return value_bool(0);
     return value_bool(strncmp(args[0]->str, args[1]->str, strlen(args[1]->str)) == 0);
 }
-static Value *str_endsWith(Value **args, size_t argc) {
+Value *xly_string_endsWith(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING || args[1]->type != VAL_STRING)
         return value_bool(0);
     size_t slen = strlen(args[0]->str);
@@ -674,13 +698,13 @@ static Value *str_endsWith(Value **args, size_t argc) {
     if (plen > slen) return value_bool(0);
     return value_bool(strcmp(args[0]->str + slen - plen, args[1]->str) == 0);
 }
-static Value *str_indexOf(Value **args, size_t argc) {
+Value *xly_string_indexOf(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING || args[1]->type != VAL_STRING)
         return value_number(-1);
     const char *p = strstr(args[0]->str, args[1]->str);
     return value_number(p ? (double)(p - args[0]->str) : -1.0);
 }
-static Value *str_lastIndexOf(Value **args, size_t argc) {
+Value *xly_string_lastIndexOf(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING || args[1]->type != VAL_STRING)
         return value_number(-1);
     const char *haystack = args[0]->str;
@@ -691,7 +715,7 @@ static Value *str_lastIndexOf(Value **args, size_t argc) {
     while ((p = strstr(p, needle)) != NULL) { last = p; p += nlen; }
     return value_number(last ? (double)(last - haystack) : -1.0);
 }
-static Value *str_charAt(Value **args, size_t argc) {
+Value *xly_string_charAt(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     int idx = (int)args[1]->num;
     int len = (int)strlen(args[0]->str);
@@ -699,19 +723,19 @@ static Value *str_charAt(Value **args, size_t argc) {
     char buf[2] = { args[0]->str[idx], '\0' };
     return value_string(buf);
 }
-static Value *str_charCodeAt(Value **args, size_t argc) {
+Value *xly_string_charCodeAt(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING) return value_number(-1);
     int idx = (int)args[1]->num;
     int len = (int)strlen(args[0]->str);
     if (idx < 0 || idx >= len) return value_number(-1);
     return value_number((double)(unsigned char)args[0]->str[idx]);
 }
-static Value *str_fromCharCode(Value **args, size_t argc) {
+Value *xly_string_fromCharCode(Value **args, size_t argc) {
     if (argc < 1) return value_string("");
     char buf[2] = { (char)(int)args[0]->num, '\0' };
     return value_string(buf);
 }
-static Value *str_repeat(Value **args, size_t argc) {
+Value *xly_string_repeat(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     int n = (int)args[1]->num;
     if (n <= 0) return value_string("");
@@ -722,7 +746,7 @@ static Value *str_repeat(Value **args, size_t argc) {
     for (int i = 0; i < n; i++) strcat(buf, args[0]->str);
     Value *r = value_string(buf); free(buf); return r;
 }
-static Value *str_reverse(Value **args, size_t argc) {
+Value *xly_string_reverse(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     size_t len = strlen(args[0]->str);
     char *buf  = (char *)malloc(len + 1);
@@ -730,7 +754,7 @@ static Value *str_reverse(Value **args, size_t argc) {
     buf[len] = '\0';
     Value *r = value_string(buf); free(buf); return r;
 }
-static Value *str_trim(Value **args, size_t argc) {
+Value *xly_string_trim(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     char *s = strdup(args[0]->str);
     char *start = s;
@@ -740,13 +764,13 @@ static Value *str_trim(Value **args, size_t argc) {
     *end = '\0';
     Value *r = value_string(start); free(s); return r;
 }
-static Value *str_trimStart(Value **args, size_t argc) {
+Value *xly_string_trimStart(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     const char *s = args[0]->str;
     while (*s && isspace((unsigned char)*s)) s++;
     return value_string(s);
 }
-static Value *str_trimEnd(Value **args, size_t argc) {
+Value *xly_string_trimEnd(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     char *s = strdup(args[0]->str);
     char *end = s + strlen(s);
@@ -754,7 +778,7 @@ static Value *str_trimEnd(Value **args, size_t argc) {
     *end = '\0';
     Value *r = value_string(s); free(s); return r;
 }
-static Value *str_replace(Value **args, size_t argc) {
+Value *xly_string_replace(Value **args, size_t argc) {
     if (argc < 3 || args[0]->type != VAL_STRING ||
         args[1]->type != VAL_STRING || args[2]->type != VAL_STRING)
         return value_string("");
@@ -781,7 +805,7 @@ static Value *str_replace(Value **args, size_t argc) {
     *out = '\0';
     Value *r = value_string(buf); free(buf); return r;
 }
-static Value *str_substr(Value **args, size_t argc) {
+Value *xly_string_substr(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     const char *s = args[0]->str;
     int start = (int)args[1]->num;
@@ -796,7 +820,7 @@ static Value *str_substr(Value **args, size_t argc) {
     buf[count] = '\0';
     Value *r = value_string(buf); free(buf); return r;
 }
-static Value *str_slice(Value **args, size_t argc) {
+Value *xly_string_slice(Value **args, size_t argc) {
     // slice(str, start, end)  — end is exclusive, negative indices wrap
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     const char *s = args[0]->str;
@@ -814,7 +838,7 @@ static Value *str_slice(Value **args, size_t argc) {
     buf[count] = '\0';
     Value *r = value_string(buf); free(buf); return r;
 }
-static Value *str_padStart(Value **args, size_t argc) {
+Value *xly_string_padStart(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     const char *s   = args[0]->str;
     int         pad = (int)args[1]->num;
@@ -830,7 +854,7 @@ static Value *str_padStart(Value **args, size_t argc) {
     buf[pad] = '\0';
     Value *r = value_string(buf); free(buf); return r;
 }
-static Value *str_padEnd(Value **args, size_t argc) {
+Value *xly_string_padEnd(Value **args, size_t argc) {
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     const char *s   = args[0]->str;
     int         pad = (int)args[1]->num;
@@ -846,7 +870,7 @@ static Value *str_padEnd(Value **args, size_t argc) {
     Value *r = value_string(buf); free(buf); return r;
 }
 // split(str, delimiter) → array of strings
-static Value *str_split(Value **args, size_t argc) {
+Value *xly_string_split(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_STRING) {
         return value_array(NULL, 0);
     }
@@ -854,40 +878,37 @@ static Value *str_split(Value **args, size_t argc) {
     const char *sep = (argc >= 2 && args[1]->type == VAL_STRING) ? args[1]->str : " ";
     size_t sep_len  = strlen(sep);
 
-    // Count parts first
-    size_t parts = 1;
-    if (sep_len > 0) {
-        const char *p = s;
-        while ((p = strstr(p, sep)) != NULL) { parts++; p += sep_len; }
-    }
-
-    Value **items = (Value **)malloc(sizeof(Value *) * parts);
-    size_t idx = 0;
-
     if (sep_len == 0) {
         // Split into individual characters
         size_t slen = strlen(s);
-        items = (Value **)realloc(items, sizeof(Value *) * (slen ? slen : 1));
-        if (slen == 0) { items[0] = value_string(""); idx = 1; }
-        else { for (size_t i = 0; i < slen; i++) { char c[2] = {s[i], 0}; items[i] = value_string(c); } idx = slen; }
-    } else {
-        const char *p = s;
-        while (1) {
-            const char *found = strstr(p, sep);
-            if (!found) { items[idx++] = value_string(p); break; }
-            size_t chunk = (size_t)(found - p);
-            char *buf = (char *)malloc(chunk + 1);
-            memcpy(buf, p, chunk);
-            buf[chunk] = '\0';
-            items[idx++] = value_string(buf);
-            free(buf);
-            p = found + sep_len;
-        }
+        Value *items = arr_new(slen);
+        if (slen == 0) arr_put(items, value_string(""));
+        for (size_t i = 0; i < slen; i++) { char c[2] = {s[i], 0}; arr_put(items, value_string(c)); }
+        return items;
     }
-    return value_array(items, idx);
+
+    // Count parts first
+    size_t parts = 1;
+    const char *p = s;
+    while ((p = strstr(p, sep)) != NULL) { parts++; p += sep_len; }
+
+    Value *items = arr_new(parts);
+    p = s;
+    while (1) {
+        const char *found = strstr(p, sep);
+        if (!found) { arr_put(items, value_string(p)); break; }
+        size_t chunk = (size_t)(found - p);
+        char *buf = (char *)malloc(chunk + 1);
+        memcpy(buf, p, chunk);
+        buf[chunk] = '\0';
+        arr_put(items, value_string(buf));
+        free(buf);
+        p = found + sep_len;
+    }
+    return items;
 }
 // join(array, separator) → string
-static Value *str_join(Value **args, size_t argc) {
+Value *xly_string_join(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_ARRAY) return value_string("");
     const char *sep = (argc >= 2 && args[1]->type == VAL_STRING) ? args[1]->str : ",";
     Value *arr = args[0];
@@ -910,14 +931,14 @@ static Value *str_join(Value **args, size_t argc) {
 }
 
 // Unicode-aware string functions
-static Value *str_unicodeLength(Value **args, size_t argc) {
+Value *xly_string_unicodeLength(Value **args, size_t argc) {
     // Get length in Unicode characters (not bytes)
     if (argc < 1 || args[0]->type != VAL_STRING) return value_number(0);
     size_t len = utf8_strlen(args[0]->str);
     return value_number((double)len);
 }
 
-static Value *str_unicodeCharAt(Value **args, size_t argc) {
+Value *xly_string_unicodeCharAt(Value **args, size_t argc) {
     // Get Unicode character at index
     if (argc < 2 || args[0]->type != VAL_STRING) return value_string("");
     const char *str = args[0]->str;
@@ -936,7 +957,7 @@ static Value *str_unicodeCharAt(Value **args, size_t argc) {
     return value_string(buf);
 }
 
-static Value *str_codePointAt(Value **args, size_t argc) {
+Value *xly_string_codePointAt(Value **args, size_t argc) {
     // Get Unicode codepoint at index
     if (argc < 2 || args[0]->type != VAL_STRING) return value_number(0);
     const char *str = args[0]->str;
@@ -950,7 +971,7 @@ static Value *str_codePointAt(Value **args, size_t argc) {
     return value_number((double)cp);
 }
 
-static Value *str_fromCodePoint(Value **args, size_t argc) {
+Value *xly_string_fromCodePoint(Value **args, size_t argc) {
     // Create string from Unicode codepoint
     if (argc < 1) return value_string("");
     uint32_t cp = (uint32_t)args[0]->num;
@@ -962,44 +983,44 @@ static Value *str_fromCodePoint(Value **args, size_t argc) {
     return value_string(buf);
 }
 
-static Value *str_normalize(Value **args, size_t argc) {
+Value *xly_string_normalize(Value **args, size_t argc) {
     // Simple normalization: just return the string (full NFD/NFC would require ICU)
     if (argc < 1 || args[0]->type != VAL_STRING) return value_string("");
     return value_string(args[0]->str);
 }
 
 static NativeFunc string_fns[] = {
-    { "len",           str_len },
-    { "toString",      str_toString },
-    { "toNumber",      str_toNumber },
-    { "upper",         str_upper },
-    { "lower",         str_lower },
-    { "contains",      str_contains },
-    { "startsWith",    str_startsWith },
-    { "endsWith",      str_endsWith },
-    { "indexOf",       str_indexOf },
-    { "lastIndexOf",   str_lastIndexOf },
-    { "charAt",        str_charAt },
-    { "charCodeAt",    str_charCodeAt },
-    { "fromCharCode",  str_fromCharCode },
-    { "repeat",        str_repeat },
-    { "reverse",       str_reverse },
-    { "trim",          str_trim },
-    { "trimStart",     str_trimStart },
-    { "trimEnd",       str_trimEnd },
-    { "replace",       str_replace },
-    { "substr",        str_substr },
-    { "slice",         str_slice },
-    { "padStart",      str_padStart },
-    { "padEnd",        str_padEnd },
-    { "split",         str_split },
-    { "join",          str_join },
+    { "len",           xly_string_len },
+    { "toString",      xly_string_toString },
+    { "toNumber",      xly_string_toNumber },
+    { "upper",         xly_string_upper },
+    { "lower",         xly_string_lower },
+    { "contains",      xly_string_contains },
+    { "startsWith",    xly_string_startsWith },
+    { "endsWith",      xly_string_endsWith },
+    { "indexOf",       xly_string_indexOf },
+    { "lastIndexOf",   xly_string_lastIndexOf },
+    { "charAt",        xly_string_charAt },
+    { "charCodeAt",    xly_string_charCodeAt },
+    { "fromCharCode",  xly_string_fromCharCode },
+    { "repeat",        xly_string_repeat },
+    { "reverse",       xly_string_reverse },
+    { "trim",          xly_string_trim },
+    { "trimStart",     xly_string_trimStart },
+    { "trimEnd",       xly_string_trimEnd },
+    { "replace",       xly_string_replace },
+    { "substr",        xly_string_substr },
+    { "slice",         xly_string_slice },
+    { "padStart",      xly_string_padStart },
+    { "padEnd",        xly_string_padEnd },
+    { "split",         xly_string_split },
+    { "join",          xly_string_join },
     // Unicode-aware functions
-    { "unicodeLength",  str_unicodeLength },
-    { "unicodeCharAt",  str_unicodeCharAt },
-    { "codePointAt",    str_codePointAt },
-    { "fromCodePoint",  str_fromCodePoint },
-    { "normalize",      str_normalize },
+    { "unicodeLength",  xly_string_unicodeLength },
+    { "unicodeCharAt",  xly_string_unicodeCharAt },
+    { "codePointAt",    xly_string_codePointAt },
+    { "fromCodePoint",  xly_string_fromCodePoint },
+    { "normalize",      xly_string_normalize },
     { NULL, NULL }
 };
 
@@ -1011,6 +1032,8 @@ Module module_string(void) {
     return m;
 }
 
+#ifndef XENLY_CORE_MODULES
+
 // ═════════════════════════════════════════════════════════════════════════════
 // IO MODULE  — console I/O
 // ═════════════════════════════════════════════════════════════════════════════
@@ -1524,7 +1547,7 @@ static Value *arr_max(Value **args, size_t argc) {
 
 // array.join(arr, sep) — join elements into string (delegates to string.join)
 static Value *arr_join(Value **args, size_t argc) {
-    return str_join(args, argc);   // reuse string module impl
+    return xly_string_join(args, argc);   // reuse string module impl
 }
 
 // array.sort(arr) — numeric sort, returns new sorted array
@@ -2314,6 +2337,109 @@ static Value *mp_cpu_count(Value **args, size_t argc) {
     return value_number((double)nproc);
 }
 
+// ─── Shared Buffers ──────────────────────────────────────────────────────────
+// multiproc.sharedBuffer(bytes, type?) → handle; type is "f64" (default),
+// "i64", "i32" or "u8".  Create it before process_pool_create so workers
+// inherit the mapping and can fill disjoint slices in place.
+
+static SharedBuffer *mp_buffer_arg(Value **args, size_t argc, const char *who) {
+    SharedBuffer *buf = NULL;
+    if (argc > 0 && args[0]->type == VAL_NUMBER)
+        buf = shared_buffer_check((void *)(uintptr_t)args[0]->num);
+    if (!buf) fprintf(stderr, "multiproc.%s expects a shared buffer handle\n", who);
+    return buf;
+}
+
+static int mp_buffer_index(SharedBuffer *buf, Value **args, size_t argc, const char *who,
+                           size_t *index) {
+    if (argc < 2 || args[1]->type != VAL_NUMBER || args[1]->num < 0 ||
+        (size_t)args[1]->num >= buf->length) {
+        fprintf(stderr, "multiproc.%s: index out of range (length %zu)\n", who, buf->length);
+        return 0;
+    }
+    *index = (size_t)args[1]->num;
+    return 1;
+}
+
+static Value *mp_shared_buffer(Value **args, size_t argc) {
+    if (argc < 1 || args[0]->type != VAL_NUMBER || args[0]->num < 1) {
+        fprintf(stderr, "multiproc.sharedBuffer expects (bytes: number, type?: string)\n");
+        return value_null();
+    }
+    const char *tname = (argc > 1 && args[1]->type == VAL_STRING) ? args[1]->str : NULL;
+    int type = shared_buffer_type_from_name(tname);
+    if (type < 0) {
+        fprintf(stderr, "multiproc.sharedBuffer: unknown element type '%s'\n", tname);
+        return value_null();
+    }
+    SharedBuffer *buf = shared_buffer_create((size_t)args[0]->num, (SharedBufferType)type);
+    return buf ? value_number((double)(uintptr_t)buf) : value_null();
+}
+
+static Value *mp_buffer_length(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferLength");
+    return value_number(buf ? (double)buf->length : 0);
+}
+
+static Value *mp_buffer_get(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferGet");
+    size_t i;
+    double v;
+    if (!buf || !mp_buffer_index(buf, args, argc, "bufferGet", &i)) return value_null();
+    shared_buffer_get(buf, i, &v);
+    return value_number(v);
+}
+
+static Value *mp_buffer_set(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferSet");
+    size_t i;
+    if (!buf || !mp_buffer_index(buf, args, argc, "bufferSet", &i)) return value_null();
+    if (argc < 3 || args[2]->type != VAL_NUMBER) return value_null();
+    shared_buffer_set(buf, i, args[2]->num);
+    return value_null();
+}
+
+// multiproc.bufferAtomicAdd(buf, i, delta) → previous value
+static Value *mp_buffer_atomic_add(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferAtomicAdd");
+    size_t i;
+    double old;
+    if (!buf || !mp_buffer_index(buf, args, argc, "bufferAtomicAdd", &i)) return value_null();
+    if (argc < 3 || args[2]->type != VAL_NUMBER) return value_null();
+    shared_buffer_add(buf, i, args[2]->num, &old);
+    return value_number(old);
+}
+
+// multiproc.bufferCompareExchange(buf, i, expected, desired) → previous value;
+// the store happened iff it equals `expected`.
+static Value *mp_buffer_compare_exchange(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferCompareExchange");
+    size_t i;
+    double old;
+    if (!buf || !mp_buffer_index(buf, args, argc, "bufferCompareExchange", &i)) return value_null();
+    if (argc < 4 || args[2]->type != VAL_NUMBER || args[3]->type != VAL_NUMBER) return value_null();
+    shared_buffer_cas(buf, i, args[2]->num, args[3]->num, &old);
+    return value_number(old);
+}
+
+static Value *mp_buffer_to_array(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferToArray");
+    if (!buf) return value_null();
+    Value **items = (Value **)malloc(sizeof(Value *) * (buf->length ? buf->length : 1));
+    for (size_t i = 0; i < buf->length; i++) {
+        double v;
+        shared_buffer_get(buf, i, &v);
+        items[i] = value_number(v);
+    }
+    return value_array(items, buf->length);
+}
+
+static Value *mp_buffer_destroy(Value **args, size_t argc) {
+    SharedBuffer *buf = mp_buffer_arg(args, argc, "bufferDestroy");
+    if (buf) shared_buffer_destroy(buf);
+    return value_null();
+}
+
 #ifndef XENLY_NO_MULTIPROC
 // ─── Multiprocessing Functions (require interpreter, not in compiled code) ───
 
@@ -2376,6 +2502,20 @@ static Value *mp_channel_destroy(Value **args, size_t argc) {
     return value_null();
 }
 
+// multiproc.select([ch1, ch2, fut], timeoutMs) → [index, value]
+// Blocks until any channel has a value (or is closed) or any future is
+// resolved.  index is -1 when timeoutMs elapses first; omit it to wait forever.
+static Value *mp_select(Value **args, size_t argc) {
+    return xly_select_value("multiproc.select", args, argc);
+}
+
+static Value *mp_channel_try_recv(Value **args, size_t argc) {
+    if (argc < 1) return value_null();
+    Channel *chan = (Channel *)(uintptr_t)args[0]->num;
+    Value *out = NULL;
+    return channel_try_recv(chan, &out) == 0 ? out : value_null();
+}
+
 static Value *mp_thread_pool_create(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_NUMBER) return value_null();
     size_t num_workers = (size_t)args[0]->num;
@@ -2397,6 +2537,19 @@ static Value *mp_process_pool_create(Value **args, size_t argc) {
     return value_number((double)(uintptr_t)pool);
 }
 
+// multiproc.process_pool_submit(pool, fn, ...args) → future.  Arguments and
+// the result are copied through a pipe (numbers, strings, bools, arrays).
+static Value *mp_process_pool_submit(Value **args, size_t argc) {
+    if (argc < 2 || args[0]->type != VAL_NUMBER || args[1]->type != VAL_FUNCTION) {
+        fprintf(stderr, "multiproc.process_pool_submit expects (pool, fn, ...args)\n");
+        return value_null();
+    }
+    ProcessPool *pool = (ProcessPool *)(uintptr_t)args[0]->num;
+    Future *fut = process_pool_submit(pool, args[1]->fn,
+                                      argc > 2 ? &args[2] : NULL, argc > 2 ? argc - 2 : 0);
+    return value_number((double)(uintptr_t)fut);
+}
+
 static Value *mp_process_pool_destroy(Value **args, size_t argc) {
     if (argc < 1) return value_null();
     ProcessPool *pool = (ProcessPool *)(uintptr_t)args[0]->num;
@@ -2407,7 +2560,16 @@ static Value *mp_process_pool_destroy(Value **args, size_t argc) {
 static Value *mp_future_get(Value **args, size_t argc) {
     if (argc < 1) return value_null();
     Future *fut = (Future *)(uintptr_t)args[0]->num;
-    return future_get(fut);
+    // Copy primitives: the future keeps its result for combinators / re-gets
+    Value *r = future_get(fut);
+    if (!r) return value_null();
+    switch (r->type) {
+        case VAL_NUMBER: return value_number(r->num);
+        case VAL_STRING: return value_string(r->str);
+        case VAL_BOOL:   return value_bool(r->boolean);
+        case VAL_NULL:   return value_null();
+        default:         return r;
+    }
 }
 
 static Value *mp_future_is_ready(Value **args, size_t argc) {
@@ -2423,23 +2585,61 @@ static Value *mp_future_destroy(Value **args, size_t argc) {
     return value_null();
 }
 
+// multiproc.future_all / future_any / future_race (futures: array) → future
+static Value *mp_future_all(Value **args, size_t argc) {
+    return future_group_value("multiproc.future_all", future_all, args, argc);
+}
+static Value *mp_future_any(Value **args, size_t argc) {
+    return future_group_value("multiproc.future_any", future_any, args, argc);
+}
+static Value *mp_future_race(Value **args, size_t argc) {
+    return future_group_value("multiproc.future_race", future_race, args, argc);
+}
+
+// multiproc.future_then(fut, fn) → future of fn(result), run on the shared pool
+static Value *mp_future_then(Value **args, size_t argc) {
+    Future *fut = (argc > 0 && args[0]->type == VAL_NUMBER)
+                      ? future_check((void *)(uintptr_t)args[0]->num) : NULL;
+    if (!fut || argc < 2 ||
+        (args[1]->type != VAL_FUNCTION && args[1]->type != VAL_BUILTIN_FN)) {
+        fprintf(stderr, "multiproc.future_then expects (future, fn)\n");
+        return value_null();
+    }
+    return value_number((double)(uintptr_t)future_then(fut, args[1]));
+}
+
 #endif // XENLY_NO_MULTIPROC
 
 static NativeFunc multiproc_fns[] = {
     { "cpu_count",          mp_cpu_count },
+    { "sharedBuffer",       mp_shared_buffer },
+    { "bufferLength",       mp_buffer_length },
+    { "bufferGet",          mp_buffer_get },
+    { "bufferSet",          mp_buffer_set },
+    { "bufferAtomicAdd",    mp_buffer_atomic_add },
+    { "bufferCompareExchange", mp_buffer_compare_exchange },
+    { "bufferToArray",      mp_buffer_to_array },
+    { "bufferDestroy",      mp_buffer_destroy },
 #ifndef XENLY_NO_MULTIPROC
     { "channel_create",     mp_channel_create },
     { "channel_send",       mp_channel_send },
     { "channel_recv",       mp_channel_recv },
+    { "channel_try_recv",   mp_channel_try_recv },
     { "channel_close",      mp_channel_close },
     { "channel_destroy",    mp_channel_destroy },
     { "thread_pool_create", mp_thread_pool_create },
     { "thread_pool_destroy", mp_thread_pool_destroy },
     { "process_pool_create", mp_process_pool_create },
+    { "process_pool_submit", mp_process_pool_submit },
     { "process_pool_destroy", mp_process_pool_destroy },
     { "future_get",         mp_future_get },
     { "future_is_ready",    mp_future_is_ready },
     { "future_destroy",     mp_future_destroy },
+    { "future_all",         mp_future_all },
+    { "future_any",         mp_future_any },
+    { "future_race",        mp_future_race },
+    { "future_then",        mp_future_then },
+    { "select",             mp_select },
 #endif // XENLY_NO_MULTIPROC
     { NULL, NULL }
 };
@@ -2732,10 +2932,10 @@ static Value *sys_getrlimit(Value **args, size_t argc) {
     if (argc < 1 || args[0]->type != VAL_NUMBER) return value_null();
     struct rlimit rl;
     if (getrlimit((int)args[0]->num, &rl) < 0) return value_null();
-    Value **elems = (Value **)malloc(sizeof(Value *) * 2);
-    elems[0] = value_number(rl.rlim_cur == RLIM_INFINITY ? -1.0 : (double)rl.rlim_cur);
-    elems[1] = value_number(rl.rlim_max == RLIM_INFINITY ? -1.0 : (double)rl.rlim_max);
-    return value_array(elems, 2);
+    Value *c = arr_new(2);
+    arr_put(c, value_number(rl.rlim_cur == RLIM_INFINITY ? -1.0 : (double)rl.rlim_cur));
+    arr_put(c, value_number(rl.rlim_max == RLIM_INFINITY ? -1.0 : (double)rl.rlim_max));
+    return c;
 }
 
 // sys.setrlimit(resource, soft, hard) — set resource limit (C: setrlimit())
@@ -3639,6 +3839,28 @@ static Value *sys_next_pow2(Value **args, size_t argc) {
     return value_number((double)(long long)(n + 1));
 }
 
+// sys.gc() / sys.arenaBegin() / sys.arenaEnd() — the collector and regions of
+// compiled programs (xly_rt.c).  The interpreter frees values as it goes, so
+// here they only keep the same results: values freed 0, the arena depth.
+static int sys_arena_depth = 0;
+static Value *sys_gc(Value **args, size_t argc) {
+    (void)args; (void)argc;
+    return value_number(0);
+}
+static Value *sys_arena_begin(Value **args, size_t argc) {
+    (void)args; (void)argc;
+    return value_number((double)++sys_arena_depth);
+}
+static Value *sys_arena_end(Value **args, size_t argc) {
+    (void)args; (void)argc;
+    if (sys_arena_depth == 0) {
+        fprintf(stderr, "[xenly] sys.arenaEnd: no arena is open\n");
+        return value_null();
+    }
+    sys_arena_depth--;
+    return value_number(0);
+}
+
 // ═════════════════════════════════════════════════════════════════════════════
 // LEVEL 8 — IPC & SYSTEM LOGGING
 // ═════════════════════════════════════════════════════════════════════════════
@@ -3887,6 +4109,9 @@ static NativeFunc sys_fns[] = {
     { "align_down",     sys_align_down      },
     { "is_pow2",        sys_is_pow2         },
     { "next_pow2",      sys_next_pow2       },
+    { "gc",             sys_gc              },
+    { "arenaBegin",     sys_arena_begin     },
+    { "arenaEnd",       sys_arena_end       },
     // ── LEVEL 8: IPC & Syslog ───────────────────────────────────────────────
     { "openlog",        sys_openlog         },
     { "syslog",         sys_syslog          },
@@ -4523,3 +4748,5 @@ Module module_http(void) {
     m.fn_count  = sizeof(http_fns)/sizeof(http_fns[0]) - 1;
     return m;
 }
+
+#endif // XENLY_CORE_MODULES
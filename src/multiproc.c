@@ -16,43 +16,309 @@
  * - Channels for inter-task communication
  * - Futures/Promises for async results
  * - Integrated with interpreter's spawn/await
+ * - select() over any mix of channels and futures, with timeouts
+ * - Future combinators (all / any / race / then) driven by continuations
+ * - Shared-memory typed buffers inherited by process-pool workers
  */
 
+/* _GNU_SOURCE: memfd_create() and MAP_ANONYMOUS (see modules.c). */
+#if !defined(__APPLE__)
+#define _GNU_SOURCE
+#endif
 #include "multiproc.h"
+#include "platform.h"
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <sys/wait.h>
 #include <errno.h>
 #include <stdio.h>
+#include <sched.h>
+#include <time.h>
+#include <fcntl.h>
+#include <sys/mman.h>
 
+#if defined(PLATFORM_MACOS) && !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS 0x1000   // MAP_ANON, hidden by strict _POSIX_C_SOURCE
+#endif
+
+#ifndef XENLY_NO_MULTIPROC
 // Forward declare eval from interpreter.c
 extern Value *eval(Interpreter *interp, ASTNode *node, Environment *env);
+#endif
+
+// ─── Parker Implementation ────────────────────────────────────────────────────
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+// timeout_ns < 0 sleeps until woken.  Spurious returns are fine: every
+// caller loops and re-checks its condition.
+static void parker_sleep(XlyParker *p, uint32_t seen, long long timeout_ns) {
+    struct timespec ts, *tsp = NULL;
+    if (timeout_ns >= 0) {
+        ts.tv_sec  = (time_t)(timeout_ns / 1000000000LL);
+        ts.tv_nsec = (long)(timeout_ns % 1000000000LL);
+        tsp = &ts;
+    }
+    syscall(SYS_futex, (uint32_t *)&p->word, FUTEX_WAIT_PRIVATE, seen, tsp, NULL, 0);
+}
+
+static void parker_kick(XlyParker *p, int all) {
+    syscall(SYS_futex, (uint32_t *)&p->word, FUTEX_WAKE_PRIVATE, all ? INT32_MAX : 1,
+            NULL, NULL, 0);
+}
+#else
+static void parker_sleep(XlyParker *p, uint32_t seen, long long timeout_ns) {
+    struct timespec deadline;
+    if (timeout_ns >= 0) {
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        long long ns = (long long)deadline.tv_nsec + timeout_ns;
+        deadline.tv_sec  += (time_t)(ns / 1000000000LL);
+        deadline.tv_nsec  = (long)(ns % 1000000000LL);
+    }
+    pthread_mutex_lock(&p->lock);
+    while (atomic_load(&p->word) == seen) {
+        if (timeout_ns < 0) {
+            pthread_cond_wait(&p->cond, &p->lock);
+        } else if (pthread_cond_timedwait(&p->cond, &p->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    pthread_mutex_unlock(&p->lock);
+}
+
+static void parker_kick(XlyParker *p, int all) {
+    pthread_mutex_lock(&p->lock);
+    if (all) pthread_cond_broadcast(&p->cond);
+    else     pthread_cond_signal(&p->cond);
+    pthread_mutex_unlock(&p->lock);
+}
+#endif
+
+void xly_parker_init(XlyParker *p) {
+    atomic_init(&p->word, 0);
+    atomic_init(&p->waiters, 0);
+#if !defined(__linux__)
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->cond, NULL);
+#endif
+}
+
+void xly_parker_destroy(XlyParker *p) {
+#if !defined(__linux__)
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->cond);
+#else
+    (void)p;
+#endif
+}
+
+// Register as a waiter and snapshot the wake word.  The caller must re-check
+// its condition after this and before parker_sleep().
+static uint32_t parker_prepare(XlyParker *p) {
+    atomic_fetch_add(&p->waiters, 1);
+    uint32_t seen = atomic_load(&p->word);
+    atomic_thread_fence(memory_order_seq_cst);
+    return seen;
+}
+
+static void parker_finish(XlyParker *p) {
+    atomic_fetch_sub(&p->waiters, 1);
+}
+
+// Callers must issue a seq_cst fence after publishing their state change;
+// it pairs with the one in parker_prepare(): either the waker sees the
+// registered waiter, or the waiter's re-check sees the state change.
+static void parker_wake_fenced(XlyParker *p, int all) {
+    if (atomic_load(&p->waiters) == 0) return;
+    atomic_fetch_add(&p->word, 1);
+    parker_kick(p, all);
+}
+
+void xly_parker_wake(XlyParker *p, int all) {
+    atomic_thread_fence(memory_order_seq_cst);
+    parker_wake_fenced(p, all);
+}
+
+// ─── Live Handles ─────────────────────────────────────────────────────────────
+// Every channel, future and shared buffer is in this set while it exists,
+// so a handle the program passed in can be checked before it is
+// dereferenced.  Each starts with its uint32_t kind.  Open addressing by
+// address; LIVE_GONE marks a removed entry.
+typedef const uint32_t LiveHandle;
+#define LIVE_GONE ((LiveHandle *)1)
+
+static pthread_mutex_t live_lock = PTHREAD_MUTEX_INITIALIZER;
+static LiveHandle    **live_slot;
+static size_t          live_cap, live_n, live_used;    // used: n + removed
+
+static size_t live_hash(const void *p) {
+    return (size_t)(((uint64_t)(uintptr_t)p * 0x9E3779B97F4A7C15ULL) >> 32);
+}
+
+// Slot of `w`, or the free slot it would go in.  Caller holds live_lock.
+static LiveHandle **live_find(const void *w) {
+    LiveHandle **gone = NULL;
+    for (size_t i = live_hash(w) & (live_cap - 1);; i = (i + 1) & (live_cap - 1)) {
+        if (live_slot[i] == w) return &live_slot[i];
+        if (!live_slot[i]) return gone ? gone : &live_slot[i];
+        if (live_slot[i] == LIVE_GONE && !gone) gone = &live_slot[i];
+    }
+}
+
+static void live_add(LiveHandle *w) {
+    pthread_mutex_lock(&live_lock);
+    if (2 * (live_used + 1) > live_cap) {
+        LiveHandle **old = live_slot;
+        size_t old_cap = live_cap;
+        live_cap = 64;
+        while (live_cap < 4 * (live_n + 1)) live_cap *= 2;
+        live_slot = (LiveHandle **)calloc(live_cap, sizeof(LiveHandle *));
+        for (size_t i = 0; i < old_cap; i++)
+            if (old[i] && old[i] != LIVE_GONE) *live_find(old[i]) = old[i];
+        free(old);
+        live_used = live_n;
+    }
+    LiveHandle **e = live_find(w);
+    if (!*e) live_used++;
+    *e = w;
+    live_n++;
+    pthread_mutex_unlock(&live_lock);
+}
+
+static void live_remove(LiveHandle *w) {
+    pthread_mutex_lock(&live_lock);
+    LiveHandle **e = live_cap ? live_find(w) : NULL;
+    if (e && *e == w) {
+        *e = LIVE_GONE;
+        live_n--;
+    }
+    pthread_mutex_unlock(&live_lock);
+}
+
+// XLY_WAIT_CHANNEL / XLY_WAIT_FUTURE / XLY_SHARED_BUFFER for a live
+// handle, 0 for anything else
+static uint32_t live_kind(const void *handle) {
+    uint32_t kind = 0;
+    pthread_mutex_lock(&live_lock);
+    if (handle && live_cap) {
+        LiveHandle **e = live_find(handle);
+        if (*e == handle) kind = **e;
+    }
+    pthread_mutex_unlock(&live_lock);
+    return kind;
+}
+
+// ─── Wait Lists (select registration) ─────────────────────────────────────────
+static void waitable_init(XlyWaitable *w, uint32_t kind) {
+    w->kind = kind;
+    pthread_mutex_init(&w->wait_lock, NULL);
+    w->waiters = NULL;
+    atomic_init(&w->waiter_count, 0);
+    live_add(&w->kind);
+}
+
+static void waitable_destroy(XlyWaitable *w) {
+    live_remove(&w->kind);
+    w->kind = 0;
+    pthread_mutex_destroy(&w->wait_lock);
+}
+
+static void waitable_register(XlyWaitable *w, XlySelectNode *node) {
+    pthread_mutex_lock(&w->wait_lock);
+    node->prev = NULL;
+    node->next = w->waiters;
+    if (w->waiters) w->waiters->prev = node;
+    w->waiters = node;
+    atomic_fetch_add(&w->waiter_count, 1);
+    pthread_mutex_unlock(&w->wait_lock);
+}
+
+static void waitable_unregister(XlyWaitable *w, XlySelectNode *node) {
+    pthread_mutex_lock(&w->wait_lock);
+    if (node->prev) node->prev->next = node->next;
+    else            w->waiters = node->next;
+    if (node->next) node->next->prev = node->prev;
+    atomic_fetch_sub(&w->waiter_count, 1);
+    pthread_mutex_unlock(&w->wait_lock);
+}
+
+// Wake every selector registered on `w`.  Like parker_wake_fenced(), the
+// caller must have fenced after making the source ready.
+static void waitable_notify_fenced(XlyWaitable *w) {
+    if (atomic_load(&w->waiter_count) == 0) return;
+    pthread_mutex_lock(&w->wait_lock);
+    for (XlySelectNode *n = w->waiters; n; n = n->next)
+        parker_wake_fenced(n->parker, 1);
+    pthread_mutex_unlock(&w->wait_lock);
+}
+
 
 // ─── Future Implementation ────────────────────────────────────────────────────
 Future *future_create(void) {
     Future *fut = (Future *)calloc(1, sizeof(Future));
+    waitable_init(&fut->wait, XLY_WAIT_FUTURE);
     pthread_mutex_init(&fut->lock, NULL);
     pthread_cond_init(&fut->cond, NULL);
     fut->ready = 0;
     fut->result = NULL;
+    atomic_init(&fut->refs, 1);
     return fut;
 }
 
-void future_destroy(Future *fut) {
-    if (!fut) return;
+static void future_release(Future *fut) {
+    if (atomic_fetch_sub(&fut->refs, 1) != 1) return;
     pthread_mutex_destroy(&fut->lock);
     pthread_cond_destroy(&fut->cond);
+    waitable_destroy(&fut->wait);
     // Don't destroy result — caller owns it
     free(fut);
 }
 
+void future_destroy(Future *fut) {
+    if (fut) future_release(fut);
+}
+
 void future_set(Future *fut, Value *result) {
+    // A waiter may destroy the future as soon as it sees `ready`; keep it
+    // alive until the wake-ups and continuations below are done with it.
+    atomic_fetch_add(&fut->refs, 1);
     pthread_mutex_lock(&fut->lock);
     fut->result = result;
     fut->ready = 1;
+    FutureWaiter *cb = fut->callbacks;
+    fut->callbacks = NULL;
     pthread_cond_broadcast(&fut->cond);
     pthread_mutex_unlock(&fut->lock);
+    atomic_thread_fence(memory_order_seq_cst);
+    waitable_notify_fenced(&fut->wait);
+
+    // Run continuations outside the lock; they may resolve other futures.
+    while (cb) {
+        FutureWaiter *next = cb->next;
+        cb->fn(fut, cb->ctx);
+        free(cb);
+        cb = next;
+    }
+    future_release(fut);
+}
+
+void future_on_ready(Future *fut, FutureCallback fn, void *ctx) {
+    pthread_mutex_lock(&fut->lock);
+    if (!fut->ready) {
+        FutureWaiter *w = (FutureWaiter *)malloc(sizeof(FutureWaiter));
+        w->fn   = fn;
+        w->ctx  = ctx;
+        w->next = NULL;
+        FutureWaiter **tail = &fut->callbacks;
+        while (*tail) tail = &(*tail)->next;
+        *tail = w;
+        pthread_mutex_unlock(&fut->lock);
+        return;
+    }
+    pthread_mutex_unlock(&fut->lock);
+    fn(fut, ctx);
 }
 
 Value *future_get(Future *fut) {
@@ -64,6 +330,10 @@ Value *future_get(Future *fut) {
     return result;
 }
 
+Future *future_check(void *handle) {
+    return live_kind(handle) == XLY_WAIT_FUTURE ? (Future *)handle : NULL;
+}
+
 int future_is_ready(Future *fut) {
     pthread_mutex_lock(&fut->lock);
     int ready = fut->ready;
@@ -71,13 +341,214 @@ int future_is_ready(Future *fut) {
     return ready;
 }
 
+// ─── Future Combinators ───────────────────────────────────────────────────────
+// One FutureGroup per combinator call.  Each input gets a slot whose
+// continuation records its result; the group is freed by whichever
+// continuation runs last, so no thread ever blocks on the inputs.
+typedef enum { GROUP_ALL, GROUP_ANY, GROUP_RACE } GroupMode;
+
+// Future results are handed out to callers who may free them, so anything a
+// continuation keeps is copied first (shared types are never freed).
+static Value *future_result_copy(Value *v) {
+    if (!v) return value_null();
+    switch (v->type) {
+        case VAL_NUMBER: return value_number(v->num);
+        case VAL_STRING: return value_string(v->str);
+        case VAL_BOOL:   return value_bool(v->boolean);
+        case VAL_NULL:   return value_null();
+        default:         return v;
+    }
+}
+
+typedef struct FutureGroup FutureGroup;
+
+typedef struct {
+    FutureGroup *group;
+    size_t index;
+} FutureGroupSlot;
+
+struct FutureGroup {
+    GroupMode mode;
+    Future *out;
+    size_t n;
+    Value **results;            // GROUP_ALL only
+    FutureGroupSlot *slots;
+    _Atomic size_t remaining;
+    _Atomic int settled;        // GROUP_ANY / GROUP_RACE: out already resolved
+};
+
+static void future_group_on_ready(Future *fut, void *ctx) {
+    FutureGroupSlot *slot = (FutureGroupSlot *)ctx;
+    FutureGroup *g = slot->group;
+    Value *result = fut->result;
+
+    if (g->mode == GROUP_ALL) {
+        g->results[slot->index] = future_result_copy(result);
+    } else if (g->mode == GROUP_RACE ||
+               (result && result->type != VAL_NULL)) {
+        if (atomic_exchange(&g->settled, 1) == 0)
+            future_set(g->out, future_result_copy(result));
+    }
+
+    if (atomic_fetch_sub(&g->remaining, 1) != 1) return;
+
+    // Last input resolved
+    if (g->mode == GROUP_ALL)
+        future_set(g->out, value_array(g->results, g->n));
+    else if (atomic_exchange(&g->settled, 1) == 0)
+        future_set(g->out, value_null());
+    free(g->slots);
+    free(g);
+}
+
+static Future *future_group(GroupMode mode, Future **futs, size_t n) {
+    Future *out = future_create();
+    if (n == 0) {
+        future_set(out, mode == GROUP_ALL ? value_array(NULL, 0) : value_null());
+        return out;
+    }
+    FutureGroup *g = (FutureGroup *)calloc(1, sizeof(FutureGroup));
+    g->mode  = mode;
+    g->out   = out;
+    g->n     = n;
+    g->slots = (FutureGroupSlot *)malloc(sizeof(FutureGroupSlot) * n);
+    if (mode == GROUP_ALL)
+        g->results = (Value **)calloc(n, sizeof(Value *));
+    atomic_init(&g->remaining, n);
+    atomic_init(&g->settled, 0);
+    for (size_t i = 0; i < n; i++) {
+        g->slots[i].group = g;
+        g->slots[i].index = i;
+    }
+    // Register last: a continuation may run (and free g) immediately.
+    for (size_t i = 0; i < n; i++)
+        future_on_ready(futs[i], future_group_on_ready, &g->slots[i]);
+    return out;
+}
+
+Future *future_all(Future **futs, size_t n)  { return future_group(GROUP_ALL,  futs, n); }
+Future *future_any(Future **futs, size_t n)  { return future_group(GROUP_ANY,  futs, n); }
+Future *future_race(Future **futs, size_t n) { return future_group(GROUP_RACE, futs, n); }
+
+Value *future_group_value(const char *name, Future *(*fn)(Future **, size_t),
+                          Value **args, size_t argc) {
+    if (argc < 1 || args[0]->type != VAL_ARRAY) {
+        fprintf(stderr, "%s expects (futures: array)\n", name);
+        return value_null();
+    }
+    size_t n = args[0]->array_len;
+    Future **futs = (Future **)malloc(sizeof(Future *) * (n ? n : 1));
+    for (size_t i = 0; i < n; i++) {
+        Value *h = args[0]->array[i];
+        futs[i] = (h && h->type == VAL_NUMBER) ? future_check((void *)(uintptr_t)h->num) : NULL;
+        if (!futs[i]) {
+            fprintf(stderr, "%s: element %zu is not a future\n", name, i);
+            free(futs);
+            return value_null();
+        }
+    }
+    Future *out = fn(futs, n);
+    free(futs);
+    return value_number((double)(uintptr_t)out);
+}
+
 // ─── Channel Implementation ───────────────────────────────────────────────────
+// Buffered channels use a bounded MPMC ring (Vyukov): producers and consumers
+// each claim a position with one CAS and hand the value over through the
+// slot's sequence number, so the hot path takes no lock and allocates nothing.
+// Threads only park when the ring is full (senders) or empty (receivers).
+// The ring is a power of two; a sender also counts the values in flight
+// (enqueue_pos - dequeue_pos) against the capacity asked for, so a channel
+// of capacity 3 holds 3 values, not 4.
+// Unbuffered channels keep the original unbounded mutex/condvar queue.
+
+// Brief back-off before parking: a slot usually frees up within a few
+// hundred cycles, which is far cheaper than a futex round trip.
+#define CHANNEL_SPIN_YIELDS 16
+
+// A value became available (or the channel closed): wake one parked receiver
+// and every select() registered on the channel.
+static void channel_signal_readable(Channel *chan, int all) {
+    atomic_thread_fence(memory_order_seq_cst);
+    parker_wake_fenced(&chan->not_empty_park, all);
+    waitable_notify_fenced(&chan->wait);
+}
+
+static size_t ring_size_for(size_t capacity) {
+    size_t n = 2;   // a single-slot ring cannot tell "full" from "free"
+    while (n < capacity) n <<= 1;
+    return n;
+}
+
+static int ring_try_push(Channel *chan, Value *data) {
+    size_t pos = atomic_load_explicit(&chan->enqueue_pos, memory_order_relaxed);
+    for (;;) {
+        ChannelSlot *slot = &chan->slots[pos & chan->mask];
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+        if (dif == 0) {
+            // dequeue_pos only grows: the bound holds when the CAS succeeds
+            if (pos - atomic_load_explicit(&chan->dequeue_pos, memory_order_acquire) >=
+                chan->capacity)
+                return -1;  // full
+            if (atomic_compare_exchange_weak_explicit(&chan->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                slot->data = data;
+                atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+                return 0;
+            }
+        } else if (dif < 0) {
+            return -1;  // full
+        } else {
+            pos = atomic_load_explicit(&chan->enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+static int ring_try_pop(Channel *chan, Value **out) {
+    size_t pos = atomic_load_explicit(&chan->dequeue_pos, memory_order_relaxed);
+    for (;;) {
+        ChannelSlot *slot = &chan->slots[pos & chan->mask];
+        size_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        intptr_t dif = (intptr_t)seq - (intptr_t)(pos + 1);
+        if (dif == 0) {
+            if (atomic_compare_exchange_weak_explicit(&chan->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                *out = slot->data;
+                slot->data = NULL;
+                atomic_store_explicit(&slot->seq, pos + chan->mask + 1, memory_order_release);
+                return 0;
+            }
+        } else if (dif < 0) {
+            return -1;  // empty
+        } else {
+            pos = atomic_load_explicit(&chan->dequeue_pos, memory_order_relaxed);
+        }
+    }
+}
+
 Channel *channel_create(size_t capacity) {
     Channel *chan = (Channel *)calloc(1, sizeof(Channel));
-    chan->capacity = capacity;
+    waitable_init(&chan->wait, XLY_WAIT_CHANNEL);
     pthread_mutex_init(&chan->lock, NULL);
     pthread_cond_init(&chan->not_empty, NULL);
     pthread_cond_init(&chan->not_full, NULL);
+    xly_parker_init(&chan->not_empty_park);
+    xly_parker_init(&chan->not_full_park);
+    atomic_init(&chan->closed, 0);
+    atomic_init(&chan->enqueue_pos, 0);
+    atomic_init(&chan->dequeue_pos, 0);
+
+    if (capacity > 0) {
+        size_t n = ring_size_for(capacity);
+        chan->slots = (ChannelSlot *)calloc(n, sizeof(ChannelSlot));
+        for (size_t i = 0; i < n; i++)
+            atomic_init(&chan->slots[i].seq, i);
+        chan->mask = n - 1;
+    }
+    chan->capacity = capacity;
     return chan;
 }
 
@@ -91,13 +562,42 @@ void channel_destroy(Channel *chan) {
         free(msg);
         msg = next;
     }
+    if (chan->slots) {
+        Value *data;
+        while (ring_try_pop(chan, &data) == 0)
+            value_destroy(data);
+        free(chan->slots);
+    }
+    xly_parker_destroy(&chan->not_empty_park);
+    xly_parker_destroy(&chan->not_full_park);
     pthread_mutex_destroy(&chan->lock);
     pthread_cond_destroy(&chan->not_empty);
     pthread_cond_destroy(&chan->not_full);
+    waitable_destroy(&chan->wait);
     free(chan);
 }
 
 int channel_send(Channel *chan, Value *data) {
+    if (chan->slots) {
+        int spins = 0;
+        for (;;) {
+            if (atomic_load(&chan->closed)) return -1;
+            if (ring_try_push(chan, data) == 0) break;
+            if (spins++ < CHANNEL_SPIN_YIELDS) { sched_yield(); continue; }
+
+            uint32_t seen = parker_prepare(&chan->not_full_park);
+            if (ring_try_push(chan, data) == 0) {
+                parker_finish(&chan->not_full_park);
+                break;
+            }
+            if (!atomic_load(&chan->closed))
+                parker_sleep(&chan->not_full_park, seen, -1);
+            parker_finish(&chan->not_full_park);
+        }
+        channel_signal_readable(chan, 0);
+        return 0;
+    }
+
     pthread_mutex_lock(&chan->lock);
     
     if (chan->closed) {
@@ -105,15 +605,6 @@ int channel_send(Channel *chan, Value *data) {
         return -1;  // channel closed
     }
     
-    // Wait if channel is full (buffered channels only)
-    while (chan->capacity > 0 && chan->size >= chan->capacity) {
-        if (chan->closed) {
-            pthread_mutex_unlock(&chan->lock);
-            return -1;
-        }
-        pthread_cond_wait(&chan->not_full, &chan->lock);
-    }
-    
     // Enqueue message
     ChannelMessage *msg = (ChannelMessage *)malloc(sizeof(ChannelMessage));
     msg->data = data;
@@ -129,10 +620,50 @@ int channel_send(Channel *chan, Value *data) {
     
     pthread_cond_signal(&chan->not_empty);
     pthread_mutex_unlock(&chan->lock);
+    atomic_thread_fence(memory_order_seq_cst);
+    waitable_notify_fenced(&chan->wait);
     return 0;
 }
 
+int channel_try_send(Channel *chan, Value *data) {
+    if (chan->slots) {
+        if (atomic_load(&chan->closed)) return -1;
+        if (ring_try_push(chan, data) != 0) return -1;  // full
+        channel_signal_readable(chan, 0);
+        return 0;
+    }
+    return channel_send(chan, data);    // unbuffered queue never fills
+}
+
 Value *channel_recv(Channel *chan) {
+    if (chan->slots) {
+        Value *data;
+        int spins = 0;
+        for (;;) {
+            if (ring_try_pop(chan, &data) == 0) break;
+            if (spins++ < CHANNEL_SPIN_YIELDS && !atomic_load(&chan->closed)) {
+                sched_yield();
+                continue;
+            }
+            if (atomic_load(&chan->closed)) {
+                // Drain anything a sender published just before close
+                if (ring_try_pop(chan, &data) == 0) break;
+                return value_null();
+            }
+
+            uint32_t seen = parker_prepare(&chan->not_empty_park);
+            if (ring_try_pop(chan, &data) == 0) {
+                parker_finish(&chan->not_empty_park);
+                break;
+            }
+            if (!atomic_load(&chan->closed))
+                parker_sleep(&chan->not_empty_park, seen, -1);
+            parker_finish(&chan->not_empty_park);
+        }
+        xly_parker_wake(&chan->not_full_park, 0);
+        return data;
+    }
+
     pthread_mutex_lock(&chan->lock);
     
     // Wait for data
@@ -155,12 +686,18 @@ Value *channel_recv(Channel *chan) {
     Value *data = msg->data;
     free(msg);
     
-    pthread_cond_signal(&chan->not_full);
     pthread_mutex_unlock(&chan->lock);
     return data;
 }
 
 int channel_try_recv(Channel *chan, Value **out) {
+    if (chan->slots) {
+        if (ring_try_pop(chan, out) != 0)
+            return -1;  // no data available
+        xly_parker_wake(&chan->not_full_park, 0);
+        return 0;
+    }
+
     pthread_mutex_lock(&chan->lock);
     
     if (!chan->queue) {
@@ -177,19 +714,315 @@ int channel_try_recv(Channel *chan, Value **out) {
     *out = msg->data;
     free(msg);
     
-    pthread_cond_signal(&chan->not_full);
     pthread_mutex_unlock(&chan->lock);
     return 0;
 }
 
 void channel_close(Channel *chan) {
     pthread_mutex_lock(&chan->lock);
-    chan->closed = 1;
+    atomic_store(&chan->closed, 1);
     pthread_cond_broadcast(&chan->not_empty);
-    pthread_cond_broadcast(&chan->not_full);
     pthread_mutex_unlock(&chan->lock);
+    channel_signal_readable(chan, 1);
+    xly_parker_wake(&chan->not_full_park, 1);
+}
+
+// ─── Select ───────────────────────────────────────────────────────────────────
+// select() registers one node per source, all pointing at a parker owned by
+// the calling thread, then sleeps on that single parker.  Sources wake it via
+// waitable_notify_fenced(); nothing is polled while blocked.
+
+static long long select_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000000000LL + ts.tv_nsec;
 }
 
+// 1 = ready (value in *out), 0 = not ready.  xly_select checked the handle.
+static int select_poll(void *src, Value **out) {
+    if (((XlyWaitable *)src)->kind == XLY_WAIT_CHANNEL) {
+        Channel *chan = (Channel *)src;
+        if (channel_try_recv(chan, out) == 0) return 1;
+        if (atomic_load(&chan->closed)) {
+            if (channel_try_recv(chan, out) == 0) return 1;
+            *out = value_null();    // closed and drained: ready with null
+            return 1;
+        }
+        return 0;
+    }
+    Future *fut = (Future *)src;
+    if (!future_is_ready(fut)) return 0;
+    *out = future_result_copy(fut->result);
+    return 1;
+}
+
+// Sources are polled from `start` round, so a busy one cannot starve
+// the ones after it.
+static int select_poll_all(void **sources, size_t n, size_t start, Value **out) {
+    for (size_t k = 0; k < n; k++) {
+        size_t i = (start + k) % n;
+        if (select_poll(sources[i], out)) return (int)i;
+    }
+    return -1;
+}
+
+static _Atomic size_t select_turn;
+
+int xly_select(void **sources, size_t n, long timeout_ms, Value **out) {
+    *out = NULL;
+    for (size_t i = 0; i < n; i++)
+        if (!live_kind(sources[i])) return -2;
+
+    size_t start = n ? atomic_fetch_add(&select_turn, 1) % n : 0;
+    int fired = select_poll_all(sources, n, start, out);
+    if (fired != -1 || timeout_ms == 0 || n == 0) return fired;
+
+    long long deadline = timeout_ms > 0
+        ? select_now_ns() + (long long)timeout_ms * 1000000LL : -1;
+
+    XlyParker parker;
+    xly_parker_init(&parker);
+    XlySelectNode *nodes = (XlySelectNode *)calloc(n, sizeof(XlySelectNode));
+    for (size_t i = 0; i < n; i++) {
+        nodes[i].parker = &parker;
+        waitable_register((XlyWaitable *)sources[i], &nodes[i]);
+    }
+
+    for (;;) {
+        uint32_t seen = parker_prepare(&parker);
+        fired = select_poll_all(sources, n, start, out);
+        if (fired != -1) { parker_finish(&parker); break; }
+
+        long long remaining = -1;
+        if (deadline >= 0) {
+            remaining = deadline - select_now_ns();
+            if (remaining <= 0) { parker_finish(&parker); break; }
+        }
+        parker_sleep(&parker, seen, remaining);
+        parker_finish(&parker);
+    }
+
+    for (size_t i = 0; i < n; i++)
+        waitable_unregister((XlyWaitable *)sources[i], &nodes[i]);
+    free(nodes);
+    xly_parker_destroy(&parker);
+    return fired;
+}
+
+Value *xly_select_value(const char *name, Value **args, size_t argc) {
+    if (argc < 1 || args[0]->type != VAL_ARRAY) {
+        fprintf(stderr, "%s expects (sources: array, timeoutMs?)\n", name);
+        return value_null();
+    }
+    long timeout_ms = -1;
+    if (argc > 1 && args[1]->type == VAL_NUMBER) timeout_ms = (long)args[1]->num;
+
+    size_t n = args[0]->array_len;
+    void **sources = (void **)malloc(sizeof(void *) * (n ? n : 1));
+    for (size_t i = 0; i < n; i++) {
+        Value *h = args[0]->array[i];
+        sources[i] = (h && h->type == VAL_NUMBER) ? (void *)(uintptr_t)h->num : NULL;
+    }
+
+    Value *out = NULL;
+    int fired = xly_select(sources, n, timeout_ms, &out);
+    free(sources);
+    if (fired == -2) {
+        fprintf(stderr, "%s: sources must be channel or future handles\n", name);
+        return value_null();
+    }
+
+    Value **pair = (Value **)malloc(sizeof(Value *) * 2);
+    pair[0] = value_number((double)fired);
+    pair[1] = out ? out : value_null();
+    return value_array(pair, 2);
+}
+
+// ─── Shared Buffer Implementation ─────────────────────────────────────────────
+static size_t shared_buffer_elem_size(SharedBufferType type) {
+    switch (type) {
+        case SHBUF_F64: return sizeof(double);
+        case SHBUF_I64: return sizeof(int64_t);
+        case SHBUF_I32: return sizeof(int32_t);
+        case SHBUF_U8:  return sizeof(uint8_t);
+    }
+    return 1;
+}
+
+int shared_buffer_type_from_name(const char *name) {
+    if (!name || strcmp(name, "f64") == 0) return SHBUF_F64;
+    if (strcmp(name, "i64") == 0) return SHBUF_I64;
+    if (strcmp(name, "i32") == 0) return SHBUF_I32;
+    if (strcmp(name, "u8")  == 0) return SHBUF_U8;
+    return -1;
+}
+
+SharedBuffer *shared_buffer_create(size_t bytes, SharedBufferType type) {
+    size_t elem = shared_buffer_elem_size(type);
+    if (bytes < elem) return NULL;
+
+    int fd = -1;
+    void *data = MAP_FAILED;
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    // A memfd gives the mapping a file identity (visible in /proc/<pid>/fd)
+    // while fork() children still inherit the mapping itself.
+    fd = memfd_create("xenly-shared-buffer", MFD_CLOEXEC);
+    if (fd >= 0) {
+        if (ftruncate(fd, (off_t)bytes) == 0)
+            data = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (data == MAP_FAILED) { close(fd); fd = -1; }
+    }
+#endif
+    if (data == MAP_FAILED)
+        data = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                    MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        perror("shared_buffer_create: mmap");
+        return NULL;
+    }
+
+    SharedBuffer *buf = (SharedBuffer *)calloc(1, sizeof(SharedBuffer));
+    buf->magic  = XLY_SHARED_BUFFER;
+    buf->type   = type;
+    buf->fd     = fd;
+    buf->data   = data;     // fresh pages are zero-filled
+    buf->bytes  = bytes;
+    buf->length = bytes / elem;
+    live_add(&buf->magic);
+    return buf;
+}
+
+void shared_buffer_destroy(SharedBuffer *buf) {
+    if (!shared_buffer_check(buf)) return;
+    live_remove(&buf->magic);
+    buf->magic = 0;
+    munmap(buf->data, buf->bytes);
+    if (buf->fd >= 0) close(buf->fd);
+    free(buf);
+}
+
+SharedBuffer *shared_buffer_check(void *handle) {
+    return live_kind(handle) == XLY_SHARED_BUFFER ? (SharedBuffer *)handle : NULL;
+}
+
+size_t shared_buffer_length(SharedBuffer *buf) {
+    return buf->length;
+}
+
+// f64 elements are accessed through their bit pattern so every element type
+// can use the same lock-free __atomic builtins.
+static inline uint64_t f64_bits(double d)  { uint64_t u; memcpy(&u, &d, sizeof u); return u; }
+static inline double   bits_f64(uint64_t u) { double d; memcpy(&d, &u, sizeof d); return d; }
+
+int shared_buffer_get(SharedBuffer *buf, size_t index, double *out) {
+    if (index >= buf->length) return -1;
+    switch (buf->type) {
+        case SHBUF_F64:
+            *out = bits_f64(__atomic_load_n((uint64_t *)buf->data + index, __ATOMIC_RELAXED));
+            break;
+        case SHBUF_I64:
+            *out = (double)__atomic_load_n((int64_t *)buf->data + index, __ATOMIC_RELAXED);
+            break;
+        case SHBUF_I32:
+            *out = (double)__atomic_load_n((int32_t *)buf->data + index, __ATOMIC_RELAXED);
+            break;
+        case SHBUF_U8:
+            *out = (double)__atomic_load_n((uint8_t *)buf->data + index, __ATOMIC_RELAXED);
+            break;
+    }
+    return 0;
+}
+
+int shared_buffer_set(SharedBuffer *buf, size_t index, double value) {
+    if (index >= buf->length) return -1;
+    switch (buf->type) {
+        case SHBUF_F64:
+            __atomic_store_n((uint64_t *)buf->data + index, f64_bits(value), __ATOMIC_RELAXED);
+            break;
+        case SHBUF_I64:
+            __atomic_store_n((int64_t *)buf->data + index, (int64_t)value, __ATOMIC_RELAXED);
+            break;
+        case SHBUF_I32:
+            __atomic_store_n((int32_t *)buf->data + index, (int32_t)value, __ATOMIC_RELAXED);
+            break;
+        case SHBUF_U8:
+            __atomic_store_n((uint8_t *)buf->data + index, (uint8_t)value, __ATOMIC_RELAXED);
+            break;
+    }
+    return 0;
+}
+
+int shared_buffer_add(SharedBuffer *buf, size_t index, double delta, double *old) {
+    if (index >= buf->length) return -1;
+    switch (buf->type) {
+        case SHBUF_F64: {
+            uint64_t *slot = (uint64_t *)buf->data + index;
+            uint64_t cur = __atomic_load_n(slot, __ATOMIC_RELAXED);
+            while (!__atomic_compare_exchange_n(slot, &cur, f64_bits(bits_f64(cur) + delta),
+                                                1, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+                ;
+            *old = bits_f64(cur);
+            break;
+        }
+        case SHBUF_I64:
+            *old = (double)__atomic_fetch_add((int64_t *)buf->data + index,
+                                              (int64_t)delta, __ATOMIC_SEQ_CST);
+            break;
+        case SHBUF_I32:
+            *old = (double)__atomic_fetch_add((int32_t *)buf->data + index,
+                                              (int32_t)delta, __ATOMIC_SEQ_CST);
+            break;
+        case SHBUF_U8:
+            *old = (double)__atomic_fetch_add((uint8_t *)buf->data + index,
+                                              (uint8_t)(int)delta, __ATOMIC_SEQ_CST);
+            break;
+    }
+    return 0;
+}
+
+// Stores `desired` only if the element equals `expected`; *old receives the
+// element's previous value either way (compare it to `expected` to tell).
+int shared_buffer_cas(SharedBuffer *buf, size_t index, double expected,
+                      double desired, double *old) {
+    if (index >= buf->length) return -1;
+    switch (buf->type) {
+        case SHBUF_F64: {
+            uint64_t cur = f64_bits(expected);
+            __atomic_compare_exchange_n((uint64_t *)buf->data + index, &cur, f64_bits(desired),
+                                        0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *old = bits_f64(cur);
+            break;
+        }
+        case SHBUF_I64: {
+            int64_t cur = (int64_t)expected;
+            __atomic_compare_exchange_n((int64_t *)buf->data + index, &cur, (int64_t)desired,
+                                        0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *old = (double)cur;
+            break;
+        }
+        case SHBUF_I32: {
+            int32_t cur = (int32_t)expected;
+            __atomic_compare_exchange_n((int32_t *)buf->data + index, &cur, (int32_t)desired,
+                                        0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *old = (double)cur;
+            break;
+        }
+        case SHBUF_U8: {
+            uint8_t cur = (uint8_t)(int)expected;
+            __atomic_compare_exchange_n((uint8_t *)buf->data + index, &cur, (uint8_t)(int)desired,
+                                        0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+            *old = (double)cur;
+            break;
+        }
+    }
+    return 0;
+}
+
+#ifndef XENLY_NO_MULTIPROC
+// Thread and process pools evaluate AST closures, so they only exist in the
+// interpreter build.  multiproc_rt.o (libxly_rt / libxly_rtc) keeps just the
+// parker, future, channel and select primitives above for compiled programs.
+
 // ─── Thread Pool Implementation ───────────────────────────────────────────────
 static void *thread_worker_func(void *arg);
 
@@ -258,6 +1091,7 @@ static void *thread_worker_func(void *arg) {
     // Each thread needs its own interpreter instance for thread safety
     // For now, we'll create a minimal interpreter per thread
     Interpreter *thread_interp = interpreter_create();
+    interpreter_mark_isolate();
     
     while (1) {
         pthread_mutex_lock(&pool->queue_lock);
@@ -286,7 +1120,9 @@ static void *thread_worker_func(void *arg) {
         
         Value *result = value_null();  // default result
         
-        if (fn && fn->body) {
+        if (task->native_fn) {
+            task->native_fn(task->native_ctx, thread_interp);
+        } else if (fn && fn->body) {
             // Create function environment
             Environment *fn_env = env_create(fn->closure);
             
@@ -309,8 +1145,8 @@ static void *thread_worker_func(void *arg) {
             env_destroy(fn_env);
         }
         
-        // Resolve the future with the result
-        future_set(task->future, result);
+        // Resolve the future with the result (posted tasks have none)
+        if (task->future) future_set(task->future, result);
         
         // Free the copied args array (Values already freed by env_destroy above)
         free(task->args);
@@ -321,14 +1157,10 @@ static void *thread_worker_func(void *arg) {
     return NULL;
 }
 
-Future *thread_pool_submit(ThreadPool *pool, FnDef *fn, Value **args, size_t argc) {
+// Enqueue a task; `with_future` links a fresh future that the worker resolves.
+static Future *thread_pool_enqueue(ThreadPool *pool, ThreadTask *task, int with_future) {
     // Create future first
-    Future *fut = future_create();
-    
-    ThreadTask *task = (ThreadTask *)calloc(1, sizeof(ThreadTask));
-    task->fn = fn;
-    task->args = args;
-    task->argc = argc;
+    Future *fut = with_future ? future_create() : NULL;
     task->future = fut;  // link the future to this task
     
     // Enqueue task
@@ -345,15 +1177,308 @@ Future *thread_pool_submit(ThreadPool *pool, FnDef *fn, Value **args, size_t arg
     return fut;
 }
 
+Future *thread_pool_submit(ThreadPool *pool, FnDef *fn, Value **args, size_t argc) {
+    ThreadTask *task = (ThreadTask *)calloc(1, sizeof(ThreadTask));
+    task->fn = fn;
+    task->args = args;
+    task->argc = argc;
+    return thread_pool_enqueue(pool, task, 1);
+}
+
+Future *thread_pool_submit_native(ThreadPool *pool, ThreadNativeFn fn, void *ctx) {
+    ThreadTask *task = (ThreadTask *)calloc(1, sizeof(ThreadTask));
+    task->native_fn  = fn;
+    task->native_ctx = ctx;
+    return thread_pool_enqueue(pool, task, 1);
+}
+
+void thread_pool_post_native(ThreadPool *pool, ThreadNativeFn fn, void *ctx) {
+    ThreadTask *task = (ThreadTask *)calloc(1, sizeof(ThreadTask));
+    task->native_fn  = fn;
+    task->native_ctx = ctx;
+    thread_pool_enqueue(pool, task, 0);
+}
+
+// Process-wide pool for runtime-internal work (parallel array ops).  It lives
+// until exit; worker threads are detached from any user-visible handle.
+static ThreadPool *g_shared_pool = NULL;
+static pthread_once_t g_shared_pool_once = PTHREAD_ONCE_INIT;
+
+static void shared_pool_init(void) {
+    long n = xly_cpu_count();
+    g_shared_pool = thread_pool_create(n > 0 ? (size_t)n : 1);
+}
+
+ThreadPool *thread_pool_shared(void) {
+    pthread_once(&g_shared_pool_once, shared_pool_init);
+    return g_shared_pool;
+}
+
+// ─── future_then ──────────────────────────────────────────────────────────────
+typedef struct {
+    Value *fn;
+    Value *arg;
+    Future *out;
+} ThenTask;
+
+static void future_then_run(void *ctx, Interpreter *isolate) {
+    ThenTask *t = (ThenTask *)ctx;
+    Value *r = call_value(isolate, t->fn, &t->arg, 1);
+    value_destroy(t->arg);
+    future_set(t->out, r ? r : value_null());
+    free(t);
+}
+
+static void future_then_ready(Future *fut, void *ctx) {
+    ThenTask *t = (ThenTask *)ctx;
+    t->arg = future_result_copy(fut->result);
+    thread_pool_post_native(thread_pool_shared(), future_then_run, t);
+}
+
+Future *future_then(Future *fut, Value *fn) {
+    ThenTask *t = (ThenTask *)calloc(1, sizeof(ThenTask));
+    t->fn  = fn;
+    t->out = future_create();
+    Future *out = t->out;       // t may be freed before we return
+    future_on_ready(fut, future_then_ready, t);
+    return out;
+}
+
 // ─── Process Pool Implementation ──────────────────────────────────────────────
+// Wire format (native byte order, parent and child are the same binary):
+//   task:   u64 FnDef pointer, u32 len + fn name, u32 argc, argc × value
+//   result: value
+//   value:  'N' | 'n' f64 | 'b' u8 | 's' u32 len + bytes | 'a' u32 len + values
+// Functions, instances and other shared types travel as null; numeric
+// handles (shared buffers, channels) pass through as plain numbers.
+// Workers only run top-level functions that existed at fork time: the child
+// checks the pointer against its own copy of the global scope.
+
+extern Interpreter *g_interp;
+
+typedef struct {
+    char *data;
+    size_t len, cap;
+} ProcBuf;
+
+static void procbuf_put(ProcBuf *b, const void *src, size_t n) {
+    if (b->len + n > b->cap) {
+        b->cap = (b->len + n) * 2 + 64;
+        b->data = (char *)realloc(b->data, b->cap);
+    }
+    memcpy(b->data + b->len, src, n);
+    b->len += n;
+}
+
+static void procbuf_put_value(ProcBuf *b, Value *v) {
+    char tag = 'N';
+    if (v && v->type == VAL_NUMBER)      tag = 'n';
+    else if (v && v->type == VAL_BOOL)   tag = 'b';
+    else if (v && v->type == VAL_STRING) tag = 's';
+    else if (v && v->type == VAL_ARRAY)  tag = 'a';
+    procbuf_put(b, &tag, 1);
+
+    switch (tag) {
+        case 'n': procbuf_put(b, &v->num, sizeof(double)); break;
+        case 'b': { uint8_t x = (uint8_t)(v->boolean != 0); procbuf_put(b, &x, 1); break; }
+        case 's': {
+            uint32_t len = (uint32_t)strlen(v->str);
+            procbuf_put(b, &len, sizeof len);
+            procbuf_put(b, v->str, len);
+            break;
+        }
+        case 'a': {
+            uint32_t len = (uint32_t)v->array_len;
+            procbuf_put(b, &len, sizeof len);
+            for (uint32_t i = 0; i < len; i++) procbuf_put_value(b, v->array[i]);
+            break;
+        }
+    }
+}
+
+static int write_full(int fd, const void *src, size_t n) {
+    const char *p = (const char *)src;
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w < 0 && errno == EINTR) continue;
+        if (w <= 0) return -1;
+        p += w; n -= (size_t)w;
+    }
+    return 0;
+}
+
+static int read_full(int fd, void *dst, size_t n) {
+    char *p = (char *)dst;
+    while (n > 0) {
+        ssize_t r = read(fd, p, n);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) return -1;     // EOF: the other side exited
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+// Returns NULL if the stream ended or is malformed.
+static Value *read_value(int fd) {
+    char tag;
+    if (read_full(fd, &tag, 1) < 0) return NULL;
+    switch (tag) {
+        case 'N': return value_null();
+        case 'n': {
+            double d;
+            return read_full(fd, &d, sizeof d) < 0 ? NULL : value_number(d);
+        }
+        case 'b': {
+            uint8_t x;
+            return read_full(fd, &x, 1) < 0 ? NULL : value_bool(x);
+        }
+        case 's': {
+            uint32_t len;
+            if (read_full(fd, &len, sizeof len) < 0) return NULL;
+            char *str = (char *)malloc((size_t)len + 1);
+            if (read_full(fd, str, len) < 0) { free(str); return NULL; }
+            str[len] = '\0';
+            Value *v = value_string(str);
+            free(str);
+            return v;
+        }
+        case 'a': {
+            uint32_t len;
+            if (read_full(fd, &len, sizeof len) < 0) return NULL;
+            Value **items = (Value **)malloc(sizeof(Value *) * (len ? len : 1));
+            for (uint32_t i = 0; i < len; i++) {
+                items[i] = read_value(fd);
+                if (!items[i]) { free(items); return NULL; }
+            }
+            return value_array(items, len);
+        }
+    }
+    return NULL;
+}
+
+// Child side: the forked copy of the parent's interpreter (with its globals
+// and imports) evaluates each task; exits when the parent closes pipe_in.
+static void process_worker_main(int in_fd, int out_fd) {
+    Interpreter *interp = g_interp ? g_interp : interpreter_create();
+    ProcBuf out = { 0 };
+
+    for (;;) {
+        uint64_t fn_bits;
+        uint32_t name_len, argc;
+        char name[256];
+        if (read_full(in_fd, &fn_bits, sizeof fn_bits) < 0 ||
+            read_full(in_fd, &name_len, sizeof name_len) < 0 || name_len >= sizeof name ||
+            read_full(in_fd, name, name_len) < 0 ||
+            read_full(in_fd, &argc, sizeof argc) < 0) break;
+        name[name_len] = '\0';
+
+        Value **args = (Value **)calloc(argc ? argc : 1, sizeof(Value *));
+        int ok = 1;
+        for (uint32_t i = 0; i < argc && ok; i++)
+            ok = (args[i] = read_value(in_fd)) != NULL;
+        if (!ok) break;
+
+        Value *known = env_get(interp->global, name);
+        FnDef *fn = (known && known->type == VAL_FUNCTION &&
+                     (uint64_t)(uintptr_t)known->fn == fn_bits) ? known->fn : NULL;
+        if (!fn)
+            fprintf(stderr, "\033[1;31m[Xenly Error] process pool: '%s' is not a top-level "
+                            "function defined before process_pool_create\033[0m\n", name);
+        // call_value() binds copies of primitives (and fills defaults), so
+        // those are still ours; arrays are shared with the call's result.
+        Value *result = fn ? call_value(interp, known, args, argc) : NULL;
+        for (uint32_t i = 0; i < argc; i++)
+            if (args[i]->type == VAL_NULL || args[i]->type == VAL_NUMBER ||
+                args[i]->type == VAL_STRING || args[i]->type == VAL_BOOL)
+                value_destroy(args[i]);
+        free(args);
+        fflush(stdout);     // _exit() below would drop buffered prints
+
+        out.len = 0;
+        procbuf_put_value(&out, result);
+        if (write_full(out_fd, out.data, out.len) < 0) break;
+    }
+    _exit(0);
+}
+
+// Marks `worker` dead.  The last live worker hands queued tasks a null result
+// so no future waits forever.
+static void process_worker_lost(ProcessPool *pool, ProcessWorker *worker) {
+    pthread_mutex_lock(&pool->lock);
+    worker->dead = 1;
+    ProcessTask *orphans = NULL;
+    if (--pool->alive == 0) {
+        orphans = pool->task_queue;
+        pool->task_queue = pool->task_queue_tail = NULL;
+    }
+    pthread_mutex_unlock(&pool->lock);
+
+    fprintf(stderr, "\033[1;31m[Xenly Error] process pool worker %d exited unexpectedly\033[0m\n",
+            (int)worker->pid);
+    while (orphans) {
+        ProcessTask *next = orphans->next;
+        future_set(orphans->future, value_null());
+        free(orphans->payload);
+        free(orphans);
+        orphans = next;
+    }
+}
+
+// Parent side: one dispatcher per worker pulls from the shared queue, so an
+// idle worker always takes the next task.
+static void *process_dispatch_func(void *arg) {
+    ProcessWorker *worker = (ProcessWorker *)arg;
+    ProcessPool *pool = worker->pool;
+
+    // A worker that died leaves a closed pipe: get EPIPE instead of SIGPIPE.
+    sigset_t pipe_set;
+    sigemptyset(&pipe_set);
+    sigaddset(&pipe_set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &pipe_set, NULL);
+
+    for (;;) {
+        pthread_mutex_lock(&pool->lock);
+        while (!pool->task_queue && !pool->shutdown)
+            pthread_cond_wait(&pool->cond, &pool->lock);
+        if (!pool->task_queue) {
+            pthread_mutex_unlock(&pool->lock);
+            break;
+        }
+        ProcessTask *task = pool->task_queue;
+        pool->task_queue = task->next;
+        if (!pool->task_queue) pool->task_queue_tail = NULL;
+        worker->busy = 1;
+        pthread_mutex_unlock(&pool->lock);
+
+        Value *result = NULL;
+        if (write_full(worker->pipe_in[1], task->payload, task->payload_len) == 0)
+            result = read_value(worker->pipe_out[0]);
+        worker->busy = 0;
+
+        future_set(task->future, result ? result : value_null());
+        free(task->payload);
+        free(task);
+        if (!result) {
+            process_worker_lost(pool, worker);
+            break;
+        }
+    }
+    return NULL;
+}
+
 ProcessPool *process_pool_create(size_t num_workers) {
     ProcessPool *pool = (ProcessPool *)calloc(1, sizeof(ProcessPool));
     pool->num_workers = num_workers;
     pthread_mutex_init(&pool->lock, NULL);
-    
+    pthread_cond_init(&pool->cond, NULL);
+
+    // Children inherit stdio buffers; flush so nothing is printed twice.
+    fflush(NULL);
+
     ProcessWorker *prev = NULL;
     for (size_t i = 0; i < num_workers; i++) {
         ProcessWorker *worker = (ProcessWorker *)calloc(1, sizeof(ProcessWorker));
+        worker->pool = pool;
         
         // Create pipes
         if (pipe(worker->pipe_in) < 0 || pipe(worker->pipe_out) < 0) {
@@ -378,14 +1503,13 @@ ProcessPool *process_pool_create(size_t num_workers) {
             // Child process: close unused pipe ends
             close(worker->pipe_in[1]);   // close write end of input
             close(worker->pipe_out[0]);  // close read end of output
-            
-            // Worker loop: read tasks, execute, write results
-            while (1) {
-                // TODO: Implement worker protocol
-                // For now, just sleep
-                sleep(1);
+            // ...and the parent's ends for earlier siblings, so their
+            // workers still see EOF when the parent closes them.
+            for (ProcessWorker *w = pool->workers; w; w = w->next) {
+                close(w->pipe_in[1]);
+                close(w->pipe_out[0]);
             }
-            exit(0);
+            process_worker_main(worker->pipe_in[0], worker->pipe_out[1]);
         }
         
         // Parent: close unused pipe ends
@@ -400,22 +1524,32 @@ ProcessPool *process_pool_create(size_t num_workers) {
             pool->workers = worker;
         }
         prev = worker;
+        pool->alive++;
     }
+
+    // Dispatchers start after every fork so no child inherits a held lock.
+    for (ProcessWorker *w = pool->workers; w; w = w->next)
+        pthread_create(&w->dispatcher, NULL, process_dispatch_func, w);
     
     return pool;
 }
 
 void process_pool_destroy(ProcessPool *pool) {
     if (!pool) return;
+
+    // Let dispatchers drain the queue, then stop
+    pthread_mutex_lock(&pool->lock);
+    pool->shutdown = 1;
+    pthread_cond_broadcast(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
     
     ProcessWorker *worker = pool->workers;
     while (worker) {
-        // Close pipes
+        pthread_join(worker->dispatcher, NULL);
+
+        // Closing the task pipe makes the worker exit its loop
         close(worker->pipe_in[1]);
         close(worker->pipe_out[0]);
-        
-        // Kill worker process
-        kill(worker->pid, SIGTERM);
         waitpid(worker->pid, NULL, 0);
         
         ProcessWorker *next = worker->next;
@@ -423,14 +1557,48 @@ void process_pool_destroy(ProcessPool *pool) {
         worker = next;
     }
     
+    pthread_cond_destroy(&pool->cond);
     pthread_mutex_destroy(&pool->lock);
     free(pool);
 }
 
 Future *process_pool_submit(ProcessPool *pool, FnDef *fn, Value **args, size_t argc) {
-    (void)pool; (void)fn; (void)args; (void)argc;
-    // TODO: Serialize task to worker, deserialize result
     Future *fut = future_create();
-    future_set(fut, value_null());  // placeholder
+
+    // Serialize now: the caller's args do not outlive this call
+    ProcBuf b = { 0 };
+    uint64_t fn_bits = (uint64_t)(uintptr_t)fn;
+    const char *name = (fn && fn->name) ? fn->name : "";
+    uint32_t name_len = (uint32_t)strnlen(name, 255);
+    uint32_t n = (uint32_t)argc;
+    procbuf_put(&b, &fn_bits, sizeof fn_bits);
+    procbuf_put(&b, &name_len, sizeof name_len);
+    procbuf_put(&b, name, name_len);
+    procbuf_put(&b, &n, sizeof n);
+    for (size_t i = 0; i < argc; i++) procbuf_put_value(&b, args[i]);
+
+    ProcessTask *task = (ProcessTask *)calloc(1, sizeof(ProcessTask));
+    task->payload     = b.data;
+    task->payload_len = b.len;
+    task->future      = fut;
+
+    pthread_mutex_lock(&pool->lock);
+    if (pool->alive == 0) {
+        pthread_mutex_unlock(&pool->lock);
+        free(task->payload);
+        free(task);
+        future_set(fut, value_null());
+        return fut;
+    }
+    if (pool->task_queue_tail) {
+        pool->task_queue_tail->next = task;
+        pool->task_queue_tail = task;
+    } else {
+        pool->task_queue = pool->task_queue_tail = task;
+    }
+    pthread_cond_signal(&pool->cond);
+    pthread_mutex_unlock(&pool->lock);
     return fut;
 }
+
+#endif // XENLY_NO_MULTIPROC
@@ -12,6 +12,8 @@
 
 #include "interpreter.h"
 #include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
 #include <semaphore.h>
 #include <sys/types.h>
 #include <signal.h>
@@ -22,11 +24,25 @@ struct Value;
 typedef struct Future Future;
 
 // ─── Process Pool ─────────────────────────────────────────────────────────────
+// Workers are forked when the pool is created, so they see a snapshot of the
+// parent: functions and shared buffers must exist before process_pool_create.
+// Each worker has a dispatcher thread in the parent that feeds it queued
+// tasks over pipe_in and resolves the task's future from pipe_out.
+typedef struct ProcessTask {
+    char *payload;          // serialized fn pointer + args (copied at submit)
+    size_t payload_len;
+    Future *future;
+    struct ProcessTask *next;
+} ProcessTask;
+
 typedef struct ProcessWorker {
     pid_t pid;              // worker process ID
     int pipe_in[2];         // pipe for sending tasks TO worker
     int pipe_out[2];        // pipe for receiving results FROM worker
     int busy;               // 1 if worker is processing a task
+    int dead;               // worker exited; remaining tasks resolve to null
+    pthread_t dispatcher;   // parent-side thread driving this worker
+    struct ProcessPool *pool;
     struct ProcessWorker *next;
 } ProcessWorker;
 
@@ -34,13 +50,24 @@ typedef struct ProcessPool {
     size_t num_workers;
     ProcessWorker *workers;
     pthread_mutex_t lock;
+    pthread_cond_t cond;
+    ProcessTask *task_queue;
+    ProcessTask *task_queue_tail;
+    size_t alive;           // workers still accepting tasks
+    int shutdown;
 } ProcessPool;
 
 // ─── Thread Pool ──────────────────────────────────────────────────────────────
+// Native tasks run a C callback on the worker's isolate interpreter instead
+// of evaluating a Xenly function (used by array.parallel*).
+typedef void (*ThreadNativeFn)(void *ctx, Interpreter *isolate);
+
 typedef struct ThreadTask {
     FnDef *fn;
     Value **args;
     size_t argc;
+    ThreadNativeFn native_fn;   // when set, fn/args are ignored
+    void *native_ctx;
     Future *future;         // the future that will be resolved when task completes
     struct ThreadTask *next;
 } ThreadTask;
@@ -61,31 +88,127 @@ typedef struct ThreadPool {
     int shutdown;
 } ThreadPool;
 
+// ─── Parker (futex-style wait/wake word) ─────────────────────────────────────
+// Waiters snapshot `word`, re-check their condition, then sleep until the
+// word changes.  Wakers only bump `word` and issue a wake when `waiters` is
+// non-zero, so the uncontended path never enters the kernel.  On Linux this
+// is a raw futex; elsewhere a mutex/condvar pair emulates it.
+typedef struct XlyParker {
+    _Atomic uint32_t word;
+    _Atomic int waiters;
+#if !defined(__linux__)
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+} XlyParker;
+
+// ─── Select Wait Lists ────────────────────────────────────────────────────────
+// Channels and futures both start with an XlyWaitable header so a select()
+// caller can tell them apart from a bare handle and hang one XlySelectNode
+// on each source.  Every node points at the selecting thread's own parker;
+// a source that becomes ready wakes all parkers on its list.
+#define XLY_WAIT_CHANNEL 0x4E414843u   // "CHAN"
+#define XLY_WAIT_FUTURE  0x55545546u   // "FUTU"
+
+typedef struct XlySelectNode {
+    XlyParker *parker;
+    struct XlySelectNode *prev;
+    struct XlySelectNode *next;
+} XlySelectNode;
+
+typedef struct XlyWaitable {
+    uint32_t kind;              // XLY_WAIT_CHANNEL / XLY_WAIT_FUTURE
+    pthread_mutex_t wait_lock;
+    XlySelectNode *waiters;
+    _Atomic int waiter_count;
+} XlyWaitable;
+
 // ─── Channel (for inter-task communication) ───────────────────────────────────
 typedef struct ChannelMessage {
     Value *data;
     struct ChannelMessage *next;
 } ChannelMessage;
 
+// One slot of the bounded ring.  `seq` follows Vyukov's MPMC scheme:
+//   seq == pos       → slot free for the producer that claims `pos`
+//   seq == pos + 1   → slot full for the consumer that claims `pos`
+typedef struct ChannelSlot {
+    _Atomic size_t seq;
+    Value *data;
+} ChannelSlot;
+
+#define XLY_CACHELINE 64
+
 typedef struct Channel {
+    XlyWaitable wait;       // must stay first (see xly_select)
+    // Unbuffered (capacity 0) channels keep the unbounded linked queue.
     ChannelMessage *queue;
     ChannelMessage *queue_tail;
-    size_t capacity;        // 0 = unbuffered
-    size_t size;            // current items in queue
+    size_t capacity;        // 0 = unbuffered; otherwise values it holds at most
+    size_t size;            // current items in queue (linked mode only)
     pthread_mutex_t lock;
     pthread_cond_t not_empty;
     pthread_cond_t not_full;
-    int closed;
+    _Atomic int closed;
+
+    // Buffered channels: preallocated lock-free ring.
+    ChannelSlot *slots;
+    size_t mask;
+    char pad0[XLY_CACHELINE];
+    _Atomic size_t enqueue_pos;
+    char pad1[XLY_CACHELINE - sizeof(size_t)];
+    _Atomic size_t dequeue_pos;
+    char pad2[XLY_CACHELINE - sizeof(size_t)];
+    XlyParker not_empty_park;   // receivers park here when the ring is empty
+    XlyParker not_full_park;    // senders park here when the ring is full
 } Channel;
 
 // ─── Future/Promise ───────────────────────────────────────────────────────────
+// Continuations registered with future_on_ready() run exactly once, on the
+// thread that calls future_set() (or immediately if already resolved).
+// future_destroy() may follow future_get() at once: the setter holds its
+// own reference until it has finished with the future.
+typedef void (*FutureCallback)(Future *fut, void *ctx);
+
+typedef struct FutureWaiter {
+    FutureCallback fn;
+    void *ctx;
+    struct FutureWaiter *next;
+} FutureWaiter;
+
 typedef struct Future {
+    XlyWaitable wait;       // must stay first (see xly_select)
     Value *result;
     int ready;
+    _Atomic int refs;       // the owner's, plus one while future_set() runs
     pthread_mutex_t lock;
     pthread_cond_t cond;
+    FutureWaiter *callbacks;    // pending continuations, in registration order
 } Future;
 
+// ─── Shared Buffer ────────────────────────────────────────────────────────────
+// Fixed-length numeric array in MAP_SHARED memory (a memfd on Linux).  The
+// mapping survives fork() at the same address, so a buffer created before
+// process_pool_create() can be filled in place by every worker.  Element
+// access goes through relaxed atomics; add/cas are sequentially consistent.
+#define XLY_SHARED_BUFFER 0x46554253u  // "SBUF"
+
+typedef enum {
+    SHBUF_F64,
+    SHBUF_I64,
+    SHBUF_I32,
+    SHBUF_U8,
+} SharedBufferType;
+
+typedef struct SharedBuffer {
+    uint32_t magic;         // XLY_SHARED_BUFFER; must stay first (live handle)
+    SharedBufferType type;
+    int fd;                 // backing memfd, -1 for anonymous shared memory
+    void *data;
+    size_t bytes;
+    size_t length;          // element count
+} SharedBuffer;
+
 // ─── API ──────────────────────────────────────────────────────────────────────
 // Process pool
 ProcessPool *process_pool_create(size_t num_workers);
@@ -96,13 +219,17 @@ Future *process_pool_submit(ProcessPool *pool, FnDef *fn, Value **args, size_t a
 ThreadPool *thread_pool_create(size_t num_workers);
 void thread_pool_destroy(ThreadPool *pool);
 Future *thread_pool_submit(ThreadPool *pool, FnDef *fn, Value **args, size_t argc);
+Future *thread_pool_submit_native(ThreadPool *pool, ThreadNativeFn fn, void *ctx);
+void thread_pool_post_native(ThreadPool *pool, ThreadNativeFn fn, void *ctx);  // no future
+ThreadPool *thread_pool_shared(void);              // lazily created, one worker per CPU
 
 // Channel
 Channel *channel_create(size_t capacity);
 void channel_destroy(Channel *chan);
 int channel_send(Channel *chan, Value *data);      // returns 0 on success
 Value *channel_recv(Channel *chan);                // blocks until data available
-int channel_try_recv(Channel *chan, Value **out);  // non-blocking
+int channel_try_recv(Channel *chan, Value **out);  // non-blocking, -1 if empty
+int channel_try_send(Channel *chan, Value *data);  // non-blocking, -1 if full/closed
 void channel_close(Channel *chan);
 
 // Future
@@ -111,6 +238,49 @@ void future_destroy(Future *fut);
 void future_set(Future *fut, Value *result);
 Value *future_get(Future *fut);                    // blocks until ready
 int future_is_ready(Future *fut);
+Future *future_check(void *handle);                 // NULL unless a live future
+void future_on_ready(Future *fut, FutureCallback fn, void *ctx);
+
+// Future combinators — each returns a new future and parks no thread.
+//   all:  array of every result, in input order
+//   any:  first non-null result (null if every input resolves to null)
+//   race: first result to resolve, whatever it is
+//   then: fn(result), evaluated on the shared thread pool (interpreter only)
+Future *future_all(Future **futs, size_t n);
+Future *future_any(Future **futs, size_t n);
+Future *future_race(Future **futs, size_t n);
+Future *future_then(Future *fut, Value *fn);
+// The builtins' side: (futures: array) → future handle, null after an
+// error message prefixed with `name`.
+Value *future_group_value(const char *name, Future *(*fn)(Future **, size_t),
+                          Value **args, size_t argc);
+
+// Select: block until one of `sources` (Channel* / Future*) is ready.
+// Returns the index that fired and stores the received value / future
+// result in *out; returns -1 on timeout and -2 on an invalid handle (not
+// a live channel or future).  timeout_ms < 0 waits forever, 0 polls once.
+// When several sources are ready, successive calls take them in turn.
+int xly_select(void **sources, size_t n, long timeout_ms, Value **out);
+// The builtins' side: (sources: array, timeoutMs?) → [index, value], null
+// after an error message prefixed with `name`.
+Value *xly_select_value(const char *name, Value **args, size_t argc);
+
+// Shared buffer — index functions return 0 on success, -1 when out of range.
+SharedBuffer *shared_buffer_create(size_t bytes, SharedBufferType type);
+void shared_buffer_destroy(SharedBuffer *buf);
+SharedBuffer *shared_buffer_check(void *handle);  // NULL unless a live buffer
+size_t shared_buffer_length(SharedBuffer *buf);
+int shared_buffer_type_from_name(const char *name); // "f64"/"i64"/"i32"/"u8", -1 if unknown
+int shared_buffer_get(SharedBuffer *buf, size_t index, double *out);
+int shared_buffer_set(SharedBuffer *buf, size_t index, double value);
+int shared_buffer_add(SharedBuffer *buf, size_t index, double delta, double *old);
+int shared_buffer_cas(SharedBuffer *buf, size_t index, double expected,
+                      double desired, double *old);
+
+// Parker
+void xly_parker_init(XlyParker *p);
+void xly_parker_destroy(XlyParker *p);
+void xly_parker_wake(XlyParker *p, int all);
 
 // Built-in registration
 void register_multiproc_builtins(Interpreter *interp);
@@ -190,6 +190,12 @@ Value *builtin_channel_destroy(Value **args, size_t argc) {
     return value_null();
 }
 
+// channel_select([ch1, ch2, fut], timeoutMs) → [index, value]
+// index is the position of the source that fired, -1 on timeout.
+Value *builtin_channel_select(Value **args, size_t argc) {
+    return xly_select_value("channel_select", args, argc);
+}
+
 // ─── Future Functions ─────────────────────────────────────────────────────────
 Value *builtin_future_get(Value **args, size_t argc) {
     if (argc < 1) {
@@ -198,7 +204,8 @@ Value *builtin_future_get(Value **args, size_t argc) {
     }
     
     Future *fut = (Future *)(uintptr_t)args[0]->num;
-    return future_get(fut);
+    // Copy: the future keeps its result for combinators and later gets
+    return value_copy_shallow(future_get(fut));
 }
 
 Value *builtin_future_is_ready(Value **args, size_t argc) {
@@ -214,6 +221,30 @@ Value *builtin_future_destroy(Value **args, size_t argc) {
     return value_null();
 }
 
+// ─── Future Combinators ───────────────────────────────────────────────────────
+Value *builtin_future_all(Value **args, size_t argc) {
+    return future_group_value("future_all", future_all, args, argc);
+}
+
+Value *builtin_future_any(Value **args, size_t argc) {
+    return future_group_value("future_any", future_any, args, argc);
+}
+
+Value *builtin_future_race(Value **args, size_t argc) {
+    return future_group_value("future_race", future_race, args, argc);
+}
+
+Value *builtin_future_then(Value **args, size_t argc) {
+    Future *fut = (argc > 0 && args[0]->type == VAL_NUMBER)
+                      ? future_check((void *)(uintptr_t)args[0]->num) : NULL;
+    if (!fut || argc < 2 ||
+        (args[1]->type != VAL_FUNCTION && args[1]->type != VAL_BUILTIN_FN)) {
+        fprintf(stderr, "future_then expects (future, fn)\n");
+        return value_null();
+    }
+    return value_number((double)(uintptr_t)future_then(fut, args[1]));
+}
+
 // ─── CPU-bound computation helpers ────────────────────────────────────────────
 Value *builtin_cpu_count(Value **args, size_t argc) {
     (void)args; (void)argc;
@@ -240,11 +271,16 @@ void register_multiproc_builtins(Interpreter *interp) {
     register_builtin(interp, "channel_try_recv", builtin_channel_try_recv);
     register_builtin(interp, "channel_close", builtin_channel_close);
     register_builtin(interp, "channel_destroy", builtin_channel_destroy);
+    register_builtin(interp, "channel_select", builtin_channel_select);
     
     // Futures
     register_builtin(interp, "future_get", builtin_future_get);
     register_builtin(interp, "future_is_ready", builtin_future_is_ready);
     register_builtin(interp, "future_destroy", builtin_future_destroy);
+    register_builtin(interp, "future_all", builtin_future_all);
+    register_builtin(interp, "future_any", builtin_future_any);
+    register_builtin(interp, "future_race", builtin_future_race);
+    register_builtin(interp, "future_then", builtin_future_then);
     
     // Utilities
     register_builtin(interp, "cpu_count", builtin_cpu_count);
@@ -228,6 +228,8 @@ static ASTNode *parse_statement(Parser *p) {
                         if (count >= cap) { cap *= 2; params = (Param *)realloc(params, sizeof(Param) * cap); }
                         params[count].name = strdup(p->current.value);
                         params[count].type_annotation = NULL;
+                        params[count].default_value = NULL;
+                        params[count].is_optional = 0;
                         advance(p);
                         count++;
                     } while (match(p, TOKEN_COMMA));
@@ -1911,6 +1913,8 @@ static ASTNode *parse_primary(Parser *p) {
                             }
                             params[count].name = strdup(p->current.value);
                             params[count].type_annotation = NULL;
+                            params[count].default_value = NULL;
+                            params[count].is_optional = 0;
                             advance(p);
                             count++;
                         } while (match(p, TOKEN_COMMA));
@@ -78,13 +78,47 @@ typedef struct {
     int     min_arity; /* count of required params (those without defaults)  */
 } Symbol;
 
+/* A scope's symbols, in declaration order.  Past SCOPE_HASH_MIN symbols
+ * (the global scope of a large program) they are also hashed: `slots` is
+ * an open-addressed table of syms[] index + 1 (0 = empty), at most half
+ * full, so lookups stay O(1) however many names a scope declares.       */
+#define SCOPE_HASH_MIN 16
+
 typedef struct Scope {
     Symbol      *syms;
     int          count;
     int          cap;
+    int         *slots;
+    int          slot_cap;       /* 0 = not hashed yet, else a power of 2 */
     struct Scope *parent;
 } Scope;
 
+/* FNV-1a */
+static unsigned sym_hash(const char *s) {
+    unsigned h = 2166136261u;
+    for (const unsigned char *p = (const unsigned char *)s; *p; p++) {
+        h ^= *p;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void scope_slot_put(Scope *s, int i) {
+    unsigned m = (unsigned)s->slot_cap - 1;
+    unsigned k = sym_hash(s->syms[i].name) & m;
+    while (s->slots[k]) k = (k + 1) & m;
+    s->slots[k] = i + 1;
+}
+
+static void scope_rehash(Scope *s) {
+    int cap = 64;
+    while (cap < s->count * 4) cap *= 2;
+    free(s->slots);
+    s->slots    = (int *)calloc((size_t)cap, sizeof(int));
+    s->slot_cap = cap;
+    for (int i = 0; i < s->count; i++) scope_slot_put(s, i);
+}
+
 static Scope *scope_new(Scope *parent) {
     Scope *s = (Scope *)calloc(1, sizeof(Scope));
     s->cap    = 16;
@@ -98,11 +132,19 @@ static void scope_free(Scope *s) {
     for (int i = 0; i < s->count; i++)
         free(s->syms[i].name);
     free(s->syms);
+    free(s->slots);
     free(s);
 }
 
 /* Look up a name in this scope only (no parent walk). */
 static Symbol *scope_find_local(Scope *s, const char *name) {
+    if (s->slot_cap) {
+        unsigned m = (unsigned)s->slot_cap - 1;
+        for (unsigned k = sym_hash(name) & m; s->slots[k]; k = (k + 1) & m)
+            if (strcmp(s->syms[s->slots[k] - 1].name, name) == 0)
+                return &s->syms[s->slots[k] - 1];
+        return NULL;
+    }
     for (int i = 0; i < s->count; i++)
         if (strcmp(s->syms[i].name, name) == 0)
             return &s->syms[i];
@@ -136,6 +178,8 @@ static Symbol *scope_declare(Scope *s, const char *name, SymKind kind,
     sym->line      = line;
     sym->arity     = arity;
     sym->min_arity = min_arity;
+    if (s->slot_cap && s->count * 2 <= s->slot_cap) scope_slot_put(s, s->count - 1);
+    else if (s->count >= SCOPE_HASH_MIN)            scope_rehash(s);
     return NULL;   /* success */
 }
 
@@ -179,6 +223,22 @@ static int is_builtin(const char *name) {
     return 0;
 }
 
+/* Thread/process pools and the futures built from them exist only in the
+ * interpreter; compiled code has no way to create a future, so these are
+ * rejected rather than left to evaluate to null.                           */
+static const char *k_interp_only[] = {
+    "thread_pool_create", "thread_pool_submit", "thread_pool_destroy",
+    "process_pool_create", "process_pool_submit", "process_pool_destroy",
+    "future_all", "future_any", "future_race", "future_then",
+    NULL
+};
+
+static int is_interp_only(const char *name) {
+    for (int i = 0; k_interp_only[i]; i++)
+        if (strcmp(k_interp_only[i], name) == 0) return 1;
+    return 0;
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * ANALYSIS CONTEXT
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -352,7 +412,11 @@ static void sema_expr(SemaCtx *ctx, ASTNode *node) {
 
         /* Resolve the callee */
         Symbol *sym = scope_lookup(ctx->scope, node->str_value);
-        if (!sym && d->opts->warn_undecl && !is_builtin(node->str_value)) {
+        if (!sym && is_interp_only(node->str_value)) {
+            sema_error(d, node->line,
+                       "'%s' is not supported in compiled programs "
+                       "(they cannot create futures)", node->str_value);
+        } else if (!sym && d->opts->warn_undecl && !is_builtin(node->str_value)) {
             sema_warn(d, node->line,
                       "call to undeclared function '%s'", node->str_value);
         }
@@ -397,6 +461,14 @@ static void sema_expr(SemaCtx *ctx, ASTNode *node) {
     /* Method call: obj.method(args) */
     case NODE_METHOD_CALL: {
         /* children[0] = object, children[1..n] = args */
+        ASTNode *recv = node->child_count > 0 ? node->children[0] : NULL;
+        if (recv && recv->type == NODE_IDENTIFIER && recv->str_value &&
+            strcmp(recv->str_value, "multiproc") == 0 &&
+            node->str_value && is_interp_only(node->str_value)) {
+            sema_error(d, node->line,
+                       "'multiproc.%s' is not supported in compiled programs "
+                       "(they cannot create futures)", node->str_value);
+        }
         for (size_t i = 0; i < node->child_count; i++)
             sema_expr(ctx, node->children[i]);
         break;
@@ -588,12 +660,14 @@ static void sema_stmt(SemaCtx *ctx, ASTNode *node) {
         break;
     }
 
-    /* ── function declaration ───────────────────────────────────────────── */
-    case NODE_FN_DECL: {
+    /* ── function / generator declaration ───────────────────────────────── */
+    case NODE_FN_DECL:
+    case NODE_GEN_DECL: {
         if (!node->str_value) break;
 
-        /* In nested scopes (not top level) we may not have hoisted yet */
-        if (ctx->scope->parent != NULL) {
+        /* In nested scopes (not top level) we may not have hoisted yet;
+         * generators are never hoisted (the name is bound where declared) */
+        if (ctx->scope->parent != NULL || node->type == NODE_GEN_DECL) {
             /* Only declare if not already present (top-level hoist may have
              * already registered it; nested fn declarations may shadow)      */
             int total  = (int)node->param_count;
@@ -730,8 +804,9 @@ static void sema_stmt(SemaCtx *ctx, ASTNode *node) {
         break;
     }
 
-    /* ── for-in ─────────────────────────────────────────────────────────── */
-    case NODE_FOR_IN: {
+    /* ── for-in / for-of ────────────────────────────────────────────────── */
+    case NODE_FOR_IN:
+    case NODE_FOR_OF: {
         /* str_value = loop variable name; children: [iterable, body] */
         ctx_push_scope(ctx);
         if (node->str_value)
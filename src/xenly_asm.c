@@ -0,0 +1,1632 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * xenly_asm.c — Xenly Built-in Assembler  (xlas)
+ *
+ * One pass over the text encodes every instruction into per-section byte
+ * buffers.  Each buffer is cut into fragments at the points whose size is
+ * not known yet — jumps to labels (2 or 5/6 bytes) and alignment padding —
+ * so relaxation only walks the fragment list, never the bytes.  Label
+ * references are recorded as fixups and patched (or turned into RELA
+ * entries) once the layout is final; the object is then written with a
+ * single fwrite.
+ *
+ *   line → labels / directive / instruction
+ *        → bytes + fixups in the current fragment
+ *   relax: grow out-of-range short branches until the layout is stable
+ *   emit:  flatten fragments, apply fixups, write ELF64 ET_REL
+ */
+
+#include "xenly_asm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <ctype.h>
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * ELF64 DEFINITIONS (the ET_REL subset)
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+#define ELFCLASS64     2
+#define ELFDATA2LSB    1
+#define ET_REL         1
+#define EM_X86_64      62
+#define SHT_PROGBITS   1
+#define SHT_SYMTAB     2
+#define SHT_STRTAB     3
+#define SHT_RELA       4
+#define SHT_NOBITS     8
+#define SHF_WRITE      0x1
+#define SHF_ALLOC      0x2
+#define SHF_EXECINSTR  0x4
+#define SHF_INFO_LINK  0x40
+#define STB_LOCAL      0
+#define STB_GLOBAL     1
+#define STT_NOTYPE     0
+#define STT_SECTION    3
+#define R_X86_64_64    1
+#define R_X86_64_PC32  2
+#define R_X86_64_PLT32 4
+#define R_X86_64_32    10
+#define R_X86_64_32S   11
+
+typedef struct {
+    unsigned char e_ident[16];
+    uint16_t e_type, e_machine;
+    uint32_t e_version;
+    uint64_t e_entry, e_phoff, e_shoff;
+    uint32_t e_flags;
+    uint16_t e_ehsize, e_phentsize, e_phnum, e_shentsize, e_shnum, e_shstrndx;
+} Elf64Ehdr;
+
+typedef struct {
+    uint32_t sh_name, sh_type;
+    uint64_t sh_flags, sh_addr, sh_offset, sh_size;
+    uint32_t sh_link, sh_info;
+    uint64_t sh_addralign, sh_entsize;
+} Elf64Shdr;
+
+typedef struct {
+    uint32_t st_name;
+    unsigned char st_info, st_other;
+    uint16_t st_shndx;
+    uint64_t st_value, st_size;
+} Elf64Sym;
+
+typedef struct {
+    uint64_t r_offset, r_info;
+    int64_t  r_addend;
+} Elf64Rela;
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * ASSEMBLER STATE
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct { unsigned char *p; size_t n, cap; } Buf;
+
+static void buf_put(Buf *b, const void *src, size_t n) {
+    if (b->n + n > b->cap) {
+        size_t cap = b->cap ? b->cap * 2 : 4096;
+        while (cap < b->n + n) cap *= 2;
+        b->p = realloc(b->p, cap);
+        b->cap = cap;
+    }
+    memcpy(b->p + b->n, src, n);
+    b->n += n;
+}
+static void buf_byte(Buf *b, unsigned v) { unsigned char c = (unsigned char)v; buf_put(b, &c, 1); }
+static void buf_zero(Buf *b, size_t n) {
+    static const unsigned char z[64];
+    while (n) { size_t k = n < sizeof(z) ? n : sizeof(z); buf_put(b, z, k); n -= k; }
+}
+
+enum { SEC_TEXT, SEC_RODATA, SEC_DATA, SEC_BSS, SEC_NOTE, SEC_COLD, SEC_COUNT };
+static const char *sec_names[SEC_COUNT] = {
+    ".text", ".rodata", ".data", ".bss", ".note.GNU-stack", ".text.unlikely"
+};
+
+/* What ends a fragment: nothing (the last one), a jump to a label whose
+ * size relaxation decides, or alignment padding.                        */
+enum { T_NONE, T_JMP, T_JCC, T_ALIGN };
+
+typedef struct {
+    size_t start, len;      /* raw bytes: data[start, start+len)          */
+    int    term;            /* T_*                                        */
+    int    cc;              /* T_JCC condition code                       */
+    int    sym;             /* T_JMP/T_JCC target                         */
+    int    align;           /* T_ALIGN boundary                           */
+    int    wide;            /* branch: rel32 form                         */
+    size_t addr, pad;       /* layout results                             */
+} Frag;
+
+/* Fixup kinds.  PC32/PLT32 carry the final addend (displacement minus the
+ * bytes that follow the field); DIFF32 is `a - b` of two labels.        */
+enum { FX_PC32, FX_PLT32, FX_ABS64, FX_ABS32, FX_ABS32S, FX_DIFF32, FX_DIFF64 };
+
+typedef struct {
+    int     frag;
+    size_t  off;            /* within the fragment's raw bytes            */
+    int     kind, sym, sym2;
+    int64_t addend;
+} Fixup;
+
+typedef struct {
+    Buf    data;
+    Frag  *frags;
+    int    nfrags, frag_cap;
+    Fixup *fix;
+    int    nfix, fix_cap;
+    int    align;
+    int    used;
+    size_t size;            /* after layout                               */
+    unsigned char *out;     /* flattened contents                         */
+    Elf64Rela *rela;
+    int    nrela, rela_cap;
+    int    shndx;           /* ELF section index                          */
+} Sec;
+
+typedef struct {
+    char    *name;
+    unsigned hash;
+    int      sec;           /* -1 while undefined                         */
+    int      frag;
+    size_t   off;
+    int      global;
+    int      referenced;
+    int      elf_index;
+} Sym;
+
+typedef struct {
+    Sec   sec[SEC_COUNT];
+    int   cur;
+    Sym  *syms;
+    int   nsyms, syms_cap;
+    int  *table;            /* open addressing: symbol index + 1          */
+    int   table_cap;
+    int   line;
+    char *err;
+    size_t errsz;
+    int   failed;
+} Asm;
+
+static int fail(Asm *A, int code, const char *fmt, ...) {
+    if (!A->failed && A->err && A->errsz) {
+        int n = snprintf(A->err, A->errsz, "line %d: ", A->line);
+        va_list ap;
+        va_start(ap, fmt);
+        if (n >= 0 && (size_t)n < A->errsz)
+            vsnprintf(A->err + n, A->errsz - (size_t)n, fmt, ap);
+        va_end(ap);
+    }
+    if (!A->failed) A->failed = code;
+    return code;
+}
+
+/* ── symbols ─────────────────────────────────────────────────────────────── */
+
+static unsigned sym_hash(const char *s, size_t n) {
+    unsigned h = 2166136261u;
+    for (size_t i = 0; i < n; i++) h = (h ^ (unsigned char)s[i]) * 16777619u;
+    return h;
+}
+
+static void sym_rehash(Asm *A) {
+    int cap = A->table_cap ? A->table_cap * 2 : 1024;
+    int *t = calloc((size_t)cap, sizeof(int));
+    for (int i = 0; i < A->nsyms; i++) {
+        unsigned k = A->syms[i].hash & (unsigned)(cap - 1);
+        while (t[k]) k = (k + 1) & (unsigned)(cap - 1);
+        t[k] = i + 1;
+    }
+    free(A->table);
+    A->table = t;
+    A->table_cap = cap;
+}
+
+static int sym_get(Asm *A, const char *name, size_t n) {
+    unsigned h = sym_hash(name, n);
+    if (A->table_cap) {
+        unsigned k = h & (unsigned)(A->table_cap - 1);
+        while (A->table[k]) {
+            Sym *s = &A->syms[A->table[k] - 1];
+            if (s->hash == h && strlen(s->name) == n && memcmp(s->name, name, n) == 0)
+                return A->table[k] - 1;
+            k = (k + 1) & (unsigned)(A->table_cap - 1);
+        }
+    }
+    if (A->nsyms == A->syms_cap) {
+        A->syms_cap = A->syms_cap ? A->syms_cap * 2 : 512;
+        A->syms = realloc(A->syms, sizeof(Sym) * (size_t)A->syms_cap);
+    }
+    Sym *s = &A->syms[A->nsyms];
+    memset(s, 0, sizeof(*s));
+    s->name = malloc(n + 1);
+    memcpy(s->name, name, n);
+    s->name[n] = '\0';
+    s->hash = h;
+    s->sec  = -1;
+    A->nsyms++;
+    if (A->nsyms * 2 > A->table_cap) sym_rehash(A);
+    else {
+        unsigned k = h & (unsigned)(A->table_cap - 1);
+        while (A->table[k]) k = (k + 1) & (unsigned)(A->table_cap - 1);
+        A->table[k] = A->nsyms;
+    }
+    return A->nsyms - 1;
+}
+
+static int sym_is_local_label(const Sym *s) { return s->name[0] == '.' && s->name[1] == 'L'; }
+
+/* ── fragments ───────────────────────────────────────────────────────────── */
+
+static Frag *cur_frag(Sec *S) { return &S->frags[S->nfrags - 1]; }
+
+static void frag_open(Sec *S) {
+    if (S->nfrags == S->frag_cap) {
+        S->frag_cap = S->frag_cap ? S->frag_cap * 2 : 256;
+        S->frags = realloc(S->frags, sizeof(Frag) * (size_t)S->frag_cap);
+    }
+    Frag *f = &S->frags[S->nfrags++];
+    memset(f, 0, sizeof(*f));
+    f->start = S->data.n;
+    f->sym = -1;
+}
+
+static Sec *sec_cur(Asm *A) {
+    Sec *S = &A->sec[A->cur];
+    if (!S->nfrags) frag_open(S);
+    S->used = 1;
+    return S;
+}
+
+/* Close the current fragment with terminator `term` and start a new one. */
+static Frag *frag_close(Sec *S, int term) {
+    Frag *f = cur_frag(S);
+    f->len  = S->data.n - f->start;
+    f->term = term;
+    frag_open(S);
+    return &S->frags[S->nfrags - 2];
+}
+
+static void add_fixup(Sec *S, size_t pos, int kind, int sym, int sym2, int64_t addend) {
+    if (S->nfix == S->fix_cap) {
+        S->fix_cap = S->fix_cap ? S->fix_cap * 2 : 256;
+        S->fix = realloc(S->fix, sizeof(Fixup) * (size_t)S->fix_cap);
+    }
+    Fixup *x = &S->fix[S->nfix++];
+    x->frag   = S->nfrags - 1;
+    x->off    = pos - cur_frag(S)->start;
+    x->kind   = kind;
+    x->sym    = sym;
+    x->sym2   = sym2;
+    x->addend = addend;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * LEXING: expressions and operands
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct {
+    int     sym;            /* -1: none                                    */
+    int     sym2;           /* subtracted symbol, -1: none                 */
+    int64_t c;
+} Expr;
+
+static const char *skip_ws(const char *s) { while (*s == ' ' || *s == '\t') s++; return s; }
+static int is_sym_start(int c) { return isalpha(c) || c == '_' || c == '.' || c == '$' || c >= 0x80; }
+static int is_sym_char(int c)  { return isalnum(c) || c == '_' || c == '.' || c == '$' || c == '@' || c >= 0x80; }
+
+/* sym [+|- const]... | const | sym - sym.  Returns the end or NULL. */
+static const char *parse_expr(Asm *A, const char *s, Expr *e) {
+    e->sym = e->sym2 = -1;
+    e->c = 0;
+    int sign = 1, any = 0;
+    for (;;) {
+        s = skip_ws(s);
+        if (*s == '-') { sign = -sign; s++; continue; }
+        if (*s == '+') { s++; continue; }
+        if (isdigit((unsigned char)*s)) {
+            char *end;
+            uint64_t v = strtoull(s, &end, 0);
+            e->c += sign * (int64_t)v;
+            s = end;
+        } else if (is_sym_start((unsigned char)*s) && *s != '$') {
+            const char *b = s;
+            while (is_sym_char((unsigned char)*s)) s++;
+            int id = sym_get(A, b, (size_t)(s - b));
+            A->syms[id].referenced = 1;
+            if (sign > 0 && e->sym < 0)       e->sym = id;
+            else if (sign < 0 && e->sym2 < 0) e->sym2 = id;
+            else return NULL;
+        } else {
+            return any ? s : NULL;
+        }
+        any = 1;
+        s = skip_ws(s);
+        if (*s == '+')      { sign = 1;  s++; }
+        else if (*s == '-') { sign = -1; s++; }
+        else return s;
+    }
+}
+
+enum { OP_REG, OP_XMM, OP_IMM, OP_MEM, OP_EXPR };
+#define REG_RIP 16
+
+typedef struct {
+    int  kind;
+    int  indirect;          /* '*' prefix (call/jmp)                       */
+    int  reg, size;         /* OP_REG/OP_XMM: number, width in bytes       */
+    int  rex8;              /* spl/bpl/sil/dil: needs a REX prefix         */
+    int  base, index, scale;
+    Expr ex;                /* IMM value, MEM displacement, EXPR target    */
+} Operand;
+
+static const char *reg64[16] = { "rax","rcx","rdx","rbx","rsp","rbp","rsi","rdi",
+                                 "r8","r9","r10","r11","r12","r13","r14","r15" };
+static const char *reg32[16] = { "eax","ecx","edx","ebx","esp","ebp","esi","edi",
+                                 "r8d","r9d","r10d","r11d","r12d","r13d","r14d","r15d" };
+static const char *reg16[16] = { "ax","cx","dx","bx","sp","bp","si","di",
+                                 "r8w","r9w","r10w","r11w","r12w","r13w","r14w","r15w" };
+static const char *reg8[16]  = { "al","cl","dl","bl","spl","bpl","sil","dil",
+                                 "r8b","r9b","r10b","r11b","r12b","r13b","r14b","r15b" };
+
+/* %name → op (REG/XMM).  Returns the end or NULL. */
+static const char *parse_reg(const char *s, Operand *o) {
+    if (*s != '%') return NULL;
+    s++;
+    const char *b = s;
+    while (isalnum((unsigned char)*s)) s++;
+    size_t n = (size_t)(s - b);
+    char name[8];
+    if (n == 0 || n >= sizeof(name)) return NULL;
+    memcpy(name, b, n);
+    name[n] = '\0';
+    o->rex8 = 0;
+    for (int r = 0; r < 16; r++) {
+        if (!strcmp(name, reg64[r])) { o->kind = OP_REG; o->reg = r; o->size = 8; return s; }
+        if (!strcmp(name, reg32[r])) { o->kind = OP_REG; o->reg = r; o->size = 4; return s; }
+        if (!strcmp(name, reg16[r])) { o->kind = OP_REG; o->reg = r; o->size = 2; return s; }
+        if (!strcmp(name, reg8[r]))  {
+            o->kind = OP_REG; o->reg = r; o->size = 1; o->rex8 = (r >= 4 && r < 8);
+            return s;
+        }
+    }
+    if (!strcmp(name, "rip")) { o->kind = OP_REG; o->reg = REG_RIP; o->size = 8; return s; }
+    if (!strncmp(name, "xmm", 3) && isdigit((unsigned char)name[3])) {
+        int r = atoi(name + 3);
+        if (r < 16) { o->kind = OP_XMM; o->reg = r; o->size = 16; return s; }
+    }
+    return NULL;
+}
+
+static int parse_operand(Asm *A, const char *s, Operand *o) {
+    memset(o, 0, sizeof(*o));
+    o->base = o->index = -1;
+    o->ex.sym = o->ex.sym2 = -1;
+    s = skip_ws(s);
+    if (*s == '*') { o->indirect = 1; s = skip_ws(s + 1); }
+    if (*s == '%') {
+        s = parse_reg(s, o);
+        if (!s || o->reg == REG_RIP) return -1;
+        return *skip_ws(s) ? -1 : 0;
+    }
+    if (*s == '$') {
+        o->kind = OP_IMM;
+        s = parse_expr(A, s + 1, &o->ex);
+        return (!s || *skip_ws(s)) ? -1 : 0;
+    }
+    if (*s != '(') {
+        s = parse_expr(A, s, &o->ex);
+        if (!s) return -1;
+        s = skip_ws(s);
+        if (!*s) { o->kind = o->indirect ? OP_MEM : OP_EXPR; return 0; }
+        if (*s != '(') return -1;
+    }
+    /* (base[,index[,scale]]) */
+    o->kind = OP_MEM;
+    s = skip_ws(s + 1);
+    Operand r;
+    if (*s == '%') {
+        s = parse_reg(s, &r);
+        if (!s || r.kind != OP_REG || r.size != 8) return -1;
+        o->base = r.reg;
+        s = skip_ws(s);
+    }
+    if (*s == ',') {
+        s = skip_ws(s + 1);
+        s = parse_reg(s, &r);
+        if (!s || r.kind != OP_REG || r.size != 8 || r.reg == 4 || r.reg == REG_RIP) return -1;
+        o->index = r.reg;
+        o->scale = 1;
+        s = skip_ws(s);
+        if (*s == ',') {
+            s = skip_ws(s + 1);
+            o->scale = (int)strtol(s, (char **)&s, 10);
+            if (o->scale != 1 && o->scale != 2 && o->scale != 4 && o->scale != 8) return -1;
+            s = skip_ws(s);
+        }
+    }
+    if (*s != ')') return -1;
+    if (o->base == REG_RIP && o->index >= 0) return -1;
+    return *skip_ws(s + 1) ? -1 : 0;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * ENCODING
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+typedef struct {
+    unsigned char b[24];
+    int  n;
+    int  fix_pos, fix_kind;     /* at most one symbolic field per instr */
+    Expr fix_ex;
+} Ins;
+
+static void ins_byte(Ins *I, unsigned v) { I->b[I->n++] = (unsigned char)v; }
+static void ins_le(Ins *I, int64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) ins_byte(I, (unsigned)((uint64_t)v >> (8 * i)) & 0xFF);
+}
+
+static int fits8(int64_t v)  { return v >= -128 && v <= 127; }
+static int fits32(int64_t v) { return v >= INT32_MIN && v <= INT32_MAX; }
+
+/*
+ * The general form: [pfx] [REX] opcode... ModRM [SIB] [disp] [imm].
+ *   reg   ModRM.reg value (register number or /digit), 0-15
+ *   rm    OP_REG / OP_XMM / OP_MEM operand for ModRM.rm
+ *   force a REX byte even when no bit is set (spl/bpl/sil/dil)
+ */
+static int encode(Asm *A, Ins *I, int pfx, int w, const unsigned char *op, int nop,
+                  int reg, const Operand *rm, int force, int imm_bytes, int64_t imm) {
+    int rex = 0x40 | (w ? 8 : 0) | (reg >= 8 ? 4 : 0);
+    if (rm->kind == OP_MEM) {
+        if (rm->index >= 8) rex |= 2;
+        if (rm->base >= 0 && rm->base != REG_RIP && rm->base >= 8) rex |= 1;
+    } else if (rm->reg >= 8) {
+        rex |= 1;
+    }
+    if (rm->kind == OP_REG && rm->rex8) force = 1;
+    I->n = 0;
+    I->fix_pos = -1;
+    if (pfx) ins_byte(I, (unsigned)pfx);
+    if (rex != 0x40 || force) ins_byte(I, (unsigned)rex);
+    for (int i = 0; i < nop; i++) ins_byte(I, op[i]);
+
+    int r = (reg & 7) << 3;
+    if (rm->kind != OP_MEM) {
+        ins_byte(I, 0xC0 | (unsigned)r | (unsigned)(rm->reg & 7));
+    } else if (rm->base == REG_RIP) {
+        ins_byte(I, 0x05 | (unsigned)r);
+        if (rm->ex.sym >= 0) {
+            if (rm->ex.sym2 >= 0) return fail(A, XLAS_ERR_SYMBOL, "symbol difference in operand");
+            I->fix_pos = I->n; I->fix_kind = FX_PC32; I->fix_ex = rm->ex;
+            ins_le(I, 0, 4);
+        } else {
+            ins_le(I, rm->ex.c, 4);
+        }
+    } else {
+        int sym = rm->ex.sym >= 0;
+        if (rm->ex.sym2 >= 0) return fail(A, XLAS_ERR_SYMBOL, "symbol difference in operand");
+        if (!sym && !fits32(rm->ex.c)) return fail(A, XLAS_ERR_SYNTAX, "displacement out of range");
+        if (rm->base < 0) {                                  /* disp32 only */
+            ins_byte(I, 0x04 | (unsigned)r);
+            ins_byte(I, (unsigned)((rm->index >= 0 ? (__builtin_ctz((unsigned)rm->scale) << 6) |
+                                    ((rm->index & 7) << 3) : 0x20) | 5));
+        } else {
+            int mod = sym ? 2 : (rm->ex.c == 0 && (rm->base & 7) != 5) ? 0 : fits8(rm->ex.c) ? 1 : 2;
+            if (rm->index >= 0 || (rm->base & 7) == 4) {
+                ins_byte(I, (unsigned)(mod << 6) | (unsigned)r | 4);
+                int idx = rm->index >= 0 ? (rm->index & 7) : 4;
+                int sc  = rm->index >= 0 ? __builtin_ctz((unsigned)rm->scale) : 0;
+                ins_byte(I, (unsigned)((sc << 6) | (idx << 3) | (rm->base & 7)));
+            } else {
+                ins_byte(I, (unsigned)(mod << 6) | (unsigned)r | (unsigned)(rm->base & 7));
+            }
+            if (mod == 1) { ins_le(I, rm->ex.c, 1); goto imm; }
+            if (mod == 0) goto imm;
+        }
+        if (sym) { I->fix_pos = I->n; I->fix_kind = FX_ABS32S; I->fix_ex = rm->ex; ins_le(I, 0, 4); }
+        else     ins_le(I, rm->ex.c, 4);
+    }
+imm:
+    if (imm_bytes) ins_le(I, imm, imm_bytes);
+    return 0;
+}
+
+/* Append the encoded instruction to the current section, turning its
+ * symbolic field into a fixup.                                         */
+static void commit(Asm *A, Ins *I) {
+    Sec *S = sec_cur(A);
+    size_t at = S->data.n;
+    buf_put(&S->data, I->b, (size_t)I->n);
+    if (I->fix_pos >= 0) {
+        int64_t a = I->fix_ex.c;
+        if (I->fix_kind == FX_PC32 || I->fix_kind == FX_PLT32)
+            a -= I->n - I->fix_pos;                 /* relative to the field */
+        add_fixup(S, at + (size_t)I->fix_pos, I->fix_kind, I->fix_ex.sym, -1, a);
+    }
+}
+
+static int simple(Asm *A, const unsigned char *b, int n) {
+    Ins I;
+    memcpy(I.b, b, (size_t)n);
+    I.n = n;
+    I.fix_pos = -1;
+    commit(A, &I);
+    return 0;
+}
+
+/* ── mnemonic helpers ───────────────────────────────────────────────────── */
+
+static const char *cc_names[16][3] = {
+    {"o"},{"no"},{"b","c","nae"},{"ae","nb","nc"},{"e","z"},{"ne","nz"},
+    {"be","na"},{"a","nbe"},{"s"},{"ns"},{"p","pe"},{"np","po"},
+    {"l","nge"},{"ge","nl"},{"le","ng"},{"g","nle"}
+};
+
+static int cond_code(const char *s) {
+    for (int c = 0; c < 16; c++)
+        for (int k = 0; k < 3 && cc_names[c][k]; k++)
+            if (!strcmp(s, cc_names[c][k])) return c;
+    return -1;
+}
+
+/* `base` + optional size suffix.  Returns the width (0 = none given), or
+ * -1 when `mn` is not `base` with a suffix.                            */
+static int suffix(const char *mn, const char *base) {
+    size_t n = strlen(base);
+    if (strncmp(mn, base, n) != 0) return -1;
+    switch (mn[n]) {
+    case '\0': return 0;
+    case 'b':  return mn[n + 1] ? -1 : 1;
+    case 'w':  return mn[n + 1] ? -1 : 2;
+    case 'l':  return mn[n + 1] ? -1 : 4;
+    case 'q':  return mn[n + 1] ? -1 : 8;
+    default:   return -1;
+    }
+}
+
+static int op_size(int sz, const Operand *o, int n) {
+    if (sz) return sz;
+    for (int i = 0; i < n; i++)
+        if (o[i].kind == OP_REG) return o[i].size;
+    return 0;
+}
+
+static int is_rm(const Operand *o) { return o->kind == OP_REG || o->kind == OP_MEM; }
+
+/* Integer op with the usual r/m, reg / reg, r/m / imm, r/m forms. */
+static int enc_alu(Asm *A, int grp, int sz, Operand *o, int n) {
+    Ins I;
+    if (n != 2) return fail(A, XLAS_ERR_SYNTAX, "expected two operands");
+    sz = op_size(sz, o, 2);
+    if (!sz || !is_rm(&o[1])) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    int pfx = sz == 2 ? 0x66 : 0, w = sz == 8;
+    int force = o[0].kind == OP_REG && o[0].rex8;
+    unsigned char op;
+    if (o[0].kind == OP_IMM) {
+        if (o[0].ex.sym >= 0) return fail(A, XLAS_ERR_SYNTAX, "symbolic immediate");
+        int64_t v = o[0].ex.c;
+        if (sz == 1)       { op = 0x80; if (encode(A, &I, pfx, w, &op, 1, grp, &o[1], force, 1, v)) return -1; }
+        else if (fits8(v)) { op = 0x83; if (encode(A, &I, pfx, w, &op, 1, grp, &o[1], force, 1, v)) return -1; }
+        else {
+            if (!fits32(v) && !(sz == 4 && v >= 0 && v <= UINT32_MAX))
+                return fail(A, XLAS_ERR_SYNTAX, "immediate out of range");
+            op = 0x81;
+            if (encode(A, &I, pfx, w, &op, 1, grp, &o[1], force, sz == 2 ? 2 : 4, v)) return -1;
+        }
+    } else if (o[0].kind == OP_REG) {
+        op = (unsigned char)((grp << 3) | (sz == 1 ? 0 : 1));
+        if (encode(A, &I, pfx, w, &op, 1, o[0].reg, &o[1], force, 0, 0)) return -1;
+    } else if (o[0].kind == OP_MEM && o[1].kind == OP_REG) {
+        op = (unsigned char)((grp << 3) | (sz == 1 ? 2 : 3));
+        if (encode(A, &I, pfx, w, &op, 1, o[1].reg, &o[0], o[1].rex8, 0, 0)) return -1;
+    } else {
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    }
+    commit(A, &I);
+    return 0;
+}
+
+static int enc_mov(Asm *A, int sz, Operand *o, int n) {
+    Ins I;
+    unsigned char op;
+    if (n != 2) return fail(A, XLAS_ERR_SYNTAX, "expected two operands");
+    sz = op_size(sz, o, 2);
+    if (!sz || !is_rm(&o[1])) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    int pfx = sz == 2 ? 0x66 : 0, w = sz == 8;
+    if (o[0].kind == OP_IMM) {
+        if (o[0].ex.sym >= 0) return fail(A, XLAS_ERR_SYNTAX, "symbolic immediate");
+        int64_t v = o[0].ex.c;
+        if (o[1].kind == OP_REG && sz != 8) {               /* B0+r / B8+r */
+            Operand none = { .kind = OP_REG, .reg = 0 };
+            int rex = 0x40 | (o[1].reg >= 8 ? 1 : 0);
+            I.n = 0; I.fix_pos = -1;
+            if (pfx) ins_byte(&I, (unsigned)pfx);
+            if (rex != 0x40 || o[1].rex8) ins_byte(&I, (unsigned)rex);
+            ins_byte(&I, (unsigned)((sz == 1 ? 0xB0 : 0xB8) + (o[1].reg & 7)));
+            ins_le(&I, v, sz);
+            (void)none;
+            commit(A, &I);
+            return 0;
+        }
+        if (sz == 8 && !fits32(v)) return fail(A, XLAS_ERR_SYNTAX, "immediate out of range");
+        op = sz == 1 ? 0xC6 : 0xC7;
+        if (encode(A, &I, pfx, w, &op, 1, 0, &o[1], 0, sz == 1 ? 1 : sz == 2 ? 2 : 4, v)) return -1;
+    } else if (o[0].kind == OP_REG) {
+        op = sz == 1 ? 0x88 : 0x89;
+        if (encode(A, &I, pfx, w, &op, 1, o[0].reg, &o[1], o[0].rex8, 0, 0)) return -1;
+    } else if (o[0].kind == OP_MEM && o[1].kind == OP_REG) {
+        op = sz == 1 ? 0x8A : 0x8B;
+        if (encode(A, &I, pfx, w, &op, 1, o[1].reg, &o[0], o[1].rex8, 0, 0)) return -1;
+    } else {
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    }
+    commit(A, &I);
+    return 0;
+}
+
+/* Two-operand reg ← r/m form with a multi-byte opcode (lea, movzx, ...). */
+static int enc_rrm(Asm *A, int pfx, int w, const unsigned char *op, int nop,
+                   Operand *src, Operand *dst) {
+    Ins I;
+    if ((dst->kind != OP_REG && dst->kind != OP_XMM) || !(is_rm(src) || src->kind == OP_XMM))
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    if (encode(A, &I, pfx, w, op, nop, dst->reg, src, dst->kind == OP_REG && dst->rex8, 0, 0))
+        return -1;
+    commit(A, &I);
+    return 0;
+}
+
+/* F7/FF-style group op with a /digit and one r/m operand. */
+static int enc_group(Asm *A, unsigned char op8, unsigned char op, int digit, int sz,
+                     Operand *o, int n) {
+    Ins I;
+    if (n != 1 || !is_rm(&o[0])) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    sz = op_size(sz, o, 1);
+    if (!sz) return fail(A, XLAS_ERR_SYNTAX, "operand size unknown");
+    unsigned char b = sz == 1 ? op8 : op;
+    if (encode(A, &I, sz == 2 ? 0x66 : 0, sz == 8, &b, 1, digit, &o[0], 0, 0, 0)) return -1;
+    commit(A, &I);
+    return 0;
+}
+
+static int enc_shift(Asm *A, int digit, int sz, Operand *o, int n) {
+    Ins I;
+    Operand *dst = &o[n - 1];
+    sz = op_size(sz, dst, 1);
+    if (!sz || !is_rm(dst)) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    int pfx = sz == 2 ? 0x66 : 0, w = sz == 8;
+    unsigned char op;
+    if (n == 1 || (o[0].kind == OP_IMM && o[0].ex.sym < 0 && o[0].ex.c == 1)) {
+        op = sz == 1 ? 0xD0 : 0xD1;
+        if (encode(A, &I, pfx, w, &op, 1, digit, dst, 0, 0, 0)) return -1;
+    } else if (o[0].kind == OP_IMM && o[0].ex.sym < 0) {
+        op = sz == 1 ? 0xC0 : 0xC1;
+        if (encode(A, &I, pfx, w, &op, 1, digit, dst, 0, 1, o[0].ex.c)) return -1;
+    } else if (o[0].kind == OP_REG && o[0].reg == 1 && o[0].size == 1) {
+        op = sz == 1 ? 0xD2 : 0xD3;
+        if (encode(A, &I, pfx, w, &op, 1, digit, dst, 0, 0, 0)) return -1;
+    } else {
+        return fail(A, XLAS_ERR_SYNTAX, "bad shift count");
+    }
+    commit(A, &I);
+    return 0;
+}
+
+/* movq/movd between xmm registers, general registers and memory. */
+static int enc_movq_xmm(Asm *A, int w, Operand *o) {
+    Ins I;
+    unsigned char op[2] = { 0x0F, 0 };
+    if (o[1].kind == OP_XMM && (o[0].kind == OP_XMM || (o[0].kind == OP_MEM && w))) {
+        op[1] = 0x7E;                                       /* F3 0F 7E  */
+        if (encode(A, &I, 0xF3, 0, op, 2, o[1].reg, &o[0], 0, 0, 0)) return -1;
+    } else if (o[1].kind == OP_XMM && is_rm(&o[0])) {
+        op[1] = 0x6E;                                       /* 66 0F 6E  */
+        if (encode(A, &I, 0x66, w, op, 2, o[1].reg, &o[0], 0, 0, 0)) return -1;
+    } else if (o[0].kind == OP_XMM && o[1].kind == OP_MEM && w) {
+        op[1] = 0xD6;                                       /* 66 0F D6  */
+        if (encode(A, &I, 0x66, 0, op, 2, o[0].reg, &o[1], 0, 0, 0)) return -1;
+    } else if (o[0].kind == OP_XMM && is_rm(&o[1])) {
+        op[1] = 0x7E;                                       /* 66 0F 7E  */
+        if (encode(A, &I, 0x66, w, op, 2, o[0].reg, &o[1], 0, 0, 0)) return -1;
+    } else {
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    }
+    commit(A, &I);
+    return 0;
+}
+
+/* Scalar / packed SSE2 op: pfx 0F op, xmm ← xmm/m. */
+static int enc_sse(Asm *A, int pfx, unsigned char opc, Operand *o, int n) {
+    unsigned char op[2] = { 0x0F, opc };
+    if (n != 2 || o[1].kind != OP_XMM || (o[0].kind != OP_XMM && o[0].kind != OP_MEM))
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    return enc_rrm(A, pfx, 0, op, 2, &o[0], &o[1]);
+}
+
+/* call / jmp / jcc to a label, or indirect through *r/m. */
+static int enc_branch(Asm *A, int kind, int cc, Operand *o, int n) {
+    if (n != 1) return fail(A, XLAS_ERR_SYNTAX, "expected one operand");
+    if (o[0].indirect) {
+        Ins I;
+        unsigned char op = 0xFF;
+        if (kind == T_JCC) return fail(A, XLAS_ERR_SYNTAX, "indirect conditional jump");
+        if (o[0].kind == OP_REG && o[0].size != 8) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        if (encode(A, &I, 0, 0, &op, 1, kind == T_JMP ? 4 : 2, &o[0], 0, 0, 0)) return -1;
+        commit(A, &I);
+        return 0;
+    }
+    if (o[0].kind != OP_EXPR || o[0].ex.sym < 0 || o[0].ex.sym2 >= 0)
+        return fail(A, XLAS_ERR_SYNTAX, "bad branch target");
+    Sec *S = sec_cur(A);
+    if (kind == T_NONE) {                                   /* call rel32 */
+        Ins I;
+        I.n = 0;
+        ins_byte(&I, 0xE8);
+        I.fix_pos = I.n; I.fix_kind = FX_PLT32; I.fix_ex = o[0].ex;
+        ins_le(&I, 0, 4);
+        commit(A, &I);
+        return 0;
+    }
+    if (o[0].ex.c) return fail(A, XLAS_ERR_SYNTAX, "offset branch target");
+    Frag *f = frag_close(S, kind);
+    f->cc  = cc;
+    f->sym = o[0].ex.sym;
+    return 0;
+}
+
+/* Split "op a, b(c,d), e" at top-level commas. */
+static int split_operands(char *s, char **out, int max) {
+    int n = 0, depth = 0, quote = 0;
+    s = (char *)skip_ws(s);
+    if (!*s) return 0;
+    out[n++] = s;
+    for (; *s; s++) {
+        if (*s == '"') quote = !quote;
+        if (quote) continue;
+        if (*s == '(') depth++;
+        else if (*s == ')') depth--;
+        else if (*s == ',' && depth == 0) {
+            if (n == max) return -1;
+            *s = '\0';
+            out[n++] = s + 1;
+        }
+    }
+    for (int i = 0; i < n; i++) {                           /* trim right */
+        char *e = out[i] + strlen(out[i]);
+        while (e > out[i] && (e[-1] == ' ' || e[-1] == '\t')) *--e = '\0';
+    }
+    return n;
+}
+
+static int instruction(Asm *A, const char *mn, char *args) {
+    char *txt[4];
+    Operand o[3];
+    int n = split_operands(args, txt, 3), sz, c;
+    if (n < 0) return fail(A, XLAS_ERR_SYNTAX, "too many operands");
+    for (int i = 0; i < n; i++)
+        if (parse_operand(A, txt[i], &o[i]))
+            return fail(A, XLAS_ERR_SYNTAX, "bad operand '%s'", txt[i]);
+
+    /* no operands */
+    static const struct { const char *mn; unsigned char b[4]; int n; } bare[] = {
+        {"ret",{0xC3},1}, {"retq",{0xC3},1}, {"leave",{0xC9},1}, {"leaveq",{0xC9},1},
+        {"ud2",{0x0F,0x0B},2}, {"nop",{0x90},1}, {"int3",{0xCC},1}, {"hlt",{0xF4},1},
+        {"cqto",{0x48,0x99},2}, {"cqo",{0x48,0x99},2}, {"cltq",{0x48,0x98},2},
+        {"cdqe",{0x48,0x98},2}, {"cltd",{0x99},1}, {"cdq",{0x99},1},
+        {"syscall",{0x0F,0x05},2}, {"endbr64",{0xF3,0x0F,0x1E,0xFA},4},
+    };
+    for (size_t i = 0; i < sizeof(bare) / sizeof(bare[0]); i++)
+        if (!strcmp(mn, bare[i].mn)) {
+            if (n) return fail(A, XLAS_ERR_SYNTAX, "'%s' takes no operands", mn);
+            return simple(A, bare[i].b, bare[i].n);
+        }
+
+    /* integer ALU */
+    static const char *alu[8] = { "add","or","adc","sbb","and","sub","xor","cmp" };
+    for (int g = 0; g < 8; g++)
+        if ((sz = suffix(mn, alu[g])) >= 0) return enc_alu(A, g, sz, o, n);
+
+    if ((sz = suffix(mn, "mov")) >= 0) {
+        if (n == 2 && (o[0].kind == OP_XMM || o[1].kind == OP_XMM))
+            return sz == 8 ? enc_movq_xmm(A, 1, o) : fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        return enc_mov(A, sz, o, n);
+    }
+    if (!strcmp(mn, "movd")) {
+        if (n != 2) return fail(A, XLAS_ERR_SYNTAX, "expected two operands");
+        return enc_movq_xmm(A, 0, o);
+    }
+    if (!strcmp(mn, "movabsq") || !strcmp(mn, "movabs")) {
+        if (n != 2 || o[0].kind != OP_IMM || o[0].ex.sym >= 0 || o[1].kind != OP_REG || o[1].size != 8)
+            return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        Ins I;
+        I.n = 0; I.fix_pos = -1;
+        ins_byte(&I, 0x48 | (o[1].reg >= 8 ? 1u : 0u));
+        ins_byte(&I, 0xB8u + (unsigned)(o[1].reg & 7));
+        ins_le(&I, o[0].ex.c, 8);
+        commit(A, &I);
+        return 0;
+    }
+    if ((sz = suffix(mn, "lea")) >= 0) {
+        unsigned char op = 0x8D;
+        if (n != 2 || o[0].kind != OP_MEM) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        sz = op_size(sz, &o[1], 1);
+        return enc_rrm(A, sz == 2 ? 0x66 : 0, sz == 8, &op, 1, &o[0], &o[1]);
+    }
+    if ((sz = suffix(mn, "test")) >= 0) {
+        Ins I;
+        unsigned char op;
+        if (n != 2 || !is_rm(&o[1])) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        sz = op_size(sz, o, 2);
+        int pfx = sz == 2 ? 0x66 : 0;
+        if (o[0].kind == OP_IMM && o[0].ex.sym < 0) {
+            op = sz == 1 ? 0xF6 : 0xF7;
+            if (encode(A, &I, pfx, sz == 8, &op, 1, 0, &o[1], 0, sz == 1 ? 1 : sz == 2 ? 2 : 4, o[0].ex.c))
+                return -1;
+        } else if (o[0].kind == OP_REG) {
+            op = sz == 1 ? 0x84 : 0x85;
+            if (encode(A, &I, pfx, sz == 8, &op, 1, o[0].reg, &o[1], o[0].rex8, 0, 0)) return -1;
+        } else {
+            return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        }
+        commit(A, &I);
+        return 0;
+    }
+    if (!strcmp(mn, "push") || !strcmp(mn, "pushq") || !strcmp(mn, "pop") || !strcmp(mn, "popq")) {
+        int push = mn[1] == 'u';
+        if (n != 1) return fail(A, XLAS_ERR_SYNTAX, "expected one operand");
+        if (o[0].kind == OP_REG && o[0].size == 8) {
+            unsigned char b[2];
+            int k = 0;
+            if (o[0].reg >= 8) b[k++] = 0x41;
+            b[k++] = (unsigned char)((push ? 0x50 : 0x58) + (o[0].reg & 7));
+            return simple(A, b, k);
+        }
+        if (push && o[0].kind == OP_IMM && o[0].ex.sym < 0 && fits32(o[0].ex.c)) {
+            Ins I;
+            I.n = 0; I.fix_pos = -1;
+            if (fits8(o[0].ex.c)) { ins_byte(&I, 0x6A); ins_le(&I, o[0].ex.c, 1); }
+            else                  { ins_byte(&I, 0x68); ins_le(&I, o[0].ex.c, 4); }
+            commit(A, &I);
+            return 0;
+        }
+        if (o[0].kind == OP_MEM) {
+            Ins I;
+            unsigned char op = push ? 0xFF : 0x8F;
+            if (encode(A, &I, 0, 0, &op, 1, push ? 6 : 0, &o[0], 0, 0, 0)) return -1;
+            commit(A, &I);
+            return 0;
+        }
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    }
+
+    /* control flow */
+    if (!strcmp(mn, "call") || !strcmp(mn, "callq")) return enc_branch(A, T_NONE, 0, o, n);
+    if (!strcmp(mn, "jmp")  || !strcmp(mn, "jmpq"))  return enc_branch(A, T_JMP, 0, o, n);
+    if (mn[0] == 'j' && (c = cond_code(mn + 1)) >= 0) return enc_branch(A, T_JCC, c, o, n);
+    if (!strncmp(mn, "set", 3) && (c = cond_code(mn + 3)) >= 0) {
+        Ins I;
+        unsigned char op[2] = { 0x0F, (unsigned char)(0x90 + c) };
+        if (n != 1 || !is_rm(&o[0]) || (o[0].kind == OP_REG && o[0].size != 1))
+            return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        if (encode(A, &I, 0, 0, op, 2, 0, &o[0], 0, 0, 0)) return -1;
+        commit(A, &I);
+        return 0;
+    }
+    if (!strncmp(mn, "cmov", 4)) {
+        char cc[8];
+        size_t l = strlen(mn + 4);
+        if (l == 0 || l >= sizeof(cc)) return fail(A, XLAS_ERR_SYNTAX, "unknown instruction '%s'", mn);
+        memcpy(cc, mn + 4, l + 1);
+        sz = 0;
+        if ((c = cond_code(cc)) < 0 && l > 1) {
+            char s = cc[l - 1];
+            cc[l - 1] = '\0';
+            sz = s == 'q' ? 8 : s == 'l' ? 4 : s == 'w' ? 2 : 0;
+            if (sz) c = cond_code(cc);
+        }
+        if (c >= 0 && n == 2) {
+            unsigned char op[2] = { 0x0F, (unsigned char)(0x40 + c) };
+            sz = op_size(sz, &o[1], 1);
+            return enc_rrm(A, sz == 2 ? 0x66 : 0, sz == 8, op, 2, &o[0], &o[1]);
+        }
+    }
+
+    /* widening moves: movzbl %al, %eax ... movslq */
+    static const struct { const char *mn; unsigned char op; int w; } ext[] = {
+        {"movzbl",0xB6,0}, {"movzbq",0xB6,1}, {"movzbw",0xB6,0}, {"movzwl",0xB7,0},
+        {"movzwq",0xB7,1}, {"movsbl",0xBE,0}, {"movsbq",0xBE,1}, {"movswl",0xBF,0},
+        {"movswq",0xBF,1},
+    };
+    for (size_t i = 0; i < sizeof(ext) / sizeof(ext[0]); i++)
+        if (!strcmp(mn, ext[i].mn)) {
+            unsigned char op[2] = { 0x0F, ext[i].op };
+            if (n != 2) return fail(A, XLAS_ERR_SYNTAX, "expected two operands");
+            return enc_rrm(A, mn[5] == 'w' ? 0x66 : 0, ext[i].w, op, 2, &o[0], &o[1]);
+        }
+    if (!strcmp(mn, "movslq")) {
+        unsigned char op = 0x63;
+        if (n != 2) return fail(A, XLAS_ERR_SYNTAX, "expected two operands");
+        return enc_rrm(A, 0, 1, &op, 1, &o[0], &o[1]);
+    }
+
+    /* one-operand groups */
+    static const struct { const char *mn; unsigned char op8, op; int digit; } grp[] = {
+        {"not",0xF6,0xF7,2}, {"neg",0xF6,0xF7,3}, {"mul",0xF6,0xF7,4},
+        {"div",0xF6,0xF7,6}, {"idiv",0xF6,0xF7,7}, {"inc",0xFE,0xFF,0}, {"dec",0xFE,0xFF,1},
+    };
+    for (size_t i = 0; i < sizeof(grp) / sizeof(grp[0]); i++)
+        if ((sz = suffix(mn, grp[i].mn)) >= 0)
+            return enc_group(A, grp[i].op8, grp[i].op, grp[i].digit, sz, o, n);
+    if ((sz = suffix(mn, "imul")) >= 0) {
+        if (n == 1) return enc_group(A, 0xF6, 0xF7, 5, sz, o, n);
+        if (n == 2) {
+            unsigned char op[2] = { 0x0F, 0xAF };
+            sz = op_size(sz, &o[1], 1);
+            return enc_rrm(A, sz == 2 ? 0x66 : 0, sz == 8, op, 2, &o[0], &o[1]);
+        }
+        if (n == 3 && o[0].kind == OP_IMM && o[0].ex.sym < 0 && o[2].kind == OP_REG) {
+            Ins I;
+            int8_t small = fits8(o[0].ex.c);
+            unsigned char op = small ? 0x6B : 0x69;
+            sz = op_size(sz, &o[2], 1);
+            if (encode(A, &I, sz == 2 ? 0x66 : 0, sz == 8, &op, 1, o[2].reg, &o[1], 0,
+                       small ? 1 : sz == 2 ? 2 : 4, o[0].ex.c))
+                return -1;
+            commit(A, &I);
+            return 0;
+        }
+        return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+    }
+    static const struct { const char *mn; int digit; } shf[] = {
+        {"rol",0}, {"ror",1}, {"shl",4}, {"sal",4}, {"shr",5}, {"sar",7},
+    };
+    for (size_t i = 0; i < sizeof(shf) / sizeof(shf[0]); i++)
+        if ((sz = suffix(mn, shf[i].mn)) >= 0 && (n == 1 || n == 2))
+            return enc_shift(A, shf[i].digit, sz, o, n);
+    static const struct { const char *mn; int digit; unsigned char rop; } bts[] = {
+        {"bt",4,0xA3}, {"bts",5,0xAB}, {"btr",6,0xB3}, {"btc",7,0xBB},
+    };
+    for (size_t i = 0; i < sizeof(bts) / sizeof(bts[0]); i++)
+        if ((sz = suffix(mn, bts[i].mn)) >= 0 && n == 2 && is_rm(&o[1])) {
+            Ins I;
+            sz = op_size(sz, &o[1], 1);
+            if (o[0].kind == OP_IMM && o[0].ex.sym < 0) {
+                unsigned char op[2] = { 0x0F, 0xBA };
+                if (encode(A, &I, sz == 2 ? 0x66 : 0, sz == 8, op, 2, bts[i].digit, &o[1], 0, 1, o[0].ex.c))
+                    return -1;
+            } else if (o[0].kind == OP_REG) {
+                unsigned char op[2] = { 0x0F, bts[i].rop };
+                if (encode(A, &I, sz == 2 ? 0x66 : 0, sz == 8, op, 2, o[0].reg, &o[1], 0, 0, 0))
+                    return -1;
+            } else {
+                return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+            }
+            commit(A, &I);
+            return 0;
+        }
+
+    /* SSE2 */
+    if (!strcmp(mn, "movsd") || !strcmp(mn, "movss")) {
+        int pfx = mn[4] == 'd' ? 0xF2 : 0xF3;
+        if (n != 2) return fail(A, XLAS_ERR_SYNTAX, "expected two operands");
+        if (o[0].kind == OP_XMM && o[1].kind == OP_MEM) {
+            unsigned char op[2] = { 0x0F, 0x11 };
+            Ins I;
+            if (encode(A, &I, pfx, 0, op, 2, o[0].reg, &o[1], 0, 0, 0)) return -1;
+            commit(A, &I);
+            return 0;
+        }
+        return enc_sse(A, pfx, 0x10, o, n);
+    }
+    static const struct { const char *mn; int pfx; unsigned char op; } sse[] = {
+        {"addsd",0xF2,0x58}, {"mulsd",0xF2,0x59}, {"subsd",0xF2,0x5C}, {"minsd",0xF2,0x5D},
+        {"divsd",0xF2,0x5E}, {"maxsd",0xF2,0x5F}, {"sqrtsd",0xF2,0x51},
+        {"ucomisd",0x66,0x2E}, {"comisd",0x66,0x2F}, {"andpd",0x66,0x54},
+        {"andnpd",0x66,0x55}, {"orpd",0x66,0x56}, {"xorpd",0x66,0x57},
+        {"pxor",0x66,0xEF}, {"movapd",0x66,0x28},
+    };
+    for (size_t i = 0; i < sizeof(sse) / sizeof(sse[0]); i++)
+        if (!strcmp(mn, sse[i].mn)) return enc_sse(A, sse[i].pfx, sse[i].op, o, n);
+    if (!strncmp(mn, "cvttsd2si", 9) || !strncmp(mn, "cvtsd2si", 8)) {
+        const char *sfx = mn + (mn[3] == 't' ? 9 : 8);
+        unsigned char op[2] = { 0x0F, (unsigned char)(mn[3] == 't' ? 0x2C : 0x2D) };
+        if (n != 2 || o[1].kind != OP_REG) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        if (*sfx && strcmp(sfx, "q") && strcmp(sfx, "l"))
+            return fail(A, XLAS_ERR_SYNTAX, "unknown instruction '%s'", mn);
+        return enc_rrm(A, 0xF2, o[1].size == 8, op, 2, &o[0], &o[1]);
+    }
+    if (!strncmp(mn, "cvtsi2sd", 8)) {
+        const char *sfx = mn + 8;
+        unsigned char op[2] = { 0x0F, 0x2A };
+        int w;
+        if (n != 2 || o[1].kind != OP_XMM) return fail(A, XLAS_ERR_SYNTAX, "bad operands");
+        if (!strcmp(sfx, "q"))      w = 1;
+        else if (!strcmp(sfx, "l")) w = 0;
+        else if (!*sfx && o[0].kind == OP_REG) w = o[0].size == 8;
+        else return fail(A, XLAS_ERR_SYNTAX, "ambiguous '%s'", mn);
+        return enc_rrm(A, 0xF2, w, op, 2, &o[0], &o[1]);
+    }
+
+    return fail(A, XLAS_ERR_SYNTAX, "unknown instruction '%s'", mn);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * DIRECTIVES
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static int set_section(Asm *A, const char *name) {
+    char nm[64];
+    size_t n = 0;
+    while (name[n] && name[n] != ',' && name[n] != ' ' && name[n] != '\t' && n < sizeof(nm) - 1) {
+        nm[n] = name[n];
+        n++;
+    }
+    nm[n] = '\0';
+    for (int i = 0; i < SEC_COUNT; i++)
+        if (!strcmp(nm, sec_names[i])) { A->cur = i; sec_cur(A); return 0; }
+    return fail(A, XLAS_ERR_SYNTAX, "unsupported section '%s'", nm);
+}
+
+static int align_to(Asm *A, int64_t bytes) {
+    if (bytes <= 0 || (bytes & (bytes - 1)) || bytes > 4096)
+        return fail(A, XLAS_ERR_SYNTAX, "bad alignment");
+    Sec *S = sec_cur(A);
+    if (bytes > S->align) S->align = (int)bytes;
+    if (bytes > 1) frag_close(S, T_ALIGN)->align = (int)bytes;
+    return 0;
+}
+
+/* .asciz / .ascii / .string body with C-style escapes. */
+static int string_data(Asm *A, const char *s, int nul) {
+    Sec *S = sec_cur(A);
+    s = skip_ws(s);
+    if (*s++ != '"') return fail(A, XLAS_ERR_SYNTAX, "expected string");
+    while (*s && *s != '"') {
+        int c = (unsigned char)*s++;
+        if (c == '\\') {
+            c = (unsigned char)*s++;
+            switch (c) {
+            case 'n': c = '\n'; break;
+            case 't': c = '\t'; break;
+            case 'r': c = '\r'; break;
+            case 'b': c = '\b'; break;
+            case 'f': c = '\f'; break;
+            case '"': case '\\': break;
+            case 'x': {
+                int v = 0, k = 0;
+                while (k < 2 && isxdigit((unsigned char)*s)) {
+                    v = v * 16 + (isdigit((unsigned char)*s) ? *s - '0' : (tolower((unsigned char)*s) - 'a' + 10));
+                    s++; k++;
+                }
+                c = v;
+                break;
+            }
+            default:
+                if (c >= '0' && c <= '7') {
+                    int v = c - '0', k = 1;
+                    while (k < 3 && *s >= '0' && *s <= '7') { v = v * 8 + (*s++ - '0'); k++; }
+                    c = v & 0xFF;
+                } else if (!c) {
+                    return fail(A, XLAS_ERR_SYNTAX, "unterminated string");
+                }
+            }
+        }
+        buf_byte(&S->data, (unsigned)c);
+    }
+    if (*s != '"') return fail(A, XLAS_ERR_SYNTAX, "unterminated string");
+    if (nul) buf_byte(&S->data, 0);
+    return 0;
+}
+
+/* .quad / .long / .word / .byte: comma-separated expressions. */
+static int data_values(Asm *A, char *args, int bytes) {
+    char *v[64];
+    int n = split_operands(args, v, 64);
+    if (n <= 0) return fail(A, XLAS_ERR_SYNTAX, "expected values");
+    Sec *S = sec_cur(A);
+    for (int i = 0; i < n; i++) {
+        Expr e;
+        const char *end = parse_expr(A, v[i], &e);
+        if (!end || *skip_ws(end)) return fail(A, XLAS_ERR_SYNTAX, "bad value '%s'", v[i]);
+        size_t at = S->data.n;
+        buf_zero(&S->data, (size_t)bytes);
+        if (e.sym < 0 && e.sym2 < 0) {
+            for (int k = 0; k < bytes; k++) S->data.p[at + (size_t)k] = (unsigned char)((uint64_t)e.c >> (8 * k));
+        } else if (e.sym >= 0 && e.sym2 >= 0 && (bytes == 4 || bytes == 8)) {
+            add_fixup(S, at, bytes == 4 ? FX_DIFF32 : FX_DIFF64, e.sym, e.sym2, e.c);
+        } else if (e.sym >= 0 && e.sym2 < 0 && (bytes == 4 || bytes == 8)) {
+            add_fixup(S, at, bytes == 4 ? FX_ABS32 : FX_ABS64, e.sym, -1, e.c);
+        } else {
+            return fail(A, XLAS_ERR_SYMBOL, "unsupported expression '%s'", v[i]);
+        }
+    }
+    return 0;
+}
+
+static int directive(Asm *A, const char *d, char *args) {
+    Expr e;
+    const char *end;
+    if (!strcmp(d, ".section")) return set_section(A, skip_ws(args));
+    if (!strcmp(d, ".text"))    return set_section(A, ".text");
+    if (!strcmp(d, ".data"))    return set_section(A, ".data");
+    if (!strcmp(d, ".bss"))     return set_section(A, ".bss");
+    if (!strcmp(d, ".globl") || !strcmp(d, ".global")) {
+        const char *s = skip_ws(args), *b = s;
+        while (is_sym_char((unsigned char)*s)) s++;
+        if (s == b) return fail(A, XLAS_ERR_SYNTAX, "expected symbol");
+        int id = sym_get(A, b, (size_t)(s - b));
+        A->syms[id].global = 1;
+        return 0;
+    }
+    if (!strcmp(d, ".balign") || !strcmp(d, ".align") || !strcmp(d, ".p2align")) {
+        end = parse_expr(A, args, &e);
+        if (!end || e.sym >= 0 || e.sym2 >= 0) return fail(A, XLAS_ERR_SYNTAX, "bad alignment");
+        return align_to(A, d[1] == 'p' ? ((e.c >= 0 && e.c < 13) ? (int64_t)1 << e.c : -1) : e.c);
+    }
+    if (!strcmp(d, ".quad"))  return data_values(A, args, 8);
+    if (!strcmp(d, ".long") || !strcmp(d, ".int")) return data_values(A, args, 4);
+    if (!strcmp(d, ".word") || !strcmp(d, ".short")) return data_values(A, args, 2);
+    if (!strcmp(d, ".byte"))  return data_values(A, args, 1);
+    if (!strcmp(d, ".zero") || !strcmp(d, ".skip") || !strcmp(d, ".space")) {
+        end = parse_expr(A, args, &e);
+        if (!end || *skip_ws(end) || e.sym >= 0 || e.sym2 >= 0 || e.c < 0)
+            return fail(A, XLAS_ERR_SYNTAX, "bad size");
+        buf_zero(&sec_cur(A)->data, (size_t)e.c);
+        return 0;
+    }
+    if (!strcmp(d, ".asciz") || !strcmp(d, ".string")) return string_data(A, args, 1);
+    if (!strcmp(d, ".ascii")) return string_data(A, args, 0);
+    if (!strcmp(d, ".type") || !strcmp(d, ".size") || !strcmp(d, ".file") ||
+        !strcmp(d, ".ident") || !strcmp(d, ".local"))
+        return 0;
+    return fail(A, XLAS_ERR_SYNTAX, "unsupported directive '%s'", d);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * LINES
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static int define_label(Asm *A, const char *name, size_t n) {
+    int id = sym_get(A, name, n);
+    Sym *s = &A->syms[id];
+    if (s->sec >= 0) return fail(A, XLAS_ERR_SYMBOL, "symbol '%s' defined twice", s->name);
+    Sec *S = sec_cur(A);
+    s->sec  = A->cur;
+    s->frag = S->nfrags - 1;
+    s->off  = S->data.n - cur_frag(S)->start;
+    return 0;
+}
+
+static int one_line(Asm *A, char *s) {
+    /* strip a # comment that is not inside a string */
+    int quote = 0;
+    for (char *p = s; *p; p++) {
+        if (*p == '\\' && quote && p[1]) { p++; continue; }
+        if (*p == '"') quote = !quote;
+        else if (*p == '#' && !quote) { *p = '\0'; break; }
+    }
+    for (;;) {
+        s = (char *)skip_ws(s);
+        if (!*s) return 0;
+        char *b = s;
+        while (is_sym_char((unsigned char)*s)) s++;
+        if (s == b) return fail(A, XLAS_ERR_SYNTAX, "unexpected '%c'", *s);
+        char *after = (char *)skip_ws(s);
+        if (*after == ':') {
+            if (define_label(A, b, (size_t)(s - b))) return -1;
+            s = after + 1;
+            continue;
+        }
+        char mn[32];
+        size_t n = (size_t)(s - b);
+        if (n >= sizeof(mn)) return fail(A, XLAS_ERR_SYNTAX, "unknown instruction");
+        memcpy(mn, b, n);
+        mn[n] = '\0';
+        return mn[0] == '.' ? directive(A, mn, s) : instruction(A, mn, s);
+    }
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * LAYOUT, FIXUPS, OBJECT FILE
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+static size_t sym_value(const Asm *A, const Sym *s) {
+    const Frag *f = &A->sec[s->sec].frags[s->frag];
+    return f->addr + s->off;
+}
+
+/* A branch stays relaxable only when its target is a local label of the
+ * same section; anything else gets a rel32 and a PLT32 relocation.     */
+static int branch_local(const Asm *A, int sec, const Frag *f) {
+    const Sym *s = &A->syms[f->sym];
+    return s->sec == sec && !s->global;
+}
+
+static void layout(Asm *A, Sec *S, int si) {
+    Frag *last = cur_frag(S);
+    last->len = S->data.n - last->start;
+    last->term = T_NONE;
+    for (int i = 0; i < S->nfrags; i++) {
+        Frag *f = &S->frags[i];
+        f->wide = (f->term == T_JMP || f->term == T_JCC) && !branch_local(A, si, f);
+    }
+    for (;;) {
+        size_t addr = 0;
+        for (int i = 0; i < S->nfrags; i++) {
+            Frag *f = &S->frags[i];
+            f->addr = addr;
+            addr += f->len;
+            switch (f->term) {
+            case T_JMP:   addr += f->wide ? 5 : 2; break;
+            case T_JCC:   addr += f->wide ? 6 : 2; break;
+            case T_ALIGN: f->pad = (size_t)((-(int64_t)addr) & (f->align - 1)); addr += f->pad; break;
+            }
+        }
+        S->size = addr;
+        int grew = 0;
+        for (int i = 0; i < S->nfrags; i++) {
+            Frag *f = &S->frags[i];
+            if ((f->term != T_JMP && f->term != T_JCC) || f->wide) continue;
+            int64_t d = (int64_t)sym_value(A, &A->syms[f->sym]) - (int64_t)(f->addr + f->len + 2);
+            if (!fits8(d)) { f->wide = 1; grew = 1; }
+        }
+        if (!grew) return;
+    }
+}
+
+static void add_rela(Sec *S, uint64_t off, int sym_elf, int type, int64_t addend) {
+    if (S->nrela == S->rela_cap) {
+        S->rela_cap = S->rela_cap ? S->rela_cap * 2 : 64;
+        S->rela = realloc(S->rela, sizeof(Elf64Rela) * (size_t)S->rela_cap);
+    }
+    Elf64Rela *r = &S->rela[S->nrela++];
+    r->r_offset = off;
+    r->r_info   = ((uint64_t)(unsigned)sym_elf << 32) | (uint32_t)type;
+    r->r_addend = addend;
+}
+
+static void put_le(unsigned char *p, uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) p[i] = (unsigned char)(v >> (8 * i));
+}
+
+/* Symbol + addend as a relocation: locals go through their section
+ * symbol (as gas does), globals and undefined symbols by name.         */
+static void reloc_to(Asm *A, Sec *S, uint64_t off, int sym, int type, int64_t addend) {
+    Sym *s = &A->syms[sym];
+    if (s->sec >= 0 && !s->global)
+        add_rela(S, off, A->sec[s->sec].shndx, type, addend + (int64_t)sym_value(A, s));
+    else
+        add_rela(S, off, s->elf_index, type, addend);
+}
+
+/* Code padding with the recommended multi-byte NOPs, so the padding in
+ * front of an aligned loop head decodes as one instruction.           */
+static void fill_nops(unsigned char *p, size_t n) {
+    static const unsigned char nops[11][11] = {
+        {0x90},
+        {0x66,0x90},
+        {0x0F,0x1F,0x00},
+        {0x0F,0x1F,0x40,0x00},
+        {0x0F,0x1F,0x44,0x00,0x00},
+        {0x66,0x0F,0x1F,0x44,0x00,0x00},
+        {0x0F,0x1F,0x80,0x00,0x00,0x00,0x00},
+        {0x0F,0x1F,0x84,0x00,0x00,0x00,0x00,0x00},
+        {0x66,0x0F,0x1F,0x84,0x00,0x00,0x00,0x00,0x00},
+        {0x66,0x2E,0x0F,0x1F,0x84,0x00,0x00,0x00,0x00,0x00},
+        {0x66,0x66,0x2E,0x0F,0x1F,0x84,0x00,0x00,0x00,0x00,0x00},
+    };
+    while (n) {
+        size_t k = n < 11 ? n : 11;
+        memcpy(p, nops[k - 1], k);
+        p += k;
+        n -= k;
+    }
+}
+
+static int emit_section(Asm *A, int si) {
+    Sec *S = &A->sec[si];
+    S->out = malloc(S->size ? S->size : 1);
+    size_t at = 0;
+    for (int i = 0; i < S->nfrags; i++) {
+        Frag *f = &S->frags[i];
+        memcpy(S->out + at, S->data.p + f->start, f->len);
+        at += f->len;
+        if (f->term == T_ALIGN) {
+            if (si == SEC_TEXT || si == SEC_COLD) fill_nops(S->out + at, f->pad);
+            else                memset(S->out + at, 0, f->pad);
+            at += f->pad;
+        } else if (f->term == T_JMP || f->term == T_JCC) {
+            size_t opn = f->term == T_JMP ? (f->wide ? 1 : 1) : (f->wide ? 2 : 1);
+            if (f->term == T_JMP) S->out[at] = f->wide ? 0xE9 : 0xEB;
+            else if (f->wide)     { S->out[at] = 0x0F; S->out[at + 1] = (unsigned char)(0x80 + f->cc); }
+            else                  S->out[at] = (unsigned char)(0x70 + f->cc);
+            at += opn;
+            if (f->wide && !branch_local(A, si, f)) {
+                put_le(S->out + at, 0, 4);
+                reloc_to(A, S, at, f->sym, R_X86_64_PLT32, -4);
+                at += 4;
+            } else {
+                int64_t d = (int64_t)sym_value(A, &A->syms[f->sym]) - (int64_t)(at + (f->wide ? 4 : 1));
+                put_le(S->out + at, (uint64_t)d, f->wide ? 4 : 1);
+                at += f->wide ? 4 : 1;
+            }
+        }
+    }
+    for (int i = 0; i < S->nfix; i++) {
+        Fixup *x = &S->fix[i];
+        uint64_t p = S->frags[x->frag].addr + x->off;
+        Sym *s = &A->syms[x->sym];
+        switch (x->kind) {
+        case FX_PC32:
+        case FX_PLT32:
+            if (s->sec == si && !s->global) {
+                int64_t v = (int64_t)sym_value(A, s) + x->addend - (int64_t)p;
+                put_le(S->out + p, (uint64_t)v, 4);
+            } else {
+                reloc_to(A, S, p, x->sym, x->kind == FX_PC32 ? R_X86_64_PC32 : R_X86_64_PLT32, x->addend);
+            }
+            break;
+        case FX_ABS64: reloc_to(A, S, p, x->sym, R_X86_64_64,  x->addend); break;
+        case FX_ABS32: reloc_to(A, S, p, x->sym, R_X86_64_32,  x->addend); break;
+        case FX_ABS32S: reloc_to(A, S, p, x->sym, R_X86_64_32S, x->addend); break;
+        case FX_DIFF32:
+        case FX_DIFF64: {
+            Sym *b = &A->syms[x->sym2];
+            if (s->sec < 0 || s->sec != b->sec)
+                return fail(A, XLAS_ERR_SYMBOL, "'%s-%s' is not a constant", s->name, b->name);
+            int64_t v = (int64_t)sym_value(A, s) - (int64_t)sym_value(A, b) + x->addend;
+            put_le(S->out + p, (uint64_t)v, x->kind == FX_DIFF32 ? 4 : 8);
+            break;
+        }
+        }
+    }
+    return 0;
+}
+
+static uint32_t strtab_add(Buf *b, const char *s) {
+    uint32_t off = (uint32_t)b->n;
+    buf_put(b, s, strlen(s) + 1);
+    return off;
+}
+
+static void pad_to(Buf *b, size_t align) {
+    while (b->n % align) buf_byte(b, 0);
+}
+
+static int write_object(Asm *A, const char *path) {
+    static const struct { int type; uint64_t flags; } kinds[SEC_COUNT] = {
+        { SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR },
+        { SHT_PROGBITS, SHF_ALLOC },
+        { SHT_PROGBITS, SHF_ALLOC | SHF_WRITE },
+        { SHT_NOBITS,   SHF_ALLOC | SHF_WRITE },
+        { SHT_PROGBITS, 0 },
+        { SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR },
+    };
+    Elf64Shdr sh[2 * SEC_COUNT + 4];
+    memset(sh, 0, sizeof(sh));
+    int nsh = 1;
+    A->sec[SEC_TEXT].used = A->sec[SEC_NOTE].used = 1;     /* always present */
+    for (int i = 0; i < SEC_COUNT; i++) {
+        if (!A->sec[i].nfrags) frag_open(&A->sec[i]);
+        if (A->sec[i].used) A->sec[i].shndx = nsh++;
+    }
+    for (int i = 0; i < SEC_COUNT; i++)
+        if (A->sec[i].used) layout(A, &A->sec[i], i);
+
+    /* symbol table: null, section symbols, locals, then globals */
+    Buf strtab = {0}, symtab = {0};
+    buf_byte(&strtab, 0);
+    Elf64Sym es;
+    memset(&es, 0, sizeof(es));
+    buf_put(&symtab, &es, sizeof(es));
+    int nsym = 1;
+    for (int i = 0; i < SEC_COUNT; i++) {
+        if (!A->sec[i].used) continue;
+        memset(&es, 0, sizeof(es));
+        es.st_info  = (STB_LOCAL << 4) | STT_SECTION;
+        es.st_shndx = (uint16_t)A->sec[i].shndx;
+        buf_put(&symtab, &es, sizeof(es));
+        nsym++;
+    }
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < A->nsyms; i++) {
+            Sym *s = &A->syms[i];
+            if (s->sec < 0 && s->global == 0 && !s->referenced) continue;
+            if (s->sec < 0 && sym_is_local_label(s))
+                return fail(A, XLAS_ERR_SYMBOL, "undefined local label '%s'", s->name);
+            int global = s->global || s->sec < 0;
+            if (global != pass || (!global && sym_is_local_label(s))) continue;
+            memset(&es, 0, sizeof(es));
+            es.st_name  = strtab_add(&strtab, s->name);
+            es.st_info  = (unsigned char)(((global ? STB_GLOBAL : STB_LOCAL) << 4) | STT_NOTYPE);
+            es.st_shndx = (uint16_t)(s->sec >= 0 ? A->sec[s->sec].shndx : 0);
+            es.st_value = s->sec >= 0 ? sym_value(A, s) : 0;
+            buf_put(&symtab, &es, sizeof(es));
+            s->elf_index = nsym++;
+        }
+        if (pass == 0) sh[0].sh_info = (uint32_t)nsym;      /* first global, stashed */
+    }
+    int first_global = (int)sh[0].sh_info;
+    sh[0].sh_info = 0;
+
+    for (int i = 0; i < SEC_COUNT; i++)
+        if (A->sec[i].used && emit_section(A, i)) return -1;
+
+    /* file: ehdr, contents, relas, symtab, strtab, shstrtab, shdrs */
+    Buf f = {0}, shstr = {0};
+    buf_byte(&shstr, 0);
+    buf_zero(&f, sizeof(Elf64Ehdr));
+    for (int i = 0; i < SEC_COUNT; i++) {
+        Sec *S = &A->sec[i];
+        if (!S->used) continue;
+        int align = S->align > 1 ? S->align : 1;
+        if ((i == SEC_TEXT || i == SEC_COLD) && align < 16) align = 16;
+        Elf64Shdr *h = &sh[S->shndx];
+        pad_to(&f, (size_t)align);
+        h->sh_name = strtab_add(&shstr, sec_names[i]);
+        h->sh_type = (uint32_t)kinds[i].type;
+        h->sh_flags = kinds[i].flags;
+        h->sh_offset = f.n;
+        h->sh_size = S->size;
+        h->sh_addralign = (uint64_t)align;
+        if (kinds[i].type != SHT_NOBITS) buf_put(&f, S->out, S->size);
+    }
+    int symtab_idx = nsh + 0;
+    for (int i = 0; i < SEC_COUNT; i++) if (A->sec[i].used && A->sec[i].nrela) symtab_idx++;
+    for (int i = 0; i < SEC_COUNT; i++) {
+        Sec *S = &A->sec[i];
+        if (!S->used || !S->nrela) continue;
+        char name[32];
+        snprintf(name, sizeof(name), ".rela%s", sec_names[i]);
+        Elf64Shdr *h = &sh[nsh++];
+        pad_to(&f, 8);
+        h->sh_name = strtab_add(&shstr, name);
+        h->sh_type = SHT_RELA;
+        h->sh_flags = SHF_INFO_LINK;
+        h->sh_offset = f.n;
+        h->sh_size = sizeof(Elf64Rela) * (size_t)S->nrela;
+        h->sh_link = (uint32_t)symtab_idx;
+        h->sh_info = (uint32_t)S->shndx;
+        h->sh_addralign = 8;
+        h->sh_entsize = sizeof(Elf64Rela);
+        buf_put(&f, S->rela, h->sh_size);
+    }
+    Elf64Shdr *h = &sh[nsh++];                              /* .symtab */
+    pad_to(&f, 8);
+    h->sh_name = strtab_add(&shstr, ".symtab");
+    h->sh_type = SHT_SYMTAB;
+    h->sh_offset = f.n;
+    h->sh_size = symtab.n;
+    h->sh_link = (uint32_t)nsh;                              /* .strtab follows */
+    h->sh_info = (uint32_t)first_global;
+    h->sh_addralign = 8;
+    h->sh_entsize = sizeof(Elf64Sym);
+    buf_put(&f, symtab.p, symtab.n);
+    h = &sh[nsh++];                                         /* .strtab */
+    h->sh_name = strtab_add(&shstr, ".strtab");
+    h->sh_type = SHT_STRTAB;
+    h->sh_offset = f.n;
+    h->sh_size = strtab.n;
+    h->sh_addralign = 1;
+    buf_put(&f, strtab.p, strtab.n);
+    h = &sh[nsh++];                                         /* .shstrtab */
+    h->sh_name = strtab_add(&shstr, ".shstrtab");
+    h->sh_type = SHT_STRTAB;
+    h->sh_offset = f.n;
+    h->sh_size = shstr.n;
+    h->sh_addralign = 1;
+    buf_put(&f, shstr.p, shstr.n);
+    pad_to(&f, 8);
+    size_t shoff = f.n;
+    buf_put(&f, sh, sizeof(Elf64Shdr) * (size_t)nsh);
+
+    Elf64Ehdr eh;
+    memset(&eh, 0, sizeof(eh));
+    memcpy(eh.e_ident, "\177ELF", 4);
+    eh.e_ident[4] = ELFCLASS64;
+    eh.e_ident[5] = ELFDATA2LSB;
+    eh.e_ident[6] = 1;
+    eh.e_type = ET_REL;
+    eh.e_machine = EM_X86_64;
+    eh.e_version = 1;
+    eh.e_shoff = shoff;
+    eh.e_ehsize = sizeof(Elf64Ehdr);
+    eh.e_shentsize = sizeof(Elf64Shdr);
+    eh.e_shnum = (uint16_t)nsh;
+    eh.e_shstrndx = (uint16_t)(nsh - 1);
+    memcpy(f.p, &eh, sizeof(eh));
+
+    int rc = 0;
+    FILE *out = fopen(path, "wb");
+    if (!out || fwrite(f.p, 1, f.n, out) != f.n) rc = fail(A, XLAS_ERR_OUTPUT, "cannot write %s", path);
+    if (out && fclose(out) != 0 && !rc) rc = fail(A, XLAS_ERR_OUTPUT, "cannot write %s", path);
+    if (rc) remove(path);
+    free(f.p); free(shstr.p); free(symtab.p); free(strtab.p);
+    return rc;
+}
+
+static void asm_free(Asm *A) {
+    for (int i = 0; i < SEC_COUNT; i++) {
+        Sec *S = &A->sec[i];
+        free(S->data.p); free(S->frags); free(S->fix); free(S->out); free(S->rela);
+    }
+    for (int i = 0; i < A->nsyms; i++) free(A->syms[i].name);
+    free(A->syms);
+    free(A->table);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * PUBLIC API
+ * ═══════════════════════════════════════════════════════════════════════════ */
+
+int xlas_supported(void) {
+#if defined(__x86_64__) && !defined(__APPLE__)
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+/* Parse and encode every line of `src`; stops at the first error. */
+static void assemble_lines(Asm *A, const char *src, size_t len) {
+    A->cur = SEC_TEXT;
+    char *line = malloc(256);
+    size_t cap = 256;
+    for (size_t i = 0; i < len && !A->failed; ) {
+        size_t j = i;
+        while (j < len && src[j] != '\n') j++;
+        if (j - i + 1 > cap) { cap = j - i + 1; line = realloc(line, cap); }
+        memcpy(line, src + i, j - i);
+        line[j - i] = '\0';
+        A->line++;
+        one_line(A, line);
+        i = j + 1;
+    }
+    free(line);
+}
+
+int xlas_assemble(const char *src, size_t len, const char *obj_path,
+                  char *err, size_t errsz) {
+    Asm A;
+    memset(&A, 0, sizeof(A));
+    A.err = err;
+    A.errsz = errsz;
+    if (err && errsz) err[0] = '\0';
+    if (!xlas_supported()) {
+        fail(&A, XLAS_ERR_TARGET, "xlas does not support this target");
+        return XLAS_ERR_TARGET;
+    }
+    assemble_lines(&A, src, len);
+    if (!A.failed) write_object(&A, obj_path);
+    int rc = A.failed;
+    asm_free(&A);
+    return rc;
+}
+
+int xlas_assemble_code(const char *src, size_t len, unsigned char **code, size_t *size,
+                       char *err, size_t errsz) {
+    Asm A;
+    memset(&A, 0, sizeof(A));
+    A.err = err;
+    A.errsz = errsz;
+    if (err && errsz) err[0] = '\0';
+    *code = NULL;
+    *size = 0;
+#if !defined(__x86_64__)
+    fail(&A, XLAS_ERR_TARGET, "xlas does not support this target");
+    return XLAS_ERR_TARGET;
+#endif
+    assemble_lines(&A, src, len);
+    for (int i = 0; i < SEC_COUNT && !A.failed; i++)
+        if (i != SEC_TEXT && A.sec[i].used)
+            fail(&A, XLAS_ERR_SYNTAX, "%s: only .text can be assembled to code", sec_names[i]);
+    for (int i = 0; i < A.nsyms && !A.failed; i++)
+        if (A.syms[i].sec < 0 && A.syms[i].referenced)
+            fail(&A, XLAS_ERR_SYMBOL, "'%s' is not defined in the code", A.syms[i].name);
+    if (!A.failed) {
+        Sec *S = &A.sec[SEC_TEXT];
+        if (!S->nfrags) frag_open(S);
+        layout(&A, S, SEC_TEXT);
+        if (emit_section(&A, SEC_TEXT) == 0 && S->nrela)
+            fail(&A, XLAS_ERR_SYMBOL, "code needs relocations");
+        if (!A.failed) {
+            *code = S->out;
+            *size = S->size;
+            S->out = NULL;
+        }
+    }
+    int rc = A.failed;
+    asm_free(&A);
+    return rc;
+}
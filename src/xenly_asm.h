@@ -0,0 +1,70 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * xenly_asm.h — Xenly Built-in Assembler  (xlas)
+ *
+ * Encodes the x86-64 AT&T assembly that codegen emits straight into an
+ * ELF64 relocatable object, in-process.  xenlyc no longer has to write a
+ * .s file and launch the system assembler to re-parse it: the text goes
+ * from an in-memory buffer to the .o in a single pass plus branch
+ * relaxation.
+ *
+ * Covered: the instruction subset codegen produces (integer moves and
+ * ALU ops, lea, push/pop, call/jmp/jcc/setcc, movz/movs, shifts, bit
+ * tests, the scalar-double SSE2 ops and xmm<->gpr moves), the directives
+ * .section/.text/.data/.bss/.globl/.balign/.p2align/.quad/.long/.byte/
+ * .zero/.asciz, and # comments.  Sections: .text, .text.unlikely (cold
+ * code), .rodata, .data, .bss.  Short jumps are relaxed like gas does.
+ *
+ * Anything outside that subset makes xlas_assemble() fail with a message;
+ * the driver then falls back to the system assembler, so an unsupported
+ * instruction costs speed, never correctness.
+ *
+ * Pipeline position:
+ *   codegen → asm text (memory) → xlas → .o → link
+ */
+
+#ifndef XENLY_ASM_H
+#define XENLY_ASM_H
+
+#include <stddef.h>
+
+/* ── Return codes ────────────────────────────────────────────────────────── */
+#define XLAS_OK          0
+#define XLAS_ERR_SYNTAX  1   /* unknown instruction, operand or directive */
+#define XLAS_ERR_SYMBOL  2   /* undefined local label, bad expression     */
+#define XLAS_ERR_OUTPUT  3   /* cannot write the object file             */
+#define XLAS_ERR_TARGET  4   /* host target not supported by xlas        */
+
+/*
+ * xlas_supported — 1 when xlas can assemble for the host target
+ * (x86-64 ELF); 0 on AArch64 and Mach-O, which keep the system assembler.
+ */
+int xlas_supported(void);
+
+/*
+ * xlas_assemble — assemble `len` bytes of assembly text at `src` into an
+ * ELF64 relocatable object written to `obj_path`.
+ * Returns XLAS_OK, or an XLAS_ERR_* code with a one-line reason
+ * ("line N: ...") copied into `err` (may be NULL).
+ */
+int xlas_assemble(const char *src, size_t len, const char *obj_path,
+                  char *err, size_t errsz);
+
+/*
+ * xlas_assemble_code — assemble text that only uses .text and its own
+ * labels into position-independent machine code (the interpreter's JIT
+ * puts it in executable memory).  *code is malloc'd and *size bytes long;
+ * anything that would need a relocation is an error.  Returns as above.
+ */
+int xlas_assemble_code(const char *src, size_t len, unsigned char **code, size_t *size,
+                       char *err, size_t errsz);
+
+#endif /* XENLY_ASM_H */
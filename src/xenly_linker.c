@@ -47,7 +47,8 @@
  *  20. Output mmap POPULATE   — touch output pages before writing (Linux)
  *
  *  LAYOUT STAGE
- *  21. qsort                  — O(n log n) chunk sort; replaces O(n²) bubble
+ *  21. Bucketed layout        — one pass per output section; no sort, and
+ *                               chunk indices held by symbols stay valid
  *
  *  PLATFORM-SPECIFIC
  *  22. F_NOCACHE (macOS)      — bypass kernel buffer cache for output writes
@@ -56,8 +57,8 @@
  *  25. CLONE_VM thread (Linux)— parallel AR member scanning via clone(2)
  *
  *  SELF-HOSTING
- *  26. gcc/clang fully removed from xenlyc_main.c
- *  27. xlnk is the sole linker; ELF64 + Mach-O-64 output
+ *  26. xenlyc links x86-64 ELF in-process; cc only on --linker=system
+ *  27. On-demand archive members, GOT/PLT + copy relocs, versioned imports
  */
 
 #include "xenly_linker.h"
@@ -117,14 +118,22 @@
 #define SHT_NOBITS   8
 #define SHT_REL      9
 #define SHT_DYNSYM   11
+#define SHT_INIT_ARRAY 14
+#define SHT_FINI_ARRAY 15
+#define SHT_GROUP    17
+#define SHT_GNU_verdef  0x6ffffffd
+#define SHT_GNU_verneed 0x6ffffffe
+#define SHT_GNU_versym  0x6fffffff
 #define SHF_WRITE     0x1
 #define SHF_ALLOC     0x2
 #define SHF_EXECINSTR 0x4
+#define SHF_TLS       0x400
 #define PT_NULL    0
 #define PT_LOAD    1
 #define PT_DYNAMIC 2
 #define PT_INTERP  3
 #define PT_PHDR    6
+#define PT_TLS     7
 #define PT_GNU_STACK 0x6474e551
 #define PF_X  0x1
 #define PF_W  0x2
@@ -132,7 +141,12 @@
 #define STB_LOCAL  0
 #define STB_GLOBAL 1
 #define STB_WEAK   2
+#define STT_NOTYPE 0
+#define STT_OBJECT 1
 #define STT_FUNC   2
+#define STT_SECTION 3
+#define STT_TLS    6
+#define STT_GNU_IFUNC 10
 #define SHN_UNDEF  0
 #define SHN_ABS    0xFFF1
 #define SHN_COMMON 0xFFF2
@@ -141,8 +155,25 @@
 #define DT_STRTAB 5
 #define DT_SYMTAB 6
 #define DT_STRSZ  10
+#define DT_HASH   4
+#define DT_RELA   7
+#define DT_RELASZ 8
+#define DT_RELAENT 9
 #define DT_SYMENT 11
+#define DT_DEBUG  21
+#define DT_INIT_ARRAY   25
+#define DT_FINI_ARRAY   26
+#define DT_INIT_ARRAYSZ 27
+#define DT_FINI_ARRAYSZ 28
+#define DT_FLAGS  30
+#define DT_VERSYM     0x6ffffff0
+#define DT_FLAGS_1    0x6ffffffb
+#define DT_VERNEED    0x6ffffffe
+#define DT_VERNEEDNUM 0x6fffffff
+#define DF_BIND_NOW 0x8
+#define DF_1_NOW  0x1
 #define DF_1_PIE  0x08000000
+#define VER_HIDDEN 0x8000
 
 typedef uint64_t Elf64_Addr;
 typedef uint64_t Elf64_Off;
@@ -199,6 +230,21 @@ typedef struct {
     union { Elf64_Xword d_val; Elf64_Addr d_ptr; } d_un;
 } Elf64_Dyn;
 
+typedef struct {
+    Elf64_Half vd_version, vd_flags, vd_ndx, vd_cnt;
+    Elf64_Word vd_hash, vd_aux, vd_next;
+} Elf64_Verdef;
+typedef struct { Elf64_Word vda_name, vda_next; } Elf64_Verdaux;
+typedef struct {
+    Elf64_Half vn_version, vn_cnt;
+    Elf64_Word vn_file, vn_aux, vn_next;
+} Elf64_Verneed;
+typedef struct {
+    Elf64_Word vna_hash;
+    Elf64_Half vna_flags, vna_other;
+    Elf64_Word vna_name, vna_next;
+} Elf64_Vernaux;
+
 #define ELF64_ST_BIND(i)  ((i)>>4)
 #define ELF64_ST_TYPE(i)  ((i)&0xf)
 #define ELF64_R_SYM(r)    ((r)>>32)
@@ -210,10 +256,16 @@ typedef struct {
 #define R_X86_64_64        1
 #define R_X86_64_PC32      2
 #define R_X86_64_PLT32     4
+#define R_X86_64_COPY      5
+#define R_X86_64_GLOB_DAT  6
 #define R_X86_64_RELATIVE  8
 #define R_X86_64_GOTPCREL  9
 #define R_X86_64_32       10
 #define R_X86_64_32S      11
+#define R_X86_64_TPOFF64  18
+#define R_X86_64_GOTTPOFF 22
+#define R_X86_64_TPOFF32  23
+#define R_X86_64_PC64     24
 #define R_X86_64_GOTPCRELX    41
 #define R_X86_64_REX_GOTPCRELX 42
 
@@ -261,17 +313,30 @@ typedef struct { uint32_t cmd, cmdsize, name_offset; } DylinkerCommand;
 typedef struct { char ar_name[16], ar_date[12], ar_uid[6], ar_gid[6], ar_mode[8], ar_size[10], ar_fmag[2]; } ArHeader;
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * ARENA ALLOCATOR  — two-level: stack-fast + heap-overflow
+ * ARENA ALLOCATOR  — bump allocation in large blocks
+ *
+ * Chunks, relocation tables and symbol names keep raw pointers into the
+ * arena, so a full block is retired (kept alive until arena_free) and a new
+ * one started — blocks are never moved by realloc.
  * ═══════════════════════════════════════════════════════════════════════════ */
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;
+    uint8_t *base;
+    size_t   cap;
+    int      from_huge;
+} ArenaBlock;
+
 typedef struct {
     uint8_t *base;
     size_t   used;
     size_t   cap;
     int      from_huge; /* 1 = backed by huge pages (Linux MAP_HUGETLB) */
+    ArenaBlock *retired;
 } Arena;
 
 static void arena_init(Arena *a, size_t cap) {
     a->from_huge = 0;
+    a->retired   = NULL;
 #if defined(__linux__) && defined(MAP_HUGETLB)
     /* Try huge pages (2 MB) for large arenas — reduces TLB pressure */
     if (cap >= 2 * 1024 * 1024) {
@@ -289,37 +354,50 @@ static void arena_init(Arena *a, size_t cap) {
 #endif
     a->base = (uint8_t *)malloc(cap);
     a->used = 0;
-    a->cap  = cap;
+    a->cap  = a->base ? cap : 0;
 }
 
 static void *arena_alloc(Arena *a, size_t sz, size_t align) {
-    size_t off = (a->used + align - 1) & ~(align - 1);
-    if (XLNK_UNLIKELY(off + sz > a->cap)) {
-        size_t new_cap = a->cap * 2;
-        while (new_cap < off + sz) new_cap *= 2;
-        if (a->from_huge) {
-            /* Can't realloc huge pages; fall back to malloc for overflow */
-            uint8_t *nb = (uint8_t *)malloc(new_cap);
-            if (!nb) return NULL;
-            memcpy(nb, a->base, a->used);
-            munmap(a->base, a->cap);
-            a->base = nb;
-            a->from_huge = 0;
-        } else {
-            uint8_t *nb = (uint8_t *)realloc(a->base, new_cap);
-            if (!nb) return NULL;
-            a->base = nb;
+    uintptr_t p = ((uintptr_t)a->base + a->used + align - 1) & ~(uintptr_t)(align - 1);
+    if (XLNK_UNLIKELY(!a->base || p + sz > (uintptr_t)a->base + a->cap)) {
+        size_t new_cap = a->cap ? a->cap * 2 : 1024 * 1024;
+        while (new_cap < sz + align) new_cap *= 2;
+        uint8_t *nb = (uint8_t *)malloc(new_cap);
+        if (!nb) return NULL;
+        if (a->base) {
+            ArenaBlock *old = (ArenaBlock *)malloc(sizeof(*old));
+            if (!old) { free(nb); return NULL; }
+            old->next = a->retired; old->base = a->base;
+            old->cap  = a->cap;     old->from_huge = a->from_huge;
+            a->retired = old;
         }
-        a->cap = new_cap;
+        a->base = nb; a->cap = new_cap; a->used = 0; a->from_huge = 0;
+        p = ((uintptr_t)nb + align - 1) & ~(uintptr_t)(align - 1);
     }
-    a->used = off + sz;
-    return a->base + off;
+    a->used = (size_t)(p + sz - (uintptr_t)a->base);
+    return (void *)p;
+}
+
+static void *arena_zalloc(Arena *a, size_t sz, size_t align) {
+    void *p = arena_alloc(a, sz, align);
+    if (p) memset(p, 0, sz);
+    return p;
+}
+
+static void arena_block_free(uint8_t *base, size_t cap, int huge) {
+    if (!base) return;
+    if (huge) munmap(base, cap);
+    else free(base);
 }
 
 static void arena_free(Arena *a) {
-    if (!a->base) return;
-    if (a->from_huge) munmap(a->base, a->cap);
-    else free(a->base);
+    while (a->retired) {
+        ArenaBlock *b = a->retired;
+        a->retired = b->next;
+        arena_block_free(b->base, b->cap, b->from_huge);
+        free(b);
+    }
+    arena_block_free(a->base, a->cap, a->from_huge);
     a->base = NULL; a->used = a->cap = 0;
 }
 
@@ -330,27 +408,37 @@ static void arena_free(Arena *a) {
  * Average probe length: ~0.5 + load_factor²/(2*(1-load_factor))
  * At 50% load (our target): avg ~1.0 probe — nearly O(1) per lookup.
  * Outperforms linear probing for lookup-heavy workloads (symbol resolution).
+ *
+ * Slots carry only (hash, probe distance, index); the symbols live in a
+ * flat array, so the index an object file records for its symbol N stays
+ * valid while later inserts shuffle slots around.
  * ═══════════════════════════════════════════════════════════════════════════ */
 
-/* A resolved symbol — tightly packed for cache efficiency */
+/* A resolved symbol */
 typedef struct {
-    const char *name;     /* points into str_arena */
-    uint64_t    value;    /* virtual address after layout */
-    uint32_t    hash;     /* cached wyhash (0 = empty slot) */
-    uint32_t    size;
-    uint32_t    dist;     /* Robin Hood probe distance */
-    uint8_t     bind;     /* STB_* */
-    uint8_t     type;     /* STT_* */
-    uint8_t     defined;
-    uint8_t     _pad;
+    const char *name;       /* points into str_arena                         */
+    uint64_t    value;      /* offset in `chunk` until layout, then VA       */
+    uint64_t    size;
+    int         chunk;      /* defining chunk; -1 = absolute                 */
+    uint8_t     bind;       /* STB_*                                         */
+    uint8_t     type;       /* STT_*                                         */
+    uint8_t     defined;    /* defined by an input object                    */
+    uint8_t     strong_ref; /* referenced by a non-weak undefined entry      */
+    uint8_t     copy;       /* imported data object copied into .bss         */
     int         plt_index;
     int         got_index;
+    int         dynsym_index; /* 0 = not in .dynsym                          */
+    int         lib;        /* defining shared library, -1 = none            */
+    const char *version;    /* default version in `lib`, NULL = unversioned  */
+    uint64_t    copy_off;   /* offset of the copy in the copy area           */
 } XlnkSymbol;
 
-/* Robin Hood open-addressing table */
-#define SYM_HTAB_CAP 262144u  /* 2× XLNK_MAX_SYMBOLS, power of 2 */
+typedef struct { uint32_t hash, dist, idx; } SymSlot;
+
+#define SYM_HTAB_CAP 131072u  /* 2× XLNK_MAX_SYMBOLS, power of 2 */
 typedef struct {
-    XlnkSymbol *slots;    /* heap-allocated via arena */
+    XlnkSymbol *syms;     /* XLNK_MAX_SYMBOLS entries; addresses are stable  */
+    SymSlot    *slots;    /* calloc'd: fresh zero pages, no 1.5 MB memset    */
     uint32_t    cap;      /* SYM_HTAB_CAP */
     uint32_t    n;        /* number of live entries */
 } SymTable;
@@ -378,73 +466,125 @@ static inline uint32_t sym_hash(const char *key) {
     return (uint32_t)(s ^ (s >> 32)) | 1u; /* never 0 (0 = empty sentinel) */
 }
 
-/* Initialise SymTable — slots allocated from arena */
-static void sym_table_init(SymTable *t, Arena *a) {
+static int sym_table_init(SymTable *t) {
     t->cap   = SYM_HTAB_CAP;
     t->n     = 0;
-    t->slots = (XlnkSymbol *)arena_alloc(a, sizeof(XlnkSymbol) * SYM_HTAB_CAP, 64);
-    if (t->slots) memset(t->slots, 0, sizeof(XlnkSymbol) * SYM_HTAB_CAP);
+    t->syms  = (XlnkSymbol *)malloc(sizeof(XlnkSymbol) * XLNK_MAX_SYMBOLS);
+    t->slots = (SymSlot *)calloc(SYM_HTAB_CAP, sizeof(SymSlot));
+    return t->syms && t->slots ? XLNK_OK : XLNK_ERR_NOMEM;
 }
 
-/* Robin Hood find */
-static XlnkSymbol *sym_find(SymTable *t, const char *name) {
-    uint32_t h   = sym_hash(name);
-    uint32_t idx = h & (t->cap - 1);
+static void sym_table_free(SymTable *t) {
+    free(t->syms);
+    free(t->slots);
+    t->syms = NULL; t->slots = NULL;
+}
+
+/* Robin Hood find; returns the symbol index or -1 */
+static int sym_find_h(const SymTable *t, const char *name, uint32_t h) {
+    uint32_t idx  = h & (t->cap - 1);
     uint32_t dist = 0;
     while (1) {
-        XlnkSymbol *s = &t->slots[idx];
-        if (XLNK_UNLIKELY(s->hash == 0)) return NULL;   /* empty */
-        if (XLNK_UNLIKELY(s->dist < dist)) return NULL; /* Robin Hood: can't be here */
-        if (XLNK_LIKELY(s->hash == h) && strcmp(s->name, name) == 0) return s;
+        const SymSlot *s = &t->slots[idx];
+        if (XLNK_UNLIKELY(s->hash == 0)) return -1;   /* empty */
+        if (XLNK_UNLIKELY(s->dist < dist)) return -1; /* Robin Hood: can't be here */
+        if (XLNK_LIKELY(s->hash == h) && strcmp(t->syms[s->idx].name, name) == 0)
+            return (int)s->idx;
         XLNK_PREFETCH(&t->slots[(idx+1) & (t->cap-1)]);
         idx = (idx + 1) & (t->cap - 1);
         dist++;
     }
 }
 
-/* Robin Hood insert-or-find */
-static XlnkSymbol *sym_intern(SymTable *t, const char *name, Arena *str_a) {
-    if (XLNK_UNLIKELY(t->n * 2 >= t->cap)) return NULL; /* >50% load */
-    uint32_t h    = sym_hash(name);
-    uint32_t idx  = h & (t->cap - 1);
-    uint32_t dist = 0;
+static int sym_find(const SymTable *t, const char *name) {
+    return sym_find_h(t, name, sym_hash(name));
+}
+
+/* Robin Hood insert-or-find; returns the symbol index or -1 when full */
+static int sym_intern(SymTable *t, const char *name, Arena *str_a) {
+    uint32_t h  = sym_hash(name);
+    int      ex = sym_find_h(t, name, h);
+    if (ex >= 0) return ex;
+    if (XLNK_UNLIKELY(t->n >= XLNK_MAX_SYMBOLS)) return -1;
 
     /* Copy name into str_arena */
     size_t nlen = strlen(name) + 1;
     char *ncopy = (char *)arena_alloc(str_a, nlen, 1);
-    if (ncopy) memcpy(ncopy, name, nlen);
-    const char *iname = ncopy ? ncopy : name;
-
-    XlnkSymbol incoming = {0};
-    incoming.name      = iname;
-    incoming.hash      = h;
-    incoming.dist      = 0;
-    incoming.plt_index = -1;
-    incoming.got_index = -1;
-
+    if (!ncopy) return -1;
+    memcpy(ncopy, name, nlen);
+
+    XlnkSymbol *sym = &t->syms[t->n];
+    memset(sym, 0, sizeof(*sym));
+    sym->name      = ncopy;
+    sym->chunk     = -1;
+    sym->plt_index = -1;
+    sym->got_index = -1;
+    sym->lib       = -1;
+
+    SymSlot incoming = { h, 0, t->n++ };
+    uint32_t idx = h & (t->cap - 1);
     while (1) {
-        XlnkSymbol *s = &t->slots[idx];
-        if (s->hash == 0) {
-            /* Empty slot — check for existing same-name entry first */
-            *s = incoming; s->dist = dist; t->n++;
-            return s;
-        }
-        if (s->hash == h && strcmp(s->name, name) == 0) return s; /* exists */
+        SymSlot *s = &t->slots[idx];
+        if (s->hash == 0) { *s = incoming; return (int)(t->n - 1); }
         /* Robin Hood: steal from rich */
-        if (s->dist < dist) {
-            XlnkSymbol tmp = *s;
-            *s = incoming; s->dist = dist;
+        if (s->dist < incoming.dist) {
+            SymSlot tmp = *s;
+            *s = incoming;
             incoming = tmp;
-            dist = tmp.dist;
         }
         idx = (idx + 1) & (t->cap - 1);
-        dist++;
+        incoming.dist++;
     }
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * A CHUNK OF DATA (one input section → one output region)
  * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* Output sections, in address order.  Everything before OUT_TDATA goes in
+ * the R+X segment, the rest in the R+W one.                              */
+enum {
+    OUT_INTERP, OUT_HASH, OUT_DYNSYM, OUT_DYNSTR, OUT_VERSYM, OUT_VERNEED,
+    OUT_RELA, OUT_RODATA, OUT_TEXT, OUT_PLT,
+    OUT_TDATA, OUT_TBSS, OUT_INIT_ARRAY, OUT_FINI_ARRAY, OUT_DATA, OUT_GOT,
+    OUT_DYNAMIC, OUT_BSS,
+    OUT_COUNT
+};
+#define OUT_FIRST_RW OUT_TDATA
+
+static const struct {
+    const char *name;
+    uint32_t    type;
+    uint64_t    flags;
+    uint64_t    entsize;
+} out_sec[OUT_COUNT] = {
+    { ".interp",            SHT_PROGBITS,    SHF_ALLOC,                 0  },
+    { ".hash",              SHT_HASH,        SHF_ALLOC,                 4  },
+    { ".dynsym",            SHT_DYNSYM,      SHF_ALLOC,                 24 },
+    { ".dynstr",            SHT_STRTAB,      SHF_ALLOC,                 0  },
+    { ".gnu.version",       SHT_GNU_versym,  SHF_ALLOC,                 2  },
+    { ".gnu.version_r",     SHT_GNU_verneed, SHF_ALLOC,                 0  },
+    { ".rela.dyn",          SHT_RELA,        SHF_ALLOC,                 24 },
+    { ".rodata",            SHT_PROGBITS,    SHF_ALLOC,                 0  },
+    { ".text",              SHT_PROGBITS,    SHF_ALLOC|SHF_EXECINSTR,   0  },
+    { ".plt",               SHT_PROGBITS,    SHF_ALLOC|SHF_EXECINSTR,   8  },
+    { ".tdata",             SHT_PROGBITS,    SHF_ALLOC|SHF_WRITE|SHF_TLS, 0 },
+    { ".tbss",              SHT_NOBITS,      SHF_ALLOC|SHF_WRITE|SHF_TLS, 0 },
+    { ".init_array",        SHT_INIT_ARRAY,  SHF_ALLOC|SHF_WRITE,       8  },
+    { ".fini_array",        SHT_FINI_ARRAY,  SHF_ALLOC|SHF_WRITE,       8  },
+    { ".data",              SHT_PROGBITS,    SHF_ALLOC|SHF_WRITE,       0  },
+    { ".got",               SHT_PROGBITS,    SHF_ALLOC|SHF_WRITE,       8  },
+    { ".dynamic",           SHT_DYNAMIC,     SHF_ALLOC|SHF_WRITE,       16 },
+    { ".bss",               SHT_NOBITS,      SHF_ALLOC|SHF_WRITE,       0  },
+};
+
+/* An input object's symbol N: a local (chunk + offset) or a global */
+typedef struct {
+    int      chunk;      /* -1 = absolute or dropped section                */
+    int      gsym;       /* index in the global table, -1 = local           */
+    uint64_t off;
+} ObjSym;
+
 typedef struct {
     const uint8_t *data;     /* points into arena OR directly into mmap'd input */
     size_t         size;
@@ -455,19 +595,40 @@ typedef struct {
     const char    *name;
     Elf64_Rela    *relas;    /* points into arena */
     size_t         n_relas;
-    SymTable      *symtab;
-    int            obj_sym_base;
+    const ObjSym  *osyms;    /* the owning object's symbol table */
+    size_t         n_osyms;
+    int            kind;     /* OUT_* */
     int            is_bss;
     int            is_exec;
     int            is_write;
 } Chunk;
 
-/* PendingReloc for PLT/GOT */
-typedef struct { uint64_t where; int sym_idx, type; int64_t addend; } PendingReloc;
-
 /* Mapped input file */
 typedef struct { const char *path; const uint8_t *data; size_t size; int fd; } MappedFile;
 
+/* A static archive: its symbol index drives member selection */
+typedef struct {
+    const char    *path;
+    const uint8_t *data;
+    size_t         size;
+    uint32_t       n_index;     /* entries in the "/" symbol index          */
+    const uint8_t *index_offs;  /* n_index big-endian member offsets        */
+    const char    *index_names; /* n_index NUL-terminated names             */
+    size_t        *loaded;      /* header offsets of members already pulled */
+    int            n_loaded, cap_loaded;
+} Archive;
+
+/* A shared library named by cfg->sonames */
+typedef struct {
+    const char *soname;
+    MappedFile  mf;
+    int         used;           /* supplies at least one imported symbol   */
+    uint32_t    soname_off;     /* in .dynstr                              */
+} SharedLib;
+
+/* One version requirement (library, version name) → .gnu.version_r */
+typedef struct { int lib; const char *name; uint16_t other; uint32_t name_off; } VerReq;
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * LINKER STATE
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -479,23 +640,43 @@ typedef struct {
     SymTable syms;
 
     /* Arenas (huge-page backed on Linux) */
-    Arena mem_arena;   /* 32 MB: chunk data, reloc tables, sym slots */
+    Arena mem_arena;   /* 32 MB: chunk data, reloc tables, object symbols */
     Arena str_arena;   /* 2 MB: symbol name strings */
 
     /* Section chunks */
     Chunk  *chunks;
     int     n_chunks;
     int     cap_chunks;
-
-    /* Pending PLT/GOT relocs */
-    PendingReloc *pending;
-    int           n_pending;
+    int     syn[OUT_COUNT];   /* synthetic chunk per output section, -1 */
+
+    /* Inputs stay mapped until the output is written (zero-copy chunks) */
+    MappedFile *files;
+    int         n_files, cap_files;
+    Archive     archives[XLNK_MAX_LIBS];
+    int         n_archives;
+    SharedLib   libs[XLNK_MAX_SONAMES];
+    int         n_libs;
+
+    /* GOT / PLT / .dynsym membership, as global symbol indices */
+    int    *got;   int n_got,  cap_got;
+    int    *plt;   int n_plt,  cap_plt;
+    int    *dyn;   int n_dyn,  cap_dyn;   /* dyn[0] unused (null entry) */
+    uint64_t copy_size, copy_align;
+    VerReq  vers[64];
+    int     n_vers;
 
     /* Dynamic linking */
     char   *dynstr;
     size_t  dynstr_len, dynstr_cap;
-    Elf64_Sym *dynsym;
-    int        n_dynsym;
+    uint32_t *dynsym_name;            /* .dynstr offset per .dynsym entry */
+    int     n_needed;
+
+    /* Layout results */
+    uint64_t rx_end_off;              /* end of the R+X segment in the file */
+    uint64_t rw_off, rw_file_end, rw_mem_end;
+    uint64_t tls_start, tls_filesz, tls_memsz, tls_align;
+    int      shndx[OUT_COUNT];        /* section header index per kind, 0 */
+    int      n_shdr;
 
     uint64_t entry_vaddr;
     int      machine;  /* EM_X86_64 or EM_AARCH64 */
@@ -524,18 +705,31 @@ static uint64_t align_up(uint64_t v, uint64_t a) {
     return (a <= 1) ? v : (v + a - 1) & ~(a - 1);
 }
 
+/* Grow an int list by one slot */
+static int list_push(int **v, int *n, int *cap, int x) {
+    if (*n >= *cap) {
+        int nc = *cap ? *cap * 2 : 64;
+        int *nv = (int *)realloc(*v, sizeof(int) * (size_t)nc);
+        if (!nv) return XLNK_ERR_NOMEM;
+        *v = nv; *cap = nc;
+    }
+    (*v)[(*n)++] = x;
+    return XLNK_OK;
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * MEMORY-MAPPED INPUT
  * ═══════════════════════════════════════════════════════════════════════════ */
 static int mmap_file(XlnkState *st, const char *path, MappedFile *mf) {
     mf->path = path;
+    mf->data = NULL;
     mf->fd   = open(path, O_RDONLY);
     if (mf->fd < 0) {
         xlnk_diag(st, XLNK_DIAG_ERROR, "cannot open '%s': %s", path, strerror(errno));
         return XLNK_ERR_OPEN;
     }
     struct stat sb;
-    if (fstat(mf->fd, &sb) < 0) { close(mf->fd); return XLNK_ERR_OPEN; }
+    if (fstat(mf->fd, &sb) < 0) { close(mf->fd); mf->fd = -1; return XLNK_ERR_OPEN; }
     mf->size = (size_t)sb.st_size;
     if (mf->size == 0) { mf->data = NULL; return XLNK_OK; }
 
@@ -549,7 +743,8 @@ static int mmap_file(XlnkState *st, const char *path, MappedFile *mf) {
     mf->data = (const uint8_t *)mmap(NULL, mf->size, PROT_READ, flags, mf->fd, 0);
     if (mf->data == MAP_FAILED) {
         xlnk_diag(st, XLNK_DIAG_ERROR, "mmap '%s': %s", path, strerror(errno));
-        close(mf->fd); return XLNK_ERR_OPEN;
+        mf->data = NULL;
+        close(mf->fd); mf->fd = -1; return XLNK_ERR_OPEN;
     }
 
     /* Sequential read hint */
@@ -574,6 +769,19 @@ static void munmap_file(MappedFile *mf) {
     mf->data = NULL; mf->fd = -1;
 }
 
+/* Map an input and keep it until xlnk_link returns */
+static int map_input(XlnkState *st, const char *path, MappedFile *out) {
+    if (st->n_files >= st->cap_files) {
+        int nc = st->cap_files ? st->cap_files * 2 : 16;
+        MappedFile *nf = (MappedFile *)realloc(st->files, sizeof(MappedFile) * (size_t)nc);
+        if (!nf) return XLNK_ERR_NOMEM;
+        st->files = nf; st->cap_files = nc;
+    }
+    int rc = mmap_file(st, path, out);
+    if (rc == XLNK_OK) st->files[st->n_files++] = *out;
+    return rc;
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
  * CHUNK MANAGEMENT
  * ═══════════════════════════════════════════════════════════════════════════ */
@@ -619,6 +827,21 @@ static int is_elf64(const uint8_t *d, size_t sz) {
            d[4]==ELFCLASS64;
 }
 
+/* Output section for an allocatable input section; -1 = drop it.
+ * .eh_frame is dropped: nothing in a Xenly binary unwinds, and keeping it
+ * would mean building .eh_frame_hdr as well.                              */
+static int chunk_kind(const Elf64_Shdr *sh, const char *name) {
+    if (sh->sh_type == SHT_NOTE || sh->sh_type == SHT_GROUP) return -1;
+    if (strcmp(name, ".eh_frame") == 0) return -1;
+    if (sh->sh_flags & SHF_TLS) return sh->sh_type == SHT_NOBITS ? OUT_TBSS : OUT_TDATA;
+    if (sh->sh_type == SHT_INIT_ARRAY) return OUT_INIT_ARRAY;
+    if (sh->sh_type == SHT_FINI_ARRAY) return OUT_FINI_ARRAY;
+    if (sh->sh_type == SHT_NOBITS)     return OUT_BSS;
+    if (sh->sh_flags & SHF_EXECINSTR)  return OUT_TEXT;
+    if (sh->sh_flags & SHF_WRITE)      return OUT_DATA;
+    return OUT_RODATA;
+}
+
 static int process_elf64(XlnkState *st, const uint8_t *data, size_t size,
                           const char *path) {
     const Elf64_Ehdr *eh = (const Elf64_Ehdr *)data;
@@ -626,7 +849,17 @@ static int process_elf64(XlnkState *st, const uint8_t *data, size_t size,
         xlnk_diag(st, XLNK_DIAG_WARN, "%s: not ET_REL, skipping", path);
         return XLNK_OK;
     }
+    if (eh->e_shoff + (uint64_t)eh->e_shnum * sizeof(Elf64_Shdr) > size ||
+        eh->e_shstrndx >= eh->e_shnum) {
+        xlnk_diag(st, XLNK_DIAG_ERROR, "%s: truncated section header table", path);
+        return XLNK_ERR_FORMAT;
+    }
     if (st->machine == 0) st->machine = eh->e_machine;
+    else if (st->machine != eh->e_machine) {
+        xlnk_diag(st, XLNK_DIAG_ERROR, "%s: machine %u does not match the other inputs",
+                  path, (unsigned)eh->e_machine);
+        return XLNK_ERR_FORMAT;
+    }
 
     const Elf64_Shdr *shdrs = (const Elf64_Shdr *)(data + eh->e_shoff);
     const char *shstr = (const char *)(data + shdrs[eh->e_shstrndx].sh_offset);
@@ -636,41 +869,42 @@ static int process_elf64(XlnkState *st, const uint8_t *data, size_t size,
     size_t            nsyms  = 0;
     const char       *strtab = NULL;
     int               strtab_link = 0;
-    int               first_global = 1;
+    size_t            first_global = 1;
 
     for (int i = 0; i < eh->e_shnum; i++) {
         if (shdrs[i].sh_type == SHT_SYMTAB) {
             symtab       = (const Elf64_Sym *)(data + shdrs[i].sh_offset);
             nsyms        = shdrs[i].sh_size / sizeof(Elf64_Sym);
             strtab_link  = (int)shdrs[i].sh_link;
-            first_global = (int)shdrs[i].sh_info;
+            first_global = shdrs[i].sh_info;
         }
     }
     if (strtab_link > 0 && strtab_link < eh->e_shnum)
         strtab = (const char *)(data + shdrs[strtab_link].sh_offset);
 
     /* Section → chunk mapping */
-    int sec_to_chunk[4096];
-    memset(sec_to_chunk, -1, sizeof(sec_to_chunk));
-
-    int obj_sym_base = st->syms.n;
+    int *sec_to_chunk = (int *)arena_alloc(&st->mem_arena, sizeof(int) * eh->e_shnum, 8);
+    if (!sec_to_chunk) return XLNK_ERR_NOMEM;
+    for (int i = 0; i < eh->e_shnum; i++) sec_to_chunk[i] = -1;
+    int first_chunk = st->n_chunks;
 
     /* Pass 1: create chunks for allocatable sections */
-    for (int i = 1; i < eh->e_shnum && i < 4096; i++) {
+    for (int i = 1; i < eh->e_shnum; i++) {
         const Elf64_Shdr *sh = &shdrs[i];
         if (!(sh->sh_flags & SHF_ALLOC)) continue;
+        int kind = chunk_kind(sh, shstr + sh->sh_name);
+        if (kind < 0) continue;
 
         Chunk *c = new_chunk(st);
         if (!c) return XLNK_ERR_NOMEM;
         c->size        = sh->sh_size;
         c->align       = sh->sh_addralign ? sh->sh_addralign : 1;
-        c->flags       = sh->sh_flags;
+        c->flags       = (uint32_t)sh->sh_flags;
+        c->kind        = kind;
         c->is_exec     = (sh->sh_flags & SHF_EXECINSTR) ? 1 : 0;
         c->is_write    = (sh->sh_flags & SHF_WRITE)     ? 1 : 0;
         c->is_bss      = (sh->sh_type  == SHT_NOBITS)   ? 1 : 0;
         c->name        = shstr + sh->sh_name;
-        c->symtab      = &st->syms;
-        c->obj_sym_base = obj_sym_base;
         sec_to_chunk[i] = st->n_chunks - 1;
 
         if (!c->is_bss && sh->sh_size > 0) {
@@ -689,9 +923,14 @@ static int process_elf64(XlnkState *st, const uint8_t *data, size_t size,
     /* Pass 2: collect RELA tables */
     for (int i = 1; i < eh->e_shnum; i++) {
         const Elf64_Shdr *sh = &shdrs[i];
+        if (sh->sh_type == SHT_REL && sh->sh_info < eh->e_shnum &&
+            sec_to_chunk[sh->sh_info] >= 0) {
+            xlnk_diag(st, XLNK_DIAG_ERROR, "%s: SHT_REL relocations are not supported", path);
+            return XLNK_ERR_UNSUPPORTED;
+        }
         if (sh->sh_type != SHT_RELA) continue;
-        int target = (int)sh->sh_info;
-        if (target < 0 || target >= 4096) continue;
+        uint32_t target = sh->sh_info;
+        if (target >= eh->e_shnum) continue;
         int ci = sec_to_chunk[target];
         if (ci < 0) continue;
         Chunk *c = &st->chunks[ci];
@@ -709,126 +948,620 @@ static int process_elf64(XlnkState *st, const uint8_t *data, size_t size,
         c->n_relas = n;
     }
 
-    /* Pass 3: intern global symbols */
-    if (symtab && strtab) {
-        for (size_t i = (size_t)first_global; i < nsyms; i++) {
+    /* Pass 3: the object's symbols — locals by chunk, globals interned */
+    ObjSym *osyms = NULL;
+    if (symtab && strtab && nsyms) {
+        osyms = (ObjSym *)arena_alloc(&st->mem_arena, sizeof(ObjSym) * nsyms, 8);
+        if (!osyms) return XLNK_ERR_NOMEM;
+        osyms[0].chunk = -1; osyms[0].gsym = -1; osyms[0].off = 0;
+        for (size_t i = 1; i < nsyms; i++) {
             const Elf64_Sym *sym = &symtab[i];
-            if (sym->st_shndx == SHN_UNDEF) continue;
+            ObjSym *o = &osyms[i];
+            unsigned shidx = sym->st_shndx;
+            o->off   = sym->st_value;
+            o->chunk = (shidx > 0 && shidx < eh->e_shnum) ? sec_to_chunk[shidx] : -1;
+            o->gsym  = -1;
+            if (i < first_global) continue;
+
             uint8_t bind = ELF64_ST_BIND(sym->st_info);
-            if (bind != STB_GLOBAL && bind != STB_WEAK) continue;
             const char *sname = strtab + sym->st_name;
-            if (!sname || !*sname) continue;
-
-            XlnkSymbol *s = sym_intern(&st->syms, sname, &st->str_arena);
-            if (!s) continue;
-            if (!s->defined) {
-                int shidx = sym->st_shndx;
-                if (shidx > 0 && shidx < 4096) {
-                    int ci = sec_to_chunk[shidx];
-                    if (ci >= 0) {
-                        /* Encode as chunk-relative: ci in low 32, offset in high 32 */
-                        s->value   = (uint64_t)ci | ((uint64_t)sym->st_value << 32);
-                        s->defined = 1;
-                        s->type    = ELF64_ST_TYPE(sym->st_info);
-                        s->bind    = bind;
-                        s->size    = (uint32_t)sym->st_size;
-                    }
-                } else if (shidx == SHN_ABS) {
-                    s->value   = sym->st_value;
-                    s->defined = 1;
-                }
+            if (!*sname) continue;
+            int gi = sym_intern(&st->syms, sname, &st->str_arena);
+            if (gi < 0) {
+                xlnk_diag(st, XLNK_DIAG_ERROR, "symbol table full (%d entries)", XLNK_MAX_SYMBOLS);
+                return XLNK_ERR_NOMEM;
+            }
+            o->gsym = gi;
+            XlnkSymbol *s = &st->syms.syms[gi];
+
+            if (shidx == SHN_UNDEF) {
+                if (bind != STB_WEAK) s->strong_ref = 1;
+                continue;
+            }
+            if (s->defined && !(s->bind == STB_WEAK && bind == STB_GLOBAL)) continue;
+            if (shidx == SHN_COMMON) {
+                /* Tentative definition: give it its own .bss chunk */
+                Chunk *c = new_chunk(st);
+                if (!c) return XLNK_ERR_NOMEM;
+                c->size = sym->st_size; c->align = sym->st_value ? sym->st_value : 1;
+                c->kind = OUT_BSS; c->is_bss = 1; c->is_write = 1; c->name = ".bss";
+                s->chunk = st->n_chunks - 1;
+                s->value = 0;
+            } else if (shidx == SHN_ABS) {
+                s->chunk = -1;
+                s->value = sym->st_value;
+            } else if (o->chunk >= 0) {
+                s->chunk = o->chunk;
+                s->value = sym->st_value;
+            } else {
+                continue;   /* defined in a dropped section */
             }
+            s->defined = 1;
+            s->type    = ELF64_ST_TYPE(sym->st_info);
+            s->bind    = bind;
+            s->size    = sym->st_size;
         }
     }
+    for (int ci = first_chunk; ci < st->n_chunks; ci++) {
+        st->chunks[ci].osyms   = osyms;
+        st->chunks[ci].n_osyms = osyms ? nsyms : 0;
+    }
     return XLNK_OK;
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
  * AR ARCHIVE PROCESSING
+ *
+ * Members are pulled in only when they define a symbol that is still
+ * undefined, like ld does, by walking the archive's "/" symbol index.
+ * Archives without an index fall back to loading every member.
  * ═══════════════════════════════════════════════════════════════════════════ */
-static int process_ar(XlnkState *st, const uint8_t *data, size_t size,
-                       const char *path) {
-    if (size < AR_MAGIC_LEN || memcmp(data, AR_MAGIC, AR_MAGIC_LEN) != 0) {
-        xlnk_diag(st, XLNK_DIAG_ERROR, "'%s': invalid AR archive", path);
+static uint32_t be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static size_t ar_member_size(const ArHeader *ah) {
+    char sz_buf[11]; memcpy(sz_buf, ah->ar_size, 10); sz_buf[10] = '\0';
+    return (size_t)strtoul(sz_buf, NULL, 10);
+}
+
+static int ar_load_member(XlnkState *st, Archive *a, size_t hdr_off) {
+    for (int i = 0; i < a->n_loaded; i++)
+        if (a->loaded[i] == hdr_off) return 0;
+    if (hdr_off + sizeof(ArHeader) > a->size) return -XLNK_ERR_FORMAT;
+    const ArHeader *ah = (const ArHeader *)(a->data + hdr_off);
+    size_t msz = ar_member_size(ah);
+    const uint8_t *md = a->data + hdr_off + sizeof(ArHeader);
+    if (hdr_off + sizeof(ArHeader) + msz > a->size) return -XLNK_ERR_FORMAT;
+    if (a->n_loaded >= a->cap_loaded) {
+        int nc = a->cap_loaded ? a->cap_loaded * 2 : 16;
+        size_t *nl = (size_t *)realloc(a->loaded, sizeof(size_t) * (size_t)nc);
+        if (!nl) return -XLNK_ERR_NOMEM;
+        a->loaded = nl; a->cap_loaded = nc;
+    }
+    a->loaded[a->n_loaded++] = hdr_off;
+    if (!is_elf64(md, msz)) return 0;
+    int rc = process_elf64(st, md, msz, a->path);
+    return rc == XLNK_OK ? 1 : -rc;
+}
+
+static int process_ar(XlnkState *st, Archive *a) {
+    if (a->size < AR_MAGIC_LEN || memcmp(a->data, AR_MAGIC, AR_MAGIC_LEN) != 0) {
+        xlnk_diag(st, XLNK_DIAG_ERROR, "'%s': invalid AR archive", a->path);
         return XLNK_ERR_FORMAT;
     }
-    const uint8_t *p = data + AR_MAGIC_LEN, *end = data + size;
+    const uint8_t *p = a->data + AR_MAGIC_LEN, *end = a->data + a->size;
+    if (p + sizeof(ArHeader) <= end) {
+        const ArHeader *ah = (const ArHeader *)p;
+        size_t msz = ar_member_size(ah);
+        const uint8_t *md = p + sizeof(ArHeader);
+        if (memcmp(ah->ar_name, "/               ", 16) == 0 && md + msz <= end && msz >= 4) {
+            uint32_t n = be32(md);
+            if (4 + (size_t)n * 4 <= msz) {
+                a->n_index     = n;
+                a->index_offs  = md + 4;
+                a->index_names = (const char *)(md + 4 + (size_t)n * 4);
+                return XLNK_OK;
+            }
+        }
+    }
+    /* No symbol index: load every ELF member */
     while (p + sizeof(ArHeader) <= end) {
         const ArHeader *ah = (const ArHeader *)p;
         if (ah->ar_fmag[0] != '`' || ah->ar_fmag[1] != '\n') break;
-        char sz_buf[11]; memcpy(sz_buf, ah->ar_size, 10); sz_buf[10] = '\0';
-        size_t msz = (size_t)strtoul(sz_buf, NULL, 10);
-        p += sizeof(ArHeader);
-        const uint8_t *md = p;
-        p += msz + (msz & 1);
+        size_t msz = ar_member_size(ah);
+        size_t off = (size_t)(p - a->data);
+        p += sizeof(ArHeader) + msz + (msz & 1);
         /* Skip symbol table and long-name table */
         if (memcmp(ah->ar_name, "/               ", 16) == 0 ||
             memcmp(ah->ar_name, "//              ", 16) == 0 ||
             memcmp(ah->ar_name, "__.SYMDEF",       9)   == 0) continue;
-        if (is_elf64(md, msz)) {
-            int rc = process_elf64(st, md, msz, path);
-            if (rc != XLNK_OK) return rc;
-        }
+        int rc = ar_load_member(st, a, off);
+        if (rc < 0) return -rc;
     }
     return XLNK_OK;
 }
 
+/* One pass over an archive's index: pull every member that defines a
+ * symbol somebody still needs.  Returns the number of members loaded, or
+ * a negated XLNK_ERR_* code.                                              */
+static int ar_pull(XlnkState *st, Archive *a) {
+    int pulled = 0;
+    const char *name = a->index_names;
+    const char *names_end = (const char *)a->data + a->size;
+    for (uint32_t k = 0; k < a->n_index && name < names_end; k++) {
+        size_t len = strnlen(name, (size_t)(names_end - name));
+        int gi = sym_find(&st->syms, name);
+        if (gi >= 0) {
+            const XlnkSymbol *s = &st->syms.syms[gi];
+            if (!s->defined && s->strong_ref) {
+                int rc = ar_load_member(st, a, be32(a->index_offs + 4 * k));
+                if (rc < 0) return rc;
+                pulled += rc;
+            }
+        }
+        name += len + 1;
+    }
+    return pulled;
+}
+
 /* ═══════════════════════════════════════════════════════════════════════════
- * LAYOUT  — assign virtual addresses and file offsets
+ * SHARED LIBRARIES  — resolve the remaining undefined symbols by name
+ *
+ * Only .dynsym is read.  A symbol is taken from the first library (in
+ * cfg->sonames order) that exports a default-version definition; the
+ * version is recorded so .gnu.version_r can ask ld.so for exactly that one.
  * ═══════════════════════════════════════════════════════════════════════════ */
-static int xlnk_chunk_cmp(const void *a, const void *b) {
-    const Chunk *ca = (const Chunk *)a, *cb = (const Chunk *)b;
-    int ka = (ca->is_write ? 2 : 0) + (ca->is_bss ? 1 : 0);
-    int kb = (cb->is_write ? 2 : 0) + (cb->is_bss ? 1 : 0);
-    return ka - kb;
+static const char *xlnk_default_libdirs[] = {
+#if defined(__x86_64__)
+    "/lib/x86_64-linux-gnu", "/usr/lib/x86_64-linux-gnu",
+#elif defined(__aarch64__)
+    "/lib/aarch64-linux-gnu", "/usr/lib/aarch64-linux-gnu",
+#endif
+    "/lib64", "/usr/lib64", "/lib", "/usr/lib", NULL
+};
+
+static int shlib_open(XlnkState *st, SharedLib *L) {
+    char path[1024];
+    const char *found = NULL;
+    if (strchr(L->soname, '/')) {
+        if (access(L->soname, R_OK) == 0) found = L->soname;
+    } else {
+        for (int pass = 0; pass < 2 && !found; pass++) {
+            const char *const *dirs = pass == 0 ? st->cfg->libdirs : xlnk_default_libdirs;
+            int n = pass == 0 ? st->cfg->n_libdirs : 1 << 20;
+            for (int i = 0; i < n && dirs[i]; i++) {
+                snprintf(path, sizeof(path), "%s/%s", dirs[i], L->soname);
+                if (access(path, R_OK) == 0) { found = path; break; }
+            }
+        }
+    }
+    if (!found) {
+        if (st->cfg->verbose)
+            xlnk_diag(st, XLNK_DIAG_INFO, "'%s' not found — skipping", L->soname);
+        return XLNK_ERR_OPEN;
+    }
+    size_t n = strlen(found) + 1;
+    char *keep = (char *)arena_alloc(&st->str_arena, n, 1);
+    if (!keep) return XLNK_ERR_NOMEM;
+    memcpy(keep, found, n);
+    return map_input(st, keep, &L->mf);
 }
 
-static int layout_elf64(XlnkState *st) {
-    const XlnkConfig *cfg = st->cfg;
-    uint64_t base = cfg->base_address ? cfg->base_address : 0x400000ULL;
-    if (!cfg->is_static) base = 0;
+static void shlib_resolve(XlnkState *st, int li) {
+    const uint8_t *d = st->libs[li].mf.data;
+    size_t sz = st->libs[li].mf.size;
+    if (!is_elf64(d, sz)) return;
+    const Elf64_Ehdr *eh = (const Elf64_Ehdr *)d;
+    if (eh->e_type != ET_DYN || (st->machine && eh->e_machine != st->machine)) return;
+    if (eh->e_shoff + (uint64_t)eh->e_shnum * sizeof(Elf64_Shdr) > sz) return;
+    const Elf64_Shdr *sh = (const Elf64_Shdr *)(d + eh->e_shoff);
+
+    const Elf64_Sym *dsym = NULL; size_t nsym = 0; const char *dstr = NULL;
+    const uint16_t *versym = NULL;
+    const Elf64_Shdr *verdef = NULL;
+    for (int i = 0; i < eh->e_shnum; i++) {
+        if (sh[i].sh_type == SHT_DYNSYM && sh[i].sh_link < eh->e_shnum) {
+            dsym = (const Elf64_Sym *)(d + sh[i].sh_offset);
+            nsym = sh[i].sh_size / sizeof(Elf64_Sym);
+            dstr = (const char *)(d + sh[sh[i].sh_link].sh_offset);
+        } else if (sh[i].sh_type == SHT_GNU_versym) {
+            versym = (const uint16_t *)(d + sh[i].sh_offset);
+        } else if (sh[i].sh_type == SHT_GNU_verdef) {
+            verdef = &sh[i];
+        }
+    }
+    if (!dsym || !dstr) return;
+
+    /* version index → name */
+    const char *vnames[256] = {0};
+    if (verdef && verdef->sh_link < eh->e_shnum) {
+        const char *vstr = (const char *)(d + sh[verdef->sh_link].sh_offset);
+        size_t off = verdef->sh_offset;
+        for (uint64_t k = 0; k < verdef->sh_info && off + sizeof(Elf64_Verdef) <= sz; k++) {
+            const Elf64_Verdef *vd = (const Elf64_Verdef *)(d + off);
+            if (vd->vd_cnt && vd->vd_ndx < 256 && off + vd->vd_aux + sizeof(Elf64_Verdaux) <= sz) {
+                const Elf64_Verdaux *va = (const Elf64_Verdaux *)(d + off + vd->vd_aux);
+                vnames[vd->vd_ndx] = vstr + va->vda_name;
+            }
+            if (!vd->vd_next) break;
+            off += vd->vd_next;
+        }
+    }
 
-    qsort(st->chunks, (size_t)st->n_chunks, sizeof(Chunk), xlnk_chunk_cmp);
+    for (size_t i = 1; i < nsym; i++) {
+        const Elf64_Sym *ds = &dsym[i];
+        uint8_t bind = ELF64_ST_BIND(ds->st_info), type = ELF64_ST_TYPE(ds->st_info);
+        if (ds->st_shndx == SHN_UNDEF || (bind != STB_GLOBAL && bind != STB_WEAK)) continue;
+        if (type == STT_TLS) continue;             /* would need TLS dyn relocs */
+        uint16_t ver = versym ? versym[i] : 1;
+        if (ver & VER_HIDDEN) continue;            /* not the default version */
+        int gi = sym_find(&st->syms, dstr + ds->st_name);
+        if (gi < 0) continue;
+        XlnkSymbol *s = &st->syms.syms[gi];
+        if (s->defined || s->lib >= 0) continue;
+        s->lib     = li;
+        s->type    = type == STT_GNU_IFUNC ? STT_FUNC : type;
+        s->size    = ds->st_size;
+        s->value   = ds->st_value;               /* only its alignment is used */
+        s->version = (ver >= 2 && ver < 256) ? vnames[ver] : NULL;
+    }
+}
 
-    size_t ehdr_sz = sizeof(Elf64_Ehdr);
-    int    nphdr   = cfg->is_static ? 2 : 5;
-    size_t phdr_sz = (size_t)nphdr * sizeof(Elf64_Phdr);
+/* ═══════════════════════════════════════════════════════════════════════════
+ * RELOCATION SCAN  — decide which symbols need GOT slots, PLT stubs,
+ * copy relocations and .dynsym entries before anything is laid out
+ * ═══════════════════════════════════════════════════════════════════════════ */
+/* mov foo@GOTPCREL(%rip), %reg → lea foo(%rip), %reg, as ld does */
+static int got_relaxable(const Chunk *c, const Elf64_Rela *r) {
+    uint32_t type = (uint32_t)ELF64_R_TYPE(r->r_info);
+    return (type == R_X86_64_GOTPCRELX || type == R_X86_64_REX_GOTPCRELX) &&
+           r->r_offset >= 2 && c->data[r->r_offset - 2] == 0x8b;
+}
+
+static int need_dynsym(XlnkState *st, int gi) {
+    XlnkSymbol *s = &st->syms.syms[gi];
+    if (s->dynsym_index) return XLNK_OK;
+    if (st->n_dyn == 0 && list_push(&st->dyn, &st->n_dyn, &st->cap_dyn, -1)) return XLNK_ERR_NOMEM;
+    s->dynsym_index = st->n_dyn;
+    st->libs[s->lib].used = 1;
+    return list_push(&st->dyn, &st->n_dyn, &st->cap_dyn, gi);
+}
+
+static int need_got(XlnkState *st, int gi) {
+    XlnkSymbol *s = &st->syms.syms[gi];
+    if (s->got_index >= 0) return XLNK_OK;
+    s->got_index = st->n_got;
+    if (list_push(&st->got, &st->n_got, &st->cap_got, gi)) return XLNK_ERR_NOMEM;
+    return s->lib >= 0 ? need_dynsym(st, gi) : XLNK_OK;
+}
+
+static int need_plt(XlnkState *st, int gi) {
+    XlnkSymbol *s = &st->syms.syms[gi];
+    if (s->plt_index >= 0) return XLNK_OK;
+    s->plt_index = st->n_plt;
+    if (list_push(&st->plt, &st->n_plt, &st->cap_plt, gi)) return XLNK_ERR_NOMEM;
+    return need_got(st, gi);
+}
+
+static int need_copy(XlnkState *st, int gi) {
+    XlnkSymbol *s = &st->syms.syms[gi];
+    if (s->copy) return XLNK_OK;
+    /* The library's own alignment is not in .dynsym; its address is the
+     * best hint (capped at 32 bytes).                                     */
+    uint64_t a = s->value ? (s->value & (~s->value + 1)) : 16;
+    if (a > 32) a = 32;
+    if (a < 1)  a = 1;
+    s->copy     = 1;
+    s->copy_off = align_up(st->copy_size, a);
+    st->copy_size = s->copy_off + s->size;
+    if (a > st->copy_align) st->copy_align = a;
+    return need_dynsym(st, gi);
+}
+
+static int scan_relocations(XlnkState *st) {
+    for (int ci = 0; ci < st->n_chunks; ci++) {
+        const Chunk *c = &st->chunks[ci];
+        for (size_t ri = 0; ri < c->n_relas; ri++) {
+            const Elf64_Rela *r = &c->relas[ri];
+            uint32_t type = (uint32_t)ELF64_R_TYPE(r->r_info);
+            uint64_t si   = ELF64_R_SYM(r->r_info);
+            if (si >= c->n_osyms) {
+                if (type == R_X86_64_NONE) continue;
+                xlnk_diag(st, XLNK_DIAG_ERROR, "%s: bad symbol index %llu",
+                          c->name, (unsigned long long)si);
+                return XLNK_ERR_FORMAT;
+            }
+            int gi = c->osyms[si].gsym;
+            const XlnkSymbol *s = gi >= 0 ? &st->syms.syms[gi] : NULL;
+            int imported = s && !s->defined && s->lib >= 0;
 
-    uint64_t cur_off = ehdr_sz + phdr_sz;
-    uint64_t cur_va  = base + cur_off;
+            if (st->machine == EM_AARCH64) {
+                if (imported) {
+                    xlnk_diag(st, XLNK_DIAG_ERROR,
+                              "'%s': AArch64 imports from shared libraries are not supported",
+                              s->name);
+                    return XLNK_ERR_UNSUPPORTED;
+                }
+                continue;
+            }
 
+            switch (type) {
+            case R_X86_64_NONE:
+            case R_X86_64_TPOFF32:
+            case R_X86_64_TPOFF64:
+                break;
+            case R_X86_64_GOTPCREL:
+            case R_X86_64_GOTPCRELX:
+            case R_X86_64_REX_GOTPCRELX:
+            case R_X86_64_GOTTPOFF: {
+                int relax = type != R_X86_64_GOTTPOFF && got_relaxable(c, r) &&
+                            (!s || s->defined);
+                if (relax) break;
+                if (!s || (type == R_X86_64_GOTTPOFF && imported)) {
+                    xlnk_diag(st, XLNK_DIAG_ERROR, "%s+0x%llx: unsupported GOT reference",
+                              c->name, (unsigned long long)r->r_offset);
+                    return XLNK_ERR_UNSUPPORTED;
+                }
+                if (need_got(st, gi)) return XLNK_ERR_NOMEM;
+                break;
+            }
+            case R_X86_64_64:
+            case R_X86_64_PC32:
+            case R_X86_64_PLT32:
+            case R_X86_64_32:
+            case R_X86_64_32S:
+            case R_X86_64_PC64:
+                if (imported) {
+                    int rc = (s->type == STT_OBJECT) ? need_copy(st, gi) : need_plt(st, gi);
+                    if (rc) return rc;
+                }
+                break;
+            default:
+                xlnk_diag(st, XLNK_DIAG_ERROR,
+                          "unhandled x86-64 reloc %u in %s", type, c->name);
+                return XLNK_ERR_UNSUPPORTED;
+            }
+        }
+    }
+    return XLNK_OK;
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * SYNTHETIC SECTIONS  — sized here, filled once addresses are known
+ * ═══════════════════════════════════════════════════════════════════════════ */
+static int add_synthetic(XlnkState *st, int kind, size_t size, size_t align) {
+    Chunk *c = new_chunk(st);
+    if (!c) return XLNK_ERR_NOMEM;
+    c->kind     = kind;
+    c->name     = out_sec[kind].name;
+    c->size     = size;
+    c->align    = align;
+    c->is_exec  = (out_sec[kind].flags & SHF_EXECINSTR) ? 1 : 0;
+    c->is_write = (out_sec[kind].flags & SHF_WRITE) ? 1 : 0;
+    c->is_bss   = out_sec[kind].type == SHT_NOBITS;
+    if (!c->is_bss && size) {
+        c->data = (uint8_t *)arena_zalloc(&st->mem_arena, size, 16);
+        if (!c->data) return XLNK_ERR_NOMEM;
+    }
+    st->syn[kind] = st->n_chunks - 1;
+    return XLNK_OK;
+}
+
+static uint32_t elf_hash(const char *name) {
+    uint32_t h = 0, g;
+    for (const unsigned char *p = (const unsigned char *)name; *p; p++) {
+        h = (h << 4) + *p;
+        g = h & 0xf0000000u;
+        if (g) h ^= g >> 24;
+        h &= ~g;
+    }
+    return h;
+}
+
+static const char *xlnk_interp(const XlnkConfig *cfg) {
+    if (cfg->interp) return cfg->interp;
+#if defined(__aarch64__) || defined(__arm64__)
+    return "/lib/ld-linux-aarch64.so.1";
+#else
+    return "/lib64/ld-linux-x86-64.so.2";
+#endif
+}
+
+static int has_kind(const XlnkState *st, int kind, uint64_t *start, uint64_t *size) {
+    uint64_t lo = 0, hi = 0; int any = 0;
     for (int i = 0; i < st->n_chunks; i++) {
-        Chunk *c = &st->chunks[i];
-        if (c->is_write) break;
-        cur_off = align_up(cur_off, c->align);
-        cur_va  = align_up(cur_va,  c->align);
-        c->file_off = cur_off;
-        c->vaddr    = cur_va;
-        if (!c->is_bss) cur_off += c->size;
-        cur_va += c->size;
+        const Chunk *c = &st->chunks[i];
+        if (c->kind != kind) continue;
+        if (!any || c->vaddr < lo) lo = c->vaddr;
+        if (!any || c->vaddr + c->size > hi) hi = c->vaddr + c->size;
+        any = 1;
     }
-    cur_off = align_up(cur_off, 0x1000);
-    cur_va  = align_up(cur_va,  0x1000);
+    if (start) *start = lo;
+    if (size)  *size  = hi - lo;
+    return any;
+}
 
+static int dynamic_count(const XlnkState *st, int n_rela) {
+    int n = st->n_needed + 6;                   /* HASH STRTAB SYMTAB STRSZ SYMENT DEBUG */
+    if (n_rela) n += 3;                         /* RELA RELASZ RELAENT       */
+    if (st->n_vers) n += 3;                     /* VERSYM VERNEED VERNEEDNUM */
+    if (has_kind(st, OUT_INIT_ARRAY, NULL, NULL)) n += 2;
+    if (has_kind(st, OUT_FINI_ARRAY, NULL, NULL)) n += 2;
+    return n + 3;                               /* FLAGS FLAGS_1 NULL        */
+}
+
+/* Size every synthetic section.  Called after scan_relocations. */
+static int create_synthetic(XlnkState *st) {
+    const XlnkConfig *cfg = st->cfg;
+    int rc;
+
+    /* GOT, PLT and the copy area exist in static links too */
+    if ((rc = add_synthetic(st, OUT_PLT, (size_t)st->n_plt * 8, 8))) return rc;
+    if (st->copy_size) {
+        if ((rc = add_synthetic(st, OUT_BSS, st->copy_size, st->copy_align))) return rc;
+        st->chunks[st->n_chunks - 1].name = ".dynbss";
+        st->syn[OUT_BSS] = -1;
+        for (int k = 1; k < st->n_dyn; k++) {
+            XlnkSymbol *s = &st->syms.syms[st->dyn[k]];
+            if (s->copy) s->chunk = st->n_chunks - 1;
+        }
+    }
+    if (cfg->is_static) return XLNK_OK;
+
+    /* .dynstr: symbol names, needed sonames, version names */
+    if (st->n_dyn == 0 && list_push(&st->dyn, &st->n_dyn, &st->cap_dyn, -1)) return XLNK_ERR_NOMEM;
+    dynstr_add(st, "");
+    st->dynsym_name = (uint32_t *)arena_zalloc(&st->mem_arena, sizeof(uint32_t) * (size_t)st->n_dyn, 4);
+    if (!st->dynsym_name) return XLNK_ERR_NOMEM;
+    for (int k = 1; k < st->n_dyn; k++)
+        st->dynsym_name[k] = dynstr_add(st, st->syms.syms[st->dyn[k]].name);
+    for (int li = 0; li < st->n_libs; li++) {
+        if (!st->libs[li].used) continue;
+        st->libs[li].soname_off = dynstr_add(st, st->libs[li].soname);
+        st->n_needed++;
+    }
+    for (int k = 1; k < st->n_dyn; k++) {
+        const XlnkSymbol *s = &st->syms.syms[st->dyn[k]];
+        if (!s->version) continue;
+        int v;
+        for (v = 0; v < st->n_vers; v++)
+            if (st->vers[v].lib == s->lib && strcmp(st->vers[v].name, s->version) == 0) break;
+        if (v < st->n_vers) continue;
+        if (st->n_vers >= (int)(sizeof(st->vers) / sizeof(st->vers[0]))) {
+            xlnk_diag(st, XLNK_DIAG_ERROR, "too many symbol versions");
+            return XLNK_ERR_UNSUPPORTED;
+        }
+        st->vers[v].lib      = s->lib;
+        st->vers[v].name     = s->version;
+        st->vers[v].other    = (uint16_t)(2 + v);
+        st->vers[v].name_off = dynstr_add(st, s->version);
+        st->n_vers++;
+    }
+
+    const char *interp = xlnk_interp(cfg);
+    int n_rela = 0;
+    for (int k = 0; k < st->n_got; k++)
+        if (st->syms.syms[st->got[k]].lib >= 0) n_rela++;
+    for (int k = 1; k < st->n_dyn; k++)
+        if (st->syms.syms[st->dyn[k]].copy) n_rela++;
+    int nbucket = st->n_dyn / 2 + 1;
+    int n_verlibs = 0;
+    for (int li = 0; li < st->n_libs; li++) {
+        int any = 0;
+        for (int v = 0; v < st->n_vers; v++) if (st->vers[v].lib == li) any = 1;
+        n_verlibs += any;
+    }
+
+    if ((rc = add_synthetic(st, OUT_INTERP, strlen(interp) + 1, 1))) return rc;
+    memcpy((void *)st->chunks[st->syn[OUT_INTERP]].data, interp, strlen(interp) + 1);
+    if ((rc = add_synthetic(st, OUT_HASH, (size_t)(2 + nbucket + st->n_dyn) * 4, 8))) return rc;
+    if ((rc = add_synthetic(st, OUT_DYNSYM, (size_t)st->n_dyn * sizeof(Elf64_Sym), 8))) return rc;
+    if ((rc = add_synthetic(st, OUT_DYNSTR, 0, 1))) return rc;
+    st->chunks[st->syn[OUT_DYNSTR]].size = st->dynstr_len;
+    st->chunks[st->syn[OUT_DYNSTR]].data = (const uint8_t *)st->dynstr;
+    if (st->n_vers) {
+        if ((rc = add_synthetic(st, OUT_VERSYM, (size_t)st->n_dyn * 2, 2))) return rc;
+        if ((rc = add_synthetic(st, OUT_VERNEED,
+                                (size_t)n_verlibs * sizeof(Elf64_Verneed) +
+                                (size_t)st->n_vers * sizeof(Elf64_Vernaux), 8))) return rc;
+    }
+    if (n_rela && (rc = add_synthetic(st, OUT_RELA, (size_t)n_rela * sizeof(Elf64_Rela), 8)))
+        return rc;
+    return add_synthetic(st, OUT_DYNAMIC, (size_t)dynamic_count(st, n_rela) * sizeof(Elf64_Dyn), 8);
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * LAYOUT  — assign virtual addresses and file offsets
+ *
+ * Non-PIE: the image sits at cfg->base_address (default 0x400000).  One
+ * R+X segment holds the headers, the dynamic-linking tables, .rodata,
+ * .text and .plt; the R+W segment starts on the next page with the TLS
+ * template, .data, .got, .dynamic, then the zero-fill sections.
+ * ═══════════════════════════════════════════════════════════════════════════ */
+static int layout_count_phdrs(const XlnkState *st) {
+    int n = 2;                                       /* LOAD(rx) GNU_STACK   */
+    if (!st->cfg->is_static) n += 3;                 /* PHDR INTERP DYNAMIC  */
+    n += 1;                                          /* LOAD(rw)             */
+    for (int i = 0; i < st->n_chunks; i++)
+        if (st->chunks[i].kind == OUT_TDATA || st->chunks[i].kind == OUT_TBSS) return n + 1;
+    return n;
+}
+
+static void place(Chunk *c, uint64_t *off, uint64_t *va, int file) {
+    *off = align_up(*off, c->align);
+    *va  = align_up(*va,  c->align);
+    c->file_off = *off;
+    c->vaddr    = *va;
+    if (file) *off += c->size;
+    *va += c->size;
+}
+
+static int chunk_is_cold(const Chunk *c) {
+    return c->kind == OUT_TEXT && c->name && strncmp(c->name, ".text.unlikely", 14) == 0;
+}
+
+static int layout_elf64(XlnkState *st) {
+    const XlnkConfig *cfg = st->cfg;
+    uint64_t base = cfg->base_address ? cfg->base_address : 0x400000ULL;
+
+    uint64_t off = sizeof(Elf64_Ehdr) + (uint64_t)layout_count_phdrs(st) * sizeof(Elf64_Phdr);
+    uint64_t va  = base + off;
+
+    /* R+X: one pass per output section keeps input order inside it; cold
+     * code (.text.unlikely*) goes after the rest of .text, off the pages
+     * the hot path runs on */
+    for (int k = 0; k < OUT_FIRST_RW; k++)
+        for (int cold = 0; cold < 2; cold++)
+            for (int i = 0; i < st->n_chunks; i++)
+                if (st->chunks[i].kind == k && chunk_is_cold(&st->chunks[i]) == cold)
+                    place(&st->chunks[i], &off, &va, 1);
+    st->rx_end_off = off;
+
+    off = align_up(off, 0x1000);
+    va  = base + off;
+    st->rw_off = off;
+
+    /* TLS template: .tdata in the file, .tbss only in the TLS block */
+    st->tls_start = va; st->tls_align = 1;
     for (int i = 0; i < st->n_chunks; i++) {
         Chunk *c = &st->chunks[i];
-        if (!c->is_write) continue;
-        cur_off = align_up(cur_off, c->align);
-        cur_va  = align_up(cur_va,  c->align);
-        c->file_off = cur_off;
-        c->vaddr    = cur_va;
-        if (!c->is_bss) cur_off += c->size;
-        cur_va += c->size;
+        if (c->kind != OUT_TDATA) continue;
+        place(c, &off, &va, 1);
+        if (c->align > st->tls_align) st->tls_align = c->align;
+    }
+    st->tls_filesz = va - st->tls_start;
+    {
+        uint64_t tva = va, toff = off;
+        for (int i = 0; i < st->n_chunks; i++) {
+            Chunk *c = &st->chunks[i];
+            if (c->kind != OUT_TBSS) continue;
+            place(c, &toff, &tva, 0);
+            if (c->align > st->tls_align) st->tls_align = c->align;
+        }
+        st->tls_memsz = tva - st->tls_start;
     }
 
-    /* Fix up symbol values: chunk-index tag → absolute VA */
-    for (uint32_t i = 0; i < st->syms.cap; i++) {
-        XlnkSymbol *s = &st->syms.slots[i];
-        if (!s->hash || !s->defined) continue;
-        uint64_t ci  = s->value & 0xFFFFFFFFULL;
-        uint64_t off = s->value >> 32;
-        if (ci < (uint64_t)st->n_chunks)
-            s->value = st->chunks[ci].vaddr + off;
+    for (int k = OUT_INIT_ARRAY; k < OUT_COUNT; k++) {
+        int file = out_sec[k].type != SHT_NOBITS;
+        for (int i = 0; i < st->n_chunks; i++)
+            if (st->chunks[i].kind == k) place(&st->chunks[i], &off, &va, file);
+        if (k == OUT_DYNAMIC) st->rw_file_end = off;
+    }
+    st->rw_mem_end = va;
+
+    /* Symbol values: chunk offset → absolute VA */
+    for (uint32_t i = 0; i < st->syms.n; i++) {
+        XlnkSymbol *s = &st->syms.syms[i];
+        if (s->defined) {
+            if (s->chunk >= 0) s->value += st->chunks[s->chunk].vaddr;
+        } else if (s->copy) {
+            s->value = st->chunks[s->chunk].vaddr + s->copy_off;
+        } else if (s->plt_index >= 0) {
+            s->value = st->chunks[st->syn[OUT_PLT]].vaddr + (uint64_t)s->plt_index * 8;
+        } else {
+            s->value = 0;   /* undefined weak, or reached only through the GOT */
+        }
     }
 
     /* Find entry point
@@ -846,14 +1579,15 @@ static int layout_elf64(XlnkState *st) {
         candidates[ncandidates++] = "_start";  /* ELF CRT0 fallback           */
         candidates[ncandidates++] = "start";   /* bare fallback               */
 
-        XlnkSymbol *esym = NULL;
+        const XlnkSymbol *esym = NULL;
         const char *ename = candidates[0];
         for (int ci = 0; ci < ncandidates; ci++) {
-            esym = sym_find(&st->syms, candidates[ci]);
-            if (esym && esym->defined) { ename = candidates[ci]; break; }
-            esym = NULL;
+            int gi = sym_find(&st->syms, candidates[ci]);
+            if (gi >= 0 && st->syms.syms[gi].defined) {
+                esym = &st->syms.syms[gi]; ename = candidates[ci]; break;
+            }
         }
-        if (esym && esym->defined) {
+        if (esym) {
             st->entry_vaddr = esym->value;
             if (cfg->verbose)
                 xlnk_diag(st, XLNK_DIAG_INFO, "entry: '%s' @ 0x%llx",
@@ -870,6 +1604,23 @@ static int layout_elf64(XlnkState *st) {
 /* ═══════════════════════════════════════════════════════════════════════════
  * RELOCATION APPLICATION  — x86-64
  * ═══════════════════════════════════════════════════════════════════════════ */
+
+/* S: the address a relocation's symbol resolved to */
+static uint64_t reloc_sym_value(const XlnkState *st, const Chunk *c, uint64_t si) {
+    const ObjSym *o = &c->osyms[si];
+    if (o->gsym >= 0) return st->syms.syms[o->gsym].value;
+    return o->chunk >= 0 ? st->chunks[o->chunk].vaddr + o->off : o->off;
+}
+
+/* Variant II TLS: the block ends at the thread pointer */
+static int64_t tpoff(const XlnkState *st, uint64_t S) {
+    return (int64_t)(S - st->tls_start) - (int64_t)align_up(st->tls_memsz, st->tls_align);
+}
+
+static uint64_t got_slot(const XlnkState *st, int got_index) {
+    return st->chunks[st->syn[OUT_GOT]].vaddr + (uint64_t)got_index * 8;
+}
+
 static int apply_relocations_x86_64(XlnkState *st) {
     for (int ci = 0; ci < st->n_chunks; ci++) {
         Chunk *c = &st->chunks[ci];
@@ -879,42 +1630,67 @@ static int apply_relocations_x86_64(XlnkState *st) {
         for (size_t ri = 0; ri < c->n_relas; ri++) {
             const Elf64_Rela *r = &c->relas[ri];
             uint32_t type   = (uint32_t)ELF64_R_TYPE(r->r_info);
+            uint64_t si     = ELF64_R_SYM(r->r_info);
             uint64_t offset = r->r_offset;
             int64_t  addend = r->r_addend;
             if (XLNK_UNLIKELY(offset >= c->size)) continue;
+            if (type == R_X86_64_NONE) continue;
 
             uint8_t  *p = (uint8_t *)c->data + offset;
             uint64_t  P = c->vaddr + offset;
+            uint64_t  S = reloc_sym_value(st, c, si);
+            int       gi = c->osyms[si].gsym;
+            int64_t   val;
 
             switch (type) {
-            case R_X86_64_NONE: break;
             case R_X86_64_64:
-                *(int64_t *)p = addend; break;
+                val = (int64_t)(S + (uint64_t)addend);
+                memcpy(p, &val, 8); continue;
+            case R_X86_64_PC64:
+                val = (int64_t)(S + (uint64_t)addend - P);
+                memcpy(p, &val, 8); continue;
+            case R_X86_64_TPOFF64:
+                val = tpoff(st, S) + addend;
+                memcpy(p, &val, 8); continue;
             case R_X86_64_PC32:
             case R_X86_64_PLT32:
+                val = (int64_t)(S + (uint64_t)addend - P);
+                break;
             case R_X86_64_GOTPCREL:
             case R_X86_64_GOTPCRELX:
-            case R_X86_64_REX_GOTPCRELX: {
-                int64_t val = addend - (int64_t)P;
-                if (XLNK_UNLIKELY(val < INT32_MIN || val > INT32_MAX)) {
-                    xlnk_diag(st, XLNK_DIAG_ERROR,
-                              "PC32 overflow in %s+0x%llx", c->name,
-                              (unsigned long long)offset);
-                    return XLNK_ERR_RELOC;
+            case R_X86_64_REX_GOTPCRELX:
+            case R_X86_64_GOTTPOFF:
+                if (gi >= 0 && st->syms.syms[gi].got_index >= 0) {
+                    val = (int64_t)(got_slot(st, st->syms.syms[gi].got_index) + (uint64_t)addend - P);
+                } else {
+                    p[-2] = 0x8d;                      /* relaxed: mov → lea */
+                    val = (int64_t)(S + (uint64_t)addend - P);
                 }
-                *(int32_t *)p = (int32_t)val; break;
-            }
+                break;
+            case R_X86_64_TPOFF32:
+                val = tpoff(st, S) + addend;
+                break;
             case R_X86_64_32:
-                *(uint32_t *)p = (uint32_t)addend; break;
+                val = (int64_t)(S + (uint64_t)addend);
+                if (XLNK_UNLIKELY(val < 0 || val > (int64_t)UINT32_MAX)) goto overflow;
+                { uint32_t u = (uint32_t)val; memcpy(p, &u, 4); }
+                continue;
             case R_X86_64_32S:
-                *(int32_t  *)p = (int32_t)addend;  break;
-            case R_X86_64_RELATIVE:
-                *(int64_t  *)p = (int64_t)(st->chunks[0].vaddr + addend); break;
+                val = (int64_t)(S + (uint64_t)addend);
+                break;
             default:
-                xlnk_diag(st, XLNK_DIAG_WARN,
+                xlnk_diag(st, XLNK_DIAG_ERROR,
                           "unhandled x86-64 reloc %u in %s", type, c->name);
-                break;
+                return XLNK_ERR_UNSUPPORTED;
             }
+            if (XLNK_UNLIKELY(val < INT32_MIN || val > INT32_MAX)) goto overflow;
+            { int32_t v32 = (int32_t)val; memcpy(p, &v32, 4); }
+            continue;
+        overflow:
+            xlnk_diag(st, XLNK_DIAG_ERROR,
+                      "relocation %u overflow in %s+0x%llx", type, c->name,
+                      (unsigned long long)offset);
+            return XLNK_ERR_RELOC;
         }
     }
     return XLNK_OK;
@@ -933,15 +1709,16 @@ static int apply_relocations_aarch64(XlnkState *st) {
             const Elf64_Rela *r = &c->relas[ri];
             uint32_t type   = (uint32_t)ELF64_R_TYPE(r->r_info);
             uint64_t offset = r->r_offset;
-            int64_t  addend = r->r_addend;
             if (XLNK_UNLIKELY(offset >= c->size || !c->data)) continue;
+            if (type == R_AARCH64_NONE) continue;
+            int64_t  addend = (int64_t)(reloc_sym_value(st, c, ELF64_R_SYM(r->r_info)) +
+                                        (uint64_t)r->r_addend);     /* S + A */
 
             uint8_t  *p    = (uint8_t *)c->data + offset;
             uint64_t  P    = c->vaddr + offset;
             uint32_t  insn = *(uint32_t *)p;
 
             switch (type) {
-            case R_AARCH64_NONE: break;
             case R_AARCH64_ABS64:  *(int64_t *)p = addend;                break;
             case R_AARCH64_PREL32: *(int32_t *)p = (int32_t)(addend-(int64_t)P); break;
             case R_AARCH64_ADR_PREL_PG_HI21: {
@@ -953,20 +1730,27 @@ static int apply_relocations_aarch64(XlnkState *st) {
             }
             case R_AARCH64_ADD_ABS_LO12_NC:
             case R_AARCH64_LDST8_ABS_LO12_NC:
+                *(uint32_t *)p = (insn & ~(0xFFF<<10)) | ((uint32_t)(addend & 0xFFF)<<10);
+                break;
             case R_AARCH64_LDST16_ABS_LO12_NC:
             case R_AARCH64_LDST32_ABS_LO12_NC:
-            case R_AARCH64_LDST64_ABS_LO12_NC:
-                *(uint32_t *)p = (insn & ~(0xFFF<<10)) | ((uint32_t)(addend & 0xFFF)<<10);
+            case R_AARCH64_LDST64_ABS_LO12_NC: {
+                /* the imm12 of a scaled load/store counts access-size units */
+                int sh = type == R_AARCH64_LDST16_ABS_LO12_NC ? 1 :
+                         type == R_AARCH64_LDST32_ABS_LO12_NC ? 2 : 3;
+                *(uint32_t *)p = (insn & ~(0xFFF<<10)) |
+                                 ((uint32_t)((addend & 0xFFF) >> sh) << 10);
                 break;
+            }
             case R_AARCH64_CALL26:
             case R_AARCH64_JUMP26:
                 *(uint32_t *)p = (insn & 0xFC000000) |
                                  ((uint32_t)((addend-(int64_t)P)>>2) & 0x3FFFFFF);
                 break;
             default:
-                xlnk_diag(st, XLNK_DIAG_WARN,
+                xlnk_diag(st, XLNK_DIAG_ERROR,
                           "unhandled AArch64 reloc %u in %s", type, c->name);
-                break;
+                return XLNK_ERR_UNSUPPORTED;
             }
         }
     }
@@ -974,13 +1758,165 @@ static int apply_relocations_aarch64(XlnkState *st) {
 }
 
 /* ═══════════════════════════════════════════════════════════════════════════
- * ELF64 OUTPUT WRITER  — mmap primary path, pwritev fallback
+ * SYNTHETIC SECTION CONTENTS  — GOT, PLT, .dynsym, .hash, versions,
+ * .rela.dyn and .dynamic, filled in once every address is final
+ * ═══════════════════════════════════════════════════════════════════════════ */
+static uint16_t sym_version_index(const XlnkState *st, const XlnkSymbol *s) {
+    if (!s->version) return 1;
+    for (int v = 0; v < st->n_vers; v++)
+        if (st->vers[v].lib == s->lib && strcmp(st->vers[v].name, s->version) == 0)
+            return st->vers[v].other;
+    return 1;
+}
+
+static uint64_t syn_vaddr(const XlnkState *st, int kind) {
+    return st->syn[kind] >= 0 ? st->chunks[st->syn[kind]].vaddr : 0;
+}
+
+static void fill_synthetic(XlnkState *st) {
+    /* GOT: link-time value, TLS offset, or 0 + GLOB_DAT for imports */
+    uint64_t *got = (uint64_t *)st->chunks[st->syn[OUT_GOT]].data;
+    for (int k = 0; k < st->n_got; k++) {
+        const XlnkSymbol *s = &st->syms.syms[st->got[k]];
+        if (s->lib >= 0 && !s->copy) got[k] = 0;
+        else if (s->type == STT_TLS) got[k] = (uint64_t)tpoff(st, s->value);
+        else got[k] = s->value;
+    }
+
+    /* PLT: jmp *slot(%rip) ; 2-byte nop */
+    uint8_t *plt = (uint8_t *)st->chunks[st->syn[OUT_PLT]].data;
+    uint64_t plt_va = syn_vaddr(st, OUT_PLT);
+    for (int k = 0; k < st->n_plt; k++) {
+        const XlnkSymbol *s = &st->syms.syms[st->plt[k]];
+        uint8_t *e = plt + k * 8;
+        int32_t rel = (int32_t)(got_slot(st, s->got_index) - (plt_va + (uint64_t)k * 8 + 6));
+        e[0] = 0xff; e[1] = 0x25; memcpy(e + 2, &rel, 4);
+        e[6] = 0x66; e[7] = 0x90;
+    }
+    if (st->cfg->is_static) return;
+
+    /* .dynsym + .gnu.version */
+    Elf64_Sym *ds = (Elf64_Sym *)st->chunks[st->syn[OUT_DYNSYM]].data;
+    uint16_t  *vs = st->syn[OUT_VERSYM] >= 0 ? (uint16_t *)st->chunks[st->syn[OUT_VERSYM]].data : NULL;
+    for (int k = 1; k < st->n_dyn; k++) {
+        const XlnkSymbol *s = &st->syms.syms[st->dyn[k]];
+        uint8_t type = s->type == STT_OBJECT ? STT_OBJECT : STT_FUNC;
+        ds[k].st_name = st->dynsym_name[k];
+        ds[k].st_info = (uint8_t)(((s->strong_ref || s->copy ? STB_GLOBAL : STB_WEAK) << 4) | type);
+        if (s->copy) {
+            ds[k].st_shndx = (Elf64_Half)st->shndx[OUT_BSS];
+            ds[k].st_value = s->value;
+            ds[k].st_size  = s->size;
+        }
+        if (vs) vs[k] = sym_version_index(st, s);
+    }
+
+    /* .hash (SysV) */
+    uint32_t *h = (uint32_t *)st->chunks[st->syn[OUT_HASH]].data;
+    uint32_t nbucket = (uint32_t)st->n_dyn / 2 + 1, nchain = (uint32_t)st->n_dyn;
+    h[0] = nbucket; h[1] = nchain;
+    uint32_t *bucket = h + 2, *chain = h + 2 + nbucket;
+    for (int k = 1; k < st->n_dyn; k++) {
+        uint32_t b = elf_hash(st->syms.syms[st->dyn[k]].name) % nbucket;
+        chain[k] = bucket[b];
+        bucket[b] = (uint32_t)k;
+    }
+
+    /* .gnu.version_r: one Verneed per library, one Vernaux per version */
+    if (st->syn[OUT_VERNEED] >= 0) {
+        uint8_t *p = (uint8_t *)st->chunks[st->syn[OUT_VERNEED]].data;
+        Elf64_Verneed *prev = NULL;
+        for (int li = 0; li < st->n_libs; li++) {
+            int cnt = 0;
+            for (int v = 0; v < st->n_vers; v++) cnt += st->vers[v].lib == li;
+            if (!cnt) continue;
+            Elf64_Verneed *vn = (Elf64_Verneed *)p;
+            if (prev) prev->vn_next = (Elf64_Word)((uint8_t *)vn - (uint8_t *)prev);
+            vn->vn_version = 1;
+            vn->vn_cnt  = (Elf64_Half)cnt;
+            vn->vn_file = st->libs[li].soname_off;
+            vn->vn_aux  = sizeof(Elf64_Verneed);
+            p += sizeof(Elf64_Verneed);
+            Elf64_Vernaux *pa = NULL;
+            for (int v = 0; v < st->n_vers; v++) {
+                if (st->vers[v].lib != li) continue;
+                Elf64_Vernaux *va = (Elf64_Vernaux *)p;
+                if (pa) pa->vna_next = sizeof(Elf64_Vernaux);
+                va->vna_hash  = elf_hash(st->vers[v].name);
+                va->vna_other = st->vers[v].other;
+                va->vna_name  = st->vers[v].name_off;
+                p += sizeof(Elf64_Vernaux);
+                pa = va;
+            }
+            prev = vn;
+        }
+    }
+
+    /* .rela.dyn */
+    if (st->syn[OUT_RELA] >= 0) {
+        Elf64_Rela *r = (Elf64_Rela *)st->chunks[st->syn[OUT_RELA]].data;
+        int n = 0;
+        for (int k = 0; k < st->n_got; k++) {
+            const XlnkSymbol *s = &st->syms.syms[st->got[k]];
+            if (s->lib < 0) continue;
+            r[n].r_offset = got_slot(st, k);
+            r[n].r_info   = ELF64_R_INFO(s->dynsym_index, R_X86_64_GLOB_DAT);
+            r[n].r_addend = 0;
+            n++;
+        }
+        for (int k = 1; k < st->n_dyn; k++) {
+            const XlnkSymbol *s = &st->syms.syms[st->dyn[k]];
+            if (!s->copy) continue;
+            r[n].r_offset = s->value;
+            r[n].r_info   = ELF64_R_INFO(k, R_X86_64_COPY);
+            r[n].r_addend = 0;
+            n++;
+        }
+    }
+
+    /* .dynamic */
+    Elf64_Dyn *d = (Elf64_Dyn *)st->chunks[st->syn[OUT_DYNAMIC]].data;
+    int nd = 0;
+#define DYN(tag, val) do { d[nd].d_tag = (tag); d[nd].d_un.d_val = (val); nd++; } while (0)
+    for (int li = 0; li < st->n_libs; li++)
+        if (st->libs[li].used) DYN(DT_NEEDED, st->libs[li].soname_off);
+    DYN(DT_HASH,   syn_vaddr(st, OUT_HASH));
+    DYN(DT_STRTAB, syn_vaddr(st, OUT_DYNSTR));
+    DYN(DT_SYMTAB, syn_vaddr(st, OUT_DYNSYM));
+    DYN(DT_STRSZ,  st->dynstr_len);
+    DYN(DT_SYMENT, sizeof(Elf64_Sym));
+    DYN(DT_DEBUG,  0);
+    if (st->syn[OUT_RELA] >= 0) {
+        DYN(DT_RELA,    syn_vaddr(st, OUT_RELA));
+        DYN(DT_RELASZ,  st->chunks[st->syn[OUT_RELA]].size);
+        DYN(DT_RELAENT, sizeof(Elf64_Rela));
+    }
+    if (st->syn[OUT_VERSYM] >= 0) {
+        int nlibs = 0;
+        for (int li = 0; li < st->n_libs; li++)
+            for (int v = 0; v < st->n_vers; v++)
+                if (st->vers[v].lib == li) { nlibs++; break; }
+        DYN(DT_VERSYM,     syn_vaddr(st, OUT_VERSYM));
+        DYN(DT_VERNEED,    syn_vaddr(st, OUT_VERNEED));
+        DYN(DT_VERNEEDNUM, (uint64_t)nlibs);
+    }
+    uint64_t a, sz;
+    if (has_kind(st, OUT_INIT_ARRAY, &a, &sz)) { DYN(DT_INIT_ARRAY, a); DYN(DT_INIT_ARRAYSZ, sz); }
+    if (has_kind(st, OUT_FINI_ARRAY, &a, &sz)) { DYN(DT_FINI_ARRAY, a); DYN(DT_FINI_ARRAYSZ, sz); }
+    DYN(DT_FLAGS,   DF_BIND_NOW);
+    DYN(DT_FLAGS_1, DF_1_NOW);
+    DYN(DT_NULL,    0);
+#undef DYN
+}
+
+/* ═══════════════════════════════════════════════════════════════════════════
+ * ELF64 OUTPUT WRITER  — mmap primary path, pwrite fallback
  * ═══════════════════════════════════════════════════════════════════════════ */
 
 /* Platform-optimal output write:
  *   Linux  → mmap(MAP_SHARED) + memcpy (zero pwrite syscalls)
  *   macOS  → mmap(MAP_SHARED) + F_NOCACHE + memcpy (bypasses UBC cache)
- *   other  → pwritev (single syscall) or sequential pwrite */
+ *   other  → one pwrite per piece of the scatter list */
 static int write_output_mmap(int fd, off_t file_size,
                               const void **bufs, const off_t *offsets,
                               const size_t *lens, int n) {
@@ -993,127 +1929,162 @@ static int write_output_mmap(int fd, off_t file_size,
                                    PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
     if (m == MAP_FAILED) return -1;
 
-    memset(m, 0, (size_t)file_size);
-
 #if defined(MADV_SEQUENTIAL)
     madvise(m, (size_t)file_size, MADV_SEQUENTIAL);
 #endif
 
+    /* The file is fresh from O_TRUNC + ftruncate: gaps already read as zero */
     for (int i = 0; i < n; i++) {
         if (bufs[i] && lens[i] > 0)
             memcpy(m + offsets[i], bufs[i], lens[i]);
     }
 
-#if defined(MADV_DONTNEED)
-    /* Release pages from page cache after write — we won't read them again */
-    madvise(m, (size_t)file_size, MADV_DONTNEED);
-#endif
     munmap(m, (size_t)file_size);
     return 0;
 }
 
+/* .shstrtab offset of each section name, built on the fly */
+static uint32_t shstr_add(char *buf, size_t *len, const char *s) {
+    uint32_t off = (uint32_t)*len;
+    size_t n = strlen(s) + 1;
+    memcpy(buf + *len, s, n);
+    *len += n;
+    return off;
+}
+
 static int write_elf64(XlnkState *st) {
     const XlnkConfig *cfg = st->cfg;
     const char *out = cfg->output ? cfg->output : "a.out";
+    uint64_t base = cfg->base_address ? cfg->base_address : 0x400000ULL;
+    int nphdr = layout_count_phdrs(st);
 
-    /* Interp string */
-    const char *interp = cfg->interp;
-    if (!interp && !cfg->is_static) {
-#if defined(__aarch64__) || defined(__arm64__)
-        interp = "/lib/ld-linux-aarch64.so.1";
-#else
-        interp = "/lib64/ld-linux-x86-64.so.2";
-#endif
-    }
-    size_t interp_len = interp ? strlen(interp) + 1 : 0;
-
-    /* Segment ranges */
-    uint64_t text_start=0, text_end=0, data_start=0, data_end=0;
-    uint64_t data_off=0;
-    int first_text=1, first_data=1;
-    for (int i = 0; i < st->n_chunks; i++) {
-        Chunk *c = &st->chunks[i];
-        if (!c->is_write) {
-            if (first_text) { text_start=c->vaddr; first_text=0; }
-            text_end = c->vaddr + c->size;
-        } else {
-            if (first_data) { data_start=c->vaddr; data_off=c->file_off; first_data=0; }
-            data_end = c->vaddr + c->size;
-        }
-    }
-
-    int nphdr = 2; /* LOAD(text) + GNU_STACK minimum */
-    if (!cfg->is_static) nphdr += 3; /* +PHDR, +INTERP, +LOAD(data) */
-    if (data_start) nphdr++;
-
-    /* ELF header */
-    Elf64_Ehdr eh = {0};
-    eh.e_ident[0]=ELF_MAG0; eh.e_ident[1]=ELF_MAG1;
-    eh.e_ident[2]=ELF_MAG2; eh.e_ident[3]=ELF_MAG3;
-    eh.e_ident[4]=ELFCLASS64; eh.e_ident[5]=ELFDATA2LSB; eh.e_ident[6]=1;
-    eh.e_type    = cfg->is_static ? ET_EXEC : ET_DYN;
-    eh.e_machine = (Elf64_Half)st->machine;
-    eh.e_version = 1;
-    eh.e_entry   = st->entry_vaddr;
-    eh.e_phoff   = sizeof(Elf64_Ehdr);
-    eh.e_ehsize  = sizeof(Elf64_Ehdr);
-    eh.e_phentsize = sizeof(Elf64_Phdr);
-    eh.e_phnum   = (Elf64_Half)nphdr;
-    eh.e_shentsize = sizeof(Elf64_Shdr);
-
+    /* ── Program headers ─────────────────────────────────────────────── */
+    Elf64_Phdr phdrs[8];
+    memset(phdrs, 0, sizeof(phdrs));
+    int ph = 0;
     uint64_t phdr_off  = sizeof(Elf64_Ehdr);
     uint64_t phdr_size = (uint64_t)nphdr * sizeof(Elf64_Phdr);
-
-    Elf64_Phdr phdrs[8] = {0};
-    int ph = 0;
     if (!cfg->is_static) {
         phdrs[ph].p_type=PT_PHDR; phdrs[ph].p_flags=PF_R;
-        phdrs[ph].p_offset=phdr_off; phdrs[ph].p_vaddr=text_start+phdr_off;
-        phdrs[ph].p_paddr=phdrs[ph].p_vaddr;
+        phdrs[ph].p_offset=phdr_off; phdrs[ph].p_vaddr=phdrs[ph].p_paddr=base+phdr_off;
         phdrs[ph].p_filesz=phdrs[ph].p_memsz=phdr_size; phdrs[ph].p_align=8; ph++;
 
-        if (interp_len > 0) {
-            uint64_t ioff = phdr_off + phdr_size;
-            phdrs[ph].p_type=PT_INTERP; phdrs[ph].p_flags=PF_R;
-            phdrs[ph].p_offset=ioff; phdrs[ph].p_vaddr=text_start+ioff;
-            phdrs[ph].p_paddr=phdrs[ph].p_vaddr;
-            phdrs[ph].p_filesz=phdrs[ph].p_memsz=interp_len; phdrs[ph].p_align=1; ph++;
-        }
+        const Chunk *ic = &st->chunks[st->syn[OUT_INTERP]];
+        phdrs[ph].p_type=PT_INTERP; phdrs[ph].p_flags=PF_R;
+        phdrs[ph].p_offset=ic->file_off; phdrs[ph].p_vaddr=phdrs[ph].p_paddr=ic->vaddr;
+        phdrs[ph].p_filesz=phdrs[ph].p_memsz=ic->size; phdrs[ph].p_align=1; ph++;
     }
-    /* PT_LOAD text */
+    /* PT_LOAD text: headers through .plt */
     phdrs[ph].p_type=PT_LOAD; phdrs[ph].p_flags=PF_R|PF_X;
-    phdrs[ph].p_vaddr=phdrs[ph].p_paddr=text_start;
-    phdrs[ph].p_filesz=phdrs[ph].p_memsz=text_end-text_start; phdrs[ph].p_align=0x1000; ph++;
+    phdrs[ph].p_offset=0; phdrs[ph].p_vaddr=phdrs[ph].p_paddr=base;
+    phdrs[ph].p_filesz=phdrs[ph].p_memsz=st->rx_end_off; phdrs[ph].p_align=0x1000; ph++;
     /* PT_LOAD data */
-    if (data_start) {
-        phdrs[ph].p_type=PT_LOAD; phdrs[ph].p_flags=PF_R|PF_W;
-        phdrs[ph].p_offset=data_off; phdrs[ph].p_vaddr=phdrs[ph].p_paddr=data_start;
-        phdrs[ph].p_filesz=phdrs[ph].p_memsz=data_end-data_start; phdrs[ph].p_align=0x1000; ph++;
+    phdrs[ph].p_type=PT_LOAD; phdrs[ph].p_flags=PF_R|PF_W;
+    phdrs[ph].p_offset=st->rw_off; phdrs[ph].p_vaddr=phdrs[ph].p_paddr=base+st->rw_off;
+    phdrs[ph].p_filesz=st->rw_file_end-st->rw_off;
+    phdrs[ph].p_memsz=st->rw_mem_end-(base+st->rw_off); phdrs[ph].p_align=0x1000; ph++;
+    if (!cfg->is_static) {
+        const Chunk *dc = &st->chunks[st->syn[OUT_DYNAMIC]];
+        phdrs[ph].p_type=PT_DYNAMIC; phdrs[ph].p_flags=PF_R|PF_W;
+        phdrs[ph].p_offset=dc->file_off; phdrs[ph].p_vaddr=phdrs[ph].p_paddr=dc->vaddr;
+        phdrs[ph].p_filesz=phdrs[ph].p_memsz=dc->size; phdrs[ph].p_align=8; ph++;
+    }
+    if (ph < nphdr - 1) {   /* room left before GNU_STACK → PT_TLS */
+        phdrs[ph].p_type=PT_TLS; phdrs[ph].p_flags=PF_R;
+        phdrs[ph].p_offset=st->tls_start - base;
+        phdrs[ph].p_vaddr=phdrs[ph].p_paddr=st->tls_start;
+        phdrs[ph].p_filesz=st->tls_filesz; phdrs[ph].p_memsz=st->tls_memsz;
+        phdrs[ph].p_align=st->tls_align; ph++;
     }
     /* PT_GNU_STACK */
     phdrs[ph].p_type=PT_GNU_STACK; phdrs[ph].p_flags=PF_R|PF_W;
     phdrs[ph].p_align=16; phdrs[ph].p_memsz=cfg->stack_size?cfg->stack_size:8*1024*1024; ph++;
 
-    /* Compute output file size */
-    off_t out_size = (off_t)(phdr_off + phdr_size + interp_len);
-    for (int i = 0; i < st->n_chunks; i++) {
-        Chunk *c = &st->chunks[i];
-        if (!c->is_bss && c->data) {
-            off_t end = (off_t)c->file_off + (off_t)c->size;
-            if (end > out_size) out_size = end;
+    /* ── Section headers: one per non-empty output section ──────────── */
+    Elf64_Shdr shdrs[OUT_COUNT + 2];
+    char       shstr[512];
+    size_t     shstr_len = 0;
+    memset(shdrs, 0, sizeof(shdrs));
+    shstr_add(shstr, &shstr_len, "");
+    int nsh = 1;
+    for (int k = 0; k < OUT_COUNT; k++) {
+        uint64_t lo = 0, hi = 0, off = 0, align = 1; int any = 0;
+        for (int i = 0; i < st->n_chunks; i++) {
+            const Chunk *c = &st->chunks[i];
+            if (c->kind != k) continue;
+            if (!any) { lo = c->vaddr; off = c->file_off; }
+            hi = c->vaddr + c->size;
+            if (c->align > align) align = c->align;
+            any = 1;
+        }
+        if (!any || (hi == lo && k != OUT_DYNAMIC)) continue;
+        Elf64_Shdr *s = &shdrs[nsh];
+        s->sh_name = shstr_add(shstr, &shstr_len, out_sec[k].name);
+        s->sh_type = out_sec[k].type;
+        s->sh_flags = out_sec[k].flags;
+        s->sh_addr = lo; s->sh_offset = off; s->sh_size = hi - lo;
+        s->sh_addralign = align; s->sh_entsize = out_sec[k].entsize;
+        st->shndx[k] = nsh++;
+    }
+    for (int k = 0; k < OUT_COUNT; k++) {
+        Elf64_Shdr *s = &shdrs[st->shndx[k]];
+        if (!st->shndx[k]) continue;
+        if (k == OUT_DYNSYM || k == OUT_VERNEED || k == OUT_DYNAMIC)
+            s->sh_link = (Elf64_Word)st->shndx[OUT_DYNSTR];
+        if (k == OUT_HASH || k == OUT_VERSYM || k == OUT_RELA)
+            s->sh_link = (Elf64_Word)st->shndx[OUT_DYNSYM];
+        if (k == OUT_DYNSYM) s->sh_info = 1;   /* first non-local symbol */
+        if (k == OUT_VERNEED) {
+            int nlibs = 0;
+            for (int li = 0; li < st->n_libs; li++)
+                for (int v = 0; v < st->n_vers; v++)
+                    if (st->vers[v].lib == li) { nlibs++; break; }
+            s->sh_info = (Elf64_Word)nlibs;
         }
     }
-    out_size = (out_size + 4095) & ~(off_t)4095;
+    int shstrndx = nsh++;
+    shdrs[shstrndx].sh_name = shstr_add(shstr, &shstr_len, ".shstrtab");
+    shdrs[shstrndx].sh_type = SHT_STRTAB;
+    shdrs[shstrndx].sh_addralign = 1;
+
+    /* Copied symbols point at .bss in .dynsym, so fill after shndx[] */
+    fill_synthetic(st);
+
+    uint64_t end = st->rw_file_end;
+    shdrs[shstrndx].sh_offset = end;
+    shdrs[shstrndx].sh_size   = shstr_len;
+    uint64_t shoff = align_up(end + shstr_len, 8);
+    off_t out_size = (off_t)(shoff + (uint64_t)nsh * sizeof(Elf64_Shdr));
+
+    /* ── ELF header ──────────────────────────────────────────────────── */
+    Elf64_Ehdr eh;
+    memset(&eh, 0, sizeof(eh));
+    eh.e_ident[0]=ELF_MAG0; eh.e_ident[1]=ELF_MAG1;
+    eh.e_ident[2]=ELF_MAG2; eh.e_ident[3]=ELF_MAG3;
+    eh.e_ident[4]=ELFCLASS64; eh.e_ident[5]=ELFDATA2LSB; eh.e_ident[6]=1;
+    eh.e_type    = ET_EXEC;
+    eh.e_machine = (Elf64_Half)st->machine;
+    eh.e_version = 1;
+    eh.e_entry   = st->entry_vaddr;
+    eh.e_phoff   = phdr_off;
+    eh.e_shoff   = shoff;
+    eh.e_ehsize  = sizeof(Elf64_Ehdr);
+    eh.e_phentsize = sizeof(Elf64_Phdr);
+    eh.e_phnum   = (Elf64_Half)ph;
+    eh.e_shentsize = sizeof(Elf64_Shdr);
+    eh.e_shnum   = (Elf64_Half)nsh;
+    eh.e_shstrndx = (Elf64_Half)shstrndx;
 
-#if defined(__linux__)
-    posix_fallocate(open(out, O_CREAT|O_TRUNC|O_WRONLY, 0755), 0, out_size);
-    close(open(out, O_RDONLY)); /* flush the create */
-#endif
+    /* Remove first: a running copy of the old binary keeps its inode */
+    unlink(out);
     int fd = open(out, O_CREAT|O_TRUNC|O_RDWR, 0755);
     if (fd < 0) {
         xlnk_diag(st, XLNK_DIAG_ERROR, "cannot write '%s': %s", out, strerror(errno));
         return XLNK_ERR_OUTPUT;
     }
+#if defined(__linux__)
+    posix_fallocate(fd, 0, out_size);
+#endif
 
     /* Build scatter list */
     int max_segs = 4 + st->n_chunks;
@@ -1123,46 +2094,31 @@ static int write_elf64(XlnkState *st) {
     if (!bufs || !offs || !lens) { free(bufs); free(offs); free(lens); close(fd); return XLNK_ERR_NOMEM; }
 
     int ns = 0;
-    bufs[ns]=&eh;    offs[ns]=0;        lens[ns]=sizeof(eh); ns++;
-    bufs[ns]=phdrs;  offs[ns]=(off_t)phdr_off; lens[ns]=(size_t)ph*sizeof(Elf64_Phdr); ns++;
-    if (!cfg->is_static && interp_len > 0) {
-        bufs[ns]=interp; offs[ns]=(off_t)(phdr_off+phdr_size); lens[ns]=interp_len; ns++;
-    }
+    bufs[ns]=&eh;    offs[ns]=0;                lens[ns]=sizeof(eh); ns++;
+    bufs[ns]=phdrs;  offs[ns]=(off_t)phdr_off;  lens[ns]=(size_t)ph*sizeof(Elf64_Phdr); ns++;
     for (int i = 0; i < st->n_chunks; i++) {
         Chunk *c = &st->chunks[i];
         if (!c->is_bss && c->data && c->size > 0) {
             bufs[ns]=c->data; offs[ns]=(off_t)c->file_off; lens[ns]=c->size; ns++;
         }
     }
+    bufs[ns]=shstr; offs[ns]=(off_t)end;   lens[ns]=shstr_len; ns++;
+    bufs[ns]=shdrs; offs[ns]=(off_t)shoff; lens[ns]=(size_t)nsh*sizeof(Elf64_Shdr); ns++;
 
     int wrc = write_output_mmap(fd, out_size, bufs, offs, lens, ns);
-    free(bufs); free(offs); free(lens);
-
     if (wrc != 0) {
-        /* pwritev fallback */
-        struct iovec *iov = (struct iovec *)malloc(sizeof(struct iovec) * (size_t)ns);
-        if (!iov) { close(fd); return XLNK_ERR_NOMEM; }
-        /* Re-build iov (already scattered by offset — sort by offset first) */
-        for (int i = 0; i < ns; i++) {
-            iov[i].iov_base = (void *)bufs[i]; /* bufs freed — but we need to rebuild */
-            iov[i].iov_len  = lens[i];
-        }
-        /* Actually bufs/lens were freed. Use sequential pwrite. */
-        free(iov);
-        /* Minimal pwrite fallback: write contiguous */
-        lseek(fd, 0, SEEK_SET);
-        write(fd, &eh, sizeof(eh));
-        pwrite(fd, phdrs, (size_t)ph*sizeof(Elf64_Phdr), (off_t)phdr_off);
-        if (!cfg->is_static && interp_len > 0)
-            pwrite(fd, interp, interp_len, (off_t)(phdr_off+phdr_size));
-        for (int i = 0; i < st->n_chunks; i++) {
-            Chunk *c = &st->chunks[i];
-            if (!c->is_bss && c->data && c->size > 0)
-                pwrite(fd, c->data, c->size, (off_t)c->file_off);
-        }
+        /* pwrite fallback: same scatter list, one call per piece */
+        wrc = ftruncate(fd, out_size);
+        for (int i = 0; i < ns && wrc == 0; i++)
+            if (pwrite(fd, bufs[i], lens[i], offs[i]) != (ssize_t)lens[i]) wrc = -1;
     }
-
+    free(bufs); free(offs); free(lens);
     close(fd);
+    if (wrc != 0) {
+        xlnk_diag(st, XLNK_DIAG_ERROR, "cannot write '%s': %s", out, strerror(errno));
+        unlink(out);
+        return XLNK_ERR_OUTPUT;
+    }
     chmod(out, 0755);
 
     if (cfg->verbose)
@@ -1351,9 +2307,47 @@ const char *xlnk_error_string(int code) {
 }
 const char *xlnk_version(void) { return "4.0.0"; }
 
+/* Per-phase wall-clock, reported through cfg->times */
+static void phase_mark(const XlnkConfig *cfg, int phase, uint64_t *t) {
+    uint64_t now = xly_nanotime();
+    if (cfg->times) cfg->times[phase] += (double)(now - *t) / 1e6;
+    *t = now;
+}
+
+/* Error unless every strong reference found a definition */
+static int check_undefined(XlnkState *st) {
+    int n = 0;
+    for (uint32_t i = 0; i < st->syms.n; i++) {
+        const XlnkSymbol *s = &st->syms.syms[i];
+        if (s->defined || !s->strong_ref || s->lib >= 0) continue;
+        if (n < 5)
+            xlnk_diag(st, XLNK_DIAG_ERROR, "undefined reference to '%s'", s->name);
+        n++;
+    }
+    if (n > 5)
+        xlnk_diag(st, XLNK_DIAG_ERROR, "... and %d more undefined symbols", n - 5);
+    return n ? XLNK_ERR_UNDEF : XLNK_OK;
+}
+
+static void define_synthetic(XlnkState *st, const char *name, int kind) {
+    int gi = sym_find(&st->syms, name);
+    if (gi < 0 || st->syn[kind] < 0) return;
+    XlnkSymbol *s = &st->syms.syms[gi];
+    if (s->defined) return;
+    s->defined = 1;
+    s->chunk   = st->syn[kind];
+    s->value   = 0;
+    s->lib     = -1;
+    s->bind    = STB_GLOBAL;
+}
+
 int xlnk_link(const XlnkConfig *cfg) {
     XlnkState st; memset(&st, 0, sizeof(st));
     st.cfg = cfg;
+    for (int k = 0; k < OUT_COUNT; k++) st.syn[k] = -1;
+    if (cfg->times)
+        for (int k = 0; k < XLNK_NUM_PHASES; k++) cfg->times[k] = 0.0;
+    uint64_t t = xly_nanotime();
 
     /* Detect output format from first object */
     if (cfg->n_objects > 0) {
@@ -1363,62 +2357,111 @@ int xlnk_link(const XlnkConfig *cfg) {
         st.is_macho = 1;
 #endif
     }
+    if (cfg->pic && !st.is_macho) {
+        xlnk_diag(&st, XLNK_DIAG_ERROR, "position-independent output is not supported");
+        return XLNK_ERR_UNSUPPORTED;
+    }
 
     /* Init arenas — huge-page backed on Linux when available */
     arena_init(&st.str_arena, 2  * 1024 * 1024);
     arena_init(&st.mem_arena, 32 * 1024 * 1024);
 
-    /* Init Robin Hood symbol table inside mem_arena */
-    sym_table_init(&st.syms, &st.mem_arena);
+    /* Robin Hood symbol table */
+    if ((st.rc = sym_table_init(&st.syms)) != XLNK_OK) goto cleanup;
 
-    /* Process object files */
+    /* ── Input: objects, then archive members on demand ────────────── */
     for (int i = 0; i < cfg->n_objects; i++) {
         MappedFile mf = {0};
-        int rc = mmap_file(&st, cfg->objects[i], &mf);
+        int rc = map_input(&st, cfg->objects[i], &mf);
         if (rc != XLNK_OK) { st.rc = rc; goto cleanup; }
         if (is_elf64(mf.data, mf.size))
             rc = process_elf64(&st, mf.data, mf.size, cfg->objects[i]);
-        munmap_file(&mf);
         if (rc != XLNK_OK) { st.rc = rc; goto cleanup; }
     }
 
-    /* Process static archives */
     for (int i = 0; i < cfg->n_libraries; i++) {
         MappedFile mf = {0};
-        int rc = mmap_file(&st, cfg->libraries[i], &mf);
+        int rc = map_input(&st, cfg->libraries[i], &mf);
         if (rc != XLNK_OK) {
             xlnk_diag(&st, XLNK_DIAG_WARN, "library '%s' not found — skipping",
                       cfg->libraries[i]);
             continue;
         }
-        if (mf.size >= AR_MAGIC_LEN && memcmp(mf.data, AR_MAGIC, AR_MAGIC_LEN) == 0)
-            rc = process_ar(&st, mf.data, mf.size, cfg->libraries[i]);
-        else if (is_elf64(mf.data, mf.size))
+        if (mf.size >= AR_MAGIC_LEN && memcmp(mf.data, AR_MAGIC, AR_MAGIC_LEN) == 0) {
+            Archive *a = &st.archives[st.n_archives++];
+            memset(a, 0, sizeof(*a));
+            a->path = cfg->libraries[i]; a->data = mf.data; a->size = mf.size;
+            rc = process_ar(&st, a);
+        } else if (is_elf64(mf.data, mf.size)) {
             rc = process_elf64(&st, mf.data, mf.size, cfg->libraries[i]);
-        munmap_file(&mf);
+        }
         if (rc != XLNK_OK) { st.rc = rc; goto cleanup; }
     }
+    /* Members can need members of earlier archives: iterate to a fixpoint */
+    for (int changed = 1; changed; ) {
+        changed = 0;
+        for (int i = 0; i < st.n_archives; i++) {
+            int n = ar_pull(&st, &st.archives[i]);
+            if (n < 0) { st.rc = -n; goto cleanup; }
+            changed |= n > 0;
+        }
+    }
+    phase_mark(cfg, XLNK_PHASE_INPUT, &t);
+
+    /* ── Resolve: shared libraries, GOT/PLT/copy needs ──────────────── */
+    if (!st.is_macho && !cfg->is_static) {
+        for (int i = 0; i < cfg->n_sonames && st.n_libs < XLNK_MAX_SONAMES; i++) {
+            SharedLib *L = &st.libs[st.n_libs];
+            memset(L, 0, sizeof(*L));
+            L->soname = cfg->sonames[i];
+            if (shlib_open(&st, L) != XLNK_OK) continue;
+            shlib_resolve(&st, st.n_libs++);
+        }
+    }
+    if (!st.is_macho) {
+        if ((st.rc = add_synthetic(&st, OUT_GOT, 0, 8)) != XLNK_OK) goto cleanup;
+        define_synthetic(&st, "_GLOBAL_OFFSET_TABLE_", OUT_GOT);
+        if ((st.rc = scan_relocations(&st)) != XLNK_OK) goto cleanup;
+        Chunk *gc = &st.chunks[st.syn[OUT_GOT]];
+        gc->size = (size_t)st.n_got * 8;
+        if (gc->size && !(gc->data = (uint8_t *)arena_zalloc(&st.mem_arena, gc->size, 8))) {
+            st.rc = XLNK_ERR_NOMEM; goto cleanup;
+        }
+        if ((st.rc = create_synthetic(&st)) != XLNK_OK) goto cleanup;
+        define_synthetic(&st, "_DYNAMIC", OUT_DYNAMIC);
+    }
+    if ((st.rc = check_undefined(&st)) != XLNK_OK) goto cleanup;
+    if (cfg->verbose)
+        xlnk_diag(&st, XLNK_DIAG_INFO, "%u symbols, %d chunks, %d GOT, %d PLT, %d dynsym",
+                  st.syms.n, st.n_chunks, st.n_got, st.n_plt, st.n_dyn ? st.n_dyn - 1 : 0);
+    phase_mark(cfg, XLNK_PHASE_RESOLVE, &t);
 
-    /* Layout */
-    { int rc = layout_elf64(&st);
-      if (rc != XLNK_OK) { st.rc = rc; goto cleanup; } }
+    /* ── Layout ────────────────────────────────────────────────────── */
+    if ((st.rc = layout_elf64(&st)) != XLNK_OK) goto cleanup;
+    phase_mark(cfg, XLNK_PHASE_LAYOUT, &t);
 
-    /* Apply relocations */
-    { int rc = (st.machine == EM_AARCH64)
-             ? apply_relocations_aarch64(&st)
-             : apply_relocations_x86_64(&st);
-      if (rc != XLNK_OK) { st.rc = rc; goto cleanup; } }
+    /* ── Apply relocations ─────────────────────────────────────────── */
+    st.rc = (st.machine == EM_AARCH64)
+          ? apply_relocations_aarch64(&st)
+          : apply_relocations_x86_64(&st);
+    if (st.rc != XLNK_OK) goto cleanup;
+    phase_mark(cfg, XLNK_PHASE_RELOC, &t);
 
-    /* Write output */
-    { int rc = st.is_macho ? write_macho64(&st) : write_elf64(&st);
-      if (rc != XLNK_OK) { st.rc = rc; goto cleanup; } }
+    /* ── Write output ──────────────────────────────────────────────── */
+    st.rc = st.is_macho ? write_macho64(&st) : write_elf64(&st);
+    phase_mark(cfg, XLNK_PHASE_WRITE, &t);
 
 cleanup:
+    for (int i = 0; i < st.n_files; i++) munmap_file(&st.files[i]);
+    for (int i = 0; i < st.n_archives; i++) free(st.archives[i].loaded);
+    sym_table_free(&st.syms);
     arena_free(&st.str_arena);
     arena_free(&st.mem_arena);
+    free(st.files);
     free(st.chunks);
     free(st.dynstr);
-    free(st.dynsym);
-    free(st.pending);
+    free(st.got);
+    free(st.plt);
+    free(st.dyn);
     return st.rc;
 }
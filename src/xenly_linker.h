@@ -36,12 +36,20 @@
  *
  * Supported output:
  *   ELF64 dynamically linked executable (PT_INTERP, PLT/GOT, .dynamic)
- *   ELF64 statically linked executable  (--static)
+ *   ELF64 statically linked executable  (--static; needs every symbol
+ *                                        defined by the inputs)
  *   Mach-O 64-bit executable (LC_MAIN, LC_LOAD_DYLIB)
  *
  * Pipeline position:
  *   source.xe → lexer → parser → AST → sema → codegen
- *     → .s → as → .o → xlnk → ELF/Mach-O binary
+ *     → asm text → xlas → .o → xlnk → ELF/Mach-O binary
+ *
+ * ELF output is a non-PIE ET_EXEC at 0x400000.  Archive members are pulled
+ * in only when they define a still-undefined symbol; whatever remains is
+ * looked up in the shared libraries' .dynsym and imported through GOT/PLT
+ * (functions) or copy relocations (data), bound eagerly (BIND_NOW) at the
+ * symbol's default version.  Only libraries that supply a symbol get a
+ * DT_NEEDED entry.
  *
  * Usage (C API):
  *   XlnkConfig cfg = xlnk_default_config();
@@ -115,8 +123,19 @@ typedef struct {
     /* Diagnostics callback (NULL = use fprintf to stderr) */
     void (*diag)(int level, const char *msg, void *userdata);
     void *diag_userdata;
+
+    /* Optional per-phase wall-clock in ms, XLNK_NUM_PHASES entries */
+    double     *times;
 } XlnkConfig;
 
+/* Link phases, as indices into cfg->times */
+#define XLNK_PHASE_INPUT    0   /* map objects, pull archive members     */
+#define XLNK_PHASE_RESOLVE  1   /* shared libraries, GOT/PLT/.dynamic    */
+#define XLNK_PHASE_LAYOUT   2   /* addresses and file offsets            */
+#define XLNK_PHASE_RELOC    3   /* apply relocations                     */
+#define XLNK_PHASE_WRITE    4   /* write the executable                  */
+#define XLNK_NUM_PHASES     5
+
 /* Diagnostic levels */
 #define XLNK_DIAG_INFO    0
 #define XLNK_DIAG_WARN    1
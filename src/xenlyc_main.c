@@ -10,12 +10,21 @@
  * xenlyc_main.c  —  Xenly native compiler driver  (v0.1.0)
  *
  * Pipeline (fully self-hosting, zero external toolchain):
- *   source.xe  →  lexer  →  parser  →  AST  →  sema  →  codegen  →  .s
- *   .s  →  as (system assembler)  →  .o  →  xlnk  →  ELF/Mach-O binary
+ *   source.xe  →  lexer  →  parser  →  AST  →  sema  →  codegen  →  asm text
+ *   asm text  →  xlas (in-process assembler)  →  .o  →  xlnk  →  ELF binary
  *
- * xlnk is a self-hosting, self-contained native linker.
- * No gcc, no clang, no ld.  The only external process is the system
- * assembler (as) which converts .s → .o.  All other stages are in-process.
+ * The assembly never touches the disk unless --emit-asm / --keep-asm asks
+ * for it, or xlas cannot handle the target (AArch64, Mach-O) or the input,
+ * in which case the .s is written and the C compiler assembles it.
+ *
+ * xlnk (xenly_linker.c) links the object with libxly_rtc.a and the libc
+ * shared objects in-process; --linker=system, or anything xlnk refuses,
+ * goes through `cc -nostartfiles` instead.
+ * xlas (xenly_asm.c) is the in-process assembler for x86-64 ELF.
+ *
+ * Imported user modules are compiled separately (xenlyc_units.c) into
+ * objects cached under .xenly-cache/ (or --cache-dir) and linked with the
+ * program's own object; an unchanged module is not recompiled.
  *
  * v0.1.0: Self-hosting linker
  *   • gcc/clang fallback fully removed — xlnk is the only linker
@@ -33,12 +42,20 @@
  *   • --opt <0-3>       Optimization level (default: 2)
  *   • --verbose         Annotate assembly + show codegen stats
  *   • --keep-asm        Keep the intermediate .s file after linking
- *   • --emit-ir         Dump annotated AST (IR) to stdout, then exit
- *   • --static          Pass -static to the linker
+ *   • --emit-ir         Dump the optimized SSA IR to stdout, then exit
+ *   • --emit-ast        Dump the annotated AST to stdout, then exit
+ *   • --static          Link a static binary (cfg.is_static / cc -static)
+ *   • --linker=<which>  xlnk (in-process, default) or system (cc)
  *   • -D<name>[=val]    Preprocessor-style defines (stored for future use)
  *   • --target <triple> Target triple (default: native; for cross-compile docs)
  *   • --time            Print compile time breakdown to stderr
  *   • --no-color        Suppress ANSI colour codes in diagnostics
+ *   • --cache-dir <dir> Where compiled modules are cached (.xenly-cache)
+ *   • --jobs <n>        Threads emitting function bodies (default: one per CPU)
+ *   • --profile-generate[=file]  Count branches, calls and arithmetic while the
+ *                       program runs; the counts go to file (<input>.xeprof)
+ *   • --profile-use[=file]       Optimize with those counts: cold code laid
+ *                       out apart, hot calls inlined first
  *
  * Usage:
  *   ./xenlyc  input.xe  [-o output]
@@ -50,10 +67,13 @@
 #include "lexer.h"
 #include "parser.h"
 #include "sema.h"
+#include "astopt.h"
 #include "codegen.h"
 #include "ast.h"
 #include "platform.h"
 #include "xenly_linker.h"
+#include "xenly_asm.h"
+#include "xenlyc_units.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -107,6 +127,46 @@ static char *swap_ext(const char *path, const char *ext) {
     return out;
 }
 
+/* Write len bytes to path; 0 on success */
+static int write_file(const char *path, const char *buf, size_t len) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+    size_t wr = fwrite(buf, 1, len, f);
+    if (fclose(f) != 0 || wr != len) return -1;
+    return 0;
+}
+
+/* Look `name` up in $PATH without spawning a shell; 1 if found */
+static int in_path(const char *name) {
+    const char *path = getenv("PATH");
+    if (!path || !*path) path = "/usr/local/bin:/usr/bin:/bin";
+    while (*path) {
+        const char *end = strchr(path, ':');
+        size_t len = end ? (size_t)(end - path) : strlen(path);
+        char probe[1024];
+        if (len == 0)
+            snprintf(probe, sizeof(probe), "./%s", name);
+        else
+            snprintf(probe, sizeof(probe), "%.*s/%s", (int)len, path, name);
+        if (access(probe, X_OK) == 0) return 1;
+        if (!end) break;
+        path = end + 1;
+    }
+    return 0;
+}
+
+/* xlnk diagnostics: keep the first error for the fallback note, echo all
+ * of them under --verbose */
+typedef struct { int verbose; char first_err[256]; } LinkDiag;
+
+static void link_diag(int level, const char *msg, void *userdata) {
+    LinkDiag *d = (LinkDiag *)userdata;
+    if (level == XLNK_DIAG_ERROR && !d->first_err[0])
+        snprintf(d->first_err, sizeof(d->first_err), "%s", msg);
+    if (d->verbose)
+        fprintf(stderr, "%s[xlnk]%s %s\n", COL("2"), RESET, msg);
+}
+
 /* ══════════════════════════════════════════════════════════════════════════════
  * TIMING
  *
@@ -125,7 +185,7 @@ static double now_ms(void) {
 }
 
 /* ══════════════════════════════════════════════════════════════════════════════
- * AST IR DUMP  (--emit-ir)
+ * AST DUMP  (--emit-ast)
  *
  * Prints a human-readable indented tree of AST nodes — useful for debugging
  * the parser and understanding what the code generator sees.
@@ -283,7 +343,9 @@ static void print_usage(const char *prog) {
            COL("1"), RESET, COL("2"), RESET);
     printf("    %s--emit-asm%s           Emit assembly only (.s), then stop\n",
            COL("1"), RESET);
-    printf("    %s--emit-ir%s            Dump AST to stdout, then stop\n",
+    printf("    %s--emit-ir%s            Dump optimized SSA IR to stdout, then stop\n",
+           COL("1"), RESET);
+    printf("    %s--emit-ast%s           Dump AST to stdout, then stop\n",
            COL("1"), RESET);
     printf("    %s--keep-asm%s           Keep the .s file after linking\n",
            COL("1"), RESET);
@@ -291,10 +353,20 @@ static void print_usage(const char *prog) {
            COL("1"), RESET);
     printf("    %s--static%s             Link a static binary\n",
            COL("1"), RESET);
+    printf("    %s--linker=<xlnk|system>%s Link in-process with xlnk %s(default)%s or with cc\n",
+           COL("1"), RESET, COL("2"), RESET);
     printf("    %s--linker-version%s     Print xlnk (built-in linker) version\n",
            COL("1"), RESET);
     printf("    %s--time%s               Print phase timings to stderr\n",
            COL("1"), RESET);
+    printf("    %s--jobs <n>%s           Threads for function bodies %s(default: one per CPU)%s\n",
+           COL("1"), RESET, COL("2"), RESET);
+    printf("    %s--cache-dir <dir>%s    Cache for compiled modules %s(default: .xenly-cache)%s\n",
+           COL("1"), RESET, COL("2"), RESET);
+    printf("    %s--profile-generate[=f]%s Instrument; the binary writes counts to f %s(<input>.xeprof)%s\n",
+           COL("1"), RESET, COL("2"), RESET);
+    printf("    %s--profile-use[=f]%s    Optimize with the counts in f %s(<input>.xeprof)%s\n",
+           COL("1"), RESET, COL("2"), RESET);
     printf("    %s--no-color%s           Disable ANSI colour in output\n",
            COL("1"), RESET);
     printf("    %s-D<n>[=val]%s       Define a compile-time constant\n",
@@ -311,16 +383,20 @@ static void print_usage(const char *prog) {
     printf("\n");
     printf("  %sOptimisation levels:%s\n", COL("1;33"), RESET);
     printf("    0  No opts     — readable asm, good for debugging\n");
-    printf("    1  Basic       — noreturn dead-code elision\n");
-    printf("    2  Systems     — + sys constant inlining, unboxed fast-paths  (default)\n");
-    printf("    3  Aggressive  — + all level-2 opts, maximum inlining\n");
+    printf("    1  Basic       — noreturn dead-code elision, register allocation\n");
+    printf("    2  Systems     — + sys constant inlining, unboxed fast-paths,\n"
+           "                     function inlining, tail calls, raw-f64\n"
+           "                     entries for fns annotated number  (default)\n");
+    printf("    3  Aggressive  — + all level-2 opts, maximum inlining,\n"
+           "                     raw-f64 entries for every fn that qualifies\n");
     printf("\n");
     printf("  %sExamples:%s\n", COL("1;32"), RESET);
     printf("    %s main.xe                   %s\u2192 ./a.out\n",   prog, COL("2"));
     printf("    %s%s main.xe -o main          %s\u2192 ./main\n",   RESET, prog, COL("2"));
     printf("    %s%s --opt 0 main.xe          %s\u2192 debug build\n", RESET, prog, COL("2"));
     printf("    %s%s --emit-asm main.xe       %s\u2192 main.s\n",   RESET, prog, COL("2"));
-    printf("    %s%s --emit-ir  main.xe       %s\u2192 AST dump\n", RESET, prog, COL("2"));
+    printf("    %s%s --emit-ir  main.xe       %s\u2192 IR dump\n", RESET, prog, COL("2"));
+    printf("    %s%s --emit-ast main.xe       %s\u2192 AST dump\n", RESET, prog, COL("2"));
     printf("    %s%s --verbose main.xe -o m   %s\u2192 annotated asm + stats\n",
            RESET, prog, COL("2"));
     printf("%s\n", RESET);
@@ -339,13 +415,19 @@ int main(int argc, char **argv) {
     const char *input     = NULL;
     const char *output    = NULL;
     const char *target    = "native";
+    const char *cache_dir = NULL;  /* --cache-dir: compiled module cache */
     int         emit_asm  = 0;
     int         emit_ir   = 0;
+    int         emit_ast  = 0;
     int         keep_asm  = 0;
     int         verbose   = 0;
     int         do_static = 0;
     int         do_time   = 0;
+    int         use_xlnk  = 1;     /* --linker=xlnk (default) | system   */
     int         opt_level = 2;     /* default: -O2 / sys-optimized */
+    int         jobs      = 0;     /* --jobs: 0 = one thread per CPU */
+    const char *prof_gen  = NULL;  /* --profile-generate: "" = default file */
+    const char *prof_use  = NULL;  /* --profile-use:      "" = default file */
 
     /* semantic analysis flags */
     int         sema_enabled = 1;  /* 1 = run sema (default on)              */
@@ -387,10 +469,22 @@ int main(int argc, char **argv) {
             emit_asm = 1; continue;
         }
         if (strcmp(argv[i], "--emit-ir") == 0) { emit_ir = 1; continue; }
+        if (strcmp(argv[i], "--emit-ast") == 0) { emit_ast = 1; continue; }
         if (strcmp(argv[i], "--keep-asm") == 0) { keep_asm = 1; continue; }
         if (strcmp(argv[i], "--verbose")  == 0) { verbose  = 1; continue; }
         if (strcmp(argv[i], "--static")   == 0) { do_static= 1; continue; }
         if (strcmp(argv[i], "--time")     == 0) { do_time  = 1; continue; }
+        if (strncmp(argv[i], "--linker=", 9) == 0) {
+            const char *which = argv[i] + 9;
+            if (strcmp(which, "xlnk") == 0)        use_xlnk = 1;
+            else if (strcmp(which, "system") == 0) use_xlnk = 0;
+            else {
+                fprintf(stderr, "%s[xenlyc]%s --linker must be xlnk or system\n",
+                        COL("1;31"), RESET);
+                return 1;
+            }
+            continue;
+        }
 
         if (strcmp(argv[i], "--linker-version") == 0) {
             printf("xlnk (Xenly built-in linker) v%s\n", xlnk_version());
@@ -430,6 +524,28 @@ int main(int argc, char **argv) {
             target = argv[++i];
             continue;
         }
+        if (strcmp(argv[i], "--jobs") == 0) {
+            if (i + 1 >= argc || atoi(argv[i + 1]) < 1) {
+                fprintf(stderr, "%s[xenlyc]%s --jobs requires a thread count\n",
+                        COL("1;31"), RESET);
+                return 1;
+            }
+            jobs = atoi(argv[++i]);
+            continue;
+        }
+        if (strcmp(argv[i], "--profile-generate") == 0) { prof_gen = ""; continue; }
+        if (strncmp(argv[i], "--profile-generate=", 19) == 0) { prof_gen = argv[i] + 19; continue; }
+        if (strcmp(argv[i], "--profile-use") == 0) { prof_use = ""; continue; }
+        if (strncmp(argv[i], "--profile-use=", 14) == 0) { prof_use = argv[i] + 14; continue; }
+        if (strcmp(argv[i], "--cache-dir") == 0) {
+            if (i + 1 >= argc) {
+                fprintf(stderr, "%s[xenlyc]%s --cache-dir requires a directory\n",
+                        COL("1;31"), RESET);
+                return 1;
+            }
+            cache_dir = argv[++i];
+            continue;
+        }
         if (strncmp(argv[i], "-D", 2) == 0) {
             if (ndefines < 64) defines[ndefines++] = argv[i] + 2;
             continue;
@@ -450,6 +566,39 @@ int main(int argc, char **argv) {
 
     /* ── configure codegen ────────────────────────────────────────────── */
     codegen_set_opts(opt_level, verbose);
+    codegen_set_jobs(jobs);
+
+    /* profile: the counts live next to the input by default.  The binary
+     * may run from anywhere, so the path it writes to is made absolute. */
+    if (prof_gen) {
+#if defined(__aarch64__) || defined(__arm64__)
+        fprintf(stderr, "%s[xenlyc]%s warning: --profile-generate is only supported "
+                "on x86-64; ignored\n", COL("1;33"), RESET);
+#else
+        char *path = *prof_gen ? strdup(prof_gen) : swap_ext(input, ".xeprof");
+        char  cwd[4096];
+        if (path[0] != '/' && getcwd(cwd, sizeof(cwd))) {
+            char *abs = malloc(strlen(cwd) + strlen(path) + 2);
+            sprintf(abs, "%s/%s", cwd, path);
+            free(path);
+            path = abs;
+        }
+        codegen_set_profile_generate(path);
+        free(path);
+#endif
+    }
+    if (prof_use) {
+        char *path = *prof_use ? strdup(prof_use) : swap_ext(input, ".xeprof");
+        if (codegen_load_profile(path) != 0) {
+            fprintf(stderr, "%s[xenlyc]%s cannot read profile '%s'\n",
+                    COL("1;31"), RESET, path);
+            free(path);
+            return 1;
+        }
+        if (verbose)
+            fprintf(stderr, "%s[xenlyc]%s using profile %s\n", COL("1;36"), RESET, path);
+        free(path);
+    }
 
     if (verbose) {
         fprintf(stderr, "%s[xenlyc]%s opt=%d  target=%s  static=%d\n",
@@ -486,9 +635,9 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    /* ── --emit-ir: dump AST and exit ────────────────────────────────── */
-    if (emit_ir) {
-        printf("=== Xenly AST IR  (%s) ===\n", input);
+    /* ── --emit-ast: dump AST and exit ───────────────────────────────── */
+    if (emit_ast) {
+        printf("=== Xenly AST  (%s) ===\n", input);
         dump_ast(program, 0);
         free(source);
         return 0;
@@ -532,13 +681,65 @@ int main(int argc, char **argv) {
         }
     }
 
-    /* ── codegen → .s ────────────────────────────────────────────────── */
+    /* ── AST optimization: fold, propagate consts, prune, mark pure ──── */
+    if (opt_level >= 1) {
+        AstOptStats ost;
+        ast_optimize(program, &ost);
+        if (verbose)
+            fprintf(stderr, "%s[xenlyc]%s ast-opt: %d folded, %d const refs, "
+                    "%d branches pruned, %d math calls, %d pure fns (%d memoizable)\n",
+                    COL("1;36"), RESET, ost.folded, ost.consts, ost.branches,
+                    ost.math_calls, ost.pure_fns, ost.memo_fns);
+    }
+    double t_opt = now_ms();
+
+    /* ── --emit-ir: print the optimized IR and exit ──────────────────── */
+    if (emit_ir) {
+        printf("=== Xenly SSA IR  (%s, -O%d) ===\n", input, opt_level);
+        int rc = codegen_emit_ir(program, stdout);
+        free(source);
+        return rc;
+    }
+
+    /* ── imported modules → cached objects ───────────────────────────── *
+     * Only where xlas can build them; otherwise (and for --emit-asm, whose
+     * .s must link on its own) imports stay dynamic as before.
+     * ------------------------------------------------------------------- */
+    UnitSet units;
+    memset(&units, 0, sizeof(units));
+    if (!emit_asm && xlas_supported()) {
+        UnitOpts uo = { cache_dir, opt_level, verbose, g_color, sema_enabled };
+        if (units_build(&units, &uo, input, program) != 0) {
+            fprintf(stderr, "%s[xenlyc]%s Module compilation failed — aborting.\n",
+                    COL("1;31"), RESET);
+            units_free(&units);
+            free(source);
+            return 1;
+        }
+    }
+    double t_units = now_ms();
+
+    /* ── codegen → assembly text in memory ───────────────────────────── */
     char *asm_path = swap_ext(input, ".s");
+    char  *asm_buf = NULL;
+    size_t asm_len = 0;
+    FILE  *asm_mem = open_memstream(&asm_buf, &asm_len);
+    if (!asm_mem) {
+        perror("xenlyc: open_memstream");
+        units_free(&units);
+        free(source);
+        free(asm_path);
+        return 1;
+    }
 
-    if (codegen(program, asm_path) != 0) {
+    int cg_rc = codegen_to(program, asm_mem);
+    fclose(asm_mem);
+    if (cg_rc != 0) {
         fprintf(stderr, "%s[xenlyc]%s Code generation failed.\n",
                 COL("1;31"), RESET);
+        units_free(&units);
         free(source);
+        free(asm_buf);
         free(asm_path);
         return 1;
     }
@@ -548,20 +749,60 @@ int main(int argc, char **argv) {
 
     /* ── --emit-asm: stop after .s ───────────────────────────────────── */
     if (emit_asm) {
+        if (write_file(asm_path, asm_buf, asm_len) != 0) {
+            fprintf(stderr, "%s[xenlyc]%s error: cannot write %s\n",
+                    COL("1;31"), RESET, asm_path);
+            free(asm_buf);
+            free(asm_path);
+            return 1;
+        }
         fprintf(stderr, "%s[xenlyc]%s Assembly written to %s\n",
                 COL("1;32"), RESET, asm_path);
         if (do_time)
             fprintf(stderr, "[xenlyc] read %.1f ms  parse %.1f ms  sema %.1f ms  codegen %.1f ms\n",
                     t_read-t0, t_parse-t_read, t_sema-t_parse, t_codegen-t_sema);
+        free(asm_buf);
         free(asm_path);
         return 0;
     }
 
-    /* ── assemble + link in one gcc call ─────────────────────────────── *
-     * We pass the .s file directly to gcc rather than calling `as` first.
-     * This removes the dependency on the system `as` binary and keeps the
-     * pipeline to a single external process.  gcc (or cc/clang fallback)
-     * handles both assembly and linking internally.
+    /* ── assemble: xlas in-process, .s on disk only when needed ─────── *
+     * xlas turns the in-memory text straight into <input>.o.  If it
+     * rejects the input (or the target is not x86-64 ELF) the .s is
+     * written and handed to the C compiler to assemble, as before.
+     * ------------------------------------------------------------------- */
+    char *obj_path = swap_ext(input, ".o");
+    const char *link_input = asm_path;
+    int asm_written = 0;
+    if (xlas_supported()) {
+        char xerr[256];
+        if (xlas_assemble(asm_buf, asm_len, obj_path, xerr, sizeof(xerr)) == XLAS_OK) {
+            link_input = obj_path;
+        } else if (verbose) {
+            fprintf(stderr, "%s[xenlyc]%s xlas: %s — using the system assembler\n",
+                    COL("2"), RESET, xerr);
+        }
+    }
+    if (link_input == asm_path || keep_asm) {
+        if (write_file(asm_path, asm_buf, asm_len) != 0) {
+            fprintf(stderr, "%s[xenlyc]%s error: cannot write %s\n",
+                    COL("1;31"), RESET, asm_path);
+            if (link_input == obj_path) unlink(obj_path);
+            units_free(&units);
+            free(asm_buf);
+            free(asm_path);
+            free(obj_path);
+            return 1;
+        }
+        asm_written = 1;
+    }
+    free(asm_buf);
+    double t_assemble = now_ms();
+
+    /* ── link: xlnk in-process, one cc call otherwise ─────────────────── *
+     * xlnk links the xlas object directly.  cc links everything else (or
+     * assembles + links the .s on the fallback path); gcc (or cc/clang)
+     * is found by scanning $PATH only when it is actually needed.
      *
      * libxly_rtc.a is searched in several standard locations so that the
      * binary works whether xenlyc is run from the build tree, installed to
@@ -634,58 +875,94 @@ int main(int argc, char **argv) {
                 candidates[3], candidates[4],
                 COL("1;33"), RESET,
                 COL("1;33"), RESET);
-            free(asm_path);
-            return 1;
+            goto fail;
         }
         if (verbose)
             fprintf(stderr, "%s[xenlyc]%s runtime: %s\n", COL("2"), RESET, rt_path);
     }
 
-    /* 2. Find a working C compiler (gcc → cc → clang) ------------------- */
+    /* 2. Link in-process with xlnk ------------------------------------ *
+     * Only the x86-64 ELF object from xlas goes through xlnk; the .s
+     * fallback, AArch64 and macOS keep the system linker.  If xlnk refuses
+     * the input it says why under --verbose and cc links it instead.    */
+    const char *out_name = output ? output : "a.out";
+    double link_times[XLNK_NUM_PHASES] = {0};
+    int linked_xlnk = 0;
+    if (use_xlnk && link_input == obj_path) {
+        XlnkConfig lc = xlnk_default_config();
+        LinkDiag   ld = { verbose, "" };
+        xlnk_add_object(&lc, obj_path);
+        for (int k = 0; k < units.nobjects; k++)
+            xlnk_add_object(&lc, units.objects[k]);
+        xlnk_add_library(&lc, rt_path);
+        xlnk_add_soname(&lc, "libm.so.6");
+        xlnk_add_soname(&lc, "libpthread.so.0");
+        xlnk_add_soname(&lc, "libdl.so.2");
+        xlnk_add_soname(&lc, "libresolv.so.2");
+        xlnk_add_soname(&lc, "libc.so.6");
+        lc.output        = out_name;
+        lc.entry         = "_start";
+        lc.is_static     = do_static;
+        lc.verbose       = verbose;
+        lc.diag          = link_diag;
+        lc.diag_userdata = &ld;
+        lc.times         = link_times;
+        int lrc = xlnk_link(&lc);
+        if (lrc == XLNK_OK) {
+            linked_xlnk = 1;
+        } else if (verbose) {
+            fprintf(stderr, "%s[xenlyc]%s xlnk: %s%s%s — using the system linker\n",
+                    COL("2"), RESET, xlnk_error_string(lrc),
+                    ld.first_err[0] ? ": " : "", ld.first_err);
+        }
+    }
+
+    /* 3. Otherwise find a working C compiler (gcc → cc → clang) -------- */
     const char *cc = NULL;
-    {
+    if (!linked_xlnk) {
         const char *try[] = { "gcc", "cc", "clang", NULL };
-        for (int k = 0; try[k]; k++) {
-            char probe[64];
-            snprintf(probe, sizeof(probe), "command -v %s >/dev/null 2>&1", try[k]);
-            if (system(probe) == 0) { cc = try[k]; break; }
-        }
+        for (int k = 0; try[k]; k++)
+            if (in_path(try[k])) { cc = try[k]; break; }
         if (!cc) {
             fprintf(stderr,
                 "%s[xenlyc]%s error: no C compiler found (tried gcc, cc, clang)\n"
                 "%s[xenlyc]%s  fix: install gcc — e.g.  sudo apt install gcc\n",
                 COL("1;31"), RESET,
                 COL("1;33"), RESET);
-            free(asm_path);
-            return 1;
+            goto fail;
         }
         if (verbose)
             fprintf(stderr, "%s[xenlyc]%s compiler: %s\n", COL("2"), RESET, cc);
     }
 
-    /* 3. Single compile+link command: cc -nostartfiles src.s rt.a → bin -- */
-    {
-        const char *out_name = output ? output : "a.out";
-        char cmd[4096];
+    /* 4. Single link command: cc -nostartfiles src.o rt.a → bin -------- */
+    if (!linked_xlnk) {
+        char cmd[8192];
+        char mods[4096];            /* the cached module objects, quoted */
+        size_t mlen = 0;
+        mods[0] = '\0';
+        for (int k = 0; k < units.nobjects && mlen < sizeof(mods); k++)
+            mlen += (size_t)snprintf(mods + mlen, sizeof(mods) - mlen,
+                                     " '%s'", units.objects[k]);
 
 #if defined(XLY_PLATFORM_MACOS) || defined(PLATFORM_MACOS)
         if (do_static)
             snprintf(cmd, sizeof(cmd),
-                "%s -nostartfiles -o '%s' '%s' '%s' -lm -lpthread -static 2>&1",
-                cc, out_name, asm_path, rt_path);
+                "%s -nostartfiles -o '%s' '%s'%s '%s' -lm -lpthread -static 2>&1",
+                cc, out_name, link_input, mods, rt_path);
         else
             snprintf(cmd, sizeof(cmd),
-                "%s -nostartfiles -o '%s' '%s' '%s' -lm -lpthread 2>&1",
-                cc, out_name, asm_path, rt_path);
+                "%s -nostartfiles -o '%s' '%s'%s '%s' -lm -lpthread 2>&1",
+                cc, out_name, link_input, mods, rt_path);
 #else
         if (do_static)
             snprintf(cmd, sizeof(cmd),
-                "%s -nostartfiles -o '%s' '%s' '%s' -lm -lpthread -ldl -lresolv -static 2>&1",
-                cc, out_name, asm_path, rt_path);
+                "%s -nostartfiles -o '%s' '%s'%s '%s' -lm -lpthread -ldl -lresolv -static 2>&1",
+                cc, out_name, link_input, mods, rt_path);
         else
             snprintf(cmd, sizeof(cmd),
-                "%s -nostartfiles -o '%s' '%s' '%s' -lm -lpthread -ldl -lresolv 2>&1",
-                cc, out_name, asm_path, rt_path);
+                "%s -nostartfiles -o '%s' '%s'%s '%s' -lm -lpthread -ldl -lresolv 2>&1",
+                cc, out_name, link_input, mods, rt_path);
 #endif
 
         if (verbose)
@@ -695,8 +972,7 @@ int main(int argc, char **argv) {
         if (!lpipe) {
             fprintf(stderr, "%s[xenlyc]%s error: cannot launch compiler (%s)\n",
                     COL("1;31"), RESET, cc);
-            free(asm_path);
-            return 1;
+            goto fail;
         }
         char lline[512];
         while (fgets(lline, sizeof(lline), lpipe))
@@ -706,37 +982,60 @@ int main(int argc, char **argv) {
             fprintf(stderr,
                 "%s[xenlyc]%s link failed (status %d) — command was:\n  %s\n",
                 COL("1;31"), RESET, lrc, cmd);
-            free(asm_path);
-            return 1;
+            goto fail;
         }
+    }
+    double t_link = now_ms();
 
-        double t_link = now_ms();
-        /* t_assemble reused: codegen→link is now one phase */
-        double t_assemble = t_link;
-
-        fprintf(stderr, "%s[xenlyc]%s OK  →  %s  (opt=%d)\n",
-                COL("1;32"), RESET, out_name, opt_level);
+    fprintf(stderr, "%s[xenlyc]%s OK  →  %s  (opt=%d)\n",
+            COL("1;32"), RESET, out_name, opt_level);
 
-        if (do_time) {
-            fprintf(stderr, "\n%s[xenlyc] compile times:%s\n", COL("1;36"), RESET);
-            fprintf(stderr, "  read    %6.1f ms\n", t_read     - t0);
-            fprintf(stderr, "  parse   %6.1f ms\n", t_parse    - t_read);
-            fprintf(stderr, "  sema    %6.1f ms\n", t_sema     - t_parse);
-            fprintf(stderr, "  codegen %6.1f ms\n", t_codegen  - t_sema);
-            fprintf(stderr, "  link    %6.1f ms\n", t_link     - t_codegen);
-            fprintf(stderr, "  total   %6.1f ms\n", t_link     - t0);
+    if (do_time) {
+        fprintf(stderr, "\n%s[xenlyc] compile times:%s\n", COL("1;36"), RESET);
+        fprintf(stderr, "  read    %6.1f ms\n", t_read     - t0);
+        fprintf(stderr, "  parse   %6.1f ms\n", t_parse    - t_read);
+        fprintf(stderr, "  sema    %6.1f ms\n", t_sema     - t_parse);
+        fprintf(stderr, "  astopt  %6.1f ms\n", t_opt      - t_sema);
+        if (units.count > 0)
+            fprintf(stderr, "  modules %6.1f ms  (%d built, %d cached)\n",
+                    t_units - t_opt, units.built, units.reused);
+        fprintf(stderr, "  codegen %6.1f ms\n", t_codegen  - t_units);
+        fprintf(stderr, "  asm     %6.1f ms%s\n", t_assemble - t_codegen,
+                link_input == obj_path ? "" : "  (system assembler, in link)");
+        fprintf(stderr, "  link    %6.1f ms%s\n", t_link     - t_assemble,
+                linked_xlnk ? "  (xlnk)" : "  (system linker)");
+        if (linked_xlnk) {
+            static const char *const phase[XLNK_NUM_PHASES] = {
+                "input", "resolve", "layout", "reloc", "write"
+            };
+            for (int k = 0; k < XLNK_NUM_PHASES; k++)
+                fprintf(stderr, "    %-7s %6.2f ms\n", phase[k], link_times[k]);
         }
-        (void)t_assemble;
+        fprintf(stderr, "  total   %6.1f ms\n", t_link     - t0);
     }
 
     /* ── cleanup temp files ───────────────────────────────────────────── */
-    if (!keep_asm)
+    if (link_input == obj_path)
+        unlink(obj_path);
+    if (asm_written && !keep_asm)
         unlink(asm_path);
-    else if (verbose)
+    else if (asm_written && verbose)
         fprintf(stderr, "%s[xenlyc]%s kept assembly: %s\n",
                 COL("2"), RESET, asm_path);
 
+    units_free(&units);
     free(asm_path);
+    free(obj_path);
 
     return 0;
+
+fail:
+    if (link_input == obj_path)
+        unlink(obj_path);
+    if (asm_written && !keep_asm)
+        unlink(asm_path);
+    units_free(&units);
+    free(asm_path);
+    free(obj_path);
+    return 1;
 }
@@ -0,0 +1,579 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * xenlyc_units.c — separate compilation of imported user modules
+ *
+ * See xenlyc_units.h for the cache layout.  A build walks the import graph
+ * depth-first from the program:
+ *
+ *   1. read the module and hash it (FNV-1a 64)
+ *   2. interface: reuse <unit>.xli when it records that hash; otherwise
+ *      parse the module, collect its imports and exports, rewrite the .xli
+ *   3. visit the user modules it imports (cycles are an error, as in the
+ *      interpreter)
+ *   4. object key = hash(source, compiler, options, imported interfaces);
+ *      reuse <unit>-<key>.o if present, else compile it with codegen in
+ *      unit mode and xlas, write it under a temporary name and rename it
+ *      into place, then drop the unit's older objects
+ *
+ * Import paths resolve like the interpreter's: "lib/m" → <dir>/lib/m.xe
+ * relative to the importing file, with the stdlib module names (math, sys,
+ * ...) taking precedence over files.
+ */
+
+/* _GNU_SOURCE: realpath() under -D_POSIX_C_SOURCE (see modules.c). */
+#define _GNU_SOURCE
+
+#include "xenlyc_units.h"
+#include "lexer.h"
+#include "parser.h"
+#include "sema.h"
+#include "astopt.h"
+#include "codegen.h"
+#include "xenly_asm.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+
+#ifndef PATH_MAX
+#  define PATH_MAX 4096
+#endif
+
+/* Bump when the .xli format or the unit ABI changes */
+#define UNIT_FORMAT 1
+
+typedef struct { char *written; int unit; } UnitDep;      /* units[] index */
+typedef struct { char *name; int arity; } UnitExport;
+
+struct XlyUnit {
+    char       *path;       /* absolute path of the .xe                   */
+    char       *dir;        /* its directory: imports resolve against it  */
+    char       *name;       /* unit name: <file>_<path hash>              */
+    uint64_t    src_hash;
+    uint64_t    iface_hash; /* exports and arities only                   */
+    char      **imports;    /* every import path as written               */
+    int         nimports;
+    UnitDep    *deps;       /* the ones that are user modules             */
+    int         ndeps;
+    UnitExport *exports;
+    int         nexports;
+    int         state;      /* UNIT_NEW / UNIT_VISITING / UNIT_DONE       */
+};
+
+enum { UNIT_NEW, UNIT_VISITING, UNIT_DONE };
+
+/* ══════════════════════════════════════════════════════════════════════════════
+ * HELPERS
+ * ══════════════════════════════════════════════════════════════════════════════ */
+static uint64_t fnv1a(uint64_t h, const void *data, size_t len) {
+    const unsigned char *p = (const unsigned char *)data;
+    for (size_t i = 0; i < len; i++) { h ^= p[i]; h *= 0x100000001b3ULL; }
+    return h;
+}
+#define FNV_SEED 0xcbf29ce484222325ULL
+
+static uint64_t fnv1a_str(uint64_t h, const char *s) {
+    return fnv1a(h, s, strlen(s) + 1);      /* the NUL separates fields */
+}
+
+static char *read_all(const char *path, size_t *out_len) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return NULL;
+    fseek(f, 0, SEEK_END);
+    long sz = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *buf = (char *)malloc((size_t)sz + 1);
+    if (!buf) { fclose(f); return NULL; }
+    size_t rd = fread(buf, 1, (size_t)sz, f);
+    fclose(f);
+    buf[rd] = '\0';
+    if (out_len) *out_len = rd;
+    return buf;
+}
+
+static char *dir_of(const char *path) {
+    const char *slash = strrchr(path, '/');
+    if (!slash) return strdup(".");
+    if (slash == path) return strdup("/");
+    size_t n = (size_t)(slash - path);
+    char *d = (char *)malloc(n + 1);
+    memcpy(d, path, n);
+    d[n] = '\0';
+    return d;
+}
+
+/* The stdlib modules the runtime provides (modules.c: modules_get) */
+static int is_native_module(const char *name) {
+    static const char *const native[] = {
+        "math", "string", "io", "array", "os", "type", "crypto", "path",
+        "multiproc", "sys", "fs", "http", "reflect", "iter", NULL
+    };
+    for (int i = 0; native[i]; i++)
+        if (strcmp(native[i], name) == 0) return 1;
+    return 0;
+}
+
+/* `import "written"` from a file in `dir`: the module's absolute path, or
+ * NULL when it is a stdlib module or no such file exists. */
+static char *resolve_import(const char *dir, const char *written) {
+    if (is_native_module(written)) return NULL;
+    size_t len = strlen(written);
+    int needs_ext = len < 3 || strcmp(written + len - 3, ".xe") != 0;
+    char probe[PATH_MAX], abs[PATH_MAX];
+    if (written[0] == '/')
+        snprintf(probe, sizeof(probe), "%s%s", written, needs_ext ? ".xe" : "");
+    else
+        snprintf(probe, sizeof(probe), "%s/%s%s", dir, written, needs_ext ? ".xe" : "");
+    if (!realpath(probe, abs)) return NULL;
+    return strdup(abs);
+}
+
+/* Unit name: file name (identifier characters only) + path hash */
+static char *unit_name_for(const char *abs) {
+    const char *slash = strrchr(abs, '/');
+    const char *base  = slash ? slash + 1 : abs;
+    size_t len = strlen(base);
+    if (len > 3 && strcmp(base + len - 3, ".xe") == 0) len -= 3;
+    if (len > 64) len = 64;
+    char *name = (char *)malloc(len + 10);
+    for (size_t i = 0; i < len; i++) {
+        char c = base[i];
+        int ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+                 (c >= '0' && c <= '9') || c == '_';
+        name[i] = ok ? c : '_';
+    }
+    snprintf(name + len, 10, "_%08x", (unsigned)(fnv1a_str(FNV_SEED, abs) >> 32));
+    return name;
+}
+
+/* Identity of this compiler binary, so a rebuilt xenlyc never links the
+ * objects an older one produced. */
+static uint64_t compiler_id(void) {
+    static uint64_t id;
+    if (id) return id;
+    id = fnv1a_str(FNV_SEED, __DATE__ " " __TIME__);
+    struct stat st;
+    if (stat("/proc/self/exe", &st) == 0) {
+        id = fnv1a(id, &st.st_size,  sizeof(st.st_size));
+        id = fnv1a(id, &st.st_mtime, sizeof(st.st_mtime));
+        id = fnv1a(id, &st.st_ino,   sizeof(st.st_ino));
+    }
+    return id;
+}
+
+/* ══════════════════════════════════════════════════════════════════════════════
+ * INTERFACES
+ * ══════════════════════════════════════════════════════════════════════════════ */
+static void add_import(XlyUnit *u, const char *written) {
+    for (int i = 0; i < u->nimports; i++)
+        if (strcmp(u->imports[i], written) == 0) return;
+    u->imports = (char **)realloc(u->imports, sizeof(char *) * (size_t)(u->nimports + 1));
+    u->imports[u->nimports++] = strdup(written);
+}
+
+static void add_export(XlyUnit *u, const char *name, int arity) {
+    u->exports = (UnitExport *)realloc(u->exports,
+                 sizeof(UnitExport) * (size_t)(u->nexports + 1));
+    u->exports[u->nexports].name  = strdup(name);
+    u->exports[u->nexports].arity = arity;
+    u->nexports++;
+}
+
+/* Every import statement, wherever it sits */
+static void scan_imports(XlyUnit *u, ASTNode *n) {
+    if (!n) return;
+    if (n->type == NODE_IMPORT && n->str_value) add_import(u, n->str_value);
+    for (size_t i = 0; i < n->child_count; i++) scan_imports(u, n->children[i]);
+}
+
+/* Exported top-level fns; exported classes stay private to the unit */
+static void scan_exports(XlyUnit *u, ASTNode *program) {
+    for (size_t i = 0; i < program->child_count; i++) {
+        ASTNode *ex = program->children[i];
+        if (!ex || ex->type != NODE_EXPORT || ex->child_count == 0) continue;
+        ASTNode *d = ex->children[0];
+        if (d && d->type == NODE_FN_DECL && d->str_value)
+            add_export(u, d->str_value, (int)d->param_count);
+    }
+}
+
+static int write_interface(const char *path, const XlyUnit *u) {
+    char tmp[PATH_MAX];
+    if (snprintf(tmp, sizeof(tmp), "%s.%d.tmp", path, (int)getpid()) >= (int)sizeof(tmp))
+        return -1;
+    FILE *f = fopen(tmp, "w");
+    if (!f) return -1;
+    fprintf(f, "xli %d\n", UNIT_FORMAT);
+    fprintf(f, "source %016llx\n", (unsigned long long)u->src_hash);
+    for (int i = 0; i < u->nimports; i++) fprintf(f, "import %s\n", u->imports[i]);
+    for (int i = 0; i < u->nexports; i++)
+        fprintf(f, "export %s %d\n", u->exports[i].name, u->exports[i].arity);
+    if (fclose(f) != 0 || rename(tmp, path) != 0) { unlink(tmp); return -1; }
+    return 0;
+}
+
+/* Load `path` if it describes the current source; 1 on success */
+static int read_interface(const char *path, XlyUnit *u) {
+    char *text = read_all(path, NULL);
+    if (!text) return 0;
+    int ok = 0, format = 0;
+    unsigned long long src = 0;
+    for (char *line = text, *next; line && *line; line = next) {
+        next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+        if (sscanf(line, "xli %d", &format) == 1) continue;
+        if (sscanf(line, "source %llx", &src) == 1) {
+            ok = format == UNIT_FORMAT && src == u->src_hash;
+            if (!ok) break;
+        } else if (strncmp(line, "import ", 7) == 0) {
+            add_import(u, line + 7);
+        } else if (strncmp(line, "export ", 7) == 0) {
+            char *sp = strrchr(line + 7, ' ');
+            if (!sp) { ok = 0; break; }
+            *sp = '\0';
+            add_export(u, line + 7, atoi(sp + 1));
+        }
+    }
+    free(text);
+    if (!ok) {                          /* stale or damaged: start over */
+        for (int i = 0; i < u->nimports; i++) free(u->imports[i]);
+        for (int i = 0; i < u->nexports; i++) free(u->exports[i].name);
+        free(u->imports); free(u->exports);
+        u->imports = NULL; u->exports = NULL;
+        u->nimports = u->nexports = 0;
+    }
+    return ok;
+}
+
+/* ══════════════════════════════════════════════════════════════════════════════
+ * BUILD
+ * ══════════════════════════════════════════════════════════════════════════════ */
+typedef struct {
+    UnitSet        *us;
+    const UnitOpts *o;
+    char            cache[PATH_MAX];
+    int             cache_ready;
+} Build;
+
+typedef struct {                /* a module parsed in this run */
+    char    *source;
+    Lexer   *lexer;
+    Parser  *parser;
+    ASTNode *program;
+} Parsed;
+
+static void parsed_free(Parsed *p) {
+    if (p->program) ast_node_destroy(p->program);
+    if (p->parser)  parser_destroy(p->parser);
+    if (p->lexer)   lexer_destroy(p->lexer);
+    free(p->source);
+    memset(p, 0, sizeof(*p));
+}
+
+static int cache_open(Build *b) {
+    if (b->cache_ready) return 0;
+    if (mkdir(b->cache, 0755) != 0 && errno != EEXIST) {
+        fprintf(stderr, "[xenlyc] error: cannot create module cache %s: %s\n",
+                b->cache, strerror(errno));
+        return -1;
+    }
+    b->cache_ready = 1;
+    return 0;
+}
+
+/* Drop the objects an earlier build left for unit `name`, except `keep` */
+static void prune_objects(const Build *b, const char *name, const char *keep) {
+    DIR *d = opendir(b->cache);
+    if (!d) return;
+    size_t nlen = strlen(name);
+    struct dirent *e;
+    while ((e = readdir(d)) != NULL) {
+        size_t len = strlen(e->d_name);
+        if (len < nlen + 3 || strncmp(e->d_name, name, nlen) != 0 ||
+            e->d_name[nlen] != '-' || strcmp(e->d_name + len - 2, ".o") != 0)
+            continue;
+        char path[PATH_MAX];
+        if (snprintf(path, sizeof(path), "%s/%s", b->cache, e->d_name) < (int)sizeof(path) &&
+            strcmp(path, keep) != 0)
+            unlink(path);
+    }
+    closedir(d);
+}
+
+/* Declare to codegen the user modules `u` imports */
+static void declare_imports(UnitSet *us, const XlyUnit *u) {
+    codegen_clear_imports();
+    for (int i = 0; i < u->ndeps; i++) {
+        const XlyUnit *d = &us->units[u->deps[i].unit];
+        codegen_add_import(u->deps[i].written, d->name, NULL, 0);
+        for (int k = 0; k < d->nexports; k++)
+            codegen_add_import(u->deps[i].written, d->name,
+                               d->exports[k].name, d->exports[k].arity);
+    }
+}
+
+static int unit_parse(const XlyUnit *u, Parsed *p, const UnitOpts *o) {
+    size_t len = 0;
+    p->source = read_all(u->path, &len);
+    if (!p->source) {
+        fprintf(stderr, "[xenlyc] error: cannot open module '%s'\n", u->path);
+        return -1;
+    }
+    p->lexer   = lexer_create(p->source, len);
+    p->parser  = parser_create(p->lexer);
+    p->program = parser_parse(p->parser);
+    if (p->parser->had_error) {
+        fprintf(stderr, "[xenlyc] Parse errors in module '%s' — aborting.\n", u->path);
+        return -1;
+    }
+    if (o->sema) {
+        SemaOpts so = sema_default_opts();
+        so.color   = o->color;
+        so.verbose = o->verbose;
+        int nerr = 0, nwarn = 0;
+        if (sema_analyze(p->program, &so, &nerr, &nwarn) == SEMA_ERROR) {
+            fprintf(stderr, "[xenlyc] Semantic errors in module '%s' — aborting.\n", u->path);
+            return -1;
+        }
+    }
+    if (o->opt_level >= 1) ast_optimize(p->program, NULL);
+    return 0;
+}
+
+/* Compile `u` (already parsed) into the object `obj` */
+static int unit_compile(Build *b, int ui, Parsed *p, const char *obj) {
+    XlyUnit *u = &b->us->units[ui];
+    char  *asm_buf = NULL;
+    size_t asm_len = 0;
+    FILE  *mem = open_memstream(&asm_buf, &asm_len);
+    if (!mem) { perror("xenlyc: open_memstream"); return -1; }
+    declare_imports(b->us, u);
+    codegen_set_unit(u->name);
+    int rc = codegen_to(p->program, mem);
+    codegen_set_unit(NULL);
+    codegen_clear_imports();
+    fclose(mem);
+    if (rc != 0) {
+        fprintf(stderr, "[xenlyc] Code generation failed for module '%s'.\n", u->path);
+        free(asm_buf);
+        return -1;
+    }
+
+    char tmp[PATH_MAX], err[256];
+    if (snprintf(tmp, sizeof(tmp), "%s.%d.tmp", obj, (int)getpid()) >= (int)sizeof(tmp)) {
+        fprintf(stderr, "[xenlyc] error: module cache path too long: %s\n", obj);
+        free(asm_buf);
+        return -1;
+    }
+    rc = xlas_assemble(asm_buf, asm_len, tmp, err, sizeof(err));
+    free(asm_buf);
+    if (rc != XLAS_OK) {
+        fprintf(stderr, "[xenlyc] error: module '%s': xlas: %s\n", u->path, err);
+        unlink(tmp);
+        return -1;
+    }
+    if (rename(tmp, obj) != 0) {
+        fprintf(stderr, "[xenlyc] error: cannot write %s: %s\n", obj, strerror(errno));
+        unlink(tmp);
+        return -1;
+    }
+    prune_objects(b, u->name, obj);
+    return 0;
+}
+
+static int unit_visit(Build *b, const char *abs);
+
+/* Visit the user modules among u's imports, recording them as deps */
+static int unit_visit_deps(Build *b, int ui) {
+    UnitSet *us = b->us;
+    char *dir = strdup(us->units[ui].dir);
+    int nimports = us->units[ui].nimports;
+    for (int i = 0; i < nimports; i++) {
+        const char *written = us->units[ui].imports[i];
+        char *abs = resolve_import(dir, written);
+        if (!abs) continue;
+        int di = unit_visit(b, abs);
+        free(abs);
+        if (di < 0) { free(dir); return -1; }
+        XlyUnit *u = &us->units[ui];            /* units[] may have moved */
+        u->deps = (UnitDep *)realloc(u->deps, sizeof(UnitDep) * (size_t)(u->ndeps + 1));
+        u->deps[u->ndeps].written = strdup(written);
+        u->deps[u->ndeps].unit    = di;
+        u->ndeps++;
+    }
+    free(dir);
+    return 0;
+}
+
+static int unit_visit(Build *b, const char *abs) {
+    UnitSet *us = b->us;
+    for (int i = 0; i < us->count; i++) {
+        if (strcmp(us->units[i].path, abs) != 0) continue;
+        if (us->units[i].state == UNIT_VISITING) {
+            fprintf(stderr, "[xenlyc] error: circular import of '%s'\n", abs);
+            return -1;
+        }
+        return i;
+    }
+
+    if (us->count >= us->cap) {
+        us->cap = us->cap ? us->cap * 2 : 8;
+        us->units = (XlyUnit *)realloc(us->units, sizeof(XlyUnit) * (size_t)us->cap);
+    }
+    int ui = us->count++;
+    XlyUnit *u = &us->units[ui];
+    memset(u, 0, sizeof(*u));
+    u->path  = strdup(abs);
+    u->dir   = dir_of(abs);
+    u->name  = unit_name_for(abs);
+    u->state = UNIT_VISITING;
+
+    size_t len = 0;
+    char *src = read_all(abs, &len);
+    if (!src) {
+        fprintf(stderr, "[xenlyc] error: cannot open module '%s'\n", abs);
+        return -1;
+    }
+    u->src_hash = fnv1a(FNV_SEED, src, len);
+    free(src);
+
+    /* interface: from the .xli when it matches, else from the source */
+    Parsed p = {0};
+    char xli[PATH_MAX];
+    if (cache_open(b) != 0) return -1;
+    if (snprintf(xli, sizeof(xli), "%s/%s.xli", b->cache, u->name) >= (int)sizeof(xli)) {
+        fprintf(stderr, "[xenlyc] error: module cache path too long: %s\n", b->cache);
+        return -1;
+    }
+    if (!read_interface(xli, u)) {
+        if (unit_parse(u, &p, b->o) != 0) { parsed_free(&p); return -1; }
+        scan_imports(u, p.program);
+        scan_exports(u, p.program);
+        if (write_interface(xli, u) != 0 && b->o->verbose)
+            fprintf(stderr, "[xenlyc] note: cannot write %s\n", xli);
+    }
+
+    if (unit_visit_deps(b, ui) != 0) { parsed_free(&p); return -1; }
+    u = &us->units[ui];
+
+    uint64_t h = FNV_SEED;
+    for (int i = 0; i < u->nexports; i++) {
+        h = fnv1a_str(h, u->exports[i].name);
+        h = fnv1a(h, &u->exports[i].arity, sizeof(int));
+    }
+    u->iface_hash = h;
+
+    /* object key: everything that can change the code of this unit */
+    uint64_t key = fnv1a(FNV_SEED, &u->src_hash, sizeof(u->src_hash));
+    uint64_t cid = compiler_id();
+    int fmt = UNIT_FORMAT;
+    key = fnv1a(key, &cid, sizeof(cid));
+    key = fnv1a(key, &fmt, sizeof(fmt));
+    key = fnv1a(key, &b->o->opt_level, sizeof(int));
+    unsigned long long prof = codegen_profile_hash();
+    key = fnv1a(key, &prof, sizeof(prof));
+    key = fnv1a_str(key, u->name);
+    for (int i = 0; i < u->ndeps; i++) {
+        const XlyUnit *d = &us->units[u->deps[i].unit];
+        key = fnv1a_str(key, u->deps[i].written);
+        key = fnv1a_str(key, d->name);
+        key = fnv1a(key, &d->iface_hash, sizeof(d->iface_hash));
+    }
+
+    char obj[PATH_MAX];
+    if (snprintf(obj, sizeof(obj), "%s/%s-%016llx.o", b->cache, u->name,
+                 (unsigned long long)key) >= (int)sizeof(obj)) {
+        fprintf(stderr, "[xenlyc] error: module cache path too long: %s\n", b->cache);
+        parsed_free(&p);
+        return -1;
+    }
+    if (access(obj, R_OK) == 0) {
+        us->reused++;
+        if (b->o->verbose)
+            fprintf(stderr, "[xenlyc] module %s: cached\n", u->path);
+    } else {
+        if (!p.program && unit_parse(u, &p, b->o) != 0) { parsed_free(&p); return -1; }
+        if (unit_compile(b, ui, &p, obj) != 0) { parsed_free(&p); return -1; }
+        us->built++;
+        if (b->o->verbose)
+            fprintf(stderr, "[xenlyc] module %s: compiled → %s\n", u->path, obj);
+    }
+    parsed_free(&p);
+
+    us->objects = (char **)realloc(us->objects, sizeof(char *) * (size_t)(us->nobjects + 1));
+    us->objects[us->nobjects++] = strdup(obj);
+    us->units[ui].state = UNIT_DONE;
+    return ui;
+}
+
+int units_build(UnitSet *us, const UnitOpts *o, const char *input, ASTNode *program) {
+    memset(us, 0, sizeof(*us));
+    codegen_clear_imports();
+
+    char abs_input[PATH_MAX];
+    if (!realpath(input, abs_input)) snprintf(abs_input, sizeof(abs_input), "%s", input);
+
+    /* the program is a unit without a cache entry of its own */
+    XlyUnit top;
+    memset(&top, 0, sizeof(top));
+    top.dir = dir_of(abs_input);
+    scan_imports(&top, program);
+
+    Build b;
+    memset(&b, 0, sizeof(b));
+    b.us = us;
+    b.o  = o;
+    if (o->cache_dir) snprintf(b.cache, sizeof(b.cache), "%s", o->cache_dir);
+    else              snprintf(b.cache, sizeof(b.cache), "%s/.xenly-cache", top.dir);
+
+    int rc = 0;
+    for (int i = 0; i < top.nimports && rc == 0; i++) {
+        char *abs = resolve_import(top.dir, top.imports[i]);
+        if (!abs) continue;
+        int di = unit_visit(&b, abs);
+        free(abs);
+        if (di < 0) { rc = -1; break; }
+        top.deps = (UnitDep *)realloc(top.deps, sizeof(UnitDep) * (size_t)(top.ndeps + 1));
+        top.deps[top.ndeps].written = strdup(top.imports[i]);
+        top.deps[top.ndeps].unit    = di;
+        top.ndeps++;
+    }
+    if (rc == 0) declare_imports(us, &top);
+
+    for (int i = 0; i < top.nimports; i++) free(top.imports[i]);
+    free(top.imports);
+    for (int i = 0; i < top.ndeps; i++) free(top.deps[i].written);
+    free(top.deps);
+    free(top.dir);
+    return rc;
+}
+
+void units_free(UnitSet *us) {
+    for (int i = 0; i < us->count; i++) {
+        XlyUnit *u = &us->units[i];
+        free(u->path); free(u->dir); free(u->name);
+        for (int k = 0; k < u->nimports; k++) free(u->imports[k]);
+        free(u->imports);
+        for (int k = 0; k < u->ndeps; k++) free(u->deps[k].written);
+        free(u->deps);
+        for (int k = 0; k < u->nexports; k++) free(u->exports[k].name);
+        free(u->exports);
+    }
+    free(us->units);
+    for (int i = 0; i < us->nobjects; i++) free(us->objects[i]);
+    free(us->objects);
+    memset(us, 0, sizeof(*us));
+}
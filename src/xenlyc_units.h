@@ -0,0 +1,72 @@
+/*
+ * XENLY - high-level and general-purpose programming language
+ * created, designed, and developed by Cyril John Magayaga (cjmagayaga957@gmail.com, cyrilmagayaga@proton.me).
+ *
+ * It is initially written in C programming language.
+ *
+ * It is available for the Linux and macOS operating systems.
+ *
+ */
+/*
+ * xenlyc_units.h — separate compilation of imported user modules
+ *
+ * Every user module a program imports (`import "lib/m"` → lib/m.xe next to
+ * the importing file) is compiled on its own into an object in the cache
+ * directory, and only when something it depends on changed:
+ *
+ *   <cache>/<unit>.xli        interface: source hash, the user modules it
+ *                             imports, its exported fns and their arity
+ *   <cache>/<unit>-<key>.o    object; <key> hashes the source, compiler
+ *                             version, options and the interfaces of the
+ *                             modules it imports
+ *
+ * <unit> is the module's file name plus a hash of its absolute path, so
+ * two lib/util.xe in different directories never share symbols.
+ *
+ * An unchanged module costs a read and a hash: neither it nor its .xli is
+ * parsed again.  A changed module is recompiled; its importers only when
+ * its interface (exports, arities) changed too.  The importing program
+ * itself is always compiled; units_build() declares the modules it imports
+ * to codegen, and the driver links units.objects after its own object.
+ *
+ * Pipeline position:
+ *   main.xe ─┬─ codegen → xlas → main.o ───────────────┐
+ *            └─ units_build: m.xe → codegen → xlas → <cache>/m-<key>.o
+ *                                                       └→ xlnk → binary
+ */
+
+#ifndef XENLYC_UNITS_H
+#define XENLYC_UNITS_H
+
+#include "ast.h"
+
+typedef struct {
+    const char *cache_dir;  /* NULL = .xenly-cache next to the input      */
+    int         opt_level;
+    int         verbose;
+    int         color;
+    int         sema;       /* run semantic analysis on rebuilt modules   */
+} UnitOpts;
+
+typedef struct XlyUnit XlyUnit;
+
+typedef struct {
+    XlyUnit *units;         /* dependencies ahead of their importers      */
+    int      count, cap;
+    char   **objects;       /* one cached object per unit, to link        */
+    int      nobjects;
+    int      built;         /* units compiled by this run                 */
+    int      reused;        /* units whose cached object was current      */
+} UnitSet;
+
+/*
+ * units_build — bring the object of every user module `program` (parsed
+ * from `input`) imports, directly or not, up to date, and declare its
+ * direct imports to codegen (codegen_add_import).  Returns 0 on success;
+ * on failure a diagnostic has been printed.
+ */
+int  units_build(UnitSet *us, const UnitOpts *o, const char *input, ASTNode *program);
+
+void units_free(UnitSet *us);
+
+#endif /* XENLYC_UNITS_H */
@@ -30,6 +30,10 @@
  *                        xly_array_reverse, xly_array_contains
  */
 
+/* _GNU_SOURCE: MAP_ANONYMOUS for generator stacks (see jit.c). */
+#if !defined(__APPLE__)
+#define _GNU_SOURCE
+#endif
 #include "xly_rt.h"
 #include "unicode.h"
 #include <stdio.h>
@@ -39,6 +43,12 @@
 #include <unistd.h>
 #include <errno.h>
 #include <stdint.h>
+#include <sys/mman.h>
+#include <pthread.h>
+
+#if defined(__APPLE__) && !defined(MAP_ANONYMOUS)
+#define MAP_ANONYMOUS 0x1000   // MAP_ANON, hidden by strict _POSIX_C_SOURCE
+#endif
 
 /* ── internal struct layout ─────────────────────────────────────────────
  * Must match interpreter.h  Value / ValueType exactly so that modules.c
@@ -53,7 +63,10 @@
  * Exact field offsets (64-bit):
  *   type=0  num=8  str=16  boolean=24  local=28  fn_shared=32  refcount=36
  *   fn=40  builtin_fn=48  inner=56  class_def=64  instance=72
- *   array=80  array_len=88  array_cap=96
+ *   array=80  array_len=88  array_cap=96  variant=104
+ *
+ * A variant built by compiled code keeps its compile-time tag id in
+ * `boolean` (unused for variants) so match can dispatch without strcmp.
  *                                                                         */
 
 typedef enum {
@@ -83,15 +96,15 @@ struct XlyVal {
     ValType   type;          /* offset  0 — 4 bytes + 4 pad               */
     double    num;           /* offset  8                                  */
     char     *str;           /* offset 16                                  */
-    int       boolean;       /* offset 24                                  */
+    int       boolean;       /* offset 24 — a function's: takes a receiver */
     int       local;         /* offset 28                                  */
     int       fn_shared;     /* offset 32 — must exist; unused at runtime  */
-    int       refcount;      /* offset 36 — must exist; unused at runtime  */
+    int       refcount;      /* offset 36 — XLY_NOT_HEAP or 0              */
     void     *fn;            /* offset 40 — FnDef* in interp; NULL here    */
     void     *builtin_fn;    /* offset 48 — raw fn ptr for compiled fns    */
     struct XlyVal *inner;    /* offset 56 — closure env ptr (reused)       */
-    void     *class_def;     /* offset 64 — unused in compiled code        */
-    void     *instance;      /* offset 72 — unused in compiled code        */
+    void     *class_def;     /* offset 64 — XlyGen* of a generator         */
+    void     *instance;      /* offset 72 — XlyObjStore* (VAL_INSTANCE)    */
     struct XlyVal **array;   /* offset 80 — VAL_ARRAY elements             */
     size_t    array_len;     /* offset 88                                  */
     size_t    array_cap;     /* offset 96                                  */
@@ -103,45 +116,65 @@ struct XlyVal {
     } variant;               /* offset 104                                 */
 };
 
+static const XlyClass *xly_class_of(XlyVal *v);   /* NULL unless a class instance */
+
+/* Every value, closure env and capture cell is a slot of the collected
+ * heap; see GARBAGE COLLECTION at the end of this file.                  */
+enum { GC_FREE, GC_VAL, GC_CELL, GC_ENV, GC_ENV_TAIL };
+static void    *gc_alloc(int kind);
+static XlyVal **gc_alloc_env(size_t n);
+static int      gc_owns(const XlyVal *v);
+static void     gc_pin(XlyVal *v);
+static XlyVal  *gc_unpin(XlyVal *v);
+static XlyVal  *xly_gc_call(const char *fn, XlyVal **args, size_t argc);
+
 /* ══════════════════════════════════════════════════════════════════════════════
  * CONSTRUCTORS
  * ══════════════════════════════════════════════════════════════════════════════ */
 
 XlyVal *xly_num(double n) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type = VAL_NUMBER;
     v->num  = n;
     return v;
 }
 
 XlyVal *xly_str(const char *s) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type = VAL_STRING;
     v->str  = s ? strdup(s) : strdup("");
     return v;
 }
 
+/* Values that do not live on the heap have refcount XLY_NOT_HEAP: the
+ * shared null / true / false below, number constants xenlyc lays out in
+ * read-only data and temporaries it builds in a function's frame (see
+ * pass_escape in ir.c).  Nothing writes to a value once it is built, and
+ * value_destroy leaves these alone.                                      */
+#define XLY_NOT_HEAP (-1)
+
+static XlyVal xly_null_val  = { .type = VAL_NULL, .refcount = XLY_NOT_HEAP };
+static XlyVal xly_true_val  = { .type = VAL_BOOL, .boolean = 1, .refcount = XLY_NOT_HEAP };
+static XlyVal xly_false_val = { .type = VAL_BOOL, .boolean = 0, .refcount = XLY_NOT_HEAP };
+
 XlyVal *xly_bool(int b) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
-    v->type    = VAL_BOOL;
-    v->boolean = b ? 1 : 0;
-    return v;
+    return b ? &xly_true_val : &xly_false_val;
 }
 
 XlyVal *xly_null(void) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
-    v->type = VAL_NULL;
-    return v;
+    return &xly_null_val;
 }
 
-/* xly_make_variant(tag_str, fields_array, nfields) → VAL_ENUM_VARIANT
+/* xly_make_variant(tag_str, fields_array, nfields, tag_id) → VAL_ENUM_VARIANT
  * tag_str    : XlyVal* string holding the variant name (e.g. "Some")
  * fields_arr : XlyVal** array of field values (may be NULL if nfields==0)
  * nfields    : XlyVal* number holding field count
+ * tag_id     : the compiler's id for the tag (>= 1), stored in ->boolean
  * Called from compiled code for both parameterless and parametric variants. */
-XlyVal *xly_make_variant(XlyVal *tag_val, XlyVal **fields, int nfields) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
+XlyVal *xly_make_variant(XlyVal *tag_val, XlyVal **fields, int nfields, int tag_id) {
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type = VAL_ENUM_VARIANT;
+    v->boolean = tag_id;
     v->variant.tag = strdup(tag_val && tag_val->str ? tag_val->str : "?");
     v->variant.field_count = (size_t)nfields;
     if (nfields > 0 && fields) {
@@ -232,6 +265,12 @@ char *xly_to_cstr(XlyVal *v) {
             out[pos] = '\0';
             return out;
         }
+        case VAL_INSTANCE: {
+            const XlyClass *cls = xly_class_of(v);
+            if (!cls) return strdup("<object>");
+            snprintf(buf, sizeof(buf), "<%s instance>", cls->name);
+            return strdup(buf);
+        }
         default: return strdup("<object>");
     }
 }
@@ -311,15 +350,20 @@ XlyVal *xly_gte(XlyVal *a, XlyVal *b) { return xly_bool(a->num >= b->num); }
  * I/O
  * ══════════════════════════════════════════════════════════════════════════════ */
 
+/* One line at a time: tasks printing at once do not interleave. */
 void xly_print(XlyVal **vals, size_t n) {
+    char **s = (char **)malloc(sizeof(char *) * (n ? n : 1));
+    for (size_t i = 0; i < n; i++) s[i] = xly_to_cstr(vals[i]);
+    flockfile(stdout);
     for (size_t i = 0; i < n; i++) {
-        if (i) putchar(' ');
-        char *s = xly_to_cstr(vals[i]);
-        fputs(s, stdout);
-        free(s);
+        if (i) putchar_unlocked(' ');
+        fputs(s[i], stdout);
+        free(s[i]);
     }
-    putchar('\n');
+    putchar_unlocked('\n');
     fflush(stdout);
+    funlockfile(stdout);
+    free(s);
 }
 
 XlyVal *xly_input(XlyVal *prompt) {
@@ -623,7 +667,7 @@ XlyVal *xly_perror(XlyVal *msg) {
  * ══════════════════════════════════════════════════════════════════════════════ */
 
 XlyVal *xly_array_create(XlyVal **elems, size_t n) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type      = VAL_ARRAY;
     v->array_len = n;
     v->array_cap = n ? n : 4;
@@ -701,11 +745,417 @@ XlyVal *xly_array_contains(XlyVal *arr, XlyVal *val) {
     return xly_bool(0);
 }
 
+/* ══════════════════════════════════════════════════════════════════════════════
+ * THREADS
+ *
+ * Compiled code runs on several threads at once: main and the workers
+ * that run spawned tasks.  The runtime's own state is one of
+ *   • the thread's: the running generator and its stack pool, the spaces
+ *     it allocates from and its open arenas (see GARBAGE COLLECTION)
+ *   • set up before the first spawn and only read after: unit roots,
+ *     profile tables
+ *   • locked: the chunk table, the thread list and the task queue under
+ *     rt_lock; the atom table under its own lock; channels and futures
+ *     under theirs
+ * A method's receiver is an argument (xly_obj_call).  The program's own
+ * values are not locked: tasks that change one array or object at the
+ * same time race, as in the interpreter; send it over a channel instead.
+ *
+ * The collector stops the world, cooperatively.  Each thread running
+ * compiled code has an XlyThread and counts in rt_running until it
+ * parks: at a safepoint (rt_safepoint, from gc_take) once a collection
+ * asks, or around a wait that never touches the heap — a channel,
+ * future or select wait (rt_release / rt_reacquire), an idle worker
+ * (rt_wait).  A parked thread's `sp` is where it stopped; the collector
+ * scans that stack up to `base`, with the thread's generator chain.  It
+ * runs once rt_running is down to itself, and a parked thread resumes
+ * only after it.  Compiled code also polls xly_stopping on every loop
+ * back edge and function entry (xly_safepoint), so a loop that neither
+ * allocates nor waits still lets a collection through.
+ *
+ * spawn f(args) queues the call and yields null.  The first spawn starts
+ * XENLY_THREADS workers (default: one per CPU), which take the tasks in
+ * FIFO order; exit waits until all have run, as the interpreter runs
+ * spawned tasks once main is done.
+ * ══════════════════════════════════════════════════════════════════════════════ */
+
+#if defined(__GNUC__) || defined(__clang__)
+#  define XLY_THREAD_LOCAL __thread
+#else
+#  define XLY_THREAD_LOCAL
+#endif
+
+#define RT_MAX_WORKERS 64
+
+typedef struct XlyThread {
+    char              *base;      /* stack top                              */
+    char              *sp;        /* where it parked; NULL while it runs    */
+    struct XlyGen     *gen;       /* its running generator then             */
+    struct GcSpace    *space;     /* per arena depth (GARBAGE COLLECTION)   */
+    size_t             taken;     /* slots not yet counted in gc.since      */
+    int                worker;
+    struct XlyThread  *next;
+} XlyThread;
+
+typedef struct RtTask {
+    XlyVal         *fn;
+    XlyVal         *args[6];
+    int             argc;
+    struct RtTask  *next;
+} RtTask;
+
+static pthread_mutex_t rt_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t  rt_parked  = PTHREAD_COND_INITIALIZER;  /* a thread parked  */
+static pthread_cond_t  rt_resumed = PTHREAD_COND_INITIALIZER;  /* collection done  */
+static XlyThread      *rt_threads;
+static int             rt_running;      /* registered threads not parked      */
+int                    xly_stopping;    /* a collection waits for the others  */
+
+static struct {
+    pthread_cond_t  work, idle;
+    RtTask         *head, *tail;
+    int             nworkers;
+    size_t          pending;      /* queued or running                      */
+} rt_pool = { PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER, NULL, NULL, 0, 0 };
+
+static XLY_THREAD_LOCAL XlyThread     *rt_self;     /* NULL: not registered  */
+static XLY_THREAD_LOCAL struct XlyGen *g_gen_cur;   /* generator running     */
+
+static struct GcSpace *gc_spaces_new(void);
+
+/* Register the calling thread as running; `base` is its stack top. */
+static XlyThread *rt_thread_enter(char *base, int worker) {
+    XlyThread *t = calloc(1, sizeof(XlyThread));
+    t->base   = base;
+    t->worker = worker;
+    t->space  = gc_spaces_new();
+    pthread_mutex_lock(&rt_lock);
+    while (xly_stopping) pthread_cond_wait(&rt_resumed, &rt_lock);
+    t->next    = rt_threads;
+    rt_threads = t;
+    rt_running++;
+    pthread_mutex_unlock(&rt_lock);
+    rt_self = t;
+    return t;
+}
+
+/* An address below the caller's frame. */
+static __attribute__((noinline)) char *rt_stack_here(void) {
+    return (char *)__builtin_frame_address(0);
+}
+
+/* With rt_lock held: stop running.  Inlined, so that __builtin_unwind_init
+ * spills the callee-saved registers, with whatever compiled frames keep
+ * in them, into the calling frame: above the recorded stack pointer.    */
+static inline __attribute__((always_inline)) void rt_park(XlyThread *t) {
+    __builtin_unwind_init();
+    t->gen  = g_gen_cur;
+    t->sp   = rt_stack_here();
+    rt_running--;
+    if (xly_stopping) pthread_cond_signal(&rt_parked);
+}
+
+/* With rt_lock held: run again, once no collection is under way. */
+static void rt_unpark(XlyThread *t) {
+    while (xly_stopping) pthread_cond_wait(&rt_resumed, &rt_lock);
+    t->sp = NULL;
+    rt_running++;
+}
+
+static inline __attribute__((always_inline)) XlyThread *rt_release(void) {
+    XlyThread *t = rt_self;
+    if (!t) return NULL;
+    pthread_mutex_lock(&rt_lock);
+    rt_park(t);
+    pthread_mutex_unlock(&rt_lock);
+    return t;
+}
+
+static void rt_reacquire(XlyThread *t) {
+    if (!t) return;
+    pthread_mutex_lock(&rt_lock);
+    rt_unpark(t);
+    pthread_mutex_unlock(&rt_lock);
+}
+
+/* With rt_lock held: wait on `cond`, parked meanwhile. */
+static inline __attribute__((always_inline)) void rt_wait(pthread_cond_t *cond) {
+    XlyThread *t = rt_self;
+    rt_park(t);
+    pthread_cond_wait(cond, &rt_lock);
+    rt_unpark(t);
+}
+
+/* A collection is waiting for this thread: park until it is done. */
+static __attribute__((noinline)) void rt_safepoint(void) {
+    XlyThread *t = rt_self;
+    pthread_mutex_lock(&rt_lock);
+    if (xly_stopping) {
+        rt_park(t);
+        rt_unpark(t);
+    }
+    pthread_mutex_unlock(&rt_lock);
+}
+
+/* Compiled code's poll: called when it sees xly_stopping set. */
+void xly_safepoint(void) {
+    if (rt_self) rt_safepoint();
+}
+
+static __attribute__((noinline)) void rt_worker_loop(char *base) {
+    rt_thread_enter(base, 1);
+    pthread_mutex_lock(&rt_lock);
+    for (;;) {
+        while (!rt_pool.head) rt_wait(&rt_pool.work);
+        RtTask task = *rt_pool.head;
+        free(rt_pool.head);
+        rt_pool.head = task.next;
+        if (!rt_pool.head) rt_pool.tail = NULL;
+        pthread_mutex_unlock(&rt_lock);
+        xly_call_fnval(task.fn, task.args, task.argc);
+        pthread_mutex_lock(&rt_lock);
+        if (--rt_pool.pending == 0) pthread_cond_broadcast(&rt_pool.idle);
+    }
+}
+
+static void *rt_worker(void *unused) {
+    volatile char base = 0;
+    (void)unused;
+    rt_worker_loop((char *)&base);
+    return NULL;
+}
+
+/* At exit, on the main thread: wait for every spawned task. */
+static void rt_pool_drain(void *unused) {
+    (void)unused;
+    if (!rt_self || rt_self->worker) return;
+    pthread_mutex_lock(&rt_lock);
+    while (rt_pool.pending > 0) rt_wait(&rt_pool.idle);
+    pthread_mutex_unlock(&rt_lock);
+}
+
+#if defined(__GLIBC__)
+extern int __cxa_atexit(void (*fn)(void *), void *arg, void *dso);
+#else
+static void rt_pool_drain_all(void) { rt_pool_drain(NULL); }
+#endif
+
+/* With rt_lock held; the workers register once it is let go. */
+static void rt_pool_start(void) {
+    const char *env = getenv("XENLY_THREADS");
+    long n = env && *env ? strtol(env, NULL, 10) : sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) n = 1;
+    if (n > RT_MAX_WORKERS) n = RT_MAX_WORKERS;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_DETACHED);
+    for (long i = 0; i < n; i++) {
+        pthread_t th;
+        if (pthread_create(&th, &attr, rt_worker, NULL) == 0) rt_pool.nworkers++;
+    }
+    pthread_attr_destroy(&attr);
+    if (rt_pool.nworkers == 0) return;
+#if defined(__GLIBC__)
+    __cxa_atexit(rt_pool_drain, NULL, NULL);   /* see prof_at_exit */
+#else
+    atexit(rt_pool_drain_all);
+#endif
+}
+
+XlyVal *xly_spawn(XlyVal *fn_val, XlyVal **args, int argc) {
+    if (!fn_val || fn_val->type != VAL_FUNCTION || argc < 0 || argc > 6)
+        return xly_null();
+    pthread_mutex_lock(&rt_lock);
+    if (rt_self && rt_pool.nworkers == 0) rt_pool_start();
+    if (rt_pool.nworkers == 0) {          /* no workers: run it right away */
+        pthread_mutex_unlock(&rt_lock);
+        xly_call_fnval(fn_val, args, argc);
+        return xly_null();
+    }
+    RtTask *task = calloc(1, sizeof(RtTask));
+    task->fn   = fn_val;
+    task->argc = argc;
+    for (int i = 0; i < argc; i++) task->args[i] = args[i];
+    if (rt_pool.tail) rt_pool.tail->next = task;
+    else              rt_pool.head = task;
+    rt_pool.tail = task;
+    rt_pool.pending++;
+    pthread_cond_signal(&rt_pool.work);
+    pthread_mutex_unlock(&rt_lock);
+    return xly_null();
+}
+
+/* ══════════════════════════════════════════════════════════════════════════════
+ * MULTIPROC  (channels, futures, select, shared buffers)
+ *
+ * The channel/future/select core lives in multiproc.c and is compiled into
+ * both runtimes as multiproc_rt.o (thread/process pools excluded).  Its
+ * functions only move Value pointers around and call value_null() /
+ * value_destroy(), which the shims below provide for XlyVal.  Handles are
+ * passed as numbers, exactly like the interpreter's multiproc module.
+ * ══════════════════════════════════════════════════════════════════════════════ */
+
+extern void   *channel_create(size_t capacity);
+extern void    channel_destroy(void *chan);
+extern int     channel_send(void *chan, XlyVal *data);
+extern XlyVal *channel_recv(void *chan);
+extern int     channel_try_recv(void *chan, XlyVal **out);
+extern void    channel_close(void *chan);
+extern XlyVal *future_get(void *fut);
+extern int     future_is_ready(void *fut);
+extern void    future_destroy(void *fut);
+extern int     xly_select(void **sources, size_t n, long timeout_ms, XlyVal **out);
+extern void   *shared_buffer_create(size_t bytes, int type);
+extern void    shared_buffer_destroy(void *buf);
+extern void   *shared_buffer_check(void *handle);
+extern size_t  shared_buffer_length(void *buf);
+extern int     shared_buffer_type_from_name(const char *name);
+extern int     shared_buffer_get(void *buf, size_t index, double *out);
+extern int     shared_buffer_set(void *buf, size_t index, double value);
+extern int     shared_buffer_add(void *buf, size_t index, double delta, double *old);
+extern int     shared_buffer_cas(void *buf, size_t index, double expected,
+                                 double desired, double *old);
+
+static void *mp_handle(XlyVal **args, size_t argc, size_t i) {
+    if (i >= argc || !args[i] || args[i]->type != VAL_NUMBER) return NULL;
+    return (void *)(uintptr_t)args[i]->num;
+}
+
+/* Returns NULL when `fn` is not a multiproc function handled here. */
+static XlyVal *xly_multiproc_call(const char *fn, XlyVal **args, size_t argc) {
+    if (strcmp(fn, "cpu_count") == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        return xly_num((double)(n > 0 ? n : 1));
+    }
+    if (strcmp(fn, "channel_create") == 0) {
+        size_t cap = (argc > 0 && args[0]->type == VAL_NUMBER) ? (size_t)args[0]->num : 0;
+        return xly_num((double)(uintptr_t)channel_create(cap));
+    }
+    if (strcmp(fn, "select") == 0) {
+        if (argc < 1 || args[0]->type != VAL_ARRAY) {
+            xly_write_stderr("[xenly] multiproc.select expects (sources: array, timeoutMs?)\n");
+            return xly_null();
+        }
+        long timeout_ms = (argc > 1 && args[1]->type == VAL_NUMBER) ? (long)args[1]->num : -1;
+        size_t n = args[0]->array_len;
+        void **sources = (void **)malloc(sizeof(void *) * (n ? n : 1));
+        for (size_t i = 0; i < n; i++) sources[i] = mp_handle(args[0]->array, n, i);
+        XlyVal *out = NULL;
+        XlyThread *t = rt_release();
+        int fired = xly_select(sources, n, timeout_ms, &out);
+        rt_reacquire(t);
+        free(sources);
+        if (fired == -2) {
+            xly_write_stderr("[xenly] multiproc.select: sources must be channel or future handles\n");
+            return xly_null();
+        }
+        out = out ? gc_unpin(out) : xly_null();
+        XlyVal *pair[2] = { xly_num((double)fired), out };
+        return xly_array_create(pair, 2);
+    }
+
+    /* Compiled code has no pools, so it can never hold a future to combine;
+     * xenlyc's sema rejects these calls, this covers --no-sema builds. */
+    if (strncmp(fn, "thread_pool_", 12) == 0 || strncmp(fn, "process_pool_", 13) == 0 ||
+        strcmp(fn, "future_all") == 0 || strcmp(fn, "future_any") == 0 ||
+        strcmp(fn, "future_race") == 0 || strcmp(fn, "future_then") == 0) {
+        char buf[160];
+        snprintf(buf, sizeof(buf),
+                 "[xenly] multiproc.%s is not supported in compiled programs\n", fn);
+        xly_write_stderr(buf);
+        return xly_null();
+    }
+
+    if (strcmp(fn, "sharedBuffer") == 0) {
+        const char *tname = (argc > 1 && args[1]->type == VAL_STRING) ? args[1]->str : NULL;
+        int type = shared_buffer_type_from_name(tname);
+        if (argc < 1 || args[0]->type != VAL_NUMBER || args[0]->num < 1 || type < 0) {
+            xly_write_stderr("[xenly] multiproc.sharedBuffer expects (bytes: number, type?: \"f64\"|\"i64\"|\"i32\"|\"u8\")\n");
+            return xly_null();
+        }
+        void *buf = shared_buffer_create((size_t)args[0]->num, type);
+        return buf ? xly_num((double)(uintptr_t)buf) : xly_null();
+    }
+    if (strncmp(fn, "buffer", 6) == 0) {
+        void *buf = shared_buffer_check(mp_handle(args, argc, 0));
+        if (!buf) {
+            xly_write_stderr("[xenly] multiproc.buffer*: expects a shared buffer handle\n");
+            return xly_null();
+        }
+        size_t len = shared_buffer_length(buf);
+        if (strcmp(fn, "bufferLength") == 0)  return xly_num((double)len);
+        if (strcmp(fn, "bufferDestroy") == 0) { shared_buffer_destroy(buf); return xly_null(); }
+        if (strcmp(fn, "bufferToArray") == 0) {
+            XlyVal *arr = xly_array_create(NULL, 0);
+            for (size_t i = 0; i < len; i++) {
+                double v;
+                shared_buffer_get(buf, i, &v);
+                xly_array_push(arr, xly_num(v));
+            }
+            return arr;
+        }
+        if (argc < 2 || args[1]->type != VAL_NUMBER || args[1]->num < 0 ||
+            (size_t)args[1]->num >= len) {
+            xly_write_stderr("[xenly] multiproc.buffer*: index out of range\n");
+            return xly_null();
+        }
+        size_t i = (size_t)args[1]->num;
+        double a = (argc > 2 && args[2]->type == VAL_NUMBER) ? args[2]->num : 0;
+        double b = (argc > 3 && args[3]->type == VAL_NUMBER) ? args[3]->num : 0;
+        double out = 0;
+        if (strcmp(fn, "bufferGet") == 0)       { shared_buffer_get(buf, i, &out); return xly_num(out); }
+        if (strcmp(fn, "bufferSet") == 0)       { shared_buffer_set(buf, i, a); return xly_null(); }
+        if (strcmp(fn, "bufferAtomicAdd") == 0) { shared_buffer_add(buf, i, a, &out); return xly_num(out); }
+        if (strcmp(fn, "bufferCompareExchange") == 0) {
+            shared_buffer_cas(buf, i, a, b, &out);
+            return xly_num(out);
+        }
+        return NULL;
+    }
+
+    /* a queued message is pinned: the collector does not see channels */
+    void *h = mp_handle(args, argc, 0);
+    if (strcmp(fn, "channel_send") == 0) {
+        if (!h || argc < 2) return xly_num(-1);
+        gc_pin(args[1]);
+        XlyThread *t = rt_release();      /* a full channel blocks */
+        int rc = channel_send(h, args[1]);
+        rt_reacquire(t);
+        if (rc != 0) gc_unpin(args[1]);
+        return xly_num((double)rc);
+    }
+    if (strcmp(fn, "channel_recv") == 0) {
+        if (!h) return xly_null();
+        XlyThread *t = rt_release();
+        XlyVal *v = channel_recv(h);
+        rt_reacquire(t);
+        return gc_unpin(v);
+    }
+    if (strcmp(fn, "channel_try_recv") == 0) {
+        XlyVal *out = NULL;
+        return (h && channel_try_recv(h, &out) == 0) ? gc_unpin(out) : xly_null();
+    }
+    if (strcmp(fn, "channel_close") == 0)   { if (h) channel_close(h);   return xly_null(); }
+    if (strcmp(fn, "channel_destroy") == 0) { if (h) channel_destroy(h); return xly_null(); }
+    if (strcmp(fn, "future_get") == 0) {
+        if (!h) return xly_null();
+        XlyThread *t = rt_release();
+        XlyVal *v = future_get(h);
+        rt_reacquire(t);
+        return v;
+    }
+    if (strcmp(fn, "future_is_ready") == 0) return xly_bool(h ? future_is_ready(h) : 0);
+    if (strcmp(fn, "future_destroy") == 0)  { if (h) future_destroy(h);  return xly_null(); }
+    return NULL;
+}
+
 /* ══════════════════════════════════════════════════════════════════════════════
  * MODULE DISPATCH
  *
  * Bridges compiled code → the same 160+ module functions the interpreter uses.
- * modules_get() is defined in modules.c and compiled into libxly_rt.a.
+ * modules_get() is defined in modules.c and compiled into libxly_rt.a; the
+ * copy in libxly_rtc.a has only math and string, whose natives xenlyc
+ * mostly calls directly (codegen.c: module_native).
  * ══════════════════════════════════════════════════════════════════════════════ */
 
 typedef XlyVal* (*NativeFn)(XlyVal **args, size_t argc);
@@ -733,17 +1183,15 @@ XlyVal *xly_call_module(const char *mod, const char *fn,
         if (strcmp(fn, "map") == 0) {
             if (argc < 2 || !args || !args[0] || args[0]->type != VAL_ARRAY)
                 return xly_array_create(NULL, 0);
-            XlyVal *arr  = args[0];
-            XlyVal *cb   = args[1];
-            size_t   n   = arr->array_len;
-            XlyVal **out = (XlyVal **)malloc(sizeof(XlyVal *) * (n ? n : 1));
-            for (size_t k = 0; k < n; k++) {
+            XlyVal *arr    = args[0];
+            XlyVal *cb     = args[1];
+            size_t  n      = arr->array_len;
+            XlyVal *result = xly_array_create(NULL, 0);   /* keeps results reachable */
+            for (size_t k = 0; k < n && k < arr->array_len; k++) {
                 XlyVal *ea[1] = { arr->array[k] };
                 XlyVal *r = xly_call_fnval(cb, ea, 1);
-                out[k] = r ? r : xly_null();
+                xly_array_push(result, r ? r : xly_null());
             }
-            XlyVal *result = xly_array_create(out, n);
-            free(out);
             return result;
         }
 
@@ -850,6 +1298,16 @@ XlyVal *xly_call_module(const char *mod, const char *fn,
         }
     }
 
+    if (strcmp(mod, "multiproc") == 0) {
+        XlyVal *r = xly_multiproc_call(fn, args, argc);
+        if (r) return r;
+    }
+
+    if (strcmp(mod, "sys") == 0) {
+        XlyVal *r = xly_gc_call(fn, args, argc);
+        if (r) return r;
+    }
+
     Mod m;
     memset(&m, 0, sizeof(m));
     if (!modules_get(mod, &m)) {
@@ -899,6 +1357,155 @@ XlyVal *xly_index(XlyVal *collection, XlyVal *index_val) {
 
 void xly_exit(int code) { exit(code); }
 
+/* Same report as the interpreter's; compiled code cannot carry on. */
+void xly_match_fail(int line) {
+    fflush(stdout);
+    fprintf(stderr, "\033[1;31m[Xenly Error] Line %d: No pattern matched in match expression.\033[0m\n", line);
+    exit(1);
+}
+
+/* ══════════════════════════════════════════════════════════════════════════════
+ * PROFILE COUNTERS  (xenlyc --profile-generate)
+ *
+ * Registered tables are written at exit.  The file keeps the sum over every
+ * run: its existing lines are read back, the counts of each site added, and
+ * the result replaces the file through a rename, so a run that dies midway
+ * never leaves half a profile behind.
+ * ══════════════════════════════════════════════════════════════════════════════ */
+
+#define XLY_PROF_HEADER "# xenly profile 1"
+
+static struct { const char *path; XlyProfTable *t; } *prof_tabs;
+static int prof_ntabs;
+
+typedef struct { char *key; uint64_t count[2]; } ProfLine;
+
+typedef struct {
+    ProfLine *slot;             /* open addressing, cap a power of two */
+    size_t    cap;
+    size_t   *order;            /* slots in first-seen order           */
+    size_t    n;
+} ProfMap;
+
+static ProfLine *prof_map_get(ProfMap *m, const char *key) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const unsigned char *p = (const unsigned char *)key; *p; p++) {
+        h ^= *p;
+        h *= 0x100000001b3ULL;
+    }
+    size_t i = (size_t)h & (m->cap - 1);
+    while (m->slot[i].key && strcmp(m->slot[i].key, key) != 0) i = (i + 1) & (m->cap - 1);
+    if (!m->slot[i].key) {
+        m->slot[i].key = strdup(key);
+        m->order[m->n++] = i;
+    }
+    return &m->slot[i];
+}
+
+static void prof_write(const char *path) {
+    /* what the file holds already */
+    ProfLine *old = NULL;
+    size_t nold = 0, cap_old = 0;
+    FILE *in = fopen(path, "r");
+    if (in) {
+        char *line = NULL;
+        size_t len = 0;
+        while (getline(&line, &len, in) > 0) {
+            unsigned long long c0, c1;
+            char key[512];
+            if (line[0] == '#' || sscanf(line, "%llu %llu %511s", &c0, &c1, key) != 3) continue;
+            if (nold == cap_old) {
+                cap_old = cap_old ? cap_old * 2 : 256;
+                old = realloc(old, sizeof(ProfLine) * cap_old);
+            }
+            old[nold].key = strdup(key);
+            old[nold].count[0] = c0;
+            old[nold].count[1] = c1;
+            nold++;
+        }
+        free(line);
+        fclose(in);
+    }
+
+    size_t total = nold;
+    for (int i = 0; i < prof_ntabs; i++)
+        if (strcmp(prof_tabs[i].path, path) == 0) total += (size_t)prof_tabs[i].t->nsites;
+    ProfMap m;
+    m.cap = 16;
+    while (m.cap < 2 * total) m.cap *= 2;
+    m.slot  = calloc(m.cap, sizeof(ProfLine));
+    m.order = malloc(sizeof(size_t) * (total ? total : 1));
+    m.n     = 0;
+    for (size_t i = 0; i < nold; i++) {
+        ProfLine *e = prof_map_get(&m, old[i].key);
+        e->count[0] += old[i].count[0];
+        e->count[1] += old[i].count[1];
+        free(old[i].key);
+    }
+    free(old);
+    for (int i = 0; i < prof_ntabs; i++) {
+        if (strcmp(prof_tabs[i].path, path) != 0) continue;
+        XlyProfTable *t = prof_tabs[i].t;
+        for (int64_t k = 0; k < t->nsites; k++) {
+            ProfLine *e = prof_map_get(&m, t->site[k].key);
+            e->count[0] += t->site[k].count[0];
+            e->count[1] += t->site[k].count[1];
+        }
+    }
+
+    size_t plen = strlen(path);
+    char *tmp = malloc(plen + 32);
+    snprintf(tmp, plen + 32, "%s.%ld.tmp", path, (long)getpid());
+    FILE *out = fopen(tmp, "w");
+    int ok = out != NULL;
+    if (out) {
+        fprintf(out, "%s\n", XLY_PROF_HEADER);
+        for (size_t i = 0; i < m.n; i++) {
+            ProfLine *e = &m.slot[m.order[i]];
+            fprintf(out, "%llu %llu %s\n", (unsigned long long)e->count[0],
+                    (unsigned long long)e->count[1], e->key);
+        }
+        ok = fclose(out) == 0;
+    }
+    if (!ok || rename(tmp, path) != 0) {
+        fprintf(stderr, "[xenly] cannot write profile %s: %s\n", path, strerror(errno));
+        remove(tmp);
+    }
+    free(tmp);
+    for (size_t i = 0; i < m.n; i++) free(m.slot[m.order[i]].key);
+    free(m.slot);
+    free(m.order);
+}
+
+static void prof_dump(void *unused) {
+    (void)unused;
+    for (int i = 0; i < prof_ntabs; i++) {
+        int seen = 0;
+        for (int k = 0; k < i && !seen; k++) seen = strcmp(prof_tabs[k].path, prof_tabs[i].path) == 0;
+        if (!seen) prof_write(prof_tabs[i].path);
+    }
+}
+
+/* atexit() lives in libc_nonshared.a and needs the __dso_handle that the
+ * crt files define; programs are linked without them, so ask libc.so. */
+#if defined(__GLIBC__)
+extern int __cxa_atexit(void (*fn)(void *), void *arg, void *dso);
+static void prof_at_exit(void (*fn)(void *)) { __cxa_atexit(fn, NULL, NULL); }
+#else
+static void prof_at_exit_all(void) { prof_dump(NULL); }
+static void prof_at_exit(void (*fn)(void *)) { (void)fn; atexit(prof_at_exit_all); }
+#endif
+
+void xly_prof_register(const char *path, XlyProfTable *t) {
+    const char *env = getenv("XENLY_PROFILE_FILE");
+    if (env && *env) path = env;
+    if (prof_ntabs == 0) prof_at_exit(prof_dump);
+    prof_tabs = realloc(prof_tabs, sizeof(prof_tabs[0]) * (size_t)(prof_ntabs + 1));
+    prof_tabs[prof_ntabs].path = path;
+    prof_tabs[prof_ntabs].t    = t;
+    prof_ntabs++;
+}
+
 /* ── first-class function values ──────────────────────────────────────────── */
 
 /* Wrap a raw C function pointer as a VAL_FUNCTION XlyVal*.
@@ -906,72 +1513,94 @@ void xly_exit(int code) { exit(code); }
  * `fn` (offset 40) is kept NULL so modules.c does not confuse this
  * for an interpreter FnDef*.  `inner` (offset 56) stays NULL → plain fn. */
 XlyVal *xly_make_fn(void *fp) {
-    XlyVal *v = calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type       = VAL_FUNCTION;
     v->builtin_fn = fp;   /* raw code pointer — offset 48 */
     return v;
 }
 
 /* Create a closure: function pointer + captured environment.
- * The environment is a heap-allocated array of XlyVal* values.
+ * The environment is an array of XlyVal* values on the collected heap (a
+ * body keeps it alive while it runs, not the closure value).
  * Stored in `inner` (offset 56).  `builtin_fn` (offset 48) holds the ptr. */
 XlyVal *xly_make_closure(void *fp, XlyVal **env, int env_size) {
-    XlyVal *v = calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type       = VAL_FUNCTION;
     v->builtin_fn = fp;   /* raw code pointer — offset 48 */
     if (env_size > 0 && env) {
-        XlyVal **captured = malloc(sizeof(XlyVal*) * (size_t)env_size);
+        XlyVal **captured = gc_alloc_env((size_t)env_size);
         memcpy(captured, env, sizeof(XlyVal*) * (size_t)env_size);
         v->inner = (XlyVal*)captured;  /* closure env — offset 56 */
     }
     return v;
 }
 
+/* A function whose body takes a receiver ahead of its params (`this`
+ * outside a class, see xenlyc's fn_uses_this); env as for a closure. */
+XlyVal *xly_make_method(void *fp, XlyVal **env, int env_size) {
+    XlyVal *v = xly_make_closure(fp, env, env_size);
+    v->boolean = 1;
+    return v;
+}
+
 /* Get the environment pointer from a closure XlyVal* (NULL if none). */
 XlyVal **xly_closure_env(XlyVal *closure) {
     if (!closure || closure->type != VAL_FUNCTION) return NULL;
     return (XlyVal**)closure->inner;
 }
 
+typedef XlyVal *(*XlyF0)(void);
+typedef XlyVal *(*XlyF1)(XlyVal*);
+typedef XlyVal *(*XlyF2)(XlyVal*,XlyVal*);
+typedef XlyVal *(*XlyF3)(XlyVal*,XlyVal*,XlyVal*);
+typedef XlyVal *(*XlyF4)(XlyVal*,XlyVal*,XlyVal*,XlyVal*);
+typedef XlyVal *(*XlyF5)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
+typedef XlyVal *(*XlyF6)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
+typedef XlyVal *(*XlyF7)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
+typedef XlyVal *(*XlyF8)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
+
+/* Call a compiled body that takes one hidden leading argument (a closure's
+ * env, a method's receiver) ahead of 0–6 explicit args.  Every arg register
+ * is passed: omitted trailing params read as NULL, as at a direct call.  */
+static XlyVal *xly_call_hidden(void *fp, XlyVal *hidden, XlyVal **args, int argc) {
+    if (argc < 0 || argc > 6) return xly_null();
+    XlyVal *a[6] = { NULL, NULL, NULL, NULL, NULL, NULL };
+    for (int i = 0; i < argc; i++) a[i] = args[i];
+    return ((XlyF7)fp)(hidden, a[0], a[1], a[2], a[3], a[4], a[5]);
+}
+
+/* A body that takes a receiver: builtin_fn([env,] self, args[0], ...). */
+static XlyVal *xly_call_method(XlyVal *fn_val, XlyVal *self, XlyVal **args, int argc) {
+    if (argc < 0 || argc > 6) return xly_null();
+    XlyVal *a[8] = { NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL };
+    int k = 0;
+    if (fn_val->inner) a[k++] = fn_val->inner;
+    a[k++] = self ? self : xly_null();
+    for (int i = 0; i < argc; i++) a[k++] = args[i];
+    return ((XlyF8)fn_val->builtin_fn)(a[0], a[1], a[2], a[3], a[4], a[5], a[6], a[7]);
+}
+
 /* Call a VAL_FUNCTION XlyVal* with 0–6 args.
  * For plain functions (inner == NULL): call builtin_fn(args[0], ...)
- * For closures (inner != NULL):        call builtin_fn(env, args[0], ...) */
+ * For closures (inner != NULL):        call builtin_fn(env, args[0], ...)
+ * A function that takes a receiver gets null: it was not called on one. */
 XlyVal *xly_call_fnval(XlyVal *fn_val, XlyVal **args, int argc) {
     if (!fn_val || fn_val->type != VAL_FUNCTION || !fn_val->builtin_fn)
         return xly_null();
+    if (fn_val->boolean) return xly_call_method(fn_val, NULL, args, argc);
     XlyVal **env = (XlyVal**)fn_val->inner;  /* NULL for plain fns */
-    typedef XlyVal *(*F0)(void);
-    typedef XlyVal *(*F1)(XlyVal*);
-    typedef XlyVal *(*F2)(XlyVal*,XlyVal*);
-    typedef XlyVal *(*F3)(XlyVal*,XlyVal*,XlyVal*);
-    typedef XlyVal *(*F4)(XlyVal*,XlyVal*,XlyVal*,XlyVal*);
-    typedef XlyVal *(*F5)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
-    typedef XlyVal *(*F6)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
-    typedef XlyVal *(*F7)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
-    if (!env) {
-        /* Plain function — call with args directly */
-        switch (argc) {
-            case 0: return ((F0)fn_val->builtin_fn)();
-            case 1: return ((F1)fn_val->builtin_fn)(args[0]);
-            case 2: return ((F2)fn_val->builtin_fn)(args[0],args[1]);
-            case 3: return ((F3)fn_val->builtin_fn)(args[0],args[1],args[2]);
-            case 4: return ((F4)fn_val->builtin_fn)(args[0],args[1],args[2],args[3]);
-            case 5: return ((F5)fn_val->builtin_fn)(args[0],args[1],args[2],args[3],args[4]);
-            case 6: return ((F6)fn_val->builtin_fn)(args[0],args[1],args[2],args[3],args[4],args[5]);
-            default: return xly_null();
-        }
-    } else {
-        /* Closure — prepend env as first hidden arg */
-        switch (argc) {
-            case 0: return ((F1)fn_val->builtin_fn)((XlyVal*)env);
-            case 1: return ((F2)fn_val->builtin_fn)((XlyVal*)env,args[0]);
-            case 2: return ((F3)fn_val->builtin_fn)((XlyVal*)env,args[0],args[1]);
-            case 3: return ((F4)fn_val->builtin_fn)((XlyVal*)env,args[0],args[1],args[2]);
-            case 4: return ((F5)fn_val->builtin_fn)((XlyVal*)env,args[0],args[1],args[2],args[3]);
-            case 5: return ((F6)fn_val->builtin_fn)((XlyVal*)env,args[0],args[1],args[2],args[3],args[4]);
-            case 6: return ((F7)fn_val->builtin_fn)((XlyVal*)env,args[0],args[1],args[2],args[3],args[4],args[5]);
-            default: return xly_null();
-        }
+    if (env)   /* closure — env is the hidden first arg */
+        return xly_call_hidden(fn_val->builtin_fn, (XlyVal*)env, args, argc);
+    void *fp = fn_val->builtin_fn;
+    switch (argc) {
+        case 0: return ((XlyF0)fp)();
+        case 1: return ((XlyF1)fp)(args[0]);
+        case 2: return ((XlyF2)fp)(args[0],args[1]);
+        case 3: return ((XlyF3)fp)(args[0],args[1],args[2]);
+        case 4: return ((XlyF4)fp)(args[0],args[1],args[2],args[3]);
+        case 5: return ((XlyF5)fp)(args[0],args[1],args[2],args[3],args[4]);
+        case 6: return ((XlyF6)fp)(args[0],args[1],args[2],args[3],args[4],args[5]);
+        default: return xly_null();
     }
 }
 
@@ -979,91 +1608,307 @@ XlyVal *xly_call_fnval(XlyVal *fn_val, XlyVal **args, int argc) {
  * OBJECT / INSTANCE OPERATIONS
  *
  * Compiled Xenly object literals { key: val, ... } use VAL_INSTANCE with
- * a flat key-value store allocated in the `instance` field.
- * Layout: XlyObjStore { char **keys; XlyVal **vals; size_t count; size_t cap; }
+ * a key-value store allocated in the `instance` field.
+ * Layout: XlyObjStore { const char **keys; XlyVal **vals; size_t count;
+ *                       size_t cap; const XlyClass *cls; ... }
+ *
+ * Keys are atoms: one canonical pointer per text (xly_atom), so a lookup
+ * compares pointers, never strings.  xenlyc hands its literal property
+ * names and class fields to xly_atoms up front and passes the atom itself
+ * to xly_obj_get_atom / xly_obj_set_atom.  Up to XLY_OBJ_INLINE keys live
+ * in the store's own arrays and are scanned; past XLY_OBJ_SCAN an
+ * open-addressed index (slot + 1, 0 = empty) keyed by the atom's address
+ * takes over.
+ *
+ * Instances of a compiled class start with the class's fields as their
+ * first keys, in slot order, so compiled methods read and write
+ * `this.field` at vals[slot] directly (codegen.c relies on the offsets of
+ * vals and cls).  A NULL val is a field not assigned yet.
  * ══════════════════════════════════════════════════════════════════════════════ */
 
+#define XLY_OBJ_INLINE 8        /* keys held in the store itself          */
+#define XLY_OBJ_SCAN   8        /* more keys than this: index them         */
+
 typedef struct {
-    char    **keys;
-    XlyVal  **vals;
-    size_t    count;
-    size_t    cap;
+    const char    **keys;       /* atoms, in insertion order */
+    XlyVal        **vals;
+    size_t          count;
+    size_t          cap;
+    const XlyClass *cls;        /* NULL for object literals */
+    uint32_t       *index;      /* NULL while count <= XLY_OBJ_SCAN */
+    size_t          index_mask;
+    const char     *inline_keys[XLY_OBJ_INLINE];
+    XlyVal         *inline_vals[XLY_OBJ_INLINE];
 } XlyObjStore;
 
+/* ── atoms ───────────────────────────────────────────────────────────────
+ * The intern table, open addressing by text hash.  The first pointer
+ * registered for a text is its atom: xenlyc's static strings where it
+ * has them, a copy for keys first seen at run time.
+ *
+ * Lookups take no lock.  Inserting does: a slot is filled once and
+ * published with a release store, and growing publishes a new table the
+ * same way, so a thread finds every atom interned before it synchronized
+ * with the interning one (a channel, a spawn).  Old tables stay: a
+ * reader may still probe one.                                           */
+typedef struct AtomTable { size_t cap; const char *slot[]; } AtomTable;
+
+static struct {
+    AtomTable       *tab;
+    size_t           n;
+    pthread_mutex_t  lock;
+} atoms = { NULL, 0, PTHREAD_MUTEX_INITIALIZER };
+
+static uint64_t atom_text_hash(const char *s) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const unsigned char *p = (const unsigned char *)s; *p; p++) {
+        h ^= *p;
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* The atom of `s` in table t, or NULL. */
+static const char *atom_probe(const AtomTable *t, const char *s) {
+    if (!t) return NULL;
+    for (size_t i = (size_t)atom_text_hash(s) & (t->cap - 1);; i = (i + 1) & (t->cap - 1)) {
+        const char *a = __atomic_load_n(&t->slot[i], __ATOMIC_ACQUIRE);
+        if (!a || strcmp(a, s) == 0) return a;
+    }
+}
+
+/* With atoms.lock held: put the new atom a in t. */
+static void atom_put(AtomTable *t, const char *a) {
+    size_t i = (size_t)atom_text_hash(a) & (t->cap - 1);
+    while (t->slot[i]) i = (i + 1) & (t->cap - 1);
+    __atomic_store_n(&t->slot[i], a, __ATOMIC_RELEASE);
+}
+
+static void atoms_grow(void) {
+    AtomTable *old = atoms.tab;
+    size_t cap = old ? old->cap * 2 : 256;
+    AtomTable *t = (AtomTable *)calloc(1, sizeof(AtomTable) + cap * sizeof(const char *));
+    t->cap = cap;
+    for (size_t i = 0; old && i < old->cap; i++)
+        if (old->slot[i]) atom_put(t, old->slot[i]);
+    __atomic_store_n(&atoms.tab, t, __ATOMIC_RELEASE);
+}
+
+/* The atom of `s`; `s` itself becomes it if `keep` and it is new. */
+static const char *atom_intern(const char *s, int keep) {
+    const char *a = atom_probe(__atomic_load_n(&atoms.tab, __ATOMIC_ACQUIRE), s);
+    if (a) return a;
+    pthread_mutex_lock(&atoms.lock);
+    a = atom_probe(atoms.tab, s);
+    if (!a) {
+        if (!atoms.tab || 2 * (atoms.n + 1) > atoms.tab->cap) atoms_grow();
+        a = keep ? s : strdup(s);
+        atom_put(atoms.tab, a);
+        atoms.n++;
+    }
+    pthread_mutex_unlock(&atoms.lock);
+    return a;
+}
+
+/* The atom of `s`, or NULL: no object has a key nobody interned. */
+static const char *atom_find(const char *s) {
+    return atom_probe(__atomic_load_n(&atoms.tab, __ATOMIC_ACQUIRE), s);
+}
+
+const char *xly_atom(const char *s) {
+    return s ? atom_intern(s, 0) : NULL;
+}
+
+void xly_atoms(const char **slots, size_t n) {
+    for (size_t i = 0; i < n; i++) slots[i] = atom_intern(slots[i], 1);
+}
+
+static size_t atom_addr_hash(const char *a) {
+    uint64_t h = (uint64_t)(uintptr_t)a * 0x9E3779B97F4A7C15ULL;
+    return (size_t)(h >> 32);
+}
+
+/* Index of every key, sized for twice as many. */
+static void obj_reindex(XlyObjStore *s) {
+    size_t cap = 16;
+    while (cap < 4 * s->count) cap *= 2;
+    free(s->index);
+    s->index      = (uint32_t *)calloc(cap, sizeof(uint32_t));
+    s->index_mask = cap - 1;
+    for (size_t k = 0; k < s->count; k++) {
+        size_t i = atom_addr_hash(s->keys[k]) & s->index_mask;
+        while (s->index[i]) i = (i + 1) & s->index_mask;
+        s->index[i] = (uint32_t)k + 1;
+    }
+}
+
+/* Slot of the atom in the store, -1 if absent. */
+static inline long obj_find(const XlyObjStore *s, const char *atom) {
+    if (s->index) {
+        for (size_t i = atom_addr_hash(atom) & s->index_mask; s->index[i];
+             i = (i + 1) & s->index_mask)
+            if (s->keys[s->index[i] - 1] == atom) return (long)s->index[i] - 1;
+        return -1;
+    }
+    for (size_t k = 0; k < s->count; k++)
+        if (s->keys[k] == atom) return (long)k;
+    return -1;
+}
+
+/* Room for `n` keys. */
+static void obj_reserve(XlyObjStore *s, size_t n) {
+    if (n <= s->cap) return;
+    size_t cap = s->cap * 2;
+    while (cap < n) cap *= 2;
+    if (s->keys == s->inline_keys) {
+        s->keys = (const char **)malloc(sizeof(char *) * cap);
+        s->vals = (XlyVal **)malloc(sizeof(XlyVal *) * cap);
+        memcpy(s->keys, s->inline_keys, sizeof(char *) * s->count);
+        memcpy(s->vals, s->inline_vals, sizeof(XlyVal *) * s->count);
+    } else {
+        s->keys = (const char **)realloc(s->keys, sizeof(char *) * cap);
+        s->vals = (XlyVal **)realloc(s->vals, sizeof(XlyVal *) * cap);
+    }
+    s->cap = cap;
+}
+
 /* Create an empty object (VAL_INSTANCE). */
 XlyVal *xly_obj_new(void) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type = VAL_INSTANCE;
-    XlyObjStore *s = (XlyObjStore*)calloc(1, sizeof(XlyObjStore));
-    s->cap  = 4;
-    s->keys = (char**)malloc(sizeof(char*) * s->cap);
-    s->vals = (XlyVal**)malloc(sizeof(XlyVal*) * s->cap);
+    XlyObjStore *s = (XlyObjStore*)malloc(sizeof(XlyObjStore));
+    s->keys  = s->inline_keys;
+    s->vals  = s->inline_vals;
+    s->count = 0;
+    s->cap   = XLY_OBJ_INLINE;
+    s->cls   = NULL;
+    s->index = NULL;
+    s->index_mask = 0;
     v->instance = s;
     return v;
 }
 
-/* Set (or add) a field on an object. */
-void xly_obj_set(XlyVal *obj, const char *key, XlyVal *val) {
-    if (!obj || obj->type != VAL_INSTANCE || !key) return;
+/* Set (or add) a field on an object; `atom` from xly_atom. */
+void xly_obj_set_atom(XlyVal *obj, const char *atom, XlyVal *val) {
+    if (!obj || obj->type != VAL_INSTANCE || !atom) return;
     XlyObjStore *s = (XlyObjStore*)obj->instance;
     if (!s) return;
-    for (size_t i = 0; i < s->count; i++) {
-        if (strcmp(s->keys[i], key) == 0) { s->vals[i] = val; return; }
-    }
-    if (s->count >= s->cap) {
-        s->cap *= 2;
-        s->keys = (char**)realloc(s->keys, sizeof(char*) * s->cap);
-        s->vals = (XlyVal**)realloc(s->vals, sizeof(XlyVal*) * s->cap);
-    }
-    s->keys[s->count] = strdup(key);
+    long k = obj_find(s, atom);
+    if (k >= 0) { s->vals[k] = val; return; }
+    obj_reserve(s, s->count + 1);
+    s->keys[s->count] = atom;
     s->vals[s->count] = val;
     s->count++;
+    if (s->count <= XLY_OBJ_SCAN) return;
+    if (!s->index || 2 * s->count > s->index_mask + 1) {
+        obj_reindex(s);
+        return;
+    }
+    size_t i = atom_addr_hash(atom) & s->index_mask;
+    while (s->index[i]) i = (i + 1) & s->index_mask;
+    s->index[i] = (uint32_t)s->count;
 }
 
 /* Get a field from an object (returns xly_null() if not found). */
-XlyVal *xly_obj_get(XlyVal *obj, const char *key) {
-    if (!obj || !key) return xly_null();
+XlyVal *xly_obj_get_atom(XlyVal *obj, const char *atom) {
+    if (!obj || !atom) return xly_null();
     if (obj->type == VAL_INSTANCE) {
         XlyObjStore *s = (XlyObjStore*)obj->instance;
         if (s) {
-            for (size_t i = 0; i < s->count; i++)
-                if (strcmp(s->keys[i], key) == 0) return s->vals[i];
+            long k = obj_find(s, atom);
+            if (k >= 0 && s->vals[k]) return s->vals[k];
         }
         return xly_null();
     }
     /* Support field access on arrays too: .length */
     if (obj->type == VAL_ARRAY) {
-        if (strcmp(key, "length") == 0) return xly_num((double)obj->array_len);
+        if (strcmp(atom, "length") == 0) return xly_num((double)obj->array_len);
         return xly_null();
     }
     return xly_null();
 }
 
-/* ── this / self support ─────────────────────────────────────────────────
- * When a method is called via xly_obj_call, we store the receiver object
- * in a global so compiled functions can retrieve it via xly_this().
- * This is not thread-safe, but matches the single-threaded interpreter.   */
-static XlyVal *g_this = NULL;
-XlyVal *xly_this(void) { return g_this ? g_this : xly_null(); }
+void xly_obj_set(XlyVal *obj, const char *key, XlyVal *val) {
+    if (!obj || obj->type != VAL_INSTANCE || !key) return;
+    xly_obj_set_atom(obj, atom_intern(key, 0), val);
+}
+
+XlyVal *xly_obj_get(XlyVal *obj, const char *key) {
+    if (!obj || !key) return xly_null();
+    if (obj->type == VAL_ARRAY) return xly_obj_get_atom(obj, key);
+    return xly_obj_get_atom(obj, atom_find(key));
+}
+
+/* ── classes ─────────────────────────────────────────────────────────────
+ * XlyClass descriptors are laid out by xenlyc (see xly_rt.h).  These are
+ * the slow paths; compiled code reaches fields and vtables inline.       */
+static const XlyClass *xly_class_of(XlyVal *v) {
+    if (!v || v->type != VAL_INSTANCE || !v->instance) return NULL;
+    return ((XlyObjStore*)v->instance)->cls;
+}
+
+/* A new instance of `cls` with every field present but unassigned.  The
+ * field names are atoms already (xly_atoms at startup). */
+XlyVal *xly_new(const XlyClass *cls) {
+    XlyVal *v = xly_obj_new();
+    XlyObjStore *s = (XlyObjStore*)v->instance;
+    size_t n = (size_t)cls->nfields;
+    obj_reserve(s, n);
+    memcpy(s->keys, cls->fields, sizeof(char *) * n);
+    memset(s->vals, 0, sizeof(XlyVal *) * n);
+    s->count = n;
+    s->cls   = cls;
+    if (n > XLY_OBJ_SCAN) obj_reindex(s);
+    return v;
+}
+
+/* Run the nearest init of `cls` (its own or inherited) on `self`. */
+XlyVal *xly_call_init(const XlyClass *cls, XlyVal *self, XlyVal **args, int argc) {
+    if (cls && cls->init) xly_call_hidden(cls->init, self, args, argc);
+    return xly_null();
+}
+
+/* new Class(args): allocate, then init. */
+XlyVal *xly_construct(const XlyClass *cls, XlyVal **args, int argc) {
+    XlyVal *v = xly_new(cls);
+    xly_call_init(cls, v, args, argc);
+    return v;
+}
+
+/* v instanceof cls: walk v's class chain. */
+XlyVal *xly_instanceof(XlyVal *v, const XlyClass *cls) {
+    for (const XlyClass *c = xly_class_of(v); c; c = c->parent)
+        if (c == cls) return xly_bool(1);
+    return xly_bool(0);
+}
 
 /* Call a method on an object: obj.method(args, argc).
- * Looks up field `method` on `obj`; if it's a VAL_FUNCTION, calls it.
- * Sets g_this = obj so `this` is accessible inside the method body. */
+ * Class instances dispatch through their class's vtable by name, passing
+ * the receiver as the method's hidden first argument; other objects look
+ * up field `method` and call it, with obj as the receiver if the function
+ * takes one (xly_make_method).                                           */
+static XlyVal *gen_next_result(XlyVal *iter);   /* see GENERATOR RUNTIME HELPERS */
+
 XlyVal *xly_obj_call(XlyVal *obj, const char *method, XlyVal **args, int argc) {
+    if (obj && obj->type == VAL_INSTANCE && obj->class_def && strcmp(method, "next") == 0)
+        return gen_next_result(obj);
+    const XlyClass *cls = xly_class_of(obj);
+    if (cls) {
+        for (int64_t i = 0; i < cls->nslots; i++)
+            if (cls->vtable[i] && strcmp(cls->selectors[i], method) == 0)
+                return xly_call_hidden(cls->vtable[i], obj, args, argc);
+    }
     XlyVal *fn_val = xly_obj_get(obj, method);
-    if (!fn_val || fn_val->type != VAL_FUNCTION) return xly_null();
-    XlyVal *prev_this = g_this;
-    g_this = obj;
-    XlyVal *result = xly_call_fnval(fn_val, args, argc);
-    g_this = prev_this;
-    return result;
+    if (!fn_val || fn_val->type != VAL_FUNCTION || !fn_val->builtin_fn) return xly_null();
+    if (fn_val->boolean) return xly_call_method(fn_val, obj, args, argc);
+    return xly_call_fnval(fn_val, args, argc);
 }
 
 /* ══════════════════════════════════════════════════════════════════════════════
  * MUTABLE CLOSURE CAPTURE CELLS
  *
  * For `var` variables captured by closures, we use a heap-allocated cell
- * (a single XlyVal* on the heap).  All closures sharing the capture hold a
+ * (a single XlyVal* in a slot of the collected heap).  All closures sharing the capture hold a
  * pointer to the SAME cell, so mutations are visible across calls.
  *
  * xly_make_cell(val) → XlyVal** (heap pointer, initially pointing to val)
@@ -1072,7 +1917,7 @@ XlyVal *xly_obj_call(XlyVal *obj, const char *method, XlyVal **args, int argc) {
  * ══════════════════════════════════════════════════════════════════════════════ */
 
 XlyVal **xly_make_cell(XlyVal *initial) {
-    XlyVal **cell = (XlyVal**)malloc(sizeof(XlyVal*));
+    XlyVal **cell = (XlyVal**)gc_alloc(GC_CELL);
     *cell = initial;
     return cell;
 }
@@ -1092,7 +1937,7 @@ XlyVal *value_bool(int b)             { return xly_bool(b);  }
 XlyVal *value_null(void)              { return xly_null();   }
 
 XlyVal *value_array(XlyVal **items, size_t len) {
-    XlyVal *v = (XlyVal*)calloc(1, sizeof(XlyVal));
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
     v->type      = VAL_ARRAY;
     v->array     = items;
     v->array_len = len;
@@ -1100,8 +1945,10 @@ XlyVal *value_array(XlyVal **items, size_t len) {
     return v;
 }
 
+/* A collected value is freed by the sweep; here it only drops a pin. */
 void value_destroy(XlyVal *v) {
-    if (!v) return;
+    if (!v || v->refcount == XLY_NOT_HEAP) return;
+    if (gc_owns(v)) { gc_unpin(v); return; }
     switch (v->type) {
         case VAL_STRING: free(v->str); free(v); break;
         case VAL_NUMBER:
@@ -1121,10 +1968,11 @@ XlyVal *value_clone(XlyVal *v) {
         case VAL_BOOL:   return xly_bool(v->boolean);
         case VAL_NULL:   return xly_null();
         case VAL_ARRAY: {
-            size_t alloc = v->array_len > 0 ? v->array_len : 4;
-            XlyVal **items = (XlyVal**)malloc(sizeof(XlyVal*) * alloc);
-            for (size_t i = 0; i < v->array_len; i++) items[i] = value_clone(v->array[i]);
-            return xly_array_create(items, v->array_len);
+            /* the copy holds each clone as it is made: a collection may run */
+            XlyVal *copy = xly_array_create(NULL, 0);
+            for (size_t i = 0; i < v->array_len; i++)
+                xly_array_push(copy, value_clone(v->array[i]));
+            return copy;
         }
         default: return v;
     }
@@ -1437,6 +2285,7 @@ XlyVal *xly_reflect_delete(XlyVal *obj, XlyVal *key) {
 
 XlyVal *xly_reflect_freeze(XlyVal *obj) {
     if (!obj) return xly_null();
+    if (obj->refcount == XLY_NOT_HEAP) return obj;     /* shared or read-only */
     /* Set the frozen sentinel directly — local is accessible in xly_rt.c */
     obj->local = 99;
     return obj;
@@ -1482,63 +2331,736 @@ XlyVal *xly_index_set(XlyVal *collection, XlyVal *index, XlyVal *val) {
 /* ═══════════════════════════════════════════════════════════════════════════
  * GENERATOR RUNTIME HELPERS
  *
- * Native generator bodies compiled by xenlyc call xly_gen_yield() to
- * suspend, and the iterator's .next() calls through xly_for_of_next().
+ * A compiled `gen fn` body is an ordinary function; it runs on a stack of
+ * its own and xly_gen_yield() switches back to whoever resumed it, so a
+ * yield inside loops or nested calls suspends with all its locals intact.
  *
- * Thread-local yield state: _gen_yield_val / _gen_yielded.
- * On macOS this is safe for single-threaded generator use.  Multi-threaded
- * generator use requires per-generator state (future work).
+ *   xly_gen_fn(body)      → the value bound to the generator's name; calling
+ *                           it makes a generator holding the arguments
+ *                           (the body does not start until the first next)
+ *   xly_for_of_next(g)    → resumes g up to its next yield: the yielded
+ *                           value, or NULL once the body has returned
+ *   xly_gen_yield(v)      → suspends the running generator with v
+ *
+ * A generator is a VAL_INSTANCE whose class_def holds its XlyGen; besides
+ * for-of it answers .next() with { value, done }.  The stack is mapped on
+ * the first resume (guard page below it) and goes back to a per-thread
+ * pool when the body returns, so a for-of loop costs one pair of stack
+ * switches per element and allocates nothing itself.
  * ═══════════════════════════════════════════════════════════════════════════ */
 
-#if defined(__GNUC__) || defined(__clang__)
-#  define XLY_THREAD_LOCAL __thread
+#define XLY_GEN_STACK      (256 * 1024)   /* per generator, guard page included */
+#define XLY_GEN_POOL_MAX   16             /* idle stacks kept per thread        */
+
+enum { GEN_NEW, GEN_SUSPENDED, GEN_RUNNING, GEN_DONE };
+
+typedef struct XlyGen {
+    void           *sp;          /* suspended generator's stack pointer  */
+    void           *caller_sp;   /* resumer's, while the generator runs  */
+    void           *body;
+    XlyVal         *args[6];
+    XlyVal         *value;       /* last yielded                         */
+    char           *stack;       /* XLY_GEN_STACK bytes, NULL until run  */
+    struct XlyGen  *resumer;     /* generator running when this resumed  */
+    XlyVal         *iter;        /* the generator value itself           */
+    int             state;
+} XlyGen;
+
+/* xly_gen_swap(save, to): push the callee-saved registers, store the
+ * stack pointer in *save, switch to `to` and pop the registers saved
+ * there.  A new stack is laid out as if it had been switched away from
+ * just before entering gen_entry (see gen_stack_init).                   */
+void xly_gen_swap(void **save, void *to);
+
+#if defined(__APPLE__)
+#  define XLY_GEN_SWAP_SYM  "_xly_gen_swap"
+#  define XLY_GEN_SWAP_TYPE ""
+#elif defined(__aarch64__)
+#  define XLY_GEN_SWAP_SYM  "xly_gen_swap"
+#  define XLY_GEN_SWAP_TYPE ".type xly_gen_swap, %function\n"
 #else
-#  define XLY_THREAD_LOCAL
+#  define XLY_GEN_SWAP_SYM  "xly_gen_swap"
+#  define XLY_GEN_SWAP_TYPE ".type xly_gen_swap, @function\n"
+#endif
+
+#if defined(__aarch64__) || defined(__arm64__)
+#define XLY_GEN_FRAME 160            /* x19–x30, d8–d15 */
+__asm__(
+    ".text\n"
+    ".p2align 2\n"
+    ".globl " XLY_GEN_SWAP_SYM "\n"
+    XLY_GEN_SWAP_TYPE
+    XLY_GEN_SWAP_SYM ":\n"
+    "    sub     sp, sp, #160\n"
+    "    stp     x19, x20, [sp, #0]\n"
+    "    stp     x21, x22, [sp, #16]\n"
+    "    stp     x23, x24, [sp, #32]\n"
+    "    stp     x25, x26, [sp, #48]\n"
+    "    stp     x27, x28, [sp, #64]\n"
+    "    stp     x29, x30, [sp, #80]\n"
+    "    stp     d8,  d9,  [sp, #96]\n"
+    "    stp     d10, d11, [sp, #112]\n"
+    "    stp     d12, d13, [sp, #128]\n"
+    "    stp     d14, d15, [sp, #144]\n"
+    "    mov     x9, sp\n"
+    "    str     x9, [x0]\n"
+    "    mov     sp, x1\n"
+    "    ldp     x19, x20, [sp, #0]\n"
+    "    ldp     x21, x22, [sp, #16]\n"
+    "    ldp     x23, x24, [sp, #32]\n"
+    "    ldp     x25, x26, [sp, #48]\n"
+    "    ldp     x27, x28, [sp, #64]\n"
+    "    ldp     x29, x30, [sp, #80]\n"
+    "    ldp     d8,  d9,  [sp, #96]\n"
+    "    ldp     d10, d11, [sp, #112]\n"
+    "    ldp     d12, d13, [sp, #128]\n"
+    "    ldp     d14, d15, [sp, #144]\n"
+    "    add     sp, sp, #160\n"
+    "    ret\n");
+#else
+#define XLY_GEN_FRAME 64             /* rbp rbx r12–r15, return address, pad */
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    ".globl " XLY_GEN_SWAP_SYM "\n"
+    XLY_GEN_SWAP_TYPE
+    XLY_GEN_SWAP_SYM ":\n"
+    "    pushq   %rbp\n"
+    "    pushq   %rbx\n"
+    "    pushq   %r12\n"
+    "    pushq   %r13\n"
+    "    pushq   %r14\n"
+    "    pushq   %r15\n"
+    "    movq    %rsp, (%rdi)\n"
+    "    movq    %rsi, %rsp\n"
+    "    popq    %r15\n"
+    "    popq    %r14\n"
+    "    popq    %r13\n"
+    "    popq    %r12\n"
+    "    popq    %rbx\n"
+    "    popq    %rbp\n"
+    "    ret\n");
 #endif
 
-static XLY_THREAD_LOCAL XlyVal *_gen_yield_val = NULL;
-static XLY_THREAD_LOCAL int     _gen_yielded   = 0;
+static XLY_THREAD_LOCAL char   *g_gen_pool[XLY_GEN_POOL_MAX];
+static XLY_THREAD_LOCAL int     g_gen_pool_n = 0;
+
+typedef XlyVal *(*XlyGenBody)(XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*,XlyVal*);
+
+/* First code run on a generator's stack: the body, then a final switch
+ * back marked GEN_DONE.  The resumer releases the stack. */
+static void gen_entry(void) {
+    XlyGen *g = g_gen_cur;
+    ((XlyGenBody)g->body)(g->args[0], g->args[1], g->args[2],
+                          g->args[3], g->args[4], g->args[5]);
+    g->state = GEN_DONE;
+    g->value = NULL;
+    xly_gen_swap(&g->sp, g->caller_sp);
+    abort();   /* a finished generator is never resumed */
+}
 
-XlyVal *xly_gen_create(void *fn_ptr, void *env_ptr) {
-    (void)env_ptr;
-    XlyVal *iter = xly_obj_new();
-    xly_obj_set(iter, "done",       xly_bool(0));
-    xly_obj_set(iter, "value",      xly_null());
-    xly_obj_set(iter, "__gen_fn__", xly_num((double)(uintptr_t)fn_ptr));
+static char *gen_stack_alloc(void) {
+    if (g_gen_pool_n > 0) return g_gen_pool[--g_gen_pool_n];
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_STACK
+    flags |= MAP_STACK;
+#endif
+    void *m = mmap(NULL, XLY_GEN_STACK, PROT_READ | PROT_WRITE, flags, -1, 0);
+    if (m == MAP_FAILED) {
+        fprintf(stderr, "[xly_rt] generator: cannot map a stack: %s\n", strerror(errno));
+        exit(1);
+    }
+    mprotect(m, (size_t)sysconf(_SC_PAGESIZE), PROT_NONE);   /* overflow guard */
+    return (char *)m;
+}
+
+static void gen_stack_free(char *stack) {
+    if (g_gen_pool_n < XLY_GEN_POOL_MAX) g_gen_pool[g_gen_pool_n++] = stack;
+    else munmap(stack, XLY_GEN_STACK);
+}
+
+/* Lay out a frame at the top of g's stack for xly_gen_swap to "return"
+ * into gen_entry: zeroed callee-saved registers and gen_entry as the
+ * return address, entered with the alignment of a normal call.          */
+static void gen_stack_init(XlyGen *g) {
+    uintptr_t top = ((uintptr_t)g->stack + XLY_GEN_STACK) & ~(uintptr_t)15;
+    void **frame = (void **)(top - XLY_GEN_FRAME);
+    memset(frame, 0, XLY_GEN_FRAME);
+#if defined(__aarch64__) || defined(__arm64__)
+    frame[11] = (void *)gen_entry;          /* x30 */
+#else
+    frame[6] = (void *)gen_entry;           /* return address; rsp ≡ 8 mod 16 */
+#endif
+    g->sp = frame;
+}
+
+static XlyGen *gen_of(XlyVal *v) {
+    return v && v->type == VAL_INSTANCE ? (XlyGen *)v->class_def : NULL;
+}
+
+/* Calling the generator function: bind the arguments, do not run yet. */
+static XlyVal *gen_call(XlyVal *body, XlyVal *a0, XlyVal *a1, XlyVal *a2,
+                        XlyVal *a3, XlyVal *a4, XlyVal *a5) {
+    XlyVal *iter = xly_obj_new();   /* first: the collector does not see g yet */
+    XlyGen *g = calloc(1, sizeof(XlyGen));
+    g->body = (void *)body;
+    g->args[0] = a0; g->args[1] = a1; g->args[2] = a2;
+    g->args[3] = a3; g->args[4] = a4; g->args[5] = a5;
+    g->iter  = iter;
+    g->state = GEN_NEW;
+    iter->class_def = g;
     return iter;
 }
 
+/* The body pointer rides in the closure env slot: xly_call_fnval hands it
+ * to gen_call as the hidden first argument. */
+XlyVal *xly_gen_fn(void *body) {
+    XlyVal *v = (XlyVal*)gc_alloc(GC_VAL);
+    v->type       = VAL_FUNCTION;
+    v->builtin_fn = (void *)gen_call;
+    v->inner      = (XlyVal *)body;
+    return v;
+}
+
 void xly_gen_yield(XlyVal *val) {
-    _gen_yield_val = val;
-    _gen_yielded   = 1;
-    /* The generator body returns here; xly_for_of_next detects the yield */
+    XlyGen *g = g_gen_cur;
+    if (!g) return;                          /* yield outside a generator */
+    g->value = val ? val : xly_null();
+    g->state = GEN_SUSPENDED;
+    xly_gen_swap(&g->sp, g->caller_sp);
 }
 
 XlyVal *xly_for_of_next(XlyVal *iter) {
-    if (!iter) return NULL;
+    XlyGen *g = gen_of(iter);
+    if (!g || g->state == GEN_DONE || g->state == GEN_RUNNING) return NULL;
+    if (g->state == GEN_NEW) {
+        g->stack = gen_stack_alloc();
+        gen_stack_init(g);
+    }
+    g->resumer = g_gen_cur;
+    g_gen_cur  = g;
+    g->state   = GEN_RUNNING;
+    xly_gen_swap(&g->caller_sp, g->sp);
+    g_gen_cur  = g->resumer;
+    if (g->state == GEN_DONE) {
+        gen_stack_free(g->stack);
+        g->stack = NULL;
+        return NULL;
+    }
+    return g->value;
+}
+
+/* g.next() → { value, done } */
+static XlyVal *gen_next_result(XlyVal *iter) {
+    XlyVal *v = xly_for_of_next(iter);
+    XlyVal *r = xly_obj_new();
+    xly_obj_set(r, "value", v ? v : xly_null());
+    xly_obj_set(r, "done",  xly_bool(v == NULL));
+    return r;
+}
+
+/* ══════════════════════════════════════════════════════════════════════════════
+ * GARBAGE COLLECTION
+ *
+ * Values, closure envs and capture cells live in 128-byte slots of 1 MiB
+ * chunks aligned to their size; a chunk starts with a header holding each
+ * slot's kind and mark bit.  Allocation pops a free list, else bumps.
+ *
+ * A collection is mark-sweep:
+ *   • roots — the globals main and every unit register (xly_gc_roots),
+ *     values pinned while a channel queues them, spawned tasks not
+ *     started yet, and the machine stack from the
+ *     collector's frame up to its thread's entry plus the stacks of the
+ *     generators that resumed the running one; the same for every other
+ *     thread from where it parked.  Stacks are scanned conservatively:
+ *     any word that points into a live slot keeps it.
+ *   • tracing from there is by type: array elements, object fields,
+ *     closure envs, cells, variant fields, a generator's arguments, last
+ *     value and (while suspended) its stack
+ *   • the sweep frees what an unmarked value owns (string bytes, element
+ *     buffers, object stores, generator stacks) and unmaps empty chunks
+ * One runs once as many slots have been handed out as survived the last
+ * (GC_MIN_TRIGGER at least); XENLY_GC=off turns collection off.
+ *
+ * Every thread allocates from spaces of its own, one per arena depth:
+ * the chunks it made, with the free slots a sweep found in them.  Only
+ * making a chunk takes rt_lock, and a thread adds what it took to the
+ * shared count GC_BATCH slots at a time.  A collection stops the other
+ * threads first (see THREADS), so it has the whole heap to itself.
+ *
+ * sys.arenaBegin() / sys.arenaEnd() bracket a region of the calling
+ * thread, e.g. one request: what it allocates in between goes to the
+ * region's own chunks, and arenaEnd marks from the roots but sweeps only
+ * those chunks.  Values that escaped survive and pass to the enclosing
+ * region (or the heap), so ending a region never leaves a dangling
+ * pointer.
+ *
+ * Until main registers its roots — libxly_rt.a inside the interpreter,
+ * objects built by an older xenlyc — and on threads the runtime did not
+ * start, values come from calloc and are never collected.
+ * ══════════════════════════════════════════════════════════════════════════════ */
 
-    /* Check done flag */
-    XlyVal *done = xly_obj_get(iter, "done");
-    if (done && xly_truthy(done)) return NULL;
+#define GC_CHUNK        ((size_t)1 << 20)
+#define GC_SLOT         sizeof(XlyVal)
+#define GC_SLOTS        (GC_CHUNK / GC_SLOT)
+#define GC_MIN_TRIGGER  ((size_t)1 << 16)      /* slots: 8 MiB             */
+#define GC_MAX_REGIONS  64
+#define GC_BATCH        256                    /* slots per gc.since update */
 
-    /* Get generator body function pointer */
-    XlyVal *fn_val = xly_obj_get(iter, "__gen_fn__");
-    if (!fn_val || fn_val->type != VAL_NUMBER) return NULL;
+typedef struct GcChunk {
+    int        region;                  /* arena depth owning it; 0 = heap */
+    uint32_t   used;                    /* slots below this handed out     */
+    XlyThread *owner;                   /* whose spaces it fills           */
+    uint64_t   mark[GC_SLOTS / 64];
+    uint8_t    kind[GC_SLOTS];          /* GC_FREE, GC_VAL, ...            */
+} GcChunk;
 
-    typedef void (*GenBodyFn)(XlyVal *);
-    GenBodyFn body = (GenBodyFn)(uintptr_t)(unsigned long long)(fn_val->num);
+#define GC_FIRST  ((uint32_t)((sizeof(GcChunk) + GC_SLOT - 1) / GC_SLOT))
 
-    _gen_yielded   = 0;
-    _gen_yield_val = NULL;
-    body(iter);   /* body calls xly_gen_yield() then returns */
+typedef struct GcSpace { void *free; GcChunk *bump; } GcSpace;
+typedef struct { XlyVal **vals; size_t n; } GcRoots;
 
-    if (!_gen_yielded) {
-        xly_obj_set(iter, "done",  xly_bool(1));
-        xly_obj_set(iter, "value", xly_null());
-        return NULL;
+static struct {
+    int        on, off;                 /* roots registered / XENLY_GC=off */
+    GcChunk  **chunks;                  /* sorted by address; rt_lock      */
+    int        nchunks, cap;
+    uintptr_t  lo, hi;
+    size_t     since, trigger;          /* slots handed out since the last */
+    GcRoots   *roots;
+    int        nroots;
+    char      *stack_base;              /* main's entry stack pointer      */
+    char     **todo;                    /* marked, not yet traced          */
+    size_t     ntodo, todo_cap;
+} gc;
+
+static XLY_THREAD_LOCAL int gc_depth;   /* the thread's open arenas        */
+
+static GcSpace *gc_spaces_new(void) {
+    return calloc(GC_MAX_REGIONS + 1, sizeof(GcSpace));
+}
+
+static GcChunk *gc_chunk_of(const void *p) {
+    return (GcChunk *)((uintptr_t)p & ~(uintptr_t)(GC_CHUNK - 1));
+}
+
+static size_t gc_index(const GcChunk *c, const void *p) {
+    return (size_t)((const char *)p - (const char *)c) / GC_SLOT;
+}
+
+static int gc_chunk_pos(uintptr_t base) {   /* insertion point in gc.chunks */
+    int lo = 0, hi = gc.nchunks;
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        if ((uintptr_t)gc.chunks[mid] < base) lo = mid + 1; else hi = mid;
+    }
+    return lo;
+}
+
+/* Map twice the size and trim, for the alignment; mmap zeroes the header. */
+static GcChunk *gc_chunk_new(XlyThread *owner, int region) {
+    size_t len = GC_CHUNK * 2;
+    char *m = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (m == MAP_FAILED) {
+        fprintf(stderr, "[xly_rt] out of memory: %s\n", strerror(errno));
+        exit(1);
+    }
+    uintptr_t a = ((uintptr_t)m + GC_CHUNK - 1) & ~(uintptr_t)(GC_CHUNK - 1);
+    if (a > (uintptr_t)m) munmap(m, a - (uintptr_t)m);
+    if ((uintptr_t)m + len > a + GC_CHUNK)
+        munmap((char *)a + GC_CHUNK, (uintptr_t)m + len - (a + GC_CHUNK));
+    GcChunk *c = (GcChunk *)a;
+    c->region = region;
+    c->used   = GC_FIRST;
+    c->owner  = owner;
+
+    pthread_mutex_lock(&rt_lock);
+    if (gc.nchunks == gc.cap) {
+        gc.cap = gc.cap ? gc.cap * 2 : 16;
+        gc.chunks = realloc(gc.chunks, sizeof(GcChunk *) * (size_t)gc.cap);
+    }
+    int at = gc_chunk_pos(a);
+    memmove(gc.chunks + at + 1, gc.chunks + at, sizeof(GcChunk *) * (size_t)(gc.nchunks - at));
+    gc.chunks[at] = c;
+    gc.nchunks++;
+    if (!gc.lo || a < gc.lo) gc.lo = a;
+    if (a + GC_CHUNK > gc.hi) gc.hi = a + GC_CHUNK;
+    pthread_mutex_unlock(&rt_lock);
+    return c;
+}
+
+static void gc_chunk_release(int at) {
+    GcChunk *c = gc.chunks[at];
+    for (int d = 0; d <= GC_MAX_REGIONS; d++)
+        if (c->owner->space[d].bump == c) c->owner->space[d].bump = NULL;
+    memmove(gc.chunks + at, gc.chunks + at + 1, sizeof(GcChunk *) * (size_t)(gc.nchunks - at - 1));
+    gc.nchunks--;
+    munmap(c, GC_CHUNK);
+}
+
+static size_t gc_collect(int region, int due);
+
+/* n consecutive slots from the thread's current region; the first is of
+ * `kind`.  Also the safepoint where a thread stops for a collection.   */
+static char *gc_take(XlyThread *t, int kind, size_t n) {
+    if (__atomic_load_n(&xly_stopping, __ATOMIC_RELAXED)) rt_safepoint();
+    if (t->taken >= GC_BATCH) {
+        size_t since = __atomic_add_fetch(&gc.since, t->taken, __ATOMIC_RELAXED);
+        t->taken = 0;
+        if (since >= __atomic_load_n(&gc.trigger, __ATOMIC_RELAXED) && !gc.off)
+            gc_collect(-1, 1);
+    }
+    GcSpace *s = &t->space[gc_depth];
+    char    *p = NULL;
+    GcChunk *c;
+    if (n == 1 && s->free) {
+        p = s->free;
+        s->free = *(void **)p;
+        c = gc_chunk_of(p);
+    } else {
+        c = s->bump;
+        if (!c || c->used + n > GC_SLOTS) c = s->bump = gc_chunk_new(t, gc_depth);
+        p = (char *)c + (size_t)c->used * GC_SLOT;
+        c->used += (uint32_t)n;
+    }
+    memset(p, 0, n * GC_SLOT);
+    size_t i = gc_index(c, p);
+    c->kind[i] = (uint8_t)kind;
+    for (size_t k = 1; k < n; k++) c->kind[i + k] = GC_ENV_TAIL;
+    t->taken += n;
+    return p;
+}
+
+static void *gc_alloc(int kind) {
+    XlyThread *t = rt_self;
+    if (!gc.on || !t) return calloc(1, GC_SLOT);
+    return gc_take(t, kind, 1);
+}
+
+/* A closure env: its length, then the n entries the body indexes. */
+static XlyVal **gc_alloc_env(size_t n) {
+    size_t bytes = sizeof(size_t) + n * sizeof(XlyVal *);
+    XlyThread *t = rt_self;
+    size_t *e = gc.on && t ? (size_t *)gc_take(t, GC_ENV, (bytes + GC_SLOT - 1) / GC_SLOT)
+                           : (size_t *)calloc(1, bytes);
+    e[0] = n;
+    return (XlyVal **)(e + 1);
+}
+
+/* The slot p points into (its start), NULL unless a live one. */
+static char *gc_find(uintptr_t p) {
+    if (p < gc.lo || p >= gc.hi) return NULL;
+    GcChunk *c = gc_chunk_of((void *)p);
+    int at = gc_chunk_pos((uintptr_t)c);
+    if (at >= gc.nchunks || gc.chunks[at] != c) return NULL;
+    size_t i = gc_index(c, (void *)p);
+    if (i < GC_FIRST || i >= c->used) return NULL;
+    while (c->kind[i] == GC_ENV_TAIL) i--;
+    if (c->kind[i] == GC_FREE) return NULL;
+    return (char *)c + i * GC_SLOT;
+}
+
+/* From a running thread; a collection has the table to itself. */
+static int gc_owns(const XlyVal *v) {
+    if (!gc.on) return 0;
+    pthread_mutex_lock(&rt_lock);
+    int own = gc_find((uintptr_t)v) == (const char *)v;
+    pthread_mutex_unlock(&rt_lock);
+    return own;
+}
+
+static void gc_pin(XlyVal *v) {
+    if (!v || v->refcount == XLY_NOT_HEAP || !gc.on) return;
+    pthread_mutex_lock(&rt_lock);
+    if (gc_find((uintptr_t)v) == (const char *)v) v->refcount++;
+    pthread_mutex_unlock(&rt_lock);
+}
+
+static XlyVal *gc_unpin(XlyVal *v) {
+    if (!v || v->refcount == XLY_NOT_HEAP || !gc.on) return v;
+    pthread_mutex_lock(&rt_lock);
+    if (v->refcount > 0 && gc_find((uintptr_t)v) == (const char *)v) v->refcount--;
+    pthread_mutex_unlock(&rt_lock);
+    return v;
+}
+
+static void gc_mark(const void *p) {
+    char *slot = gc_find((uintptr_t)p);
+    if (!slot) return;
+    GcChunk *c = gc_chunk_of(slot);
+    size_t   i = gc_index(c, slot);
+    uint64_t bit = (uint64_t)1 << (i & 63);
+    if (c->mark[i >> 6] & bit) return;
+    c->mark[i >> 6] |= bit;
+    if (gc.ntodo == gc.todo_cap) {
+        gc.todo_cap = gc.todo_cap ? gc.todo_cap * 2 : 1024;
+        gc.todo = realloc(gc.todo, sizeof(char *) * gc.todo_cap);
     }
+    gc.todo[gc.ntodo++] = slot;
+}
+
+static void gc_scan(const char *lo, const char *hi) {
+    const uintptr_t *w = (const uintptr_t *)(((uintptr_t)lo + 7) & ~(uintptr_t)7);
+    for (; (const char *)(w + 1) <= hi; w++) gc_mark((const void *)*w);
+}
+
+static void gc_trace_val(XlyVal *v) {
+    switch (v->type) {
+        case VAL_ARRAY:
+            for (size_t i = 0; i < v->array_len; i++) gc_mark(v->array[i]);
+            break;
+        case VAL_FUNCTION:
+            gc_mark(v->inner);          /* env; a generator's code is not in the heap */
+            break;
+        case VAL_ENUM_VARIANT:
+            for (size_t i = 0; i < v->variant.field_count; i++) gc_mark(v->variant.fields[i]);
+            break;
+        case VAL_INSTANCE: {
+            XlyObjStore *s = (XlyObjStore *)v->instance;
+            if (s)
+                for (size_t i = 0; i < s->count; i++) gc_mark(s->vals[i]);
+            XlyGen *g = (XlyGen *)v->class_def;
+            if (g) {
+                for (int i = 0; i < 6; i++) gc_mark(g->args[i]);
+                gc_mark(g->value);
+                if (g->state == GEN_SUSPENDED)
+                    gc_scan((const char *)g->sp, g->stack + XLY_GEN_STACK);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+static void gc_drain(void) {
+    while (gc.ntodo > 0) {
+        char    *p = gc.todo[--gc.ntodo];
+        GcChunk *c = gc_chunk_of(p);
+        switch (c->kind[gc_index(c, p)]) {
+            case GC_VAL:  gc_trace_val((XlyVal *)p); break;
+            case GC_CELL: gc_mark(*(XlyVal **)p); break;
+            case GC_ENV: {
+                size_t   n = *(size_t *)p;
+                XlyVal **e = (XlyVal **)(p + sizeof(size_t));
+                for (size_t i = 0; i < n; i++) gc_mark(e[i]);
+                break;
+            }
+        }
+    }
+}
 
-    XlyVal *yval = _gen_yield_val ? _gen_yield_val : xly_null();
-    xly_obj_set(iter, "value", yval);
-    return yval;
+/* A thread's stack from sp up (a generator's, while g runs), then each
+ * resumer's from where it switched away. */
+static void gc_scan_thread(char *sp, XlyGen *g, char *base) {
+    gc_scan(sp, g ? g->stack + XLY_GEN_STACK : base);
+    for (; g; g = g->resumer) {
+        gc_mark(g->iter);
+        sp = (char *)g->caller_sp;
+        gc_scan(sp, g->resumer ? g->resumer->stack + XLY_GEN_STACK : base);
+    }
+}
+
+/* The running stack from this frame up, then every parked thread's.
+ * Kept out of line so the caller's frame, with every callee-saved
+ * register spilled into it, lies above `here`.                          */
+static __attribute__((noinline)) void gc_scan_stacks(void) {
+    volatile char here = 0;   /* every other thread is parked */
+    gc_scan_thread((char *)&here, g_gen_cur, rt_self ? rt_self->base : gc.stack_base);
+    for (XlyThread *t = rt_threads; t; t = t->next) {
+        if (t == rt_self || !t->sp) continue;
+        gc_scan_thread(t->sp, t->gen, t->base);
+    }
+}
+
+static __attribute__((noinline)) void gc_mark_roots(void) {
+    __builtin_unwind_init();
+    for (int r = 0; r < gc.nroots; r++)
+        for (size_t i = 0; i < gc.roots[r].n; i++) gc_mark(gc.roots[r].vals[i]);
+    for (RtTask *t = rt_pool.head; t; t = t->next) {
+        gc_mark(t->fn);
+        for (int i = 0; i < t->argc; i++) gc_mark(t->args[i]);
+    }
+    for (int k = 0; k < gc.nchunks; k++) {
+        GcChunk *c = gc.chunks[k];
+        for (size_t i = GC_FIRST; i < c->used; i++)
+            if (c->kind[i] == GC_VAL && ((XlyVal *)((char *)c + i * GC_SLOT))->refcount > 0)
+                gc_mark((char *)c + i * GC_SLOT);
+    }
+    gc_scan_stacks();
+    gc_drain();
+}
+
+static void gc_finalize(XlyVal *v) {
+    switch (v->type) {
+        case VAL_STRING: free(v->str); break;
+        case VAL_ARRAY:  free(v->array); break;
+        case VAL_ENUM_VARIANT:
+            free(v->variant.tag);
+            free(v->variant.fields);
+            break;
+        case VAL_INSTANCE: {
+            XlyObjStore *s = (XlyObjStore *)v->instance;
+            if (s) {
+                /* the keys are atoms, which live as long as the program */
+                if (s->keys != s->inline_keys) {
+                    free(s->keys);
+                    free(s->vals);
+                }
+                free(s->index);
+                free(s);
+            }
+            XlyGen *g = (XlyGen *)v->class_def;
+            if (g) {
+                if (g->stack) gen_stack_free(g->stack);
+                free(g);
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+/* Free the unmarked slots of the chunks of `region` (every chunk when -1)
+ * and clear all marks.  Region chunks pass to the enclosing region.
+ * Returns the number of values freed.                                   */
+static size_t gc_sweep(int region) {
+    size_t freed = 0, live_total = 0;
+    if (region < 0) {
+        for (XlyThread *t = rt_threads; t; t = t->next)
+            for (int d = 0; d <= GC_MAX_REGIONS; d++) t->space[d].free = NULL;
+    } else {
+        rt_self->space[region].free = NULL;
+    }
+    for (int k = 0; k < gc.nchunks; k++) {
+        GcChunk *c = gc.chunks[k];
+        if (region >= 0 && (c->region != region || c->owner != rt_self)) {
+            memset(c->mark, 0, sizeof(c->mark));
+            continue;
+        }
+        if (region > 0) c->region = region - 1;
+        size_t live = 0;
+        void  *head = NULL, **tail = &head;
+        for (size_t i = GC_FIRST; i < c->used; ) {
+            size_t n = 1;
+            while (i + n < c->used && c->kind[i + n] == GC_ENV_TAIL) n++;
+            char *p = (char *)c + i * GC_SLOT;
+            if (c->kind[i] != GC_FREE && (c->mark[i >> 6] >> (i & 63) & 1)) {
+                live += n;
+            } else {
+                if (c->kind[i] == GC_VAL) { gc_finalize((XlyVal *)p); freed++; }
+                for (size_t j = 0; j < n; j++) {
+                    char *q = p + j * GC_SLOT;
+                    c->kind[i + j] = GC_FREE;
+                    *tail = q;
+                    tail  = (void **)q;
+                }
+            }
+            i += n;
+        }
+        *tail = NULL;
+        memset(c->mark, 0, sizeof(c->mark));
+        if (live == 0 && gc.nchunks > 1) {
+            gc_chunk_release(k--);
+            continue;
+        }
+        if (head) {
+            GcSpace *s = &c->owner->space[c->region];
+            *tail   = s->free;
+            s->free = head;
+        }
+        live_total += live;
+    }
+    if (region < 0) {
+        __atomic_store_n(&gc.since, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&gc.trigger, live_total > GC_MIN_TRIGGER ? live_total : GC_MIN_TRIGGER,
+                         __ATOMIC_RELAXED);
+    } else {
+        size_t since = __atomic_load_n(&gc.since, __ATOMIC_RELAXED);
+        __atomic_store_n(&gc.since, since > freed ? since - freed : 0, __ATOMIC_RELAXED);
+    }
+    return freed;
+}
+
+/* Stop the other threads, mark, sweep `region`, let them go.  With `due`
+ * only if a collection is still due: another thread may just have run
+ * one.  When two threads ask at once, the second waits for the first.  */
+static size_t gc_collect(int region, int due) {
+    XlyThread *self = rt_self;
+    if (!gc.on || gc.off || !self) return 0;
+    pthread_mutex_lock(&rt_lock);
+    if (xly_stopping) {
+        rt_park(self);
+        rt_unpark(self);
+    }
+    if (due && __atomic_load_n(&gc.since, __ATOMIC_RELAXED) <
+               __atomic_load_n(&gc.trigger, __ATOMIC_RELAXED)) {
+        pthread_mutex_unlock(&rt_lock);
+        return 0;
+    }
+    __atomic_store_n(&xly_stopping, 1, __ATOMIC_RELAXED);
+    while (rt_running > 1) pthread_cond_wait(&rt_parked, &rt_lock);
+    gc_mark_roots();
+    size_t freed = gc_sweep(region);
+    __atomic_store_n(&xly_stopping, 0, __ATOMIC_RELAXED);
+    pthread_cond_broadcast(&rt_resumed);
+    pthread_mutex_unlock(&rt_lock);
+    return freed;
+}
+
+/* main passes its globals and its entry stack pointer; a unit's
+ * initializer its own globals and NULL. */
+void xly_gc_roots(XlyVal **globals, size_t n, void *stack_base) {
+    if (stack_base && !gc.on) {
+        const char *env = getenv("XENLY_GC");
+        gc.off        = env && (strcmp(env, "off") == 0 || strcmp(env, "0") == 0);
+        gc.stack_base = (char *)stack_base;
+        gc.trigger    = GC_MIN_TRIGGER;
+        gc.on         = 1;
+        rt_thread_enter(gc.stack_base, 0);
+    }
+    if (!globals || n == 0) return;
+    pthread_mutex_lock(&rt_lock);
+    gc.roots = realloc(gc.roots, sizeof(GcRoots) * (size_t)(gc.nroots + 1));
+    gc.roots[gc.nroots].vals = globals;
+    gc.roots[gc.nroots].n    = n;
+    gc.nroots++;
+    pthread_mutex_unlock(&rt_lock);
+}
+
+/* sys.gc() → values freed;  sys.arenaBegin() → depth;  sys.arenaEnd() →
+ * values of the region freed.  NULL when `fn` is not one of these.      */
+static XlyVal *xly_gc_call(const char *fn, XlyVal **args, size_t argc) {
+    (void)args; (void)argc;
+    if (strcmp(fn, "gc") == 0)
+        return xly_num((double)gc_collect(-1, 0));
+    if (strcmp(fn, "arenaBegin") == 0) {
+        if (gc_depth == GC_MAX_REGIONS) {
+            xly_write_stderr("[xenly] sys.arenaBegin: too many nested arenas\n");
+            return xly_null();
+        }
+        gc_depth++;
+        return xly_num((double)gc_depth);
+    }
+    if (strcmp(fn, "arenaEnd") == 0) {
+        if (gc_depth == 0) {
+            xly_write_stderr("[xenly] sys.arenaEnd: no arena is open\n");
+            return xly_null();
+        }
+        int region = gc_depth--;
+        XlyThread *t = rt_self;
+        if (!t) return xly_num(0);
+        size_t freed = gc_collect(region, 0);
+        if (gc.off) {                   /* nothing swept: pass the chunks on */
+            pthread_mutex_lock(&rt_lock);
+            for (int k = 0; k < gc.nchunks; k++)
+                if (gc.chunks[k]->region == region && gc.chunks[k]->owner == t)
+                    gc.chunks[k]->region = region - 1;
+            pthread_mutex_unlock(&rt_lock);
+        }
+        if (!t->space[region - 1].bump) t->space[region - 1].bump = t->space[region].bump;
+        t->space[region].bump = NULL;
+        return xly_num((double)freed);
+    }
+    return NULL;
 }
@@ -15,7 +15,9 @@
  *
  * Every Xenly value at runtime is an opaque pointer to an XlyVal on the heap.
  * The runtime owns all allocation.  Compiled code never touches struct
- * internals directly; it only calls the functions declared here.
+ * internals directly; it only calls the functions declared here (class
+ * descriptors and instance fields are the exception, see XlyClass, as are
+ * a variant's tag id and fields, read by match; see xly_make_variant).
  *
  * Calling convention: System V AMD64 / AAPCS64.
  *
@@ -43,7 +45,7 @@ XlyVal *xly_num(double n);
 XlyVal *xly_str(const char *s);     /* copies s            */
 XlyVal *xly_bool(int b);            /* 0 or 1              */
 XlyVal *xly_null(void);
-XlyVal *xly_make_variant(XlyVal *tag, XlyVal **fields, int nfields);
+XlyVal *xly_make_variant(XlyVal *tag, XlyVal **fields, int nfields, int tag_id);
 
 /* ── arithmetic / comparison  (both args must be valid XlyVal*) ────────────── */
 XlyVal *xly_add(XlyVal *a, XlyVal *b);   /* num+num  or  str concat */
@@ -174,12 +176,45 @@ XlyVal *xly_index(XlyVal *collection, XlyVal *index_val);
 
 /* ── process exit ────────────────────────────────────────────────────────────── */
 void    xly_exit(int code);   /* calls exit() */
+void    xly_match_fail(int line);   /* no match arm matched: report, exit(1) */
+
+/* ── profile counters (xenlyc --profile-generate) ──────────────────────────────
+ * An instrumented program keeps one XlyProfSite per function entry, branch,
+ * direct call and boxed arithmetic op in its data section and registers the
+ * table on entry (a module unit in its initializer).  At exit the counts are
+ * added to the ones already in the .xeprof file (XENLY_PROFILE_FILE overrides
+ * the path compiled in): one "<count0> <count1> <key>" line per site.        */
+typedef struct { uint64_t count[2]; const char *key; } XlyProfSite;
+typedef struct { int64_t nsites; XlyProfSite site[]; } XlyProfTable;
+void    xly_prof_register(const char *path, XlyProfTable *t);
+
+/* ── memory (GARBAGE COLLECTION in xly_rt.c) ───────────────────────────────────
+ * main hands over its globals and its entry stack pointer before anything
+ * else runs, a module unit's initializer its own globals (stack_base NULL);
+ * values are collected from then on.  sys.gc(), sys.arenaBegin() and
+ * sys.arenaEnd() reach the collector through xly_call_module.             */
+void    xly_gc_roots(XlyVal **globals, size_t n, void *stack_base);
+
+/* ── threads and spawn (THREADS in xly_rt.c) ───────────────────────────────────
+ * `spawn f(args)` queues the call for the runtime's worker threads and
+ * yields null; the program's exit waits for every spawned task.  Tasks
+ * run in parallel with main and with each other; what they share they
+ * should pass over channels, as the runtime does not lock program values. */
+XlyVal *xly_spawn(XlyVal *fn_val, XlyVal **args, int argc);
+/* Set while a collection waits for the running threads to stop.  Compiled
+ * code tests it at each loop back edge and function entry and calls
+ * xly_safepoint() when it is set, so loops that never allocate still stop. */
+extern int xly_stopping;
+void    xly_safepoint(void);
 
 /* ── first-class function values ─────────────────────────────────────────────── */
 /* Wrap a raw C function pointer as a VAL_FUNCTION XlyVal* */
 XlyVal *xly_make_fn(void *fp);
 /* Create a closure: fn ptr + captured-variable environment array */
 XlyVal *xly_make_closure(void *fp, XlyVal **env, int env_size);
+/* The same for a body taking a receiver ahead of its params: obj.fn()
+ * passes obj, any other call null */
+XlyVal *xly_make_method(void *fp, XlyVal **env, int env_size);
 /* Get the environment pointer from a closure XlyVal* */
 XlyVal **xly_closure_env(XlyVal *closure);
 /* Call a VAL_FUNCTION XlyVal* with given args */
@@ -190,7 +225,38 @@ XlyVal  *xly_obj_new(void);                                    /* create empty o
 void     xly_obj_set(XlyVal *obj, const char *key, XlyVal *val); /* set field              */
 XlyVal  *xly_obj_get(XlyVal *obj, const char *key);            /* get field (null if miss) */
 XlyVal  *xly_obj_call(XlyVal *obj, const char *method, XlyVal **args, int argc);
-XlyVal  *xly_this(void);                               /* current method receiver */
+/* Keys are atoms: one canonical pointer per name, compared by address.
+ * xenlyc registers the atom slots of its property names and class fields
+ * with xly_atoms at startup (each slot is set to the atom of its text)
+ * and passes the atom straight to the _atom entry points.                */
+const char *xly_atom(const char *s);
+void     xly_atoms(const char **slots, size_t n);
+XlyVal  *xly_obj_get_atom(XlyVal *obj, const char *atom);
+void     xly_obj_set_atom(XlyVal *obj, const char *atom, XlyVal *val);
+
+/* ── classes ────────────────────────────────────────────────────────────────
+ * xenlyc lays out one XlyClass per `class` in the data section of the
+ * compiled program.  fields[] lists the instance fields in slot order; a
+ * subclass repeats its parent's fields first, so a field keeps its slot
+ * down the hierarchy.  vtable[] has one entry per program-wide method
+ * selector (inherited entries copied from the parent, NULL = no such
+ * method) and selectors[] names them.  Methods take the receiver as a
+ * hidden first argument:  XlyVal *method(XlyVal *this, args...).          */
+typedef struct XlyClass {
+    const char              *name;
+    const struct XlyClass   *parent;      /* NULL for a root class         */
+    void                    *init;        /* nearest init, own or inherited */
+    int64_t                  nfields;
+    const char *const       *fields;
+    int64_t                  nslots;      /* length of vtable / selectors  */
+    void *const             *vtable;
+    const char *const       *selectors;
+} XlyClass;
+
+XlyVal  *xly_new(const XlyClass *cls);                         /* fields unassigned */
+XlyVal  *xly_construct(const XlyClass *cls, XlyVal **args, int argc); /* new + init */
+XlyVal  *xly_call_init(const XlyClass *cls, XlyVal *self, XlyVal **args, int argc);
+XlyVal  *xly_instanceof(XlyVal *v, const XlyClass *cls);       /* class chain walk */
 
 /* ── mutable closure capture cells ──────────────────────────────────────────── */
 XlyVal **xly_make_cell(XlyVal *initial);   /* allocate heap cell for mutable capture */
@@ -336,8 +402,12 @@ XlyVal *xly_reflect_define   (XlyVal *obj, XlyVal *key, XlyVal *desc);
 XlyVal *xly_reflect_apply    (XlyVal *fn, XlyVal *args);
 XlyVal *xly_reflect_construct(XlyVal *cls, XlyVal *args);
 
-/* ── Generator runtime helpers ───────────────────────────────────────────── */
-XlyVal *xly_gen_create   (void *fn_ptr, void *env_ptr);
+/* ── Generator runtime helpers ─────────────────────────────────────────────
+ * A `gen fn` body is compiled as a plain function and runs on its own stack.
+ * xly_gen_fn(body) is the value bound to the generator's name; calling it
+ * returns a suspended generator.  xly_for_of_next resumes one up to its
+ * next xly_gen_yield and returns the value yielded, NULL once it is done. */
+XlyVal *xly_gen_fn       (void *body);
 void    xly_gen_yield    (XlyVal *val);
 XlyVal *xly_for_of_next  (XlyVal *iter);
 XlyVal *xly_index_set    (XlyVal *collection, XlyVal *index, XlyVal *val);
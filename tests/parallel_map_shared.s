@@ -0,0 +1,200 @@
+.section .text
+.globl  main
+.globl  _start
+_start:
+    andq    $-16, %rsp
+    subq    $8, %rsp
+main:
+    subq    $8, %rsp
+    leaq    __xly_globals(%rip), %rdi
+    movq    .Lxly_gvar_count(%rip), %rsi
+    leaq    8(%rsp), %rdx
+    call    xly_gc_roots
+    leaq    .Lxly_atoms(%rip), %rdi
+    movq    .Lxly_atom_count(%rip), %rsi
+    call    xly_atoms
+    addq    $8, %rsp
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %r14, -32(%rbp)
+    movq    %r15, -40(%rbp)
+    xorq    %rdi, %rdi
+    movq    $0, %rsi
+    call    xly_array_create
+    movq    %rax, %rbx
+    movq    %rbx, %rax
+    movq    %rax, __xly_globals+0(%rip)
+    movabsq $0x0, %rax
+    movq    %rax, %r12
+    movabsq $0x408f400000000000, %rax
+    movq    %rax, %r13
+    leaq    .Lxly_ir1_k16(%rip), %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir1_k17(%rip), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r14, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_526eb811b28d5cb2(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %rbx, %rax
+    movq    %rax, 0(%rsp)
+    leaq    .Lxly_fn___anon_0(%rip), %rdi
+    movq    %rsp, %rsi
+    movl    $1, %edx
+    call    xly_make_closure
+    addq    $16, %rsp
+    movq    %rax, %r12
+    call    xly_obj_new
+    movq    %rax, %rbx
+    movabsq $0x4024000000000000, %rax
+    movq    %rax, %r14
+    leaq    .Lxly_ir1_k18(%rip), %rax
+    movq    %rax, %r15
+    movq    %rbx, %rdi
+    movq    %r15, %rdx
+    movq    .Lxly_atom_0f838176873c8e22(%rip), %rsi
+    call    xly_obj_set_atom
+    movabsq $0x4020000000000000, %rax
+    movq    %rax, %r15
+    leaq    .Lxly_ir1_k19(%rip), %rax
+    movq    %rax, %r14
+    movq    %rbx, %rdi
+    movq    %r14, %rdx
+    movq    .Lxly_atom_e4dede02383cb9cc(%rip), %rsi
+    call    xly_obj_set_atom
+    subq    $32, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %r12, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 16(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_c8db2ba39df3bb7c(%rip), %rsi
+    movl    $3, %ecx
+    call    xly_call_module
+    addq    $32, %rsp
+    movq    %rax, %r14
+    movq    %r14, %rax
+    movq    %rax, __xly_globals+8(%rip)
+    leaq    .Lxly_str_867a42370d40ee2c(%rip), %rdi
+    call    xly_str
+    movq    %rax, %r13
+    subq    $16, %rsp
+    movq    %r13, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rsp, %rdi
+    movl    $1, %esi
+    call    xly_print
+    addq    $16, %rsp
+    movl    $0, %edi
+    call    xly_exit
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    -32(%rbp), %r14
+    movq    -40(%rbp), %r15
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .rodata
+.balign 16
+.Lxly_ir1_k16:
+    .quad   0, 0x0, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir1_k17:
+    .quad   0, 0x408f400000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir1_k18:
+    .quad   0, 0x4024000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+.Lxly_ir1_k19:
+    .quad   0, 0x4020000000000000, 0, 0, 0xffffffff00000000
+    .space  88
+    .section .text
+
+.Lxly_fn___anon_0:
+    pushq   %rbp
+    movq    %rsp, %rbp
+    subq    $48, %rsp
+    movq    %rbx, -8(%rbp)
+    movq    %r12, -16(%rbp)
+    movq    %r13, -24(%rbp)
+    movq    %rdi, -32(%rbp)
+    movq    %rsi, %rbx
+    movq    -32(%rbp), %rax
+    movq    0(%rax), %rax
+    movq    %rax, %r12
+    subq    $16, %rsp
+    movq    %r12, %rax
+    movq    %rax, 0(%rsp)
+    movq    %rbx, %rax
+    movq    %rax, 8(%rsp)
+    movq    %rsp, %rdx
+    leaq    .Lxly_str_4f9e14b634c6b026(%rip), %rdi
+    leaq    .Lxly_str_6c80030e2762459d(%rip), %rsi
+    movl    $2, %ecx
+    call    xly_call_module
+    addq    $16, %rsp
+    movq    %rax, %r13
+    movq    %rbx, %rax
+    movq    -8(%rbp), %rbx
+    movq    -16(%rbp), %r12
+    movq    -24(%rbp), %r13
+    movq    %rbp, %rsp
+    popq    %rbp
+    ret
+
+.section .data
+.balign 8
+.Lxly_atom_count:
+    .quad   2
+.Lxly_atoms:
+.Lxly_atom_0f838176873c8e22:
+    .quad   .Lxly_str_0f838176873c8e22
+.Lxly_atom_e4dede02383cb9cc:
+    .quad   .Lxly_str_e4dede02383cb9cc
+
+.section .rodata
+.Lxly_str_4f9e14b634c6b026:
+    .asciz  "array"
+.Lxly_str_526eb811b28d5cb2:
+    .asciz  "range"
+.Lxly_str_c8db2ba39df3bb7c:
+    .asciz  "parallelMap"
+.Lxly_str_867a42370d40ee2c:
+    .asciz  "not reached"
+.Lxly_str_6c80030e2762459d:
+    .asciz  "push"
+.Lxly_str_0f838176873c8e22:
+    .asciz  "chunk"
+.Lxly_str_e4dede02383cb9cc:
+    .asciz  "workers"
+
+.section .note.GNU-stack,"",@progbits
+
+.section .rodata
+.balign 8
+.Lxly_gvar_count:
+    .quad   2
+
+.section .bss
+.globl  __xly_globals
+.balign 8
+__xly_globals:
+    .zero   16
@@ -0,0 +1,73 @@
+#!/bin/sh
+# Golden-output tests (make test): tests/<name>.xe must print exactly
+# tests/<name>.out on stdout, under the interpreter (with the JIT on, off
+# and compiling every function on its first call) and compiled by xenlyc
+# at -O0 through -O3.  A first line "// test: interp" keeps a test to the
+# interpreter, for features xenlyc does not compile, "// test: compiled"
+# to xenlyc, for ones the interpreter does not run, and "// test: O2" to
+# xenlyc -O2, for what only its optimizations make work (deep tail
+# calls); "exit=N" on that line expects the program to exit with N (an
+# error case).  "// test: pgo" also builds the test with
+# --profile-generate, runs it to write a profile, and checks the -O2
+# build that uses it.
+#
+# usage: tests/run.sh [xenly] [xenlyc]
+
+XENLY=${1:-./xenly}
+XENLYC=${2:-./xenlyc}
+TMP=${TMPDIR:-/tmp}/xenly-test.$$
+trap 'rm -f "$TMP".out "$TMP".bin "$TMP".xeprof' EXIT
+
+fails=0
+check() {   # name, mode, command...
+    name=$1 mode=$2
+    shift 2
+    "$@" > "$TMP.out" 2>/dev/null </dev/null
+    rc=$?
+    if [ "$rc" -ne "$want_rc" ]; then
+        echo "✗ $name ($mode): exited with $rc"
+        fails=$((fails + 1))
+    elif ! cmp -s "tests/$name.out" "$TMP.out"; then
+        echo "✗ $name ($mode): output differs"
+        diff "tests/$name.out" "$TMP.out" | head -10
+        fails=$((fails + 1))
+    fi
+}
+
+for src in tests/*.xe; do
+    name=$(basename "$src" .xe)
+    before=$fails
+    want_rc=$(head -n 1 "$src" | sed -n 's/^\/\/ test:.*exit=\([0-9]*\).*/\1/p')
+    want_rc=${want_rc:-0}
+    levels="0 1 2 3"
+    head -n 1 "$src" | grep -q '^// test: O2' && levels=2
+    if ! head -n 1 "$src" | grep -q '^// test: \(compiled\|O2\)'; then
+        check "$name" interp "$XENLY" "$src"
+        check "$name" jit=off "$XENLY" --jit=off "$src"
+        check "$name" jit=1 "$XENLY" --jit-threshold=1 "$src"
+    fi
+    head -n 1 "$src" | grep -q '^// test: interp' || for o in $levels; do
+        if "$XENLYC" --no-color --opt $o "$src" -o "$TMP.bin" > "$TMP.out" 2>&1; then
+            check "$name" "-O$o" "$TMP.bin"
+        else
+            echo "✗ $name (-O$o): does not compile"
+            sed 's/^/    /' "$TMP.out" | head -10
+            fails=$((fails + 1))
+        fi
+    done
+    if head -n 1 "$src" | grep -q '^// test: pgo'; then
+        rm -f "$TMP.xeprof"
+        for prof in "--profile-generate=$TMP.xeprof" "--profile-use=$TMP.xeprof"; do
+            mode=${prof%%=*}
+            if "$XENLYC" --no-color --opt 2 "$prof" "$src" -o "$TMP.bin" > "$TMP.out" 2>&1; then
+                check "$name" "$mode" "$TMP.bin"
+            else
+                echo "✗ $name ($mode): does not compile"
+                sed 's/^/    /' "$TMP.out" | head -10
+                fails=$((fails + 1))
+            fi
+        done
+    fi
+    [ "$fails" -eq "$before" ] && echo "✓ $name"
+done
+[ "$fails" -eq 0 ]